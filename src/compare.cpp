@@ -0,0 +1,122 @@
+// Last updated: <2026/10/20 14:24:06 +0900>
+//
+// Pixel comparison of render paths.
+//
+// Alpha is ignored. It depends on blending of each path, and is not shown.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "compare.h"
+#include "pngwrite.h"
+
+// ========================================
+static inline int get_diff(const unsigned char *a, const unsigned char *b)
+{
+    int d = 0;
+    for (int c = 0; c < 3; c++)
+    {
+        int v = abs(a[c] - b[c]);
+        if (v > d)
+            d = v;
+    }
+    return d;
+}
+
+void compare_rgba(const unsigned char *ref, const unsigned char *img, int w, int h, int tol, COMPARE_RESULT *r)
+{
+    long sum = 0;
+    r->bad = 0;
+    r->maxd = 0;
+
+    for (int i = 0; i < w * h; i++)
+    {
+        const unsigned char *a = ref + i * 4;
+        const unsigned char *b = img + i * 4;
+        sum += abs(a[0] - b[0]) + abs(a[1] - b[1]) + abs(a[2] - b[2]);
+
+        int d = get_diff(a, b);
+        if (d > r->maxd)
+            r->maxd = d;
+        if (d > tol)
+            r->bad++;
+    }
+    r->mean = (double)sum / (w * h * 3);
+}
+
+// mean of n x n pixels into dst of (w / n) x (h / n). rest of rows and columns are dropped.
+// filtered paths are compared after this, so that edges moved in a pixel match
+void compare_downsample(const unsigned char *src, int w, int h, int n, unsigned char *dst)
+{
+    int dw = w / n;
+    int dh = h / n;
+    for (int y = 0; y < dh; y++)
+    {
+        for (int x = 0; x < dw; x++)
+        {
+            int sum[4] = {0, 0, 0, 0};
+            for (int j = 0; j < n; j++)
+            {
+                const unsigned char *s = src + ((y * n + j) * w + x * n) * 4;
+                for (int i = 0; i < n * 4; i++)
+                    sum[i & 3] += s[i];
+            }
+            unsigned char *d = dst + (y * dw + x) * 4;
+            for (int c = 0; c < 4; c++)
+                d[c] = (sum[c] + n * n / 2) / (n * n);
+        }
+    }
+}
+
+// PNG of dark gray reference with red pixels over tolerance. return 0 if failed
+int compare_write_diff(const char *path, const unsigned char *ref, const unsigned char *img, int w, int h, int tol)
+{
+    unsigned char *o = (unsigned char *)malloc(w * h * 4);
+
+    for (int i = 0; i < w * h; i++)
+    {
+        const unsigned char *a = ref + i * 4;
+        unsigned char *p = o + i * 4;
+        if (get_diff(a, img + i * 4) > tol)
+        {
+            p[0] = 255;
+            p[1] = 0;
+            p[2] = 0;
+        }
+        else
+        {
+            int g = (a[0] + a[1] + a[2]) / 9;
+            p[0] = g;
+            p[1] = g;
+            p[2] = g;
+        }
+        p[3] = 255;
+    }
+
+    int ok = png_write_rgba(path, o, w, h, 1);
+    free(o);
+    return ok;
+}
+
+// return 0 if file does not exist or size is different
+int compare_load_ref(const char *path, unsigned char *rgba, int size)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL)
+        return 0;
+
+    int ok = (fread(rgba, 1, size, fp) == (size_t)size && fgetc(fp) == EOF);
+    fclose(fp);
+    return ok;
+}
+
+int compare_save_ref(const char *path, const unsigned char *rgba, int size)
+{
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL)
+        return 0;
+
+    int ok = (fwrite(rgba, 1, size, fp) == (size_t)size);
+    if (fclose(fp) != 0)
+        ok = 0;
+    return ok;
+}
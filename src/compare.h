@@ -0,0 +1,26 @@
+// Last updated: <2026/10/20 14:24:06 +0900>
+//
+// Pixel comparison of render paths. The same deterministic frame is drawn
+// by each path, and compared with the reference frame per channel.
+// Reference frames are kept as raw RGBA files (bottom row first), so
+// paths of other processes (renderer, OpenGL version) can be compared too.
+
+#ifndef __COMPARE_H__
+#define __COMPARE_H__
+
+typedef struct compare_result
+{
+    int bad;     // pixels with difference over tolerance
+    int maxd;    // max difference of channels
+    double mean; // mean difference of channels
+} COMPARE_RESULT;
+
+// ----------------------------------------
+// prototype declaration
+void compare_rgba(const unsigned char *ref, const unsigned char *img, int w, int h, int tol, COMPARE_RESULT *r);
+int compare_write_diff(const char *path, const unsigned char *ref, const unsigned char *img, int w, int h, int tol);
+void compare_downsample(const unsigned char *src, int w, int h, int n, unsigned char *dst);
+int compare_load_ref(const char *path, unsigned char *rgba, int size);
+int compare_save_ref(const char *path, const unsigned char *rgba, int size);
+
+#endif
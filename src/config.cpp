@@ -0,0 +1,191 @@
+// Last updated: <2026/10/20 14:40:12 +0900>
+//
+// Config file of glfw version.
+//
+// Lines are turned into command line arguments ("-key", "value"), and
+// parsed by the same code as command line. Strings are kept until exit.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "config.h"
+
+// ----------------------------------------
+// prototype declaration
+static int file_exists(const char *path);
+static char *trim(char *s);
+static void push_arg(int *argc, char ***argv, int *max, const char *s);
+static int push_ini_arg(int *argc, char ***argv, int *max, const char *key, const char *val);
+
+// ========================================
+static int file_exists(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+        return 0;
+    fclose(fp);
+    return 1;
+}
+
+// remove spaces of both ends
+static char *trim(char *s)
+{
+    while (*s && isspace((unsigned char)*s))
+        s++;
+    int len = strlen(s);
+    while (len > 0 && isspace((unsigned char)s[len - 1]))
+        s[--len] = '\0';
+    return s;
+}
+
+static void push_arg(int *argc, char ***argv, int *max, const char *s)
+{
+    if (*argc >= *max)
+    {
+        *max = (*max > 0) ? *max * 2 : 32;
+        *argv = (char **)realloc(*argv, sizeof(char *) * *max);
+    }
+    (*argv)[(*argc)++] = strdup(s);
+}
+
+// key of ini file of Windows version as option. return 0 if key is not one of them
+static int push_ini_arg(int *argc, char ***argv, int *max, const char *key, const char *val)
+{
+    char buf[32];
+    if (strcmp(key, "wait") == 0)
+    {
+        int ms = atoi(val);
+        snprintf(buf, sizeof(buf), "%g", 1000.0 / ((ms > 0) ? ms : 1));
+        push_arg(argc, argv, max, "-framerate");
+        push_arg(argc, argv, max, buf);
+        return 1;
+    }
+    if (strcmp(key, "fps") == 0)
+    {
+        push_arg(argc, argv, max, "-fps");
+        push_arg(argc, argv, max, (atoi(val) != 0) ? "on" : "off");
+        return 1;
+    }
+    return 0;
+}
+
+// path of existing config file. return 0 if not found
+int config_find_path(char *path, int size)
+{
+#ifdef _WIN32
+    const char *appdata = getenv("APPDATA");
+    if (appdata && *appdata)
+    {
+        snprintf(path, size, "%s\\%s\\%s", appdata, CONFIG_DIR, CONFIG_FILENAME);
+        if (file_exists(path))
+            return 1;
+    }
+#else
+    // user config. relative path in environment variable is ignored (XDG base directory)
+    const char *home = getenv("XDG_CONFIG_HOME");
+    if (home && home[0] == '/')
+        snprintf(path, size, "%s/%s/%s", home, CONFIG_DIR, CONFIG_FILENAME);
+    else if ((home = getenv("HOME")) != NULL && *home)
+        snprintf(path, size, "%s/.config/%s/%s", home, CONFIG_DIR, CONFIG_FILENAME);
+    else
+        path[0] = '\0';
+    if (path[0] && file_exists(path))
+        return 1;
+
+    // system config. directories separated by ':'
+    const char *dirs = getenv("XDG_CONFIG_DIRS");
+    if (dirs == NULL || *dirs == '\0')
+        dirs = "/etc/xdg";
+    while (*dirs)
+    {
+        int len = strcspn(dirs, ":");
+        if (len > 0 && dirs[0] == '/')
+        {
+            snprintf(path, size, "%.*s/%s/%s", len, dirs, CONFIG_DIR, CONFIG_FILENAME);
+            if (file_exists(path))
+                return 1;
+        }
+        dirs += len;
+        if (*dirs == ':')
+            dirs++;
+    }
+#endif
+    path[0] = '\0';
+    return 0;
+}
+
+// append options of config file to argc / argv. return 0 if file cannot be read
+int config_load(const char *path, int *argc, char ***argv)
+{
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+        return 0;
+
+    int max = *argc;
+    char line[CONFIG_LINE_MAX];
+    while (fgets(line, sizeof(line), fp))
+    {
+        char *key = trim(line);
+        if (*key == '\0' || *key == '#' || *key == ';' || *key == '[')
+            continue;
+
+        // key and value are separated by '=' or space
+        char *val = key + strcspn(key, "= \t");
+        if (*val)
+        {
+            *val++ = '\0';
+            key = trim(key);
+            val = trim(val);
+            if (*val == '=')
+                val = trim(val + 1);
+        }
+
+        if (push_ini_arg(argc, argv, &max, key, val))
+            continue;
+
+        char opt[CONFIG_LINE_MAX + 1];
+        snprintf(opt, sizeof(opt), "%s%s", (key[0] == '-') ? "" : "-", key);
+        push_arg(argc, argv, &max, opt);
+        if (*val)
+            push_arg(argc, argv, &max, val);
+    }
+    fclose(fp);
+    return 1;
+}
+
+// replace argc / argv with program name + options of config file + command line.
+// "-config FILE" of command line selects config file. return 0 if it cannot be read
+int config_merge_args(int *argc, char ***argv)
+{
+    char path[CONFIG_PATH_MAX];
+    int found = 0;
+    for (int i = 1; i + 1 < *argc; i++)
+    {
+        if (strcmp((*argv)[i], "-config") == 0)
+        {
+            snprintf(path, sizeof(path), "%s", (*argv)[i + 1]);
+            found = 1;
+        }
+    }
+    if (!found && !config_find_path(path, sizeof(path)))
+        return 1;
+
+    int n = 1;
+    char **args = (char **)malloc(sizeof(char *));
+    args[0] = (*argv)[0];
+    if (!config_load(path, &n, &args))
+    {
+        fprintf(stderr, "Error: Could not read %s\n", path);
+        free(args);
+        return 0;
+    }
+
+    args = (char **)realloc(args, sizeof(char *) * (n + *argc));
+    for (int i = 1; i < *argc; i++)
+        args[n++] = (*argv)[i];
+    args[n] = NULL;
+    *argc = n;
+    *argv = args;
+    return 1;
+}
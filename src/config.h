@@ -0,0 +1,33 @@
+// Last updated: <2026/10/20 14:40:12 +0900>
+//
+// Config file of glfw version. Each line is a command line option without
+// "-", and value after space or "=" :
+//
+//   framerate 30
+//   size=1920x1080
+//   painter
+//
+// '#' or ';' at line start is comment, and [section] is ignored. Keys of ini
+// file of Windows version are read as options : wait=N (ms) is framerate 1000 / N,
+// fps=0 / 1 is fps off / on. Options of config file come before options of
+// command line, so command line overrides them.
+//
+// Linux : $XDG_CONFIG_HOME/ssisoroadgl/ssisoroadglfw.conf (default ~/.config),
+// then $XDG_CONFIG_DIRS (default /etc/xdg). Windows : %APPDATA%\ssisoroadgl
+
+#ifndef __CONFIG_H__
+#define __CONFIG_H__
+
+#define CONFIG_DIR "ssisoroadgl"
+#define CONFIG_FILENAME "ssisoroadglfw.conf"
+
+#define CONFIG_PATH_MAX 1024
+#define CONFIG_LINE_MAX 1024
+
+// ----------------------------------------
+// prototype declaration
+int config_find_path(char *path, int size);
+int config_load(const char *path, int *argc, char ***argv);
+int config_merge_args(int *argc, char ***argv);
+
+#endif
@@ -0,0 +1,15 @@
+// Last updated: <2026/10/20 13:44:20 +0900>
+//
+// Course data. Control points of the courses, compiled once in coursedata.cpp,
+// so that render.cpp does not recompile them.
+
+#ifndef __COURSEDATA_H__
+#define __COURSEDATA_H__
+
+#define COURSE_MAX 4
+
+extern const double (*course_ctrl[COURSE_MAX])[2];
+extern const int course_ctrl_num[COURSE_MAX];
+extern const char *course_name[COURSE_MAX];
+
+#endif
@@ -0,0 +1,85 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Frame time graph
+
+#include <string.h>
+#include "framegraph.h"
+
+// colors of stages. same order as framestat.h
+static const unsigned char stage_col[FRAMESTAT_STAGE_MAX][4] = {
+    {160, 160, 255, 255}, // update
+    {64, 128, 255, 255},  // roads
+    {64, 200, 64, 255},   // trees
+    {255, 160, 32, 255},  // model
+    {224, 64, 224, 255},  // overlay
+    {255, 255, 64, 255},  // swap
+};
+
+static const unsigned char back_col[4] = {0, 0, 0, 160};
+static const unsigned char interval_col[4] = {96, 96, 96, 255};
+static const unsigned char budget_col[4] = {0, 255, 0, 255};
+static const unsigned char miss_col[4] = {255, 0, 0, 255};
+
+// ----------------------------------------
+// prototype declaration
+static FRAMEGRAPH_VTX *add_quad(FRAMEGRAPH_VTX *v, float x0, float y0, float x1, float y1, const unsigned char col[4]);
+
+// ========================================
+static FRAMEGRAPH_VTX *add_quad(FRAMEGRAPH_VTX *v, float x0, float y0, float x1, float y1, const unsigned char col[4])
+{
+    const float p[6][2] = {{x0, y0}, {x1, y0}, {x0, y1}, {x0, y1}, {x1, y0}, {x1, y1}};
+    for (int i = 0; i < 6; i++)
+    {
+        v[i].x = p[i][0];
+        v[i].y = p[i][1];
+        memcpy(v[i].col, col, 4);
+    }
+    return v + 6;
+}
+
+// triangles of graph at (x, y) - (x + w, y + h) in pixels, y up. budget : 1 / framerate (sec).
+// v : FRAMEGRAPH_VTX_MAX vertices. return number of vertices
+int framegraph_build(const FRAMESTAT *f, float budget, float x, float y, float w, float h, FRAMEGRAPH_VTX *v)
+{
+    FRAMEGRAPH_VTX *p = v;
+    float top = budget * FRAMEGRAPH_RANGE;
+    float sy = (top > 0.0) ? h / top : 0.0;
+    float step = w / FRAMESTAT_HIST;
+
+    p = add_quad(p, x, y, x + w, y + h, back_col);
+
+    // newest frame at right end. empty quads are skipped
+    for (int age = 0; age < FRAMESTAT_HIST; age++)
+    {
+        float interval;
+        float stage[FRAMESTAT_STAGE_MAX];
+        if (!framestat_get_frame(f, age, &interval, stage))
+            break;
+
+        float x1 = x + w - step * age;
+        float x0 = x1 - step;
+        float yi = (interval < top) ? y + interval * sy : y + h;
+        if (yi > y)
+            p = add_quad(p, x0, y, x1, yi, interval_col);
+
+        float y0 = y;
+        for (int i = 0; i < FRAMESTAT_STAGE_MAX && y0 < y + h; i++)
+        {
+            float y1 = y0 + stage[i] * sy;
+            if (y1 > y + h)
+                y1 = y + h;
+            if (y1 > y0)
+                p = add_quad(p, x0, y0, x1, y1, stage_col[i]);
+            y0 = y1;
+        }
+    }
+
+    // lines over bars
+    float yb = y + budget * sy;
+    float ym = y + budget * FRAMESTAT_MISS * sy;
+    p = add_quad(p, x, yb, x + w, yb + 1.0, budget_col);
+    if (ym < y + h)
+        p = add_quad(p, x, ym, x + w, ym + 1.0, miss_col);
+
+    return p - v;
+}
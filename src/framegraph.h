@@ -0,0 +1,32 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Frame time graph. Makes colored triangles of the frames in FRAMESTAT
+// history, so the whole graph is one vertex array and one draw call.
+//
+// Each frame is a column. Gray = frame interval, and stacked on it the
+// CPU time of each stage (update, roads, trees, model, overlay, swap).
+// Lines of frame budget (green) and missed frame (red, FRAMESTAT_MISS).
+
+#ifndef __FRAMEGRAPH_H__
+#define __FRAMEGRAPH_H__
+
+#include "framestat.h"
+
+// top of graph = budget * this
+#define FRAMEGRAPH_RANGE 2.0
+
+// background, budget lines, and interval + stages of each frame. 6 vertices per quad
+#define FRAMEGRAPH_VTX_MAX ((3 + FRAMESTAT_HIST * (1 + FRAMESTAT_STAGE_MAX)) * 6)
+
+// pixel position and RGBA color. 12 bytes
+typedef struct framegraph_vtx
+{
+    float x, y;
+    unsigned char col[4];
+} FRAMEGRAPH_VTX;
+
+// ----------------------------------------
+// prototype declaration
+int framegraph_build(const FRAMESTAT *f, float budget, float x, float y, float w, float h, FRAMEGRAPH_VTX *v);
+
+#endif
@@ -0,0 +1,89 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Frame statistics
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "framestat.h"
+
+// ----------------------------------------
+// prototype declaration
+static int cmp_float(const void *a, const void *b);
+
+// ========================================
+static int cmp_float(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+void framestat_init(FRAMESTAT *f)
+{
+    memset(f, 0, sizeof(FRAMESTAT));
+}
+
+// add time from last mark to stage. now : current time (sec)
+void framestat_mark(FRAMESTAT *f, int stage, double now)
+{
+    if (f->mark > 0.0 && now > f->mark)
+        f->stage[stage] += now - f->mark;
+    f->mark = now;
+}
+
+// interval : time from last frame, budget : 1 / framerate, now : current time (sec).
+// next stage starts from now, so sleep of frame rate control is not counted
+void framestat_end_frame(FRAMESTAT *f, float interval, float budget, double now)
+{
+    f->mark = now;
+    memcpy(f->last, f->stage, sizeof(f->last));
+    memset(f->stage, 0, sizeof(f->stage));
+
+    f->hist[f->head] = interval;
+    memcpy(f->stage_hist[f->head], f->last, sizeof(f->last));
+    f->head = (f->head + 1) % FRAMESTAT_HIST;
+    if (f->num < FRAMESTAT_HIST)
+        f->num++;
+
+    f->frames++;
+    if (interval > budget * FRAMESTAT_MISS)
+        f->misses++;
+}
+
+// frame of age (0 = last frame) in history. stage : FRAMESTAT_STAGE_MAX floats or NULL.
+// return 0 if not in history
+int framestat_get_frame(const FRAMESTAT *f, int age, float *interval, float *stage)
+{
+    if (age < 0 || age >= f->num)
+        return 0;
+
+    int i = (f->head - 1 - age + FRAMESTAT_HIST) % FRAMESTAT_HIST;
+    *interval = f->hist[i];
+    if (stage)
+        memcpy(stage, f->stage_hist[i], sizeof(f->stage_hist[i]));
+    return 1;
+}
+
+// frame intervals of percentiles p[n] (0 - 100) into out[n] (sec). nearest rank
+void framestat_get_percentiles(const FRAMESTAT *f, const float *p, int n, float *out)
+{
+    float v[FRAMESTAT_HIST];
+    memcpy(v, f->hist, sizeof(float) * f->num);
+    qsort(v, f->num, sizeof(float), cmp_float);
+
+    for (int i = 0; i < n; i++)
+    {
+        if (f->num <= 0)
+        {
+            out[i] = 0.0;
+            continue;
+        }
+        int k = (int)ceil(p[i] / 100.0 * f->num) - 1;
+        if (k < 0)
+            k = 0;
+        if (k >= f->num)
+            k = f->num - 1;
+        out[i] = v[k];
+    }
+}
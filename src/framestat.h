@@ -0,0 +1,51 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Frame statistics. CPU time of each stage of a frame, history of frame
+// intervals for percentiles, and frames over the frame budget.
+//
+// OpenGL commands are asynchronous, so stage times are the time to submit
+// them. Time the GPU needs shows up in swap.
+
+#ifndef __FRAMESTAT_H__
+#define __FRAMESTAT_H__
+
+// stages of frame
+enum
+{
+    FRAMESTAT_UPDATE,  // update of views
+    FRAMESTAT_ROADS,   // clear, shadows, roads, white lines (or tiles)
+    FRAMESTAT_TREES,   // trees
+    FRAMESTAT_MODEL,   // player and traffic
+    FRAMESTAT_OVERLAY, // heatmap, fade, upscale and text
+    FRAMESTAT_SWAP,    // end of drawing - next frame, without sleep of frame rate control
+    FRAMESTAT_STAGE_MAX,
+};
+
+// frame intervals in history
+#define FRAMESTAT_HIST 256
+
+// frame interval over budget * this is a missed frame
+#define FRAMESTAT_MISS 1.5
+
+typedef struct framestat
+{
+    double mark;                     // end of last stage (sec)
+    float stage[FRAMESTAT_STAGE_MAX]; // stages of current frame (sec)
+    float last[FRAMESTAT_STAGE_MAX];  // stages of last frame (sec)
+    float hist[FRAMESTAT_HIST];      // frame intervals (sec)
+    float stage_hist[FRAMESTAT_HIST][FRAMESTAT_STAGE_MAX]; // stages of frames in hist (sec)
+    int head;                        // next entry of hist
+    int num;                         // entries of hist
+    unsigned int frames;
+    unsigned int misses; // frames over budget
+} FRAMESTAT;
+
+// ----------------------------------------
+// prototype declaration
+void framestat_init(FRAMESTAT *f);
+void framestat_mark(FRAMESTAT *f, int stage, double now);
+void framestat_end_frame(FRAMESTAT *f, float interval, float budget, double now);
+void framestat_get_percentiles(const FRAMESTAT *f, const float *p, int n, float *out);
+int framestat_get_frame(const FRAMESTAT *f, int age, float *interval, float *stage);
+
+#endif
@@ -0,0 +1,1136 @@
+// Last updated: <2026/10/20 09:31:52 +0900>
+//
+// Capture of OpenGL command stream. See glcapture.h.
+//
+// Every wrapper checks one pointer and calls the real function when
+// capture is not active. Client side arrays are stored at each draw call,
+// the range of elements which the call reads (from first, or min - max
+// index of client side indices).
+
+#define GLCAPTURE_IMPL
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glfunc.h"
+#include "glcapture.h"
+
+// buffer of file writes
+#define WRITE_BUF_SIZE (4 * 1024 * 1024)
+
+#define RESTART_INDEX 0xffffffff
+
+typedef struct client_array
+{
+    int enabled;
+    int client; // pointer is in memory, not in buffer object
+    GLint size;
+    GLenum type;
+    GLsizei stride;
+    const void *ptr;
+} CLIENT_ARRAY;
+
+static FILE *cap_fp = NULL;
+static char *cap_buf = NULL;
+static GLCAPTURE_HEADER cap_header;
+static int cap_frames = 0; // frames to capture
+static long long cap_bytes = 0;
+static int unpack_align = 4;
+static int pack_align = 4;
+static int warned_range = 0;
+static CLIENT_ARRAY arrays[GLCAP_ARRAY_MAX];
+
+// record with words only
+#define REC(op, ...)                                             \
+    do                                                           \
+    {                                                            \
+        if (cap_fp)                                              \
+        {                                                        \
+            const uint32_t w_[] = {__VA_ARGS__};                 \
+            put(op, w_, sizeof(w_) / sizeof(uint32_t), NULL, 0); \
+        }                                                        \
+    } while (0)
+
+// ----------------------------------------
+// prototype declaration
+static void put(int op, const uint32_t *w, int n, const void *data, uint32_t size);
+static uint32_t fw(float f);
+static uint32_t lo(uint64_t v);
+static uint32_t hi(uint64_t v);
+static uint64_t dw(double d);
+static void put_names(int op, GLsizei n, const GLuint *names);
+static int array_kind(GLenum array);
+static int type_bytes(GLenum type);
+static int bound_buffer(GLenum binding);
+static void set_array(int kind, GLint size, GLenum type, GLsizei stride, const void *ptr);
+static void put_client_arrays(GLint first, GLsizei count);
+static void put_index_range(GLsizei count, GLenum type, const void *indices);
+
+// ========================================
+static void put(int op, const uint32_t *w, int n, const void *data, uint32_t size)
+{
+    GLCAPTURE_REC r;
+    r.op = op;
+    r.words = n;
+    r.size = size;
+
+    static const unsigned char pad[4] = {0, 0, 0, 0};
+    int npad = (4 - (size & 3)) & 3;
+    int ok = (fwrite(&r, sizeof(r), 1, cap_fp) == 1);
+    if (ok && n > 0)
+        ok = (fwrite(w, sizeof(uint32_t), n, cap_fp) == (size_t)n);
+    if (ok && size > 0)
+        ok = (fwrite(data, 1, size, cap_fp) == size);
+    if (ok && npad > 0)
+        ok = (fwrite(pad, 1, npad, cap_fp) == (size_t)npad);
+    cap_bytes += sizeof(r) + sizeof(uint32_t) * n + size + npad;
+
+    if (!ok)
+    {
+        fprintf(stderr, "Error: Could not write capture file\n");
+        glcapture_stop();
+    }
+}
+
+static uint32_t fw(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static uint32_t lo(uint64_t v)
+{
+    return (uint32_t)v;
+}
+
+static uint32_t hi(uint64_t v)
+{
+    return (uint32_t)(v >> 32);
+}
+
+static uint64_t dw(double d)
+{
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+    return u;
+}
+
+static void put_names(int op, GLsizei n, const GLuint *names)
+{
+    uint32_t w[GLCAPTURE_WORD_MAX];
+    int i = 0;
+    while (i < n)
+    {
+        // long lists are split
+        int k = 0;
+        w[k++] = 0;
+        while (i < n && k < GLCAPTURE_WORD_MAX)
+            w[k++] = names[i++];
+        w[0] = k - 1;
+        put(op, w, k, NULL, 0);
+    }
+}
+
+static int array_kind(GLenum array)
+{
+    switch (array)
+    {
+    case GL_VERTEX_ARRAY:
+        return GLCAP_ARRAY_VERTEX;
+    case GL_NORMAL_ARRAY:
+        return GLCAP_ARRAY_NORMAL;
+    case GL_COLOR_ARRAY:
+        return GLCAP_ARRAY_COLOR;
+    case GL_TEXTURE_COORD_ARRAY:
+        return GLCAP_ARRAY_TEXCOORD;
+    }
+    return -1;
+}
+
+static int type_bytes(GLenum type)
+{
+    switch (type)
+    {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+        return 2;
+    case GL_DOUBLE:
+        return 8;
+    }
+    return 4;
+}
+
+// buffer object bound to binding point. 0 = client memory
+static int bound_buffer(GLenum binding)
+{
+    if (!glf_has_vbo)
+        return 0;
+    GLint b = 0;
+    glGetIntegerv(binding, &b);
+    return b;
+}
+
+static void set_array(int kind, GLint size, GLenum type, GLsizei stride, const void *ptr)
+{
+    CLIENT_ARRAY *a = &arrays[kind];
+    a->client = (bound_buffer(GL_ARRAY_BUFFER_BINDING) == 0);
+    a->size = size;
+    a->type = type;
+    a->stride = stride;
+    a->ptr = ptr;
+
+    uint64_t p = (uint64_t)(size_t)ptr;
+    REC(GLCAP_ARRAY_POINTER, (uint32_t)kind, (uint32_t)size, type, (uint32_t)stride, (uint32_t)a->client, lo(p), hi(p));
+}
+
+// elements first - first + count - 1 of enabled client side arrays
+static void put_client_arrays(GLint first, GLsizei count)
+{
+    if (count <= 0)
+        return;
+
+    for (int kind = 0; kind < GLCAP_ARRAY_MAX; kind++)
+    {
+        const CLIENT_ARRAY *a = &arrays[kind];
+        if (!a->enabled || !a->client || a->ptr == NULL)
+            continue;
+
+        int elem = a->size * type_bytes(a->type);
+        int stride = (a->stride > 0) ? a->stride : elem;
+        uint32_t size = stride * (count - 1) + elem;
+        const uint32_t w[5] = {(uint32_t)kind, (uint32_t)a->size, a->type, (uint32_t)a->stride, (uint32_t)first};
+        put(GLCAP_CLIENT_ARRAY, w, 5, (const char *)a->ptr + (size_t)stride * first, size);
+        if (cap_fp == NULL)
+            return;
+    }
+}
+
+// client side arrays for indices in memory
+static void put_index_range(GLsizei count, GLenum type, const void *indices)
+{
+    int any = 0;
+    for (int kind = 0; kind < GLCAP_ARRAY_MAX; kind++)
+        any |= (arrays[kind].enabled && arrays[kind].client);
+    if (!any || count <= 0)
+        return;
+
+    uint32_t vmin = 0xffffffff;
+    uint32_t vmax = 0;
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t v;
+        if (type == GL_UNSIGNED_BYTE)
+            v = ((const GLubyte *)indices)[i];
+        else if (type == GL_UNSIGNED_SHORT)
+            v = ((const GLushort *)indices)[i];
+        else
+            v = ((const GLuint *)indices)[i];
+        if (v == RESTART_INDEX)
+            continue;
+        if (v < vmin)
+            vmin = v;
+        if (v > vmax)
+            vmax = v;
+    }
+    if (vmin <= vmax)
+        put_client_arrays(vmin, vmax - vmin + 1);
+}
+
+// start capture into path. frames : frames until glcapture_end_frame() returns 0.
+// call before OpenGL objects are made, replay needs all of them. return 0 if failed
+int glcapture_start(const char *path, int frames, int width, int height, int core)
+{
+    glcapture_stop();
+
+    cap_fp = fopen(path, "wb");
+    if (cap_fp == NULL)
+        return 0;
+    cap_buf = (char *)malloc(WRITE_BUF_SIZE);
+    if (cap_buf)
+        setvbuf(cap_fp, cap_buf, _IOFBF, WRITE_BUF_SIZE);
+
+    memset(&cap_header, 0, sizeof(cap_header));
+    cap_header.magic = GLCAPTURE_MAGIC;
+    cap_header.version = GLCAPTURE_VERSION;
+    cap_header.width = width;
+    cap_header.height = height;
+    cap_header.core = core;
+    cap_frames = frames;
+    cap_bytes = sizeof(cap_header);
+    memset(arrays, 0, sizeof(arrays));
+    warned_range = 0;
+
+    if (fwrite(&cap_header, sizeof(cap_header), 1, cap_fp) != 1)
+    {
+        glcapture_stop();
+        return 0;
+    }
+    return 1;
+}
+
+int glcapture_is_active(void)
+{
+    return (cap_fp != NULL);
+}
+
+// call after swap buffers. return 0 when capture is not active (finished)
+int glcapture_end_frame(void)
+{
+    if (cap_fp == NULL)
+        return 0;
+
+    put(GLCAP_FRAME, NULL, 0, NULL, 0);
+    if (cap_fp == NULL)
+        return 0;
+    cap_header.frames++;
+    if ((int)cap_header.frames >= cap_frames)
+    {
+        glcapture_stop();
+        return 0;
+    }
+    return 1;
+}
+
+// complete header and close file
+void glcapture_stop(void)
+{
+    if (cap_fp == NULL)
+        return;
+
+    FILE *fp = cap_fp;
+    cap_fp = NULL;
+    cap_header.gl_version = glf_version;
+    if (fseek(fp, 0, SEEK_SET) == 0)
+        fwrite(&cap_header, sizeof(cap_header), 1, fp);
+    fclose(fp);
+    free(cap_buf);
+    cap_buf = NULL;
+
+    fprintf(stderr, "capture : %u frames, %.1f MB\n", cap_header.frames, cap_bytes / (1024.0 * 1024.0));
+}
+
+// bytes per pixel. 0 if not supported
+int glcapture_pixel_bytes(GLenum format, GLenum type)
+{
+    int n;
+    switch (format)
+    {
+    case GL_RGBA:
+    case GL_BGRA:
+        n = 4;
+        break;
+    case GL_RGB:
+    case GL_BGR:
+        n = 3;
+        break;
+    case GL_RG:
+    case GL_LUMINANCE_ALPHA:
+        n = 2;
+        break;
+    case GL_RED:
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+    case GL_DEPTH_COMPONENT:
+    case GL_STENCIL_INDEX:
+        n = 1;
+        break;
+    case GL_DEPTH_STENCIL:
+        return 4;
+    default:
+        return 0;
+    }
+    return n * type_bytes(type);
+}
+
+// bytes of image with rows aligned to align bytes
+int glcapture_image_size(int w, int h, GLenum format, GLenum type, int align)
+{
+    int row = w * glcapture_pixel_bytes(format, type);
+    if (align > 1)
+        row = (row + align - 1) / align * align;
+    return row * h;
+}
+
+// floats of glLightfv()
+int glcapture_light_params(GLenum pname)
+{
+    switch (pname)
+    {
+    case GL_AMBIENT:
+    case GL_DIFFUSE:
+    case GL_SPECULAR:
+    case GL_POSITION:
+        return 4;
+    case GL_SPOT_DIRECTION:
+        return 3;
+    }
+    return 1;
+}
+
+// ----------------------------------------
+// wrappers
+
+void glcap_Enable(GLenum cap)
+{
+    REC(GLCAP_ENABLE, cap);
+    glEnable(cap);
+}
+
+void glcap_Disable(GLenum cap)
+{
+    REC(GLCAP_DISABLE, cap);
+    glDisable(cap);
+}
+
+void glcap_EnableClientState(GLenum array)
+{
+    int kind = array_kind(array);
+    if (kind >= 0)
+        arrays[kind].enabled = 1;
+    REC(GLCAP_ENABLE_CLIENT_STATE, array);
+    glEnableClientState(array);
+}
+
+void glcap_DisableClientState(GLenum array)
+{
+    int kind = array_kind(array);
+    if (kind >= 0)
+        arrays[kind].enabled = 0;
+    REC(GLCAP_DISABLE_CLIENT_STATE, array);
+    glDisableClientState(array);
+}
+
+void glcap_VertexPointer(GLint size, GLenum type, GLsizei stride, const void *ptr)
+{
+    if (cap_fp)
+        set_array(GLCAP_ARRAY_VERTEX, size, type, stride, ptr);
+    glVertexPointer(size, type, stride, ptr);
+}
+
+void glcap_NormalPointer(GLenum type, GLsizei stride, const void *ptr)
+{
+    if (cap_fp)
+        set_array(GLCAP_ARRAY_NORMAL, 3, type, stride, ptr);
+    glNormalPointer(type, stride, ptr);
+}
+
+void glcap_ColorPointer(GLint size, GLenum type, GLsizei stride, const void *ptr)
+{
+    if (cap_fp)
+        set_array(GLCAP_ARRAY_COLOR, size, type, stride, ptr);
+    glColorPointer(size, type, stride, ptr);
+}
+
+void glcap_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *ptr)
+{
+    if (cap_fp)
+        set_array(GLCAP_ARRAY_TEXCOORD, size, type, stride, ptr);
+    glTexCoordPointer(size, type, stride, ptr);
+}
+
+void glcap_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (cap_fp)
+    {
+        put_client_arrays(first, count);
+        REC(GLCAP_DRAW_ARRAYS, mode, (uint32_t)first, (uint32_t)count);
+    }
+    glDrawArrays(mode, first, count);
+}
+
+void glcap_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    if (cap_fp)
+    {
+        uint64_t p = (uint64_t)(size_t)indices;
+        if (bound_buffer(GL_ELEMENT_ARRAY_BUFFER_BINDING) == 0)
+        {
+            put_index_range(count, type, indices);
+            const uint32_t w[5] = {mode, (uint32_t)count, type, 1, 0};
+            if (cap_fp)
+                put(GLCAP_DRAW_ELEMENTS, w, 5, indices, count * type_bytes(type));
+        }
+        else
+        {
+            // range of indices in buffer object is unknown
+            for (int kind = 0; kind < GLCAP_ARRAY_MAX; kind++)
+            {
+                if (arrays[kind].enabled && arrays[kind].client && !warned_range)
+                {
+                    fprintf(stderr, "capture : client arrays with index buffer are not recorded\n");
+                    warned_range = 1;
+                }
+            }
+            REC(GLCAP_DRAW_ELEMENTS, mode, (uint32_t)count, type, 0, lo(p), hi(p));
+        }
+    }
+    glDrawElements(mode, count, type, indices);
+}
+
+void glcap_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    if (cap_fp)
+    {
+        put_client_arrays(first, count);
+        REC(GLCAP_DRAW_ARRAYS_INSTANCED, mode, (uint32_t)first, (uint32_t)count, (uint32_t)instancecount);
+    }
+    glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+void glcap_Begin(GLenum mode)
+{
+    REC(GLCAP_BEGIN, mode);
+    glBegin(mode);
+}
+
+void glcap_End(void)
+{
+    if (cap_fp)
+        put(GLCAP_END, NULL, 0, NULL, 0);
+    glEnd();
+}
+
+void glcap_Vertex2f(GLfloat x, GLfloat y)
+{
+    REC(GLCAP_VERTEX2F, fw(x), fw(y));
+    glVertex2f(x, y);
+}
+
+void glcap_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_VERTEX3F, fw(x), fw(y), fw(z));
+    glVertex3f(x, y, z);
+}
+
+void glcap_Vertex2d(GLdouble x, GLdouble y)
+{
+    REC(GLCAP_VERTEX2D, lo(dw(x)), hi(dw(x)), lo(dw(y)), hi(dw(y)));
+    glVertex2d(x, y);
+}
+
+void glcap_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
+{
+    REC(GLCAP_VERTEX3D, lo(dw(x)), hi(dw(x)), lo(dw(y)), hi(dw(y)), lo(dw(z)), hi(dw(z)));
+    glVertex3d(x, y, z);
+}
+
+void glcap_TexCoord2f(GLfloat s, GLfloat t)
+{
+    REC(GLCAP_TEXCOORD2F, fw(s), fw(t));
+    glTexCoord2f(s, t);
+}
+
+void glcap_Color4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    REC(GLCAP_COLOR4F, fw(r), fw(g), fw(b), fw(a));
+    glColor4f(r, g, b, a);
+}
+
+void glcap_Color4fv(const GLfloat *v)
+{
+    REC(GLCAP_COLOR4F, fw(v[0]), fw(v[1]), fw(v[2]), fw(v[3]));
+    glColor4fv(v);
+}
+
+void glcap_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_RASTER_POS3F, fw(x), fw(y), fw(z));
+    glRasterPos3f(x, y, z);
+}
+
+void glcap_Bitmap(GLsizei w, GLsizei h, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap)
+{
+    if (cap_fp)
+    {
+        int row = (w + 7) / 8;
+        row = (row + unpack_align - 1) / unpack_align * unpack_align;
+        const uint32_t wd[6] = {(uint32_t)w, (uint32_t)h, fw(xorig), fw(yorig), fw(xmove), fw(ymove)};
+        put(GLCAP_BITMAP, wd, 6, bitmap, (bitmap) ? row * h : 0);
+    }
+    glBitmap(w, h, xorig, yorig, xmove, ymove, bitmap);
+}
+
+void glcap_MatrixMode(GLenum mode)
+{
+    REC(GLCAP_MATRIX_MODE, mode);
+    glMatrixMode(mode);
+}
+
+void glcap_LoadIdentity(void)
+{
+    if (cap_fp)
+        put(GLCAP_LOAD_IDENTITY, NULL, 0, NULL, 0);
+    glLoadIdentity();
+}
+
+void glcap_PushMatrix(void)
+{
+    if (cap_fp)
+        put(GLCAP_PUSH_MATRIX, NULL, 0, NULL, 0);
+    glPushMatrix();
+}
+
+void glcap_PopMatrix(void)
+{
+    if (cap_fp)
+        put(GLCAP_POP_MATRIX, NULL, 0, NULL, 0);
+    glPopMatrix();
+}
+
+void glcap_Ortho(GLdouble l, GLdouble r, GLdouble b, GLdouble t, GLdouble n, GLdouble f)
+{
+    REC(GLCAP_ORTHO, lo(dw(l)), hi(dw(l)), lo(dw(r)), hi(dw(r)), lo(dw(b)), hi(dw(b)),
+        lo(dw(t)), hi(dw(t)), lo(dw(n)), hi(dw(n)), lo(dw(f)), hi(dw(f)));
+    glOrtho(l, r, b, t, n, f);
+}
+
+void glcap_Translatef(GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_TRANSLATEF, fw(x), fw(y), fw(z));
+    glTranslatef(x, y, z);
+}
+
+void glcap_Translated(GLdouble x, GLdouble y, GLdouble z)
+{
+    REC(GLCAP_TRANSLATED, lo(dw(x)), hi(dw(x)), lo(dw(y)), hi(dw(y)), lo(dw(z)), hi(dw(z)));
+    glTranslated(x, y, z);
+}
+
+void glcap_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_ROTATEF, fw(angle), fw(x), fw(y), fw(z));
+    glRotatef(angle, x, y, z);
+}
+
+void glcap_Scalef(GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_SCALEF, fw(x), fw(y), fw(z));
+    glScalef(x, y, z);
+}
+
+void glcap_Viewport(GLint x, GLint y, GLsizei w, GLsizei h)
+{
+    REC(GLCAP_VIEWPORT, (uint32_t)x, (uint32_t)y, (uint32_t)w, (uint32_t)h);
+    glViewport(x, y, w, h);
+}
+
+void glcap_Scissor(GLint x, GLint y, GLsizei w, GLsizei h)
+{
+    REC(GLCAP_SCISSOR, (uint32_t)x, (uint32_t)y, (uint32_t)w, (uint32_t)h);
+    glScissor(x, y, w, h);
+}
+
+void glcap_Clear(GLbitfield mask)
+{
+    REC(GLCAP_CLEAR, mask);
+    glClear(mask);
+}
+
+void glcap_ClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    REC(GLCAP_CLEAR_COLOR, fw(r), fw(g), fw(b), fw(a));
+    glClearColor(r, g, b, a);
+}
+
+void glcap_ClearDepth(GLdouble d)
+{
+    REC(GLCAP_CLEAR_DEPTH, lo(dw(d)), hi(dw(d)));
+    glClearDepth(d);
+}
+
+void glcap_ClearStencil(GLint s)
+{
+    REC(GLCAP_CLEAR_STENCIL, (uint32_t)s);
+    glClearStencil(s);
+}
+
+void glcap_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    REC(GLCAP_BLEND_FUNC, sfactor, dfactor);
+    glBlendFunc(sfactor, dfactor);
+}
+
+void glcap_DepthFunc(GLenum func)
+{
+    REC(GLCAP_DEPTH_FUNC, func);
+    glDepthFunc(func);
+}
+
+void glcap_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    REC(GLCAP_STENCIL_FUNC, func, (uint32_t)ref, mask);
+    glStencilFunc(func, ref, mask);
+}
+
+void glcap_StencilOp(GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    REC(GLCAP_STENCIL_OP, sfail, dpfail, dppass);
+    glStencilOp(sfail, dpfail, dppass);
+}
+
+void glcap_CullFace(GLenum mode)
+{
+    REC(GLCAP_CULL_FACE, mode);
+    glCullFace(mode);
+}
+
+void glcap_FrontFace(GLenum mode)
+{
+    REC(GLCAP_FRONT_FACE, mode);
+    glFrontFace(mode);
+}
+
+void glcap_ShadeModel(GLenum mode)
+{
+    REC(GLCAP_SHADE_MODEL, mode);
+    glShadeModel(mode);
+}
+
+void glcap_ColorMaterial(GLenum face, GLenum mode)
+{
+    REC(GLCAP_COLOR_MATERIAL, face, mode);
+    glColorMaterial(face, mode);
+}
+
+void glcap_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
+{
+    if (cap_fp)
+    {
+        const uint32_t w[2] = {light, pname};
+        put(GLCAP_LIGHTFV, w, 2, params, sizeof(GLfloat) * glcapture_light_params(pname));
+    }
+    glLightfv(light, pname, params);
+}
+
+void glcap_PixelStorei(GLenum pname, GLint param)
+{
+    if (pname == GL_UNPACK_ALIGNMENT)
+        unpack_align = param;
+    else if (pname == GL_PACK_ALIGNMENT)
+        pack_align = param;
+    REC(GLCAP_PIXEL_STOREI, pname, (uint32_t)param);
+    glPixelStorei(pname, param);
+}
+
+void glcap_PushAttrib(GLbitfield mask)
+{
+    REC(GLCAP_PUSH_ATTRIB, mask);
+    glPushAttrib(mask);
+}
+
+void glcap_PopAttrib(void)
+{
+    if (cap_fp)
+        put(GLCAP_POP_ATTRIB, NULL, 0, NULL, 0);
+    glPopAttrib();
+}
+
+// pixels are not stored. replay reads them into scratch memory
+void glcap_ReadPixels(GLint x, GLint y, GLsizei w, GLsizei h, GLenum format, GLenum type, void *pixels)
+{
+    REC(GLCAP_READ_PIXELS, (uint32_t)x, (uint32_t)y, (uint32_t)w, (uint32_t)h, format, type);
+    glReadPixels(x, y, w, h, format, type, pixels);
+}
+
+void glcap_DrawPixels(GLsizei w, GLsizei h, GLenum format, GLenum type, const void *pixels)
+{
+    if (cap_fp)
+    {
+        const uint32_t wd[4] = {(uint32_t)w, (uint32_t)h, format, type};
+        put(GLCAP_DRAW_PIXELS, wd, 4, pixels, glcapture_image_size(w, h, format, type, unpack_align));
+    }
+    glDrawPixels(w, h, format, type, pixels);
+}
+
+void glcap_Finish(void)
+{
+    if (cap_fp)
+        put(GLCAP_FINISH, NULL, 0, NULL, 0);
+    glFinish();
+}
+
+void glcap_GenTextures(GLsizei n, GLuint *textures)
+{
+    glGenTextures(n, textures);
+    if (cap_fp)
+        put_names(GLCAP_GEN_TEXTURES, n, textures);
+}
+
+void glcap_DeleteTextures(GLsizei n, const GLuint *textures)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_TEXTURES, n, textures);
+    glDeleteTextures(n, textures);
+}
+
+void glcap_BindTexture(GLenum target, GLuint texture)
+{
+    REC(GLCAP_BIND_TEXTURE, target, texture);
+    glBindTexture(target, texture);
+}
+
+void glcap_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei w, GLsizei h, GLint border,
+                      GLenum format, GLenum type, const void *pixels)
+{
+    if (cap_fp)
+    {
+        const uint32_t wd[8] = {target, (uint32_t)level, (uint32_t)internalformat, (uint32_t)w, (uint32_t)h,
+                                (uint32_t)border, format, type};
+        int size = (pixels) ? glcapture_image_size(w, h, format, type, unpack_align) : 0;
+        put(GLCAP_TEX_IMAGE_2D, wd, 8, pixels, size);
+    }
+    glTexImage2D(target, level, internalformat, w, h, border, format, type, pixels);
+}
+
+void glcap_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    REC(GLCAP_TEX_PARAMETERI, target, pname, (uint32_t)param);
+    glTexParameteri(target, pname, param);
+}
+
+void glcap_TexEnvi(GLenum target, GLenum pname, GLint param)
+{
+    REC(GLCAP_TEX_ENVI, target, pname, (uint32_t)param);
+    glTexEnvi(target, pname, param);
+}
+
+void glcap_GenerateMipmap(GLenum target)
+{
+    REC(GLCAP_GENERATE_MIPMAP, target);
+    glGenerateMipmap(target);
+}
+
+void glcap_GenBuffers(GLsizei n, GLuint *buffers)
+{
+    glGenBuffers(n, buffers);
+    if (cap_fp)
+        put_names(GLCAP_GEN_BUFFERS, n, buffers);
+}
+
+void glcap_DeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_BUFFERS, n, buffers);
+    glDeleteBuffers(n, buffers);
+}
+
+void glcap_BindBuffer(GLenum target, GLuint buffer)
+{
+    REC(GLCAP_BIND_BUFFER, target, buffer);
+    glBindBuffer(target, buffer);
+}
+
+void glcap_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    if (cap_fp)
+    {
+        const uint32_t w[3] = {target, (uint32_t)size, usage};
+        put(GLCAP_BUFFER_DATA, w, 3, data, (data) ? size : 0);
+    }
+    glBufferData(target, size, data, usage);
+}
+
+void glcap_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    if (cap_fp)
+    {
+        const uint32_t w[2] = {target, (uint32_t)offset};
+        put(GLCAP_BUFFER_SUB_DATA, w, 2, data, size);
+    }
+    glBufferSubData(target, offset, size, data);
+}
+
+void glcap_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    REC(GLCAP_BIND_BUFFER_RANGE, target, index, buffer, (uint32_t)offset, (uint32_t)size);
+    glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void glcap_PrimitiveRestartIndex(GLuint index)
+{
+    REC(GLCAP_PRIMITIVE_RESTART_INDEX, index);
+    glPrimitiveRestartIndex(index);
+}
+
+void glcap_GenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    glGenVertexArrays(n, arrays);
+    if (cap_fp)
+        put_names(GLCAP_GEN_VERTEX_ARRAYS, n, arrays);
+}
+
+void glcap_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_VERTEX_ARRAYS, n, arrays);
+    glDeleteVertexArrays(n, arrays);
+}
+
+void glcap_BindVertexArray(GLuint array)
+{
+    REC(GLCAP_BIND_VERTEX_ARRAY, array);
+    glBindVertexArray(array);
+}
+
+void glcap_EnableVertexAttribArray(GLuint index)
+{
+    REC(GLCAP_ENABLE_VERTEX_ATTRIB_ARRAY, index);
+    glEnableVertexAttribArray(index);
+}
+
+void glcap_DisableVertexAttribArray(GLuint index)
+{
+    REC(GLCAP_DISABLE_VERTEX_ATTRIB_ARRAY, index);
+    glDisableVertexAttribArray(index);
+}
+
+// pointer is offset in buffer object. core profile has no client side arrays
+void glcap_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+                               const void *ptr)
+{
+    uint64_t p = (uint64_t)(size_t)ptr;
+    REC(GLCAP_VERTEX_ATTRIB_POINTER, index, (uint32_t)size, type, normalized, (uint32_t)stride, lo(p), hi(p));
+    glVertexAttribPointer(index, size, type, normalized, stride, ptr);
+}
+
+void glcap_VertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    REC(GLCAP_VERTEX_ATTRIB_DIVISOR, index, divisor);
+    glVertexAttribDivisor(index, divisor);
+}
+
+void glcap_VertexAttrib1f(GLuint index, GLfloat x)
+{
+    REC(GLCAP_VERTEX_ATTRIB4F, index, fw(x), fw(0.0), fw(0.0), fw(1.0));
+    glVertexAttrib1f(index, x);
+}
+
+void glcap_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    REC(GLCAP_VERTEX_ATTRIB4F, index, fw(x), fw(y), fw(z), fw(1.0));
+    glVertexAttrib3f(index, x, y, z);
+}
+
+void glcap_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    REC(GLCAP_VERTEX_ATTRIB4F, index, fw(x), fw(y), fw(z), fw(w));
+    glVertexAttrib4f(index, x, y, z, w);
+}
+
+GLuint glcap_CreateShader(GLenum type)
+{
+    GLuint s = glCreateShader(type);
+    REC(GLCAP_CREATE_SHADER, type, s);
+    return s;
+}
+
+void glcap_DeleteShader(GLuint shader)
+{
+    REC(GLCAP_DELETE_SHADER, shader);
+    glDeleteShader(shader);
+}
+
+void glcap_ShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+{
+    if (cap_fp)
+    {
+        // (length, string) of each string
+        uint32_t size = 0;
+        for (int i = 0; i < count; i++)
+            size += sizeof(uint32_t) + ((length && length[i] >= 0) ? length[i] : strlen(string[i]));
+        char *buf = (char *)malloc(size);
+        char *p = buf;
+        for (int i = 0; buf && i < count; i++)
+        {
+            uint32_t len = (length && length[i] >= 0) ? length[i] : strlen(string[i]);
+            memcpy(p, &len, sizeof(len));
+            memcpy(p + sizeof(len), string[i], len);
+            p += sizeof(len) + len;
+        }
+        const uint32_t w[2] = {shader, (uint32_t)count};
+        if (buf)
+            put(GLCAP_SHADER_SOURCE, w, 2, buf, size);
+        free(buf);
+    }
+    glShaderSource(shader, count, string, length);
+}
+
+void glcap_CompileShader(GLuint shader)
+{
+    REC(GLCAP_COMPILE_SHADER, shader);
+    glCompileShader(shader);
+}
+
+GLuint glcap_CreateProgram(void)
+{
+    GLuint p = glCreateProgram();
+    REC(GLCAP_CREATE_PROGRAM, p);
+    return p;
+}
+
+void glcap_DeleteProgram(GLuint program)
+{
+    REC(GLCAP_DELETE_PROGRAM, program);
+    glDeleteProgram(program);
+}
+
+void glcap_AttachShader(GLuint program, GLuint shader)
+{
+    REC(GLCAP_ATTACH_SHADER, program, shader);
+    glAttachShader(program, shader);
+}
+
+void glcap_LinkProgram(GLuint program)
+{
+    REC(GLCAP_LINK_PROGRAM, program);
+    glLinkProgram(program);
+}
+
+void glcap_UseProgram(GLuint program)
+{
+    REC(GLCAP_USE_PROGRAM, program);
+    glUseProgram(program);
+}
+
+GLint glcap_GetUniformLocation(GLuint program, const GLchar *name)
+{
+    GLint loc = glGetUniformLocation(program, name);
+    if (cap_fp)
+    {
+        const uint32_t w[2] = {program, (uint32_t)loc};
+        put(GLCAP_GET_UNIFORM_LOCATION, w, 2, name, strlen(name) + 1);
+    }
+    return loc;
+}
+
+GLuint glcap_GetUniformBlockIndex(GLuint program, const GLchar *name)
+{
+    GLuint idx = glGetUniformBlockIndex(program, name);
+    if (cap_fp)
+    {
+        const uint32_t w[2] = {program, idx};
+        put(GLCAP_GET_UNIFORM_BLOCK_INDEX, w, 2, name, strlen(name) + 1);
+    }
+    return idx;
+}
+
+void glcap_UniformBlockBinding(GLuint program, GLuint index, GLuint binding)
+{
+    REC(GLCAP_UNIFORM_BLOCK_BINDING, program, index, binding);
+    glUniformBlockBinding(program, index, binding);
+}
+
+void glcap_Uniform1i(GLint location, GLint v0)
+{
+    REC(GLCAP_UNIFORM1I, (uint32_t)location, (uint32_t)v0);
+    glUniform1i(location, v0);
+}
+
+void glcap_Uniform1f(GLint location, GLfloat v0)
+{
+    REC(GLCAP_UNIFORM1F, (uint32_t)location, fw(v0));
+    glUniform1f(location, v0);
+}
+
+void glcap_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    REC(GLCAP_UNIFORM2F, (uint32_t)location, fw(v0), fw(v1));
+    glUniform2f(location, v0, v1);
+}
+
+void glcap_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    if (cap_fp)
+    {
+        const uint32_t w[2] = {(uint32_t)location, (uint32_t)count};
+        put(GLCAP_UNIFORM4FV, w, 2, value, sizeof(GLfloat) * 4 * count);
+    }
+    glUniform4fv(location, count, value);
+}
+
+void glcap_GenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    glGenFramebuffers(n, framebuffers);
+    if (cap_fp)
+        put_names(GLCAP_GEN_FRAMEBUFFERS, n, framebuffers);
+}
+
+void glcap_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_FRAMEBUFFERS, n, framebuffers);
+    glDeleteFramebuffers(n, framebuffers);
+}
+
+void glcap_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    REC(GLCAP_BIND_FRAMEBUFFER, target, framebuffer);
+    glBindFramebuffer(target, framebuffer);
+}
+
+void glcap_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    REC(GLCAP_FRAMEBUFFER_TEXTURE_2D, target, attachment, textarget, texture, (uint32_t)level);
+    glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+void glcap_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    glGenRenderbuffers(n, renderbuffers);
+    if (cap_fp)
+        put_names(GLCAP_GEN_RENDERBUFFERS, n, renderbuffers);
+}
+
+void glcap_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_RENDERBUFFERS, n, renderbuffers);
+    glDeleteRenderbuffers(n, renderbuffers);
+}
+
+void glcap_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    REC(GLCAP_BIND_RENDERBUFFER, target, renderbuffer);
+    glBindRenderbuffer(target, renderbuffer);
+}
+
+void glcap_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei w, GLsizei h)
+{
+    REC(GLCAP_RENDERBUFFER_STORAGE, target, internalformat, (uint32_t)w, (uint32_t)h);
+    glRenderbufferStorage(target, internalformat, w, h);
+}
+
+void glcap_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum rbtarget, GLuint renderbuffer)
+{
+    REC(GLCAP_FRAMEBUFFER_RENDERBUFFER, target, attachment, rbtarget, renderbuffer);
+    glFramebufferRenderbuffer(target, attachment, rbtarget, renderbuffer);
+}
+
+void glcap_GenQueries(GLsizei n, GLuint *ids)
+{
+    glGenQueries(n, ids);
+    if (cap_fp)
+        put_names(GLCAP_GEN_QUERIES, n, ids);
+}
+
+void glcap_DeleteQueries(GLsizei n, const GLuint *ids)
+{
+    if (cap_fp)
+        put_names(GLCAP_DELETE_QUERIES, n, ids);
+    glDeleteQueries(n, ids);
+}
+
+void glcap_BeginQuery(GLenum target, GLuint id)
+{
+    REC(GLCAP_BEGIN_QUERY, target, id);
+    glBeginQuery(target, id);
+}
+
+void glcap_EndQuery(GLenum target)
+{
+    REC(GLCAP_END_QUERY, target);
+    glEndQuery(target);
+}
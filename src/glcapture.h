@@ -0,0 +1,448 @@
+// Last updated: <2026/10/20 09:31:52 +0900>
+//
+// Capture of OpenGL command stream. Included at the end of glfunc.h, so
+// every module which draws by OpenGL calls glcap_*() instead of the
+// OpenGL functions below. They write the call into a file while capture
+// is active, and call the real function. ssisoroadreplay issues the
+// stream again on another context / driver.
+//
+// Arguments are 32 bit words (doubles and pointers are 2 words). Data
+// which the call reads from memory is stored after them : buffer data,
+// textures, bitmaps, shader sources, and client side vertex arrays and
+// indices of each draw call. Object names are mapped by replay, because
+// another driver may return other names.
+//
+// Persistent mapped buffers are written without OpenGL calls, so the
+// streaming ring buffer uses glBufferSubData() while capture is active
+// (glring.cpp). Queries of state (glGet*) are not recorded, except the
+// names and locations which later calls use.
+//
+// File is in byte order of the machine (little endian on x86 / ARM).
+// Record : op (16 bit), words (16 bit), bytes of data (32 bit), words, data (padded to 4 bytes).
+
+#ifndef __GLCAPTURE_H__
+#define __GLCAPTURE_H__
+
+#include <stdint.h>
+
+#define GLCAPTURE_MAGIC 0x434c4753 // "SGLC"
+#define GLCAPTURE_VERSION 1
+
+// words of a record
+#define GLCAPTURE_WORD_MAX 16
+
+typedef struct glcapture_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width; // window
+    uint32_t height;
+    uint32_t core;       // 1 = OpenGL 3.3 core profile renderer, 0 = fixed function
+    uint32_t gl_version; // major * 10 + minor of capture context (glf_version)
+    uint32_t frames;     // 0 = file was not closed
+    uint32_t reserved;
+} GLCAPTURE_HEADER;
+
+typedef struct glcapture_rec
+{
+    uint16_t op;
+    uint16_t words;
+    uint32_t size;
+} GLCAPTURE_REC;
+
+// client side arrays of fixed function path
+enum
+{
+    GLCAP_ARRAY_VERTEX,
+    GLCAP_ARRAY_NORMAL,
+    GLCAP_ARRAY_COLOR,
+    GLCAP_ARRAY_TEXCOORD,
+    GLCAP_ARRAY_MAX,
+};
+
+// operations. do not reorder, append only (GLCAPTURE_VERSION)
+enum
+{
+    GLCAP_FRAME, // end of frame (swap buffers)
+    GLCAP_ENABLE,
+    GLCAP_DISABLE,
+    GLCAP_ENABLE_CLIENT_STATE,
+    GLCAP_DISABLE_CLIENT_STATE,
+    GLCAP_ARRAY_POINTER, // kind, size, type, stride, client, offset (2 words)
+    GLCAP_CLIENT_ARRAY,  // kind, size, type, stride, first + data
+    GLCAP_DRAW_ARRAYS,
+    GLCAP_DRAW_ELEMENTS, // mode, count, type, client, offset (2 words) [+ indices]
+    GLCAP_DRAW_ARRAYS_INSTANCED,
+    GLCAP_BEGIN,
+    GLCAP_END,
+    GLCAP_VERTEX2F,
+    GLCAP_VERTEX3F,
+    GLCAP_VERTEX2D,
+    GLCAP_VERTEX3D,
+    GLCAP_TEXCOORD2F,
+    GLCAP_COLOR4F,
+    GLCAP_RASTER_POS3F,
+    GLCAP_BITMAP, // + bitmap
+    GLCAP_MATRIX_MODE,
+    GLCAP_LOAD_IDENTITY,
+    GLCAP_PUSH_MATRIX,
+    GLCAP_POP_MATRIX,
+    GLCAP_ORTHO,
+    GLCAP_TRANSLATEF,
+    GLCAP_TRANSLATED,
+    GLCAP_ROTATEF,
+    GLCAP_SCALEF,
+    GLCAP_VIEWPORT,
+    GLCAP_SCISSOR,
+    GLCAP_CLEAR,
+    GLCAP_CLEAR_COLOR,
+    GLCAP_CLEAR_DEPTH,
+    GLCAP_CLEAR_STENCIL,
+    GLCAP_BLEND_FUNC,
+    GLCAP_DEPTH_FUNC,
+    GLCAP_STENCIL_FUNC,
+    GLCAP_STENCIL_OP,
+    GLCAP_CULL_FACE,
+    GLCAP_FRONT_FACE,
+    GLCAP_SHADE_MODEL,
+    GLCAP_COLOR_MATERIAL,
+    GLCAP_LIGHTFV, // light, pname + params
+    GLCAP_PIXEL_STOREI,
+    GLCAP_PUSH_ATTRIB,
+    GLCAP_POP_ATTRIB,
+    GLCAP_READ_PIXELS,
+    GLCAP_FINISH,
+    GLCAP_GEN_TEXTURES, // n, names
+    GLCAP_DELETE_TEXTURES,
+    GLCAP_BIND_TEXTURE,
+    GLCAP_TEX_IMAGE_2D, // [+ pixels]
+    GLCAP_TEX_PARAMETERI,
+    GLCAP_TEX_ENVI,
+    GLCAP_GENERATE_MIPMAP,
+    GLCAP_GEN_BUFFERS,
+    GLCAP_DELETE_BUFFERS,
+    GLCAP_BIND_BUFFER,
+    GLCAP_BUFFER_DATA, // target, size, usage [+ data]
+    GLCAP_BUFFER_SUB_DATA,
+    GLCAP_BIND_BUFFER_RANGE,
+    GLCAP_PRIMITIVE_RESTART_INDEX,
+    GLCAP_GEN_VERTEX_ARRAYS,
+    GLCAP_DELETE_VERTEX_ARRAYS,
+    GLCAP_BIND_VERTEX_ARRAY,
+    GLCAP_ENABLE_VERTEX_ATTRIB_ARRAY,
+    GLCAP_DISABLE_VERTEX_ATTRIB_ARRAY,
+    GLCAP_VERTEX_ATTRIB_POINTER,
+    GLCAP_VERTEX_ATTRIB_DIVISOR,
+    GLCAP_VERTEX_ATTRIB4F, // 1f / 3f are recorded as 4f
+    GLCAP_CREATE_SHADER,   // type, name
+    GLCAP_DELETE_SHADER,
+    GLCAP_SHADER_SOURCE, // shader, count + (length, string) * count
+    GLCAP_COMPILE_SHADER,
+    GLCAP_CREATE_PROGRAM,
+    GLCAP_DELETE_PROGRAM,
+    GLCAP_ATTACH_SHADER,
+    GLCAP_LINK_PROGRAM,
+    GLCAP_USE_PROGRAM,
+    GLCAP_GET_UNIFORM_LOCATION, // program, location + name
+    GLCAP_GET_UNIFORM_BLOCK_INDEX,
+    GLCAP_UNIFORM_BLOCK_BINDING,
+    GLCAP_UNIFORM1I,
+    GLCAP_UNIFORM1F,
+    GLCAP_UNIFORM2F,
+    GLCAP_UNIFORM4FV, // location, count + values
+    GLCAP_GEN_FRAMEBUFFERS,
+    GLCAP_DELETE_FRAMEBUFFERS,
+    GLCAP_BIND_FRAMEBUFFER,
+    GLCAP_FRAMEBUFFER_TEXTURE_2D,
+    GLCAP_GEN_RENDERBUFFERS,
+    GLCAP_DELETE_RENDERBUFFERS,
+    GLCAP_BIND_RENDERBUFFER,
+    GLCAP_RENDERBUFFER_STORAGE,
+    GLCAP_FRAMEBUFFER_RENDERBUFFER,
+    GLCAP_GEN_QUERIES,
+    GLCAP_DELETE_QUERIES,
+    GLCAP_BEGIN_QUERY,
+    GLCAP_END_QUERY,
+    GLCAP_DRAW_PIXELS, // [+ pixels]
+    GLCAP_OP_MAX,
+};
+
+// ----------------------------------------
+// prototype declaration
+int glcapture_start(const char *path, int frames, int width, int height, int core);
+int glcapture_is_active(void);
+int glcapture_end_frame(void);
+void glcapture_stop(void);
+int glcapture_pixel_bytes(GLenum format, GLenum type);
+int glcapture_image_size(int w, int h, GLenum format, GLenum type, int align);
+int glcapture_light_params(GLenum pname);
+
+void glcap_Enable(GLenum cap);
+void glcap_Disable(GLenum cap);
+void glcap_EnableClientState(GLenum array);
+void glcap_DisableClientState(GLenum array);
+void glcap_VertexPointer(GLint size, GLenum type, GLsizei stride, const void *ptr);
+void glcap_NormalPointer(GLenum type, GLsizei stride, const void *ptr);
+void glcap_ColorPointer(GLint size, GLenum type, GLsizei stride, const void *ptr);
+void glcap_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *ptr);
+void glcap_DrawArrays(GLenum mode, GLint first, GLsizei count);
+void glcap_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+void glcap_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+void glcap_Begin(GLenum mode);
+void glcap_End(void);
+void glcap_Vertex2f(GLfloat x, GLfloat y);
+void glcap_Vertex3f(GLfloat x, GLfloat y, GLfloat z);
+void glcap_Vertex2d(GLdouble x, GLdouble y);
+void glcap_Vertex3d(GLdouble x, GLdouble y, GLdouble z);
+void glcap_TexCoord2f(GLfloat s, GLfloat t);
+void glcap_Color4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+void glcap_Color4fv(const GLfloat *v);
+void glcap_RasterPos3f(GLfloat x, GLfloat y, GLfloat z);
+void glcap_Bitmap(GLsizei w, GLsizei h, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap);
+void glcap_MatrixMode(GLenum mode);
+void glcap_LoadIdentity(void);
+void glcap_PushMatrix(void);
+void glcap_PopMatrix(void);
+void glcap_Ortho(GLdouble l, GLdouble r, GLdouble b, GLdouble t, GLdouble n, GLdouble f);
+void glcap_Translatef(GLfloat x, GLfloat y, GLfloat z);
+void glcap_Translated(GLdouble x, GLdouble y, GLdouble z);
+void glcap_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+void glcap_Scalef(GLfloat x, GLfloat y, GLfloat z);
+void glcap_Viewport(GLint x, GLint y, GLsizei w, GLsizei h);
+void glcap_Scissor(GLint x, GLint y, GLsizei w, GLsizei h);
+void glcap_Clear(GLbitfield mask);
+void glcap_ClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+void glcap_ClearDepth(GLdouble d);
+void glcap_ClearStencil(GLint s);
+void glcap_BlendFunc(GLenum sfactor, GLenum dfactor);
+void glcap_DepthFunc(GLenum func);
+void glcap_StencilFunc(GLenum func, GLint ref, GLuint mask);
+void glcap_StencilOp(GLenum sfail, GLenum dpfail, GLenum dppass);
+void glcap_CullFace(GLenum mode);
+void glcap_FrontFace(GLenum mode);
+void glcap_ShadeModel(GLenum mode);
+void glcap_ColorMaterial(GLenum face, GLenum mode);
+void glcap_Lightfv(GLenum light, GLenum pname, const GLfloat *params);
+void glcap_PixelStorei(GLenum pname, GLint param);
+void glcap_PushAttrib(GLbitfield mask);
+void glcap_PopAttrib(void);
+void glcap_ReadPixels(GLint x, GLint y, GLsizei w, GLsizei h, GLenum format, GLenum type, void *pixels);
+void glcap_DrawPixels(GLsizei w, GLsizei h, GLenum format, GLenum type, const void *pixels);
+void glcap_Finish(void);
+void glcap_GenTextures(GLsizei n, GLuint *textures);
+void glcap_DeleteTextures(GLsizei n, const GLuint *textures);
+void glcap_BindTexture(GLenum target, GLuint texture);
+void glcap_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei w, GLsizei h, GLint border,
+                      GLenum format, GLenum type, const void *pixels);
+void glcap_TexParameteri(GLenum target, GLenum pname, GLint param);
+void glcap_TexEnvi(GLenum target, GLenum pname, GLint param);
+void glcap_GenerateMipmap(GLenum target);
+void glcap_GenBuffers(GLsizei n, GLuint *buffers);
+void glcap_DeleteBuffers(GLsizei n, const GLuint *buffers);
+void glcap_BindBuffer(GLenum target, GLuint buffer);
+void glcap_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void glcap_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+void glcap_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void glcap_PrimitiveRestartIndex(GLuint index);
+void glcap_GenVertexArrays(GLsizei n, GLuint *arrays);
+void glcap_DeleteVertexArrays(GLsizei n, const GLuint *arrays);
+void glcap_BindVertexArray(GLuint array);
+void glcap_EnableVertexAttribArray(GLuint index);
+void glcap_DisableVertexAttribArray(GLuint index);
+void glcap_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+                               const void *ptr);
+void glcap_VertexAttribDivisor(GLuint index, GLuint divisor);
+void glcap_VertexAttrib1f(GLuint index, GLfloat x);
+void glcap_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z);
+void glcap_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+GLuint glcap_CreateShader(GLenum type);
+void glcap_DeleteShader(GLuint shader);
+void glcap_ShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length);
+void glcap_CompileShader(GLuint shader);
+GLuint glcap_CreateProgram(void);
+void glcap_DeleteProgram(GLuint program);
+void glcap_AttachShader(GLuint program, GLuint shader);
+void glcap_LinkProgram(GLuint program);
+void glcap_UseProgram(GLuint program);
+GLint glcap_GetUniformLocation(GLuint program, const GLchar *name);
+GLuint glcap_GetUniformBlockIndex(GLuint program, const GLchar *name);
+void glcap_UniformBlockBinding(GLuint program, GLuint index, GLuint binding);
+void glcap_Uniform1i(GLint location, GLint v0);
+void glcap_Uniform1f(GLint location, GLfloat v0);
+void glcap_Uniform2f(GLint location, GLfloat v0, GLfloat v1);
+void glcap_Uniform4fv(GLint location, GLsizei count, const GLfloat *value);
+void glcap_GenFramebuffers(GLsizei n, GLuint *framebuffers);
+void glcap_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers);
+void glcap_BindFramebuffer(GLenum target, GLuint framebuffer);
+void glcap_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void glcap_GenRenderbuffers(GLsizei n, GLuint *renderbuffers);
+void glcap_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers);
+void glcap_BindRenderbuffer(GLenum target, GLuint renderbuffer);
+void glcap_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei w, GLsizei h);
+void glcap_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum rbtarget, GLuint renderbuffer);
+void glcap_GenQueries(GLsizei n, GLuint *ids);
+void glcap_DeleteQueries(GLsizei n, const GLuint *ids);
+void glcap_BeginQuery(GLenum target, GLuint id);
+void glcap_EndQuery(GLenum target);
+
+// calls of other modules go through capture. glcapture.cpp and replay call the real functions
+#ifndef GLCAPTURE_IMPL
+#define glEnable glcap_Enable
+#define glDisable glcap_Disable
+#define glEnableClientState glcap_EnableClientState
+#define glDisableClientState glcap_DisableClientState
+#define glVertexPointer glcap_VertexPointer
+#define glNormalPointer glcap_NormalPointer
+#define glColorPointer glcap_ColorPointer
+#define glTexCoordPointer glcap_TexCoordPointer
+#define glDrawArrays glcap_DrawArrays
+#define glDrawElements glcap_DrawElements
+#define glBegin glcap_Begin
+#define glEnd glcap_End
+#define glVertex2f glcap_Vertex2f
+#define glVertex3f glcap_Vertex3f
+#define glVertex2d glcap_Vertex2d
+#define glVertex3d glcap_Vertex3d
+#define glTexCoord2f glcap_TexCoord2f
+#define glColor4f glcap_Color4f
+#define glColor4fv glcap_Color4fv
+#define glRasterPos3f glcap_RasterPos3f
+#define glBitmap glcap_Bitmap
+#define glMatrixMode glcap_MatrixMode
+#define glLoadIdentity glcap_LoadIdentity
+#define glPushMatrix glcap_PushMatrix
+#define glPopMatrix glcap_PopMatrix
+#define glOrtho glcap_Ortho
+#define glTranslatef glcap_Translatef
+#define glTranslated glcap_Translated
+#define glRotatef glcap_Rotatef
+#define glScalef glcap_Scalef
+#define glViewport glcap_Viewport
+#define glScissor glcap_Scissor
+#define glClear glcap_Clear
+#define glClearColor glcap_ClearColor
+#define glClearDepth glcap_ClearDepth
+#define glClearStencil glcap_ClearStencil
+#define glBlendFunc glcap_BlendFunc
+#define glDepthFunc glcap_DepthFunc
+#define glStencilFunc glcap_StencilFunc
+#define glStencilOp glcap_StencilOp
+#define glCullFace glcap_CullFace
+#define glFrontFace glcap_FrontFace
+#define glShadeModel glcap_ShadeModel
+#define glColorMaterial glcap_ColorMaterial
+#define glLightfv glcap_Lightfv
+#define glPixelStorei glcap_PixelStorei
+#define glPushAttrib glcap_PushAttrib
+#define glPopAttrib glcap_PopAttrib
+#define glReadPixels glcap_ReadPixels
+#define glDrawPixels glcap_DrawPixels
+#define glFinish glcap_Finish
+#define glGenTextures glcap_GenTextures
+#define glDeleteTextures glcap_DeleteTextures
+#define glBindTexture glcap_BindTexture
+#define glTexImage2D glcap_TexImage2D
+#define glTexParameteri glcap_TexParameteri
+#define glTexEnvi glcap_TexEnvi
+
+// functions of glfunc.h
+#undef glGenerateMipmap
+#undef glGenBuffers
+#undef glDeleteBuffers
+#undef glBindBuffer
+#undef glBufferData
+#undef glBufferSubData
+#undef glBindBufferRange
+#undef glPrimitiveRestartIndex
+#undef glDrawArraysInstanced
+#undef glGenVertexArrays
+#undef glDeleteVertexArrays
+#undef glBindVertexArray
+#undef glEnableVertexAttribArray
+#undef glDisableVertexAttribArray
+#undef glVertexAttribPointer
+#undef glVertexAttribDivisor
+#undef glVertexAttrib1f
+#undef glVertexAttrib3f
+#undef glVertexAttrib4f
+#undef glCreateShader
+#undef glDeleteShader
+#undef glShaderSource
+#undef glCompileShader
+#undef glCreateProgram
+#undef glDeleteProgram
+#undef glAttachShader
+#undef glLinkProgram
+#undef glUseProgram
+#undef glGetUniformLocation
+#undef glGetUniformBlockIndex
+#undef glUniformBlockBinding
+#undef glUniform1i
+#undef glUniform1f
+#undef glUniform2f
+#undef glUniform4fv
+#undef glGenFramebuffers
+#undef glDeleteFramebuffers
+#undef glBindFramebuffer
+#undef glFramebufferTexture2D
+#undef glGenRenderbuffers
+#undef glDeleteRenderbuffers
+#undef glBindRenderbuffer
+#undef glRenderbufferStorage
+#undef glFramebufferRenderbuffer
+#undef glGenQueries
+#undef glDeleteQueries
+#undef glBeginQuery
+#undef glEndQuery
+
+#define glGenerateMipmap glcap_GenerateMipmap
+#define glGenBuffers glcap_GenBuffers
+#define glDeleteBuffers glcap_DeleteBuffers
+#define glBindBuffer glcap_BindBuffer
+#define glBufferData glcap_BufferData
+#define glBufferSubData glcap_BufferSubData
+#define glBindBufferRange glcap_BindBufferRange
+#define glPrimitiveRestartIndex glcap_PrimitiveRestartIndex
+#define glDrawArraysInstanced glcap_DrawArraysInstanced
+#define glGenVertexArrays glcap_GenVertexArrays
+#define glDeleteVertexArrays glcap_DeleteVertexArrays
+#define glBindVertexArray glcap_BindVertexArray
+#define glEnableVertexAttribArray glcap_EnableVertexAttribArray
+#define glDisableVertexAttribArray glcap_DisableVertexAttribArray
+#define glVertexAttribPointer glcap_VertexAttribPointer
+#define glVertexAttribDivisor glcap_VertexAttribDivisor
+#define glVertexAttrib1f glcap_VertexAttrib1f
+#define glVertexAttrib3f glcap_VertexAttrib3f
+#define glVertexAttrib4f glcap_VertexAttrib4f
+#define glCreateShader glcap_CreateShader
+#define glDeleteShader glcap_DeleteShader
+#define glShaderSource glcap_ShaderSource
+#define glCompileShader glcap_CompileShader
+#define glCreateProgram glcap_CreateProgram
+#define glDeleteProgram glcap_DeleteProgram
+#define glAttachShader glcap_AttachShader
+#define glLinkProgram glcap_LinkProgram
+#define glUseProgram glcap_UseProgram
+#define glGetUniformLocation glcap_GetUniformLocation
+#define glGetUniformBlockIndex glcap_GetUniformBlockIndex
+#define glUniformBlockBinding glcap_UniformBlockBinding
+#define glUniform1i glcap_Uniform1i
+#define glUniform1f glcap_Uniform1f
+#define glUniform2f glcap_Uniform2f
+#define glUniform4fv glcap_Uniform4fv
+#define glGenFramebuffers glcap_GenFramebuffers
+#define glDeleteFramebuffers glcap_DeleteFramebuffers
+#define glBindFramebuffer glcap_BindFramebuffer
+#define glFramebufferTexture2D glcap_FramebufferTexture2D
+#define glGenRenderbuffers glcap_GenRenderbuffers
+#define glDeleteRenderbuffers glcap_DeleteRenderbuffers
+#define glBindRenderbuffer glcap_BindRenderbuffer
+#define glRenderbufferStorage glcap_RenderbufferStorage
+#define glFramebufferRenderbuffer glcap_FramebufferRenderbuffer
+#define glGenQueries glcap_GenQueries
+#define glDeleteQueries glcap_DeleteQueries
+#define glBeginQuery glcap_BeginQuery
+#define glEndQuery glcap_EndQuery
+#endif
+
+#endif
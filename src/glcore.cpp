@@ -0,0 +1,773 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Shader renderer for OpenGL 3.3 core profile (and OpenGL ES 3.0).
+// Same picture as the fixed function path of render.cpp.
+//
+// Lighting is the same as set_scene_state() : directional light (1, 1, 1)
+// in eye space, ambient 0.5 + global ambient 0.2, diffuse 1.0,
+// color material, flat shading. Roads and trees have no normal,
+// so current normal (0, 0, 1) is used like the fixed function path.
+//
+// View matrices, vehicle instances and text vertices change every frame.
+// They are written to the streaming ring buffer of render.cpp.
+
+#define _USE_MATH_DEFINES
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "glfunc.h"
+#include "glcore.h"
+
+#define COURSE_MAX 8
+
+// vertex attribute location
+enum
+{
+    ATTR_POS,
+    ATTR_NML,
+    ATTR_COL,
+    ATTR_PAL,
+    ATTR_INST,
+};
+
+// uniform buffer binding point
+enum
+{
+    UBO_VIEW,
+    UBO_PALETTE,
+};
+
+// per view uniform block. std140
+typedef struct viewblock
+{
+    float proj[16];
+    float view[16];
+    float light_dir[4];
+    float light_amb[4];
+    float light_dif[4];
+} VIEWBLOCK;
+
+typedef struct model
+{
+    int vtx_num;
+    GLuint vao;
+    GLuint vbo;
+} MODEL;
+
+typedef struct font
+{
+    int w;
+    int h;
+    GLuint tex;
+} FONT;
+
+typedef struct course
+{
+    const ROADMESH *mesh;
+    GLuint vao;
+} COURSE;
+
+static int initialized = 0;
+
+static GLuint prog_lit = 0;
+static GLuint prog_unlit = 0;
+static GLuint prog_text = 0;
+static GLuint prog_blit = 0;
+static GLuint prog_color = 0;
+static GLint lit_scale;
+static GLint unlit_color;
+static GLint text_color;
+static GLint text_viewport;
+static GLint color_viewport;
+
+static GLRING *ring = NULL;
+static GLuint pal_ubo = 0;
+static int ubo_align = 0;
+static int view_stride = 0;
+static int view_ofs = -1;
+static int pal_stride = 0;
+static unsigned char *view_buf = NULL;
+
+static MODEL models[GLCORE_MODEL_MAX];
+static FONT fonts[GLCORE_FONT_MAX];
+static COURSE courses[COURSE_MAX];
+static int course_num = 0;
+
+static int inst_ofs = 0;
+static GLuint fill_vao = 0;
+static GLuint fill_vbo = 0;
+static GLuint text_vao = 0;
+
+// ----------------------------------------
+// shaders
+static const char *header_core = "#version 330 core\n";
+static const char *header_es = "#version 300 es\nprecision highp float;\n";
+
+static const char *lit_vs =
+    "layout(std140) uniform View {\n"
+    "    mat4 u_proj;\n"
+    "    mat4 u_view;\n"
+    "    vec4 u_light_dir;\n"
+    "    vec4 u_light_amb;\n"
+    "    vec4 u_light_dif;\n"
+    "};\n"
+    "layout(std140) uniform Palette {\n"
+    "    vec4 u_pal[PAL_MAX];\n"
+    "};\n"
+    "uniform float u_scale;\n"
+    "layout(location = 0) in vec3 a_pos;\n"
+    "layout(location = 1) in vec3 a_nml;\n"
+    "layout(location = 2) in vec4 a_col;\n"
+    "layout(location = 3) in float a_pal;\n"
+    "layout(location = 4) in vec4 a_inst;\n"
+    "flat out vec4 v_col;\n"
+    "void main() {\n"
+    "    float r = radians(a_inst.w);\n"
+    "    float c = cos(r);\n"
+    "    float s = sin(r);\n"
+    "    mat3 rot = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);\n"
+    "    vec3 p = rot * (a_pos * u_scale) + a_inst.xyz;\n"
+    "    gl_Position = u_proj * u_view * vec4(p, 1.0);\n"
+    "    vec3 n = normalize(mat3(u_view) * (rot * a_nml));\n"
+    "    vec4 col = (a_pal >= 0.0) ? u_pal[int(a_pal)] : a_col;\n"
+    "    vec3 lit = u_light_amb.rgb + u_light_dif.rgb * max(dot(n, u_light_dir.xyz), 0.0);\n"
+    "    v_col = vec4(min(col.rgb * lit, vec3(1.0)), col.a);\n"
+    "}\n";
+
+static const char *lit_fs =
+    "flat in vec4 v_col;\n"
+    "out vec4 o_col;\n"
+    "void main() {\n"
+    "    o_col = v_col;\n"
+    "}\n";
+
+static const char *unlit_vs =
+    "layout(location = 0) in vec3 a_pos;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_pos, 1.0);\n"
+    "}\n";
+
+static const char *unlit_fs =
+    "uniform vec4 u_color;\n"
+    "out vec4 o_col;\n"
+    "void main() {\n"
+    "    o_col = u_color;\n"
+    "}\n";
+
+// a_pos : pixel in viewport, a_uv : texel in font atlas
+static const char *text_vs =
+    "uniform vec2 u_viewport;\n"
+    "layout(location = 0) in vec2 a_pos;\n"
+    "layout(location = 1) in vec2 a_uv;\n"
+    "out vec2 v_uv;\n"
+    "void main() {\n"
+    "    v_uv = a_uv;\n"
+    "    gl_Position = vec4(a_pos / u_viewport * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *text_fs =
+    "uniform sampler2D u_tex;\n"
+    "uniform vec4 u_color;\n"
+    "in vec2 v_uv;\n"
+    "out vec4 o_col;\n"
+    "void main() {\n"
+    "    if (texelFetch(u_tex, ivec2(v_uv), 0).r < 0.5)\n"
+    "        discard;\n"
+    "    o_col = u_color;\n"
+    "}\n";
+
+// texture over whole viewport. a_pos of fill quad
+static const char *blit_vs =
+    "layout(location = 0) in vec3 a_pos;\n"
+    "out vec2 v_uv;\n"
+    "void main() {\n"
+    "    v_uv = a_pos.xy * 0.5 + 0.5;\n"
+    "    gl_Position = vec4(a_pos, 1.0);\n"
+    "}\n";
+
+static const char *blit_fs =
+    "uniform sampler2D u_tex;\n"
+    "in vec2 v_uv;\n"
+    "out vec4 o_col;\n"
+    "void main() {\n"
+    "    o_col = texture(u_tex, v_uv);\n"
+    "}\n";
+
+// vertex colored triangles. a_pos in pixels of viewport
+static const char *color_vs =
+    "uniform vec2 u_viewport;\n"
+    "layout(location = 0) in vec2 a_pos;\n"
+    "layout(location = 1) in vec4 a_col;\n"
+    "out vec4 v_col;\n"
+    "void main() {\n"
+    "    v_col = a_col;\n"
+    "    gl_Position = vec4(a_pos / u_viewport * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *color_fs =
+    "in vec4 v_col;\n"
+    "out vec4 o_col;\n"
+    "void main() {\n"
+    "    o_col = v_col;\n"
+    "}\n";
+
+// ----------------------------------------
+// prototype declaration
+static GLuint compile_shader(GLenum type, const char *src);
+static GLuint link_program(const char *vs, const char *fs);
+static int align_up(int n, int a);
+static void free_gl_objects(void);
+
+// ========================================
+static GLuint compile_shader(GLenum type, const char *src)
+{
+    char def[64];
+    sprintf(def, "#define PAL_MAX %d\n", ROADMESH_PAL_MAX);
+    const char *srcs[3] = {glf_es ? header_es : header_core, def, src};
+
+    GLuint sh = glCreateShader(type);
+    glShaderSource(sh, 3, srcs, NULL);
+    glCompileShader(sh);
+
+    GLint ok = 0;
+    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+    {
+        char log[1024];
+        glGetShaderInfoLog(sh, sizeof(log), NULL, log);
+        fprintf(stderr, "glcore: shader compile error\n%s\n", log);
+        glDeleteShader(sh);
+        return 0;
+    }
+    return sh;
+}
+
+static GLuint link_program(const char *vs, const char *fs)
+{
+    GLuint v = compile_shader(GL_VERTEX_SHADER, vs);
+    GLuint f = compile_shader(GL_FRAGMENT_SHADER, fs);
+    if (v == 0 || f == 0)
+    {
+        if (v)
+            glDeleteShader(v);
+        if (f)
+            glDeleteShader(f);
+        return 0;
+    }
+
+    GLuint p = glCreateProgram();
+    glAttachShader(p, v);
+    glAttachShader(p, f);
+    glLinkProgram(p);
+    glDeleteShader(v);
+    glDeleteShader(f);
+
+    GLint ok = 0;
+    glGetProgramiv(p, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        char log[1024];
+        glGetProgramInfoLog(p, sizeof(log), NULL, log);
+        fprintf(stderr, "glcore: program link error\n%s\n", log);
+        glDeleteProgram(p);
+        return 0;
+    }
+    return p;
+}
+
+static int align_up(int n, int a)
+{
+    return (a > 0) ? ((n + a - 1) / a) * a : n;
+}
+
+// compile shaders and make buffers. r : ring buffer of per frame data.
+// return 0 if not supported
+int glcore_init(GLRING *r)
+{
+    if (initialized)
+        return 1;
+    if (!glf_has_core || r->buf == 0)
+        return 0;
+    ring = r;
+
+    prog_lit = link_program(lit_vs, lit_fs);
+    prog_unlit = link_program(unlit_vs, unlit_fs);
+    prog_text = link_program(text_vs, text_fs);
+    prog_blit = link_program(blit_vs, blit_fs);
+    prog_color = link_program(color_vs, color_fs);
+    if (prog_lit == 0 || prog_unlit == 0 || prog_text == 0 || prog_blit == 0 || prog_color == 0)
+    {
+        free_gl_objects();
+        return 0;
+    }
+
+    glUniformBlockBinding(prog_lit, glGetUniformBlockIndex(prog_lit, "View"), UBO_VIEW);
+    glUniformBlockBinding(prog_lit, glGetUniformBlockIndex(prog_lit, "Palette"), UBO_PALETTE);
+    lit_scale = glGetUniformLocation(prog_lit, "u_scale");
+    unlit_color = glGetUniformLocation(prog_unlit, "u_color");
+    text_color = glGetUniformLocation(prog_text, "u_color");
+    text_viewport = glGetUniformLocation(prog_text, "u_viewport");
+    color_viewport = glGetUniformLocation(prog_color, "u_viewport");
+    glUseProgram(prog_text);
+    glUniform1i(glGetUniformLocation(prog_text, "u_tex"), 0);
+    glUseProgram(prog_blit);
+    glUniform1i(glGetUniformLocation(prog_blit, "u_tex"), 0);
+    glUseProgram(0);
+
+    // uniform buffers. one block per view / stage
+    GLint align = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+    ubo_align = align;
+    view_stride = align_up(sizeof(VIEWBLOCK), align);
+    pal_stride = align_up(sizeof(float) * 4 * ROADMESH_PAL_MAX, align);
+    view_buf = (unsigned char *)calloc(GLCORE_VIEW_MAX, view_stride);
+
+    GLuint buf[2];
+    glGenBuffers(2, buf);
+    pal_ubo = buf[0];
+    fill_vbo = buf[1];
+
+    glBindBuffer(GL_UNIFORM_BUFFER, pal_ubo);
+    glBufferData(GL_UNIFORM_BUFFER, pal_stride * ROADMESH_STG_MAX, NULL, GL_STATIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // fill quad. whole viewport
+    static const float quad[4][3] = {{-1, -1, 0}, {1, -1, 0}, {-1, 1, 0}, {1, 1, 0}};
+    GLuint vao[2];
+    glGenVertexArrays(2, vao);
+    fill_vao = vao[0];
+    text_vao = vao[1];
+
+    glBindVertexArray(fill_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, fill_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(ATTR_POS);
+    glVertexAttribPointer(ATTR_POS, 3, GL_FLOAT, GL_FALSE, 0, (const void *)0);
+
+    // text and colored vertices are in ring buffer. pointers are set by
+    // glcore_draw_text() and glcore_draw_colored()
+    glBindVertexArray(text_vao);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    initialized = 1;
+    return 1;
+}
+
+static void free_gl_objects(void)
+{
+    if (prog_lit)
+        glDeleteProgram(prog_lit);
+    if (prog_unlit)
+        glDeleteProgram(prog_unlit);
+    if (prog_text)
+        glDeleteProgram(prog_text);
+    if (prog_blit)
+        glDeleteProgram(prog_blit);
+    if (prog_color)
+        glDeleteProgram(prog_color);
+    prog_lit = prog_unlit = prog_text = prog_blit = prog_color = 0;
+
+    if (pal_ubo)
+    {
+        GLuint buf[2] = {pal_ubo, fill_vbo};
+        glDeleteBuffers(2, buf);
+        GLuint vao[2] = {fill_vao, text_vao};
+        glDeleteVertexArrays(2, vao);
+    }
+    pal_ubo = fill_vbo = 0;
+    fill_vao = text_vao = 0;
+
+    for (int i = 0; i < GLCORE_MODEL_MAX; i++)
+    {
+        if (models[i].vao)
+        {
+            glDeleteVertexArrays(1, &models[i].vao);
+            glDeleteBuffers(1, &models[i].vbo);
+        }
+    }
+    memset(models, 0, sizeof(models));
+
+    for (int i = 0; i < GLCORE_FONT_MAX; i++)
+    {
+        if (fonts[i].tex)
+            glDeleteTextures(1, &fonts[i].tex);
+    }
+    memset(fonts, 0, sizeof(fonts));
+
+    for (int i = 0; i < course_num; i++)
+        glDeleteVertexArrays(1, &courses[i].vao);
+    course_num = 0;
+
+    free(view_buf);
+    view_buf = NULL;
+    ring = NULL;
+}
+
+// delete all objects. needs current OpenGL context
+void glcore_cleanup(void)
+{
+    if (!initialized)
+        return;
+    free_gl_objects();
+    initialized = 0;
+}
+
+// model data of render.cpp. vtx_num triangles vertices
+void glcore_add_model(int kind, int vtx_num, const float *vtx, const float *nml, const float *col)
+{
+    if (!initialized || kind < 0 || kind >= GLCORE_MODEL_MAX)
+        return;
+
+    MODEL *m = &models[kind];
+    int vsize = sizeof(float) * vtx_num * 3;
+    int csize = sizeof(float) * vtx_num * 4;
+    m->vtx_num = vtx_num;
+    glGenVertexArrays(1, &m->vao);
+    glGenBuffers(1, &m->vbo);
+
+    glBindVertexArray(m->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+    glBufferData(GL_ARRAY_BUFFER, vsize * 2 + csize, NULL, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vsize, vtx);
+    glBufferSubData(GL_ARRAY_BUFFER, vsize, vsize, nml);
+    glBufferSubData(GL_ARRAY_BUFFER, vsize * 2, csize, col);
+
+    glEnableVertexAttribArray(ATTR_POS);
+    glEnableVertexAttribArray(ATTR_NML);
+    glEnableVertexAttribArray(ATTR_COL);
+    glVertexAttribPointer(ATTR_POS, 3, GL_FLOAT, GL_FALSE, 0, (const void *)0);
+    glVertexAttribPointer(ATTR_NML, 3, GL_FLOAT, GL_FALSE, 0, (const void *)(size_t)vsize);
+    glVertexAttribPointer(ATTR_COL, 4, GL_FLOAT, GL_FALSE, 0, (const void *)(size_t)(vsize * 2));
+
+    // per vehicle. pointer is set by glcore_draw_model()
+    glEnableVertexAttribArray(ATTR_INST);
+    glVertexAttribDivisor(ATTR_INST, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// bitmap font of glbitmfont.h. 96 characters (0x20 - 0x7f) in one texture
+void glcore_add_font(int kind, int w, int h, int chrlen, const unsigned char *bits)
+{
+    if (!initialized || kind < 0 || kind >= GLCORE_FONT_MAX)
+        return;
+
+    int tw = w * 96;
+    int pitch = (w + 7) / 8;
+    unsigned char *img = (unsigned char *)calloc(tw, h);
+
+    // same bit order as glBitmap(). first row is bottom, MSB is left
+    for (int c = 0; c < 96; c++)
+    {
+        const unsigned char *src = bits + chrlen * c;
+        for (int y = 0; y < h; y++)
+            for (int x = 0; x < w; x++)
+                if (src[y * pitch + x / 8] & (0x80 >> (x % 8)))
+                    img[y * tw + c * w + x] = 255;
+    }
+
+    FONT *f = &fonts[kind];
+    f->w = w;
+    f->h = h;
+    glGenTextures(1, &f->tex);
+    glBindTexture(GL_TEXTURE_2D, f->tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, tw, h, 0, GL_RED, GL_UNSIGNED_BYTE, img);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(img);
+}
+
+// vertex array object of course. roadmesh_upload() must be called before
+void glcore_add_course(const ROADMESH *m)
+{
+    if (!initialized || m->vbo == 0 || course_num >= COURSE_MAX)
+        return;
+
+    COURSE *c = &courses[course_num++];
+    c->mesh = m;
+    glGenVertexArrays(1, &c->vao);
+
+    glBindVertexArray(c->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+    glEnableVertexAttribArray(ATTR_POS);
+    glEnableVertexAttribArray(ATTR_PAL);
+    glVertexAttribPointer(ATTR_POS, 3, GL_FLOAT, GL_FALSE, 0, (const void *)0);
+    glVertexAttribPointer(ATTR_PAL, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0,
+                          (const void *)(size_t)roadmesh_get_pal_offset(m));
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+// colors of stage. see ROADMESH_PAL_xxx
+void glcore_set_palette(int stg, const float pal[ROADMESH_PAL_MAX][4])
+{
+    if (!initialized || stg < 0 || stg >= ROADMESH_STG_MAX)
+        return;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, pal_ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, pal_stride * stg, sizeof(float) * 4 * ROADMESH_PAL_MAX, pal);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+// same matrices as set_scene_matrix(). written to uniform buffer by glcore_upload_views()
+void glcore_set_view_matrix(int view, float view_w, float view_h, float zfar)
+{
+    if (!initialized || view < 0 || view >= GLCORE_VIEW_MAX)
+        return;
+
+    VIEWBLOCK *b = (VIEWBLOCK *)(view_buf + view_stride * view);
+    memset(b, 0, sizeof(VIEWBLOCK));
+
+    // glOrtho(-w, w, -h, h, -zfar, zfar)
+    b->proj[0] = 1.0 / view_w;
+    b->proj[5] = 1.0 / view_h;
+    b->proj[10] = -1.0 / zfar;
+    b->proj[15] = 1.0;
+
+    // glRotatef(30, 1, 0, 0)
+    float c = cos(30.0 * M_PI / 180.0);
+    float s = sin(30.0 * M_PI / 180.0);
+    b->view[0] = 1.0;
+    b->view[5] = c;
+    b->view[6] = s;
+    b->view[9] = -s;
+    b->view[10] = c;
+    b->view[15] = 1.0;
+
+    float l = 1.0 / sqrt(3.0);
+    b->light_dir[0] = l;
+    b->light_dir[1] = l;
+    b->light_dir[2] = l;
+    for (int i = 0; i < 3; i++)
+    {
+        b->light_amb[i] = 0.2 + 0.5;
+        b->light_dif[i] = 1.0;
+    }
+    b->light_amb[3] = 1.0;
+    b->light_dif[3] = 1.0;
+}
+
+// write matrices of all views to ring buffer at once
+void glcore_upload_views(int view_num)
+{
+    view_ofs = -1;
+    if (!initialized || view_num <= 0)
+        return;
+
+    int size = view_stride * view_num;
+    void *p = glring_alloc(ring, size, ubo_align, &view_ofs);
+    if (p == NULL)
+    {
+        view_ofs = -1;
+        return;
+    }
+    memcpy(p, view_buf, size);
+    glring_flush(ring, view_ofs, size);
+}
+
+// states of set_scene_state()
+void glcore_begin_scene(void)
+{
+    glEnable(GL_CULL_FACE);
+    glFrontFace(GL_CCW);
+    glCullFace(GL_BACK);
+    glDepthFunc(GL_LESS);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+
+    glUseProgram(prog_lit);
+    glfunc_enable_restart(1);
+}
+
+void glcore_end_scene(void)
+{
+    glfunc_enable_restart(0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glDisable(GL_DEPTH_TEST);
+}
+
+// select uniform blocks of view and stage
+void glcore_set_view(int view, int stg)
+{
+    if (view_ofs >= 0)
+        glBindBufferRange(GL_UNIFORM_BUFFER, UBO_VIEW, ring->buf, view_ofs + view_stride * view,
+                          sizeof(VIEWBLOCK));
+    glBindBufferRange(GL_UNIFORM_BUFFER, UBO_PALETTE, pal_ubo, pal_stride * stg,
+                      sizeof(float) * 4 * ROADMESH_PAL_MAX);
+}
+
+// bind course. draw with roadmesh_draw(m, layer, 0, idx, num)
+void glcore_bind_course(const ROADMESH *m)
+{
+    for (int i = 0; i < course_num; i++)
+    {
+        if (courses[i].mesh == m)
+        {
+            glBindVertexArray(courses[i].vao);
+            break;
+        }
+    }
+
+    // course has no normal and no rotation
+    glVertexAttrib3f(ATTR_NML, 0.0, 0.0, 1.0);
+    glVertexAttrib4f(ATTR_INST, 0.0, 0.0, 0.0, 0.0);
+    glUniform1f(lit_scale, 1.0);
+}
+
+void glcore_set_course_pos(float x, float y, float z)
+{
+    glVertexAttrib4f(ATTR_INST, x, y, z, 0.0);
+}
+
+// instance data of all views, once per frame. return memory for max instances
+// in ring buffer, or NULL if it is full. write and call glcore_unmap_instances()
+GLCOREINST *glcore_map_instances(int max)
+{
+    if (!initialized || max <= 0)
+        return NULL;
+    return (GLCOREINST *)glring_alloc(ring, sizeof(GLCOREINST) * max, sizeof(GLCOREINST), &inst_ofs);
+}
+
+// num instances have been written
+void glcore_unmap_instances(int num)
+{
+    if (num > 0)
+        glring_flush(ring, inst_ofs, sizeof(GLCOREINST) * num);
+}
+
+// draw instances [first, first + num) of glcore_map_instances()
+void glcore_draw_model(int kind, float scale, int first, int num)
+{
+    const MODEL *m = &models[kind];
+    if (m->vao == 0 || num <= 0)
+        return;
+
+    glBindVertexArray(m->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, ring->buf);
+    glVertexAttribPointer(ATTR_INST, 4, GL_FLOAT, GL_FALSE, 0,
+                          (const void *)(size_t)(inst_ofs + sizeof(GLCOREINST) * first));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glVertexAttrib1f(ATTR_PAL, -1.0);
+    glUniform1f(lit_scale, scale);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, m->vtx_num, num);
+}
+
+// fill current viewport. blend state is set by caller
+void glcore_draw_fill(const float col[4])
+{
+    glUseProgram(prog_unlit);
+    glUniform4fv(unlit_color, 1, col);
+    glBindVertexArray(fill_vao);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
+
+// stretch texture to current viewport (bilinear). blend state is set by caller
+void glcore_draw_texture(GLuint tex)
+{
+    glUseProgram(prog_blit);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glBindVertexArray(fill_vao);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+}
+
+// draw text at (x, y) of current viewport (-1.0 - 1.0), same as glRasterPos() + glBitmap()
+void glcore_draw_text(const char *str, float x, float y, int kind, const float col[4])
+{
+    if (kind < 0 || kind >= GLCORE_FONT_MAX || fonts[kind].tex == 0)
+        return;
+
+    const FONT *f = &fonts[kind];
+    int len = strlen(str);
+    if (len <= 0)
+        return;
+
+    int size = sizeof(float) * 4 * 6 * len;
+    int ofs;
+    float *v = (float *)glring_alloc(ring, size, sizeof(float) * 4, &ofs);
+    if (v == NULL)
+        return;
+
+    GLint vp[4];
+    glGetIntegerv(GL_VIEWPORT, vp);
+    // first pixel whose center is in the bitmap rectangle
+    float px = ceil((x + 1.0) * 0.5 * vp[2] - 0.5);
+    float py = ceil((y + 1.0) * 0.5 * vp[3] - 0.5);
+
+    for (int i = 0; i < len; i++)
+    {
+        int c = (unsigned char)str[i];
+        if (c < 0x20 || c > 0x7f)
+            c = 0x20;
+        c -= 0x20;
+
+        float x0 = px + f->w * i;
+        float x1 = x0 + f->w;
+        float y0 = py;
+        float y1 = py + f->h;
+        float u0 = c * f->w;
+        float u1 = u0 + f->w;
+        float q[6][4] = {
+            {x0, y0, u0, 0}, {x1, y0, u1, 0}, {x0, y1, u0, (float)f->h},
+            {x0, y1, u0, (float)f->h}, {x1, y0, u1, 0}, {x1, y1, u1, (float)f->h}};
+        memcpy(v, q, sizeof(q));
+        v += 24;
+    }
+
+    glring_flush(ring, ofs, size);
+
+    glUseProgram(prog_text);
+    glUniform4fv(text_color, 1, col);
+    glUniform2f(text_viewport, vp[2], vp[3]);
+    glBindTexture(GL_TEXTURE_2D, f->tex);
+    glBindVertexArray(text_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, ring->buf);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, (const void *)(size_t)ofs);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4,
+                          (const void *)(size_t)(ofs + sizeof(float) * 2));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDrawArrays(GL_TRIANGLES, 0, len * 6);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+}
+
+// triangles at ofs of ring buffer. vertex = 2 floats of pixel position in
+// current viewport + 4 unsigned bytes of RGBA (12 bytes). blend state is set by caller
+void glcore_draw_colored(int ofs, int num)
+{
+    if (num <= 0)
+        return;
+
+    GLint vp[4];
+    glGetIntegerv(GL_VIEWPORT, vp);
+
+    glUseProgram(prog_color);
+    glUniform2f(color_viewport, vp[2], vp[3]);
+    glBindVertexArray(text_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, ring->buf);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 12, (const void *)(size_t)ofs);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 12, (const void *)(size_t)(ofs + sizeof(float) * 2));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDrawArrays(GL_TRIANGLES, 0, num);
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
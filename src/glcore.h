@@ -0,0 +1,51 @@
+// Last updated: <2026/10/20 08:02:37 +0900>
+//
+// Shader renderer for OpenGL 3.3 core profile (and OpenGL ES 3.0).
+// Same picture as the fixed function path of render.cpp.
+//
+// Shaders : flat-lit mesh, unlit colored geometry, bitmap text, texture blit,
+// vertex colored triangles in pixels.
+// Per view matrices and per stage palette are in uniform buffers.
+// Course and models are vertex array objects. Vehicles are instanced.
+
+#ifndef __GLCORE_H__
+#define __GLCORE_H__
+
+#include "roadmesh.h"
+#include "glring.h"
+
+#define GLCORE_VIEW_MAX 64
+#define GLCORE_MODEL_MAX 4
+#define GLCORE_FONT_MAX 8
+
+// instance data of vehicle. 4 floats
+typedef struct glcoreinst
+{
+    float x, y, z; // position
+    float ang;     // rotation around y axis (degree)
+} GLCOREINST;
+
+// ----------------------------------------
+// prototype declaration
+int glcore_init(GLRING *r);
+void glcore_cleanup(void);
+void glcore_add_model(int kind, int vtx_num, const float *vtx, const float *nml, const float *col);
+void glcore_add_font(int kind, int w, int h, int chrlen, const unsigned char *bits);
+void glcore_add_course(const ROADMESH *m);
+void glcore_set_palette(int stg, const float pal[ROADMESH_PAL_MAX][4]);
+void glcore_set_view_matrix(int view, float view_w, float view_h, float zfar);
+void glcore_upload_views(int view_num);
+void glcore_begin_scene(void);
+void glcore_end_scene(void);
+void glcore_set_view(int view, int stg);
+void glcore_bind_course(const ROADMESH *m);
+void glcore_set_course_pos(float x, float y, float z);
+GLCOREINST *glcore_map_instances(int max);
+void glcore_unmap_instances(int num);
+void glcore_draw_model(int kind, float scale, int first, int num);
+void glcore_draw_fill(const float col[4]);
+void glcore_draw_texture(GLuint tex);
+void glcore_draw_text(const char *str, float x, float y, int kind, const float col[4]);
+void glcore_draw_colored(int ofs, int num);
+
+#endif
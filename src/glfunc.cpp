@@ -0,0 +1,180 @@
+// Last updated: <2026/10/20 07:18:52 +0900>
+//
+// OpenGL 1.5 and later functions. opengl32.dll exports OpenGL 1.1 only,
+// so the functions are loaded at runtime after the context is made current.
+
+#include <stdio.h>
+#include <string.h>
+#include "glfunc.h"
+
+#ifndef _WIN32
+#include <GL/glx.h>
+#endif
+
+#define GLFUNC_DEFINE(type, name) type p_##name = NULL;
+GLFUNC_LIST(GLFUNC_DEFINE)
+#undef GLFUNC_DEFINE
+
+#define RESTART_INDEX 0xffffffff
+
+int glf_version = 0;
+int glf_es = 0;
+int glf_has_vbo = 0;
+int glf_has_restart = 0;
+int glf_has_core = 0;
+int glf_has_sync = 0;
+int glf_has_storage = 0;
+int glf_has_fbo = 0;
+int glf_has_query = 0;
+
+static GLFUNC_GETPROC user_getproc = NULL;
+static int version_limit = 0;
+
+// ----------------------------------------
+// prototype declaration
+static void *get_proc(const char *name);
+static int get_version(void);
+
+// ========================================
+// set function loader of window library (glfwGetProcAddress etc).
+// NULL = wglGetProcAddress / glXGetProcAddressARB
+void glfunc_set_getproc(GLFUNC_GETPROC getproc)
+{
+    user_getproc = getproc;
+}
+
+// use features up to this version only. for checking fallback paths. 0 = no limit
+void glfunc_set_version_limit(int ver)
+{
+    version_limit = ver;
+}
+
+static void *get_proc(const char *name)
+{
+    if (user_getproc)
+        return user_getproc(name);
+#ifdef _WIN32
+    void *p = (void *)wglGetProcAddress(name);
+    // some drivers return 1, 2, 3 or -1 instead of NULL
+    if (p == (void *)0 || p == (void *)1 || p == (void *)2 || p == (void *)3 || p == (void *)-1)
+        return NULL;
+    return p;
+#else
+    return (void *)glXGetProcAddressARB((const GLubyte *)name);
+#endif
+}
+
+static int get_version(void)
+{
+    const char *s = (const char *)glGetString(GL_VERSION);
+    int major = 0;
+    int minor = 0;
+
+    if (s == NULL)
+        return 0;
+
+    glf_es = 0;
+    if (strncmp(s, "OpenGL ES", 9) == 0)
+    {
+        glf_es = 1;
+        while (*s != '\0' && (*s < '0' || *s > '9'))
+            s++;
+    }
+
+    if (sscanf(s, "%d.%d", &major, &minor) != 2)
+        return 0;
+    return major * 10 + minor;
+}
+
+// load functions of current context. return OpenGL version
+int glfunc_load(void)
+{
+#define GLFUNC_LOAD(type, name) p_##name = (type)get_proc(#name);
+    GLFUNC_LIST(GLFUNC_LOAD)
+#undef GLFUNC_LOAD
+
+    glf_version = get_version();
+    if (version_limit > 0 && glf_version > version_limit)
+        glf_version = version_limit;
+
+    int ver = glf_version;
+    glf_has_vbo = (ver >= (glf_es ? 20 : 15) && p_glGenBuffers && p_glDeleteBuffers
+                   && p_glBindBuffer && p_glBufferData && p_glBufferSubData);
+
+    // ES 3.0 has fixed restart index only
+    glf_has_restart = (glf_es) ? (ver >= 30) : (ver >= 31 && p_glPrimitiveRestartIndex);
+
+    // shaders, vertex array objects, uniform buffers and instancing
+    glf_has_core = (ver >= (glf_es ? 30 : 33) && glf_has_vbo && p_glCreateProgram
+                    && p_glGenVertexArrays && p_glBindBufferRange && p_glVertexAttribDivisor
+                    && p_glDrawArraysInstanced);
+
+    glf_has_sync = (ver >= (glf_es ? 30 : 32) && p_glFenceSync && p_glClientWaitSync && p_glDeleteSync);
+
+    // ARB_buffer_storage. not in OpenGL ES. extension is ignored if version is limited
+    glf_has_storage = (!glf_es && glf_has_vbo && glf_has_sync && p_glBufferStorage && p_glMapBufferRange
+                       && (ver >= 44 || (version_limit == 0 && ver >= 30
+                                         && glfunc_has_extension("GL_ARB_buffer_storage"))));
+
+    // render to texture. ES 2.0 has it, but not glGenerateMipmap() of all formats
+    glf_has_fbo = (p_glGenFramebuffers && p_glBindFramebuffer && p_glFramebufferTexture2D
+                   && p_glRenderbufferStorage && p_glGenerateMipmap
+                   && (ver >= 30 || (version_limit == 0 && glfunc_has_extension("GL_ARB_framebuffer_object"))));
+
+    // GL_PRIMITIVES_GENERATED is in ES 3.2
+    glf_has_query = (!glf_es && ver >= 30 && p_glGenQueries && p_glBeginQuery && p_glEndQuery
+                     && p_glGetQueryObjectuiv);
+    return glf_version;
+}
+
+int glfunc_has_extension(const char *name)
+{
+    // GL_EXTENSIONS of glGetString() is removed in core profile
+    if (glf_version >= 30 && p_glGetStringi)
+    {
+        GLint n = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+        for (int i = 0; i < n; i++)
+        {
+            const char *e = (const char *)glGetStringi(GL_EXTENSIONS, i);
+            if (e && strcmp(e, name) == 0)
+                return 1;
+        }
+        return 0;
+    }
+
+    const char *s = (const char *)glGetString(GL_EXTENSIONS);
+    if (s == NULL)
+        return 0;
+
+    int len = strlen(name);
+    while ((s = strstr(s, name)) != NULL)
+    {
+        if (s[len] == ' ' || s[len] == '\0')
+            return 1;
+        s += len;
+    }
+    return 0;
+}
+
+// primitive restart with index 0xffffffff (GL_UNSIGNED_INT)
+void glfunc_enable_restart(int fg)
+{
+    if (!glf_has_restart)
+        return;
+
+    GLenum cap = GL_PRIMITIVE_RESTART;
+    if (glf_es || glf_version >= 43)
+        cap = GL_PRIMITIVE_RESTART_FIXED_INDEX;
+
+    if (fg)
+    {
+        if (cap == GL_PRIMITIVE_RESTART)
+            glPrimitiveRestartIndex(RESTART_INDEX);
+        glEnable(cap);
+    }
+    else
+    {
+        glDisable(cap);
+    }
+}
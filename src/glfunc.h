@@ -0,0 +1,171 @@
+// Last updated: <2026/10/20 08:47:15 +0900>
+//
+// OpenGL 1.5 and later functions. opengl32.dll exports OpenGL 1.1 only,
+// so the functions are loaded at runtime after the context is made current.
+
+#ifndef __GLFUNC_H__
+#define __GLFUNC_H__
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+typedef void *(*GLFUNC_GETPROC)(const char *name);
+
+// list of functions. F(type, name)
+#define GLFUNC_LIST(F)                                                   \
+    F(PFNGLGENBUFFERSPROC, glGenBuffers)                                 \
+    F(PFNGLDELETEBUFFERSPROC, glDeleteBuffers)                           \
+    F(PFNGLBINDBUFFERPROC, glBindBuffer)                                 \
+    F(PFNGLBUFFERDATAPROC, glBufferData)                                 \
+    F(PFNGLBUFFERSUBDATAPROC, glBufferSubData)                           \
+    F(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex)           \
+    F(PFNGLCREATESHADERPROC, glCreateShader)                             \
+    F(PFNGLDELETESHADERPROC, glDeleteShader)                             \
+    F(PFNGLSHADERSOURCEPROC, glShaderSource)                             \
+    F(PFNGLCOMPILESHADERPROC, glCompileShader)                           \
+    F(PFNGLGETSHADERIVPROC, glGetShaderiv)                               \
+    F(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog)                     \
+    F(PFNGLCREATEPROGRAMPROC, glCreateProgram)                           \
+    F(PFNGLDELETEPROGRAMPROC, glDeleteProgram)                           \
+    F(PFNGLATTACHSHADERPROC, glAttachShader)                             \
+    F(PFNGLLINKPROGRAMPROC, glLinkProgram)                               \
+    F(PFNGLGETPROGRAMIVPROC, glGetProgramiv)                             \
+    F(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog)                   \
+    F(PFNGLUSEPROGRAMPROC, glUseProgram)                                 \
+    F(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation)                 \
+    F(PFNGLUNIFORM1IPROC, glUniform1i)                                   \
+    F(PFNGLUNIFORM1FPROC, glUniform1f)                                   \
+    F(PFNGLUNIFORM2FPROC, glUniform2f)                                   \
+    F(PFNGLUNIFORM4FVPROC, glUniform4fv)                                 \
+    F(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex)             \
+    F(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding)               \
+    F(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange)                       \
+    F(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays)                       \
+    F(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays)                 \
+    F(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray)                       \
+    F(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray)       \
+    F(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray)     \
+    F(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer)               \
+    F(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f)                         \
+    F(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f)                         \
+    F(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f)                         \
+    F(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor)               \
+    F(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced)               \
+    F(PFNGLGETSTRINGIPROC, glGetStringi)                                 \
+    F(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange)                         \
+    F(PFNGLUNMAPBUFFERPROC, glUnmapBuffer)                               \
+    F(PFNGLBUFFERSTORAGEPROC, glBufferStorage)                           \
+    F(PFNGLFENCESYNCPROC, glFenceSync)                                   \
+    F(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync)                         \
+    F(PFNGLDELETESYNCPROC, glDeleteSync)                                 \
+    F(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers)                       \
+    F(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers)                 \
+    F(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer)                       \
+    F(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D)             \
+    F(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus)         \
+    F(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers)                     \
+    F(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers)               \
+    F(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer)                     \
+    F(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage)               \
+    F(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer)       \
+    F(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap)                         \
+    F(PFNGLGENQUERIESPROC, glGenQueries)                                 \
+    F(PFNGLDELETEQUERIESPROC, glDeleteQueries)                           \
+    F(PFNGLBEGINQUERYPROC, glBeginQuery)                                 \
+    F(PFNGLENDQUERYPROC, glEndQuery)                                     \
+    F(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv)
+
+#define GLFUNC_DECLARE(type, name) extern type p_##name;
+GLFUNC_LIST(GLFUNC_DECLARE)
+#undef GLFUNC_DECLARE
+
+#define glGenBuffers p_glGenBuffers
+#define glDeleteBuffers p_glDeleteBuffers
+#define glBindBuffer p_glBindBuffer
+#define glBufferData p_glBufferData
+#define glBufferSubData p_glBufferSubData
+#define glPrimitiveRestartIndex p_glPrimitiveRestartIndex
+#define glCreateShader p_glCreateShader
+#define glDeleteShader p_glDeleteShader
+#define glShaderSource p_glShaderSource
+#define glCompileShader p_glCompileShader
+#define glGetShaderiv p_glGetShaderiv
+#define glGetShaderInfoLog p_glGetShaderInfoLog
+#define glCreateProgram p_glCreateProgram
+#define glDeleteProgram p_glDeleteProgram
+#define glAttachShader p_glAttachShader
+#define glLinkProgram p_glLinkProgram
+#define glGetProgramiv p_glGetProgramiv
+#define glGetProgramInfoLog p_glGetProgramInfoLog
+#define glUseProgram p_glUseProgram
+#define glGetUniformLocation p_glGetUniformLocation
+#define glUniform1i p_glUniform1i
+#define glUniform1f p_glUniform1f
+#define glUniform2f p_glUniform2f
+#define glUniform4fv p_glUniform4fv
+#define glGetUniformBlockIndex p_glGetUniformBlockIndex
+#define glUniformBlockBinding p_glUniformBlockBinding
+#define glBindBufferRange p_glBindBufferRange
+#define glGenVertexArrays p_glGenVertexArrays
+#define glDeleteVertexArrays p_glDeleteVertexArrays
+#define glBindVertexArray p_glBindVertexArray
+#define glEnableVertexAttribArray p_glEnableVertexAttribArray
+#define glDisableVertexAttribArray p_glDisableVertexAttribArray
+#define glVertexAttribPointer p_glVertexAttribPointer
+#define glVertexAttrib1f p_glVertexAttrib1f
+#define glVertexAttrib3f p_glVertexAttrib3f
+#define glVertexAttrib4f p_glVertexAttrib4f
+#define glVertexAttribDivisor p_glVertexAttribDivisor
+#define glDrawArraysInstanced p_glDrawArraysInstanced
+#define glGetStringi p_glGetStringi
+#define glMapBufferRange p_glMapBufferRange
+#define glUnmapBuffer p_glUnmapBuffer
+#define glBufferStorage p_glBufferStorage
+#define glFenceSync p_glFenceSync
+#define glClientWaitSync p_glClientWaitSync
+#define glDeleteSync p_glDeleteSync
+#define glGenFramebuffers p_glGenFramebuffers
+#define glDeleteFramebuffers p_glDeleteFramebuffers
+#define glBindFramebuffer p_glBindFramebuffer
+#define glFramebufferTexture2D p_glFramebufferTexture2D
+#define glCheckFramebufferStatus p_glCheckFramebufferStatus
+#define glGenRenderbuffers p_glGenRenderbuffers
+#define glDeleteRenderbuffers p_glDeleteRenderbuffers
+#define glBindRenderbuffer p_glBindRenderbuffer
+#define glRenderbufferStorage p_glRenderbufferStorage
+#define glFramebufferRenderbuffer p_glFramebufferRenderbuffer
+#define glGenerateMipmap p_glGenerateMipmap
+#define glGenQueries p_glGenQueries
+#define glDeleteQueries p_glDeleteQueries
+#define glBeginQuery p_glBeginQuery
+#define glEndQuery p_glEndQuery
+#define glGetQueryObjectuiv p_glGetQueryObjectuiv
+
+// OpenGL version of current context. major * 10 + minor. 0 = not loaded
+extern int glf_version;
+extern int glf_es;
+
+// features
+extern int glf_has_vbo;     // vertex buffer object (1.5)
+extern int glf_has_restart; // primitive restart (3.1, ES 3.0)
+extern int glf_has_core;    // shader renderer (3.3, ES 3.0)
+extern int glf_has_sync;    // fence sync objects (3.2, ES 3.0)
+extern int glf_has_storage; // persistent mapped buffer (4.4, ARB_buffer_storage)
+extern int glf_has_fbo;     // framebuffer object (3.0, ARB_framebuffer_object)
+extern int glf_has_query;   // primitives generated query (3.0. not in ES 3.0)
+
+// ----------------------------------------
+// prototype declaration
+void glfunc_set_getproc(GLFUNC_GETPROC getproc);
+void glfunc_set_version_limit(int ver);
+int glfunc_load(void);
+int glfunc_has_extension(const char *name);
+void glfunc_enable_restart(int fg);
+
+// OpenGL calls of all modules can be captured
+#include "glcapture.h"
+
+#endif
@@ -0,0 +1,216 @@
+// Last updated: <2026/10/20 08:47:15 +0900>
+//
+// Streaming ring buffer for vertex / instance / uniform data made every frame.
+//
+// Buffer is divided into slots, one slot per frame. A fence is put after
+// the draw calls of a frame, and the slot is reused after GPU has passed
+// the fence, so the mapped memory is never written while GPU reads it.
+
+#include <stdlib.h>
+#include <string.h>
+#include "glring.h"
+
+// GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT is 256 or less on most GPUs
+#define SLOT_ALIGN 256
+
+// 1 sec
+#define FENCE_TIMEOUT 1000000000
+
+// ----------------------------------------
+// prototype declaration
+static int align_up(int n, int a);
+static int create_buffer(GLRING *r);
+static void delete_buffer(GLRING *r);
+static void wait_fence(GLRING *r, int slot);
+
+// ========================================
+static int align_up(int n, int a)
+{
+    return (a > 0) ? ((n + a - 1) / a) * a : n;
+}
+
+static int create_buffer(GLRING *r)
+{
+    GLsizeiptr total = (GLsizeiptr)r->slot_size * r->slot_num;
+
+    glGenBuffers(1, &r->buf);
+    glBindBuffer(GL_ARRAY_BUFFER, r->buf);
+
+    r->persistent = 0;
+    r->ptr = NULL;
+
+    // writes into mapped memory cannot be captured
+    if (glf_has_storage && !glcapture_is_active())
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, total, NULL, flags);
+        r->ptr = (unsigned char *)glMapBufferRange(GL_ARRAY_BUFFER, 0, total, flags);
+        if (r->ptr)
+        {
+            r->persistent = 1;
+        }
+        else
+        {
+            // buffer storage is immutable. make new buffer for fallback
+            glDeleteBuffers(1, &r->buf);
+            glGenBuffers(1, &r->buf);
+            glBindBuffer(GL_ARRAY_BUFFER, r->buf);
+        }
+    }
+
+    if (!r->persistent)
+    {
+        glBufferData(GL_ARRAY_BUFFER, total, NULL, GL_STREAM_DRAW);
+        r->ptr = (unsigned char *)malloc(total);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    if (r->ptr == NULL)
+    {
+        glDeleteBuffers(1, &r->buf);
+        r->buf = 0;
+        return 0;
+    }
+    return 1;
+}
+
+static void delete_buffer(GLRING *r)
+{
+    for (int i = 0; i < GLRING_SLOT_MAX; i++)
+    {
+        if (r->fence[i])
+            glDeleteSync(r->fence[i]);
+        r->fence[i] = 0;
+    }
+
+    if (r->buf == 0)
+        return;
+
+    if (r->persistent)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, r->buf);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    else
+    {
+        free(r->ptr);
+    }
+    glDeleteBuffers(1, &r->buf);
+    r->buf = 0;
+    r->ptr = NULL;
+    r->persistent = 0;
+}
+
+// wait until GPU has finished the frame which used the slot
+static void wait_fence(GLRING *r, int slot)
+{
+    GLsync f = r->fence[slot];
+    if (f == 0)
+        return;
+
+    GLenum ret = glClientWaitSync(f, 0, 0);
+    if (ret == GL_TIMEOUT_EXPIRED)
+    {
+        r->stall++;
+        do
+        {
+            ret = glClientWaitSync(f, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+        } while (ret == GL_TIMEOUT_EXPIRED);
+    }
+
+    glDeleteSync(f);
+    r->fence[slot] = 0;
+}
+
+// slot_size bytes per frame, slot_num frames in flight. needs current OpenGL context.
+// return 0 if buffer object is not supported
+int glring_init(GLRING *r, int slot_size, int slot_num)
+{
+    memset(r, 0, sizeof(GLRING));
+    if (!glf_has_vbo)
+        return 0;
+
+    if (slot_num < 1)
+        slot_num = 1;
+    if (slot_num > GLRING_SLOT_MAX)
+        slot_num = GLRING_SLOT_MAX;
+    r->slot_num = slot_num;
+    r->slot_size = align_up(slot_size, SLOT_ALIGN);
+    r->slot = slot_num - 1;
+    return create_buffer(r);
+}
+
+void glring_free(GLRING *r)
+{
+    delete_buffer(r);
+    r->head = 0;
+    r->need = 0;
+}
+
+// select next slot. call before any glring_alloc() of the frame
+void glring_begin_frame(GLRING *r)
+{
+    if (r->buf == 0)
+        return;
+
+    // last frame did not fit. make larger buffer (old one is deleted after GPU has used it)
+    if (r->need > r->slot_size)
+    {
+        delete_buffer(r);
+        r->slot_size = align_up(r->need + r->need / 2, SLOT_ALIGN);
+        r->slot = r->slot_num - 1;
+        if (!create_buffer(r))
+            return;
+    }
+
+    r->slot = (r->slot + 1) % r->slot_num;
+    r->head = 0;
+    r->need = 0;
+    wait_fence(r, r->slot);
+}
+
+// call after the last draw call which uses data of the frame
+void glring_end_frame(GLRING *r)
+{
+    if (r->buf == 0 || !glf_has_sync)
+        return;
+
+    // glBufferSubData() is synchronized by driver, but fence keeps
+    // persistent mapped slot from being overwritten
+    if (r->persistent)
+        r->fence[r->slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+// sub-allocate size bytes aligned to align bytes (power of 2, 256 or less).
+// *ofs = offset in r->buf. write data to returned pointer, then call glring_flush().
+// return NULL if slot is full. slot is enlarged at next frame
+void *glring_alloc(GLRING *r, int size, int align, int *ofs)
+{
+    if (r->buf == 0 || size <= 0)
+        return NULL;
+
+    r->need = align_up(r->need, align) + size;
+
+    int pos = align_up(r->head, align);
+    if (pos + size > r->slot_size)
+        return NULL;
+
+    r->head = pos + size;
+
+    *ofs = r->slot_size * r->slot + pos;
+    return r->ptr + *ofs;
+}
+
+// make written data visible to GPU. GL_ARRAY_BUFFER binding is reset to 0
+void glring_flush(GLRING *r, int ofs, int size)
+{
+    // coherent mapping needs nothing
+    if (r->persistent || r->buf == 0)
+        return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, r->buf);
+    glBufferSubData(GL_ARRAY_BUFFER, ofs, size, r->ptr + ofs);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -0,0 +1,40 @@
+// Last updated: <2026/10/19 20:21:48 +0900>
+//
+// Streaming ring buffer for vertex / instance / uniform data made every frame.
+//
+// Persistent mapped buffer (ARB_buffer_storage) if available. CPU writes
+// into the mapped memory directly, and each frame slot is protected by
+// a fence. On older contexts the data is written to system memory and
+// sent by glBufferSubData().
+
+#ifndef __GLRING_H__
+#define __GLRING_H__
+
+#include "glfunc.h"
+
+#define GLRING_SLOT_MAX 4
+
+typedef struct glring
+{
+    GLuint buf;            // buffer object. 0 = not available
+    int slot_num;          // number of frame slots
+    int slot_size;         // bytes per slot
+    int slot;              // slot of current frame
+    int head;              // used bytes of current slot
+    int need;              // requested bytes of current frame. slot grows to this
+    int persistent;        // 1 = persistent mapped, 0 = glBufferSubData()
+    unsigned char *ptr;    // mapped memory, or system memory of fallback
+    GLsync fence[GLRING_SLOT_MAX];
+    int stall;             // number of frames which waited for GPU
+} GLRING;
+
+// ----------------------------------------
+// prototype declaration
+int glring_init(GLRING *r, int slot_size, int slot_num);
+void glring_free(GLRING *r);
+void glring_begin_frame(GLRING *r);
+void glring_end_frame(GLRING *r);
+void *glring_alloc(GLRING *r, int size, int align, int *ofs);
+void glring_flush(GLRING *r, int ofs, int size);
+
+#endif
@@ -0,0 +1,64 @@
+#!python
+# -*- mode: python; Encoding: utf-8; coding: utf-8 -*-
+# Last updated: <2026/10/20 14:58:02 +0900>
+"""
+Make model list
+
+Read models.csv (name of obj file of pyobj2c.py, scale), and output
+the table of model kind order (modeldata.cpp).
+The order of lines is the model kind.
+
+Usage:
+    python make_model_list.py -i models.csv > modeldata.cpp
+
+License: CC0 / Public Domain
+"""
+
+import argparse
+import csv
+
+
+def load_csv(infile):
+    """load csv file. return list of (obj file name, scale)."""
+
+    models = []
+    with open(infile, "r", newline="") as file:
+        for row in csv.reader(file):
+            if len(row) < 2 or row[0].startswith("#"):
+                continue
+            models.append((row[0].strip(), row[1].strip()))
+    return models
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-i", "--input", required=True, help="Input csv file")
+    args = parser.parse_args()
+
+    models = load_csv(args.input)
+
+    print("// Object data. Made by makemodeldata/make_model_list.py from models.csv,")
+    print("// do not edit. Vertices made by makemodeldata/pyobj2c.py")
+    print()
+    print('#include "modeldata.h"')
+    for obj, _ in models:
+        print(f'#include "{obj.split(".")[0]}.h"')
+    print()
+    print(f"#if MODEL_MAX != {len(models)}")
+    print(f'#error "MODEL_MAX of modeldata.h must be {len(models)}, lines of models.csv"')
+    print("#endif")
+    print()
+    print("// ----------------------------------------")
+    print("// order of model kind")
+    print("MODELDATA models[MODEL_MAX] = {")
+    for obj, scale in models:
+        label = obj.replace(".", "_")
+        print(f"    {{// {obj.split('.')[0]}")
+        print(f"     {scale},")
+        refs = [f"{label}_{k}_size, &{label}_{k}[0][0]" for k in ("vtx", "nml", "col", "uv")]
+        print("     " + ",\n     ".join(refs) + "},")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
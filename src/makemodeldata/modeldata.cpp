@@ -0,0 +1,27 @@
+// Object data. Made by makemodeldata/make_model_list.py from models.csv,
+// do not edit. Vertices made by makemodeldata/pyobj2c.py
+
+#include "modeldata.h"
+#include "car.h"
+#include "scooter.h"
+
+#if MODEL_MAX != 2
+#error "MODEL_MAX of modeldata.h must be 2, lines of models.csv"
+#endif
+
+// ----------------------------------------
+// order of model kind
+MODELDATA models[MODEL_MAX] = {
+    {// car
+     12.0,
+     car_obj_vtx_size, &car_obj_vtx[0][0],
+     car_obj_nml_size, &car_obj_nml[0][0],
+     car_obj_col_size, &car_obj_col[0][0],
+     car_obj_uv_size, &car_obj_uv[0][0]},
+    {// scooter
+     16.0,
+     scooter_obj_vtx_size, &scooter_obj_vtx[0][0],
+     scooter_obj_nml_size, &scooter_obj_nml[0][0],
+     scooter_obj_col_size, &scooter_obj_col[0][0],
+     scooter_obj_uv_size, &scooter_obj_uv[0][0]},
+};
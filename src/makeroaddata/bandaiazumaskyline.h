@@ -1,4231 +1,432 @@
 #ifndef __BANDAIAZUMASKYLINE__
 #define __BANDAIAZUMASKYLINE__
 
-#include "roads.h"
+#define BANDAIAZUMASKYLINE_NUM 422
 
-#define BANDAIAZUMASKYLINE_NUM 4220
-
-static ROADDATA bandaiazumaskyline_data[4220] = {
-  { 140239094.495773, 48944583.504751615, 140239074.83541664, 48944618.3396535, 140239114.15612933, 48944548.66984973, 140239093.5127552, 48944585.24649671, 140239095.4787908, 48944581.76300652, 0, 0, 0, 0, 0 },
-  { 140239111.92862648, 48944593.343622774, 140239097.23263088, 48944630.54614572, 140239126.62462208, 48944556.141099826, 140239111.1938267, 48944595.20374892, 140239112.66342625, 48944591.48349663, 1, 3, 140239198.26760057, 48944374.77880046, 38 },
-  { 140239135.57192308, 48944602.68335984, 140239124.4610031, 48944641.10922947, 140239146.68284306, 48944564.25749021, 140239135.0163771, 48944604.60465332, 140239136.12746906, 48944600.76206636, 0, 0, 0, 0, 0 },
-  { 140239163.96646556, 48944610.893700756, 140239155.98702917, 48944650.08972855, 140239171.94590196, 48944571.69767296, 140239163.56749374, 48944612.85350215, 140239164.3654374, 48944608.933899365, 0, 0, 0, 0, 0 },
-  { 140239195.65305695, 48944617.34438352, 140239190.84237105, 48944657.05404609, 140239200.46374285, 48944577.63472096, 140239195.41252264, 48944619.32986665, 140239195.89359125, 48944615.3589004, 0, 0, 0, 0, 0 },
-  { 140239229.1725001, 48944621.40514613, 140239227.94500494, 48944661.38630739, 140239230.39999527, 48944581.42398487, 140239229.11112535, 48944623.40420419, 140239229.23387486, 48944619.40608807, 0, 0, 0, 0, 0 },
-  { 140239263.06559798, 48944622.44572654, 140239266.2376048, 48944662.31975785, 140239259.89359117, 48944582.57169524, 140239263.2241983, 48944624.439428106, 140239262.90699765, 48944620.45202498, 0, 0, 0, 0, 0 },
-  { 140239295.87315348, 48944619.83586276, 140239304.75350797, 48944658.837648675, 140239286.99279898, 48944580.83407685, 140239296.31717122, 48944621.78595206, 140239295.42913574, 48944617.885773465, 1, 2, 140239244.81111518, 48944395.575593784, 29 },
-  { 140239326.1359696, 48944612.945292786, 140239342.53327218, 48944649.4299261, 140239309.73866704, 48944576.460659474, 140239326.95583475, 48944614.769524455, 140239325.31610447, 48944611.12106112, 0, 0, 0, 0, 0 },
-  { 140239352.3948492, 48944601.14375457, 140239378.0135393, 48944631.86317378, 140239326.7761591, 48944570.42433536, 140239353.67578372, 48944602.679725535, 140239351.1139147, 48944599.60778361, 0, 0, 0, 0, 0 },
-  { 140239373.19059524, 48944583.800986156, 140239407.14472434, 48944604.946130216, 140239339.23646614, 48944562.655842096, 140239374.8883017, 48944584.85824336, 140239371.49288878, 48944582.74372895, 0, 0, 0, 0, 0 },
-  { 140239387.58887088, 48944560.68074121, 140239425.49587494, 48944573.450198665, 140239349.68186682, 48944547.91128376, 140239389.48422107, 48944561.31921408, 140239385.6935207, 48944560.04226834, 1, 2, 140239063.48398623, 48944451.50187998, 28 },
-  { 140239396.8484218, 48944533.193133704, 140239436.08434126, 48944540.97404791, 140239357.61250237, 48944525.4122195, 140239398.8102178, 48944533.58217941, 140239394.88662583, 48944532.804088, 0, 0, 0, 0, 0 },
-  { 140239402.80070946, 48944503.17821871, 140239442.38567626, 48944508.92542707, 140239363.21574265, 48944497.43101034, 140239404.7799578, 48944503.46557912, 140239400.8214611, 48944502.89085829, 0, 0, 0, 0, 0 },
-  { 140239407.26075518, 48944472.45882403, 140239446.90726474, 48944477.76488473, 140239367.61424562, 48944467.15276333, 140239409.24308065, 48944472.72412707, 140239405.27842972, 48944472.19352099, 0, 0, 0, 0, 0 },
-  { 140239411.32338777, 48944442.10312119, 140239451.00956237, 48944447.10387564, 140239371.63721317, 48944437.102366745, 140239413.3076965, 48944442.35315891, 140239409.33907905, 48944441.85308347, 0, 0, 0, 0, 0 },
-  { 140239415.09810776, 48944412.14680201, 140239454.8173399, 48944416.87782701, 140239375.3788756, 48944407.415777005, 140239417.08406937, 48944412.383353256, 140239413.11214614, 48944411.91025076, 0, 0, 0, 0, 0 },
-  { 140239418.62330812, 48944382.5510481, 140239458.3694215, 48944387.05065595, 140239378.87719473, 48944378.05144025, 140239420.6106138, 48944382.77602849, 140239416.63600245, 48944382.32606771, 0, 0, 0, 0, 0 },
-  { 140239421.9373819, 48944353.27704106, 140239461.7046117, 48944357.58603558, 140239382.1701521, 48944348.968046546, 140239423.92574337, 48944353.49249079, 140239419.94902042, 48944353.061591335, 0, 0, 0, 0, 0 },
-  { 140239425.07872212, 48944324.28596246, 140239464.86166877, 48944328.447351076, 140239385.29577547, 48944320.12457385, 140239427.06786945, 48944324.49403189, 140239423.08957478, 48944324.07789303, 1, 3, 140239054.10274452, 48944285.48101368, 37 },
-  { 140239428.0857218, 48944295.5389939, 140239467.8792795, 48944299.59765938, 140239388.2921641, 48944291.480328426, 140239430.07539967, 48944295.74192718, 140239426.0960439, 48944295.33606063, 1, 4, 140239581.29091895, 48944311.164855994, 48 },
-  { 140239430.99677387, 48944266.99731698, 140239470.7960365, 48944270.99965293, 140239391.19751123, 48944262.99498103, 140239432.986737, 48944267.19743378, 140239429.00681072, 48944266.79720018, 0, 0, 0, 0, 0 },
-  { 140239433.8502714, 48944238.622113295, 140239473.65042016, 48944242.615627885, 140239394.05012265, 48944234.628598705, 140239435.84027883, 48944238.821789026, 140239431.86026397, 48944238.42243756, 0, 0, 0, 0, 0 },
-  { 140239436.6846075, 48944210.374564424, 140239476.48078537, 48944214.40745763, 140239396.88842964, 48944206.34167122, 140239438.6744164, 48944210.57620908, 140239434.69479862, 48944210.172919765, 1, 3, 140239249.64257157, 48944191.419966355, 45 },
-  { 140239439.53817502, 48944182.21585196, 140239479.3253545, 48944186.33657411, 140239399.75099555, 48944178.09512982, 140239441.52753398, 48944182.42188807, 140239437.54881606, 48944182.00981586, 1, 1, 140239556.9103544, 48944194.371982284, 47 },
-  { 140239442.44936705, 48944154.10715749, 140239482.22221822, 48944158.363953225, 140239402.67651588, 48944149.85036176, 140239444.4380096, 48944154.31999728, 140239440.4607245, 48944153.8943177, 0, 0, 0, 0, 0 },
-  { 140239445.45657656, 48944126.00966263, 140239485.20934284, 48944130.45011013, 140239405.70381027, 48944121.56921513, 140239447.44421488, 48944126.231685005, 140239443.46893823, 48944125.78764025, 1, 2, 140239786.33654732, 48944164.086499944, 42 },
-  { 140239448.5981967, 48944097.884548955, 140239488.3245853, 48944102.55510007, 140239408.87180808, 48944093.21399784, 140239450.5845161, 48944098.11807651, 140239446.61187726, 48944097.6510214, 1, 1, 140239210.239865, 48944069.86124226, 28 },
-  { 140239451.91262028, 48944069.69299804, 140239491.60576513, 48944074.63812205, 140239412.21947542, 48944064.74787402, 140239453.8972775, 48944069.940254234, 140239449.92796305, 48944069.44574184, 1, 3, 140239663.27861664, 48944096.025783405, 36 },
-  { 140239455.43784678, 48944041.396978386, 140239495.09197408, 48944046.645805776, 140239415.78371948, 48944036.148150995, 140239457.42055315, 48944041.65941975, 140239453.4551404, 48944041.13453702, 1, 0, 140239186.7811344, 48944005.836172834, 30 },
-  { 140239459.19860727, 48944012.98498005, 140239498.80962595, 48944018.54979806, 140239419.58758858, 48944007.42016204, 140239461.1791582, 48944013.26322095, 140239457.21805632, 48944012.70673914, 1, 5, 140239748.3590436, 48944053.60815153, 33 },
-  { 140239463.20349002, 48943984.47776109, 140239502.7670847, 48943990.37029674, 140239423.63989535, 48943978.58522544, 140239465.18166974, 48943984.77238787, 140239461.2253103, 48943984.18313431, 1, 1, 140239186.2583273, 48943943.23001154, 49 },
-  { 140239467.46010745, 48943955.89802962, 140239506.97157985, 48943962.13048897, 140239427.94863504, 48943949.66557027, 140239469.43568107, 48943956.20965259, 140239465.48453382, 48943955.58640665, 0, 0, 0, 0, 0 },
-  { 140239471.97607225, 48943927.26849372, 140239511.43030566, 48943933.853588015, 140239432.52183884, 48943920.683399424, 140239473.94878393, 48943927.597748436, 140239470.00336057, 48943926.939239, 1, 4, 140239211.57813182, 48943883.80687137, 45 },
-  { 140239476.7589969, 48943898.61186147, 140239516.15041688, 48943905.56283498, 140239437.36757693, 48943891.66088796, 140239478.7285679, 48943898.959410146, 140239474.7894259, 48943898.26431279, 1, 0, 140239698.33573425, 48943937.71108744, 46 },
-  { 140239481.81649405, 48943869.950840995, 140239521.1390253, 48943877.2814982, 140239442.4939628, 48943862.62018379, 140239483.7826206, 48943870.31737386, 140239479.8503675, 48943869.58430813, 0, 0, 0, 0, 0 },
-  { 140239487.15617624, 48943841.30814036, 140239526.4031951, 48943849.03287392, 140239447.90915737, 48943833.5834068, 140239489.11852717, 48943841.694377035, 140239485.1938253, 48943840.921903685, 0, 0, 0, 0, 0 },
-  { 140239492.78565606, 48943812.706467666, 140239531.94993824, 48943820.840286024, 140239453.6213739, 48943804.57264931, 140239494.74387017, 48943813.11315858, 140239490.82744196, 48943812.29977675, 1, 2, 140239250.94621357, 48943762.480139315, 32 },
-  { 140239498.71254608, 48943784.16853101, 140239537.78620905, 48943792.72708589, 140239459.6388831, 48943775.60997613, 140239500.66622922, 48943784.596458755, 140239496.75886294, 48943783.74060326, 0, 0, 0, 0, 0 },
-  { 140239504.94445887, 48943755.71703849, 140239543.9186759, 48943764.71761667, 140239465.97024184, 48943746.71646031, 140239506.89316973, 48943756.1670674, 140239502.995748, 48943755.26700958, 0, 0, 0, 0, 0 },
-  { 140239511.48988074, 48943727.3741157, 140239550.35147154, 48943736.849175654, 140239472.62828994, 48943717.89905574, 140239513.43296027, 48943727.847868696, 140239509.5468012, 48943726.9003627, 0, 0, 0, 0, 0 },
-  { 140239518.37062678, 48943699.15300278, 140239557.10222897, 48943709.146150015, 140239479.6390246, 48943689.15985555, 140239520.3072069, 48943699.65266015, 140239516.43404666, 48943698.65334542, 0, 0, 0, 0, 0 },
-  { 140239525.6189041, 48943671.06001187, 140239564.20132542, 48943681.61447854, 140239487.0364828, 48943660.5055452, 140239527.5480252, 48943671.587735206, 140239523.68978304, 48943670.53228854, 0, 0, 0, 0, 0 },
-  { 140239533.26719525, 48943643.101271726, 140239571.67938426, 48943654.25939596, 140239494.85500625, 48943631.943147495, 140239535.1878047, 48943643.65917794, 140239531.3465858, 48943642.543365516, 0, 0, 0, 0, 0 },
-  { 140239541.3479824, 48943615.28291113, 140239579.56695196, 48943627.08589242, 140239503.12901285, 48943603.47992984, 140239543.2589309, 48943615.8730602, 140239539.43703392, 48943614.69276206, 0, 0, 0, 0, 0 },
-  { 140239549.893748, 48943587.61105887, 140239587.8945271, 48943600.098684214, 140239511.89296886, 48943575.12343352, 140239551.79378694, 48943588.235440135, 140239547.99370903, 48943586.9866776, 1, 2, 140239262.9878657, 48943493.3294875, 38 },
-  { 140239558.93697438, 48943560.091843724, 140239596.69259402, 48943573.302187614, 140239521.18135473, 48943546.881499834, 140239560.82475537, 48943560.75236092, 140239557.04919338, 48943559.43132653, 0, 0, 0, 0, 0 },
-  { 140239568.51014382, 48943532.731394425, 140239605.9940987, 48943546.69395601, 140239531.02618894, 48943518.76883284, 140239570.38434157, 48943533.42952251, 140239566.63594607, 48943532.03326634, 0, 0, 0, 0, 0 },
-  { 140239578.64076966, 48943505.534671254, 140239615.8558725, 48943520.19878115, 140239541.4256668, 48943490.87056136, 140239580.5015248, 48943506.26787675, 140239576.78001451, 48943504.80146576, 0, 0, 0, 0, 0 },
-  { 140239589.29636347, 48943478.49252395, 140239626.26929614, 48943493.75693516, 140239552.3234308, 48943463.22811275, 140239591.1450101, 48943479.25574452, 140239587.44771683, 48943477.72930339, 0, 0, 0, 0, 0 },
-  { 140239600.40463793, 48943451.58644299, 140239637.1669176, 48943467.35142934, 140239563.64235827, 48943435.82145664, 140239602.24275193, 48943452.374692306, 140239598.56652394, 48943450.79819368, 0, 0, 0, 0, 0 },
-  { 140239611.89259163, 48943424.79775082, 140239648.47935432, 48943440.96589221, 140239575.30582893, 48943408.629609436, 140239613.72192976, 48943425.60615789, 140239610.0632535, 48943423.989343755, 0, 0, 0, 0, 0 },
-  { 140239623.68722314, 48943398.107769966, 140239660.13643807, 48943414.583653234, 140239587.2380082, 48943381.6318867, 140239625.50968388, 48943398.93156413, 140239621.8647624, 48943397.2839758, 0, 0, 0, 0, 0 },
-  { 140239635.71553108, 48943371.497822896, 140239672.06728798, 48943388.1876333, 140239599.36377418, 48943354.80801249, 140239637.53311893, 48943372.33231342, 140239633.89794323, 48943370.66333237, 0, 0, 0, 0, 0 },
-  { 140239647.90451407, 48943344.949232124, 140239684.20037016, 48943361.76026514, 140239611.608658, 48943328.138199106, 140239649.7193069, 48943345.789783776, 140239646.08972126, 48943344.10868047, 0, 0, 0, 0, 0 },
-  { 140239660.18117067, 48943318.44332016, 140239696.4635407, 48943335.28343965, 140239623.89880064, 48943301.603200674, 140239661.99528918, 48943319.28532614, 140239658.36705217, 48943317.60131419, 1, 5, 140239551.33406055, 48943267.9229617, 27 },
-  { 140239672.4724995, 48943291.961409464, 140239708.78406918, 48943308.73847436, 140239636.1609298, 48943275.18434457, 140239674.28807798, 48943292.80026271, 140239670.656921, 48943291.12255622, 1, 1, 140239775.05268386, 48943339.35661779, 46 },
-  { 140239684.70549908, 48943265.48482253, 140239721.0886411, 48943282.106103376, 140239648.32235706, 48943248.86354168, 140239686.52465618, 48943266.31588657, 140239682.886342, 48943264.65375848, 0, 0, 0, 0, 0 },
-  { 140239696.80716813, 48943238.99488187, 140239733.3033397, 48943255.366487205, 140239660.31099656, 48943222.62327653, 140239698.6319767, 48943239.81346214, 140239694.98235956, 48943238.1763016, 0, 0, 0, 0, 0 },
-  { 140239708.70450523, 48943212.472909994, 140239745.35360593, 48943228.499245144, 140239672.05540454, 48943196.446574844, 140239710.53696027, 48943213.274226755, 140239706.8720502, 48943211.671593234, 0, 0, 0, 0, 0 },
-  { 140239720.32450894, 48943185.900229365, 140239757.16417876, 48943201.48351293, 140239683.4848391, 48943170.3169458, 140239722.16649243, 48943186.679393545, 140239718.48252544, 48943185.121065184, 0, 0, 0, 0, 0 },
-  { 140239731.59417787, 48943159.2581625, 140239768.65901855, 48943174.29802903, 140239694.5293372, 48943144.21829597, 140239733.4474199, 48943160.01015583, 140239729.74093583, 48943158.50616917, 0, 0, 0, 0, 0 },
-  { 140239742.44051066, 48943132.52803188, 140239779.76121652, 48943146.921256505, 140239705.1198048, 48943118.13480725, 140239744.30654594, 48943133.24769311, 140239740.57447538, 48943131.80837065, 0, 0, 0, 0, 0 },
-  { 140239752.79050583, 48943105.69116001, 140239790.39289746, 48943119.33154648, 140239715.1881142, 48943092.05077354, 140239754.67062542, 48943106.37317933, 140239750.91038623, 48943105.009140685, 0, 0, 0, 0, 0 },
-  { 140239762.57116202, 48943078.728869356, 140239800.47512588, 48943091.507348254, 140239724.66719815, 48943065.95039046, 140239764.4663602, 48943079.3677933, 140239760.67596382, 48943078.08994541, 0, 0, 0, 0, 0 },
-  { 140239771.70947784, 48943051.622482456, 140239809.92782706, 48943063.427472256, 140239733.49112862, 48943039.81749266, 140239773.6203953, 48943052.21273194, 140239769.79856038, 48943051.03223297, 1, 3, 140239490.8046112, 48942964.85580743, 35 },
-  { 140239780.1324519, 48943024.35332178, 140239818.66378897, 48943035.09278461, 140239741.6011148, 48943013.61385895, 140239782.05901876, 48943024.890294924, 140239778.20588502, 48943023.81634864, 0, 0, 0, 0, 0 },
-  { 140239787.78258106, 48942996.9059801, 140239826.5865637, 48943006.61427193, 140239748.97859842, 48942987.197688274, 140239789.7227802, 48942997.3913947, 140239785.84238192, 48942996.42056551, 1, 2, 140239414.294248, 48942903.46367126, 36 },
-  { 140239794.6932145, 48942969.28422078, 140239833.7218824, 48942978.04567509, 140239755.6645466, 48942960.52276646, 140239796.6446479, 48942969.722293496, 140239792.74178112, 48942968.84614806, 0, 0, 0, 0, 0 },
-  { 140239800.93070504, 48942941.49877124, 140239840.1422652, 48942949.401527144, 140239761.71914488, 48942933.59601534, 140239802.89128304, 48942941.89390904, 140239798.97012705, 48942941.10363345, 1, 5, 140239492.13966888, 48942879.2645685, 49 },
-  { 140239806.56145206, 48942913.560368724, 140239845.9199838, 48942920.69521133, 140239767.20292032, 48942906.42552612, 140239808.52937865, 48942913.91711085, 140239804.59352547, 48942913.203626595, 0, 0, 0, 0, 0 },
-  { 140239811.65185514, 48942885.47975051, 140239851.12685326, 48942891.93920287, 140239772.17685702, 48942879.020298146, 140239813.62560505, 48942885.802723125, 140239809.67810524, 48942885.15677789, 0, 0, 0, 0, 0 },
-  { 140239816.26831374, 48942857.26765386, 140239855.83412996, 48942863.145254314, 140239776.7024975, 48942851.39005341, 140239818.24660453, 48942857.56153388, 140239814.29002294, 48942856.97377384, 0, 0, 0, 0, 0 },
-  { 140239820.4772273, 48942828.934816025, 140239860.11244628, 48942834.32456699, 140239780.84200832, 48942823.54506506, 140239822.45898825, 48942829.20430357, 140239818.49546635, 48942828.66532848, 0, 0, 0, 0, 0 },
-  { 140239824.34499535, 48942800.4919743, 140239864.03177276, 48942805.48794247, 140239784.65821794, 48942795.49600613, 140239826.32933423, 48942800.74177271, 140239822.36065647, 48942800.24217589, 1, 4, 140239929.51495552, 48942813.73128996, 46 },
-  { 140239827.93801737, 48942771.949865915, 140239867.66140044, 48942776.64591069, 140239788.2146343, 48942767.25382114, 140239829.92418653, 48942772.18466815, 140239825.9518482, 48942771.715063676, 1, 3, 140239554.8397587, 48942739.66455808, 49 },
-  { 140239831.32269275, 48942743.31922816, 140239871.06993726, 48942747.808833376, 140239791.57544824, 48942738.82962294, 140239833.310055, 48942743.54370842, 140239829.33533052, 48942743.09474789, 0, 0, 0, 0, 0 },
-  { 140239834.5654211, 48942714.610798284, 140239874.32531333, 48942718.98698039, 140239794.80552888, 48942710.234616175, 140239836.55341572, 48942714.82960739, 140239832.5774265, 48942714.39198918, 0, 0, 0, 0, 0 },
-  { 140239837.73260176, 48942685.83531354, 140239877.4947901, 48942690.190583736, 140239797.97041342, 48942681.48004335, 140239839.72071117, 48942686.05307706, 140239835.74449235, 48942685.61755003, 0, 0, 0, 0, 0 },
-  { 140239840.89063442, 48942657.00351124, 140239880.64497256, 48942661.42986408, 140239801.13629627, 48942652.57715841, 140239842.87835133, 48942657.224828884, 140239838.9029175, 48942656.7821936, 0, 0, 0, 0, 0 },
-  { 140239844.10591835, 48942628.12612859, 140239883.8418204, 48942632.715038024, 140239804.3700163, 48942623.53721916, 140239846.09271345, 48942628.355574064, 140239842.11912325, 48942627.89668312, 1, 3, 140239991.12875587, 48942645.1050935, 37 },
-  { 140239847.44485313, 48942599.2139029, 140239887.15066117, 48942604.056299835, 140239807.73904508, 48942594.37150596, 140239849.43014354, 48942599.45602275, 140239845.45956272, 48942598.97178305, 1, 4, 140239682.66574976, 48942579.11795561, 37 },
-  { 140239850.97383818, 48942570.27757139, 140239890.6362032, 48942575.46378405, 140239811.31147316, 48942565.09135873, 140239852.95695642, 48942570.53688202, 140239848.99071994, 48942570.018260755, 0, 0, 0, 0, 0 },
-  { 140239854.75927308, 48942541.32787136, 140239894.36255205, 48942546.947506055, 140239815.15599412, 48942535.708236665, 140239856.73943704, 48942541.608853094, 140239852.77910912, 48942541.046889625, 1, 0, 140239535.9528773, 48942496.08981204, 48 },
-  { 140239858.8675573, 48942512.37554007, 140239898.39323223, 48942518.517284125, 140239819.34188235, 48942506.233796015, 140239860.84384105, 48942512.682627276, 140239856.89127353, 48942512.068452865, 1, 3, 140240188.90694308, 48942563.65910292, 43 },
-  { 140239863.3650902, 48942483.43131477, 140239902.79121813, 48942490.18264322, 140239823.93896225, 48942476.67998631, 140239865.33639657, 48942483.76888119, 140239861.3937838, 48942483.093748346, 1, 1, 140239489.802528, 48942419.46247767, 32 },
-  { 140239868.31827137, 48942454.505932726, 140239907.61897907, 48942461.95270218, 140239829.01756367, 48942447.05916327, 140239870.28330675, 48942454.8782712, 140239866.353236, 48942454.13359425, 0, 0, 0, 0, 0 },
-  { 140239873.7935003, 48942425.61013122, 140239912.93854174, 48942433.83604952, 140239834.64845887, 48942417.38421292, 140239875.7507524, 48942426.02142713, 140239871.83624822, 48942425.198835306, 0, 0, 0, 0, 0 },
-  { 140239879.8571764, 48942396.75464749, 140239918.81157595, 48942405.8406122, 140239840.90277684, 48942387.668682784, 140239881.80489638, 48942397.20894573, 140239877.9094564, 48942396.30034926, 0, 0, 0, 0, 0 },
-  { 140239886.5756992, 48942367.95021883, 140239925.29950804, 48942377.973523155, 140239847.8518904, 48942357.9269145, 140239888.51188967, 48942368.451384045, 140239884.63950875, 48942367.44905361, 1, 1, 140239763.62760618, 48942336.126227595, 49 },
-  { 140239894.01546818, 48942339.20758247, 140239932.46366334, 48942350.240999386, 140239855.56727302, 48942328.17416555, 140239895.93787795, 48942339.759253316, 140239892.0930584, 48942338.65591162, 1, 0, 140240201.60102946, 48942427.47491783, 29 },
-  { 140239902.24288276, 48942310.537475675, 140239940.01648965, 48942323.696298614, 140239864.46927586, 48942297.37865274, 140239904.1315631, 48942311.19541682, 140239900.35420242, 48942309.87953453, 1, 4, 140239618.94083095, 48942211.84630362, 49 },
-  { 140239912.0015211, 48942282.524410166, 140239943.08615458, 48942307.69871379, 140239880.91688764, 48942257.350106545, 140239913.55575278, 48942283.78312535, 140239910.44728944, 48942281.26569498, 1, 2, 140240149.79896706, 48942475.10783286, 31 },
-  { 140239929.7280032, 48942260.63617021, 140239948.71825057, 48942295.84086457, 140239910.73775584, 48942225.43147585, 140239930.67751557, 48942262.39640493, 140239928.77849084, 48942258.87593549, 0, 0, 0, 0, 0 },
-  { 140239955.81380633, 48942246.56486913, 140239969.35945368, 48942284.20149275, 140239942.26815897, 48942208.92824551, 140239956.4910887, 48942248.44670031, 140239955.13652396, 48942244.683037944, 0, 0, 0, 0, 0 },
-  { 140239983.5448471, 48942236.58430066, 140239993.13276112, 48942275.41820215, 140239973.95693308, 48942197.75039917, 140239984.0242428, 48942238.52599573, 140239983.0654514, 48942234.64260559, 1, 0, 140239938.48165122, 48942054.06496367, 28 },
-  { 140240011.76253748, 48942229.61748098, 140240017.98393685, 48942269.130696364, 140240005.5411381, 48942190.10426559, 140240012.07360744, 48942231.59314175, 140240011.4514675, 48942227.64182021, 0, 0, 0, 0, 0 },
-  { 140240040.37566325, 48942225.11231276, 140240043.95167685, 48942264.95214366, 140240036.79964966, 48942185.27248185, 140240040.55446392, 48942227.1043043, 140240040.19686258, 48942223.120321214, 1, 4, 140240026.96561223, 48942075.712946855, 48 },
-  { 140240069.29301047, 48942222.51669865, 140240070.99163786, 48942262.48061569, 140240067.5943831, 48942182.55278161, 140240069.37794185, 48942224.5148945, 140240069.2080791, 48942220.5185028, 1, 5, 140240077.1916278, 48942408.34891288, 39 },
-  { 140240098.4233648, 48942221.278541304, 140240099.015117, 48942261.27416393, 140240097.8316126, 48942181.28291868, 140240098.45295238, 48942223.278322436, 140240098.3937772, 48942219.27876017, 0, 0, 0, 0, 0 },
-  { 140240127.67551222, 48942220.845743366, 140240127.92075235, 48942260.84499157, 140240127.4302721, 48942180.84649516, 140240127.68777424, 48942222.84570578, 140240127.6632502, 48942218.845780954, 1, 1, 140240129.110167, 48942454.841345385, 43 },
-  { 140240156.9582386, 48942220.6662075, 140240157.6121382, 48942260.660862334, 140240156.304339, 48942180.671552666, 140240156.99093357, 48942222.66594024, 140240156.92554364, 48942218.66647476, 1, 1, 140240150.45193762, 48941822.7193919, 30 },
-  { 140240186.18031698, 48942220.188436024, 140240186.6643445, 48942260.18550739, 140240185.69628948, 48942180.19136466, 140240186.20451835, 48942222.18828959, 140240186.15611562, 48942218.18858246, 1, 5, 140240188.69726008, 48942428.1732071, 38 },
-  { 140240215.22966227, 48942219.83689322, 140240210.96296173, 48942259.60868306, 140240219.4963628, 48942180.06510339, 140240215.01632723, 48942221.82548272, 140240215.4429973, 48942217.84830373, 0, 0, 0, 0, 0 },
-  { 140240243.92268625, 48942222.91506851, 140240232.7258497, 48942261.31599104, 140240255.1195228, 48942184.51414598, 140240243.3628444, 48942224.835114636, 140240244.4825281, 48942220.99502238, 0, 0, 0, 0, 0 },
-  { 140240271.8418634, 48942231.055666246, 140240254.84677806, 48942267.26570732, 140240288.83694872, 48942194.84562517, 140240270.99210912, 48942232.8661683, 140240272.69161767, 48942229.24516419, 1, 1, 140240322.82711938, 48942122.425543025, 29 },
-  { 140240298.31747916, 48942243.48192526, 140240275.8624547, 48942276.584370434, 140240320.7725036, 48942210.37948008, 140240297.19472793, 48942245.137047514, 140240299.4402304, 48942241.826803, 0, 0, 0, 0, 0 },
-  { 140240322.43224147, 48942259.84016026, 140240294.22816452, 48942288.20439907, 140240350.63631842, 48942231.475921445, 140240321.02203763, 48942261.258372195, 140240323.8424453, 48942258.42194832, 1, 1, 140240444.4148743, 48942137.16482739, 50 },
-  { 140240343.03269383, 48942280.32428985, 140240309.64921284, 48942302.3593346, 140240376.41617483, 48942258.2892451, 140240341.3635198, 48942281.42604209, 140240344.70186788, 48942279.222537614, 1, 2, 140240214.50629205, 48942365.15921215, 43 },
-  { 140240359.12239116, 48942304.700464755, 140240322.01203993, 48942319.627682544, 140240396.2327424, 48942289.77324697, 140240357.2668736, 48942305.446825646, 140240360.97790873, 48942303.954103865, 1, 2, 140240467.67016855, 48942261.03835272, 46 },
-  { 140240370.03763437, 48942331.83670106, 140240330.689118, 48942339.02657305, 140240409.38615075, 48942324.64682907, 140240368.07020855, 48942332.196194656, 140240372.0050602, 48942331.47720746, 0, 0, 0, 0, 0 },
-  { 140240375.27728382, 48942360.51209783, 140240335.27779153, 48942360.31056285, 140240415.2767761, 48942360.71363281, 140240373.2773092, 48942360.50202108, 140240377.27725843, 48942360.522174574, 0, 0, 0, 0, 0 },
-  { 140240375.13064766, 48942389.615591384, 140240335.68857643, 48942382.95803796, 140240414.5727189, 48942396.27314481, 140240373.1585441, 48942389.28271371, 140240377.10275123, 48942389.94846906, 0, 0, 0, 0, 0 },
-  { 140240370.308389, 48942418.184625246, 140240331.81192803, 48942407.32080946, 140240408.80484998, 48942429.04844103, 140240368.38356596, 48942417.64143445, 140240372.23321205, 48942418.72781604, 0, 0, 0, 0, 0 },
-  { 140240362.42375797, 48942446.12419979, 140240324.41246387, 48942433.668617904, 140240400.43505207, 48942458.57978168, 140240360.52319327, 48942445.5014207, 140240364.32432267, 48942446.74697889, 0, 0, 0, 0, 0 },
-  { 140240353.3741124, 48942473.741435386, 140240315.60924837, 48942460.557542026, 140240391.13897642, 48942486.92532875, 140240351.4858692, 48942473.082240716, 140240355.2623556, 48942474.40063006, 0, 0, 0, 0, 0 },
-  { 140240343.80568674, 48942501.14990146, 140240306.27365646, 48942487.31708888, 140240381.33771703, 48942514.982714035, 140240341.92908522, 48942500.45826083, 140240345.68228826, 48942501.84154209, 0, 0, 0, 0, 0 },
-  { 140240333.77326277, 48942528.37048571, 140240296.45800275, 48942513.96314838, 140240371.0885228, 48942542.77782304, 140240331.90749976, 48942527.65011884, 140240335.63902578, 48942529.09085257, 0, 0, 0, 0, 0 },
-  { 140240323.32814342, 48942555.42353067, 140240286.210126, 48942540.51538578, 140240360.44616082, 48942570.33167556, 140240321.47224253, 48942554.67812342, 140240325.1840443, 48942556.168937914, 0, 0, 0, 0, 0 },
-  { 140240312.52163187, 48942582.329378895, 140240275.57835218, 48942566.993340105, 140240349.46491155, 48942597.665417686, 140240310.6744679, 48942581.56257696, 140240314.36879584, 48942583.096180834, 1, 3, 140240445.51743874, 48942637.53911855, 28 },
-  { 140240301.40503109, 48942609.108372964, 140240264.61147872, 48942593.4165119, 140240338.19858345, 48942624.80023403, 140240299.56535345, 48942608.32377991, 140240303.24470872, 48942609.89296602, 1, 3, 140240195.623568, 48942563.99427241, 41 },
-  { 140240290.0296443, 48942635.78085543, 140240253.35875678, 48942619.804435074, 140240326.70053184, 48942651.75727579, 140240288.19609994, 48942634.982034415, 140240291.86318868, 48942636.57967645, 0, 0, 0, 0, 0 },
-  { 140240278.44677442, 48942662.36716885, 140240241.8698698, 48942646.176738076, 140240315.02367905, 48942678.55759963, 140240276.6179292, 48942661.55764731, 140240280.27561966, 48942663.17669039, 0, 0, 0, 0, 0 },
-  { 140240266.70772454, 48942688.88765578, 140240230.19491553, 48942672.55318982, 140240303.22053355, 48942705.22212174, 140240264.8820841, 48942688.070932485, 140240268.53336498, 48942689.704379074, 0, 0, 0, 0, 0 },
-  { 140240254.86379778, 48942715.3626588, 140240218.38438985, 48942698.95373448, 140240291.34320572, 48942731.77158312, 140240253.03982738, 48942714.54221258, 140240256.6877682, 48942716.183105014, 0, 0, 0, 0, 0 },
-  { 140240242.96629718, 48942741.81252044, 140240206.48917535, 48942725.39851477, 140240279.443419, 48942758.226526104, 140240241.1424411, 48942740.99182016, 140240244.79015326, 48942742.63322072, 0, 0, 0, 0, 0 },
-  { 140240231.0665258, 48942768.25758325, 140240194.5605355, 48942751.9078838, 140240267.57251608, 48942784.607282706, 140240229.2412263, 48942767.44009828, 140240232.8918253, 48942769.07506823, 1, 2, 140240044.88597527, 48942684.87411604, 42 },
-  { 140240219.21578673, 48942794.71818985, 140240182.65011498, 48942778.50240589, 140240255.78145847, 48942810.93397381, 140240217.38750315, 48942793.90740065, 140240221.0440703, 48942795.52897905, 0, 0, 0, 0, 0 },
-  { 140240207.46538302, 48942821.21468275, 140240170.8099453, 48942805.202847, 140240244.12082076, 48942837.226518504, 140240205.63261113, 48942820.41409096, 140240209.29815492, 48942822.01527454, 0, 0, 0, 0, 0 },
-  { 140240195.8666177, 48942847.76740452, 140240159.09245643, 48942832.030153744, 140240232.640779, 48942863.504655294, 140240194.02790964, 48942846.98054198, 140240197.70532578, 48942848.55426706, 0, 0, 0, 0, 0 },
-  { 140240184.47079384, 48942874.39669771, 140240147.55049327, 48942859.0054208, 140240221.39109442, 48942889.78797462, 140240182.6247788, 48942873.62713386, 140240186.31680888, 48942875.166261554, 0, 0, 0, 0, 0 },
-  { 140240173.32921457, 48942901.1229049, 140240136.2373355, 48942886.14984552, 140240210.42109364, 48942916.095964275, 140240171.4746206, 48942900.374251924, 140240175.18380854, 48942901.87155787, 0, 0, 0, 0, 0 },
-  { 140240162.4931829, 48942927.96636863, 140240125.2067186, 48942913.484670565, 140240199.7796472, 48942942.4480667, 140240160.62885967, 48942927.242283724, 140240164.35750613, 48942928.69045354, 1, 5, 140240060.88756764, 48942888.5037414, 30 },
-  { 140240152.01400197, 48942954.94743149, 140240114.51324362, 48942941.030063845, 140240189.51476032, 48942968.864799134, 140240150.13896406, 48942954.25156311, 140240153.88903987, 48942955.64329987, 0, 0, 0, 0, 0 },
-  { 140240141.9422383, 48942982.0860963, 140240104.22521877, 48942968.765944734, 140240179.65925783, 48942995.40624787, 140240140.05638734, 48942981.42008872, 140240143.82808927, 48942982.75210388, 0, 0, 0, 0, 0 },
-  { 140240132.2998745, 48943009.38918076, 140240094.38401395, 48942996.64604467, 140240170.21573508, 48943022.13231684, 140240130.4040815, 48943008.75202395, 140240134.19566754, 48943010.026337564, 1, 2, 140240307.66072965, 48943068.326185144, 30 },
-  { 140240123.07178637, 48943036.84638603, 140240084.97460064, 48943024.65604401, 140240161.1689721, 48943049.036728054, 140240121.1669271, 48943036.236868925, 140240124.97664565, 48943037.455903135, 0, 0, 0, 0, 0 },
-  { 140240114.24037206, 48943064.44627049, 140240075.9781992, 48943052.7841039, 140240152.5025449, 48943076.108437076, 140240112.3272634, 48943063.86316216, 140240116.1534807, 48943065.02937882, 0, 0, 0, 0, 0 },
-  { 140240105.78803018, 48943092.177392624, 140240067.37607267, 48943081.01847151, 140240144.19998768, 48943103.33631374, 140240103.8674323, 48943091.61944657, 140240107.70862806, 48943092.73533868, 0, 0, 0, 0, 0 },
-  { 140240097.69715902, 48943120.028310806, 140240059.14953095, 48943109.34746951, 140240136.2447871, 48943130.7091521, 140240095.76977763, 48943119.49426874, 140240099.62454042, 48943120.56235287, 0, 0, 0, 0, 0 },
-  { 140240089.95015696, 48943147.98758347, 140240051.279936, 48943137.75948442, 140240128.62037793, 48943158.21568253, 140240088.0166459, 48943147.47617852, 140240091.883668, 48943148.49898843, 0, 0, 0, 0, 0 },
-  { 140240082.5294224, 48943176.04376903, 140240043.7487048, 48943166.2429557, 140240121.31014, 48943185.844582364, 140240080.5903865, 48943175.553728364, 140240084.4684583, 48943176.5338097, 0, 0, 0, 0, 0 },
-  { 140240075.41735375, 48943204.18542592, 140240036.53731173, 48943194.78636567, 140240114.29739577, 48943213.58448617, 140240073.47335166, 48943203.71547291, 140240077.36135584, 48943204.65537894, 0, 0, 0, 0, 0 },
-  { 140240068.59634933, 48943232.40111252, 140240029.62728986, 48943223.37823024, 140240107.5654088, 48943241.4239948, 140240066.64789635, 48943231.949968405, 140240070.5448023, 48943232.85225663, 0, 0, 0, 0, 0 },
-  { 140240062.04880756, 48943260.679387294, 140240023.00000697, 48943252.00810297, 140240101.09760815, 48943269.35067162, 140240060.09636754, 48943260.24582308, 140240064.00124758, 48943261.11295151, 0, 0, 0, 0, 0 },
-  { 140240055.75778237, 48943289.00933002, 140240016.6355192, 48943280.675751835, 140240094.88004553, 48943297.3429082, 140240053.8016692, 48943288.59265111, 140240057.71389553, 48943289.42600893, 0, 0, 0, 0, 0 },
-  { 140240049.71326154, 48943317.38553638, 140240010.52212128, 48943309.382129274, 140240088.9044018, 48943325.388943486, 140240047.75370452, 48943316.985366024, 140240051.67281857, 48943317.785706736, 0, 0, 0, 0, 0 },
-  { 140240043.90940174, 48943345.80591791, 140240004.65375605, 48943338.12514444, 140240083.16504744, 48943353.486691386, 140240041.94661945, 48943345.42187924, 140240045.87218404, 48943346.18995658, 0, 0, 0, 0, 0 },
-  { 140240038.3404163, 48943374.26843146, 140239999.02444485, 48943366.902673684, 140240077.65638778, 48943381.63418924, 140240036.37461773, 48943373.90014357, 140240040.3062149, 48943374.63671935, 1, 1, 140239850.60665256, 48943339.096938066, 33 },
-  { 140240033.00051862, 48943402.77103385, 140239993.62821177, 48943395.712602556, 140240072.37282547, 48943409.82946515, 140240031.03190327, 48943402.418112285, 140240034.96913397, 48943403.12395542, 0, 0, 0, 0, 0 },
-  { 140240027.88392222, 48943431.311681926, 140239988.45908427, 48943424.55282455, 140240067.30876017, 48943438.0705393, 140240025.91268033, 48943430.97373906, 140240029.8551641, 48943431.649624795, 0, 0, 0, 0, 0 },
-  { 140240022.98484042, 48943459.88833254, 140239983.51109302, 48943453.421241574, 140240062.45858783, 48943466.3554235, 140240021.01115304, 48943459.56497799, 140240024.9585278, 48943460.21168709, 1, 2, 140240321.01163337, 48943508.7148693, 34 },
-  { 140240018.2974867, 48943488.49894251, 140239978.77827254, 48943482.315762654, 140240057.81670085, 48943494.682122365, 140240016.321526, 48943488.18978351, 140240020.2734474, 48943488.808101505, 0, 0, 0, 0, 0 },
-  { 140240013.81607443, 48943517.141468674, 140239974.25466138, 48943511.23430371, 140240053.37748748, 48943523.048633635, 140240011.83800378, 48943516.846110426, 140240015.79414508, 48943517.43682692, 0, 0, 0, 0, 0 },
-  { 140240009.53481704, 48943545.813867874, 140239969.9343023, 48943540.17478709, 140240049.13533178, 48943551.45294866, 140240007.5547913, 48943545.53191383, 140240011.51484278, 48943546.09582192, 1, 0, 140239825.39242348, 48943519.592142224, 30 },
-  { 140240005.44792798, 48943574.51409697, 140239965.81124258, 48943569.1351408, 140240045.08461338, 48943579.89305314, 140240003.46609372, 48943574.24514916, 140240007.42976224, 48943574.78304478, 1, 5, 140240132.2853213, 48943591.7267567, 33 },
-  { 140240001.5496207, 48943603.240112774, 140239961.8795341, 48943598.113298066, 140240041.21970728, 48943608.36692748, 140239999.56611636, 48943602.98377204, 140240003.533125, 48943603.49645351, 0, 0, 0, 0, 0 },
-  { 140239997.83410853, 48943631.98987213, 140239958.13323343, 48943627.10719707, 140240037.53498363, 48943636.87254719, 140239995.84906477, 48943631.74573837, 140239999.8191523, 48943632.23400588, 1, 5, 140240275.7402343, 48943666.16859755, 42 },
-  { 140239994.29560494, 48943660.76133188, 140239954.5664021, 48943656.11478028, 140240034.02480778, 48943665.40788348, 140239992.3091448, 48943660.5290043, 140239996.2820651, 48943660.99365946, 0, 0, 0, 0, 0 },
-  { 140239990.92832342, 48943689.55244886, 140239951.17310673, 48943685.13399362, 140240030.6835401, 48943693.970904104, 140239988.94056258, 48943689.3315261, 140239992.91608426, 48943689.77337162, 1, 3, 140240307.97617644, 48943724.78962942, 48 },
-  { 140239987.72647724, 48943718.36117991, 140239947.94741878, 48943714.16278642, 140240027.5055357, 48943722.559573404, 140239985.7375243, 48943718.151260234, 140239989.71543017, 48943718.57109959, 0, 0, 0, 0, 0 },
-  { 140239984.68427947, 48943747.1854821, 140239944.88348645, 48943743.198393635, 140240024.4850725, 48943751.172570564, 140239982.69423983, 48943746.986127675, 140239986.67431912, 48943747.384836525, 0, 0, 0, 0, 0 },
-  { 140239981.7953905, 48943776.02358632, 140239941.97503012, 48943772.236912355, 140240021.61575085, 48943779.81026028, 140239979.80437246, 48943775.83425262, 140239983.7864085, 48943776.21292002, 0, 0, 0, 0, 0 },
-  { 140239979.0518412, 48943804.87453106, 140239939.2139511, 48943801.27696073, 140240018.8897313, 48943808.47210139, 140239977.0599467, 48943804.69465254, 140239981.0437357, 48943805.05440958, 1, 2, 140240363.48748067, 48943839.59108471, 40 },
-  { 140239976.44536352, 48943833.73750297, 140239936.59182, 48943830.317697614, 140240016.29890704, 48943837.157308325, 140239974.45268634, 48943833.566512704, 140239978.4380407, 48943833.908493236, 0, 0, 0, 0, 0 },
-  { 140239973.96768937, 48943862.61168868, 140239934.1002167, 48943859.35828704, 140240013.83516204, 48943865.865090325, 140239971.97431573, 48943862.4490186, 140239975.961063, 48943862.774358764, 0, 0, 0, 0, 0 },
-  { 140239971.61055073, 48943891.49627481, 140239931.73073056, 48943888.39789714, 140240011.4903709, 48943894.594652474, 140239969.6165597, 48943891.34135592, 140239973.60454175, 48943891.65119369, 0, 0, 0, 0, 0 },
-  { 140239969.3656795, 48943920.39044799, 140239929.47496045, 48943917.43570031, 140240009.25639856, 48943923.345195666, 140239967.37114355, 48943920.242710605, 140239971.36021546, 48943920.53818537, 0, 0, 0, 0, 0 },
-  { 140239967.2248077, 48943949.29339488, 140239927.32451493, 48943946.47087181, 140240007.1251005, 48943952.11591794, 140239965.22979307, 48943949.15226872, 140239969.21982235, 48943949.434521034, 1, 5, 140239713.8579486, 48943931.3703734, 49 },
-  { 140239965.17966726, 48943978.204302095, 140239925.2710122, 48943975.50258981, 140240005.08832234, 48943980.90601438, 140239963.1842345, 48943978.06921648, 140239967.17510003, 48943978.33938771, 0, 0, 0, 0, 0 },
-  { 140239963.2219901, 48944007.12235626, 140239923.30608013, 48944004.530034654, 140240003.13790008, 48944009.71467786, 140239961.22619462, 48944006.99274018, 140239965.2177856, 48944007.25197234, 1, 2, 140239840.48056695, 48943999.15096732, 39 },
-  { 140239961.34350818, 48944036.04674404, 140239921.42135656, 48944033.552388504, 140240001.2656598, 48944038.54109958, 140239959.3474006, 48944035.92202626, 140239963.33961576, 48944036.17146182, 0, 0, 0, 0, 0 },
-  { 140239959.5359534, 48944064.97665201, 140239919.60848895, 48944062.568834975, 140239999.46341786, 48944067.38446905, 140239957.53958017, 48944064.85626116, 140239961.53232664, 48944065.097042866, 1, 3, 140239619.154319, 48944044.45001178, 48 },
-  { 140239957.79105777, 48944093.91126684, 140239917.8591348, 48944091.57855866, 140239997.72298074, 48944096.24397502, 140239955.7944616, 48944093.79463143, 140239959.78765392, 48944094.02790225, 1, 1, 140240288.22772038, 48944113.21442704, 26 },
-  { 140239956.10055327, 48944122.84977518, 140239916.16496137, 48944120.580744594, 140239996.03614518, 48944125.118805766, 140239954.10377368, 48944122.73632365, 140239958.09733286, 48944122.96322671, 0, 0, 0, 0, 0 },
-  { 140239954.45617175, 48944151.79136363, 140239914.5176457, 48944149.57457867, 140239994.39469782, 48944154.00814858, 140239952.45924544, 48944151.68052438, 140239956.45309806, 48944151.902202874, 1, 0, 140240118.20412862, 48944160.88018192, 34 },
-  { 140239952.8496452, 48944180.73521883, 140239912.90887472, 48944178.5592468, 140239992.79041567, 48944182.91119086, 140239950.85260668, 48944180.62642023, 140239954.8466837, 48944180.84401743, 1, 2, 140239787.09544775, 48944171.704934895, 25 },
-  { 140239951.2727056, 48944209.68052741, 140239911.3303454, 48944207.53393457, 140239991.21506584, 48944211.82712025, 140239949.27558762, 48944209.57319777, 140239953.2698236, 48944209.787857056, 0, 0, 0, 0, 0 },
-  { 140239949.71708483, 48944238.626476005, 140239909.77376425, 48944236.49782801, 140239989.6604054, 48944240.755124, 140239947.7199188, 48944238.520043604, 140239951.71425086, 48944238.732908405, 0, 0, 0, 0, 0 },
-  { 140239948.17451486, 48944267.572251275, 140239908.23084795, 48944265.450112484, 140239988.11818177, 48944269.694390066, 140239946.1773315, 48944267.46614434, 140239950.1716982, 48944267.67835821, 0, 0, 0, 0, 0 },
-  { 140239946.6367277, 48944296.51703981, 140239906.6933229, 48944294.38997297, 140239986.58013248, 48944298.64410666, 140239944.63955745, 48944296.41068647, 140239948.63389793, 48944296.623393156, 0, 0, 0, 0, 0 },
-  { 140239945.0954552, 48944325.46002827, 140239905.15292534, 48944323.316594444, 140239985.03798506, 48944327.60346209, 140239943.0983287, 48944325.35285658, 140239947.0925817, 48944325.56719996, 0, 0, 0, 0, 0 },
-  { 140239943.54242942, 48944354.400403276, 140239903.60140154, 48944352.22916108, 140239983.4834573, 48944356.57164547, 140239941.54537803, 48944354.291841164, 140239945.5394808, 48944354.50896539, 1, 4, 140239812.73556313, 48944347.28958509, 44 },
-  { 140239941.9693822, 48944383.33735147, 140239902.03050748, 48944381.1268572, 140239981.90825692, 48944385.54784574, 140239939.97243845, 48944383.22682676, 140239943.96632594, 48944383.447876185, 0, 0, 0, 0, 0 },
-  { 140239940.3680455, 48944412.27005947, 140239900.43200904, 48944410.00886678, 140239980.30408198, 48944414.53125215, 140239938.3712437, 48944412.156999834, 140239942.36484733, 48944412.3831191, 0, 0, 0, 0, 0 },
-  { 140239938.73015136, 48944441.19771391, 140239898.79768223, 48944438.87437363, 140239978.66262048, 48944443.52105419, 140239936.7335279, 48944441.081546895, 140239940.7267748, 48944441.31388093, 1, 5, 140240131.40431485, 48944452.40783077, 46 },
-  { 140239937.04743162, 48944470.119501434, 140239897.1193127, 48944467.72256192, 140239976.97555053, 48944472.51644095, 140239935.05102566, 48944469.99965446, 140239939.04383758, 48944470.23934841, 0, 0, 0, 0, 0 },
-  { 140239935.31161824, 48944499.03460867, 140239895.38869607, 48944496.55261631, 140239975.2345404, 48944501.516601026, 140239933.31547213, 48944498.91050905, 140239937.30776435, 48944499.15870829, 1, 2, 140240314.57937878, 48944522.61353609, 35 },
-  { 140239933.51444328, 48944527.94222225, 140239893.5976381, 48944525.36372162, 140239973.43124846, 48944530.52072289, 140239931.51860303, 48944527.81329722, 140239935.51028353, 48944528.071147285, 0, 0, 0, 0, 0 },
-  { 140239931.64763856, 48944556.84152881, 140239891.73810524, 48944554.15282087, 140239971.55717188, 48944559.53023675, 140239929.6521619, 48944556.70709341, 140239933.64311522, 48944556.97596421, 1, 5, 140240229.9714001, 48944576.939620666, 32 },
-  { 140239929.70130882, 48944585.73165501, 140239889.801343, 48944582.904513784, 140239969.60127464, 48944588.558796234, 140239927.70631054, 48944585.590297945, 140239931.6963071, 48944585.87301207, 0, 0, 0, 0, 0 },
-  { 140239927.6550177, 48944614.61133908, 140239887.76764402, 48944611.61176904, 140239967.5423914, 48944617.61090911, 140239925.66064903, 48944614.461360574, 140239929.64938638, 48944614.76131758, 0, 0, 0, 0, 0 },
-  { 140239925.48412862, 48944643.47916445, 140239885.61281365, 48944640.2731948, 140239965.3554436, 48944646.685134105, 140239923.4905629, 48944643.31886597, 140239927.47769436, 48944643.63946293, 0, 0, 0, 0, 0 },
-  { 140239923.1639942, 48944672.33371417, 140239883.31273103, 48944668.8874372, 140239963.01525736, 48944675.77999114, 140239921.17143103, 48944672.161400326, 140239925.15655735, 48944672.50602802, 0, 0, 0, 0, 0 },
-  { 140239920.66996697, 48944701.173571266, 140239880.84335986, 48944697.45317274, 140239960.49657407, 48944704.89396979, 140239918.6786366, 48944700.98755134, 140239922.66129732, 48944701.35959119, 1, 2, 140239625.95307428, 48944673.64262217, 28 },
-  { 140239917.97739947, 48944729.997318804, 140239878.18074653, 48944725.96911627, 140239957.7740524, 48944734.02552134, 140239915.98756683, 48944729.795908675, 140239919.9672321, 48944730.198728934, 1, 0, 140240255.25403303, 48944764.13633525, 31 },
-  { 140239915.0616444, 48944758.80353979, 140239875.30101848, 48944754.43402889, 140239954.82227033, 48944763.17305069, 140239913.0736131, 48944758.58506425, 140239917.0496757, 48944759.02201533, 1, 0, 140239592.00655872, 48944723.301263765, 28 },
-  { 140239911.8980543, 48944787.590817295, 140239872.18038037, 48944782.84672848, 140239951.61572823, 48944792.33490611, 140239909.91217062, 48944787.353612855, 140239913.88393798, 48944787.828021735, 0, 0, 0, 0, 0 },
-  { 140239908.46198174, 48944816.35773434, 140239868.79511067, 48944811.206099704, 140239948.1288528, 48944821.50936897, 140239906.4786382, 48944816.100152604, 140239910.4453253, 48944816.61531607, 1, 4, 140239724.01103127, 48944792.40263329, 36 },
-  { 140239904.72877938, 48944845.102873996, 140239865.1215563, 48944839.5111049, 140239944.33600244, 48944850.694643095, 140239902.7484182, 48944844.82328554, 140239906.70914054, 48944845.38246245, 0, 0, 0, 0, 0 },
-  { 140239900.67379966, 48944873.82481927, 140239861.13612616, 48944867.760796435, 140239940.21147317, 48944879.8888421, 140239898.69691598, 48944873.52161813, 140239902.65068334, 48944874.128020406, 0, 0, 0, 0, 0 },
-  { 140239896.2723953, 48944902.52215322, 140239856.8152836, 48944895.954327516, 140239935.72950703, 48944909.089978926, 140239894.29953972, 48944902.19376194, 140239898.2452509, 48944902.850544505, 0, 0, 0, 0, 0 },
-  { 140239891.49991882, 48944931.19345888, 140239852.13553667, 48944924.090965, 140239930.86430097, 48944938.29595275, 140239889.53169972, 48944930.83833418, 140239893.46813792, 48944931.548583575, 1, 0, 140239660.23417377, 48944889.46630735, 27 },
-  { 140239886.3317228, 48944959.837319285, 140239847.0734274, 48944952.17010049, 140239925.59001818, 48944967.50453808, 140239884.36880803, 48944959.45395835, 140239888.29463756, 48944960.22068022, 0, 0, 0, 0, 0 },
-  { 140239880.74315992, 48944988.45231749, 140239841.6045278, 48944980.19595781, 140239919.88179204, 48944996.70867717, 140239878.7862283, 48944988.03949951, 140239882.70009154, 48944988.865135476, 0, 0, 0, 0, 0 },
-  { 140239874.71313763, 48945017.03717007, 140239835.68291295, 48945008.28265345, 140239913.7433623, 48945025.791686684, 140239872.7616264, 48945016.59944423, 140239876.66464886, 48945017.4748959, 1, 5, 140240033.76130322, 48945052.71182529, 28 },
-  { 140239868.3078421, 48945045.5938722, 140239829.34394664, 48945036.54871605, 140239907.27173758, 48945054.63902834, 140239866.35964733, 48945045.14161439, 140239870.25603688, 48945046.04613, 1, 4, 140239627.70578757, 48944989.740033, 37 },
-  { 140239861.68391544, 48945074.12781702, 140239822.73869094, 48945065.002605274, 140239900.62913993, 48945083.253028765, 140239859.73665422, 48945073.671556436, 140239863.63117665, 48945074.584077604, 1, 0, 140240012.59666035, 48945109.48801254, 31 },
-  { 140239855.00219062, 48945102.64455506, 140239816.02672085, 48945093.64940325, 140239893.9776604, 48945111.63970687, 140239853.05341712, 48945102.19479747, 140239856.95096412, 48945103.09431265, 0, 0, 0, 0, 0 },
-  { 140239848.42350048, 48945131.149636924, 140239809.3707198, 48945122.49629531, 140239887.47628117, 48945139.80297854, 140239846.47086143, 48945130.71696984, 140239850.37613952, 48945131.58230401, 0, 0, 0, 0, 0 },
-  { 140239842.108678, 48945159.648613125, 140239802.93659768, 48945151.55243369, 140239881.28075835, 48945167.74479256, 140239840.150074, 48945159.24380416, 140239844.06728202, 48945160.05342209, 0, 0, 0, 0, 0 },
-  { 140239836.21855605, 48945188.14703424, 140239796.89375785, 48945180.82854761, 140239875.54335424, 48945195.46552087, 140239834.25231615, 48945187.781109914, 140239838.18479595, 48945188.51295857, 0, 0, 0, 0, 0 },
-  { 140239830.91396752, 48945216.65045084, 140239791.41547564, 48945210.33624948, 140239870.4124594, 48945222.9646522, 140239828.93904293, 48945216.33474077, 140239832.8888921, 48945216.96616091, 0, 0, 0, 0, 0 },
-  { 140239826.35574535, 48945245.16441344, 140239786.6793086, 48945240.08697639, 140239866.0321821, 48945250.24185049, 140239824.3719235, 48945244.91054159, 140239828.33956718, 48945245.41828529, 0, 0, 0, 0, 0 },
-  { 140239822.70472243, 48945273.69447263, 140239782.8674105, 48945270.09050562, 140239862.54203436, 48945277.298439644, 140239820.71285683, 48945273.514274284, 140239824.69658804, 48945273.87467098, 1, 0, 140239550.8150685, 48945249.09739779, 47 },
-  { 140239820.1217317, 48945302.246178955, 140239780.1665573, 48945300.353022814, 140239860.07690609, 48945304.139335096, 140239818.12397298, 48945302.15152115, 140239822.1194904, 48945302.34083676, 1, 4, 140239943.9827723, 48945308.11496299, 32 },
-  { 140239818.76760602, 48945330.825082965, 140239778.7676098, 48945330.84248896, 140239858.76760224, 48945330.80767697, 140239816.7676062, 48945330.82595327, 140239820.76760584, 48945330.82421266, 0, 0, 0, 0, 0 },
-  { 140239818.78005916, 48945359.44312775, 140239778.82628483, 48945361.36560461, 140239858.7338335, 48945357.52065089, 140239816.78237045, 48945359.539251596, 140239820.77774787, 48945359.34700391, 1, 3, 140240049.51310587, 48945348.3408239, 40 },
-  { 140239820.16134894, 48945388.14971008, 140239780.33569196, 48945391.88026595, 140239859.98700592, 48945384.41915421, 140239818.1700661, 48945388.33623788, 140239822.1526318, 48945387.963182285, 0, 0, 0, 0, 0 },
-  { 140239822.86455137, 48945417.007825665, 140239783.2338431, 48945422.43064423, 140239862.49525964, 48945411.5850071, 140239820.88301596, 48945417.27896659, 140239824.84608677, 48945416.73668474, 0, 0, 0, 0, 0 },
-  { 140239826.84267306, 48945446.0804894, 140239787.4617462, 48945453.09066751, 140239866.22359994, 48945439.070311286, 140239824.8736267, 48945446.4309983, 140239828.81171942, 48945445.72998049, 1, 5, 140239492.1047945, 48945505.66700336, 41 },
-  { 140239832.06414208, 48945475.413023636, 140239793.1172151, 48945484.530966274, 140239871.01106906, 48945466.295081, 140239830.11679572, 48945475.868920766, 140239834.01148844, 48945474.957126506, 0, 0, 0, 0, 0 },
-  { 140239838.8957055, 48945504.59377329, 140239800.89029053, 48945517.06728257, 140239876.90112045, 48945492.12026401, 140239836.99543473, 48945505.217448756, 140239840.79597625, 48945503.970097825, 0, 0, 0, 0, 0 },
-  { 140239848.12828785, 48945532.72443932, 140239812.00777265, 48945549.908978365, 140239884.24880305, 48945515.53990028, 140239846.32226208, 48945533.58366627, 140239849.93431363, 48945531.86521237, 1, 4, 140239939.3325887, 48945489.33347824, 32 },
-  { 140239860.5734134, 48945558.88308957, 140239827.92583537, 48945581.99446444, 140239893.22099143, 48945535.7717147, 140239858.9410345, 48945560.03865831, 140239862.2057923, 48945557.72752083, 1, 0, 140239592.04708406, 48945748.9741479, 33 },
-  { 140239877.04260615, 48945582.14779183, 140239849.73234546, 48945611.37363076, 140239904.35286683, 48945552.9219529, 140239875.67709312, 48945583.60908378, 140239878.40811917, 48945580.686499886, 1, 1, 140240126.24873495, 48945315.46201161, 27 },
-  { 140239898.0302456, 48945601.759817556, 140239876.28726116, 48945635.33425169, 140239919.77323005, 48945568.185383424, 140239896.94309637, 48945603.43853926, 140239899.11739483, 48945600.08109585, 1, 4, 140239841.49848604, 48945689.0533463, 32 },
-  { 140239922.62182367, 48945617.685456015, 140239905.86593494, 48945654.00680226, 140239939.3777124, 48945581.36410977, 140239921.78402925, 48945619.50152333, 140239923.4596181, 48945615.8693887, 0, 0, 0, 0, 0 },
-  { 140239949.51479492, 48945630.09181427, 140239937.33838487, 48945668.19345516, 140239961.69120497, 48945591.990173385, 140239948.90597442, 48945631.99689632, 140239950.1236154, 48945628.186732225, 1, 3, 140239877.97838584, 48945853.938954465, 25 },
-  { 140239977.709885, 48945639.10231803, 140239970.0640039, 48945678.36477469, 140239985.3557661, 48945599.83986138, 140239977.32759094, 48945641.06544086, 140239978.09217906, 48945637.139195204, 1, 2, 140240000.64752826, 48945521.314948075, 31 },
-  { 140240006.7640706, 48945644.76026374, 140240003.60415843, 48945684.63525534, 140240009.92398277, 48945604.885272145, 140240006.606075, 48945646.75401332, 140240006.9220662, 48945642.76651416, 0, 0, 0, 0, 0 },
-  { 140240036.29388952, 48945647.10036792, 140240037.56665117, 48945687.08011376, 140240035.02112788, 48945607.120622076, 140240036.3575276, 48945649.09935521, 140240036.23025143, 48945645.101380624, 0, 0, 0, 0, 0 },
-  { 140240065.91587955, 48945646.157347105, 140240071.57449275, 48945685.75507554, 140240060.25726634, 48945606.559618674, 140240066.19881022, 48945648.137233526, 140240065.63294888, 48945644.177460685, 0, 0, 0, 0, 0 },
-  { 140240095.24657837, 48945641.965917796, 140240105.2544183, 48945680.693726145, 140240085.23873842, 48945603.23810945, 140240095.74697036, 48945643.90230821, 140240094.74618638, 48945640.02952738, 0, 0, 0, 0, 0 },
-  { 140240123.9025239, 48945634.56079654, 140240138.20008636, 48945671.91825507, 140240109.60496145, 48945597.203338005, 140240124.61740202, 48945636.42866946, 140240123.1876458, 48945632.69292361, 1, 0, 140240198.60728768, 48945829.753517374, 29 },
-  { 140240151.50870863, 48945623.99527186, 140240169.8372932, 48945659.54893535, 140240133.18012404, 48945588.44160838, 140240152.42513785, 48945625.77295504, 140240150.5922794, 48945622.217588685, 0, 0, 0, 0, 0 },
-  { 140240177.75488007, 48945610.464875095, 140240199.78301483, 48945643.85291604, 140240155.7267453, 48945577.07683415, 140240178.85628682, 48945612.13427714, 140240176.65347332, 48945608.79547305, 0, 0, 0, 0, 0 },
-  { 140240202.3607214, 48945594.23089509, 140240227.78403133, 48945625.11220517, 140240176.9374115, 48945563.349585004, 140240203.6318869, 48945595.77496059, 140240201.08955592, 48945592.68682958, 1, 3, 140239957.0257806, 48945296.226252824, 45 },
-  { 140240225.04607755, 48945575.55497627, 140240253.58336425, 48945603.5839482, 140240196.50879085, 48945547.52600434, 140240226.47294188, 48945576.95642487, 140240223.61921322, 48945574.15352767, 0, 0, 0, 0, 0 },
-  { 140240245.53079355, 48945554.6987631, 140240276.90820125, 48945579.50719486, 140240214.15338585, 48945529.89033134, 140240247.09966394, 48945555.93918469, 140240243.96192315, 48945553.45834152, 0, 0, 0, 0, 0 },
-  { 140240263.53748548, 48945531.92411457, 140240297.31702748, 48945553.34705887, 140240229.75794348, 48945510.50117027, 140240265.22646257, 48945532.99526179, 140240261.8485084, 48945530.85296735, 1, 2, 140240362.34264582, 48945594.58622664, 41 },
-  { 140240279.02036667, 48945507.51082067, 140240314.54815385, 48945525.88951315, 140240243.4925795, 48945489.132128194, 140240280.79675603, 48945508.42975529, 140240277.2439773, 48945506.59188605, 0, 0, 0, 0, 0 },
-  { 140240292.336295, 48945481.76984541, 140240329.06227645, 48945497.61920779, 140240255.61031356, 48945465.92048303, 140240294.17259407, 48945482.56231353, 140240290.49999595, 48945480.977377295, 1, 2, 140240507.18328637, 48945574.48861534, 43 },
-  { 140240303.88242403, 48945455.015272595, 140240341.39001414, 48945468.91421805, 140240266.3748339, 48945441.11632714, 140240305.75780353, 48945455.71021987, 140240302.00704452, 48945454.32032532, 0, 0, 0, 0, 0 },
-  { 140240314.05590758, 48945427.56118609, 140240352.03660667, 48945440.10975163, 140240276.0752085, 48945415.01262055, 140240315.95494252, 48945428.18861437, 140240312.15687263, 48945426.93375781, 1, 0, 140240443.19028446, 48945470.22630892, 26 },
-  { 140240323.25389582, 48945399.7216675, 140240361.51549238, 48945411.38572465, 140240284.99229926, 48945388.05761035, 140240325.16697565, 48945400.30487036, 140240321.340816, 48945399.13846464, 1, 3, 140239968.3775878, 48945291.537537396, 32 },
-  { 140240331.7807725, 48945371.7509613, 140240370.31076398, 48945382.49525082, 140240293.25078103, 48945361.00667179, 140240333.70727208, 48945372.28817578, 140240329.85427293, 48945371.21374683, 0, 0, 0, 0, 0 },
-  { 140240339.60640454, 48945343.68753887, 140240378.41945136, 48945353.35952917, 140240300.79335773, 48945334.01554857, 140240341.54705688, 48945344.17113838, 140240337.6657522, 48945343.203939356, 1, 4, 140240073.7370338, 48945277.434405334, 45 },
-  { 140240346.6252829, 48945315.52125184, 140240385.7240837, 48945323.96422394, 140240307.52648214, 48945307.07827974, 140240348.58022296, 48945315.94340045, 140240344.67034286, 48945315.099103235, 0, 0, 0, 0, 0 },
-  { 140240352.73189837, 48945287.24195184, 140240392.10492244, 48945294.29638129, 140240313.3588743, 48945280.18752239, 140240354.70054957, 48945287.59467331, 140240350.76324716, 48945286.88923036, 1, 1, 140240180.474918, 48945256.378823, 38 },
-  { 140240357.82074192, 48945258.83949049, 140240397.43970573, 48945264.34745805, 140240318.2017781, 48945253.33152293, 140240359.8016901, 48945259.11488887, 140240355.83979374, 48945258.56409211, 1, 5, 140240620.29637715, 48945295.329775564, 35 },
-  { 140240361.78785986, 48945230.30390087, 140240401.59580812, 48945234.21890475, 140240321.9799116, 48945226.38889699, 140240363.77825728, 48945230.49965106, 140240359.79746243, 48945230.108150676, 0, 0, 0, 0, 0 },
-  { 140240364.6074344, 48945201.63433103, 140240404.53296396, 48945204.07402113, 140240324.68190482, 48945199.194640934, 140240366.60371086, 48945201.75631554, 140240362.61115792, 48945201.51234653, 1, 1, 140240577.21087942, 48945214.62568081, 26 },
-  { 140240366.36675045, 48945172.84312296, 140240406.35161665, 48945173.94333888, 140240326.38188425, 48945171.74290704, 140240368.36599377, 48945172.898133755, 140240364.36750713, 48945172.78811216, 0, 0, 0, 0, 0 },
-  { 140240367.16194278, 48945143.94365108, 140240407.16181672, 48945143.84322287, 140240327.16206884, 48945144.04407929, 140240369.16193646, 48945143.93862967, 140240365.1619491, 48945143.94867249, 1, 1, 140240729.16080183, 48945143.03477579, 27 },
-  { 140240367.08914626, 48945114.949289806, 140240407.07227904, 48945113.787784725, 140240327.10601348, 48945116.11079489, 140240369.08830288, 48945114.89121455, 140240365.08998963, 48945115.00736506, 1, 4, 140240033.22998765, 48945124.647857256, 35 },
-  { 140240366.24449563, 48945085.873413526, 140240406.19017756, 48945083.789548084, 140240326.2988137, 48945087.95727897, 140240368.2417797, 48945085.769220255, 140240364.24721155, 48945085.977606796, 0, 0, 0, 0, 0 },
-  { 140240364.7241258, 48945056.72939669, 140240404.62107784, 48945053.86003832, 140240324.82717377, 48945059.59875507, 140240366.7189734, 48945056.585928775, 140240362.7292782, 48945056.87286461, 0, 0, 0, 0, 0 },
-  { 140240362.62417158, 48945027.530613676, 140240402.4689704, 48945024.01038521, 140240322.77937278, 48945031.05084214, 140240364.61641154, 48945027.354602255, 140240360.63193163, 48945027.7066251, 0, 0, 0, 0, 0 },
-  { 140240360.04084647, 48944998.29044628, 140240399.84005532, 48944994.28757547, 140240320.24163762, 48945002.293317094, 140240362.0308069, 48944998.09030274, 140240358.05088603, 48944998.49058982, 0, 0, 0, 0, 0 },
-  { 140240357.09740743, 48944969.024814054, 140240396.87294674, 48944964.793210156, 140240317.32186812, 48944973.25641795, 140240359.08618438, 48944968.81323386, 140240355.10863048, 48944969.23639425, 0, 0, 0, 0, 0 },
-  { 140240353.98356995, 48944939.755873, 140240393.7629891, 48944935.560898304, 140240314.2041508, 48944943.9508477, 140240355.97254092, 48944939.546124265, 140240351.99459898, 48944939.96562174, 0, 0, 0, 0, 0 },
-  { 140240350.899074, 48944910.506719805, 140240390.70926517, 48944906.61458969, 140240311.0888828, 48944914.39884992, 140240352.88958356, 48944910.3121133, 140240348.90856442, 48944910.70132631, 1, 1, 140240639.52296016, 48944882.28877648, 40 },
-  { 140240348.04365948, 48944881.30045119, 140240387.90568948, 48944877.981028736, 140240308.18162948, 48944884.61987364, 140240350.036761, 48944881.13448007, 140240346.05055797, 48944881.46642231, 0, 0, 0, 0, 0 },
-  { 140240345.61706644, 48944852.160163805, 140240385.54067394, 48944849.689219855, 140240305.69345894, 48944854.631107755, 140240347.61324683, 48944852.03661661, 140240343.62088606, 48944852.283711, 0, 0, 0, 0, 0 },
-  { 140240343.81903479, 48944823.10895438, 140240383.79659605, 48944821.769329466, 140240303.84147352, 48944824.44857929, 140240345.81791285, 48944823.04197313, 140240341.82015672, 48944823.175935626, 0, 0, 0, 0, 0 },
-  { 140240342.8493045, 48944794.1699196, 140240382.84922254, 48944794.25089642, 140240302.84938645, 48944794.08894279, 140240344.84930038, 48944794.17396844, 140240340.8493086, 48944794.16587076, 1, 3, 140240579.84881884, 48944794.649707235, 28 },
-  { 140240342.90761554, 48944765.36615616, 140240382.86736158, 48944767.160228916, 140240302.9478695, 48944763.572083406, 140240344.90560284, 48944765.455859795, 140240340.90962824, 48944765.27645253, 0, 0, 0, 0, 0 },
-  { 140240344.19370788, 48944736.72076077, 140240384.0131618, 48944740.51695496, 140240304.37425396, 48944732.92456658, 140240346.18468058, 48944736.91057048, 140240342.2027352, 48944736.53095106, 0, 0, 0, 0, 0 },
-  { 140240346.9073214, 48944708.2568301, 140240386.44390586, 48944714.327949256, 140240307.37073693, 48944702.18571095, 140240348.88415062, 48944708.56038606, 140240344.93049216, 48944707.953274146, 0, 0, 0, 0, 0 },
-  { 140240351.2467421, 48944679.99748135, 140240390.34641543, 48944688.4364117, 140240312.14706877, 48944671.558551006, 140240353.20172575, 48944680.41942787, 140240349.29175845, 48944679.575534835, 0, 0, 0, 0, 0 },
-  { 140240357.29650137, 48944651.967434734, 140240395.85994282, 48944662.59103973, 140240318.7330599, 48944641.343829736, 140240359.22467345, 48944652.49861498, 140240355.3683293, 48944651.43625449, 0, 0, 0, 0, 0 },
-  { 140240364.94759592, 48944624.19413773, 140240402.9107888, 48944636.795565665, 140240326.98440304, 48944611.592709795, 140240366.84575558, 48944624.824209124, 140240363.04943627, 48944623.564066336, 0, 0, 0, 0, 0 },
-  { 140240374.0721858, 48944596.705303304, 140240411.39786625, 48944611.085622475, 140240336.74650538, 48944582.32498413, 140240375.93846983, 48944597.42431926, 140240372.2059018, 48944595.98628735, 1, 2, 140240265.82771254, 48944555.00237772, 45 },
-  { 140240384.5424311, 48944569.52864438, 140240421.21528277, 48944585.50055566, 140240347.8695794, 48944553.55673311, 140240386.37607366, 48944570.327239946, 140240382.7087885, 48944568.73004882, 1, 2, 140240509.2301268, 48944623.83314272, 47 },
-  { 140240396.2304918, 48944542.69187394, 140240432.2526549, 48944560.08163422, 140240360.20832866, 48944525.30211365, 140240398.03159994, 48944543.56136195, 140240394.42938364, 48944541.82238592, 0, 0, 0, 0, 0 },
-  { 140240409.008528, 48944516.22270489, 140240444.39569256, 48944534.87072313, 140240373.62136343, 48944497.57468665, 140240410.7778862, 48944517.1551058, 140240407.23916978, 48944515.290303975, 0, 0, 0, 0, 0 },
-  { 140240422.74869972, 48944490.14885018, 140240457.5268842, 48944509.909363426, 140240387.97051525, 48944470.388336934, 140240424.48760894, 48944491.136875845, 140240421.0097905, 48944489.160824515, 0, 0, 0, 0, 0 },
-  { 140240437.3231671, 48944464.49802278, 140240471.5231564, 48944485.24316032, 140240403.12317777, 48944443.75288524, 140240439.03316656, 48944465.535279654, 140240435.6131676, 48944463.460765906, 1, 4, 140240639.103104, 48944586.89433426, 33 },
-  { 140240452.60873216, 48944439.29856767, 140240486.21919778, 48944460.985812806, 140240418.99826655, 48944417.61132253, 140240454.28925544, 48944440.38292992, 140240450.9282089, 48944438.214205414, 0, 0, 0, 0, 0 },
-  { 140240468.55299097, 48944414.58846922, 140240501.52405176, 48944437.23596689, 140240435.5819302, 48944391.94097155, 140240470.20154402, 48944415.720844105, 140240466.90443793, 48944413.45609434, 0, 0, 0, 0, 0 },
-  { 140240485.1587278, 48944390.41322628, 140240517.43534288, 48944414.03990863, 140240452.8821127, 48944366.78654392, 140240486.77255854, 48944391.59456039, 140240483.54489705, 48944389.23189216, 0, 0, 0, 0, 0 },
-  { 140240502.43018702, 48944366.81853648, 140240533.95293763, 48944391.442025125, 140240470.9074364, 48944342.19504784, 140240504.00632456, 48944368.049710914, 140240500.85404947, 48944365.58736205, 1, 4, 140240690.77862203, 48944513.9438811, 40 },
-  { 140240520.371613, 48944343.85009747, 140240551.07659164, 48944369.486093394, 140240489.66663435, 48944318.214101546, 140240521.90686193, 48944345.13189726, 140240518.83636406, 48944342.56829768, 0, 0, 0, 0, 0 },
-  { 140240538.98725015, 48944321.55360691, 140240568.80602995, 48944348.215196736, 140240509.16847035, 48944294.89201709, 140240540.47818914, 48944322.88668641, 140240537.49631116, 48944320.22052742, 1, 1, 140240764.11903757, 48944522.84861006, 35 },
-  { 140240558.2813428, 48944299.97476244, 140240587.1410523, 48944327.671642534, 140240529.4216333, 48944272.277882345, 140240559.72432828, 48944301.359606445, 140240556.83835733, 48944298.589918435, 0, 0, 0, 0, 0 },
-  { 140240578.25813532, 48944279.159261666, 140240606.08166674, 48944307.896886826, 140240550.4346039, 48944250.42163651, 140240579.6493119, 48944280.596142925, 140240576.86695874, 48944277.72238041, 0, 0, 0, 0, 0 },
-  { 140240598.9218721, 48944259.15280231, 140240625.62884307, 48944288.93094366, 140240572.21490115, 48944229.37466096, 140240600.25722066, 48944260.64170938, 140240597.58652356, 48944257.66389524, 0, 0, 0, 0, 0 },
-  { 140240620.27654108, 48944240.0005484, 140240645.81534505, 48944270.78641354, 140240594.73773712, 48944209.21468326, 140240621.55348128, 48944241.53984166, 140240618.9996009, 48944238.46125514, 0, 0, 0, 0, 0 },
-  { 140240642.3128551, 48944221.72004529, 140240666.6823217, 48944253.43958339, 140240617.9433885, 48944190.00050719, 140240643.53132844, 48944223.3060222, 140240641.09438175, 48944220.134068385, 0, 0, 0, 0, 0 },
-  { 140240665.00208107, 48944204.28838116, 140240688.21238446, 48944236.865701735, 140240641.79177767, 48944171.71106058, 140240666.16259623, 48944205.91724719, 140240663.8415659, 48944202.65951513, 0, 0, 0, 0, 0 },
-  { 140240688.31393868, 48944187.67942503, 140240710.38222522, 48944221.04094072, 140240666.24565214, 48944154.317909345, 140240689.417353, 48944189.347500816, 140240687.21052435, 48944186.011349246, 1, 1, 140240517.8364251, 48943929.961716354, 45 },
-  { 140240712.21814758, 48944171.86704598, 140240733.16765842, 48944205.9422275, 140240691.26863673, 48944137.79186447, 140240713.26562312, 48944173.57080506, 140240711.17067203, 48944170.16328691, 1, 0, 140240880.86170995, 48944446.17225714, 34 },
-  { 140240736.6844274, 48944156.82511305, 140240756.54360184, 48944191.54705411, 140240716.82525298, 48944122.10317199, 140240737.67738613, 48944158.5612101, 140240735.6914687, 48944155.089016, 0, 0, 0, 0, 0 },
-  { 140240761.68249783, 48944142.5274953, 140240780.48409507, 48944177.833301365, 140240742.8809006, 48944107.22168924, 140240762.6225777, 48944144.29278561, 140240760.74241796, 48944140.762205, 0, 0, 0, 0, 0 },
-  { 140240787.18207854, 48944128.94806179, 140240804.9623471, 48944164.77908257, 140240769.40181, 48944093.11704101, 140240788.07109198, 48944130.739612825, 140240786.2930651, 48944127.15651075, 0, 0, 0, 0, 0 },
-  { 140240813.15288922, 48944116.06068157, 140240829.95080408, 48944152.36261067, 140240796.35497436, 48944079.758752465, 140240813.99278498, 48944117.87577802, 140240812.31299347, 48944114.245585114, 0, 0, 0, 0, 0 },
-  { 140240839.56464937, 48944103.83922367, 140240855.42122892, 48944140.56208964, 140240823.70806983, 48944067.1163577, 140240840.35747835, 48944105.67536697, 140240838.7718204, 48944102.00308037, 1, 4, 140240761.07458064, 48943922.0610371, 47 },
-  { 140240866.38707882, 48944092.25755718, 140240881.34478897, 48944129.35562866, 140240851.42936867, 48944055.159485705, 140240867.13496432, 48944094.112460755, 140240865.63919333, 48944090.40265361, 1, 2, 140240954.26362592, 48944310.20872711, 26 },
-  { 140240893.5898972, 48944081.28955114, 140240907.69214213, 48944118.72117798, 140240879.48765224, 48944043.8579243, 140240894.29500943, 48944083.16113248, 140240892.88478494, 48944079.4179698, 1, 5, 140240802.63041738, 48943839.855558015, 40 },
-  { 140240921.1428241, 48944070.909074605, 140240934.433522, 48944108.63648308, 140240907.85212624, 48944033.18166613, 140240921.807359, 48944072.795445025, 140240920.47828922, 48944069.022704184, 1, 4, 140241024.81026748, 48944365.18286071, 26 },
-  { 140240949.0155792, 48944061.089996606, 140240961.5388167, 48944099.079054534, 140240936.4923417, 48944023.10093868, 140240949.64174107, 48944062.9894495, 140240948.38941732, 48944059.19054371, 0, 0, 0, 0, 0 },
-  { 140240977.17788222, 48944051.806186244, 140240988.97764233, 48944090.02615042, 140240965.37812212, 48944013.58622207, 140240977.76787022, 48944053.717184454, 140240976.58789423, 48944049.89518803, 0, 0, 0, 0, 0 },
-  { 140241005.59945276, 48944043.03151255, 140241016.71940678, 48944081.45476882, 140240994.47949874, 48944004.60825628, 140241006.15545046, 48944044.952675365, 140241005.04345506, 48944041.11034974, 1, 2, 140240909.13385168, 48943709.70976438, 43 },
-  { 140241034.2500105, 48944034.73984455, 140241044.73336774, 48944073.341647886, 140241023.76665324, 48943996.13804122, 140241034.77417836, 48944036.66993472, 140241033.72584262, 48944032.80975439, 0, 0, 0, 0, 0 },
-  { 140241063.09927505, 48944026.905051336, 140241072.98868266, 48944065.66327133, 140241053.20986745, 48943988.14683134, 140241063.59374544, 48944028.84296233, 140241062.60480466, 48944024.96714034, 1, 1, 140240983.9840142, 48943716.83929137, 39 },
-  { 140241092.11696616, 48944019.50100195, 140241101.45445183, 48944058.39587772, 140241082.7794805, 48943980.606126174, 140241092.58384043, 48944021.44574574, 140241091.6500919, 48944017.55625816, 1, 5, 140241182.22370282, 48944394.836553164, 27 },
-  { 140241121.27280346, 48944012.50156546, 140241130.09975553, 48944051.515472166, 140241112.4458514, 48943973.48765875, 140241121.71415105, 48944014.45226079, 140241120.83145586, 48944010.55087012, 1, 0, 140241085.30297375, 48943853.5198956, 26 },
-  { 140241150.5365065, 48944005.880610876, 140241158.8936854, 48944044.99783932, 140241142.1793276, 48943966.763382435, 140241150.95436546, 48944007.836472295, 140241150.11864755, 48944003.92474946, 0, 0, 0, 0, 0 },
-  { 140241179.8777951, 48943999.612007305, 140241187.74154213, 48944038.83140917, 140241172.01404807, 48943960.39260544, 140241180.27098244, 48944001.5729774, 140241179.48460776, 48943997.65103721, 1, 3, 140241128.96003312, 48943745.66638023, 44 },
-  { 140241209.2594855, 48943993.72078588, 140241216.07670468, 48944033.135574, 140241202.44226635, 48943954.30599776, 140241209.60034648, 48943995.69152529, 140241208.91862455, 48943991.75004647, 1, 5, 140241233.6310441, 48944134.628653415, 44 },
-  { 140241238.58825278, 48943988.64805444, 140241243.50443882, 48944028.34479379, 140241233.67206675, 48943948.9513151, 140241238.8340621, 48943990.63289141, 140241238.34244347, 48943986.66321748, 0, 0, 0, 0, 0 },
-  { 140241267.74345535, 48943985.03736998, 140241269.82474378, 48944024.98318627, 140241265.66216692, 48943945.091553695, 140241267.8475198, 48943987.034660794, 140241267.63939092, 48943983.04007917, 1, 1, 140241282.3124743, 48944264.65808396, 47 },
-  { 140241296.60426942, 48943983.533641085, 140241294.85083783, 48944023.495191075, 140241298.357701, 48943943.572091095, 140241296.51659784, 48943985.53171858, 140241296.691941, 48943981.53556359, 0, 0, 0, 0, 0 },
-  { 140241325.04987112, 48943984.781776264, 140241318.50121558, 48944024.24207417, 140241331.59852666, 48943945.32147836, 140241324.72243834, 48943986.75479116, 140241325.3773039, 48943982.808761366, 0, 0, 0, 0, 0 },
-  { 140241352.9609679, 48943989.41377775, 140241341.57772493, 48944027.75985682, 140241364.34421086, 48943951.06769869, 140241352.39180574, 48943991.3310817, 140241353.53013006, 48943987.496473804, 0, 0, 0, 0, 0 },
-  { 140241380.28204173, 48943997.52418771, 140241365.11761674, 48944034.53824199, 140241395.4464667, 48943960.51013342, 140241379.5238205, 48943999.374890424, 140241381.04026297, 48943995.67348499, 0, 0, 0, 0, 0 },
-  { 140241407.0429586, 48944008.48796685, 140241389.1287861, 48944044.25222867, 140241424.9571311, 48943972.72370503, 140241406.14724997, 48944010.27617994, 140241407.9386672, 48944006.69975376, 0, 0, 0, 0, 0 },
-  { 140241433.279554, 48944021.62977022, 140241413.50399473, 48944056.399401434, 140241453.0551133, 48943986.860139005, 140241432.29077604, 48944023.36825178, 140241434.26833197, 48944019.89128866, 0, 0, 0, 0, 0 },
-  { 140241459.02766332, 48944036.2742529, 140241438.15642348, 48944070.39743194, 140241479.89890316, 48944002.15107386, 140241457.98410133, 48944037.98041185, 140241460.07122532, 48944034.56809395, 1, 1, 140241657.82622272, 48943711.25097253, 40 },
-  { 140241484.32312188, 48944051.746069916, 140241462.9866205, 48944085.58027906, 140241505.65962327, 48944017.91186077, 140241483.2562968, 48944053.43778037, 140241485.38994694, 48944050.05435946, 0, 0, 0, 0, 0 },
-  { 140241509.21172446, 48944067.44130019, 140241487.6714644, 48944101.1461544, 140241530.7519845, 48944033.73644598, 140241508.13471144, 48944069.1265429, 140241510.28873748, 48944065.75605748, 1, 5, 140241628.7601677, 48943880.37935932, 46 },
-  { 140241533.7944449, 48944083.15174318, 140241512.19337845, 48944116.817659594, 140241555.39551133, 48944049.48582677, 140241532.71439156, 48944084.835039005, 140241534.87449822, 48944081.46844736, 0, 0, 0, 0, 0 },
-  { 140241558.19125962, 48944098.80547468, 140241536.67490456, 48944132.52559427, 140241579.7076147, 48944065.085355096, 140241557.11544186, 48944100.49148066, 140241559.2670774, 48944097.119468704, 0, 0, 0, 0, 0 },
-  { 140241582.52216244, 48944114.330696724, 140241561.23807833, 48944148.19790452, 140241603.80624655, 48944080.46348893, 140241581.45795822, 48944116.02405711, 140241583.58636665, 48944112.637336336, 0, 0, 0, 0, 0 },
-  { 140241606.9071473, 48944129.65561136, 140241586.00417873, 48944163.75936343, 140241627.81011584, 48944095.55185929, 140241605.86199886, 48944131.36079896, 140241607.95229572, 48944127.950423755, 1, 4, 140241809.1433681, 48943799.70181006, 28 },
-  { 140241631.46620804, 48944144.70842061, 140241611.0934643, 48944179.13154238, 140241651.8389518, 48944110.28529885, 140241630.44757086, 48944146.4295767, 140241632.48484522, 48944142.98726452, 1, 0, 140241457.78856754, 48944438.165533654, 30 },
-  { 140241656.31933856, 48944159.41732653, 140241636.61007884, 48944194.22458269, 140241676.02859828, 48944124.61007038, 140241655.33387557, 48944161.15768934, 140241657.30480155, 48944157.676963724, 1, 1, 140241837.644528, 48943839.190569885, 26 },
-  { 140241681.57596868, 48944173.718640044, 140241662.5051722, 48944208.87976518, 140241700.64676517, 48944138.557514906, 140241680.62242886, 48944175.476696305, 140241682.5295085, 48944171.96058378, 1, 2, 140241624.8403491, 48944278.32298734, 40 },
-  { 140241707.23335734, 48944187.634771444, 140241688.68098643, 48944223.072174475, 140241725.78572825, 48944152.19736841, 140241706.3057388, 48944189.406641595, 140241708.16097587, 48944185.86290129, 1, 3, 140241850.55042267, 48943913.880833045, 26 },
-  { 140241733.22114706, 48944201.24003235, 140241715.0658904, 48944236.88251621, 140241751.37640372, 48944165.59754849, 140241732.31338423, 48944203.022156544, 140241734.1289099, 48944199.45790816, 0, 0, 0, 0, 0 },
-  { 140241759.46804827, 48944214.60944931, 140241741.5889934, 48944250.391279854, 140241777.34710315, 48944178.82761877, 140241758.57409552, 48944216.39854084, 140241760.36200103, 48944212.820357785, 0, 0, 0, 0, 0 },
-  { 140241785.90277186, 48944227.81804894, 140241768.17953286, 48944263.677312724, 140241803.62601086, 48944191.958785154, 140241785.0166099, 48944229.61101213, 140241786.7889338, 48944226.02508575, 0, 0, 0, 0, 0 },
-  { 140241812.4540284, 48944240.94085782, 140241794.76671022, 48944276.81785289, 140241830.14134657, 48944205.06386275, 140241811.56966248, 48944242.73470757, 140241813.3383943, 48944239.14700807, 0, 0, 0, 0, 0 },
-  { 140241839.05052876, 48944254.05290256, 140241821.27960223, 48944289.88855757, 140241856.8214553, 48944218.217247546, 140241838.16198245, 48944255.84468531, 140241839.93907508, 48944252.261119805, 0, 0, 0, 0, 0 },
-  { 140241865.62098345, 48944267.229209736, 140241847.64714184, 48944302.96352123, 140241883.59482506, 48944231.494898245, 140241864.72229138, 48944269.01592531, 140241866.51967552, 48944265.44249416, 0, 0, 0, 0, 0 },
-  { 140241892.09410325, 48944280.54480594, 140241873.7981664, 48944316.11528098, 140241910.3900401, 48944244.974330895, 140241891.17930642, 48944282.32332969, 140241893.00890008, 48944278.766282186, 1, 2, 140241750.30059263, 48944556.2159875, 47 },
-  { 140241918.39859888, 48944294.07471777, 140241899.66153395, 48944329.41481395, 140241937.1356638, 48944258.734621584, 140241917.46174562, 48944295.84172258, 140241919.33545214, 48944292.30771296, 1, 3, 140242001.31011117, 48944137.694792174, 47 },
-  { 140241944.46318096, 48944307.8939718, 140241925.16631207, 48944342.93153523, 140241963.76004985, 48944272.85640837, 140241943.4983375, 48944309.64584997, 140241945.4280244, 48944306.14209363, 0, 0, 0, 0, 0 },
-  { 140241970.21656027, 48944322.07759462, 140241950.2420447, 48944356.73331172, 140241990.19107586, 48944287.421877526, 140241969.2178345, 48944323.81038048, 140241971.21528605, 48944320.344808765, 1, 1, 140242082.07384747, 48944128.00557887, 37 },
-  { 140241995.58744755, 48944336.70061286, 140241974.8191029, 48944370.88651436, 140242016.3557922, 48944302.51471136, 140241994.54903033, 48944338.40990793, 140241996.62586477, 48944334.99131779, 1, 1, 140241910.95644316, 48944476.00816146, 45 },
-  { 140242020.50455332, 48944351.83805306, 140241998.8291217, 48944385.45613844, 140242042.17998493, 48944318.219967686, 140242019.42078173, 48944353.51895733, 140242021.5883249, 48944350.15714879, 0, 0, 0, 0, 0 },
-  { 140242044.89658847, 48944367.564941846, 140242022.20551708, 48944400.506029844, 140242067.58765987, 48944334.62385385, 140242043.7620349, 48944369.21199624, 140242046.03114206, 48944365.91788745, 0, 0, 0, 0, 0 },
-  { 140242068.69226357, 48944383.95630581, 140242044.8840637, 48944416.09926178, 140242092.50046346, 48944351.813349836, 140242067.5018536, 48944385.56345361, 140242069.88267356, 48944382.34915801, 1, 4, 140242241.89691767, 48944150.11630112, 39 },
-  { 140242091.8202894, 48944401.0871715, 140242066.8034916, 48944432.29870506, 140242116.8370872, 48944369.87563795, 140242090.5694495, 48944402.64774818, 140242093.0711293, 48944399.526594825, 0, 0, 0, 0, 0 },
-  { 140242114.20937663, 48944419.03256556, 140242087.90603295, 48944449.16782915, 140242140.51272032, 48944388.897301964, 140242112.89420944, 48944420.53932874, 140242115.52454382, 48944417.525802374, 0, 0, 0, 0, 0 },
-  { 140242135.78823593, 48944437.867514536, 140242108.13781846, 48944466.771742836, 140242163.4386534, 48944408.963286236, 140242134.40571505, 48944439.312725954, 140242137.17075682, 48944436.42230312, 1, 2, 140241953.98674104, 48944627.91281561, 37 },
-  { 140242156.48557806, 48944457.66704506, 140242127.44899687, 48944485.178441845, 140242185.52215925, 48944430.15564827, 140242155.033749, 48944459.0426149, 140242157.9374071, 48944456.291475214, 1, 3, 140242257.38769767, 48944362.06494121, 25 },
-  { 140242176.2301137, 48944478.506183684, 140242145.79344448, 48944504.46016543, 140242206.6667829, 48944452.552201934, 140242174.70828024, 48944479.80388277, 140242177.75194713, 48944477.2084846, 1, 0, 140241885.55992293, 48944726.36670939, 40 },
-  { 140242194.95055348, 48944500.45995704, 140242163.12657285, 48944524.692873836, 140242226.7745341, 48944476.227040246, 140242193.35935444, 48944501.67160288, 140242196.54175252, 48944499.2483112, 0, 0, 0, 0, 0 },
-  { 140242212.55182064, 48944523.5748957, 140242179.36642545, 48944545.90714921, 140242245.73721582, 48944501.242642194, 140242210.8925509, 48944524.691508375, 140242214.2110904, 48944522.45828303, 0, 0, 0, 0, 0 },
-  { 140242228.84083787, 48944547.78013203, 140242194.3265275, 48944567.99800481, 140242263.35514823, 48944527.56225926, 140242227.11512235, 48944548.79102567, 140242230.56655338, 48944546.7692384, 0, 0, 0, 0, 0 },
-  { 140242243.59929407, 48944572.97456982, 140242207.8048288, 48944590.82831609, 140242279.39375934, 48944555.12082355, 140242241.8095708, 48944573.86725713, 140242245.38901734, 48944572.08188251, 0, 0, 0, 0, 0 },
-  { 140242256.60887814, 48944599.05711284, 140242219.61132446, 48944614.261750996, 140242293.6064318, 48944583.85247469, 140242254.75900045, 48944599.81734475, 140242258.45875582, 48944598.29688094, 1, 0, 140242566.46339026, 48944471.71826833, 38 },
-  { 140242267.6512789, 48944625.92666485, 140242229.5854553, 48944638.21458872, 140242305.71710253, 48944613.63874099, 140242265.74798775, 48944626.541061044, 140242269.55457008, 48944625.31226866, 0, 0, 0, 0, 0 },
-  { 140242276.54568166, 48944653.4799578, 140242237.7018363, 48944663.027505964, 140242315.38952702, 48944643.93240963, 140242274.6034894, 48944653.957335204, 140242278.4878739, 48944653.00258039, 0, 0, 0, 0, 0 },
-  { 140242283.45586082, 48944681.59376528, 140242244.12210128, 48944688.863934405, 140242322.78962037, 48944674.32359616, 140242281.48917285, 48944681.95727374, 140242285.4225488, 48944681.230256826, 0, 0, 0, 0, 0 },
-  { 140242288.73105446, 48944710.134118944, 140242249.1088727, 48944715.618889965, 140242328.3532362, 48944704.64934792, 140242286.74994537, 48944710.40835749, 140242290.71216354, 48944709.859880395, 0, 0, 0, 0, 0 },
-  { 140242292.72228995, 48944738.96694672, 140242252.94301516, 48944743.16329007, 140242332.50156474, 48944734.77060337, 140242290.7333262, 48944739.17676389, 140242294.7112537, 48944738.75712955, 0, 0, 0, 0, 0 },
-  { 140242295.78059494, 48944767.95817661, 140242255.9247027, 48944771.35049935, 140242335.6364872, 48944764.56585388, 140242293.78780034, 48944768.127792746, 140242297.77338955, 48944767.78856048, 0, 0, 0, 0, 0 },
-  { 140242298.25050882, 48944796.97682515, 140242258.3532475, 48944799.8418798, 140242338.14777014, 48944794.111770496, 140242296.25564575, 48944797.12007788, 140242300.24537188, 48944796.83357242, 0, 0, 0, 0, 0 },
-  { 140242300.3318709, 48944825.9607915, 140242260.4047633, 48944828.374518804, 140242340.25897852, 48944823.54706419, 140242298.33551553, 48944826.081477866, 140242302.3282263, 48944825.84010513, 1, 3, 140242635.71957466, 48944805.68548214, 28 },
-  { 140242302.08229095, 48944854.915681675, 140242262.13389033, 48944856.94676206, 140242342.03069156, 48944852.88460129, 140242300.0848709, 48944855.0172357, 140242304.079711, 48944854.814127654, 0, 0, 0, 0, 0 },
-  { 140242303.5533845, 48944883.849955, 140242263.5902974, 48944885.567996964, 140242343.51647162, 48944882.131913036, 140242301.55523017, 48944883.935857095, 140242305.55153885, 48944883.764052905, 0, 0, 0, 0, 0 },
-  { 140242304.79676715, 48944912.772070765, 140242264.82398164, 48944914.24733997, 140242344.76955265, 48944911.29680156, 140242302.79812786, 48944912.845834225, 140242306.79540643, 48944912.698307306, 1, 5, 140242163.89269826, 48944917.97239471, 46 },
-  { 140242305.86405456, 48944941.69048834, 140242265.8852889, 48944942.99367478, 140242345.84282023, 48944940.3873019, 140242303.86511627, 48944941.75564766, 140242307.86299285, 48944941.62532902, 0, 0, 0, 0, 0 },
-  { 140242306.8068624, 48944970.61366705, 140242266.82492703, 48944971.815683804, 140242346.7887978, 48944969.41165029, 140242304.80776563, 48944970.67376789, 140242308.8059592, 48944970.55356621, 0, 0, 0, 0, 0 },
-  { 140242307.6768062, 48944999.55006619, 140242267.69404194, 48945000.72418753, 140242347.6595705, 48944998.375944845, 140242305.677668, 48944999.608772255, 140242309.67594442, 48944999.49136012, 0, 0, 0, 0, 0 },
-  { 140242308.52711448, 48945028.5059108, 140242268.54611892, 48945029.73879111, 140242348.50811005, 48945027.27303049, 140242306.5280647, 48945028.56755482, 140242310.52616426, 48945028.44426678, 0, 0, 0, 0, 0 },
-  { 140242309.42040643, 48945057.47441745, 140242269.44432494, 48945058.85749702, 140242349.39648792, 48945056.091337875, 140242307.42160237, 48945057.54357143, 140242311.4192105, 48945057.40526347, 0, 0, 0, 0, 0 },
-  { 140242310.42269042, 48945086.4441074, 140242270.45570302, 48945088.06888981, 140242350.38967782, 48945084.819324985, 140242308.42434105, 48945086.52534652, 140242312.4210398, 48945086.36286828, 0, 0, 0, 0, 0 },
-  { 140242311.59997967, 48945115.403495535, 140242271.647938, 48945117.36164958, 140242351.55202132, 48945113.44534149, 140242309.6023776, 48945115.501403235, 140242313.59758174, 48945115.305587836, 0, 0, 0, 0, 0 },
-  { 140242313.01828718, 48945144.34109678, 140242273.08849934, 48945146.710071735, 140242352.94807503, 48945141.97212183, 140242311.02179778, 48945144.45954553, 140242315.0147766, 48945144.22264803, 0, 0, 0, 0, 0 },
-  { 140242314.733241, 48945173.24716082, 140242274.8302067, 48945176.0306573, 140242354.6362753, 48945170.463664345, 140242312.73808926, 48945173.38633565, 140242316.72839272, 48945173.107985996, 0, 0, 0, 0, 0 },
-  { 140242316.7473659, 48945202.120807946, 140242276.87381557, 48945205.29885525, 140242356.62091622, 48945198.94276064, 140242314.75368837, 48945202.27971031, 140242318.74104342, 48945201.961905584, 1, 1, 140242096.44600037, 48945219.67951933, 33 },
-  { 140242319.04625788, 48945230.96398634, 140242279.20432258, 48945234.51647702, 140242358.8881932, 48945227.411495656, 140242317.05416113, 48945231.14161087, 140242321.03835464, 48945230.786361806, 1, 1, 140242673.63948223, 48945199.34681928, 32 },
-  { 140242321.61550575, 48945259.77864533, 140242281.80674508, 48945263.685379595, 140242361.42426643, 48945255.871911064, 140242319.6250677, 48945259.97398204, 140242323.6059438, 48945259.583308615, 0, 0, 0, 0, 0 },
-  { 140242324.4406983, 48945288.566734314, 140242284.66612944, 48945292.80745033, 140242364.21526715, 48945284.326018296, 140242322.45196986, 48945288.77877011, 140242326.42942673, 48945288.35469852, 0, 0, 0, 0, 0 },
-  { 140242327.5074242, 48945317.330202654, 140242287.76755208, 48945321.884603165, 140242367.24729633, 48945312.77580214, 140242325.5204306, 48945317.557922676, 140242329.49441782, 48945317.10248263, 1, 5, 140241987.73151758, 48945356.270327054, 42 },
-  { 140242330.80127227, 48945346.07099973, 140242291.09612048, 48945350.91877453, 140242370.50642407, 48945341.22322492, 140242328.81601468, 48945346.31338847, 140242332.78652987, 48945345.82861099, 0, 0, 0, 0, 0 },
-  { 140242334.30783126, 48945374.79107488, 140242294.63697362, 48945379.91191995, 140242373.9786889, 48945369.67022981, 140242332.32428837, 48945375.04711714, 140242336.29137415, 48945374.53503262, 1, 2, 140242204.3857725, 48945391.56184248, 25 },
-  { 140242338.01269, 48945403.49237751, 140242298.37528253, 48945408.866010174, 140242377.6500975, 48945398.11874485, 140242336.03081962, 48945403.76105914, 140242339.9945604, 48945403.22369588, 0, 0, 0, 0, 0 },
-  { 140242341.90143716, 48945432.176856965, 140242302.29625016, 48945437.78302879, 140242381.50662416, 48945426.57068514, 140242339.9211778, 48945432.457165554, 140242343.88169652, 48945431.896548375, 1, 4, 140242208.23393103, 48945451.09768687, 34 },
-  { 140242345.95966154, 48945460.84646263, 140242306.38511178, 48945466.66496858, 140242385.5342113, 48945455.02795668, 140242343.98093405, 48945461.137387924, 140242347.93838903, 48945460.555537336, 0, 0, 0, 0, 0 },
-  { 140242350.17295194, 48945489.503143884, 140242310.62713465, 48945495.51382897, 140242389.71876922, 48945483.4924588, 140242348.19566107, 48945489.80367814, 140242352.1502428, 48945489.20260963, 0, 0, 0, 0, 0 },
-  { 140242354.52689707, 48945518.14885006, 140242315.0076178, 48945524.33161367, 140242394.04617634, 48945511.966086455, 140242352.55093312, 48945518.45798824, 140242356.50286102, 48945517.83971188, 0, 0, 0, 0, 0 },
-  { 140242359.0070857, 48945546.78553056, 140242319.51189187, 48945553.12032846, 140242398.50227955, 48945540.450732656, 140242357.032326, 48945547.102270454, 140242360.9818454, 48945546.468790665, 1, 4, 140242191.15251195, 48945573.708421655, 28 },
-  { 140242363.59910664, 48945575.41513475, 140242324.12531883, 48945581.8819791, 140242403.07289445, 48945568.9482904, 140242361.62541726, 48945575.73847697, 140242365.57279602, 48945575.09179253, 0, 0, 0, 0, 0 },
-  { 140242368.28854865, 48945604.03961198, 140242328.83329147, 48945610.6185694, 140242407.74380583, 48945597.460654564, 140242366.3157858, 48945604.36855985, 140242370.2613115, 48945603.71066411, 0, 0, 0, 0, 0 },
-  { 140242373.0610004, 48945632.66091163, 140242333.62123317, 48945639.332100436, 140242412.50076765, 48945625.98972282, 140242371.08901206, 48945632.994471066, 140242375.03298876, 48945632.32735219, 1, 5, 140242667.87326053, 48945582.7937753, 26 },
-  { 140242377.9020508, 48945661.2809831, 140242338.4745977, 48945668.02456833, 140242417.3295039, 48945654.53739787, 140242375.93067813, 48945661.61816236, 140242379.87342346, 48945660.94380384, 0, 0, 0, 0, 0 },
-  { 140242382.79728848, 48945689.90177569, 140242343.3788686, 48945696.69796405, 140242422.21570835, 48945683.105587326, 140242380.8263675, 48945690.241585106, 140242384.76820946, 48945689.56196627, 0, 0, 0, 0, 0 },
-  { 140242387.7323023, 48945718.52523884, 140242348.3195594, 48945725.35427208, 140242427.14504522, 48945711.6962056, 140242385.76166517, 48945718.8666905, 140242389.70293945, 48945718.18378718, 0, 0, 0, 0, 0 },
-  { 140242392.692681, 48945747.15332189, 140242353.28221276, 48945753.99547004, 140242432.10314927, 48945740.311173744, 140242390.7221576, 48945747.4954293, 140242394.66320443, 48945746.811214484, 1, 2, 140242517.82091776, 48945725.42950153, 39 },
-  { 140242397.6640133, 48945775.78797419, 140242358.25240085, 48945782.62352857, 140242437.07562575, 48945768.95241982, 140242395.69343266, 48945776.12975191, 140242399.63459393, 48945775.446196474, 0, 0, 0, 0, 0 },
-  { 140242402.631888, 48945804.43114515, 140242363.21572503, 48945811.24041073, 140242442.04805097, 48945797.62187956, 140242400.66107985, 48945804.77160843, 140242404.60269615, 48945804.090681866, 0, 0, 0, 0, 0 },
-  { 140242407.58189386, 48945833.08478411, 140242368.1578158, 48945839.8480725, 140242447.0059719, 48945826.32149573, 140242405.61068997, 48945833.42294853, 140242409.55309775, 48945832.746619694, 0, 0, 0, 0, 0 },
-  { 140242412.49961966, 48945861.750840455, 140242373.06433272, 48945868.448462784, 140242451.9349066, 48945855.05321813, 140242410.5278553, 48945862.085721575, 140242414.47138402, 48945861.415959336, 1, 5, 140242552.49488825, 48945837.974281184, 29 },
-  { 140242417.37065414, 48945890.43126354, 140242377.92112082, 48945897.044456564, 140242456.82018745, 48945883.81807052, 140242415.39817747, 48945890.761923194, 140242419.3431308, 48945890.10060389, 1, 2, 140242248.72389925, 48945918.70266372, 39 },
-  { 140242422.1812515, 48945919.12781302, 140242382.72203106, 48945925.682957776, 140242461.64047194, 48945912.57266826, 140242420.2082905, 48945919.45557026, 140242424.1542125, 48945918.80005578, 1, 2, 140242746.73333958, 48945865.211747415, 36 },
-  { 140242426.94989726, 48945947.833059266, 140242387.49613073, 48945954.42095026, 140242466.40366378, 48945941.245168276, 140242424.97720894, 48945948.162453815, 140242428.92258558, 48945947.50366472, 1, 0, 140242242.5035388, 48945978.63144965, 30 },
-  { 140242431.74105027, 48945976.52646549, 140242392.30896384, 48945983.242905006, 140242471.1731367, 48945969.810025975, 140242429.76944596, 48945976.86228747, 140242433.7126546, 48945976.19064351, 1, 2, 140242608.19963706, 48945946.47039865, 50 },
-  { 140242436.62269214, 48946005.18649041, 140242397.22950187, 48946012.12742405, 140242476.0158824, 48945998.24555677, 140242434.65303263, 48946005.53353709, 140242438.59235165, 48946004.83944373, 0, 0, 0, 0, 0 },
-  { 140242441.6628048, 48946033.79159282, 140242402.32745352, 48946041.05314489, 140242480.9981561, 48946026.530040756, 140242439.69603723, 48946034.154670425, 140242443.6295724, 48946033.42851522, 0, 0, 0, 0, 0 },
-  { 140242446.92937008, 48946062.32023144, 140242407.67326957, 48946069.99868009, 140242486.18547058, 48946054.64178278, 140242444.96656504, 48946062.70415387, 140242448.8921751, 48946061.936309, 0, 0, 0, 0, 0 },
-  { 140242452.4903697, 48946090.75086506, 140242413.33814564, 48946098.94252858, 140242491.64259377, 48946082.55920153, 140242450.5327585, 48946091.16044823, 140242454.4479809, 48946090.34128188, 0, 0, 0, 0, 0 },
-  { 140242458.4137855, 48946119.06195242, 140242419.39401752, 48946127.862958506, 140242497.43355346, 48946110.26094633, 140242456.46279708, 48946119.50200272, 140242460.3647739, 48946118.621902116, 0, 0, 0, 0, 0 },
-  { 140242464.76759928, 48946147.231952265, 140242425.9135429, 48946156.73786113, 140242503.62165567, 48946137.7260434, 140242462.82489645, 48946147.707247704, 140242466.7103021, 48946146.756656826, 0, 0, 0, 0, 0 },
-  { 140242471.6197929, 48946175.23932339, 140242432.96829954, 48946185.537967004, 140242510.27128628, 48946164.94067978, 140242469.68721825, 48946175.75425557, 140242473.55236757, 48946174.724391215, 0, 0, 0, 0, 0 },
-  { 140242479.03365877, 48946203.06405431, 140242440.60430607, 48946214.162921384, 140242517.46301147, 48946191.96518724, 140242477.11219114, 48946203.61899766, 140242480.9551264, 48946202.50911096, 0, 0, 0, 0, 0 },
-  { 140242487.01652598, 48946230.70439072, 140242448.81333002, 48946242.55832758, 140242525.21972194, 48946218.85045386, 140242485.1063662, 48946231.297087565, 140242488.92668578, 48946230.111693874, 0, 0, 0, 0, 0 },
-  { 140242495.53891623, 48946258.17058599, 140242457.5628695, 48946270.73322402, 140242533.51496297, 48946245.60794796, 140242493.6401139, 48946258.79871789, 140242497.43771857, 48946257.542454086, 0, 0, 0, 0, 0 },
-  { 140242504.57070553, 48946285.47310413, 140242466.8201915, 48946298.69803096, 140242542.32121956, 48946272.24817729, 140242502.68317983, 48946286.13435047, 140242506.45823124, 48946284.81185778, 0, 0, 0, 0, 0 },
-  { 140242514.08177, 48946312.62240916, 140242476.55275002, 48946326.46338667, 140242551.61078998, 48946298.781431645, 140242512.20531902, 48946313.314458035, 140242515.958221, 48946311.93036028, 0, 0, 0, 0, 0 },
-  { 140242524.0419857, 48946339.62896511, 140242486.72819445, 48946354.040106036, 140242561.35577694, 48946325.21782418, 140242522.17629611, 48946340.34952216, 140242525.90767527, 48946338.90840806, 0, 0, 0, 0, 0 },
-  { 140242534.42122865, 48946366.50323599, 140242497.3143729, 48946381.43914095, 140242571.5280844, 48946351.56733102, 140242532.56588587, 48946367.25003124, 140242536.27657142, 48946365.75644074, 1, 1, 140242667.07823792, 48946313.107375726, 31 },
-  { 140242545.18937486, 48946393.25568581, 140242508.2793313, 48946408.671544, 140242582.09941843, 48946377.83982763, 140242543.3438727, 48946394.02647872, 140242547.03487703, 48946392.484892905, 0, 0, 0, 0, 0 },
-  { 140242556.31630045, 48946419.8967786, 140242519.59130892, 48946435.7484346, 140242593.04129198, 48946404.04512259, 140242554.48005086, 48946420.6893614, 140242558.15255004, 48946419.104195796, 1, 3, 140242654.55565277, 48946377.49359878, 31 },
-  { 140242567.77188152, 48946446.4369784, 140242531.21873173, 48946462.680969276, 140242604.3250313, 48946430.192987524, 140242565.94422403, 48946447.24917794, 140242569.599539, 48946445.62477886, 0, 0, 0, 0, 0 },
-  { 140242579.52599403, 48946472.88674919, 140242543.13020366, 48946489.48031549, 140242615.9217844, 48946456.293182895, 140242577.7062045, 48946473.716427505, 140242581.34578356, 48946472.05707088, 0, 0, 0, 0, 0 },
-  { 140242591.54851413, 48946499.25655502, 140242555.2944975, 48946516.15762831, 140242627.80253077, 48946482.35548173, 140242589.7358133, 48946500.101608686, 140242593.36121497, 48946498.411501355, 0, 0, 0, 0, 0 },
-  { 140242603.8093178, 48946525.55685989, 140242567.68054494, 48946542.72403122, 140242639.93809065, 48946508.38968856, 140242602.00287914, 48946526.41521846, 140242605.61575645, 48946524.69850132, 1, 5, 140242813.3562004, 48946425.98726619, 50 },
-  { 140242616.2782811, 48946551.79812784, 140242580.25742704, 48946569.190599546, 140242652.29913515, 48946534.40565613, 140242614.4772384, 48946552.667751424, 140242618.0793238, 48946550.92850425, 1, 0, 140242370.43595207, 48946670.501747265, 45 },
-  { 140242628.92528015, 48946577.99082288, 140242592.99436498, 48946595.568346426, 140242664.85619533, 48946560.41329934, 140242627.12873438, 48946578.86969906, 140242630.72182593, 48946577.1119467, 1, 5, 140242751.09039178, 48946518.227242835, 30 },
-  { 140242641.7201909, 48946604.145409, 140242605.8607119, 48946621.86821251, 140242677.57966992, 48946586.42260549, 140242639.92721695, 48946605.03154918, 140242643.51316488, 48946603.25926883, 1, 0, 140242440.0106214, 48946703.83617874, 34 },
-  { 140242654.63288957, 48946630.27235028, 140242618.82594565, 48946648.10105656, 140242690.4398335, 48946612.443644, 140242652.84254238, 48946631.1637856, 140242656.42323676, 48946629.380914964, 1, 5, 140243011.8071551, 48946452.43100513, 37 },
-  { 140242667.63325202, 48946656.382110685, 140242631.85966286, 48946674.27764976, 140242703.4068412, 48946638.48657161, 140242665.84457257, 48946657.27688764, 140242669.42193148, 48946655.48733373, 0, 0, 0, 0, 0 },
-  { 140242680.69115445, 48946682.48515428, 140242644.93157443, 48946700.40867061, 140242716.45073447, 48946664.561637945, 140242678.90317544, 48946683.381330095, 140242682.47913346, 48946681.58897846, 0, 0, 0, 0, 0 },
-  { 140242693.77647287, 48946708.591945045, 140242658.01150236, 48946726.504702635, 140242729.54144338, 48946690.679187454, 140242691.98822433, 48946709.48758292, 140242695.5647214, 48946707.69630717, 0, 0, 0, 0, 0 },
-  { 140242706.8590833, 48946734.712947, 140242671.06937817, 48946752.576233596, 140242742.64878842, 48946716.84966041, 140242705.06959805, 48946735.60611133, 140242708.64856854, 48946733.819782674, 0, 0, 0, 0, 0 },
-  { 140242719.90886182, 48946760.858624205, 140242684.0752431, 48946778.63365636, 140242755.74248055, 48946743.08359205, 140242718.11718088, 48946761.747375816, 140242721.70054275, 48946759.969872594, 0, 0, 0, 0, 0 },
-  { 140242732.89568454, 48946787.03944065, 140242696.99924907, 48946804.68727112, 140242768.79212, 48946769.391610175, 140242731.10086277, 48946787.921832174, 140242734.6905063, 48946786.15704912, 0, 0, 0, 0, 0 },
-  { 140242745.7894274, 48946813.265860334, 140242709.81166208, 48946830.74729058, 140242781.76719272, 48946795.78443009, 140242743.99053913, 48946814.13993185, 140242747.58831567, 48946812.39178882, 1, 5, 140242636.0572432, 48946866.58422259, 48 },
-  { 140242758.55996662, 48946839.548347324, 140242722.48286617, 48946856.82384506, 140242794.63706708, 48946822.27284959, 140242756.7561116, 48946840.41212221, 140242760.36382166, 48946838.684572436, 1, 3, 140243010.19774237, 48946719.05175064, 46 },
-  { 140242771.17717808, 48946865.8973656, 140242734.98336878, 48946882.92699179, 140242807.3709874, 48946848.86773941, 140242769.3674876, 48946866.74884691, 140242772.98686856, 48946865.04588429, 1, 0, 140242561.25308412, 48946964.669197515, 49 },
-  { 140242783.61093795, 48946892.32337921, 140242747.28380767, 48946909.06672433, 140242819.93806824, 48946875.58003409, 140242781.79458144, 48946893.16054647, 140242785.42729446, 48946891.486211956, 1, 2, 140243061.51348457, 48946764.236789055, 37 },
-  { 140242795.83112228, 48946918.83685217, 140242759.3586995, 48946935.26129666, 140242832.30354506, 48946902.41240768, 140242794.00750116, 48946919.658074394, 140242797.6547434, 48946918.01562995, 0, 0, 0, 0, 0 },
-  { 140242807.81386763, 48946945.44595634, 140242771.20008722, 48946961.55282084, 140242844.42764804, 48946929.339091845, 140242805.98317862, 48946946.25129957, 140242809.64455664, 48946944.64061312, 1, 2, 140243074.17912012, 48946828.268517114, 38 },
-  { 140242819.56106493, 48946972.14943438, 140242782.8136347, 48946987.949003085, 140242856.30849516, 48946956.349865675, 140242817.72369343, 48946972.93941282, 140242821.39843643, 48946971.35945594, 0, 0, 0, 0, 0 },
-  { 140242831.0812265, 48946998.94360461, 140242794.2075975, 48947014.446361944, 140242867.9548555, 48946983.44084728, 140242829.23754504, 48946999.718742475, 140242832.92490795, 48946998.16846675, 1, 3, 140243182.30254266, 48946851.27984099, 32 },
-  { 140242842.38286492, 48947025.824785374, 140242805.39023438, 48947041.04139753, 140242879.37549546, 48947010.60817322, 140242840.5332334, 48947026.585615985, 140242844.23249644, 48947025.06395476, 0, 0, 0, 0, 0 },
-  { 140242853.47449258, 48947052.78929495, 140242816.36980817, 48947067.73059328, 140242890.579177, 48947037.84799662, 140242851.61925837, 48947053.53635987, 140242855.3297268, 48947052.04223003, 0, 0, 0, 0, 0 },
-  { 140242864.36462197, 48947079.8334517, 140242827.15458706, 48947094.51041671, 140242901.57465687, 48947065.1564867, 140242862.50412023, 48947080.567299955, 140242866.2251237, 48947079.09960345, 0, 0, 0, 0, 0 },
-  { 140242875.06176552, 48947106.95357394, 140242837.75284523, 48947121.37732058, 140242912.37068582, 48947092.529827304, 140242873.19631952, 48947107.67476127, 140242876.92721152, 48947106.23238661, 0, 0, 0, 0, 0 },
-  { 140242885.57443574, 48947134.145979986, 140242848.1728638, 48947148.32774356, 140242922.97600767, 48947119.96421641, 140242883.70435715, 48947134.85506816, 140242887.44451433, 48947133.43689181, 1, 4, 140242571.40123165, 48947253.27279403, 40 },
-  { 140242895.91114494, 48947161.406988144, 140242858.4229316, 48947175.35811214, 140242933.39935827, 48947147.45586415, 140242894.03673428, 48947162.10454434, 140242897.7855556, 48947160.70943195, 1, 1, 140243212.68654764, 48947043.51999039, 37 },
-  { 140242906.08040574, 48947188.73291676, 140242868.51134568, 48947202.464840405, 140242943.6494658, 48947175.00099311, 140242904.20195273, 48947189.41951294, 140242907.95885876, 48947188.04632057, 1, 3, 140242753.92571256, 48947244.34720752, 33 },
-  { 140242916.0907305, 48947216.12008415, 140242878.446412, 48947229.64433221, 140242953.73504898, 48947202.595836096, 140242914.20851457, 48947216.79629655, 140242917.9729464, 48947215.44387175, 0, 0, 0, 0, 0 },
-  { 140242925.9506317, 48947243.56480864, 140242888.2364458, 48947256.89298117, 140242963.6648176, 48947230.2366361, 140242924.06492242, 48947244.231217265, 140242927.836341, 48947242.89840001, 1, 1, 140242712.86548147, 48947318.868983455, 33 },
-  { 140242935.66862178, 48947271.06340854, 140242897.88977224, 48947284.20717236, 140242973.44747132, 48947257.91964472, 140242933.7796793, 48947271.72059673, 140242937.55756426, 48947270.40622035, 0, 0, 0, 0, 0 },
-  { 140242945.2532132, 48947298.612202175, 140242907.41472653, 48947311.58328258, 140242983.09169987, 48947285.64112177, 140242943.36128888, 48947299.260756195, 140242947.14513752, 48947297.963648155, 0, 0, 0, 0, 0 },
-  { 140242954.7129184, 48947326.20750788, 140242916.81965452, 48947339.01768167, 140242992.60618228, 48947313.397334084, 140242952.81825522, 48947326.84801657, 140242956.6075816, 48947325.56699919, 1, 2, 140243140.3899114, 48947263.43765629, 39 },
-  { 140242964.05624992, 48947353.84564397, 140242926.1129128, 48947366.506732725, 140243001.99958703, 48947341.18455521, 140242962.15908307, 48947354.4786984, 140242965.95341676, 48947353.21258953, 0, 0, 0, 0, 0 },
-  { 140242973.29172012, 48947381.52292877, 140242935.30286893, 48947394.04679344, 140243011.2805713, 48947368.999064095, 140242971.39227757, 48947382.149122, 140242975.19116268, 48947380.896735534, 1, 1, 140243143.29182914, 48947325.47863435, 41 },
-  { 140242982.42784145, 48947409.235680595, 140242944.39790183, 48947421.63421648, 140243020.45778108, 48947396.83714471, 140242980.52634448, 48947409.85560739, 140242984.32933843, 48947408.6157538, 1, 4, 140242793.22889182, 48947470.91839661, 41 },
-  { 140242991.47312638, 48947436.98021777, 140242953.40640175, 48947449.265350126, 140243029.539851, 48947424.695085414, 140242989.56979015, 48947437.59447439, 140242993.3764626, 48947436.36596115, 1, 3, 140243307.4269407, 48947335.01361923, 38 },
-  { 140243000.4360874, 48947464.75285863, 140242962.33677065, 48947476.936538875, 140243038.53540415, 48947452.56917839, 140242998.53112155, 48947465.36204264, 140243002.34105325, 48947464.14367462, 1, 2, 140242831.84661084, 48947518.6656437, 41 },
-  { 140243009.32523698, 48947492.54992147, 140242971.19742206, 48947504.64412378, 140243047.4530519, 48947480.45571916, 140243007.41884622, 48947493.154631585, 140243011.23162773, 48947491.94521135, 0, 0, 0, 0, 0 },
-  { 140243018.1490875, 48947520.367724635, 140242979.99678126, 48947532.384443395, 140243056.30139372, 48947508.351005875, 140243016.24147218, 48947520.96856058, 140243020.0567028, 48947519.76688869, 1, 3, 140242902.73836115, 48947556.71829889, 35 },
-  { 140243026.91615137, 48947548.202586435, 140242988.7432856, 48947560.15383399, 140243065.08901715, 48947536.25133888, 140243025.0075081, 48947548.800148815, 140243028.82479465, 48947547.605024055, 1, 1, 140243192.9681175, 48947496.214659564, 42 },
-  { 140243035.63494125, 48947576.050825216, 140242997.44538432, 48947587.948629275, 140243073.82449818, 48947564.15302116, 140243033.7254634, 48947576.645715415, 140243037.5444191, 48947575.455935016, 1, 0, 140242670.92467254, 48947689.67485395, 47 },
-  { 140243044.31396943, 48947603.90875928, 140243006.1115386, 48947615.76516169, 140243082.51640028, 48947592.05235687, 140243042.4038479, 48947604.501579404, 140243046.22409096, 48947603.31593916, 1, 2, 140243245.8317921, 48947541.36623656, 39 },
-  { 140243052.96174836, 48947631.772706956, 140243014.7502218, 48947643.59976224, 140243091.17327493, 48947619.94565167, 140243051.05117202, 48947632.36405972, 140243054.8723247, 48947631.181354195, 0, 0, 0, 0, 0 },
-  { 140243061.58679056, 48947659.63898655, 140243023.36991936, 48947671.44876032, 140243099.80366176, 48947647.82921278, 140243059.675947, 48947660.22947524, 140243063.4976341, 48947659.04849786, 0, 0, 0, 0, 0 },
-  { 140243070.19760844, 48947687.503916405, 140243031.97912896, 48947699.30848446, 140243108.41608793, 48947675.69934835, 140243068.28668445, 48947688.094144806, 140243072.10853243, 48947686.913688004, 0, 0, 0, 0, 0 },
-  { 140243078.80271444, 48947715.36381482, 140243040.58636045, 48947727.175262176, 140243117.01906842, 48947703.55236747, 140243076.89189672, 48947715.95438719, 140243080.71353215, 48947714.77324246, 0, 0, 0, 0, 0 },
-  { 140243087.41062114, 48947743.215000175, 140243049.20013598, 48947755.04541956, 140243125.6211063, 48947731.38458079, 140243085.5000969, 48947743.80652115, 140243089.3211454, 48947742.6234792, 1, 1, 140242903.04503018, 48947800.29677371, 42 },
-  { 140243096.02984086, 48947771.05379072, 140243057.82898974, 48947782.91528197, 140243134.23069197, 48947759.19229947, 140243094.1197983, 48947771.64686528, 140243097.9398834, 48947770.46071616, 0, 0, 0, 0, 0 },
-  { 140243104.66888607, 48947798.876504816, 140243066.48146847, 48947810.78117358, 140243142.85630366, 48947786.97183605, 140243102.7595152, 48947799.47173826, 140243106.57825693, 48947798.281271376, 0, 0, 0, 0, 0 },
-  { 140243113.33626926, 48947826.67946079, 140243075.16613114, 48947838.639417104, 140243151.50640738, 48947814.71950447, 140243111.42776236, 48947827.2774586, 140243115.24477616, 48947826.08146297, 1, 1, 140243275.5593563, 48947775.84964645, 46 },
-  { 140243122.04050288, 48947854.458976924, 140243083.89154893, 48947866.48633374, 140243160.18945682, 48947842.431620106, 140243120.13305518, 48947855.06034476, 140243123.94795057, 48947853.857609086, 0, 0, 0, 0, 0 },
-  { 140243130.79009935, 48947882.211371586, 140243092.66630542, 48947894.31824308, 140243168.91389328, 48947870.10450009, 140243128.88390964, 48947882.81671516, 140243132.69628906, 48947881.60602801, 0, 0, 0, 0, 0 },
-  { 140243139.5935712, 48947909.93296309, 140243101.49899656, 48947922.13146232, 140243177.68814582, 48947897.734463856, 140243137.68884245, 48947910.54288805, 140243141.49829993, 48947909.32303812, 1, 1, 140242824.3609661, 48948010.87554421, 33 },
-  { 140243148.45943075, 48947937.62006973, 140243110.3982304, 48947949.92230643, 140243186.5206311, 48947925.31783302, 140243146.55637074, 48947938.23518156, 140243150.36249077, 48947937.00495789, 1, 2, 140243271.2068019, 48947897.94535634, 37 },
-  { 140243157.39619058, 48947965.269009866, 140243119.37262747, 48947977.687087305, 140243195.4197537, 48947952.85093243, 140243155.49501243, 48947965.88991374, 140243159.29736874, 48947964.648105994, 0, 0, 0, 0, 0 },
-  { 140243166.4123631, 48947992.87610178, 140243128.4308203, 48948005.42211323, 140243204.39390594, 48947980.33009032, 140243164.51328596, 48947993.50340235, 140243168.31144026, 48947992.2488012, 0, 0, 0, 0, 0 },
-  { 140243175.51646072, 48948020.43766382, 140243137.5814536, 48948033.123689026, 140243213.45146784, 48948007.75163862, 140243173.61971036, 48948021.07196508, 140243177.41321108, 48948019.80336256, 0, 0, 0, 0, 0 },
-  { 140243184.716996, 48948047.95001434, 140243146.83318424, 48948060.78811414, 140243222.6008078, 48948035.11191454, 140243182.82280543, 48948048.591919325, 140243186.6111866, 48948047.30810935, 0, 0, 0, 0, 0 },
-  { 140243194.0224813, 48948075.409471594, 140243156.19468084, 48948088.41168341, 140243231.85028175, 48948062.40725978, 140243192.13109127, 48948076.05958218, 140243195.91387132, 48948074.75936101, 0, 0, 0, 0, 0 },
-  { 140243203.44142917, 48948102.81235395, 140243165.67462373, 48948115.99068494, 140243241.2082346, 48948089.634022966, 140243201.5530889, 48948103.4712705, 140243205.32976943, 48948102.153437406, 0, 0, 0, 0, 0 },
-  { 140243212.9823519, 48948130.15497972, 140243175.28170484, 48948143.521400765, 140243250.68299896, 48948116.78855868, 140243211.09731954, 48948130.82330077, 140243214.86738425, 48948129.48665867, 1, 1, 140243054.63963425, 48948186.2939481, 48 },
-  { 140243222.6537621, 48948157.43366722, 140243185.0246274, 48948171.00010447, 140243260.28289682, 48948143.86722997, 140243220.77230537, 48948158.11198908, 140243224.53521883, 48948156.75534536, 1, 1, 140243526.50902504, 48948047.88468644, 35 },
-  { 140243232.46417212, 48948184.64473478, 140243194.9121055, 48948198.42306166, 140243270.01623875, 48948170.86640789, 140243230.5865688, 48948185.33365112, 140243234.34177545, 48948183.95581844, 0, 0, 0, 0, 0 },
-  { 140243242.42209455, 48948211.78450071, 140243204.95286396, 48948225.78652769, 140243279.89132515, 48948197.78247373, 140243240.54863304, 48948212.48460206, 140243244.29555607, 48948211.084399365, 1, 0, 140243430.70497823, 48948141.42431514, 27 },
-  { 140243252.53604168, 48948238.84928336, 140243215.15563774, 48948253.0867481, 140243289.9164456, 48948224.61181862, 140243250.66702148, 48948239.5611566, 140243254.40506187, 48948238.13741012, 1, 5, 140242905.83279526, 48948370.901768856, 31 },
-  { 140243262.81452608, 48948265.83540102, 140243225.52917153, 48948280.319956094, 140243300.09988064, 48948251.35084595, 140243260.95025834, 48948266.55962878, 140243264.67879382, 48948265.111173265, 0, 0, 0, 0, 0 },
-  { 140243273.26606014, 48948292.73917205, 140243236.08221906, 48948307.48237261, 140243310.44990122, 48948277.995971486, 140243271.4068681, 48948293.476332076, 140243275.1252522, 48948292.00201202, 0, 0, 0, 0, 0 },
-  { 140243283.89915633, 48948319.556914724, 140243246.82354262, 48948334.57020447, 140243320.97477004, 48948304.54362498, 140243282.04537565, 48948320.30757921, 140243285.75293702, 48948318.80625024, 0, 0, 0, 0, 0 },
-  { 140243294.7223271, 48948346.2849474, 140243257.76191223, 48948361.57964361, 140243331.682742, 48948330.9902512, 140243292.87430638, 48948347.049682215, 140243296.57034785, 48948345.52021259, 0, 0, 0, 0, 0 },
-  { 140243305.74408495, 48948372.919588394, 140243268.9061047, 48948388.50686563, 140243342.5820652, 48948357.33231116, 140243303.90218595, 48948373.69895226, 140243307.58598396, 48948372.14022453, 0, 0, 0, 0, 0 },
-  { 140243316.97294226, 48948399.45715602, 140243280.26490286, 48948415.34802894, 140243353.68098167, 48948383.56628309, 140243315.13754028, 48948400.25169966, 140243318.80834424, 48948398.66261237, 0, 0, 0, 0, 0 },
-  { 140243328.41741154, 48948425.8939686, 140243291.8470943, 48948442.09927321, 140243364.98772877, 48948409.68866398, 140243326.58889568, 48948426.704233825, 140243330.2459274, 48948425.08370337, 0, 0, 0, 0, 0 },
-  { 140243340.0860052, 48948452.22634447, 140243303.66147044, 48948468.756718546, 140243376.51053998, 48948435.6959704, 140243338.26477847, 48948453.05286318, 140243341.90723196, 48948451.39982577, 0, 0, 0, 0, 0 },
-  { 140243351.98723575, 48948478.45060194, 140243315.71682504, 48948495.31646408, 140243388.25764647, 48948461.584739804, 140243350.1737152, 48948479.29389505, 140243353.8007563, 48948477.607308835, 0, 0, 0, 0, 0 },
-  { 140243364.12961566, 48948504.563059345, 140243328.02195272, 48948521.7745868, 140243400.2372786, 48948487.35153189, 140243362.32423252, 48948505.423635714, 140243365.9349988, 48948503.702482976, 1, 1, 140243166.44016108, 48948598.79617213, 48 },
-  { 140243376.52165723, 48948530.56003499, 140243340.58564773, 48948548.12714125, 140243412.45766672, 48948512.99292873, 140243374.72485676, 48948531.43839031, 140243378.3184577, 48948529.68167967, 1, 0, 140243668.5017343, 48948387.82729661, 45 },
-  { 140243389.1718731, 48948556.43784722, 140243353.41670206, 48948574.37015731, 140243424.92704412, 48948538.50553713, 140243387.38411453, 48948557.334462725, 140243390.95963165, 48948555.541231714, 1, 4, 140243117.43257332, 48948692.7234039, 40 },
-  { 140243402.08877555, 48948582.19281431, 140243366.5239037, 48948600.49964063, 140243437.6536474, 48948563.885988, 140243400.31053194, 48948583.10815563, 140243403.86701915, 48948581.277472995, 1, 3, 140243685.71862862, 48948436.19587446, 29 },
-  { 140243415.28087723, 48948607.821254656, 140243379.91603473, 48948626.51157073, 140243450.64571974, 48948589.13093858, 140243413.5126351, 48948608.75577046, 140243417.04911935, 48948606.88673885, 0, 0, 0, 0, 0 },
-  { 140243428.75669047, 48948633.31948652, 140243393.60186931, 48948652.401901186, 140243463.91151163, 48948614.23707186, 140243426.9989494, 48948634.273607254, 140243430.51443154, 48948632.36536579, 0, 0, 0, 0, 0 },
-  { 140243442.5247277, 48948658.68382824, 140243407.59017166, 48948678.166558936, 140243477.45928374, 48948639.20109755, 140243440.7779999, 48948659.65796477, 140243444.2714555, 48948657.70969171, 0, 0, 0, 0, 0 },
-  { 140243456.59350145, 48948683.91059816, 140243421.88969386, 48948703.80144375, 140243491.29730904, 48948664.01975257, 140243454.85831106, 48948684.90514044, 140243458.32869184, 48948682.91605588, 0, 0, 0, 0, 0 },
-  { 140243470.97152415, 48948708.996114574, 140243436.5091733, 48948729.30242825, 140243505.433875, 48948688.689800896, 140243469.24840662, 48948710.011430256, 140243472.69464168, 48948707.98079889, 1, 4, 140243369.3075892, 48948768.89973992, 49 },
-  { 140243485.6673082, 48948733.93669582, 140243451.45842052, 48948754.66715656, 140243519.8761959, 48948713.20623508, 140243483.95686382, 48948734.97321886, 140243487.3777526, 48948732.900172785, 0, 0, 0, 0, 0 },
-  { 140243500.69036508, 48948758.72736843, 140243466.7744429, 48948779.933740675, 140243534.60628724, 48948737.52099618, 140243498.99456897, 48948759.78768704, 140243502.38616118, 48948757.66704982, 1, 0, 140243218.34031308, 48948935.27041739, 39 },
-  { 140243516.0745388, 48948783.33169171, 140243482.5225454, 48948805.10928891, 140243549.6265322, 48948761.554094516, 140243514.39693913, 48948784.42057157, 140243517.75213847, 48948782.24281185, 1, 3, 140243784.49048588, 48948609.11091412, 29 },
-  { 140243531.87878555, 48948807.68074995, 140243498.76877525, 48948830.124618135, 140243564.98879585, 48948785.23688177, 140243530.22328505, 48948808.802943364, 140243533.53428605, 48948806.55855654, 0, 0, 0, 0, 0 },
-  { 140243548.1632162, 48948831.70413407, 140243515.58004835, 48948854.90622822, 140243580.74638405, 48948808.50203992, 140243546.53405783, 48948832.864238776, 140243549.79237458, 48948830.54402936, 0, 0, 0, 0, 0 },
-  { 140243564.98794186, 48948855.331434965, 140243533.02409762, 48948879.379567154, 140243596.9517861, 48948831.28330278, 140243563.38974965, 48948856.53384157, 140243566.58613408, 48948854.12902836, 1, 4, 140243380.3967414, 48948994.20939834, 45 },
-  { 140243582.41307327, 48948878.49224354, 140243551.1692437, 48948903.46869472, 140243613.65690285, 48948853.51579237, 140243580.8508818, 48948879.741066106, 140243583.97526476, 48948877.24342098, 0, 0, 0, 0, 0 },
-  { 140243600.49872157, 48948901.11615073, 140243570.05476946, 48948927.06158925, 140243630.94267368, 48948875.17071221, 140243598.97652397, 48948902.41342266, 140243602.02091917, 48948899.8188788, 0, 0, 0, 0, 0 },
-  { 140243619.2808743, 48948923.15482077, 140243589.5978926, 48948949.96751546, 140243648.963856, 48948896.34212608, 140243617.7967252, 48948924.4954555, 140243620.7650234, 48948921.81418604, 1, 3, 140243696.45662677, 48948853.441814564, 45 },
-  { 140243638.69731206, 48948944.64977952, 140243609.69641128, 48948972.19878592, 140243667.69821283, 48948917.10077312, 140243637.247267, 48948946.02722984, 140243640.1473571, 48948943.272329204, 0, 0, 0, 0, 0 },
-  { 140243658.6608277, 48948965.66541718, 140243630.25456727, 48948993.82717082, 140243687.06708813, 48948937.50366354, 140243657.24051467, 48948967.073504865, 140243660.08114073, 48948964.257329494, 0, 0, 0, 0, 0 },
-  { 140243679.08421397, 48948986.26612397, 140243651.17856985, 48949014.92402038, 140243706.9898581, 48948957.608227566, 140243677.68893176, 48948987.69901879, 140243680.47949618, 48948984.833229154, 0, 0, 0, 0, 0 },
-  { 140243699.88026372, 48949006.5162901, 140243672.37624127, 48949035.5598565, 140243727.38428617, 48948977.4727237, 140243698.50506258, 48949007.96846842, 140243701.25546485, 48949005.06411178, 1, 4, 140243807.83355182, 48948892.52029199, 28 },
-  { 140243720.96176976, 48949026.4803058, 140243693.75743836, 48949055.80477261, 140243748.16610116, 48948997.15583899, 140243719.6015532, 48949027.94652914, 140243722.32198632, 48949025.014082454, 0, 0, 0, 0, 0 },
-  { 140243742.2421387, 48949046.22212115, 140243715.27231166, 48949075.762405984, 140243769.21196577, 48949016.681836314, 140243740.89364737, 48949047.69913539, 140243743.59063005, 48949044.745106906, 1, 4, 140243883.15948513, 48948891.874132894, 33 },
-  { 140243763.66693375, 48949065.78263047, 140243736.92338893, 48949095.52792945, 140243790.41047856, 48949036.0373315, 140243762.3297565, 48949067.26989542, 140243765.004111, 48949064.29536553, 0, 0, 0, 0, 0 },
-  { 140243785.22904456, 48949085.16879556, 140243758.70801157, 48949115.11265652, 140243811.75007755, 48949055.22493461, 140243783.9029929, 48949086.66598861, 140243786.5550962, 48949083.67160252, 1, 3, 140244015.96203163, 48948824.65720526, 38 },
-  { 140243806.92515162, 48949104.38486032, 140243780.6227009, 48949134.52090331, 140243833.22760233, 48949074.24881733, 140243805.61002907, 48949105.89166247, 140243808.24027416, 48949102.87805817, 0, 0, 0, 0, 0 },
-  { 140243828.75193515, 48949123.43506868, 140243802.66398558, 48949153.75698957, 140243854.83988473, 48949093.113147795, 140243827.44753766, 48949124.95116473, 140243830.05633265, 48949121.918972634, 0, 0, 0, 0, 0 },
-  { 140243850.70607564, 48949142.32366457, 140243824.82840106, 48949172.82523762, 140243876.58375022, 48949111.82209152, 140243849.4121919, 48949143.84874322, 140243851.99995938, 48949140.798585914, 1, 3, 140243767.897517, 48949239.92869832, 29 },
-  { 140243872.78425342, 48949161.05489194, 140243847.1124899, 48949191.72997235, 140243898.45601693, 48949130.379811525, 140243871.50066525, 48949162.58864596, 140243874.0678416, 48949159.521137916, 0, 0, 0, 0, 0 },
-  { 140243894.98314896, 48949179.63299472, 140243869.51280123, 48949210.47552034, 140243920.4534967, 48949148.790469095, 140243893.70963156, 48949181.175121, 140243896.25666636, 48949178.090868436, 0, 0, 0, 0, 0 },
-  { 140243917.29944247, 48949198.06221684, 140243892.025891, 48949229.06621008, 140243942.57299393, 48949167.0582236, 140243916.0357649, 48949199.612416506, 140243918.56312004, 48949196.512017176, 0, 0, 0, 0, 0 },
-  { 140243939.7298145, 48949216.34680222, 140243914.64832154, 48949247.50637074, 140243964.81130746, 48949185.1872337, 140243938.47573984, 48949217.90478065, 140243940.98388916, 48949214.78882379, 1, 5, 140243856.33385035, 48949319.952367544, 44 },
-  { 140243962.27094522, 48949234.490994796, 140243937.3766615, 48949265.80033267, 140243987.16522893, 48949203.18165692, 140243961.02623102, 48949236.05646169, 140243963.51565942, 48949232.9255279, 1, 5, 140244158.31342947, 48948987.929959014, 34 },
-  { 140243984.91951513, 48949252.49903851, 140243960.20748588, 48949283.95242641, 140244009.63154438, 48949221.04565061, 140243983.68391368, 48949254.071707904, 140243986.1551166, 48949250.926369116, 0, 0, 0, 0, 0 },
-  { 140244007.67220458, 48949270.375177294, 140243983.1373756, 48949301.96698267, 140244032.20703357, 48949238.78337192, 140244006.44546312, 48949271.95476756, 140244008.89894605, 48949268.795587026, 1, 4, 140244106.42489123, 48949143.21816066, 44 },
-  { 140244030.52569407, 48949288.12365509, 140244006.1629173, 48949319.84833172, 140244054.88847086, 48949256.39897846, 140244029.30755523, 48949289.70988892, 140244031.74383292, 48949286.53742126, 1, 1, 140243847.80486816, 48949526.058729805, 40 },
-  { 140244053.47666377, 48949305.7487158, 140244029.28070316, 48949337.60080349, 140244077.67262438, 48949273.89662812, 140244052.26686573, 48949307.34132019, 140244054.6864618, 48949304.15611142, 0, 0, 0, 0, 0 },
-  { 140244076.5217941, 48949323.25460338, 140244052.48733097, 48949355.228727, 140244100.55625725, 48949291.28047976, 140244075.32007095, 48949324.85330956, 140244077.72351727, 48949321.6558972, 1, 0, 140243938.92449263, 48949506.30646112, 40 },
-  { 140244099.65776557, 48949340.64556176, 140244075.77940357, 48949372.736430064, 140244123.53612757, 48949308.55469346, 140244098.46384746, 48949342.25010518, 140244100.85168368, 48949339.041018344, 0, 0, 0, 0, 0 },
-  { 140244122.88125837, 48949357.92583486, 140244099.15352878, 48949390.128239244, 140244146.60898796, 48949325.72343047, 140244121.6948719, 48949359.53595508, 140244124.06764483, 48949356.315714635, 0, 0, 0, 0, 0 },
-  { 140244146.188953, 48949375.09966664, 140244122.6063193, 48949407.40847949, 140244169.77158672, 48949342.79085379, 140244145.00982133, 48949376.715107284, 140244147.3680847, 48949373.484225996, 1, 0, 140244294.16997948, 48949172.361866005, 39 },
-  { 140244169.57752982, 48949392.171301, 140244146.13439226, 48949424.58147381, 140244193.02066737, 48949359.76112819, 140244168.40537295, 48949393.79180964, 140244170.7496867, 48949390.55079236, 0, 0, 0, 0, 0 },
-  { 140244193.04366907, 48949409.144981876, 140244169.73436925, 48949441.6515434, 140244216.3529689, 48949376.63842035, 140244191.87820408, 48949410.770309955, 140244194.20913407, 48949407.5196538, 0, 0, 0, 0, 0 },
-  { 140244216.5840513, 48949426.02495323, 140244193.4028761, 48949458.62300711, 140244239.7652265, 48949393.42689935, 140244215.42499256, 48949427.65485592, 140244217.74311006, 48949424.39505054, 0, 0, 0, 0, 0 },
-  { 140244240.19535688, 48949442.815458976, 140244217.13654244, 48949475.500181355, 140244263.2541713, 48949410.1307366, 140244239.04241616, 48949444.449695095, 140244241.3482976, 48949441.181222856, 0, 0, 0, 0, 0 },
-  { 140244263.87426603, 48949459.52074304, 140244240.93200177, 48949492.2873802, 140244286.8165303, 48949426.75410588, 140244262.72715282, 48949461.1590749, 140244265.02137923, 48949457.88241118, 0, 0, 0, 0, 0 },
-  { 140244287.61745924, 48949476.145049356, 140244264.78589115, 48949508.98891481, 140244310.44902733, 48949443.3011839, 140244286.47588083, 48949477.78724263, 140244288.75903764, 48949474.50285608, 1, 2, 140244351.54584992, 48949384.18222608, 41 },
-  { 140244311.42161685, 48949492.69262188, 140244288.6948511, 48949525.609093726, 140244334.1483826, 48949459.77615003, 140244310.28527856, 48949494.33844547, 140244312.55795515, 48949491.04679829, 0, 0, 0, 0, 0 },
-  { 140244335.28341928, 48949509.16770452, 140244312.65552536, 48949542.152222365, 140244357.9113132, 48949476.18318668, 140244334.1520246, 48949510.81693041, 140244336.41481397, 48949507.51847863, 1, 2, 140244446.7257968, 48949346.71895415, 28 },
-  { 140244359.19954684, 48949525.5745412, 140244336.66456065, 48949558.622603126, 140244381.73453304, 48949492.52647928, 140244358.07279754, 48949527.2269443, 140244360.32629615, 48949523.92213811, 0, 0, 0, 0, 0 },
-  { 140244383.1666799, 48949541.917375885, 140244360.71860668, 48949575.02453538, 140244405.6147531, 48949508.81021639, 140244382.04427624, 48949543.57273386, 140244384.28908354, 48949540.26201791, 1, 3, 140244510.55949527, 48949354.03424576, 34 },
-  { 140244407.18149883, 48949558.20045246, 140244384.81431597, 48949591.362315066, 140244429.54868168, 48949525.03858986, 140244406.06313968, 48949559.858545594, 140244408.29985797, 48949556.54235933, 1, 1, 140244288.07625017, 48949734.78737084, 28 },
-  { 140244431.24068412, 48949574.42801492, 140244408.9483436, 48949607.64023487, 140244453.53302464, 48949541.215794966, 140244430.1260671, 48949576.088625915, 140244432.35530114, 48949572.76740392, 1, 4, 140244611.25133383, 48949306.23933882, 47 },
-  { 140244455.340916, 48949590.60430716, 140244433.1173471, 48949623.86258409, 140244477.56448492, 48949557.34603023, 140244454.22973755, 48949592.267221004, 140244456.45209447, 48949588.941393316, 0, 0, 0, 0, 0 },
-  { 140244479.47887492, 48949606.73357311, 140244457.31798634, 48949640.03364845, 140244501.6397635, 48949573.433497764, 140244478.3708305, 48949608.39857688, 140244480.58691934, 48949605.06856934, 1, 1, 140244639.59129483, 48949366.14052875, 26 },
-  { 140244503.6512412, 48949622.82005671, 140244481.54692364, 48949656.157710254, 140244525.7555588, 48949589.48240316, 140244502.54602534, 48949624.486939386, 140244504.7564571, 48949621.15317403, 0, 0, 0, 0, 0 },
-  { 140244527.85469535, 48949638.8680019, 140244505.8008232, 48949672.239048086, 140244549.9085675, 48949605.496955715, 140244526.75200173, 48949640.53655421, 140244528.95738897, 48949637.19944959, 1, 2, 140244728.5449318, 48949335.19148158, 28 },
-  { 140244552.08591756, 48949654.88165258, 140244530.07635134, 48949688.28193694, 140244574.09548378, 48949621.481368214, 140244550.98543924, 48949656.551666796, 140244553.18639588, 48949653.21163836, 1, 1, 140244462.39693528, 48949790.98781136, 49 },
-  { 140244576.34158826, 48949670.865252726, 140244554.37017652, 48949704.29064826, 140244598.313, 48949637.43985719, 140244575.24301767, 48949672.5365225, 140244577.44015884, 48949669.19398295, 0, 0, 0, 0, 0 },
-  { 140244600.6183879, 48949686.82304626, 140244578.67896894, 48949720.26944958, 140244622.55780688, 48949653.37664294, 140244599.52141696, 48949688.495366424, 140244601.71535885, 48949685.150726095, 1, 2, 140244515.60313937, 48949816.42785912, 32 },
-  { 140244624.91299683, 48949702.7592771, 140244602.99940056, 48949736.22260476, 140244646.8265931, 48949669.29594944, 140244623.817317, 48949704.432443485, 140244626.00867665, 48949701.08611071, 0, 0, 0, 0, 0 },
-  { 140244649.22209534, 48949718.678189166, 140244627.3281452, 48949752.154373944, 140244671.11604548, 48949685.20200439, 140244648.12739784, 48949720.3519984, 140244650.31679285, 48949717.00437993, 0, 0, 0, 0, 0 },
-  { 140244673.5423639, 48949734.58402643, 140244651.66187847, 48949768.06901346, 140244695.42284936, 48949701.099039406, 140244672.44833964, 48949736.258275785, 140244674.63638818, 48949732.90977708, 1, 1, 140244839.83405334, 48949480.09812501, 43 },
-  { 140244697.87048283, 48949750.4810328, 140244675.9972775, 48949783.97077584, 140244719.74368817, 48949716.991289765, 140244696.77682257, 48949752.155519955, 140244698.9641431, 48949748.80654565, 0, 0, 0, 0, 0 },
-  { 140244722.2031325, 48949766.37345222, 140244700.3310213, 48949799.86390984, 140244744.0752437, 48949732.88299459, 140244721.10952696, 48949768.0479751, 140244723.29673806, 48949764.69892933, 0, 0, 0, 0, 0 },
-  { 140244746.53699335, 48949782.26552858, 140244724.65979034, 48949815.75266026, 140244768.41419637, 48949748.778396904, 140244745.4431332, 48949783.93988517, 140244747.6308535, 48949780.591171995, 1, 1, 140244633.32246774, 48949955.56143502, 46 },
-  { 140244770.86874565, 48949798.16150588, 140244748.98026687, 48949831.641268365, 140244792.75722444, 48949764.68174339, 140244769.7743217, 48949799.835494004, 140244771.9631696, 48949796.48751775, 0, 0, 0, 0, 0 },
-  { 140244795.19506988, 48949814.06562802, 140244773.28913477, 48949847.533971384, 140244817.101005, 48949780.59728466, 140244794.09977314, 48949815.73904519, 140244796.29036662, 48949812.392210856, 0, 0, 0, 0, 0 },
-  { 140244819.51264635, 48949829.982138924, 140244797.5830796, 48949863.435002804, 140244841.4422131, 48949796.529275045, 140244818.416168, 48949831.65478212, 140244820.6091247, 48949828.30949573, 1, 4, 140244949.44532937, 48949631.77392042, 42 },
-  { 140244843.81815544, 48949845.915282525, 140244821.85878858, 48949879.34859236, 140244865.7775223, 48949812.48197269, 140244842.7201871, 48949847.586948015, 140244844.91612378, 48949844.243617035, 1, 5, 140244765.86240306, 48949964.60353245, 44 },
-  { 140244868.10827753, 48949861.86930278, 140244846.11295074, 48949895.27896605, 140244890.10360432, 48949828.45963951, 140244867.0085112, 48949863.539785944, 140244869.20804387, 48949860.198819615, 1, 2, 140245085.3121295, 48949531.94887799, 50 },
-  { 140244892.37969297, 48949877.8484436, 140244870.34225693, 48949911.230346076, 140244914.417129, 48949844.46654112, 140244891.27782118, 48949879.51753872, 140244893.48156476, 48949876.179348476, 0, 0, 0, 0, 0 },
-  { 140244916.62908217, 48949893.85694891, 140244894.54339984, 48949927.20695095, 140244938.7147645, 48949860.50694688, 140244915.52479807, 48949895.52444901, 140244917.73336628, 48949892.18944881, 1, 3, 140245077.3024212, 48949651.23568413, 26 },
-  { 140244940.8531255, 48949909.89906266, 140244918.71307403, 48949943.21299549, 140244962.993177, 48949876.585129835, 140244939.74612293, 48949911.56475931, 140244941.9601281, 48949908.23336602, 1, 5, 140244881.07498652, 48949999.84668129, 49 },
-  { 140244965.04850337, 48949925.97902879, 140244942.84797612, 48949959.252690904, 140244987.24903062, 48949892.70536668, 140244963.938477, 48949927.6427119, 140244966.15852973, 48949924.31534568, 0, 0, 0, 0, 0 },
-  { 140244989.21189606, 48949942.10109121, 140244966.94480482, 48949975.330244794, 140245011.4789873, 48949908.87193763, 140244988.0985415, 48949943.76254889, 140244990.32525063, 48949940.43963353, 1, 0, 140244924.63733146, 48950038.465636596, 31 },
-  { 140245013.339984, 48949958.269493885, 140244991.0002611, 48949991.44986129, 140245035.6797069, 48949925.08912648, 140245012.22299784, 48949959.92851225, 140245014.45697016, 48949956.61047552, 0, 0, 0, 0, 0 },
-  { 140245037.4294476, 48949974.4884807, 140245015.0110481, 48950007.61574084, 140245059.84784707, 48949941.36122056, 140245036.30852762, 48949976.14484371, 140245038.55036756, 48949972.83211769, 0, 0, 0, 0, 0 },
-  { 140245061.47696713, 48949990.7622956, 140245038.97387144, 48950023.83208067, 140245083.9800628, 48949957.69251052, 140245060.35181233, 48949992.41578485, 140245062.60212192, 48949989.10880634, 1, 0, 140245285.3827691, 48949661.71793409, 47 },
-  { 140245085.47922304, 48950007.09518255, 140245062.88543943, 48950040.103074655, 140245108.07300666, 48949974.08729045, 140245084.34953386, 48950008.74557716, 140245086.60891223, 48950005.44478795, 0, 0, 0, 0, 0 },
-  { 140245109.4328957, 48950023.491385475, 140245086.74246287, 48950056.43291334, 140245132.1233285, 48949990.54985761, 140245108.29837406, 48950025.138461865, 140245110.56741732, 48950021.844309084, 0, 0, 0, 0, 0 },
-  { 140245133.33466545, 48950039.95514827, 140245110.5416555, 48950072.82578408, 140245156.12767538, 48950007.084512465, 140245132.19501495, 48950041.598680064, 140245134.47431594, 48950038.31161648, 1, 1, 140245026.77734405, 48950193.62537068, 26 },
-  { 140245157.18121272, 48950056.49071491, 140245134.2797341, 48950089.28587121, 140245180.08269134, 48950023.69555861, 140245156.0361388, 48950058.13047272, 140245158.32628664, 48950054.850957096, 1, 1, 140245292.2999366, 48949862.99929273, 30 },
-  { 140245180.96921784, 48950073.10232931, 140245157.95341846, 48950105.81735611, 140245203.9850172, 48950040.3873025, 140245179.81842786, 48950074.73808064, 140245182.1200078, 48950071.46657797, 1, 2, 140245109.62023976, 48950174.5189124, 31 },
-  { 140245204.69536114, 48950089.79423537, 140245181.55943173, 48950122.42441728, 140245227.83129054, 48950057.16405346, 140245203.53856468, 48950091.42574447, 140245205.8521576, 48950088.162726276, 0, 0, 0, 0, 0 },
-  { 140245228.3563231, 48950106.570677094, 140245205.09450078, 48950139.111230604, 140245251.6181454, 48950074.030123584, 140245227.19323197, 48950108.19770477, 140245229.51941422, 48950104.94364942, 0, 0, 0, 0, 0 },
-  { 140245251.94878408, 48950123.43589837, 140245228.5553558, 48950155.8819692, 140245275.34221238, 48950090.98982754, 140245250.77911267, 48950125.05820191, 140245253.1184555, 48950121.81359483, 0, 0, 0, 0, 0 },
-  { 140245275.4694243, 48950140.394143134, 140245251.93873104, 48950172.740804076, 140245299.00011757, 48950108.04748219, 140245274.29288965, 48950142.01147618, 140245276.64595896, 48950138.77681009, 0, 0, 0, 0, 0 },
-  { 140245298.91492432, 48950157.44965531, 140245275.2413648, 48950189.69190369, 140245322.58848384, 48950125.20740693, 140245297.73124635, 48950159.06176773, 140245300.0986023, 48950155.83754289, 0, 0, 0, 0, 0 },
-  { 140245322.28196442, 48950174.60667884, 140245298.4599997, 48950206.73943467, 140245346.10392913, 48950142.47392302, 140245321.09086618, 48950176.213316634, 140245323.47306266, 48950173.00004105, 1, 0, 140245224.61190906, 48950306.35097773, 30 },
-  { 140245345.56722504, 48950191.86945767, 140245321.59179938, 48950223.887873694, 140245369.5426507, 48950159.851041645, 140245344.36845377, 48950193.47037847, 140245346.7659963, 48950190.268536866, 1, 5, 140245420.4904302, 48950091.8119076, 28 },
-  { 140245368.7676174, 48950209.24193737, 140245344.63986513, 48950241.145723514, 140245392.89536968, 48950177.338151224, 140245367.5612298, 48950210.83712668, 140245369.974005, 48950207.64674806, 1, 4, 140245249.93843746, 48950366.368084125, 29 },
-  { 140245391.88345823, 48950226.72366441, 140245367.60916957, 48950258.5160992, 140245416.15774688, 48950194.93122962, 140245390.6697438, 48950228.31328615, 140245393.09717265, 48950225.13404267, 0, 0, 0, 0, 0 },
-  { 140245414.9176601, 48950244.31083158, 140245390.50269693, 48950275.99536368, 140245439.33262324, 48950212.62629947, 140245413.69691193, 48950245.895058185, 140245416.13840824, 48950242.72660497, 0, 0, 0, 0, 0 },
-  { 140245437.87320095, 48950261.99954739, 140245413.32337922, 48950293.57970339, 140245462.4230227, 48950230.41939139, 140245436.64570987, 48950263.57855519, 140245439.10069203, 48950260.420539595, 1, 2, 140245586.39962244, 48950070.93960361, 34 },
-  { 140245460.7530588, 48950279.78592031, 140245436.0741483, 48950311.2653005, 140245485.43196929, 48950248.30654012, 140245459.51911327, 48950281.35988931, 140245461.9870043, 48950278.2119513, 1, 2, 140245335.5075881, 48950439.54377479, 44 },
-  { 140245483.56021136, 48950297.66605877, 140245458.75793672, 48950329.048333585, 140245508.362486, 48950266.28378396, 140245482.32009763, 48950299.23517251, 140245484.8003251, 48950296.09694503, 1, 5, 140245706.16062626, 48950016.01014229, 35 },
-  { 140245506.2976368, 48950315.636071265, 140245481.3776775, 48950346.92497709, 140245531.2175961, 48950284.34716544, 140245505.05163884, 48950317.20051656, 140245507.54363477, 48950314.07162597, 1, 5, 140245321.88993785, 48950547.17397436, 48 },
-  { 140245528.96831295, 48950333.69206627, 140245503.9363045, 48950364.89140204, 140245554.0003214, 48950302.49273049, 140245527.71671253, 48950335.252033055, 140245530.21991336, 48950332.13209948, 0, 0, 0, 0, 0 },
-  { 140245551.5752178, 48950351.830152206, 140245526.43675244, 48950382.94377557, 140245576.7136832, 48950320.71652884, 140245550.31829455, 48950353.385833375, 140245552.83214107, 48950350.27447104, 1, 1, 140245307.73210377, 48950653.63229887, 27 },
-  { 140245574.12132928, 48950370.04643758, 140245548.8819572, 48950401.07826153, 140245599.36070135, 48950339.01461362, 140245572.85936067, 48950371.59802877, 140245575.3832979, 48950368.49484638, 0, 0, 0, 0, 0 },
-  { 140245596.60962528, 48950388.33703083, 140245571.27485585, 48950419.29102021, 140245621.9443947, 48950357.38304145, 140245595.3428868, 48950389.884730294, 140245597.87636375, 48950386.78933136, 0, 0, 0, 0, 0 },
-  { 140245619.0430837, 48950406.69804043, 140245593.61838692, 48950437.57820872, 140245644.46778047, 48950375.817872144, 140245617.77184886, 48950408.242048845, 140245620.31431854, 48950405.15403202, 0, 0, 0, 0, 0 },
-  { 140245641.42468256, 48950425.125574864, 140245615.91549045, 48950455.93598086, 140245666.93387467, 48950394.31516887, 140245640.14922294, 48950426.66609517, 140245642.70014217, 48950423.58505456, 0, 0, 0, 0, 0 },
-  { 140245663.75739974, 48950443.61574255, 140245638.169108, 48950474.360487245, 140245689.34569147, 48950412.87099785, 140245662.47798514, 48950445.15297978, 140245665.03681433, 48950442.078505315, 1, 1, 140245808.9709553, 48950269.13931642, 42 },
-  { 140245686.04421324, 48950462.164652005, 140245660.38218313, 48950492.84787561, 140245711.70624334, 48950431.4814284, 140245684.76111174, 48950463.698813185, 140245687.32731473, 48950460.630490825, 0, 0, 0, 0, 0 },
-  { 140245708.28810102, 48950480.76841167, 140245682.557661, 48950511.394290544, 140245734.01854104, 48950450.1425328, 140245707.00157902, 48950482.29970562, 140245709.57462302, 48950479.23711773, 0, 0, 0, 0, 0 },
-  { 140245730.49204093, 48950499.423130006, 140245704.6984887, 48950529.995873824, 140245756.28559315, 48950468.85038619, 140245729.2023633, 48950500.9517672, 140245731.78171855, 48950497.89449281, 1, 3, 140245567.34782323, 48950692.79573465, 28 },
-  { 140245752.65901086, 48950518.12491547, 140245726.8076156, 48950548.648764566, 140245778.5104061, 48950487.60106638, 140245751.3664411, 48950519.65110793, 140245753.9515806, 48950516.59872302, 0, 0, 0, 0, 0 },
-  { 140245774.79198888, 48950536.86987655, 140245748.88799298, 48950567.34909891, 140245800.69598478, 48950506.390654184, 140245773.4967891, 48950538.39383767, 140245776.08718866, 48950535.34591543, 0, 0, 0, 0, 0 },
-  { 140245796.89395288, 48950555.654121704, 140245770.9425743, 48950586.09301048, 140245822.84533146, 48950525.21523293, 140245795.59638396, 48950557.176066145, 140245798.1915218, 48950554.13217726, 1, 4, 140245901.34825167, 48950433.1375944, 34 },
-  { 140245818.96788073, 48950574.4737594, 140245792.97431538, 48950604.87663032, 140245844.96144608, 48950544.070888475, 140245817.66820246, 48950575.993902944, 140245820.267559, 48950572.95361585, 0, 0, 0, 0, 0 },
-  { 140245841.01675045, 48950593.32489808, 140245814.98617423, 48950623.69608676, 140245867.04732668, 48950562.9537094, 140245839.71522164, 48950594.84345751, 140245842.31827927, 48950591.806338646, 0, 0, 0, 0, 0 },
-  { 140245863.04353994, 48950612.20364624, 140245836.98111132, 48950642.547505826, 140245889.10596856, 48950581.85978666, 140245861.74041852, 48950613.720839225, 140245864.34666136, 48950610.68645326, 0, 0, 0, 0, 0 },
-  { 140245885.05122712, 48950631.106112316, 140245858.96208942, 48950661.42701095, 140245911.14036483, 48950600.78521368, 140245883.74677023, 48950632.622157246, 140245886.355684, 48950629.59006739, 0, 0, 0, 0, 0 },
-  { 140245907.04279003, 48950650.02840482, 140245880.9320738, 48950680.33072319, 140245933.15350625, 48950619.726086445, 140245905.7372542, 48950651.54352073, 140245908.34832585, 48950648.5132889, 1, 3, 140245674.0046478, 48950920.47659629, 37 },
-  { 140245929.02120644, 48950668.96663214, 140245902.8940321, 48950699.25476119, 140245955.1483808, 48950638.678503096, 140245927.7148477, 48950670.48103859, 140245930.32756516, 48950667.45222569, 0, 0, 0, 0, 0 },
-  { 140245950.98945436, 48950687.91690281, 140245924.85093462, 48950718.19524136, 140245977.1279741, 48950657.63856426, 140245949.68252838, 48950689.430819735, 140245952.29638034, 48950686.402985886, 0, 0, 0, 0, 0 },
-  { 140245972.9505118, 48950706.87532528, 140245946.80575404, 48950737.148277566, 140245999.0952696, 48950676.60237299, 140245971.64327392, 48950708.38897289, 140245974.2577497, 48950705.36167766, 0, 0, 0, 0, 0 },
-  { 140245994.90735662, 48950725.838007994, 140245968.76146558, 48950756.10998152, 140246021.05324766, 48950695.566034466, 140245993.60006207, 48950727.35160667, 140245996.21465117, 48950724.32440932, 0, 0, 0, 0, 0 },
-  { 140246016.86296678, 48950744.80105943, 140245990.72104695, 48950775.07646244, 140246043.0048866, 48950714.525656424, 140246015.55587077, 48950746.31482958, 140246018.17006278, 48950743.287289284, 1, 4, 140246109.66678217, 48950637.32337875, 33 },
-  { 140246038.82032007, 48950763.76058804, 140246012.68747857, 48950794.04382754, 140246064.95316157, 48950733.47734854, 140246037.51367798, 48950765.27475002, 140246040.12696216, 48950762.24642607, 0, 0, 0, 0, 0 },
-  { 140246060.7823947, 48950782.71270232, 140246034.6637433, 48950813.00818132, 140246086.90104613, 48950752.41722332, 140246059.47646213, 48950784.22747627, 140246062.0883273, 48950781.19792837, 1, 4, 140246306.95068437, 48950497.17781274, 36 },
-  { 140246082.75216848, 48950801.65351071, 140246056.65282637, 48950831.965626135, 140246108.85151058, 48950771.34139529, 140246081.44720137, 48950803.16911648, 140246084.05713558, 48950800.13790494, 0, 0, 0, 0, 0 },
-  { 140246104.73261923, 48950820.57912167, 140246078.65771574, 48950850.91226209, 140246130.8075227, 48950790.24598125, 140246103.42887405, 48950822.09577869, 140246106.0363644, 48950819.062464654, 0, 0, 0, 0, 0 },
-  { 140246126.72672507, 48950839.4856437, 140246100.68140173, 48950869.84418669, 140246152.7720484, 48950809.127100706, 140246125.4244589, 48950841.00357085, 140246128.02899125, 48950837.96771655, 1, 1, 140245978.91951516, 48951011.77037518, 35 },
-  { 140246148.7374638, 48950858.36918522, 140246122.72687718, 48950888.757495195, 140246174.74805042, 48950827.98087524, 140246147.43693447, 48950859.888600715, 140246150.03799313, 48950856.84976972, 0, 0, 0, 0, 0 },
-  { 140246170.76781344, 48950877.22585471, 140246144.7971373, 48950907.64828033, 140246196.7384896, 48950846.80342909, 140246169.46927965, 48950878.74697599, 140246172.06634724, 48950875.70473343, 0, 0, 0, 0, 0 },
-  { 140246192.82075194, 48950896.05176066, 140246166.8951797, 48950926.512632355, 140246218.74632418, 48950865.59088896, 140246191.5244733, 48950897.57480425, 140246194.11703056, 48950894.52871707, 1, 3, 140246419.02136967, 48950630.28065512, 40 },
-  { 140246214.89925712, 48950914.843011506, 140246189.0240043, 48950945.34663904, 140246240.77450994, 48950884.339383975, 140246213.60549447, 48950916.36819288, 140246216.19301978, 48950913.31783013, 0, 0, 0, 0, 0 },
-  { 140246237.006307, 48950933.59571572, 140246211.18661344, 48950964.14638549, 140246262.82600057, 48950903.04504594, 140246235.71532232, 48950935.1232492, 140246238.2972917, 48950932.06818223, 1, 5, 140246365.45928255, 48950781.60613359, 30 },
-  { 140246259.14487958, 48950952.305981785, 140246233.38601148, 48950982.90795417, 140246284.90374768, 48950921.7040094, 140246257.8569362, 48950953.8360804, 140246260.43282297, 48950950.77588317, 1, 5, 140246053.07393476, 48951197.1217609, 32 },
-  { 140246281.31795266, 48950970.96991814, 140246255.62520504, 48951001.62742488, 140246307.0107003, 48950940.3124114, 140246280.03331527, 48950972.502793476, 140246282.60259005, 48950969.4370428, 0, 0, 0, 0, 0 },
-  { 140246303.52850425, 48950989.58363325, 140246277.9072028, 48951020.300874546, 140246329.1498057, 48950958.86639196, 140246302.24743918, 48950991.11949532, 140246304.80956933, 48950988.047771186, 0, 0, 0, 0, 0 },
-  { 140246325.7795123, 48951008.14323562, 140246300.23501554, 48951038.92437734, 140246351.32400903, 48950977.362093896, 140246324.50228745, 48951009.6822927, 140246327.05673712, 48951006.60417853, 0, 0, 0, 0, 0 },
-  { 140246348.07395467, 48951026.64483365, 140246322.6116557, 48951057.494004324, 140246373.53625363, 48950995.79566297, 140246346.80083972, 48951028.18729218, 140246349.34706962, 48951025.10237511, 1, 4, 140246118.27670652, 48951305.05859902, 26 },
-  { 140246370.41480935, 48951045.08453586, 140246345.04013783, 48951076.00582377, 140246395.78948087, 48951014.16324795, 140246369.1460758, 48951046.63060025, 140246371.6835429, 48951043.53847147, 1, 2, 140246516.31917053, 48950867.2871304, 42 },
-  { 140246392.8050543, 48951063.458450705, 140246367.523478, 48951094.4559006, 140246418.0866306, 48951032.46100081, 140246391.54097548, 48951065.0083232, 140246394.06913313, 48951061.90857821, 1, 1, 140246201.92915332, 48951297.48919744, 36 },
-  { 140246415.24766743, 48951081.762686625, 140246390.0646939, 48951112.84029665, 140246440.43064097, 48951050.6850766, 140246413.98851874, 48951083.31656712, 140246416.50681612, 48951080.20880613, 0, 0, 0, 0, 0 },
-  { 140246437.7456267, 48951099.99335211, 140246412.66680467, 48951131.155070394, 140246462.8244487, 48951068.83163382, 140246436.4916856, 48951101.55143802, 140246438.99956778, 48951098.4352662, 0, 0, 0, 0, 0 },
-  { 140246460.30190995, 48951118.1465556, 140246435.33283082, 48951149.39627699, 140246485.2709891, 48951086.89683422, 140246459.053456, 48951119.70904167, 140246461.5503639, 48951116.584069535, 1, 0, 140246610.74061182, 48950929.86698426, 34 },
-  { 140246482.91949522, 48951136.21840558, 140246458.06579402, 48951167.559968024, 140246507.77319643, 48951104.87684314, 140246481.67681018, 48951137.7854837, 140246484.16218027, 48951134.65132746, 1, 3, 140246336.9040006, 48951320.350084916, 48 },
-  { 140246505.60136047, 48951154.20501052, 140246480.86871698, 48951185.64219146, 140246530.33400396, 48951122.767829575, 140246504.3647283, 48951155.776869565, 140246506.83799264, 48951152.63315147, 1, 1, 140246584.12750357, 48951054.39196102, 25 },
-  { 140246528.35048357, 48951172.102478884, 140246503.7446232, 48951203.63899163, 140246552.95634392, 48951140.56596614, 140246527.12019056, 48951173.67930452, 140246529.58077657, 48951170.52565325, 1, 2, 140246437.30880025, 48951288.787576035, 46 },
-  { 140246551.16984236, 48951189.90691911, 140246526.69653705, 48951221.546409085, 140246575.64314768, 48951158.26742913, 140246549.9461771, 48951191.488893606, 140246552.39350763, 48951188.32494461, 0, 0, 0, 0, 0 },
-  { 140246574.062415, 48951207.61443969, 140246549.7274832, 48951239.3604803, 140246598.3973468, 48951175.868399076, 140246572.8456684, 48951209.20174172, 140246575.2791616, 48951206.02713766, 1, 1, 140246439.0035436, 48951383.80496511, 35 },
-  { 140246597.03117925, 48951225.22114907, 140246572.8404868, 48951257.07723795, 140246621.2218717, 48951193.365060195, 140246595.82164463, 48951226.81395352, 140246598.24071386, 48951223.628344625, 0, 0, 0, 0, 0 },
-  { 140246620.07911313, 48951242.723155744, 140246596.038573, 48951274.69271049, 140246644.11965325, 48951210.753601, 140246618.87708613, 48951244.32163348, 140246621.28114012, 48951241.12467801, 0, 0, 0, 0, 0 },
-  { 140246643.2091945, 48951260.11656813, 140246619.3247647, 48951292.20292056, 140246667.09362432, 48951228.0302157, 140246642.014973, 48951261.72088575, 140246644.403416, 48951258.51225051, 0, 0, 0, 0, 0 },
-  { 140246666.42440015, 48951277.39749625, 140246642.7002444, 48951309.60253364, 140246690.1485559, 48951245.19245887, 140246665.23819235, 48951279.00774812, 140246667.61060795, 48951275.78724439, 1, 1, 140246480.18977737, 48951530.20703974, 40 },
-  { 140246689.7266484, 48951294.56332532, 140246666.16174406, 48951326.88507162, 140246713.29155272, 48951262.241579026, 140246688.54840317, 48951296.17941264, 140246690.9048936, 48951292.947238006, 0, 0, 0, 0, 0 },
-  { 140246713.11487025, 48951311.61504046, 140246689.7072544, 48951344.05087745, 140246736.5224861, 48951279.179203466, 140246711.94448945, 48951313.236832306, 140246714.28525105, 48951309.99324861, 0, 0, 0, 0, 0 },
-  { 140246736.5874734, 48951328.55425732, 140246713.33515134, 48951361.10160004, 140246759.83979544, 48951296.00691459, 140246735.4248573, 48951330.18162446, 140246737.7500895, 48951326.92689018, 0, 0, 0, 0, 0 },
-  { 140246760.14286548, 48951345.38259159, 140246737.04381198, 48951378.0388885, 140246783.24191898, 48951312.72629468, 140246758.9879128, 48951347.01540644, 140246761.29781815, 48951343.74977674, 0, 0, 0, 0, 0 },
-  { 140246783.77945423, 48951362.101658955, 140246760.83161482, 48951394.86439184, 140246806.72729364, 48951329.33892607, 140246782.63206226, 48951363.7397956, 140246784.9268462, 48951360.46352231, 1, 3, 140246885.89733964, 48951216.30749761, 47 },
-  { 140246807.49564734, 48951378.71307513, 140246784.69693953, 48951411.57975921, 140246830.29435515, 48951345.84639105, 140246806.35571194, 48951380.35640933, 140246808.63558275, 48951377.06974093, 0, 0, 0, 0, 0 },
-  { 140246831.2898525, 48951395.21845577, 140246808.63816693, 48951428.186639525, 140246853.94153807, 48951362.25027201, 140246830.15726823, 48951396.86686496, 140246832.42243677, 48951393.57004658, 0, 0, 0, 0, 0 },
-  { 140246855.1604774, 48951411.61941658, 140246832.65367895, 48951444.68668172, 140246877.66727585, 48951378.55215144, 140246854.03513747, 48951413.27277984, 140246856.28581733, 48951409.96605332, 1, 2, 140246659.35133097, 48951699.304623306, 46 },
-  { 140246879.10592964, 48951427.91757323, 140246856.74185875, 48951461.08153459, 140246901.47000054, 48951394.75361187, 140246877.9877261, 48951429.575771295, 140246880.2241332, 48951426.25937516, 0, 0, 0, 0, 0 },
-  { 140246903.124617, 48951444.11454141, 140246880.90109053, 48951477.37284669, 140246925.3481435, 48951410.85623613, 140246902.0134407, 48951445.77745668, 140246904.23579332, 48951442.451626144, 1, 4, 140246821.45315716, 48951566.33881332, 26 },
-  { 140246927.21494716, 48951460.21193681, 140246905.12975943, 48951493.56226639, 140246949.3001349, 48951426.86160723, 140246926.1106878, 48951461.87945329, 140246928.31920654, 48951458.54442033, 1, 0, 140247036.53662643, 48951295.127805404, 40 },
-  { 140246951.37532774, 48951476.21137512, 140246929.4262518, 48951509.65144188, 140246973.32440367, 48951442.771308355, 140246950.27787393, 48951477.88337845, 140246952.47278154, 48951474.53937178, 0, 0, 0, 0, 0 },
-  { 140246975.60416648, 48951492.11447201, 140246953.7889548, 48951525.64202096, 140246997.41937816, 48951458.586923055, 140246974.5134059, 48951493.790849455, 140246976.69492707, 48951490.438094564, 1, 0, 140247176.30411407, 48951183.66102166, 33 },
-  { 140246999.89987105, 48951507.92284319, 140246978.21625662, 48951541.53565124, 140247021.58348548, 48951474.31003514, 140246998.81569034, 48951509.60348359, 140247000.98405176, 48951506.24220279, 0, 0, 0, 0, 0 },
-  { 140247024.26084912, 48951523.63810432, 140247002.70654634, 48951557.33397991, 140247045.8151519, 48951489.94222873, 140247023.183134, 48951525.3228981, 140247025.33856425, 48951521.95331054, 1, 4, 140247172.98553824, 48951291.136562735, 33 },
-  { 140247048.68550843, 48951539.26187111, 140247027.25821394, 48951573.03865381, 140247070.11280292, 48951505.4850884, 140247047.6141437, 48951540.950710244, 140247049.75687316, 48951537.57303197, 1, 0, 140246974.22566003, 48951656.63619102, 50 },
-  { 140247073.17225653, 48951554.79575921, 140247051.86965016, 48951588.65131949, 140247094.4748629, 48951520.94019893, 140247072.1071262, 48951556.48853722, 140247074.23738685, 48951553.102981195, 1, 5, 140247220.1602405, 48951321.192393295, 48 },
-  { 140247097.71950132, 48951570.24138436, 140247076.5392467, 48951604.17362292, 140247118.89975592, 48951536.30914579, 140247096.66048858, 48951571.93799628, 140247098.77851406, 48951568.54477243, 0, 0, 0, 0, 0 },
-  { 140247122.32565027, 48951585.6003622, 140247101.26539588, 48951619.60720982, 140247143.38590467, 48951551.59351458, 140247121.27263755, 48951587.300704576, 140247123.378663, 48951583.90001982, 0, 0, 0, 0, 0 },
-  { 140247146.98911124, 48951600.87430843, 140247126.04649088, 48951634.95372526, 140247167.9317316, 48951566.794891596, 140247145.9419802, 48951602.57827927, 140247148.03624228, 48951599.17033759, 0, 0, 0, 0, 0 },
-  { 140247171.7082918, 48951616.064838745, 140247150.88092548, 48951650.21481402, 140247192.53565812, 48951581.91486347, 140247170.6669235, 48951617.77233751, 140247172.7496601, 48951614.35733998, 1, 4, 140247309.68959376, 48951389.82125251, 28 },
-  { 140247196.4815997, 48951631.17356882, 140247175.76709422, 48951665.392120264, 140247217.19610515, 48951596.95501738, 140247195.44587442, 48951632.8844964, 140247197.51732495, 48951629.46264125, 1, 3, 140247096.53411078, 48951796.27807954, 40 },
-  { 140247221.30744255, 48951646.202114336, 140247200.70339224, 48951680.48728768, 140247241.91149285, 48951611.916940995, 140247220.27724004, 48951647.916373, 140247222.33764505, 48951644.48785567, 1, 0, 140247419.62142676, 48951316.207320936, 27 },
-  { 140247246.18422812, 48951661.152091004, 140247225.68821537, 48951695.50195944, 140247266.68024087, 48951626.802222565, 140247245.1594275, 48951662.86958443, 140247247.20902875, 48951659.43459758, 0, 0, 0, 0, 0 },
-  { 140247271.11036408, 48951676.02511449, 140247250.71995994, 48951710.43777813, 140247291.5007682, 48951641.61245085, 140247270.0908439, 48951677.74574767, 140247272.12988427, 48951674.30448131, 0, 0, 0, 0, 0 },
-  { 140247296.08425805, 48951690.822800495, 140247275.79702285, 48951725.296385854, 140247316.37149325, 48951656.349215135, 140247295.06989628, 48951692.54647976, 140247297.09861982, 48951689.09912123, 0, 0, 0, 0, 0 },
-  { 140247321.10431775, 48951705.54676468, 140247300.91780156, 48951740.07942405, 140247341.29083395, 48951671.014105305, 140247320.09499195, 48951707.27339765, 140247322.11364356, 48951703.82013171, 0, 0, 0, 0, 0 },
-  { 140247346.16895092, 48951720.19862274, 140247326.080694, 48951754.7885336, 140247366.25720784, 48951685.60871188, 140247345.16453806, 48951721.92811828, 140247347.17336378, 48951718.4691272, 1, 1, 140247246.22987267, 48951892.283429265, 41 },
-  { 140247371.2765652, 48951734.779990375, 140247351.28409857, 48951769.42535482, 140247391.26903182, 48951700.13462593, 140247370.27694187, 48951736.5122586, 140247372.27618852, 48951733.04772215, 0, 0, 0, 0, 0 },
-  { 140247396.42556828, 48951749.29248326, 140247376.5264141, 48951783.99152738, 140247416.32472247, 48951714.59343915, 140247395.43061057, 48951751.02743547, 140247397.420526, 48951747.55753106, 0, 0, 0, 0, 0 },
-  { 140247421.61436778, 48951763.73771707, 140247401.8060398, 48951798.48869033, 140247441.42269576, 48951728.98674381, 140247420.62395138, 48951765.475265734, 140247422.6047842, 48951762.000168405, 0, 0, 0, 0, 0 },
-  { 140247446.84137154, 48951778.117307544, 140247427.1213755, 48951812.91848218, 140247466.56136757, 48951743.31613291, 140247445.85537174, 48951779.85736628, 140247447.82737133, 48951776.37724881, 0, 0, 0, 0, 0 },
-  { 140247472.10498708, 48951792.432870276, 140247452.47082096, 48951827.282540575, 140247491.7391532, 48951757.58319998, 140247471.12327877, 48951794.17535379, 140247473.0866954, 48951790.690386765, 1, 4, 140247541.80627686, 48951668.7165407, 28 },
-  { 140247497.4036222, 48951806.686021045, 140247477.85277668, 48951841.5825028, 140247516.95446774, 48951771.78953929, 140247496.42607993, 48951808.430845134, 140247498.3811645, 48951804.941196956, 0, 0, 0, 0, 0 },
-  { 140247522.7356845, 48951820.87837547, 140247503.26564324, 48951855.82000526, 140247542.2057258, 48951785.93674568, 140247521.76218244, 48951822.62545696, 140247523.70918658, 48951819.13129398, 0, 0, 0, 0, 0 },
-  { 140247548.09958175, 48951835.01154926, 140247528.70782158, 48951869.99668378, 140247567.49134192, 48951800.02641474, 140247547.12999374, 48951836.76080598, 140247549.06916976, 48951833.262292534, 1, 3, 140247370.66497615, 48952155.125530116, 45 },
-  { 140247573.49372157, 48951849.08715811, 140247554.17771295, 48951884.11417356, 140247592.8097302, 48951814.060142666, 140247572.52792114, 48951850.83850889, 140247574.459522, 48951847.33580734, 0, 0, 0, 0, 0 },
-  { 140247598.9165117, 48951863.106817715, 140247579.6737188, 48951898.17410905, 140247618.15930462, 48951828.03952638, 140247597.95437208, 48951864.86018228, 140247599.87865135, 48951861.35345315, 0, 0, 0, 0, 0 },
-  { 140247624.3663598, 48951877.07214373, 140247605.19839478, 48951912.180392295, 140247643.53432482, 48951841.96389517, 140247623.40796155, 48951878.82755616, 140247625.32475805, 48951875.316731304, 0, 0, 0, 0, 0 },
-  { 140247649.84315974, 48951890.98165018, 140247630.8148663, 48951926.16579503, 140247668.87145317, 48951855.797505334, 140247648.89174506, 48951892.74085742, 140247650.7945744, 48951889.22244294, 1, 4, 140247566.59437594, 48952044.91228389, 26 },
-  { 140247675.3693783, 48951904.78674277, 140247656.595487, 48951940.10728928, 140247694.1432696, 48951869.46619626, 140247674.43068373, 48951906.55277009, 140247676.30807287, 48951903.020715445, 0, 0, 0, 0, 0 },
-  { 140247700.9850314, 48951918.402202725, 140247682.58311632, 48951953.91796713, 140247719.38694647, 48951882.88643832, 140247700.06493565, 48951920.17799094, 140247701.90512714, 48951916.62641451, 1, 3, 140247526.626886, 48952254.91407047, 48 },
-  { 140247726.7305966, 48951931.74184816, 140247708.82033733, 48951967.50806983, 140247744.64085588, 48951895.9756265, 140247725.83508363, 48951933.53015925, 140247727.62610957, 48951929.95353708, 0, 0, 0, 0, 0 },
-  { 140247752.64655143, 48951944.71949716, 140247735.35010448, 48951980.78655862, 140247769.94299838, 48951908.6524357, 140247751.78172907, 48951946.52285023, 140247753.5113738, 48951942.91614409, 1, 2, 140247629.841778, 48952200.79563354, 25 },
-  { 140247778.77337325, 48951957.248967804, 140247762.21549585, 48951993.661008336, 140247795.33125064, 48951920.83692727, 140247777.94547936, 48951959.06956983, 140247779.60126713, 48951955.428365774, 0, 0, 0, 0, 0 },
-  { 140247805.15153962, 48951969.244078174, 140247789.45939252, 48952006.037508555, 140247820.84368673, 48951932.45064779, 140247804.36693227, 48951971.0837497, 140247805.93614697, 48951967.40440665, 1, 0, 140247736.10609236, 48952131.13517186, 28 },
-  { 140247831.82152823, 48951980.618646406, 140247817.12394688, 48952017.820542894, 140247846.51910958, 48951943.41674992, 140247831.08664915, 48951982.47874123, 140247832.5564073, 48951978.75855158, 0, 0, 0, 0, 0 },
-  { 140247858.823266, 48951991.28638851, 140247845.24380162, 48952028.910824016, 140247872.40273038, 48951953.661953, 140247858.14429277, 48951993.16761029, 140247859.50223923, 48951989.40516673, 1, 4, 140247790.92594412, 48952179.40856604, 46 },
-  { 140247886.1680777, 48952001.15571655, 140247873.82586464, 48952039.20397245, 140247898.51029077, 48951963.107460655, 140247885.55096707, 48952003.05812935, 140247886.78518835, 48951999.25330376, 0, 0, 0, 0, 0 },
-  { 140247913.82532248, 48952010.1272607, 140247902.8464781, 48952048.591074556, 140247924.80416685, 48951971.66344684, 140247913.27638027, 48952012.05045139, 140247914.3742647, 48952008.20407001, 0, 0, 0, 0, 0 },
-  { 140247941.7610126, 48952018.10103042, 140247932.27912363, 48952056.960955545, 140247951.2429016, 48951979.24110529, 140247941.28691816, 48952020.04402667, 140247942.23510706, 48952016.15803416, 1, 3, 140248031.6019108, 48951649.9032398, 34 },
-  { 140247969.9411604, 48952024.977035254, 140247962.09634775, 48952064.20022883, 140247977.78597307, 48951985.753841676, 140247969.54891977, 48952026.93819493, 140247970.33340105, 48952023.01587558, 0, 0, 0, 0, 0 },
-  { 140247998.33177835, 48952030.65528475, 140247992.24471837, 48952070.189418115, 140248004.41883832, 48951991.12115138, 140247998.02742535, 48952032.631991416, 140247998.63613135, 48952028.67857808, 0, 0, 0, 0, 0 },
-  { 140248026.8997139, 48952035.05388217, 140248022.49354565, 48952074.81046252, 140248031.30588216, 48951995.297301814, 140248026.67940548, 48952037.04171118, 140248027.12002233, 48952033.06605315, 0, 0, 0, 0, 0 },
-  { 140248055.61854577, 48952038.236751616, 140248052.712242, 48952078.13102938, 140248058.52484953, 48951998.34247385, 140248055.47323057, 48952040.2314655, 140248055.76386097, 48952036.24203773, 0, 0, 0, 0, 0 },
-  { 140248084.46510267, 48952040.33822736, 140248082.87075463, 48952080.30644041, 140248086.05945072, 48952000.37001431, 140248084.38538527, 48952042.33663801, 140248084.54482007, 48952038.33981671, 0, 0, 0, 0, 0 },
-  { 140248113.4162344, 48952041.49309962, 140248112.94361317, 48952081.49030739, 140248113.88885564, 48952001.495891854, 140248113.39260334, 48952043.49296001, 140248113.43986547, 48952039.49323923, 1, 0, 140248114.95225343, 48951911.50217438, 42 },
-  { 140248142.44879067, 48952041.83615864, 140248142.90796214, 48952081.83352307, 140248141.9896192, 48952001.83879421, 140248142.47174925, 48952043.83602686, 140248142.4258321, 48952039.83629042, 1, 2, 140248147.02902615, 48952440.80986886, 45 },
-  { 140248171.53962138, 48952041.50219464, 140248172.74239814, 48952081.48410715, 140248170.33684462, 48952001.520282134, 140248171.59976023, 48952043.50129027, 140248171.47948253, 48952039.50309902, 1, 4, 140248165.31525168, 48951834.5957974, 25 },
-  { 140248200.66557625, 48952040.6259979, 140248202.42602462, 48952080.58723939, 140248198.90512788, 48952000.66475641, 140248200.75359866, 48952042.624059975, 140248200.57755384, 48952038.62793583, 0, 0, 0, 0, 0 },
-  { 140248229.8035051, 48952039.34235863, 140248231.9377283, 48952079.28538169, 140248227.6692819, 48951999.39933556, 140248229.91021624, 48952041.33950978, 140248229.69679394, 48952037.345207475, 0, 0, 0, 0, 0 },
-  { 140248258.93025765, 48952037.78606703, 140248261.266333, 48952077.71779317, 140248256.59418228, 48951997.854340896, 140248259.0470614, 48952039.78265334, 140248258.81345388, 48952035.78948072, 1, 4, 140248266.34729692, 48952164.5692975, 41 },
-  { 140248288.024131, 48952036.08402489, 140248290.5005418, 48952076.007293664, 140248285.5477202, 48951996.16075612, 140248288.14795154, 48952038.08018833, 140248287.90031046, 48952034.087861456, 0, 0, 0, 0, 0 },
-  { 140248317.07834163, 48952034.28181372, 140248319.69840348, 48952074.19591243, 140248314.4582798, 48951994.36771501, 140248317.2093447, 48952036.27751865, 140248316.94733855, 48952032.286108784, 0, 0, 0, 0, 0 },
-  { 140248346.09489778, 48952032.37709398, 140248348.86273223, 48952072.28121773, 140248343.32706332, 48951992.472970225, 140248346.2332895, 48952034.37230016, 140248345.95650604, 48952030.38188779, 1, 5, 140248333.501251, 48951850.8133309, 33 },
-  { 140248375.07592106, 48952030.366908886, 140248377.9956174, 48952070.26020874, 140248372.15622473, 48951990.47360903, 140248375.2219059, 48952032.361573875, 140248374.92993623, 48952028.372243896, 0, 0, 0, 0, 0 },
-  { 140248404.02353284, 48952028.24830159, 140248407.0991447, 48952068.12988395, 140248400.94792098, 48951988.36671922, 140248404.17731342, 48952030.24238071, 140248403.86975226, 48952026.25422247, 1, 0, 140248393.33578163, 48951889.65980288, 44 },
-  { 140248432.9398547, 48952026.018315285, 140248436.17539692, 48952065.88724136, 140248429.7043125, 48951986.14938921, 140248433.10163182, 48952028.01176159, 140248432.7780776, 48952024.02486898, 0, 0, 0, 0, 0 },
-  { 140248461.8270083, 48952023.67399317, 140248465.22645375, 48952063.529278524, 140248458.42756286, 48951983.81870782, 140248461.99698058, 48952025.666757435, 140248461.65703604, 48952021.681228906, 1, 4, 140248439.220696, 48951758.63634557, 43 },
-  { 140248490.68711507, 48952021.212378405, 140248494.25439125, 48952061.05299261, 140248487.1198389, 48951981.3717642, 140248490.86547887, 48952023.204409115, 140248490.50875127, 48952019.220347695, 1, 0, 140248503.88603693, 48952168.62265098, 28 },
-  { 140248519.52229652, 48952018.6305142, 140248523.26128235, 48952058.45538061, 140248515.78331068, 48951978.80564778, 140248519.7092458, 48952020.621757515, 140248519.33534724, 48952016.63927088, 1, 0, 140248503.63160676, 48951849.37483193, 47 },
-  { 140248548.33467418, 48952015.92544369, 140248552.24919644, 48952055.73343931, 140248544.42015192, 48951976.11744806, 140248548.5304003, 48952017.915843464, 140248548.13894805, 48952013.93504391, 1, 0, 140248585.13118353, 48952390.120602526, 42 },
-  { 140248577.12636966, 48952013.094210126, 140248581.22020003, 48952052.88416555, 140248573.03253928, 48951973.3042547, 140248577.33106118, 48952015.0837079, 140248576.92167813, 48952011.10471235, 1, 3, 140248561.56981418, 48951861.89237951, 44 },
-  { 140248605.89950442, 48952010.13385663, 140248610.17635575, 48952049.904556185, 140248601.6226531, 48951970.36315708, 140248606.113347, 48952012.12239161, 140248605.68566185, 48952008.14532165, 1, 3, 140248646.20882818, 48952384.972699896, 34 },
-  { 140248634.6562, 48952007.04142645, 140248639.1197232, 48952046.79160834, 140248630.19267678, 48951967.29124456, 140248634.87937614, 48952009.028935544, 140248634.43302384, 48952005.053917356, 0, 0, 0, 0, 0 },
-  { 140248663.39857793, 48952003.8139627, 140248668.05235845, 48952043.54231941, 140248658.7447974, 48951964.08560599, 140248663.63126695, 48952005.800380535, 140248663.1658889, 48952001.82754486, 1, 2, 140248707.95852634, 48952384.21297821, 36 },
-  { 140248692.12875977, 48952000.44850861, 140248696.9763144, 48952040.15368729, 140248687.28120515, 48951960.743329935, 140248692.3711375, 48952002.43376755, 140248691.88638204, 48951998.463249676, 0, 0, 0, 0, 0 },
-  { 140248720.848867, 48951996.94210735, 140248725.8936405, 48952036.62271043, 140248715.8040935, 48951957.26150427, 140248721.10110566, 48951998.92613751, 140248720.59662834, 48951994.95807719, 0, 0, 0, 0, 0 },
-  { 140248749.5610212, 48951993.29180209, 140248754.80638298, 48952032.946387954, 140248744.31565943, 48951953.63721623, 140248749.8232893, 48951995.27453139, 140248749.2987531, 48951991.3090728, 0, 0, 0, 0, 0 },
-  { 140248778.26734388, 48951989.49463604, 140248783.71658486, 48952029.12171987, 140248772.8181029, 48951949.867552206, 140248778.53980592, 48951991.47599023, 140248777.99488184, 48951987.513281845, 0, 0, 0, 0, 0 },
-  { 140248806.96995658, 48951985.54765236, 140248812.62628594, 48952025.14570708, 140248801.3136272, 48951945.949597634, 140248807.25277305, 48951987.52755509, 140248806.6871401, 48951983.56774962, 1, 4, 140248769.07254976, 48951720.2406857, 34 },
-  { 140248835.67098078, 48951981.44789424, 140248841.53752288, 48952021.01535162, 140248829.80443868, 48951941.88043685, 140248835.96430787, 48951983.42626711, 140248835.3776537, 48951979.469521366, 0, 0, 0, 0, 0 },
-  { 140248864.3725381, 48951977.19240487, 140248870.4523294, 48952016.727656715, 140248858.29274678, 48951937.65715303, 140248864.67652765, 48951979.16916747, 140248864.06854853, 48951975.21564228, 0, 0, 0, 0, 0 },
-  { 140248893.07674995, 48951972.77822742, 140248899.37273592, 48952012.2796269, 140248886.78076398, 48951933.27682794, 140248893.39154926, 48951974.753297396, 140248892.76195064, 48951970.80315744, 0, 0, 0, 0, 0 },
-  { 140248921.78573793, 48951968.202405095, 140248928.3012464, 48952007.66818964, 140248915.27022946, 48951928.73662055, 140248922.11151335, 48951970.175694324, 140248921.45996252, 48951966.229115866, 1, 1, 140248875.52562776, 48951687.99533486, 37 },
-  { 140248950.50138384, 48951963.46166482, 140248957.2554169, 48952002.887329526, 140248943.74735078, 48951924.03600011, 140248950.8390855, 48951965.43294805, 140248950.1636822, 48951961.49038158, 1, 4, 140248968.23072064, 48952066.95403467, 43 },
-  { 140248979.2176335, 48951958.54226775, 140248986.24819115, 48951997.919561446, 140248972.18707582, 48951919.16497405, 140248979.56916136, 48951960.511132434, 140248978.86610562, 48951956.57340306, 1, 3, 140248953.38033408, 48951813.830713406, 42 },
-  { 140249007.9188611, 48951953.4178517, 140249015.26512626, 48951992.73747006, 140249000.57259592, 48951914.09823334, 140249008.28617436, 48951955.38383262, 140249007.55154783, 48951951.451870784, 0, 0, 0, 0, 0 },
-  { 140249036.58887014, 48951948.06130202, 140249044.29010305, 48951987.31293908, 140249028.88763723, 48951908.809664965, 140249036.9739318, 48951950.02388387, 140249036.2038085, 48951946.09872017, 1, 2, 140248990.38147268, 48951712.55147968, 44 },
-  { 140249065.21146423, 48951942.445504054, 140249073.30701485, 48951981.61771436, 140249057.1159136, 48951903.27329375, 140249065.61624175, 48951944.40411457, 140249064.8066867, 48951940.48689354, 0, 0, 0, 0, 0 },
-  { 140249093.7704469, 48951936.543343104, 140249102.29975024, 48951975.62340176, 140249085.24114355, 48951897.46328445, 140249094.19691205, 48951938.497346036, 140249093.34398174, 48951934.58934017, 1, 5, 140249033.21239322, 48951659.07492664, 42 },
-  { 140249122.2496217, 48951930.32770452, 140249131.25217396, 48951969.30146559, 140249113.24706942, 48951891.353943445, 140249122.6997493, 48951932.27639257, 140249121.7994941, 48951928.37901647, 0, 0, 0, 0, 0 },
-  { 140249150.63279217, 48951923.77147363, 140249160.14810547, 48951962.62322794, 140249141.11747888, 48951884.91971932, 140249151.10855785, 48951925.71406135, 140249150.1570265, 48951921.82888591, 1, 4, 140249117.32919562, 48951787.790333554, 43 },
-  { 140249178.90376183, 48951916.847535744, 140249188.97129428, 48951955.559869565, 140249168.83622938, 48951878.13520192, 140249179.40713847, 48951918.78315244, 140249178.4003852, 48951914.91191905, 0, 0, 0, 0, 0 },
-  { 140249207.04633427, 48951909.52877623, 140249217.70539412, 48951948.08243291, 140249196.3872744, 48951870.975119546, 140249207.57928726, 48951911.45645906, 140249206.51338127, 48951907.6010934, 0, 0, 0, 0, 0 },
-  { 140249235.04431298, 48951901.78808037, 140249246.33393276, 48951940.16182772, 140249223.7546932, 48951863.41433302, 140249235.60879397, 48951903.70676774, 140249234.479832, 48951899.869393006, 1, 1, 140249265.80852687, 48952006.35654189, 33 },
-  { 140249262.88150164, 48951893.598333545, 140249274.84028164, 48951931.76884024, 140249250.92272165, 48951855.42782685, 140249263.47944063, 48951895.50685888, 140249262.28356266, 48951891.68980821, 1, 5, 140249151.3658783, 48951537.65835862, 48 },
-  { 140249290.54170367, 48951884.932421066, 140249303.20762116, 48951922.874146566, 140249277.8757862, 48951846.990695566, 140249291.17499954, 48951886.82950734, 140249289.9084078, 48951883.03533479, 0, 0, 0, 0, 0 },
-  { 140249318.00872266, 48951875.76322827, 140249331.4189067, 48951913.44833095, 140249304.59853864, 48951838.07812558, 140249318.67923185, 48951877.6474834, 140249317.33821347, 48951873.878973134, 0, 0, 0, 0, 0 },
-  { 140249345.2663622, 48951866.06364047, 140249359.45683244, 48951903.46190986, 140249331.07589194, 48951828.665371075, 140249345.9758857, 48951867.933553934, 140249344.5568387, 48951864.193727, 1, 2, 140249419.4115693, 48952061.46959806, 32 },
-  { 140249372.29842573, 48951855.806543015, 140249387.3037963, 48951892.8853625, 140249357.29305518, 48951818.72772353, 140249373.04869425, 48951857.660483986, 140249371.54815722, 48951853.952602044, 1, 1, 140249300.64778128, 48951678.755179994, 44 },
-  { 140249399.08871683, 48951844.96482121, 140249414.94199485, 48951881.689112574, 140249383.23543882, 48951808.24052985, 140249399.88138074, 48951846.80103578, 140249398.29605293, 48951843.12860665, 0, 0, 0, 0, 0 },
-  { 140249425.62098297, 48951833.51127437, 140249442.41274863, 48951869.81604824, 140249408.8292173, 48951797.20650049, 140249426.46057126, 48951835.32651306, 140249424.7813947, 48951831.696035676, 0, 0, 0, 0, 0 },
-  { 140249451.85271677, 48951821.37851386, 140249469.82211795, 48951857.115058474, 140249433.8833156, 48951785.64196924, 140249452.75118685, 48951823.16534109, 140249450.9542467, 48951819.59168663, 0, 0, 0, 0, 0 },
-  { 140249477.67342815, 48951808.39508956, 140249497.07068434, 48951843.37717714, 140249458.27617195, 48951773.41300198, 140249478.64329097, 48951810.14419394, 140249476.70356533, 48951806.64598518, 1, 5, 140249309.40223053, 48951504.92547979, 47 },
-  { 140249502.96176833, 48951794.372930005, 140249524.01491797, 48951828.38417652, 140249481.9086187, 48951760.36168349, 140249504.0144258, 48951796.07349233, 140249501.90911084, 48951792.67236768, 1, 0, 140249655.5971033, 48952040.95446726, 35 },
-  { 140249527.5963886, 48951779.12396384, 140249550.49996215, 48951811.91765713, 140249504.69281507, 48951746.33027055, 140249528.74156728, 48951780.7636485, 140249526.45120993, 48951777.48427918, 1, 0, 140249407.92521688, 48951607.776916414, 50 },
-  { 140249551.45594028, 48951762.46011963, 140249576.35743743, 48951793.7637207, 140249526.55444312, 48951731.156518556, 140249552.70101514, 48951764.02529968, 140249550.2108654, 48951760.89493957, 0, 0, 0, 0, 0 },
-  { 140249574.41907454, 48951744.19332595, 140249601.4050626, 48951773.71884795, 140249547.43308648, 48951714.66780395, 140249575.76837394, 48951745.66960205, 140249573.06977513, 48951742.71704985, 0, 0, 0, 0, 0 },
-  { 140249596.36444274, 48951724.135511436, 140249625.4242817, 48951751.622340284, 140249567.3046038, 48951696.64868259, 140249597.8174347, 48951725.50985288, 140249594.91145077, 48951722.76116999, 1, 3, 140249815.76622683, 48951931.661069244, 40 },
-  { 140249617.18469718, 48951702.12376012, 140249647.98703265, 48951727.642696805, 140249586.3823617, 48951676.60482343, 140249618.72481397, 48951703.39970695, 140249615.6445804, 48951700.847813286, 0, 0, 0, 0, 0 },
-  { 140249636.9340855, 48951678.28549086, 140249669.04125223, 48951702.14193327, 140249604.82691875, 48951654.429048456, 140249638.53944382, 48951679.478312984, 140249635.32872716, 48951677.09266874, 0, 0, 0, 0, 0 },
-  { 140249655.77055874, 48951652.93444408, 140249688.82952014, 48951675.45343766, 140249622.71159735, 48951630.41545049, 140249657.42350683, 48951654.06039376, 140249654.11761066, 48951651.8084944, 0, 0, 0, 0, 0 },
-  { 140249673.85377166, 48951626.38742123, 140249707.57984567, 48951647.89444177, 140249640.12769765, 48951604.88040069, 140249675.54007536, 48951627.46277226, 140249672.16746795, 48951625.3120702, 0, 0, 0, 0, 0 },
-  { 140249691.34337896, 48951598.961223856, 140249725.50094497, 48951619.77613878, 140249657.18581295, 48951578.14630893, 140249693.05125725, 48951600.0019696, 140249689.63550067, 48951597.92047811, 0, 0, 0, 0, 0 },
-  { 140249708.39903542, 48951570.972653456, 140249742.78395206, 48951591.40981345, 140249674.0141188, 48951550.53549346, 140249710.11828125, 48951571.994511455, 140249706.6797896, 48951569.95079546, 0, 0, 0, 0, 0 },
-  { 140249725.18039575, 48951542.738511525, 140249759.60406676, 48951563.110327214, 140249690.75672475, 48951522.366695836, 140249726.9015793, 48951543.75710231, 140249723.4592122, 48951541.71992074, 1, 2, 140249498.84475887, 48951408.79382339, 26 },
-  { 140249741.84711474, 48951514.57559958, 140249776.12132475, 48951535.19788189, 140249707.57290474, 48951493.95331727, 140249743.56082523, 48951515.6067137, 140249740.13340425, 48951513.544485465, 1, 2, 140250052.88557068, 48951701.72281152, 30 },
-  { 140249758.55884713, 48951486.800719135, 140249792.48011914, 48951507.998532824, 140249724.63757512, 48951465.602905445, 140249760.25491074, 48951487.86060982, 140249756.86278352, 48951485.74082845, 0, 0, 0, 0, 0 },
-  { 140249775.47524762, 48951459.73067168, 140249808.80730715, 48951481.843423836, 140249742.1431881, 48951437.61791953, 140249777.1418506, 48951460.83630929, 140249773.80864465, 48951458.62503407, 1, 3, 140249940.46894225, 48951569.18879485, 40 },
-  { 140249792.75597098, 48951433.682258725, 140249825.20892414, 48951457.066138454, 140249760.30301782, 48951410.298379, 140249794.37861866, 48951434.85145271, 140249791.1333233, 48951432.51306474, 0, 0, 0, 0, 0 },
-  { 140249810.56067201, 48951408.9722818, 140249841.76599357, 48951433.99682787, 140249779.35535046, 48951383.94773573, 140249812.1209381, 48951410.2235091, 140249809.00040594, 48951407.721054494, 0, 0, 0, 0, 0 },
-  { 140249829.04900542, 48951385.91754237, 140249858.53112236, 48951412.95094358, 140249799.56688848, 48951358.884141155, 140249830.52311125, 48951387.26921243, 140249827.57489958, 48951384.565872304, 0, 0, 0, 0, 0 },
-  { 140249848.380626, 48951364.83484198, 140249875.53015035, 48951394.21005819, 140249821.23110163, 48951335.45962577, 140249849.7381022, 48951366.30360279, 140249847.0231498, 48951363.36608117, 0, 0, 0, 0, 0 },
-  { 140249868.71518838, 48951346.04098212, 140249892.7773088, 48951377.99429747, 140249844.65306798, 48951314.08766677, 140249869.9182944, 48951347.638647884, 140249867.51208237, 48951344.443316355, 0, 0, 0, 0, 0 },
-  { 140249890.21234742, 48951329.8527643, 140249910.31566522, 48951364.43392411, 140249870.10902962, 48951295.27160449, 140249891.2175133, 48951331.58182229, 140249889.20718154, 48951328.12370631, 1, 1, 140250030.43298906, 48951571.05635395, 25 },
-  { 140249913.03175786, 48951316.58699003, 140249928.2879024, 48951353.56333453, 140249897.7756133, 48951279.610645525, 140249913.79456508, 48951318.43580725, 140249912.26895064, 48951314.73817281, 0, 0, 0, 0, 0 },
-  { 140249937.3330744, 48951306.56046082, 140249947.01304436, 48951345.371518284, 140249927.65310442, 48951267.74940336, 140249937.8170729, 48951308.501013696, 140249936.84907588, 48951304.619907945, 1, 1, 140249978.4729468, 48951471.507455036, 39 },
-  { 140249963.2759518, 48951300.08997816, 140249967.00477886, 48951339.91579703, 140249959.54712474, 48951260.264159285, 140249963.46239316, 48951302.0812691, 140249963.08951044, 48951298.09868722, 0, 0, 0, 0, 0 },
-  { 140249991.02004483, 48951297.49234357, 140249994.40499538, 48951337.3488626, 140249987.63509429, 48951257.63582453, 140249991.18929237, 48951299.48516952, 140249990.8507973, 48951295.49951761, 1, 4, 140250001.85188654, 48951425.03320449, 30 },
-  { 140250019.0505056, 48951295.11176128, 140250034.24027866, 48951332.11542049, 140250003.86073256, 48951258.10810207, 140250019.80999425, 48951296.96194424, 140250018.29101697, 48951293.26157832, 0, 0, 0, 0, 0 },
-  { 140250043.9615063, 48951284.8859497, 140250068.18933135, 48951316.7138069, 140250019.73368126, 48951253.058092505, 140250045.17289755, 48951286.47734256, 140250042.75011507, 48951283.29455684, 1, 0, 140250272.30875733, 48951584.86350378, 41 },
-  { 140250066.1970972, 48951267.95989644, 140250095.74171144, 48951294.92498073, 140250036.652483, 48951240.994812146, 140250067.6743279, 48951269.30815065, 140250064.7198665, 48951266.61164223, 0, 0, 0, 0, 0 },
-  { 140250086.3633237, 48951245.864531375, 140250118.72026858, 48951269.381081216, 140250054.0063788, 48951222.347981535, 140250087.98117092, 48951247.04035887, 140250084.74547645, 48951244.68870388, 0, 0, 0, 0, 0 },
-  { 140250105.06623107, 48951220.130784385, 140250138.74210492, 48951241.71632401, 140250071.39035723, 48951198.54524476, 140250106.75002477, 48951221.210061364, 140250103.38243738, 48951219.051507406, 1, 3, 140249898.80150378, 48951087.9193542, 27 },
-  { 140250122.91186464, 48951192.28958536, 140250156.92114872, 48951213.345905, 140250088.90258056, 48951171.23326572, 140250124.61232883, 48951193.34240134, 140250121.21140045, 48951191.23676938, 1, 3, 140250227.49041316, 48951257.03776824, 27 },
-  { 140250140.50626403, 48951163.87184962, 140250174.15934205, 48951185.492912054, 140250106.853186, 48951142.25078718, 140250142.18891793, 48951164.95290274, 140250138.82361013, 48951162.790796496, 0, 0, 0, 0, 0 },
-  { 140250158.33906692, 48951136.11517908, 140250191.50163877, 48951158.481310345, 140250125.17649508, 48951113.74904781, 140250159.9971955, 48951137.23348564, 140250156.68093833, 48951134.996872514, 0, 0, 0, 0, 0 },
-  { 140250176.48457158, 48951109.21058861, 140250209.15147033, 48951132.29464642, 140250143.81767282, 48951086.126530804, 140250178.11791652, 48951110.364791505, 140250174.85122663, 48951108.05638572, 0, 0, 0, 0, 0 },
-  { 140250194.9244775, 48951083.11575968, 140250227.0940942, 48951106.88792324, 140250162.7548608, 48951059.343596116, 140250196.53295833, 48951084.304367855, 140250193.31599665, 48951081.9271515, 1, 3, 140250288.21636596, 48951152.05503402, 28 },
-  { 140250213.64048418, 48951057.788373716, 140250245.31493744, 48951082.21641109, 140250181.96603093, 48951033.36033634, 140250215.22420684, 48951059.00977559, 140250212.05676153, 48951056.566971846, 1, 5, 140250010.1321219, 48950900.838233605, 27 },
-  { 140250232.61429122, 48951033.18611217, 140250263.79953986, 48951058.23566841, 140250201.42904258, 48951008.13655593, 140250234.17355365, 48951034.43858998, 140250231.0550288, 48951031.93363436, 0, 0, 0, 0, 0 },
-  { 140250251.82759804, 48951009.2666565, 140250282.5334947, 48951034.90155281, 140250221.12170136, 48950983.631760195, 140250253.36289287, 48951010.54840132, 140250250.2923032, 48951007.98491169, 1, 0, 140250026.1392574, 48950820.850168645, 31 },
-  { 140250271.26210424, 48950985.987688154, 140250301.50239176, 48951012.17022073, 140250241.02181673, 48950959.805155575, 140250272.77411863, 48950987.296814784, 140250269.75008985, 48950984.67856152, 0, 0, 0, 0, 0 },
-  { 140250290.89950928, 48950963.306888565, 140250320.6917607, 48950989.99811851, 140250261.10725787, 48950936.61565862, 140250292.38912186, 48950964.64145006, 140250289.4098967, 48950961.97232707, 0, 0, 0, 0, 0 },
-  { 140250310.72151276, 48950941.18193919, 140250340.08702108, 48950968.3419635, 140250281.35600445, 48950914.021914884, 140250312.1897882, 48950942.53994041, 140250309.25323734, 48950939.823937975, 1, 0, 140250482.5097365, 48951100.06808139, 49 },
-  { 140250330.70981413, 48950919.57052148, 140250359.6734356, 48950947.158718795, 140250301.74619266, 48950891.98232417, 140250332.1579952, 48950920.949931346, 140250329.26163307, 48950918.19111162, 0, 0, 0, 0, 0 },
-  { 140250350.8461129, 48950898.43031688, 140250379.43607077, 48950926.40556147, 140250322.25615504, 48950870.45507229, 140250352.2756108, 48950899.82907911, 140250349.416615, 48950897.031554654, 1, 2, 140250448.76671857, 48950994.24552959, 29 },
-  { 140250371.11210865, 48950877.71900684, 140250399.35976362, 48950906.03984702, 140250342.86445367, 48950849.39816666, 140250372.5244914, 48950879.135048844, 140250369.6997259, 48950876.30296483, 0, 0, 0, 0, 0 },
-  { 140250391.48950085, 48950857.394272804, 140250419.42909452, 48950886.01907158, 140250363.54990718, 48950828.76947403, 140250392.88648054, 48950858.825512744, 140250390.09252116, 48950855.963032864, 0, 0, 0, 0, 0 },
-  { 140250411.95998904, 48950837.413796194, 140250439.6283658, 48950866.30083353, 140250384.29161227, 48950808.52675886, 140250413.34340787, 48950838.85814806, 140250410.5765702, 48950835.96944433, 1, 5, 140250149.1104096, 48950562.98694149, 25 },
-  { 140250432.5052728, 48950817.73525853, 140250459.94158608, 48950846.842795596, 140250405.06895953, 48950788.62772146, 140250433.87708846, 48950819.19063538, 140250431.13345715, 48950816.27988167, 0, 0, 0, 0, 0 },
-  { 140250453.10705158, 48950798.316341184, 140250480.35245705, 48950827.60264995, 140250425.86164612, 48950769.03003242, 140250454.46932185, 48950799.78065662, 140250451.74478132, 48950796.85202575, 0, 0, 0, 0, 0 },
-  { 140250473.7470249, 48950779.11472564, 140250500.84436533, 48950808.5380861, 140250446.64968446, 48950749.69136518, 140250475.1018919, 48950780.58589367, 140250472.39215788, 48950777.643557616, 0, 0, 0, 0, 0 },
-  { 140250494.4068923, 48950760.08809333, 140250521.40037525, 48950789.60676332, 140250467.41340935, 48950730.56942335, 140250495.75656644, 48950761.56402683, 140250493.05721816, 48950758.61215983, 0, 0, 0, 0, 0 },
-  { 140250515.06835327, 48950741.19412573, 140250542.0032226, 48950770.76628854, 140250488.13348392, 48950711.62196291, 140250516.41509673, 48950742.672733866, 140250513.7216098, 48950739.71551759, 0, 0, 0, 0, 0 },
-  { 140250535.7131074, 48950722.39050426, 140250562.63530976, 48950751.974199444, 140250508.79090506, 48950692.80680908, 140250537.0592175, 48950723.869689025, 140250534.3669973, 48950720.9113195, 0, 0, 0, 0, 0 },
-  { 140250556.32285416, 48950703.634910375, 140250583.27869904, 48950733.18795467, 140250529.36700928, 48950674.08186608, 140250557.6706464, 48950705.11256259, 140250554.97506192, 48950702.15725816, 1, 4, 140250632.47311592, 48950787.122260526, 26 },
-  { 140250576.87929305, 48950684.885025516, 140250603.9151067, 48950714.364930205, 140250549.8434794, 48950655.40512083, 140250578.23108375, 48950686.35902075, 140250575.52750236, 48950683.411030285, 0, 0, 0, 0, 0 },
-  { 140250597.36412367, 48950666.09853116, 140250624.5258959, 48950695.462422766, 140250570.20235145, 48950636.73463955, 140250598.72221228, 48950667.56672574, 140250596.00603506, 48950664.630336575, 1, 2, 140250665.94759852, 48950740.24235746, 43 },
-  { 140250617.75904545, 48950647.233108714, 140250645.09206796, 48950676.437661104, 140250590.42602295, 48950618.028556325, 140250619.12569657, 48950648.69333633, 140250616.39239433, 48950645.7728811, 0, 0, 0, 0, 0 },
-  { 140250638.045758, 48950628.246439666, 140250665.59425563, 48950657.247823745, 140250610.4972604, 48950599.245055586, 140250639.4231829, 48950629.69650887, 140250636.6683331, 48950626.79637046, 1, 1, 140250712.4267016, 48950706.55017667, 40 },
-  { 140250658.20596078, 48950609.09620543, 140250686.0127147, 48950637.85006491, 140250630.39920685, 48950580.342345946, 140250659.5962985, 48950610.533898406, 140250656.81562307, 48950607.65851245, 1, 0, 140250530.29489264, 48950476.82845183, 32 },
-  { 140250678.22135332, 48950589.74008748, 140250706.32731953, 48950618.20154674, 140250650.1153871, 48950561.278628215, 140250679.62665164, 48950591.16316044, 140250676.816055, 48950588.317014515, 0, 0, 0, 0, 0 },
-  { 140250698.07363513, 48950570.135767244, 140250726.51756, 48950598.25947855, 140250669.62971026, 48950542.01205594, 140250699.49583137, 48950571.54195281, 140250696.6514389, 48950568.72958168, 0, 0, 0, 0, 0 },
-  { 140250717.74450576, 48950550.24092618, 140250746.5625445, 48950577.98116129, 140250688.92646703, 48950522.50069106, 140250719.1854077, 48950551.627937935, 140250716.30360383, 48950548.85391442, 0, 0, 0, 0, 0 },
-  { 140250737.21566468, 48950530.01324571, 140250766.44100773, 48950557.32403704, 140250707.99032164, 48950502.70245438, 140250738.67693183, 48950531.378785275, 140250735.75439754, 48950528.64770614, 0, 0, 0, 0, 0 },
-  { 140250756.46881148, 48950509.41040732, 140250786.13128224, 48950536.24579122, 140250726.80634072, 48950482.57502342, 140250757.95193502, 48950510.752176516, 140250754.98568794, 48950508.06863812, 0, 0, 0, 0, 0 },
-  { 140250775.4856698, 48950488.390137754, 140250805.5878005, 48950514.731392995, 140250745.38353908, 48950462.048882514, 140250776.99077633, 48950489.70720052, 140250773.98056325, 48950487.07307499, 0, 0, 0, 0, 0 },
-  { 140250794.26084018, 48950466.93434046, 140250824.74292067, 48950492.834973074, 140250763.7787597, 48950441.03370785, 140250795.7849442, 48950468.22937209, 140250792.73673615, 48950465.63930883, 0, 0, 0, 0, 0 },
-  { 140250812.82296845, 48950445.08883976, 140250843.61942327, 48950470.61487297, 140250782.02651364, 48950419.562806554, 140250814.36279118, 48950446.36514142, 140250811.28314573, 48950443.8125381, 0, 0, 0, 0, 0 },
-  { 140250831.20626256, 48950422.90990262, 140250862.2555042, 48950448.12784451, 140250800.15702093, 48950397.69196072, 140250832.75872463, 48950424.17079971, 140250829.6538005, 48950421.649005525, 0, 0, 0, 0, 0 },
-  { 140250849.44493008, 48950400.45379588, 140250880.68865857, 48950425.43037352, 140250818.2012016, 48950375.47721824, 140250851.0071165, 48950401.70262476, 140250847.88274366, 48950399.204967, 0, 0, 0, 0, 0 },
-  { 140250867.57317895, 48950377.77678649, 140250898.95568258, 48950402.57877163, 140250836.19067532, 48950352.974801354, 140250869.14230412, 48950379.01688575, 140250866.00405377, 48950376.53668723, 0, 0, 0, 0, 0 },
-  { 140250885.6252168, 48950354.93514134, 140250917.0926783, 48950379.62924727, 140250854.15775532, 48950330.24103541, 140250887.1985899, 48950356.16984664, 140250884.05184373, 48950353.70043604, 0, 0, 0, 0, 0 },
-  { 140250903.6352516, 48950331.98512736, 140250935.1350639, 48950356.637953304, 140250872.13543934, 48950307.332301416, 140250905.2102422, 48950333.217768654, 140250902.060261, 48950330.752486065, 0, 0, 0, 0, 0 },
-  { 140250921.63749096, 48950308.98301145, 140250953.11758026, 48950333.66101738, 140250890.15740165, 48950284.30500551, 140250923.21149543, 48950310.21691174, 140250920.0634865, 48950307.74911115, 1, 2, 140250820.11420295, 48950229.3964423, 32 },
-  { 140250939.6661428, 48950285.985060506, 140250971.07429925, 48950310.75455199, 140250908.25798634, 48950261.21556902, 140250941.2365506, 48950287.22353508, 140250938.09573498, 48950284.74658593, 1, 2, 140251223.12475473, 48950509.529721186, 39 },
-  { 140250957.75541472, 48950263.047541454, 140250989.04494217, 48950287.966720246, 140250926.46588728, 48950238.12836266, 140250959.3198911, 48950264.29350039, 140250956.19093835, 48950261.801582515, 0, 0, 0, 0, 0 },
-  { 140250975.93528, 48950240.22016828, 140251007.0993158, 48950265.29611038, 140250944.7712442, 48950215.14422618, 140250977.49348179, 48950241.473965384, 140250974.3770782, 48950238.96637117, 1, 5, 140251236.154979, 48950449.604284815, 39 },
-  { 140250994.2084698, 48950217.51049941, 140251025.25634545, 48950242.73012309, 140250963.16059417, 48950192.29087573, 140250995.7608636, 48950218.7714806, 140250992.656076, 48950216.24951822, 0, 0, 0, 0, 0 },
-  { 140251012.56692922, 48950194.909402266, 140251043.50825453, 48950220.25963676, 140250981.6256039, 48950169.55916777, 140251014.1139955, 48950196.17691399, 140251011.01986295, 48950193.64189054, 1, 3, 140251300.32125446, 48950430.66658308, 42 },
-  { 140251031.00257653, 48950172.40770271, 140251061.847178, 48950197.87553654, 140251000.15797505, 48950146.939868875, 140251032.5448066, 48950173.6810944, 140251029.46034646, 48950171.13431101, 1, 0, 140250859.81503835, 48950031.06122495, 37 },
-  { 140251049.50733003, 48950149.99622669, 140251080.26522973, 48950175.568704195, 140251018.74943033, 48950124.423749186, 140251051.04522502, 48950151.27485057, 140251047.96943504, 48950148.71760281, 1, 4, 140251248.6647306, 48950315.57801855, 42 },
-  { 140251068.0731079, 48950127.66580003, 140251098.754502, 48950153.33001747, 140251037.3917138, 48950102.001582585, 140251069.60717762, 48950128.9490109, 140251066.53903818, 48950126.382589154, 1, 3, 140250950.7167755, 48950029.500168316, 39 },
-  { 140251086.69182846, 48950105.40724863, 140251117.3070666, 48950131.150348574, 140251056.07659033, 48950079.66414869, 140251088.22259036, 48950106.694403626, 140251085.16106656, 48950104.120093636, 0, 0, 0, 0, 0 },
-  { 140251105.35540995, 48950083.21139837, 140251135.91497454, 48950109.02056364, 140251074.79584536, 48950057.4022331, 140251106.8833882, 48950084.50185663, 140251103.8274317, 48950081.92094011, 0, 0, 0, 0, 0 },
-  { 140251124.0557706, 48950061.06907515, 140251154.57025647, 48950086.93152189, 140251093.54128474, 48950035.20662841, 140251125.5814949, 48950062.36219749, 140251122.5300463, 48950059.775952816, 0, 0, 0, 0, 0 },
-  { 140251142.78482875, 48950038.97110484, 140251173.26492304, 48950064.87407479, 140251112.30473447, 48950013.06813489, 140251144.30883348, 48950040.26625334, 140251141.26082402, 48950037.67595634, 0, 0, 0, 0, 0 },
-  { 140251161.53450257, 48950016.90831332, 140251191.99096447, 48950042.839065894, 140251131.07804066, 48949990.97756074, 140251163.05732566, 48950018.20485095, 140251160.01167947, 48950015.61177569, 0, 0, 0, 0, 0 },
-  { 140251180.29671037, 48949994.87152648, 140251210.74035135, 48950020.81733006, 140251149.8530694, 48949968.9257229, 140251181.81889242, 48949996.168816656, 140251178.77452832, 48949993.5742363, 0, 0, 0, 0, 0 },
-  { 140251199.0633704, 48949972.8515702, 140251229.5050343, 48949998.79969342, 140251168.62170652, 48949946.90344697, 140251200.5854536, 48949974.148976356, 140251197.5412872, 48949971.55416404, 0, 0, 0, 0, 0 },
-  { 140251217.82640094, 48949950.83927034, 140251248.27694404, 48949976.77697309, 140251187.37585783, 48949924.901567586, 140251219.3489281, 48949952.13615548, 140251216.30387378, 48949949.5423852, 1, 0, 140251105.15939143, 48949854.86977015, 37 },
-  { 140251236.5777202, 48949928.82545281, 140251267.04799134, 48949954.73997725, 140251206.10744905, 48949902.910928376, 140251238.10123375, 48949930.12117904, 140251235.05420664, 48949927.52972659, 0, 0, 0, 0, 0 },
-  { 140251255.30924648, 48949906.8009435, 140251285.81006706, 48949932.67950499, 140251224.8084259, 48949880.92238201, 140251256.8342875, 48949908.09487157, 140251253.78420547, 48949905.50701543, 0, 0, 0, 0, 0 },
-  { 140251274.01289803, 48949884.756568275, 140251304.55504182, 48949910.58634666, 140251243.47075424, 48949858.92678989, 140251275.5400052, 48949886.0480572, 140251272.48579085, 48949883.46507935, 1, 4, 140251551.18285307, 48950119.16180717, 36 },
-  { 140251292.680593, 48949862.683153, 140251323.2747657, 48949888.451284446, 140251262.08642033, 48949836.91502156, 140251294.21030164, 48949863.97155958, 140251291.1508844, 48949861.39474643, 0, 0, 0, 0, 0 },
-  { 140251311.30424985, 48949840.571523584, 140251341.96106857, 48949866.265092164, 140251280.64743114, 48949814.877955005, 140251312.8370908, 48949841.856202014, 140251309.77140892, 48949839.286845155, 1, 3, 140251476.08465043, 48949978.674454704, 34 },
-  { 140251329.87578675, 48949818.412505925, 140251360.60575914, 48949844.01853641, 140251299.14581436, 48949792.80647544, 140251331.41228536, 48949819.69280745, 140251328.33928815, 48949817.1322044, 1, 4, 140251233.07637373, 48949737.7535099, 32 },
-  { 140251348.38712198, 48949796.19692586, 140251379.20062494, 48949821.70237694, 140251317.573619, 48949770.69147479, 140251349.92779714, 48949797.47219842, 140251346.8464468, 48949794.92165331, 0, 0, 0, 0, 0 },
-  { 140251366.8301737, 48949773.915609315, 140251397.73743173, 48949799.30736783, 140251335.92291567, 48949748.5238508, 140251368.3755366, 48949775.18519724, 140251365.2848108, 48949772.64602139, 1, 5, 140251271.0176738, 48949695.20115792, 46 },
-  { 140251385.19686028, 48949751.55938215, 140251416.2079237, 48949776.824257866, 140251354.18579686, 48949726.29450643, 140251386.74741346, 48949752.822625935, 140251383.6463071, 48949750.29613836, 0, 0, 0, 0, 0 },
-  { 140251403.47909987, 48949729.11907024, 140251434.6038222, 48949754.24379233, 140251372.35437754, 48949703.994348146, 140251405.035336, 48949730.375306346, 140251401.92286375, 48949727.86283413, 1, 2, 140251146.70014068, 48949521.84011298, 40 },
-  { 140251421.66881084, 48949706.58549947, 140251452.91682628, 48949731.556713544, 140251390.4207954, 48949681.6142854, 140251423.2312116, 48949707.83406018, 140251420.1064101, 48949705.33693877, 1, 4, 140251552.12927523, 48949810.84031821, 47 },
-  { 140251439.75791144, 48949683.949495755, 140251471.13861176, 48949708.75376248, 140251408.37721112, 48949659.14522903, 140251441.32694647, 48949685.18970909, 140251438.18887642, 48949682.70928242, 1, 1, 140251173.0219588, 48949473.11322854, 32 },
-  { 140251457.7383198, 48949661.201884925, 140251489.2584682, 48949685.82870455, 140251426.21817142, 48949636.5750653, 140251459.31432724, 48949662.43322591, 140251456.1623124, 48949659.97054394, 1, 5, 140251744.57167026, 48949885.30594351, 39 },
-  { 140251475.6039461, 48949638.335465305, 140251507.23543945, 48949662.81910532, 140251443.97245273, 48949613.85182529, 140251477.18552077, 48949639.55964731, 140251474.0223714, 48949637.1112833, 0, 0, 0, 0, 0 },
-  { 140251493.37814507, 48949615.37219447, 140251525.06707788, 48949639.78144554, 140251461.68921226, 48949590.9629434, 140251494.9625917, 48949616.59265702, 140251491.79369843, 48949614.151731916, 1, 4, 140251658.16059563, 48949742.30030005, 30 },
-  { 140251511.10675737, 48949592.35629766, 140251542.79916078, 48949616.761042416, 140251479.41435397, 48949567.9515529, 140251512.69137755, 48949593.5765349, 140251509.5221372, 48949591.13606042, 1, 3, 140251336.00622857, 48949457.52008288, 44 },
-  { 140251528.83619148, 48949569.33256259, 140251560.4781662, 48949593.80265528, 140251497.19421676, 48949544.8624699, 140251530.4182902, 48949570.55606722, 140251527.25409275, 48949568.109057955, 1, 4, 140251769.3151993, 48949755.30526704, 33 },
-  { 140251546.61285615, 48949546.345777, 140251578.15003288, 48949570.95078631, 140251515.07567942, 48949521.74076769, 140251548.189715, 48949547.57602746, 140251545.0359973, 48949545.115526535, 0, 0, 0, 0, 0 },
-  { 140251564.48315993, 48949523.44072861, 140251595.8601683, 48949548.24966541, 140251533.10615155, 48949498.631791815, 140251566.05201036, 48949524.681175455, 140251562.9143095, 48949522.20028177, 1, 2, 140251740.9788321, 48949662.99099808, 26 },
-  { 140251582.49351138, 48949500.66220517, 140251613.65346697, 48949525.74321726, 140251551.3335558, 48949475.581193075, 140251584.05150917, 48949501.91625577, 140251580.9355136, 48949499.40815456, 1, 2, 140251427.4727323, 48949375.88417, 29 },
-  { 140251600.69031927, 48949478.054994434, 140251631.57434022, 48949503.47501113, 140251569.80629832, 48949452.634977736, 140251602.23452032, 48949479.32599527, 140251599.14611822, 48949476.7839936, 1, 3, 140251724.99850366, 48949580.37056166, 44 },
-  { 140251619.119992, 48949455.6638841, 140251649.666757, 48949481.48819724, 140251588.573227, 48949429.83957097, 140251620.64733022, 48949456.95509976, 140251617.59265375, 48949454.372668445, 1, 1, 140251428.2027108, 48949294.26192702, 28 },
-  { 140251637.82893834, 48949433.533661924, 140251667.97430432, 48949459.82542698, 140251607.68357235, 48949407.24189687, 140251639.33620664, 48949434.84825018, 140251636.32167003, 48949432.21907367, 1, 2, 140251929.48535421, 48949687.90648884, 26 },
-  { 140251656.86356685, 48949411.70911566, 140251686.54026535, 48949438.52876453, 140251627.18686834, 48949384.88946679, 140251658.34740177, 48949413.050098106, 140251655.37973192, 48949410.36813322, 1, 2, 140251516.6411664, 48949284.98627476, 39 },
-  { 140251676.2702861, 48949390.235033, 140251705.4077227, 48949417.63959081, 140251647.1328495, 48949362.83047519, 140251677.72715795, 48949391.605260886, 140251674.81341428, 48949388.86480511, 1, 3, 140251853.28021342, 48949556.71772171, 42 },
-  { 140251696.09550473, 48949369.15620172, 140251724.61968926, 48949397.1985072, 140251667.5713202, 48949341.11389624, 140251697.52171397, 48949370.55831699, 140251694.6692955, 48949367.75408645, 1, 5, 140251437.23853007, 48949114.67227951, 34 },
-  { 140251716.38563135, 48949348.5174095, 140251744.2201279, 48949377.244414255, 140251688.5511348, 48949319.79040475, 140251717.77735618, 48949349.953759745, 140251714.99390653, 48949347.08105926, 0, 0, 0, 0, 0 },
-  { 140251737.18616587, 48949328.36311875, 140251764.2767221, 48949357.79272567, 140251710.09560964, 48949298.93351184, 140251738.54069367, 48949329.8345991, 140251735.83163807, 48949326.891638406, 1, 3, 140251466.2806036, 48949034.06704958, 46 },
-  { 140251758.51623896, 48949308.72834939, 140251784.8354125, 48949338.84978866, 140251732.1970654, 48949278.60691012, 140251759.83219764, 48949310.23442135, 140251757.20028028, 48949307.222277425, 1, 1, 140251954.5940819, 48949533.13307193, 30 },
-  { 140251780.36516103, 48949289.63744318, 140251805.88600954, 48949320.43819465, 140251754.84431252, 48949258.83669171, 140251781.64120346, 48949291.17748075, 140251779.0891186, 48949288.097405605, 0, 0, 0, 0, 0 },
-  { 140251802.72064003, 48949271.11416807, 140251827.41519615, 48949302.58127625, 140251778.02608392, 48949239.64705989, 140251803.95536783, 48949272.68752348, 140251801.48591223, 48949269.540812664, 0, 0, 0, 0, 0 },
-  { 140251825.5703839, 48949253.18229205, 140251849.40965927, 48949285.30220722, 140251801.73110855, 48949221.06237689, 140251826.76234767, 48949254.78828781, 140251824.37842014, 48949251.57629629, 0, 0, 0, 0, 0 },
-  { 140251848.90210074, 48949235.86558311, 140251871.85610616, 48949268.6239963, 140251825.94809532, 48949203.10716991, 140251850.04980102, 48949237.50350377, 140251847.75440046, 48949234.227662444, 0, 0, 0, 0, 0 },
-  { 140251872.70349836, 48949219.18780916, 140251894.74128115, 48949252.56948272, 140251850.66571558, 48949185.8061356, 140251873.8053875, 48949220.85689284, 140251871.60160923, 48949217.518725485, 1, 5, 140251797.2240923, 48949104.855577216, 41 },
-  { 140251896.96228495, 48949203.17273824, 140251918.0519871, 48949237.16133136, 140251875.8725828, 48949169.184145115, 140251898.01677006, 48949204.87216789, 140251895.90779984, 48949201.473308586, 1, 2, 140252051.4443533, 48949452.13918288, 48 },
-  { 140251921.6661683, 48949187.84413843, 140251941.77177563, 48949222.42396713, 140251901.56056097, 48949153.26430973, 140251922.67144868, 48949189.57312986, 140251920.66088793, 48949186.115146995, 0, 0, 0, 0, 0 },
-  { 140251946.80218408, 48949173.22940833, 140251965.8740076, 48949208.3899764, 140251927.73036054, 48949138.068840265, 140251947.75577524, 48949174.987436734, 140251945.8485929, 48949171.47137993, 1, 2, 140252064.57069448, 48949390.34591613, 36 },
-  { 140251972.35493886, 48949159.36906257, 140251990.33781663, 48949195.09882758, 140251954.3720611, 48949123.63929757, 140251973.25408274, 48949161.15555082, 140251971.455795, 48949157.58257432, 0, 0, 0, 0, 0 },
-  { 140251998.3084908, 48949146.30657666, 140252015.14456096, 48949182.590825886, 140251981.47242066, 48949110.02232744, 140251999.15029433, 48949148.120789126, 140251997.4666873, 48949144.4923642, 1, 5, 140252097.220403, 48949359.47654084, 47 },
-  { 140252024.64689812, 48949134.085426085, 140252040.27585655, 48949170.90574192, 140252009.0179397, 48949097.26511025, 140252025.42834604, 48949135.92644188, 140252023.8654502, 48949132.24441029, 0, 0, 0, 0, 0 },
-  { 140252051.35421908, 48949122.749086365, 140252065.7136809, 48949160.082795754, 140252036.99475726, 48949085.415376976, 140252052.07219216, 48949124.61577184, 140252050.636246, 48949120.88240089, 1, 5, 140252173.05065787, 48949439.15227343, 42 },
-  { 140252078.4145118, 48949112.341033, 140252091.44095773, 48949150.160495006, 140252065.38806587, 48949074.52157099, 140252079.0658341, 48949114.232006095, 140252077.7631895, 48949110.4500599, 1, 5, 140251954.66327557, 48948753.0561439, 41 },
-  { 140252105.8117674, 48949102.90438717, 140252117.4806495, 48949141.1645125, 140252094.1428853, 48949064.64426184, 140252106.39521152, 48949104.81739344, 140252105.22832328, 48949100.9913809, 0, 0, 0, 0, 0 },
-  { 140252133.52431738, 48949094.45238981, 140252143.88302663, 48949133.087828755, 140252123.16560814, 48949055.81695086, 140252134.04225284, 48949096.384161755, 140252133.00638193, 48949092.52061786, 1, 5, 140252071.8899974, 48948864.571528055, 37 },
-  { 140252161.5206251, 48949086.946182564, 140252170.6273535, 48949125.895733245, 140252152.41389674, 48949047.99663188, 140252161.97596154, 48949088.8936601, 140252161.0652887, 48949084.99870503, 1, 3, 140252205.2329214, 48949273.90402582, 43 },
-  { 140252189.76816288, 48949080.341673665, 140252197.6838556, 48949119.55062429, 140252181.85247016, 48949041.13272304, 140252190.16394752, 48949082.30212119, 140252189.37237823, 48949078.38122614, 1, 3, 140252154.74122262, 48948906.84206716, 36 },
-  { 140252218.23440275, 48949074.59477139, 140252225.0217489, 48949114.014714725, 140252211.4470566, 48949035.17482806, 140252218.57377005, 48949076.56576856, 140252217.89503545, 48949072.62377422, 0, 0, 0, 0, 0 },
-  { 140252246.8868169, 48949069.66138397, 140252252.60940567, 48949109.24991738, 140252241.1642281, 48949030.07285056, 140252247.17294633, 48949071.64081064, 140252246.60068744, 48949067.681957304, 0, 0, 0, 0, 0 },
-  { 140252275.6928775, 48949065.497419685, 140252280.41451654, 48949105.217768684, 140252270.97123846, 48949025.777070686, 140252275.92895946, 48949067.483437136, 140252275.45679554, 48949063.511402234, 0, 0, 0, 0, 0 },
-  { 140252304.62005675, 48949062.058786795, 140252308.4042419, 48949101.879383765, 140252300.8358716, 48949022.238189824, 140252304.809266, 48949064.049816646, 140252304.4308475, 48949060.06775694, 0, 0, 0, 0, 0 },
-  { 140252333.63582677, 48949059.30139354, 140252336.5453495, 48949099.19543667, 140252330.72630402, 48949019.407350406, 140252333.7813029, 48949061.29609569, 140252333.49035063, 48949057.306691386, 0, 0, 0, 0, 0 },
-  { 140252362.70765978, 48949057.181148194, 140252364.8043028, 48949097.1261615, 140252360.61101675, 48949017.23613489, 140252362.81249192, 48949059.17839886, 140252362.60282764, 48949055.183897525, 0, 0, 0, 0, 0 },
-  { 140252391.8030403, 48949055.65398318, 140252393.13154805, 48949095.631915435, 140252390.47453254, 48949015.67605093, 140252391.86946568, 48949057.6528798, 140252391.7366149, 48949053.65508657, 0, 0, 0, 0, 0 },
-  { 140252420.8952857, 48949054.68721798, 140252421.45858666, 48949094.68325143, 140252420.33198473, 48949014.69118453, 140252420.92345074, 48949056.68701965, 140252420.86712065, 48949052.68741631, 1, 4, 140252419.0786401, 48948925.70001009, 29 },
-  { 140252449.97283432, 48949054.277692094, 140252449.76732245, 48949094.277164154, 140252450.1783462, 48949014.278220035, 140252449.96255872, 48949056.2776657, 140252449.98310992, 48949052.27771849, 1, 3, 140252449.08399552, 48949227.275408745, 34 },
-  { 140252479.02654287, 48949054.42696611, 140252478.0487278, 48949094.41501279, 140252480.00435793, 48949014.438919425, 140252478.97765213, 48949056.426368445, 140252479.0754336, 48949052.42756377, 1, 1, 140252487.58242455, 48948704.53155761, 39 },
-  { 140252508.04726818, 48949055.13660072, 140252506.29379013, 48949095.098148674, 140252509.80074623, 48949015.17505276, 140252507.95959428, 48949057.13467812, 140252508.13494208, 48949053.13852332, 0, 0, 0, 0, 0 },
-  { 140252537.02586678, 48949056.40815648, 140252534.493512, 48949096.327915736, 140252539.55822155, 48949016.48839722, 140252536.89924905, 48949058.40414444, 140252537.1524845, 48949054.41216851, 0, 0, 0, 0, 0 },
-  { 140252565.95319545, 48949058.24319406, 140252562.63891378, 48949098.105651796, 140252569.26747712, 48949018.38073632, 140252565.78748137, 48949060.23631695, 140252566.11890954, 48949056.25007117, 0, 0, 0, 0, 0 },
-  { 140252594.82011092, 48949060.64327409, 140252590.72103414, 48949100.43268938, 140252598.9191877, 48949020.8538588, 140252594.61515707, 48949062.632744856, 140252595.02506477, 48949058.653803326, 1, 1, 140252615.93035632, 48948855.72778532, 34 },
-  { 140252623.61746982, 48949063.60995717, 140252618.73093626, 48949103.31035755, 140252628.50400338, 48949023.9095568, 140252623.37314314, 48949065.59497719, 140252623.8617965, 48949061.624937154, 0, 0, 0, 0, 0 },
-  { 140252652.33613008, 48949067.14480054, 140252646.67843693, 48949106.74266043, 140252657.99382323, 48949027.54694064, 140252652.05324543, 48949069.12469353, 140252652.61901474, 48949065.164907545, 1, 2, 140252703.53825316, 48948708.7841685, 48 },
-  { 140252680.971266, 48949071.236153275, 140252674.62013388, 48949110.72872373, 140252687.32239813, 48949031.74358282, 140252680.65370938, 48949073.2107818, 140252681.28882262, 48949069.26152475, 0, 0, 0, 0, 0 },
-  { 140252709.53213626, 48949075.829266824, 140252702.57782498, 48949115.22009767, 140252716.48644754, 48949036.43843598, 140252709.1844207, 48949077.798808366, 140252709.87985182, 48949073.85972528, 0, 0, 0, 0, 0 },
-  { 140252738.030868, 48949080.860616684, 140252730.56336918, 48949120.15739087, 140252745.4983668, 48949041.5638425, 140252737.65749305, 48949082.82545539, 140252738.40424293, 48949078.89577798, 1, 4, 140252707.97418532, 48949239.03013279, 31 },
-  { 140252766.47958794, 48949086.26667829, 140252758.58838898, 48949125.48056587, 140252774.3707869, 48949047.05279071, 140252766.085028, 48949088.22737267, 140252766.8741479, 48949084.30598391, 0, 0, 0, 0, 0 },
-  { 140252794.89042303, 48949091.9839271, 140252786.66439062, 48949131.128944546, 140252803.11645544, 48949052.838909656, 140252794.47912142, 48949093.94117797, 140252795.30172464, 48949090.02667623, 1, 5, 140252743.68337134, 48949335.66166071, 30 },
-  { 140252823.27550018, 48949097.94883859, 140252814.80286184, 48949137.04122148, 140252831.74813852, 48949058.856455706, 140252822.85186827, 48949099.90345774, 140252823.69913208, 48949095.994219445, 0, 0, 0, 0, 0 },
-  { 140252851.6469463, 48949104.09788822, 140252843.01534775, 48949143.15548039, 140252860.27854487, 48949065.04029604, 140252851.2153664, 48949106.050767824, 140252852.07852623, 48949102.14500861, 1, 3, 140252798.5626152, 48949344.30208008, 41 },
-  { 140252880.01688823, 48949110.36755145, 140252871.31350577, 48949149.409210406, 140252888.7202707, 48949071.3258925, 140252879.5817191, 48949112.3196344, 140252880.45205736, 48949108.41546851, 0, 0, 0, 0, 0 },
-  { 140252908.3974529, 48949116.69430384, 140252899.6893147, 48949155.734902315, 140252917.1055911, 48949077.653705366, 140252907.96204597, 48949118.64633376, 140252908.8328598, 48949114.74227392, 0, 0, 0, 0, 0 },
-  { 140252936.79722607, 48949123.02896978, 140252928.07622975, 48949162.066697985, 140252945.5182224, 48949083.991241574, 140252936.36117625, 48949124.98085619, 140252937.2332759, 48949121.07708337, 0, 0, 0, 0, 0 },
-  { 140252965.2113937, 48949129.37667142, 140252956.45172843, 48949168.405740894, 140252973.971059, 48949090.34760194, 140252964.77341044, 48949131.328124896, 140252965.649377, 48949127.42521794, 0, 0, 0, 0, 0 },
-  { 140252993.6319727, 48949135.755372286, 140252984.80786416, 48949174.76992225, 140253002.45608124, 48949096.74082232, 140252993.1907673, 48949137.706099786, 140252994.0731781, 48949133.804644786, 1, 3, 140253050.98867813, 48948882.16079754, 35 },
-  { 140253022.05097985, 48949142.1830359, 140253013.1366823, 48949181.17707775, 140253030.9652774, 48949103.18899406, 140253021.60526496, 48949144.132737994, 140253022.49669474, 48949140.23333381, 1, 3, 140252987.95379177, 48949291.33524596, 39 },
-  { 140253050.46043208, 48949148.6776258, 140253041.4302214, 48949187.644987725, 140253059.49064276, 48949109.71026387, 140253050.00892156, 48949150.62599389, 140253050.9119426, 48949146.7292577, 1, 3, 140253090.41911426, 48948976.24704928, 34 },
-  { 140253078.85234627, 48949155.257105485, 140253069.68051505, 48949194.19137717, 140253088.0241775, 48949116.3228338, 140253078.39375472, 48949157.20381907, 140253079.31093782, 48949153.3103919, 1, 1, 140253015.10811925, 48949425.85029372, 27 },
-  { 140253107.21873933, 48949161.939438514, 140253097.87959427, 48949200.833915874, 140253116.5578844, 48949123.044961154, 140253106.7517821, 48949163.88416238, 140253107.68569657, 48949159.99471465, 1, 3, 140253131.73399514, 48949059.84143544, 26 },
-  { 140253135.55162808, 48949168.74258838, 140253126.0194903, 48949207.59021828, 140253145.08376586, 48949129.894958474, 140253135.0750212, 48949170.68496987, 140253136.02823496, 48949166.800206885, 1, 5, 140253106.00200093, 48949289.17024108, 43 },
-  { 140253163.8430294, 48949175.68451859, 140253154.09223813, 48949214.47784365, 140253173.5938207, 48949136.89119353, 140253163.35548985, 48949177.62418485, 140253164.33056897, 48949173.744852334, 1, 3, 140253222.34777713, 48948942.92456822, 28 },
-  { 140253192.08496022, 48949182.78319272, 140253182.0898806, 48949221.51429628, 140253202.08003986, 48949144.052089155, 140253191.58520624, 48949184.71974789, 140253192.5847142, 48949180.84663754, 0, 0, 0, 0, 0 },
-  { 140253220.2694374, 48949190.056574255, 140253210.0044726, 48949228.7170256, 140253230.5344022, 48949151.39612291, 140253219.75618917, 48949191.98959682, 140253220.78268564, 48949188.12355169, 1, 3, 140253300.8494109, 48948886.5720312, 49 },
-  { 140253248.38847774, 48949197.522626735, 140253237.82808653, 48949236.103426844, 140253258.94886896, 48949158.94182663, 140253247.8604582, 48949199.45166674, 140253248.9164973, 48949195.59358673, 0, 0, 0, 0, 0 },
-  { 140253276.4340982, 48949205.19931367, 140253265.55281764, 48949243.69084174, 140253287.3153788, 48949166.7077856, 140253275.8900342, 48949207.12389007, 140253276.97816223, 48949203.27473727, 1, 1, 140253312.88638812, 48949076.25269464, 40 },
-  { 140253304.39831567, 48949213.10459858, 140253293.17079043, 48949251.49655969, 140253315.6258409, 48949174.71263748, 140253303.8369394, 48949215.02419664, 140253304.95969194, 48949211.185000524, 1, 3, 140253274.92606196, 48949313.88349648, 37 },
-  { 140253332.27314696, 48949221.25644502, 140253320.6741655, 48949259.53781945, 140253343.87212843, 48949182.97507059, 140253331.69319788, 48949223.17051374, 140253332.85309604, 48949219.3423763, 0, 0, 0, 0, 0 },
-  { 140253360.05060896, 48949229.672816485, 140253348.05514646, 48949267.83181122, 140253372.04607147, 48949191.51382175, 140253359.45083582, 48949231.58076622, 140253360.6503821, 48949227.76486675, 1, 1, 140253249.99224046, 48949579.78159318, 48 },
-  { 140253387.72271863, 48949238.37167651, 140253375.30598813, 48949276.3956795, 140253400.13944912, 48949200.34767352, 140253387.1018821, 48949240.272876665, 140253388.34355515, 48949236.47047636, 0, 0, 0, 0, 0 },
-  { 140253415.2814927, 48949247.37098863, 140253402.41900438, 48949285.24652683, 140253428.14398104, 48949209.49545043, 140253414.63836828, 48949249.26476554, 140253415.92461714, 48949245.47721172, 0, 0, 0, 0, 0 },
-  { 140253442.71894822, 48949256.68871633, 140253429.38657665, 48949294.401418015, 140253456.05131978, 48949218.976014644, 140253442.05232963, 48949258.574351415, 140253443.3855668, 48949254.803081244, 1, 2, 140253483.71599075, 48949140.72215864, 36 },
-  { 140253470.0271019, 48949266.34282318, 140253456.20116287, 48949303.87738604, 140253483.85304093, 48949228.808260314, 140253469.33580494, 48949268.21955132, 140253470.71839887, 48949264.46609504, 0, 0, 0, 0, 0 },
-  { 140253497.19797078, 48949276.35127267, 140253482.8553059, 48949313.691438235, 140253511.54063565, 48949239.01110711, 140253496.48083752, 48949278.21828095, 140253497.91510403, 48949274.484264396, 0, 0, 0, 0, 0 },
-  { 140253524.2235716, 48949286.73202834, 140253509.3416425, 48949323.86056435, 140253539.1055007, 48949249.603492334, 140253523.47947514, 48949288.58845514, 140253524.96766806, 48949284.875601545, 0, 0, 0, 0, 0 },
-  { 140253551.0959213, 48949297.50305372, 140253535.65291157, 48949334.40174543, 140253566.53893104, 48949260.604362, 140253550.32377082, 48949299.3479883, 140253551.8680718, 48949295.658119135, 0, 0, 0, 0, 0 },
-  { 140253577.80703673, 48949308.682312295, 140253561.78196207, 48949345.331964165, 140253593.8321114, 48949272.032660425, 140253577.005783, 48949310.514794886, 140253578.60829046, 48949306.8498297, 0, 0, 0, 0, 0 },
-  { 140253604.3489348, 48949320.287767634, 140253587.72176033, 48949356.66821664, 140253620.97610927, 48949283.90731863, 140253603.51757607, 48949322.10679008, 140253605.18029353, 48949318.46874519, 1, 2, 140253742.3544828, 48949018.33004092, 30 },
-  { 140253630.71363238, 48949332.33738324, 140253613.46539584, 48949368.42752505, 140253647.9618689, 48949296.24724143, 140253629.85122055, 48949334.14189033, 140253631.5760442, 48949330.53287615, 1, 5, 140253487.553269, 48949631.88556027, 41 },
-  { 140253656.8931463, 48949344.849122636, 140253639.00190428, 48949380.62486105, 140253674.78438833, 48949309.073384225, 140253655.9985842, 48949346.637909554, 140253657.7877084, 48949343.06033572, 1, 4, 140253715.03968287, 48949228.57797279, 37 },
-  { 140253682.87597492, 48949357.84298652, 140253664.28041074, 48949393.25774323, 140253701.4715391, 48949322.4282298, 140253681.9461967, 48949359.61372435, 140253683.80575314, 48949356.07224868, 0, 0, 0, 0, 0 },
-  { 140253708.6164262, 48949371.35877084, 140253689.23370442, 48949406.34891369, 140253727.99914798, 48949336.36862799, 140253707.6472901, 48949373.108277984, 140253709.5855623, 48949369.609263696, 0, 0, 0, 0, 0 },
-  { 140253734.04956853, 48949385.44741071, 140253713.79845282, 48949419.94222645, 140253754.30068424, 48949350.95259497, 140253733.03701276, 48949387.1721515, 140253735.0621243, 48949383.72266992, 0, 0, 0, 0, 0 },
-  { 140253759.11025548, 48949400.159965634, 140253737.91217884, 48949434.08107333, 140253780.30833212, 48949366.23885794, 140253758.05035165, 48949401.85602102, 140253760.1701593, 48949398.46391025, 1, 3, 140253967.3813584, 48949066.885082565, 33 },
-  { 140253783.73334062, 48949415.54749515, 140253761.51351553, 48949448.80827345, 140253805.9531657, 48949382.28671685, 140253782.62234938, 48949417.210534066, 140253784.84433186, 48949413.88445623, 0, 0, 0, 0, 0 },
-  { 140253807.8536775, 48949431.661058754, 140253784.54252008, 48949464.166288175, 140253831.16483495, 48949399.15582933, 140253806.68811965, 48949433.286320224, 140253809.01923537, 48949430.03579728, 0, 0, 0, 0, 0 },
-  { 140253831.40611973, 48949448.551715985, 140253806.94103816, 48949480.19756536, 140253855.8712013, 48949416.90586661, 140253830.18286565, 48949450.13400845, 140253832.62937382, 48949446.96942352, 0, 0, 0, 0, 0 },
-  { 140253854.32554847, 48949466.27049127, 140253828.71174398, 48949496.99398424, 140253879.93935296, 48949435.54699831, 140253853.04485825, 48949467.80666592, 140253855.6062387, 48949464.734316625, 0, 0, 0, 0, 0 },
-  { 140253876.5812696, 48949484.824816786, 140253849.996871, 48949514.71243547, 140253903.1656682, 48949454.9371981, 140253875.25204965, 48949486.31919772, 140253877.91048953, 48949483.33043585, 0, 0, 0, 0, 0 },
-  { 140253898.24416357, 48949504.0934984, 140253870.88569683, 48949533.2742163, 140253925.60263032, 48949474.9127805, 140253896.87624022, 48949505.5525343, 140253899.61208692, 48949502.634462506, 1, 3, 140254171.82883108, 48949212.28631943, 37 },
-  { 140253919.40375426, 48949523.93173406, 140253891.45442936, 48949552.547031336, 140253947.35307917, 48949495.31643679, 140253918.00628802, 48949525.362498924, 140253920.8012205, 48949522.5009692, 0, 0, 0, 0, 0 },
-  { 140253940.1495653, 48949544.19472164, 140253911.76658666, 48949572.3799398, 140253968.53254396, 48949516.00950348, 140253938.7304164, 48949545.603982545, 140253941.56871423, 48949542.78546073, 1, 5, 140254128.89637336, 48949356.76302088, 27 },
-  { 140253960.56317055, 48949564.751558155, 140253931.8032528, 48949592.55204609, 140253989.32308832, 48949536.95107022, 140253959.12517467, 48949566.14158255, 140253962.00116643, 48949563.36153376, 0, 0, 0, 0, 0 },
-  { 140253980.67618042, 48949585.55869332, 140253951.55855733, 48949612.98430226, 140254009.7938035, 48949558.13308438, 140253979.22029927, 48949586.929973766, 140253982.13206157, 48949584.18741287, 1, 5, 140254106.60990027, 48949466.94293464, 28 },
-  { 140254000.5008418, 48949606.60643081, 140253971.04436252, 48949633.667765364, 140254029.95732108, 48949579.54509626, 140253999.02801782, 48949607.95949754, 140254001.97366577, 48949605.253364086, 1, 5, 140253781.78648305, 48949807.53683986, 28 },
-  { 140254020.04935914, 48949627.885148436, 140253990.27253535, 48949654.5935884, 140254049.82618293, 48949601.176708475, 140254018.56051797, 48949629.22057043, 140254021.53820032, 48949626.54972644, 1, 5, 140254103.42446575, 48949553.10151655, 26 },
-  { 140254039.33393702, 48949649.385224, 140254009.25491676, 48949675.75286592, 140254069.41295728, 48949623.01758208, 140254037.829986, 48949650.7036061, 140254040.83788803, 48949648.0668419, 0, 0, 0, 0, 0 },
-  { 140254058.36677986, 48949671.09703529, 140254028.0033278, 48949697.13663548, 140254088.73023194, 48949645.057435095, 140254056.84860727, 48949672.3990153, 140254059.88495246, 48949669.79505528, 1, 0, 140254169.19337994, 48949576.05249459, 41 },
-  { 140254077.1600923, 48949693.010960124, 140254046.52957547, 48949718.73587877, 140254107.79060912, 48949667.286041476, 140254075.62856644, 48949694.29720606, 140254078.69161814, 48949691.72471419, 1, 2, 140253829.818669, 48949900.7396782, 48 },
-  { 140254095.72607866, 48949715.1173763, 140254064.84545854, 48949740.54152428, 140254126.60669878, 48949689.69322831, 140254094.18204767, 48949716.3885837, 140254097.27010965, 48949713.8461689, 0, 0, 0, 0, 0 },
-  { 140254114.07694358, 48949737.406661615, 140254082.96277234, 48949762.544448875, 140254145.1911148, 48949712.268874355, 140254112.52123502, 48949738.66355098, 140254115.63265213, 48949736.14977225, 0, 0, 0, 0, 0 },
-  { 140254132.22489142, 48949759.86919386, 140254100.89331368, 48949784.735480994, 140254163.55646917, 48949735.002906725, 140254130.65831253, 48949761.112508215, 140254133.79147032, 48949758.625879504, 1, 2, 140254336.66343623, 48949597.6166703, 41 },
-  { 140254150.1821268, 48949782.49535083, 140254118.64888492, 48949807.10540279, 140254181.71536866, 48949757.88529887, 140254148.6054647, 48949783.72585343, 140254151.75878888, 48949781.26484823, 0, 0, 0, 0, 0 },
-  { 140254167.96085414, 48949805.27551036, 140254136.24129793, 48949829.644953385, 140254199.68041036, 48949780.90606734, 140254166.37487632, 48949806.493982516, 140254169.54683197, 48949804.05703821, 0, 0, 0, 0, 0 },
-  { 140254185.57327798, 48949828.200050235, 140254153.68237734, 48949852.344831385, 140254217.46417862, 48949804.055269085, 140254183.97873294, 48949829.40728929, 140254187.16782302, 48949826.99281118, 1, 0, 140253906.52789745, 48950039.46688531, 42 },
-  { 140254203.03160286, 48949851.25934824, 140254170.98396367, 48949875.19569763, 140254235.07924205, 48949827.32299886, 140254201.42922089, 48949852.456165716, 140254204.63398483, 48949850.06253077, 0, 0, 0, 0, 0 },
-  { 140254220.3480332, 48949874.443782195, 140254188.1579159, 48949898.18817834, 140254252.5381505, 48949850.69938605, 140254218.73852733, 48949875.631002, 140254221.95753905, 48949873.25656239, 1, 3, 140253939.48925972, 48950081.61363851, 33 },
-  { 140254237.53477353, 48949897.74372987, 140254205.21611378, 48949921.31286713, 140254269.85343328, 48949874.17459261, 140254235.91884053, 48949898.92218673, 140254239.15070653, 48949896.565273, 0, 0, 0, 0, 0 },
-  { 140254254.6040283, 48949921.14956911, 140254222.17045996, 48949944.56032824, 140254287.03759667, 48949897.73880998, 140254252.9823499, 48949922.320107065, 140254256.22570673, 48949919.97903115, 0, 0, 0, 0, 0 },
-  { 140254271.56800207, 48949944.651677676, 140254239.03288153, 48949967.921098195, 140254304.10312262, 48949921.382257156, 140254269.94124606, 48949945.815148704, 140254273.1947581, 48949943.48820665, 1, 5, 140254521.27505225, 48949766.0588752, 48 },
-  { 140254288.43889934, 48949968.24043339, 140254255.81533158, 48949991.38568831, 140254321.0624671, 48949945.09517846, 140254286.80772096, 48949969.39769614, 140254290.07007772, 48949967.08317064, 1, 4, 140254193.0149636, 48950035.94030405, 39 },
-  { 140254305.22892457, 48949991.906214036, 140254272.52979022, 48950014.944586664, 140254337.92805892, 48949968.86784141, 140254303.59396785, 48949993.05813267, 140254306.8638813, 48949990.7542954, 1, 5, 140254543.1151269, 48949824.30205318, 34 },
-  { 140254321.9502823, 48950015.63939744, 140254289.1882659, 48950038.58825971, 140254354.71229872, 48949992.69053517, 140254320.31218147, 48950016.78684056, 140254323.58838314, 48950014.49195433, 0, 0, 0, 0, 0 },
-  { 140254338.61517704, 48950039.43036139, 140254305.8027957, 48950062.3071538, 140254371.42755836, 48950016.55356898, 140254336.97455797, 48950040.57420101, 140254340.2557961, 48950038.28652177, 1, 1, 140254569.12215593, 48949878.720894724, 26 },
-  { 140254355.2358132, 48950063.269483685, 140254322.3854465, 48950086.09169672, 140254388.0861799, 48950040.447270654, 140254353.59329486, 48950064.41059434, 140254356.87833154, 48950062.128373034, 0, 0, 0, 0, 0 },
-  { 140254371.8243954, 48950087.147142135, 140254338.948315, 48950109.932298236, 140254404.70047578, 48950064.36198603, 140254370.18059137, 48950088.28639994, 140254373.4681994, 48950086.00788433, 0, 0, 0, 0, 0 },
-  { 140254388.39312795, 48950111.053714514, 140254355.5035283, 48950133.81935166, 140254421.2827276, 48950088.28807737, 140254386.74864796, 48950112.19199637, 140254390.03760794, 48950109.915432654, 1, 0, 140254192.70001003, 48950246.50925554, 33 },
-  { 140254404.95421556, 48950134.979578644, 140254372.06324393, 48950157.74323355, 140254437.8451872, 48950112.21592374, 140254403.30966696, 48950136.11776139, 140254406.59876415, 48950133.8413959, 0, 0, 0, 0, 0 },
-  { 140254421.51986265, 48950158.91511233, 140254388.6396498, 48950181.69430467, 140254454.4000755, 48950136.135919996, 140254419.87585202, 48950160.05407195, 140254423.16387329, 48950157.776152715, 1, 1, 140254227.5266069, 48950293.31234712, 29 },
-  { 140254438.10227367, 48950182.85069335, 140254405.24496433, 48950205.662909895, 140254470.959583, 48950160.03847681, 140254436.4594082, 48950183.99130418, 140254439.74513915, 48950181.71008252, 1, 2, 140254643.460457, 48950040.274339974, 31 },
-  { 140254454.71365315, 48950206.77669953, 140254421.8914361, 48950229.63937803, 140254487.5358702, 48950183.91402102, 140254453.0725423, 48950207.91983345, 140254456.35476398, 48950205.633565605, 0, 0, 0, 0, 0 },
-  { 140254471.3662056, 48950230.68350865, 140254438.59134346, 48950253.614021346, 140254504.14106774, 48950207.75299595, 140254469.7274625, 48950231.830034286, 140254473.0049487, 48950229.53698301, 0, 0, 0, 0, 0 },
-  { 140254488.07213554, 48950254.56149854, 140254455.35699415, 48950277.57713506, 140254520.78727692, 48950231.54586201, 140254486.43637848, 48950255.71228036, 140254489.7078926, 48950253.41071671, 1, 1, 140254210.81131238, 48950449.619018115, 38 },
-  { 140254504.8436474, 48950278.401046954, 140254472.20072463, 48950301.518996544, 140254537.48657015, 48950255.283097364, 140254503.21150124, 48950279.55694444, 140254506.47579354, 48950277.24514947, 0, 0, 0, 0, 0 },
-  { 140254521.69294578, 48950302.192531735, 140254489.13489923, 48950325.429863885, 140254554.25099233, 48950278.955199584, 140254520.06504345, 48950303.35439834, 140254523.3208481, 48950301.03066513, 0, 0, 0, 0, 0 },
-  { 140254538.63223505, 48950325.92633065, 140254506.17190936, 48950349.29997513, 140254571.09256074, 48950302.55268617, 140254537.00921875, 48950327.09501287, 140254540.25525135, 48950324.75764842, 0, 0, 0, 0, 0 },
-  { 140254555.67371976, 48950349.59282154, 140254523.3241724, 48950373.11954647, 140254588.02326712, 48950326.066096604, 140254554.0562424, 48950350.76915778, 140254557.29119712, 48950348.416485295, 1, 1, 140254310.62589857, 48950527.80776289, 43 },
-  { 140254572.82960445, 48950373.18238216, 140254540.60413033, 48950396.87877044, 140254605.05507857, 48950349.48599388, 140254571.21833074, 48950374.367201574, 140254574.44087815, 48950371.99756274, 0, 0, 0, 0, 0 },
-  { 140254590.11209363, 48950396.685390346, 140254558.0244002, 48950420.56801857, 140254622.19978705, 48950372.80276212, 140254588.50770897, 48950397.87952176, 140254591.7164783, 48950395.491258934, 0, 0, 0, 0, 0 },
-  { 140254607.53350836, 48950420.09206944, 140254575.61482635, 48950444.20011246, 140254639.45219037, 48950395.98402642, 140254605.93757427, 48950421.29747159, 140254609.12944245, 48950418.88666729, 1, 0, 140254728.82450002, 48950328.481505945, 27 },
-  { 140254625.1192493, 48950443.37532279, 140254593.43501744, 48950467.79067555, 140254656.8034812, 48950418.95997003, 140254623.53503773, 48950444.59609043, 140254626.7034609, 48950442.15455515, 0, 0, 0, 0, 0 },
-  { 140254642.91958216, 48950466.47512719, 140254611.54191577, 48950491.28323176, 140254674.29724854, 48950441.66702262, 140254641.35069883, 48950467.71553242, 140254644.4884655, 48950465.23472196, 0, 0, 0, 0, 0 },
-  { 140254660.98755577, 48950489.32777386, 140254629.99249452, 48950514.61227857, 140254691.98261702, 48950464.04326915, 140254659.4378027, 48950490.5919991, 140254662.53730884, 48950488.063548625, 0, 0, 0, 0, 0 },
-  { 140254679.3762191, 48950511.86955399, 140254648.8445281, 48950537.711687155, 140254709.90791008, 48950486.027420826, 140254677.84963456, 48950513.16166065, 140254680.90280363, 48950510.57744733, 1, 1, 140254835.08784303, 48950380.07467485, 29 },
-  { 140254698.13862103, 48950534.03675877, 140254668.15648153, 48950560.51451001, 140254728.12076053, 48950507.55900753, 140254696.63951406, 48950535.36064634, 140254699.637728, 48950532.71287121, 0, 0, 0, 0, 0 },
-  { 140254717.3278105, 48950555.76567942, 140254687.98735175, 48950582.95276239, 140254746.66826925, 48950528.57859645, 140254715.86078757, 48950557.125033565, 140254718.79483342, 48950554.40632527, 0, 0, 0, 0, 0 },
-  { 140254736.99683645, 48950576.99260713, 140254708.39644766, 48950604.95718761, 140254765.59722525, 48950549.028026655, 140254735.56681702, 48950578.39083616, 140254738.4268559, 48950575.59437811, 0, 0, 0, 0, 0 },
-  { 140254757.19874772, 48950597.653833106, 140254729.44309598, 48950626.45702383, 140254784.95439947, 48950568.85064238, 140254755.81096515, 48950599.09399264, 140254758.5865303, 48950596.21367357, 0, 0, 0, 0, 0 },
-  { 140254777.98659325, 48950617.68564855, 140254751.18439063, 48950647.378104426, 140254804.78879586, 48950587.99319268, 140254776.64648312, 48950619.170271344, 140254779.32670337, 48950616.20102576, 1, 4, 140254576.9700737, 48950840.37906757, 45 },
-  { 140254799.41216007, 48950637.0256582, 140254773.6018039, 48950667.584216975, 140254825.22251624, 48950606.46709942, 140254798.12164226, 48950638.55358613, 140254800.70267788, 48950635.49773026, 0, 0, 0, 0, 0 },
-  { 140254821.47790363, 48950655.66281661, 140254796.59580946, 48950686.981842615, 140254846.3599978, 48950624.3437906, 140254820.23379892, 48950657.22876791, 140254822.72200835, 48950654.096865304, 0, 0, 0, 0, 0 },
-  { 140254844.12203658, 48950673.65294976, 140254820.09014425, 48950705.62900565, 140254868.1539289, 48950641.67689387, 140254842.92044196, 48950675.251752555, 140254845.3236312, 48950672.05414696, 0, 0, 0, 0, 0 },
-  { 140254867.2784619, 48950691.05636944, 140254844.0125032, 48950723.59396563, 140254890.5444206, 48950658.51877325, 140254866.11516398, 48950692.68324925, 140254868.44175982, 48950689.42948963, 0, 0, 0, 0, 0 },
-  { 140254890.88108256, 48950707.933387466, 140254868.29213274, 48950740.94458777, 140254913.4700324, 48950674.922187164, 140254889.75163507, 48950709.58394748, 140254892.01053005, 48950706.28282745, 0, 0, 0, 0, 0 },
-  { 140254914.86380166, 48950724.34431568, 140254892.85950813, 48950757.74807394, 140254936.8680952, 48950690.94055741, 140254913.76358697, 48950726.01450359, 140254915.96401635, 48950722.674127765, 0, 0, 0, 0, 0 },
-  { 140254939.1605221, 48950740.349465884, 140254917.64603314, 48950774.07077612, 140254960.67501107, 48950706.62815565, 140254938.08479765, 48950742.035531394, 140254940.23624656, 48950738.663400374, 0, 0, 0, 0, 0 },
-  { 140254963.705147, 48950756.009149864, 140254942.58377445, 48950789.978071265, 140254984.82651955, 48950722.04022846, 140254962.64907837, 48950757.70759594, 140254964.76121563, 48950754.31070379, 0, 0, 0, 0, 0 },
-  { 140254988.43157926, 48950771.38367948, 140254967.6073129, 48950805.53554516, 140255009.25584564, 48950737.231813796, 140254987.39036593, 48950773.091272764, 140254989.4727926, 48950769.676086195, 0, 0, 0, 0, 0 },
-  { 140255013.2752355, 48950786.532219835, 140254992.69190028, 48950820.82983362, 140255033.85857072, 48950752.23460605, 140255012.24606875, 48950788.247100525, 140255014.30440226, 48950784.817339145, 0, 0, 0, 0, 0 },
-  { 140255038.201345, 48950801.49134996, 140255017.8396414, 48950835.92100327, 140255058.5630486, 48950767.06169665, 140255037.18325981, 48950803.21283262, 140255039.21943018, 48950799.76986729, 0, 0, 0, 0, 0 },
-  { 140255063.20241138, 48950816.27698543, 140255043.04407254, 48950850.826100826, 140255083.36075023, 48950781.72787003, 140255062.19449443, 48950818.0044412, 140255064.21032834, 48950814.54952966, 0, 0, 0, 0, 0 },
-  { 140255088.2719431, 48950830.90428078, 140255068.2983964, 48950865.56055629, 140255108.24548978, 48950796.24800527, 140255087.27326575, 48950832.63709456, 140255089.27062044, 48950829.171467006, 0, 0, 0, 0, 0 },
-  { 140255113.4034485, 48950845.38839049, 140255093.59585193, 48950880.13978065, 140255133.21104506, 48950810.63700033, 140255112.41306865, 48950847.12596, 140255114.39382833, 48950843.65082098, 0, 0, 0, 0, 0 },
-  { 140255138.59043607, 48950859.74446909, 140255118.92971247, 48950894.579163685, 140255158.25115967, 48950824.9097745, 140255137.60739988, 48950861.48620382, 140255139.57347226, 48950858.00273436, 0, 0, 0, 0, 0 },
-  { 140255163.8264142, 48950873.98767107, 140255144.29328376, 48950908.894071855, 140255183.35954463, 48950839.081270285, 140255162.84975767, 48950875.73299111, 140255164.80307072, 48950872.24235103, 0, 0, 0, 0, 0 },
-  { 140255189.10489127, 48950888.13315094, 140255169.67990258, 48950923.09984673, 140255208.52987996, 48950853.16645516, 140255188.13364184, 48950889.88148573, 140255190.0761407, 48950886.384816155, 0, 0, 0, 0, 0 },
-  { 140255214.41937575, 48950902.1960632, 140255195.0829349, 48950937.2118033, 140255233.7558166, 48950867.180323094, 140255213.45255372, 48950903.9468502, 140255215.38619778, 48950900.44527619, 1, 4, 140255102.26801878, 48951105.287355796, 45 },
-  { 140255239.76337594, 48950916.19156235, 140255220.49577484, 48950951.245229036, 140255259.03097704, 48950881.13789566, 140255238.79999587, 48950917.94424568, 140255240.726756, 48950914.43887901, 1, 4, 140255289.37744877, 48950825.92837063, 37 },
-  { 140255265.1304003, 48950930.134802885, 140255245.9118436, 48950965.21538267, 140255284.348957, 48950895.0542231, 140255264.16947246, 48950931.888831876, 140255266.09132814, 48950928.380773894, 0, 0, 0, 0, 0 },
-  { 140255290.5139573, 48950944.04093934, 140255271.32458845, 48950979.13749363, 140255309.70332614, 48950908.944385044, 140255289.55448884, 48950945.795767054, 140255291.47342575, 48950942.28611162, 1, 2, 140255370.6295722, 48950797.51282516, 32 },
-  { 140255315.90755525, 48950957.92512619, 140255296.72748214, 48950993.02676142, 140255335.08762836, 48950922.823490955, 140255314.9485516, 48950959.680207945, 140255316.8665589, 48950956.17004443, 0, 0, 0, 0, 0 },
-  { 140255341.30470264, 48950971.80251794, 140255322.11402264, 48951006.89835532, 140255360.49538264, 48950936.706680566, 140255340.34516865, 48950973.557309814, 140255342.26423663, 48950970.04772607, 0, 0, 0, 0, 0 },
-  { 140255366.6989078, 48950985.68826911, 140255347.4777329, 48951020.76741441, 140255385.9200827, 48950950.6091238, 140255365.73784906, 48950987.44222637, 140255367.65996653, 48950983.934311844, 0, 0, 0, 0, 0 },
-  { 140255392.0836792, 48950999.597534195, 140255372.81216103, 48951034.64904754, 140255411.35519737, 48950964.54602085, 140255391.1201033, 48951001.35010986, 140255393.0472551, 48950997.84495853, 0, 0, 0, 0, 0 },
-  { 140255417.45252523, 48951013.54546769, 140255398.11088067, 48951048.558333695, 140255436.79416978, 48950978.532601684, 140255416.485443, 48951015.29611099, 140255418.41960746, 48951011.79482439, 1, 4, 140255314.45826796, 48951199.98897916, 35 },
-  { 140255442.79895425, 48951027.5472241, 140255423.3674916, 48951062.51032263, 140255462.2304169, 48950992.58412556, 140255441.8273811, 48951029.29537902, 140255443.7705274, 48951025.79906917, 0, 0, 0, 0, 0 },
-  { 140255468.11647472, 48951041.617957935, 140255448.57562068, 48951076.520035565, 140255487.65732875, 48951006.715880305, 140255467.139432, 48951043.363061816, 140255469.09351742, 48951039.872854054, 0, 0, 0, 0, 0 },
-  { 140255493.39859506, 48951055.7728237, 140255473.7289228, 48951090.60246615, 140255513.06826732, 48951020.94318125, 140255492.41511145, 48951057.51430582, 140255494.38207868, 48951054.031341575, 0, 0, 0, 0, 0 },
-  { 140255518.6388237, 48951070.0269759, 140255498.82108232, 48951104.77258177, 140255538.45656505, 48951035.28137003, 140255517.6479366, 48951071.764256194, 140255519.62971076, 48951068.289695606, 0, 0, 0, 0, 0 },
-  { 140255543.83066893, 48951084.39556902, 140255523.84581435, 48951119.045324974, 140255563.8155235, 48951049.745813064, 140255542.8314262, 48951086.12805682, 140255544.82991165, 48951082.66308122, 1, 4, 140255639.2583495, 48950918.942984335, 36 },
-  { 140255568.9676392, 48951098.89375758, 140255548.79638347, 48951133.43533314, 140255589.13889495, 48951064.35218202, 140255567.95907643, 48951100.62083636, 140255569.97620198, 48951097.1666788, 1, 2, 140255425.2474421, 48951345.002483435, 34 },
-  { 140255594.0418524, 48951113.536354475, 140255573.66327316, 48951147.95602193, 140255614.42043167, 48951079.11668702, 140255593.02292344, 48951115.257337846, 140255595.0607814, 48951111.8153711, 0, 0, 0, 0, 0 },
-  { 140255619.04008764, 48951128.33686115, 140255598.4329889, 48951162.62020232, 140255639.64718637, 48951094.05351998, 140255618.0097327, 48951130.05102821, 140255620.0704426, 48951126.62269409, 1, 1, 140255520.64119118, 48951292.03981524, 34 },
-  { 140255643.9478434, 48951143.3084644, 140255623.0912102, 48951177.44057321, 140255664.80447662, 48951109.17635559, 140255642.90501174, 48951145.01506984, 140255644.99067506, 48951141.60185896, 1, 0, 140255786.81578085, 48950909.50351909, 38 },
-  { 140255668.750618, 48951158.46435106, 140255647.62363753, 48951192.42978489, 140255689.8775985, 48951124.49891723, 140255667.69426897, 48951160.16262275, 140255669.80696705, 48951156.766079366, 0, 0, 0, 0, 0 },
-  { 140255693.43390992, 48951173.817707926, 140255672.01599753, 48951207.60044063, 140255714.85182232, 48951140.03497522, 140255692.3630143, 48951175.50684456, 140255694.50480554, 48951172.128571294, 0, 0, 0, 0, 0 },
-  { 140255717.98321757, 48951189.3817218, 140255696.25404853, 48951222.965098836, 140255739.7123866, 48951155.79834477, 140255716.89675912, 48951191.06089065, 140255719.069676, 48951187.70255295, 1, 3, 140255626.7207076, 48951330.43190534, 29 },
-  { 140255742.3840392, 48951205.169579506, 140255720.32358682, 48951238.53627609, 140255764.44449157, 48951171.802882925, 140255741.2810166, 48951206.83791433, 140255743.4870618, 48951203.50124468, 1, 2, 140255908.38894337, 48950954.08518773, 30 },
-  { 140255766.62187338, 48951221.19446784, 140255744.21045285, 48951254.32644983, 140255789.0332939, 48951188.06248586, 140255765.50130236, 48951222.85106694, 140255767.7424444, 48951219.537868746, 0, 0, 0, 0, 0 },
-  { 140255790.68221843, 48951237.46957361, 140255767.90053803, 48951270.3480626, 140255813.46389884, 48951204.59108462, 140255789.54313442, 48951239.11349806, 140255791.82130244, 48951235.82564916, 0, 0, 0, 0, 0 },
-  { 140255814.55057275, 48951254.008083634, 140255791.37979183, 48951286.61352661, 140255837.72135368, 48951221.402640656, 140255813.3920337, 48951255.638355784, 140255815.7091118, 48951252.377811484, 0, 0, 0, 0, 0 },
-  { 140255838.2124347, 48951270.82318471, 140255814.634229, 48951303.13522915, 140255861.7906404, 48951238.51114028, 140255837.03352442, 48951272.43878694, 140255839.391345, 48951269.20758249, 0, 0, 0, 0, 0 },
-  { 140255861.65330273, 48951287.92806365, 140255837.64993685, 48951319.92553897, 140255885.6566686, 48951255.930588335, 140255860.45313445, 48951289.52793742, 140255862.853471, 48951286.32818989, 1, 5, 140255673.22688064, 48951539.10824492, 44 },
-  { 140255884.85867524, 48951305.33590727, 140255860.4130827, 48951336.99681385, 140255909.3042678, 48951273.6750007, 140255883.6363956, 48951306.9189526, 140255886.08095488, 48951303.75286195, 0, 0, 0, 0, 0 },
-  { 140255907.81405059, 48951323.059902355, 140255882.9099208, 48951354.36140903, 140255932.71818036, 48951291.75839568, 140255906.5688441, 48951324.624977686, 140255909.05925706, 48951321.494827025, 0, 0, 0, 0, 0 },
-  { 140255930.50492722, 48951341.113235764, 140255905.12679958, 48951372.03168717, 140255955.88305485, 48951310.19478436, 140255929.23602083, 48951342.659158334, 140255931.7738336, 48951339.567313194, 1, 3, 140256110.0551803, 48951122.36519208, 46 },
-  { 140255952.91680348, 48951359.509094246, 140255927.05016735, 48951390.020028934, 140255978.7834396, 48951328.99815956, 140255951.62347168, 48951361.03464098, 140255954.21013528, 48951357.98354751, 0, 0, 0, 0, 0 },
-  { 140255975.03517777, 48951378.260664634, 140255948.66657838, 48951408.33884554, 140256001.40377715, 48951348.182483725, 140255973.7167478, 48951379.76457368, 140255976.35360774, 48951376.75675559, 0, 0, 0, 0, 0 },
-  { 140255996.8455485, 48951397.38113373, 140255969.9626003, 48951427.000503995, 140256023.72849673, 48951367.76176346, 140255995.5014011, 48951398.86210224, 140255998.18969592, 48951395.900165215, 0, 0, 0, 0, 0 },
-  { 140256018.33310378, 48951416.88353471, 140255990.92185065, 48951446.014672734, 140256045.7443569, 48951387.75239668, 140256016.96254113, 48951418.34009161, 140256019.70366642, 48951415.426977806, 1, 0, 140256126.60755357, 48951301.8155395, 25 },
-  { 140256039.47431996, 48951436.776586175, 140256011.51854306, 48951465.38558019, 140256067.43009686, 48951408.16759216, 140256038.0765311, 48951438.20703588, 140256040.87210882, 48951435.34613647, 0, 0, 0, 0, 0 },
-  { 140256060.23598444, 48951457.0642083, 140256031.72006565, 48951485.114919096, 140256088.75190324, 48951429.0134975, 140256058.8101885, 48951458.46674384, 140256061.6617804, 48951455.661672756, 0, 0, 0, 0, 0 },
-  { 140256080.58437788, 48951477.75007037, 140256051.49364477, 48951505.204200245, 140256109.675111, 48951450.295940496, 140256079.12984124, 48951479.122776866, 140256082.03891453, 48951476.377363876, 1, 5, 140255903.85817426, 48951644.53390937, 36 },
-  { 140256100.48578125, 48951498.837841734, 140256070.8067215, 48951525.65487761, 140256130.164841, 48951472.02080586, 140256099.00182825, 48951500.178693525, 140256101.96973425, 48951497.49698994, 0, 0, 0, 0, 0 },
-  { 140256119.90647525, 48951520.3311917, 140256089.62698755, 48951546.468380235, 140256150.18596295, 48951494.19400317, 140256118.39250085, 48951521.63805113, 140256121.42044964, 48951519.02433228, 1, 4, 140255831.4943548, 48951769.287912436, 48 },
-  { 140256138.81274784, 48951542.233786464, 140256107.93654913, 48951567.663303845, 140256169.68894655, 48951516.80426908, 140256137.26893792, 48951543.50526233, 140256140.35655776, 48951540.9623106, 0, 0, 0, 0, 0 },
-  { 140256157.18610385, 48951564.54248319, 140256125.76110268, 48951589.29060031, 140256188.61110502, 48951539.79436607, 140256155.6148538, 48951565.77988905, 140256158.7573539, 48951563.30507733, 1, 0, 140256050.34109983, 48951648.68608138, 41 },
-  { 140256175.05548698, 48951587.23291185, 140256143.1359997, 48951611.33988867, 140256206.97497424, 48951563.125935026, 140256173.45951262, 48951588.43826069, 140256176.65146133, 48951586.027563006, 1, 5, 140256277.1978463, 48951510.09058601, 37 },
-  { 140256192.45905957, 48951610.2765775, 140256160.09691933, 48951633.78597731, 140256224.8211998, 48951586.76717769, 140256190.84095255, 48951611.45204749, 140256194.0771666, 48951609.101107515, 1, 3, 140255965.9240779, 48951774.84237616, 42 },
-  { 140256209.43498376, 48951633.6449852, 140256176.67948544, 48951656.60314999, 140256242.19048208, 48951610.68682041, 140256207.79720885, 48951634.79289344, 140256211.07275867, 48951632.49707696, 0, 0, 0, 0, 0 },
-  { 140256226.02142188, 48951657.30964005, 140256192.9193492, 48951679.76521362, 140256259.12349457, 48951634.854066476, 140256224.36631826, 48951658.43241873, 140256227.6765255, 48951656.18686137, 0, 0, 0, 0, 0 },
-  { 140256242.25653598, 48951681.24204708, 140256208.852258, 48951703.24555165, 140256275.66081396, 48951659.238542505, 140256240.58632207, 48951682.34222231, 140256243.92674989, 48951680.14187185, 0, 0, 0, 0, 0 },
-  { 140256258.17848843, 48951705.41371136, 140256224.51411164, 48951727.017177165, 140256291.84286523, 48951683.81024556, 140256256.4952696, 48951706.49388465, 140256259.86170727, 48951704.33353807, 0, 0, 0, 0, 0 },
-  { 140256273.8254414, 48951729.796137996, 140256239.94100675, 48951751.05278612, 140256307.70987603, 48951708.53948987, 140256272.13121966, 48951730.8589704, 140256275.51966313, 48951728.73330559, 0, 0, 0, 0, 0 },
-  { 140256289.23555705, 48951754.360832, 140256255.16927156, 48951775.324805684, 140256323.30184254, 48951733.39685831, 140256287.53224277, 48951755.40903068, 140256290.93887132, 48951753.31263331, 0, 0, 0, 0, 0 },
-  { 140256304.44699773, 48951779.07929849, 140256270.2354918, 48951799.8054381, 140256338.65850365, 48951758.35315888, 140256302.73642245, 48951780.115605466, 140256306.157573, 48951778.04299151, 1, 4, 140256427.608419, 48951704.46519588, 46 },
-  { 140256319.49792558, 48951803.923042506, 140256285.17653003, 48951824.46669865, 140256353.81932113, 48951783.379386365, 140256317.7818558, 48951804.950225316, 140256321.21399537, 48951802.895859696, 1, 0, 140256032.05623788, 48951975.97616268, 42 },
-  { 140256334.42650276, 48951828.86356911, 140256300.0295392, 48951849.28044685, 140256368.82346633, 48951808.44669137, 140256332.70665458, 48951829.884413, 140256336.14635095, 48951827.842725225, 0, 0, 0, 0, 0 },
-  { 140256349.27089164, 48951853.872383386, 140256314.8319718, 48951874.21841001, 140256383.70981148, 48951833.526356764, 140256347.54894564, 48951854.889684714, 140256350.99283764, 48951852.85508206, 0, 0, 0, 0, 0 },
-  { 140256364.06925428, 48951878.92099039, 140256329.62158558, 48951899.25220093, 140256398.51692298, 48951858.589779854, 140256362.34687084, 48951879.93755092, 140256365.79163772, 48951877.90442987, 1, 0, 140256635.3446452, 48951718.81270741, 43 },
-  { 140256378.85975304, 48951903.98089522, 140256344.43644634, 48951924.35332648, 140256413.28305975, 48951883.608463965, 140256377.1385877, 48951904.999516785, 140256380.58091837, 48951902.96227366, 1, 4, 140256063.88649666, 48952090.3886412, 26 },
-  { 140256393.68055004, 48951929.0236029, 140256359.31492788, 48951949.49319043, 140256428.0461722, 48951908.554015376, 140256391.96226892, 48951930.04708228, 140256395.39883116, 48951928.00012352, 0, 0, 0, 0, 0 },
-  { 140256408.5698076, 48951954.02061852, 140256374.29570997, 48951974.64308761, 140256442.8439052, 48951933.39814943, 140256406.8561027, 48951955.05174197, 140256410.28351247, 48951952.98949507, 0, 0, 0, 0, 0 },
-  { 140256423.5656878, 48951978.94344713, 140256389.41777322, 48951999.77419194, 140256457.7136024, 48951958.11270232, 140256421.85829207, 48951979.98498437, 140256425.27308354, 48951977.90190989, 0, 0, 0, 0, 0 },
-  { 140256438.706353, 48952003.76359384, 140256404.7203912, 48952024.857536115, 140256472.6923148, 48951982.66965156, 140256437.00705492, 48952004.81829095, 140256440.4056511, 48952002.70889673, 1, 2, 140256114.14041784, 48952205.21074255, 27 },
-  { 140256454.02996537, 48952028.452563666, 140256420.2431183, 48952049.86398502, 140256487.81681246, 48952007.041142315, 140256452.34062302, 48952029.52313473, 140256455.71930772, 48952027.3819926, 1, 0, 140256670.26578668, 48951891.41946701, 41 },
-  { 140256469.5746871, 48952052.9818617, 140256436.02577302, 48952074.76420238, 140256503.12360117, 48952031.19952103, 140256467.89724138, 48952054.07097874, 140256471.2521328, 48952051.89274467, 0, 0, 0, 0, 0 },
-  { 140256485.37868044, 48952077.32299301, 140256452.1084153, 48952099.52861073, 140256518.64894557, 48952055.11737529, 140256483.7151672, 48952078.4332739, 140256487.04219368, 48952076.212712124, 0, 0, 0, 0, 0 },
-  { 140256501.4801076, 48952101.44746267, 140256468.5313161, 48952124.12734668, 140256534.4288991, 48952078.76757866, 140256499.83266804, 48952102.58145687, 140256503.12754717, 48952100.31346847, 1, 0, 140256366.39006245, 48952194.434987105, 50 },
-  { 140256517.9171308, 48952125.326775715, 140256485.32569972, 48952148.517261244, 140256550.50856188, 48952102.136290185, 140256516.28755924, 48952126.48629999, 140256519.54670236, 48952124.16725144, 0, 0, 0, 0, 0 },
-  { 140256534.71850282, 48952148.939078175, 140256502.4829283, 48952172.62172446, 140256566.95407733, 48952125.25643189, 140256533.10672408, 48952150.12321049, 140256536.33028156, 48952147.75494586, 1, 5, 140256230.09232354, 48952372.74008553, 30 },
-  { 140256551.87389565, 48952172.29009805, 140256519.98154208, 48952196.43296001, 140256583.7662492, 48952148.14723609, 140256550.27927798, 48952173.49724115, 140256553.4685133, 48952171.08295495, 0, 0, 0, 0, 0 },
-  { 140256569.36283663, 48952195.39272317, 140256537.7997747, 48952219.96451844, 140256600.92589855, 48952170.8209279, 140256567.78468353, 48952196.62131294, 140256570.94098973, 48952194.16413341, 0, 0, 0, 0, 0 },
-  { 140256587.16485307, 48952218.259841375, 140256555.91598275, 48952243.22998563, 140256618.41372338, 48952193.28969712, 140256585.60240954, 48952219.50834859, 140256588.7272966, 48952217.01133416, 0, 0, 0, 0, 0 },
-  { 140256605.25947234, 48952240.90434055, 140256574.30863962, 48952266.24296629, 140256636.21030506, 48952215.565714814, 140256603.7119307, 48952242.17127184, 140256606.807014, 48952239.63740926, 0, 0, 0, 0, 0 },
-  { 140256623.62622175, 48952263.3391085, 140256592.95632857, 48952289.01706893, 140256654.29611492, 48952237.661148064, 140256622.0927271, 48952264.623006515, 140256625.1597164, 48952262.05521048, 0, 0, 0, 0, 0 },
-  { 140256642.24462855, 48952285.577033095, 140256611.8377354, 48952311.5658932, 140256672.65152168, 48952259.58817299, 140256640.7242839, 48952286.8764761, 140256643.7649732, 48952284.27759009, 0, 0, 0, 0, 0 },
-  { 140256661.09422013, 48952307.631002165, 140256630.93164062, 48952333.90301765, 140256691.25679964, 48952281.35898668, 140256659.58609116, 48952308.94460294, 140256662.6023491, 48952306.317401394, 0, 0, 0, 0, 0 },
-  { 140256680.1545238, 48952329.513903566, 140256650.21692726, 48952356.04200781, 140256710.09212032, 48952302.98579932, 140256678.65764397, 48952330.84030878, 140256681.6514036, 48952328.18749835, 0, 0, 0, 0, 0 },
-  { 140256699.40508366, 48952351.23861818, 140256669.6751813, 48952377.99927785, 140256729.134986, 48952324.47795851, 140256697.91858855, 48952352.57665116, 140256700.89157876, 48952349.9005852, 1, 5, 140256817.58144552, 48952244.864995986, 30 },
-  { 140256718.8282273, 48952372.81686667, 140256689.29382154, 48952399.79313172, 140256748.36263308, 48952345.84060163, 140256717.351507, 48952374.165679924, 140256720.3049476, 48952371.46805342, 0, 0, 0, 0, 0 },
-  { 140256738.4121534, 48952394.257923044, 140256709.06141806, 48952421.43391126, 140256767.76288873, 48952367.08193483, 140256736.94461662, 48952395.61672246, 140256739.87969017, 48952392.89912363, 1, 3, 140256974.6855728, 48952175.49121791, 31 },
-  { 140256758.1458043, 48952415.570751116, 140256728.96661934, 48952442.93085284, 140256787.32498923, 48952388.21064939, 140256756.68684503, 48952416.938756205, 140256759.60476354, 48952414.202746026, 0, 0, 0, 0, 0 },
-  { 140256778.01812273, 48952436.76431468, 140256748.9981031, 48952464.293180645, 140256807.03814235, 48952409.23544872, 140256776.56712174, 48952438.14075798, 140256779.46912372, 48952435.387871385, 0, 0, 0, 0, 0 },
-  { 140256798.01805124, 48952457.84757755, 140256769.14457458, 48952485.53010537, 140256826.8915279, 48952430.16504973, 140256796.57437742, 48952459.23170394, 140256799.46172506, 48952456.46345116, 1, 4, 140256629.83004978, 48952619.09830211, 28 },
-  { 140256818.13453245, 48952478.82950356, 140256789.3947648, 48952506.65082195, 140256846.8743001, 48952451.00818517, 140256816.69754407, 48952480.22056948, 140256819.57152084, 48952477.43843764, 0, 0, 0, 0, 0 },
-  { 140256838.35650888, 48952499.71905651, 140256809.73742905, 48952527.6645082, 140256866.9755887, 48952471.77360482, 140256836.9255549, 48952501.116329096, 140256839.78746286, 48952498.32178392, 1, 2, 140256589.37051445, 48952742.84448623, 27 },
-  { 140256858.67292324, 48952520.525200225, 140256830.1613452, 48952548.58032307, 140256887.18450126, 48952492.47007738, 140256857.24734434, 48952521.927956365, 140256860.09850213, 48952519.122444086, 0, 0, 0, 0, 0 },
-  { 140256879.07271808, 48952541.25689853, 140256850.65531233, 48952569.40740563, 140256907.49012384, 48952513.10639143, 140256877.6518478, 48952542.66442388, 140256880.49358836, 48952539.84937318, 1, 3, 140256627.57867715, 48952790.38888638, 30 },
-  { 140256899.54483593, 48952561.92311521, 140256871.20814955, 48952590.15487401, 140256927.8815223, 48952533.691356406, 140256898.1280016, 48952563.33470315, 140256900.96167025, 48952560.51152727, 0, 0, 0, 0, 0 },
-  { 140256920.0782194, 48952582.5328141, 140256891.80869496, 48952610.83182445, 140256948.34774387, 48952554.23380375, 140256918.66474319, 48952583.94776462, 140256921.49169564, 48952581.11786358, 1, 1, 140256637.38297483, 48952865.52291761, 37 },
-  { 140256940.6618112, 48952603.094959006, 140256912.4458044, 48952631.447330326, 140256968.87781802, 48952574.742587686, 140256939.25101086, 48952604.51257757, 140256942.07261154, 48952601.67734044, 1, 1, 140257102.90385038, 48952440.06882391, 34 },
-  { 140256961.2845538, 48952623.61851377, 140256933.1083509, 48952652.01044205, 140256989.4607567, 48952595.22658549, 140256959.87574366, 48952625.03811018, 140256962.69336393, 48952622.19891736, 0, 0, 0, 0, 0 },
-  { 140256981.93538982, 48952644.11244217, 140256953.78522402, 48952672.53018603, 140257010.0855556, 48952615.69469832, 140256980.52788153, 48952645.53332937, 140256983.3428981, 48952642.69155498, 0, 0, 0, 0, 0 },
-  { 140257002.6032619, 48952664.585708044, 140256974.4653292, 48952693.015564606, 140257030.74119458, 48952636.15585148, 140257001.19636527, 48952666.007200874, 140257004.0101585, 48952663.164215215, 1, 4, 140256730.36876312, 48952939.644570254, 32 },
-  { 140257023.27711257, 48952685.04727519, 140256995.13758764, 48952713.475555755, 140257051.4166375, 48952656.61899463, 140257021.87013632, 48952686.46868922, 140257024.68408883, 48952683.62586117, 1, 3, 140257120.35847363, 48952586.96970725, 50 },
-  { 140257043.9458845, 48952705.50610744, 140257015.790936, 48952733.91911284, 140257072.100833, 48952677.093102045, 140257042.53813708, 48952706.92675771, 140257045.3536319, 48952704.085457176, 0, 0, 0, 0, 0 },
-  { 140257064.59852016, 48952725.97116861, 140257036.4143268, 48952754.35516488, 140257092.78271353, 48952697.58717234, 140257063.1893105, 48952727.390368424, 140257066.00772983, 48952724.55196879, 1, 5, 140257271.7523414, 48952517.348795995, 36 },
-  { 140257085.2239623, 48952746.45142248, 140257056.99672812, 48952774.79261601, 140257113.4511965, 48952718.110228956, 140257083.8126006, 48952747.86848216, 140257086.635324, 48952745.03436281, 0, 0, 0, 0, 0 },
-  { 140257105.8111534, 48952766.95583292, 140257077.5271245, 48952795.240346484, 140257134.09518233, 48952738.67131936, 140257104.39695197, 48952768.370058596, 140257107.22535485, 48952765.541607246, 1, 1, 140257248.64549953, 48952624.11903944, 40 },
-  { 140257126.3490361, 48952787.49336371, 140257097.9945171, 48952815.7072123, 140257154.7035551, 48952759.27951512, 140257124.93131015, 48952788.90405614, 140257127.76676205, 48952786.08267128, 0, 0, 0, 0, 0 },
-  { 140257146.82655293, 48952808.07297865, 140257118.38792482, 48952836.20204603, 140257175.26518103, 48952779.94391128, 140257145.4046215, 48952809.479432024, 140257148.24848434, 48952806.66652528, 0, 0, 0, 0, 0 },
-  { 140257167.23264658, 48952828.703641616, 140257138.69638503, 48952856.733657256, 140257195.76890814, 48952800.673625976, 140257165.80583352, 48952830.1051424, 140257168.65945965, 48952827.30214083, 1, 0, 140256885.43706378, 48953105.50004607, 42 },
-  { 140257187.5562596, 48952849.39431636, 140257158.90895456, 48952877.310833216, 140257216.20356464, 48952821.477799505, 140257186.12389436, 48952850.7901422, 140257188.98862484, 48952847.99849052, 0, 0, 0, 0, 0 },
-  { 140257207.78633457, 48952870.15396671, 140257179.01471108, 48952897.94233985, 140257236.55795807, 48952842.36559357, 140257206.3477534, 48952871.543385364, 140257209.22491574, 48952868.764548056, 0, 0, 0, 0, 0 },
-  { 140257227.91181415, 48952890.99155652, 140257199.0027545, 48952918.636922695, 140257256.8208738, 48952863.34619034, 140257226.46636117, 48952892.37382483, 140257229.35726714, 48952889.60928821, 1, 3, 140257329.81624937, 48952793.54164075, 47 },
-  { 140257247.9216408, 48952911.91604956, 140257218.86220846, 48952939.40330825, 140257276.98107317, 48952884.428790875, 140257246.4686692, 48952913.2904125, 140257249.37461242, 48952910.541686624, 0, 0, 0, 0, 0 },
-  { 140257267.8047572, 48952932.936409675, 140257238.58222198, 48952960.25020538, 140257297.02729243, 48952905.62261397, 140257266.34363043, 48952934.30209946, 140257269.26588398, 48952931.57071989, 0, 0, 0, 0, 0 },
-  { 140257287.55010602, 48952954.06160066, 140257258.1519713, 48952981.18630668, 140257316.94824073, 48952926.93689465, 140257286.08019927, 48952955.417835966, 140257289.02001277, 48952952.70536536, 1, 3, 140257061.18446887, 48953162.921836995, 26 },
-  { 140257307.1466297, 48952975.300586335, 140257277.56066173, 48953002.22029102, 140257336.73259765, 48952948.38088165, 140257305.6673313, 48952976.64657157, 140257308.62592807, 48952973.9546011, 0, 0, 0, 0, 0 },
-  { 140257326.58327094, 48952996.66233052, 140257296.79752955, 48953023.36082504, 140257356.36901233, 48952969.96383601, 140257325.09398386, 48952997.99725525, 140257328.07255802, 48952995.327405795, 0, 0, 0, 0, 0 },
-  { 140257345.84897226, 48953018.15579703, 140257315.85184404, 48953044.61656608, 140257375.84610048, 48952991.69502798, 140257344.34911585, 48953019.47883548, 140257347.34882867, 48953016.832758576, 1, 5, 140257563.32815185, 48952826.315221414, 44 },
-  { 140257364.9326763, 48953039.78994966, 140257334.7129097, 48953065.99616471, 140257395.15244287, 48953013.58373462, 140257363.42168796, 48953041.100260414, 140257366.4436646, 48953038.47963891, 1, 4, 140257179.8366059, 48953200.303016834, 30 },
-  { 140257383.8233257, 48953061.57375228, 140257353.37006792, 48953087.50826771, 140257414.27658346, 48953035.639236845, 140257382.30066282, 48953062.87047805, 140257385.34598857, 48953060.277026504, 0, 0, 0, 0, 0 },
-  { 140257402.50986293, 48953083.51616863, 140257371.8126991, 48953109.161521696, 140257433.20702675, 48953057.87081557, 140257400.97500473, 48953084.798436284, 140257404.04472113, 48953082.23390098, 0, 0, 0, 0, 0 },
-  { 140257420.98123068, 48953105.626162596, 140257390.03022474, 48953130.96457675, 140257451.9322366, 48953080.28774844, 140257419.4336804, 48953106.893083304, 140257422.52878097, 48953104.35924189, 0, 0, 0, 0, 0 },
-  { 140257439.22637153, 48953127.91269794, 140257408.01210868, 48953152.926090255, 140257470.44063437, 48953102.89930563, 140257437.66565838, 48953129.163367555, 140257440.78708467, 48953126.66202833, 0, 0, 0, 0, 0 },
-  { 140257457.23422804, 48953150.3847385, 140257425.74812073, 48953175.05506572, 140257488.72033536, 48953125.71441127, 140257455.6599227, 48953151.618254855, 140257458.8085334, 48953149.15122214, 0, 0, 0, 0, 0 },
-  { 140257474.99398112, 48953173.051056884, 140257443.23715377, 48953197.371910416, 140257506.75080848, 48953148.73020335, 140257473.40613976, 48953174.26709956, 140257476.58182248, 48953171.83501421, 0, 0, 0, 0, 0 },
-  { 140257492.50323188, 48953195.91366953, 140257460.48819482, 48953219.89360703, 140257524.51826894, 48953171.933732025, 140257490.90248004, 48953197.1126664, 140257494.10398373, 48953194.714672655, 0, 0, 0, 0, 0 },
-  { 140257509.77005488, 48953218.96618907, 140257477.50971636, 48953242.61509094, 140257542.0303934, 48953195.31728721, 140257508.15703794, 48953220.148634166, 140257511.3830718, 48953217.78374398, 1, 1, 140257304.1103969, 48953369.727938466, 42 },
-  { 140257526.80317983, 48953242.2017025, 140257494.31012043, 48953265.529820524, 140257559.29623923, 48953218.87358447, 140257525.17852685, 48953243.3681084, 140257528.4278328, 48953241.0352966, 0, 0, 0, 0, 0 },
-  { 140257543.6113366, 48953265.61329684, 140257510.8978057, 48953288.6312224, 140257576.3248675, 48953242.595371276, 140257541.97566006, 48953266.76419312, 140257545.24701312, 48953264.462400556, 0, 0, 0, 0, 0 },
-  { 140257560.20325482, 48953289.19405906, 140257527.28117004, 48953311.91269312, 140257593.1253396, 48953266.475425, 140257558.55715057, 48953290.32999076, 140257561.84935907, 48953288.05812736, 0, 0, 0, 0, 0 },
-  { 140257576.58766428, 48953312.937076166, 140257543.46861285, 48953335.367600724, 140257609.7067157, 48953290.50655161, 140257574.9317117, 48953314.05860239, 140257578.24361685, 48953311.81554994, 0, 0, 0, 0, 0 },
-  { 140257592.77329475, 48953336.83543515, 140257559.46853703, 48953358.98928616, 140257626.07805246, 48953314.68158414, 140257591.10805687, 48953337.9431277, 140257594.43853262, 48953335.727742605, 0, 0, 0, 0, 0 },
-  { 140257608.76887593, 48953360.88222301, 140257575.2893511, 48953382.7710653, 140257642.24840075, 48953338.99338072, 140257607.09489968, 48953361.976665124, 140257610.44285217, 48953359.787780896, 0, 0, 0, 0, 0 },
-  { 140257624.58313757, 48953385.07052673, 140257590.93947065, 48953406.70623044, 140257658.2268045, 48953363.434823014, 140257622.90095422, 48953386.15231191, 140257626.26532093, 48953383.98874154, 0, 0, 0, 0, 0 },
-  { 140257640.2248095, 48953409.393433325, 140257606.42732, 48953430.7880519, 140257674.022299, 48953387.99881475, 140257638.53493503, 48953410.463164255, 140257641.91468397, 48953408.323702395, 0, 0, 0, 0, 0 },
-  { 140257655.7026214, 48953433.84402978, 140257621.7613335, 48953455.00977984, 140257689.6439093, 48953412.67827971, 140257654.005557, 48953434.90231728, 140257657.3996858, 48953432.785742275, 0, 0, 0, 0, 0 },
-  { 140257671.02530295, 48953458.41540306, 140257636.94995672, 48953479.36464599, 140257705.10064918, 48953437.46616013, 140257669.32153565, 48953459.4628652, 140257672.72907025, 48953457.36794092, 1, 3, 140257407.7932533, 48953620.24830469, 46 },
-  { 140257686.20158395, 48953483.10064021, 140257652.0016476, 48953503.84586505, 140257720.4015203, 48953462.35541537, 140257684.49158713, 48953484.13790145, 140257687.91158077, 48953482.06337897, 1, 4, 140258009.39098245, 48953287.05826544, 25 },
-  { 140257701.24019423, 48953507.892828204, 140257666.92487714, 48953528.44663596, 140257735.55551133, 48953487.339020446, 140257699.52442837, 48953508.92051859, 140257702.9559601, 48953506.865137815, 0, 0, 0, 0, 0 },
-  { 140257716.14986336, 48953532.78505401, 140257681.72813037, 48953553.16014414, 140257750.57159635, 48953512.40996388, 140257714.4287767, 48953533.80380852, 140257717.87095, 48953531.76629951, 0, 0, 0, 0, 0 },
-  { 140257730.93932128, 48953557.770404674, 140257696.41990694, 48953577.97956185, 140257765.45873562, 48953537.5612475, 140257729.21335056, 48953558.78086253, 140257732.665292, 48953556.759946816, 1, 4, 140257441.83922622, 48953727.02209603, 29 },
-  { 140257745.61729762, 48953582.84196716, 140257711.00872165, 48953602.89805025, 140257780.2258736, 48953562.78588407, 140257743.88686883, 48953583.84477131, 140257747.3477264, 48953581.839163005, 1, 2, 140258064.88141102, 48953397.824600674, 32 },
-  { 140257760.1925221, 48953607.992828466, 140257725.50310504, 48953627.90876036, 140257794.88193917, 48953588.07689657, 140257758.45805126, 48953608.98862506, 140257761.92699295, 48953606.997031875, 1, 1, 140257447.12053305, 48953787.73411381, 39 },
-  { 140257774.67372456, 48953633.21607558, 140257739.9116037, 48953653.00483383, 140257809.43584543, 48953613.42731732, 140257772.93561852, 48953634.20551349, 140257776.4118306, 48953632.22663766, 0, 0, 0, 0, 0 },
-  { 140257789.06963462, 48953658.50479551, 140257754.24278075, 48953678.17940478, 140257823.8964885, 48953638.83018623, 140257787.32829192, 48953659.48852597, 140257790.8109773, 48953657.52106504, 0, 0, 0, 0, 0 },
-  { 140257803.38898218, 48953683.85207524, 140257768.50521597, 48953703.42559956, 140257838.27274838, 48953664.27855092, 140257801.64479387, 48953684.83075146, 140257805.1331705, 48953682.87339903, 0, 0, 0, 0, 0 },
-  { 140257817.64049685, 48953709.25100177, 140257782.70750603, 48953728.73653875, 140257852.57348767, 48953689.76546478, 140257815.89384732, 48953710.225278616, 140257819.38714638, 48953708.27672492, 1, 3, 140257653.45543993, 48953800.83302558, 33 },
-  { 140257831.83290845, 48953734.6946621, 140257796.85826483, 48953754.10533708, 140257866.80755207, 48953715.28398712, 140257830.08417627, 48953735.66519585, 140257833.58164063, 48953733.72412835, 0, 0, 0, 0, 0 },
-  { 140257845.9749467, 48953760.17614322, 140257810.96612355, 48953779.52510447, 140257880.98376986, 48953740.82718197, 140257844.22450554, 48953761.143591285, 140257847.72538787, 48953759.20869516, 1, 5, 140257574.65656728, 48953910.13059289, 35 },
-  { 140257860.0753414, 48953785.68853213, 140257825.03973076, 48953804.98894628, 140257895.11095205, 48953766.38811798, 140257858.32356086, 48953786.65355284, 140257861.82712194, 48953784.72351142, 0, 0, 0, 0, 0 },
-  { 140257874.14282224, 48953811.22491582, 140257839.0877525, 48953830.489964075, 140257909.19789198, 48953791.95986756, 140257872.39006874, 48953812.18816823, 140257875.89557573, 48953810.26166341, 0, 0, 0, 0, 0 },
-  { 140257888.18611893, 48953836.77838127, 140257853.1188724, 48953856.02125583, 140257923.25336546, 48953817.53550672, 140257886.4327566, 48953837.740525, 140257889.93948126, 48953835.81623755, 1, 3, 140258170.47745347, 48953681.873241104, 40 },
-  { 140257902.2139613, 48953862.342015505, 140257867.14179182, 48953881.57591596, 140257937.2861308, 48953843.10811505, 140257900.46035284, 48953863.30371053, 140257903.96756977, 48953861.38032048, 0, 0, 0, 0, 0 },
-  { 140257916.23507902, 48953887.90890549, 140257881.16522962, 48953907.147035934, 140257951.30492842, 48953868.67077505, 140257914.48158655, 48953888.870812014, 140257917.9885715, 48953886.94699897, 0, 0, 0, 0, 0 },
-  { 140257930.25820187, 48953913.47213825, 140257895.19792253, 48953932.72770401, 140257965.3184812, 48953894.216572486, 140257928.5051879, 48953914.43491653, 140257932.01121584, 48953912.50935996, 0, 0, 0, 0, 0 },
-  { 140257944.29205963, 48953939.024800755, 140257909.24862486, 48953958.311005145, 140257979.3354944, 48953919.738596365, 140257942.5398879, 48953939.98911098, 140257946.04423136, 48953938.06049053, 0, 0, 0, 0, 0 },
-  { 140257958.345382, 48953964.55998, 140257923.32480136, 48953983.88765265, 140257993.36596265, 48953945.232307345, 140257956.59435296, 48953965.52636363, 140257960.09641105, 48953963.59359636, 0, 0, 0, 0, 0 },
-  { 140257972.42522785, 48953990.071814045, 140257937.42388347, 48954009.43430075, 140258007.42657223, 48953970.70932734, 140257970.67516062, 48953991.03993838, 140257974.17529508, 48953989.10368971, 0, 0, 0, 0, 0 },
-  { 140257986.52632195, 48954015.56219956, 140257951.53623804, 48954034.94502777, 140258021.51640585, 48953996.17937136, 140257984.77681774, 48954016.53134097, 140257988.27582616, 48954014.593058154, 1, 0, 140257669.86606273, 48954190.976794824, 38 },
-  { 140258000.63786653, 48954041.036507204, 140257965.65101486, 48954060.42516909, 140258035.6247182, 48954021.64784532, 140257998.88852394, 48954042.005940296, 140258002.38720912, 48954040.06707411, 0, 0, 0, 0, 0 },
-  { 140258014.7490377, 48954066.500123836, 140257979.75737518, 48954085.88010197, 140258049.74070024, 48954047.1201457, 140258012.9994546, 48954067.469122745, 140258016.49862084, 48954065.53112493, 0, 0, 0, 0, 0 },
-  { 140258028.84901196, 48954091.95843639, 140257993.8444975, 48954111.31519151, 140258063.8535264, 48954072.60168128, 140258027.09878623, 48954092.92627415, 140258030.59923768, 48954090.990598634, 0, 0, 0, 0, 0 },
-  { 140258042.92696542, 48954117.41683178, 140258007.90157765, 48954136.735791706, 140258077.95235318, 48954098.09787185, 140258041.17569602, 48954118.38277977, 140258044.67823482, 48954116.45088378, 0, 0, 0, 0, 0 },
-  { 140258056.97207445, 48954142.8806969, 140258021.91782886, 48954162.14724476, 140258092.02632004, 48954123.61414904, 140258055.21936217, 48954143.84402429, 140258058.72478673, 48954141.91736951, 0, 0, 0, 0, 0 },
-  { 140258070.9735153, 48954168.355418675, 140258035.88248202, 48954187.55488175, 140258106.06454858, 48954149.1559556, 140258069.21896362, 48954169.31539183, 140258072.72806698, 48954167.39544552, 1, 1, 140257973.5958979, 48954221.633928716, 48 },
-  { 140258084.9204642, 48954193.846384004, 140258049.7847861, 48954212.96402315, 140258120.05614227, 48954174.72874486, 140258083.1636803, 48954194.802265964, 140258086.6772481, 48954192.89050204, 0, 0, 0, 0, 0 },
-  { 140258098.80209753, 48954219.35897981, 140258063.61400855, 48954238.37997854, 140258133.9901865, 48954200.337981075, 140258097.04269308, 48954220.310029745, 140258100.56150198, 48954218.40792987, 0, 0, 0, 0, 0 },
-  { 140258112.60759148, 48954244.89859298, 140258077.35943538, 48954263.80804807, 140258147.85574758, 48954225.98913789, 140258110.84518367, 48954245.84406573, 140258114.3699993, 48954243.953120224, 1, 0, 140258376.96876222, 48954103.07767982, 39 },
-  { 140258126.3261223, 48954270.47061047, 140258091.01037225, 48954289.25352286, 140258161.64187238, 48954251.68769808, 140258124.5603348, 48954271.40975609, 140258128.09190983, 48954269.53146485, 0, 0, 0, 0, 0 },
-  { 140258139.94686636, 48954296.08041914, 140258104.55614454, 48954314.72168544, 140258175.3375882, 48954277.43915284, 140258138.1773303, 48954297.01248246, 140258141.71640244, 48954295.14835582, 1, 3, 140258277.97068146, 48954223.379480556, 27 },
-  { 140258153.45899987, 48954321.733405925, 140258117.98609817, 48954340.217811346, 140258188.93190157, 48954303.249000505, 140258151.6853548, 48954322.6576262, 140258155.23264495, 48954320.809185654, 1, 3, 140257942.39523467, 48954431.715618186, 40 },
-  { 140258166.8516991, 48954347.43495775, 140258131.28960016, 48954365.74717, 140258202.41379806, 48954329.1227455, 140258165.07359415, 48954348.35056836, 140258168.62980407, 48954346.51934714, 0, 0, 0, 0, 0 },
-  { 140258180.11414045, 48954373.190461494, 140258144.45603928, 48954391.31502552, 140258215.77224162, 48954355.065897465, 140258178.33123538, 48954374.09668969, 140258181.89704552, 48954372.284233294, 0, 0, 0, 0, 0 },
-  { 140258193.23550004, 48954399.0053041, 140258157.47482675, 48954416.926639035, 140258228.99617332, 48954381.08396916, 140258191.44746637, 48954399.901370846, 140258195.0235337, 48954398.10923735, 0, 0, 0, 0, 0 },
-  { 140258206.20495418, 48954424.88487244, 140258170.33539692, 48954442.587269485, 140258242.07451144, 48954407.18247539, 140258204.4114763, 48954425.76999229, 140258207.99843204, 48954423.99975258, 0, 0, 0, 0, 0 },
-  { 140258219.0116792, 48954450.83455346, 140258183.0272079, 48954468.30217565, 140258254.9961505, 48954433.36693127, 140258217.21245563, 48954451.707934566, 140258220.81090277, 48954449.96117235, 1, 5, 140258362.04995263, 48954381.40075525, 45 },
-  { 140258231.6448514, 48954476.85973404, 140258195.53974214, 48954494.076617815, 140258267.74996063, 48954459.64285027, 140258229.8395959, 48954477.72057823, 140258233.45010686, 48954475.998889856, 0, 0, 0, 0, 0 },
-  { 140258244.0936469, 48954502.96580111, 140258207.8625071, 48954519.91586033, 140258280.32478672, 48954486.01574189, 140258242.28208992, 48954503.813304074, 140258245.9052039, 48954502.11829815, 0, 0, 0, 0, 0 },
-  { 140258256.34724215, 48954529.15814158, 140258219.9850357, 48954545.82517315, 140258292.7094486, 48954512.49111002, 140258254.52913183, 48954529.99149316, 140258258.16535246, 48954528.32479001, 0, 0, 0, 0, 0 },
-  { 140258268.39481333, 48954555.442142375, 140258231.89688668, 48954571.80983463, 140258304.89273998, 48954539.07445012, 140258266.569917, 48954556.260526985, 140258270.21970966, 48954554.623757765, 0, 0, 0, 0, 0 },
-  { 140258280.22553673, 48954581.823190376, 140258243.58764505, 48954597.87513396, 140258316.8634284, 48954565.77124679, 140258278.39364216, 48954582.625787556, 140258282.0574313, 48954581.020593196, 1, 0, 140257946.8207224, 48954727.895876996, 38 },
-  { 140258291.8285887, 48954608.3066725, 140258255.04692206, 48954624.02637353, 140258328.61025533, 48954592.58697147, 140258289.98950535, 48954609.09265755, 140258293.66767204, 48954607.520687446, 0, 0, 0, 0, 0 },
-  { 140258303.1931454, 48954634.89797567, 140258266.26435533, 48954650.26887234, 140258340.12193546, 48954619.52707899, 140258301.34670588, 48954635.6665205, 140258305.0395849, 48954634.12943084, 0, 0, 0, 0, 0 },
-  { 140258314.30838314, 48954661.60248678, 140258277.22960863, 48954676.60796846, 140258351.38715765, 48954646.59700511, 140258312.4544444, 48954662.35276087, 140258316.16232187, 48954660.8522127, 0, 0, 0, 0, 0 },
-  { 140258325.16347829, 48954688.425592765, 140258287.9345653, 48954703.05460638, 140258362.39239126, 48954673.79657915, 140258323.30203265, 48954689.15704345, 140258327.02492392, 48954687.69414208, 1, 1, 140258183.693609, 48954744.015844494, 37 },
-  { 140258335.75169855, 48954715.37121885, 140258298.44587433, 48954729.80297135, 140258373.05752277, 48954700.93946636, 140258333.88640735, 48954716.09280648, 140258337.61698976, 48954714.649631225, 0, 0, 0, 0, 0 },
-  { 140258346.20531538, 48954742.39363292, 140258308.98070595, 48954757.03359369, 140258383.42992482, 48954727.753672145, 140258344.34408492, 48954743.12563096, 140258348.06654584, 48954741.66163488, 0, 0, 0, 0, 0 },
-  { 140258356.82182822, 48954769.3879364, 140258319.7394442, 48954784.384495825, 140258393.90421224, 48954754.39137697, 140258354.967709, 48954770.13776437, 140258358.67594743, 48954768.638108425, 0, 0, 0, 0, 0 },
-  { 140258367.7096679, 48954796.31058183, 140258330.68345407, 48954811.445293285, 140258404.73588172, 48954781.17587038, 140258365.8583572, 48954797.067317404, 140258369.5609786, 48954795.55384626, 0, 0, 0, 0, 0 },
-  { 140258378.70384294, 48954823.20720799, 140258341.63480502, 48954838.23672658, 140258415.77288085, 48954808.1776894, 140258376.85039103, 48954823.95868392, 140258380.55729485, 48954822.45573206, 0, 0, 0, 0, 0 },
-  { 140258389.6195639, 48954850.129911594, 140258352.41064286, 48954864.80970025, 140258426.82848495, 48954835.45012294, 140258387.75911784, 48954850.86390103, 140258391.48000997, 48954849.39592216, 0, 0, 0, 0, 0 },
-  { 140258400.272041, 48954877.13078934, 140258362.83262148, 48954891.21233281, 140258437.7114605, 48954863.04924587, 140258398.40007, 48954877.83486652, 140258402.14401197, 48954876.42671216, 0, 0, 0, 0, 0 },
-  { 140258410.4764847, 48954904.261937946, 140258372.72727704, 48954917.49059333, 140258448.22569233, 48954891.03328256, 140258408.5890243, 48954904.92337071, 140258412.36394507, 48954903.60050518, 1, 3, 140258140.5696501, 48954998.84682392, 45 },
-  { 140258420.04810527, 48954931.57545412, 140258381.92657518, 48954943.689451955, 140258458.16963536, 48954919.46145629, 140258418.14202878, 48954932.18115401, 140258421.95418176, 48954930.969754234, 0, 0, 0, 0, 0 },
-  { 140258428.80211318, 48954959.123434596, 140258390.26995453, 48954969.859949395, 140258467.33427182, 48954948.3869198, 140258426.87550524, 48954959.660260335, 140258430.7287211, 48954958.58660886, 0, 0, 0, 0, 0 },
-  { 140258436.55751178, 48954986.95669844, 140258397.64253888, 48954996.21006993, 140258475.47248468, 48954977.70332695, 140258434.61176312, 48954987.419367015, 140258438.50326043, 48954986.494029865, 1, 0, 140258759.55178687, 48954910.153715074, 46 },
-  { 140258443.24666628, 48955015.08787923, 140258404.024982, 48955022.940234505, 140258482.46835056, 48955007.23552396, 140258441.28558207, 48955015.480496995, 140258445.2077505, 48955014.69526147, 1, 2, 140258250.07987127, 48955053.760728955, 38 },
-  { 140258448.93205276, 48955043.48578351, 140258409.4717059, 48955050.03414412, 140258488.3923996, 48955036.9374229, 140258446.95903543, 48955043.81320154, 140258450.9050701, 48955043.15836548, 1, 3, 140258791.25056165, 48954986.67875525, 34 },
-  { 140258453.68330988, 48955072.116805114, 140258414.04192644, 48955077.461028025, 140258493.32469332, 48955066.7725822, 140258451.70124072, 48955072.38401626, 140258455.66537905, 48955071.84959397, 1, 3, 140258191.05914456, 48955107.52228192, 50 },
-  { 140258457.5700762, 48955100.94733788, 140258417.79550865, 48955105.18806633, 140258497.34464374, 48955096.70660943, 140258455.58134782, 48955101.159374304, 140258459.55880457, 48955100.73530146, 0, 0, 0, 0, 0 },
-  { 140258460.66164365, 48955129.943714306, 140258420.78674033, 48955133.10474045, 140258500.53654698, 48955126.78268816, 140258458.66789848, 48955130.10176561, 140258462.65538883, 48955129.785663, 1, 5, 140258293.18704978, 48955143.220024094, 26 },
-  { 140258462.96996388, 48955159.06212133, 140258423.01700684, 48955161.00150891, 140258502.9229209, 48955157.12273376, 140258460.97231603, 48955159.15909071, 140258464.96761173, 48955158.96515195, 1, 1, 140258834.5324643, 48955141.025816895, 35 },
-  { 140258464.38618237, 48955188.23737089, 140258424.38994348, 48955188.785892226, 140258504.38242126, 48955187.68884956, 140258462.38637042, 48955188.26479696, 140258466.38599432, 48955188.20994483, 0, 0, 0, 0, 0 },
-  { 140258464.7861496, 48955217.40156869, 140258424.79910484, 48955216.38360426, 140258504.77319434, 48955218.41953312, 140258462.78679734, 48955217.350670464, 140258466.78550184, 48955217.45246691, 0, 0, 0, 0, 0 },
-  { 140258464.045716, 48955246.48682044, 140258424.1413786, 48955243.722067595, 140258503.95005336, 48955249.25157328, 140258462.0504991, 48955246.3485828, 140258466.04093286, 48955246.62505808, 0, 0, 0, 0, 0 },
-  { 140258462.04073206, 48955275.42523184, 140258422.31702814, 48955270.731901884, 140258501.76443598, 48955280.11856179, 140258460.05454686, 48955275.19056534, 140258464.02691725, 48955275.65989833, 0, 0, 0, 0, 0 },
-  { 140258458.6470482, 48955304.1489086, 140258419.2292531, 48955297.34909762, 140258498.0648433, 48955310.94871958, 140258456.67615846, 48955303.80891805, 140258460.61793795, 48955304.48889915, 0, 0, 0, 0, 0 },
-  { 140258453.74077561, 48955332.59005911, 140258414.7551411, 48955323.639064655, 140258492.72641012, 48955341.54105356, 140258451.7914939, 48955332.142509386, 140258455.69005734, 48955333.03760883, 0, 0, 0, 0, 0 },
-  { 140258447.2834709, 48955360.71454548, 140258408.7789514, 48955349.87932613, 140258485.7879904, 48955371.549764834, 140258445.35824493, 48955360.172784515, 140258449.20869687, 48955361.25630645, 0, 0, 0, 0, 0 },
-  { 140258439.44485074, 48955388.57021621, 140258401.41720238, 48955376.16465456, 140258477.4724991, 48955400.97577786, 140258437.54346833, 48955387.949938126, 140258441.34623316, 48955389.19049429, 0, 0, 0, 0, 0 },
-  { 140258430.42572966, 48955416.21716801, 140258392.83418852, 48955402.54690709, 140258468.0172708, 48955429.88742893, 140258428.5461526, 48955415.533654965, 140258432.30530673, 48955416.900681056, 0, 0, 0, 0, 0 },
-  { 140258420.42613074, 48955443.714838795, 140258383.30628723, 48955428.81124131, 140258457.54597425, 48955458.618436284, 140258418.57013857, 48955442.96965892, 140258422.2821229, 48955444.46001867, 0, 0, 0, 0, 0 },
-  { 140258409.47807166, 48955470.98276791, 140258373.12943754, 48955454.28615755, 140258445.82670578, 48955487.67937827, 140258407.66063994, 48955470.147937395, 140258411.29550338, 48955471.817598425, 0, 0, 0, 0, 0 },
-  { 140258397.23857483, 48955497.6282356, 140258362.10405242, 48955478.50847264, 140258432.37309724, 48955516.747998565, 140258395.48184872, 48955496.672247455, 140258398.99530095, 48955498.58422375, 0, 0, 0, 0, 0 },
-  { 140258383.31389987, 48955523.21625179, 140258349.99356538, 48955501.08583586, 140258416.63423437, 48955545.34666772, 140258381.64788315, 48955522.109730996, 140258384.9799166, 48955524.322772585, 0, 0, 0, 0, 0 },
-  { 140258367.31030637, 48955547.31182642, 140258336.5780287, 48955521.70856276, 140258398.04258403, 48955572.915090084, 140258365.7736925, 48955546.03166324, 140258368.84692025, 48955548.59198961, 1, 0, 140258490.239417, 48955649.72488106, 38 },
-  { 140258348.8386114, 48955569.4838927, 140258320.36767602, 48955541.38752569, 140258377.30954677, 48955597.58025971, 140258347.41506463, 48955568.07907435, 140258350.26215816, 48955570.88871105, 0, 0, 0, 0, 0 },
-  { 140258328.4678111, 48955590.1262675, 140258299.89829352, 48955562.13014876, 140258357.0373287, 48955618.12238624, 140258327.03933522, 48955588.72646156, 140258329.896287, 48955591.52607344, 0, 0, 0, 0, 0 },
-  { 140258308.1577901, 48955610.85226556, 140258279.1707312, 48955583.2886951, 140258337.144849, 48955638.41583602, 140258306.70843714, 48955609.47408704, 140258309.60714304, 48955612.23044408, 1, 3, 140258026.25864232, 48955342.79654284, 33 },
-  { 140258288.1701153, 48955631.87218051, 140258258.85582095, 48955604.65688797, 140258317.48440963, 48955659.08747304, 140258286.70440057, 48955630.51141588, 140258289.63583001, 48955633.23294514, 0, 0, 0, 0, 0 },
-  { 140258268.43944773, 48955653.12459201, 140258238.88521105, 48955626.17005447, 140258297.9936844, 48955680.079129554, 140258266.9617359, 48955651.77686514, 140258269.91715956, 48955654.47231889, 0, 0, 0, 0, 0 },
-  { 140258248.9004486, 48955674.548079774, 140258219.19122288, 48955647.76446711, 140258278.6096743, 48955701.331692435, 140258247.4149873, 48955673.20889914, 140258250.3859099, 48955675.88726041, 1, 5, 140258372.19373533, 48955785.7000723, 37 },
-  { 140258229.48777908, 48955696.08122348, 140258199.70696035, 48955669.377238095, 140258259.2685978, 48955722.785208866, 140258227.99873814, 48955694.746024214, 140258230.97682002, 48955697.41642275, 0, 0, 0, 0, 0 },
-  { 140258210.13610026, 48955717.66260284, 140258180.36637783, 48955690.946247794, 140258239.9058227, 48955744.37895789, 140258208.64761415, 48955716.32678509, 140258211.62458637, 48955718.998420596, 0, 0, 0, 0, 0 },
-  { 140258190.78007337, 48955739.23079755, 140258161.10431275, 48955712.410110906, 140258220.455834, 48955766.0514842, 140258189.29628533, 48955737.88976322, 140258192.26386142, 48955740.57183188, 0, 0, 0, 0, 0 },
-  { 140258171.35435948, 48955760.724387296, 140258141.85648218, 48955733.70818411, 140258200.85223678, 48955787.74059048, 140258169.8794656, 48955759.37357713, 140258172.82925335, 48955762.07519746, 0, 0, 0, 0, 0 },
-  { 140258151.79361972, 48955782.08195176, 140258122.5594457, 48955754.780613504, 140258181.02779374, 48955809.383290015, 140258150.33191103, 48955780.716884844, 140258153.25532842, 48955783.447018676, 1, 4, 140257866.02956885, 48955515.211370334, 26 },
-  { 140258132.03251535, 48955803.24207067, 140258103.15053013, 48955775.568420194, 140258160.91450056, 48955830.91572114, 140258130.5884161, 48955801.85838814, 140258133.4766146, 48955804.625753194, 0, 0, 0, 0, 0 },
-  { 140258112.0057074, 48955824.14332369, 140258083.56554788, 48955796.01580466, 140258140.44586694, 48955852.270842716, 140258110.58369943, 48955822.73694774, 140258113.4277154, 48955825.54969964, 1, 5, 140257865.2873236, 48955580.13709613, 27 },
-  { 140258091.64947087, 48955844.72582206, 140258063.67582366, 48955816.13430125, 140258119.62311807, 48955873.31734287, 140258090.2507885, 48955843.29624602, 140258093.04815322, 48955846.1553981, 0, 0, 0, 0, 0 },
-  { 140258070.9504752, 48955864.977504596, 140258043.38691562, 48955835.99043534, 140258098.51403475, 48955893.96457385, 140258069.57229722, 48955863.52815113, 140258072.32865316, 48955866.42685806, 0, 0, 0, 0, 0 },
-  { 140258049.9544954, 48955884.94240461, 140258022.73723274, 48955855.62993945, 140258077.17175806, 48955914.254869774, 140258048.59363228, 48955883.47678135, 140258051.31535852, 48955886.40802787, 1, 1, 140258137.73016745, 48955979.47510476, 42 },
-  { 140258028.71067622, 48955904.667753644, 140258001.77370107, 48955875.097508974, 140258055.64765137, 48955934.237998314, 140258027.36382747, 48955903.18924141, 140258030.05752498, 48955906.14626588, 0, 0, 0, 0, 0 },
-  { 140258007.26816243, 48955924.20078313, 140257980.5437966, 48955894.438251816, 140258033.99252826, 48955953.96331445, 140258005.93194413, 48955922.712656565, 140258008.60438073, 48955925.6889097, 0, 0, 0, 0, 0 },
-  { 140257985.6760986, 48955943.588724546, 140257959.0954722, 48955913.697751, 140258012.25672498, 48955973.47969809, 140257984.34706727, 48955942.09417587, 140257987.0051299, 48955945.083273225, 1, 0, 140257919.22453254, 48955868.861290686, 29 },
-  { 140257963.98362958, 48955962.87880935, 140257937.47710213, 48955932.92210723, 140257990.49015704, 48955992.83551147, 140257962.6583032, 48955961.38097424, 140257965.30895597, 48955964.376644455, 0, 0, 0, 0, 0 },
-  { 140257942.23990008, 48955982.11826905, 140257915.737442, 48955952.15796673, 140257968.74235818, 48956012.078571364, 140257940.9147772, 48955980.620253935, 140257943.56502298, 48955983.61628416, 0, 0, 0, 0, 0 },
-  { 140257920.49405476, 48956001.3543351, 140257893.9256085, 48955971.45253478, 140257947.06250104, 48956031.25613542, 140257919.16563246, 48955999.859245084, 140257921.82247707, 48956002.849425115, 0, 0, 0, 0, 0 },
-  { 140257898.79523844, 48956020.63423898, 140257872.09107885, 48955990.85357645, 140257925.49939802, 48956050.41490151, 140257897.46003047, 48956019.145205855, 140257900.1304464, 48956022.123272106, 0, 0, 0, 0, 0 },
-  { 140257877.19259584, 48956040.005212165, 140257850.28370893, 48956010.40940493, 140257904.10148275, 48956069.6010194, 140257875.8471515, 48956038.525421806, 140257878.5380402, 48956041.485002525, 1, 5, 140258068.24569282, 48956250.13544354, 44 },
-  { 140257855.7352716, 48956059.51448611, 140257828.55377018, 48956030.16885646, 140257882.91677302, 48956088.86011577, 140257854.37619653, 48956058.04720463, 140257857.09434667, 48956060.981767595, 0, 0, 0, 0, 0 },
-  { 140257834.4724105, 48956079.20929233, 140257806.9520054, 48956050.181248955, 140257861.9928156, 48956108.237335704, 140257833.09639025, 48956077.757890165, 140257835.84843075, 48956080.660694495, 0, 0, 0, 0, 0 },
-  { 140257813.45315728, 48956099.136862256, 140257785.52969944, 48956070.49632276, 140257841.3766151, 48956127.77740175, 140257812.0569844, 48956097.70483528, 140257814.84933016, 48956100.56888923, 0, 0, 0, 0, 0 },
-  { 140257792.72665662, 48956119.344427384, 140257764.33876342, 48956091.16415911, 140257821.11454982, 48956147.52469566, 140257791.30726194, 48956117.93541397, 140257794.1460513, 48956120.7534408, 0, 0, 0, 0, 0 },
-  { 140257772.3420533, 48956139.87921918, 140257743.43182752, 48956112.2350725, 140257801.25227907, 48956167.52336586, 140257770.896542, 48956138.49701185, 140257773.78756458, 48956141.261426516, 1, 3, 140257637.18674782, 48956010.642833434, 37 },
-  { 140257752.34849197, 48956160.788469106, 140257722.86751363, 48956133.75382622, 140257781.8294703, 48956187.82311199, 140257750.87444305, 48956159.43673696, 140257753.82254088, 48956162.14020125, 0, 0, 0, 0, 0 },
-  { 140257732.79143152, 48956182.11522671, 140257702.74672592, 48956155.70849146, 140257762.83613712, 48956208.52196196, 140257731.28919622, 48956180.79488995, 140257734.2936668, 48956183.43556347, 0, 0, 0, 0, 0 },
-  { 140257713.67923257, 48956203.86045137, 140257683.10726973, 48956178.0659735, 140257744.2511954, 48956229.65492924, 140257712.15063444, 48956202.570727475, 140257715.2078307, 48956205.150175266, 1, 0, 140258012.5201692, 48956456.00147261, 31 },
-  { 140257694.9987967, 48956226.00075573, 140257663.93484724, 48956200.80093342, 140257726.06274617, 48956251.200578034, 140257693.44559923, 48956224.74076461, 140257696.55199417, 48956227.260746844, 0, 0, 0, 0, 0 },
-  { 140257676.73676437, 48956248.5124561, 140257645.21449995, 48956223.88834504, 140257708.2590288, 48956273.13656715, 140257675.16065115, 48956247.281250544, 140257678.3128776, 48956249.74366165, 1, 1, 140257979.35050285, 48956484.90392227, 35 },
-  { 140257658.87977585, 48956271.37186867, 140257626.9312615, 48956247.303374104, 140257690.8282902, 48956295.440363236, 140257657.28235012, 48956270.16844394, 140257660.47720158, 48956272.5752934, 0, 0, 0, 0, 0 },
-  { 140257641.41447154, 48956294.55530974, 140257609.07018033, 48956271.021359235, 140257673.75876275, 48956318.08926025, 140257639.79725698, 48956293.37861222, 140257643.0316861, 48956295.732007265, 1, 5, 140257748.1506325, 48956372.217346415, 49 },
-  { 140257624.32749167, 48956318.039095536, 140257591.61633673, 48956295.01779358, 140257657.0386466, 48956341.06039749, 140257622.69193393, 48956316.88803044, 140257625.9630494, 48956319.19016063, 0, 0, 0, 0, 0 },
-  { 140257607.60547677, 48956341.79954233, 140257574.5548588, 48956319.268305056, 140257640.65609473, 48956364.330779605, 140257605.95294586, 48956340.672980465, 140257609.25800768, 48956342.926104195, 0, 0, 0, 0, 0 },
-  { 140257591.23506713, 48956365.81296636, 140257557.8706798, 48956343.749021634, 140257624.59945446, 48956387.87691109, 140257589.56684777, 48956364.70976912, 140257592.9032865, 48956366.9161636, 0, 0, 0, 0, 0 },
-  { 140257575.2031875, 48956390.05585895, 140257541.53278708, 48956368.461782515, 140257608.8735879, 48956411.64993538, 140257573.51966748, 48956388.976155125, 140257576.8867075, 48956391.13556277, 1, 2, 140257668.6385486, 48956449.979421034, 40 },
-  { 140257559.51574123, 48956414.51639093, 140257525.520707, 48956393.4370729, 140257593.51077545, 48956435.59570895, 140257557.81598952, 48956413.46242502, 140257561.21549293, 48956415.57035683, 1, 2, 140257410.78746653, 48956322.29437457, 42 },
-  { 140257544.20920372, 48956439.201547526, 140257509.8702147, 48956418.68731264, 140257578.54819274, 48956459.71578241, 140257542.49225426, 48956438.17583578, 140257545.92615318, 48956440.22725927, 1, 3, 140257693.58380598, 48956528.43846927, 37 },
-  { 140257529.3228201, 48956464.12001837, 140257494.62258253, 48956444.22294542, 140257564.02305767, 48956484.01709132, 140257527.58780822, 48956463.125164725, 140257531.05783197, 48956465.114872016, 0, 0, 0, 0, 0 },
-  { 140257514.89583528, 48956489.28049308, 140257479.81937316, 48956470.054422125, 140257549.9722974, 48956508.506564036, 140257513.14201218, 48956488.31918953, 140257516.64965838, 48956490.24179663, 1, 3, 140257679.7552073, 48956579.64302658, 42 },
-  { 140257500.96749434, 48956514.69166131, 140257465.50246942, 48956496.1921476, 140257536.43251926, 48956533.19117503, 140257499.1942431, 48956513.76668563, 140257502.74074557, 48956515.616637, 1, 3, 140257185.3287726, 48956350.04598922, 35 },
-  { 140257487.57704225, 48956540.362212665, 140257451.7140993, 48956522.64641964, 140257523.43998522, 48956558.078005694, 140257485.7838951, 48956539.47642301, 140257489.3701894, 48956541.24800232, 1, 1, 140257720.68617144, 48956655.51486737, 28 },
-  { 140257474.76372412, 48956566.30083683, 140257438.50353584, 48956549.41300849, 140257511.0239124, 48956583.188665174, 140257472.9507147, 48956565.45644541, 140257476.57673353, 48956567.14522825, 1, 3, 140257316.1254004, 48956492.41658784, 33 },
-  { 140257462.55590805, 48956592.51247873, 140257425.94107994, 48956576.40799607, 140257499.17073616, 48956608.61696139, 140257460.72516665, 48956591.707254596, 140257464.38664946, 48956593.31770287, 0, 0, 0, 0, 0 },
-  { 140257450.91499385, 48956618.97902731, 140257413.99945226, 48956603.576339565, 140257487.83053544, 48956634.38171505, 140257449.0692168, 48956618.20889292, 140257452.76077092, 48956619.7491617, 1, 2, 140257174.048432, 48956503.458869234, 29 },
-  { 140257439.7769146, 48956645.673603915, 140257402.60983557, 48956630.88819774, 140257476.94399363, 48956660.45901009, 140257437.91856065, 48956644.93433361, 140257441.63526854, 48956646.41287422, 0, 0, 0, 0, 0 },
-  { 140257429.07755402, 48956672.56931282, 140257391.70374203, 48956658.314552985, 140257466.451366, 48956686.82407265, 140257427.2088634, 48956671.856574826, 140257430.94624463, 48956673.28205081, 1, 1, 140257271.1731984, 48956612.342952505, 27 },
-  { 140257418.75279582, 48956699.63925831, 140257381.21319133, 48956685.82701388, 140257456.2924003, 48956713.45150274, 140257416.8758156, 48956698.94864609, 140257420.62977603, 48956700.32987053, 0, 0, 0, 0, 0 },
-  { 140257408.73852375, 48956726.8565447, 140257371.07077962, 48956713.39767951, 140257446.40626788, 48956740.3154099, 140257406.85513654, 48956726.18360145, 140257410.62191096, 48956727.52948796, 0, 0, 0, 0, 0 },
-  { 140257398.97062147, 48956754.194276266, 140257361.20972502, 48956740.99902331, 140257436.7315179, 48956767.38952922, 140257397.08257663, 48956753.534513615, 140257400.8586663, 48956754.85403892, 1, 5, 140257658.57678443, 48956844.91164035, 42 },
-  { 140257389.38497266, 48956781.625557266, 140257351.56389654, 48956768.60379853, 140257427.2060488, 48956794.647316, 140257387.49391887, 48956780.97446933, 140257391.27602646, 48956782.276645206, 0, 0, 0, 0, 0 },
-  { 140257379.9174612, 48956809.12349204, 140257342.06782869, 48956796.184971265, 140257417.7670937, 48956822.062012814, 140257378.02497956, 48956808.476566, 140257381.8099428, 48956809.77041808, 1, 5, 140257485.8964322, 48956845.3513502, 38 },
-  { 140257370.50397414, 48956836.661185995, 140257332.64758685, 48956823.7424422, 140257408.36036143, 48956849.57992979, 140257368.61115476, 48956836.015248805, 140257372.3967935, 48956837.307123184, 0, 0, 0, 0, 0 },
-  { 140257361.1000231, 48956864.21801494, 140257323.2280002, 48956851.34517992, 140257398.972046, 48956877.09084996, 140257359.20642194, 48956863.57437319, 140257362.99362424, 48956864.86165669, 0, 0, 0, 0, 0 },
-  { 140257351.72673863, 48956891.794321425, 140257313.8239772, 48956879.012276374, 140257389.62950006, 48956904.57636648, 140257349.83160055, 48956891.155219175, 140257353.62187672, 48956892.433423676, 1, 4, 140257051.34735426, 48956790.496614404, 39 },
-  { 140257342.41895026, 48956919.39482516, 140257304.47065258, 48956906.74861214, 140257380.36724794, 48956932.04103818, 140257340.52153537, 48956918.76251451, 140257344.31636515, 48956920.02713581, 1, 0, 140257481.87894422, 48956965.86965799, 29 },
-  { 140257333.21148747, 48956947.02424578, 140257295.2033036, 48956934.55917625, 140257371.21967134, 48956959.489315316, 140257331.31107828, 48956946.400992304, 140257335.11189666, 48956947.64749926, 0, 0, 0, 0, 0 },
-  { 140257324.13917994, 48956974.68730308, 140257286.05735546, 48956962.44905793, 140257362.22100443, 48956986.92554823, 140257322.23508874, 48956974.07539082, 140257326.04327115, 48956975.29921534, 0, 0, 0, 0, 0 },
-  { 140257315.23685724, 48957002.388716705, 140257277.06838757, 48956990.4234368, 140257353.4053269, 48957014.35399661, 140257313.32843375, 48957001.79045271, 140257317.14528072, 48957002.9869807, 0, 0, 0, 0, 0 },
-  { 140257306.53934887, 48957030.13320633, 140257268.2721416, 48957018.48756993, 140257344.80655614, 48957041.77884273, 140257304.6259885, 48957029.55092451, 140257308.45270923, 48957030.71548815, 0, 0, 0, 0, 0 },
-  { 140257298.08148447, 48957057.9254917, 140257259.70453104, 48957046.64677524, 140257336.4584379, 48957069.20420816, 140257296.1626368, 48957057.361555874, 140257300.00033215, 48957058.48942752, 1, 5, 140257172.39696196, 48957020.987695284, 39 },
-  { 140257289.89809352, 48957085.770292506, 140257251.4016507, 48957074.90641243, 140257328.39453635, 48957096.63417258, 140257287.97327137, 48957085.2270985, 140257291.82291567, 48957086.31348651, 1, 1, 140257650.80224493, 48957187.619168244, 41 },
-  { 140257282.02400568, 48957113.672328435, 140257243.39978743, 48957103.271859005, 140257320.64822394, 48957124.072797865, 140257280.09279478, 48957113.15230496, 140257283.9552166, 48957114.19235191, 0, 0, 0, 0, 0 },
-  { 140257274.49405053, 48957141.6363192, 140257235.73542958, 48957131.7484831, 140257313.25267148, 48957151.5241553, 140257272.55611947, 48957141.14192739, 140257276.4319816, 48957142.130711004, 1, 5, 140257439.21818954, 48957183.65962262, 38 },
-  { 140257267.3430576, 48957169.666984506, 140257228.44527587, 48957160.341611795, 140257306.24083933, 48957178.99235722, 140257265.3981685, 48957169.20071587, 140257269.2879467, 48957170.13325314, 0, 0, 0, 0, 0 },
-  { 140257260.60585648, 48957197.76904402, 140257221.5662422, 48957189.056494616, 140257299.64547077, 48957206.48159342, 140257258.65387577, 48957197.33341655, 140257262.5578372, 48957198.20467149, 1, 5, 140257479.22769645, 48957246.55932066, 26 },
-  { 140257254.31727672, 48957225.94721748, 140257215.13546547, 48957217.89826296, 140257293.49908796, 48957233.996171996, 140257252.35818616, 48957225.54476976, 140257256.27636728, 48957226.3496652, 1, 4, 140257108.36502987, 48957195.964861915, 29 },
-  { 140257248.51214787, 48957254.206224546, 140257209.19030324, 48957246.871885136, 140257287.8339925, 48957261.540563956, 140257246.54605564, 48957253.83950757, 140257250.4782401, 48957254.57294152, 1, 5, 140257529.66333702, 48957306.64675132, 26 },
-  { 140257243.2252996, 48957282.55078497, 140257203.76998442, 48957275.97217529, 140257282.68061477, 48957289.12939464, 140257241.25253385, 48957282.221854486, 140257245.19806534, 48957282.87971545, 1, 0, 140257065.67638135, 48957252.947041415, 36 },
-  { 140257238.4840724, 48957310.98636983, 140257198.91447937, 48957305.13424988, 140257278.0536654, 48957316.838489786, 140257236.50559273, 48957310.69376384, 140257240.46255204, 48957311.27897583, 0, 0, 0, 0, 0 },
-  { 140257234.2635631, 48957339.52369242, 140257194.60127643, 48957334.33688068, 140257273.92584977, 48957344.71050417, 140257232.28044876, 48957339.26435184, 140257236.24667743, 48957339.783033006, 0, 0, 0, 0, 0 },
-  { 140257230.51661414, 48957368.1756989, 140257190.78024098, 48957363.590870716, 140257270.2529873, 48957372.76052708, 140257228.52979547, 48957367.94645749, 140257232.5034328, 48957368.40494031, 0, 0, 0, 0, 0 },
-  { 140257227.1959858, 48957396.95534378, 140257187.40130246, 48957392.90772995, 140257266.99066913, 48957401.00295761, 140257225.20625162, 48957396.75296309, 140257229.18571997, 48957397.15772448, 0, 0, 0, 0, 0 },
-  { 140257224.25443822, 48957425.875581495, 140257184.4146135, 48957422.299499035, 140257264.09426296, 48957429.451663956, 140257222.262447, 48957425.69677737, 140257226.24642944, 48957426.05438562, 0, 0, 0, 0, 0 },
-  { 140257221.64473164, 48957454.94936653, 140257181.7682228, 48957451.80865894, 140257261.52124047, 48957458.09007412, 140257219.6509062, 48957454.79233115, 140257223.63855708, 48957455.10640191, 1, 4, 140257000.3301077, 48957437.51843942, 25 },
-  { 140257219.34229672, 48957484.182609, 140257179.41462705, 48957481.77819734, 140257259.2699664, 48957486.58702066, 140257217.34591323, 48957484.06238842, 140257221.3386802, 48957484.30282958, 1, 5, 140257408.99872762, 48957495.603564374, 26 },
-  { 140257217.5766916, 48957513.50225476, 140257177.5931237, 48957512.355826646, 140257257.5602595, 48957514.64868288, 140257215.5775132, 48957513.444933355, 140257219.57587, 48957513.55957617, 1, 5, 140257049.6457064, 48957508.68725669, 33 },
-  { 140257216.73706368, 48957542.78566088, 140257176.7424494, 48957543.44203621, 140257256.73167795, 48957542.129285544, 140257214.73733297, 48957542.81847964, 140257218.73679438, 48957542.75284211, 0, 0, 0, 0, 0 },
-  { 140257217.2150309, 48957571.90941682, 140257177.32956094, 48957574.93419532, 140257257.10050088, 48957568.88463832, 140257215.2207574, 48957572.06065574, 140257219.20930442, 48957571.75817789, 1, 3, 140257033.74186903, 48957585.823397905, 50 },
-  { 140257219.40221122, 48957600.75011198, 140257179.84943783, 48957606.71485157, 140257258.9549846, 48957594.78537239, 140257217.42457256, 48957601.04834896, 140257221.37984988, 48957600.451875, 0, 0, 0, 0, 0 },
-  { 140257223.69022256, 48957629.18433586, 140257184.806593, 48957638.56854348, 140257262.57385212, 48957619.80012824, 140257221.7460411, 48957629.65354624, 140257225.63440403, 48957628.71512548, 1, 4, 140257089.5417006, 48957661.559852146, 31 },
-  { 140257230.42750365, 48957657.10037869, 140257192.34443513, 48957669.334752105, 140257268.51057217, 48957644.86600528, 140257228.5233502, 48957657.71209736, 140257232.33165708, 48957656.48866002, 1, 1, 140257535.09205174, 48957559.2253914, 38 },
-  { 140257239.2549127, 48957684.57827336, 140257201.690558, 48957698.323063485, 140257276.81926742, 48957670.83348324, 140257237.37669498, 48957685.26551287, 140257241.13313043, 48957683.89103386, 0, 0, 0, 0, 0 },
-  { 140257249.23534173, 48957711.8546721, 140257211.75332135, 48957725.822425984, 140257286.7173621, 48957697.88691821, 140257247.3612407, 48957712.553059794, 140257251.10944274, 48957711.1562844, 1, 1, 140257520.04293895, 48957610.937650286, 43 },
-  { 140257259.4147592, 48957739.170812964, 140257221.59770057, 48957752.20423452, 140257297.2318178, 48957726.13739141, 140257257.52390626, 48957739.82248404, 140257261.30561212, 48957738.51914189, 1, 3, 140257041.02124566, 48957814.43882244, 31 },
-  { 140257268.9164378, 48957766.74036066, 140257231.04101777, 48957779.60319697, 140257306.79185784, 48957753.87752435, 140257267.0226668, 48957767.383502476, 140257270.8102088, 48957766.09721885, 0, 0, 0, 0, 0 },
-  { 140257278.2678333, 48957794.27612521, 140257241.24457604, 48957809.418067664, 140257315.29109055, 48957779.13418275, 140257276.41667044, 48957795.03322233, 140257280.11899614, 48957793.51902808, 1, 3, 140256931.1747964, 48957936.231835715, 39 },
-  { 140257289.21979567, 48957821.05454694, 140257254.4161389, 48957840.770161934, 140257324.02345246, 48957801.33893194, 140257287.47961283, 48957822.04032769, 140257290.95997852, 48957820.068766184, 1, 0, 140257381.44948614, 48957768.8081672, 28 },
-  { 140257303.53866693, 48957846.33141915, 140257272.46853614, 48957871.523619756, 140257334.60879773, 48957821.13921854, 140257301.98516038, 48957847.591029175, 140257305.0921735, 48957845.07180912, 0, 0, 0, 0, 0 },
-  { 140257322.0269004, 48957869.13339034, 140257295.98592767, 48957899.49566527, 140257348.06787315, 48957838.77111541, 140257320.7248518, 48957870.651504084, 140257323.32894903, 48957867.61527659, 0, 0, 0, 0, 0 },
-  { 140257344.2491228, 48957888.19284121, 140257324.85120377, 48957923.174561255, 140257363.64704183, 48957853.211121164, 140257343.27922684, 48957889.94192721, 140257345.21901876, 48957886.44375521, 1, 1, 140257238.53046408, 48958078.84321545, 47 },
-  { 140257369.6674318, 48957902.28769702, 140257357.2710599, 48957940.318342075, 140257382.0638037, 48957864.25705196, 140257369.0476132, 48957904.18922927, 140257370.2872504, 48957900.38616476, 0, 0, 0, 0, 0 },
-  { 140257397.3762529, 48957911.319593556, 140257390.76808056, 48957950.76996818, 140257403.98442522, 48957871.86921893, 140257397.0458443, 48957913.29211229, 140257397.7066615, 48957909.34707482, 0, 0, 0, 0, 0 },
-  { 140257426.15935636, 48957916.14093454, 140257423.9772599, 48957956.08137088, 140257428.3414528, 48957876.2004982, 140257426.05025154, 48957918.13795636, 140257426.26846117, 48957914.143912725, 1, 5, 140257443.72523284, 48957594.620422006, 42 },
-  { 140257455.09282345, 48957917.721678816, 140257455.70792627, 48957957.71694914, 140257454.47772062, 48957877.72640849, 140257455.12357858, 48957919.721442334, 140257455.0620683, 48957915.7219153, 0, 0, 0, 0, 0 },
-  { 140257484.09383237, 48957917.27566102, 140257486.0116407, 48957957.229659714, 140257482.17602405, 48957877.32166233, 140257484.18972278, 48957919.27336095, 140257483.99794197, 48957915.27796109, 0, 0, 0, 0, 0 },
-  { 140257513.19238365, 48957915.878918625, 140257516.6087787, 48957955.73275464, 140257509.7759886, 48957876.02508261, 140257513.3632034, 48957917.871610425, 140257513.0215639, 48957913.886226825, 0, 0, 0, 0, 0 },
-  { 140257542.19969824, 48957913.392321214, 140257548.02916977, 48957952.96525719, 140257536.3702267, 48957873.81938524, 140257542.4911718, 48957915.370968014, 140257541.90822467, 48957911.413674414, 1, 3, 140257527.48028263, 48957813.47065787, 26 },
-  { 140257570.83645743, 48957909.17385301, 140257579.9848187, 48957948.113646105, 140257561.68809617, 48957870.234059915, 140257571.2938755, 48957911.120842665, 140257570.37903938, 48957907.226863354, 0, 0, 0, 0, 0 },
-  { 140257598.82913387, 48957902.59736411, 140257611.51382804, 48957940.53281632, 140257586.1444397, 48957864.661911905, 140257599.46336856, 48957904.49413672, 140257598.19489917, 48957900.700591505, 0, 0, 0, 0, 0 },
-  { 140257626.0623921, 48957893.491223775, 140257641.76353875, 48957930.28081461, 140257610.36124542, 48957856.70163294, 140257626.84744942, 48957895.33070332, 140257625.27733475, 48957891.65174423, 0, 0, 0, 0, 0 },
-  { 140257652.590012, 48957882.169704795, 140257670.76088738, 48957917.804228626, 140257634.41913664, 48957846.53518096, 140257653.49855578, 48957883.951430984, 140257651.68146825, 48957880.387978606, 0, 0, 0, 0, 0 },
-  { 140257678.47404087, 48957868.97083439, 140257698.6068745, 48957903.53481869, 140257658.34120724, 48957834.40685009, 140257679.48068255, 48957870.6990336, 140257677.46739918, 48957867.242635176, 1, 1, 140257878.7957354, 48958212.88247814, 50 },
-  { 140257703.77652615, 48957854.2326398, 140257725.4141006, 48957887.87510362, 140257682.13895172, 48957820.59017597, 140257704.85840487, 48957855.91476299, 140257702.69464743, 48957852.550516605, 0, 0, 0, 0, 0 },
-  { 140257728.5595151, 48957838.29314824, 140257751.293149, 48957871.204877, 140257705.82588118, 48957805.38141949, 140257729.6961968, 48957839.93873468, 140257727.42283338, 48957836.6475618, 0, 0, 0, 0, 0 },
-  { 140257752.88505512, 48957821.490386955, 140257776.34497723, 48957853.88841244, 140257729.42513302, 48957789.09236147, 140257754.05805123, 48957823.11028823, 140257751.71205902, 48957819.87048568, 0, 0, 0, 0, 0 },
-  { 140257776.81516713, 48957804.16221479, 140257800.73887473, 48957836.21929225, 140257752.89145952, 48957772.10513733, 140257778.0113525, 48957805.765068665, 140257775.61898175, 48957802.55936092, 0, 0, 0, 0, 0 },
-  { 140257800.3986587, 48957786.562215015, 140257824.74713033, 48957818.29787207, 140257776.05018705, 48957754.826557964, 140257801.61608228, 48957788.148997866, 140257799.1812351, 48957784.975432165, 0, 0, 0, 0, 0 },
-  { 140257823.64974532, 48957768.723339885, 140257848.41859728, 48957800.13200068, 140257798.88089335, 48957737.31467909, 140257824.88818792, 48957770.29377293, 140257822.41130272, 48957767.15290684, 1, 3, 140257888.0487604, 48957850.38585794, 31 },
-  { 140257846.57705113, 48957750.64287961, 140257871.76131797, 48957781.719441585, 140257821.3927843, 48957719.56631764, 140257847.83626446, 48957752.19670771, 140257845.3178378, 48957749.089051515, 0, 0, 0, 0, 0 },
-  { 140257869.1892001, 48957732.318124324, 140257894.7833545, 48957763.05798867, 140257843.59504572, 48957701.578259975, 140257870.46890783, 48957733.855117545, 140257867.90949237, 48957730.7811311, 0, 0, 0, 0, 0 },
-  { 140257891.49481636, 48957713.74636421, 140257917.49279302, 48957744.145463035, 140257865.4968397, 48957683.34726539, 140257892.7947152, 48957715.266319156, 140257890.19491753, 48957712.22640927, 1, 0, 140257790.75265676, 48957595.94985629, 50 },
-  { 140257913.50252405, 48957694.92488946, 140257939.8977467, 48957724.979709715, 140257887.10730138, 48957664.870069206, 140257914.82228518, 48957696.42763047, 140257912.18276292, 48957693.42214845, 1, 5, 140258092.99003816, 48957899.29766718, 47 },
-  { 140257935.22094715, 48957675.850990206, 140257962.00635815, 48957705.558594584, 140257908.43553615, 48957646.14338583, 140257936.5602177, 48957677.33637042, 140257933.88167658, 48957674.36560999, 0, 0, 0, 0, 0 },
-  { 140257956.65870973, 48957656.52195665, 140257983.82680246, 48957685.88000047, 140257929.490617, 48957627.16391283, 140257958.01711437, 48957657.98985884, 140257955.3003051, 48957655.05405446, 0, 0, 0, 0, 0 },
-  { 140257977.82443598, 48957636.93507896, 140258005.3672897, 48957665.94182318, 140257950.28158227, 48957607.92833475, 140257979.20157868, 48957638.38541617, 140257976.44729328, 48957635.484741755, 1, 0, 140257831.84731135, 48957483.19933463, 42 },
-  { 140257998.72674987, 48957617.087647304, 140258026.63606572, 48957645.74196788, 140257970.817434, 48957588.43332673, 140258000.12221566, 48957618.52036333, 140257997.33128408, 48957615.65493128, 0, 0, 0, 0, 0 },
-  { 140258019.3742755, 48957596.97695184, 140258047.64141452, 48957625.27834493, 140257991.1071365, 48957568.675558746, 140258020.78763247, 48957598.39202149, 140258017.96091855, 48957595.56188218, 0, 0, 0, 0, 0 },
-  { 140258039.775637, 48957576.60028275, 140258068.38980153, 48957604.550767325, 140258011.16147247, 48957548.64979818, 140258041.20634523, 48957577.99780698, 140258038.34492877, 48957575.20275852, 0, 0, 0, 0, 0 },
-  { 140258059.94049436, 48957555.95661396, 140258088.86761004, 48957583.58308638, 140258031.01337868, 48957528.33014154, 140258061.38685015, 48957557.33793758, 140258058.49413857, 48957554.57529034, 1, 0, 140257929.7684738, 48957431.63748805, 42 },
-  { 140258079.89160728, 48957535.06621063, 140258109.08294445, 48957562.41334638, 140258050.70027012, 48957507.719074875, 140258081.35117415, 48957536.43356741, 140258078.43204042, 48957533.69885384, 1, 5, 140258186.439988, 48957634.88325612, 39 },
-  { 140258099.66071734, 48957513.963936426, 140258129.06877944, 48957541.07787903, 140258070.25265524, 48957486.849993825, 140258101.13112044, 48957515.31963356, 140258098.19031423, 48957512.60823929, 0, 0, 0, 0, 0 },
-  { 140258119.2797416, 48957492.68494015, 140258148.85836044, 48957519.612719595, 140258089.70112273, 48957465.75716071, 140258120.75867254, 48957494.031329125, 140258117.80081064, 48957491.33855118, 0, 0, 0, 0, 0 },
-  { 140258138.78059706, 48957471.26437063, 140258168.4846903, 48957498.05367531, 140258109.0765038, 48957444.47506595, 140258140.26580173, 48957472.60383586, 140258137.2953924, 48957469.9249054, 1, 1, 140257998.42875654, 48957344.68490602, 44 },
-  { 140258158.1952008, 48957449.73737668, 140258187.98051226, 48957476.43635084, 140258128.40988934, 48957423.03840253, 140258159.68446636, 48957451.07232539, 140258156.70593524, 48957448.40242797, 1, 3, 140258455.30368266, 48957716.059643894, 27 },
-  { 140258177.55546978, 48957428.13910709, 140258207.37829828, 48957454.79616809, 140258147.73264128, 48957401.4820461, 140258179.04661122, 48957429.47196014, 140258176.06432834, 48957426.806254044, 1, 0, 140257881.56389704, 48957163.567776695, 40 },
-  { 140258196.89332113, 48957406.50471071, 140258226.71024278, 48957433.16837857, 140258167.07639948, 48957379.841042854, 140258198.3841672, 48957407.837894104, 140258195.40247506, 48957405.17152732, 0, 0, 0, 0, 0 },
-  { 140258216.24067172, 48957384.869336314, 140258246.0082589, 48957411.58807042, 140258186.47308454, 48957358.15060221, 140258217.72905108, 48957386.20527302, 140258214.75229236, 48957383.53339961, 1, 2, 140257947.58819726, 48957143.732760966, 32 },
-  { 140258235.6294388, 48957363.26813276, 140258265.30398142, 48957390.09016697, 140258205.95489615, 48957336.44609855, 140258237.11316592, 48957364.609234475, 140258234.14571166, 48957361.92703105, 0, 0, 0, 0, 0 },
-  { 140258255.09153917, 48957341.73624881, 140258284.62876996, 48957368.70942062, 140258225.55430838, 48957314.763077006, 140258256.5684007, 48957343.084907405, 140258253.61467764, 48957340.38759022, 0, 0, 0, 0, 0 },
-  { 140258274.65889007, 48957320.30883333, 140258304.01372033, 48957347.480398245, 140258245.3040598, 48957293.13726842, 140258276.1266316, 48957321.66741157, 140258273.19114855, 48957318.95025509, 0, 0, 0, 0, 0 },
-  { 140258294.36340842, 48957299.0210351, 140258323.48967737, 48957326.43746187, 140258265.23713946, 48957271.60460833, 140258295.81972188, 48957300.39185644, 140258292.90709496, 48957297.650213756, 1, 3, 140258109.41160053, 48957124.92672513, 36 },
-  { 140258314.23701122, 48957277.90800292, 140258343.08761102, 48957305.614372075, 140258285.38641143, 48957250.20163377, 140258315.6795412, 48957279.29332138, 140258312.79448125, 48957276.52268446, 0, 0, 0, 0, 0 },
-  { 140258334.3113665, 48957257.0046075, 140258362.99997628, 48957284.878675535, 140258305.62275672, 48957229.13053946, 140258335.74579698, 48957258.3983109, 140258332.87693602, 48957255.6109041, 0, 0, 0, 0, 0 },
-  { 140258354.50567526, 48957236.2201765, 140258383.43751332, 48957263.84170336, 140258325.5738372, 48957208.59864964, 140258355.95226717, 48957237.60125285, 140258353.05908334, 48957234.83910016, 0, 0, 0, 0, 0 },
-  { 140258374.53536722, 48957215.24031513, 140258403.78956202, 48957242.520199426, 140258345.28117242, 48957187.96043084, 140258375.99807695, 48957216.60430935, 140258373.0726575, 48957213.87632091, 0, 0, 0, 0, 0 },
-  { 140258394.33542565, 48957194.007279105, 140258423.91589305, 48957220.933027886, 140258364.75495824, 48957167.081530325, 140258395.814449, 48957195.35356654, 140258392.85640228, 48957192.66099167, 1, 4, 140258517.09436542, 48957305.74913656, 31 },
-  { 140258413.8919443, 48957172.52260408, 140258443.8024787, 48957199.08121719, 140258383.98140988, 48957145.963990964, 140258415.38747102, 48957173.85053474, 140258412.39641756, 48957171.19467342, 0, 0, 0, 0, 0 },
-  { 140258433.1910168, 48957150.78782561, 140258463.43526527, 48957176.965782635, 140258402.9467683, 48957124.60986858, 140258434.70322922, 48957152.09672346, 140258431.67880437, 48957149.478927754, 1, 1, 140258611.6320828, 48957305.237772085, 39 },
-  { 140258452.2187369, 48957128.80447932, 140258482.8001713, 48957154.58772717, 140258421.6373025, 48957103.02123148, 140258453.7478086, 48957130.09364171, 140258450.68966517, 48957127.51531693, 1, 2, 140258241.20683944, 48956950.90006922, 41 },
-  { 140258470.96119842, 48957106.57410084, 140258501.88308555, 48957131.94804214, 140258440.0393113, 48957081.200159535, 140258472.50729278, 48957107.842797905, 140258469.41510406, 48957105.30540377, 0, 0, 0, 0, 0 },
-  { 140258489.404495, 48957084.09822576, 140258520.66986352, 48957109.047709346, 140258458.13912648, 48957059.14874217, 140258490.96776342, 48957085.345699936, 140258487.84122658, 48957082.85075158, 0, 0, 0, 0, 0 },
-  { 140258507.53472036, 48957061.37838969, 140258539.14632568, 48957085.88770239, 140258475.92311504, 48957036.86907698, 140258509.11530063, 48957062.60385532, 140258505.9541401, 48957060.15292405, 1, 4, 140258614.2238883, 48957144.09732006, 29 },
-  { 140258525.33796826, 48957038.41612825, 140258557.2982546, 48957062.4689887, 140258493.3776819, 48957014.363267794, 140258526.93598258, 48957039.61877127, 140258523.73995394, 48957037.213485226, 1, 0, 140258348.75738615, 48956905.52407423, 45 },
-  { 140258542.8003324, 48957015.21297704, 140258575.11139208, 48957038.79253219, 140258510.4892727, 48956991.63342188, 140258544.4158854, 48957016.391954795, 140258541.1847794, 48957014.03399928, 1, 1, 140258697.08564243, 48957127.80535291, 37 },
-  { 140258559.9079065, 48956991.77047168, 140258592.57143655, 48957014.85929592, 140258527.24437645, 48956968.681647435, 140258561.541083, 48956992.92491289, 140258558.27473, 48956990.61603046, 1, 2, 140258285.53425413, 48956797.824348025, 34 },
-  { 140258576.64678428, 48956968.090147756, 140258609.66404012, 48956990.670245536, 140258543.62952843, 48956945.51004998, 140258578.29764706, 48956969.219152644, 140258574.9959215, 48956966.96114287, 1, 5, 140258791.25894734, 48957114.86078331, 35 },
-  { 140258593.00305942, 48956944.173540905, 140258626.3748061, 48956966.22635305, 140258559.63131273, 48956922.12072876, 140258594.67164674, 48956945.27618151, 140258591.3344721, 48956943.0709003, 0, 0, 0, 0, 0 },
-  { 140258608.9628257, 48956920.02218671, 140258642.68914673, 48956941.52881984, 140258575.23650464, 48956898.515553586, 140258610.64914173, 48956921.09751837, 140258607.27650964, 48956918.94685505, 1, 2, 140258737.12284568, 48957001.74739259, 25 },
-  { 140258624.51235467, 48956895.637690835, 140258658.57235342, 48956916.61187699, 140258590.45235592, 48956874.66350468, 140258626.21535462, 48956896.686400145, 140258622.80935472, 48956894.588981524, 0, 0, 0, 0, 0 },
-  { 140258639.66449094, 48956871.03212384, 140258673.99695724, 48956891.55727323, 140258605.33202463, 48956850.50697445, 140258641.38111424, 48956872.05838131, 140258637.94786763, 48956870.00586637, 0, 0, 0, 0, 0 },
-  { 140258654.48665765, 48956846.23905026, 140258689.0285035, 48956866.40984313, 140258619.9448118, 48956826.06825739, 140258656.21374995, 48956847.24758991, 140258652.75956535, 48956845.230510615, 1, 3, 140258464.50650546, 48956735.29968948, 45 },
-  { 140258669.05298436, 48956821.29467574, 140258703.74393064, 48956841.207943834, 140258634.36203808, 48956801.38140764, 140258670.78753167, 48956822.29033914, 140258667.31843704, 48956820.29901233, 0, 0, 0, 0, 0 },
-  { 140258683.4376004, 48956796.23520583, 140258718.2195016, 48956815.989176296, 140258648.6556992, 48956776.48123536, 140258685.17669547, 48956797.222904354, 140258681.69850534, 48956795.247507304, 0, 0, 0, 0, 0 },
-  { 140258697.71463525, 48956771.0968461, 140258732.530739, 48956790.79047244, 140258662.8985315, 48956751.40321977, 140258699.45544043, 48956772.08152742, 140258695.97383007, 48956770.11216479, 0, 0, 0, 0, 0 },
-  { 140258711.95821843, 48956745.91580218, 140258746.7523897, 48956765.648152396, 140258677.16404715, 48956726.183451965, 140258713.697927, 48956746.902419694, 140258710.21850985, 48956744.92918467, 0, 0, 0, 0, 0 },
-  { 140258726.2424792, 48956720.72827963, 140258760.95841485, 48956740.59795031, 140258691.52654356, 48956700.858608946, 140258727.97827598, 48956721.721763164, 140258724.50668243, 48956719.73479609, 1, 4, 140258977.93301255, 48956864.78339207, 45 },
-  { 140258740.64154708, 48956695.57048403, 140258775.222007, 48956715.67500572, 140258706.06108716, 48956675.465962335, 140258742.3705701, 48956696.57571011, 140258738.91252407, 48956694.565257944, 1, 4, 140258469.1849368, 48956537.749988735, 37 },
-  { 140258755.22955158, 48956670.47862099, 140258789.61563146, 48956690.913823724, 140258720.8434717, 48956650.04341826, 140258756.94885558, 48956671.50038113, 140258753.5102476, 48956669.456860855, 1, 1, 140258989.05489475, 48956809.43799959, 32 },
-  { 140258770.08062205, 48956645.488896064, 140258804.2110944, 48956666.34820708, 140258735.9501497, 48956624.62958505, 140258771.78714567, 48956646.53186162, 140258768.37409842, 48956644.44593051, 0, 0, 0, 0, 0 },
-  { 140258785.26888794, 48956620.637514874, 140258819.07964274, 48956642.01116359, 140258751.45813313, 48956599.26386616, 140258786.9594257, 48956621.706197314, 140258783.5783502, 48956619.568832435, 1, 1, 140259077.731917, 48956805.51957629, 30 },
-  { 140258800.86847866, 48956595.96068296, 140258834.27750245, 48956617.95698102, 140258767.45945486, 48956573.9643849, 140258802.53892985, 48956597.060497865, 140258799.19802746, 48956594.86086805, 1, 2, 140258564.49963525, 48956440.33687417, 32 },
-  { 140258816.96292746, 48956571.51566854, 140258849.78368983, 48956594.38043526, 140258784.1421651, 48956548.650901824, 140258818.60396558, 48956572.65890688, 140258815.32188934, 48956570.372430205, 0, 0, 0, 0, 0 },
-  { 140258833.69650924, 48956547.495790355, 140258865.6763704, 48956571.52261868, 140258801.71664807, 48956523.46896203, 140258835.2955023, 48956548.69713177, 140258832.09751618, 48956546.29444894, 0, 0, 0, 0, 0 },
-  { 140258851.2376389, 48956524.14843534, 140258882.082694, 48956549.61571976, 140258820.3925838, 48956498.68115092, 140258852.77989164, 48956525.42179956, 140258849.69538614, 48956522.875071116, 1, 1, 140259081.03329942, 48956713.87970427, 47 },
-  { 140258869.75479224, 48956501.72112797, 140258899.1212498, 48956528.88012596, 140258840.3883347, 48956474.56212998, 140258871.22311512, 48956503.07907787, 140258868.28646937, 48956500.363178074, 0, 0, 0, 0, 0 },
-  { 140258889.41644555, 48956480.461392716, 140258916.90719813, 48956509.517519824, 140258861.92569298, 48956451.40526561, 140258890.79098317, 48956481.91419907, 140258888.04190794, 48956479.00858636, 0, 0, 0, 0, 0 },
-  { 140258910.39107478, 48956460.616754085, 140258935.58039036, 48956491.68922389, 140258885.2017592, 48956429.54428428, 140258911.65054056, 48956462.170377575, 140258909.131609, 48956459.063130595, 1, 2, 140258776.8877021, 48956295.93266412, 43 },
-  { 140258932.83324614, 48956442.423706, 140258955.56459576, 48956475.3370125, 140258910.10189652, 48956409.510399505, 140258933.96981362, 48956444.06937133, 140258931.69667867, 48956440.77804068, 1, 3, 140259101.04523334, 48956685.98217407, 36 },
-  { 140258956.68530053, 48956425.950448066, 140258977.0557191, 48956460.37494584, 140258936.31488195, 48956391.52595029, 140258957.70382145, 48956427.671672955, 140258955.6667796, 48956424.22922318, 0, 0, 0, 0, 0 },
-  { 140258981.72408926, 48956411.13394703, 140258999.72428468, 48956446.85499075, 140258963.72389385, 48956375.41290331, 140258982.62409905, 48956412.91999922, 140258980.82407948, 48956409.34789484, 1, 3, 140259064.9749931, 48956576.343774244, 27 },
-  { 140259007.74261832, 48956398.02294693, 140259022.15212524, 48956435.33736921, 140258993.3331114, 48956360.70852465, 140259008.46309367, 48956399.888668045, 140259007.02214298, 48956396.15722582, 0, 0, 0, 0, 0 },
-  { 140259034.7024231, 48956387.61202617, 140259043.9535392, 48956426.5275353, 140259025.451307, 48956348.69651704, 140259035.1649789, 48956389.55780163, 140259034.2398673, 48956385.66625071, 1, 1, 140259071.70688748, 48956543.27406269, 43 },
-  { 140259062.5998943, 48956380.98015238, 140259067.0143538, 48956420.735812955, 140259058.18543476, 48956341.22449181, 140259062.82061726, 48956382.96793541, 140259062.3791713, 48956378.992369354, 0, 0, 0, 0, 0 },
-  { 140259091.2542788, 48956377.79837604, 140259091.78683773, 48956417.79483064, 140259090.7217199, 48956337.801921435, 140259091.28090677, 48956379.79819877, 140259091.22765085, 48956375.79855331, 1, 3, 140259093.58422413, 48956552.782864936, 33 },
-  { 140259120.44351193, 48956377.40971692, 140259118.07835776, 48956417.33973127, 140259122.8086661, 48956337.47970257, 140259120.32525423, 48956379.406217635, 140259120.56176963, 48956375.4132162, 0, 0, 0, 0, 0 },
-  { 140259149.94552907, 48956379.15719485, 140259145.60983437, 48956418.921522476, 140259154.28122377, 48956339.39286723, 140259149.72874433, 48956381.14541123, 140259150.16231382, 48956377.168978475, 1, 1, 140259129.24258688, 48956569.031859264, 32 },
-  { 140259179.538265, 48956382.38383229, 140259173.7528958, 48956421.963239856, 140259185.32363418, 48956342.804424725, 140259179.24899653, 48956384.36280267, 140259179.82753345, 48956380.40486191, 1, 4, 140259230.3048796, 48956035.074530885, 48 },
-  { 140259208.95592687, 48956386.683846995, 140259200.92233372, 48956425.86881071, 140259216.98952, 48956347.49888328, 140259208.5542472, 48956388.64309518, 140259209.35760653, 48956384.72459881, 1, 0, 140259142.076264, 48956712.89866992, 42 },
-  { 140259237.76915786, 48956392.59105611, 140259226.34434384, 48956430.92477005, 140259249.19397187, 48956354.25734217, 140259237.19791716, 48956394.50774181, 140259238.34039855, 48956390.67437041, 0, 0, 0, 0, 0 },
-  { 140259265.51036495, 48956400.858925276, 140259249.57309836, 48956437.54684609, 140259281.44763154, 48956364.17100446, 140259264.71350163, 48956402.69332132, 140259266.30722827, 48956399.02452923, 0, 0, 0, 0, 0 },
-  { 140259291.71195513, 48956412.24092017, 140259270.65264958, 48956446.24835538, 140259312.77126068, 48956378.23348496, 140259290.65898985, 48956413.94129193, 140259292.7649204, 48956410.540548414, 1, 2, 140259500.19908008, 48956075.56731157, 28 },
-  { 140259316.01264092, 48956427.28926369, 140259291.16021016, 48956458.631833546, 140259340.86507168, 48956395.94669383, 140259314.77001938, 48956428.85639218, 140259317.25526246, 48956425.72213519, 1, 5, 140259225.30126864, 48956541.689643666, 40 },
-  { 140259338.71828333, 48956445.2932247, 140259311.76975268, 48956474.852938764, 140259365.66681397, 48956415.733510636, 140259337.3708568, 48956446.7712104, 140259340.06570986, 48956443.815239, 1, 4, 140259417.5427355, 48956358.831061065, 42 },
-  { 140259360.3929607, 48956465.053250335, 140259332.6945752, 48956493.911515005, 140259388.0913462, 48956436.194985665, 140259359.0080414, 48956466.49616357, 140259361.77787998, 48956463.6103371, 0, 0, 0, 0, 0 },
-  { 140259381.5855534, 48956485.39406465, 140259353.52621695, 48956513.901495926, 140259409.64488986, 48956456.886633374, 140259380.18258658, 48956486.819436215, 140259382.98852023, 48956483.968693085, 0, 0, 0, 0, 0 },
-  { 140259402.39014727, 48956505.87164094, 140259373.4263732, 48956533.459678076, 140259431.35392132, 48956478.28360381, 140259400.94195858, 48956507.2510428, 140259403.83833596, 48956504.49223909, 1, 4, 140259272.7772584, 48956629.328107126, 36 },
-  { 140259422.38791844, 48956526.86664406, 140259391.9775309, 48956552.85141518, 140259452.798306, 48956500.881872945, 140259420.86739907, 48956528.16588262, 140259423.90843782, 48956525.56740551, 0, 0, 0, 0, 0 },
-  { 140259441.13260826, 48956548.80385025, 140259408.84901297, 48956572.42099391, 140259473.41620356, 48956525.18670659, 140259439.5184285, 48956549.98470743, 140259442.74678802, 48956547.62299307, 0, 0, 0, 0, 0 },
-  { 140259458.17877057, 48956572.10520342, 140259423.9052482, 48956592.728628546, 140259492.45229295, 48956551.481778294, 140259456.46509445, 48956573.136374675, 140259459.8924467, 48956571.074032165, 0, 0, 0, 0, 0 },
-  { 140259473.14348447, 48956596.974663936, 140259437.08002326, 48956614.278616264, 140259509.2069457, 48956579.67071161, 140259471.3403114, 48956597.83986155, 140259474.94665754, 48956596.10946632, 1, 1, 140259357.74040863, 48956652.34731139, 28 },
-  { 140259485.74962848, 48956623.24734296, 140259448.1533394, 48956636.904540546, 140259523.34591758, 48956609.59014537, 140259483.86981404, 48956623.93020284, 140259487.62944293, 48956622.56448308, 0, 0, 0, 0, 0 },
-  { 140259495.730306, 48956650.722704194, 140259456.91363344, 48956660.380132966, 140259534.54697856, 48956641.06527542, 140259493.78947237, 48956651.20557563, 140259497.67113963, 48956650.23983276, 0, 0, 0, 0, 0 },
-  { 140259502.81451517, 48956679.19668359, 140259463.13189745, 48956684.22558505, 140259542.4971329, 48956674.167782135, 140259500.83038428, 48956679.44812866, 140259504.79864606, 48956678.94523852, 1, 2, 140259634.75921914, 48956662.47558625, 42 },
-  { 140259506.49828935, 48956708.26502061, 140259466.5061539, 48956707.47186051, 140259546.49042478, 48956709.058180705, 140259504.4986826, 48956708.22536261, 140259508.4978961, 48956708.30467861, 1, 1, 140259244.5498022, 48956703.069822, 28 },
-  { 140259505.92403662, 48956737.21956954, 140259466.6757027, 48956729.5015203, 140259545.17237055, 48956744.937618785, 140259503.9616199, 48956736.83366708, 140259507.88645333, 48956737.605472006, 0, 0, 0, 0, 0 },
-  { 140259500.38342723, 48956765.39504247, 140259462.65686885, 48956752.101931736, 140259538.10998562, 48956778.68815321, 140259498.4970993, 48956764.730386935, 140259502.26975515, 48956766.05969801, 0, 0, 0, 0, 0 },
-  { 140259490.7516242, 48956792.730614014, 140259454.2661741, 48956776.33512887, 140259527.2370743, 48956809.126099154, 140259488.92735168, 48956791.91083976, 140259492.5758967, 48956793.55038827, 1, 0, 140259741.58909345, 48956905.44957433, 39 },
-  { 140259478.73073342, 48956819.481125295, 140259442.72100204, 48956802.06563661, 140259514.7404648, 48956836.89661398, 140259476.93024686, 48956818.61035086, 140259480.53122, 48956820.35189973, 1, 1, 140259360.79886317, 48956762.44539985, 47 },
-  { 140259465.95713013, 48956845.892903425, 140259430.0754403, 48956828.21511131, 140259501.83881998, 48956863.57069554, 140259464.16304564, 48956845.00901382, 140259467.75121462, 48956846.77679303, 0, 0, 0, 0, 0 },
-  { 140259453.0665098, 48956872.057779506, 140259417.37232524, 48956854.00438126, 140259488.76069438, 48956890.11117775, 140259451.2818006, 48956871.15510959, 140259454.85121903, 48956872.96044942, 0, 0, 0, 0, 0 },
-  { 140259439.9680106, 48956897.95541063, 140259404.53480777, 48956879.395019025, 140259475.40121344, 48956916.515802234, 140259438.19635046, 48956897.02739105, 140259441.73967075, 48956898.88343021, 0, 0, 0, 0, 0 },
-  { 140259426.55444345, 48956923.56293314, 140259391.4612725, 48956904.367377564, 140259461.6476144, 48956942.758488715, 140259424.7997849, 48956922.60315536, 140259428.309102, 48956924.52271092, 1, 2, 140259245.82461315, 48956824.70582191, 39 },
-  { 140259412.71861923, 48956948.85748335, 140259378.0507786, 48956928.90401684, 140259447.38645986, 48956968.81094986, 140259410.9852272, 48956947.859810024, 140259414.45201126, 48956949.855156675, 0, 0, 0, 0, 0 },
-  { 140259398.3533497, 48956973.8161979, 140259364.17844608, 48956953.02976089, 140259432.5282533, 48956994.602634914, 140259396.6446045, 48956972.776876055, 140259400.06209487, 48956974.85551975, 1, 4, 140259136.91533712, 48956814.79995478, 29 },
-  { 140259383.3837117, 48956998.42772392, 140259349.6820652, 48956976.88244549, 140259417.0853582, 48957019.97300235, 140259381.69862938, 48956997.35046, 140259385.068794, 48956999.50498784, 1, 0, 140259564.53006166, 48957114.23359549, 33 },
-  { 140259367.85214475, 48957022.72257723, 140259334.5779595, 48957000.52283405, 140259401.12633, 48957044.92232041, 140259366.1884355, 48957021.61259007, 140259369.515854, 48957023.83256439, 1, 0, 140259152.4017954, 48956878.97924014, 29 },
-  { 140259351.82776532, 48957046.74079064, 140259318.9296492, 48957023.98746216, 140259384.72588143, 48957069.49411912, 140259350.1828595, 48957045.603124216, 140259353.47267112, 48957047.87845707, 0, 0, 0, 0, 0 },
-  { 140259335.37968975, 48957070.52239692, 140259302.8017628, 48957047.312944636, 140259367.95761672, 48957093.73184921, 140259333.7507934, 48957069.361924306, 140259337.0085861, 48957071.68286954, 1, 3, 140259218.0991527, 48956986.96836869, 36 },
-  { 140259318.57703456, 48957094.107428856, 140259286.25991464, 48957070.53618027, 140259350.8941545, 48957117.67867744, 140259316.96117857, 48957092.92886642, 140259320.19289055, 48957095.28599129, 1, 2, 140259409.87289834, 48957160.6962061, 49 },
-  { 140259301.4889162, 48957117.53591924, 140259269.37058595, 48957093.69450856, 140259333.60724643, 48957141.37732992, 140259299.8829997, 48957116.343848705, 140259303.0948327, 48957118.72798978, 1, 0, 140259201.92209247, 48957043.62754614, 50 },
-  { 140259284.184451, 48957140.84790084, 140259252.20102027, 48957116.82582438, 140259316.16788176, 48957164.869977295, 140259282.58527946, 48957139.646797016, 140259285.78362256, 48957142.04900466, 0, 0, 0, 0, 0 },
-  { 140259266.73275557, 48957164.08340646, 140259234.8191404, 48957139.96865649, 140259298.64637074, 48957188.19815644, 140259265.1370748, 48957162.87766896, 140259268.32843634, 48957165.289143965, 0, 0, 0, 0, 0 },
-  { 140259249.20294622, 48957187.28246888, 140259217.29348898, 48957163.162217245, 140259281.11240345, 48957211.40272051, 140259247.60747334, 48957186.07645629, 140259250.7984191, 48957188.48848146, 0, 0, 0, 0, 0 },
-  { 140259231.66413945, 48957210.48512087, 140259199.6931976, 48957186.44642544, 140259263.6350813, 48957234.5238163, 140259230.06559235, 48957209.2831861, 140259233.26268655, 48957211.68705564, 0, 0, 0, 0, 0 },
-  { 140259214.18545172, 48957233.731395215, 140259182.0879831, 48957209.86190615, 140259246.28292033, 48957257.60088428, 140259212.5805783, 48957232.53792076, 140259215.79032513, 48957234.92486967, 0, 0, 0, 0, 0 },
-  { 140259196.83599952, 48957257.06132473, 140259164.54817253, 48957233.449966684, 140259229.1238265, 48957280.67268278, 140259195.22160816, 48957255.880756825, 140259198.45039088, 48957258.241892636, 1, 1, 140259034.58966896, 48957138.41425053, 30 },
-  { 140259179.6848992, 48957280.514942184, 140259147.14475444, 48957257.25254809, 140259212.22504398, 48957303.77733628, 140259178.05789196, 48957279.35182248, 140259181.31190646, 48957281.67806189, 0, 0, 0, 0, 0 },
-  { 140259162.80126727, 48957304.13228034, 140259129.9494556, 48957281.312147364, 140259195.65307894, 48957326.95241332, 140259161.15867668, 48957302.991273694, 140259164.44385785, 48957305.27328699, 0, 0, 0, 0, 0 },
-  { 140259146.25422004, 48957327.953372, 140259113.0348371, 48957305.67170698, 140259179.47360298, 48957350.23503702, 140259144.5932509, 48957326.83928875, 140259147.91518918, 48957329.067455254, 0, 0, 0, 0, 0 },
-  { 140259130.11287418, 48957352.01824996, 140259096.47970957, 48957330.36622377, 140259163.7460388, 48957373.67027615, 140259128.43121594, 48957350.93564865, 140259131.79453242, 48957353.10085127, 0, 0, 0, 0, 0 },
-  { 140259114.4402192, 48957376.36336114, 140259080.40661928, 48957355.346366175, 140259148.4738191, 48957397.38035611, 140259112.7385392, 48957375.31251139, 140259116.1418992, 48957377.41421089, 1, 2, 140259320.34349862, 48957503.516180694, 33 },
-  { 140259099.234177, 48957400.987069584, 140259064.84581295, 48957380.555710874, 140259133.62254104, 48957421.418428294, 140259097.5147588, 48957399.96550165, 140259100.9535952, 48957402.00863752, 0, 0, 0, 0, 0 },
-  { 140259084.45343903, 48957425.86477865, 140259049.75384396, 48957405.96658523, 140259119.1530341, 48957445.76297208, 140259082.71845928, 48957424.86986898, 140259086.18841878, 48957426.85968833, 0, 0, 0, 0, 0 },
-  { 140259070.0561559, 48957450.971575245, 140259035.08636203, 48957431.5521644, 140259105.02594975, 48957470.39098609, 140259068.30766618, 48957450.000604704, 140259071.8046456, 48957451.94254579, 1, 1, 140258908.32085928, 48957361.15680009, 34 },
-  { 140259056.0004784, 48957476.28254625, 140259020.79918042, 48957457.28600388, 140259091.20177636, 48957495.279088624, 140259054.2404135, 48957475.33271913, 140259057.7605433, 48957477.23237337, 0, 0, 0, 0, 0 },
-  { 140259042.24455726, 48957501.77277857, 140259006.84832123, 48957483.14198486, 140259077.6407933, 48957520.40357228, 140259040.47474545, 48957500.841238886, 140259044.01436907, 48957502.704318255, 0, 0, 0, 0, 0 },
-  { 140259028.74654326, 48957527.4173591, 140258993.190051, 48957509.09426282, 140259064.30303553, 48957545.740455374, 140259026.96871865, 48957526.50120428, 140259030.52436787, 48957528.333513916, 0, 0, 0, 0, 0 },
-  { 140259015.46458715, 48957553.19137473, 140258979.78090778, 48957535.11722119, 140259051.14826652, 48957571.26552826, 140259013.68040317, 48957552.28766705, 140259017.24877113, 48957554.0950824, 0, 0, 0, 0, 0 },
-  { 140259002.35683957, 48957579.069912344, 140258966.57772052, 48957561.185431905, 140259038.1359586, 48957596.95439278, 140259000.5678836, 48957578.17568832, 140259004.14579552, 48957579.96413637, 1, 0, 140259233.1321574, 48957694.42481118, 30 },
-  { 140258989.38145125, 48957605.02805884, 140258953.5376235, 48957587.27362244, 140259025.225279, 48957622.782495245, 140258987.58925986, 48957604.14033702, 140258991.17364264, 48957605.91578066, 1, 4, 140258646.17680052, 48957435.02933027, 47 },
-  { 140258976.49657306, 48957631.04090115, 140258940.618066, 48957613.356650166, 140259012.3750801, 48957648.72515213, 140258974.70264772, 48957630.1566886, 140258978.2904984, 48957631.92511369, 0, 0, 0, 0, 0 },
-  { 140258963.66035566, 48957657.083526134, 140258927.77681774, 48957639.40948566, 140258999.54389358, 48957674.75756661, 140258961.86617875, 48957656.19982411, 140258965.45453256, 48957657.96722816, 0, 0, 0, 0, 0 },
-  { 140258950.83094975, 48957683.1310207, 140258914.97197202, 48957665.407202944, 140258986.6899275, 48957700.85483846, 140258949.03800088, 48957682.24482981, 140258952.62389863, 48957684.01721159, 0, 0, 0, 0, 0 },
-  { 140258937.9665061, 48957709.158471726, 140258902.16194624, 48957691.324978136, 140258973.77106595, 48957726.991965316, 140258936.1762781, 48957708.26679704, 140258939.75673407, 48957710.05014641, 0, 0, 0, 0, 0 },
-  { 140258925.02517545, 48957735.14096614, 140258889.3054797, 48957717.13809593, 140258960.7448712, 48957753.14383635, 140258923.23919067, 48957734.24082263, 140258926.81116024, 48957736.04110965, 1, 4, 140259117.01854008, 48957831.9063935, 27 },
-  { 140258911.96510848, 48957761.053590804, 140258876.3616282, 48957742.82196466, 140258947.56858876, 48957779.28521695, 140258910.18493447, 48957760.1420095, 140258913.7452825, 48957761.96517211, 1, 3, 140258659.1803985, 48957631.60904516, 38 },
-  { 140258898.744456, 48957786.87143264, 140258863.28975624, 48957768.352138214, 140258934.19915575, 48957805.390727066, 140258896.971721, 48957785.94546792, 140258900.517191, 48957787.79739736, 1, 4, 140259112.35902196, 48957898.450181566, 40 },
-  { 140258885.3213687, 48957812.56957852, 140258850.04952407, 48957793.70434658, 140258920.59321332, 48957831.43481046, 140258883.55777645, 48957811.62631693, 140258887.08496094, 48957813.512840115, 0, 0, 0, 0, 0 },
-  { 140258871.65399733, 48957838.12311536, 140258836.59836158, 48957818.859097056, 140258906.70963308, 48957857.387133665, 140258869.90121555, 48957837.15991445, 140258873.4067791, 48957839.08631627, 0, 0, 0, 0, 0 },
-  { 140258857.7037484, 48957863.50903628, 140258822.87459448, 48957843.83849902, 140258892.53290233, 48957883.17957354, 140258855.9622907, 48957862.52550942, 140258859.4452061, 48957864.49256314, 1, 3, 140258626.08987474, 48957732.699963495, 43 },
-  { 140258843.46367875, 48957888.72286606, 140258808.85724777, 48957868.66308204, 140258878.07010972, 48957908.782650076, 140258841.7333572, 48957887.719876856, 140258845.1940003, 48957889.72585526, 0, 0, 0, 0, 0 },
-  { 140258828.94466192, 48957913.77056116, 140258794.55645362, 48957893.33894032, 140258863.33287022, 48957934.202181995, 140258827.2252515, 48957912.74898012, 140258830.66407233, 48957914.7921422, 0, 0, 0, 0, 0 },
-  { 140258814.15777078, 48957938.65819472, 140258779.98273066, 48957917.87198218, 140258848.3328109, 48957959.44440726, 140258812.44901878, 48957937.618884094, 140258815.8665228, 48957939.69750535, 1, 3, 140259112.33499596, 48958120.01789914, 42 },
-  { 140258799.114078, 48957963.39183988, 140258765.14663038, 48957942.268097244, 140258833.0815256, 48957984.51558251, 140258797.4157056, 48957962.335652746, 140258800.81245038, 48957964.44802701, 0, 0, 0, 0, 0 },
-  { 140258783.8246563, 48957987.97756973, 140258750.05873746, 48957966.53315964, 140258817.59057516, 48958009.421979815, 140258782.13636038, 48957986.905349225, 140258785.51295224, 48957989.04979023, 0, 0, 0, 0, 0 },
-  { 140258768.30057847, 48958012.42145745, 140258734.72966877, 48957990.67303173, 140258801.87148818, 48958034.16988316, 140258766.622033, 48958011.334036164, 140258769.97912395, 48958013.50887873, 0, 0, 0, 0, 0 },
-  { 140258752.55291724, 48958036.72957613, 140258719.17007267, 48958014.69356721, 140258785.9357618, 48958058.76558506, 140258750.88377503, 48958035.627775684, 140258754.22205946, 48958037.83137658, 1, 3, 140259007.097107, 48958204.75414416, 26 },
-  { 140258736.59274527, 48958060.907998905, 140258703.39062777, 48958038.600614645, 140258769.79486278, 48958083.215383165, 140258734.9326394, 48958059.79262969, 140258738.25285116, 48958062.02336812, 0, 0, 0, 0, 0 },
-  { 140258720.43113548, 48958084.96279894, 140258687.4020425, 48958062.400019445, 140258753.46022844, 48958107.52557843, 140258718.77968082, 48958083.834659964, 140258722.08259013, 48958086.09093791, 0, 0, 0, 0, 0 },
-  { 140258704.07916048, 48958108.90004932, 140258671.21505305, 48958086.09762747, 140258736.9432679, 48958131.702471174, 140258702.4359551, 48958107.75992823, 140258705.72236586, 48958110.040170416, 0, 0, 0, 0, 0 },
-  { 140258687.5478931, 48958132.72582321, 140258654.84042278, 48958109.699286655, 140258720.25536343, 48958155.75235976, 140258685.9125196, 48958131.57449638, 140258689.1832666, 48958133.87715004, 0, 0, 0, 0, 0 },
-  { 140258670.84840602, 48958156.4461937, 140258638.28894055, 48958133.210849755, 140258703.40787148, 48958179.68153765, 140258669.22043273, 48958155.2844265, 140258672.4763793, 48958157.6079609, 0, 0, 0, 0, 0 },
-  { 140258653.99177197, 48958180.06723394, 140258621.5714196, 48958156.638176076, 140258686.41212434, 48958203.49629181, 140258652.37075436, 48958178.89578105, 140258655.61278957, 48958181.23868684, 1, 0, 140258841.2193069, 48958315.37004311, 41 },
-  { 140258636.98906374, 48958203.59501705, 140258604.69869637, 48958179.987133294, 140258669.2794311, 48958227.20290081, 140258635.37454537, 48958202.414622866, 140258638.6035821, 48958204.77541124, 1, 1, 140258419.83634323, 48958044.83199877, 40 },
-  { 140258619.85135412, 48958227.035616174, 140258587.6816293, 48958203.26359893, 140258652.02107894, 48958250.80763342, 140258618.2428679, 48958225.847015314, 140258621.45984036, 48958228.224217035, 0, 0, 0, 0, 0 },
-  { 140258602.58971572, 48958250.39510442, 140258570.53109688, 48958226.473462395, 140258634.64833456, 48958274.31674645, 140258600.9867848, 48958249.19902232, 140258604.19264665, 48958251.59118652, 0, 0, 0, 0, 0 },
-  { 140258585.21522143, 48958273.67955494, 140258553.2579978, 48958249.622625425, 140258617.17244506, 48958297.73648445, 140258583.61736026, 48958272.476708464, 140258586.8130826, 48958274.882401414, 0, 0, 0, 0, 0 },
-  { 140258567.73894393, 48958296.89504086, 140258535.87324876, 48958272.717003904, 140258599.6046391, 48958321.07307782, 140258566.14565918, 48958295.68613902, 140258569.3322287, 48958298.10394271, 1, 3, 140258355.03542864, 48958135.50664417, 27 },
-  { 140258550.17195597, 48958320.04763528, 140258518.38778394, 48958295.76252856, 140258581.956128, 48958344.332742, 140258548.58274737, 48958318.83337995, 140258551.76116458, 48958321.26189061, 0, 0, 0, 0, 0 },
-  { 140258532.52533028, 48958343.14341137, 140258500.81255403, 48958318.76514599, 140258564.23810652, 48958367.52167675, 140258530.93969145, 48958341.924498096, 140258534.1109691, 48958344.36232464, 0, 0, 0, 0, 0 },
-  { 140258514.8101396, 48958366.18844223, 140258483.15852544, 48958341.73081928, 140258546.46175376, 48958390.64606518, 140258513.22755888, 48958364.965561084, 140258516.3927203, 48958367.411323376, 0, 0, 0, 0, 0 },
-  { 140258497.0374567, 48958389.18880098, 140258465.43667945, 48958364.66552883, 140258528.63823393, 48958413.71207314, 140258495.45741782, 48958387.96263737, 140258498.61749557, 48958390.414964594, 0, 0, 0, 0, 0 },
-  { 140258479.2183543, 48958412.15056079, 140258447.6580118, 48958387.575272806, 140258510.77869684, 48958436.72584877, 140258477.6403372, 48958410.92179639, 140258480.79637143, 48958413.37932519, 1, 0, 140258686.72760642, 48958573.7330793, 48 },
-  { 140258461.36390525, 48958435.07979476, 140258429.8335321, 48958410.4660675, 140258492.8942784, 48958459.69352201, 140258459.7873866, 48958433.8491084, 140258462.9404239, 48958436.310481116, 0, 0, 0, 0, 0 },
-  { 140258443.48518214, 48958457.98257601, 140258411.97426313, 48958433.34394813, 140258474.99610114, 48958482.62120389, 140258441.9096362, 48958456.75064462, 140258445.06072807, 48958459.21450741, 0, 0, 0, 0, 0 },
-  { 140258425.59325776, 48958480.86497769, 140258394.091241, 48958456.21496875, 140258457.0952745, 48958505.51498663, 140258424.01815692, 48958479.63247724, 140258427.1683586, 48958482.09747814, 0, 0, 0, 0, 0 },
-  { 140258407.69920492, 48958503.73307293, 140258376.19551498, 48958479.08520243, 140258439.20289487, 48958528.380943425, 140258406.12402043, 48958502.5006794, 140258409.27438942, 48958504.965466455, 1, 2, 140258516.38693523, 48958588.76822613, 26 },
-  { 140258389.81409633, 48958526.59293483, 140258358.29814696, 48958501.96074176, 140258421.3300457, 48958551.225127906, 140258388.23829886, 48958525.36132518, 140258391.3898938, 48958527.82454448, 1, 4, 140258140.83809632, 48958331.99860958, 26 },
-  { 140258371.94900474, 48958549.45063656, 140258340.41021207, 48958524.847698584, 140258403.4877974, 48958574.05357453, 140258370.3720651, 48958548.22048966, 140258373.52594438, 48958550.68078346, 0, 0, 0, 0, 0 },
-  { 140258354.11500287, 48958572.31225122, 140258322.54218403, 48958547.75299408, 140258385.68782172, 48958596.87150835, 140258352.53636193, 48958571.08428836, 140258355.6936438, 48958573.54021408, 1, 3, 140258137.84119385, 48958404.08133986, 30 },
-  { 140258336.3221773, 48958595.18630052, 140258304.70196486, 48958570.68809312, 140258367.94238973, 48958619.68450793, 140258334.74116668, 48958593.96139015, 140258337.9031879, 48958596.411210895, 1, 5, 140258603.5129723, 48958802.196153104, 37 },
-  { 140258318.57554018, 48958618.092157505, 140258286.90185258, 48958593.663127355, 140258350.2492278, 48958642.521187656, 140258316.9918558, 48958616.870706, 140258320.15922457, 48958619.31360901, 0, 0, 0, 0, 0 },
-  { 140258300.87746322, 48958641.038764775, 140258269.14883032, 48958616.68114061, 140258332.60609612, 48958665.39638894, 140258299.29103157, 48958639.820883565, 140258302.46389487, 48958642.256645985, 1, 1, 140258454.76133275, 48958759.173241965, 47 },
-  { 140258283.22970757, 48958664.02701505, 140258251.44472313, 48958639.74297163, 140258315.014692, 48958688.31105848, 140258281.64045835, 48958662.81281288, 140258284.8189568, 48958665.241217226, 0, 0, 0, 0, 0 },
-  { 140258265.63402742, 48958687.05771096, 140258233.79129812, 48958662.849435724, 140258297.47675672, 48958711.2659862, 140258264.04189095, 48958685.8472972, 140258267.2261639, 48958688.26812472, 0, 0, 0, 0, 0 },
-  { 140258248.09217712, 48958710.13165511, 140258216.190323, 48958686.00134836, 140258279.99403125, 48958734.26196186, 140258246.4970844, 48958708.92513978, 140258249.68726984, 48958711.33817045, 0, 0, 0, 0, 0 },
-  { 140258230.60591096, 48958733.24965017, 140258198.643566, 48958709.19952532, 140258262.5682559, 48958757.29977503, 140258229.0077937, 48958732.04714393, 140258232.20402822, 48958734.45215642, 0, 0, 0, 0, 0 },
-  { 140258213.17698324, 48958756.412498735, 140258181.1527957, 48958732.44478269, 140258245.20117077, 48958780.38021478, 140258211.57577386, 48958755.21411293, 140258214.7781926, 48958757.61088454, 1, 4, 140258088.28265184, 48958662.93840614, 42 },
-  { 140258195.8071483, 48958779.621003464, 140258163.71978125, 48958755.73793674, 140258227.89451537, 48958803.504070185, 140258194.20277995, 48958778.426850125, 140258197.41151667, 48958780.8151568, 0, 0, 0, 0, 0 },
-  { 140258178.49816048, 48958802.875966996, 140258146.3462924, 48958779.07980387, 140258210.65002856, 48958826.67213012, 140258176.89056706, 48958801.68615884, 140258180.1057539, 48958804.06577515, 1, 0, 140258018.5426168, 48958684.49005545, 34 },
-  { 140258161.25177392, 48958826.178191915, 140258129.0340989, 48958802.47120105, 140258193.46944895, 48958849.88518278, 140258159.64089018, 48958824.99284237, 140258162.86265767, 48958827.36354146, 1, 0, 140258298.1768928, 48958926.932903096, 40 },
-  { 140258144.06974304, 48958849.52848089, 140258111.7849715, 48958825.91294518, 140258176.35451457, 48958873.14401659, 140258142.45550445, 48958848.347704105, 140258145.68398163, 48958850.70925767, 0, 0, 0, 0, 0 },
-  { 140258126.95382214, 48958872.92763654, 140258094.60068142, 48958849.40585333, 140258159.30696285, 48958896.44941975, 140258125.3361651, 48958871.75154738, 140258128.57147917, 48958874.1037257, 0, 0, 0, 0, 0 },
-  { 140258109.90576544, 48958896.3764615, 140258077.4830001, 48958872.950742975, 140258142.3285308, 48958919.80218002, 140258108.28462717, 48958895.20517557, 140258111.52690372, 48958897.547747426, 0, 0, 0, 0, 0 },
-  { 140258092.92732733, 48958919.875758395, 140258060.43369994, 48958896.548431545, 140258125.42095473, 48958943.20308524, 140258091.30264595, 48958918.709392056, 140258094.55200872, 48958921.04212473, 1, 4, 140258198.53161642, 48958995.68957064, 36 },
-  { 140258076.02026212, 48958943.42632984, 140258043.4545537, 48958920.1997366, 140258108.58597055, 48958966.652923085, 140258074.3919767, 48958942.26500018, 140258077.64854753, 48958944.58765951, 0, 0, 0, 0, 0 },
-  { 140258059.18632403, 48958967.028978504, 140258026.54733458, 48958943.90547599, 140258091.82531348, 48958990.15248102, 140258057.55437455, 48958965.872803375, 140258060.8182735, 48958968.18515363, 0, 0, 0, 0, 0 },
-  { 140258042.4272674, 48958990.68450698, 140258009.71381667, 48958967.6664675, 140258075.14071813, 48959013.70254646, 140258040.79159486, 48958989.53360501, 140258044.06293994, 48958991.835408956, 0, 0, 0, 0, 0 },
-  { 140258025.74484652, 48959014.39371792, 140257992.95577446, 48958991.48352905, 140258058.5339186, 48959037.30390679, 140258024.10539293, 48959013.24820848, 140258027.3843001, 48959015.53922737, 0, 0, 0, 0, 0 },
-  { 140258009.14081568, 48959038.15741394, 140257976.27498302, 48959015.35747877, 140258042.00664833, 48959060.95734911, 140258007.49752405, 48959037.01741718, 140258010.7841073, 48959039.2974107, 1, 3, 140257820.98392373, 48958907.62778508, 42 },
-  { 140257992.61692926, 48959061.9763977, 140257959.67321837, 48959039.28913447, 140258025.56064016, 48959084.66366093, 140257990.96974373, 48959060.84203454, 140257994.2641148, 48959063.11076086, 0, 0, 0, 0, 0 },
-  { 140257976.1749415, 48959085.85147181, 140257943.15225682, 48959063.279314265, 140258009.1976262, 48959108.42362936, 140257974.5238073, 48959084.722863935, 140257977.82607573, 48959086.98007969, 1, 4, 140257840.78193432, 48958993.30562586, 34 },
-  { 140257959.81660673, 48959109.78343889, 140257926.71387553, 48959087.3288361, 140257992.91933793, 48959132.238041684, 140257958.16147017, 48959108.66070875, 140257961.4717433, 48959110.906169035, 1, 4, 140258128.6405359, 48959224.301913135, 25 },
-  { 140257943.54367918, 48959133.773101576, 140257910.3598521, 48959111.43851807, 140257976.72750625, 48959156.10768508, 140257941.88448784, 48959132.6563724, 140257945.20287052, 48959134.88983075, 0, 0, 0, 0, 0 },
-  { 140257927.35791323, 48959157.82126251, 140257894.09196517, 48959135.60917798, 140257960.62386128, 48959180.03334704, 140257925.6946158, 48959156.71065828, 140257929.02121064, 48959158.931866735, 1, 5, 140258067.9065438, 48959251.66731967, 33 },
-  { 140257911.26106313, 48959181.928724304, 140257877.91199374, 48959159.84163369, 140257944.61013252, 48959204.015814915, 140257909.59360966, 48959180.82436977, 140257912.9285166, 48959183.033078834, 0, 0, 0, 0, 0 },
-  { 140257895.2548832, 48959206.09628962, 140257861.82171777, 48959184.136702895, 140257928.68804863, 48959228.055876344, 140257893.58322492, 48959204.99831028, 140257896.92654148, 48959207.19426896, 0, 0, 0, 0, 0 },
-  { 140257879.34112772, 48959230.32476105, 140257845.82291767, 48959208.495203204, 140257912.85933778, 48959252.15431889, 140257877.66521722, 48959229.233283155, 140257881.01703823, 48959231.41623894, 0, 0, 0, 0, 0 },
-  { 140257863.52155104, 48959254.61494126, 140257829.9173749, 48959232.91795195, 140257897.12572718, 48959276.311930574, 140257861.84134224, 48959253.53009179, 140257865.20175985, 48959255.69979073, 1, 2, 140258116.39297655, 48959417.88478587, 28 },
-  { 140257847.79790744, 48959278.96763285, 140257814.10681105, 48959257.40586056, 140257881.48900384, 48959300.52940515, 140257846.11335263, 48959277.88954424, 140257849.48246226, 48959280.045721464, 0, 0, 0, 0, 0 },
-  { 140257832.17203894, 48959303.38365184, 140257798.3924827, 48959281.96073001, 140257865.9515952, 48959324.80657367, 140257830.48306113, 48959302.312505744, 140257833.86101675, 48959304.45479793, 1, 3, 140258037.38284317, 48959433.52790193, 27 },
-  { 140257816.6466859, 48959327.86395106, 140257782.77681038, 48959306.58411241, 140257850.51656142, 48959349.1437897, 140257814.9531921, 48959326.79995912, 140257818.34017968, 48959328.92794299, 0, 0, 0, 0, 0 },
-  { 140257801.22511536, 48959352.40956361, 140257767.26310253, 48959331.27708421, 140257835.1871282, 48959373.54204301, 140257799.52701473, 48959351.352939636, 140257802.923216, 48959353.46618758, 0, 0, 0, 0, 0 },
-  { 140257785.9106009, 48959377.02152354, 140257751.8546804, 48959356.04071618, 140257819.9665214, 48959398.00233091, 140257784.2078049, 48959375.97248317, 140257787.6133969, 48959378.07056391, 1, 2, 140257457.2709679, 48959174.55673247, 44 },
-  { 140257770.70641613, 48959401.700864956, 140257736.55486697, 48959380.87607947, 140257804.8579653, 48959422.52565044, 140257768.99883866, 48959400.65962568, 140257772.4139936, 48959402.74210423, 0, 0, 0, 0, 0 },
-  { 140257755.61583477, 48959426.448621966, 140257721.36698765, 48959405.784245126, 140257789.8646819, 48959447.112998806, 140257753.9033924, 48959425.41540313, 140257757.32827714, 48959427.481840804, 1, 0, 140257644.30708158, 48959359.28939725, 32 },
-  { 140257740.64213043, 48959451.26582865, 140257706.29436943, 48959430.76628439, 140257774.98989144, 48959471.7653729, 140257738.92474237, 48959450.24085143, 140257742.3595185, 48959452.29080586, 0, 0, 0, 0, 0 },
-  { 140257725.78857675, 48959476.1535191, 140257691.3403416, 48959455.82326838, 140257760.2368119, 48959496.48376983, 140257724.066165, 48959475.137006566, 140257727.5109885, 48959477.17003164, 0, 0, 0, 0, 0 },
-  { 140257711.05844733, 48959501.112727374, 140257676.50823522, 48959480.956268266, 140257745.60865945, 48959521.26918648, 140257709.33093673, 48959500.10490442, 140257712.78595793, 48959502.12055033, 0, 0, 0, 0, 0 },
-  { 140257696.45501596, 48959526.1444876, 140257661.80138412, 48959506.166354515, 140257731.1086478, 48959546.12262068, 140257694.72233436, 48959525.14558094, 140257698.18769756, 48959527.143394254, 0, 0, 0, 0, 0 },
-  { 140257681.98155612, 48959551.249833845, 140257647.22312367, 48959531.45459768, 140257716.73998857, 48959571.04507001, 140257680.2436345, 48959550.26007204, 140257683.71947774, 48959552.23959565, 1, 0, 140258015.6625075, 48959741.28410099, 45 },
-  { 140257667.6413415, 48959576.429800205, 140257632.77679187, 48959556.82206758, 140257702.50589114, 48959596.03753283, 140257665.89811403, 48959575.449413575, 140257669.384569, 48959577.410186835, 0, 0, 0, 0, 0 },
-  { 140257653.43764576, 48959601.685420774, 140257618.46578318, 48959582.26973571, 140257688.40950835, 48959621.10110584, 140257651.68905264, 48959600.71463652, 140257655.18623888, 48959602.65620503, 0, 0, 0, 0, 0 },
-  { 140257639.37366945, 48959627.01769443, 140257604.2957768, 48959607.79423352, 140257674.45156208, 48959646.241155334, 140257637.61977482, 48959626.056521386, 140257641.12756407, 48959627.97886747, 0, 0, 0, 0, 0 },
-  { 140257625.44933352, 48959652.42604118, 140257590.2699918, 48959633.388869226, 140257660.62867525, 48959671.46321313, 140257623.69036645, 48959651.47418258, 140257627.2083006, 48959653.37789977, 1, 4, 140257974.6043001, 48959841.36997283, 45 },
-  { 140257611.6600275, 48959677.907699354, 140257576.38395986, 48959659.05036519, 140257646.93609515, 48959696.76503352, 140257609.8962241, 48959676.96483265, 140257613.4238309, 48959678.85056606, 1, 1, 140257396.47601488, 48959562.87796096, 44 },
-  { 140257598.00080913, 48959703.45974754, 140257562.63263693, 48959684.77573308, 140257633.36898133, 48959722.14376199, 140257596.23240054, 48959702.52554681, 140257599.76921773, 48959704.393948264, 1, 1, 140257821.7044982, 48959821.63613897, 38 },
-  { 140257584.46673617, 48959729.07926438, 140257549.0109817, 48959710.56198931, 140257619.92249063, 48959747.59653945, 140257582.69394845, 48959728.15340063, 140257586.2395239, 48959730.00512813, 1, 1, 140257273.34249085, 48959566.5901756, 41 },
-  { 140257571.05286622, 48959754.76332843, 140257535.51395527, 48959736.406155236, 140257606.59177718, 48959773.12050163, 140257569.27592066, 48959753.84546977, 140257572.82981178, 48959755.68118709, 0, 0, 0, 0, 0 },
-  { 140257557.75425702, 48959780.50901831, 140257522.13652185, 48959762.3052566, 140257593.3719922, 48959798.71278002, 140257555.97337025, 48959779.59883022, 140257559.5351438, 48959781.419206396, 0, 0, 0, 0, 0 },
-  { 140257544.56596634, 48959806.31341262, 140257508.87364897, 48959788.25632313, 140257580.2582837, 48959824.370502114, 140257542.78135046, 48959805.41055815, 140257546.3505822, 48959807.216267094, 1, 0, 140257743.55063567, 48959906.98168654, 29 },
-  { 140257531.48305184, 48959832.17358996, 140257495.72030726, 48959814.25638874, 140257567.2457964, 48959850.09079118, 140257529.6949146, 48959831.2777299, 140257533.27118906, 48959833.06945002, 1, 2, 140257334.78795663, 48959733.62898323, 30 },
-  { 140257518.50057134, 48959858.08662896, 140257482.67147118, 48959840.30249047, 140257554.3296715, 48959875.870767444, 140257516.70911634, 48959857.197422035, 140257520.29202634, 48959858.97583588, 1, 4, 140257795.2803701, 48959995.46909876, 31 },
-  { 140257505.6135824, 48959884.04960815, 140257469.7221182, 48959866.39166949, 140257541.5050466, 48959901.70754681, 140257503.81900918, 48959883.16671122, 140257507.40815562, 48959884.93250508, 0, 0, 0, 0, 0 },
-  { 140257492.8171429, 48959910.0596062, 140257456.86723027, 48959892.52096939, 140257528.76705554, 48959927.59824301, 140257491.01964727, 48959909.18267436, 140257494.61463854, 48959910.93653804, 0, 0, 0, 0, 0 },
-  { 140257480.1063104, 48959936.113701686, 140257444.10179245, 48959918.68743739, 140257516.11082834, 48959953.53996598, 140257478.3060845, 48959935.24238847, 140257481.90653628, 48959936.9850149, 0, 0, 0, 0, 0 },
-  { 140257467.47614273, 48959962.20897321, 140257431.4207944, 48959944.88812289, 140257503.53149107, 48959979.52982353, 140257465.6733753, 48959961.34293069, 140257469.27891016, 48959963.07501572, 0, 0, 0, 0, 0 },
-  { 140257454.92169753, 48959988.34249938, 140257418.8192293, 48959971.12007828, 140257491.02416575, 48960005.564920485, 140257453.1165741, 48959987.481378324, 140257456.72682095, 48959989.20362044, 0, 0, 0, 0, 0 },
-  { 140257442.4380326, 48960014.51135878, 140257406.29209498, 48959997.38035783, 140257478.58397022, 48960031.64235973, 140257440.63073573, 48960013.65480874, 140257444.24532947, 48960015.36790883, 0, 0, 0, 0, 0 },
-  { 140257430.02020553, 48960040.712630026, 140257393.83439285, 48960023.66601859, 140257466.2060182, 48960057.75924146, 140257428.21091488, 48960039.86029945, 140257431.82949618, 48960041.5649606, 0, 0, 0, 0, 0 },
-  { 140257417.6632742, 48960066.94339172, 140257381.4411293, 48960049.97411891, 140257453.8854191, 48960083.912664525, 140257415.85216695, 48960066.09492808, 140257419.47438145, 48960067.79185536, 0, 0, 0, 0, 0 },
-  { 140257405.36229616, 48960093.20072246, 140257369.1073144, 48960076.30171961, 140257441.61727792, 48960110.09972531, 140257403.54954708, 48960092.355772324, 140257407.17504525, 48960094.0456726, 0, 0, 0, 0, 0 },
-  { 140257393.1123292, 48960119.48170083, 140257356.82796293, 48960102.64588292, 140257429.3966955, 48960136.31751874, 140257391.2981109, 48960118.63990994, 140257394.92654753, 48960120.32349172, 1, 2, 140257626.23938248, 48960227.65183089, 43 },
-  { 140257380.90843108, 48960145.78340545, 140257344.59809414, 48960129.0036727, 140257417.21876803, 48960162.56313821, 140257379.09291422, 48960144.94441882, 140257382.72394794, 48960146.62239209, 0, 0, 0, 0, 0 },
-  { 140257368.74565947, 48960172.10291494, 140257332.4127316, 48960155.372154325, 140257405.07858735, 48960188.83367555, 140257366.92901307, 48960171.266376905, 140257370.56230587, 48960172.93945297, 0, 0, 0, 0, 0 },
-  { 140257356.6190721, 48960198.43730788, 140257320.26690343, 48960181.74839444, 140257392.9712408, 48960215.12622132, 140257354.80146366, 48960197.60286221, 140257358.43668056, 48960199.27175355, 0, 0, 0, 0, 0 },
-  { 140257344.52372667, 48960224.78366285, 140257308.15564227, 48960208.12946107, 140257380.89181107, 48960241.437864624, 140257342.70532244, 48960223.95095276, 140257346.3421309, 48960225.616372935, 0, 0, 0, 0, 0 },
-  { 140257332.45468086, 48960251.139058486, 140257296.0739853, 48960234.51242352, 140257368.8353764, 48960267.76569345, 140257330.63564608, 48960250.30772674, 140257334.27371565, 48960251.97039023, 0, 0, 0, 0, 0 },
-  { 140257320.40699244, 48960277.50057336, 140257284.01697436, 48960260.89435207, 140257356.7970105, 48960294.10679465, 140257318.58749154, 48960276.67026229, 140257322.22649333, 48960278.33088443, 1, 3, 140257436.85505024, 48960330.64048147, 37 },
-  { 140257308.3757191, 48960303.865286104, 140257271.97911513, 48960287.27350444, 140257344.77232307, 48960320.457067765, 140257306.5558889, 48960303.03569702, 140257310.1955493, 48960304.69487519, 1, 0, 140257129.1224445, 48960222.15076142, 35 },
-  { 140257296.356728, 48960330.23077648, 140257259.95296487, 48960313.65470848, 140257332.7604911, 48960346.80684448, 140257294.53653982, 48960329.40197308, 140257298.17691615, 48960331.05957988, 0, 0, 0, 0, 0 },
-  { 140257284.35083416, 48960356.597687796, 140257247.93809405, 48960340.041348934, 140257320.76357427, 48960373.15402666, 140257282.53019714, 48960355.769870855, 140257286.17147118, 48960357.42550474, 0, 0, 0, 0, 0 },
-  { 140257272.36072156, 48960382.967820585, 140257235.93719053, 48960366.43523492, 140257308.78425258, 48960399.50040625, 140257270.539545, 48960382.141191304, 140257274.18189812, 48960383.794449866, 1, 0, 140257400.75366837, 48960441.24518505, 47 },
-  { 140257260.3890777, 48960409.34297753, 140257223.95294982, 48960392.83817257, 140257296.82520556, 48960425.84778249, 140257258.5672713, 48960408.517737284, 140257262.2108841, 48960410.16821778, 0, 0, 0, 0, 0 },
-  { 140257248.43859002, 48960435.72496132, 140257211.98806882, 48960419.25196816, 140257284.88911122, 48960452.197954476, 140257246.61606395, 48960434.90131166, 140257250.2611161, 48960436.54861098, 1, 5, 140257560.09054634, 48960576.56905283, 45 },
-  { 140257236.51194596, 48960462.115574606, 140257200.04524586, 48960445.67842818, 140257272.97864607, 48960478.55272103, 140257234.68861097, 48960461.29371729, 140257238.33528095, 48960462.937431924, 0, 0, 0, 0, 0 },
-  { 140257224.611833, 48960488.5166201, 140257188.12718093, 48960472.119359225, 140257261.09648508, 48960504.913880974, 140257222.7876004, 48960487.696757056, 140257226.4360656, 48960489.33648314, 0, 0, 0, 0, 0 },
-  { 140257212.7409387, 48960514.92990047, 140257176.2365758, 48960498.576567754, 140257249.24530157, 48960531.28323318, 140257210.91572055, 48960514.11223383, 140257214.56615683, 48960515.7475671, 0, 0, 0, 0, 0 },
-  { 140257200.90195045, 48960541.35721841, 140257164.37613356, 48960525.05186035, 140257237.42776734, 48960557.66257647, 140257199.0756596, 48960540.5419505, 140257202.7282413, 48960542.17248631, 0, 0, 0, 0, 0 },
-  { 140257189.09755567, 48960567.80037657, 140257152.54855874, 48960551.54704388, 140257225.6465526, 48960584.05370926, 140257187.2701058, 48960566.98770994, 140257190.92500553, 48960568.613043204, 0, 0, 0, 0, 0 },
-  { 140257177.33044195, 48960594.26117764, 140257140.75655782, 48960578.06392477, 140257213.90432608, 48960610.45843051, 140257175.50174776, 48960593.45131499, 140257179.15913615, 48960595.07104028, 1, 4, 140257322.71163133, 48960658.645257786, 36 },
-  { 140257165.6032967, 48960620.74142432, 140257129.00283858, 48960604.60430975, 140257202.2037548, 48960636.87853889, 140257163.7732738, 48960619.93456859, 140257167.4333196, 48960621.54828005, 1, 5, 140256978.94096038, 48960538.44214003, 46 },
-  { 140257153.91880742, 48960647.24291928, 140257117.29011056, 48960631.17000525, 140257190.54750428, 48960663.315833315, 140257152.08737257, 48960646.43927358, 140257155.75024226, 48960648.04656498, 0, 0, 0, 0, 0 },
-  { 140257142.27966154, 48960673.7674652, 140257105.62108466, 48960657.76281773, 140257178.9382384, 48960689.77211266, 140257140.4467327, 48960672.96723282, 140257144.11259037, 48960674.56769757, 0, 0, 0, 0, 0 },
-  { 140257130.68854654, 48960700.31686476, 140257093.99847355, 48960684.38455344, 140257167.37861952, 48960716.24917608, 140257128.8540429, 48960699.520249195, 140257132.5230502, 48960701.11348032, 0, 0, 0, 0, 0 },
-  { 140257119.14814988, 48960726.892920636, 140257082.4249914, 48960711.03701855, 140257155.87130836, 48960742.74882272, 140257117.31199196, 48960726.10012553, 140257120.9843078, 48960727.68571574, 0, 0, 0, 0, 0 },
-  { 140257107.6611591, 48960753.49743552, 140257070.90335414, 48960737.72201874, 140257144.41896406, 48960769.272852294, 140257105.82326886, 48960752.70866468, 140257109.49904934, 48960754.28620636, 1, 3, 140257397.12887317, 48960877.72884265, 35 },
-  { 140257096.2302616, 48960780.13221207, 140257059.43627903, 48960764.44135971, 140257133.02424416, 48960795.82306443, 140257094.39056247, 48960779.34766945, 140257098.0699607, 48960780.91675469, 1, 0, 140256891.10380885, 48960692.65571016, 26 },
-  { 140257084.85814488, 48960806.799053006, 140257048.02648517, 48960791.19684661, 140257121.68980458, 48960822.4012594, 140257083.0165619, 48960806.018942684, 140257086.69972786, 48960807.57916333, 1, 3, 140257212.8481623, 48960861.016720235, 38 },
-  { 140257073.54749638, 48960833.49976096, 140257036.67669302, 48960817.99028448, 140257110.41829973, 48960849.009237446, 140257071.70395622, 48960832.72428714, 140257075.39103654, 48960834.27523479, 1, 4, 140256965.7003966, 48960788.13454224, 49 },
-  { 140257062.30100366, 48960860.23613866, 140257025.38962498, 48960844.82347749, 140257099.21238235, 48960875.64879982, 140257060.45543474, 48960859.4655056, 140257064.1465726, 48960861.00677171, 0, 0, 0, 0, 0 },
-  { 140257051.12135407, 48960887.009988755, 140257014.1680046, 48960871.69822979, 140257088.07470354, 48960902.32174772, 140257049.2736866, 48960886.24440081, 140257052.96902156, 48960887.7755767, 1, 3, 140256850.64943317, 48960803.94369637, 40 },
-  { 140257040.0112351, 48960913.82311392, 140257003.01455715, 48960898.61634499, 140257077.00791302, 48960929.02988285, 140257038.16140118, 48960913.06277547, 140257041.861069, 48960914.58345237, 1, 0, 140257359.10758233, 48961044.98149594, 30 },
-  { 140257028.97333434, 48960940.67731687, 140256991.93200994, 48960925.57962548, 140257066.01465875, 48960955.775008254, 140257027.12126812, 48960939.922432296, 140257030.82540056, 48960941.43220144, 1, 0, 140256880.80803666, 48960880.286551334, 25 },
-  { 140257018.01033908, 48960967.57440025, 140256980.91960937, 48960952.59849395, 140257055.1010688, 48960982.55030656, 140257016.1558026, 48960966.82560494, 140257019.86487556, 48960968.32319557, 0, 0, 0, 0, 0 },
-  { 140257007.13177985, 48960994.51725712, 140256969.96887353, 48960979.72136604, 140257044.29468617, 48961009.31314819, 140257005.27363452, 48960993.777462564, 140257008.98992518, 48960995.25705167, 0, 0, 0, 0, 0 },
-  { 140256996.38319805, 48961021.51451848, 140256959.12028384, 48961006.972330704, 140257033.64611226, 48961036.05670625, 140256994.52005234, 48961020.78740909, 140256998.24634376, 48961022.241627865, 0, 0, 0, 0, 0 },
-  { 140256985.8219395, 48961048.57669629, 140256948.43256018, 48961034.362818785, 140257023.21131882, 48961062.7905738, 140256983.95247054, 48961047.86600242, 140256987.69140846, 48961049.287390165, 0, 0, 0, 0, 0 },
-  { 140256975.50535676, 48961075.71430355, 140256937.9648486, 48961061.904515445, 140257013.0458649, 48961089.52409166, 140256973.62833136, 48961075.02381415, 140256977.38238215, 48961076.40479296, 1, 1, 140257079.6802669, 48961114.036465555, 41 },
-  { 140256965.49080256, 48961102.93785331, 140256927.77674603, 48961089.60931474, 140257003.20485908, 48961116.26639187, 140256963.60509974, 48961102.27142638, 140256967.37650537, 48961103.60428023, 0, 0, 0, 0, 0 },
-  { 140256955.83562946, 48961130.257858574, 140256917.92833847, 48961117.48925297, 140256993.74292046, 48961143.02646418, 140256953.9402649, 48961129.61942829, 140256957.73099402, 48961130.89628886, 0, 0, 0, 0, 0 },
-  { 140256946.59719005, 48961157.68483236, 140256908.4802421, 48961145.556424454, 140256984.714138, 48961169.81324026, 140256944.69134265, 48961157.07841196, 140256948.50303745, 48961158.291252755, 0, 0, 0, 0, 0 },
-  { 140256937.832837, 48961185.229287684, 140256899.49370348, 48961173.82267375, 140256976.1719705, 48961196.635901615, 140256935.91588032, 48961184.65895699, 140256939.74979365, 48961185.79961838, 0, 0, 0, 0, 0 },
-  { 140256929.59977028, 48961212.90171051, 140256891.04269758, 48961202.25501404, 140256968.15684298, 48961223.54840698, 140256927.67191663, 48961212.36937568, 140256931.52762392, 48961213.43404534, 1, 1, 140256634.63816422, 48961131.45448252, 42 },
-  { 140256921.92202652, 48961240.70670384, 140256883.1793134, 48961230.75671991, 140256960.66473964, 48961250.656687774, 140256919.98489085, 48961240.209204644, 140256923.85916218, 48961241.20420304, 0, 0, 0, 0, 0 },
-  { 140256914.74925044, 48961268.635674134, 140256875.85315353, 48961259.30327655, 140256953.64534736, 48961277.96807172, 140256912.8044456, 48961268.169054255, 140256916.6940553, 48961269.10229401, 0, 0, 0, 0, 0 },
-  { 140256908.0209586, 48961296.67823114, 140256868.9999847, 48961287.882573366, 140256947.0419325, 48961305.47388892, 140256906.0699099, 48961296.238448255, 140256909.9720073, 48961297.11801403, 0, 0, 0, 0, 0 },
-  { 140256901.67666754, 48961324.82398467, 140256862.55597845, 48961316.48302038, 140256940.79735664, 48961333.164948955, 140256899.7206331, 48961324.40693645, 140256903.632702, 48961325.24103288, 1, 3, 140256753.018049, 48961293.12832038, 28 },
-  { 140256895.65589377, 48961353.06254446, 140256856.4577628, 48961345.09344613, 140256934.85402474, 48961361.03164279, 140256893.69598722, 48961352.66408954, 140256897.61580032, 48961353.46099938, 0, 0, 0, 0, 0 },
-  { 140256889.8981539, 48961381.38352033, 140256850.64245734, 48961373.70300687, 140256929.15385047, 48961389.064033784, 140256887.93536907, 48961380.99949466, 140256891.86093873, 48961381.767546, 0, 0, 0, 0, 0 },
-  { 140256884.34296444, 48961409.77652205, 140256845.0476946, 48961402.301111154, 140256923.6382343, 48961417.25193294, 140256882.37820095, 48961409.402751505, 140256886.30772793, 48961410.15029259, 0, 0, 0, 0, 0 },
-  { 140256878.92984203, 48961438.231159404, 140256839.6116322, 48961430.87735935, 140256918.24805185, 48961445.584959455, 140256876.96393153, 48961437.8634694, 140256880.89575252, 48961438.59884941, 0, 0, 0, 0, 0 },
-  { 140256873.5983032, 48961466.73704218, 140256834.27295697, 48961459.421500854, 140256912.92364943, 48961474.05258351, 140256871.63203588, 48961466.37126511, 140256875.56457052, 48961467.10281925, 0, 0, 0, 0, 0 },
-  { 140256868.28786448, 48961495.28378015, 140256828.97088438, 48961487.923408106, 140256907.60484457, 48961502.644152194, 140256866.32201546, 48961494.915761545, 140256870.2537135, 48961495.651798755, 1, 0, 140256539.99108073, 48961433.82467361, 35 },
-  { 140256862.93804246, 48961523.8609831, 140256823.6451536, 48961516.373067096, 140256902.2309313, 48961531.34889911, 140256860.97339803, 48961523.4865873, 140256864.9026869, 48961524.235378906, 1, 2, 140256962.1525868, 48961542.767971024, 49 },
-  { 140256857.48835373, 48961552.45826083, 140256818.23601896, 48961544.760584846, 140256896.7406885, 48961560.15593681, 140256855.525737, 48961552.07337703, 140256859.45097047, 48961552.843144625, 0, 0, 0, 0, 0 },
-  { 140256851.8783148, 48961581.06522309, 140256812.6842372, 48961573.076213025, 140256891.07239237, 48961589.054233156, 140256849.9186109, 48961580.66577259, 140256853.8380187, 48961581.46467359, 0, 0, 0, 0, 0 },
-  { 140256846.04744223, 48961609.67147968, 140256806.9310503, 48961601.31038635, 140256885.16383415, 48961618.03257301, 140256844.09162262, 48961609.25342501, 140256848.00326183, 48961610.08953435, 1, 1, 140256531.16048712, 48961542.364678375, 35 },
-  { 140256839.93525255, 48961638.26664035, 140256800.94705102, 48961629.32683383, 140256878.92345408, 48961647.20644687, 140256837.98584247, 48961637.819650024, 140256841.88466263, 48961638.713630676, 1, 3, 140257026.10391492, 48961680.95421648, 28 },
-  { 140256833.3941705, 48961666.79354693, 140256794.72155625, 48961656.574500635, 140256872.06678474, 48961677.012593225, 140256831.4605398, 48961666.282594614, 140256835.3278012, 48961667.304499246, 0, 0, 0, 0, 0 },
-  { 140256825.93735754, 48961695.01285843, 140256787.88099065, 48961682.69567782, 140256863.99372444, 48961707.33003904, 140256824.0345392, 48961694.3969994, 140256827.8401759, 48961695.62871746, 0, 0, 0, 0, 0 },
-  { 140256816.99537644, 48961722.64087856, 140256779.99882993, 48961707.43378989, 140256853.99192294, 48961737.84796723, 140256815.14554912, 48961721.88052412, 140256818.84520376, 48961723.401232995, 0, 0, 0, 0, 0 },
-  { 140256805.9987896, 48961749.393910974, 140256770.69002235, 48961730.59787539, 140256841.30755687, 48961768.18994656, 140256804.23335123, 48961748.45410919, 140256807.764228, 48961750.33371276, 0, 0, 0, 0, 0 },
-  { 140256792.3769843, 48961774.98277259, 140256759.83765152, 48961751.71924272, 140256824.91631708, 48961798.246302456, 140256790.75001767, 48961773.8195961, 140256794.00395092, 48961776.14594908, 0, 0, 0, 0, 0 },
-  { 140256775.45842338, 48961798.647224516, 140256747.80180323, 48961769.748931095, 140256803.11504352, 48961827.54551794, 140256774.07559237, 48961797.20230985, 140256776.84125438, 48961800.092139184, 0, 0, 0, 0, 0 },
-  { 140256754.39954546, 48961818.801265396, 140256733.96631593, 48961784.41401295, 140256774.832775, 48961853.18851784, 140256753.37788397, 48961817.08190277, 140256755.42120695, 48961820.52062802, 0, 0, 0, 0, 0 },
-  { 140256729.1249379, 48961833.81967545, 140256717.6662736, 48961795.496066384, 140256740.5836022, 48961872.14328452, 140256728.55200467, 48961831.903495, 140256729.69787112, 48961835.73585591, 1, 4, 140256804.7521223, 48962086.75549533, 28 },
-  { 140256701.19808605, 48961842.16973507, 140256700.09177348, 48961802.185037084, 140256702.30439863, 48961882.15443305, 140256701.1427704, 48961840.17050017, 140256701.2534017, 48961844.16896997, 0, 0, 0, 0, 0 },
-  { 140256672.26032513, 48961842.970396586, 140256678.93402678, 48961803.531054474, 140256665.5866235, 48961882.4097387, 140256672.5940102, 48961840.99842948, 140256671.92664006, 48961844.942363694, 0, 0, 0, 0, 0 },
-  { 140256643.40738034, 48961838.088065006, 140256656.05405557, 48961800.13992136, 140256630.7607051, 48961876.03620865, 140256644.0397141, 48961836.190657824, 140256642.7750466, 48961839.98547219, 0, 0, 0, 0, 0 },
-  { 140256615.8477171, 48961828.90347581, 140256636.67885154, 48961794.75579891, 140256595.01658267, 48961863.05115271, 140256616.88927382, 48961827.19609197, 140256614.8061604, 48961830.610859655, 1, 5, 140256562.2075459, 48961916.833743826, 42 },
-  { 140256591.28842103, 48961813.92154893, 140256618.6613362, 48961784.754383914, 140256563.91550586, 48961843.08871395, 140256592.6570668, 48961812.46319068, 140256589.91977528, 48961815.37990718, 0, 0, 0, 0, 0 },
-  { 140256569.98234844, 48961793.92614254, 140256600.9625661, 48961768.6234527, 140256539.00213078, 48961819.22883239, 140256571.53135931, 48961792.66100805, 140256568.43333757, 48961795.191277035, 0, 0, 0, 0, 0 },
-  { 140256551.37276095, 48961771.1408547, 140256584.36436042, 48961748.523287095, 140256518.38116148, 48961793.75842231, 140256553.02234092, 48961770.00997632, 140256549.72318098, 48961772.27173308, 0, 0, 0, 0, 0 },
-  { 140256534.91415012, 48961747.13314945, 140256569.2704617, 48961726.64793885, 140256500.55783853, 48961767.61836006, 140256536.6319657, 48961746.108888924, 140256533.19633454, 48961748.15740998, 1, 1, 140256219.69499123, 48961935.08495674, 37 },
-  { 140256520.09328339, 48961722.27666516, 140256555.32004806, 48961703.32738945, 140256484.8665187, 48961741.22594087, 140256521.85462162, 48961721.32920137, 140256518.33194515, 48961723.22412895, 0, 0, 0, 0, 0 },
-  { 140256506.40030238, 48961696.82136929, 140256542.14502263, 48961678.86823658, 140256470.65558213, 48961714.774502, 140256508.1875384, 48961695.923712656, 140256504.61306638, 48961697.719025925, 1, 5, 140256296.4000709, 48961802.29602396, 32 },
-  { 140256493.4183821, 48961670.974342145, 140256529.57100812, 48961653.85746063, 140256457.2657561, 48961688.09122366, 140256495.22601342, 48961670.11849807, 140256491.6107508, 48961671.83018622, 0, 0, 0, 0, 0 },
-  { 140256481.0284037, 48961644.805424914, 140256517.52796835, 48961628.44138564, 140256444.52883905, 48961661.169464186, 140256482.85338193, 48961643.98722295, 140256479.20342547, 48961645.62362688, 1, 3, 140256234.6563424, 48961755.26269001, 39 },
-  { 140256469.17067304, 48961618.35706462, 140256505.96208605, 48961602.660188206, 140256432.37926003, 48961634.053941034, 140256471.01024368, 48961617.5722208, 140256467.3311024, 48961619.14190844, 1, 4, 140256620.01546636, 48961553.99987132, 44 },
-  { 140256457.7854963, 48961591.67170832, 140256494.81895512, 48961576.554733545, 140256420.75203747, 48961606.7886831, 140256459.63716924, 48961590.91585959, 140256455.93382335, 48961592.42755706, 0, 0, 0, 0, 0 },
-  { 140256446.81317928, 48961564.791803025, 140256484.04350424, 48961550.166383274, 140256409.58285433, 48961579.417222776, 140256448.67469552, 48961564.06053204, 140256444.95166305, 48961565.52307401, 1, 4, 140256618.07267413, 48961497.51487218, 36 },
-  { 140256436.19402802, 48961537.75979579, 140256473.58101708, 48961523.539632306, 140256398.80703896, 48961551.97995928, 140256438.06337747, 48961537.048787616, 140256434.32467857, 48961538.47080397, 0, 0, 0, 0, 0 },
-  { 140256425.8701134, 48961510.616642125, 140256463.3907409, 48961496.75293009, 140256388.3494859, 48961524.48035416, 140256427.74614477, 48961509.92345652, 140256423.99408203, 48961511.30982773, 0, 0, 0, 0, 0 },
-  { 140256415.80742803, 48961483.383079536, 140256453.45001727, 48961469.85401915, 140256378.1648388, 48961496.91213992, 140256417.6895575, 48961482.70662652, 140256413.92529857, 48961484.05953255, 0, 0, 0, 0, 0 },
-  { 140256405.9891868, 48961456.06529017, 140256443.74285543, 48961442.84937155, 140256368.23551816, 48961469.28120878, 140256407.87687021, 48961455.40449424, 140256404.10150337, 48961456.726086095, 0, 0, 0, 0, 0 },
-  { 140256396.39898372, 48961428.6691356, 140256434.25338712, 48961415.74457983, 140256358.5445803, 48961441.59369137, 140256398.29170388, 48961428.02290781, 140256394.50626355, 48961429.31536339, 1, 2, 140256186.30704474, 48961500.40042014, 40 },
-  { 140256387.02041286, 48961401.20047742, 140256424.9657139, 48961388.54527574, 140256349.07511184, 48961413.8556791, 140256388.9176779, 48961400.567717336, 140256385.12314782, 48961401.83323751, 1, 1, 140256659.27794778, 48961310.39940538, 27 },
-  { 140256377.8370682, 48961373.66517719, 140256415.86390442, 48961361.25712627, 140256339.81023198, 48961386.073228106, 140256379.73841, 48961373.044774644, 140256375.9357264, 48961374.28557973, 0, 0, 0, 0, 0 },
-  { 140256368.83254382, 48961346.06909655, 140256406.9319926, 48961333.885829195, 140256330.73309505, 48961358.252363905, 140256370.73751625, 48961345.459933184, 140256366.9275714, 48961346.67825992, 0, 0, 0, 0, 0 },
-  { 140256359.99043375, 48961318.41809704, 140256398.15397564, 48961306.43710919, 140256321.82689187, 48961330.399084896, 140256361.89861086, 48961317.81904765, 140256358.08225664, 48961319.01714643, 1, 3, 140256043.233036, 48961417.86029622, 38 },
-  { 140256351.294332, 48961290.71804027, 140256389.5138128, 48961278.91671462, 140256313.07485119, 48961302.51936592, 140256353.20530602, 48961290.12797399, 140256349.38335797, 48961291.30810656, 0, 0, 0, 0, 0 },
-  { 140256342.72783267, 48961262.974787846, 140256380.9954241, 48961251.33041375, 140256304.46024126, 48961274.61916194, 140256344.64121225, 48961262.39256914, 140256340.8144531, 48961263.55700655, 0, 0, 0, 0, 0 },
-  { 140256334.27452976, 48961235.194201306, 140256372.58268932, 48961223.683992326, 140256295.9663702, 48961246.704410285, 140256336.18993774, 48961234.618690856, 140256332.35912177, 48961235.769711755, 1, 0, 140256439.62196857, 48961203.54112662, 46 },
-  { 140256325.91801733, 48961207.38214228, 140256364.25944752, 48961195.98325066, 140256287.57658714, 48961218.7810339, 140256327.83508885, 48961206.8121977, 140256324.0009458, 48961207.952086866, 0, 0, 0, 0, 0 },
-  { 140256317.64188936, 48961179.54447234, 140256356.00949624, 48961168.23400182, 140256279.2742825, 48961190.85494285, 140256319.5602697, 48961178.97894881, 140256315.723509, 48961180.109995864, 1, 3, 140256452.88770357, 48961139.67506377, 39 },
-  { 140256309.42973998, 48961151.68705309, 140256347.8165911, 48961140.44206927, 140256271.04288885, 48961162.932036914, 140256311.34908253, 48961151.1248039, 140256307.51039743, 48961152.24930228, 1, 1, 140255994.6575608, 48961243.89592041, 48 },
-  { 140256301.26516312, 48961123.815746084, 140256339.66444555, 48961112.613286145, 140256262.8658807, 48961135.01820602, 140256303.18512726, 48961123.25562309, 140256299.345199, 48961124.37586908, 0, 0, 0, 0, 0 },
-  { 140256293.131753, 48961095.93641295, 140256331.5367306, 48961084.753493115, 140256254.7267754, 48961107.11933279, 140256295.05200186, 48961095.37726696, 140256291.21150413, 48961096.49555895, 1, 5, 140256071.34300742, 48961160.51777503, 35 },
-  { 140256285.01310346, 48961068.05491526, 140256323.4170744, 48961056.86853897, 140256246.6091325, 48961079.241291545, 140256286.93330202, 48961067.495596446, 140256283.0929049, 48961068.61423407, 0, 0, 0, 0, 0 },
-  { 140256276.8928086, 48961040.17711458, 140256315.28906268, 48961028.964279436, 140256238.4965545, 48961051.38994973, 140256278.8126213, 48961039.616472825, 140256274.97299588, 48961040.73775634, 1, 5, 140256061.8737857, 48961102.96899141, 36 },
-  { 140256268.7544625, 48961012.30887255, 140256307.13623822, 48961001.04657729, 140256230.3726868, 48961023.57116781, 140256270.6735513, 48961011.74575779, 140256266.83537373, 48961012.87198731, 0, 0, 0, 0, 0 },
-  { 140256260.5816592, 48960984.4560507, 140256298.94210103, 48960973.121303156, 140256222.22121736, 48960995.79079825, 140256262.4996813, 48960983.889313325, 140256258.6636371, 48960985.02278808, 0, 0, 0, 0, 0 },
-  { 140256252.3579927, 48960956.62451067, 140256290.69010863, 48960945.194336124, 140256214.0258768, 48960968.05468521, 140256254.2745985, 48960956.05300194, 140256250.4413869, 48960957.196019396, 1, 1, 140256372.14585492, 48960920.905215226, 43 },
-  { 140256244.06705704, 48960928.820114, 140256282.36367592, 48960917.271565095, 140256205.77043816, 48960940.36866291, 140256245.981888, 48960928.242686555, 140256242.1522261, 48960929.39754145, 0, 0, 0, 0, 0 },
-  { 140256235.69244632, 48960901.04872231, 140256273.94617584, 48960889.35889005, 140256197.4387168, 48960912.738554575, 140256237.6051328, 48960900.4642307, 140256233.77975985, 48960901.63321392, 0, 0, 0, 0, 0 },
-  { 140256227.21775454, 48960873.31619719, 140256265.42093936, 48960861.46222441, 140256189.01456973, 48960885.170169964, 140256229.12791377, 48960872.723498546, 140256225.3075953, 48960873.90889583, 1, 2, 140255995.13340685, 48960945.32908181, 46 },
-  { 140256218.62657574, 48960845.628400214, 140256256.77125627, 48960833.58749709, 140256180.4818952, 48960857.669303335, 140256220.53380975, 48960845.02635506, 140256216.71934173, 48960846.23044537, 1, 0, 140256416.02529743, 48960783.316726565, 30 },
-  { 140256209.90250385, 48960817.99119296, 140256247.9803759, 48960805.74065576, 140256171.8246318, 48960830.24173016, 140256211.80639744, 48960817.378666095, 140256207.99861026, 48960818.60371982, 0, 0, 0, 0, 0 },
-  { 140256201.02913308, 48960790.41043704, 140256239.03150803, 48960777.92766897, 140256163.02675813, 48960802.89320511, 140256202.92925182, 48960789.78629864, 140256199.12901434, 48960791.03457544, 0, 0, 0, 0, 0 },
-  { 140256191.99005744, 48960762.89199404, 140256229.90782398, 48960750.15453034, 140256154.0722909, 48960775.629457735, 140256193.88594577, 48960762.25512085, 140256190.0941691, 48960763.52886722, 0, 0, 0, 0, 0 },
-  { 140256182.7688709, 48960735.44172552, 140256220.59245804, 48960722.427262254, 140256144.94528374, 48960748.45618879, 140256184.66005024, 48960734.791002356, 140256180.87769154, 48960736.09244869, 0, 0, 0, 0, 0 },
-  { 140256173.34916753, 48960708.06549311, 140256211.06850952, 48960694.75191957, 140256135.62982553, 48960721.379066646, 140256175.23513463, 48960707.39981443, 140256171.46320042, 48960708.73117179, 0, 0, 0, 0, 0 },
-  { 140256163.71454135, 48960680.76915837, 140256201.31904456, 48960667.134594284, 140256126.11003813, 48960694.40372246, 140256165.5947665, 48960680.087430164, 140256161.8343162, 48960681.45088658, 0, 0, 0, 0, 0 },
-  { 140256153.84858638, 48960653.558582895, 140256191.32709914, 48960639.581420094, 140256116.37007362, 48960667.535745695, 140256155.722512, 48960652.85972475, 140256151.97466075, 48960654.25744104, 0, 0, 0, 0, 0 },
-  { 140256143.7348968, 48960626.43962827, 140256181.07568195, 48960612.09857651, 140256106.39411166, 48960640.78068004, 140256145.60193607, 48960625.72257569, 140256141.86785755, 48960627.15668086, 0, 0, 0, 0, 0 },
-  { 140256133.3570665, 48960599.4181561, 140256170.54777786, 48960584.69229483, 140256096.16635516, 48960614.144017376, 140256135.2166021, 48960598.68186304, 140256131.49753094, 48960600.154449165, 1, 5, 140255893.4769784, 48960694.39996131, 34 },
-  { 140256122.69868955, 48960572.50002795, 140256159.7263525, 48960557.36886223, 140256085.6710266, 48960587.63119367, 140256124.5500727, 48960571.74346966, 140256120.8473064, 48960573.25658623, 0, 0, 0, 0, 0 },
-  { 140256111.74336, 48960545.69110542, 140256148.59435692, 48960530.1346268, 140256074.8923631, 48960561.24758404, 140256113.58590984, 48960544.913281485, 140256109.90081018, 48960546.46892935, 0, 0, 0, 0, 0 },
-  { 140256100.47467193, 48960518.99725009, 140256137.1347329, 48960502.996002354, 140256063.81461096, 48960534.99849782, 140256102.30767497, 48960518.1971877, 140256098.6416689, 48960519.797312476, 0, 0, 0, 0, 0 },
-  { 140256088.8762193, 48960492.424323544, 140256125.3304193, 48960475.959473014, 140256052.4220193, 48960508.889174074, 140256090.6989293, 48960491.60108102, 140256087.0535093, 48960493.24756607, 0, 0, 0, 0, 0 },
-  { 140256076.93159622, 48960465.9781874, 140256113.16435868, 48960449.03159703, 140256040.69883376, 48960482.92477776, 140256078.74323434, 48960465.13085788, 140256075.1199581, 48960466.82551692, 0, 0, 0, 0, 0 },
-  { 140256064.62439668, 48960439.66470323, 140256100.61950487, 48960422.21901071, 140256028.6292885, 48960457.110395744, 140256066.42415208, 48960438.7924186, 140256062.8246413, 48960440.536987856, 1, 1, 140255823.4571719, 48960556.550843075, 27 },
-  { 140256051.9382148, 48960413.489732616, 140256087.65699434, 48960395.48504465, 140256016.21943527, 48960431.49442058, 140256053.7241538, 48960412.589498214, 140256050.15227583, 48960414.38996702, 1, 1, 140256382.33692548, 48960246.946368925, 28 },
-  { 140256038.8301485, 48960387.4851647, 140256074.12779, 48960368.66824404, 140256003.53250697, 48960406.30208536, 140256040.59503058, 48960386.54431867, 140256037.0652664, 48960388.426010735, 0, 0, 0, 0, 0 },
-  { 140256025.1377446, 48960361.80032644, 140256059.8182451, 48960341.868871786, 140255990.4572441, 48960381.73178109, 140256026.87176964, 48960360.803753704, 140256023.40371957, 48960362.79689917, 0, 0, 0, 0, 0 },
-  { 140256010.6648469, 48960336.617651865, 140256044.49868613, 48960315.2805639, 140255976.83100766, 48960357.95473983, 140256012.35653886, 48960335.55079747, 140256008.97315493, 48960337.68450626, 1, 4, 140255716.31044558, 48960522.25031718, 31 },
-  { 140255995.21529722, 48960312.11957693, 140256027.932043, 48960289.10622112, 140255962.49855146, 48960335.132932745, 140255996.8511345, 48960310.96890914, 140255993.57945994, 48960313.270244725, 0, 0, 0, 0, 0 },
-  { 140255978.5929375, 48960288.488537565, 140256009.9120025, 48960263.60649249, 140255947.2738725, 48960313.37058264, 140255980.15889075, 48960287.24443531, 140255977.02698424, 48960289.73263982, 0, 0, 0, 0, 0 },
-  { 140255960.63447383, 48960265.88419417, 140255990.45943123, 48960239.2295151, 140255930.80951643, 48960292.53887325, 140255962.1257217, 48960264.55146022, 140255959.14322597, 48960267.216928124, 0, 0, 0, 0, 0 },
-  { 140255941.37207606, 48960244.330747925, 140255969.7018798, 48960216.09208259, 140255913.04227233, 48960272.56941326, 140255942.78856626, 48960242.91881466, 140255939.95558587, 48960245.74268119, 1, 5, 140255682.15437183, 48960502.714535736, 27 },
-  { 140255920.90988868, 48960223.8025202, 140255947.76468673, 48960194.15762481, 140255894.05509064, 48960253.44741559, 140255922.2526286, 48960222.32027543, 140255919.56714877, 48960225.28476497, 1, 2, 140256110.23621482, 48960014.80600772, 32 },
-  { 140255899.3521687, 48960204.27375451, 140255924.76845777, 48960173.386665784, 140255873.93587965, 48960235.16084323, 140255900.62298316, 48960202.72940007, 140255898.08135426, 48960205.818108946, 1, 2, 140255687.76156223, 48960461.40876816, 25 },
-  { 140255876.80317318, 48960185.71869438, 140255900.82945266, 48960153.73842085, 140255852.7768937, 48960217.69896791, 140255878.00448716, 48960184.1196807, 140255875.6018592, 48960187.31770806, 0, 0, 0, 0, 0 },
-  { 140255853.36715898, 48960168.111583345, 140255876.0601913, 48960135.17184618, 140255830.67412665, 48960201.05132051, 140255854.50181058, 48960166.46459649, 140255852.23250738, 48960169.7585702, 1, 3, 140255720.61291996, 48960360.809045754, 38 },
-  { 140255829.14838633, 48960151.426647834, 140255850.59827405, 48960117.6642084, 140255807.6984986, 48960185.18908727, 140255830.22088072, 48960149.73852586, 140255828.07589194, 48960153.11476981, 0, 0, 0, 0, 0 },
-  { 140255804.25598285, 48960135.6120542, 140255824.64586037, 48960101.19907853, 140255783.86610532, 48960170.02502987, 140255805.27547672, 48960133.89140542, 140255803.23648897, 48960137.33270298, 1, 2, 140255652.8611422, 48960391.12839853, 44 },
-  { 140255778.81375253, 48960120.537392676, 140255798.3529674, 48960085.634397365, 140255759.27453765, 48960155.44038799, 140255779.79071328, 48960118.79224291, 140255777.83679178, 48960122.282542445, 1, 5, 140255872.1135036, 48959953.875590056, 37 },
-  { 140255752.9482544, 48960106.05750287, 140255771.85261482, 48960070.80661412, 140255734.043894, 48960141.30839162, 140255753.89347243, 48960104.294958435, 140255752.00303638, 48960107.82004731, 1, 0, 140255578.55552968, 48960431.2469516, 30 },
-  { 140255726.7860477, 48960092.02722443, 140255745.275141, 48960056.55676589, 140255708.2969544, 48960127.49768297, 140255727.71050236, 48960090.2537015, 140255725.86159304, 48960093.80074736, 0, 0, 0, 0, 0 },
-  { 140255700.45369127, 48960078.30139694, 140255718.7494933, 48960042.73085255, 140255682.15788925, 48960113.871941335, 140255701.36848137, 48960076.52286972, 140255699.53890118, 48960080.079924166, 1, 5, 140255587.9345088, 48960297.06024495, 34 },
-  { 140255674.0777444, 48960064.73486006, 140255692.40406412, 48960029.180029094, 140255655.75142467, 48960100.28969103, 140255674.99406037, 48960062.95711851, 140255673.16142842, 48960066.512601614, 1, 3, 140255769.374607, 48959879.84973902, 31 },
-  { 140255647.78476605, 48960051.18245341, 140255666.3670762, 48960015.760740444, 140255629.2024559, 48960086.60416637, 140255648.71388155, 48960049.41136776, 140255646.85565054, 48960052.95353906, 0, 0, 0, 0, 0 },
-  { 140255621.70131534, 48960037.499016605, 140255640.76651308, 48960002.33485537, 140255602.6361176, 48960072.66317784, 140255622.65457523, 48960035.74080855, 140255620.74805546, 48960039.257224664, 0, 0, 0, 0, 0 },
-  { 140255595.95395133, 48960023.539389275, 140255615.7295664, 48959988.769789785, 140255576.17833626, 48960058.308988765, 140255596.9427321, 48960021.8009093, 140255594.96517056, 48960025.27786925, 0, 0, 0, 0, 0 },
-  { 140255570.66923314, 48960009.15841103, 140255591.38154837, 48959974.9385338, 140255549.9569179, 48960043.37828827, 140255571.70484892, 48960007.44741717, 140255569.63361737, 48960010.8694049, 0, 0, 0, 0, 0 },
-  { 140255545.97371984, 48959994.21092152, 140255567.84421524, 48959960.7194087, 140255524.10322443, 48960027.70243434, 140255547.06724462, 48959992.53634588, 140255544.88019505, 48959995.88549716, 0, 0, 0, 0, 0 },
-  { 140255521.99397054, 48959978.55176037, 140255545.2334906, 48959945.99527548, 140255498.7544505, 48960011.10824525, 140255523.15594655, 48959976.92393612, 140255520.83199453, 48959980.179584615, 0, 0, 0, 0, 0 },
-  { 140255498.85654423, 48959962.035767175, 140255523.65670618, 48959930.65182277, 140255474.05638227, 48959993.41971158, 140255500.0965523, 48959960.46656995, 140255497.61653614, 48959963.6049644, 0, 0, 0, 0, 0 },
-  { 140255476.68800005, 48959944.51778158, 140255503.2097204, 48959914.57452942, 140255450.1662797, 48959974.46103374, 140255478.01408607, 48959943.02061897, 140255475.36191404, 48959946.01494419, 0, 0, 0, 0, 0 },
-  { 140255455.61489704, 48959925.85264321, 140255483.97462872, 48959897.644034244, 140255427.25516537, 48959954.06125217, 140255457.0328836, 48959924.44221276, 140255454.19691047, 48959927.26307365, 1, 2, 140255335.7950307, 48960045.034016065, 50 },
-  { 140255435.76379436, 48959905.8951917, 140255465.97224873, 48959879.67593762, 140255405.55534, 48959932.114445776, 140255437.27421707, 48959904.58422899, 140255434.25337166, 48959907.206154406, 0, 0, 0, 0, 0 },
-  { 140255417.2299392, 48959884.54145232, 140255449.03775284, 48959860.28731884, 140255385.42212555, 48959908.795585796, 140255418.82032987, 48959883.32874564, 140255415.6395485, 48959885.754158996, 0, 0, 0, 0, 0 },
-  { 140255399.95615467, 48959861.88793969, 140255433.07456213, 48959839.456464306, 140255366.83774722, 48959884.31941508, 140255401.61207506, 48959860.76636592, 140255398.3002343, 48959863.00951346, 1, 0, 140255553.12878913, 48959758.14236603, 48 },
-  { 140255383.83895105, 48959838.09208555, 140255418.01902398, 48959817.314149775, 140255349.65887812, 48959858.87002132, 140255385.5479547, 48959837.053188756, 140255382.1299474, 48959839.13098234, 1, 3, 140255182.17652082, 48959960.68190662, 47 },
-  { 140255368.77482784, 48959813.311335646, 140255403.8061014, 48959794.00305059, 140255333.74355426, 48959832.6196207, 140255370.5263915, 48959812.34592139, 140255367.02326417, 48959814.2767499, 1, 0, 140255642.89454356, 48959662.224005096, 25 },
-  { 140255354.66028467, 48959787.70313576, 140255390.36678603, 48959769.67411025, 140255318.9537833, 48959805.73216127, 140255356.44560975, 48959786.801684484, 140255352.8749596, 48959788.60458703, 1, 5, 140255105.6074377, 48959913.455588676, 50 },
-  { 140255341.39182112, 48959761.42493167, 140255377.62694237, 48959744.48338548, 140255305.15669987, 48959778.366477855, 140255343.2035772, 48959760.57785436, 140255339.58006504, 48959762.27200898, 1, 0, 140255469.12062356, 48959701.70598135, 44 },
-  { 140255328.8659367, 48959734.63416914, 140255365.50703105, 48959718.58953747, 140255292.22484234, 48959750.67880081, 140255330.6979914, 48959733.83193756, 140255327.033882, 48959735.43640072, 0, 0, 0, 0, 0 },
-  { 140255316.979131, 48959707.48829396, 140255353.9222819, 48959692.151944846, 140255280.03598014, 48959722.824643075, 140255318.82628855, 48959706.7214765, 140255315.13197348, 48959708.25511142, 1, 1, 140255482.29973114, 48959638.858131655, 33 },
-  { 140255305.62790358, 48959680.14475188, 140255342.78425232, 48959665.33240069, 140255268.47155485, 48959694.957103066, 140255307.48572102, 48959679.40413432, 140255303.77008614, 48959680.885369435, 0, 0, 0, 0, 0 },
-  { 140255294.70986536, 48959652.757173054, 140255332.02400106, 48959638.34692404, 140255257.39572966, 48959667.16742207, 140255296.57557213, 48959652.036660604, 140255292.8441586, 48959653.4776855, 1, 1, 140255596.02151117, 48959536.394412234, 42 },
-  { 140255284.14533928, 48959625.401215546, 140255321.58774117, 48959611.32760406, 140255246.7029374, 48959639.47482703, 140255286.01745936, 48959624.69753497, 140255282.2732192, 48959626.10489612, 0, 0, 0, 0, 0 },
-  { 140255273.87588084, 48959598.07964349, 140255311.41904366, 48959584.27707395, 140255236.332718, 48959611.88221303, 140255275.75303897, 48959597.38951501, 140255271.9987227, 48959598.76977196, 1, 2, 140255552.63386473, 48959495.59556468, 48 },
-  { 140255263.84386072, 48959570.792422526, 140255301.46121484, 48959557.19335388, 140255226.2265066, 48959584.391491175, 140255265.72472844, 48959570.11246909, 140255261.962993, 48959571.47237596, 0, 0, 0, 0, 0 },
-  { 140255253.99164957, 48959543.53951828, 140255291.65733787, 48959530.07490079, 140255216.32596126, 48959557.00413577, 140255255.874934, 48959542.86628741, 140255252.10836515, 48959544.21274915, 0, 0, 0, 0, 0 },
-  { 140255244.2616181, 48959516.3208964, 140255281.9502381, 48959502.92060082, 140255206.5729981, 48959529.72119199, 140255246.1460491, 48959515.650881626, 140255242.3771871, 48959516.99091118, 0, 0, 0, 0, 0 },
-  { 140255234.596137, 48959489.13652253, 140255272.28245893, 48959475.72976536, 140255196.90981504, 48959502.5432797, 140255236.48045307, 48959488.466184676, 140255232.7118209, 48959489.80686039, 1, 4, 140255596.3848277, 48959360.43165368, 45 },
-  { 140255224.9375769, 48959461.9863623, 140255262.59624812, 48959448.50213144, 140255187.27890566, 48959475.47059316, 140255226.82051045, 48959461.31215076, 140255223.05464333, 48959462.66057384, 0, 0, 0, 0, 0 },
-  { 140255215.22830847, 48959434.87038134, 140255252.8335551, 48959421.23786778, 140255177.62306184, 48959448.5028949, 140255217.1085708, 48959434.18875566, 140255213.34804612, 48959435.55200702, 1, 5, 140255503.84857634, 48959330.24083976, 35 },
-  { 140255205.4107024, 48959407.78854529, 140255242.93603957, 48959393.93758608, 140255167.88536525, 48959421.6395045, 140255207.28696927, 48959407.095997326, 140255203.53443554, 48959408.48109325, 0, 0, 0, 0, 0 },
-  { 140255195.42712942, 48959380.740819804, 140255232.8467624, 48959366.60678045, 140255158.00749645, 48959394.87485916, 140255197.29811105, 48959380.03411783, 140255193.55614778, 48959381.447521776, 1, 0, 140255467.65495926, 48959277.915683456, 39 },
-  { 140255185.22395453, 48959353.728084825, 140255222.52471218, 48959339.28324221, 140255147.92319688, 48959368.17292744, 140255187.08899242, 48959353.00584269, 140255183.35891664, 48959354.45032696, 0, 0, 0, 0, 0 },
-  { 140255174.7799464, 48959326.75863787, 140255211.95480108, 48959311.99279286, 140255137.6050917, 48959341.524482876, 140255176.63868913, 48959326.02034562, 140255172.92120364, 48959327.496930115, 1, 3, 140255528.8704373, 48959186.11396417, 30 },
-  { 140255164.08960766, 48959299.844378054, 140255201.13121182, 48959284.74737301, 140255127.0480035, 48959314.9413831, 140255165.94168785, 48959299.0895278, 140255162.23752746, 48959300.59922831, 1, 1, 140254799.2298067, 48959448.54987773, 40 },
-  { 140255153.14754495, 48959272.99722829, 140255190.0481683, 48959257.55883469, 140255116.2469216, 48959288.43562189, 140255154.99257612, 48959272.225308605, 140255151.30251378, 48959273.76914797, 1, 3, 140255322.89041233, 48959201.98061771, 32 },
-  { 140255141.94836497, 48959246.22911156, 140255178.6998746, 48959230.43903435, 140255105.19685534, 48959262.01918877, 140255143.78594047, 48959245.4396077, 140255140.11078948, 48959247.01861542, 0, 0, 0, 0, 0 },
-  { 140255130.4866745, 48959219.55195078, 140255167.0805145, 48959203.399834104, 140255093.89283448, 48959235.70406746, 140255132.3163665, 48959218.74434495, 140255128.65698248, 48959220.359556615, 0, 0, 0, 0, 0 },
-  { 140255118.75708008, 48959192.977668926, 140255155.1842509, 48959176.45310459, 140255082.32990927, 48959209.50223326, 140255120.5784386, 48959192.15144071, 140255116.93572155, 48959193.80389714, 0, 0, 0, 0, 0 },
-  { 140255106.75418857, 48959166.51818894, 140255143.00522575, 48959149.61072597, 140255070.5031514, 48959183.42565191, 140255108.56674042, 48959165.67281579, 140255104.9416367, 48959167.363562085, 0, 0, 0, 0, 0 },
-  { 140255094.47260663, 48959140.18543374, 140255130.53755948, 48959122.884590514, 140255058.40765378, 48959157.48627696, 140255096.27585426, 48959139.32039158, 140255092.669359, 48959141.050475895, 1, 1, 140254752.7571784, 48959304.11092325, 41 },
-  { 140255081.9069408, 48959113.9913263, 140255117.7753513, 48959096.28660579, 140255046.0385303, 48959131.696046814, 140255083.7003613, 48959113.10609028, 140255080.11352026, 48959114.87656233, 0, 0, 0, 0, 0 },
-  { 140255069.051798, 48959087.947789565, 140255104.71267894, 48959069.82869552, 140255033.39091703, 48959106.06688361, 140255070.83484203, 48959087.04183486, 140255067.26875395, 48959088.85374427, 1, 1, 140254937.99806044, 48959154.535460174, 43 },
-  { 140255055.90178484, 48959062.06674648, 140255091.3435989, 48959043.52280364, 140255020.45997077, 48959080.61068932, 140255057.67387554, 48959061.13954934, 140255054.12969413, 48959062.993943624, 0, 0, 0, 0, 0 },
-  { 140255042.45150796, 48959036.36011998, 140255077.66214687, 48959017.380896926, 140255007.24086905, 48959055.33934304, 140255044.2120399, 48959035.41115883, 140255040.69097602, 48959037.30908114, 1, 5, 140254785.41384396, 48959174.90844833, 46 },
-  { 140255028.69557413, 48959010.839833036, 140255063.66234115, 48958991.41497253, 140254993.72880712, 48959030.26469354, 140255030.44391248, 48959009.86859001, 140255026.9472358, 48959011.81107606, 0, 0, 0, 0, 0 },
-  { 140255014.62859267, 48958985.51780495, 140255049.3416433, 48958965.643094495, 140254979.91554204, 48959005.392515406, 140255016.3642452, 48958984.52406943, 140255012.89294013, 48958986.51154047, 1, 0, 140254870.56943253, 48959067.99785333, 39 },
-  { 140255000.24842575, 48958960.401491255, 140255034.7080996, 48958940.09063509, 140254965.7887519, 48958980.71234742, 140255001.97140944, 48958959.38594845, 140254998.52544206, 48958961.41703406, 1, 5, 140255199.25304225, 48958843.10629693, 42 },
-  { 140254985.5625234, 48958935.485190265, 140255019.7716977, 48958914.7552025, 140254951.3533491, 48958956.21517803, 140254987.27298212, 48958934.44869088, 140254983.85206467, 48958936.52168965, 1, 1, 140254729.8489454, 48959090.441848814, 26 },
-  { 140254970.5800935, 48958910.76078803, 140255004.54233772, 48958889.6286805, 140254936.6178493, 48958931.892895564, 140254972.27820572, 48958909.704182655, 140254968.88198128, 48958911.81739341, 1, 5, 140255153.12715608, 48958797.17571002, 31 },
-  { 140254955.31034386, 48958886.22017062, 140254989.02988818, 48958864.70291402, 140254921.59079954, 48958907.73742721, 140254956.99632108, 48958885.144307785, 140254953.62436664, 48958887.29603345, 0, 0, 0, 0, 0 },
-  { 140254939.76248232, 48958861.85522409, 140254973.24418482, 48958839.96971298, 140254906.2807798, 48958883.740735196, 140254941.43656746, 48958860.76094853, 140254938.08839718, 48958862.949499644, 0, 0, 0, 0, 0 },
-  { 140254923.94571677, 48958837.65783449, 140254957.19502935, 48958815.420856014, 140254890.6964042, 48958859.89481297, 140254925.6081824, 48958836.54598557, 140254922.28325114, 48958838.76968341, 1, 3, 140254650.47012067, 48959020.55698251, 30 },
-  { 140254907.86925507, 48958813.619887926, 140254940.89218888, 48958791.048094854, 140254874.84632125, 48958836.191681, 140254909.52040175, 48958812.49129827, 140254906.2181084, 48958814.74847758, 1, 1, 140255189.3897658, 48958621.19535198, 43 },
-  { 140254891.54230514, 48958789.73327046, 140254924.34539548, 48958766.843157634, 140254858.7392148, 48958812.62338328, 140254893.18245965, 48958788.58876482, 140254889.90215063, 48958790.8777761, 0, 0, 0, 0, 0 },
-  { 140254874.97407475, 48958765.989868134, 140254907.56434625, 48958742.797753006, 140254842.38380325, 48958789.18198326, 140254876.6035883, 48958764.83026238, 140254873.3445612, 48958767.14947389, 0, 0, 0, 0, 0 },
-  { 140254858.1737717, 48958742.38156702, 140254890.5587038, 48958718.90357364, 140254825.7888396, 48958765.85956041, 140254859.7930183, 48958741.20766735, 140254856.5545251, 48958743.5554667, 0, 0, 0, 0, 0 },
-  { 140254841.15060398, 48958718.90025319, 140254873.33809656, 48958695.15229914, 140254808.9631114, 48958742.64820724, 140254842.75997862, 48958717.71285549, 140254839.54122934, 48958720.087650895, 1, 5, 140255056.80680427, 48958559.78896107, 31 },
-  { 140254823.9137794, 48958695.53781271, 140254855.91211945, 48958671.535599604, 140254791.91543937, 48958719.540025815, 140254825.5136964, 48958694.33770206, 140254822.3138624, 48958696.73792336, 1, 2, 140254723.91896674, 48958770.54472866, 40 },
-  { 140254806.4725058, 48958672.28613166, 140254838.2903349, 48958648.04513845, 140254774.6546767, 48958696.52712487, 140254808.06339726, 48958671.074081995, 140254804.88161436, 48958673.49818132, 0, 0, 0, 0, 0 },
-  { 140254788.835991, 48958649.137096085, 140254820.4822738, 48958624.67257515, 140254757.1897082, 48958673.601617016, 140254790.41830513, 48958647.91387004, 140254787.25367686, 48958650.36032213, 1, 3, 140254617.94606385, 48958781.24550913, 43 },
-  { 140254771.01344293, 48958626.08259206, 140254802.49743658, 48958601.409567446, 140254739.52944928, 48958650.75561668, 140254772.5876426, 48958624.848940834, 140254769.43924326, 48958627.31624329, 1, 3, 140255070.89848247, 48958391.0720326, 42 },
-  { 140254753.0140694, 48958603.11450563, 140254784.34529436, 48958578.24777397, 140254721.68284446, 48958627.9812373, 140254754.58063066, 48958601.87116905, 140254751.44750816, 48958604.357842214, 0, 0, 0, 0, 0 },
-  { 140254734.8470783, 48958580.22472291, 140254766.03481075, 48958555.178259194, 140254703.65934584, 48958605.27118662, 140254736.4064649, 48958578.97239972, 140254733.28769168, 48958581.477046095, 0, 0, 0, 0, 0 },
-  { 140254716.52133006, 48958557.40559205, 140254747.51420656, 48958532.1184094, 140254685.52845356, 48958582.69277469, 140254718.07097387, 48958556.141232915, 140254714.97168624, 48958558.66995118, 0, 0, 0, 0, 0 },
-  { 140254698.00197762, 48958534.707610585, 140254728.62520605, 48958508.974016204, 140254667.3787492, 48958560.441204965, 140254699.53313905, 48958533.42093086, 140254696.4708162, 48958535.99429031, 1, 4, 140254814.3702457, 48958436.91995194, 37 },
-  { 140254679.1683689, 48958512.29543242, 140254709.2214222, 48958485.89819795, 140254649.11531562, 48958538.69266689, 140254680.67102158, 48958510.97557069, 140254677.66571623, 48958513.61529414, 0, 0, 0, 0, 0 },
-  { 140254659.88986403, 48958490.346999325, 140254689.15416363, 48958463.07795517, 140254630.62556443, 48958517.61604348, 140254661.35307902, 48958488.983547114, 140254658.42664903, 48958491.710451536, 1, 2, 140254937.90071023, 48958231.29107987, 45 },
-  { 140254640.03582305, 48958469.0402531, 140254668.26967946, 48958440.70565672, 140254611.80196664, 48958497.37484948, 140254641.44751588, 48958467.62352328, 140254638.62413022, 48958470.456982926, 1, 1, 140254529.21793664, 48958580.2535439, 35 },
-  { 140254619.4756063, 48958448.55313552, 140254646.41103202, 48958418.981479496, 140254592.54018056, 48958478.12479155, 140254620.8223776, 48958447.07455272, 140254618.128835, 48958450.03171832, 0, 0, 0, 0, 0 },
-  { 140254598.07857364, 48958429.06358839, 140254623.4211939, 48958398.1160263, 140254572.7359534, 48958460.01115048, 140254599.34570464, 48958427.51621028, 140254596.81144264, 48958430.610966496, 0, 0, 0, 0, 0 },
-  { 140254575.71408543, 48958410.7495535, 140254599.14767212, 48958378.33247443, 140254552.28049874, 48958443.16663257, 140254576.88576478, 48958409.12869955, 140254574.54240608, 48958412.370407455, 1, 4, 140254794.81812087, 48958107.6498642, 37 },
-  { 140254552.25150162, 48958393.78897262, 140254573.48107862, 48958359.88757058, 140254531.02192461, 48958427.690374665, 140254553.31298047, 48958392.09390252, 140254551.19002277, 48958395.48404273, 1, 4, 140254403.1137232, 48958631.94632196, 41 },
-  { 140254527.5952446, 48958378.34884697, 140254546.50920832, 48958343.103109986, 140254508.68128085, 48958413.59458396, 140254528.54094276, 48958376.58656012, 140254526.6495464, 48958380.11113382, 0, 0, 0, 0, 0 },
-  { 140254501.85064122, 48958364.53348841, 140254518.39383346, 48958328.11477357, 140254485.30744898, 48958400.952203244, 140254502.67780083, 48958362.71255267, 140254501.0234816, 48958366.35442415, 0, 0, 0, 0, 0 },
-  { 140254475.19444942, 48958352.42491984, 140254489.2970956, 48958314.993444175, 140254461.09180325, 48958389.85639551, 140254475.89958173, 48958350.55334606, 140254474.48931712, 48958354.29649363, 1, 2, 140254576.38093576, 48958083.854081914, 25 },
-  { 140254447.8035129, 48958342.10513738, 140254459.3782793, 48958303.81643431, 140254436.2287465, 48958380.39384045, 140254448.38225123, 48958340.19070222, 140254447.22477457, 48958344.01957253, 1, 5, 140254379.22302198, 48958568.96570307, 38 },
-  { 140254419.85467565, 48958333.656137116, 140254428.7948926, 48958294.66802969, 140254410.9144587, 48958372.644244544, 140254420.3016865, 48958331.706731744, 140254419.4076648, 48958335.60554249, 0, 0, 0, 0, 0 },
-  { 140254391.5247814, 48958327.15991513, 140254397.73003712, 48958287.644161284, 140254385.3195257, 48958366.67566897, 140254391.8350442, 48958325.184127435, 140254391.2145186, 48958329.13570282, 0, 0, 0, 0, 0 },
-  { 140254362.9786403, 48958322.6772446, 140254366.61879122, 48958282.8432227, 140254359.33848935, 48958362.51126651, 140254363.16064784, 48958320.68554351, 140254362.79663274, 48958324.6689457, 1, 4, 140254383.09047413, 48958102.59427357, 43 },
-  { 140254334.25847983, 48958320.05271126, 140254335.70692036, 48958280.078944616, 140254332.8100393, 48958360.02647791, 140254334.33090186, 48958318.05402293, 140254334.1860578, 48958322.051399596, 1, 0, 140254330.05800232, 48958435.97663455, 27 },
-  { 140254305.33495468, 48958319.00467378, 140254304.9985333, 48958279.00608855, 140254305.67137605, 48958359.00325901, 140254305.31813362, 48958317.004744515, 140254305.35177574, 48958321.00460304, 0, 0, 0, 0, 0 },
-  { 140254276.1778226, 48958319.249909505, 140254274.46899512, 48958279.28642732, 140254277.88665006, 48958359.21339169, 140254276.0923812, 48958317.2517354, 140254276.26326397, 48958321.248083614, 1, 3, 140254292.58256626, 48958702.89933852, 29 },
-  { 140254246.75827968, 48958320.50788104, 140254243.66215712, 48958280.62788574, 140254249.85440224, 48958360.38787634, 140254246.60347354, 48958318.51388127, 140254246.91308582, 48958322.5018808, 0, 0, 0, 0, 0 },
-  { 140254217.2102381, 48958322.801872246, 140254211.87749046, 48958283.15894346, 140254222.54298574, 48958362.44480103, 140254216.9436007, 48958320.819725804, 140254217.47687548, 48958324.78401869, 1, 2, 140254268.40461555, 48958703.37398856, 34 },
-  { 140254187.97772837, 48958326.73421535, 140254179.40729788, 48958287.66315546, 140254196.54815885, 48958365.80527524, 140254187.54920685, 48958324.78066236, 140254188.40624988, 48958328.68776834, 1, 2, 140254106.3443779, 48957954.58236987, 31 },
-  { 140254159.53960192, 48958332.97225923, 140254146.69470918, 48958295.09075015, 140254172.38449466, 48958370.85376831, 140254158.89735729, 48958331.07818378, 140254160.18184656, 48958334.866334684, 1, 0, 140254257.80303138, 48958622.765803725, 36 },
-  { 140254132.37471005, 48958342.18335274, 140254114.37978762, 48958306.45965238, 140254150.36963248, 48958377.9070531, 140254131.47496393, 48958340.39716772, 140254133.27445617, 48958343.96953776, 0, 0, 0, 0, 0 },
-  { 140254106.93924385, 48958354.995833986, 140254084.30455208, 48958322.015980616, 140254129.57393563, 48958387.975687355, 140254105.80750927, 48958353.34684132, 140254108.07097843, 48958356.64482665, 1, 4, 140254308.38800064, 48958648.51652899, 47 },
-  { 140254083.2386249, 48958371.26201318, 140254057.46053746, 48958340.67622878, 140254109.01671234, 48958401.84779759, 140254081.94972053, 48958369.73272396, 140254084.52752927, 48958372.791302405, 0, 0, 0, 0, 0 },
-  { 140254060.86346588, 48958390.120081306, 140254033.197602, 48958361.230637275, 140254088.52932975, 48958419.00952534, 140254059.4801727, 48958388.675609104, 140254062.24675906, 48958391.56455351, 0, 0, 0, 0, 0 },
-  { 140254039.39107308, 48958410.68303487, 140254010.30621064, 48958383.22268568, 140254068.47593552, 48958438.143384054, 140254037.93682995, 48958409.31001741, 140254040.8453162, 48958412.05605233, 0, 0, 0, 0, 0 },
-  { 140254018.89630878, 48958432.390238814, 140253987.58472753, 48958407.49877685, 140254050.20789003, 48958457.281700775, 140254017.33072972, 48958431.14566571, 140254020.46188784, 48958433.634811915, 0, 0, 0, 0, 0 },
-  { 140254000.5858241, 48958455.42344715, 140253966.27186605, 48958434.867370605, 140254034.89978215, 48958475.97952369, 140253998.8701262, 48958454.395643316, 140254002.30152202, 48958456.45125098, 0, 0, 0, 0, 0 },
-  { 140253985.82282528, 48958480.06710525, 140253948.3429116, 48958466.09369944, 140254023.30273896, 48958494.04051106, 140253983.9488296, 48958479.36843496, 140253987.69682097, 48958480.76577554, 0, 0, 0, 0, 0 },
-  { 140253975.93327126, 48958506.59318174, 140253936.53014806, 48958499.708860226, 140254015.33639446, 48958513.47750325, 140253973.9631151, 48958506.24896566, 140253977.90342742, 48958506.937397815, 0, 0, 0, 0, 0 },
-  { 140253970.99538347, 48958534.85569106, 140253931.04224023, 48958532.920142986, 140254010.9485267, 48958536.791239135, 140253968.99772632, 48958534.75891366, 140253972.99304062, 48958534.95246846, 1, 1, 140254258.6580147, 48958548.79163718, 43 },
-  { 140253969.57370707, 48958564.20161201, 140253929.58100668, 48958564.96575576, 140254009.56640747, 48958563.43746826, 140253967.57407206, 48958564.2398192, 140253971.57334208, 48958564.16340482, 1, 0, 140253777.60874522, 48958567.869502, 38 },
-  { 140253970.1420658, 48958593.947585896, 140253930.184199, 48958595.78303756, 140254010.09993258, 48958592.11213423, 140253968.14417246, 48958594.03935848, 140253972.13995913, 48958593.85581331, 0, 0, 0, 0, 0 },
-  { 140253971.50278306, 48958623.57046319, 140253931.58567095, 48958626.144207634, 140254011.41989517, 48958620.99671874, 140253969.50692746, 48958623.69915041, 140253973.49863866, 48958623.44177596, 0, 0, 0, 0, 0 },
-  { 140253973.40075538, 48958653.00678649, 140253933.52886724, 48958656.20562032, 140254013.2726435, 48958649.80795266, 140253971.40716097, 48958653.166728176, 140253975.39434978, 48958652.8468448, 0, 0, 0, 0, 0 },
-  { 140253975.7488824, 48958682.27503345, 140253935.9211455, 48958685.983317606, 140254015.57661933, 48958678.5667493, 140253973.75749555, 48958682.46044766, 140253977.74026927, 48958682.08961924, 0, 0, 0, 0, 0 },
-  { 140253978.46006387, 48958711.393681705, 140253938.67076913, 48958715.4939284, 140254018.24935862, 48958707.29343501, 140253976.47059914, 48958711.59869404, 140253980.4495286, 48958711.18866937, 1, 1, 140254305.72701323, 48958677.669152625, 42 },
-  { 140253981.4471993, 48958740.38120887, 140253941.68698794, 48958744.7544905, 140254021.2074107, 48958736.00792723, 140253979.45918876, 48958740.59987295, 140253983.43520987, 48958740.16254479, 1, 3, 140253796.56221646, 48958760.71696848, 50 },
-  { 140253984.62318844, 48958769.25609259, 140253944.88009584, 48958773.78230423, 140254024.36628103, 48958764.72988096, 140253982.6360338, 48958769.482403174, 140253986.61034307, 48958769.02978201, 1, 4, 140254151.5441773, 48958750.24600373, 39 },
-  { 140253987.90093085, 48958798.03681052, 140253948.16147336, 48958802.594827384, 140254027.64038834, 48958793.47879365, 140253985.91395798, 48958798.26471136, 140253989.88790372, 48958797.80890968, 1, 0, 140253598.4542474, 48958842.70537583, 33 },
-  { 140253991.19332632, 48958826.741840295, 140253951.443622, 48958831.209614374, 140254030.94303066, 48958822.27406622, 140253989.2058411, 48958826.965229, 140253993.18081155, 48958826.518451594, 0, 0, 0, 0, 0 },
-  { 140253994.4132744, 48958855.389659554, 140253954.64019328, 48958859.644306116, 140254034.18635553, 48958851.13501299, 140253992.42462036, 48958855.602391884, 140253996.40192845, 48958855.176927224, 1, 2, 140253661.31371993, 48958891.0223245, 29 },
-  { 140253997.47367474, 48958883.99874591, 140253957.66601387, 48958887.91667094, 140254037.28133562, 48958880.08082088, 140253995.48329172, 48958884.194642164, 140253999.46405777, 48958883.80284966, 1, 4, 140254162.67546734, 48958867.739357024, 32 },
-  { 140254000.28742704, 48958912.58757702, 140253960.4371033, 48958916.044699945, 140254040.13775077, 48958909.1304541, 140253998.29491085, 48958912.76043317, 140254002.27994323, 48958912.41472088, 1, 3, 140253601.78418976, 48958947.158806264, 30 },
-  { 140254002.76743093, 48958941.17463052, 140253962.87067807, 48958944.0467572, 140254042.6641838, 48958938.30250385, 140254000.7725933, 48958941.31823686, 140254004.76226857, 48958941.03102419, 0, 0, 0, 0, 0 },
-  { 140254004.82658607, 48958969.77838406, 140253964.88513258, 48958971.94178268, 140254044.76803955, 48958967.614985436, 140254002.8295134, 48958969.88655399, 140254006.82365873, 48958969.67021413, 0, 0, 0, 0, 0 },
-  { 140254006.37779212, 48958998.41731526, 140253966.39998364, 48958999.74954252, 140254046.3556006, 48958997.085088, 140254004.3789017, 48958998.483926624, 140254008.37668255, 48958998.350703895, 1, 3, 140254406.15587687, 48958985.09504267, 31 },
-  { 140254007.33394873, 48959027.10990176, 140253967.3358119, 48959027.49597246, 140254047.33208555, 48959026.723831065, 140254005.3340419, 48959027.1292053, 140254009.33385557, 48959027.090598226, 0, 0, 0, 0, 0 },
-  { 140254007.61158845, 48959055.87424862, 140253967.61486527, 48959055.36225764, 140254047.60831162, 48959056.386239596, 140254005.6117523, 48959055.84864907, 140254009.6114246, 48959055.89984816, 0, 0, 0, 0, 0 },
-  { 140254007.24238193, 48959084.71665326, 140253967.25959027, 48959083.54346463, 140254047.2251736, 48959085.889841884, 140254005.24324235, 48959084.65799382, 140254009.2415215, 48959084.77531269, 0, 0, 0, 0, 0 },
-  { 140254006.39401242, 48959113.62946457, 140253966.4255904, 48959112.040364064, 140254046.36243445, 48959115.21856507, 140254004.39559132, 48959113.55000954, 140254008.39243352, 48959113.70891959, 0, 0, 0, 0, 0 },
-  { 140254005.24200773, 48959142.604227014, 140253965.28084522, 48959140.84198643, 140254045.20317024, 48959144.366467595, 140254003.24394962, 48959142.51611499, 140254007.24006584, 48959142.69233904, 0, 0, 0, 0, 0 },
-  { 140254003.96189547, 48959171.632485084, 140253963.99780133, 48959169.93802922, 140254043.9259896, 48959173.32694095, 140254001.96369076, 48959171.54776229, 140254005.96010017, 48959171.71720788, 1, 4, 140254173.8092955, 48959178.83392249, 49 },
-  { 140254002.72920343, 48959200.70578323, 140253962.75358516, 48959199.309379704, 140254042.7048217, 48959202.10218676, 140254000.73042253, 48959200.63596306, 140254004.72798434, 48959200.775603406, 0, 0, 0, 0, 0 },
-  { 140254001.71236068, 48959229.8155046, 140253961.72656372, 48959228.7496522, 140254041.69815764, 48959230.88135701, 140253999.71307084, 48959229.762211986, 140254003.71165052, 48959229.86879722, 0, 0, 0, 0, 0 },
-  { 140254000.93576455, 48959258.94975914, 140253960.9455889, 48959258.06327756, 140254040.92594022, 48959259.836240724, 140253998.93625575, 48959258.90543506, 140254002.93527335, 48959258.99408322, 0, 0, 0, 0, 0 },
-  { 140254000.28971872, 48959288.09360927, 140253960.29907364, 48959287.22856271, 140254040.2803638, 48959288.958655834, 140253998.29018646, 48959288.05035695, 140254002.28925097, 48959288.1368616, 1, 0, 140254121.2614201, 48959290.71037513, 38 },
-  { 140253999.65941966, 48959317.23200148, 140253959.6719622, 48959316.23037982, 140254039.6468771, 48959318.23362315, 140253997.6600468, 48959317.1819204, 140254001.65879253, 48959317.282082565, 0, 0, 0, 0, 0 },
-  { 140253998.93006346, 48959346.34988217, 140253958.95108443, 48959345.05325737, 140254038.90904248, 48959347.64650697, 140253996.9311145, 48959346.28505093, 140254000.92901242, 48959346.41471341, 1, 5, 140254176.83652014, 48959352.11986256, 39 },
-  { 140253997.98684648, 48959375.432197794, 140253958.0251778, 48959373.68147317, 140254037.94851515, 48959377.182922415, 140253995.98876303, 48959375.34466156, 140253999.98492992, 48959375.519734025, 0, 0, 0, 0, 0 },
-  { 140253996.714965, 48959404.46389478, 140253956.7849197, 48959402.09926262, 140254036.64501026, 48959406.82852694, 140253994.71846274, 48959404.34566317, 140253998.71146724, 48959404.58212639, 0, 0, 0, 0, 0 },
-  { 140253994.99961522, 48959433.429919556, 140253955.12295422, 48959430.2911449, 140254034.87627622, 48959436.56869421, 140253993.00578216, 48959433.272980824, 140253996.9934483, 48959433.58685829, 0, 0, 0, 0, 0 },
-  { 140253992.72599345, 48959462.31521855, 140253952.9338847, 48959458.24237164, 140254032.5181022, 48959466.388065465, 140253990.73638803, 48959462.11157621, 140253994.71559888, 48959462.5188609, 0, 0, 0, 0, 0 },
-  { 140253989.77929598, 48959491.10473822, 140253950.11419457, 48959485.93949571, 140254029.4443974, 48959496.26998073, 140253987.79604092, 48959490.84647609, 140253991.76255104, 48959491.36300035, 0, 0, 0, 0, 0 },
-  { 140253986.04471907, 48959519.783424966, 140253946.56204724, 48959513.3710444, 140254025.5273909, 48959526.195805535, 140253984.0705855, 48959519.462805934, 140253988.01885265, 48959520.104044, 1, 5, 140254180.49687788, 48959551.36439925, 37 },
-  { 140253981.4074589, 48959548.33622523, 140253942.17691362, 48959540.5282602, 140254020.63800418, 48959556.14419025, 140253979.44593164, 48959547.94582698, 140253983.36898616, 48959548.726623476, 1, 3, 140253683.25531486, 48959488.99569105, 39 },
-  { 140253975.75271183, 48959576.748085454, 140253936.85897696, 48959567.40584866, 140254014.6464467, 48959586.09032225, 140253973.8080251, 48959576.28097361, 140253977.69739857, 48959577.215197295, 0, 0, 0, 0, 0 },
-  { 140253968.96569848, 48959605.00387725, 140253930.50779215, 48959594.00435726, 140254007.42360482, 48959616.00339724, 140253967.04280317, 48959604.45390125, 140253970.8885938, 48959605.55385325, 0, 0, 0, 0, 0 },
-  { 140253960.9434781, 48959633.05217391, 140253923.03654703, 48959620.2824998, 140253998.85040918, 48959645.82184803, 140253959.04813156, 48959632.41369021, 140253962.83882466, 48959633.690657616, 1, 5, 140254183.64669812, 48959708.07400935, 27 },
-  { 140253951.61395228, 48959660.746983446, 140253914.39605188, 48959646.08997523, 140253988.83185267, 48959675.40399166, 140253949.75305727, 48959660.014133036, 140253953.4748473, 48959661.479833856, 1, 2, 140253680.85372686, 48959554.11724869, 33 },
-  { 140253940.90998134, 48959687.927109055, 140253904.5462331, 48959671.26344163, 140253977.2737296, 48959704.59077648, 140253939.09179392, 48959687.093925685, 140253942.72816876, 48959688.760292426, 1, 4, 140254120.00144154, 48959769.99567114, 29 },
-  { 140253928.76442584, 48959714.431353964, 140253893.45040363, 48959695.64519321, 140253964.07844806, 48959733.217514716, 140253926.99872473, 48959713.492045924, 140253930.53012696, 48959715.370662004, 0, 0, 0, 0, 0 },
-  { 140253915.11014622, 48959740.09852141, 140253881.07420135, 48959719.085324235, 140253949.1460911, 48959761.11171859, 140253913.40834898, 48959739.047861554, 140253916.81194347, 48959741.14918127, 0, 0, 0, 0, 0 },
-  { 140253899.88000295, 48959764.76741462, 140253867.35082075, 48959741.4896934, 140253932.40918514, 48959788.04513584, 140253898.25354382, 48959763.60352856, 140253901.50646207, 48959765.931300685, 1, 1, 140253769.76327413, 48959671.65652975, 45 },
-  { 140253883.03704605, 48959788.30440988, 140253851.888865, 48959763.20877646, 140253914.1852271, 48959813.400043294, 140253881.479637, 48959787.049628206, 140253884.5944551, 48959789.55919155, 0, 0, 0, 0, 0 },
-  { 140253864.8605502, 48959810.86470052, 140253834.66882354, 48959784.62618604, 140253895.05227685, 48959837.103214994, 140253863.35096386, 48959809.552774794, 140253866.37013653, 48959812.17662624, 1, 4, 140253744.84843674, 48959706.56660549, 38 },
-  { 140253845.81844038, 48959832.77577994, 140253816.10009092, 48959806.0022911, 140253875.53678983, 48959859.54926878, 140253844.3325229, 48959831.4371055, 140253847.30435786, 48959834.11445438, 1, 3, 140253952.80449846, 48959929.16033978, 28 },
-  { 140253826.3720666, 48959854.36109277, 140253796.8621943, 48959827.35799226, 140253855.88193887, 48959881.364193276, 140253824.89657298, 48959853.01093774, 140253827.8475602, 48959855.711247794, 1, 5, 140253751.1218922, 48959785.50318648, 40 },
-  { 140253806.76294103, 48959875.790587164, 140253777.44489086, 48959848.579340704, 140253836.0809912, 48959903.001833625, 140253805.29703853, 48959874.43002484, 140253808.22884354, 48959877.15114949, 0, 0, 0, 0, 0 },
-  { 140253787.00666443, 48959897.076473854, 140253757.87509394, 48959869.66568034, 140253816.1382349, 48959924.48726737, 140253785.5500859, 48959895.70593418, 140253788.46324295, 48959898.44701353, 1, 0, 140253693.78563887, 48959809.361934625, 42 },
-  { 140253767.1085265, 48959918.22376415, 140253738.157914, 48959890.62191571, 140253796.05913898, 48959945.82561259, 140253765.66099587, 48959916.84367173, 140253768.55605713, 48959919.60385657, 1, 1, 140253951.66868103, 48960094.185547955, 39 },
-  { 140253747.07381707, 48959939.23746944, 140253718.29847237, 48959911.452949695, 140253775.84916177, 48959967.02198919, 140253745.63504985, 48959937.84824345, 140253748.5125843, 48959940.62669543, 0, 0, 0, 0, 0 },
-  { 140253726.90782577, 48959960.122601025, 140253698.3018997, 48959932.16368484, 140253755.51375183, 48959988.08151721, 140253725.47752947, 48959958.72465522, 140253728.33812207, 48959961.52054683, 0, 0, 0, 0, 0 },
-  { 140253706.61584243, 48959980.88417029, 140253678.17333707, 48959952.75902338, 140253735.0583478, 48960009.00931719, 140253705.19371715, 48959979.47791294, 140253708.0379677, 48959982.29042763, 0, 0, 0, 0, 0 },
-  { 140253686.2031568, 48960001.52718853, 140253657.91793466, 48959973.2438682, 140253714.48837894, 48960029.81050886, 140253684.7888957, 48960000.11302251, 140253687.6174179, 48960002.94135455, 0, 0, 0, 0, 0 },
-  { 140253665.67505857, 48960022.05666709, 140253637.5408517, 48959993.623123445, 140253693.80926543, 48960050.490210734, 140253664.26834822, 48960020.63498991, 140253667.08176893, 48960023.47834427, 0, 0, 0, 0, 0 },
-  { 140253645.03683755, 48960042.47761732, 140253617.04725635, 48960013.90169486, 140253673.02641875, 48960071.05353979, 140253643.6373585, 48960041.0488212, 140253646.4363166, 48960043.90641344, 0, 0, 0, 0, 0 },
-  { 140253624.29378343, 48960062.79505058, 140253596.44232503, 48960034.084490426, 140253652.14524183, 48960091.50561073, 140253622.90121052, 48960061.359522566, 140253625.68635634, 48960064.23057859, 0, 0, 0, 0, 0 },
-  { 140253603.45118594, 48960083.013978176, 140253575.7312421, 48960054.17642085, 140253631.1711298, 48960111.8515355, 140253602.06518874, 48960081.57210031, 140253604.83718315, 48960084.45585604, 0, 0, 0, 0, 0 },
-  { 140253582.5143349, 48960103.13941146, 140253554.91919976, 48960074.182399906, 140253610.10947, 48960132.09642301, 140253581.13457814, 48960101.69156088, 140253583.89409164, 48960104.587262034, 0, 0, 0, 0, 0 },
-  { 140253561.48852003, 48960123.176361784, 140253534.01139772, 48960094.107344784, 140253588.96564233, 48960152.245378785, 140253560.1146639, 48960121.72291093, 140253562.86237615, 48960124.629812635, 1, 5, 140253724.29046974, 48960295.4102875, 47 },
-  { 140253540.37903103, 48960143.12984047, 140253513.01304227, 48960113.95617668, 140253567.7450198, 48960172.30350426, 140253539.0107316, 48960141.67115728, 140253541.74733046, 48960144.58852366, 1, 1, 140253334.44996557, 48959923.598020464, 37 },
-  { 140253519.19115767, 48960163.00485887, 140253491.9293467, 48960133.73382091, 140253546.45296863, 48960192.275896825, 140253517.82806712, 48960161.541306965, 140253520.5542482, 48960164.46841077, 1, 2, 140253686.1697498, 48960342.28996635, 27 },
-  { 140253497.93018967, 48960182.8064283, 140253470.76553056, 48960153.44520736, 140253525.09484878, 48960212.16764924, 140253496.57195672, 48960181.33836725, 140253499.2884226, 48960184.27448934, 0, 0, 0, 0, 0 },
-  { 140253476.60141683, 48960202.53956013, 140253449.5268196, 48960173.095270626, 140253503.67601407, 48960231.98384964, 140253475.24768695, 48960201.06734566, 140253477.9551467, 48960204.01177461, 0, 0, 0, 0, 0 },
-  { 140253455.2101289, 48960222.20926569, 140253428.21844533, 48960192.68895033, 140253482.20181248, 48960251.72958104, 140253453.8605447, 48960220.73324992, 140253456.5597131, 48960223.685281456, 1, 5, 140253318.22733483, 48960072.39366526, 30 },
-  { 140253433.7616156, 48960241.82055631, 140253406.84564483, 48960212.23119137, 140253460.67758638, 48960271.40992126, 140253432.41581705, 48960240.341088064, 140253435.10741416, 48960243.30002456, 0, 0, 0, 0, 0 },
-  { 140253412.2611666, 48960261.37844334, 140253385.41366017, 48960231.72694425, 140253439.10867304, 48960291.02994242, 140253410.9187913, 48960259.89586838, 140253413.6035419, 48960262.86101829, 1, 2, 140253279.3660097, 48960114.603522874, 30 },
-  { 140253390.7140718, 48960280.887938105, 140253363.92773908, 48960251.181164816, 140253417.50040454, 48960310.59471139, 140253389.37475517, 48960279.40259944, 140253392.05338845, 48960282.37327677, 0, 0, 0, 0, 0 },
-  { 140253369.1256208, 48960300.35405197, 140253342.3931336, 48960270.59881498, 140253395.858108, 48960330.10928896, 140253367.78899646, 48960298.86629012, 140253370.46224517, 48960301.84181382, 0, 0, 0, 0, 0 },
-  { 140253347.5011034, 48960319.78179624, 140253320.81510067, 48960289.98486254, 140253374.18710613, 48960349.578729935, 140253346.16680327, 48960318.291949555, 140253348.83540353, 48960321.27164292, 1, 4, 140253559.65482518, 48960556.66741912, 25 },
-  { 140253325.8458094, 48960339.176182285, 140253299.19890195, 48960309.34428119, 140253352.49271685, 48960369.00808338, 140253324.51346403, 48960337.68458723, 140253327.17815477, 48960340.66777734, 1, 5, 140253154.63942897, 48960147.50621775, 41 },
-  { 140253304.16502842, 48960358.54222143, 140253277.54980296, 48960328.682051085, 140253330.7802539, 48960388.40239177, 140253302.83426714, 48960357.04921291, 140253305.4957897, 48960360.03522994, 0, 0, 0, 0, 0 },
-  { 140253282.46405035, 48960377.88492503, 140253255.87307405, 48960348.003158346, 140253309.05502665, 48960407.766691715, 140253281.13450155, 48960376.39083669, 140253283.79359916, 48960379.37901337, 0, 0, 0, 0, 0 },
-  { 140253260.74816486, 48960397.209304415, 140253234.17398944, 48960367.312595546, 140253287.32234028, 48960427.10601328, 140253259.4194561, 48960395.71446897, 140253262.07687363, 48960398.70413986, 0, 0, 0, 0, 0 },
-  { 140253239.02266166, 48960416.520370916, 140253212.45782727, 48960386.61536172, 140253265.58749604, 48960446.42538011, 140253237.69441995, 48960415.02512046, 140253240.35090336, 48960418.01562137, 1, 4, 140253067.0153591, 48960222.8854364, 50 },
-  { 140253217.2928306, 48960435.82313587, 140253190.72987014, 48960405.91646216, 140253243.85579103, 48960465.729809575, 140253215.96468258, 48960434.32780218, 140253218.6209786, 48960437.318469554, 1, 3, 140253455.03132656, 48960703.48786557, 44 },
-  { 140253195.56396133, 48960455.122610636, 140253168.99540433, 48960425.22090869, 140253222.13251832, 48960485.024312586, 140253194.23553348, 48960453.62752554, 140253196.89238918, 48960456.617695734, 0, 0, 0, 0, 0 },
-  { 140253173.84134358, 48960474.42380655, 140253147.25972015, 48960444.53371964, 140253200.42296702, 48960504.31389346, 140253172.5122624, 48960472.9293022, 140253175.17042476, 48960475.918310896, 0, 0, 0, 0, 0 },
-  { 140253152.13026717, 48960493.73173493, 140253125.52811208, 48960463.85991971, 140253178.73242226, 48960523.60355015, 140253150.80015942, 48960492.23814417, 140253153.46037492, 48960495.225325696, 0, 0, 0, 0, 0 },
-  { 140253130.43602186, 48960513.051407136, 140253103.80587873, 48960483.20454002, 140253157.066165, 48960542.89827425, 140253129.10451472, 48960511.55906378, 140253131.767529, 48960514.543750495, 1, 1, 140253363.4497743, 48960774.2114944, 47 },
-  { 140253108.76389733, 48960532.38783451, 140253082.09832263, 48960502.572618164, 140253135.42947203, 48960562.20305086, 140253107.43061858, 48960530.89707369, 140253110.09717607, 48960533.87859533, 0, 0, 0, 0, 0 },
-  { 140253087.11918333, 48960551.74602837, 140253060.41075063, 48960521.969198085, 140253113.82761604, 48960581.52285866, 140253085.7837617, 48960550.25718686, 140253088.45460495, 48960553.23486988, 0, 0, 0, 0, 0 },
-  { 140253065.50716966, 48960571.13100009, 140253038.74847415, 48960541.39932987, 140253092.26586518, 48960600.8626703, 140253064.1692349, 48960569.64441658, 140253066.84510443, 48960572.617583595, 1, 3, 140252983.8931483, 48960480.44940593, 26 },
-  { 140253043.93314597, 48960590.54776097, 140253017.11680868, 48960560.86807002, 140253070.74948326, 48960620.22745192, 140253042.5923291, 48960589.063776426, 140253045.27396283, 48960592.031745516, 0, 0, 0, 0, 0 },
-  { 140253022.40240207, 48960610.001322374, 140252995.5210748, 48960580.38048098, 140253049.28372934, 48960639.622163765, 140253021.05833572, 48960608.5202803, 140253023.74646842, 48960611.482364446, 0, 0, 0, 0, 0 },
-  { 140253000.9202277, 48960629.496695645, 140252973.9665977, 48960599.941631265, 140253027.8738577, 48960659.051760025, 140252999.5725462, 48960628.01894242, 140253002.2679092, 48960630.97444887, 1, 5, 140253120.86388114, 48960761.016732134, 27 },
-  { 140252979.49191266, 48960649.03889212, 140252952.45870787, 48960619.55659509, 140253006.52511746, 48960678.52118915, 140252978.1402524, 48960647.56477727, 140252980.8435729, 48960650.51300697, 0, 0, 0, 0, 0 },
-  { 140252958.12274662, 48960668.63292312, 140252931.0027407, 48960639.23045248, 140252985.24275252, 48960698.03539376, 140252956.7667463, 48960667.16279959, 140252959.47874692, 48960670.10304665, 0, 0, 0, 0, 0 },
-  { 140252936.8180193, 48960688.2838, 140252909.60403734, 48960658.96828899, 140252964.03200126, 48960717.59931101, 140252935.4573202, 48960686.81802445, 140252938.1787184, 48960689.74957555, 0, 0, 0, 0, 0 },
-  { 140252915.58302054, 48960707.99653409, 140252888.26794484, 48960678.77519532, 140252942.89809623, 48960737.21787285, 140252914.21726674, 48960706.53546715, 140252916.94877434, 48960709.457601026, 0, 0, 0, 0, 0 },
-  { 140252894.42304, 48960727.776136756, 140252866.99981615, 48960698.65626737, 140252921.84626386, 48960756.896006145, 140252893.0518788, 48960726.32014329, 140252895.7942012, 48960729.23213022, 0, 0, 0, 0, 0 },
-  { 140252873.34336746, 48960747.627619304, 140252845.80501068, 48960718.616605766, 140252900.88172424, 48960776.63863284, 140252871.96644962, 48960746.17706863, 140252874.7202853, 48960749.07816998, 0, 0, 0, 0, 0 },
-  { 140252852.34929267, 48960767.55599309, 140252824.68889466, 48960738.66131567, 140252880.00969067, 48960796.4506705, 140252850.96627277, 48960766.111259215, 140252853.73231256, 48960769.00072696, 1, 3, 140252771.44262853, 48960683.03906166, 39 },
-  { 140252831.44610536, 48960787.56626944, 140252803.65684128, 48960758.79550647, 140252859.23536944, 48960816.337032415, 140252830.05664214, 48960786.12773129, 140252832.83556858, 48960789.00480759, 1, 2, 140253003.04481107, 48960965.22573078, 50 },
-  { 140252810.63909528, 48960807.663459726, 140252782.7142311, 48960779.02429142, 140252838.56395945, 48960836.30262803, 140252809.24285206, 48960806.23150131, 140252812.0353385, 48960809.09541814, 1, 2, 140252694.750909, 48960688.810911246, 40 },
-  { 140252789.9335522, 48960827.85257526, 140252761.86645266, 48960799.35278714, 140252818.00065175, 48960856.35236338, 140252788.53019723, 48960826.427585855, 140252791.33690718, 48960829.27756466, 1, 2, 140252905.00866038, 48960944.70170654, 50 },
-  { 140252769.33476585, 48960848.13862738, 140252741.1189024, 48960819.7861134, 140252797.55062932, 48960876.491141364, 140252767.92397267, 48960846.72100168, 140252770.74555904, 48960849.55625308, 0, 0, 0, 0, 0 },
-  { 140252748.84802592, 48960868.52662744, 140252720.4769852, 48960840.32939268, 140252777.21906665, 48960896.72386219, 140252747.42947388, 48960867.1167657, 140252750.26657796, 48960869.93648917, 0, 0, 0, 0, 0 },
-  { 140252728.4786223, 48960889.02158678, 140252699.94611534, 48960860.98774925, 140252757.01112923, 48960917.05542432, 140252727.05199695, 48960887.61989491, 140252729.90524763, 48960890.42327866, 1, 4, 140252511.63156945, 48960675.96442152, 41 },
-  { 140252708.23184457, 48960909.62851672, 140252679.53171572, 48960881.76630927, 140252736.93197343, 48960937.49072417, 140252706.79683813, 48960908.23540635, 140252709.666851, 48960911.02162709, 0, 0, 0, 0, 0 },
-  { 140252688.11298254, 48960930.35242862, 140252659.23921925, 48960902.67019979, 140252716.98674583, 48960958.034657456, 140252686.6692944, 48960928.96831718, 140252689.5566707, 48960931.736540064, 0, 0, 0, 0, 0 },
-  { 140252668.12732595, 48960951.19833381, 140252639.07406867, 48960923.70454831, 140252697.18058324, 48960978.69211931, 140252666.6746631, 48960949.823644534, 140252669.5799888, 48960952.57302308, 1, 3, 140252833.00456104, 48961107.225566536, 38 },
-  { 140252648.28016463, 48960972.17124364, 140252619.0417174, 48960944.87448185, 140252677.51861185, 48960999.468005426, 140252646.81824228, 48960970.80640555, 140252649.74208698, 48960973.536081724, 0, 0, 0, 0, 0 },
-  { 140252628.5767882, 48960993.276169434, 140252599.14762905, 48960966.185126774, 140252658.00594732, 48961020.367212094, 140252627.10533023, 48960991.9216173, 140252630.04824615, 48960994.63072157, 1, 2, 140252838.99527603, 48961186.977124445, 35 },
-  { 140252609.02248645, 48961014.51812254, 140252579.3972786, 48960987.641607516, 140252638.6476943, 48961041.39463756, 140252607.54122606, 48961013.17429679, 140252610.50374684, 48961015.86194829, 1, 4, 140252463.85896796, 48960882.823198944, 38 },
-  { 140252589.62254912, 48961035.9021143, 140252559.79615209, 48961009.24904617, 140252619.44894615, 48961062.555182435, 140252588.13122925, 48961034.5694609, 140252591.11386898, 48961037.234767705, 0, 0, 0, 0, 0 },
-  { 140252570.382266, 48961057.43315604, 140252540.34974742, 48961031.01256128, 140252600.4147846, 48961083.85375081, 140252568.8806401, 48961056.112126306, 140252571.88389194, 48961058.75418578, 0, 0, 0, 0, 0 },
-  { 140252551.3069268, 48961079.11625913, 140252521.06357387, 48961052.937267475, 140252581.5502797, 48961105.29525078, 140252549.79475915, 48961077.807309546, 140252552.81909442, 48961080.42520871, 0, 0, 0, 0, 0 },
-  { 140252532.40182126, 48961100.956434876, 140252501.9436463, 48961075.02769447, 140252562.8599962, 48961126.88517528, 140252530.8789125, 48961099.65999786, 140252533.92473, 48961102.25287189, 1, 4, 140252246.85643113, 48960857.8744936, 36 },
-  { 140252513.67180488, 48961122.95835656, 140252483.0113971, 48961097.269070946, 140252544.33221266, 48961148.64764217, 140252512.1387845, 48961121.67389228, 140252515.20482525, 48961124.24282084, 1, 5, 140252621.74974227, 48961213.513088346, 26 },
-  { 140252495.10720342, 48961145.115385726, 140252464.2765626, 48961119.63065332, 140252525.93784425, 48961170.60011813, 140252493.56567138, 48961143.84114911, 140252496.64873546, 48961146.389622346, 0, 0, 0, 0, 0 },
-  { 140252476.68072557, 48961167.40716856, 140252445.7123072, 48961142.09003872, 140252507.64914393, 48961192.7242984, 140252475.13230467, 48961166.14131207, 140252478.22914648, 48961168.67302505, 0, 0, 0, 0, 0 },
-  { 140252458.36402112, 48961189.81252692, 140252427.2896412, 48961164.62556773, 140252489.43840104, 48961214.99948611, 140252456.81030214, 48961188.55317896, 140252459.9177401, 48961191.07187488, 0, 0, 0, 0, 0 },
-  { 140252440.1287399, 48961212.31028269, 140252408.97969282, 48961187.215724185, 140252471.27778697, 48961237.4048412, 140252438.57128754, 48961211.05555477, 140252441.68619224, 48961213.565010615, 1, 2, 140252736.04468706, 48961450.70858852, 41 },
-  { 140252421.94653156, 48961234.87925767, 140252390.75371438, 48961209.83912675, 140252453.13934875, 48961259.91938859, 140252420.3868907, 48961233.627251126, 140252423.50617242, 48961236.13126422, 1, 0, 140252185.66094142, 48961045.200265974, 33 },
-  { 140252403.7890461, 48961257.49827377, 140252372.5830883, 48961232.47452111, 140252434.9950039, 48961282.52202643, 140252402.22874823, 48961256.24708614, 140252405.349344, 48961258.7494614, 0, 0, 0, 0, 0 },
-  { 140252385.6279332, 48961280.1461528, 140252354.43932763, 48961255.10077635, 140252416.81653878, 48961305.19152925, 140252384.06850293, 48961278.89388398, 140252387.18736348, 48961281.39842162, 1, 5, 140252097.91304663, 48961049.10255508, 27 },
-  { 140252367.43484268, 48961302.80171664, 140252336.29149148, 48961277.70008967, 140252398.57819387, 48961327.90334361, 140252365.87767512, 48961301.54663529, 140252368.99201024, 48961304.05679799, 0, 0, 0, 0, 0 },
-  { 140252349.18396536, 48961325.44540753, 140252317.96264747, 48961300.440821774, 140252380.40528324, 48961350.44999329, 140252347.62289947, 48961324.19517825, 140252350.74503124, 48961326.69563682, 1, 1, 140252201.6632383, 48961207.298739836, 34 },
-  { 140252330.99824545, 48961348.152528055, 140252299.3488201, 48961323.69207275, 140252362.6476708, 48961372.61298336, 140252329.41577417, 48961346.92950529, 140252332.58071673, 48961349.37555082, 1, 2, 140252606.34824616, 48961560.958489224, 34 },
-  { 140252313.22908852, 48961371.1440709, 140252280.803763, 48961347.72189627, 140252345.65441403, 48961394.56624553, 140252311.60782224, 48961369.97296217, 140252314.8503548, 48961372.31517963, 1, 4, 140252164.0725911, 48961263.40206758, 34 },
-  { 140252296.24730858, 48961394.65340558, 140252262.74384922, 48961372.80121549, 140252329.75076795, 48961416.50559566, 140252294.57213563, 48961393.560796075, 140252297.92248154, 48961395.74601508, 0, 0, 0, 0, 0 },
-  { 140252280.4237196, 48961418.91390156, 140252245.61636934, 48961399.204808064, 140252315.2310699, 48961438.622995056, 140252278.6833521, 48961417.92844689, 140252282.16408712, 48961419.89935623, 1, 5, 140252158.5979936, 48961349.93207433, 48 },
-  { 140252266.12913558, 48961444.15892837, 140252229.9339521, 48961427.1322231, 140252302.32431906, 48961461.185633644, 140252264.3193764, 48961443.30759311, 140252267.93889475, 48961445.01026364, 1, 4, 140252600.02970326, 48961601.23028449, 46 },
-  { 140252253.7123111, 48961470.55447781, 140252216.2696, 48961456.48168895, 140252291.15502217, 48961484.627266675, 140252251.84017554, 48961469.85083837, 140252255.58444664, 48961471.25811725, 0, 0, 0, 0, 0 },
-  { 140252243.41714472, 48961497.94627227, 140252204.9278094, 48961487.0572381, 140252281.90648004, 48961508.835306436, 140252241.49267796, 48961497.40182056, 140252245.34161147, 48961498.490723975, 1, 2, 140252352.14951706, 48961528.70779378, 33 },
-  { 140252235.45641258, 48961526.08497438, 140252196.1525644, 48961518.654798225, 140252274.76026076, 48961533.51515053, 140252233.49122018, 48961525.71346557, 140252237.421605, 48961526.456483185, 0, 0, 0, 0, 0 },
-  { 140252230.04288578, 48961554.72123161, 140252190.21070656, 48961551.06097228, 140252269.875065, 48961558.38149094, 140252228.05127683, 48961554.53821864, 140252232.03449473, 48961554.90424458, 0, 0, 0, 0, 0 },
-  { 140252227.38861707, 48961583.60588093, 140252187.3890124, 48961583.78372034, 140252267.38822174, 48961583.428041525, 140252225.38863683, 48961583.6147729, 140252229.3885973, 48961583.59698896, 0, 0, 0, 0, 0 },
-  { 140252227.51725662, 48961612.53946314, 140252187.66556907, 48961615.9808292, 140252267.36894417, 48961609.09809708, 140252225.52467224, 48961612.711531445, 140252229.509841, 48961612.367394835, 0, 0, 0, 0, 0 },
-  { 140252230.01281413, 48961641.438504, 140252190.4683988, 48961647.45840568, 140252269.55722946, 48961635.418602325, 140252228.03559336, 48961641.739499085, 140252231.9900349, 48961641.13750892, 1, 5, 140252067.8807113, 48961666.12010087, 47 },
-  { 140252234.39670378, 48961670.23604294, 140252195.19143903, 48961678.169971064, 140252273.60196853, 48961662.302114815, 140252232.43644053, 48961670.63273934, 140252236.35696703, 48961669.839346536, 1, 1, 140252345.1515767, 48961647.822695985, 40 },
-  { 140252240.19033983, 48961698.86511946, 140252201.2720413, 48961708.104493864, 140252279.10863838, 48961689.62574505, 140252238.2444249, 48961699.32708818, 140252242.13625476, 48961698.40315074, 1, 4, 140252045.59884718, 48961745.06199148, 29 },
-  { 140252246.93189517, 48961727.26204889, 140252208.2677362, 48961737.51303963, 140252285.59605414, 48961717.01105815, 140252244.9986872, 48961727.77459843, 140252248.86510313, 48961726.74949936, 1, 5, 140252500.18213642, 48961660.11805952, 25 },
-  { 140252254.39448807, 48961755.40907247, 140252215.99023828, 48961766.59449153, 140252292.79873785, 48961744.22365342, 140252252.4742756, 48961755.96834343, 140252256.31470054, 48961754.84980152, 0, 0, 0, 0, 0 },
-  { 140252262.52433813, 48961783.3222683, 140252224.38149604, 48961795.36899388, 140252300.6671802, 48961771.27554272, 140252260.61719602, 48961783.92460458, 140252264.43148023, 48961782.71993202, 0, 0, 0, 0, 0 },
-  { 140252271.2716916, 48961811.01850158, 140252233.38670233, 48961823.85312616, 140252309.15668085, 48961798.183877, 140252269.37744212, 48961811.66023281, 140252273.16594106, 48961810.37677035, 0, 0, 0, 0, 0 },
-  { 140252280.58679473, 48961838.51463755, 140252242.95149747, 48961852.0639696, 140252318.222092, 48961824.96530551, 140252278.70502988, 48961839.19210415, 140252282.4685596, 48961837.83717095, 0, 0, 0, 0, 0 },
-  { 140252290.4198937, 48961865.827541396, 140252253.02199337, 48961880.0189842, 140252327.81779405, 48961851.63609859, 140252288.5499987, 48961866.53711354, 140252292.28978872, 48961865.11796925, 1, 1, 140252180.09608766, 48961907.69229767, 38 },
-  { 140252300.72123477, 48961892.97407834, 140252263.54477984, 48961907.73589389, 140252337.8976897, 48961878.212262794, 140252298.86241204, 48961893.71216912, 140252302.5800575, 48961892.23598757, 1, 0, 140252581.40346956, 48961781.52237096, 34 },
-  { 140252311.44106418, 48961919.971113615, 140252274.46691704, 48961935.23258287, 140252348.41521132, 48961904.70964436, 140252309.59235683, 48961920.734187074, 140252313.28977153, 48961919.208040155, 0, 0, 0, 0, 0 },
-  { 140252322.52962816, 48961946.83551241, 140252285.73591858, 48961962.52700486, 140252359.32333773, 48961931.144019954, 140252320.6899427, 48961947.62008703, 140252324.36931363, 48961946.05093779, 0, 0, 0, 0, 0 },
-  { 140252333.93717286, 48961973.58413993, 140252297.29972908, 48961989.63710579, 140252370.57461664, 48961957.53117406, 140252332.10530066, 48961974.38678822, 140252335.76904505, 48961972.78149164, 1, 3, 140252124.1878072, 48962065.48736949, 25 },
-  { 140252345.61394462, 48962000.233861394, 140252309.10669926, 48962016.580758214, 140252382.12118998, 48961983.886964574, 140252343.78858235, 48962001.05120624, 140252347.43930689, 48961999.41651655, 0, 0, 0, 0, 0 },
-  { 140252357.5101896, 48962026.80154203, 140252321.1055611, 48962043.37570942, 140252393.91481808, 48962010.227374636, 140252355.68995816, 48962027.6302504, 140252359.33042103, 48962025.972833656, 1, 5, 140252181.85785714, 48962106.77189969, 50 },
-  { 140252369.57615408, 48962053.304047056, 140252333.24540538, 48962070.039539255, 140252405.9069028, 48962036.568554856, 140252367.75961664, 48962054.140821666, 140252371.39269152, 48962052.467272446, 0, 0, 0, 0, 0 },
-  { 140252381.76208428, 48962079.75824166, 140252345.4756627, 48962096.58962928, 140252418.04850584, 48962062.926854044, 140252379.9477632, 48962080.59981104, 140252383.57640535, 48962078.91667228, 0, 0, 0, 0, 0 },
-  { 140252394.01822633, 48962106.180991076, 140252357.7460898, 48962123.04314134, 140252430.29036286, 48962089.31884081, 140252392.2046195, 48962107.02409859, 140252395.83183315, 48962105.33788356, 0, 0, 0, 0, 0 },
-  { 140252406.2948266, 48962132.58916051, 140252370.0067612, 48962149.4170038, 140252442.582892, 48962115.761317216, 140252404.48042333, 48962133.43055268, 140252408.10922986, 48962131.74776834, 1, 5, 140252043.41417265, 48962300.86759341, 50 },
-  { 140252418.54213125, 48962158.999615155, 140252382.208067, 48962175.727907844, 140252454.8761955, 48962142.27132247, 140252416.72542804, 48962159.83602979, 140252420.35883445, 48962158.16320052, 0, 0, 0, 0, 0 },
-  { 140252430.71038654, 48962185.429220244, 140252394.30071706, 48962201.99231076, 140252467.12005603, 48962168.866129726, 140252428.88990307, 48962186.25737477, 140252432.53087002, 48962184.60106572, 1, 5, 140252097.5619107, 48962336.98149847, 41 },
-  { 140252442.74983865, 48962211.89484099, 140252406.23575112, 48962228.22644874, 140252479.26392618, 48962195.56323325, 140252440.92413428, 48962212.71142138, 140252444.57554302, 48962211.07826061, 0, 0, 0, 0, 0 },
-  { 140252454.61073387, 48962238.413342595, 140252417.96455494, 48962254.44635761, 140252491.2569128, 48962222.38032758, 140252452.77842492, 48962239.21499334, 140252456.4430428, 48962237.61169185, 1, 5, 140252240.23058718, 48962332.20648042, 35 },
-  { 140252466.2433184, 48962265.00159029, 140252429.43888116, 48962280.66790441, 140252503.04775566, 48962249.33527617, 140252464.40309656, 48962265.78490599, 140252468.08354026, 48962264.218274586, 0, 0, 0, 0, 0 },
-  { 140252477.59783843, 48962291.67644927, 140252440.6108742, 48962306.90682932, 140252514.58480266, 48962276.44606922, 140252475.7484902, 48962292.43796827, 140252479.44718665, 48962290.91493027, 0, 0, 0, 0, 0 },
-  { 140252488.62454027, 48962318.45478475, 140252451.43309757, 48962333.17879881, 140252525.81598297, 48962303.73077069, 140252486.76496813, 48962319.190985456, 140252490.4841124, 48962317.718584046, 1, 3, 140252593.6903659, 48962276.85944504, 50 },
-  { 140252499.27367008, 48962345.35346194, 140252461.8585612, 48962359.499472894, 140252536.68877897, 48962331.20745099, 140252497.40291464, 48962346.06076249, 140252501.1444255, 48962344.6461614, 1, 5, 140252135.41173598, 48962482.9234184, 46 },
-  { 140252509.49547416, 48962372.38934608, 140252471.84074628, 48962385.88458481, 140252547.15020204, 48962358.89410735, 140252507.61273777, 48962373.064108014, 140252511.37821054, 48962371.71458414, 0, 0, 0, 0, 0 },
-  { 140252519.2401987, 48962399.57930235, 140252481.33362448, 48962412.35003569, 140252557.14677292, 48962386.80856901, 140252517.34487, 48962400.21783902, 140252521.1355274, 48962398.94076568, 0, 0, 0, 0, 0 },
-  { 140252528.4580899, 48962426.940195985, 140252490.2916669, 48962438.91200272, 140252566.62451288, 48962414.96838925, 140252526.54976875, 48962427.53878632, 140252530.36641103, 48962426.34160565, 0, 0, 0, 0, 0 },
-  { 140252537.09939396, 48962454.48889216, 140252498.6698391, 48962465.58705929, 140252575.5289488, 48962443.39072503, 140252535.17791623, 48962455.04380052, 140252539.0208717, 48962453.9339838, 0, 0, 0, 0, 0 },
-  { 140252545.11435726, 48962482.24225614, 140252506.42357647, 48962492.39230454, 140252583.80513805, 48962472.092207745, 140252543.1798182, 48962482.749758564, 140252547.0488963, 48962481.73475372, 0, 0, 0, 0, 0 },
-  { 140252552.4532259, 48962510.2171531, 140252513.5097986, 48962519.35003151, 140252591.39665323, 48962501.084274694, 140252550.50605455, 48962510.67379702, 140252554.40039727, 48962509.760509185, 0, 0, 0, 0, 0 },
-  { 140252559.0683728, 48962538.424743325, 140252519.89291927, 48962546.50458508, 140252598.2438263, 48962530.34490157, 140252557.1096001, 48962538.82873541, 140252561.02714548, 48962538.02075124, 0, 0, 0, 0, 0 },
-  { 140252564.9277781, 48962566.834317066, 140252525.5454853, 48962573.83681761, 140252604.3100709, 48962559.831816524, 140252562.95866346, 48962567.184442095, 140252566.89689273, 48962566.484192036, 1, 5, 140252328.6340213, 48962608.84932034, 30 },
-  { 140252570.00637498, 48962595.39651259, 140252530.44346052, 48962601.293613486, 140252609.56928945, 48962589.499411695, 140252568.02822927, 48962595.69136763, 140252571.9845207, 48962595.10165755, 0, 0, 0, 0, 0 },
-  { 140252574.27912843, 48962624.061882585, 140252534.56414986, 48962628.82848274, 140252613.994107, 48962619.29528243, 140252572.29337952, 48962624.30021259, 140252576.26487735, 48962623.82355258, 0, 0, 0, 0, 0 },
-  { 140252577.7263718, 48962652.78407279, 140252537.8952701, 48962656.45603951, 140252617.55747348, 48962649.11210606, 140252575.7348167, 48962652.967671126, 140252579.7179269, 48962652.60047445, 1, 4, 140252888.40896484, 48962624.14273235, 35 },
-  { 140252580.37781274, 48962681.54517602, 140252540.4656819, 48962684.19504633, 140252620.28994358, 48962678.895305716, 140252578.3822062, 48962681.67766954, 140252582.37341928, 48962681.4126825, 0, 0, 0, 0, 0 },
-  { 140252582.28974906, 48962710.34260514, 140252542.32604048, 48962712.04612982, 140252622.25345764, 48962708.63908045, 140252580.29156363, 48962710.42778137, 140252584.28793448, 48962710.2574289, 1, 1, 140252704.17906022, 48962705.14685484, 33 },
-  { 140252583.51873556, 48962739.17392105, 140252543.52745038, 48962740.008851886, 140252623.51002073, 48962738.33899021, 140252581.5191713, 48962739.21566759, 140252585.51829982, 48962739.13217451, 0, 0, 0, 0, 0 },
-  { 140252584.12132713, 48962768.03668477, 140252544.12135282, 48962768.08202857, 140252624.12130144, 48962767.991340965, 140252582.1213284, 48962768.038951956, 140252586.12132585, 48962768.03441758, 0, 0, 0, 0, 0 },
-  { 140252584.15407872, 48962796.928457245, 140252544.15960002, 48962796.26387253, 140252624.14855742, 48962797.593041964, 140252582.15435478, 48962796.895228006, 140252586.15380266, 48962796.961686485, 0, 0, 0, 0, 0 },
-  { 140252583.67354518, 48962825.846799485, 140252543.69450274, 48962824.55213096, 140252623.65258762, 48962827.14146801, 140252581.67459306, 48962825.78206606, 140252585.6724973, 48962825.91153291, 0, 0, 0, 0, 0 },
-  { 140252582.7362814, 48962854.78927241, 140252542.77885714, 48962852.94421235, 140252622.69370565, 48962856.63433248, 140252580.73841017, 48962854.697019406, 140252584.73415262, 48962854.88152542, 1, 4, 140252379.9523533, 48962845.42559257, 33 },
-  { 140252581.39884225, 48962883.75343703, 140252541.4659547, 48962881.43730003, 140252621.3317298, 48962886.06957403, 140252579.40219787, 48962883.63763018, 140252583.39548662, 48962883.869243875, 0, 0, 0, 0, 0 },
-  { 140252579.71778262, 48962912.736854285, 140252539.8095811, 48962910.02845048, 140252619.62598413, 48962915.44525809, 140252577.72237253, 48962912.6014341, 140252581.7131927, 48962912.87227447, 1, 3, 140252258.45676035, 48962890.934203655, 46 },
-  { 140252577.74965745, 48962941.73708518, 140252537.8640079, 48962938.71467561, 140252617.635307, 48962944.759494744, 140252575.75537497, 48962941.5859647, 140252579.74393994, 48962941.888205655, 0, 0, 0, 0, 0 },
-  { 140252575.55102155, 48962970.751690656, 140252535.68398, 48962967.4930105, 140252615.4180631, 48962974.01037081, 140252573.55766946, 48962970.58875665, 140252577.54437363, 48962970.91462466, 0, 0, 0, 0, 0 },
-  { 140252573.1784298, 48962999.77823167, 140252533.3247028, 48962996.36056533, 140252613.03215683, 48963003.19589802, 140252571.18574345, 48962999.60734835, 140252575.17111617, 48962999.94911499, 0, 0, 0, 0, 0 },
-  { 140252570.68843713, 48963028.81426923, 140252530.84183043, 48963025.31456417, 140252610.53504384, 48963032.31397429, 140252568.6961068, 48963028.63928398, 140252572.68076748, 48963028.98925448, 0, 0, 0, 0, 0 },
-  { 140252568.13759843, 48963057.85736429, 140252528.29145664, 48963054.35237008, 140252607.9837402, 48963061.362358496, 140252566.14529133, 48963057.68211458, 140252570.12990552, 48963058.032614, 0, 0, 0, 0, 0 },
-  { 140252565.58246854, 48963086.90507782, 140252525.73010936, 48963083.47149819, 140252605.43482772, 48963090.33865745, 140252563.58985057, 48963086.73339884, 140252567.5750865, 48963087.076756805, 0, 0, 0, 0, 0 },
-  { 140252563.0796024, 48963115.95497079, 140252523.21475017, 48963112.669615924, 140252602.9444546, 48963119.24032566, 140252561.08635977, 48963115.79070305, 140252565.072845, 48963116.11923853, 0, 0, 0, 0, 0 },
-  { 140252560.68555477, 48963145.00460417, 140252520.80277705, 48963141.9445322, 140252600.5683325, 48963148.064676136, 140252558.69141588, 48963144.85160057, 140252562.67969367, 48963145.157607764, 1, 1, 140252322.38595784, 48963126.720674165, 37 },
-  { 140252558.45688075, 48963174.051538914, 140252518.5520323, 48963171.2941723, 140252598.3617292, 48963176.80890553, 140252556.46163833, 48963173.913670585, 140252560.45212317, 48963174.189407244, 0, 0, 0, 0, 0 },
-  { 140252556.45013508, 48963203.09333603, 140252516.52081186, 48963200.716542445, 140252596.3794583, 48963205.47012962, 140252554.45366892, 48963202.97449635, 140252558.44660124, 48963203.21217571, 1, 4, 140252435.66393235, 48963195.903535426, 49 },
-  { 140252554.72187266, 48963232.127556466, 140252514.76791376, 48963230.20891963, 140252594.67583156, 48963234.0461933, 140252552.7241747, 48963232.03162462, 140252556.7195706, 48963232.22348831, 0, 0, 0, 0, 0 },
-  { 140252553.3280952, 48963261.15177109, 140252513.35313118, 48963259.736762166, 140252593.30305922, 48963262.566780016, 140252551.32934698, 48963261.081020646, 140252555.3268434, 48963261.222521536, 0, 0, 0, 0, 0 },
-  { 140252552.30113924, 48963290.163975105, 140252512.31149054, 48963289.25403167, 140252592.29078794, 48963291.07391854, 140252550.3016568, 48963290.11847793, 140252554.30062166, 48963290.209472276, 0, 0, 0, 0, 0 },
-  { 140252551.64128762, 48963319.16273831, 140252511.64335573, 48963318.75599084, 140252591.63921952, 48963319.569485776, 140252549.64139104, 48963319.142400935, 140252553.6411842, 48963319.18307568, 0, 0, 0, 0, 0 },
-  { 140252551.34654385, 48963348.14667144, 140252511.34665525, 48963348.241076045, 140252591.34643245, 48963348.05226683, 140252549.34654942, 48963348.15139167, 140252553.34653828, 48963348.1419512, 1, 1, 140252809.34582528, 48963347.53776171, 46 },
-  { 140252551.41491118, 48963377.11438515, 140252511.41931215, 48963377.70772969, 140252591.4105102, 48963376.52104061, 140252549.41513124, 48963377.14405238, 140252553.41469112, 48963377.08471792, 1, 0, 140252264.44648808, 48963381.37163224, 32 },
-  { 140252551.8443931, 48963406.064490184, 140252511.85924464, 48963407.154399626, 140252591.82954156, 48963404.97458074, 140252549.8451357, 48963406.11898565, 140252553.84365052, 48963406.009994715, 1, 0, 140252736.77570474, 48963401.023659006, 48 },
-  { 140252552.63299307, 48963434.99559722, 140252512.66436628, 48963436.57953937, 140252592.60161987, 48963433.41165507, 140252550.63456175, 48963435.07479433, 140252554.6314244, 48963434.91640011, 0, 0, 0, 0, 0 },
-  { 140252553.7787144, 48963463.90631697, 140252513.83258614, 48963465.98160902, 140252593.72484264, 48963461.83102493, 140252551.78140798, 48963464.010081574, 140252555.7760208, 48963463.80255237, 1, 0, 140252723.54975948, 48963455.08632579, 35 },
-  { 140252555.27956057, 48963492.795260124, 140252515.3618094, 48963495.35907426, 140252595.19731173, 48963490.23144599, 140252553.28367302, 48963492.92345083, 140252557.2754481, 48963492.66706942, 0, 0, 0, 0, 0 },
-  { 140252557.13353494, 48963521.661037385, 140252517.24993753, 48963524.7104075, 140252597.01713234, 48963518.61166727, 140252555.13935506, 48963521.81350589, 140252559.1277148, 48963521.50856888, 0, 0, 0, 0, 0 },
-  { 140252559.33864096, 48963550.50225945, 140252519.49486867, 48963554.03408736, 140252599.18241325, 48963546.97043154, 140252557.34645236, 48963550.678850845, 140252561.33082956, 48963550.32566805, 0, 0, 0, 0, 0 },
-  { 140252561.89288208, 48963579.31753704, 140252522.0944979, 48963583.32859868, 140252601.69126627, 48963575.3064754, 140252559.90296286, 48963579.51809012, 140252563.8828013, 48963579.11698396, 0, 0, 0, 0, 0 },
-  { 140252564.7942616, 48963608.10548083, 140252525.04671755, 48963612.59243318, 140252604.54180565, 48963603.61852848, 140252562.8068844, 48963608.32982845, 140252566.7816388, 48963607.881133206, 1, 4, 140252199.11685628, 48963649.385442466, 48 },
-  { 140252568.04078302, 48963636.86470152, 140252528.34941772, 48963641.82408868, 140252607.73214832, 48963631.905314356, 140252566.05621475, 48963637.112670876, 140252570.0253513, 48963636.61673216, 0, 0, 0, 0, 0 },
-  { 140252571.63044968, 48963665.59380981, 140252532.00048634, 48963671.02206981, 140252611.26041302, 48963660.165549815, 140252569.64895153, 48963665.86522281, 140252573.61194783, 48963665.322396815, 0, 0, 0, 0, 0 },
-  { 140252575.56126508, 48963694.29141644, 140252535.99780974, 48963700.18488742, 140252615.12472042, 48963688.397945456, 140252573.5830923, 48963694.58608998, 140252577.53943786, 48963693.99674289, 1, 1, 140252741.72777757, 48963669.538838334, 29 },
-  { 140252579.8312326, 48963722.95613206, 140252540.3392726, 48963729.31105877, 140252619.32319263, 48963716.60120536, 140252577.85663462, 48963723.273878396, 140252581.8058306, 48963722.63838573, 1, 2, 140252213.54330337, 48963781.898077235, 32 },
-  { 140252584.43835562, 48963751.586567394, 140252545.0227585, 48963758.399107635, 140252623.85395274, 48963744.774027154, 140252582.46757576, 48963751.92719441, 140252586.4091355, 48963751.24594038, 1, 4, 140252692.8312477, 48963732.85208173, 26 },
-  { 140252589.38063753, 48963780.18133313, 140252550.04615027, 48963787.4475641, 140252628.7151248, 48963772.91510216, 140252587.41391316, 48963780.54464468, 140252591.3473619, 48963779.81802158, 0, 0, 0, 0, 0 },
-  { 140252594.65608177, 48963808.73904, 140252555.40733007, 48963816.45496441, 140252633.90483347, 48963801.0231156, 140252592.69364417, 48963809.12483622, 140252596.61851937, 48963808.35324378, 0, 0, 0, 0, 0 },
-  { 140252600.26269177, 48963837.258298665, 140252561.1041797, 48963845.41985076, 140252639.42120382, 48963829.09674657, 140252598.30476615, 48963837.66637627, 140252602.22061738, 48963836.85022106, 0, 0, 0, 0, 0 },
-  { 140252606.19847092, 48963865.73771985, 140252567.13458094, 48963874.34077158, 140252645.2623609, 48963857.13466812, 140252604.24527642, 48963866.16787244, 140252608.15166542, 48963865.30756726, 0, 0, 0, 0, 0 },
-  { 140252612.46142265, 48963894.17591424, 140252573.49641567, 48963903.21628099, 140252651.42642963, 48963885.1355475, 140252610.5131723, 48963894.62793258, 140252614.409673, 48963893.72389591, 0, 0, 0, 0, 0 },
-  { 140252619.04955035, 48963922.571492545, 140252580.1875662, 48963932.04493893, 140252657.91153452, 48963913.09804616, 140252617.10645115, 48963923.04516486, 140252620.99264956, 48963922.09782023, 0, 0, 0, 0, 0 },
-  { 140252625.96085742, 48963950.923065454, 140252587.20591536, 48963960.825311005, 140252664.71579948, 48963941.0208199, 140252624.02311033, 48963951.41817773, 140252627.8986045, 48963950.427953176, 0, 0, 0, 0, 0 },
-  { 140252633.19334733, 48963979.22924368, 140252594.54934692, 48963989.55596789, 140252671.83734775, 48963968.90251947, 140252631.26114732, 48963979.74557989, 140252635.12554735, 48963978.71290747, 0, 0, 0, 0, 0 },
-  { 140252640.74502334, 48964007.48863792, 140252602.2157455, 48964018.235486284, 140252679.27430117, 48963996.74178955, 140252638.81855944, 48964008.02598034, 140252642.67148724, 48964006.951295495, 0, 0, 0, 0, 0 },
-  { 140252648.61388907, 48964035.69985887, 140252610.20299706, 48964046.86244708, 140252687.02478108, 48964024.53727065, 140252646.69334447, 48964036.257988274, 140252650.53443366, 48964035.14172946, 1, 4, 140252906.92713776, 48963960.63145311, 25 },
-  { 140252656.7979478, 48964063.861517236, 140252618.5089887, 48964075.435436726, 140252695.08690688, 48964052.287597746, 140252654.88349983, 48964064.44021321, 140252658.71239576, 48964063.28282126, 0, 0, 0, 0, 0 },
-  { 140252665.2952029, 48964091.972223714, 140252627.13160917, 48964103.95304638, 140252703.45879665, 48964079.99140105, 140252663.3870232, 48964092.57126485, 140252667.2033826, 48964091.37318258, 0, 0, 0, 0, 0 },
-  { 140252674.10365793, 48964120.030589014, 140252636.06874877, 48964132.41387154, 140252712.1385671, 48964107.64730649, 140252672.20191246, 48964120.64975314, 140252676.0054034, 48964119.41142489, 1, 3, 140252338.44558468, 48964229.313057296, 41 },
-  { 140252683.22131622, 48964148.035223804, 140252645.3182996, 48964160.816512145, 140252721.12433285, 48964135.253935464, 140252681.32616538, 48964148.67428822, 140252685.11646706, 48964147.39615939, 1, 5, 140252922.01032087, 48964067.51310727, 49 },
-  { 140252692.6461811, 48964175.98473883, 140252654.87815562, 48964189.15957279, 140252730.4142066, 48964162.809904866, 140252690.75777984, 48964176.643480524, 140252694.53458238, 48964175.32599713, 0, 0, 0, 0, 0 },
-  { 140252702.37625614, 48964203.877744764, 140252664.74621278, 48964217.44166151, 140252740.0062995, 48964190.31382802, 140252700.49475396, 48964204.5559406, 140252704.25775832, 48964203.19954893, 0, 0, 0, 0, 0 },
-  { 140252712.40954465, 48964231.71285232, 140252674.92036915, 48964245.66139061, 140252749.89872015, 48964217.76431403, 140252710.53508586, 48964232.41027924, 140252714.28400344, 48964231.01542541, 1, 3, 140252452.7970043, 48964328.30647996, 37 },
-  { 140252722.74405006, 48964259.4886722, 140252685.39852488, 48964273.81737585, 140252760.08957523, 48964245.15996854, 140252720.8767738, 48964260.205107376, 140252724.6113263, 48964258.77223702, 0, 0, 0, 0, 0 },
-  { 140252733.3777757, 48964287.20381506, 140252696.17858243, 48964301.90823685, 140252770.57696897, 48964272.49939327, 140252731.51781604, 48964287.939036146, 140252735.23773536, 48964286.46859397, 0, 0, 0, 0, 0 },
-  { 140252744.30872518, 48964314.85689167, 140252707.25844663, 48964329.932595976, 140252781.35900372, 48964299.78118736, 140252742.45621124, 48964315.610676885, 140252746.16123912, 48964314.103106454, 0, 0, 0, 0, 0 },
-  { 140252755.53490174, 48964342.44651269, 140252718.63602453, 48964357.88907923, 140252792.43377894, 48964327.003946155, 140252753.6899579, 48964343.21864102, 140252757.3798456, 48964341.67438436, 0, 0, 0, 0, 0 },
-  { 140252767.0543088, 48964369.97128881, 140252730.3092257, 48964385.77631548, 140252803.7993919, 48964354.166262135, 140252765.21705464, 48964370.761540145, 140252768.89156297, 48964369.18103747, 0, 0, 0, 0, 0 },
-  { 140252778.86494988, 48964397.42983076, 140252742.27596214, 48964413.59293614, 140252815.45393762, 48964381.266725376, 140252777.0355005, 48964398.23798603, 140252780.69439927, 48964396.62167549, 0, 0, 0, 0, 0 },
-  { 140252790.96482825, 48964424.820749216, 140252754.53414828, 48964441.3375757, 140252827.39550823, 48964408.303922735, 140252789.14329425, 48964425.64659054, 140252792.78636226, 48964423.99490789, 0, 0, 0, 0, 0 },
-  { 140252803.35194746, 48964452.1426549, 140252767.0817012, 48964469.00887069, 140252839.62219372, 48964435.276439115, 140252801.53843513, 48964452.98596569, 140252805.16545978, 48964451.299344115, 0, 0, 0, 0, 0 },
-  { 140252816.02431083, 48964479.394158505, 140252779.96380764, 48964496.70427434, 140252852.084814, 48964462.08404267, 140252814.22128567, 48964480.2596643, 140252817.82733598, 48964478.52865271, 0, 0, 0, 0, 0 },
-  { 140252829.03898993, 48964506.50639055, 140252794.2940497, 48964526.32529893, 140252863.78393015, 48964486.68748217, 140252827.3017429, 48964507.49733597, 140252830.77623695, 48964505.51544513, 0, 0, 0, 0, 0 },
-  { 140252843.62300137, 48964532.07392413, 140252813.3361582, 48964558.20258904, 140252873.90984455, 48964505.94525922, 140252842.1086592, 48964533.38035738, 140252845.13734353, 48964530.767490886, 0, 0, 0, 0, 0 },
-  { 140252862.07701018, 48964553.464748085, 140252840.32138175, 48964587.03099052, 140252883.83263862, 48964519.89850565, 140252860.98922876, 48964555.14306021, 140252863.1647916, 48964551.78643596, 1, 5, 140252756.0183215, 48964717.10017994, 46 },
-  { 140252885.84563497, 48964568.87014744, 140252871.6532962, 48964606.26770779, 140252900.03797373, 48964531.472587086, 140252885.13601804, 48964570.74002545, 140252886.5552519, 48964567.00026942, 0, 0, 0, 0, 0 },
-  { 140252913.42817044, 48964579.33769356, 140252903.92643505, 48964618.192770764, 140252922.92990583, 48964540.48261635, 140252912.95308366, 48964581.280447416, 140252913.90325722, 48964577.3949397, 1, 0, 140252868.77001417, 48964761.95655643, 38 },
-  { 140252942.71975324, 48964586.500743754, 140252936.1355483, 48964625.95512558, 140252949.30395818, 48964547.04636193, 140252942.39054298, 48964588.47346284, 140252943.0489635, 48964584.528024666, 1, 4, 140252975.31156772, 48964391.20155372, 25 },
-  { 140252972.03753158, 48964591.39333749, 140252969.52223724, 48964631.31417534, 140252974.55282593, 48964551.47249964, 140252971.91176686, 48964593.38937938, 140252972.1632963, 48964589.397295594, 0, 0, 0, 0, 0 },
-  { 140253000.98869684, 48964593.21746509, 140253004.34029043, 48964633.07680302, 140252997.63710326, 48964553.358127154, 140253001.15627652, 48964595.210431986, 140253000.82111716, 48964591.22449819, 0, 0, 0, 0, 0 },
-  { 140253029.42608467, 48964590.82629225, 140253039.69839638, 48964629.48479211, 140253019.15377295, 48964552.16779238, 140253029.93970025, 48964592.75921724, 140253028.9124691, 48964588.89336725, 1, 4, 140253116.74073428, 48964919.423541114, 37 },
-  { 140253057.16797653, 48964583.454734586, 140253073.29375646, 48964620.060188025, 140253041.0421966, 48964546.84928115, 140253057.97426552, 48964585.28500726, 140253056.36168754, 48964581.62446191, 0, 0, 0, 0, 0 },
-  { 140253083.91176075, 48964571.67331028, 140253104.57038972, 48964605.92562479, 140253063.25313178, 48964537.42099577, 140253084.9446922, 48964573.38592601, 140253082.8788293, 48964569.96069455, 0, 0, 0, 0, 0 },
-  { 140253109.3278835, 48964556.344061516, 140253134.03612277, 48964587.80042674, 140253084.61964425, 48964524.887696296, 140253110.56329548, 48964557.91687978, 140253108.09247154, 48964554.77124325, 0, 0, 0, 0, 0 },
-  { 140253132.6683812, 48964538.0106464, 140253162.51814663, 48964564.63754077, 140253102.8186158, 48964511.38375203, 140253134.16086948, 48964539.34199112, 140253131.17589295, 48964536.67930169, 1, 0, 140253311.7669738, 48964697.77201262, 31 },
-  { 140253152.01295063, 48964516.32464535, 140253187.4880227, 48964534.80488507, 140253116.53787854, 48964497.84440563, 140253153.78670424, 48964517.24865733, 140253150.23919702, 48964515.400633365, 0, 0, 0, 0, 0 },
-  { 140253165.29326862, 48964490.831456654, 140253204.23249438, 48964499.98223247, 140253126.35404286, 48964481.68068084, 140253167.2402299, 48964491.288995445, 140253163.34630734, 48964490.37391786, 1, 1, 140253460.25790367, 48964560.148583435, 49 },
-  { 140253171.97061148, 48964462.41741107, 140253211.93305343, 48964464.150395095, 140253132.00816953, 48964460.68442704, 140253173.96873358, 48964462.50406027, 140253169.9724894, 48964462.330761865, 0, 0, 0, 0, 0 },
-  { 140253173.2329586, 48964433.30780989, 140253213.09314746, 48964429.96635125, 140253133.37276977, 48964436.64926853, 140253175.22596806, 48964433.14073696, 140253171.23994917, 48964433.47488282, 1, 2, 140253527.98863927, 48964403.56882798, 28 },
-  { 140253170.81372026, 48964404.448767126, 140253210.3465289, 48964398.353109516, 140253131.28091162, 48964410.544424735, 140253172.7903607, 48964404.14398424, 140253168.83707982, 48964404.75355001, 0, 0, 0, 0, 0 },
-  { 140253166.42307892, 48964375.97367966, 140253205.5725116, 48964367.7686861, 140253127.27364624, 48964384.17867322, 140253168.38055056, 48964375.56342998, 140253164.4656073, 48964376.38392934, 0, 0, 0, 0, 0 },
-  { 140253160.53500915, 48964347.87925279, 140253199.23813504, 48964337.776379645, 140253121.83188325, 48964357.98212594, 140253162.47016543, 48964347.374109134, 140253158.59985286, 48964348.38439645, 1, 1, 140252921.54320672, 48964410.26449445, 31 },
-  { 140253153.29097813, 48964320.12807347, 140253191.5167289, 48964308.34707275, 140253115.06522736, 48964331.90907419, 140253155.20226568, 48964319.53902343, 140253151.3796906, 48964320.71712351, 0, 0, 0, 0, 0 },
-  { 140253144.83244887, 48964292.68272827, 140253182.57826966, 48964279.44441216, 140253107.08662808, 48964305.92104438, 140253146.7197399, 48964292.02081246, 140253142.94515783, 48964293.34464408, 1, 0, 140252904.20284137, 48964377.076993465, 35 },
-  { 140253135.30088457, 48964265.50580375, 140253172.58846697, 48964251.0269848, 140253098.01330218, 48964279.984622695, 140253137.16526368, 48964264.7818628, 140253133.43650547, 48964266.229744695, 1, 0, 140253269.53618124, 48964213.38205554, 37 },
-  { 140253124.83774826, 48964238.55988647, 140253161.70852944, 48964223.0503573, 140253087.96696708, 48964254.069415644, 140253126.68128732, 48964237.784410015, 140253122.9942092, 48964239.335362926, 0, 0, 0, 0, 0 },
-  { 140253113.58450305, 48964211.807562985, 140253150.0953823, 48964195.46878405, 140253077.0736238, 48964228.14634192, 140253115.41004702, 48964210.99062404, 140253111.75895908, 48964212.62450193, 0, 0, 0, 0, 0 },
-  { 140253101.68261212, 48964185.21141988, 140253137.90212417, 48964168.23652824, 140253065.46310008, 48964202.18631152, 140253103.49358773, 48964184.3626753, 140253099.8716365, 48964186.06016446, 0, 0, 0, 0, 0 },
-  { 140253089.2735385, 48964158.734043695, 140253125.27855855, 48964141.30881684, 140253053.26851845, 48964176.15927055, 140253091.0737895, 48964157.86278235, 140253087.4732875, 48964159.60530504, 0, 0, 0, 0, 0 },
-  { 140253076.49874535, 48964132.338021, 140253112.37168887, 48964114.642487034, 140253040.62580183, 48964150.03355497, 140253078.29239252, 48964131.453244306, 140253074.70509818, 48964133.2227977, 1, 1, 140252872.9197908, 48964232.76017627, 30 },
-  { 140253063.49969572, 48964105.98593836, 140253099.3261104, 48964088.19639052, 140253027.67328104, 48964123.77548621, 140253065.29101646, 48964105.09646097, 140253061.70837498, 48964106.87541576, 1, 2, 140253275.7712026, 48964000.582867384, 47 },
-  { 140253050.4178528, 48964079.64038234, 140253086.28426224, 48964061.93160847, 140253014.55144334, 48964097.349156216, 140253052.21117327, 48964078.75494365, 140253048.6245323, 48964080.52582104, 0, 0, 0, 0, 0 },
-  { 140253037.3946796, 48964053.2639395, 140253073.38652438, 48964035.81151531, 140253001.40283483, 48964070.71636369, 140253039.19427183, 48964052.39131829, 140253035.59508738, 48964054.13656071, 0, 0, 0, 0, 0 },
-  { 140253024.57163936, 48964026.81919641, 140253060.7711546, 48964009.80170263, 140252988.3721241, 48964043.83669019, 140253026.38161513, 48964025.96832172, 140253022.7616636, 48964027.6700711, 0, 0, 0, 0, 0 },
-  { 140253012.09019506, 48964000.26873961, 140253048.5740732, 48963983.86975683, 140252975.60631692, 48964016.66772239, 140253013.91438895, 48963999.448790476, 140253010.26600116, 48964001.088688746, 0, 0, 0, 0, 0 },
-  { 140253000.09180987, 48963973.575155675, 140253036.9285119, 48963957.98485793, 140252963.25510785, 48963989.16545342, 140253001.93364498, 48963972.79564079, 140252998.24997476, 48963974.35467056, 0, 0, 0, 0, 0 },
-  { 140252988.71794686, 48963946.70103117, 140253025.96456426, 48963932.11715334, 140252951.47132945, 48963961.284909, 140252990.58027774, 48963945.97183728, 140252986.85561597, 48963947.43022506, 0, 0, 0, 0, 0 },
-  { 140252978.11006913, 48963919.60895266, 140253015.80870065, 48963906.23684808, 140252940.4114376, 48963932.981057234, 140252979.9950007, 48963918.940347426, 140252976.22513756, 48963920.27755789, 0, 0, 0, 0, 0 },
-  { 140252968.4096399, 48963892.26150671, 140253006.58335117, 48963880.312960066, 140252930.23592862, 48963904.21005335, 140252970.31832546, 48963891.664079376, 140252966.50095433, 48963892.85893404, 1, 4, 140253063.8439181, 48963862.390140094, 36 },
-  { 140252959.75812218, 48963864.62127987, 140252998.40440008, 48963854.30308219, 140252921.11184427, 48963874.939477555, 140252961.69043607, 48963864.10536999, 140252957.8258083, 48963865.13718975, 0, 0, 0, 0, 0 },
-  { 140252952.29092485, 48963836.65327692, 140252991.34437308, 48963828.00294855, 140252913.23747662, 48963845.30360529, 140252954.24359727, 48963836.2207605, 140252950.33825243, 48963837.08579334, 0, 0, 0, 0, 0 },
-  { 140252946.02605295, 48963808.36939684, 140252985.3903062, 48963801.26618865, 140252906.6617997, 48963815.472605035, 140252947.99426562, 48963808.014236435, 140252944.0578403, 48963808.72455725, 0, 0, 0, 0, 0 },
-  { 140252940.87509573, 48963779.82404393, 140252980.46881613, 48963774.137454145, 140252901.28137532, 48963785.510633714, 140252942.85478175, 48963779.53971444, 140252938.8954097, 48963780.10837342, 0, 0, 0, 0, 0 },
-  { 140252936.7457924, 48963751.0731602, 140252976.50283796, 48963746.67119158, 140252896.98874682, 48963755.47512882, 140252938.73364466, 48963750.85306177, 140252934.7579401, 48963751.29325863, 1, 3, 140252714.10633722, 48963775.724184476, 46 },
-  { 140252933.54588225, 48963722.17268771, 140252973.41372246, 48963718.92379295, 140252893.67804205, 48963725.42158247, 140252935.53927428, 48963722.01024297, 140252931.55249023, 48963722.33513245, 1, 5, 140253161.78926745, 48963703.57276523, 36 },
-  { 140252931.1831046, 48963693.17856851, 140252971.12113515, 48963690.952873796, 140252891.24507406, 48963695.40426323, 140252933.18000612, 48963693.06728378, 140252929.1862031, 48963693.289853245, 0, 0, 0, 0, 0 },
-  { 140252929.56519866, 48963664.14674463, 140252969.54327545, 48963662.82259353, 140252889.58712187, 48963665.47089573, 140252931.5641025, 48963664.08053707, 140252927.56629482, 48963664.21295219, 1, 4, 140253248.39036107, 48963653.58663961, 33 },
-  { 140252928.60404423, 48963635.12807323, 140252968.60091758, 48963634.62795035, 140252888.60717088, 48963635.62819611, 140252930.6038879, 48963635.103067085, 140252926.60420057, 48963635.153079376, 0, 0, 0, 0, 0 },
-  { 140252928.24153286, 48963606.136556104, 140252968.24066108, 48963606.40064275, 140252888.24240464, 48963605.872469455, 140252930.24148926, 48963606.14976044, 140252926.24157646, 48963606.12335177, 1, 0, 140253285.23375222, 48963608.49352947, 49 },
-  { 140252928.43277934, 48963577.16995583, 140252968.42108062, 48963578.13730282, 140252888.44447806, 48963576.20260883, 140252930.4321944, 48963577.21832318, 140252926.43336427, 48963577.121588476, 0, 0, 0, 0, 0 },
-  { 140252929.1329562, 48963548.225964196, 140252969.10058865, 48963549.83480156, 140252889.16532376, 48963546.61712683, 140252931.13133782, 48963548.306406066, 140252927.1345746, 48963548.145522326, 0, 0, 0, 0, 0 },
-  { 140252930.2972362, 48963519.30227306, 140252970.23734632, 48963521.49033235, 140252890.3571261, 48963517.114213765, 140252932.2942417, 48963519.41167602, 140252928.3002307, 48963519.192870095, 0, 0, 0, 0, 0 },
-  { 140252931.88079175, 48963490.39657417, 140252971.78923962, 48963493.101345785, 140252891.9723439, 48963487.691802554, 140252933.87621415, 48963490.53181275, 140252929.88536936, 48963490.26133559, 1, 0, 140253214.23306036, 48963509.532833375, 44 },
-  { 140252933.83879554, 48963461.50655936, 140252973.71386522, 48963464.66548613, 140252893.96372586, 48963458.34763259, 140252935.83254904, 48963461.6645057, 140252931.84504205, 48963461.34861302, 0, 0, 0, 0, 0 },
-  { 140252936.12642008, 48963432.629920416, 140252975.96852258, 48963436.18053581, 140252896.28431758, 48963429.07930502, 140252938.1185252, 48963432.80745119, 140252934.13431495, 48963432.45238964, 1, 0, 140253064.61720058, 48963444.08065507, 36 },
-  { 140252938.69883808, 48963403.76434915, 140252978.51021186, 48963407.64436431, 140252898.8874643, 48963399.88433398, 140252940.68940678, 48963403.958349906, 140252936.7082694, 48963403.57034839, 0, 0, 0, 0, 0 },
-  { 140252941.511222, 48963374.907537356, 140252981.29563475, 48963379.054886356, 140252901.72680926, 48963370.760188356, 140252943.50044265, 48963375.114904806, 140252939.52200136, 48963374.700169906, 1, 5, 140253287.63561276, 48963410.98947363, 48 },
-  { 140252944.51874444, 48963346.05717683, 140252984.28119797, 48963350.41002529, 140252904.7562909, 48963341.704328366, 140252946.5068671, 48963346.274819255, 140252942.53062177, 48963345.8395344, 1, 1, 140252751.67084485, 48963324.94586178, 44 },
-  { 140252947.67657807, 48963317.21095941, 140252987.42301777, 48963321.70768398, 140252907.93013838, 48963312.714234844, 140252949.66390005, 48963317.43579564, 140252945.6892561, 48963316.98612318, 0, 0, 0, 0, 0 },
-  { 140252950.93989536, 48963288.36657686, 140252990.6769236, 48963292.945723765, 140252911.20286712, 48963283.78742995, 140252952.9267468, 48963288.595534205, 140252948.95304394, 48963288.13761951, 0, 0, 0, 0, 0 },
-  { 140252954.26386896, 48963259.521720976, 140252993.9984623, 48963264.12194834, 140252914.52927563, 48963254.92149361, 140252956.25059864, 48963259.75173234, 140252952.27713928, 48963259.29170961, 1, 5, 140253159.8903895, 48963283.32789757, 38 },
-  { 140252957.60367137, 48963230.6740836, 140252997.34289992, 48963235.234096095, 140252917.86444283, 48963226.1140711, 140252959.5906328, 48963230.902084224, 140252955.61670995, 48963230.44608297, 0, 0, 0, 0, 0 },
-  { 140252960.91447535, 48963201.82135651, 140253000.6652232, 48963206.27983664, 140252921.1637275, 48963197.362876385, 140252962.90201274, 48963202.04428052, 140252958.92693797, 48963201.5984325, 1, 5, 140253309.72728777, 48963240.94451961, 29 },
-  { 140252964.1514533, 48963172.961231515, 140253003.9201381, 48963177.256776854, 140252924.38276848, 48963168.665686175, 140252966.1398875, 48963173.17600878, 140252962.16301906, 48963172.74645425, 1, 1, 140252740.4526013, 48963148.79878899, 28 },
-  { 140252967.2697779, 48963144.091400415, 140253007.0620685, 48963148.16247006, 140252927.4774873, 48963140.02033077, 140252969.2593924, 48963144.2949539, 140252965.28016338, 48963143.88784693, 0, 0, 0, 0, 0 },
-  { 140252970.2246217, 48963115.209555015, 140253010.04515272, 48963118.99443425, 140252930.4040907, 48963111.42467578, 140252972.21564826, 48963115.39879898, 140252968.23359516, 48963115.02031105, 1, 5, 140252648.67383388, 48963084.64665516, 42 },
-  { 140252972.9711573, 48963086.31338712, 140253012.82323983, 48963089.750175975, 140252933.1190748, 48963082.87659826, 140252974.96376145, 48963086.485226564, 140252970.97855318, 48963086.14154767, 0, 0, 0, 0, 0 },
-  { 140252975.46455735, 48963057.40058853, 140253015.3498867, 48963060.42722077, 140252935.579228, 48963054.373956285, 140252977.45882383, 48963057.55192014, 140252973.47029087, 48963057.24925692, 1, 4, 140252648.40485668, 48963032.58220412, 32 },
-  { 140252977.6599944, 48963028.468851045, 140253017.57755524, 48963031.03562626, 140252937.74243355, 48963025.90207583, 140252979.65587243, 48963028.59718981, 140252975.66411635, 48963028.34051228, 0, 0, 0, 0, 0 },
-  { 140252979.52166203, 48962999.516868606, 140253019.46631232, 48963001.62041656, 140252939.57701173, 48962997.41332065, 140252981.51889455, 48962999.622046, 140252977.5244295, 48962999.41169121, 1, 0, 140252692.91879627, 48962984.42391204, 25 },
-  { 140252981.04725775, 48962970.547057115, 140253021.01330432, 48962972.19481938, 140252941.08121118, 48962968.899294846, 140252983.0455601, 48962970.629445225, 140252979.0489554, 48962970.464669004, 1, 5, 140253173.8834325, 48962978.49751005, 39 },
-  { 140252982.2422555, 48962941.56269631, 140253022.22426745, 48962942.762163684, 140252942.26024356, 48962940.36322893, 140252984.2413561, 48962941.622669674, 140252980.2431549, 48962941.50272294, 0, 0, 0, 0, 0 },
-  { 140252983.1121295, 48962912.56706598, 140253023.10493356, 48962913.32576481, 140252943.11932546, 48962911.80836714, 140252985.1117697, 48962912.60500092, 140252981.1124893, 48962912.52913103, 0, 0, 0, 0, 0 },
-  { 140252983.6623538, 48962883.56344592, 140253023.66102958, 48962883.888926186, 140252943.66367805, 48962883.23796565, 140252985.6622876, 48962883.57971993, 140252981.66242003, 48962883.547171906, 1, 0, 140252701.6716897, 48962881.268810056, 45 },
-  { 140252983.8984026, 48962854.5551159, 140253023.89827716, 48962854.45493931, 140252943.89852804, 48962854.65529249, 140252985.89839634, 48962854.55010707, 140252981.89840886, 48962854.56012473, 0, 0, 0, 0, 0 },
-  { 140252983.8257499, 48962825.54535571, 140253023.82239223, 48962825.027085386, 140252943.82910758, 48962826.06362603, 140252985.82558203, 48962825.51944219, 140252981.82591778, 48962825.57126922, 0, 0, 0, 0, 0 },
-  { 140252983.44986987, 48962796.53744511, 140253023.43908483, 48962795.60863532, 140252943.4606549, 48962797.466254905, 140252985.44933063, 48962796.49100462, 140252981.4504091, 48962796.5838856, 0, 0, 0, 0, 0 },
-  { 140252982.77623656, 48962767.534663886, 140253022.75405884, 48962766.20285114, 140252942.7984143, 48962768.86647663, 140252984.77512768, 48962767.46807325, 140252980.77734545, 48962767.60125452, 0, 0, 0, 0, 0 },
-  { 140252981.81032416, 48962738.54029184, 140253021.77301195, 48962736.81298607, 140252941.84763637, 48962740.26759761, 140252983.80845854, 48962738.45392655, 140252979.8121898, 48962738.62665713, 1, 0, 140253326.4885063, 48962723.64227957, 46 },
-  { 140252980.55760673, 48962709.55760873, 140253020.50163516, 48962707.44228571, 140252940.6135783, 48962711.67293175, 140252982.55480814, 48962709.451842576, 140252978.5604053, 48962709.663374886, 0, 0, 0, 0, 0 },
-  { 140252979.02355832, 48962680.589894325, 140253018.94561306, 48962678.09398871, 140252939.10150358, 48962683.08579994, 140252981.01966107, 48962680.465099044, 140252977.02745557, 48962680.714689605, 0, 0, 0, 0, 0 },
-  { 140252977.21365312, 48962651.64042843, 140253017.11062366, 48962648.77132707, 140252937.31668258, 48962654.50952979, 140252979.20850164, 48962651.496973366, 140252975.2188046, 48962651.7838835, 1, 1, 140252831.58971068, 48962662.112648405, 27 },
-  { 140252975.1333652, 48962622.71249083, 140253015.00233823, 48962619.47752703, 140252935.2643922, 48962625.947454624, 140252977.12681386, 48962622.55074263, 140252973.13991657, 48962622.87423902, 0, 0, 0, 0, 0 },
-  { 140252972.78816867, 48962593.80936125, 140253012.6270002, 48962590.22223129, 140252932.94933712, 48962597.39649121, 140252974.78011024, 48962593.63000475, 140252970.7962271, 48962593.98871775, 0, 0, 0, 0, 0 },
-  { 140252970.18816054, 48962564.93355046, 140253009.99996918, 48962561.05799972, 140252930.3763519, 48962568.8091012, 140252972.17875096, 48962564.73977292, 140252968.19757012, 48962565.127328, 0, 0, 0, 0, 0 },
-  { 140252967.37951335, 48962536.08156741, 140253007.17122108, 48962532.00480444, 140252927.58780563, 48962540.15833037, 140252969.36909875, 48962535.87772926, 140252965.38992795, 48962536.285405554, 0, 0, 0, 0, 0 },
-  { 140252964.42534804, 48962507.24710157, 140253004.20521605, 48962503.056385554, 140252924.64548004, 48962511.43781758, 140252966.41434145, 48962507.03756577, 140252962.43635464, 48962507.45663737, 1, 0, 140253117.5778399, 48962491.112844914, 29 },
-  { 140252961.3888834, 48962478.42382605, 140253001.16592476, 48962474.20636459, 140252921.61184207, 48962482.641287506, 140252963.37773547, 48962478.21295297, 140252959.40003136, 48962478.63469912, 1, 1, 140252854.9852978, 48962489.70553544, 30 },
-  { 140252958.33333835, 48962449.60541394, 140252998.11674458, 48962445.44842125, 140252918.54993212, 48962453.76240664, 140252960.32250866, 48962449.39756431, 140252956.34416804, 48962449.81326358, 0, 0, 0, 0, 0 },
-  { 140252955.32193175, 48962420.7855384, 140252995.12049958, 48962416.776299365, 140252915.52336392, 48962424.79477743, 140252957.31186014, 48962420.585076444, 140252953.33200336, 48962420.98600035, 0, 0, 0, 0, 0 },
-  { 140252952.41788244, 48962391.95787249, 140252992.23943856, 48962388.18379408, 140252912.59632632, 48962395.731950894, 140252954.40896025, 48962391.76916857, 140252950.42680463, 48962392.146576405, 0, 0, 0, 0, 0 },
-  { 140252949.68440938, 48962363.11608936, 140252989.53523177, 48962359.6647195, 140252909.833587, 48962366.56745922, 140252951.6769505, 48962362.94352087, 140252947.69186825, 48962363.28865785, 0, 0, 0, 0, 0 },
-  { 140252947.18473145, 48962334.253862135, 140252987.06895348, 48962331.21267281, 140252907.30050942, 48962337.29505146, 140252949.17894256, 48962334.10180267, 140252945.19052035, 48962334.4059216, 0, 0, 0, 0, 0 },
-  { 140252944.98193413, 48962305.36488221, 140252984.8988383, 48962302.78791486, 140252905.06502995, 48962307.94184956, 140252946.97777933, 48962305.23603384, 140252942.98608893, 48962305.493730575, 0, 0, 0, 0, 0 },
-  { 140252943.11498967, 48962276.446144424, 140252983.0581997, 48962274.315423444, 140252903.17177963, 48962278.576865405, 140252945.11215016, 48962276.33960838, 140252941.11782917, 48962276.55268047, 0, 0, 0, 0, 0 },
-  { 140252941.57098696, 48962247.50175176, 140252981.53434134, 48962245.78993793, 140252901.60763258, 48962249.21356559, 140252943.56915468, 48962247.41616107, 140252939.57281923, 48962247.58734245, 0, 0, 0, 0, 0 },
-  { 140252940.33028215, 48962218.53672946, 140252980.30848855, 48962217.21649673, 140252900.35207576, 48962219.8569622, 140252942.32919246, 48962218.470717825, 140252938.33137184, 48962218.6027411, 0, 0, 0, 0, 0 },
-  { 140252939.3732314, 48962189.5561028, 140252979.36180714, 48962188.600168176, 140252899.38465568, 48962190.51203742, 140252941.3726602, 48962189.50830606, 140252937.37380263, 48962189.60389953, 0, 0, 0, 0, 0 },
-  { 140252938.68019104, 48962160.56489707, 140252978.67540348, 48962159.94604167, 140252898.6849786, 48962161.18375246, 140252940.67995167, 48962160.5339543, 140252936.6804304, 48962160.595839836, 0, 0, 0, 0, 0 },
-  { 140252938.23151731, 48962131.56813754, 140252978.23032442, 48962131.25922, 140252898.2327102, 48962131.877055086, 140252940.23145768, 48962131.55269166, 140252936.23157695, 48962131.58358342, 1, 3, 140252593.24180603, 48962134.23255134, 34 },
-  { 140252938.00756636, 48962102.57084949, 140252978.0075579, 48962102.54481286, 140252898.00757483, 48962102.59688613, 140252940.00756595, 48962102.56954766, 140252936.00756678, 48962102.572151326, 0, 0, 0, 0, 0 },
-  { 140252937.9886945, 48962073.57805818, 140252977.98803398, 48962073.80792966, 140252897.989355, 48962073.34818671, 140252939.98866147, 48962073.589551754, 140252935.9887275, 48962073.56656461, 1, 5, 140252559.99493638, 48962071.405772746, 32 },
-  { 140252938.1552579, 48962044.594788924, 140252978.15262562, 48962045.05367424, 140252898.1578902, 48962044.135903604, 140252940.1551263, 48962044.61773319, 140252936.15538952, 48962044.57184466, 0, 0, 0, 0, 0 },
-  { 140252938.4876128, 48962015.626066945, 140252978.4814293, 48962016.32937541, 140252898.49379632, 48962014.92275848, 140252940.48730364, 48962015.66123237, 140252936.48792198, 48962015.590901524, 1, 4, 140252564.54542866, 48962009.050132796, 28 },
-  { 140252938.99668917, 48961986.67730917, 140252978.93525478, 48961988.89338145, 140252899.05812356, 48961984.461236894, 140252940.99361745, 48961986.78811278, 140252936.9997609, 48961986.56650556, 0, 0, 0, 0, 0 },
-  { 140252940.60091636, 48961957.7655569, 140252980.08966368, 48961964.14041638, 140252901.11216903, 48961951.39069743, 140252942.5753537, 48961958.08429988, 140252938.626479, 48961957.446813926, 1, 0, 140252801.40308198, 48961935.29417726, 49 },
-  { 140252945.25410005, 48961928.94164381, 140252983.04888332, 48961942.039519936, 140252907.4593168, 48961915.84376769, 140252947.1438392, 48961929.59653762, 140252943.3643609, 48961928.28675, 1, 3, 140253103.9921897, 48961983.952723525, 42 },
-  { 140252954.83272415, 48961901.3018938, 140252987.97638047, 48961923.69604587, 140252921.68906784, 48961878.90774173, 140252956.48990697, 48961902.42160141, 140252953.17554134, 48961900.182186194, 0, 0, 0, 0, 0 },
-  { 140252970.96415123, 48961877.42715752, 140252996.5397632, 48961908.18245092, 140252945.38853925, 48961846.67186412, 140252972.24293184, 48961878.96492219, 140252969.68537062, 48961875.88939285, 0, 0, 0, 0, 0 },
-  { 140252993.41069227, 48961858.76097162, 140253011.7647442, 48961894.30149466, 140252975.05664036, 48961823.22044858, 140252994.32839486, 48961860.537997775, 140252992.4929897, 48961856.98394547, 0, 0, 0, 0, 0 },
-  { 140253019.66501218, 48961845.20255689, 140253031.6687382, 48961883.35895298, 140253007.66128618, 48961807.04616081, 140253020.26519847, 48961847.1103767, 140253019.0648259, 48961843.294737086, 0, 0, 0, 0, 0 },
-  { 140253047.57971618, 48961836.42079309, 140253054.01074913, 48961875.90043107, 140253041.14868322, 48961796.941155106, 140253047.90126783, 48961838.39477499, 140253047.25816453, 48961834.446811184, 0, 0, 0, 0, 0 },
-  { 140253076.21562842, 48961831.75614811, 140253077.96464226, 48961871.71789169, 140253074.46661457, 48961791.79440452, 140253076.3030791, 48961833.75423529, 140253076.12817773, 48961829.758060925, 1, 0, 140253081.24404326, 48961946.64616092, 35 },
-  { 140253104.86462244, 48961830.50226169, 140253102.8069712, 48961870.449302524, 140253106.9222737, 48961790.55522086, 140253104.76173988, 48961832.49961373, 140253104.967505, 48961828.50490965, 0, 0, 0, 0, 0 },
-  { 140253133.51564726, 48961831.978061035, 140253128.688598, 48961871.68573782, 140253138.34269652, 48961792.27038425, 140253133.2742948, 48961833.96344487, 140253133.75699973, 48961829.9926772, 1, 1, 140253120.2412618, 48961941.17417219, 46 },
-  { 140253162.65663683, 48961835.52057481, 140253155.72032014, 48961874.914578296, 140253169.59295353, 48961796.12657132, 140253162.309821, 48961837.49027498, 140253163.00345266, 48961833.550874636, 0, 0, 0, 0, 0 },
-  { 140253192.47430575, 48961840.770734124, 140253179.59255314, 48961878.63972473, 140253205.35605836, 48961802.90174352, 140253191.8302181, 48961842.664183654, 140253193.1183934, 48961838.877284594, 0, 0, 0, 0, 0 },
-  { 140253220.23183826, 48961850.21290994, 140253194.9223659, 48961881.187586844, 140253245.5413106, 48961819.23823303, 140253218.96636465, 48961851.76164378, 140253221.49731186, 48961848.66417609, 1, 4, 140253346.1464632, 48961696.113892324, 38 },
-  { 140253241.701921, 48961867.75615879, 140253206.84743276, 48961887.38177088, 140253276.5564092, 48961848.130546704, 140253239.95919657, 48961868.737439394, 140253243.4446454, 48961866.77487819, 0, 0, 0, 0, 0 },
-  { 140253256.04323447, 48961893.225893945, 140253218.44446015, 48961906.87624816, 140253293.64200878, 48961879.57553973, 140253254.16329575, 48961893.90841165, 140253257.9231732, 48961892.54337624, 0, 0, 0, 0, 0 },
-  { 140253266.37886196, 48961921.69452704, 140253227.9377222, 48961932.752500325, 140253304.82000172, 48961910.63655375, 140253264.45680496, 48961922.247425705, 140253268.30091897, 48961921.14162837, 0, 0, 0, 0, 0 },
-  { 140253274.62351075, 48961950.35562867, 140253235.60251406, 48961959.15118537, 140253313.64450744, 48961941.56007197, 140253272.6724609, 48961950.795406505, 140253276.57456058, 48961949.91585083, 0, 0, 0, 0, 0 },
-  { 140253281.09477895, 48961979.0650491, 140253241.6706716, 48961985.82816678, 140253320.5188863, 48961972.30193141, 140253279.1235736, 48961979.403204985, 140253283.0659843, 48961978.72689321, 1, 4, 140253158.88004622, 48962000.03071392, 42 },
-  { 140253286.0271452, 48962007.81719353, 140253246.34101835, 48962012.81832698, 140253325.71327206, 48962002.81606008, 140253284.04283887, 48962008.0672502, 140253288.01145154, 48962007.56713686, 1, 4, 140253630.3042956, 48961964.432360835, 29 },
-  { 140253289.65508804, 48962036.60646715, 140253249.81171316, 48962040.14277574, 140253329.49846292, 48962033.07015856, 140253287.66291928, 48962036.78328258, 140253291.6472568, 48962036.42965172, 1, 3, 140253100.39905736, 48962053.40393295, 45 },
-  { 140253292.21308598, 48962065.427275166, 140253252.28420916, 48962067.81155631, 140253332.1419628, 48962063.04299402, 140253290.21664214, 48962065.546489224, 140253294.20952982, 48962065.30806111, 1, 0, 140253451.92859322, 48962055.8901506, 38 },
-  { 140253293.9356177, 48962094.274022765, 140253253.9657731, 48962095.826930836, 140253333.90546227, 48962092.721114695, 140253291.93712544, 48962094.35166817, 140253295.93410993, 48962094.19637736, 0, 0, 0, 0, 0 },
-  { 140253295.05716172, 48962123.141115166, 140253255.070823, 48962124.18644602, 140253335.04350042, 48962122.095784314, 140253293.0578448, 48962123.19338171, 140253297.05647865, 48962123.08884862, 0, 0, 0, 0, 0 },
-  { 140253295.8121966, 48962152.02295753, 140253255.82149345, 48962152.885315545, 140253335.80289978, 48962151.16059952, 140253293.81266147, 48962152.06607544, 140253297.81173176, 48962151.97983963, 0, 0, 0, 0, 0 },
-  { 140253296.435201, 48962180.91395507, 140253256.44780216, 48962181.91791417, 140253336.42259982, 48962179.90999597, 140253294.43583104, 48962180.96415302, 140253298.43457094, 48962180.86375712, 0, 0, 0, 0, 0 },
-  { 140253297.16065338, 48962209.80851298, 140253257.1876667, 48962211.278321005, 140253337.13364005, 48962208.33870495, 140253295.16200405, 48962209.88200338, 140253299.1593027, 48962209.735022575, 1, 0, 140253049.32813594, 48962218.92132274, 45 },
-  { 140253298.22303241, 48962238.70103647, 140253258.28683904, 48962240.95945584, 140253338.1592258, 48962236.442617096, 140253296.22622275, 48962238.81395744, 140253300.21984208, 48962238.5881155, 0, 0, 0, 0, 0 },
-  { 140253299.85649195, 48962267.58590913, 140253259.99052364, 48962270.85769313, 140253339.72246027, 48962264.31412513, 140253297.86319354, 48962267.74949833, 140253301.84979036, 48962267.42231993, 0, 0, 0, 0, 0 },
-  { 140253302.22559333, 48962296.45288825, 140253262.4568775, 48962300.748146206, 140253341.99430916, 48962292.157630295, 140253300.23715752, 48962296.66765115, 140253304.21402913, 48962296.238125354, 0, 0, 0, 0, 0 },
-  { 140253305.33924237, 48962325.281383574, 140253265.6919787, 48962330.58180658, 140253344.98650604, 48962319.98096057, 140253303.35687917, 48962325.54640473, 140253307.32160556, 48962325.01636242, 0, 0, 0, 0, 0 },
-  { 140253309.18522432, 48962354.04940087, 140253269.68254438, 48962360.33734782, 140253348.68790427, 48962347.76145393, 140253307.21009034, 48962354.36379822, 140253311.1603583, 48962353.73500352, 0, 0, 0, 0, 0 },
-  { 140253313.75132427, 48962382.73494579, 140253274.41542202, 48962389.99351285, 140253353.0872265, 48962375.47637873, 140253311.78452915, 48962383.09787414, 140253315.71811938, 48962382.372017436, 0, 0, 0, 0, 0 },
-  { 140253319.02532744, 48962411.31602408, 140253279.8775894, 48962419.52909943, 140253358.17306548, 48962403.10294873, 140253317.06794053, 48962411.72667785, 140253320.98271435, 48962410.90537031, 0, 0, 0, 0, 0 },
-  { 140253324.99501887, 48962439.77064142, 140253286.05615306, 48962448.92294875, 140253363.93388468, 48962430.618334085, 140253323.0480756, 48962440.228256784, 140253326.94196215, 48962439.31302605, 0, 0, 0, 0, 0 },
-  { 140253331.64818376, 48962468.07680352, 140253292.9383472, 48962478.15393374, 140253370.35802034, 48962457.9996733, 140253329.71269193, 48962468.58066003, 140253333.5836756, 48962467.57294701, 0, 0, 0, 0, 0 },
-  { 140253338.97260734, 48962496.21251612, 140253300.5115317, 48962507.2009492, 140253377.43368298, 48962485.22408304, 140253337.04955357, 48962496.761937775, 140253340.89566112, 48962495.66309447, 0, 0, 0, 0, 0 },
-  { 140253346.95607463, 48962524.1557849, 140253308.75892708, 48962536.02919718, 140253385.15322217, 48962512.282372616, 140253345.04621726, 48962524.74945551, 140253348.865932, 48962523.56211428, 0, 0, 0, 0, 0 },
-  { 140253355.577324, 48962551.89062023, 140253317.63356715, 48962564.55045105, 140253393.52108085, 48962539.230789416, 140253353.68013617, 48962552.52361177, 140253357.47451183, 48962551.257628694, 1, 4, 140253107.04571664, 48962634.81251209, 36 },
-  { 140253364.76679397, 48962579.43309049, 140253327.05136162, 48962592.75773541, 140253402.4822263, 48962566.10844558, 140253362.88102233, 48962580.099322736, 140253366.6525656, 48962578.76685825, 1, 5, 140253537.314897, 48962518.47284002, 44 },
-  { 140253374.43886974, 48962606.80991908, 140253336.92037508, 48962620.679402046, 140253411.9573644, 48962592.94043612, 140253372.562945, 48962607.50339323, 140253376.31479448, 48962606.11644493, 0, 0, 0, 0, 0 },
-  { 140253384.50792596, 48962634.04783652, 140253347.14989966, 48962648.34391541, 140253421.86595225, 48962619.75175763, 140253382.64002463, 48962634.76264046, 140253386.37582728, 48962633.33303258, 1, 4, 140253620.79744226, 48962543.62513753, 48 },
-  { 140253394.8883371, 48962661.17357327, 140253357.6503953, 48962675.77958886, 140253432.1262789, 48962646.56755768, 140253393.02644002, 48962661.90387405, 140253396.7502342, 48962660.443272494, 0, 0, 0, 0, 0 },
-  { 140253405.49447775, 48962688.213859886, 140253368.33342302, 48962703.01440082, 140253442.65553248, 48962673.413318954, 140253403.63642502, 48962688.95388693, 140253407.35253048, 48962687.47383284, 0, 0, 0, 0, 0 },
-  { 140253416.24072242, 48962715.195426844, 140253379.11158848, 48962730.075864114, 140253453.36985636, 48962700.314989574, 140253414.38426572, 48962715.93944871, 140253418.0971791, 48962714.45140498, 0, 0, 0, 0, 0 },
-  { 140253427.04144573, 48962742.14500469, 140253389.89850467, 48962756.99094455, 140253464.1843868, 48962727.29906483, 140253425.1842987, 48962742.88730168, 140253428.89859277, 48962741.402707696, 0, 0, 0, 0, 0 },
-  { 140253437.81102216, 48962769.0893239, 140253400.60877854, 48962783.78602656, 140253475.0132658, 48962754.39262124, 140253435.95090997, 48962769.82415903, 140253439.67113435, 48962768.35448877, 0, 0, 0, 0, 0 },
-  { 140253448.46382627, 48962796.05511499, 140253411.1580239, 48962810.48692396, 140253485.76962864, 48962781.62330602, 140253446.59853616, 48962796.776705444, 140253450.32911637, 48962795.33352454, 1, 0, 140253643.3866436, 48962720.64891311, 48 },
-  { 140253458.9142326, 48962823.06910848, 140253421.46290022, 48962837.118937746, 140253496.365565, 48962809.01927921, 140253457.041666, 48962823.77159994, 140253460.78679922, 48962822.36661702, 0, 0, 0, 0, 0 },
-  { 140253469.0766158, 48962850.15803488, 140253431.4411732, 48962863.70696324, 140253506.71205842, 48962836.609106526, 140253467.19484368, 48962850.8354813, 140253470.95838794, 48962849.480588466, 0, 0, 0, 0, 0 },
-  { 140253478.86535025, 48962877.34862468, 140253441.01179117, 48962890.27565313, 140253516.71890932, 48962864.42159622, 140253476.97267228, 48962877.994976096, 140253480.7580282, 48962876.70227326, 1, 5, 140253159.00277597, 48962986.5820151, 35 },
-  { 140253488.19481063, 48962904.667608395, 140253450.0949661, 48962916.849638075, 140253526.29465514, 48962892.485578716, 140253486.2898184, 48962905.27670988, 140253490.09980285, 48962904.05850691, 1, 5, 140253688.21899438, 48962840.71195259, 25 },
-  { 140253496.97937143, 48962932.14171653, 140253458.61877394, 48962943.47593731, 140253535.33996892, 48962920.80749576, 140253495.06134155, 48962932.70842757, 140253498.8974013, 48962931.575005494, 1, 0, 140253356.96319062, 48962973.51162236, 50 },
-  { 140253505.149334, 48962959.79290248, 140253466.55455345, 48962970.30208484, 140253543.74411458, 48962949.28372011, 140253503.219595, 48962960.318361595, 140253507.07907304, 48962959.26744336, 1, 5, 140253601.6362854, 48962933.51994656, 43 },
-  { 140253512.72543478, 48962987.61599436, 140253473.9327489, 48962997.36932831, 140253551.51812065, 48962977.8626604, 140253510.7858005, 48962988.10366105, 140253514.66506907, 48962987.12832766, 1, 1, 140253397.3171943, 48963016.63216286, 33 },
-  { 140253519.76028827, 48963015.596258625, 140253480.8018311, 48963024.66480943, 140253558.71874544, 48963006.52770782, 140253517.8123654, 48963016.04968616, 140253521.70821112, 48963015.14283109, 0, 0, 0, 0, 0 },
-  { 140253526.30654505, 48963043.718950994, 140253487.21058488, 48963052.17506701, 140253565.40250522, 48963035.26283498, 140253524.35174704, 48963044.141756795, 140253528.26134306, 48963043.29614519, 1, 0, 140253338.64593622, 48963084.30830787, 25 },
-  { 140253532.4168556, 48963071.96932713, 140253493.20814404, 48963079.88620388, 140253571.62556717, 48963064.05245038, 140253530.45642003, 48963072.36517097, 140253534.37729117, 48963071.57348329, 0, 0, 0, 0, 0 },
-  { 140253538.14387047, 48963100.33264277, 140253498.84402964, 48963107.78398557, 140253577.4437113, 48963092.88129997, 140253536.17887843, 48963100.70520991, 140253540.10886252, 48963099.96007563, 0, 0, 0, 0, 0 },
-  { 140253543.54024026, 48963128.794153586, 140253504.16817427, 48963135.8539284, 140253582.91230625, 48963121.73437877, 140253541.57163695, 48963129.14714233, 140253545.50884357, 48963128.441164844, 1, 5, 140253760.08660313, 48963089.96539208, 27 },
-  { 140253548.65861535, 48963157.33911529, 140253509.23093602, 48963164.081377685, 140253588.08629468, 48963150.5968529, 140253546.6872314, 48963157.67622841, 140253550.6299993, 48963157.00200217, 1, 0, 140253387.99082205, 48963184.81383454, 43 },
-  { 140253553.5516464, 48963185.952783585, 140253514.08310497, 48963192.45157091, 140253593.02018785, 48963179.453996256, 140253551.57821935, 48963186.27772295, 140253555.52507347, 48963185.62784422, 0, 0, 0, 0, 0 },
-  { 140253558.27198386, 48963214.62041415, 140253518.7759049, 48963220.94969098, 140253597.76806283, 48963208.29113732, 140253556.2971799, 48963214.936877996, 140253560.24678782, 48963214.30395031, 0, 0, 0, 0, 0 },
-  { 140253562.87227827, 48963243.32726269, 140253523.3609925, 48963249.560904905, 140253602.38356405, 48963237.09362048, 140253560.89671397, 48963243.638944805, 140253564.84784257, 48963243.01558058, 1, 0, 140253664.61383918, 48963227.275634, 50 },
-  { 140253567.4051802, 48963272.058584906, 140253527.89045554, 48963278.270391166, 140253606.91990483, 48963265.846778646, 140253565.42944396, 48963272.36917522, 140253569.38091642, 48963271.747994594, 1, 3, 140253438.9823251, 48963292.24695524, 41 },
-  { 140253571.92334008, 48963300.799636506, 140253532.41681114, 48963307.0633552, 140253611.42986903, 48963294.53591781, 140253569.94801363, 48963301.11282244, 140253573.89866653, 48963300.48645057, 0, 0, 0, 0, 0 },
-  { 140253576.47940853, 48963329.53567318, 140253536.99300468, 48963335.925032385, 140253615.96581239, 48963323.14631397, 140253574.50508833, 48963329.85514114, 140253578.45372874, 48963329.21620522, 0, 0, 0, 0, 0 },
-  { 140253581.12603608, 48963358.25195063, 140253541.67240953, 48963364.84067988, 140253620.57966262, 48963351.66322138, 140253579.15335476, 48963358.58138709, 140253583.0987174, 48963357.92251417, 0, 0, 0, 0, 0 },
-  { 140253585.91587314, 48963386.93372455, 140253546.5088274, 48963393.79555705, 140253625.3229189, 48963380.07189205, 140253583.94552085, 48963387.276816174, 140253587.88622543, 48963386.59063293, 1, 0, 140253257.85221726, 48963444.058480114, 39 },
-  { 140253590.90157035, 48963415.56625064, 140253551.5564883, 48963422.774892665, 140253630.2466524, 48963408.35760861, 140253588.93431625, 48963415.92668274, 140253592.86882445, 48963415.205818534, 1, 0, 140253722.70759517, 48963391.417299844, 39 },
-  { 140253596.13577813, 48963444.13478458, 140253556.870049, 48963451.76384196, 140253635.40150726, 48963436.5057272, 140253594.17249167, 48963444.516237445, 140253598.0990646, 48963443.75333171, 0, 0, 0, 0, 0 },
-  { 140253601.67114714, 48963472.62458211, 140253562.50458804, 48963480.747429356, 140253640.83770624, 48963464.50173487, 140253599.7128192, 48963473.03072447, 140253603.6294751, 48963472.21843975, 1, 3, 140253845.4829776, 48963422.059857994, 34 },
-  { 140253607.56032783, 48963501.02089889, 140253568.51497695, 48963509.70770356, 140253646.6056787, 48963492.33409423, 140253605.60806027, 48963501.455239125, 140253609.5125954, 48963500.58655866, 1, 2, 140253316.67246383, 48963565.73759366, 27 },
-  { 140253613.85398245, 48963529.30954614, 140253574.94023293, 48963538.5680611, 140253652.76773196, 48963520.05103119, 140253611.90829498, 48963529.77247189, 140253615.79966992, 48963528.846620396, 0, 0, 0, 0, 0 },
-  { 140253620.55848184, 48963557.48871, 140253581.77177176, 48963567.26578123, 140253659.34519193, 48963547.71163877, 140253618.61914635, 48963557.97756356, 140253622.49781734, 48963556.99985644, 1, 4, 140253376.2022084, 48963619.08425875, 30 },
-  { 140253627.63668928, 48963585.56873244, 140253588.96963227, 48963595.808786236, 140253666.30374628, 48963575.328678645, 140253625.70333642, 48963586.08073513, 140253629.57004213, 48963585.05672975, 1, 2, 140253994.0070545, 48963488.54422273, 26 },
-  { 140253635.0496369, 48963613.56046707, 140253596.49284536, 48963624.20818161, 140253673.60642844, 48963602.91275253, 140253633.12179732, 48963614.0928528, 140253636.97747648, 48963613.02808134, 1, 1, 140253371.89953452, 48963686.23111883, 27 },
-  { 140253642.75835672, 48963641.47476756, 140253604.30069557, 48963652.475144796, 140253681.21601787, 48963630.47439032, 140253640.83547366, 48963642.02478642, 140253644.68123978, 48963640.9247487, 0, 0, 0, 0, 0 },
-  { 140253650.72388077, 48963669.32248751, 140253612.35271764, 48963680.62088741, 140253689.0950439, 48963658.02408761, 140253648.80532262, 48963669.887407504, 140253652.64243892, 48963668.75756752, 0, 0, 0, 0, 0 },
-  { 140253658.90724105, 48963697.11448061, 140253620.60869107, 48963708.65662379, 140253697.20579103, 48963685.572337426, 140253656.99231353, 48963697.69158777, 140253660.82216856, 48963696.537373446, 0, 0, 0, 0, 0 },
-  { 140253667.26946965, 48963724.86160044, 140253629.028634, 48963736.59354355, 140253705.5103053, 48963713.129657336, 140253665.35742787, 48963725.448197596, 140253669.18151143, 48963724.27500329, 0, 0, 0, 0, 0 },
-  { 140253675.77159858, 48963752.57470066, 140253637.57279703, 48963764.442790695, 140253713.97040012, 48963740.70661063, 140253673.8616585, 48963753.16810516, 140253677.68153864, 48963751.98129616, 1, 4, 140253970.85734046, 48963660.89370516, 38 },
-  { 140253684.37465993, 48963780.264634944, 140253646.20165768, 48963792.21544661, 140253722.54766217, 48963768.31382328, 140253682.46600983, 48963780.862175524, 140253686.28331003, 48963779.667094365, 1, 5, 140253469.65152228, 48963847.48795055, 28 },
-  { 140253693.03968567, 48963807.94225688, 140253654.8759158, 48963819.92251855, 140253731.20345554, 48963795.961995214, 140253691.13149717, 48963808.541269965, 140253694.94787416, 48963807.3432438, 1, 4, 140253834.24563417, 48963763.61528872, 42 },
-  { 140253701.7277078, 48963835.61842012, 140253663.55649087, 48963847.57493285, 140253739.89892474, 48963823.66190738, 140253699.81914696, 48963836.216245756, 140253703.63626865, 48963835.02059448, 0, 0, 0, 0, 0 },
-  { 140253710.39975852, 48963863.30397832, 140253672.2045205, 48963875.18353186, 140253748.59499654, 48963851.424424775, 140253708.4899966, 48963863.89795599, 140253712.30952042, 48963862.71000064, 1, 3, 140254046.5178531, 48963758.76390716, 30 },
-  { 140253719.01686975, 48963891.00978507, 140253680.7813608, 48963902.75907674, 140253757.2523787, 48963879.260493405, 140253717.1050943, 48963891.59724966, 140253720.9286452, 48963890.422320485, 1, 5, 140253402.6180331, 48963988.23517362, 44 },
-  { 140253727.5400735, 48963918.746694066, 140253689.24889985, 48963930.31328468, 140253765.83124718, 48963907.18010345, 140253725.62551484, 48963919.3250236, 140253729.4546322, 48963918.16836453, 0, 0, 0, 0, 0 },
-  { 140253735.93113998, 48963946.52530177, 140253697.6140907, 48963958.00588262, 140253774.24818924, 48963935.04472092, 140253734.01528752, 48963947.09933081, 140253737.84699243, 48963945.951272726, 0, 0, 0, 0, 0 },
-  { 140253744.2586999, 48963974.31897594, 140253706.03740412, 48963986.11442204, 140253782.47999567, 48963962.52352984, 140253742.3476351, 48963974.90874825, 140253746.1697647, 48963973.729203634, 0, 0, 0, 0, 0 },
-  { 140253752.80910742, 48964002.02523246, 140253714.82756108, 48964014.57123329, 140253790.79065377, 48963989.479231626, 140253750.9100301, 48964002.652532496, 140253754.70818475, 48964001.39793242, 1, 0, 140253617.97461787, 48964046.563535415, 38 },
-  { 140253761.89521438, 48964029.53235581, 140253724.32352927, 48964043.25709541, 140253799.46689948, 48964015.807616204, 140253760.0166301, 48964030.218592785, 140253763.77379864, 48964028.84611883, 0, 0, 0, 0, 0 },
-  { 140253771.8298711, 48964056.728630885, 140253734.84073523, 48964071.95373607, 140253808.81900695, 48964041.503525704, 140253769.9804143, 48964057.48988614, 140253773.67932788, 48964055.96737563, 1, 3, 140253412.11052477, 48964204.79277879, 32 },
-  { 140253782.8574226, 48964083.51988099, 140253746.5116894, 48964100.222805254, 140253819.2031558, 48964066.81695672, 140253781.04013592, 48964084.3550272, 140253784.67470926, 48964082.68473478, 0, 0, 0, 0, 0 },
-  { 140253794.9698057, 48964109.87654988, 140253759.29093555, 48964127.96019515, 140253830.64867583, 48964091.79290461, 140253793.18586218, 48964110.78073214, 140253796.7537492, 48964108.972367615, 1, 5, 140253704.8806586, 48964155.537754185, 47 },
-  { 140253808.10083878, 48964135.78396054, 140253773.10436472, 48964155.155248664, 140253843.09731284, 48964116.41267242, 140253806.3510151, 48964136.75252495, 140253809.85066247, 48964134.81539614, 0, 0, 0, 0, 0 },
-  { 140253822.18434024, 48964161.22743598, 140253787.87908965, 48964181.79804079, 140253856.48959082, 48964140.656831175, 140253820.4690777, 48964162.255966224, 140253823.89960277, 48964160.19890574, 0, 0, 0, 0, 0 },
-  { 140253837.15412843, 48964186.192299195, 140253803.54337686, 48964207.879101165, 140253870.76488, 48964164.505497225, 140253835.47359085, 48964187.27663929, 140253838.834666, 48964185.1079591, 0, 0, 0, 0, 0 },
-  { 140253852.94402167, 48964210.66387317, 140253820.0265504, 48964233.389191344, 140253885.86149293, 48964187.938555, 140253851.2981481, 48964211.800139084, 140253854.58989525, 48964209.52760726, 0, 0, 0, 0, 0 },
-  { 140253869.48783836, 48964234.62748091, 140253837.25888452, 48964258.319136284, 140253901.7167922, 48964210.935825534, 140253867.87639067, 48964235.81206368, 140253871.09928605, 48964233.44289814, 0, 0, 0, 0, 0 },
-  { 140253886.71941337, 48964258.06846158, 140253855.1727977, 48964282.66136788, 140253918.26602903, 48964233.475555286, 140253885.14208257, 48964259.298106894, 140253888.29674417, 48964256.83881627, 0, 0, 0, 0, 0 },
-  { 140253904.58077806, 48964280.98017444, 140253873.71047828, 48964306.41685251, 140253935.45107785, 48964255.54349636, 140253903.03726307, 48964282.25200834, 140253906.12429306, 48964279.70834053, 0, 0, 0, 0, 0 },
-  { 140253923.03539383, 48964303.37694809, 140253892.8318564, 48964329.60186613, 140253953.23893127, 48964277.15203004, 140253921.52521697, 48964304.68819399, 140253924.5455707, 48964302.065702185, 0, 0, 0, 0, 0 },
-  { 140253942.0501813, 48964325.276495844, 140253912.50008652, 48964352.235574074, 140253971.60027608, 48964298.317417614, 140253940.57267657, 48964326.62444975, 140253943.52768603, 48964323.928541936, 0, 0, 0, 0, 0 },
-  { 140253961.59206122, 48964346.69653101, 140253932.6787284, 48964374.337427996, 140253990.50539404, 48964319.05563403, 140253960.14639458, 48964348.078575864, 140253963.03772786, 48964345.31448616, 0, 0, 0, 0, 0 },
-  { 140253981.62795407, 48964367.65476686, 140253953.33173782, 48964395.92708806, 140254009.92417032, 48964339.382445656, 140253980.21314326, 48964369.06838292, 140253983.04276487, 48964366.2411508, 0, 0, 0, 0, 0 },
-  { 140254002.12478054, 48964388.168916725, 140253974.42351225, 48964417.02441422, 140254029.82604882, 48964359.31341923, 140254000.73971713, 48964389.6116916, 140254003.50984395, 48964386.72614185, 0, 0, 0, 0, 0 },
-  { 140254023.04950354, 48964408.256644055, 140253995.92920116, 48964437.65884122, 140254050.1698059, 48964378.85444689, 140254021.69348842, 48964409.72675391, 140254024.40551865, 48964406.7865342, 0, 0, 0, 0, 0 },
-  { 140254044.3757492, 48964427.92776686, 140254017.84314722, 48964457.86137727, 140254070.90835118, 48964397.99415645, 140254043.0491191, 48964429.42444738, 140254045.7023793, 48964426.43108634, 1, 5, 140253859.3108504, 48964636.71469949, 48 },
-  { 140254066.09101072, 48964447.17577546, 140254040.1555817, 48964477.62825519, 140254092.02643973, 48964416.72329573, 140254064.79423928, 48964448.69839945, 140254067.38778216, 48964445.653151475, 0, 0, 0, 0, 0 },
-  { 140254088.18451184, 48964465.992122605, 140254062.85583785, 48964496.95109987, 140254113.51318583, 48964435.03314534, 140254086.91807815, 48964467.540071465, 140254089.45094553, 48964464.444173746, 0, 0, 0, 0, 0 },
-  { 140254110.64547643, 48964484.36826097, 140254085.93327293, 48964515.821511954, 140254135.35767993, 48964452.91500999, 140254109.40986624, 48964485.94092352, 140254111.88108662, 48964482.795598425, 0, 0, 0, 0, 0 },
-  { 140254133.4631282, 48964502.295643255, 140254109.3772666, 48964534.23106669, 140254157.54898983, 48964470.36021982, 140254132.25883514, 48964503.89241443, 140254134.66742128, 48964500.69887208, 1, 0, 140254025.0767509, 48964646.00504869, 25 },
-  { 140254156.62669098, 48964519.76572218, 140254133.17721903, 48964552.17131221, 140254180.07616293, 48964487.36013214, 140254155.45421737, 48964521.38600168, 140254157.7991646, 48964518.14544268, 0, 0, 0, 0, 0 },
-  { 140254180.12538856, 48964536.76995043, 140254157.32254896, 48964569.63376801, 140254202.92822817, 48964503.90613285, 140254178.98524657, 48964538.4131413, 140254181.26553056, 48964535.12675955, 1, 3, 140254046.1587059, 48964729.84487872, 39 },
-  { 140254203.94844466, 48964553.29978071, 140254181.79646978, 48964586.6057863, 140254226.10041955, 48964519.99377512, 140254202.8408459, 48964554.96508099, 140254205.05604342, 48964551.63448043, 0, 0, 0, 0, 0 },
-  { 140254228.08277395, 48964569.35163223, 140254206.51800644, 48964603.040811524, 140254249.64754146, 48964535.662452936, 140254227.0045356, 48964571.03609119, 140254229.16101232, 48964567.66717327, 0, 0, 0, 0, 0 },
-  { 140254252.49049687, 48964584.975250304, 140254231.40484703, 48964618.96635753, 140254273.57614672, 48964550.98414308, 140254251.4362144, 48964586.67480566, 140254253.54477936, 48964583.275694944, 0, 0, 0, 0, 0 },
-  { 140254277.11866036, 48964600.252800055, 140254256.40015134, 48964634.46892759, 140254297.83716938, 48964566.03667252, 140254276.0827349, 48964601.96360643, 140254278.1545858, 48964598.54199368, 1, 4, 140254107.22688633, 48964880.825045854, 42 },
-  { 140254301.91409838, 48964615.266904324, 140254281.44845802, 48964649.63487728, 140254322.37973875, 48964580.89893137, 140254300.89081636, 48964616.98530297, 140254302.9373804, 48964613.54850568, 0, 0, 0, 0, 0 },
-  { 140254326.82364506, 48964630.100186005, 140254306.49513906, 48964664.5494508, 140254347.15215105, 48964595.65092121, 140254325.80721974, 48964631.82264925, 140254327.84007037, 48964628.37772276, 1, 3, 140254260.75600064, 48964742.06029658, 26 },
-  { 140254351.79413432, 48964644.83526797, 140254331.48626813, 48964679.296703964, 140254372.1020005, 48964610.37383197, 140254350.778741, 48964646.55833977, 140254352.80952764, 48964643.11219617, 0, 0, 0, 0, 0 },
-  { 140254376.77240026, 48964659.554773055, 140254356.36854795, 48964693.959464744, 140254397.17625257, 48964625.15008137, 140254375.75220764, 48964661.27500764, 140254377.79259288, 48964657.83453847, 1, 0, 140254247.7180343, 48964877.16444799, 42 },
-  { 140254401.7052769, 48964674.341324195, 140254381.0893, 48964708.619327284, 140254422.3212538, 48964640.063321106, 140254400.67447805, 48964676.05522435, 140254402.73607576, 48964672.62742404, 1, 3, 140254489.83857822, 48964527.80286098, 41 },
-  { 140254426.53959823, 48964689.277544186, 140254405.5965158, 48964723.35667708, 140254447.48268065, 48964655.19841129, 140254425.4924441, 48964690.98150083, 140254427.58675236, 48964687.573587544, 1, 0, 140254289.3624084, 48964912.49586465, 27 },
-  { 140254451.22219837, 48964704.44605597, 140254429.83896953, 48964738.250752755, 140254472.6054272, 48964670.64135919, 140254450.15303692, 48964706.13629081, 140254452.2913598, 48964702.75582113, 1, 3, 140254663.98532522, 48964368.08932295, 40 },
-  { 140254475.6999112, 48964719.92948238, 140254453.76787406, 48964753.3807267, 140254497.63194835, 48964686.47823805, 140254474.60330936, 48964721.6020446, 140254476.79651305, 48964718.25692016, 0, 0, 0, 0, 0 },
-  { 140254499.9202242, 48964735.80933422, 140254477.39330924, 48964768.86289836, 140254522.44713914, 48964702.75577008, 140254498.79387844, 48964737.462012425, 140254501.04656994, 48964734.15665601, 1, 2, 140254675.066988, 48964478.817873016, 40 },
-  { 140254523.8567148, 48964752.12271228, 140254500.76722047, 48964784.78576865, 140254546.9462091, 48964719.4596559, 140254522.70224008, 48964753.7558651, 140254525.0111895, 48964750.48955946, 1, 1, 140254294.1162462, 48965077.12012318, 26 },
-  { 140254547.5172586, 48964768.84833606, 140254523.9018328, 48964801.13318799, 140254571.13268444, 48964736.56348414, 140254546.33648732, 48964770.46257866, 140254548.6980299, 48964767.234093465, 0, 0, 0, 0, 0 },
-  { 140254570.9120646, 48964785.96095305, 140254546.80633956, 48964817.88138569, 140254595.01778966, 48964754.04052041, 140254569.70677835, 48964787.55697468, 140254572.11735088, 48964784.36493142, 1, 2, 140254435.92000437, 48964964.71537585, 40 },
-  { 140254594.05134195, 48964803.43531073, 140254569.48990738, 48964835.00643571, 140254618.61277652, 48964771.86418575, 140254592.82327023, 48964805.013866976, 140254595.27941367, 48964801.85675448, 0, 0, 0, 0, 0 },
-  { 140254616.94529948, 48964821.24615656, 140254591.9616976, 48964852.4842685, 140254641.92890134, 48964790.008044615, 140254615.69611937, 48964822.80806216, 140254618.19447958, 48964819.68425096, 1, 0, 140254497.0240105, 48964971.18909387, 34 },
-  { 140254639.6041464, 48964839.36823805, 140254614.23088482, 48964870.29068292, 140254664.97740796, 48964808.445793174, 140254638.3354833, 48964840.91436029, 140254640.87280947, 48964837.8221158, 1, 5, 140254769.00778043, 48964681.6637692, 32 },
-  { 140254662.03809175, 48964857.77630268, 140254636.30667257, 48964888.40135888, 140254687.76951092, 48964827.15124648, 140254660.75152078, 48964859.30755549, 140254663.32466272, 48964856.24504987, 0, 0, 0, 0, 0 },
-  { 140254684.2573444, 48964876.44509793, 140254658.19808763, 48964906.79168155, 140254710.31660116, 48964846.09851431, 140254682.95438156, 48964877.96242711, 140254685.56030723, 48964874.92776875, 1, 4, 140254890.77695417, 48964635.94842273, 38 },
-  { 140254706.27199557, 48964895.349547096, 140254679.8980837, 48964925.423069865, 140254732.64590746, 48964865.27602433, 140254704.95329997, 48964896.853223234, 140254707.59069118, 48964893.84587096, 0, 0, 0, 0, 0 },
-  { 140254728.08334064, 48964914.47768507, 140254701.38067535, 48964944.25968747, 140254754.78600594, 48964884.695682675, 140254726.7482074, 48964915.96678519, 140254729.4184739, 48964912.98858495, 0, 0, 0, 0, 0 },
-  { 140254749.67794853, 48964933.83949892, 140254722.6303893, 48964963.30862749, 140254776.72550777, 48964904.37037035, 140254748.32557058, 48964935.31295535, 140254751.0303265, 48964932.366042495, 0, 0, 0, 0, 0 },
-  { 140254771.04098445, 48964953.447068185, 140254743.63303316, 48964982.581312746, 140254798.44893575, 48964924.31282362, 140254769.67058688, 48964954.903780416, 140254772.41138202, 48964951.99035595, 0, 0, 0, 0, 0 },
-  { 140254792.1576137, 48964973.31247243, 140254764.37448856, 48965002.08916366, 140254819.94073883, 48964944.535781205, 140254790.76845744, 48964974.751306996, 140254793.54676995, 48964971.87363787, 1, 4, 140254592.11911276, 48965180.50464926, 30 },
-  { 140254813.01300153, 48964993.44779117, 140254784.840716, 48965021.843606494, 140254841.18528706, 48964965.05197584, 140254811.60438725, 48964994.867581934, 140254814.4216158, 48964992.0280004, 0, 0, 0, 0, 0 },
-  { 140254833.5923132, 48965013.86510398, 140254805.01776007, 48965041.85608312, 140254862.16686633, 48964985.87412485, 140254832.16358554, 48965015.26465294, 140254835.02104086, 48965012.46555503, 0, 0, 0, 0, 0 },
-  { 140254853.88071394, 48965034.576490395, 140254824.89175344, 48965062.138060905, 140254882.86967444, 48965007.014919885, 140254852.43126592, 48965035.95456892, 140254855.33016196, 48965033.19841187, 0, 0, 0, 0, 0 },
-  { 140254873.86336905, 48965055.59402999, 140254844.44892055, 48965082.7010442, 140254903.27781755, 48965028.487015784, 140254872.3926466, 48965056.9493807, 140254875.33409148, 48965054.23867928, 1, 2, 140254758.4116587, 48965161.989060774, 36 },
-  { 140254893.5254437, 48965076.92980227, 140254863.67557985, 48965103.55658631, 140254923.37530756, 48965050.30301823, 140254892.03295052, 48965078.26114147, 140254895.0179369, 48965075.598463066, 0, 0, 0, 0, 0 },
-  { 140254912.8521032, 48965098.59588683, 140254882.5581454, 48965124.7163026, 140254943.146061, 48965072.47547105, 140254911.33740532, 48965099.901907615, 140254914.36680108, 48965097.28986604, 0, 0, 0, 0, 0 },
-  { 140254931.82851285, 48965120.60436318, 140254901.08314088, 48965146.19190122, 140254962.57388481, 48965095.01682514, 140254930.29124424, 48965121.88374008, 140254933.36578146, 48965119.32498628, 1, 0, 140255123.21845332, 48964961.32193889, 44 },
-  { 140254950.43981925, 48965142.96726254, 140254919.23937213, 48965167.99788577, 140254981.64026636, 48965117.9366393, 140254948.8797969, 48965144.2187937, 140254951.9998416, 48965141.715731375, 1, 4, 140254702.39626467, 48965341.960717276, 42 },
-  { 140254968.66813397, 48965165.68869317, 140254937.01423216, 48965190.14335532, 140255000.3220358, 48965141.23403103, 140254967.08543888, 48965166.91142628, 140254970.25082907, 48965164.46596006, 1, 5, 140255137.22516108, 48965035.46761724, 45 },
-  { 140254986.48918942, 48965188.7561122, 140254954.38389286, 48965212.61507141, 140255018.59448597, 48965164.897153, 140254984.8839246, 48965189.949060164, 140254988.09445423, 48965187.56316424, 0, 0, 0, 0, 0 },
-  { 140255003.8779127, 48965212.1548746, 140254971.3231881, 48965235.39686046, 140255036.4326373, 48965188.91288874, 140255002.25017646, 48965213.316973895, 140255005.50564894, 48965210.992775306, 1, 2, 140255313.14779636, 48964991.35600898, 47 },
-  { 140255020.80923098, 48965235.87033537, 140254987.8070646, 48965258.47248158, 140255053.81139737, 48965213.26818916, 140255019.15912268, 48965237.00044268, 140255022.4593393, 48965234.74022806, 0, 0, 0, 0, 0 },
-  { 140255037.2580713, 48965259.887849465, 140255003.81059098, 48965281.825626485, 140255070.70555162, 48965237.950072445, 140255035.5856973, 48965260.98473831, 140255038.9304453, 48965258.79096062, 0, 0, 0, 0, 0 },
-  { 140255053.19936085, 48965284.192771874, 140255019.30896848, 48965305.439920045, 140255087.0897532, 48965262.9456237, 140255051.50484124, 48965285.255129285, 140255054.89388046, 48965283.13041446, 1, 2, 140254898.9980756, 48965380.86729606, 46 },
-  { 140255068.60802665, 48965308.77045758, 140255034.27754328, 48965329.29892346, 140255102.93851003, 48965288.2419917, 140255066.8915025, 48965309.79688087, 140255070.3245508, 48965307.74403429, 0, 0, 0, 0, 0 },
-  { 140255083.45899597, 48965333.60626159, 140255048.69182053, 48965353.386138014, 140255118.2261714, 48965313.82638516, 140255081.7206372, 48965334.59525541, 140255085.19735473, 48965332.617267765, 0, 0, 0, 0, 0 },
-  { 140255097.72719574, 48965358.685538836, 140255062.52748016, 48965377.6850131, 140255132.92691132, 48965339.68606457, 140255095.96720996, 48965359.635512546, 140255099.4871815, 48965357.735565126, 0, 0, 0, 0, 0 },
-  { 140255111.38755324, 48965383.993644334, 140255075.7779456, 48965402.21329978, 140255146.99716088, 48965365.77398889, 140255109.60707286, 48965384.90462711, 140255113.16803363, 48965383.08266156, 1, 4, 140254909.30302995, 48965487.39018899, 46 },
-  { 140255124.4452184, 48965409.51434282, 140255088.53871325, 48965427.14167631, 140255160.35172358, 48965391.88700934, 140255122.64989316, 48965410.3957095, 140255126.24054366, 48965408.632976145, 0, 0, 0, 0, 0 },
-  { 140255137.06616172, 48965435.22293718, 140255100.9978222, 48965452.516718835, 140255173.13450125, 48965417.92915553, 140255135.26274475, 48965436.08762626, 140255138.8695787, 48965434.3582481, 1, 1, 140254818.7630654, 48965587.84056025, 43 },
-  { 140255149.46963426, 48965461.09192686, 140255113.3678553, 48965478.31579277, 140255185.57141322, 48965443.86806095, 140255147.66454533, 48965461.95312016, 140255151.2747232, 48965460.23073356, 1, 2, 140255318.24545082, 48965380.57035372, 35 },
-  { 140255161.87492156, 48965487.09380948, 140255125.86521873, 48965504.509357214, 140255197.8846244, 48965469.67826174, 140255160.07443643, 48965487.96458686, 140255163.6754067, 48965486.223032095, 0, 0, 0, 0, 0 },
-  { 140255174.50130907, 48965513.201082624, 140255138.7101227, 48965531.061401166, 140255210.29249543, 48965495.34076408, 140255172.71174976, 48965514.09409855, 140255176.29086837, 48965512.308066696, 0, 0, 0, 0, 0 },
-  { 140255187.56808248, 48965539.386243954, 140255152.12594926, 48965557.92957683, 140255223.0102157, 48965520.84291108, 140255185.79597583, 48965540.313410595, 140255189.34018913, 48965538.45907731, 1, 4, 140254950.10579002, 48965663.626574196, 32 },
-  { 140255201.29452723, 48965565.62179107, 140255166.8112354, 48965585.8925233, 140255235.77781907, 48965545.35105884, 140255199.57036263, 48965566.63532768, 140255203.01869184, 48965564.60825446, 0, 0, 0, 0, 0 },
-  { 140255216.356885, 48965591.24492456, 140255188.32220295, 48965619.77660175, 140255244.39156702, 48965562.71324737, 140255214.95515087, 48965592.67150842, 140255217.7586191, 48965589.818340704, 1, 4, 140254944.42046922, 48965868.00219326, 44 },
-  { 140255236.6197719, 48965611.15485092, 140255220.50250986, 48965647.764055565, 140255252.73703393, 48965574.54564628, 140255235.8139088, 48965612.98531116, 140255237.425635, 48965609.32439069, 1, 0, 140255281.34517404, 48965509.56430805, 33 },
-  { 140255263.36547577, 48965622.92969067, 140255251.05645365, 48965660.98869715, 140255275.6744979, 48965584.870684184, 140255262.75002468, 48965624.83264099, 140255263.98092687, 48965621.02674034, 1, 5, 140255211.35985732, 48965783.72899306, 35 },
-  { 140255291.29203495, 48965631.96168247, 140255281.42752174, 48965670.72624591, 140255301.15654817, 48965593.19711903, 140255290.7988093, 48965633.89991064, 140255291.78526062, 48965630.02345429, 0, 0, 0, 0, 0 },
-  { 140255319.4403446, 48965639.12465163, 140255312.35175645, 48965678.49154023, 140255326.52893275, 48965599.757763036, 140255319.0859152, 48965641.09299606, 140255319.794774, 48965637.156307206, 0, 0, 0, 0, 0 },
-  { 140255347.84138584, 48965644.23867745, 140255343.81555912, 48965684.035570785, 140255351.86721256, 48965604.44178411, 140255347.64009452, 48965646.228522114, 140255348.04267716, 48965642.248832785, 1, 2, 140255378.53831467, 48965340.78736577, 46 },
-  { 140255376.52441865, 48965647.14023359, 140255374.79014257, 48965687.102619484, 140255378.25869474, 48965607.1778477, 140255376.43770486, 48965649.138352886, 140255376.61113244, 48965645.1421143, 0, 0, 0, 0, 0 },
-  { 140255405.44212794, 48965648.39519598, 140255403.8175701, 48965688.36219252, 140255407.0666858, 48965608.42819945, 140255405.36090004, 48965650.39354581, 140255405.52335584, 48965646.39684616, 1, 0, 140255414.45842397, 48965426.57836523, 36 },
-  { 140255434.44174048, 48965649.573957264, 140255430.66734448, 48965689.395483285, 140255438.2161365, 48965609.75243124, 140255434.25302067, 48965651.56503356, 140255434.6304603, 48965647.58288097, 0, 0, 0, 0, 0 },
-  { 140255463.3624803, 48965652.31514616, 140255455.981691, 48965691.628298536, 140255470.74326962, 48965613.00199379, 140255462.99344084, 48965654.280803785, 140255463.7315198, 48965650.34948854, 0, 0, 0, 0, 0 },
-  { 140255492.0071895, 48965657.693004474, 140255481.0413085, 48965696.160516135, 140255502.97307053, 48965619.22549281, 140255491.45889547, 48965659.61638006, 140255492.55548355, 48965655.76962889, 0, 0, 0, 0, 0 },
-  { 140255520.10923576, 48965665.70401643, 140255505.72011662, 48965703.02630535, 140255534.4983549, 48965628.38172752, 140255519.3897798, 48965667.57013088, 140255520.82869172, 48965663.83790199, 0, 0, 0, 0, 0 },
-  { 140255547.3941671, 48965676.22336397, 140255529.71834883, 48965712.1060262, 140255565.06998536, 48965640.340701744, 140255546.5103762, 48965678.017497085, 140255548.277958, 48965674.42923086, 0, 0, 0, 0, 0 },
-  { 140255573.5875317, 48965689.12622914, 140255552.7522554, 48965723.271379046, 140255594.42280796, 48965654.98107923, 140255572.54576787, 48965690.83348663, 140255574.6292955, 48965687.41897164, 0, 0, 0, 0, 0 },
-  { 140255598.4250809, 48965704.28203315, 140255574.7545182, 48965736.52648171, 140255622.09564358, 48965672.037584595, 140255597.24155277, 48965705.89425558, 140255599.60860902, 48965702.66981073, 0, 0, 0, 0, 0 },
-  { 140255621.82295612, 48965721.45835021, 140255595.79510215, 48965751.831871875, 140255647.85081008, 48965691.08482855, 140255620.5215634, 48965722.97702629, 140255623.12434882, 48965719.93967413, 0, 0, 0, 0, 0 },
-  { 140255643.85186273, 48965740.33548836, 140255615.89207137, 48965768.94055902, 140255671.8116541, 48965711.73041769, 140255642.45387316, 48965741.76574189, 140255645.2498523, 48965738.90523482, 0, 0, 0, 0, 0 },
-  { 140255664.5875513, 48965760.603416815, 140255634.99882993, 48965787.52009506, 140255694.17627266, 48965733.68673857, 140255663.10811523, 48965761.94925073, 140255666.06698737, 48965759.2575829, 0, 0, 0, 0, 0 },
-  { 140255684.10616526, 48965782.059661336, 140255653.1284763, 48965807.36544698, 140255715.08385423, 48965756.753875695, 140255682.5572808, 48965783.32495062, 140255685.6550497, 48965780.79437205, 0, 0, 0, 0, 0 },
-  { 140255702.48404875, 48965804.55666525, 140255670.33327794, 48965828.354310855, 140255734.63481957, 48965780.75901964, 140255700.8765102, 48965805.74654753, 140255704.0915873, 48965803.36678297, 0, 0, 0, 0, 0 },
-  { 140255719.7975473, 48965827.947312094, 140255686.6645364, 48965850.35721139, 140255752.93055823, 48965805.5374128, 140255718.14089677, 48965829.067807056, 140255721.45419785, 48965826.82681713, 0, 0, 0, 0, 0 },
-  { 140255736.1230067, 48965852.084485464, 140255702.17436305, 48965873.23843528, 140255770.07165036, 48965830.930535644, 140255734.4255745, 48965853.14218295, 140255737.8204389, 48965851.026787974, 0, 0, 0, 0, 0 },
-  { 140255751.53677258, 48965876.82106893, 140255716.91697726, 48965896.85777952, 140255786.1565679, 48965856.78435834, 140255749.80578282, 48965877.82290446, 140255753.26776233, 48965875.819233395, 1, 5, 140255459.8649969, 48966045.63035564, 41 },
-  { 140255766.1154488, 48965902.01037257, 140255730.9508259, 48965921.07471875, 140255801.2800717, 48965882.94602639, 140255764.35721767, 48965902.963589884, 140255767.87367994, 48965901.05715526, 0, 0, 0, 0, 0 },
-  { 140255779.9547245, 48965927.53723336, 140255744.35961094, 48965945.78518918, 140255815.54983804, 48965909.28927754, 140255778.1749688, 48965928.449631155, 140255781.73448017, 48965926.624835566, 0, 0, 0, 0, 0 },
-  { 140255793.18214577, 48965953.33911315, 140255757.26070812, 48965970.93599686, 140255829.10358343, 48965935.74222945, 140255791.3860739, 48965954.21895734, 140255794.97821766, 48965952.459268965, 0, 0, 0, 0, 0 },
-  { 140255805.92828384, 48965979.358470425, 140255769.77594346, 48965996.475955166, 140255842.08062422, 48965962.240985684, 140255804.12066683, 48965980.214344665, 140255807.73590085, 48965978.502596185, 1, 0, 140255476.03817773, 48966135.5555187, 25 },
-  { 140255818.3237096, 48966005.53776361, 140255782.02916032, 48966022.35161778, 140255854.6182589, 48965988.72390944, 140255816.50898215, 48966006.37845632, 140255820.13843706, 48966004.697070904, 1, 1, 140256173.10292885, 48965841.182339035, 45 },
-  { 140255830.49899405, 48966031.81945112, 140255794.14654553, 48966048.507754974, 140255866.85144258, 48966015.13114727, 140255828.68137163, 48966032.65386631, 140255832.31661648, 48966030.98503593, 1, 0, 140255473.33618718, 48966195.78203647, 27 },
-  { 140255842.58470827, 48966058.145991445, 140255806.25681025, 48966074.8876707, 140255878.9126063, 48966041.404312186, 140255840.76831338, 48966058.98307541, 140255844.40110317, 48966057.30890748, 0, 0, 0, 0, 0 },
-  { 140255854.7114232, 48966084.459843, 140255818.49125683, 48966101.43333852, 140255890.93158954, 48966067.48634748, 140255852.90041488, 48966085.30851778, 140255856.5224315, 48966083.61116823, 1, 2, 140255712.5472703, 48966151.080812916, 25 },
-  { 140255867.0097098, 48966110.70346421, 140255830.98182866, 48966128.08137491, 140255903.03759095, 48966093.32555351, 140255865.20831576, 48966111.57235975, 140255868.81110385, 48966109.83456867, 1, 5, 140256111.09860456, 48965992.96811921, 46 },
-  { 140255879.60719547, 48966136.820569076, 140255843.7896123, 48966154.62789159, 140255915.42477864, 48966119.01324656, 140255877.8163163, 48966137.7109352, 140255881.39807463, 48966135.93020295, 0, 0, 0, 0, 0 },
-  { 140255892.52372977, 48966162.80083879, 140255856.84281984, 48966180.88045896, 140255928.2046397, 48966144.72121862, 140255890.73968428, 48966163.7048198, 140255894.30777526, 48966161.89685778, 1, 3, 140256094.12087095, 48966060.65098483, 26 },
-  { 140255905.64289328, 48966188.69207364, 140255870.015741, 48966206.87739795, 140255941.27004558, 48966170.50674934, 140255903.86153567, 48966189.60133986, 140255907.4242509, 48966187.782807425, 1, 3, 140255791.63600597, 48966246.88511141, 39 },
-  { 140255918.8395257, 48966214.5458019, 140255883.18180832, 48966232.671121, 140255954.49724308, 48966196.4204828, 140255917.05663982, 48966215.45206785, 140255920.62241158, 48966213.63953595, 0, 0, 0, 0, 0 },
-  { 140255931.98846665, 48966240.41355173, 140255896.21658877, 48966258.31251127, 140255967.76034454, 48966222.51459219, 140255930.19987276, 48966241.30849971, 140255933.77706054, 48966239.51860376, 1, 1, 140255813.0469727, 48966299.92759221, 28 },
-  { 140255944.96455595, 48966266.346851416, 140255908.99782535, 48966283.85097353, 140255980.93128654, 48966248.8427293, 140255943.1662194, 48966267.22205752, 140255946.76289248, 48966265.47164531, 0, 0, 0, 0, 0 },
-  { 140255957.64263332, 48966292.39722916, 140255921.4055783, 48966309.334638745, 140255993.87968835, 48966275.45981957, 140255955.83078057, 48966293.24409964, 140255959.45448607, 48966291.550358675, 1, 3, 140255631.50913814, 48966444.83391544, 47 },
-  { 140255969.89753845, 48966318.616213195, 140255933.32244644, 48966334.8107383, 140256006.47263047, 48966302.42168809, 140255968.06878385, 48966319.42593945, 140255971.72629306, 48966317.80648694, 1, 3, 140256183.8618268, 48966223.87824132, 36 },
-  { 140255981.60411102, 48966345.05533172, 140255944.63624945, 48966360.332020245, 140256018.57197258, 48966329.7786432, 140255979.75571793, 48966345.819166146, 140255983.4525041, 48966344.2914973, 0, 0, 0, 0, 0 },
-  { 140255992.64139903, 48966371.764322646, 140255955.28746757, 48966386.07109746, 140256029.99533048, 48966357.45754783, 140255990.77370244, 48966372.47966139, 140255994.5090956, 48966371.0489839, 0, 0, 0, 0, 0 },
-  { 140256002.97879106, 48966398.754489064, 140255965.29301184, 48966412.16277173, 140256040.66457027, 48966385.3462064, 140256001.0945021, 48966399.4249032, 140256004.86308002, 48966398.08407493, 0, 0, 0, 0, 0 },
-  { 140256012.6725727, 48966426.000164285, 140255974.70537534, 48966438.58952186, 140256050.63977006, 48966413.41080671, 140256010.77421284, 48966426.62963217, 140256014.57093257, 48966425.3706964, 0, 0, 0, 0, 0 },
-  { 140256021.78254887, 48966453.47418441, 140255983.57885817, 48966465.32652668, 140256059.98623958, 48966441.62184214, 140256019.87236434, 48966454.066801526, 140256023.6927334, 48966452.88156729, 0, 0, 0, 0, 0 },
-  { 140256030.3685245, 48966481.14938559, 140255991.96818766, 48966492.34823069, 140256068.76886132, 48966469.95054048, 140256028.44850764, 48966481.70932784, 140256032.28854135, 48966480.58944333, 0, 0, 0, 0, 0 },
-  { 140256038.49030435, 48966508.9986039, 140255999.92859995, 48966519.62851234, 140256077.05200875, 48966498.36869547, 140256036.56221914, 48966509.530099325, 140256040.41838956, 48966508.46710848, 1, 1, 140255833.1492284, 48966565.60286632, 40 },
-  { 140256046.20769346, 48966536.99467549, 140256007.51589295, 48966547.14083597, 140256084.89949396, 48966526.848515004, 140256044.27310345, 48966537.50198351, 140256048.14228347, 48966536.487367466, 1, 5, 140256188.40006036, 48966499.7075357, 34 },
-  { 140256053.58049646, 48966565.11043646, 140256014.78645766, 48966574.85838768, 140256092.37453526, 48966555.362485245, 140256051.64079452, 48966565.59783402, 140256055.5201984, 48966564.6230389, 1, 2, 140255896.46463928, 48966604.58963888, 50 },
-  { 140256060.66851845, 48966593.318722926, 140256021.79729488, 48966602.75418679, 140256099.53974202, 48966583.883259065, 140256058.7249573, 48966593.79049612, 140256062.61207962, 48966592.846949734, 1, 0, 140256246.278611, 48966548.264383, 33 },
-  { 140256067.53156418, 48966621.59237101, 140256028.60602206, 48966630.80118041, 140256106.4571063, 48966612.38356161, 140256065.58528706, 48966622.05281148, 140256069.4778413, 48966621.13193054, 0, 0, 0, 0, 0 },
-  { 140256074.22943857, 48966649.90421683, 140256035.27060628, 48966658.971156076, 140256113.18827087, 48966640.83727759, 140256072.28149697, 48966650.35756379, 140256076.17738017, 48966649.45086987, 0, 0, 0, 0, 0 },
-  { 140256080.8211355, 48966678.22742579, 140256041.8382314, 48966687.190304175, 140256119.80403957, 48966669.26454741, 140256078.8719903, 48966678.67556971, 140256082.7702807, 48966677.77928187, 1, 3, 140255925.86409175, 48966713.85486737, 50 },
-  { 140256087.33267745, 48966706.548552655, 140256048.3204095, 48966715.382744744, 140256126.3449454, 48966697.714360565, 140256085.38206404, 48966706.99026226, 140256089.28329086, 48966706.10684305, 0, 0, 0, 0, 0 },
-  { 140256093.7463992, 48966734.87189321, 140256054.6987519, 48966743.54836942, 140256132.7940465, 48966726.195417, 140256091.79401684, 48966735.30571702, 140256095.69878155, 48966734.4380694, 0, 0, 0, 0, 0 },
-  { 140256100.0416278, 48966763.2029645, 140256060.95292917, 48966771.69258399, 140256139.13032642, 48966754.713345006, 140256098.08719286, 48966763.627445474, 140256101.99606273, 48966762.778483525, 1, 3, 140256456.7260028, 48966685.7351866, 35 },
-  { 140256106.1976906, 48966791.5472836, 140256067.06268057, 48966799.820794955, 140256145.33270064, 48966783.27377224, 140256104.2409401, 48966791.96095917, 140256108.15444112, 48966791.13360803, 1, 4, 140255898.78213745, 48966835.39689378, 43 },
-  { 140256112.1939149, 48966819.91036759, 140256073.00781456, 48966827.938414715, 140256151.38001522, 48966811.88232047, 140256110.23460987, 48966820.31176995, 140256114.1532199, 48966819.50896524, 1, 1, 140256486.42117307, 48966743.24251757, 39 },
-  { 140256118.00962785, 48966848.29773354, 140256078.76820943, 48966856.05086709, 140256157.25104627, 48966840.54459999, 140256116.04755694, 48966848.68539022, 140256119.97169876, 48966847.91007686, 0, 0, 0, 0, 0 },
-  { 140256123.62415668, 48966876.71489852, 140256084.32381395, 48966884.163593754, 140256162.92449942, 48966869.266203284, 140256121.65913954, 48966877.087333284, 140256125.58917382, 48966876.342463754, 1, 0, 140256289.66810474, 48966845.24416115, 32 },
-  { 140256129.01682875, 48966905.16737961, 140256089.65464744, 48966912.282060474, 140256168.37901005, 48966898.05269875, 140256127.04871967, 48966905.52311365, 140256130.98493782, 48966904.81164557, 0, 0, 0, 0, 0 },
-  { 140256134.16697112, 48966933.66069387, 140256094.74079934, 48966940.41176621, 140256173.5931429, 48966926.90962153, 140256132.19566253, 48966933.99824749, 140256136.1382797, 48966933.32314025, 0, 0, 0, 0, 0 },
-  { 140256139.0539112, 48966962.20035838, 140256099.56242839, 48966968.55824992, 140256178.54539403, 48966955.842466846, 140256137.07933706, 48966962.51825296, 140256141.02848536, 48966961.882463805, 0, 0, 0, 0, 0 },
-  { 140256143.6569761, 48966990.79189019, 140256104.09976095, 48966996.72710122, 140256183.21419126, 48966984.85667916, 140256141.67911536, 48966991.08865074, 140256145.63483685, 48966990.49512964, 1, 0, 140256284.08508986, 48966969.721891016, 45 },
-  { 140256147.95549315, 48967019.44080641, 140256108.33308876, 48967024.92396874, 140256187.57789755, 48967013.95764408, 140256145.97437292, 48967019.714964524, 140256149.93661338, 48967019.1666483, 1, 1, 140255924.08890826, 48967050.420673564, 37 },
-  { 140256151.92878956, 48967048.15262407, 140256112.24286744, 48967053.155381925, 140256191.61471167, 48967043.149866216, 140256149.94449344, 48967048.402761966, 140256153.91308567, 48967047.902486175, 1, 4, 140256516.04712492, 48967002.25232072, 39 },
-  { 140256155.5567212, 48967076.93231262, 140256115.81125584, 48967081.43764082, 140256195.30218658, 48967072.42698442, 140256153.56944793, 48967077.157579035, 140256157.5439945, 48967076.70704621, 0, 0, 0, 0, 0 },
-  { 140256158.82643026, 48967105.777293965, 140256119.02681684, 48967109.77614034, 140256198.62604368, 48967101.77844759, 140256156.8364496, 48967105.977236286, 140256160.81641093, 48967105.577351645, 1, 3, 140256533.93778667, 48967068.088166855, 30 },
-  { 140256161.73036444, 48967134.67949396, 140256121.88231656, 48967138.16275095, 140256201.57841232, 48967131.196236975, 140256159.73796204, 48967134.85365681, 140256163.72276685, 48967134.505331114, 0, 0, 0, 0, 0 },
-  { 140256164.26109168, 48967163.63071417, 140256124.37063804, 48967166.58904275, 140256204.15154532, 48967160.67238559, 140256162.266569, 48967163.7786306, 140256166.25561437, 48967163.48279774, 0, 0, 0, 0, 0 },
-  { 140256166.4111797, 48967192.62275605, 140256126.48468477, 48967195.04659638, 140256206.33767462, 48967190.19891572, 140256164.41485494, 48967192.743948065, 140256168.40750444, 48967192.50156403, 1, 5, 140255988.73827723, 48967203.40884551, 35 },
-  { 140256168.17319646, 48967221.64742116, 140256128.21738124, 48967223.52700332, 140256208.1290117, 48967219.767839, 140256166.1754057, 48967221.741400264, 140256170.17098722, 48967221.55344205, 1, 2, 140256409.90587863, 48967210.27594908, 49 },
-  { 140256169.53970972, 48967250.69651098, 140256129.56167293, 48967252.02186881, 140256209.5177465, 48967249.371153146, 140256167.54080787, 48967250.76277887, 140256171.53861156, 48967250.630243085, 1, 1, 140255869.7044337, 48967260.63669471, 46 },
-  { 140256170.5032874, 48967279.76182705, 140256130.5105268, 48967280.522812486, 140256210.496048, 48967279.00084162, 140256168.50364938, 48967279.799876325, 140256172.50292543, 48967279.72377778, 0, 0, 0, 0, 0 },
-  { 140256171.0564973, 48967308.835170865, 140256131.05693117, 48967309.02147115, 140256211.05606344, 48967308.64887058, 140256169.056519, 48967308.84448588, 140256173.0564756, 48967308.82585585, 1, 1, 140255819.0603152, 48967310.47461339, 49 },
-  { 140256171.1919073, 48967337.90834394, 140256131.1938958, 48967337.50950053, 140256211.1899188, 48967338.30718735, 140256169.1920067, 48967337.88840177, 140256173.19180787, 48967337.92828611, 1, 5, 140256290.1859915, 48967339.094903074, 39 },
-  { 140256170.90208524, 48967366.97314781, 140256130.91445178, 48967365.97857733, 140256210.8897187, 48967367.96771829, 140256168.90270358, 48967366.92341929, 140256172.9014669, 48967367.02287633, 0, 0, 0, 0, 0 },
-  { 140256170.17959893, 48967396.021383956, 140256130.21165106, 48967394.42040229, 140256210.1475468, 48967397.62236562, 140256168.18120155, 48967395.94133487, 140256172.1779963, 48967396.10143304, 1, 5, 140256315.06340998, 48967401.82494251, 50 },
-  { 140256169.01701626, 48967425.04485392, 140256129.0785661, 48967422.826702, 140256208.95546642, 48967427.26300584, 140256167.02009374, 48967424.93394632, 140256171.01393878, 48967425.15576152, 0, 0, 0, 0, 0 },
-  { 140256167.40690508, 48967454.03535919, 140256127.50828907, 48967451.18923211, 140256207.3055211, 48967456.88148627, 140256165.41197428, 48967453.89305284, 140256169.4018359, 48967454.17766554, 0, 0, 0, 0, 0 },
-  { 140256165.3418333, 48967482.98470131, 140256125.49393094, 48967479.499779716, 140256205.18973565, 48967486.46962291, 140256163.3494382, 48967482.81045523, 140256167.3342284, 48967483.15894739, 0, 0, 0, 0, 0 },
-  { 140256162.8143686, 48967511.884681754, 140256123.02862006, 48967507.75016695, 140256202.60011715, 48967516.019196555, 140256160.82508117, 48967511.677956015, 140256164.80365604, 48967512.09140749, 0, 0, 0, 0, 0 },
-  { 140256159.81707892, 48967540.72710208, 140256120.10522464, 48967535.934542224, 140256199.5289332, 48967545.51966193, 140256157.8314862, 48967540.487474084, 140256161.80267164, 48967540.96673007, 1, 3, 140255772.6264997, 48967493.999643534, 49 },
-  { 140256156.34414983, 48967569.5043022, 140256116.71473, 48967564.0720758, 140256195.97356966, 48967574.93652861, 140256154.36267883, 48967569.232690886, 140256158.32562083, 48967569.77591352, 0, 0, 0, 0, 0 },
-  { 140256152.40862748, 48967598.214899994, 140256112.86666992, 48967592.17887544, 140256191.95058504, 48967604.25092455, 140256150.4315296, 48967597.91309877, 140256154.38572535, 48967598.51670122, 1, 5, 140255857.82104367, 48967553.24651705, 50 },
-  { 140256148.03575298, 48967626.861572355, 140256108.5846009, 48967620.25804308, 140256187.48690507, 48967633.46510163, 140256146.06319538, 48967626.53139589, 140256150.0083106, 48967627.19174882, 0, 0, 0, 0, 0 },
-  { 140256143.25097173, 48967655.447064266, 140256103.89241818, 48967648.31234206, 140256182.6095253, 48967662.58178647, 140256141.28304407, 48967655.09032816, 140256145.2188994, 48967655.803800374, 0, 0, 0, 0, 0 },
-  { 140256138.0797293, 48967683.9741207, 140256098.8154163, 48967676.337778315, 140256177.34404227, 48967691.61046308, 140256136.11651364, 48967683.59230358, 140256140.04294494, 48967684.355937816, 0, 0, 0, 0, 0 },
-  { 140256132.5428356, 48967712.44355228, 140256093.38213533, 48967704.292506024, 140256171.70353585, 48967720.59459853, 140256130.58480057, 48967712.03599997, 140256134.50087062, 48967712.85110459, 1, 5, 140255825.13133854, 48967648.4578392, 27 },
-  { 140256126.63150385, 48967740.84381936, 140256087.58812478, 48967732.14815664, 140256165.67488292, 48967749.53948207, 140256124.6793349, 48967740.40903622, 140256128.5836728, 48967741.278602496, 1, 2, 140256297.44628733, 48967778.88734374, 28 },
-  { 140256120.32530946, 48967769.15852594, 140256081.41436362, 48967759.888234995, 140256159.2362553, 48967778.42881688, 140256118.37976217, 48967768.69501139, 140256122.27085674, 48967769.62204048, 0, 0, 0, 0, 0 },
-  { 140256113.6037999, 48967797.37126442, 140256074.84188765, 48967787.496338636, 140256152.36571217, 48967807.246190205, 140256111.6657043, 48967796.87751813, 140256115.5418955, 48967797.86501071, 0, 0, 0, 0, 0 },
-  { 140256106.4465228, 48967825.46562717, 140256067.85182327, 48967814.95614729, 140256145.04122233, 48967835.97510705, 140256104.51678783, 48967824.940153174, 140256108.37625778, 48967825.99110117, 1, 0, 140255841.10796347, 48967753.21295298, 46 },
-  { 140256098.83302557, 48967853.42520664, 140256060.42538288, 48967842.25144346, 140256137.24066827, 48967864.59896982, 140256096.91264343, 48967852.86651848, 140256100.75340772, 48967853.983894795, 0, 0, 0, 0, 0 },
-  { 140256090.74285585, 48967881.23359519, 140256052.5410651, 48967869.37513054, 140256128.9446466, 48967893.09205984, 140256088.83276632, 48967880.64067196, 140256092.65294537, 48967881.826518424, 0, 0, 0, 0, 0 },
-  { 140256082.16174966, 48967908.8774456, 140256044.1632139, 48967896.38299559, 140256120.1602854, 48967921.37189561, 140256080.26182288, 48967908.2527231, 140256084.06167644, 48967909.502168104, 0, 0, 0, 0, 0 },
-  { 140256073.12284797, 48967936.366853185, 140256035.31158096, 48967923.31663915, 140256110.934115, 48967949.41706722, 140256071.23228464, 48967935.71434248, 140256075.0134113, 48967937.01936389, 0, 0, 0, 0, 0 },
-  { 140256063.681209, 48967963.72275182, 140256026.03760868, 48967950.19650495, 140256101.3248093, 48967977.24899869, 140256061.799029, 48967963.04643948, 140256065.563389, 48967964.39906416, 0, 0, 0, 0, 0 },
-  { 140256053.89200953, 48967990.96613397, 140256016.39346948, 48967977.042790435, 140256091.39054957, 48968004.8894775, 140256052.0170825, 48967990.26996679, 140256055.76693654, 48967991.662301145, 1, 5, 140255895.46067786, 48967932.14000754, 31 },
-  { 140256043.81042638, 48968018.117992155, 140256006.4318786, 48968003.875655115, 140256081.18897417, 48968032.360329196, 140256041.941499, 48968017.4058753, 140256045.67935377, 48968018.83010901, 0, 0, 0, 0, 0 },
-  { 140256033.49163646, 48968045.19931888, 140255996.20607433, 48968030.715298176, 140256070.77719858, 48968059.68333958, 140256031.62735835, 48968044.47511784, 140256035.35591456, 48968045.92351992, 0, 0, 0, 0, 0 },
-  { 140256022.99081653, 48968072.23110665, 140255985.76979744, 48968057.582020074, 140256060.21183562, 48968086.88019322, 140256021.12976557, 48968071.49865232, 140256024.8518675, 48968072.963560976, 0, 0, 0, 0, 0 },
-  { 140256012.36314353, 48968099.23434796, 140255975.1772729, 48968084.49626719, 140256049.54901418, 48968113.97242873, 140256010.50385, 48968098.49744392, 140256014.22243705, 48968099.971252, 0, 0, 0, 0, 0 },
-  { 140256001.6637942, 48968126.23003532, 140255964.48319444, 48968111.478662424, 140256038.84439394, 48968140.981408216, 140255999.8047642, 48968125.49246667, 140256003.52282417, 48968126.96760397, 0, 0, 0, 0, 0 },
-  { 140255990.94794533, 48968153.2391612, 140255953.74457368, 48968138.545314275, 140256028.15131697, 48968167.93300813, 140255989.08777675, 48968152.50446885, 140255992.8081139, 48968153.97385355, 0, 0, 0, 0, 0 },
-  { 140255980.26740617, 48968180.28123329, 140255943.0376719, 48968165.654309995, 140256017.49714044, 48968194.90815658, 140255978.40591946, 48968179.54988712, 140255982.12889287, 48968181.012579456, 0, 0, 0, 0, 0 },
-  { 140255969.63004413, 48968207.35638464, 140255932.38724786, 48968192.76275159, 140256006.8728404, 48968221.9500177, 140255967.7679043, 48968206.62670299, 140255971.49218395, 48968208.0860663, 0, 0, 0, 0, 0 },
-  { 140255959.01292244, 48968234.45116624, 140255921.77060246, 48968219.85631769, 140255996.2552424, 48968249.04601479, 140255957.15080643, 48968233.72142381, 140255960.87503844, 48968235.18090867, 0, 0, 0, 0, 0 },
-  { 140255948.39246818, 48968261.55184865, 140255911.16415697, 48968246.92130372, 140255985.6207794, 48968276.18239358, 140255946.53105262, 48968260.8203214, 140255950.25388375, 48968262.2833759, 0, 0, 0, 0, 0 },
-  { 140255937.74510863, 48968288.64470244, 140255900.5444402, 48968273.94401306, 140255974.94577706, 48968303.345391825, 140255935.8850752, 48968287.909667976, 140255939.60514206, 48968289.37973691, 0, 0, 0, 0, 0 },
-  { 140255927.047271, 48968315.7159982, 140255889.888088, 48968300.91075868, 140255964.20645404, 48968330.52123772, 140255925.18931186, 48968314.97573622, 140255928.90523016, 48968316.45626018, 1, 2, 140255803.49298745, 48968266.4885768, 50 },
-  { 140255916.27538246, 48968342.752006486, 140255879.17184255, 48968327.807866335, 140255953.37892237, 48968357.69614664, 140255914.42020547, 48968342.00479948, 140255918.13055944, 48968343.499213494, 0, 0, 0, 0, 0 },
-  { 140255905.4058702, 48968369.738997914, 140255868.37255204, 48968354.621678494, 140255942.43918836, 48968384.856317334, 140255903.5542043, 48968368.983131945, 140255907.2575361, 48968370.49486388, 0, 0, 0, 0, 0 },
-  { 140255894.41516146, 48968396.66324302, 140255857.46716967, 48968381.3385602, 140255931.36315325, 48968411.987925835, 140255892.56776187, 48968395.89700888, 140255896.26256105, 48968397.429477155, 1, 1, 140256009.87763578, 48968444.552876815, 38 },
-  { 140255883.27968344, 48968423.51101242, 140255846.43275216, 48968407.94490641, 140255920.12661472, 48968439.07711843, 140255881.4373369, 48968422.73270712, 140255885.12203, 48968424.28931772, 0, 0, 0, 0, 0 },
-  { 140255871.97586337, 48968450.26857666, 140255835.24645808, 48968434.427150376, 140255908.70526865, 48968466.11000294, 140255870.1393931, 48968449.47650535, 140255873.81233364, 48968451.06064797, 0, 0, 0, 0, 0 },
-  { 140255860.48012838, 48968476.922206335, 140255823.88554493, 48968460.77177408, 140255897.07471183, 48968493.072638586, 140255858.6503992, 48968476.11468472, 140255862.30985755, 48968477.729727946, 0, 0, 0, 0, 0 },
-  { 140255848.7689057, 48968503.458172, 140255812.32736596, 48968486.96531955, 140255885.21044543, 48968519.95102445, 140255846.94682872, 48968502.63352938, 140255850.59098268, 48968504.28281462, 0, 0, 0, 0, 0 },
-  { 140255836.81862265, 48968529.86274428, 140255800.54936567, 48968512.99440119, 140255873.08787963, 48968546.73108737, 140255835.0051598, 48968529.01932713, 140255838.6320855, 48968530.70616143, 1, 4, 140255527.62320697, 48968386.0601194, 26 },
-  { 140255824.60570627, 48968556.1221937, 140255788.52907276, 48968538.84572084, 140255860.6823398, 48968573.39866656, 140255822.8018746, 48968555.25837006, 140255826.40953794, 48968556.98601735, 1, 1, 140256013.10611638, 48968646.391764395, 44 },
-  { 140255812.10658386, 48968582.22279086, 140255776.24409333, 48968564.50608201, 140255847.9690744, 48968599.939499706, 140255810.31345934, 48968581.33695542, 140255813.8997084, 48968583.1086263, 0, 0, 0, 0, 0 },
-  { 140255799.29768258, 48968608.15080633, 140255763.6721003, 48968589.9624065, 140255834.92326486, 48968626.33920616, 140255797.51640347, 48968607.24138634, 140255801.0789617, 48968609.06022632, 1, 0, 140256138.63135365, 48968781.39531469, 45 },
-  { 140255786.1554297, 48968633.89251071, 140255750.7908219, 48968615.20175055, 140255821.52003747, 48968652.58327088, 140255784.3871993, 48968632.957972705, 140255787.92366007, 48968634.82704872, 0, 0, 0, 0, 0 },
-  { 140255772.65625232, 48968659.43417455, 140255737.57802618, 48968640.21132225, 140255807.73447847, 48968678.65702686, 140255770.902341, 48968658.47303194, 140255774.41016364, 48968660.39531717, 0, 0, 0, 0, 0 },
-  { 140255758.77657774, 48968684.76206846, 140255724.01150432, 48968664.97849774, 140255793.54165116, 48968704.54563917, 140255757.03832406, 48968683.77288992, 140255760.51483142, 48968685.751246996, 1, 1, 140255471.09559518, 48968521.05302081, 40 },
-  { 140255744.49283314, 48968709.862462975, 140255710.06877798, 48968689.49129644, 140255778.9168883, 48968730.23362951, 140255742.77163038, 48968708.84390465, 140255746.2140359, 48968710.8810213, 0, 0, 0, 0, 0 },
-  { 140255729.78178906, 48968734.72180483, 140255695.71261552, 48968713.76252494, 140255763.8509626, 48968755.681084715, 140255728.0783304, 48968733.673840836, 140255731.48524773, 48968735.76976882, 1, 2, 140255399.31080562, 48968531.41678989, 35 },
-  { 140255714.63906205, 48968759.3362094, 140255680.91514793, 48968737.825802244, 140255748.36297616, 48968780.84661656, 140255712.95286635, 48968758.26068904, 140255716.32525775, 48968760.41172976, 1, 3, 140256011.40950638, 48968948.62779235, 35 },
-  { 140255699.08851492, 48968783.71628329, 140255665.69664678, 48968761.6939505, 140255732.48038307, 48968805.73861609, 140255697.41892153, 48968782.61516665, 140255700.75810832, 48968784.817399934, 0, 0, 0, 0, 0 },
-  { 140255683.15633082, 48968807.87382353, 140255650.08171886, 48968785.37782292, 140255716.2309428, 48968830.36982414, 140255681.50260022, 48968806.7490235, 140255684.81006142, 48968808.998623565, 0, 0, 0, 0, 0 },
-  { 140255666.8686928, 48968831.82062711, 140255634.09514, 48968808.88824306, 140255699.64224556, 48968854.75301116, 140255665.23001516, 48968830.67400791, 140255668.5073704, 48968832.96724631, 1, 0, 140255390.75151062, 48968638.61529149, 38 },
-  { 140255650.25178403, 48968855.56849105, 140255617.76184452, 48968832.23602804, 140255682.74172354, 48968878.90095406, 140255648.62728706, 48968854.4018679, 140255651.876281, 48968856.7351142, 1, 2, 140255789.95852396, 48968955.89808199, 31 },
-  { 140255633.33178765, 48968879.12921239, 140255601.10691237, 48968855.43200971, 140255665.55666292, 48968902.82641506, 140255631.7205439, 48968877.944352254, 140255634.9430314, 48968880.31407252, 0, 0, 0, 0, 0 },
-  { 140255616.13488668, 48968902.514588125, 140255584.1555567, 48968878.487052776, 140255648.11421666, 48968926.542123474, 140255614.53592017, 48968901.31321136, 140255617.7338532, 48968903.71596489, 0, 0, 0, 0, 0 },
-  { 140255598.68726432, 48968925.73641527, 140255566.93311158, 48968901.41206978, 140255630.44141707, 48968950.06076075, 140255597.09955668, 48968924.520197995, 140255600.27497196, 48968926.95263254, 0, 0, 0, 0, 0 },
-  { 140255581.01510367, 48968948.806490846, 140255549.46501946, 48968924.21803448, 140255612.56518787, 48968973.39494721, 140255579.43759945, 48968947.57706803, 140255582.5926079, 48968950.03591366, 1, 4, 140255805.02070156, 48969123.38453101, 50 },
-  { 140255563.1445878, 48968971.736611865, 140255531.77681983, 48968946.915992804, 140255594.5123558, 48968996.55723093, 140255561.5761994, 48968970.49558091, 140255564.71297622, 48968972.97764282, 0, 0, 0, 0, 0 },
-  { 140255545.1018999, 48968994.53857533, 140255513.89413843, 48968969.51707211, 140255576.30966136, 48969019.56007855, 140255543.5415118, 48968993.287500165, 140255546.66228798, 48968995.78965049, 1, 3, 140255786.18185735, 48969187.82968769, 29 },
-  { 140255526.9132231, 48969017.224178284, 140255495.84592634, 48968992.02848274, 140255557.98051983, 48969042.419873826, 140255525.35985824, 48969015.964393504, 140255528.46658793, 48969018.483963065, 1, 5, 140255416.62431967, 48968927.77945912, 25 },
-  { 140255508.60124695, 48969039.80357465, 140255477.67043972, 48969014.440507725, 140255539.5320542, 48969065.16664158, 140255507.0547066, 48969038.535421304, 140255510.1477873, 48969041.071728, 0, 0, 0, 0, 0 },
-  { 140255490.17161936, 48969062.27890306, 140255459.37811807, 48969036.74930693, 140255520.96512064, 48969087.80849919, 140255488.6319443, 48969061.00242326, 140255491.7112944, 48969063.55538286, 0, 0, 0, 0, 0 },
-  { 140255471.624799, 48969084.64986159, 140255440.96941492, 48969058.95458134, 140255502.2801831, 48969110.345141836, 140255470.0920298, 48969083.365097575, 140255473.15756822, 48969085.9346256, 1, 4, 140255556.69348985, 48969155.95426427, 28 },
-  { 140255452.9612435, 48969106.916147724, 140255422.44478166, 48969081.056032576, 140255483.47770536, 48969132.77626287, 140255451.43542042, 48969105.62314197, 140255454.4870666, 48969108.20915348, 0, 0, 0, 0, 0 },
-  { 140255434.1814104, 48969129.07745897, 140255403.8046695, 48969103.053362206, 140255464.5581513, 48969155.101555735, 140255432.66257337, 48969127.77625413, 140255435.70024744, 48969130.37866381, 0, 0, 0, 0, 0 },
-  { 140255415.28575724, 48969151.13349286, 140255385.04952982, 48969124.94627171, 140255445.52198467, 48969177.320714004, 140255413.77394587, 48969149.8241318, 140255416.79756862, 48969152.44285391, 0, 0, 0, 0, 0 },
-  { 140255396.2747416, 48969173.08394685, 140255366.17981383, 48969146.73446255, 140255426.36966935, 48969199.43343114, 140255394.7699952, 48969171.76647263, 140255397.77948797, 48969174.40142106, 0, 0, 0, 0, 0 },
-  { 140255377.14882103, 48969194.928518504, 140255347.19597295, 48969168.41763599, 140255407.1016691, 48969221.439401016, 140255375.65117863, 48969193.60297438, 140255378.64646342, 48969196.25406263, 0, 0, 0, 0, 0 },
-  { 140255357.90845308, 48969216.6669053, 140255328.09845838, 48969189.99549333, 140255387.71844777, 48969243.33831727, 140255356.41795334, 48969215.3333347, 140255359.3989528, 48969218.0004759, 0, 0, 0, 0, 0 },
-  { 140255338.55409536, 48969238.298804715, 140255308.88772157, 48969211.467735656, 140255368.22046915, 48969265.129873775, 140255337.07077667, 48969236.957251266, 140255340.03741404, 48969239.640358165, 0, 0, 0, 0, 0 },
-  { 140255319.08620536, 48969259.82391428, 140255289.56421372, 48969232.83406415, 140255348.608197, 48969286.813764416, 140255317.61010578, 48969258.47442178, 140255320.56230494, 48969261.17340679, 0, 0, 0, 0, 0 },
-  { 140255299.50524068, 48969281.24193152, 140255270.1283863, 48969254.09417976, 140255328.88209507, 48969308.389683284, 140255298.03639796, 48969279.88454393, 140255300.9740834, 48969282.59931911, 0, 0, 0, 0, 0 },
-  { 140255279.81165886, 48969302.55255388, 140255250.58069047, 48969275.24778346, 140255309.04262725, 48969329.857324295, 140255278.35011044, 48969301.18731536, 140255281.27320728, 48969303.917792395, 0, 0, 0, 0, 0 },
-  { 140255260.00591746, 48969323.755478926, 140255230.9215777, 48969296.29457617, 140255289.09025723, 48969351.216381684, 140255258.55170047, 48969322.38243379, 140255261.46013445, 48969325.128524065, 0, 0, 0, 0, 0 },
-  { 140255240.0884741, 48969344.85040414, 140255211.15149942, 48969317.234258555, 140255269.02544877, 48969372.46654973, 140255238.64162537, 48969343.46959686, 140255241.53532282, 48969346.231211424, 1, 2, 140255472.3076958, 48969566.46997247, 48 },
-  { 140255220.05978626, 48969365.83702701, 140255191.2709069, 48969338.06653142, 140255248.84866562, 48969393.60752261, 140255218.62034228, 48969364.448502235, 140255221.49923024, 48969367.22555179, 0, 0, 0, 0, 0 },
-  { 140255199.92031154, 48969386.71504505, 140255171.28025156, 48969358.7910954, 140255228.56037152, 48969414.6389947, 140255198.48830855, 48969385.31884757, 140255201.35231453, 48969388.11124253, 1, 4, 140255382.50069392, 48969564.73022409, 30 },
-  { 140255179.6705075, 48969407.48415579, 140255151.1799848, 48969379.407651074, 140255208.16103017, 48969435.560660504, 140255178.24598137, 48969406.08033055, 140255181.09503362, 48969408.88798103, 1, 3, 140254958.86895666, 48969189.89124425, 25 },
-  { 140255159.3108317, 48969428.14405669, 140255130.9705581, 48969399.9158989, 140255187.65110528, 48969456.37221449, 140255157.89381802, 48969426.732648805, 140255160.72784537, 48969429.55546458, 1, 3, 140255283.29952866, 48969551.64224705, 37 },
-  { 140255138.84174165, 48969448.69444529, 140255110.6524228, 48969420.31553937, 140255167.03106052, 48969477.07335121, 140255137.4322757, 48969447.27549999, 140255140.2512076, 48969450.11339059, 0, 0, 0, 0, 0 },
-  { 140255118.26369494, 48969469.13501908, 140255090.22603026, 48969440.606272876, 140255146.30135962, 48969497.66376528, 140255116.8618117, 48969467.70858177, 140255119.6655782, 48969470.56145639, 1, 1, 140255339.76124582, 48969694.51211409, 47 },
-  { 140255097.57714918, 48969489.46547556, 140255069.6918322, 48969460.78779963, 140255125.46246615, 48969518.14315149, 140255096.18288332, 48969488.031591766, 140255098.97141504, 48969490.89935935, 0, 0, 0, 0, 0 },
-  { 140255076.78256184, 48969509.685512245, 140255049.05027983, 48969480.85981999, 140255104.51484385, 48969538.511204496, 140255075.39594772, 48969508.24422763, 140255078.16917595, 48969511.12679686, 0, 0, 0, 0, 0 },
-  { 140255055.88039058, 48969529.794826634, 140255028.3018248, 48969500.82203406, 140255083.45895636, 48969558.76761921, 140255054.50146228, 48969528.346187, 140255057.2593189, 48969531.243466265, 0, 0, 0, 0, 0 },
-  { 140255034.87109295, 48969549.79311626, 140255007.4469187, 48969520.674141906, 140255062.2952672, 48969578.91209061, 140255033.49988425, 48969548.33716754, 140255036.24230164, 48969551.249064974, 0, 0, 0, 0, 0 },
-  { 140255013.75512642, 48969569.680078566, 140254986.48601288, 48969540.41584362, 140255041.02423996, 48969598.94431351, 140255012.39167073, 48969568.21686682, 140255015.1185821, 48969571.14329031, 1, 5, 140254936.03815284, 48969486.277008966, 38 },
-  { 140254992.53294855, 48969589.45541111, 140254965.41955885, 48969560.04683926, 140255019.64633825, 48969618.86398295, 140254991.17727906, 48969587.98498251, 140254993.88861805, 48969590.9258397, 0, 0, 0, 0, 0 },
-  { 140254971.20501703, 48969609.11881136, 140254944.24800837, 48969579.566828616, 140254998.1620257, 48969638.67079411, 140254969.8571666, 48969607.641212225, 140254972.55286747, 48969610.5964105, 0, 0, 0, 0, 0 },
-  { 140254949.7717893, 48969628.66997685, 140254922.9718129, 48969598.97551163, 140254976.57176572, 48969658.36444207, 140254948.4317905, 48969627.18525359, 140254951.11178812, 48969630.154700115, 0, 0, 0, 0, 0 },
-  { 140254928.23372298, 48969648.108605064, 140254901.59142408, 48969618.2725881, 140254954.8760219, 48969677.94462203, 140254926.90160805, 48969646.61680422, 140254929.56583792, 48969649.60040591, 0, 0, 0, 0, 0 },
-  { 140254906.5912756, 48969667.434393525, 140254880.10729352, 48969637.457757756, 140254933.0752577, 48969697.411029294, 140254905.2670765, 48969665.93556174, 140254907.9154747, 48969668.93322531, 0, 0, 0, 0, 0 },
-  { 140254884.84490472, 48969686.64703972, 140254858.51987278, 48969656.530720316, 140254911.16993666, 48969716.76335912, 140254883.52865312, 48969685.14122375, 140254886.16115633, 48969688.15285569, 0, 0, 0, 0, 0 },
-  { 140254862.99506792, 48969705.74624117, 140254836.8296137, 48969675.4911754, 140254889.16052216, 48969736.001306936, 140254861.6867952, 48969704.23348788, 140254864.30334064, 48969707.25899445, 0, 0, 0, 0, 0 },
-  { 140254841.04222277, 48969724.73169536, 140254815.03696784, 48969694.338822566, 140254867.0474777, 48969755.12456816, 140254839.74196002, 48969723.21205172, 140254842.34248552, 48969726.251339, 0, 0, 0, 0, 0 },
-  { 140254818.98682678, 48969743.603099816, 140254793.14244914, 48969713.073308714, 140254844.8312044, 48969774.13289092, 140254817.69460788, 48969742.07661026, 140254820.27904567, 48969745.12958937, 1, 1, 140254936.578745, 48969882.51364933, 45 },
-  { 140254796.82930756, 48969762.3600999, 140254771.1580647, 48969731.68458377, 140254822.50055042, 48969793.035616025, 140254795.5457454, 48969760.82632409, 140254798.1128697, 48969763.8938757, 0, 0, 0, 0, 0 },
-  { 140254774.5645404, 48969780.99268763, 140254749.10411766, 48969750.14196844, 140254800.0249631, 48969811.84340682, 140254773.29151925, 48969779.45015167, 140254775.83756152, 48969782.53522359, 1, 2, 140254967.42724255, 48970014.68688548, 45 },
-  { 140254752.17538607, 48969799.469966225, 140254726.96754965, 48969768.412519716, 140254777.3832225, 48969830.527412735, 140254750.91499424, 48969797.9170939, 140254753.4357779, 48969801.02283855, 1, 4, 140254564.37700486, 48969568.09198972, 50 },
-  { 140254729.643136, 48969817.75831049, 140254704.7306276, 48969786.46347187, 140254754.5556444, 48969849.05314911, 140254728.3975106, 48969816.19356856, 140254730.8887614, 48969819.32305242, 1, 5, 140254866.03911954, 48969989.097551964, 50 },
-  { 140254706.94908175, 48969835.824095204, 140254682.3757533, 48969804.26222691, 140254731.52241018, 48969867.3859635, 140254705.72041532, 48969834.24600179, 140254708.17774817, 48969837.40218862, 1, 4, 140254573.63877505, 48969664.60095971, 26 },
-  { 140254684.0745147, 48969853.633695185, 140254659.88544226, 48969821.776376165, 140254708.26358712, 48969885.491014205, 140254682.86506107, 48969852.040829234, 140254685.2839683, 48969855.22656114, 0, 0, 0, 0, 0 },
-  { 140254661.00072628, 48969871.15348518, 140254637.24229833, 48969838.97372288, 140254684.75915423, 48969903.333247475, 140254659.81280488, 48969869.544497065, 140254662.1886477, 48969872.76247329, 0, 0, 0, 0, 0 },
-  { 140254637.70900804, 48969888.34983998, 140254614.4289835, 48969855.82230614, 140254660.98903257, 48969920.877373815, 140254636.5450068, 48969886.72346329, 140254638.87300926, 48969889.97621667, 0, 0, 0, 0, 0 },
-  { 140254614.18065143, 48969905.189134404, 140254591.42624986, 48969872.291760504, 140254636.935053, 48969938.086508304, 140254613.04293135, 48969903.54426571, 140254615.3183715, 48969906.8340031, 0, 0, 0, 0, 0 },
-  { 140254590.3978196, 48969921.639204465, 140254568.17826822, 48969888.37824333, 140254612.617371, 48969954.9001656, 140254589.28684205, 48969919.976156406, 140254591.50879717, 48969923.30225252, 0, 0, 0, 0, 0 },
-  { 140254566.36018428, 48969937.69723331, 140254544.64772958, 48969904.10304764, 140254588.072639, 48969971.291418985, 140254565.27456155, 48969936.01752403, 140254567.445807, 48969939.3769426, 0, 0, 0, 0, 0 },
-  { 140254542.0836192, 48969953.387562126, 140254520.8477442, 48969919.49010482, 140254563.31949422, 48969987.285019435, 140254541.02182546, 48969951.69268926, 140254543.14541295, 48969955.08243499, 0, 0, 0, 0, 0 },
-  { 140254517.5846086, 48969968.735554814, 140254496.79358286, 48969934.56344268, 140254538.37563437, 48970002.90766695, 140254516.54505733, 48969967.026949205, 140254518.6241599, 48969970.444160424, 1, 4, 140254458.84996083, 48969872.199338034, 47 },
-  { 140254492.8796364, 48969983.76657519, 140254472.50069603, 48969949.34712155, 140254513.25857678, 48970018.18602882, 140254491.8606894, 48969982.04560251, 140254493.8985834, 48969985.48754787, 0, 0, 0, 0, 0 },
-  { 140254467.9851867, 48969998.505987145, 140254447.9846972, 48969963.865253605, 140254487.9856762, 48970033.146720685, 140254466.98516223, 48969996.773950465, 140254468.98521116, 48970000.238023825, 0, 0, 0, 0, 0 },
-  { 140254442.9177435, 48970012.97915451, 140254423.26134408, 48969978.14201971, 140254462.57414293, 48970047.81628931, 140254441.93492353, 48970011.23729777, 140254443.90056348, 48970014.72101125, 0, 0, 0, 0, 0 },
-  { 140254417.69379082, 48970027.21144118, 140254398.34652123, 48969992.20168313, 140254437.04106042, 48970062.22119924, 140254416.72642735, 48970025.46095328, 140254418.6611543, 48970028.96192908, 0, 0, 0, 0, 0 },
-  { 140254392.32981282, 48970041.22821101, 140254373.25622407, 48970006.06860049, 140254411.40340158, 48970076.387821525, 140254391.37613338, 48970039.47023048, 140254393.28349227, 48970042.98619153, 1, 2, 140254465.76312953, 48970176.592711516, 33 },
-  { 140254366.84229344, 48970055.054827854, 140254348.00654262, 48970019.767231, 140254385.67804426, 48970090.342424706, 140254365.9005059, 48970053.29044801, 140254367.78408098, 48970056.8192077, 1, 0, 140254315.5148725, 48969958.89612644, 33 },
-  { 140254341.24771678, 48970068.71665555, 140254322.6136484, 48970033.32214332, 140254359.88178515, 48970104.11116778, 140254340.31601337, 48970066.94692994, 140254342.1794202, 48970070.486381166, 0, 0, 0, 0, 0 },
-  { 140254315.56256688, 48970082.23905802, 140254297.09378204, 48970046.75802102, 140254334.03135172, 48970117.720095016, 140254314.63912764, 48970080.465006165, 140254316.4860061, 48970084.01310987, 0, 0, 0, 0, 0 },
-  { 140254289.80332774, 48970095.64739908, 140254271.4632426, 48970060.09966671, 140254308.1434129, 48970131.19513146, 140254288.88632348, 48970093.87001246, 140254290.720332, 48970097.4247857, 0, 0, 0, 0, 0 },
-  { 140254263.98648342, 48970108.967042595, 140254245.7383793, 48970073.37200508, 140254282.23458755, 48970144.56208011, 140254263.07407823, 48970107.18729072, 140254264.89888862, 48970110.74679447, 1, 4, 140254149.0234274, 48969884.71830626, 48 },
-  { 140254238.12851802, 48970122.22335242, 140254219.93558472, 48970086.60008504, 140254256.3214513, 48970157.84661979, 140254237.21887136, 48970120.442189045, 140254239.03816468, 48970124.00451579, 0, 0, 0, 0, 0 },
-  { 140254212.2459155, 48970135.441692434, 140254194.0712899, 48970099.8090812, 140254230.4205411, 48970171.07430367, 140254211.33718422, 48970133.66006187, 140254213.15464678, 48970137.223322995, 0, 0, 0, 0, 0 },
-  { 140254186.35516, 48970148.6474265, 140254168.16196162, 48970113.02429451, 140254204.54835838, 48970184.27055849, 140254185.44550008, 48970146.8662699, 140254187.26481992, 48970150.4285831, 0, 0, 0, 0, 0 },
-  { 140254160.47273546, 48970161.86591847, 140254142.22410113, 48970126.27115278, 140254178.7213698, 48970197.460684165, 140254159.56030375, 48970160.08618019, 140254161.38516718, 48970163.64565676, 0, 0, 0, 0, 0 },
-  { 140254134.615126, 48970175.122532204, 140254116.27424556, 48970139.57521017, 140254152.95600647, 48970210.66985424, 140254133.698082, 48970173.3451661, 140254135.53217003, 48970176.899898306, 0, 0, 0, 0, 0 },
-  { 140254108.79881567, 48970188.44263158, 140254090.3289705, 48970152.962146536, 140254127.26866084, 48970223.923116624, 140254107.8753234, 48970186.668607324, 140254109.72230792, 48970190.216655836, 0, 0, 0, 0, 0 },
-  { 140254083.04028848, 48970201.85158043, 140254064.4048949, 48970166.457765914, 140254101.67568207, 48970237.24539495, 140254082.1085188, 48970200.08188971, 140254083.97205815, 48970203.621271156, 0, 0, 0, 0, 0 },
-  { 140254057.35602844, 48970215.374742635, 140254038.5186998, 48970180.08798804, 140254076.19335708, 48970250.66149723, 140254056.414162, 48970213.61040491, 140254058.29789487, 48970217.13908036, 0, 0, 0, 0, 0 },
-  { 140254031.7625141, 48970229.03747377, 140254012.70177516, 48970193.87089545, 140254050.82325307, 48970264.20405208, 140254030.80947718, 48970227.27914485, 140254032.71555105, 48970230.79580268, 0, 0, 0, 0, 0 },
-  { 140254006.26947263, 48970242.85503101, 140253987.00710726, 48970207.79848698, 140254025.531838, 48970277.91157505, 140254005.30635437, 48970241.10220381, 140254007.23259088, 48970244.60785822, 1, 4, 140253829.0557111, 48969920.33482587, 30 },
-  { 140253980.86675954, 48970256.81294828, 140253961.4323116, 48970221.85150905, 140254000.30120748, 48970291.77438751, 140253979.89503714, 48970255.06487632, 140253981.83848193, 48970258.56102024, 0, 0, 0, 0, 0 },
-  { 140253955.5405926, 48970270.89131815, 140253935.9634524, 48970236.00958108, 140253975.11773282, 48970305.77305522, 140253954.5617356, 48970269.147231296, 140253956.51944962, 48970272.635405004, 0, 0, 0, 0, 0 },
-  { 140253930.27718946, 48970285.07023317, 140253910.58660805, 48970250.25240722, 140253949.96777087, 48970319.888059124, 140253929.2926604, 48970283.32934187, 140253931.26171854, 48970286.811124474, 0, 0, 0, 0, 0 },
-  { 140253905.0627677, 48970299.32978587, 140253885.28787616, 48970264.55977488, 140253924.83765927, 48970334.099796854, 140253904.07402313, 48970297.59128532, 140253906.0515123, 48970301.06828642, 0, 0, 0, 0, 0 },
-  { 140253879.88354516, 48970313.65006882, 140253860.05337787, 48970278.91155323, 140253899.71371245, 48970348.38858441, 140253878.8920368, 48970311.91314304, 140253880.87505352, 48970315.3869946, 0, 0, 0, 0, 0 },
-  { 140253854.72573942, 48970328.011174574, 140253834.86926004, 48970293.28769223, 140253874.5822188, 48970362.73465692, 140253853.73291546, 48970326.27500046, 140253855.71856338, 48970329.74734869, 0, 0, 0, 0, 0 },
-  { 140253829.57556823, 48970342.393195674, 140253809.72169745, 48970307.66822173, 140253849.429439, 48970377.11816962, 140253828.5828747, 48970340.65694698, 140253830.56826177, 48970344.12944437, 1, 0, 140254019.67638087, 48970674.884821184, 30 },
-  { 140253804.4192492, 48970356.776224665, 140253784.59689334, 48970322.03325116, 140253824.24160507, 48970391.51919817, 140253803.4281314, 48970355.03907599, 140253805.410367, 48970358.51337334, 0, 0, 0, 0, 0 },
-  { 140253779.2430001, 48970371.14035412, 140253759.4810797, 48970336.36296919, 140253799.00492048, 48970405.91773905, 140253778.25490406, 48970369.40148487, 140253780.23109612, 48970372.87922337, 0, 0, 0, 0, 0 },
-  { 140253754.03303853, 48970385.465676576, 140253734.3566811, 48970350.63981034, 140253773.70939595, 48970420.29154281, 140253753.04922065, 48970383.724383265, 140253755.0168564, 48970387.20696989, 0, 0, 0, 0, 0 },
-  { 140253728.7776513, 48970399.73478397, 140253709.18734008, 48970364.86044231, 140253748.36796254, 48970434.60912563, 140253727.79813576, 48970397.99106689, 140253729.75716686, 48970401.47850105, 0, 0, 0, 0, 0 },
-  { 140253703.47844592, 48970413.946358554, 140253683.96488973, 48970379.02901151, 140253722.9920021, 48970448.8637056, 140253702.5027681, 48970412.200491205, 140253704.45412374, 48970415.6922259, 0, 0, 0, 0, 0 },
-  { 140253678.14230704, 48970428.10545744, 140253658.6961887, 48970393.15050814, 140253697.5884254, 48970463.06040674, 140253677.17000112, 48970426.357709974, 140253679.11461297, 48970429.853204906, 0, 0, 0, 0, 0 },
-  { 140253652.77613276, 48970442.217153706, 140253633.3881318, 48970407.22993577, 140253672.16413373, 48970477.20437164, 140253651.8067327, 48970440.46779281, 140253653.7455328, 48970443.9665146, 0, 0, 0, 0, 0 },
-  { 140253627.38682112, 48970456.28652039, 140253608.04761177, 48970421.27230926, 140253646.72603047, 48970491.300731525, 140253626.41986066, 48970454.53580984, 140253628.35378158, 48970458.037230946, 0, 0, 0, 0, 0 },
-  { 140253601.98127016, 48970470.31863058, 140253582.68151903, 48970435.282654695, 140253621.2810213, 48970505.35460647, 140253601.01628262, 48970468.56683179, 140253602.9462577, 48970472.07042938, 0, 0, 0, 0, 0 },
-  { 140253576.5663779, 48970484.31855732, 140253557.2967415, 48970449.26600945, 140253595.83601433, 48970519.371105194, 140253575.6028961, 48970482.56592993, 140253577.52985972, 48970486.07118472, 1, 0, 140253746.13917837, 48970792.780978605, 28 },
-  { 140253551.1490424, 48970498.29137367, 140253531.90016446, 48970463.22742212, 140253570.39792034, 48970533.35532522, 140253550.1865985, 48970496.53817609, 140253552.1114863, 48970500.04457125, 0, 0, 0, 0, 0 },
-  { 140253525.73616162, 48970512.2421527, 140253506.4986704, 48970477.17195264, 140253544.97365284, 48970547.312352754, 140253524.77428705, 48970510.48864269, 140253526.6980362, 48970513.995662704, 0, 0, 0, 0, 0 },
-  { 140253500.33463365, 48970526.175967455, 140253481.099139, 48970491.10467227, 140253519.5701283, 48970561.24726264, 140253499.3728589, 48970524.422402695, 140253501.29640839, 48970527.929532215, 0, 0, 0, 0, 0 },
-  { 140253474.95135653, 48970540.09789102, 140253455.70844707, 48970505.030663654, 140253494.194266, 48970575.16511838, 140253473.98921105, 48970538.34452965, 140253475.913502, 48970541.851252384, 0, 0, 0, 0, 0 },
-  { 140253449.5932283, 48970554.01299644, 140253430.33346838, 48970518.95502093, 140253468.85298824, 48970589.07097196, 140253448.63024032, 48970552.26009767, 140253450.5562163, 48970555.76589522, 0, 0, 0, 0, 0 },
-  { 140253424.267147, 48970567.926356785, 140253404.98107377, 48970532.882849835, 140253443.55322024, 48970602.969863735, 140253423.30284333, 48970566.17418144, 140253425.23145068, 48970569.67853213, 0, 0, 0, 0, 0 },
-  { 140253398.98001063, 48970581.84304511, 140253379.65935415, 48970546.81859318, 140253418.3006671, 48970616.867497034, 140253398.0139778, 48970580.09182251, 140253399.94604346, 48970583.5942677, 0, 0, 0, 0, 0 },
-  { 140253373.7370693, 48970595.767893925, 140253354.3875558, 48970560.759376004, 140253393.0865828, 48970630.77641185, 140253372.76959363, 48970594.01746803, 140253374.704545, 48970597.51831982, 0, 0, 0, 0, 0 },
-  { 140253348.524714, 48970609.70298283, 140253329.16105708, 48970574.702285826, 140253367.8883709, 48970644.70367983, 140253347.55653116, 48970607.95294798, 140253349.49289683, 48970611.453017674, 0, 0, 0, 0, 0 },
-  { 140253323.31730765, 48970623.64863563, 140253303.95438716, 48970588.64753122, 140253342.68022814, 48970658.64974005, 140253322.34916162, 48970621.89858041, 140253324.28545368, 48970625.39869086, 1, 4, 140253442.88334167, 48970839.78045538, 35 },
-  { 140253298.0890193, 48970637.60514785, 140253278.74167782, 48970602.59542952, 140253317.43636078, 48970672.61486619, 140253297.12165222, 48970635.854661934, 140253299.05638638, 48970639.35563377, 0, 0, 0, 0, 0 },
-  { 140253272.81401747, 48970651.57281495, 140253253.49700022, 48970616.546355754, 140253292.13103473, 48970686.59927414, 140253271.8481666, 48970649.82149199, 140253273.77986833, 48970653.32413791, 0, 0, 0, 0, 0 },
-  { 140253247.46647123, 48970665.55193245, 140253228.1943681, 48970630.50074074, 140253266.73857436, 48970700.60312416, 140253246.50286606, 48970663.79937286, 140253248.4300764, 48970667.304492034, 1, 4, 140253115.93436727, 48970426.32754901, 46 },
-  { 140253222.02054924, 48970679.542795785, 140253202.80773726, 48970644.459069416, 140253241.2333612, 48970714.62652215, 140253221.05990863, 48970677.78860947, 140253222.98118985, 48970681.2969821, 0, 0, 0, 0, 0 },
-  { 140253196.4504204, 48970693.5457005, 140253177.31100887, 48970658.42187773, 140253215.58983195, 48970728.66952327, 140253195.49344984, 48970691.789509356, 140253197.40739098, 48970695.30189164, 1, 4, 140253115.10792136, 48970544.269453734, 28 },
-  { 140253170.73025346, 48970707.56094205, 140253151.69457087, 48970672.380794406, 140253189.76593605, 48970742.74108969, 140253169.77846932, 48970705.80193467, 140253171.6820376, 48970709.319949426, 1, 4, 140253349.6656699, 48971038.25432986, 48 },
-  { 140253144.83308545, 48970721.573682286, 140253126.19496807, 48970686.18130202, 140253163.47120282, 48970756.96606255, 140253143.90117958, 48970719.804063275, 140253145.7649913, 48970723.343301296, 0, 0, 0, 0, 0 },
-  { 140253118.71395153, 48970735.32837976, 140253100.9907656, 48970699.46908974, 140253136.43713745, 48970771.18766978, 140253117.82779223, 48970733.535415255, 140253119.60011083, 48970737.12134426, 0, 0, 0, 0, 0 },
-  { 140253092.31346247, 48970748.37662405, 140253076.06474096, 48970711.82557688, 140253108.56218398, 48970784.92767122, 140253091.5010264, 48970746.54907169, 140253093.12589854, 48970750.2041764, 1, 5, 140252934.29464576, 48970392.917690314, 40 },
-  { 140253065.5718238, 48970760.26458549, 140253051.41170025, 48970722.85481536, 140253079.73194736, 48970797.67435562, 140253064.86381763, 48970758.39409698, 140253066.27982998, 48970762.135074, 0, 0, 0, 0, 0 },
-  { 140253038.42924106, 48970770.53843437, 140253027.0310509, 48970732.19679564, 140253049.82743123, 48970808.8800731, 140253037.85933155, 48970768.621352434, 140253038.99915057, 48970772.45551631, 0, 0, 0, 0, 0 },
-  { 140253010.8259196, 48970778.74434101, 140253002.9017148, 48970739.53710981, 140253018.7501244, 48970817.95157221, 140253010.42970935, 48970776.783979446, 140253011.22212985, 48970780.70470257, 0, 0, 0, 0, 0 },
-  { 140252982.702065, 48970784.42847571, 140252978.84779716, 48970744.614601, 140252986.55633283, 48970824.242350414, 140252982.5093516, 48970782.437781975, 140252982.89477837, 48970786.41916944, 1, 5, 140252967.0922802, 48970623.18228313, 36 },
-  { 140252954.02908465, 48970787.204225294, 140252954.10446832, 48970747.20429633, 140252953.953701, 48970827.20415426, 140252954.03285384, 48970785.20422885, 140252954.02531546, 48970789.20422174, 0, 0, 0, 0, 0 },
-  { 140252924.99402013, 48970787.14950596, 140252928.5664128, 48970747.3093502, 140252921.42162746, 48970826.989661716, 140252925.17263976, 48970785.15749817, 140252924.8154005, 48970789.14151374, 0, 0, 0, 0, 0 },
-  { 140252895.87499976, 48970784.538457565, 140252902.5461796, 48970745.09868881, 140252889.20381993, 48970823.97822632, 140252896.20855877, 48970782.566469125, 140252895.54144076, 48970786.510446005, 0, 0, 0, 0, 0 },
-  { 140252866.95047536, 48970779.6459161, 140252876.37716022, 48970740.77256259, 140252857.5237905, 48970818.5192696, 140252867.4218096, 48970777.702248424, 140252866.47914112, 48970781.58958377, 0, 0, 0, 0, 0 },
-  { 140252838.49867722, 48970772.74643071, 140252850.47739375, 48970734.58217583, 140252826.5199607, 48970810.91068559, 140252839.09761304, 48970770.838217966, 140252837.8997414, 48970774.65464345, 1, 2, 140252720.50831944, 48971148.66434126, 36 },
-  { 140252810.73406515, 48970764.03187782, 140252825.26623765, 48970726.765056625, 140252796.20189264, 48970801.29869902, 140252811.46067378, 48970762.16853676, 140252810.0074565, 48970765.89521889, 0, 0, 0, 0, 0 },
-  { 140252783.7194627, 48970753.4975513, 140252800.80413768, 48970717.329694286, 140252766.6347877, 48970789.66540831, 140252784.57369643, 48970751.68915845, 140252782.86522895, 48970755.30594415, 0, 0, 0, 0, 0 },
-  { 140252757.495643, 48970741.11015892, 140252777.0990099, 48970706.24315437, 140252737.89227608, 48970775.97716347, 140252758.47581133, 48970739.36680869, 140252756.51547465, 48970742.85350915, 0, 0, 0, 0, 0 },
-  { 140252732.11246, 48970726.838905744, 140252754.21812913, 48970693.502148375, 140252710.00679085, 48970760.17566311, 140252733.21774346, 48970725.17206787, 140252731.00717652, 48970728.505743615, 0, 0, 0, 0, 0 },
-  { 140252707.7621183, 48970710.69214646, 140252732.39168462, 48970679.174144246, 140252683.132552, 48970742.21014867, 140252708.9935966, 48970709.11624635, 140252706.53064, 48970712.268046565, 0, 0, 0, 0, 0 },
-  { 140252684.74981523, 48970692.70931109, 140252711.92268386, 48970663.355687626, 140252657.5769466, 48970722.062934555, 140252686.10845867, 48970691.24162991, 140252683.39117178, 48970694.17699227, 0, 0, 0, 0, 0 },
-  { 140252663.38385838, 48970672.930685155, 140252693.0946015, 48970646.14875576, 140252633.67311525, 48970699.71261455, 140252664.86939555, 48970671.59158868, 140252661.8983212, 48970674.26978163, 1, 5, 140252785.19790524, 48970563.12477463, 49 },
-  { 140252643.9725244, 48970651.39656977, 140252675.97982478, 48970627.40630669, 140252611.96522403, 48970675.386832856, 140252645.57288942, 48970650.19705662, 140252642.3721594, 48970652.596082926, 0, 0, 0, 0, 0 },
-  { 140252626.6221344, 48970628.24804726, 140252660.1081614, 48970606.36915342, 140252593.1361074, 48970650.12694111, 140252628.29643574, 48970627.15410257, 140252624.94783303, 48970629.34199195, 0, 0, 0, 0, 0 },
-  { 140252610.75717634, 48970603.96645345, 140252644.94612557, 48970583.20312637, 140252576.5682271, 48970624.729780525, 140252612.4666238, 48970602.9282871, 140252609.04772887, 48970605.0046198, 1, 3, 140252412.46127087, 48970724.3937505, 40 },
-  { 140252595.6584342, 48970579.104824774, 140252630.0097667, 48970558.61126586, 140252561.30710173, 48970599.59838369, 140252597.37600082, 48970578.08014683, 140252593.9408676, 48970580.12950272, 1, 2, 140252931.4427092, 48970378.780286424, 49 },
-  { 140252580.74602005, 48970554.108615026, 140252615.144138, 48970533.69368223, 140252546.3479021, 48970574.52354782, 140252582.46592593, 48970553.087868385, 140252579.02611417, 48970555.12936167, 1, 2, 140252478.41161913, 48970614.8430401, 29 },
-  { 140252565.88953778, 48970529.07620201, 140252600.30005583, 48970508.682177216, 140252531.47901973, 48970549.47022681, 140252567.61006367, 48970528.05650077, 140252564.1690119, 48970530.095903255, 1, 2, 140252786.97711626, 48970398.04459271, 36 },
-  { 140252551.04906452, 48970504.03610432, 140252585.43770227, 48970483.60520632, 140252516.66042677, 48970524.467002325, 140252552.7684964, 48970503.01455942, 140252549.32963264, 48970505.057649225, 0, 0, 0, 0, 0 },
-  { 140252536.18467733, 48970479.01684055, 140252570.51693928, 48970458.49134934, 140252501.85241538, 48970499.542331755, 140252537.90129042, 48970477.990565985, 140252534.46806425, 48970480.04311511, 0, 0, 0, 0, 0 },
-  { 140252521.25645342, 48970454.04692931, 140252555.49731025, 48970433.369315244, 140252487.0155966, 48970474.72454337, 140252522.96849626, 48970453.013048604, 140252519.5444106, 48970455.08081001, 0, 0, 0, 0, 0 },
-  { 140252506.2244698, 48970429.15488918, 140252540.33804506, 48970408.26795585, 140252472.11089456, 48970450.041822515, 140252507.93014857, 48970428.11054251, 140252504.51879105, 48970430.19923585, 1, 5, 140252704.9360456, 48970307.4885025, 42 },
-  { 140252491.04880372, 48970404.3692388, 140252524.99806866, 48970383.21628608, 140252457.09953877, 48970425.522191525, 140252492.74626696, 48970403.31159116, 140252489.35134047, 48970405.42688644, 0, 0, 0, 0, 0 },
-  { 140252475.6895321, 48970379.71849673, 140252509.4360147, 48970358.243513346, 140252441.9430495, 48970401.19348012, 140252477.37685624, 48970378.64474756, 140252474.00220796, 48970380.7922459, 0, 0, 0, 0, 0 },
-  { 140252460.1067322, 48970355.23118158, 140252493.61024442, 48970333.37907255, 140252426.60321996, 48970377.08329061, 140252461.7819078, 48970354.13857613, 140252458.43155658, 48970356.323787026, 0, 0, 0, 0, 0 },
-  { 140252444.26048115, 48970330.935811974, 140252477.4788725, 48970308.65266869, 140252411.0420898, 48970353.218955256, 140252445.92140073, 48970329.82165481, 140252442.59956157, 48970332.04996914, 1, 5, 140252596.23462167, 48970228.99043144, 37 },
-  { 140252428.110856, 48970306.860906474, 140252460.9998017, 48970284.094324596, 140252395.2219103, 48970329.62748835, 140252429.7553033, 48970305.72257738, 140252426.4664087, 48970307.99923557, 1, 1, 140252107.44363534, 48970528.83507976, 46 },
-  { 140252411.61793384, 48970283.03498371, 140252444.13076714, 48970259.73443282, 140252379.10510054, 48970306.3355346, 140252413.2435755, 48970281.869956166, 140252409.99229217, 48970284.20001125, 0, 0, 0, 0, 0 },
-  { 140252394.7417918, 48970259.486562274, 140252426.82939228, 48970235.60380915, 140252362.65419134, 48970283.3693154, 140252396.34617183, 48970258.29242462, 140252393.1374118, 48970260.68069993, 1, 3, 140252243.12787965, 48970372.33257079, 49 },
-  { 140252377.44250706, 48970236.24416076, 140252409.0532577, 48970211.73374576, 140252345.8317564, 48970260.75457575, 140252379.0230446, 48970235.018640004, 140252375.86196953, 48970237.46968151, 1, 4, 140252673.00302568, 48970007.07178058, 39 },
-  { 140252359.6801567, 48970213.33629779, 140252390.7599835, 48970188.1560602, 140252328.6003299, 48970238.51653538, 140252361.23414806, 48970212.07728591, 140252358.12616536, 48970214.59530967, 0, 0, 0, 0, 0 },
-  { 140252341.41481787, 48970190.79149194, 140252371.90732536, 48970164.90313574, 140252310.92231038, 48970216.67984814, 140252342.93944323, 48970189.49707413, 140252339.8901925, 48970192.085909754, 1, 3, 140252604.41269502, 48969967.50441973, 47 },
-  { 140252322.6065676, 48970168.63826181, 140252352.45328373, 48970142.00794944, 140252292.75985146, 48970195.26857418, 140252324.0989034, 48970167.30674619, 140252321.1142318, 48970169.96977743, 0, 0, 0, 0, 0 },
-  { 140252303.21548307, 48970146.90512601, 140252332.35622337, 48970119.50408126, 140252274.07474276, 48970174.30617077, 140252304.67252007, 48970145.53507377, 140252301.75844607, 48970148.27517825, 1, 5, 140252416.86437032, 48970040.041051455, 37 },
-  { 140252283.20164138, 48970125.62060316, 140252311.57500005, 48970097.42570081, 140252254.8282827, 48970153.815505505, 140252284.62030932, 48970124.21085804, 140252281.78297344, 48970127.03034828, 0, 0, 0, 0, 0 },
-  { 140252262.52511966, 48970104.81321183, 140252290.06908786, 48970075.807525896, 140252234.98115146, 48970133.81889776, 140252263.90231806, 48970103.36292753, 140252261.14792126, 48970106.26349612, 0, 0, 0, 0, 0 },
-  { 140252241.14599502, 48970084.51147063, 140252267.7987014, 48970054.68475036, 140252214.49328864, 48970114.3381909, 140252242.47863033, 48970083.02013462, 140252239.8133597, 48970086.00280664, 0, 0, 0, 0, 0 },
-  { 140252219.02434456, 48970064.74389816, 140252244.58283132, 48970033.97437176, 140252193.4658578, 48970095.51342456, 140252220.3022689, 48970063.20542184, 140252217.74642023, 48970066.28237448, 0, 0, 0, 0, 0 },
-  { 140252196.09043816, 48970045.694013044, 140252219.39238745, 48970013.18218197, 140252172.78848886, 48970078.20584412, 140252197.25553563, 48970044.06842149, 140252194.92534068, 48970047.3196046, 0, 0, 0, 0, 0 },
-  { 140252172.0921329, 48970028.49389624, 140252191.26097938, 48969993.38612894, 140252152.9232864, 48970063.60166354, 140252173.05057523, 48970026.738507874, 140252171.13369057, 48970030.2492846, 0, 0, 0, 0, 0 },
-  { 140252146.70830715, 48970014.63432337, 140252159.35962245, 48969976.68772641, 140252134.05699185, 48970052.58092034, 140252147.3408729, 48970012.73699353, 140252146.07574138, 48970016.53165322, 0, 0, 0, 0, 0 },
-  { 140252119.61919197, 48970005.60286958, 140252124.83119988, 48969965.943886064, 140252114.40718406, 48970045.26185309, 140252119.87979236, 48970003.6199204, 140252119.3585916, 48970007.58581875, 1, 5, 140252165.0939611, 48969659.57823841, 26 },
-  { 140252090.90964615, 48970001.82984347, 140252091.57201117, 48969961.83532794, 140252090.24728113, 48970041.824359, 140252090.9427644, 48969999.830117695, 140252090.8765279, 48970003.82956924, 1, 1, 140252087.6143802, 48970200.802558236, 39 },
-  { 140252061.60640875, 48970001.344540946, 140252058.27879402, 48969961.483194, 140252064.93402347, 48970041.20588789, 140252061.440028, 48969999.3514736, 140252061.77278948, 48970003.33760829, 0, 0, 0, 0, 0 },
-  { 140252032.64760447, 48970003.762014285, 140252023.18496412, 48969964.8973975, 140252042.1102448, 48970042.626631066, 140252032.17447245, 48970001.81878345, 140252033.12073648, 48970005.70524512, 0, 0, 0, 0, 0 },
-  { 140252004.72872245, 48970010.55961996, 140251989.4348894, 48969973.59884791, 140252020.0225555, 48970047.520392016, 140252003.9640308, 48970008.71158136, 140252005.4934141, 48970012.40765857, 1, 2, 140251853.31977528, 48969644.647976644, 41 },
-  { 140251977.98080444, 48970021.62752168, 140251959.72260016, 48969986.03766391, 140251996.23900872, 48970057.21737945, 140251977.06789422, 48970019.848028794, 140251978.89371467, 48970023.40701456, 1, 4, 140252057.4039931, 48970176.44340298, 46 },
-  { 140251951.91734245, 48970034.998522386, 140251932.82659882, 48969999.84822356, 140251971.0080861, 48970070.14882121, 140251950.96280527, 48970033.24100745, 140251952.87187964, 48970036.756037325, 1, 1, 140251891.7815, 48969924.275081076, 47 },
-  { 140251926.12653407, 48970049.00596264, 140251906.50918925, 48970014.14682062, 140251945.7438789, 48970083.86510466, 140251925.14566684, 48970047.26300554, 140251927.1074013, 48970050.74891974, 0, 0, 0, 0, 0 },
-  { 140251900.574016, 48970063.385908015, 140251880.3586059, 48970028.87015518, 140251920.78942612, 48970097.90166085, 140251899.5632455, 48970061.660120375, 140251901.5847865, 48970065.111695655, 0, 0, 0, 0, 0 },
-  { 140251875.308596, 48970078.18352317, 140251854.42494828, 48970044.067936435, 140251896.1922437, 48970112.299109906, 140251874.2644136, 48970076.477743834, 140251876.35277838, 48970079.88930251, 0, 0, 0, 0, 0 },
-  { 140251850.3790817, 48970093.443972826, 140251828.75882187, 48970059.790379174, 140251871.99934152, 48970127.09756648, 140251849.2980687, 48970091.76129314, 140251851.4600947, 48970095.12665251, 1, 4, 140251697.4157435, 48969855.34479775, 30 },
-  { 140251825.8342809, 48970109.21242168, 140251803.41150075, 48970076.08812652, 140251848.25706106, 48970142.33671684, 140251824.7131419, 48970107.55620692, 140251826.95541993, 48970110.86863644, 1, 5, 140251959.81039235, 48970307.130085275, 43 },
-  { 140251801.72300145, 48970125.53403444, 140251778.4351033, 48970093.01213721, 140251825.0108996, 48970158.055931665, 140251800.55860654, 48970123.907939576, 140251802.88739637, 48970127.1601293, 0, 0, 0, 0, 0 },
-  { 140251778.0940509, 48970142.4539758, 140251753.8827728, 48970110.61352962, 140251802.30532902, 48970174.29442197, 140251776.88348702, 48970140.86195349, 140251779.3046148, 48970144.045998104, 0, 0, 0, 0, 0 },
-  { 140251754.99623704, 48970160.017410435, 140251729.80885425, 48970128.94337387, 140251780.18361983, 48970191.091447, 140251753.7368679, 48970158.46370861, 140251756.25560617, 48970161.57111226, 0, 0, 0, 0, 0 },
-  { 140251732.4783677, 48970178.269503094, 140251706.26904964, 48970148.05242765, 140251758.68768573, 48970208.48657854, 140251731.16790178, 48970176.75864932, 140251733.7888336, 48970179.78035687, 0, 0, 0, 0, 0 },
-  { 140251710.58925042, 48970197.25541843, 140251683.32053068, 48970167.99081654, 140251737.85797015, 48970226.52002031, 140251709.22581443, 48970195.79218833, 140251711.9526864, 48970198.71864852, 0, 0, 0, 0, 0 },
-  { 140251689.37769315, 48970217.02032118, 140251661.0219896, 48970188.80766307, 140251717.73339668, 48970245.2329793, 140251687.95990798, 48970215.609688275, 140251690.7954783, 48970218.43095409, 0, 0, 0, 0, 0 },
-  { 140251668.89250347, 48970237.60937602, 140251639.43340507, 48970210.55089266, 140251698.35160187, 48970264.66785938, 140251667.41954854, 48970236.25645185, 140251670.3654584, 48970238.96230019, 1, 3, 140251517.9146242, 48970098.93464879, 36 },
-  { 140251649.18278652, 48970259.06772914, 140251618.5609251, 48970233.33250808, 140251679.80464795, 48970284.802950196, 140251647.65169346, 48970257.780968085, 140251650.7138796, 48970260.35449019, 1, 3, 140251871.19128186, 48970445.648081794, 28 },
-  { 140251630.38480887, 48970281.43509352, 140251598.4274554, 48970257.3783365, 140251662.34216234, 48970305.49185055, 140251628.7869412, 48970280.23225567, 140251631.98267654, 48970282.63793138, 0, 0, 0, 0, 0 },
-  { 140251612.8427524, 48970304.73822199, 140251579.39358047, 48970282.8030243, 140251646.29192433, 48970326.67341968, 140251611.1702938, 48970303.6414621, 140251614.515211, 48970305.83498187, 0, 0, 0, 0, 0 },
-  { 140251596.93114054, 48970329.001975976, 140251561.8939725, 48970309.70438924, 140251631.9683086, 48970348.299562715, 140251595.17928213, 48970328.03709664, 140251598.68299896, 48970329.96685531, 1, 5, 140251246.55945987, 48970136.026108615, 36 },
-  { 140251583.0244967, 48970354.25121693, 140251546.45828006, 48970338.03666177, 140251619.59071335, 48970370.4657721, 140251581.19618586, 48970353.44048917, 140251584.85280755, 48970355.06194469, 0, 0, 0, 0, 0 },
-  { 140251571.39185044, 48970380.48455231, 140251533.6552242, 48970367.2200493, 140251609.12847668, 48970393.74905532, 140251569.50501913, 48970379.82132716, 140251573.27868176, 48970381.14777746, 1, 2, 140251220.44122642, 48970257.124674335, 40 },
-  { 140251561.8637166, 48970407.5914575, 140251523.31346503, 48970396.92008914, 140251600.41396818, 48970418.26282586, 140251559.93620402, 48970407.05788908, 140251563.7912292, 48970408.12502592, 0, 0, 0, 0, 0 },
-  { 140251554.1566864, 48970435.433056004, 140251515.06600833, 48970426.9525555, 140251593.24736446, 48970443.91355651, 140251552.2021525, 48970435.009030975, 140251556.1112203, 48970435.85708103, 1, 5, 140251223.84045678, 48970363.77282672, 47 },
-  { 140251547.98735073, 48970463.87047123, 140251508.55379578, 48970457.1626591, 140251587.42090568, 48970470.57828336, 140251546.01567298, 48970463.53508063, 140251549.95902848, 48970464.20586184, 1, 3, 140251738.2542534, 48970496.235664755, 36 },
-  { 140251543.0723004, 48970492.76482657, 140251503.43198213, 48970487.41270855, 140251582.71261868, 48970498.116944596, 140251541.0902845, 48970492.49722067, 140251545.0543163, 48970493.032432474, 1, 1, 140251195.22850758, 48970445.79999095, 31 },
-  { 140251539.12812638, 48970521.977245465, 140251499.37143865, 48970517.572046176, 140251578.8848141, 48970526.382444754, 140251537.140292, 48970521.7569855, 140251541.11596078, 48970522.19750543, 0, 0, 0, 0, 0 },
-  { 140251535.87141943, 48970551.36885133, 140251496.05717513, 48970547.51840327, 140251575.68566373, 48970555.21929938, 140251533.8807072, 48970551.17632892, 140251537.86213166, 48970551.56137373, 1, 5, 140251328.83734903, 48970531.346521415, 43 },
-  { 140251533.02469474, 48970580.80443661, 140251493.18123886, 48970577.2690409, 140251572.86815062, 48970584.33983232, 140251531.03252193, 48970580.62766682, 140251535.01686755, 48970580.981206395, 1, 4, 140251641.59811205, 48970590.43838993, 31 },
-  { 140251530.41515365, 48970610.21362972, 140251490.55424067, 48970606.88082051, 140251570.27606663, 48970613.54643893, 140251528.422108, 48970610.04698926, 140251532.4081993, 48970610.38027018, 0, 0, 0, 0, 0 },
-  { 140251527.95966977, 48970639.58159629, 140251488.09104165, 48970636.34238451, 140251567.82829788, 48970642.820808075, 140251525.96623835, 48970639.419635706, 140251529.9531012, 48970639.74355688, 1, 0, 140251880.7970285, 48970668.24862059, 44 },
-  { 140251525.57801557, 48970668.895297274, 140251485.71069628, 48970665.6400164, 140251565.44533485, 48970672.15057815, 140251523.5846496, 48970668.73253323, 140251527.57138154, 48970669.05806132, 0, 0, 0, 0, 0 },
-  { 140251523.1899635, 48970698.14169356, 140251483.33317393, 48970694.75992973, 140251563.04675305, 48970701.52345739, 140251521.197124, 48970697.97260537, 140251525.18280298, 48970698.310781755, 1, 0, 140251883.89390895, 48970728.74665623, 47 },
-  { 140251520.71528596, 48970727.30774612, 140251480.87937993, 48970723.688272335, 140251560.551192, 48970730.927219905, 140251518.72349066, 48970727.12677243, 140251522.70708126, 48970727.488719806, 0, 0, 0, 0, 0 },
-  { 140251518.07375532, 48970756.380415864, 140251478.27117896, 48970752.4111698, 140251557.8763317, 48970760.34966193, 140251516.0836265, 48970756.181953564, 140251520.06388414, 48970756.578878164, 0, 0, 0, 0, 0 },
-  { 140251515.1851442, 48970785.34666373, 140251475.43141904, 48970780.91480876, 140251554.93886933, 48970789.7785187, 140251513.19745794, 48970785.12507098, 140251517.17283043, 48970785.568256475, 0, 0, 0, 0, 0 },
-  { 140251511.96922478, 48970814.193450674, 140251472.2839492, 48970809.1855668, 140251551.65450037, 48970819.20133455, 140251509.984961, 48970813.94305648, 140251513.95348856, 48970814.44384487, 0, 0, 0, 0, 0 },
-  { 140251508.34576967, 48970842.907737605, 140251468.75362536, 48970837.21018468, 140251547.93791398, 48970848.60529053, 140251506.36616245, 48970842.62285996, 140251510.3253769, 48970843.19261525, 0, 0, 0, 0, 0 },
-  { 140251504.23455125, 48970871.47648546, 140251464.7662915, 48970864.9759876, 140251543.702811, 48970877.97698332, 140251502.26113826, 48970871.151460566, 140251506.20796424, 48970871.80151036, 1, 5, 140251880.16972536, 48970933.39372764, 38 },
-  { 140251499.55534196, 48970899.8866552, 140251460.24872342, 48970892.471148595, 140251538.8619605, 48970907.3021618, 140251497.59001103, 48970899.51587987, 140251501.5206729, 48970900.25743052, 1, 5, 140251358.0515152, 48970873.19083144, 27 },
-  { 140251494.22791415, 48970928.125207715, 140251455.1285188, 48970919.684989564, 140251533.32730952, 48970936.565425865, 140251492.2729444, 48970927.70319681, 140251496.18288392, 48970928.54721862, 1, 2, 140251660.40034443, 48970963.99613485, 46 },
-  { 140251488.17204034, 48970956.17910398, 140251449.33391753, 48970946.6083038, 140251527.01016316, 48970965.749904156, 140251486.2301342, 48970955.70056397, 140251490.1139465, 48970956.65764399, 0, 0, 0, 0, 0 },
-  { 140251481.307493, 48970984.03530491, 140251442.79353607, 48970973.2336791, 140251519.82144994, 48970994.83693072, 140251479.38179517, 48970983.49522362, 140251483.23319083, 48970984.575386204, 0, 0, 0, 0, 0 },
-  { 140251473.55404443, 48971011.680771425, 140251435.43600652, 48970999.555789515, 140251511.67208233, 48971023.805753335, 140251471.64814252, 48971011.07452233, 140251475.45994633, 48971012.28702052, 0, 0, 0, 0, 0 },
-  { 140251464.83146712, 48971039.10246448, 140251427.18360466, 48971025.588085026, 140251502.4793296, 48971052.61684394, 140251462.949074, 48971038.42674551, 140251466.71386024, 48971039.77818345, 0, 0, 0, 0, 0 },
-  { 140251455.07566622, 48971066.27981671, 140251417.95370114, 48971051.38150441, 140251492.1976313, 48971081.17812901, 140251453.21956795, 48971065.5349011, 140251456.93176448, 48971067.02473232, 0, 0, 0, 0, 0 },
-  { 140251444.28682068, 48971093.16226749, 140251407.74193367, 48971076.89969592, 140251480.8317077, 48971109.424839064, 140251442.45957634, 48971092.349138916, 140251446.11406502, 48971093.97539607, 0, 0, 0, 0, 0 },
-  { 140251432.48111385, 48971119.69178775, 140251396.56600723, 48971102.08198603, 140251468.39622048, 48971137.30158947, 140251430.68535852, 48971118.81129766, 140251434.27686918, 48971120.57227784, 1, 2, 140251216.99047413, 48971014.03297746, 37 },
-  { 140251419.67472908, 48971145.81034842, 140251384.44417882, 48971126.86811181, 140251454.90527934, 48971164.75258503, 140251417.91320157, 48971144.86323659, 140251421.4362566, 48971146.75746025, 0, 0, 0, 0, 0 },
-  { 140251405.8838499, 48971171.45992046, 140251371.44564444, 48971151.11268463, 140251440.32205534, 48971191.80715629, 140251404.16193962, 48971170.44255867, 140251407.60576016, 48971172.47728225, 0, 0, 0, 0, 0 },
-  { 140251391.0719891, 48971196.52936525, 140251357.77290335, 48971174.36698971, 140251424.37107483, 48971218.69174079, 140251389.4070348, 48971195.42124647, 140251392.73694336, 48971197.63748403, 0, 0, 0, 0, 0 },
-  { 140251374.98981148, 48971220.69292163, 140251343.32325977, 48971196.25464217, 140251406.6563632, 48971245.13120109, 140251373.4064839, 48971219.47100766, 140251376.57313907, 48971221.9148356, 0, 0, 0, 0, 0 },
-  { 140251357.3342227, 48971243.57062118, 140251327.73536524, 48971216.66508946, 140251386.93308017, 48971270.4761529, 140251355.85427985, 48971242.22534459, 140251358.81416556, 48971244.915897764, 0, 0, 0, 0, 0 },
-  { 140251337.92917365, 48971264.918174796, 140251310.16317874, 48971236.12495463, 140251365.69516855, 48971293.71139496, 140251336.54087391, 48971263.478513785, 140251339.31747338, 48971266.35783581, 1, 1, 140251210.89974698, 48971133.18919255, 33 },
-  { 140251317.08892614, 48971285.014926836, 140251290.6407213, 48971255.00672029, 140251343.53713098, 48971315.02313338, 140251315.76651588, 48971283.51451651, 140251318.4113364, 48971286.51533716, 0, 0, 0, 0, 0 },
-  { 140251295.24600866, 48971304.26652572, 140251269.53687614, 48971273.62275792, 140251320.9551412, 48971334.91029353, 140251293.96055204, 48971302.73433733, 140251296.5314653, 48971305.798714116, 1, 5, 140251150.63213825, 48971131.89533182, 41 },
-  { 140251272.82844868, 48971323.07413528, 140251247.47318515, 48971292.13693095, 140251298.1837122, 48971354.01133961, 140251271.56068552, 48971321.52727506, 140251274.09621185, 48971324.6209955, 0, 0, 0, 0, 0 },
-  { 140251250.11458817, 48971341.68977723, 140251224.99022436, 48971310.56476571, 140251275.23895198, 48971372.81478876, 140251248.85836998, 48971340.13352665, 140251251.37080637, 48971343.24602781, 0, 0, 0, 0, 0 },
-  { 140251227.20180318, 48971360.185164645, 140251202.20083216, 48971328.96095212, 140251252.2027742, 48971391.40937717, 140251225.95175463, 48971358.62395402, 140251228.45185173, 48971361.74637527, 0, 0, 0, 0, 0 },
-  { 140251204.17664224, 48971378.621222265, 140251179.19143337, 48971347.384395644, 140251229.1618511, 48971409.858048886, 140251202.92738178, 48971377.05938093, 140251205.4259027, 48971380.1830636, 0, 0, 0, 0, 0 },
-  { 140251181.1256539, 48971397.0588749, 140251156.04872367, 48971365.895634204, 140251206.20258412, 48971428.22211559, 140251179.87180737, 48971395.500712864, 140251182.37950042, 48971398.61703693, 0, 0, 0, 0, 0 },
-  { 140251158.13538668, 48971415.55904735, 140251132.85965714, 48971384.55682975, 140251183.4111162, 48971446.56126495, 140251156.8716002, 48971414.00893647, 140251159.39917314, 48971417.109158225, 1, 5, 140250951.50629768, 48971162.11591846, 44 },
-  { 140251135.29238915, 48971434.182664365, 140251109.71150842, 48971403.43175313, 140251160.8732699, 48971464.9335756, 140251134.01334512, 48971432.6451188, 140251136.5714332, 48971435.72020993, 0, 0, 0, 0, 0 },
-  { 140251112.6832098, 48971452.99065076, 140251086.6920106, 48971422.58575701, 140251138.674409, 48971483.39554451, 140251111.38364986, 48971451.47040607, 140251113.98276976, 48971454.510895446, 0, 0, 0, 0, 0 },
-  { 140251090.39439714, 48971472.04393129, 140251063.88957056, 48971442.08572426, 140251116.89922372, 48971502.002138324, 140251089.0691558, 48971470.54602094, 140251091.71963847, 48971473.54184164, 0, 0, 0, 0, 0 },
-  { 140251068.5124998, 48971491.40343078, 140251041.393565, 48971461.99997223, 140251095.63143462, 48971520.80688933, 140251067.15655306, 48971489.933257855, 140251069.86844656, 48971492.87360371, 1, 0, 140250806.81477892, 48971207.66005575, 34 },
-  { 140251047.12406626, 48971511.13007396, 140251019.29471257, 48971482.39808701, 140251074.95341995, 48971539.862060905, 140251045.73259857, 48971509.69347461, 140251048.51553395, 48971512.5666733, 0, 0, 0, 0, 0 },
-  { 140251026.31564504, 48971531.284785666, 140250997.68551815, 48971503.35065181, 140251054.94577193, 48971559.21891952, 140251024.8841387, 48971529.88807897, 140251027.74715137, 48971532.68149236, 0, 0, 0, 0, 0 },
-  { 140251006.17378467, 48971551.92849064, 140250976.66076407, 48971524.92883111, 140251035.68680528, 48971578.92815017, 140251004.69813365, 48971550.57850766, 140251007.6494357, 48971553.278473616, 0, 0, 0, 0, 0 },
-  { 140250986.7850337, 48971573.1221137, 140250956.31801108, 48971547.203770146, 140251017.25205633, 48971599.04045725, 140250985.26168257, 48971571.82619652, 140250988.30838484, 48971574.41803087, 1, 2, 140250894.62229025, 48971494.719124466, 34 },
-  { 140250968.23594064, 48971594.9265796, 140250936.7580422, 48971570.24577917, 140250999.71383908, 48971619.60738003, 140250966.66204572, 48971593.69253958, 140250969.80983555, 48971596.160619624, 1, 1, 140251252.32397404, 48971817.6708035, 28 },
-  { 140250950.61305404, 48971617.402813144, 140250918.08515826, 48971594.123294346, 140250983.14094982, 48971640.68233194, 140250948.98665926, 48971616.238837205, 140250952.23944882, 48971618.56678908, 0, 0, 0, 0, 0 },
-  { 140250934.00292248, 48971640.611739114, 140250900.4079537, 48971618.90049608, 140250967.59789124, 48971662.32298215, 140250932.32317403, 48971639.52617696, 140250935.68267092, 48971641.69730127, 1, 4, 140251151.5303452, 48971781.19203775, 43 },
-  { 140250918.4913565, 48971664.61361565, 140250883.88869286, 48971644.54733377, 140250953.09402013, 48971684.679897524, 140250916.76122332, 48971663.610301554, 140250920.22148967, 48971665.61692974, 1, 3, 140250773.16016915, 48971580.33523176, 40 },
-  { 140250904.1074603, 48971689.41746946, 140250868.64632258, 48971670.91050556, 140250939.568598, 48971707.92443335, 140250902.3344034, 48971688.492121264, 140250905.88051718, 48971690.34281765, 0, 0, 0, 0, 0 },
-  { 140250890.784433, 48971714.94568186, 140250854.60476577, 48971697.88603127, 140250926.96410024, 48971732.005332455, 140250888.97544965, 48971714.092699334, 140250892.59341636, 48971715.79866439, 1, 3, 140250572.4033613, 48971564.820756674, 30 },
-  { 140250878.4462107, 48971741.112265676, 140250841.66970062, 48971725.38050461, 140250915.2227208, 48971756.844026744, 140250876.60738522, 48971740.325677626, 140250880.2850362, 48971741.89885373, 1, 3, 140250987.8563282, 48971787.91425485, 42 },
-  { 140250867.01672974, 48971767.83123378, 140250829.74800083, 48971753.30395441, 140250904.28545865, 48971782.35851315, 140250865.1532933, 48971767.104869805, 140250868.88016617, 48971768.55759775, 0, 0, 0, 0, 0 },
-  { 140250856.4199263, 48971795.016599, 140250818.7482028, 48971781.56887613, 140250894.09164977, 48971808.46432187, 140250854.53634012, 48971794.34421285, 140250858.30351245, 48971795.68898515, 0, 0, 0, 0, 0 },
-  { 140250846.5797366, 48971822.58237417, 140250808.58072203, 48971810.08938045, 140250884.57875115, 48971835.07536789, 140250844.67978585, 48971821.95772448, 140250848.47968733, 48971823.20702386, 0, 0, 0, 0, 0 },
-  { 140250837.420097, 48971850.44257216, 140250799.15790108, 48971838.780481316, 140250875.6822929, 48971862.10466301, 140250835.50698718, 48971849.85946762, 140250839.3332068, 48971851.025676705, 0, 0, 0, 0, 0 },
-  { 140250828.8649436, 48971878.511205815, 140250790.39395723, 48971867.55752109, 140250867.33592996, 48971889.46489054, 140250826.94139427, 48971877.96352158, 140250830.78849292, 48971879.05889005, 0, 0, 0, 0, 0 },
-  { 140250820.83821326, 48971906.70228861, 140250782.19836912, 48971896.36002372, 140250859.4780574, 48971917.0445535, 140250818.90622106, 48971906.18517537, 140250822.77020547, 48971907.21940186, 1, 5, 140250936.75774574, 48971937.72908328, 28 },
-  { 140250813.2784419, 48971934.94642956, 140250774.48239785, 48971925.20646205, 140250852.07448596, 48971944.68639707, 140250811.3386397, 48971934.45943119, 140250815.2182441, 48971935.43342793, 0, 0, 0, 0, 0 },
-  { 140250806.17669806, 48971963.233953804, 140250767.2320152, 48971954.10643084, 140250845.12138093, 48971972.361476764, 140250804.2294639, 48971962.77757765, 140250808.1239322, 48971963.690329954, 0, 0, 0, 0, 0 },
-  { 140250799.53586194, 48971991.56861347, 140250760.45060244, 48971983.06317466, 140250838.62112144, 48972000.07405228, 140250797.58159897, 48971991.14334153, 140250801.4901249, 48971991.99388541, 0, 0, 0, 0, 0 },
-  { 140250793.35881367, 48972019.95416063, 140250754.14152268, 48972012.07989318, 140250832.57610467, 48972027.82842808, 140250791.39794913, 48972019.56044726, 140250795.31967822, 48972020.347874, 1, 5, 140251074.74287647, 48972076.4520296, 36 },
-  { 140250787.6484336, 48972048.394347414, 140250748.3081174, 48972041.1597417, 140250826.9887498, 48972055.62895313, 140250785.6814178, 48972048.03261713, 140250789.6154494, 48972048.7560777, 1, 1, 140250477.8434434, 48971991.4218274, 38 },
-  { 140250782.40760183, 48972076.892925896, 140250742.95370188, 48972070.30583399, 140250821.86150178, 48972083.4800178, 140250780.43490684, 48972076.563571304, 140250784.38029683, 48972077.22228049, 0, 0, 0, 0, 0 },
-  { 140250777.63919863, 48972105.45364822, 140250738.08156243, 48972099.5212442, 140250817.19683483, 48972111.386052236, 140250775.6613168, 48972105.15702802, 140250779.61708045, 48972105.750268415, 1, 0, 140250663.91099453, 48972088.39798665, 34 },
-  { 140250773.34610426, 48972134.08026645, 140250733.69495234, 48972128.80900947, 140250812.9972562, 48972139.35152344, 140250771.36354667, 48972133.8167036, 140250775.32866186, 48972134.343829304, 0, 0, 0, 0, 0 },
-  { 140250769.53119886, 48972162.77653271, 140250729.79708865, 48972158.17213408, 140250809.26530907, 48972167.38093134, 140250767.54449335, 48972162.54631278, 140250771.51790437, 48972163.00675264, 1, 3, 140250610.59475806, 48972144.35893819, 36 },
-  { 140250766.19736272, 48972191.54619909, 140250726.3911496, 48972187.61359215, 140250806.00357583, 48972195.478806034, 140250764.20705205, 48972191.34956875, 140250768.1876734, 48972191.742829435, 0, 0, 0, 0, 0 },
-  { 140250763.34747598, 48972220.393017724, 140250723.48027137, 48972217.13633281, 140250803.21468058, 48972223.64970264, 140250761.35411575, 48972220.23018348, 140250765.3408362, 48972220.555851966, 0, 0, 0, 0, 0 },
-  { 140250760.98441893, 48972249.32074066, 140250721.06754637, 48972246.74328364, 140250800.9012915, 48972251.89819769, 140250758.9885753, 48972249.19186781, 140250762.98026255, 48972249.44961351, 0, 0, 0, 0, 0 },
-  { 140250759.11107174, 48972278.33312005, 140250719.156021, 48972276.43735635, 140250799.06612247, 48972280.22888374, 140250757.1133192, 48972278.23833186, 140250761.10882428, 48972278.427908234, 1, 2, 140250556.3391892, 48972268.71211928, 39 },
-  { 140250757.7303147, 48972307.433907986, 140250717.74869457, 48972306.22145078, 140250797.71193483, 48972308.64636519, 140250755.7312337, 48972307.37328512, 140250759.72939572, 48972307.49453085, 1, 0, 140251091.57684273, 48972317.55792566, 41 },
-  { 140250756.8450279, 48972336.62685656, 140250716.84883884, 48972336.07471352, 140250796.84121695, 48972337.178999595, 140250754.84521845, 48972336.59924941, 140250758.84483734, 48972336.65446371, 0, 0, 0, 0, 0 },
-  { 140250756.4407512, 48972365.91188998, 140250716.44082543, 48972365.83482928, 140250796.44067696, 48972365.98895068, 140250754.44075492, 48972365.90803694, 140250758.44074747, 48972365.915743016, 1, 5, 140250974.44034666, 48972366.33187079, 44 },
-  { 140250756.38420624, 48972395.26270347, 140250716.38447702, 48972395.40988185, 140250796.38393545, 48972395.11552509, 140250754.38421977, 48972395.27006239, 140250758.3841927, 48972395.255344555, 1, 5, 140250383.38673115, 48972396.63514186, 43 },
-  { 140250756.4923069, 48972424.64199723, 140250716.49249256, 48972424.76387484, 140250796.49212122, 48972424.52011962, 140250754.4923162, 48972424.648091115, 140250758.4922976, 48972424.63590335, 0, 0, 0, 0, 0 },
-  { 140250756.58179727, 48972454.01243396, 140250716.58209097, 48972453.859147534, 140250796.58150357, 48972454.16572039, 140250754.58181196, 48972454.00476964, 140250758.58178258, 48972454.020098284, 1, 4, 140250520.58353016, 48972453.108044036, 50 },
-  { 140250756.46942124, 48972483.33667635, 140250716.47520944, 48972482.65621918, 140250796.46363303, 48972484.01713353, 140250754.46971065, 48972483.30265349, 140250758.46913183, 48972483.37069921, 0, 0, 0, 0, 0 },
-  { 140250755.97192296, 48972512.5773871, 140250715.9986918, 48972511.1142428, 140250795.94515413, 48972514.040531404, 140250753.97326142, 48972512.50422989, 140250757.9705845, 48972512.650544316, 1, 3, 140250589.0836829, 48972506.46875963, 34 },
-  { 140250754.9060464, 48972541.69722889, 140250714.98458034, 48972539.19192499, 140250794.82751244, 48972544.2025328, 140250752.90997308, 48972541.5719637, 140250756.9021197, 48972541.82249409, 0, 0, 0, 0, 0 },
-  { 140250753.08853552, 48972570.65886442, 140250713.27038923, 48972566.84897911, 140250792.9066818, 48972574.46874974, 140250751.0976282, 48972570.468370155, 140250755.07944283, 48972570.84935869, 1, 3, 140250590.8295894, 48972555.133581765, 48 },
-  { 140250750.33613437, 48972599.424956396, 140250710.69915375, 48972594.04817599, 140250789.973115, 48972604.8017368, 140250748.35428533, 48972599.15611737, 140250752.31798342, 48972599.69379542, 1, 2, 140250916.81145296, 48972622.00743411, 29 },
-  { 140250746.46558702, 48972627.95816751, 140250707.11895654, 48972620.75798209, 140250785.8122175, 48972635.15835293, 140250744.4982555, 48972627.59815824, 140250748.43291855, 48972628.318176776, 0, 0, 0, 0, 0 },
-  { 140250741.29363742, 48972656.221160434, 140250702.38156173, 48972646.95561317, 140250780.20571312, 48972665.486707695, 140250739.34803364, 48972655.75788307, 140250743.2392412, 48972656.6844378, 0, 0, 0, 0, 0 },
-  { 140250734.63702962, 48972684.17659788, 140250696.33951253, 48972672.63102801, 140250772.9345467, 48972695.722167745, 140250732.72215375, 48972683.59931938, 140250736.55190548, 48972684.75387637, 0, 0, 0, 0, 0 },
-  { 140250726.3138424, 48972711.78523123, 140250688.83362243, 48972697.81264698, 140250763.79406235, 48972725.75781549, 140250724.43983138, 48972711.08660202, 140250728.1878534, 48972712.48386045, 1, 1, 140250904.34488726, 48972778.15500644, 25 },
-  { 140250716.19179407, 48972738.93672953, 140250679.74996617, 48972722.44451379, 140250752.63362196, 48972755.428945266, 140250714.36970267, 48972738.11211874, 140250718.01388547, 48972739.76134031, 0, 0, 0, 0, 0 },
-  { 140250704.20181477, 48972765.43024435, 140250669.05348504, 48972746.335875645, 140250739.3501445, 48972784.52461305, 140250702.44439828, 48972764.475525916, 140250705.95923126, 48972766.38496278, 0, 0, 0, 0, 0 },
-  { 140250690.27893382, 48972791.059057645, 140250656.71526247, 48972769.299462855, 140250723.84260517, 48972812.818652436, 140250688.60075027, 48972789.971077904, 140250691.95711738, 48972792.14703739, 0, 0, 0, 0, 0 },
-  { 140250674.3581804, 48972815.616451316, 140250642.70247826, 48972791.1641197, 140250706.01388255, 48972840.06878293, 140250672.7753953, 48972814.39383473, 140250675.9409655, 48972816.8390679, 0, 0, 0, 0, 0 },
-  { 140250656.37929708, 48972838.89170312, 140250626.9645535, 48972811.78500909, 140250685.79404065, 48972865.99839715, 140250654.9085599, 48972837.53636842, 140250657.85003427, 48972840.24703782, 0, 0, 0, 0, 0 },
-  { 140250636.39281407, 48972860.57997215, 140250609.59448922, 48972830.88401644, 140250663.19113892, 48972890.27592786, 140250635.05289784, 48972859.095174365, 140250637.7327303, 48972862.06476993, 0, 0, 0, 0, 0 },
-  { 140250614.5613883, 48972880.28116126, 140250590.84447685, 48972848.07078855, 140250638.27829978, 48972912.49153398, 140250613.37554273, 48972878.67064263, 140250615.7472339, 48972881.8916799, 1, 5, 140250504.87067276, 48972731.30818746, 28 },
-  { 140250591.05265793, 48972897.59094163, 140250570.9804444, 48972862.99171846, 140250611.12487146, 48972932.1901648, 140250590.04904726, 48972895.86098047, 140250592.0562686, 48972899.32090279, 0, 0, 0, 0, 0 },
-  { 140250566.0342611, 48972912.10498436, 140250550.20033365, 48972875.37234572, 140250581.86818856, 48972948.83762299, 140250565.24256474, 48972910.26835243, 140250566.82595748, 48972913.94161629, 0, 0, 0, 0, 0 },
-  { 140250539.67725155, 48972923.46640551, 140250528.06193244, 48972885.18998506, 140250551.29257065, 48972961.74282596, 140250539.09648558, 48972921.55258449, 140250540.2580175, 48972925.38022653, 1, 2, 140250584.10584706, 48973069.87371373, 44 },
-  { 140250512.1879555, 48972931.80827608, 140250504.25621092, 48972892.602569506, 140250520.11970007, 48972971.01398265, 140250511.79136828, 48972929.84799075, 140250512.58454272, 48972933.76856141, 1, 5, 140250473.91728795, 48972742.64074185, 38 },
-  { 140250483.7935131, 48972937.552783296, 140250478.91409028, 48972897.85150834, 140250488.6729359, 48972977.25405825, 140250483.54954195, 48972935.56771955, 140250484.03748423, 48972939.53784704, 1, 4, 140250501.60340637, 48973082.46243688, 42 },
-  { 140250454.72133353, 48972941.125853844, 140250452.24990532, 48972901.20227632, 140250457.19276175, 48972981.04943137, 140250454.5977621, 48972939.12967497, 140250454.84490496, 48972943.12203272, 0, 0, 0, 0, 0 },
-  { 140250425.1988262, 48972942.95341446, 140250424.51582593, 48972902.959246, 140250425.88182646, 48972982.94758292, 140250425.1646762, 48972940.95370604, 140250425.2329762, 48972944.953122884, 0, 0, 0, 0, 0 },
-  { 140250395.45340034, 48972943.46139187, 140250396.07975712, 48972903.46629621, 140250394.82704356, 48972983.45648754, 140250395.48471817, 48972941.46163709, 140250395.4220825, 48972945.46114666, 0, 0, 0, 0, 0 },
-  { 140250365.7052976, 48972942.99551161, 140250367.80092505, 48972903.050445005, 140250363.60967013, 48972982.94057821, 140250365.81007895, 48972940.99825828, 140250365.60051623, 48972944.992764935, 1, 4, 140250350.35482654, 48973235.59312444, 41 },
-  { 140250336.1338815, 48972941.44411424, 140250340.09715965, 48972901.64094318, 140250332.17060336, 48972981.2472853, 140250336.3320454, 48972939.45395569, 140250335.9357176, 48972943.43427279, 1, 5, 140250362.88600907, 48972672.7727096, 41 },
-  { 140250306.90404683, 48972938.533643484, 140250313.15331095, 48972899.024825506, 140250300.6547827, 48972978.04246146, 140250307.21651003, 48972936.55820259, 140250306.59158364, 48972940.50908438, 1, 3, 140250246.75487965, 48973318.80601651, 38 },
-  { 140250278.18067136, 48972933.99035495, 140250287.14378357, 48972895.00750463, 140250269.21755916, 48972972.97320527, 140250278.62882698, 48972932.04121243, 140250277.73251575, 48972935.93949746, 1, 5, 140250357.05605888, 48972590.941272095, 39 },
-  { 140250250.12863278, 48972927.54050411, 140250262.21934202, 48972889.41158137, 140250238.03792354, 48972965.66942686, 140250250.73316824, 48972925.63405798, 140250249.52409732, 48972929.44695025, 0, 0, 0, 0, 0 },
-  { 140250222.912809, 48972918.91034652, 140250238.4357496, 48972882.04520965, 140250207.38986844, 48972955.77548339, 140250223.68895605, 48972917.06708968, 140250222.13666198, 48972920.75360337, 1, 4, 140250266.3770426, 48972815.68796329, 26 },
-  { 140250196.68008205, 48972907.86443442, 140250215.30106914, 48972872.4630384, 140250178.05909497, 48972943.26583044, 140250197.6111314, 48972906.09436462, 140250195.7490327, 48972909.63450422, 0, 0, 0, 0, 0 },
-  { 140250171.39151794, 48972894.56275487, 140250192.44753382, 48972860.55328273, 140250150.33550206, 48972928.57222701, 140250172.44431874, 48972892.86228126, 140250170.33871713, 48972896.263228476, 0, 0, 0, 0, 0 },
-  { 140250146.8985453, 48972879.39861416, 140250169.7789408, 48972846.58874519, 140250124.0181498, 48972912.20848313, 140250148.04256508, 48972877.758120716, 140250145.7545255, 48972881.039107606, 0, 0, 0, 0, 0 },
-  { 140250123.0511751, 48972862.76833556, 140250147.21360725, 48972830.89080629, 140250098.88874292, 48972894.64586483, 140250124.2592967, 48972861.17445909, 140250121.8430535, 48972864.362212025, 1, 1, 140250223.32526854, 48972730.47658908, 42 },
-  { 140250099.69941822, 48972845.0682423, 140250124.661265, 48972813.8127435, 140250074.73757145, 48972876.32374109, 140250100.94751057, 48972843.505467355, 140250098.45132586, 48972846.63101724, 0, 0, 0, 0, 0 },
-  { 140250076.6932857, 48972826.69465759, 140250102.0127277, 48972795.72812957, 140250051.3738437, 48972857.6611856, 140250077.9592578, 48972825.14633118, 140250075.4273136, 48972828.24298399, 0, 0, 0, 0, 0 },
-  { 140250053.88278845, 48972808.043904684, 140250079.13533932, 48972777.02280422, 140250028.63023758, 48972839.065005146, 140250055.145416, 48972806.49284966, 140250052.6201609, 48972809.594959706, 1, 4, 140249951.6099574, 48972933.67936157, 36 },
-  { 140250031.11793742, 48972789.512306824, 140250055.88202563, 48972758.09988994, 140250006.3538492, 48972820.92472371, 140250032.35614184, 48972787.94168598, 140250029.879733, 48972791.08292767, 0, 0, 0, 0, 0 },
-  { 140250008.25213555, 48972771.4859723, 140250032.63267708, 48972739.77494591, 140249983.871594, 48972803.19699869, 140250009.47116262, 48972769.90042098, 140250007.03310847, 48972773.07152362, 0, 0, 0, 0, 0 },
-  { 140249985.30712134, 48972753.845046245, 140250009.80950946, 48972722.22807332, 140249960.80473322, 48972785.46201917, 140249986.53224075, 48972752.264197595, 140249984.08200192, 48972755.42589489, 0, 0, 0, 0, 0 },
-  { 140249962.4325504, 48972736.117807895, 140249987.10491598, 48972704.63329778, 140249937.76018482, 48972767.60231801, 140249963.6661687, 48972734.54358239, 140249961.1989321, 48972737.6920334, 0, 0, 0, 0, 0 },
-  { 140249939.64854935, 48972718.26346616, 140249964.5067169, 48972686.92544602, 140249914.7903818, 48972749.601486295, 140249940.89145774, 48972716.69656515, 140249938.40564096, 48972719.83036716, 1, 5, 140250030.3808609, 48972603.87969265, 29 },
-  { 140249916.96613476, 48972700.27115969, 140249942.0257045, 48972669.09395705, 140249891.906565, 48972731.448362336, 140249918.21911323, 48972698.71229956, 140249915.71315628, 48972701.830019824, 1, 2, 140249689.55053937, 48972983.204273656, 28 },
-  { 140249894.39632326, 48972682.13002716, 140249919.67264503, 48972651.12829241, 140249869.1200015, 48972713.13176191, 140249895.66013935, 48972680.57994042, 140249893.13250718, 48972683.6801139, 0, 0, 0, 0, 0 },
-  { 140249871.95013148, 48972663.8292072, 140249897.45827627, 48972633.017934114, 140249846.44198668, 48972694.64048028, 140249873.22553873, 48972662.28864354, 140249870.67472422, 48972665.369770855, 0, 0, 0, 0, 0 },
-  { 140249849.63857606, 48972645.35783847, 140249875.39330477, 48972614.75238226, 140249823.88384736, 48972675.96329467, 140249850.9263125, 48972643.827565655, 140249848.3508396, 48972646.88811128, 1, 1, 140250005.45468473, 48972460.19482845, 45 },
-  { 140249827.47267354, 48972626.70505962, 140249853.4884033, 48972596.32115259, 140249801.45694378, 48972657.088966645, 140249828.77346003, 48972625.18586427, 140249826.17188704, 48972628.224254966, 1, 5, 140249680.4838005, 48972798.3741343, 43 },
-  { 140249805.46344054, 48972607.860009275, 140249831.75420788, 48972577.71377316, 140249779.1726732, 48972638.00624539, 140249806.7779789, 48972606.35269747, 140249804.14890218, 48972609.36732108, 1, 3, 140249964.522583, 48972425.47528077, 39 },
-  { 140249783.6218937, 48972588.81182614, 140249810.20131537, 48972558.919781305, 140249757.04247203, 48972618.703870974, 140249784.9508648, 48972587.3172239, 140249782.29292262, 48972590.30642838, 0, 0, 0, 0, 0 },
-  { 140249761.9590496, 48972569.54964884, 140249788.84028023, 48972539.92871975, 140249735.077819, 48972599.170577936, 140249763.30311114, 48972568.06860239, 140249760.6149881, 48972571.0306953, 1, 2, 140249978.35295615, 48972331.101169676, 44 },
-  { 140249740.4859249, 48972550.06261601, 140249767.68161216, 48972520.73013241, 140249713.29023764, 48972579.39509962, 140249741.84570926, 48972548.595991835, 140249739.12614053, 48972551.52924019, 0, 0, 0, 0, 0 },
-  { 140249719.21353614, 48972530.339866325, 140249746.7357735, 48972501.31356015, 140249691.69129878, 48972559.3661725, 140249720.589648, 48972528.88855102, 140249717.83742428, 48972531.79118163, 1, 0, 140249932.51087576, 48972305.38599347, 32 },
-  { 140249698.15290007, 48972510.37053844, 140249726.01317686, 48972481.668535426, 140249670.29262328, 48972539.07254146, 140249699.5459139, 48972508.93543829, 140249696.75988623, 48972511.8056386, 0, 0, 0, 0, 0 },
-  { 140249677.31503314, 48972490.14377099, 140249705.52418298, 48972461.784577325, 140249649.1058833, 48972518.50296466, 140249678.72549063, 48972488.72581131, 140249675.90457565, 48972491.561730675, 1, 1, 140249782.39411628, 48972384.50577458, 25 },
-  { 140249656.71095198, 48972469.648702644, 140249685.27909938, 48972441.6511857, 140249628.1428046, 48972497.64621959, 140249658.13935935, 48972468.248826794, 140249655.2825446, 48972471.04857849, 1, 0, 140249546.00938088, 48972578.139080815, 47 },
-  { 140249636.3516733, 48972448.87447202, 140249665.28817868, 48972421.2578347, 140249607.41516793, 48972476.49110934, 140249637.79849857, 48972447.493640155, 140249634.90484804, 48972450.25530389, 1, 5, 140249755.71475795, 48972334.95584307, 46 },
-  { 140249616.24821362, 48972427.810217805, 140249645.56161824, 48972400.59396698, 140249586.934809, 48972455.02646863, 140249617.71388385, 48972426.44940526, 140249614.7825434, 48972429.17103035, 0, 0, 0, 0, 0 },
-  { 140249596.4115896, 48972406.445078634, 140249626.1095599, 48972379.64898639, 140249566.7136193, 48972433.241170876, 140249597.8964881, 48972405.10527402, 140249594.9266911, 48972407.784883246, 0, 0, 0, 0, 0 },
-  { 140249576.85281786, 48972384.76819318, 140249606.94209048, 48972358.412251286, 140249546.76354524, 48972411.12413507, 140249578.3572815, 48972383.45039608, 140249575.34835422, 48972386.08599027, 1, 2, 140249334.6341732, 48972596.933525376, 33 },
-  { 140249557.58291495, 48972362.768700056, 140249588.067681, 48972336.87122842, 140249527.09814888, 48972388.66617169, 140249559.10715327, 48972361.473826475, 140249556.05867663, 48972364.063573636, 1, 3, 140249847.95031184, 48972116.09528271, 37 },
-  { 140249538.6117592, 48972340.43712832, 140249569.38222724, 48972314.87977526, 140249507.84129113, 48972365.99448138, 140249540.1502826, 48972339.15926067, 140249537.07323578, 48972341.71499597, 1, 1, 140249313.98734233, 48972527.005805634, 49 },
-  { 140249519.86517698, 48972317.866672456, 140249550.62817875, 48972292.30033284, 140249489.1021752, 48972343.433012076, 140249521.40332708, 48972316.588355474, 140249518.32702687, 48972319.14498944, 1, 2, 140249673.68018585, 48972190.034974344, 43 },
-  { 140249501.1287437, 48972295.32183661, 140249531.57161233, 48972269.3751268, 140249470.6858751, 48972321.268546425, 140249502.65088713, 48972294.02450112, 140249499.60660028, 48972296.6191721, 0, 0, 0, 0, 0 },
-  { 140249482.17472464, 48972273.08338262, 140249511.9658307, 48972246.39087434, 140249452.38361856, 48972299.7758909, 140249483.66427994, 48972271.748757206, 140249480.68516934, 48972274.41800804, 1, 0, 140249622.19292325, 48972147.62859371, 43 },
-  { 140249462.77538523, 48972251.432072364, 140249491.54752868, 48972223.64423759, 140249434.00324178, 48972279.219907135, 140249464.21399242, 48972250.04268063, 140249461.33677804, 48972252.8214641, 1, 1, 140249196.63305834, 48972508.46954401, 31 },
-  { 140249442.70299062, 48972230.64866762, 140249470.04016015, 48972201.44799703, 140249415.3658211, 48972259.8493382, 140249444.0698491, 48972229.18863409, 140249441.33613214, 48972232.10870115, 1, 4, 140249703.0895303, 48971952.51228029, 27 },
-  { 140249421.72980627, 48972211.01393032, 140249447.16134322, 48972180.13939504, 140249396.29826933, 48972241.8884656, 140249423.00138313, 48972209.470203556, 140249420.45822942, 48972212.557657085, 0, 0, 0, 0, 0 },
-  { 140249399.6280974, 48972192.808622256, 140249422.6812621, 48972160.11991479, 140249376.57493266, 48972225.49732972, 140249400.7807556, 48972191.174186885, 140249398.47543916, 48972194.44305763, 0, 0, 0, 0, 0 },
-  { 140249376.20620462, 48972176.29072375, 140249396.57321206, 48972141.864207685, 140249355.8391972, 48972210.71723981, 140249377.224555, 48972174.56939795, 140249375.18785426, 48972178.01204955, 0, 0, 0, 0, 0 },
-  { 140249351.41840228, 48972161.62605789, 140249368.85156018, 48972125.624877274, 140249333.9852444, 48972197.62723851, 140249352.2900602, 48972159.825998865, 140249350.54674438, 48972163.42611692, 0, 0, 0, 0, 0 },
-  { 140249325.25586075, 48972148.95714788, 140249339.53934145, 48972111.59430298, 140249310.97238004, 48972186.31999278, 140249325.97003478, 48972147.089005634, 140249324.5416867, 48972150.82529013, 0, 0, 0, 0, 0 },
-  { 140249297.70975062, 48972138.4265169, 140249308.67432615, 48972099.9586331, 140249286.7451751, 48972176.89440069, 140249298.2579794, 48972136.50312271, 140249297.16152185, 48972140.349911086, 0, 0, 0, 0, 0 },
-  { 140249268.7742695, 48972130.17898059, 140249276.05149063, 48972090.846525125, 140249261.49704835, 48972169.51143605, 140249269.13813055, 48972128.21235782, 140249268.41040844, 48972132.14560336, 1, 2, 140249222.5639153, 48972379.94007277, 26 },
-  { 140249238.8069035, 48972124.6344717, 140249241.32505795, 48972084.71381416, 140249236.28874907, 48972164.55512924, 140249238.93281123, 48972122.63843882, 140249238.6809958, 48972126.63050458, 0, 0, 0, 0, 0 },
-  { 140249208.8690936, 48972122.74602513, 140249205.01899213, 48972082.93174731, 140249212.71919507, 48972162.56030295, 140249208.67658854, 48972120.755311236, 140249209.06159866, 48972124.736739025, 0, 0, 0, 0, 0 },
-  { 140249180.10293669, 48972125.52775644, 140249167.9137389, 48972087.430204585, 140249192.29213446, 48972163.62530829, 140249179.4934768, 48972123.62287884, 140249180.71239656, 48972127.43263403, 1, 0, 140249071.6190764, 48971786.45954493, 31 },
-  { 140249153.64899725, 48972133.99161525, 140249132.56200275, 48972100.00134218, 140249174.73599175, 48972167.981888324, 140249152.59464753, 48972132.2921016, 140249154.70334697, 48972135.6911289, 0, 0, 0, 0, 0 },
-  { 140249130.2109834, 48972148.53216536, 140249102.7866117, 48972119.41337698, 140249157.6353551, 48972177.65095375, 140249128.8397648, 48972147.076225944, 140249131.582202, 48972149.98810478, 0, 0, 0, 0, 0 },
-  { 140249109.4561808, 48972168.079249986, 140249078.18071163, 48972143.14242928, 140249140.73165, 48972193.016070694, 140249107.89240736, 48972166.83240895, 140249111.01995426, 48972169.32609102, 0, 0, 0, 0, 0 },
-  { 140249090.9015446, 48972191.35025794, 140249057.43803644, 48972169.43693728, 140249124.36505276, 48972213.2635786, 140249089.2283692, 48972190.254591905, 140249092.57472, 48972192.44592398, 0, 0, 0, 0, 0 },
-  { 140249074.06402975, 48972217.062578045, 140249039.4729806, 48972196.97628127, 140249108.65507892, 48972237.14887482, 140249072.3344773, 48972216.058263205, 140249075.7935822, 48972218.066892885, 1, 1, 140249283.33987716, 48972338.584673524, 26 },
-  { 140249058.46059138, 48972243.93359912, 140249023.42202872, 48972224.638544664, 140249093.49915403, 48972263.22865358, 140249056.70866325, 48972242.968846396, 140249060.2125195, 48972244.89835185, 1, 2, 140248747.49334773, 48972072.68999083, 43 },
-  { 140249043.65580037, 48972270.8181357, 140249008.33277196, 48972252.04891451, 140249078.9788288, 48972289.587356895, 140249041.88964894, 48972269.87967464, 140249045.4219518, 48972271.75659676, 1, 4, 140249146.97565848, 48972325.718107685, 30 },
-  { 140249029.51323104, 48972297.43396452, 140248993.90028176, 48972279.220841706, 140249065.12618032, 48972315.647087336, 140249027.73258358, 48972296.52330838, 140249031.2938785, 48972298.34462066, 1, 5, 140248876.37754908, 48972219.11753641, 30 },
-  { 140249016.01224887, 48972323.83305039, 140248980.10595593, 48972306.20528459, 140249051.91854182, 48972341.4608162, 140249014.21693423, 48972322.9516621, 140249017.8075635, 48972324.714438684, 0, 0, 0, 0, 0 },
-  { 140249003.13247135, 48972350.06808606, 140248966.93196413, 48972333.05270253, 140249039.33297858, 48972367.083469585, 140249001.322446, 48972349.21731688, 140249004.94249672, 48972350.918855235, 1, 3, 140248764.20912367, 48972237.766554765, 38 },
-  { 140248990.8535162, 48972376.19176433, 140248954.36056724, 48972359.81297692, 140249027.34646514, 48972392.570551746, 140248989.02886873, 48972375.37282496, 140248992.67816365, 48972377.010703705, 1, 5, 140249184.26614562, 48972462.99933763, 48 },
-  { 140248979.155001, 48972402.25677796, 140248942.37403736, 48972386.53543221, 140249015.93596467, 48972417.9781237, 140248977.31595284, 48972401.47071067, 140248980.9940492, 48972403.04284524, 1, 0, 140248877.08782685, 48972358.630043514, 39 },
-  { 140248968.0165434, 48972428.31581971, 140248930.95457247, 48972413.26888274, 140249005.0785143, 48972443.362756684, 140248966.16344485, 48972427.56347286, 140248969.86964193, 48972429.06816656, 0, 0, 0, 0, 0 },
-  { 140248957.41776097, 48972454.421582386, 140248920.08421147, 48972440.06170488, 140248994.75131047, 48972468.78145989, 140248955.5510835, 48972453.70358851, 140248959.28443843, 48972455.139576264, 1, 0, 140248618.61579928, 48972324.10569402, 25 },
-  { 140248947.3382714, 48972480.62675873, 140248909.74527258, 48972466.9605069, 140248984.93127024, 48972494.29301056, 140248945.45862147, 48972479.94344614, 140248949.21792135, 48972481.31007133, 0, 0, 0, 0, 0 },
-  { 140248937.7572809, 48972506.98205864, 140248899.9255177, 48972493.991381444, 140248975.58904406, 48972519.97273583, 140248935.86569273, 48972506.33252478, 140248939.64886904, 48972507.6315925, 1, 1, 140248758.05640572, 48972445.27634197, 48 },
-  { 140248928.6481333, 48972533.50993774, 140248890.60267714, 48972521.15909709, 140248966.69358948, 48972545.86077839, 140248926.7458605, 48972532.892395705, 140248930.55040613, 48972534.12747978, 1, 5, 140249170.23678, 48972611.93777587, 28 },
-  { 140248919.9798054, 48972560.2118035, 140248881.74419492, 48972548.46284227, 140248958.2154159, 48972571.960764736, 140248918.06802487, 48972559.62435544, 140248921.89158595, 48972560.799251564, 0, 0, 0, 0, 0 },
-  { 140248911.72116962, 48972587.088560954, 140248873.31725794, 48972575.9019811, 140248950.1250813, 48972598.27514081, 140248909.80097404, 48972586.52923196, 140248913.6413652, 48972587.64788995, 1, 4, 140249088.3791633, 48972638.54682826, 36 },
-  { 140248903.84109843, 48972614.14111518, 140248865.2890675, 48972603.476176746, 140248942.39312935, 48972624.806053616, 140248901.91349688, 48972613.60786826, 140248905.76869997, 48972614.6743621, 0, 0, 0, 0, 0 },
-  { 140248896.3084644, 48972641.37037126, 140248857.62686998, 48972631.18536989, 140248934.99005884, 48972651.55537263, 140248894.3743847, 48972640.86112119, 140248898.2425441, 48972641.87962133, 1, 2, 140249151.6069876, 48972708.591380335, 48 },
-  { 140248889.09213993, 48972668.7772342, 140248850.29798216, 48972659.029756464, 140248927.8862977, 48972678.52471193, 140248887.15243205, 48972668.28986031, 140248891.0318478, 48972669.264608085, 1, 2, 140248547.70355147, 48972582.999430135, 32 },
-  { 140248882.16099763, 48972696.36260913, 140248843.26981288, 48972687.00976205, 140248921.05218238, 48972705.71545622, 140248880.21643838, 48972695.89496678, 140248884.10555688, 48972696.830251485, 1, 1, 140249158.28840935, 48972762.76782345, 48 },
-  { 140248875.48390988, 48972724.127401076, 140248836.5098786, 48972715.12601857, 140248914.45794114, 48972733.12878358, 140248873.5352083, 48972723.677331954, 140248877.43261144, 48972724.5774702, 1, 5, 140248692.30596292, 48972681.8209033, 43 },
-  { 140248869.02974918, 48972752.07251511, 140248829.98581615, 48972743.37934, 140248908.07368222, 48972760.765690215, 140248867.07755253, 48972751.63785635, 140248870.98194584, 48972752.507173866, 1, 4, 140249116.95872393, 48972807.27417702, 27 },
-  { 140248862.76738805, 48972780.19885629, 140248823.66539082, 48972771.770700276, 140248901.86938527, 48972788.6270123, 140248860.8122882, 48972779.77744848, 140248864.7224879, 48972780.62026409, 0, 0, 0, 0, 0 },
-  { 140248856.66569895, 48972808.50732967, 140248817.5165017, 48972800.30121281, 140248895.8148962, 48972816.713446535, 140248854.70823908, 48972808.09702383, 140248858.6231588, 48972808.917635515, 0, 0, 0, 0, 0 },
-  { 140248850.69355437, 48972836.99884033, 140248811.50718382, 48972828.97211226, 140248889.87992492, 48972845.0255684, 140248848.73423585, 48972836.59750393, 140248852.6528729, 48972837.400176734, 0, 0, 0, 0, 0 },
-  { 140248844.81982684, 48972865.67429333, 140248805.6056085, 48972857.784738205, 140248884.0340452, 48972873.56384846, 140248842.85911593, 48972865.27981558, 140248846.78053775, 48972866.06877109, 0, 0, 0, 0, 0 },
-  { 140248839.01338875, 48972894.53459373, 140248799.78008085, 48972886.7405221, 140248878.24669665, 48972902.32866536, 140248837.05172336, 48972894.14489015, 140248840.97505414, 48972894.92429731, 1, 1, 140248530.05108917, 48972833.156279676, 34 },
-  { 140248833.2431127, 48972923.58064659, 140248793.99903694, 48972915.84097504, 140248872.4871885, 48972931.32031814, 140248831.2809089, 48972923.19366301, 140248835.2053165, 48972923.96763017, 0, 0, 0, 0, 0 },
-  { 140248827.47787115, 48972952.81335697, 140248788.2310381, 48972945.087679304, 140248866.7247042, 48972960.53903464, 140248825.51552948, 48972952.42707309, 140248829.44021282, 48972953.199640855, 0, 0, 0, 0, 0 },
-  { 140248821.68653646, 48972982.23362992, 140248782.44476536, 48972974.482281625, 140248860.92830756, 48972989.984978214, 140248819.7244479, 48972981.846062504, 140248823.64862502, 48972982.621197335, 0, 0, 0, 0, 0 },
-  { 140248815.83798134, 48973011.84237056, 140248776.60901296, 48973004.02648682, 140248855.06694973, 48973019.6582543, 140248813.8765329, 48973011.451576374, 140248817.79942977, 48973012.23316475, 0, 0, 0, 0, 0 },
-  { 140248809.9010781, 48973041.6404839, 140248770.69268236, 48973033.7220432, 140248849.10947385, 48973049.5589246, 140248807.94065833, 48973041.244561866, 140248811.86149788, 48973042.036405936, 0, 0, 0, 0, 0 },
-  { 140248803.8446907, 48973071.628867075, 140248764.71010053, 48973063.35337001, 140248842.9792809, 48973079.90436414, 140248801.8879612, 48973071.21509222, 140248805.8014202, 48973072.04264193, 0, 0, 0, 0, 0 },
-  { 140248797.49138024, 48973101.67349152, 140248758.67762285, 48973092.004353166, 140248836.30513763, 48973111.34262988, 140248795.55069238, 48973101.190034606, 140248799.4320681, 48973102.15694844, 0, 0, 0, 0, 0 },
-  { 140248790.1452632, 48973131.16220027, 140248752.09589717, 48973118.82340999, 140248828.19462922, 48973143.500990555, 140248788.2427949, 48973130.54526076, 140248792.0477315, 48973131.77913979, 0, 0, 0, 0, 0 },
-  { 140248780.99567026, 48973159.3769768, 140248744.49980655, 48973143.00468521, 140248817.49153396, 48973175.7492684, 140248779.17087707, 48973158.55836222, 140248782.82046345, 48973160.19559138, 1, 2, 140248926.0667285, 48973224.4568359, 41 },
-  { 140248769.23193216, 48973185.59980454, 140248735.63241664, 48973163.895598605, 140248802.8314477, 48973207.30401048, 140248767.5519564, 48973184.51459425, 140248770.91190794, 48973186.68501484, 0, 0, 0, 0, 0 },
-  { 140248754.04337958, 48973209.11266699, 140248725.24369758, 48973181.353374556, 140248782.84306157, 48973236.87195942, 140248752.60339546, 48973207.724702366, 140248755.4833637, 48973210.50063161, 0, 0, 0, 0, 0 },
-  { 140248734.6616876, 48973229.22076472, 140248711.5971221, 48973196.54010044, 140248757.72625312, 48973261.901429, 140248733.50845933, 48973227.58673151, 140248735.8149159, 48973230.85479793, 0, 0, 0, 0, 0 },
-  { 140248711.2529352, 48973245.741625465, 140248693.28488335, 48973210.0044024, 140248729.22098705, 48973281.47884853, 140248710.3545326, 48973243.954764314, 140248712.1513378, 48973247.52848662, 1, 4, 140248807.38201267, 48973436.93576886, 38 },
-  { 140248684.89616564, 48973258.99334907, 140248671.14234748, 48973221.43229895, 140248698.6499838, 48973296.554399185, 140248684.20847473, 48973257.115296565, 140248685.58385655, 48973260.87140157, 0, 0, 0, 0, 0 },
-  { 140248656.70847803, 48973269.31490101, 140248646.37622464, 48973230.672378585, 140248667.04073143, 48973307.95742343, 140248656.19186535, 48973267.38277489, 140248657.2250907, 48973271.24702713, 0, 0, 0, 0, 0 },
-  { 140248627.79930326, 48973277.04464795, 140248620.4064784, 48973237.73375708, 140248635.19212812, 48973316.355538815, 140248627.42966202, 48973275.0791034, 140248628.1689445, 48973279.01019249, 0, 0, 0, 0, 0 },
-  { 140248598.85503635, 48973282.48792056, 140248594.16892192, 48973242.763364784, 140248603.54115078, 48973322.212476335, 140248598.62073064, 48973280.50169277, 140248599.08934206, 48973284.47414835, 0, 0, 0, 0, 0 },
-  { 140248569.92682937, 48973285.90044174, 140248567.67069733, 48973245.96411908, 140248572.1829614, 48973325.83676441, 140248569.81402278, 48973283.90362561, 140248570.03963596, 48973287.89725788, 0, 0, 0, 0, 0 },
-  { 140248541.01351315, 48973287.5338485, 140248540.86689714, 48973247.53411721, 140248541.16012916, 48973327.5335798, 140248541.00618234, 48973285.533861935, 140248541.02084395, 48973289.53383507, 1, 5, 140248542.36238036, 48973655.53137642, 35 },
-  { 140248512.1139185, 48973287.63977779, 140248513.7325721, 48973247.6725417, 140248510.49526492, 48973327.607013874, 140248512.1948512, 48973285.64141598, 140248512.03298584, 48973289.63813959, 0, 0, 0, 0, 0 },
-  { 140248483.2268764, 48973286.46986664, 140248486.25590512, 48973246.58471922, 140248480.1978477, 48973326.35501406, 140248483.37832785, 48973284.47560927, 140248483.07542497, 48973288.46412401, 0, 0, 0, 0, 0 },
-  { 140248454.35121512, 48973284.276939884, 140248458.4110084, 48973244.483497225, 140248450.29142186, 48973324.07038254, 140248454.5542048, 48973282.28726775, 140248454.14822546, 48973286.266612016, 1, 3, 140248478.506985, 48973047.50595606, 33 },
-  { 140248425.48572445, 48973281.332034476, 140248430.1820627, 48973241.60868609, 140248420.7893862, 48973321.05538286, 140248425.72054136, 48973279.34586706, 140248425.25090754, 48973283.31820189, 0, 0, 0, 0, 0 },
-  { 140248396.62916392, 48973277.920434654, 140248401.57229242, 48973238.22704124, 140248391.68603542, 48973317.61382807, 140248396.87632033, 48973275.93576498, 140248396.3820075, 48973279.905104324, 1, 1, 140248421.09764993, 48973081.438137256, 50 },
-  { 140248367.78029236, 48973274.32780458, 140248372.58261696, 48973234.61712997, 140248362.97796777, 48973314.038479194, 140248368.0204086, 48973272.34227085, 140248367.54017612, 48973276.31333831, 1, 2, 140248332.9634391, 48973562.23019556, 31 },
-  { 140248338.93786845, 48973270.8398084, 140248343.21009624, 48973231.06861191, 140248334.66564065, 48973310.61100488, 140248339.15147984, 48973268.85124857, 140248338.72425705, 48973272.828368224, 1, 0, 140248357.84247646, 48973094.852263965, 42 },
-  { 140248310.1006509, 48973267.74211023, 140248313.44850615, 48973227.882458135, 140248306.75279567, 48973307.601762325, 140248310.26804367, 48973265.74912763, 140248309.93325815, 48973269.73509283, 0, 0, 0, 0, 0 },
-  { 140248281.26739854, 48973265.32037421, 140248283.2905884, 48973225.371573195, 140248279.24420866, 48973305.26917523, 140248281.36855802, 48973263.322934166, 140248281.16623905, 48973267.31781426, 1, 2, 140248290.92813018, 48973074.564849354, 37 },
-  { 140248252.43687007, 48973263.86026448, 140248252.76247466, 48973223.86158973, 140248252.11126548, 48973303.85893923, 140248252.4531503, 48973261.860330746, 140248252.42058983, 48973265.860198215, 0, 0, 0, 0, 0 },
-  { 140248223.60733676, 48973263.625581004, 140248222.3264458, 48973223.646094784, 140248224.88822773, 48973303.60506722, 140248223.54329222, 48973261.626606695, 140248223.6713813, 48973265.62455531, 0, 0, 0, 0, 0 },
-  { 140248194.76969817, 48973264.5495016, 140248192.33572885, 48973224.62362286, 140248197.2036675, 48973304.47538034, 140248194.6479997, 48973262.55320766, 140248194.89139664, 48973266.54579554, 0, 0, 0, 0, 0 },
-  { 140248165.90913922, 48973266.3089047, 140248162.78351584, 48973226.431210704, 140248169.0347626, 48973306.186598696, 140248165.75285804, 48973264.31502, 140248166.0654204, 48973268.3027894, 0, 0, 0, 0, 0 },
-  { 140248137.01069552, 48973268.573971756, 140248133.65017805, 48973228.7153852, 140248140.371213, 48973308.43255831, 140248136.84266964, 48973266.58104243, 140248137.1787214, 48973270.56690108, 0, 0, 0, 0, 0 },
-  { 140248108.05940282, 48973271.01488432, 140248104.916824, 48973231.13852292, 140248111.20198163, 48973310.89124572, 140248107.9022739, 48973269.021066256, 140248108.21653175, 48973273.00870239, 1, 0, 140248080.16901585, 48972917.11217691, 35 },
-  { 140248079.04029667, 48973273.30182388, 140248076.5605253, 48973233.3787637, 140248081.52006805, 48973313.224884056, 140248078.9163081, 48973271.305670865, 140248079.16428524, 48973275.29797689, 0, 0, 0, 0, 0 },
-  { 140248049.93898624, 48973275.10941568, 140248048.06005794, 48973235.1535697, 140248051.81791455, 48973315.06526166, 140248049.8450398, 48973273.111623384, 140248050.03293267, 48973277.10720798, 0, 0, 0, 0, 0 },
-  { 140248020.78857148, 48973276.48021733, 140248018.5718054, 48973236.541690215, 140248023.00533757, 48973316.418744445, 140248020.67773318, 48973274.48329098, 140248020.89940977, 48973278.47714368, 1, 3, 140248035.75174254, 48973546.065275356, 30 },
-  { 140247991.70446628, 48973278.09451467, 140247988.1173475, 48973238.25568212, 140247995.29158506, 48973317.93334722, 140247991.52511033, 48973276.10257304, 140247991.88382223, 48973280.0864563, 0, 0, 0, 0, 0 },
-  { 140247962.8102906, 48973280.69616821, 140247956.81473112, 48973241.1480549, 140247968.8058501, 48973320.244281515, 140247962.51051262, 48973278.71876254, 140247963.1100686, 48973282.673573874, 0, 0, 0, 0, 0 },
-  { 140247934.2296643, 48973285.029038504, 140247924.8250741, 48973246.15033375, 140247943.6342545, 48973323.90774326, 140247933.7594348, 48973283.085103266, 140247934.6998938, 48973286.97297374, 1, 0, 140247901.78382814, 48973150.8975071, 41 },
-  { 140247906.08618337, 48973291.83682457, 140247892.9842965, 48973254.04343149, 140247919.18807024, 48973329.63021766, 140247905.431089, 48973289.94715492, 140247906.74127772, 48973293.72649423, 0, 0, 0, 0, 0 },
-  { 140247878.43785182, 48973301.42170919, 140247863.1873145, 48973264.443051666, 140247893.68838912, 48973338.40036671, 140247877.67532495, 48973299.57277631, 140247879.2003787, 48973303.270642065, 1, 4, 140247743.47059673, 48972974.16059011, 28 },
-  { 140247851.13413706, 48973312.68215908, 140247835.46901765, 48973275.87721329, 140247866.79925647, 48973349.48710487, 140247850.3508811, 48973310.84191179, 140247851.91739303, 48973314.52240637, 0, 0, 0, 0, 0 },
-  { 140247823.98315695, 48973324.238305576, 140247809.6069738, 48973286.911031924, 140247838.3593401, 48973361.56557923, 140247823.2643478, 48973322.371941894, 140247824.7019661, 48973326.10466926, 0, 0, 0, 0, 0 },
-  { 140247796.7930294, 48973334.71027996, 140247785.58000147, 48973296.31408217, 140247808.00605732, 48973373.106477745, 140247796.232378, 48973332.79047006, 140247797.3536808, 48973336.63008985, 0, 0, 0, 0, 0 },
-  { 140247769.37187216, 48973342.71821355, 140247763.45080307, 48973303.158879116, 140247775.29294124, 48973382.277547985, 140247769.0758187, 48973340.74024683, 140247769.66792563, 48973344.69618027, 0, 0, 0, 0, 0 },
-  { 140247741.52839607, 48973346.88570393, 140247742.0449674, 48973306.88903964, 140247741.01182473, 48973386.882368214, 140247741.55422464, 48973344.88587072, 140247741.5025675, 48973348.88553714, 0, 0, 0, 0, 0 },
-  { 140247713.18821248, 48973346.51968025, 140247718.84376776, 48973306.92151496, 140247707.5326572, 48973386.117845535, 140247713.47099024, 48973344.53977198, 140247712.90543473, 48973348.49958851, 1, 3, 140247755.74626595, 48973048.543486424, 43 },
-  { 140247684.53355226, 48973342.42711652, 140247693.75609964, 48973303.50482702, 140247675.31100488, 48973381.34940602, 140247684.99467963, 48973340.48100205, 140247684.0724249, 48973344.373230994, 0, 0, 0, 0, 0 },
-  { 140247655.78072625, 48973335.61420022, 140247667.19684088, 48973297.277894616, 140247644.36461163, 48973373.95050582, 140247656.35153198, 48973333.69738494, 140247655.20992053, 48973337.5310155, 0, 0, 0, 0, 0 },
-  { 140247627.14604557, 48973327.087118864, 140247639.6185113, 48973289.08136143, 140247614.67357984, 48973365.0928763, 140247627.76966885, 48973325.18683099, 140247626.52242228, 48973328.98740674, 0, 0, 0, 0, 0 },
-  { 140247598.83227077, 48973317.79530074, 140247611.95132348, 48973280.007862926, 140247585.71321806, 48973355.58273855, 140247599.4882234, 48973315.90592885, 140247598.17631814, 48973319.684672624, 0, 0, 0, 0, 0 },
-  { 140247570.90131852, 48973308.09822531, 140247584.65205908, 48973270.536048405, 140247557.15057796, 48973345.660402216, 140247571.58885553, 48973306.22011647, 140247570.2137815, 48973309.976334155, 0, 0, 0, 0, 0 },
-  { 140247543.3315805, 48973298.005511135, 140247557.7024195, 48973260.676179685, 140247528.9607415, 48973335.334842585, 140247544.05012244, 48973296.13904456, 140247542.61303854, 48973299.87197771, 0, 0, 0, 0, 0 },
-  { 140247516.10035163, 48973287.52218367, 140247531.07795486, 48973250.432139166, 140247501.1227484, 48973324.61222818, 140247516.84923178, 48973285.66768145, 140247515.35147148, 48973289.376685895, 0, 0, 0, 0, 0 },
-  { 140247489.18492702, 48973276.65326842, 140247504.75430906, 48973239.807721294, 140247473.61554497, 48973313.498815544, 140247489.96339613, 48973274.81099106, 140247488.4064579, 48973278.495545775, 0, 0, 0, 0, 0 },
-  { 140247462.56260154, 48973265.40379085, 140247478.70723608, 48973228.806649216, 140247446.417967, 48973302.00093248, 140247463.36983326, 48973263.573933765, 140247461.7553698, 48973267.23364793, 0, 0, 0, 0, 0 },
-  { 140247436.2106703, 48973253.778776415, 140247452.9126141, 48973217.432592675, 140247419.50872648, 48973290.124960154, 140247437.0457675, 48973251.96146723, 140247435.3755731, 48973255.5960856, 0, 0, 0, 0, 0 },
-  { 140247410.10642827, 48973241.78325064, 140247427.34645668, 48973205.68918713, 140247392.86639985, 48973277.87731414, 140247410.96842968, 48973239.97854746, 140247409.24442685, 48973243.58795381, 0, 0, 0, 0, 0 },
-  { 140247384.2271704, 48973229.42223895, 140247401.9849206, 48973193.58005279, 140247366.46942022, 48973265.264425114, 140247385.11505792, 48973227.63012964, 140247383.3392829, 48973231.214348264, 1, 3, 140247484.11451513, 48973027.8099418, 32 },
-  { 140247358.5501918, 48973216.70076685, 140247376.80431116, 48973181.10881373, 140247340.29607242, 48973252.29271996, 140247359.46289775, 48973214.92116919, 140247357.63748583, 48973218.4803645, 0, 0, 0, 0, 0 },
-  { 140247333.05278742, 48973203.6238598, 140247351.78108403, 48973168.27911612, 140247314.32449082, 48973238.968603484, 140247333.98920226, 48973201.856622614, 140247332.1163726, 48973205.39109699, 0, 0, 0, 0, 0 },
-  { 140247307.71225223, 48973190.19654331, 140247326.8918448, 48973155.094645515, 140247288.53265965, 48973225.29844111, 140247308.67123187, 48973188.44144842, 140247306.7532726, 48973191.95163821, 0, 0, 0, 0, 0 },
-  { 140247282.50588128, 48973176.423842825, 140247302.1133453, 48973141.55914212, 140247262.89841726, 48973211.28854353, 140247283.48625448, 48973174.68060779, 140247281.52550808, 48973178.16707786, 0, 0, 0, 0, 0 },
-  { 140247257.4109696, 48973162.31078383, 140247277.42247838, 48973127.67641484, 140247237.3994608, 48973196.94515283, 140247258.41154504, 48973160.57906538, 140247256.41039413, 48973164.042502284, 1, 0, 140247199.87788177, 48973261.88459469, 30 },
-  { 140247232.40481207, 48973147.86239179, 140247252.7962707, 48973113.45035298, 140247212.01335344, 48973182.2744306, 140247233.424385, 48973146.14178985, 140247231.38523912, 48973149.58299373, 0, 0, 0, 0, 0 },
-  { 140247207.4647039, 48973133.0836922, 140247228.21187368, 48973098.884935714, 140247186.7175341, 48973167.28244869, 140247208.50206238, 48973131.373754375, 140247206.4273454, 48973134.79363003, 1, 0, 140247145.7418737, 48973234.82499274, 29 },
-  { 140247182.56793985, 48973117.97971053, 140247203.64655408, 48973083.98423992, 140247161.4893256, 48973151.97518113, 140247183.62187055, 48973116.279937, 140247181.51400915, 48973119.679484054, 1, 5, 140247313.78231353, 48972906.357906014, 25 },
-  { 140247157.69181505, 48973102.55547226, 140247179.0776835, 48973068.75244532, 140247136.3059466, 48973136.35849921, 140247158.76110846, 48973100.86532091, 140247156.62252164, 48973104.24562361, 0, 0, 0, 0, 0 },
-  { 140247132.8136246, 48973086.81600286, 140247154.48272732, 48973053.19383774, 140247111.14452186, 48973120.43816798, 140247133.89707974, 48973085.1348946, 140247131.73016945, 48973088.49711112, 0, 0, 0, 0, 0 },
-  { 140247107.91066337, 48973070.766327806, 140247129.83923417, 48973037.312811054, 140247085.98209256, 48973104.21984456, 140247109.0070919, 48973069.093651965, 140247106.81423482, 48973072.43900365, 1, 5, 140247019.09995165, 48973206.253070645, 34 },
-  { 140247082.96022642, 48973054.41147259, 140247105.2050453, 48973021.16740497, 140247060.71540752, 48973087.655540206, 140247084.07246736, 48973052.74926921, 140247081.84798548, 48973056.07367597, 0, 0, 0, 0, 0 },
-  { 140247058.0173214, 48973037.72126454, 140247080.98824266, 48973004.97471088, 140247035.04640016, 48973070.4678182, 140247059.16586748, 48973036.083936855, 140247056.86877534, 48973039.35859223, 1, 0, 140246890.32959625, 48973276.77110628, 47 },
-  { 140247033.48107004, 48973020.509673245, 140247057.68382984, 48972988.66275159, 140247009.27831024, 48973052.3565949, 140247034.69120803, 48973018.917327166, 140247032.27093205, 48973022.102019325, 1, 1, 140247247.07042518, 48972739.46058969, 48 },
-  { 140247009.84580854, 48973002.54754293, 140247035.7818479, 48972972.09558302, 140246983.90976918, 48973032.99950284, 140247011.1426105, 48973001.02494493, 140247008.54900658, 48973004.07014093, 1, 0, 140246872.3847999, 48973163.94293043, 38 },
-  { 140246987.60587683, 48972983.60571633, 140247015.75042608, 48972955.18240992, 140246959.46132758, 48973012.029022746, 140246989.0131043, 48972982.184551015, 140246986.19864938, 48972985.02688165, 1, 0, 140247190.95024517, 48972778.24732751, 29 },
-  { 140246967.25561464, 48972963.45503617, 140246998.00149497, 48972937.868109, 140246936.5097343, 48972989.04196334, 140246968.79290867, 48972962.17568981, 140246965.7183206, 48972964.73438253, 0, 0, 0, 0, 0 },
-  { 140246949.28936166, 48972941.86634516, 140246982.81736282, 48972920.05182846, 140246915.7613605, 48972963.68086186, 140246950.96576172, 48972940.77561933, 140246947.6129616, 48972942.95707099, 1, 1, 140247185.66176975, 48972788.07400241, 30 },
-  { 140246934.16863018, 48972918.62641236, 140246969.99661762, 48972900.84003229, 140246898.34064275, 48972936.41279244, 140246935.96002954, 48972917.73709336, 140246932.37723082, 48972919.515731364, 0, 0, 0, 0, 0 },
-  { 140246921.8318322, 48972893.77578838, 140246959.18920258, 48972879.47799556, 140246884.47446182, 48972908.073581204, 140246923.6997007, 48972893.06089874, 140246919.9639637, 48972894.49067802, 1, 5, 140247228.16226918, 48972776.53388723, 29 },
-  { 140246911.79772958, 48972867.558616795, 140246950.1013901, 48972856.03344471, 140246873.49406907, 48972879.08378888, 140246913.71291262, 48972866.98235819, 140246909.88254654, 48972868.1348754, 1, 0, 140246763.3710451, 48972912.21865863, 44 },
-  { 140246903.57326207, 48972840.22477664, 140246942.42464012, 48972830.707927205, 140246864.721884, 48972849.74162608, 140246905.51583096, 48972839.74893417, 140246901.63069317, 48972840.70061911, 0, 0, 0, 0, 0 },
-  { 140246896.66536948, 48972812.024147, 140246935.80255553, 48972803.76093531, 140246857.52818343, 48972820.28735869, 140246898.62222877, 48972811.61098641, 140246894.7085102, 48972812.43730758, 0, 0, 0, 0, 0 },
-  { 140246890.58099148, 48972783.20660693, 140246929.82553282, 48972775.469296336, 140246851.33645013, 48972790.94391753, 140246892.54321855, 48972782.819741406, 140246888.6187644, 48972783.59347246, 1, 1, 140247266.34747478, 48972709.12185801, 27 },
-  { 140246884.82706785, 48972754.02203552, 140246924.0357704, 48972746.10511405, 140246845.61836532, 48972761.93895698, 140246886.78750297, 48972753.62618944, 140246882.86663273, 48972754.41788159, 0, 0, 0, 0, 0 },
-  { 140246878.91053835, 48972724.7203118, 140246917.9322993, 48972715.92814638, 140246839.8887774, 48972733.51247722, 140246880.8616264, 48972724.28070353, 140246876.9594503, 48972725.15992007, 1, 4, 140247229.13084283, 48972645.81062717, 40 },
-  { 140246872.33834273, 48972695.55131484, 140246910.97281393, 48972685.18899685, 140246833.70387152, 48972705.913632825, 140246874.2700663, 48972695.03319894, 140246870.40661916, 48972696.06943074, 1, 2, 140246520.76465467, 48972789.84840848, 44 },
-  { 140246864.61742073, 48972666.76492371, 140246902.57361162, 48972654.14242105, 140246826.66122985, 48972679.38742636, 140246866.51523027, 48972666.13379858, 140246862.7196112, 48972667.39604884, 1, 0, 140246973.74146953, 48972630.47522858, 25 },
-  { 140246855.2547121, 48972638.61101749, 140246892.12372229, 48972623.09727878, 140246818.38570192, 48972654.124756195, 140246857.09816262, 48972637.83533055, 140246853.4112616, 48972639.38670442, 1, 2, 140246616.52787122, 48972739.06247564, 48 },
-  { 140246843.7812283, 48972611.343832, 140246879.16197848, 48972592.68364664, 140246808.40047812, 48972630.00401736, 140246845.55026582, 48972610.410822734, 140246842.0121908, 48972612.27684127, 1, 5, 140247118.86656085, 48972466.26089085, 47 },
-  { 140246830.03089124, 48972585.27242751, 140246863.54215556, 48972563.43220856, 140246796.51962692, 48972607.11264645, 140246831.70645446, 48972584.18041656, 140246828.35532802, 48972586.36443845, 0, 0, 0, 0, 0 },
-  { 140246814.0445957, 48972560.743324704, 140246845.23514044, 48972535.700363256, 140246782.85405093, 48972585.78628615, 140246815.60412294, 48972559.491176635, 140246812.48506844, 48972561.995472774, 0, 0, 0, 0, 0 },
-  { 140246795.86724386, 48972538.10376959, 140246824.2065117, 48972509.87460209, 140246767.527976, 48972566.3329371, 140246797.28420725, 48972536.69231122, 140246794.45028046, 48972539.515227966, 0, 0, 0, 0, 0 },
-  { 140246775.54374132, 48972517.70100065, 140246800.61331305, 48972486.531840056, 140246750.47416958, 48972548.87016125, 140246776.7972199, 48972516.14254262, 140246774.29026273, 48972519.25945868, 0, 0, 0, 0, 0 },
-  { 140246753.18986368, 48972499.72162205, 140246775.31418818, 48972466.397242606, 140246731.06553918, 48972533.046001494, 140246754.2960799, 48972498.055403076, 140246752.08364746, 48972501.38784102, 0, 0, 0, 0, 0 },
-  { 140246729.1748079, 48972483.77783268, 140246749.0157336, 48972449.045460634, 140246709.3338822, 48972518.510204725, 140246730.1668542, 48972482.04121408, 140246728.1827616, 48972485.51445128, 0, 0, 0, 0, 0 },
-  { 140246703.92439336, 48972469.35349108, 140246722.23857018, 48972433.792403825, 140246685.61021653, 48972504.91457834, 140246704.8401022, 48972467.57543672, 140246703.00868452, 48972471.13154545, 0, 0, 0, 0, 0 },
-  { 140246677.86443916, 48972455.93245573, 140246695.43926197, 48972420.000219464, 140246660.28961635, 48972491.864692, 140246678.7431803, 48972454.13584392, 140246676.985698, 48972457.72906755, 1, 2, 140246787.2677111, 48972232.25428495, 38 },
-  { 140246651.4207647, 48972442.99858518, 140246668.94911882, 48972407.0436578, 140246633.8924106, 48972478.95351256, 140246652.2971824, 48972441.20083881, 140246650.54434702, 48972444.79633155, 0, 0, 0, 0, 0 },
-  { 140246624.9697173, 48972430.10345899, 140246642.52019462, 48972394.15932532, 140246607.41923997, 48972466.04759267, 140246625.84724116, 48972428.30625231, 140246624.09219342, 48972431.90066568, 0, 0, 0, 0, 0 },
-  { 140246598.58089188, 48972417.21856139, 140246615.98190805, 48972381.20183421, 140246581.1798757, 48972453.23528857, 140246599.4509427, 48972415.41772503, 140246597.71084106, 48972419.01939775, 0, 0, 0, 0, 0 },
-  { 140246572.20647016, 48972404.47610047, 140246589.28337526, 48972368.3045742, 140246555.12956506, 48972440.647626735, 140246573.06031543, 48972402.66752415, 140246571.3526249, 48972406.28467678, 1, 2, 140246672.10636497, 48972192.87267181, 48 },
-  { 140246545.7983965, 48972392.00860976, 140246562.3723535, 48972355.60388549, 140246529.2244395, 48972428.41333403, 140246546.62709436, 48972390.18837354, 140246544.96969864, 48972393.82884597, 1, 2, 140246422.73676568, 48972662.313687444, 43 },
-  { 140246519.30861485, 48972379.94862273, 140246535.19527844, 48972343.23876138, 140246503.42195126, 48972416.65848409, 140246520.10294804, 48972378.11312967, 140246518.51428166, 48972381.7841158, 0, 0, 0, 0, 0 },
-  { 140246492.68906942, 48972368.42867286, 140246507.6977625, 48972331.35119812, 140246477.68037635, 48972405.50614759, 140246493.4395041, 48972366.57479912, 140246491.93863475, 48972370.282546595, 0, 0, 0, 0, 0 },
-  { 140246465.8917042, 48972357.58129363, 140246479.82534865, 48972320.08657996, 140246451.95805976, 48972395.07600729, 140246466.58838642, 48972355.706557944, 140246465.195022, 48972359.45602931, 0, 0, 0, 0, 0 },
-  { 140246438.86846337, 48972347.53901853, 140246451.5245548, 48972309.59401425, 140246426.21237195, 48972385.4840228, 140246439.50126794, 48972345.641768314, 140246438.2356588, 48972349.43626874, 0, 0, 0, 0, 0 },
-  { 140246411.57129112, 48972338.43438105, 140246422.7442186, 48972300.02649525, 140246400.39836365, 48972376.84226686, 140246412.1299375, 48972336.51398677, 140246411.01264474, 48972340.35477534, 1, 2, 140246487.82652107, 48972076.30056045, 31 },
-  { 140246383.95213142, 48972330.39991465, 140246393.43787238, 48972291.54092961, 140246374.46639046, 48972369.258899696, 140246384.42641845, 48972328.4569654, 140246383.4778444, 48972332.3428639, 0, 0, 0, 0, 0 },
-  { 140246355.9632925, 48972323.567649856, 140246363.64811504, 48972284.31279662, 140246348.27846998, 48972362.82250309, 140246356.34753364, 48972321.60490719, 140246355.57905138, 48972325.53039252, 0, 0, 0, 0, 0 },
-  { 140246327.5969993, 48972318.01445296, 140246333.53067926, 48972278.45700812, 140246321.66331932, 48972357.57189779, 140246327.89368328, 48972316.03658071, 140246327.3003153, 48972319.9923252, 0, 0, 0, 0, 0 },
-  { 140246298.92087764, 48972313.71298885, 140246303.17015684, 48972273.93933392, 140246294.67159843, 48972353.486643784, 140246299.1333416, 48972311.72430611, 140246298.70841366, 48972315.7016716, 0, 0, 0, 0, 0 },
-  { 140246270.01092675, 48972310.62435007, 140246272.64006507, 48972270.7108482, 140246267.38178843, 48972350.537851945, 140246270.14238366, 48972308.62867498, 140246269.87946984, 48972312.620025165, 1, 0, 140246262.78079638, 48972420.38648022, 25 },
-  { 140246240.94314617, 48972308.709629185, 140246241.94359908, 48972268.722142465, 140246239.94269326, 48972348.697115906, 140246240.9931688, 48972306.71025485, 140246240.89312354, 48972310.70900352, 1, 2, 140246246.02044466, 48972105.7731341, 41 },
-  { 140246211.80377406, 48972307.98058688, 140246210.84931928, 48972267.9919758, 140246212.75822884, 48972347.96919796, 140246211.75605133, 48972305.98115633, 140246211.8514968, 48972309.98001743, 0, 0, 0, 0, 0 },
-  { 140246182.72465014, 48972308.67465221, 140246179.38746214, 48972268.8141056, 140246186.06183815, 48972348.53519882, 140246182.55779076, 48972306.68162488, 140246182.89150953, 48972310.66767954, 0, 0, 0, 0, 0 },
-  { 140246153.85030517, 48972311.09205805, 140246147.69916654, 48972271.56784403, 140246160.0014438, 48972350.61627206, 140246153.54274824, 48972309.11584735, 140246154.1578621, 48972313.068268746, 0, 0, 0, 0, 0 },
-  { 140246125.32483014, 48972315.53146704, 140246116.1966707, 48972276.58693334, 140246134.45298958, 48972354.47600075, 140246124.86842218, 48972313.584240355, 140246125.7812381, 48972317.47869373, 0, 0, 0, 0, 0 },
-  { 140246097.24250016, 48972322.11364844, 140246085.47635537, 48972283.8833223, 140246109.00864494, 48972360.343974575, 140246096.65419292, 48972320.20213213, 140246097.8308074, 48972324.025164746, 0, 0, 0, 0, 0 },
-  { 140246069.60265693, 48972330.620361045, 140246055.5919013, 48972293.15439347, 140246083.61341256, 48972368.08632862, 140246068.90211916, 48972328.74706267, 140246070.3031947, 48972332.49365942, 0, 0, 0, 0, 0 },
-  { 140246042.39398414, 48972340.795303546, 140246026.51463208, 48972304.08227891, 140246058.2733362, 48972377.508328184, 140246041.60001653, 48972338.95965231, 140246043.18795174, 48972342.63095478, 1, 0, 140246130.12740427, 48972543.63476467, 39 },
-  { 140246015.60516542, 48972352.38217463, 140245998.20724154, 48972316.36395363, 140246033.0030893, 48972388.40039564, 140246014.73526922, 48972350.58126359, 140246016.47506163, 48972354.18308568, 0, 0, 0, 0, 0 },
-  { 140245989.2248844, 48972365.12467298, 140245970.63076124, 48972329.70915966, 140246007.81900755, 48972400.5401863, 140245988.29517823, 48972363.35389731, 140245990.15459055, 48972366.89544865, 1, 0, 140246089.1682964, 48972555.483057074, 41 },
-  { 140245963.24182478, 48972378.76649729, 140245943.74318305, 48972343.84081948, 140245982.7404665, 48972413.692175105, 140245962.2668927, 48972377.0202134, 140245964.21675685, 48972380.51278118, 1, 4, 140245769.2303396, 48972031.25600304, 48 },
-  { 140245937.64532465, 48972393.0567564, 140245917.37490013, 48972358.5732837, 140245957.91574916, 48972427.5402291, 140245936.63180342, 48972391.332582764, 140245938.65884587, 48972394.780930035, 0, 0, 0, 0, 0 },
-  { 140245912.44026557, 48972407.873049766, 140245891.38338634, 48972373.86411216, 140245933.4971448, 48972441.88198737, 140245911.3874216, 48972406.172602884, 140245913.49310952, 48972409.57349665, 1, 5, 140245753.9872493, 48972151.955794305, 32 },
-  { 140245887.6473499, 48972423.22376249, 140245865.78424564, 48972389.72742429, 140245909.51045415, 48972456.72010069, 140245886.5541947, 48972421.54894558, 140245888.7405051, 48972424.8985794, 0, 0, 0, 0, 0 },
-  { 140245863.28799012, 48972439.12314883, 140245840.60059905, 48972406.17952597, 140245885.9753812, 48972472.066771686, 140245862.15362057, 48972437.47596768, 140245864.42235968, 48972440.770329975, 0, 0, 0, 0, 0 },
-  { 140245839.38359877, 48972455.58546316, 140245815.85587886, 48972423.236639455, 140245862.9113187, 48972487.93428686, 140245838.20721278, 48972453.968021974, 140245840.55998477, 48972457.20290434, 0, 0, 0, 0, 0 },
-  { 140245815.95558822, 48972472.62495974, 140245791.57384416, 48972440.91485792, 140245840.33733228, 48972504.33506156, 140245814.736501, 48972471.03945465, 140245817.17467543, 48972474.21046483, 0, 0, 0, 0, 0 },
-  { 140245793.02537104, 48972490.25589291, 140245767.77859294, 48972459.230094045, 140245818.27214915, 48972521.281691775, 140245791.76303214, 48972488.704602964, 140245794.28770995, 48972491.807182856, 0, 0, 0, 0, 0 },
-  { 140245770.6143597, 48972508.49251698, 140245744.4945642, 48972478.19802437, 140245796.7341552, 48972538.78700959, 140245769.30836993, 48972506.97779235, 140245771.92034948, 48972510.00724161, 1, 1, 140245655.68725944, 48972375.19674951, 30 },
-  { 140245748.74396652, 48972527.34908623, 140245721.75772902, 48972497.823792234, 140245775.73020402, 48972556.87438023, 140245747.39465463, 48972525.87282153, 140245750.0932784, 48972528.82535093, 0, 0, 0, 0, 0 },
-  { 140245727.42816418, 48972546.831815325, 140245699.64551854, 48972518.054661185, 140245755.21080983, 48972575.608969465, 140245726.0390319, 48972545.39295762, 140245728.81729648, 48972548.27067303, 0, 0, 0, 0, 0 },
-  { 140245706.63944647, 48972566.9020966, 140245678.14838347, 48972538.82614018, 140245735.13050947, 48972594.97805302, 140245705.2148933, 48972565.49829878, 140245708.06399962, 48972568.30589442, 1, 1, 140245817.0423156, 48972675.69642773, 49 },
-  { 140245686.3359382, 48972587.50579483, 140245657.2199327, 48972560.078468576, 140245715.45194367, 48972614.933121085, 140245684.88013792, 48972586.134428516, 140245687.79173845, 48972588.877161145, 1, 1, 140245492.7145018, 48972405.11407526, 48 },
-  { 140245666.47574982, 48972608.5887596, 140245636.81367743, 48972581.75293539, 140245696.1378222, 48972635.424583815, 140245664.9926462, 48972607.24696839, 140245667.95885345, 48972609.93055081, 0, 0, 0, 0, 0 },
-  { 140245647.01699215, 48972630.09684052, 140245616.8832646, 48972603.79173713, 140245677.1507197, 48972656.401943915, 140245645.51030576, 48972628.78158535, 140245648.52367854, 48972631.412095696, 1, 4, 140245547.57569128, 48972543.28999932, 46 },
-  { 140245627.9177757, 48972651.9758872, 140245597.38262993, 48972626.13783633, 140245658.45292145, 48972677.813938074, 140245626.3910184, 48972650.68398466, 140245629.444533, 48972653.267789744, 1, 4, 140245909.60449544, 48972890.331906475, 26 },
-  { 140245609.1362111, 48972674.17174925, 140245578.26611534, 48972648.73482358, 140245640.00630686, 48972699.60867492, 140245607.59270632, 48972672.89990296, 140245610.67971587, 48972675.443595536, 1, 4, 140245445.52470356, 48972539.3560432, 47 },
-  { 140245590.63040903, 48972696.63027625, 140245559.48855543, 48972671.52679135, 140245621.77226263, 48972721.73376115, 140245589.07331637, 48972695.375102006, 140245592.1875017, 48972697.88545049, 0, 0, 0, 0, 0 },
-  { 140245572.3584801, 48972719.297317825, 140245541.00534007, 48972694.45822343, 140245603.71162012, 48972744.13641222, 140245570.7908231, 48972718.055363104, 140245573.9261371, 48972720.53927255, 0, 0, 0, 0, 0 },
-  { 140245554.27853495, 48972742.118723586, 140245522.76985955, 48972717.477226585, 140245585.78721035, 48972766.76022059, 140245552.7031012, 48972740.88664874, 140245555.8539687, 48972743.350798436, 1, 3, 140245733.09026784, 48972881.95921909, 32 },
-  { 140245536.3506374, 48972765.04283019, 140245504.7081593, 48972740.57338844, 140245567.9931155, 48972789.51227194, 140245534.7685135, 48972763.8193581, 140245537.9327613, 48972766.26630228, 0, 0, 0, 0, 0 },
-  { 140245518.55948, 48972788.04933414, 140245486.78235787, 48972763.75500334, 140245550.33660215, 48972812.34366494, 140245516.9706239, 48972786.8346176, 140245520.1483361, 48972789.26405068, 1, 3, 140245661.5565296, 48972897.37382272, 46 },
-  { 140245500.90660802, 48972811.13939059, 140245468.99362203, 48972787.023807935, 140245532.819594, 48972835.25497324, 140245499.3109587, 48972809.93361145, 140245502.50225732, 48972812.34516972, 0, 0, 0, 0, 0 },
-  { 140245483.39389405, 48972834.31457168, 140245451.34388363, 48972810.38139737, 140245515.44390446, 48972858.24774599, 140245481.79139352, 48972833.11791296, 140245484.99639457, 48972835.511230394, 0, 0, 0, 0, 0 },
-  { 140245466.02321082, 48972857.57644956, 140245433.83507642, 48972833.82936546, 140245498.21134523, 48972881.323533654, 140245464.4138041, 48972856.38909535, 140245467.63261753, 48972858.763803765, 0, 0, 0, 0, 0 },
-  { 140245448.79643112, 48972880.92659639, 140245416.4691362, 48972857.369304456, 140245481.12372604, 48972904.48388832, 140245447.18006638, 48972879.74873179, 140245450.41279587, 48972882.104460984, 0, 0, 0, 0, 0 },
-  { 140245431.7154276, 48972904.36658431, 140245399.24800047, 48972881.00280519, 140245464.18285474, 48972927.73036343, 140245430.09205624, 48972903.19839535, 140245433.33879897, 48972905.53477327, 1, 5, 140245154.11892554, 48972704.60627283, 45 },
-  { 140245414.78207293, 48972927.89798547, 140245382.1736084, 48972904.731457, 140245447.39053747, 48972951.064513944, 140245413.1516497, 48972926.73965905, 140245416.41249615, 48972929.0563119, 0, 0, 0, 0, 0 },
-  { 140245397.9982399, 48972951.52237204, 140245365.24790144, 48972928.5568472, 140245430.74857837, 48972974.487896875, 140245396.360723, 48972950.3740958, 140245399.63575682, 48972952.67064828, 0, 0, 0, 0, 0 },
-  { 140245381.36580113, 48972975.24131611, 140245348.4728223, 48972952.48056164, 140245414.25877994, 48972998.00207058, 140245379.7211522, 48972974.10327838, 140245383.01045007, 48972976.379353836, 0, 0, 0, 0, 0 },
-  { 140245364.88662937, 48972999.056389906, 140245331.8503159, 48972976.50418396, 140245397.92294285, 48973021.60859585, 140245363.2348137, 48972997.92877961, 140245366.53844506, 48973000.1840002, 0, 0, 0, 0, 0 },
-  { 140245348.5625973, 48973022.96916553, 140245315.38232863, 48973000.629295975, 140245381.74286598, 48973045.30903508, 140245346.90358388, 48973021.85217205, 140245350.22161072, 48973024.086159006, 0, 0, 0, 0, 0 },
-  { 140245332.39557764, 48973046.98121514, 140245299.0708087, 48973024.857477285, 140245365.72034657, 48973069.104953, 140245330.72933918, 48973045.87502825, 140245334.0618161, 48973048.08740203, 1, 2, 140245207.4276942, 48972964.01719819, 46 },
-  { 140245316.3874431, 48973071.09411089, 140245282.917706, 48973049.190305285, 140245349.85718018, 48973092.9979165, 140245314.71395624, 48973069.99892061, 140245318.06092995, 48973072.18930117, 1, 4, 140245572.43093172, 48973238.6582238, 29 },
-  { 140245300.5400664, 48973095.30942494, 140245266.9249721, 48973073.62935493, 140245334.1551607, 48973116.98949494, 140245298.85931167, 48973094.225421436, 140245302.2208211, 48973096.39342844, 1, 3, 140245021.53478375, 48972915.36484387, 26 },
-  { 140245284.85532016, 48973119.62872942, 140245251.09455982, 48973098.17619902, 140245318.6160805, 48973141.08125982, 140245283.16728213, 48973118.5561029, 140245286.54335818, 48973120.701355934, 0, 0, 0, 0, 0 },
-  { 140245269.3350772, 48973144.05359648, 140245235.42870504, 48973122.83195832, 140245303.24144936, 48973165.27523464, 140245267.6397586, 48973142.99251457, 140245271.0303958, 48973145.11467839, 0, 0, 0, 0, 0 },
-  { 140245253.98090106, 48973168.585369505, 140245219.93279964, 48973147.59187554, 140245288.0290025, 48973189.57886347, 140245252.278496, 48973167.53569481, 140245255.68330613, 48973169.6350442, 1, 4, 140245386.76849666, 48973250.45999597, 42 },
-  { 140245238.79017866, 48973193.22230027, 140245204.60683942, 48973172.44973857, 140245272.9735179, 48973213.99486197, 140245237.08101168, 48973192.18367218, 140245240.49934563, 48973194.260928355, 0, 0, 0, 0, 0 },
-  { 140245223.75729647, 48973217.960419655, 140245189.44511914, 48973197.40137088, 140245258.0694738, 48973238.51946843, 140245222.0416876, 48973216.932467215, 140245225.47290534, 48973218.988372095, 0, 0, 0, 0, 0 },
-  { 140245208.8765753, 48973242.79570994, 140245174.44181073, 48973222.44265144, 140245243.31133986, 48973263.14876843, 140245207.15483707, 48973241.77805702, 140245210.5983135, 48973243.81336286, 1, 3, 140245018.6245011, 48973130.34506177, 32 },
-  { 140245194.14233583, 48973267.72415334, 140245159.59108925, 48973247.56946754, 140245228.69358242, 48973287.87883914, 140245192.4147735, 48973266.71641905, 140245195.86989817, 48973268.73188763, 0, 0, 0, 0, 0 },
-  { 140245179.54889885, 48973292.74173211, 140245144.88713333, 48973272.77771422, 140245214.21066436, 48973312.70575, 140245177.81581056, 48973291.74353122, 140245181.28198713, 48973293.73993301, 0, 0, 0, 0, 0 },
-  { 140245165.0905851, 48973317.84442854, 140245130.32412562, 48973298.06329373, 140245199.8570446, 48973337.625563346, 140245163.35226214, 48973316.855371796, 140245166.8289081, 48973318.83348528, 1, 1, 140245318.93216836, 48973405.37595005, 41 },
-  { 140245150.76171538, 48973343.02822482, 140245115.89625308, 48973323.42211511, 140245185.6271777, 48973362.63433453, 140245149.01844227, 48973342.04791933, 140245152.5049885, 48973344.008530304, 0, 0, 0, 0, 0 },
-  { 140245136.55661038, 48973368.28910322, 140245101.59770715, 48973348.85009383, 140245171.5155136, 48973387.72811261, 140245134.80866522, 48973367.317152746, 140245138.30455554, 48973369.26105369, 0, 0, 0, 0, 0 },
-  { 140245122.46959087, 48973393.62304598, 140245087.42268434, 48973374.343151174, 140245157.5164974, 48973412.90294079, 140245120.71724555, 48973392.65905124, 140245124.2219362, 48973394.58704072, 0, 0, 0, 0, 0 },
-  { 140245108.49497765, 48973419.02603537, 140245073.36538637, 48973399.89721379, 140245143.62456894, 48973438.15485695, 140245106.7384981, 48973418.06959429, 140245110.2514572, 48973419.98247645, 0, 0, 0, 0, 0 },
-  { 140245094.62709138, 48973444.49405361, 140245059.4200199, 48973425.50821368, 140245129.83416286, 48973463.47989354, 140245092.8667378, 48973443.54476161, 140245096.38744494, 48973445.44334561, 0, 0, 0, 0, 0 },
-  { 140245080.86025295, 48973470.02308295, 140245045.58079785, 48973451.172087, 140245116.13970804, 48973488.8740789, 140245079.0962802, 48973469.080533154, 140245082.6242257, 48973470.965632744, 0, 0, 0, 0, 0 },
-  { 140245067.188783, 48973495.609105654, 140245031.84193832, 48973476.884774625, 140245102.53562766, 48973514.33343668, 140245065.42144075, 48973494.672889106, 140245068.95612523, 48973496.5453222, 0, 0, 0, 0, 0 },
-  { 140245053.60700232, 48973521.24810396, 140245018.1976657, 48973502.642221056, 140245089.01633894, 48973539.85398687, 140245051.83653548, 48973520.31780981, 140245055.37746915, 48973522.17839811, 0, 0, 0, 0, 0 },
-  { 140245040.10923168, 48973546.936060116, 140245004.64221025, 48973528.44037441, 140245075.57625312, 48973565.43174582, 140245038.3358806, 48973546.01127583, 140245041.88258275, 48973547.8608444, 0, 0, 0, 0, 0 },
-  { 140245026.68979183, 48973572.668956354, 140244991.1698085, 48973554.275186084, 140245062.20977515, 48973591.062726624, 140245024.91379267, 48973571.74926784, 140245028.465791, 48973573.58864487, 1, 3, 140245153.6737322, 48973638.42668507, 36 },
-  { 140245013.3430035, 48973598.44277496, 140244977.77470338, 48973580.14261029, 140245048.91130364, 48973616.74293963, 140245011.56458852, 48973597.52776673, 140245015.1214185, 48973599.35778319, 0, 0, 0, 0, 0 },
-  { 140245000.06318742, 48973624.25349813, 140244964.45051652, 48973606.03983095, 140245035.67585832, 48973642.467165306, 140244998.28255388, 48973623.34281477, 140245001.84382096, 48973625.164181486, 0, 0, 0, 0, 0 },
-  { 140244986.84557173, 48973650.09753014, 140244951.1845398, 48973631.97873326, 140245022.50660366, 48973668.21632703, 140244985.06252012, 48973649.191590294, 140244988.62862334, 48973651.00346999, 1, 2, 140244807.6488862, 48973559.0505758, 28 },
-  { 140244973.6968325, 48973675.97659995, 140244937.97814783, 48973657.97172377, 140245009.41551718, 48973693.98147612, 140244971.91089827, 48973675.076356135, 140244975.48276675, 48973676.87684376, 1, 3, 140245138.89574906, 48973759.249152236, 34 },
-  { 140244960.63148394, 48973701.896082036, 140244924.84592262, 48973684.02449564, 140244996.41704527, 48973719.76766843, 140244958.84220588, 48973701.00250272, 140244962.420762, 48973702.789661355, 1, 3, 140244838.96057543, 48973641.132688284, 35 },
-  { 140244947.66419226, 48973727.861421734, 140244911.80273268, 48973710.14262618, 140244983.52565184, 48973745.58021729, 140244945.8711193, 48973726.97548196, 140244949.45726523, 48973728.74736151, 0, 0, 0, 0, 0 },
-  { 140244934.8096242, 48973753.878064446, 140244898.86347848, 48973736.33170843, 140244970.7557699, 48973771.42442046, 140244933.0123169, 48973753.000746645, 140244936.60693148, 48973754.75538225, 1, 4, 140244769.45735398, 48973673.16482679, 46 },
-  { 140244922.08244598, 48973779.95145553, 140244886.0430915, 48973762.59735143, 140244958.12180045, 48973797.305559635, 140244920.28047827, 48973779.08375033, 140244923.8844137, 48973780.81916074, 1, 0, 140245280.674023, 48973952.62479133, 32 },
-  { 140244909.49732432, 48973806.08704041, 140244873.3565373, 48973788.94517605, 140244945.63811132, 48973823.22890477, 140244907.69028497, 48973805.229947194, 140244911.30436367, 48973806.944133624, 0, 0, 0, 0, 0 },
-  { 140244897.0689256, 48973832.290264405, 140244860.8188155, 48973815.38081384, 140244933.31903568, 48973849.19971497, 140244895.25642008, 48973831.444791876, 140244898.8814311, 48973833.135736935, 1, 0, 140244994.94422284, 48973877.94578095, 26 },
-  { 140244884.8119162, 48973858.5665729, 140244848.44496167, 48973841.90990402, 140244921.17887074, 48973875.223241776, 140244882.99356848, 48973857.73373945, 140244886.63026392, 48973859.39940634, 1, 2, 140244584.78454134, 48973721.14905463, 33 },
-  { 140244872.7409627, 48973884.9214113, 140244836.250049, 48973868.53809002, 140244909.23187643, 48973901.304732576, 140244870.91641703, 48973884.102245234, 140244874.5655084, 48973885.74057736, 1, 0, 140245081.65144375, 48973978.715925634, 43 },
-  { 140244860.87073162, 48973911.36022496, 140244824.2491893, 48973895.27101626, 140244897.49227396, 48973927.44943366, 140244859.0396545, 48973910.555764526, 140244862.70180875, 48973912.1646854, 0, 0, 0, 0, 0 },
-  { 140244849.2158894, 48973937.888459265, 140244812.45753428, 48973922.11432445, 140244885.9742445, 48973953.66259408, 140244847.37797165, 48973937.09975252, 140244851.05380714, 48973938.67716601, 1, 1, 140245139.60689482, 48974062.5041243, 45 },
-  { 140244837.7911025, 48973964.5115596, 140244800.89027694, 48973949.07364935, 140244874.69192806, 48973979.94946985, 140244835.94606122, 48973963.739664085, 140244839.63614377, 48973965.28345511, 1, 0, 140244605.31590146, 48973867.25272503, 47 },
-  { 140244826.6110374, 48973991.23497133, 140244789.56265238, 48973976.154614344, 140244863.65942243, 48974006.315328315, 140244824.75861815, 48973990.48095348, 140244828.46345666, 48973991.98898918, 1, 1, 140244967.3949005, 48974048.540327884, 33 },
-  { 140244815.6903606, 48974018.064139836, 140244778.48993877, 48974003.362826474, 140244852.89078245, 48974032.7654532, 140244813.83033952, 48974017.32907417, 140244817.5503817, 48974018.799205504, 1, 3, 140244695.71900016, 48973970.65240424, 27 },
-  { 140244805.04373857, 48974045.00451047, 140244767.68745768, 48974030.703871384, 140244842.40001947, 48974059.305149555, 140244803.17592454, 48974044.28947852, 140244806.9115526, 48974045.71954242, 1, 0, 140245074.00896096, 48974147.969111875, 38 },
-  { 140244794.68583778, 48974072.061528645, 140244757.16963243, 48974058.18585437, 140244832.20204312, 48974085.93720292, 140244792.8100275, 48974071.36774493, 140244796.56164804, 48974072.75531236, 1, 3, 140244422.33749974, 48973934.34546144, 29 },
-  { 140244784.63333526, 48974099.24087438, 140244746.94410947, 48974085.84228269, 140244822.32256106, 48974112.63946607, 140244782.74887398, 48974098.57094479, 140244786.51779655, 48974099.910803966, 1, 2, 140244948.58146745, 48974157.524748236, 45 },
-  { 140244774.92461824, 48974126.55076159, 140244737.04539907, 48974113.699117556, 140244812.80383742, 48974139.40240562, 140244773.0306573, 48974125.90817939, 140244776.8185792, 48974127.19334379, 1, 4, 140244612.99095625, 48974071.609983355, 36 },
-  { 140244765.61133048, 48974154.00095144, 140244727.527981, 48974141.7674526, 140244803.69467995, 48974166.23445028, 140244763.707163, 48974153.3892765, 140244767.51549795, 48974154.61262638, 1, 3, 140244981.73433867, 48974223.42605736, 41 },
-  { 140244756.74530515, 48974181.60122715, 140244718.4470509, 48974170.05810276, 140244795.0435594, 48974193.14435154, 140244754.83039245, 48974181.02407093, 140244758.66021785, 48974182.178383365, 1, 3, 140244375.67767528, 48974066.747139454, 41 },
-  { 140244748.37837535, 48974209.36137197, 140244709.85826, 48974198.581728525, 140244786.8984907, 48974220.14101542, 140244746.45236957, 48974208.8223898, 140244750.30438113, 48974209.90035415, 0, 0, 0, 0, 0 },
-  { 140244740.56237447, 48974237.29116919, 140244701.81772515, 48974227.3487274, 140244779.3070238, 48974247.23361098, 140244738.625142, 48974236.7940471, 140244742.49960694, 48974237.788291276, 0, 0, 0, 0, 0 },
-  { 140244733.34913558, 48974265.40040205, 140244694.38202286, 48974256.36911605, 140244772.3162483, 48974274.43168804, 140244731.40077993, 48974264.94883775, 140244735.29749122, 48974265.851966344, 0, 0, 0, 0, 0 },
-  { 140244726.79049182, 48974293.69885377, 140244687.60816213, 48974285.65242344, 140244765.9728215, 48974301.745284095, 140244724.83137533, 48974293.29653225, 140244728.7496083, 48974294.101175286, 0, 0, 0, 0, 0 },
-  { 140244720.9382991, 48974322.19627878, 140244681.55174416, 48974315.21779107, 140244760.32485402, 48974329.17476649, 140244718.96897134, 48974321.8473544, 140244722.90762684, 48974322.545203164, 0, 0, 0, 0, 0 },
-  { 140244715.8544361, 48974350.88957987, 140244676.27707586, 48974345.09022169, 140244755.43179634, 48974356.68893805, 140244713.8755681, 48974350.59961196, 140244717.8333041, 48974351.17954778, 1, 0, 140244468.49593452, 48974314.64359124, 28 },
-  { 140244711.62653294, 48974379.742642775, 140244671.88048247, 48974375.242479414, 140244751.37258342, 48974384.24280614, 140244709.63923043, 48974379.51763461, 140244713.61383545, 48974379.96765094, 0, 0, 0, 0, 0 },
-  { 140244708.3462976, 48974408.71412432, 140244668.46478632, 48974405.63759065, 140244748.22780886, 48974411.790658, 140244706.35222203, 48974408.56029764, 140244710.34037316, 48974408.867951006, 0, 0, 0, 0, 0 },
-  { 140244706.10543808, 48974437.762681305, 140244666.1345258, 48974436.237502314, 140244746.07635036, 48974439.2878603, 140244704.10689247, 48974437.686422355, 140244708.1039837, 48974437.838940255, 0, 0, 0, 0, 0 },
-  { 140244704.9956624, 48974466.84697052, 140244664.9959645, 48974467.002432175, 140244744.99536029, 48974466.69150887, 140244702.9956775, 48974466.8547436, 140244706.99564728, 48974466.83919744, 0, 0, 0, 0, 0 },
-  { 140244705.10867873, 48974495.92564882, 140244665.15694678, 48974497.890111774, 140244745.06041068, 48974493.96118587, 140244703.11109212, 48974496.02387197, 140244707.10626534, 48974495.82742567, 0, 0, 0, 0, 0 },
-  { 140244706.53619498, 48974524.957373, 140244666.72653788, 48974528.85496223, 140244746.34585208, 48974521.05978377, 140244704.5457121, 48974525.152252465, 140244708.52667785, 48974524.762493536, 1, 2, 140244543.3166009, 48974540.93748884, 38 },
-  { 140244709.36991918, 48974553.900799856, 140244669.8144998, 48974559.847966924, 140244748.92533857, 48974547.95363279, 140244707.3921482, 48974554.19815821, 140244711.34769017, 48974553.6034415, 0, 0, 0, 0, 0 },
-  { 140244713.7015144, 48974582.71083046, 140244674.5337395, 48974590.82781328, 140244752.86928928, 48974574.59384763, 140244711.74312565, 48974583.1166796, 140244715.65990314, 48974582.30498131, 0, 0, 0, 0, 0 },
-  { 140244719.621883, 48974611.279039845, 140244681.00292033, 48974621.69900735, 140244758.24084568, 48974600.85907234, 140244717.69093487, 48974611.80003822, 140244721.55283114, 48974610.75804147, 0, 0, 0, 0, 0 },
-  { 140244727.22129515, 48974639.44433055, 140244689.34403998, 48974652.30176189, 140244765.09855032, 48974626.58689921, 140244725.3274324, 48974640.08720212, 140244729.1151579, 48974638.801458985, 1, 3, 140244563.40216655, 48974695.0527211, 38 },
-  { 140244736.5900017, 48974667.04400263, 140244699.68247676, 48974682.465889744, 140244773.49752665, 48974651.622115515, 140244734.74462545, 48974667.81509698, 140244738.43537796, 48974666.27290828, 0, 0, 0, 0, 0 },
-  { 140244747.81825343, 48974693.91535616, 140244712.14495146, 48974712.00998316, 140244783.4915554, 48974675.82072916, 140244746.03458834, 48974694.82008751, 140244749.60191852, 48974693.01062481, 1, 1, 140244614.04337102, 48974761.770207405, 31 },
-  { 140244760.99630103, 48974719.89569117, 140244726.85203025, 48974740.73240813, 140244795.1405718, 48974699.058974214, 140244759.28908747, 48974720.937527016, 140244762.70351458, 48974718.85385533, 0, 0, 0, 0, 0 },
-  { 140244776.20265186, 48974744.813712634, 140244743.87892374, 48974768.37589845, 140244808.52637997, 48974721.25152682, 140244774.58646545, 48974745.99182192, 140244777.81883827, 48974743.635603346, 0, 0, 0, 0, 0 },
-  { 140244793.4117329, 48974768.421949215, 140244763.22187412, 48974794.662612826, 140244823.6015917, 48974742.181285605, 140244791.90223998, 48974769.7339824, 140244794.92122585, 48974767.10991603, 1, 0, 140245030.40212435, 48974562.43273988, 30 },
-  { 140244812.54357892, 48974790.43312004, 140244784.84855634, 48974819.29461211, 140244840.2386015, 48974761.571627975, 140244811.15882778, 48974791.87619465, 140244813.92833006, 48974788.990045436, 1, 0, 140244723.91950667, 48974882.789894655, 43 },
-  { 140244833.51775083, 48974810.55959733, 140244808.714117, 48974841.940797895, 140244858.32138467, 48974779.17839676, 140244832.27756914, 48974812.128657356, 140244834.7579325, 48974808.9905373, 0, 0, 0, 0, 0 },
-  { 140244856.24843252, 48974828.52587953, 140244834.3835846, 48974862.02107956, 140244878.11328045, 48974795.0306795, 140244855.1551901, 48974830.20063953, 140244857.34167492, 48974826.85111953, 0, 0, 0, 0, 0 },
-  { 140244880.5129319, 48974844.365151696, 140244861.14684898, 48974879.36450643, 140244899.87901485, 48974809.36579696, 140244879.54462776, 48974846.115119435, 140244881.48123607, 48974842.61518396, 1, 4, 140244955.0723512, 48974709.61763595, 31 },
-  { 140244905.94391564, 48974858.43679797, 140244888.5321727, 48974894.44834067, 140244923.35565856, 48974822.42525527, 140244905.0733285, 48974860.2373751, 140244906.81450278, 48974856.636220835, 0, 0, 0, 0, 0 },
-  { 140244932.16711876, 48974871.115834676, 140244916.1517708, 48974907.76973801, 140244948.18246672, 48974834.46193134, 140244931.36635137, 48974872.94852984, 140244932.96788615, 48974869.28313951, 0, 0, 0, 0, 0 },
-  { 140244958.82390237, 48974882.76309803, 140244943.9418397, 48974919.8915805, 140244973.70596504, 48974845.63461556, 140244958.07979923, 48974884.619522154, 140244959.5680055, 48974880.90667391, 0, 0, 0, 0, 0 },
-  { 140244985.7555485, 48974893.55800316, 140244971.95088723, 48974931.10039689, 140244999.56020978, 48974856.01560943, 140244985.06531546, 48974895.43512285, 140244986.44578156, 48974891.68088347, 1, 1, 140245084.11376008, 48974626.06844781, 26 },
-  { 140245012.94156086, 48974903.55453387, 140245000.1572426, 48974941.45652863, 140245025.72587913, 48974865.65253911, 140245012.30234495, 48974905.449633606, 140245013.58077678, 48974901.65943413, 0, 0, 0, 0, 0 },
-  { 140245040.36419988, 48974912.80417223, 140245028.53872094, 48974951.01618667, 140245052.18967882, 48974874.592157796, 140245039.77292594, 48974914.714772955, 140245040.9554738, 48974910.89357151, 0, 0, 0, 0, 0 },
-  { 140245068.00572613, 48974921.358400315, 140245057.07406792, 48974959.83565137, 140245078.93738434, 48974882.88114926, 140245067.45914322, 48974923.28226287, 140245068.55230904, 48974919.43453776, 0, 0, 0, 0, 0 },
-  { 140245095.84840003, 48974929.26870021, 140245085.7428591, 48974967.971129626, 140245105.95394096, 48974890.5662708, 140245095.343123, 48974931.20382168, 140245096.35367706, 48974927.33357874, 0, 0, 0, 0, 0 },
-  { 140245123.87448215, 48974936.58655401, 140245114.52538615, 48974975.47864066, 140245133.22357816, 48974897.694467366, 140245123.40702736, 48974938.53115834, 140245124.34193695, 48974934.64194968, 0, 0, 0, 0, 0 },
-  { 140245152.06623292, 48974943.363443784, 140245143.40253854, 48974982.41392905, 140245160.7299273, 48974904.312958516, 140245151.6330482, 48974945.315968044, 140245152.49941763, 48974941.410919525, 0, 0, 0, 0, 0 },
-  { 140245180.40591288, 48974949.6508516, 140245172.35568735, 48974988.832401715, 140245188.4561384, 48974910.469301485, 140245180.0034016, 48974951.60992911, 140245180.80842414, 48974947.69177409, 0, 0, 0, 0, 0 },
-  { 140245208.87578252, 48974955.500259556, 140245201.36657614, 48974994.78908519, 140245216.3849889, 48974916.211433925, 140245208.5003222, 48974957.46470084, 140245209.25124285, 48974953.53581827, 0, 0, 0, 0, 0 },
-  { 140245237.4581024, 48974960.96314973, 140245230.41722095, 48975000.33859878, 140245244.49898386, 48974921.58770067, 140245237.10605833, 48974962.93192218, 140245237.81014648, 48974958.99437727, 0, 0, 0, 0, 0 },
-  { 140245266.13513285, 48974966.091004185, 140245259.48982266, 48975005.53514003, 140245272.78044304, 48974926.64686834, 140245265.80286735, 48974968.06321098, 140245266.46739835, 48974964.11879739, 0, 0, 0, 0, 0 },
-  { 140245294.88913453, 48974970.93530504, 140245288.5666917, 48975010.43247856, 140245301.21157736, 48974931.43813151, 140245294.57301238, 48974972.910163715, 140245295.20525667, 48974968.96044636, 0, 0, 0, 0, 0 },
-  { 140245323.70236787, 48974975.547534324, 140245317.63018468, 48975015.0839554, 140245329.77455106, 48974936.01111325, 140245323.3987587, 48974977.524355374, 140245324.00597703, 48974973.570713274, 0, 0, 0, 0, 0 },
-  { 140245352.55709344, 48974979.97917418, 140245346.66265437, 48975019.54248532, 140245358.4515325, 48974940.415863045, 140245352.26237148, 48974981.95733974, 140245352.8518154, 48974978.00100862, 0, 0, 0, 0, 0 },
-  { 140245381.43557158, 48974984.281706624, 140245375.6464103, 48975023.86055971, 140245387.22473288, 48974944.70285354, 140245381.1461135, 48974986.26064928, 140245381.72502965, 48974982.30276397, 0, 0, 0, 0, 0 },
-  { 140245410.32006294, 48974988.50661378, 140245404.56369215, 48975028.09024923, 140245416.07643372, 48974948.922978334, 140245410.03224438, 48974990.48579556, 140245410.6078815, 48974986.52743201, 1, 0, 140245359.5200907, 48975337.832196616, 45 },
-  { 140245439.19282797, 48974992.70537773, 140245433.39665315, 48975032.28320432, 140245444.9890028, 48974953.12755114, 140245438.90301922, 48974994.684269056, 140245439.48263672, 48974990.7264864, 0, 0, 0, 0, 0 },
-  { 140245468.0361272, 48974996.92948045, 140245462.13966328, 48975036.49248985, 140245473.93259114, 48974957.366471045, 140245467.741304, 48974998.90763092, 140245468.3309504, 48974994.95132998, 0, 0, 0, 0, 0 },
-  { 140245496.83577436, 48975001.22177477, 140245490.82459056, 48975040.767516255, 140245502.84695816, 48974961.67603329, 140245496.53521517, 48975003.19906185, 140245497.13633355, 48974999.244487695, 0, 0, 0, 0, 0 },
-  { 140245525.5909198, 48975005.59272491, 140245519.46143368, 48975045.120302625, 140245531.7204059, 48974966.0651472, 140245525.2844455, 48975007.5691038, 140245525.8973941, 48975003.616346024, 0, 0, 0, 0, 0 },
-  { 140245554.30384213, 48975010.045197554, 140245548.05250132, 48975049.553687, 140245560.55518293, 48974970.53670811, 140245553.99127507, 48975012.02062202, 140245554.61640918, 48975008.069773085, 1, 4, 140245608.06537312, 48974670.27218835, 29 },
-  { 140245582.97682023, 48975014.5820594, 140245576.6001051, 48975054.070507124, 140245589.35353535, 48974975.09361167, 140245582.65798447, 48975016.556481786, 140245583.295656, 48975012.60763701, 0, 0, 0, 0, 0 },
-  { 140245611.6121327, 48975019.20617711, 140245605.10655928, 48975058.67360057, 140245618.11770612, 48974979.73875365, 140245611.28685403, 48975021.17954828, 140245611.93741137, 48975017.23280594, 1, 1, 140245670.32493284, 48974663.0126804, 49 },
-  { 140245640.21205828, 48975023.920417346, 140245633.57418096, 48975063.36580472, 140245646.8499356, 48974984.475029975, 140245639.8801644, 48975025.89268672, 140245640.54395214, 48975021.948147975, 0, 0, 0, 0, 0 },
-  { 140245668.77887574, 48975028.72764684, 140245662.0052903, 48975068.14995702, 140245675.55246118, 48974989.30533666, 140245668.44019645, 48975030.69876235, 140245669.11755502, 48975026.756531335, 0, 0, 0, 0, 0 },
-  { 140245697.31486374, 48975033.63073223, 140245690.40220994, 48975073.02889485, 140245704.22751755, 48974994.23256961, 140245696.96923104, 48975035.600640364, 140245697.66049644, 48975031.6608241, 1, 4, 140245662.23314574, 48975233.57640751, 40 },
-  { 140245725.82230103, 48975038.63254022, 140245718.76726565, 48975078.005455725, 140245732.8773364, 48974999.25962471, 140245725.46954927, 48975040.60118599, 140245726.1750528, 48975036.663894445, 0, 0, 0, 0, 0 },
-  { 140245754.30346632, 48975043.735937476, 140245747.1027858, 48975083.08247735, 140245761.50414684, 48975004.3893976, 140245753.9434323, 48975045.70326447, 140245754.66350034, 48975041.768610485, 0, 0, 0, 0, 0 },
-  { 140245782.76063842, 48975048.943790704, 140245775.4111018, 48975088.262797706, 140245790.11017504, 48975009.6247837, 140245782.3931616, 48975050.90974105, 140245783.12811524, 48975046.97784036, 1, 3, 140245816.75224528, 48974867.09338333, 29 },
-  { 140245811.19609588, 48975054.25896654, 140245803.69454744, 48975093.54925505, 140245818.69764432, 48975014.968678035, 140245810.82101846, 48975056.22348097, 140245811.5711733, 48975052.294452116, 1, 5, 140245763.1861858, 48975305.716812976, 25 },
-  { 140245839.61211753, 48975059.68433172, 140245831.95545965, 48975098.94468819, 140245847.2687754, 48975020.42397525, 140245839.22928464, 48975061.647349544, 140245839.9949504, 48975057.7213139, 0, 0, 0, 0, 0 },
-  { 140245868.0109821, 48975065.22275291, 140245860.19617796, 48975104.45193639, 140245875.82578623, 48975025.993569426, 140245867.62024188, 48975067.18421208, 140245868.4017223, 48975063.26129373, 1, 3, 140245809.7906913, 48975357.48016982, 49 },
-  { 140245896.39496818, 48975070.87709674, 140245888.41904438, 48975110.073839456, 140245904.370892, 48975031.68035403, 140245895.99617198, 48975072.83693388, 140245896.79376438, 48975068.917259604, 0, 0, 0, 0, 0 },
-  { 140245924.76635468, 48975076.65022996, 140245916.62640384, 48975115.813238025, 140245932.90630552, 48975037.4872219, 140245924.35935715, 48975078.60838036, 140245925.1733522, 48975074.69207956, 0, 0, 0, 0, 0 },
-  { 140245953.12742022, 48975082.54501922, 140245944.82060364, 48975121.672973394, 140245961.4342368, 48975043.41706504, 140245952.71207938, 48975084.50141693, 140245953.54276106, 48975080.588621505, 0, 0, 0, 0, 0 },
-  { 140245981.4804435, 48975088.56433121, 140245973.0039937, 48975127.65588783, 140245989.95689332, 48975049.472774595, 140245981.05662102, 48975090.518909045, 140245981.904266, 48975086.60975338, 1, 5, 140245920.87382734, 48975368.068961, 25 },
-  { 140246009.8277033, 48975094.71103259, 140246001.17892626, 48975133.76482441, 140246018.47648033, 48975055.65724077, 140246009.39526445, 48975096.66372218, 140246010.26014215, 48975092.758343, 0, 0, 0, 0, 0 },
-  { 140246038.17147833, 48975100.987990074, 140246029.3383704, 48975140.00050351, 140246047.00458625, 48975061.97547664, 140246037.72982293, 48975102.93861575, 140246038.61313373, 48975099.0373644, 0, 0, 0, 0, 0 },
-  { 140246066.51068836, 48975107.40447747, 140246057.4283066, 48975146.35971257, 140246075.59307012, 48975068.44924237, 140246066.05656928, 48975109.35223922, 140246066.96480745, 48975105.45671572, 0, 0, 0, 0, 0 },
-  { 140246094.82526088, 48975114.0059973, 140246085.4102355, 48975152.88217635, 140246104.24028626, 48975075.12981825, 140246094.35450962, 48975115.94980625, 140246095.29601213, 48975112.06218835, 0, 0, 0, 0, 0 },
-  { 140246123.08845496, 48975120.850772075, 140246113.2576109, 48975159.62388782, 140246132.91929904, 48975082.07765633, 140246122.59691277, 48975122.78942786, 140246123.57999715, 48975118.91211629, 0, 0, 0, 0, 0 },
-  { 140246151.2735224, 48975127.99703819, 140246140.9439655, 48975166.640281506, 140246161.60307932, 48975089.35379488, 140246150.75704455, 48975129.92920036, 140246151.79000026, 48975126.06487603, 0, 0, 0, 0, 0 },
-  { 140246179.353715, 48975135.503032066, 140246168.44298863, 48975173.98622385, 140246190.26444137, 48975097.019840285, 140246178.8081787, 48975137.42719165, 140246179.8992513, 48975133.57887248, 0, 0, 0, 0, 0 },
-  { 140246207.30228463, 48975143.42699008, 140246195.7286352, 48975181.71603079, 140246218.87593406, 48975105.13794936, 140246206.72360215, 48975145.341442116, 140246207.8809671, 48975141.51253804, 0, 0, 0, 0, 0 },
-  { 140246235.092483, 48975151.827148646, 140246222.7752532, 48975189.88349963, 140246247.40971282, 48975113.77079766, 140246234.47662154, 48975153.72996619, 140246235.7083445, 48975149.9243311, 1, 5, 140246282.205887, 48975006.261606134, 33 },
-  { 140246262.6975621, 48975160.76174416, 140246249.55772713, 48975198.541960366, 140246275.83739707, 48975122.98152795, 140246262.04057035, 48975162.650754966, 140246263.35455385, 48975158.87273335, 1, 5, 140246174.9891636, 48975412.944687344, 30 },
-  { 140246290.0907735, 48975170.28901301, 140246276.05163425, 48975207.74435401, 140246304.12991273, 48975132.83367202, 140246289.38881654, 48975172.16178006, 140246290.79273045, 48975168.41624597, 0, 0, 0, 0, 0 },
-  { 140246317.2453692, 48975180.46719162, 140246302.23340797, 48975217.54334327, 140246332.25733042, 48975143.391039975, 140246316.49477112, 48975182.320999205, 140246317.99596727, 48975178.61338404, 0, 0, 0, 0, 0 },
-  { 140246344.13460088, 48975191.35451636, 140246328.0804986, 48975227.991462186, 140246360.18870315, 48975154.71757053, 140246343.33189577, 48975193.18636365, 140246344.937306, 48975189.52266906, 0, 0, 0, 0, 0 },
-  { 140246370.73172054, 48975203.00922364, 140246353.5712146, 48975239.14116292, 140246387.8922265, 48975166.87728436, 140246369.87369525, 48975204.815820605, 140246371.58974582, 48975201.202626675, 1, 0, 140246209.85197738, 48975541.746154375, 35 },
-  { 140246397.00954905, 48975215.489617474, 140246378.65178707, 48975251.028224304, 140246415.36731103, 48975179.951010644, 140246396.09166095, 48975217.266547814, 140246397.92743716, 48975213.712687135, 0, 0, 0, 0, 0 },
-  { 140246422.8953635, 48975228.86114952, 140246403.19104755, 48975263.671204574, 140246442.59967947, 48975194.051094465, 140246421.91014773, 48975230.60165227, 140246423.8805793, 48975227.12064677, 0, 0, 0, 0, 0 },
-  { 140246448.23132172, 48975243.20263001, 140246427.02653742, 48975277.11954501, 140246469.43610603, 48975209.285715014, 140246447.1710825, 48975244.898475766, 140246449.29156095, 48975241.50678426, 0, 0, 0, 0, 0 },
-  { 140246472.8502515, 48975258.594333395, 140246449.99734116, 48975291.42335241, 140246495.70316184, 48975225.76531438, 140246471.707606, 48975260.235784344, 140246473.992897, 48975256.95288245, 0, 0, 0, 0, 0 },
-  { 140246496.5849809, 48975275.11653415, 140246471.959855, 48975306.63800577, 140246521.21010682, 48975243.59506253, 140246495.3537246, 48975276.69260773, 140246497.8162372, 48975273.54046057, 1, 5, 140246729.29242092, 48974977.23862736, 33 },
-  { 140246519.27648035, 48975292.8435311, 140246493.01650304, 48975323.016591795, 140246545.53645766, 48975262.67047041, 140246517.9634815, 48975294.35218414, 140246520.5894792, 48975291.334878065, 0, 0, 0, 0, 0 },
-  { 140246540.9550665, 48975311.710665144, 140246513.43385562, 48975340.73794458, 140246568.47627738, 48975282.68338571, 140246539.57900596, 48975313.16202912, 140246542.33112705, 48975310.25930117, 1, 3, 140246668.92869714, 48975176.73381578, 42 },
-  { 140246561.84155905, 48975331.51347055, 140246533.4162107, 48975359.65595749, 140246590.2669074, 48975303.370983616, 140246560.42029163, 48975332.9205949, 140246563.26282647, 48975330.106346205, 0, 0, 0, 0, 0 },
-  { 140246582.1651513, 48975352.04133615, 140246553.16495818, 48975379.591087505, 140246611.16534442, 48975324.49158479, 140246580.71514165, 48975353.41882372, 140246583.61516094, 48975350.66384858, 1, 4, 140246664.81570166, 48975273.52454478, 36 },
-  { 140246602.15503675, 48975373.08365086, 140246572.88705233, 48975400.34874004, 140246631.42302117, 48975345.81856167, 140246600.69163752, 48975374.446905315, 140246603.61843598, 48975371.7203964, 0, 0, 0, 0, 0 },
-  { 140246622.0404087, 48975394.429803535, 140246592.79817376, 48975421.722507596, 140246651.28264365, 48975367.137099475, 140246620.57829696, 48975395.79443874, 140246623.50252044, 48975393.06516833, 0, 0, 0, 0, 0 },
-  { 140246642.05046064, 48975415.86918304, 140246613.11356553, 48975443.48541202, 140246670.98735574, 48975388.252954066, 140246640.60361588, 48975417.24999449, 140246643.4973054, 48975414.488371596, 1, 0, 140246474.93989152, 48975575.352905355, 45 },
-  { 140246662.40528646, 48975437.19741942, 140246633.77234486, 48975465.12866814, 140246691.03822806, 48975409.2661707, 140246660.97363937, 48975438.593981855, 140246663.83693355, 48975435.800856985, 0, 0, 0, 0, 0 },
-  { 140246683.0721941, 48975458.38352412, 140246654.426816, 48975486.30201821, 140246711.7175722, 48975430.46503003, 140246681.63992518, 48975459.77944882, 140246684.50446302, 48975456.98759942, 0, 0, 0, 0, 0 },
-  { 140246703.73888156, 48975479.58828806, 140246674.74922118, 48975507.14912243, 140246732.72854194, 48975452.02745369, 140246702.28939855, 48975480.96632978, 140246705.18836457, 48975478.21024634, 0, 0, 0, 0, 0 },
-  { 140246724.07856557, 48975500.98243468, 140246694.41949368, 48975527.821575016, 140246753.73763746, 48975474.14329435, 140246722.59561196, 48975502.3243917, 140246725.56151918, 48975499.640477665, 0, 0, 0, 0, 0 },
-  { 140246743.7644628, 48975522.73668739, 140246713.12669495, 48975548.452969804, 140246774.40223065, 48975497.02040498, 140246742.2325744, 48975524.02250151, 140246745.2963512, 48975521.45087327, 1, 1, 140246832.61398956, 48975448.1594684, 39 },
-  { 140246762.46978986, 48975545.02176962, 140246730.5753253, 48975569.16184276, 140246794.36425442, 48975520.88169648, 140246760.87506664, 48975546.22877328, 140246764.0645131, 48975543.81476596, 0, 0, 0, 0, 0 },
-  { 140246779.86776352, 48975568.00840478, 140246746.49429482, 48975590.05861083, 140246813.24123222, 48975545.958198726, 140246778.1990901, 48975569.11091508, 140246781.53643695, 48975566.90589447, 0, 0, 0, 0, 0 },
-  { 140246795.63160035, 48975591.86731629, 140246760.64655113, 48975611.259230345, 140246830.61664957, 48975572.475402236, 140246793.88234788, 48975592.83691199, 140246797.38085282, 48975590.89772059, 0, 0, 0, 0, 0 },
-  { 140246809.43451715, 48975616.76922758, 140246772.85839462, 48975632.96142514, 140246846.01063967, 48975600.57703002, 140246807.605711, 48975617.578837454, 140246811.26332328, 48975615.959617704, 1, 4, 140247088.32745132, 48975493.303721175, 25 },
-  { 140246820.98680606, 48975642.86438441, 140246783.2245966, 48975656.05587923, 140246858.74901554, 48975629.6728896, 140246819.09869558, 48975643.52395915, 140246822.87491655, 48975642.20480967, 0, 0, 0, 0, 0 },
-  { 140246830.47925648, 48975670.037643105, 140246792.00836283, 48975680.991653435, 140246868.95015013, 48975659.083632775, 140246828.5557118, 48975670.58534362, 140246832.40280116, 48975669.48994259, 0, 0, 0, 0, 0 },
-  { 140246838.4379004, 48975697.98869796, 140246799.5849159, 48975707.49898688, 140246877.29088488, 48975688.478409044, 140246836.49525118, 48975698.46421241, 140246840.3805496, 48975697.51318351, 0, 0, 0, 0, 0 },
-  { 140246845.39560923, 48975726.41346569, 140246806.38760597, 48975735.26646975, 140246884.4036125, 48975717.56046164, 140246843.44520906, 48975726.85611589, 140246847.3460094, 48975725.970815495, 1, 2, 140247102.8484308, 48975667.98363895, 30 },
-  { 140246851.885213, 48975755.00788213, 140246812.8545258, 48975763.76033656, 140246890.91590017, 48975746.2554277, 140246849.93367863, 48975755.44550485, 140246853.83674735, 48975754.570259415, 0, 0, 0, 0, 0 },
-  { 140246858.28343314, 48975783.540099144, 140246819.19206065, 48975792.01739804, 140246897.37480563, 48975775.06280025, 140246856.3288645, 48975783.96396409, 140246860.23800176, 48975783.1162342, 1, 4, 140247203.2647954, 48975708.72793644, 39 },
-  { 140246864.45816675, 48975812.01365124, 140246825.24088237, 48975819.88795152, 140246903.67545113, 48975804.13935095, 140246862.49730253, 48975812.40736625, 140246866.41903096, 48975811.61993622, 0, 0, 0, 0, 0 },
-  { 140246870.17381462, 48975840.47995047, 140246830.78004032, 48975847.41756863, 140246909.56758893, 48975833.542332314, 140246868.2041259, 48975840.82683138, 140246872.14350334, 48975840.13306957, 0, 0, 0, 0, 0 },
-  { 140246875.1947774, 48975868.99040894, 140246835.59759313, 48975874.65282864, 140246914.79196167, 48975863.32798924, 140246873.2149182, 48975869.273529924, 140246877.1746366, 48975868.70728796, 1, 2, 140246487.14237142, 48975924.482122, 41 },
-  { 140246879.2854558, 48975897.59643866, 140246839.49080813, 48975901.64440327, 140246919.08010346, 48975893.54847405, 140246877.2957234, 48975897.798836894, 140246881.27518818, 48975897.39404043, 0, 0, 0, 0, 0 },
-  { 140246882.21025062, 48975926.34945174, 140246842.26551086, 48975928.451299794, 140246922.15499038, 48975924.24760369, 140246880.21301362, 48975926.45454414, 140246884.2074876, 48975926.244359344, 0, 0, 0, 0, 0 },
-  { 140246883.733639, 48975955.30080848, 140246843.73370808, 48975955.2264711, 140246923.73356992, 48975955.37514587, 140246881.73364246, 48975955.29709161, 140246885.73363554, 48975955.30452535, 0, 0, 0, 0, 0 },
-  { 140246883.67944518, 48975984.46176528, 140246843.74227726, 48975982.22064538, 140246923.6166131, 48975986.70288518, 140246881.6825868, 48975984.34970929, 140246885.67630357, 48975984.57382128, 0, 0, 0, 0, 0 },
-  { 140246882.03692436, 48976013.731787644, 140246842.27593538, 48976009.36558166, 140246921.79791334, 48976018.09799363, 140246880.0488749, 48976013.51347735, 140246884.0249738, 48976013.95009794, 0, 0, 0, 0, 0 },
-  { 140246878.82393047, 48976042.991015255, 140246839.3487569, 48976036.53263522, 140246918.29910403, 48976049.44939529, 140246876.8501718, 48976042.66809625, 140246880.79768914, 48976043.31393426, 1, 5, 140246778.1622379, 48976026.52214616, 34 },
-  { 140246874.0583177, 48976072.11958783, 140246834.97760567, 48976063.59327863, 140246913.1390297, 48976080.64589703, 140246872.10428208, 48976071.693272375, 140246876.0123533, 48976072.54590329, 1, 2, 140247054.80661076, 48976111.55376789, 30 },
-  { 140246867.75794002, 48976100.99764507, 140246829.18201137, 48976090.41947284, 140246906.33386868, 48976111.5758173, 140246865.82914358, 48976100.46873646, 140246869.68673646, 48976101.52655368, 0, 0, 0, 0, 0 },
-  { 140246859.94065148, 48976129.505326636, 140246821.98406193, 48976116.88402281, 140246897.89724103, 48976142.12663046, 140246858.042822, 48976128.87426145, 140246861.83848095, 48976130.136391826, 0, 0, 0, 0, 0 },
-  { 140246850.6243062, 48976157.52277225, 140246813.40830088, 48976142.86095287, 140246887.84031153, 48976172.184591636, 140246848.76350594, 48976156.789681286, 140246852.48510647, 48976158.25586322, 0, 0, 0, 0, 0 },
-  { 140246839.82675815, 48976184.93012161, 140246803.4816054, 48976168.22593435, 140246876.17191088, 48976201.63430887, 140246838.0095005, 48976184.094912246, 140246841.6440158, 48976185.76533097, 1, 4, 140247198.73514152, 48976349.88397077, 45 },
-  { 140246827.5658614, 48976211.60751441, 140246792.23301277, 48976192.85678626, 140246862.89871004, 48976230.358242564, 140246825.79921898, 48976210.669978, 140246829.33250383, 48976212.54505082, 0, 0, 0, 0, 0 },
-  { 140246813.85946995, 48976237.43509032, 140246779.69243845, 48976216.63571633, 140246848.02650145, 48976258.23446431, 140246812.15111837, 48976236.39512162, 140246815.56782153, 48976238.47505902, 1, 3, 140246976.15286958, 48976336.23211677, 29 },
-  { 140246798.72636303, 48976262.29417218, 140246765.7929645, 48976239.5919419, 140246831.65976158, 48976284.996402465, 140246797.0796931, 48976261.15906067, 140246800.37303296, 48976263.42928369, 1, 1, 140246511.38246065, 48976064.21721297, 36 },
-  { 140246782.26725775, 48976286.1708692, 140246750.4268311, 48976261.95956541, 140246814.1076844, 48976310.382172994, 140246780.6752364, 48976284.960304014, 140246783.8592791, 48976287.38143439, 1, 1, 140247081.56726816, 48976513.757124856, 34 },
-  { 140246764.72798464, 48976309.23686943, 140246733.76551923, 48976283.91245956, 140246795.69045004, 48976334.561279304, 140246763.17986137, 48976307.97064894, 140246766.2761079, 48976310.50308993, 0, 0, 0, 0, 0 },
-  { 140246746.36924362, 48976331.68287653, 140246716.03034765, 48976305.61467001, 140246776.7081396, 48976357.751083046, 140246744.85229883, 48976330.3794662, 140246747.88618842, 48976332.986286856, 0, 0, 0, 0, 0 },
-  { 140246727.45173457, 48976353.69959404, 140246697.45793256, 48976327.235054746, 140246757.44553658, 48976380.16413334, 140246725.95204446, 48976352.37636708, 140246728.9514247, 48976355.02282101, 1, 1, 140246552.7378378, 48976199.543652624, 44 },
-  { 140246708.23615736, 48976375.47772561, 140246678.29683852, 48976348.951565154, 140246738.1754762, 48976402.00388607, 140246706.7391914, 48976374.15141759, 140246709.7331233, 48976376.80403363, 1, 3, 140246976.9415438, 48976613.55001567, 25 },
-  { 140246688.98321176, 48976397.2079748, 140246658.8055178, 48976370.953322135, 140246719.16090572, 48976423.46262746, 140246687.47432706, 48976395.89524217, 140246690.49209645, 48976398.52070743, 1, 0, 140246543.37583834, 48976270.52927571, 45 },
-  { 140246669.95359778, 48976419.08104523, 140246639.27341437, 48976393.415380515, 140246700.6337812, 48976444.74670995, 140246668.41958863, 48976417.797762, 140246671.48760694, 48976420.36432847, 1, 0, 140246949.91027147, 48976653.28023581, 39 },
-  { 140246651.38818997, 48976441.2737343, 140246620.20071432, 48976416.22695083, 140246682.57566562, 48976466.32051777, 140246649.82881618, 48976440.021395124, 140246652.94756377, 48976442.52607348, 1, 5, 140246528.19766113, 48976342.338939585, 37 },
-  { 140246633.29670167, 48976463.80069277, 140246601.7538655, 48976439.202939056, 140246664.83953783, 48976488.39844648, 140246631.71955985, 48976462.57080508, 140246634.8738435, 48976465.03058045, 1, 1, 140246850.94227108, 48976633.525193386, 30 },
-  { 140246615.53937858, 48976486.571728654, 140246583.78910097, 48976462.242325224, 140246647.2896562, 48976510.901132084, 140246613.9518647, 48976485.35525848, 140246617.12689248, 48976487.78819883, 0, 0, 0, 0, 0 },
-  { 140246597.9739607, 48976509.49489222, 140246566.1597987, 48976485.24908644, 140246629.78812268, 48976533.740697995, 140246596.3832526, 48976508.28260193, 140246599.5646688, 48976510.707182504, 1, 2, 140246790.44964066, 48976656.18201717, 28 },
-  { 140246580.4581879, 48976532.47823366, 140246548.7220705, 48976508.130362086, 140246612.19430533, 48976556.82610523, 140246578.87138203, 48976531.26084008, 140246582.0449938, 48976533.695627235, 1, 0, 140246300.38695154, 48976317.608267054, 42 },
-  { 140246562.8498, 48976555.42980317, 140246531.3348585, 48976530.79632062, 140246594.36474147, 48976580.06328572, 140246561.27405292, 48976554.19812904, 140246564.42554706, 48976556.6614773, 0, 0, 0, 0, 0 },
-  { 140246545.00653693, 48976578.257651, 140246513.85976833, 48976553.16026458, 140246576.15330553, 48976603.35503742, 140246543.4491985, 48976577.00278168, 140246546.56387535, 48976579.51252032, 1, 1, 140246323.08581057, 48976399.43877277, 26 },
-  { 140246526.78613868, 48976600.869827375, 140246496.1606272, 48976575.13895011, 140246557.41165018, 48976626.60070464, 140246525.2548631, 48976599.583283514, 140246528.31741425, 48976602.156371236, 0, 0, 0, 0, 0 },
-  { 140246508.0463449, 48976623.174382485, 140246478.10274434, 48976596.65305551, 140246537.98994547, 48976649.69570946, 140246506.5491649, 48976621.84831613, 140246509.54352492, 48976624.50044884, 0, 0, 0, 0, 0 },
-  { 140246488.6448957, 48976645.07936658, 140246459.53895462, 48976617.64136022, 140246517.7508368, 48976672.517372936, 140246487.18959865, 48976643.70746626, 140246490.10019276, 48976646.4512669, 1, 4, 140246764.42368758, 48976905.05447682, 36 },
-  { 140246468.46042174, 48976666.49083877, 140246440.2864428, 48976638.09670365, 140246496.6344007, 48976694.8849739, 140246467.0517228, 48976665.07113202, 140246469.8691207, 48976667.91054553, 1, 3, 140246267.72082165, 48976464.182625994, 42 },
-  { 140246447.48453185, 48976687.30409045, 140246420.32332927, 48976657.939671926, 140246474.64573443, 48976716.66850897, 140246446.12647173, 48976685.83586952, 140246448.84259197, 48976688.772311375, 1, 2, 140246617.92107797, 48976871.56581666, 45 },
-  { 140246425.74685183, 48976707.410789646, 140246399.69031343, 48976677.061871946, 140246451.80339023, 48976737.75970735, 140246424.44402492, 48976705.89334376, 140246427.04967874, 48976708.92823553, 1, 1, 140246197.75214067, 48976441.857759744, 37 },
-  { 140246403.27703616, 48976726.702601664, 140246378.4290862, 48976695.35647936, 140246428.1249861, 48976758.048723966, 140246402.03463867, 48976725.13529555, 140246404.51943365, 48976728.26990778, 0, 0, 0, 0, 0 },
-  { 140246380.10473928, 48976745.0711918, 140246356.58219728, 48976712.71860276, 140246403.62728128, 48976777.42378084, 140246378.92861217, 48976743.45356235, 140246381.28086638, 48976746.688821256, 1, 3, 140246214.8588817, 48976517.794253774, 26 },
-  { 140246356.25961563, 48976762.40822538, 140246334.1928493, 48976729.045704134, 140246378.32638195, 48976795.770746626, 140246355.1562773, 48976760.74009932, 140246357.36295396, 48976764.07635144, 1, 0, 140246546.03380603, 48977049.325908095, 27 },
-  { 140246331.77131966, 48976778.605367705, 140246311.30452478, 48976744.238082275, 140246352.23811454, 48976812.972653136, 140246330.7479799, 48976776.88700344, 140246332.7946594, 48976780.323731974, 1, 3, 140246153.19853443, 48976478.75080232, 31 },
-  { 140246306.6695058, 48976793.55428405, 140246287.96038786, 48976758.199384734, 140246325.37862375, 48976828.90918337, 140246305.73404992, 48976791.786539085, 140246307.6049617, 48976795.32202902, 0, 0, 0, 0, 0 },
-  { 140246280.98382846, 48976807.14663975, 140246264.2024034, 48976770.83708491, 140246297.7652535, 48976843.45619459, 140246280.1447572, 48976805.331162006, 140246281.8228997, 48976808.96211749, 0, 0, 0, 0, 0 },
-  { 140246254.74394214, 48976819.27410008, 140246240.07012922, 48976782.06282203, 140246269.41775507, 48976856.48537813, 140246254.0102515, 48976817.413536176, 140246255.4776328, 48976821.134663984, 1, 0, 140246364.06384847, 48977096.49812155, 30 },
-  { 140246227.97950128, 48976829.82833038, 140246215.5924858, 48976791.7946368, 140246240.36651677, 48976867.862023965, 140246227.36015052, 48976827.9266457, 140246228.59885204, 48976831.73001506, 0, 0, 0, 0, 0 },
-  { 140246200.7206167, 48976838.7061488, 140246190.5970517, 48976800.00843011, 140246210.8441817, 48976877.4038675, 140246200.21443844, 48976836.77126287, 140246201.22679496, 48976840.64103474, 1, 0, 140246278.41897792, 48977135.711139776, 35 },
-  { 140246173.01076153, 48976845.955220036, 140246164.87300467, 48976806.79175603, 140246181.14851838, 48976885.118684046, 140246172.6038737, 48976843.997046836, 140246173.41764936, 48976847.91339324, 0, 0, 0, 0, 0 },
-  { 140246144.90858713, 48976851.79455698, 140246138.44243813, 48976812.32065526, 140246151.37473613, 48976891.26845871, 140246144.58527967, 48976849.8208619, 140246145.23189458, 48976853.76825207, 0, 0, 0, 0, 0 },
-  { 140246116.47356635, 48976856.4524467, 140246111.3541412, 48976816.7814058, 140246121.5929915, 48976896.1234876, 140246116.2175951, 48976854.46889465, 140246116.7295376, 48976858.435998745, 0, 0, 0, 0, 0 },
-  { 140246087.7651721, 48976860.157176204, 140246083.66568366, 48976820.36780332, 140246091.86466053, 48976899.94654909, 140246087.56019768, 48976858.16770756, 140246087.9701465, 48976862.146644846, 0, 0, 0, 0, 0 },
-  { 140246058.84287712, 48976863.13703252, 140246055.43910548, 48976823.2821164, 140246062.24664876, 48976902.991948634, 140246058.67268854, 48976861.14428671, 140246059.0130657, 48976865.129778326, 0, 0, 0, 0, 0 },
-  { 140246029.76615432, 48976865.62030269, 140246026.7377187, 48976825.73511023, 140246032.79458994, 48976905.50549515, 140246029.61473253, 48976863.62604307, 140246029.9175761, 48976867.61456232, 0, 0, 0, 0, 0 },
-  { 140246000.59447667, 48976867.83527376, 140245997.62403575, 48976827.945720226, 140246003.5649176, 48976907.72482729, 140246000.44595462, 48976865.84079608, 140246000.74299872, 48976869.82975143, 0, 0, 0, 0, 0 },
-  { 140245971.38731685, 48976870.01023274, 140245968.15871173, 48976830.14074429, 140245974.61592197, 48976909.87972119, 140245971.22588658, 48976868.016758315, 140245971.54874712, 48976872.00370716, 0, 0, 0, 0, 0 },
-  { 140245942.20414785, 48976872.373466685, 140245938.40039966, 48976832.55473366, 140245946.00789604, 48976912.192199714, 140245942.01396045, 48976870.38253003, 140245942.39433524, 48976874.36440334, 0, 0, 0, 0, 0 },
-  { 140245913.10444242, 48976875.15326261, 140245908.40648356, 48976835.43010585, 140245917.80240127, 48976914.876419365, 140245912.86954448, 48976873.16710477, 140245913.33934036, 48976877.13942044, 1, 2, 140245954.5639293, 48977225.710120976, 28 },
-  { 140245884.14767355, 48976878.57790757, 140245878.26456228, 48976839.01291039, 140245890.03078482, 48976918.14290475, 140245883.85351798, 48976876.599657714, 140245884.44182912, 48976880.556157425, 0, 0, 0, 0, 0 },
-  { 140245855.38775492, 48976882.854359314, 140245848.20500022, 48976843.50454311, 140245862.5705096, 48976922.20417552, 140245855.02861717, 48976880.88686851, 140245855.74689266, 48976884.82185012, 0, 0, 0, 0, 0 },
-  { 140245826.84594038, 48976888.064265534, 140245818.31699374, 48976848.98412903, 140245835.37488702, 48976927.14440204, 140245826.41949305, 48976886.110258706, 140245827.2723877, 48976890.01827236, 1, 4, 140245794.86239055, 48976741.51375363, 38 },
-  { 140245798.53159487, 48976894.243659034, 140245788.61538336, 48976855.4922881, 140245808.4478064, 48976932.99502997, 140245798.0357843, 48976892.30609049, 140245799.02740544, 48976896.18122758, 0, 0, 0, 0, 0 },
-  { 140245770.45406654, 48976901.42850702, 140245759.11595303, 48976863.06905992, 140245781.79218006, 48976939.78795412, 140245769.88716087, 48976899.51053467, 140245771.02097222, 48976903.34647938, 0, 0, 0, 0, 0 },
-  { 140245742.62270325, 48976909.6547767, 140245729.8354947, 48976871.75375696, 140245755.4099118, 48976947.55579644, 140245741.98334283, 48976907.75972571, 140245743.26206368, 48976911.54982769, 1, 2, 140245863.46182412, 48977267.819413245, 39 },
-  { 140245715.04685304, 48976918.95843529, 140245700.79150862, 48976881.58484628, 140245729.30219746, 48976956.3320243, 140245714.33408582, 48976917.08975584, 140245715.75962025, 48976920.82711474, 0, 0, 0, 0, 0 },
-  { 140245687.73909625, 48976929.37438646, 140245671.9991446, 48976892.601381116, 140245703.4790479, 48976966.1473918, 140245686.95209867, 48976927.535736196, 140245688.52609384, 48976931.21303672, 0, 0, 0, 0, 0 },
-  { 140245660.76509827, 48976940.920068406, 140245643.51822388, 48976904.82927563, 140245678.01197267, 48976977.01086118, 140245659.90275455, 48976939.11552877, 140245661.627442, 48976942.72460804, 1, 0, 140245550.81627396, 48976710.84126445, 40 },
-  { 140245634.23394513, 48976953.59863351, 140245615.45353365, 48976918.28155344, 140245653.0143566, 48976988.915713586, 140245633.29492456, 48976951.83277951, 140245635.1729657, 48976955.364487514, 0, 0, 0, 0, 0 },
-  { 140245608.2559978, 48976967.41281462, 140245587.91284347, 48976932.97219802, 140245628.59915215, 48977001.85343122, 140245607.2388401, 48976965.690783784, 140245609.2731555, 48976969.13484545, 0, 0, 0, 0, 0 },
-  { 140245582.9416173, 48976982.36534451, 140245561.00589818, 48976948.91651455, 140245604.87733644, 48977015.814174466, 140245581.84483135, 48976980.69290301, 140245584.03840327, 48976984.03778601, 1, 0, 140245792.42773512, 48977301.801670626, 49 },
-  { 140245558.40116468, 48976998.45895607, 140245534.84486115, 48976966.13094091, 140245581.9574682, 48977030.786971234, 140245557.2233495, 48976996.842555314, 140245559.57897985, 48977000.075356826, 1, 5, 140245441.79746225, 48976838.435281016, 30 },
-  { 140245534.74500105, 48977015.69638212, 140245509.5448407, 48976984.632706895, 140245559.9451614, 48977046.760057345, 140245533.48499304, 48977014.143198356, 140245536.00500906, 48977017.249565884, 0, 0, 0, 0, 0 },
-  { 140245512.08348736, 48977034.0803555, 140245485.22446722, 48977004.43928538, 140245538.9425075, 48977063.72142562, 140245510.74053636, 48977032.598302, 140245513.42643836, 48977035.562409006, 0, 0, 0, 0, 0 },
-  { 140245490.52698472, 48977053.61360906, 140245462.00646383, 48977025.567577474, 140245519.04750562, 48977081.65964065, 140245489.10095868, 48977052.21130748, 140245491.95301077, 48977055.01591064, 0, 0, 0, 0, 0 },
-  { 140245470.18585417, 48977074.29887561, 140245440.02977616, 48977048.01939769, 140245500.34193218, 48977100.578353524, 140245468.67805028, 48977072.98490171, 140245471.69365805, 48977075.612849504, 0, 0, 0, 0, 0 },
-  { 140245451.15959802, 48977096.13177755, 140245419.58931637, 48977071.56925903, 140245482.72987968, 48977120.69429606, 140245449.58108395, 48977094.903651625, 140245452.7381121, 48977097.35990347, 0, 0, 0, 0, 0 },
-  { 140245433.37270007, 48977118.993332975, 140245400.72661966, 48977095.87984268, 140245466.01878047, 48977142.106823266, 140245431.74039605, 48977117.83765846, 140245435.00500408, 48977120.14900749, 0, 0, 0, 0, 0 },
-  { 140245416.608199, 48977142.67193984, 140245383.18425232, 48977120.698324114, 140245450.03214568, 48977164.64555557, 140245414.93700168, 48977141.573259056, 140245418.27939633, 48977143.77062063, 1, 4, 140245728.28650182, 48977347.57590649, 28 },
-  { 140245400.64508504, 48977166.95334517, 140245366.68363032, 48977145.81996889, 140245434.60653976, 48977188.08672146, 140245398.9470123, 48977165.896676354, 140245402.34315777, 48977168.01001399, 1, 4, 140245163.76393837, 48977019.54804557, 38 },
-  { 140245385.28255117, 48977191.64102362, 140245350.8642799, 48977171.26008637, 140245419.70082244, 48977212.02196087, 140245383.5616376, 48977190.621976756, 140245387.00346473, 48977192.66007049, 1, 4, 140245485.9559946, 48977251.25526507, 42 },
-  { 140245370.46432477, 48977216.6652769, 140245335.60712153, 48977197.044487365, 140245405.32152802, 48977236.286066435, 140245368.7214646, 48977215.68423742, 140245372.20718494, 48977217.64631638, 0, 0, 0, 0, 0 },
-  { 140245356.19709077, 48977242.01165117, 140245320.91841316, 48977223.15920026, 140245391.4757684, 48977260.86410209, 140245354.4331569, 48977241.06902863, 140245357.96102464, 48977242.954273716, 0, 0, 0, 0, 0 },
-  { 140245342.48779413, 48977267.66592068, 140245306.80495423, 48977249.590109855, 140245378.17063403, 48977285.74173151, 140245340.70365214, 48977266.76213014, 140245344.27193612, 48977268.56971122, 0, 0, 0, 0, 0 },
-  { 140245329.34337968, 48977293.613859676, 140245293.27357936, 48977276.32312499, 140245365.41318, 48977310.90459436, 140245327.53988966, 48977292.74932294, 140245331.1468697, 48977294.47839641, 1, 1, 140245534.9412414, 48977392.171047375, 44 },
-  { 140245316.7707923, 48977319.84124238, 140245280.33116043, 48977303.34417508, 140245353.21042418, 48977336.33830968, 140245314.94881073, 48977319.01638901, 140245318.59277388, 48977320.66609575, 0, 0, 0, 0, 0 },
-  { 140245304.77697694, 48977346.33384307, 140245267.98460832, 48977330.63920671, 140245341.56934556, 48977362.02847943, 140245302.9373585, 48977345.54911125, 140245306.6165954, 48977347.11857489, 0, 0, 0, 0, 0 },
-  { 140245293.36887845, 48977373.07743594, 140245256.24087414, 48977358.19418036, 140245330.49688277, 48977387.96069152, 140245291.51247823, 48977372.333273165, 140245295.22527868, 48977373.821598716, 1, 4, 140245034.40104845, 48977269.26672825, 36 },
-  { 140245282.55344167, 48977400.05779525, 140245245.10695085, 48977385.995067045, 140245319.9999325, 48977414.12052345, 140245280.68111712, 48977399.35465884, 140245284.42576623, 48977400.760931656, 1, 3, 140245466.04124674, 48977468.96516344, 41 },
-  { 140245272.33761156, 48977427.260695234, 140245234.58987445, 48977414.0278443, 140245310.08534867, 48977440.493546166, 140245270.4502247, 48977426.59905269, 140245274.2249984, 48977427.92233778, 0, 0, 0, 0, 0 },
-  { 140245262.728333, 48977454.67191015, 140245224.69672507, 48977442.278492585, 140245300.75994092, 48977467.06532772, 140245260.8267526, 48977454.05223928, 140245264.6299134, 48977455.29158103, 0, 0, 0, 0, 0 },
-  { 140245253.73255083, 48977482.277214214, 140245215.4349196, 48977470.7320229, 140245292.03018206, 48977493.82240553, 140245251.81766927, 48977481.69995465, 140245255.6474324, 48977482.85447378, 1, 2, 140245024.90420425, 48977413.2946961, 47 },
-  { 140245245.3564913, 48977510.062222734, 140245206.84043938, 48977499.26806951, 140245283.87254322, 48977520.856375955, 140245243.4306887, 48977509.52251507, 140245247.2822939, 48977510.601930395, 0, 0, 0, 0, 0 },
-  { 140245237.52823415, 48977537.99526691, 140245198.8886283, 48977527.65211173, 140245276.16784, 48977548.33842208, 140245235.59625387, 48977537.47810915, 140245239.46021444, 48977538.51242466, 0, 0, 0, 0, 0 },
-  { 140245230.02860916, 48977566.012109846, 140245191.35563332, 48977555.79443205, 140245268.701585, 48977576.22978764, 140245228.09496036, 48977565.501225956, 140245231.96225795, 48977566.522993736, 1, 4, 140245386.65416133, 48977607.393704906, 34 },
-  { 140245222.6221425, 48977594.0449087, 140245184.00287375, 48977583.62607563, 140245261.24141124, 48977604.46374177, 140245220.69117907, 48977593.52396705, 140245224.55310592, 48977594.565850355, 0, 0, 0, 0, 0 },
-  { 140245215.07336023, 48977622.02582064, 140245176.60010982, 48977611.080090754, 140245253.54661065, 48977632.97155053, 140245213.14969772, 48977621.47853415, 140245216.99702275, 48977622.57310714, 0, 0, 0, 0, 0 },
-  { 140245207.14678863, 48977649.88700281, 140245168.92529923, 48977638.09218408, 140245245.36827803, 48977661.68182154, 140245205.23571417, 48977649.29726187, 140245209.0578631, 48977650.47674375, 0, 0, 0, 0, 0 },
-  { 140245198.60695374, 48977677.56061239, 140245160.76405793, 48977664.60240123, 140245236.44984955, 48977690.51882355, 140245196.71480894, 48977676.91270183, 140245200.49909854, 48977678.208522946, 1, 4, 140245466.3454416, 48977769.23995636, 45 },
-  { 140245189.21838182, 48977704.978806496, 140245151.89178705, 48977690.600860804, 140245226.5449766, 48977719.35675219, 140245187.3520521, 48977704.25990921, 140245191.08471155, 48977705.69770378, 1, 0, 140244892.47195336, 48977590.67413822, 35 },
-  { 140245178.78059065, 48977732.07636338, 140245142.04404035, 48977716.251513526, 140245215.51714095, 48977747.90121323, 140245176.94376314, 48977731.28512088, 140245180.61741817, 48977732.86760587, 0, 0, 0, 0, 0 },
-  { 140245167.26844656, 48977758.801195785, 140245131.17058063, 48977741.56913046, 140245203.3663125, 48977776.03326111, 140245165.46355328, 48977757.93959252, 140245169.07333985, 48977759.66279905, 0, 0, 0, 0, 0 },
-  { 140245154.71162608, 48977785.105322056, 140245119.30033427, 48977766.50316057, 140245190.1229179, 48977803.70748354, 140245152.9410615, 48977784.175213985, 140245156.48219067, 48977786.035430126, 0, 0, 0, 0, 0 },
-  { 140245141.13982454, 48977810.94076195, 140245106.46285793, 48977791.00315963, 140245175.81679115, 48977830.87836428, 140245139.4059762, 48977809.94388184, 140245142.87367287, 48977811.93764207, 0, 0, 0, 0, 0 },
-  { 140245126.58273718, 48977836.25953521, 140245092.68827522, 48977815.01887966, 140245160.47719914, 48977857.50019076, 140245124.88801408, 48977835.197502434, 140245128.27746028, 48977837.32156798, 0, 0, 0, 0, 0 },
-  { 140245111.07005927, 48977861.01366156, 140245078.00724125, 48977838.50033075, 140245144.1328773, 48977883.52699237, 140245109.41691837, 48977859.88799502, 140245112.72320017, 48977862.13932811, 0, 0, 0, 0, 0 },
-  { 140245094.63148597, 48977885.15516076, 140245062.4509058, 48977861.39784061, 140245126.81206614, 48977908.91248091, 140245093.02245697, 48977883.96729475, 140245096.24051496, 48977886.34302677, 0, 0, 0, 0, 0 },
-  { 140245077.2967126, 48977908.63605255, 140245046.05087608, 48977883.66211213, 140245108.54254913, 48977933.609992966, 140245075.73442078, 48977907.38735553, 140245078.85900444, 48977909.88474957, 0, 0, 0, 0, 0 },
-  { 140245059.09543434, 48977931.40835663, 140245028.8391744, 48977905.24428329, 140245089.3516943, 48977957.57242997, 140245057.58262134, 48977930.10015296, 140245060.60824734, 48977932.7165603, 1, 0, 140245154.4026532, 48978013.825187646, 37 },
-  { 140245040.05734646, 48977953.4240928, 140245010.83659452, 48977926.10838932, 140245069.2780984, 48977980.73979628, 140245038.59630886, 48977952.058307625, 140245041.51838407, 48977954.78987797, 1, 1, 140244823.09326336, 48977750.60499447, 47 },
-  { 140245020.21732843, 48977974.647790946, 140244992.01419544, 48977946.282613516, 140245048.42046142, 48978003.01296838, 140245018.8071718, 48977973.22953208, 140245021.62748507, 48977976.066049814, 0, 0, 0, 0, 0 },
-  { 140244999.63759854, 48977995.109953046, 140244972.4030604, 48977965.81353802, 140245026.87213668, 48978024.40636807, 140244998.27587163, 48977993.645132296, 140245000.99932545, 48977996.574773796, 0, 0, 0, 0, 0 },
-  { 140244978.38935435, 48978014.86274929, 140244952.06420198, 48977984.74653517, 140245004.71450672, 48978044.97896342, 140244977.07309672, 48978013.356938586, 140244979.70561197, 48978016.36856, 0, 0, 0, 0, 0 },
-  { 140244956.5437987, 48978033.95836264, 140244931.0606176, 48978003.12643958, 140244982.02697983, 48978064.7902857, 140244955.26963967, 48978032.41676649, 140244957.81795776, 48978035.49995879, 0, 0, 0, 0, 0 },
-  { 140244934.1721345, 48978052.4489761, 140244909.45702806, 48978020.9980061, 140244958.88724092, 48978083.8999461, 140244932.93637916, 48978050.8764276, 140244935.4078898, 48978054.0215246, 1, 3, 140245068.86946455, 48978223.8567626, 48 },
-  { 140244911.34556463, 48978070.38677272, 140244887.31959534, 48978038.40626618, 140244935.37153393, 48978102.36727926, 140244910.14426616, 48978068.7877474, 140244912.5468631, 48978071.985798046, 0, 0, 0, 0, 0 },
-  { 140244888.13529202, 48978087.82393547, 140244864.72395834, 48978055.390781835, 140244911.5466257, 48978120.25708911, 140244886.96472535, 48978086.20227779, 140244889.3058587, 48978089.445593156, 0, 0, 0, 0, 0 },
-  { 140244864.60450554, 48978104.80924318, 140244841.7640178, 48978071.971580066, 140244887.4449933, 48978137.646906294, 140244863.46248114, 48978103.16736002, 140244865.74652994, 48978106.45112634, 1, 4, 140244780.0947008, 48977983.30988965, 25 },
-  { 140244840.78405696, 48978121.377738394, 140244818.4769206, 48978088.17545432, 140244863.09119332, 48978154.58002247, 140244839.66870016, 48978119.71762419, 140244841.89941376, 48978123.0378526, 0, 0, 0, 0, 0 },
-  { 140244816.69664276, 48978137.56099951, 140244794.8835376, 48978104.03208001, 140244838.50974792, 48978171.089919016, 140244815.6059875, 48978135.88455354, 140244817.78729802, 48978139.23744549, 1, 4, 140244638.91983563, 48977864.300305575, 32 },
-  { 140244792.36495954, 48978153.390604906, 140244771.00503427, 48978119.571178645, 140244813.7248848, 48978187.21003117, 140244791.29696327, 48978151.69963359, 140244793.4329558, 48978155.08157622, 0, 0, 0, 0, 0 },
-  { 140244767.811704, 48978168.898133, 140244746.86283863, 48978134.82255467, 140244788.7605694, 48978202.973711334, 140244766.76426074, 48978167.19435409, 140244768.85914728, 48978170.60191192, 0, 0, 0, 0, 0 },
-  { 140244743.05957258, 48978184.11516217, 140244722.47860706, 48978149.81612634, 140244763.6405381, 48978218.414198, 140244742.0305243, 48978182.40021038, 140244744.08862084, 48978185.83011396, 1, 1, 140244869.63251042, 48978395.05423253, 38 },
-  { 140244718.1312619, 48978199.07327076, 140244697.87419406, 48978164.581950076, 140244738.3883297, 48978233.564591445, 140244717.1184085, 48978197.348704726, 140244719.14411527, 48978200.797836795, 0, 0, 0, 0, 0 },
-  { 140244693.0494685, 48978213.80403723, 140244673.0716223, 48978179.15024, 140244713.02731466, 48978248.45783446, 140244692.05057618, 48978212.07134736, 140244694.0483608, 48978215.53672709, 0, 0, 0, 0, 0 },
-  { 140244667.83688894, 48978228.33903991, 140244648.09305602, 48978193.55138317, 140244687.58072186, 48978263.126696646, 140244666.8496973, 48978226.59965707, 140244668.8240806, 48978230.07842274, 0, 0, 0, 0, 0 },
-  { 140244642.51621988, 48978242.70985721, 140244622.96077788, 48978207.815951034, 140244662.0716619, 48978277.60376339, 140244641.5384478, 48978240.965161905, 140244643.49399197, 48978244.45455252, 1, 0, 140244701.18254587, 48978347.391575746, 42 },
-  { 140244617.11015773, 48978256.94806752, 140244597.69716853, 48978221.97470837, 140244636.52314693, 48978291.921426676, 140244616.13950828, 48978255.19939957, 140244618.08080718, 48978258.69673548, 0, 0, 0, 0, 0 },
-  { 140244591.6413992, 48978271.08524925, 140244572.32469168, 48978236.05861924, 140244610.95810673, 48978306.11187927, 140244590.67556384, 48978269.33391775, 140244592.60723457, 48978272.83658075, 0, 0, 0, 0, 0 },
-  { 140244566.13264078, 48978285.152980745, 140244546.86588058, 48978250.09885187, 140244585.39940098, 48978320.20710962, 140244565.16930276, 48978283.4002743, 140244567.0959788, 48978286.90568719, 0, 0, 0, 0, 0 },
-  { 140244540.6065791, 48978299.18284043, 140244521.34333104, 48978264.1267814, 140244559.86982715, 48978334.23889946, 140244539.6434167, 48978297.430037476, 140244541.5697415, 48978300.93564338, 1, 2, 140244608.99110964, 48978423.63185, 32 },
-  { 140244515.08591068, 48978313.20640667, 140244495.7796964, 48978278.173991814, 140244534.39212495, 48978348.23882152, 140244514.12059996, 48978311.45478593, 140244516.0512214, 48978314.95802741, 1, 5, 140244448.9621268, 48978193.220385805, 45 },
-  { 140244489.59333217, 48978327.25525786, 140244470.19768792, 48978292.272276506, 140244508.98897642, 48978362.238239214, 140244488.62354997, 48978325.50610879, 140244490.56311437, 48978329.00440693, 1, 4, 140244638.9397928, 48978596.62421431, 25 },
-  { 140244464.15154004, 48978341.360972404, 140244444.6200783, 48978306.453637905, 140244483.6830018, 48978376.2683069, 140244463.17496696, 48978339.61560568, 140244465.12811312, 48978343.10633913, 0, 0, 0, 0, 0 },
-  { 140244438.78323087, 48978355.55512866, 140244419.06970975, 48978320.75028581, 140244458.496752, 48978390.3599715, 140244437.79755482, 48978353.81488652, 140244439.76890692, 48978357.295370795, 0, 0, 0, 0, 0 },
-  { 140244413.5111013, 48978369.86930505, 140244393.56950668, 48978335.194634125, 140244433.45269594, 48978404.54397598, 140244412.51402158, 48978368.1355715, 140244414.50818104, 48978371.6030386, 0, 0, 0, 0, 0 },
-  { 140244388.35784784, 48978384.33507994, 140244368.1424909, 48978349.819295965, 140244408.5732048, 48978418.85086391, 140244387.34708, 48978382.60929074, 140244389.3686157, 48978386.060869135, 0, 0, 0, 0, 0 },
-  { 140244363.34616706, 48978398.984031714, 140244342.81180236, 48978364.657076314, 140244383.88053176, 48978433.310987115, 140244362.31944883, 48978397.267683946, 140244364.3728853, 48978400.70037948, 0, 0, 0, 0, 0 },
-  { 140244338.49875554, 48978413.84773878, 140244317.6007232, 48978379.74096167, 140244359.39678788, 48978447.95451589, 140244337.45385394, 48978412.14239992, 140244339.54365715, 48978415.55307764, 0, 0, 0, 0, 0 },
-  { 140244313.83830985, 48978428.95777951, 140244292.53270495, 48978395.10410616, 140244335.14391476, 48978462.811452866, 140244312.7730296, 48978427.265095845, 140244314.9035901, 48978430.65046318, 0, 0, 0, 0, 0 },
-  { 140244289.3875266, 48978444.34573231, 140244267.63139963, 48978410.77981299, 140244311.14365357, 48978477.911651626, 140244288.29972026, 48978442.66743635, 140244290.47533295, 48978446.02402827, 0, 0, 0, 0, 0 },
-  { 140244265.1691023, 48978460.04317556, 140244242.92069277, 48978426.801510856, 140244287.41751185, 48978493.28484027, 140244264.05668184, 48978458.381092325, 140244266.28152278, 48978461.7052588, 0, 0, 0, 0, 0 },
-  { 140244241.2057336, 48978476.08168765, 140244218.4247386, 48978443.202723764, 140244263.9867286, 48978508.96065154, 140244240.06668386, 48978474.437739454, 140244242.34478334, 48978477.72563585, 0, 0, 0, 0, 0 },
-  { 140244217.52011696, 48978492.492846966, 140244194.16799515, 48978460.01703431, 140244240.87223876, 48978524.968659624, 140244216.35251087, 48978490.86905633, 140244218.68772304, 48978494.1166376, 0, 0, 0, 0, 0 },
-  { 140244194.134949, 48978509.308231875, 140244170.17525914, 48978477.2780389, 140244218.09463885, 48978541.338424854, 140244192.9369645, 48978507.70672223, 140244195.3329335, 48978510.90974152, 1, 0, 140244373.8326229, 48978749.53467921, 38 },
-  { 140244171.0729263, 48978526.55942082, 140244146.4719049, 48978495.01913316, 140244195.67394772, 48978558.099708475, 140244169.84287524, 48978524.98240643, 140244172.30297738, 48978528.1364352, 0, 0, 0, 0, 0 },
-  { 140244148.356631, 48978544.27784092, 140244123.12066722, 48978513.2432452, 140244173.5925948, 48978575.31243664, 140244147.0948328, 48978542.72611114, 140244149.6184292, 48978545.8295707, 0, 0, 0, 0, 0 },
-  { 140244125.98771077, 48978562.467259794, 140244100.20331421, 48978531.886793904, 140244151.77210733, 48978593.047725685, 140244124.69849095, 48978560.9382365, 140244127.2769306, 48978563.99628309, 1, 0, 140243924.2248077, 48978323.1751142, 31 },
-  { 140244103.92264393, 48978581.071764894, 140244077.6832548, 48978550.880798385, 140244130.16203305, 48978611.2627314, 140244102.61067447, 48978579.562216565, 140244105.2346134, 48978582.58131322, 1, 2, 140244229.8717117, 48978725.988404125, 48 },
-  { 140244082.1120284, 48978600.02767437, 140244055.50761232, 48978570.1578728, 140244108.71644446, 48978629.897475936, 140244080.7818076, 48978598.53418429, 140244083.44224918, 48978601.52116445, 0, 0, 0, 0, 0 },
-  { 140244060.50646228, 48978619.2713064, 140244033.62394464, 48978589.65154533, 140244087.3889799, 48978648.891067475, 140244059.1623364, 48978617.79031835, 140244061.85058814, 48978620.75229446, 1, 2, 140244128.38481927, 48978694.061203115, 41 },
-  { 140244039.05654365, 48978638.73897915, 140244011.9803703, 48978609.296138965, 140244066.13271698, 48978668.18181934, 140244037.70273498, 48978637.26683714, 140244040.41035232, 48978640.211121164, 0, 0, 0, 0, 0 },
-  { 140244017.71287036, 48978658.36701074, 140243990.5256562, 48978629.02667358, 140244044.90008453, 48978687.70734791, 140244016.35350966, 48978656.89999388, 140244019.07223105, 48978659.8340276, 1, 1, 140244280.74916756, 48978942.23477284, 47 },
-  { 140243996.42604053, 48978678.091719374, 140243969.20927504, 48978648.77879259, 140244023.64280602, 48978707.40464616, 140243995.06520227, 48978676.62607303, 140243997.7868788, 48978679.557365716, 0, 0, 0, 0, 0 },
-  { 140243975.14665207, 48978697.849423185, 140243947.9814337, 48978668.488719694, 140244002.31187046, 48978727.210126676, 140243973.78839114, 48978696.38138801, 140243976.504913, 48978699.31745836, 1, 4, 140244174.1318768, 48978912.91657627, 29 },
-  { 140243953.8253031, 48978717.57644033, 140243926.79307857, 48978688.09324449, 140243980.85752764, 48978747.05963616, 140243952.47369188, 48978716.102280535, 140243955.17691433, 48978719.05060012, 1, 0, 140243685.53047457, 48978424.95572167, 39 },
-  { 140243932.4125916, 48978737.20908899, 140243905.59587693, 48978707.52973903, 140243959.22930628, 48978766.88843895, 140243931.0717559, 48978735.72512149, 140243933.75342733, 48978738.69305649, 1, 2, 140244142.25338393, 48978969.45000242, 30 },
-  { 140243910.85911554, 48978756.68368728, 140243884.34217384, 48978726.73620319, 140243937.37605724, 48978786.63117136, 140243909.53326845, 48978755.18631307, 140243912.18496263, 48978758.181061484, 1, 4, 140243776.28563643, 48978604.70020556, 25 },
-  { 140243889.11547297, 48978775.93655342, 140243862.9849229, 48978745.65133669, 140243915.24602306, 48978806.221770145, 140243887.80894548, 48978774.42229258, 140243890.42200047, 48978777.450814255, 1, 3, 140244013.23558587, 48978919.79133288, 31 },
-  { 140243867.1322619, 48978794.90400553, 140243841.47758397, 48978764.214634396, 140243892.78693983, 48978825.59337666, 140243865.849528, 48978793.36953697, 140243868.4149958, 48978796.43847408, 0, 0, 0, 0, 0 },
-  { 140243844.86008033, 48978813.52236178, 140243819.77398494, 48978782.36649848, 140243869.94617572, 48978844.67822508, 140243843.60577556, 48978811.964568615, 140243846.1143851, 48978815.08015494, 0, 0, 0, 0, 0 },
-  { 140243822.24952626, 48978831.72794032, 140243797.8281398, 48978800.048358835, 140243846.6709127, 48978863.40752181, 140243821.02845693, 48978830.14396124, 140243823.4705956, 48978833.3119194, 0, 0, 0, 0, 0 },
-  { 140243799.25119773, 48978849.457059294, 140243775.58817345, 48978817.20707817, 140243822.914222, 48978881.70704042, 140243798.0680465, 48978847.844560236, 140243800.43434894, 48978851.06955835, 0, 0, 0, 0, 0 },
-  { 140243775.823792, 48978866.64662811, 140243752.99252215, 48978833.80255533, 140243798.65506187, 48978899.49070089, 140243774.6822285, 48978865.004424475, 140243776.96535552, 48978868.28883175, 0, 0, 0, 0, 0 },
-  { 140243751.95908463, 48978883.23597066, 140243730.03110626, 48978849.78206559, 140243773.887063, 48978916.68987573, 140243750.8626857, 48978881.563275404, 140243753.05548355, 48978884.90866592, 0, 0, 0, 0, 0 },
-  { 140243727.6572938, 48978899.165027164, 140243706.7084624, 48978865.08942793, 140243748.6061252, 48978933.240626395, 140243726.60985222, 48978897.461247206, 140243728.70473537, 48978900.86880712, 0, 0, 0, 0, 0 },
-  { 140243702.91863805, 48978914.3737378, 140243683.02901623, 48978879.669228815, 140243722.80825987, 48978949.07824678, 140243701.92415696, 48978912.63851235, 140243703.91311914, 48978916.10896324, 1, 4, 140243864.02457482, 48979195.480260566, 46 },
-  { 140243677.7433358, 48978928.802042805, 140243658.99691918, 48978893.466906406, 140243696.48975244, 48978964.1371792, 140243676.80601498, 48978927.03528599, 140243678.68065664, 48978930.56879962, 0, 0, 0, 0, 0 },
-  { 140243652.1316056, 48978942.389882386, 140243634.61584586, 48978906.428817876, 140243669.64736533, 48978978.350946896, 140243651.25581762, 48978940.59182916, 140243653.00739357, 48978944.18793561, 1, 2, 140243797.07451752, 48979239.967691176, 48 },
-  { 140243626.08366683, 48978955.07719973, 140243609.85416383, 48978918.51761504, 140243642.31316984, 48978991.63678441, 140243625.27219167, 48978953.24922049, 140243626.895142, 48978956.905178964, 0, 0, 0, 0, 0 },
-  { 140243599.6091301, 48978966.82975591, 140243584.6007927, 48978929.75213721, 140243614.61746752, 48979003.90737461, 140243598.85871324, 48978964.975874975, 140243600.359547, 48978968.683636844, 0, 0, 0, 0, 0 },
-  { 140243572.74983054, 48978977.701905854, 140243558.86605614, 48978940.188697405, 140243586.63360494, 48979015.2151143, 140243572.05564183, 48978975.826245435, 140243573.44401926, 48978979.57756627, 0, 0, 0, 0, 0 },
-  { 140243545.55451015, 48978987.766992494, 140243532.6941128, 48978949.89074426, 140243558.4149075, 48979025.64324073, 140243544.9114903, 48978985.873180084, 140243546.19753, 48978989.660804905, 0, 0, 0, 0, 0 },
-  { 140243518.07191083, 48978997.098358825, 140243506.1307065, 48978958.922350146, 140243530.01311517, 48979035.274367504, 140243517.47485062, 48978995.189558394, 140243518.66897103, 48978999.007159255, 0, 0, 0, 0, 0 },
-  { 140243490.35077468, 48979005.769347824, 140243479.2288811, 48978967.34665293, 140243501.47266826, 48979044.192042716, 140243489.79468, 48979003.84821308, 140243490.90686935, 48979007.69048257, 0, 0, 0, 0, 0 },
-  { 140243462.43875393, 48979013.848805174, 140243452.15935615, 48978975.1921889, 140243472.71815172, 48979052.505421445, 140243461.92478403, 48979011.91597436, 140243462.95272383, 48979015.781635985, 0, 0, 0, 0, 0 },
-  { 140243434.36155328, 48979021.31497117, 140243425.06542793, 48978982.410189286, 140243443.65767863, 48979060.21975306, 140243433.89674702, 48979019.369732074, 140243434.82635954, 48979023.26021027, 1, 4, 140243492.22993365, 48979263.49723839, 49 },
-  { 140243406.12452838, 48979028.06208324, 140243397.96098322, 48978988.903986625, 140243414.28807354, 48979067.22017985, 140243405.71635112, 48979026.10417841, 140243406.53270563, 48979030.01998807, 0, 0, 0, 0, 0 },
-  { 140243377.73226607, 48979033.98120432, 140243370.85422146, 48978994.57698498, 140243384.61031067, 48979073.38542367, 140243377.38836384, 48979032.010993354, 140243378.0761683, 48979035.95141529, 0, 0, 0, 0, 0 },
-  { 140243349.1893531, 48979038.9633974, 140243343.75201386, 48978999.33467875, 140243354.62669235, 48979078.59211605, 140243348.91748613, 48979036.98196147, 140243349.4612201, 48979040.94483333, 0, 0, 0, 0, 0 },
-  { 140243320.50037658, 48979042.899727, 140243316.62153506, 48979003.08823886, 140243324.3792181, 48979082.711215146, 140243320.3064345, 48979040.9091526, 140243320.69431865, 48979044.89030141, 0, 0, 0, 0, 0 },
-  { 140243291.67481467, 48979045.708207466, 140243289.33675376, 48979005.77659754, 140243294.0128756, 48979085.639817394, 140243291.55791163, 48979043.71162697, 140243291.7917177, 48979047.70478796, 1, 1, 140243284.2514713, 48978918.92534596, 41 },
-  { 140243262.73948953, 48979047.40241796, 140243261.8922494, 48979007.41139166, 140243263.58672965, 48979087.393444255, 140243262.69712752, 48979045.40286665, 140243262.78185153, 48979049.40196927, 1, 2, 140243268.35245532, 48979312.34296717, 33 },
-  { 140243233.72506598, 48979048.01711045, 140243234.316923, 48979008.021489374, 140243233.13320896, 48979088.01273153, 140243233.75465882, 48979046.017329395, 140243233.69547313, 48979050.01689151, 0, 0, 0, 0, 0 },
-  { 140243204.6622088, 48979047.587036975, 140243206.64060485, 48979007.63599257, 140243202.68381274, 48979087.53808138, 140243204.7611286, 48979045.58948475, 140243204.563289, 48979049.5845892, 0, 0, 0, 0, 0 },
-  { 140243175.58158284, 48979046.14694957, 140243178.89392105, 48979006.28433029, 140243172.26924464, 48979086.00956884, 140243175.74719974, 48979044.1538186, 140243175.41596594, 48979048.140080534, 0, 0, 0, 0, 0 },
-  { 140243146.51385283, 48979043.73160018, 140243151.10816187, 48979003.996322095, 140243141.9195438, 48979083.466878265, 140243146.74356827, 48979041.74483628, 140243146.2841374, 48979045.71836408, 0, 0, 0, 0, 0 },
-  { 140243117.48968372, 48979040.37574089, 140243123.31516013, 48979000.802216604, 140243111.6642073, 48979079.94926518, 140243117.78095755, 48979038.39706468, 140243117.1984099, 48979042.35441711, 0, 0, 0, 0, 0 },
-  { 140243088.53974018, 48979036.114123665, 140243095.54717946, 48978996.73270933, 140243081.5323009, 48979075.495538, 140243088.89011213, 48979034.14505295, 140243088.18936822, 48979038.08319438, 0, 0, 0, 0, 0 },
-  { 140243059.69468704, 48979030.98150052, 140243067.8368174, 48978991.81894554, 140243051.55255666, 48979070.1440555, 140243060.10179356, 48979029.02337277, 140243059.28758052, 48979032.93962827, 0, 0, 0, 0, 0 },
-  { 140243030.98518914, 48979025.01262348, 140243040.21692166, 48978986.09251153, 140243021.75345662, 48979063.932735436, 140243031.44677576, 48979023.066617884, 140243030.52360252, 48979026.95862908, 0, 0, 0, 0, 0 },
-  { 140243002.44191128, 48979018.24224454, 140243012.7205198, 48978979.58541841, 140242992.16330275, 48979056.89907067, 140243002.95584172, 48979016.30940323, 140243001.92798084, 48979020.17508585, 0, 0, 0, 0, 0 },
-  { 140242974.0955182, 48979010.70511573, 140242985.3811767, 48978972.33020319, 140242962.8098597, 48979049.080028266, 140242974.65980113, 48979008.7863701, 140242973.53123528, 48979012.62386136, 0, 0, 0, 0, 0 },
-  { 140242945.9768254, 48979002.435703665, 140242958.3227008, 48978964.38863597, 140242933.63094997, 48979040.48277136, 140242946.59411916, 48979000.53335028, 140242945.3595316, 48979004.33805705, 0, 0, 0, 0, 0 },
-  { 140242918.14957947, 48978993.40605349, 140242931.8134052, 48978955.81217278, 140242904.48575374, 48979030.999934204, 140242918.83277076, 48978991.526359454, 140242917.46638817, 48978995.28574753, 0, 0, 0, 0, 0 },
-  { 140242890.75150585, 48978983.4479833, 140242906.01663586, 48978946.47534739, 140242875.48637584, 48979020.42061921, 140242891.51476234, 48978981.59935151, 140242889.98824936, 48978985.296615094, 0, 0, 0, 0, 0 },
-  { 140242863.9304186, 48978972.3741885, 140242881.07131788, 48978936.232943736, 140242846.78951934, 48979008.51543326, 140242864.78746358, 48978970.56712626, 140242863.07337365, 48978974.181250736, 1, 5, 140242744.3726463, 48979224.45937069, 49 },
-  { 140242837.8341315, 48978959.997364424, 140242857.10355276, 48978924.94469826, 140242818.56471026, 48978995.05003059, 140242838.79760256, 48978958.24473111, 140242836.87066045, 48978961.749997735, 1, 5, 140242959.23148528, 48978739.165567584, 28 },
-  { 140242812.60995552, 48978946.1309364, 140242833.98150268, 48978912.31885317, 140242791.23840836, 48978979.94301963, 140242813.67853287, 48978944.440332234, 140242811.54137817, 48978947.821540564, 1, 5, 140242724.45232353, 48979085.60577973, 36 },
-  { 140242788.28827867, 48978930.75797461, 140242811.1819953, 48978897.95739932, 140242765.39456204, 48978963.558549896, 140242789.4329645, 48978929.11794584, 140242787.14359283, 48978932.39800338, 0, 0, 0, 0, 0 },
-  { 140242764.6333862, 48978914.24764208, 140242788.43801576, 48978882.102041885, 140242740.82875663, 48978946.39324227, 140242765.82361767, 48978912.64036207, 140242763.44315472, 48978915.854922086, 1, 0, 140242556.93799335, 48979194.71800377, 33 },
-  { 140242741.37273252, 48978897.022540025, 140242765.51631558, 48978865.13073235, 140242717.22914946, 48978928.9143477, 140242742.57991168, 48978895.427949645, 140242740.16555336, 48978898.617130406, 0, 0, 0, 0, 0 },
-  { 140242718.233772, 48978879.505269736, 140242742.16278782, 48978847.45215442, 140242694.3047562, 48978911.55838505, 140242719.4302228, 48978877.90261397, 140242717.0373212, 48978881.107925504, 1, 3, 140242617.73190552, 48979014.128354065, 31 },
-  { 140242694.94395915, 48978862.11843245, 140242718.09847957, 48978829.50144018, 140242671.78943872, 48978894.73542471, 140242696.10168517, 48978860.48758283, 140242693.78623313, 48978863.74928206, 0, 0, 0, 0, 0 },
-  { 140242671.23074836, 48978845.28462941, 140242693.0227634, 48978811.74199863, 140242649.4387333, 48978878.827260196, 140242672.3203491, 48978843.60749787, 140242670.1411476, 48978846.96176095, 1, 0, 140242494.17062607, 48979117.81850456, 33 },
-  { 140242646.82159403, 48978829.42646188, 140242666.62421036, 48978794.67223356, 140242627.0189777, 48978864.18069021, 140242647.81172484, 48978827.68875047, 140242645.83146322, 48978831.1641733, 0, 0, 0, 0, 0 },
-  { 140242621.44395062, 48978814.966531105, 140242638.59138015, 48978778.82838422, 140242604.2965211, 48978851.10467799, 140242622.3013221, 48978813.159623764, 140242620.58657914, 48978816.773438446, 1, 0, 140242488.55137172, 48979095.037169464, 38 },
-  { 140242594.86072353, 48978802.35287897, 140242608.52771574, 48978764.76014931, 140242581.1937313, 48978839.94560864, 140242595.54407313, 48978800.47324249, 140242594.17737392, 48978804.232515454, 0, 0, 0, 0, 0 },
-  { 140242567.20309722, 48978792.29783464, 140242576.29859337, 48978753.34565948, 140242558.10760108, 48978831.250009805, 140242567.65787202, 48978790.35022588, 140242566.74832243, 48978794.2454434, 1, 2, 140242524.45426536, 48978975.37305791, 47 },
-  { 140242538.82057023, 48978785.67039564, 140242542.04953143, 48978745.800936036, 140242535.59160903, 48978825.53985525, 140242538.9820183, 48978783.676922664, 140242538.65912217, 48978787.66386862, 0, 0, 0, 0, 0 },
-  { 140242510.06550518, 48978783.34157077, 140242506.56713018, 48978743.49484729, 140242513.56388018, 48978823.188294254, 140242509.89058644, 48978781.349234596, 140242510.24042392, 48978785.33390695, 0, 0, 0, 0, 0 },
-  { 140242481.299969, 48978785.86706405, 140242471.8978878, 48978746.98775247, 140242490.70205018, 48978824.746375635, 140242480.82986492, 48978783.923098475, 140242481.77007306, 48978787.81102963, 0, 0, 0, 0, 0 },
-  { 140242452.91902906, 48978792.73035177, 140242438.74464446, 48978755.32598275, 140242467.09341365, 48978830.13472079, 140242452.21030983, 48978790.86013332, 140242453.62774828, 48978794.60057022, 1, 5, 140242525.9171097, 48978985.3628522, 42 },
-  { 140242425.3247611, 48978803.18719884, 140242407.32439017, 48978767.46624355, 140242443.325132, 48978838.90815413, 140242424.42474255, 48978801.401151076, 140242426.22477964, 48978804.973246604, 0, 0, 0, 0, 0 },
-  { 140242398.91924098, 48978816.49337032, 140242377.80705243, 48978782.51874015, 140242420.03142953, 48978850.46800049, 140242397.86363155, 48978814.794638805, 140242399.97485042, 48978818.19210183, 1, 5, 140242496.03530827, 48978972.77666909, 49 },
-  { 140242374.0004286, 48978831.97817951, 140242350.33111644, 48978799.73281297, 140242397.66974074, 48978864.22354604, 140242372.816963, 48978830.36591118, 140242375.1838942, 48978833.590447836, 0, 0, 0, 0, 0 },
-  { 140242350.4526358, 48978849.263145305, 140242324.7512395, 48978818.612888716, 140242376.15403208, 48978879.913401894, 140242349.16756597, 48978847.73063248, 140242351.73770562, 48978850.795658134, 1, 1, 140242557.34887588, 48979095.99771086, 27 },
-  { 140242328.05746084, 48978868.04234425, 140242300.81050426, 48978838.75747858, 140242355.30441743, 48978897.32720992, 140242326.695113, 48978866.578100964, 140242329.4198087, 48978869.506587535, 1, 1, 140242079.42898208, 48978600.81794502, 34 },
-  { 140242306.59650213, 48978888.00985296, 140242278.24109113, 48978859.79690083, 140242334.95191312, 48978916.22280509, 140242305.1787316, 48978886.59920535, 140242308.01427266, 48978889.42050057, 0, 0, 0, 0, 0 },
-  { 140242285.85135794, 48978908.85974795, 140242256.77877572, 48978881.3863979, 140242314.92394015, 48978936.33309801, 140242284.39772883, 48978907.48608045, 140242287.30498704, 48978910.233415455, 0, 0, 0, 0, 0 },
-  { 140242265.6036267, 48978930.28610586, 140242236.17150635, 48978903.19828034, 140242295.03574705, 48978957.37393137, 140242264.13202068, 48978928.93171458, 140242267.0752327, 48978931.64049713, 1, 2, 140242457.64821202, 48979107.03416736, 30 },
-  { 140242245.6349067, 48978951.98300322, 140242216.18379474, 48978924.915827475, 140242275.08601868, 48978979.05017897, 140242244.1623511, 48978950.62964443, 140242247.10746232, 48978953.33636201, 0, 0, 0, 0, 0 },
-  { 140242225.72679627, 48978973.64451662, 140242196.59867805, 48978946.23005459, 140242254.8549145, 48979001.05897865, 140242224.27039036, 48978972.27379352, 140242227.18320218, 48978975.015239716, 0, 0, 0, 0, 0 },
-  { 140242205.66089386, 48978994.96472262, 140242177.21824256, 48978966.83972331, 140242234.10354516, 48979023.089721926, 140242204.2387613, 48978993.558472656, 140242207.0830264, 48978996.37097258, 0, 0, 0, 0, 0 },
-  { 140242185.2187977, 48979015.6376978, 140242157.8626863, 48978986.45477182, 140242212.57490912, 48979044.820623785, 140242183.85099214, 48979014.1785515, 140242186.58660328, 48979017.0968441, 0, 0, 0, 0, 0 },
-  { 140242164.18210626, 48979035.35751874, 140242138.36679697, 48979004.80314415, 140242189.99741554, 48979065.91189333, 140242162.8913408, 48979033.82980001, 140242165.47287172, 48979036.88523747, 1, 2, 140241987.99262038, 48978826.823912166, 30 },
-  { 140242142.33241782, 48979053.818262, 140242118.57166192, 48979021.64021856, 140242166.0931737, 48979085.99630544, 140242141.14438003, 48979052.20935983, 140242143.5204556, 48979055.427164175, 0, 0, 0, 0, 0 },
-  { 140242119.4513307, 48979070.71400418, 140242098.30906814, 48979036.75808078, 140242140.59359324, 48979104.66992758, 140242118.39421755, 48979069.01620801, 140242120.50844383, 48979072.411800355, 1, 0, 140242061.31010866, 48978977.33521482, 26 },
-  { 140242095.3204433, 48979085.73882182, 140242077.24325696, 48979050.05667876, 140242113.39762965, 48979121.42096488, 140242094.41658399, 48979083.95471466, 140242096.22430262, 48979087.522928976, 0, 0, 0, 0, 0 },
-  { 140242069.79162544, 48979098.672159284, 140242054.48665452, 48979061.71599788, 140242085.09659636, 48979135.62832069, 140242069.0263769, 48979096.824351214, 140242070.55687398, 48979100.519967355, 1, 3, 140241935.49050573, 48978774.38184299, 42 },
-  { 140242043.07982963, 48979109.73454353, 140242029.97950038, 48979071.940610506, 140242056.18015888, 48979147.52847656, 140242042.42481318, 48979107.84484688, 140242043.7348461, 48979111.62424018, 0, 0, 0, 0, 0 },
-  { 140242015.51692834, 48979119.28853945, 140242004.04352346, 48979080.96934086, 140242026.99033323, 48979157.60773803, 140242014.9432581, 48979117.372579515, 140242016.09059858, 48979121.20449938, 0, 0, 0, 0, 0 },
-  { 140241987.43485054, 48979127.69678024, 140241977.03772458, 48979089.07166184, 140241997.8319765, 48979166.32189865, 140241986.91499424, 48979125.76552432, 140241987.95470685, 48979129.628036164, 0, 0, 0, 0, 0 },
-  { 140241959.15513816, 48979135.309125364, 140241949.62928605, 48979096.45995367, 140241968.68099028, 48979174.158297054, 140241958.67884555, 48979133.36666678, 140241959.63143077, 48979137.25158395, 1, 0, 140241886.9968083, 48978841.02664979, 40 },
-  { 140241930.8213804, 48979142.25658846, 140241922.24908805, 48979103.185937025, 140241939.39367276, 48979181.32723989, 140241930.3927658, 48979140.30305589, 140241931.24999502, 48979144.21012103, 1, 4, 140241981.18359804, 48979371.796665646, 33 },
-  { 140241902.42765263, 48979148.48631146, 140241894.90102333, 48979109.20081984, 140241909.95428193, 48979187.77180307, 140241902.05132115, 48979146.52203688, 140241902.8039841, 48979150.450586036, 0, 0, 0, 0, 0 },
-  { 140241873.9633852, 48979153.93972391, 140241867.57462224, 48979114.45322358, 140241880.35214815, 48979193.42622424, 140241873.64394704, 48979151.96539889, 140241874.28282335, 48979155.914048925, 0, 0, 0, 0, 0 },
-  { 140241845.41800848, 48979158.55825539, 140241840.25831702, 48979118.89243151, 140241850.57769993, 48979198.224079266, 140241845.1600239, 48979156.574964195, 140241845.67599306, 48979160.54154658, 1, 0, 140241823.48931974, 48978989.978503905, 33 },
-  { 140241816.7809529, 48979162.28333549, 140241812.93620354, 48979122.468540475, 140241820.62570226, 48979202.09813051, 140241816.58871543, 48979160.292595744, 140241816.97319037, 48979164.27407524, 0, 0, 0, 0, 0 },
-  { 140241788.04183495, 48979165.058552735, 140241785.43609548, 48979125.14351645, 140241790.64757442, 48979204.97358902, 140241787.911548, 48979163.06280092, 140241788.1721219, 48979167.05430455, 0, 0, 0, 0, 0 },
-  { 140241759.20009604, 48979166.94140353, 140241757.52017695, 48979126.9766957, 140241760.88001513, 48979206.90611136, 140241759.11610007, 48979164.94316814, 140241759.284092, 48979168.93963892, 0, 0, 0, 0, 0 },
-  { 140241730.2696773, 48979168.15749556, 140241729.18269995, 48979128.17226728, 140241731.35665467, 48979208.142723836, 140241730.21532845, 48979166.15823414, 140241730.32402617, 48979170.156756975, 1, 4, 140241722.49778926, 48978882.26311339, 36 },
-  { 140241701.26568574, 48979168.94595378, 140241700.4401237, 48979128.95447409, 140241702.09124777, 48979208.93743347, 140241701.22440764, 48979166.946379796, 140241701.30696383, 48979170.94552776, 0, 0, 0, 0, 0 },
-  { 140241672.20322835, 48979169.54590311, 140241671.3351646, 48979129.5553234, 140241673.0712921, 48979209.53648282, 140241672.15982518, 48979167.54637413, 140241672.24663153, 48979171.54543209, 0, 0, 0, 0, 0 },
-  { 140241643.09751672, 48979170.177692235, 140241642.13256788, 48979130.18933301, 140241644.06246555, 48979210.16605146, 140241643.0492693, 48979168.178274274, 140241643.14576414, 48979172.177110195, 1, 4, 140241649.8762822, 48979451.09591582, 30 },
-  { 140241613.96477002, 48979170.88068706, 140241612.98730016, 48979130.89263193, 140241614.94223988, 48979210.86874218, 140241613.91589653, 48979168.881284304, 140241614.0136435, 48979172.88008981, 1, 4, 140241608.5153755, 48978947.94727974, 48 },
-  { 140241584.8217706, 48979171.59305988, 140241583.91754618, 48979131.60328146, 140241585.72599503, 48979211.582838304, 140241584.77655938, 48979169.59357096, 140241584.86698183, 48979173.5925488, 0, 0, 0, 0, 0 },
-  { 140241555.6853072, 48979172.25187579, 140241554.94031042, 48979132.25881414, 140241556.430304, 48979212.244937435, 140241555.64805737, 48979170.25222271, 140241555.72255704, 48979174.25152887, 0, 0, 0, 0, 0 },
-  { 140241526.5721684, 48979172.794199735, 140241526.07291687, 48979132.79731551, 140241527.07141995, 48979212.79108396, 140241526.54720584, 48979170.79435553, 140241526.59713098, 48979174.79404394, 0, 0, 0, 0, 0 },
-  { 140241497.49914294, 48979173.15709683, 140241497.3329813, 48979133.15744196, 140241497.6653046, 48979213.15675171, 140241497.49083486, 48979171.15711409, 140241497.50745103, 48979175.15707958, 0, 0, 0, 0, 0 },
-  { 140241468.48301932, 48979173.27763206, 140241468.73836458, 48979133.278447084, 140241468.22767407, 48979213.27681703, 140241468.49578658, 48979171.27767281, 140241468.47025207, 48979175.2775913, 0, 0, 0, 0, 0 },
-  { 140241439.54058632, 48979173.092870474, 140241440.3071089, 48979133.10021561, 140241438.77406374, 48979213.08552534, 140241439.57891244, 48979171.09323773, 140241439.5022602, 48979175.09250322, 0, 0, 0, 0, 0 },
-  { 140241410.68863246, 48979172.53987708, 140241412.0573499, 48979132.56330128, 140241409.31991503, 48979212.51645288, 140241410.75706834, 48979170.54104829, 140241410.62019658, 48979174.53870587, 0, 0, 0, 0, 0 },
-  { 140241381.94394648, 48979171.55571693, 140241384.00720507, 48979131.60896532, 140241379.8806879, 48979211.50246854, 140241382.04710943, 48979169.55837935, 140241381.84078354, 48979173.55305451, 0, 0, 0, 0, 0 },
-  { 140241353.32331693, 48979170.07745506, 140241356.15236527, 48979130.17762441, 140241350.4942686, 48979209.977285706, 140241353.46476936, 48979168.082463525, 140241353.1818645, 48979172.07244659, 0, 0, 0, 0, 0 },
-  { 140241324.8370377, 48979168.05767052, 140241328.33640993, 48979128.211034596, 140241321.3376655, 48979207.90430644, 140241325.0120063, 48979166.06533872, 140241324.6620691, 48979170.050002314, 0, 0, 0, 0, 0 },
-  { 140241296.44705305, 48979165.56443311, 140241300.44273162, 48979125.76450154, 140241292.45137447, 48979205.36436468, 140241296.64683697, 48979163.57443654, 140241296.24726912, 48979167.55442969, 0, 0, 0, 0, 0 },
-  { 140241268.0934998, 48979162.71790347, 140241272.40886176, 48979122.95136413, 140241263.77813786, 48979202.484442815, 140241268.3092679, 48979160.729576506, 140241267.8777317, 48979164.70623044, 1, 0, 140241289.23877332, 48978967.86186069, 48 },
-  { 140241239.716409, 48979159.63849501, 140241244.1744854, 48979119.88770188, 140241235.2583326, 48979199.38928815, 140241239.93931282, 48979157.65095536, 140241239.49350518, 48979161.62603467, 0, 0, 0, 0, 0 },
-  { 140241211.25581157, 48979156.446621165, 140241215.68089166, 48979116.69214134, 140241206.83073148, 48979196.20110099, 140241211.47706556, 48979154.45889717, 140241211.03455758, 48979158.434345156, 1, 2, 140241255.39598554, 48978759.89568491, 43 },
-  { 140241182.6517386, 48979153.262695365, 140241186.8708036, 48979113.48582406, 140241178.43267363, 48979193.039566666, 140241182.86269185, 48979151.2738518, 140241182.44078538, 48979155.25153893, 0, 0, 0, 0, 0 },
-  { 140241153.84422114, 48979150.20713105, 140241157.68833324, 48979110.3922745, 140241150.00010905, 48979190.0219876, 140241154.03642675, 48979148.216388226, 140241153.65201554, 48979152.197873875, 0, 0, 0, 0, 0 },
-  { 140241124.7732901, 48979147.40034163, 140241128.07904837, 48979107.53717615, 140241121.46753183, 48979187.26350711, 140241124.938578, 48979145.40718336, 140241124.6080022, 48979149.3934999, 0, 0, 0, 0, 0 },
-  { 140241095.37897652, 48979144.96274055, 140241097.99012065, 48979105.04805746, 140241092.7678324, 48979184.87742364, 140241095.50953373, 48979142.96700639, 140241095.2484193, 48979146.9584747, 1, 2, 140241119.66261688, 48978773.75618779, 33 },
-  { 140241065.60131133, 48979143.01474123, 140241067.3390094, 48979103.05250399, 140241063.86361325, 48979182.976978466, 140241065.68819624, 48979141.01662937, 140241065.5144264, 48979145.012853086, 0, 0, 0, 0, 0 },
-  { 140241035.39555824, 48979141.70128926, 140241034.73673323, 48979101.706715256, 140241036.05438325, 48979181.69586326, 140241035.362617, 48979139.70156056, 140241035.4284995, 48979143.70101796, 1, 3, 140241030.2896645, 48978831.74334074, 34 },
-  { 140241005.35578722, 48979142.19613019, 140240998.61588183, 48979102.76804787, 140241012.0956926, 48979181.6242125, 140241005.01879194, 48979140.22472607, 140241005.6927825, 48979144.1675343, 1, 0, 140241032.98939934, 48979303.85126769, 44 },
-  { 140240976.93393758, 48979147.05461091, 140240960.01203147, 48979110.81031351, 140240993.8558437, 48979183.29890831, 140240976.0878423, 48979145.24239604, 140240977.78003287, 48979148.866825774, 0, 0, 0, 0, 0 },
-  { 140240951.62255374, 48979158.87210749, 140240924.97932708, 48979129.03691898, 140240978.2657804, 48979188.707296, 140240950.2903924, 48979157.380348064, 140240952.95471507, 48979160.36386692, 0, 0, 0, 0, 0 },
-  { 140240930.1555832, 48979178.04240237, 140240898.04227576, 48979154.19422666, 140240962.26889065, 48979201.89057808, 140240928.54991782, 48979176.84999359, 140240931.7612486, 48979179.23481116, 0, 0, 0, 0, 0 },
-  { 140240912.2843042, 48979202.1073826, 140240877.29353908, 48979182.725784205, 140240947.27506933, 48979221.488981, 140240910.53476596, 48979201.138302684, 140240914.03384244, 48979203.07646252, 0, 0, 0, 0, 0 },
-  { 140240897.69960922, 48979228.43800952, 140240860.80105746, 48979212.99466541, 140240934.59816098, 48979243.88135364, 140240895.85468164, 48979227.66584232, 140240899.5445368, 48979229.21017673, 1, 0, 140240751.02786595, 48979167.05071666, 27 },
-  { 140240886.3792752, 48979255.48551475, 140240847.8037871, 48979244.905736, 140240924.9547633, 48979266.065293506, 140240884.4505008, 48979254.95652582, 140240888.30804962, 48979256.01450369, 1, 1, 140241003.07012668, 48979287.48934548, 45 },
-  { 140240878.7380544, 48979283.34657207, 140240839.02978218, 48979278.52442339, 140240918.4463266, 48979288.16872075, 140240876.75264078, 48979283.10546464, 140240880.723468, 48979283.587679505, 0, 0, 0, 0, 0 },
-  { 140240875.22744882, 48979312.25486398, 140240835.25437635, 48979313.72233679, 140240915.2005213, 48979310.78739116, 140240873.2287952, 48979312.328237616, 140240877.22610244, 48979312.18149034, 1, 3, 140241178.02347288, 48979301.13875739, 40 },
-  { 140240876.31762156, 48979341.95051039, 140240837.20557907, 48979350.33192623, 140240915.42966405, 48979333.56909455, 140240874.36201942, 48979342.369581185, 140240878.2732237, 48979341.531439595, 0, 0, 0, 0, 0 },
-  { 140240882.52604938, 48979370.92226138, 140240846.00195116, 48979387.23146886, 140240919.0501476, 48979354.6130539, 140240880.69984445, 48979371.737721756, 140240884.3522543, 48979370.106801, 0, 0, 0, 0, 0 },
-  { 140240894.37759477, 48979397.46352703, 140240862.94631293, 48979422.20366693, 140240925.8088766, 48979372.72338713, 140240892.8060307, 48979398.70053402, 140240895.94915885, 48979396.22652004, 0, 0, 0, 0, 0 },
-  { 140240912.1769465, 48979420.07683652, 140240886.76733527, 48979450.969419084, 140240937.58655772, 48979389.18425395, 140240910.90646592, 48979421.621465646, 140240913.44742706, 48979418.53220739, 1, 5, 140240985.22957873, 48979331.26066164, 36 },
-  { 140240934.76453152, 48979438.65546305, 140240914.54890057, 48979473.17108655, 140240954.98016247, 48979404.139839545, 140240933.75374997, 48979440.38124422, 140240935.77531308, 48979436.929681875, 1, 3, 140240761.4154962, 48979734.626934566, 40 },
-  { 140240960.3832405, 48979453.6602149, 140240944.27887607, 48979490.27509502, 140240976.48760492, 48979417.04533478, 140240959.57802227, 48979455.49095891, 140240961.1884587, 48979451.829470895, 1, 0, 140241007.48850644, 48979346.56169054, 28 },
-  { 140240987.3892864, 48979465.53831483, 140240974.94199437, 48979503.55232436, 140240999.83657843, 48979427.52430529, 140240986.7669218, 48979467.43901531, 140240988.011651, 48979463.63761435, 1, 1, 140240898.0799661, 48979738.28883326, 44 },
-  { 140241015.0948357, 48979474.61020877, 140241006.07709876, 48979513.58045923, 140241024.11257264, 48979435.639958315, 140241014.64394885, 48979476.5587213, 140241015.54572254, 48979472.66169625, 0, 0, 0, 0, 0 },
-  { 140241043.2855318, 48979481.133551024, 140241037.40308335, 48979520.69864676, 140241049.16798022, 48979441.56845529, 140241042.99140936, 48979483.11180581, 140241043.57965422, 48979479.15529624, 1, 3, 140241021.3734114, 48979628.51353263, 26 },
-  { 140241071.7512856, 48979485.36577455, 140241068.66068253, 48979525.246197976, 140241074.8418887, 48979445.48535112, 140241071.59675545, 48979487.35979572, 140241071.90581578, 48979483.37175338, 0, 0, 0, 0, 0 },
-  { 140241100.350961, 48979487.58215636, 140241099.64582604, 48979527.57594068, 140241101.05609596, 48979447.58837204, 140241100.31570426, 48979489.581845574, 140241100.38621774, 48979485.582467146, 0, 0, 0, 0, 0 },
-  { 140241129.0607726, 48979488.08834232, 140241130.30346572, 48979528.06903408, 140241127.81807947, 48979448.107650556, 140241129.12290725, 48979490.08737691, 140241128.99863794, 48979486.089307725, 0, 0, 0, 0, 0 },
-  { 140241157.8683615, 48979487.19293528, 140241160.61463866, 48979527.09854844, 140241155.12208435, 48979447.28732212, 140241158.00567535, 48979489.18821594, 140241157.73104766, 48979485.19765462, 1, 3, 140241168.7161562, 48979644.820107274, 40 },
-  { 140241186.76136902, 48979485.20453817, 140241190.57295585, 48979525.022521615, 140241182.9497822, 48979445.38655472, 140241186.95194837, 48979487.19543734, 140241186.57078966, 48979483.21363899, 0, 0, 0, 0, 0 },
-  { 140241215.7274363, 48979482.43175384, 140241220.17631352, 48979522.18357759, 140241211.2785591, 48979442.67993008, 140241215.94988015, 48979484.41934502, 140241215.50499246, 48979480.44416265, 0, 0, 0, 0, 0 },
-  { 140241244.75420457, 48979479.18318519, 140241249.4213165, 48979518.90997799, 140241240.08709264, 48979439.45639239, 140241244.98756018, 48979481.16952483, 140241244.52084896, 48979477.19684555, 0, 0, 0, 0, 0 },
-  { 140241273.82931504, 48979475.767435126, 140241278.30020326, 48979515.51678932, 140241269.3584268, 48979436.018080935, 140241274.05285946, 48979477.75490283, 140241273.60577062, 48979473.77996742, 0, 0, 0, 0, 0 },
-  { 140241302.94040895, 48979472.49310653, 140241306.79989597, 48979512.30647564, 140241299.08092192, 48979432.67973742, 140241303.1333833, 48979474.48377498, 140241302.7474346, 48979470.502438076, 0, 0, 0, 0, 0 },
-  { 140241332.07512745, 48979469.66880226, 140241334.90300643, 48979509.5687158, 140241329.24724847, 48979429.76888872, 140241332.2165214, 48979471.66379794, 140241331.9337335, 48979467.673806585, 1, 0, 140241340.98294628, 48979595.35352991, 25 },
-  { 140241361.22110635, 48979467.60310101, 140241362.63402987, 48979507.578138806, 140241359.80818284, 48979427.62806321, 140241361.29175252, 48979469.6018529, 140241361.15046018, 48979465.604349114, 0, 0, 0, 0, 0 },
-  { 140241390.35898605, 48979466.57321842, 140241390.09744832, 48979506.572363384, 140241390.62052378, 48979426.574073456, 140241390.34590918, 48979468.57317567, 140241390.37206292, 48979464.57326117, 1, 3, 140241389.31283516, 48979626.56979828, 45 },
-  { 140241419.44867527, 48979466.76342376, 140241417.2759475, 48979506.70437085, 140241421.62140304, 48979426.82247668, 140241419.3400389, 48979468.76047112, 140241419.55731165, 48979464.766376406, 0, 0, 0, 0, 0 },
-  { 140241448.44626048, 48979468.340849005, 140241444.13117844, 48979508.10741872, 140241452.76134253, 48979428.574279286, 140241448.2305064, 48979470.32917749, 140241448.66201457, 48979466.35252052, 0, 0, 0, 0, 0 },
-  { 140241477.30782798, 48979471.47262609, 140241470.63423702, 48979510.91198693, 140241483.98141894, 48979432.03326525, 140241476.97414842, 48979473.44459413, 140241477.64150754, 48979469.50065805, 1, 2, 140241541.0406215, 48979094.82673001, 35 },
-  { 140241505.98946416, 48979476.32588698, 140241496.76838255, 48979515.248523764, 140241515.21054578, 48979437.403250195, 140241505.52841008, 48979478.27201882, 140241506.45051825, 48979474.37975514, 0, 0, 0, 0, 0 },
-  { 140241534.44725537, 48979483.067763604, 140241522.52539575, 48979521.2498178, 140241546.369115, 48979444.885709405, 140241533.8511624, 48979484.97686631, 140241535.04334834, 48979481.158660896, 0, 0, 0, 0, 0 },
-  { 140241562.63308036, 48979491.8684281, 140241546.87301028, 48979528.63281564, 140241578.39315045, 48979455.10404057, 140241561.84507686, 48979493.70664748, 140241563.42108387, 48979490.03020873, 0, 0, 0, 0, 0 },
-  { 140241589.70331305, 48979503.47283098, 140241566.73345292, 48979536.22012896, 140241612.6731732, 48979470.725533, 140241588.55482003, 48979505.11019588, 140241590.85180607, 48979501.83546608, 1, 3, 140241716.03754383, 48979323.362692095, 44 },
-  { 140241613.0860948, 48979519.87416054, 140241581.87411982, 48979544.890407644, 140241644.29806978, 48979494.85791344, 140241611.52549604, 48979521.124972895, 140241614.64669356, 48979518.62334819, 0, 0, 0, 0, 0 },
-  { 140241630.9734563, 48979542.19165193, 140241595.2237189, 48979560.13479203, 140241666.72319368, 48979524.248511836, 140241629.1859694, 48979543.08880894, 140241632.76094317, 48979541.29449493, 0, 0, 0, 0, 0 },
-  { 140241644.27648094, 48979568.69646854, 140241606.48025146, 48979581.79017076, 140241682.07271042, 48979555.60276632, 140241642.38666946, 48979569.35115365, 140241646.16629243, 48979568.04178343, 1, 5, 140241487.42212865, 48979623.03533276, 36 },
-  { 140241654.15683752, 48979597.217067085, 140241614.7756233, 48979604.22563082, 140241693.53805175, 48979590.20850335, 140241652.1877768, 48979597.56749527, 140241656.12589824, 48979596.8666389, 1, 5, 140241901.27395684, 48979553.23832964, 50 },
-  { 140241659.29136118, 48979626.06802484, 140241619.45299894, 48979622.47568664, 140241699.12972343, 48979629.66036303, 140241657.29944307, 48979625.88840792, 140241661.2832793, 48979626.24764175, 0, 0, 0, 0, 0 },
-  { 140241656.78243503, 48979653.891549096, 140241619.86813098, 48979638.48589568, 140241693.69673908, 48979669.29720251, 140241654.93671983, 48979653.121266425, 140241658.62815022, 48979654.66183177, 0, 0, 0, 0, 0 },
-  { 140241645.9014755, 48979679.96399392, 140241612.8419567, 48979657.44581864, 140241678.96099427, 48979702.4821692, 140241644.24849954, 48979678.83808516, 140241647.55445144, 48979681.089902684, 0, 0, 0, 0, 0 },
-  { 140241629.19041458, 48979704.49793707, 140241598.67497954, 48979678.636610255, 140241659.70584962, 48979730.35926388, 140241627.66464284, 48979703.20487073, 140241630.7161863, 48979705.791003406, 0, 0, 0, 0, 0 },
-  { 140241609.45741394, 48979727.78216774, 140241579.82841057, 48979700.909837, 140241639.08641732, 48979754.65449848, 140241607.97596377, 48979726.4385512, 140241610.9388641, 48979729.12578428, 0, 0, 0, 0, 0 },
-  { 140241589.2470671, 48979750.0657739, 140241560.2761538, 48979722.485233955, 140241618.21798038, 48979777.64631384, 140241587.79852143, 48979748.6867469, 140241590.69561276, 48979751.44480089, 0, 0, 0, 0, 0 },
-  { 140241569.04379532, 48979771.28752068, 140241541.270949, 48979742.500909075, 140241596.81664163, 48979800.07413228, 140241567.655153, 48979769.8481901, 140241570.43243763, 48979772.726851255, 0, 0, 0, 0, 0 },
-  { 140241548.3628203, 48979791.24018301, 140241522.3967457, 48979760.81382977, 140241574.32889488, 48979821.66653625, 140241547.06451657, 48979789.71886535, 140241549.66112402, 48979792.76150067, 0, 0, 0, 0, 0 },
-  { 140241526.71371934, 48979809.715685666, 140241503.15518877, 48979777.389293395, 140241550.2722499, 48979842.042077936, 140241525.5357928, 48979808.099366054, 140241527.89164588, 48979811.33200528, 0, 0, 0, 0, 0 },
-  { 140241503.6455763, 48979826.5270746, 140241482.54023582, 48979792.54818993, 140241524.75091678, 48979860.505959265, 140241502.59030926, 48979824.828130364, 140241504.70084333, 48979828.22601883, 1, 4, 140241662.9908969, 48980083.067653835, 35 },
-  { 140241479.16562295, 48979841.73233385, 140241460.16335505, 48979806.5341263, 140241498.16789085, 48979876.930541396, 140241478.21550956, 48979839.97242347, 140241480.11573634, 48979843.49224422, 1, 2, 140241425.48421615, 48979742.29739752, 50 },
-  { 140241453.5761425, 48979855.54718968, 140241436.29499337, 48979819.472795926, 140241470.8572916, 48979891.62158344, 140241452.71208504, 48979853.74347, 140241454.44019994, 48979857.35090937, 0, 0, 0, 0, 0 },
-  { 140241427.1843116, 48979868.18998469, 140241411.2363287, 48979831.50672091, 140241443.1322945, 48979904.873248465, 140241426.38691247, 48979866.3558215, 140241427.98171073, 48979870.024147876, 1, 2, 140241343.85610092, 48979676.51993146, 45 },
-  { 140241400.2973072, 48979879.87906146, 140241385.32586172, 48979842.786530934, 140241415.26875266, 48979916.97159199, 140241399.54873493, 48979878.02443493, 140241401.04587945, 48979881.73368799, 0, 0, 0, 0, 0 },
-  { 140241373.19359046, 48979890.818779275, 140241359.0400421, 48979853.40652101, 140241387.34713882, 48979928.23103754, 140241372.48591304, 48979888.94816636, 140241373.9012679, 48979892.68939219, 0, 0, 0, 0, 0 },
-  { 140241345.96163997, 48979901.12098358, 140241332.54300734, 48979863.438888386, 140241359.3802726, 48979938.80307877, 140241345.29070833, 48979899.23687882, 140241346.6325716, 48979903.00508834, 0, 0, 0, 0, 0 },
-  { 140241318.6127703, 48979910.85994404, 140241305.84156004, 48979872.95353048, 140241331.38398054, 48979948.76635759, 140241317.9742098, 48979908.96462336, 140241319.2513308, 48979912.755264714, 1, 5, 140241231.7685406, 48979653.09633185, 33 },
-  { 140241291.15807357, 48979920.109822124, 140241278.94304353, 48979882.02054488, 140241303.37310362, 48979958.19909937, 140241290.54732206, 48979918.20535826, 140241291.76882508, 48979922.01428599, 0, 0, 0, 0, 0 },
-  { 140241263.60864207, 48979928.9447793, 140241251.8556827, 48979890.71039757, 140241275.36160144, 48979967.17916103, 140241263.0209941, 48979927.033060215, 140241264.19629005, 48979930.85649838, 0, 0, 0, 0, 0 },
-  { 140241235.97556803, 48979937.43897698, 140241224.58846626, 48979899.09404364, 140241247.3626698, 48979975.78391032, 140241235.40621293, 48979935.52173031, 140241236.54492313, 48979939.35622365, 0, 0, 0, 0, 0 },
-  { 140241208.2699438, 48979945.666576706, 140241197.15103838, 48979907.24301697, 140241219.38884923, 48979984.09013644, 140241207.71399853, 48979943.74539872, 140241208.82588908, 48979947.58775469, 1, 5, 140241100.97250658, 48979574.87922529, 30 },
-  { 140241180.50286144, 48979953.701739624, 140241169.5718091, 48979915.22431643, 140241191.43391377, 48979992.179162815, 140241179.9563088, 48979951.777868465, 140241181.04941407, 48979955.62561078, 0, 0, 0, 0, 0 },
-  { 140241152.68364137, 48979961.60490269, 140241141.92693666, 48979923.07837542, 140241163.4403461, 48980000.13142996, 140241152.14580613, 48979959.67857633, 140241153.2214766, 48979963.53122906, 0, 0, 0, 0, 0 },
-  { 140241124.8150677, 48979969.385879576, 140241114.23468813, 48979930.81055627, 140241135.39544728, 48980007.96120288, 140241124.28604874, 48979967.45711341, 140241125.34408668, 48979971.314645745, 1, 2, 140241189.0908736, 48980203.73096866, 30 },
-  { 140241096.89841816, 48979977.04281472, 140241086.4963662, 48979938.419022635, 140241107.3004701, 48980015.6666068, 140241096.37831557, 48979975.11162511, 140241097.41852075, 48979978.97400432, 1, 3, 140241069.59303173, 48979875.6553605, 35 },
-  { 140241068.93497032, 48979984.5738525, 140241058.7132732, 48979945.90193882, 140241079.15666744, 48980023.245766185, 140241068.42388546, 48979982.640256815, 140241069.44605517, 48979986.50744819, 1, 4, 140241171.15194142, 48980371.29298937, 37 },
-  { 140241040.92600185, 48979991.977137335, 140241030.88671184, 48979953.25746977, 140241050.96529186, 48980030.696804896, 140241040.42403734, 48979990.04115396, 140241041.42796636, 48979993.91312071, 0, 0, 0, 0, 0 },
-  { 140241012.8727903, 48979999.25081358, 140241003.01798445, 48979960.483781174, 140241022.72759616, 48980038.01784599, 140241012.38005, 48979997.31246196, 140241013.3655306, 48980001.189165205, 0, 0, 0, 0, 0 },
-  { 140240984.77661344, 48980006.3930257, 140240975.10839403, 48979967.57903939, 140240994.44483286, 48980045.207012005, 140240984.29320246, 48980004.45232638, 140240985.26002443, 48980008.33372501, 1, 4, 140240947.31226316, 48979855.988828756, 45 },
-  { 140240956.6387487, 48980013.40191802, 140240947.15924278, 48979974.54141149, 140240966.11825463, 48980052.26242454, 140240956.1647734, 48980011.45889269, 140240957.112724, 48980015.344943345, 0, 0, 0, 0, 0 },
-  { 140240928.46047387, 48980020.27563499, 140240919.17183372, 48979981.36906531, 140240937.749114, 48980059.18220467, 140240927.99604186, 48980018.33030651, 140240928.92490587, 48980022.22096347, 1, 1, 140240864.36885694, 48979751.820304185, 49 },
-  { 140240900.24306643, 48980027.01232099, 140240891.14746928, 48979988.06016941, 140240909.33866358, 48980065.96447256, 140240899.78828657, 48980025.06471341, 140240900.6978463, 48980028.959928565, 0, 0, 0, 0, 0 },
-  { 140240871.98780409, 48980033.61012042, 140240863.08745214, 48979994.61289315, 140240880.88815603, 48980072.6073477, 140240871.54278648, 48980031.66025906, 140240872.4328217, 48980035.559981786, 0, 0, 0, 0, 0 },
-  { 140240843.69596452, 48980040.06717768, 140240834.99308497, 48980001.02540662, 140240852.39884406, 48980079.108948745, 140240843.26082054, 48980038.11508913, 140240844.1311085, 48980042.01926623, 0, 0, 0, 0, 0 },
-  { 140240815.3688252, 48980046.38163717, 140240806.87009573, 48980007.29491823, 140240823.86755466, 48980085.46835611, 140240814.94388872, 48980044.42730122, 140240815.79376167, 48980048.33597312, 0, 0, 0, 0, 0 },
-  { 140240787.0072378, 48980052.5483727, 140240778.74737826, 48980013.41047904, 140240795.26709732, 48980091.68626636, 140240786.5942448, 48980050.59147802, 140240787.42023078, 48980054.50526738, 1, 0, 140240820.25317246, 48980210.07839469, 36 },
-  { 140240758.60936308, 48980058.54160418, 140240750.63421622, 48980019.34470338, 140240766.58450994, 48980097.73850499, 140240758.21060574, 48980056.58175914, 140240759.00812042, 48980060.50144923, 1, 4, 140240725.51250362, 48979895.874465846, 35 },
-  { 140240730.17231444, 48980064.3275116, 140240722.52804312, 48980025.0647415, 140240737.81658575, 48980103.5902817, 140240729.79010087, 48980062.364373095, 140240730.554528, 48980066.29065011, 1, 0, 140240778.71343726, 48980313.64610175, 30 },
-  { 140240701.69320288, 48980069.872256786, 140240694.42628446, 48980030.53789653, 140240708.9601213, 48980109.20661704, 140240701.32985696, 48980067.905538775, 140240702.0565488, 48980071.838974796, 0, 0, 0, 0, 0 },
-  { 140240673.16913953, 48980075.142001614, 140240666.32636485, 48980035.73164213, 140240680.01191422, 48980114.5523611, 140240672.8270008, 48980073.17148364, 140240673.51127827, 48980077.112519585, 0, 0, 0, 0, 0 },
-  { 140240644.59723526, 48980080.10290798, 140240638.22568426, 48980040.613626674, 140240650.96878627, 48980119.59218928, 140240644.2786577, 48980078.12844391, 140240644.91581282, 48980082.077372044, 0, 0, 0, 0, 0 },
-  { 140240615.97460124, 48980084.7211377, 140240610.12159184, 48980045.15167623, 140240621.82761064, 48980124.290599175, 140240615.68195078, 48980082.74266463, 140240616.2672517, 48980086.69961078, 0, 0, 0, 0, 0 },
-  { 140240587.29834843, 48980088.96285267, 140240582.01135576, 48980049.31379583, 140240592.5853411, 48980128.611909516, 140240587.0339988, 48980086.98039983, 140240587.56269807, 48980090.94530551, 1, 0, 140240540.90498766, 48979741.04237889, 38 },
-  { 140240558.56558797, 48980092.794214785, 140240553.8921307, 48980053.06816795, 140240563.23904523, 48980132.52026162, 140240558.3319151, 48980090.80791245, 140240558.79926082, 48980094.78051712, 0, 0, 0, 0, 0 },
-  { 140240529.77343073, 48980096.18138585, 140240525.76092133, 48980056.3831476, 140240533.78594014, 48980135.97962411, 140240529.57280526, 48980094.19147394, 140240529.9740562, 48980098.171297766, 0, 0, 0, 0, 0 },
-  { 140240500.91898784, 48980099.09052777, 140240497.6145452, 48980059.22725321, 140240504.22343048, 48980138.95380233, 140240500.7537657, 48980097.097364046, 140240501.08420998, 48980101.0836915, 0, 0, 0, 0, 0 },
-  { 140240471.9993703, 48980101.48780242, 140240469.4533062, 48980061.568915196, 140240474.54543442, 48980141.40668965, 140240471.8720671, 48980099.491858065, 140240472.12667352, 48980103.48374678, 1, 3, 140240465.44325525, 48979998.696667805, 44 },
-  { 140240443.01269352, 48980103.33659988, 140240441.36757016, 48980063.37044458, 140240444.6578169, 48980143.30275518, 140240442.93043736, 48980101.338292114, 140240443.0949497, 48980105.33490764, 0, 0, 0, 0, 0 },
-  { 140240413.98197538, 48980104.53158879, 140240413.48005196, 48980064.534738004, 140240414.4838988, 48980144.52843958, 140240413.9568792, 48980102.53174625, 140240414.00707155, 48980106.53143133, 0, 0, 0, 0, 0 },
-  { 140240384.9561797, 48980104.89583562, 140240385.84896573, 48980064.9058002, 140240384.06339368, 48980144.885871045, 140240385.000819, 48980102.89633385, 140240384.91154042, 48980106.895337395, 0, 0, 0, 0, 0 },
-  { 140240355.9854838, 48980104.24905869, 140240358.52743715, 48980064.32990949, 140240353.44353044, 48980144.1682079, 140240356.11258146, 48980102.25310124, 140240355.85838613, 48980106.24501615, 0, 0, 0, 0, 0 },
-  { 140240327.12006438, 48980102.4109797, 140240331.48817447, 48980062.65019985, 140240322.7519543, 48980142.17175955, 140240327.3384699, 48980100.42294071, 140240326.90165886, 48980104.3990187, 0, 0, 0, 0, 0 },
-  { 140240298.40093833, 48980099.255903155, 140240304.49727973, 48980059.72319996, 140240292.30459693, 48980138.788606346, 140240298.7057554, 48980097.279268, 140240298.09612125, 48980101.23253831, 1, 1, 140240322.32907838, 48979944.09004314, 30 },
-  { 140240269.83675444, 48980094.851018004, 140240277.49975893, 48980055.591899805, 140240262.17374995, 48980134.1101362, 140240270.21990466, 48980092.8880621, 140240269.45360422, 48980096.81397391, 0, 0, 0, 0, 0 },
-  { 140240241.42901477, 48980089.30609884, 140240250.49669677, 48980050.34743942, 140240232.36133277, 48980128.26475826, 140240241.88239887, 48980087.35816587, 140240240.97563067, 48980091.254031815, 0, 0, 0, 0, 0 },
-  { 140240213.17922142, 48980082.73092028, 140240223.4920274, 48980044.083203234, 140240202.86641544, 48980121.37863732, 140240213.6948617, 48980080.79853442, 140240212.66358113, 48980084.66330613, 0, 0, 0, 0, 0 },
-  { 140240185.08887678, 48980075.23525697, 140240196.49152192, 48980036.89494289, 140240173.68623164, 48980113.57557105, 140240185.65900904, 48980073.31824127, 140240184.51874453, 48980077.15227267, 0, 0, 0, 0, 0 },
-  { 140240157.1594829, 48980066.92888351, 140240169.5019207, 48980028.88070051, 140240144.8170451, 48980104.9770665, 140240157.7766048, 48980065.02647436, 140240156.542361, 48980068.83129266, 0, 0, 0, 0, 0 },
-  { 140240129.392542, 48980057.92157451, 140240142.53023067, 48980020.14061189, 140240116.25485334, 48980095.702537134, 140240130.04942644, 48980056.03252638, 140240128.73565757, 48980059.81062264, 1, 2, 140240209.86088505, 48979826.51317845, 50 },
-  { 140240101.7895563, 48980048.32310461, 140240115.58317614, 48980010.776652694, 140240087.99593645, 48980085.86955653, 140240102.4792373, 48980046.44578201, 140240101.0998753, 48980050.20042721, 1, 4, 140239991.095757, 48980349.63338124, 39 },
-  { 140240074.35202792, 48980038.24324842, 140240088.6665419, 48980000.89228204, 140240060.03751394, 48980075.5942148, 140240075.0677536, 48980036.3757001, 140240073.63630223, 48980040.110796735, 1, 3, 140240192.08890542, 48979731.03154995, 50 },
-  { 140240047.08124903, 48980027.79190047, 140240061.76326287, 48979990.58385739, 140240032.3992352, 48980064.999943554, 140240047.81534973, 48980025.93149832, 140240046.34714833, 48980029.65230262, 0, 0, 0, 0, 0 },
-  { 140240019.9594432, 48980017.08983997, 140240034.81828302, 48979979.95205759, 140240005.1006034, 48980054.22762235, 140240020.7023852, 48980015.23295085, 140240019.21650124, 48980018.946729094, 0, 0, 0, 0, 0 },
-  { 140239992.9348027, 48980006.2772718, 140240007.7758786, 48979969.132387005, 140239978.0937268, 48980043.422156595, 140239993.67685652, 48980004.42002756, 140239992.1927489, 48980008.13451604, 0, 0, 0, 0, 0 },
-  { 140239965.95199874, 48979995.49641075, 140239980.57958856, 48979958.26693834, 140239951.32440892, 48980032.725883156, 140239966.68337822, 48979993.63493713, 140239965.22061926, 48979997.35788437, 0, 0, 0, 0, 0 },
-  { 140239938.95570254, 48979984.88947162, 140239953.17172524, 48979947.50090788, 140239924.73967984, 48980022.27803536, 140239939.66650367, 48979983.02004343, 140239938.24490142, 48979986.75889981, 0, 0, 0, 0, 0 },
-  { 140239911.8905852, 48979974.598669186, 140239925.4936245, 48979936.98275072, 140239898.28754592, 48980012.21458765, 140239912.57073718, 48979972.71787326, 140239911.21043324, 48979976.47946511, 1, 4, 140239973.444338, 48979804.38663812, 29 },
-  { 140239884.70131794, 48979964.7662183, 140239897.48616382, 48979926.86440151, 140239871.91647205, 48980002.66803508, 140239885.34056023, 48979962.87112746, 140239884.06207564, 48979966.66130914, 0, 0, 0, 0, 0 },
-  { 140239857.33257204, 48979955.534333706, 140239869.09056818, 48979917.30150061, 140239845.5745759, 48979993.7671668, 140239857.92047185, 48979953.62269205, 140239856.74467224, 48979957.44597536, 0, 0, 0, 0, 0 },
-  { 140239829.72901848, 48979947.045230225, 140239840.2526058, 48979908.45437496, 140239819.20543116, 48979985.63608549, 140239830.25519785, 48979945.11568746, 140239829.2028391, 48979948.97477299, 0, 0, 0, 0, 0 },
-  { 140239801.83658957, 48979939.43906526, 140239811.03149325, 48979900.51023602, 140239792.6416859, 48979978.36789451, 140239802.29633477, 48979937.4926238, 140239801.37684438, 48979941.38550673, 0, 0, 0, 0, 0 },
-  { 140239773.6472931, 48979932.78081555, 140239781.56238028, 48979893.57174268, 140239765.7322059, 48979971.989888415, 140239774.04304746, 48979930.820361905, 140239773.25153872, 48979934.74126919, 1, 3, 140239737.04001483, 48980114.12277754, 39 },
-  { 140239745.2113425, 48979927.04048527, 140239751.90393957, 48979887.60434519, 140239738.51874545, 48979966.47662535, 140239745.54597238, 48979925.06867827, 140239744.87671265, 48979929.01229227, 0, 0, 0, 0, 0 },
-  { 140239716.5826799, 48979922.181995, 140239722.10872367, 48979882.56554841, 140239711.05663612, 48979961.79844158, 140239716.8589821, 48979920.201172665, 140239716.3063777, 48979924.16281733, 0, 0, 0, 0, 0 },
-  { 140239687.81524712, 48979918.16926526, 140239692.22875404, 48979878.41349893, 140239683.4017402, 48979957.925031595, 140239688.03592247, 48979916.18147694, 140239687.59457177, 48979920.15705358, 1, 5, 140239713.19291195, 48979689.57360886, 36 },
-  { 140239658.96298626, 48979914.966216624, 140239662.32593712, 48979875.1078353, 140239655.6000354, 48979954.82459795, 140239659.1311338, 48979912.97329756, 140239658.79483873, 48979916.95913569, 0, 0, 0, 0, 0 },
-  { 140239630.07238722, 48979912.52864486, 140239632.4930587, 48979872.60195767, 140239627.65171573, 48979952.45533205, 140239630.1934208, 48979910.5323105, 140239629.95135364, 48979914.52497922, 1, 2, 140239641.08644247, 48979730.86221817, 42 },
-  { 140239601.1561587, 48979910.77551444, 140239602.75847554, 48979870.80762006, 140239599.55384183, 48979950.743408814, 140239601.23627454, 48979908.77711972, 140239601.07604283, 48979912.77390916, 1, 3, 140239594.10596445, 48980086.63424968, 48 },
-  { 140239572.2174417, 48979909.61535839, 140239573.1270039, 48979869.62570102, 140239571.3078795, 48979949.60501576, 140239572.2629198, 48979907.61587552, 140239572.1719636, 48979911.61484126, 0, 0, 0, 0, 0 },
-  { 140239543.25937673, 48979908.95670905, 140239543.60257936, 48979868.958181426, 140239542.9161741, 48979948.95523667, 140239543.27653685, 48979906.95678267, 140239543.24221662, 48979910.95663543, 1, 0, 140239541.26880154, 48980140.94816926, 34 },
-  { 140239514.285104, 48979908.70809874, 140239514.1885641, 48979868.70821524, 140239514.38164392, 48979948.70798224, 140239514.280277, 48979906.708104566, 140239514.289931, 48979910.70809291, 0, 0, 0, 0, 0 },
-  { 140239485.29776406, 48979908.77805983, 140239484.8880024, 48979868.7801587, 140239485.70752573, 48979948.77596097, 140239485.27727598, 48979906.778164774, 140239485.31825215, 48979910.77795489, 0, 0, 0, 0, 0 },
-  { 140239456.3004973, 48979909.07512464, 140239455.70381826, 48979869.07957521, 140239456.89717633, 48979949.07067406, 140239456.27066335, 48979907.07534716, 140239456.33033124, 48979911.07490211, 0, 0, 0, 0, 0 },
-  { 140239427.296444, 48979909.50782554, 140239426.63895664, 48979869.51322953, 140239427.95393136, 48979949.50242155, 140239427.26356962, 48979907.50809574, 140239427.32931837, 48979911.507555336, 0, 0, 0, 0, 0 },
-  { 140239398.2887447, 48979909.98469486, 140239397.69646677, 48979869.98908001, 140239398.8810226, 48979949.98030971, 140239398.2591308, 48979907.98491412, 140239398.31835857, 48979911.984475605, 0, 0, 0, 0, 0 },
-  { 140239369.28053972, 48979910.414264925, 140239368.87952906, 48979870.41627509, 140239369.68155038, 48979950.41225476, 140239369.2604892, 48979908.41436543, 140239369.30059025, 48979912.41416442, 1, 3, 140239372.03748795, 48980185.40044501, 43 },
-  { 140239340.2749695, 48979910.705068104, 140239340.19142613, 48979870.70515535, 140239340.35851285, 48979950.70498086, 140239340.27079234, 48979908.70507246, 140239340.27914664, 48979912.705063745, 1, 2, 140239339.55440813, 48979565.70582058, 27 },
-  { 140239311.27517444, 48979910.765636735, 140239311.6354574, 48979870.767259315, 140239310.91489148, 48979950.764014155, 140239311.2931886, 48979908.765717864, 140239311.25716028, 48979912.765555605, 0, 0, 0, 0, 0 },
-  { 140239282.2842949, 48979910.50450314, 140239283.21479642, 48979870.51532751, 140239281.35379338, 48979950.49367876, 140239282.33081996, 48979908.505044356, 140239282.23776984, 48979912.50396192, 0, 0, 0, 0, 0 },
-  { 140239253.30547133, 48979909.83019969, 140239254.92899787, 48979869.86316125, 140239251.6819448, 48979949.79723813, 140239253.38664767, 48979907.831847765, 140239253.224295, 48979911.82855161, 1, 5, 140239242.9149014, 48980165.61924569, 48 },
-  { 140239224.34193265, 48979908.653653316, 140239226.7108525, 48979868.72386219, 140239221.9730128, 48979948.58344444, 140239224.46037865, 48979906.65716376, 140239224.22348666, 48979910.65014287, 1, 4, 140239236.71953878, 48979700.02049472, 37 },
-  { 140239195.39878437, 48979906.93653945, 140239198.4985263, 48979867.05682531, 140239192.29904243, 48979946.81625359, 140239195.55377147, 48979904.94255374, 140239195.24379727, 48979908.930525154, 0, 0, 0, 0, 0 },
-  { 140239166.48292378, 48979904.68898808, 140239170.29618308, 48979864.87116477, 140239162.66966447, 48979944.506811395, 140239166.67358676, 48979902.698096916, 140239166.2922608, 48979906.67987925, 0, 0, 0, 0, 0 },
-  { 140239137.60131967, 48979901.92306477, 140239142.11078736, 48979862.17806885, 140239133.09185198, 48979941.66806069, 140239137.82679304, 48979899.93581497, 140239137.3758463, 48979903.91031457, 0, 0, 0, 0, 0 },
-  { 140239108.76094085, 48979898.65083505, 140239113.94936413, 48979858.98875916, 140239103.57251757, 48979938.312910944, 140239109.02036202, 48979896.667731255, 140239108.50151968, 48979900.63393885, 0, 0, 0, 0, 0 },
-  { 140239079.9687562, 48979894.88436449, 140239085.81899258, 48979855.31449295, 140239074.1185198, 48979934.45423604, 140239080.26126802, 48979892.905870914, 140239079.67624438, 48979896.86285807, 0, 0, 0, 0, 0 },
-  { 140239051.2317345, 48979890.63571865, 140239057.72680014, 48979851.166564584, 140239044.73666888, 48979930.10487272, 140239051.5564878, 48979888.66226095, 140239050.90698123, 48979892.60917635, 0, 0, 0, 0, 0 },
-  { 140239022.55684468, 48979885.91696306, 140239029.6799566, 48979846.5563066, 140239015.43373278, 48979925.277619526, 140239022.9130003, 48979883.94893024, 140239022.20068908, 48979887.884995885, 0, 0, 0, 0, 0 },
-  { 140238993.95105538, 48979880.740163274, 140239001.68566868, 48979841.495090246, 140238986.21644208, 48979919.9852363, 140238994.33778605, 48979878.77790962, 140238993.5643247, 48979882.70241693, 0, 0, 0, 0, 0 },
-  { 140238965.42133555, 48979875.117384836, 140238973.7511754, 48979835.99432555, 140238957.0914957, 48979914.240444124, 140238965.83782753, 48979873.16123187, 140238965.00484356, 48979877.073537804, 0, 0, 0, 0, 0 },
-  { 140238936.97465402, 48979869.06069332, 140238945.88374296, 48979830.06546113, 140238928.06556508, 48979908.05592552, 140238937.42010847, 48979867.11093172, 140238936.52919957, 48979871.01045493, 1, 2, 140238977.0655543, 48979693.58214844, 41 },
-  { 140238908.61797962, 48979862.582154274, 140238918.09066057, 48979823.719983526, 140238899.14529866, 48979901.44432502, 140238909.09161365, 48979860.63904574, 140238908.14434558, 48979864.52526281, 0, 0, 0, 0, 0 },
-  { 140238880.35828108, 48979855.69383324, 140238890.37923646, 48979816.969416484, 140238870.3373257, 48979894.418249995, 140238880.85932884, 48979853.7576124, 140238879.85723332, 48979857.63005408, 0, 0, 0, 0, 0 },
-  { 140238852.20252737, 48979848.40779576, 140238862.75679436, 48979809.825319834, 140238841.64826038, 48979886.99027168, 140238852.73024073, 48979846.47867196, 140238851.67481402, 48979850.33691955, 0, 0, 0, 0, 0 },
-  { 140238824.1576872, 48979840.73610741, 140238835.23067018, 48979802.299288504, 140238813.0847042, 48979879.172926314, 140238824.71133634, 48979838.814266466, 140238823.60403803, 48979842.65794835, 0, 0, 0, 0, 0 },
-  { 140238796.23072943, 48979832.6908337, 140238807.8022717, 48979794.40115612, 140238784.65918717, 48979870.980511285, 140238796.80930653, 48979830.77634982, 140238795.65215233, 48979834.605317585, 0, 0, 0, 0, 0 },
-  { 140238768.42591262, 48979824.28792636, 140238780.44626978, 48979786.13676631, 140238756.40555546, 48979862.439086415, 140238769.02693048, 48979822.38036836, 140238767.82489476, 48979826.19548436, 0, 0, 0, 0, 0 },
-  { 140238740.73383048, 48979815.56293038, 140238753.1441767, 48979777.53684319, 140238728.32348427, 48979853.58901758, 140238741.3543478, 48979813.661626026, 140238740.11331317, 48979817.46423474, 0, 0, 0, 0, 0 },
-  { 140238713.14077976, 48979806.55755177, 140238725.8826601, 48979768.64126918, 140238700.39889944, 48979844.473834366, 140238713.77787378, 48979804.66173764, 140238712.50368574, 48979808.4533659, 0, 0, 0, 0, 0 },
-  { 140238685.63305584, 48979797.31349876, 140238698.6484013, 48979759.49021515, 140238672.61771038, 48979835.13678236, 140238686.2838231, 48979795.422334574, 140238684.98228857, 48979799.20466294, 0, 0, 0, 0, 0 },
-  { 140238658.1969539, 48979787.87247961, 140238671.4280582, 48979750.124130264, 140238644.96584958, 48979825.62082896, 140238658.85850912, 48979785.985062145, 140238657.53539866, 48979789.759897076, 0, 0, 0, 0, 0 },
-  { 140238630.81876928, 48979778.276202604, 140238644.2082368, 48979740.5837344, 140238617.42930174, 48979815.96867081, 140238631.48824266, 48979776.391579196, 140238630.1492959, 48979780.16082601, 0, 0, 0, 0, 0 },
-  { 140238603.48479727, 48979768.566376, 140238616.97546837, 48979730.910011426, 140238589.99412617, 48979806.222740576, 140238604.15933082, 48979766.68355777, 140238602.81026372, 48979770.44919423, 0, 0, 0, 0, 0 },
-  { 140238576.18133312, 48979758.784708045, 140238589.71619317, 48979721.14420375, 140238562.64647308, 48979796.42521234, 140238576.85807613, 48979756.90268283, 140238575.50459012, 48979760.66673326, 0, 0, 0, 0, 0 },
-  { 140238548.89467204, 48979748.972907014, 140238562.41675007, 48979711.32780899, 140238535.372594, 48979786.61800504, 140238549.57077593, 48979747.090652116, 140238548.21856815, 48979750.85516191, 0, 0, 0, 0, 0 },
-  { 140238521.61110938, 48979739.17268114, 140238535.06337175, 48979701.502578445, 140238508.158847, 48979776.84278383, 140238522.2837225, 48979737.289176, 140238520.93849626, 48979741.05618627, 0, 0, 0, 0, 0 },
-  { 140238494.3169404, 48979729.4257387, 140238507.64218572, 48979691.71051847, 140238480.99169508, 48979767.14095893, 140238494.98320267, 48979727.539977685, 140238493.65067813, 48979731.311499715, 0, 0, 0, 0, 0 },
-  { 140238466.9984604, 48979719.77378796, 140238480.13922122, 48979681.993893765, 140238453.8576996, 48979757.553682156, 140238467.65549845, 48979717.88479325, 140238466.34142238, 48979721.66278267, 0, 0, 0, 0, 0 },
-  { 140238439.64196458, 48979710.258537166, 140238452.54042196, 48979672.39523307, 140238426.7435072, 48979748.12184126, 140238440.28688747, 48979708.36537196, 140238438.9970417, 48979712.151702374, 0, 0, 0, 0, 0 },
-  { 140238412.23374832, 48979700.92169459, 140238424.83166528, 48979662.95733646, 140238399.63583136, 48979738.88605272, 140238412.86364415, 48979699.02347668, 140238411.60385248, 48979702.8199125, 1, 2, 140238347.35447595, 48979896.438138954, 47 },
-  { 140238384.76010677, 48979691.804968484, 140238396.99878708, 48979653.72328386, 140238372.52142647, 48979729.88665311, 140238385.37204078, 48979689.900884256, 140238384.14817277, 48979693.70905271, 0, 0, 0, 0, 0 },
-  { 140238357.2073353, 48979682.9500671, 140238369.02761406, 48979644.73644375, 140238345.38705653, 48979721.163690455, 140238357.79834923, 48979681.03938594, 140238356.61632136, 48979684.86074827, 0, 0, 0, 0, 0 },
-  { 140238329.56172913, 48979674.398698695, 140238340.90400204, 48979636.040481254, 140238318.21945623, 48979712.756916136, 140238330.12884277, 48979672.48078782, 140238328.9946155, 48979676.31660957, 0, 0, 0, 0, 0 },
-  { 140238301.80958357, 48979666.19257156, 140238312.6138818, 48979627.67936421, 140238291.00528535, 48979704.705778904, 140238302.34979847, 48979664.266911194, 140238301.26936868, 48979668.11823192, 0, 0, 0, 0, 0 },
-  { 140238273.93719393, 48979658.37339392, 140238284.14559606, 48979619.69796857, 140238263.7287918, 48979697.04881927, 140238274.44761404, 48979656.439622656, 140238273.42677382, 48979660.30716519, 1, 4, 140238321.91668388, 48979476.59889477, 50 },
-  { 140238245.93181917, 48979650.98135817, 140238255.5192457, 48979612.147336334, 140238236.34439263, 48979689.81538001, 140238246.4111905, 48979649.03965708, 140238245.45244783, 48979652.92305926, 0, 0, 0, 0, 0 },
-  { 140238217.79462284, 48979644.03478683, 140238226.76054344, 48979605.05258233, 140238208.82870224, 48979683.016991325, 140238218.24291888, 48979642.0856766, 140238217.3463268, 48979645.98389705, 0, 0, 0, 0, 0 },
-  { 140238189.53721404, 48979637.53557297, 140238197.8814357, 48979598.41557853, 140238181.1929924, 48979676.65556741, 140238189.95442513, 48979635.579573244, 140238189.12000296, 48979639.49157269, 0, 0, 0, 0, 0 },
-  { 140238161.17145607, 48979631.485209845, 140238168.8935109, 48979592.23766382, 140238153.44940123, 48979670.73275587, 140238161.5575588, 48979629.52283254, 140238160.78535333, 48979633.44758715, 1, 4, 140238195.5346001, 48979456.83363003, 46 },
-  { 140238132.70921218, 48979625.885190725, 140238139.80834916, 48979586.520203054, 140238125.6100752, 48979665.2501784, 140238133.06416902, 48979623.916941345, 140238132.35425535, 48979627.853440106, 0, 0, 0, 0, 0 },
-  { 140238104.1623457, 48979620.73700887, 140238110.63752306, 48979581.26458713, 140238097.68716836, 48979660.20943061, 140238104.48610458, 48979618.763387784, 140238103.83858684, 48979622.710629955, 0, 0, 0, 0, 0 },
-  { 140238075.5427199, 48979616.042157516, 140238081.39259848, 48979576.47223307, 140238069.69284132, 48979655.61208196, 140238075.83521384, 48979614.06366129, 140238075.25022596, 48979618.02065374, 1, 0, 140238049.94950107, 48979789.160576954, 42 },
-  { 140238046.86219814, 48979611.802129954, 140238052.06378445, 48979572.141778216, 140238041.66061184, 48979651.46248169, 140238047.12227747, 48979609.81911237, 140238046.60211882, 48979613.78514754, 1, 5, 140238084.44365925, 48979325.25608866, 28 },
-  { 140238018.12981632, 48979608.03378304, 140238022.53205442, 48979568.27676731, 140238013.72757822, 48979647.79079877, 140238018.34992823, 48979606.045932256, 140238017.90970442, 48979610.021633826, 0, 0, 0, 0, 0 },
-  { 140237989.33773518, 48979604.84567663, 140237992.7417324, 48979564.99077978, 140237985.93373796, 48979644.70057348, 140237989.50793505, 48979602.85293179, 140237989.1675353, 48979606.83842147, 0, 0, 0, 0, 0 },
-  { 140237960.4718806, 48979602.3802509, 140237962.67928287, 48979562.44120515, 140237958.26447836, 48979642.31929665, 140237960.5822507, 48979600.38329861, 140237960.36151052, 48979604.37720319, 0, 0, 0, 0, 0 },
-  { 140237931.51816863, 48979600.78000012, 140237932.33378726, 48979560.78831641, 140237930.70255, 48979640.771683834, 140237931.55894956, 48979598.78041594, 140237931.4773877, 48979602.7795843, 0, 0, 0, 0, 0 },
-  { 140237902.4625153, 48979600.1874186, 140237901.66983882, 48979560.19527357, 140237903.25519177, 48979640.179563634, 140237902.42288148, 48979598.18781135, 140237902.5021491, 48979602.18702585, 1, 2, 140237906.02955952, 48979780.15207123, 29 },
-  { 140237873.30432263, 48979600.76535744, 140237870.3650254, 48979560.87349697, 140237876.24361986, 48979640.65721791, 140237873.15735778, 48979598.77076442, 140237873.45128748, 48979602.75995047, 0, 0, 0, 0, 0 },
-  { 140237844.19756675, 48979602.9099906, 140237838.34985927, 48979563.33974525, 140237850.04527423, 48979642.48023595, 140237843.90518138, 48979600.93147834, 140237844.48995212, 48979604.888502866, 1, 4, 140237884.254363, 48979873.96617126, 35 },
-  { 140237815.39491284, 48979607.1664589, 140237805.8816052, 48979568.31421343, 140237824.90822047, 48979646.01870436, 140237814.91924745, 48979605.22384662, 140237815.87057823, 48979609.10907117, 0, 0, 0, 0, 0 },
-  { 140237787.15062484, 48979614.08231659, 140237773.3028406, 48979576.55580768, 140237800.9984091, 48979651.608825505, 140237786.45823562, 48979612.20599115, 140237787.84301406, 48979615.958642036, 0, 0, 0, 0, 0 },
-  { 140237759.71966535, 48979624.204707935, 140237741.1049772, 48979588.799999416, 140237778.3343535, 48979659.609416455, 140237758.78893095, 48979622.43447251, 140237760.65039974, 48979625.97494336, 1, 5, 140237619.64413705, 48979357.78427634, 45 },
-  { 140237733.60853606, 48979637.93312286, 140237709.93955377, 48979605.687514216, 140237757.27751836, 48979670.1787315, 140237732.42508695, 48979636.32084242, 140237734.79198518, 48979639.545403294, 0, 0, 0, 0, 0 },
-  { 140237709.94708672, 48979655.301144406, 140237680.98213896, 48979627.71433958, 140237738.91203448, 48979682.887949236, 140237708.49883932, 48979653.92180417, 140237711.39533412, 48979656.680484645, 1, 5, 140237598.43203783, 48979549.091945805, 41 },
-  { 140237689.96006396, 48979676.28665084, 140237656.0628036, 48979655.05046146, 140237723.85732433, 48979697.52284021, 140237688.26520094, 48979675.22484137, 140237691.654927, 48979677.3484603, 0, 0, 0, 0, 0 },
-  { 140237674.64213094, 48979700.73717512, 140237637.44414034, 48979686.029711165, 140237711.84012154, 48979715.44463908, 140237672.78223142, 48979700.00180192, 140237676.50203046, 48979701.47254832, 0, 0, 0, 0, 0 },
-  { 140237663.90716085, 48979727.8879686, 140237624.89762214, 48979719.041732706, 140237702.91669956, 48979736.73420449, 140237661.9566839, 48979727.445656806, 140237665.8576378, 48979728.33028039, 0, 0, 0, 0, 0 },
-  { 140237657.35195884, 48979756.794659495, 140237617.50955346, 48979753.2474447, 140237697.19436422, 48979760.341874294, 140237655.35983858, 48979756.61729875, 140237659.3440791, 48979756.97202024, 0, 0, 0, 0, 0 },
-  { 140237654.70747152, 48979786.497607246, 140237614.77919596, 48979788.891936034, 140237694.63574708, 48979784.10327846, 140237652.71105775, 48979786.61732369, 140237656.7038853, 48979786.3778908, 1, 3, 140237931.21077982, 48979769.91688038, 46 },
-  { 140237656.47359464, 48979815.94980727, 140237617.64178872, 48979825.54620506, 140237695.30540055, 48979806.353409484, 140237654.53200433, 48979816.42962716, 140237658.41518494, 48979815.469987385, 1, 1, 140237306.98734152, 48979902.317387365, 38 },
-  { 140237663.4236491, 48979844.07318982, 140237627.61179212, 48979861.89202535, 140237699.2355061, 48979826.25435428, 140237661.63305625, 48979844.96413159, 140237665.21424195, 48979843.18224804, 1, 2, 140237896.20071945, 48979728.25075885, 25 },
-  { 140237676.23870203, 48979869.8285677, 140237644.85968372, 48979894.634962246, 140237707.61772034, 48979845.02217315, 140237674.6697511, 48979871.06888743, 140237677.80765295, 48979868.58824797, 0, 0, 0, 0, 0 },
-  { 140237694.3283867, 48979892.71123794, 140237667.39957708, 48979922.28891894, 140237721.2571963, 48979863.13355693, 140237692.9819462, 48979894.190121986, 140237695.6748272, 48979891.23235389, 0, 0, 0, 0, 0 },
-  { 140237716.17874485, 48979912.60475611, 140237693.29847643, 48979945.41471369, 140237739.05901328, 48979879.79479853, 140237715.03473142, 48979914.24525399, 140237717.3227583, 48979910.96425823, 1, 1, 140237634.38178518, 48980029.90035445, 25 },
-  { 140237740.29135588, 48979929.41986511, 140237721.07937953, 48979964.50404908, 140237759.50333223, 48979894.33568114, 140237739.33075705, 48979931.17407431, 140237741.2519547, 48979927.66565591, 0, 0, 0, 0, 0 },
-  { 140237765.80542022, 48979943.39127745, 140237749.77048194, 48979980.036614865, 140237781.8403585, 48979906.74594003, 140237765.00367332, 48979945.223544315, 140237766.60716712, 48979941.55901058, 0, 0, 0, 0, 0 },
-  { 140237792.40412247, 48979955.03009917, 140237778.89433444, 48979992.679609485, 140237805.9139105, 48979917.38058885, 140237791.72863308, 48979956.912574686, 140237793.07961187, 48979953.14762365, 0, 0, 0, 0, 0 },
-  { 140237819.7880886, 48979964.8562981, 140237808.07706413, 48980003.10354513, 140237831.49911305, 48979926.60905106, 140237819.20253736, 48979966.76866045, 140237820.37363982, 48979962.943935744, 0, 0, 0, 0, 0 },
-  { 140237847.65794432, 48979973.38984202, 140237837.03909284, 48980011.954592675, 140237858.2767958, 48979934.82509136, 140237847.12700176, 48979975.31807955, 140237848.18888688, 48979971.46160448, 1, 2, 140237921.7244334, 48979704.40070619, 26 },
-  { 140237875.73300165, 48979981.12034355, 140237865.9181558, 48980019.8975121, 140237885.5478475, 48979942.343175, 140237875.24225935, 48979983.05920198, 140237876.22374395, 48979979.181485124, 1, 3, 140237806.5383383, 48980254.49938182, 36 },
-  { 140237903.90839827, 48979988.25178675, 140237894.8401425, 48980027.21031261, 140237912.97665405, 48979949.293260895, 140237903.45498547, 48979990.199713044, 140237904.36181107, 48979986.30386046, 0, 0, 0, 0, 0 },
-  { 140237932.17571604, 48979994.83148303, 140237923.7968452, 48980033.944070816, 140237940.5545869, 48979955.71889524, 140237931.7567725, 48979996.787112415, 140237932.5946596, 48979992.87585364, 1, 1, 140237874.57097906, 48980263.73052408, 45 },
-  { 140237960.52752826, 48980000.90513312, 140237952.779096, 48980040.147480115, 140237968.2759605, 48979961.662786126, 140237960.14010665, 48980002.86725047, 140237960.91494986, 48979998.94301577, 1, 4, 140238012.0546028, 48979739.94352562, 25 },
-  { 140237988.95640814, 48980006.5184378, 140237981.7781214, 48980045.86906931, 140237996.13469487, 48979967.1678063, 140237988.5974938, 48980008.48596938, 140237989.3153225, 48980004.550906226, 0, 0, 0, 0, 0 },
-  { 140238017.45492896, 48980011.7170978, 140238010.78548223, 48980051.157159664, 140238024.1243757, 48979972.27703593, 140238017.12145662, 48980013.68910089, 140238017.7884013, 48980009.7450947, 0, 0, 0, 0, 0 },
-  { 140238046.01566398, 48980016.54681387, 140238039.79301518, 48980056.059832506, 140238052.23831278, 48979977.03379523, 140238045.70453155, 48980018.5224648, 140238046.3267964, 48980014.57116294, 0, 0, 0, 0, 0 },
-  { 140238074.63118646, 48980021.05328674, 140238068.79277793, 48980060.62490518, 140238080.469595, 48979981.4816683, 140238074.33926603, 48980023.03186766, 140238074.92310688, 48980019.07470582, 0, 0, 0, 0, 0 },
-  { 140238103.29406974, 48980025.28221719, 140238097.7769997, 48980064.89991448, 140238108.81113976, 48979985.6645199, 140238103.01821622, 48980027.263102055, 140238103.56992325, 48980023.301332325, 1, 0, 140238085.36359218, 48980154.03973337, 25 },
-  { 140238131.99688694, 48980029.27930594, 140238126.73803738, 48980068.932105355, 140238137.2557365, 48979989.62650653, 140238131.73394448, 48980031.26194591, 140238132.2598294, 48980027.296665974, 0, 0, 0, 0, 0 },
-  { 140238160.7322114, 48980033.09025373, 140238155.66833884, 48980072.76842398, 140238165.796084, 48979993.412083484, 140238160.4790178, 48980035.074162245, 140238160.98540503, 48980031.10634522, 0, 0, 0, 0, 0 },
-  { 140238189.49261642, 48980036.76076135, 140238184.56041327, 48980076.455513805, 140238194.42481956, 48979997.066008896, 140238189.24600625, 48980038.74549897, 140238189.73922658, 48980034.77602373, 1, 1, 140238211.81083557, 48979857.1420065, 37 },
-  { 140238218.27067524, 48980040.33652951, 140238213.40680844, 48980080.039713256, 140238223.13454205, 48980000.63334576, 140238218.0274819, 48980042.3216887, 140238218.51386857, 48980038.35137032, 1, 1, 140238186.8987343, 48980296.42206468, 47 },
-  { 140238247.05896112, 48980043.86325898, 140238242.20009556, 48980083.56705509, 140238251.91782668, 48980004.15946287, 140238246.81601784, 48980045.84844878, 140238247.3019044, 48980041.87806918, 0, 0, 0, 0, 0 },
-  { 140238275.85004726, 48980047.386650465, 140238270.93286127, 48980087.08326596, 140238280.76723325, 48980007.69003497, 140238275.60418797, 48980049.37148124, 140238276.09590656, 48980045.40181969, 1, 3, 140238243.02783084, 48980312.361558914, 46 },
-  { 140238304.63650706, 48980050.952404745, 140238299.59770745, 48980090.63376685, 140238309.67530668, 48980011.27104264, 140238304.38456708, 48980052.93647285, 140238304.88844705, 48980048.96833664, 0, 0, 0, 0, 0 },
-  { 140238333.41091368, 48980054.606222585, 140238328.18725744, 48980094.26367353, 140238338.6345699, 48980014.94877164, 140238333.14973086, 48980056.58909513, 140238333.6720965, 48980052.62335004, 0, 0, 0, 0, 0 },
-  { 140238362.16584045, 48980058.393804714, 140238356.69417036, 48980098.017797776, 140238367.63751054, 48980018.76981165, 140238361.89225695, 48980060.375004366, 140238362.43942395, 48980056.41260506, 0, 0, 0, 0, 0 },
-  { 140238390.89386052, 48980062.360851854, 140238385.111162, 48980101.9406497, 140238396.67655903, 48980022.781054005, 140238390.6047256, 48980064.339841746, 140238391.18299544, 48980060.38186196, 0, 0, 0, 0, 0 },
-  { 140238419.58754727, 48980066.55306476, 140238413.4310338, 48980106.07644192, 140238425.74406075, 48980027.029687606, 140238419.2797216, 48980068.52923362, 140238419.89537296, 48980064.57689591, 1, 3, 140238454.98749983, 48979839.29364613, 46 },
-  { 140238448.2394739, 48980071.01614422, 140238441.6467078, 48980110.4690964, 140238454.83224002, 48980031.56319205, 140238447.9098356, 48980072.98879183, 140238448.5691122, 48980069.043496616, 1, 2, 140238400.60673884, 48980356.06372367, 42 },
-  { 140238476.84221375, 48980075.79579095, 140238469.75126904, 48980115.162255146, 140238483.93315846, 48980036.42932675, 140238476.48766652, 48980077.76411416, 140238477.19676098, 48980073.82746774, 0, 0, 0, 0, 0 },
-  { 140238505.38834, 48980080.937705696, 140238497.73802692, 48980120.199299015, 140238513.03865308, 48980041.676112376, 140238505.00582436, 48980082.900785364, 140238505.77085564, 48980078.97462603, 0, 0, 0, 0, 0 },
-  { 140238533.87042633, 48980086.48757922, 140238525.6221735, 48980125.62792062, 140238542.11867917, 48980047.34723782, 140238533.45801368, 48980088.44459629, 140238534.28283897, 48980084.53056215, 0, 0, 0, 0, 0 },
-  { 140238562.28166354, 48980092.47483072, 140238553.46293312, 48980131.49059668, 140238571.10039395, 48980053.45906475, 140238561.840727, 48980094.42561901, 140238562.72260007, 48980090.52404242, 0, 0, 0, 0, 0 },
-  { 140238590.61711583, 48980098.8794907, 140238581.26717532, 48980137.77137434, 140238599.96705633, 48980059.98760707, 140238590.1496188, 48980100.824084885, 140238591.08461285, 48980096.93489652, 0, 0, 0, 0, 0 },
-  { 140238618.87220126, 48980105.672254205, 140238609.0296138, 48980144.442390546, 140238628.71478873, 48980066.90211786, 140238618.38007188, 48980107.610761024, 140238619.36433065, 48980103.733747385, 1, 3, 140238572.61204013, 48980287.891895, 49 },
-  { 140238647.04233813, 48980112.82381627, 140238636.7449642, 48980151.47564793, 140238657.33971205, 48980074.17198461, 140238646.52746943, 48980114.75640785, 140238647.55720684, 48980110.89122469, 0, 0, 0, 0, 0 },
-  { 140238675.12294456, 48980120.30487195, 140238664.40796283, 48980158.84302403, 140238685.8379263, 48980081.76671986, 140238674.5871955, 48980122.23177955, 140238675.65869364, 48980118.37796434, 1, 5, 140238638.69200662, 48980251.334589034, 48 },
-  { 140238703.10943887, 48980128.08611623, 140238692.01338258, 48980166.51628062, 140238714.20549515, 48980089.65595184, 140238702.55463606, 48980130.007624455, 140238703.66424167, 48980126.16460801, 0, 0, 0, 0, 0 },
-  { 140238730.99723914, 48980136.13824419, 140238719.55604768, 48980174.46707326, 140238742.4384306, 48980097.80941512, 140238730.42517957, 48980138.054685645, 140238731.5692987, 48980134.221802734, 1, 2, 140238648.04860106, 48980414.02225495, 42 },
-  { 140238758.78176364, 48980144.43195084, 140238747.03084582, 48980182.66696006, 140238770.53268147, 48980106.196941614, 140238758.19421774, 48980146.343701296, 140238759.36930954, 48980142.52020038, 0, 0, 0, 0, 0 },
-  { 140238786.45843053, 48980152.93793122, 140238774.4327395, 48980191.08741031, 140238798.48412156, 48980114.788452126, 140238785.85714597, 48980154.84540517, 140238787.0597151, 48980151.030457266, 0, 0, 0, 0, 0 },
-  { 140238814.02265805, 48980161.62688037, 140238801.75677586, 48980199.69981215, 140238826.28854024, 48980123.55394859, 140238813.40936396, 48980163.53052696, 140238814.63595214, 48980159.72323378, 0, 0, 0, 0, 0 },
-  { 140238841.46986437, 48980170.46949331, 140238828.996813, 48980208.475058556, 140238853.94291574, 48980132.46392806, 140238840.8462118, 48980172.36977157, 140238842.09351695, 48980168.569215044, 0, 0, 0, 0, 0 },
-  { 140238868.79603794, 48980179.43767373, 140238856.12752306, 48980217.37853206, 140238881.46455282, 48980141.496815406, 140238868.1626122, 48980181.33471665, 140238869.42946368, 48980177.54063082, 0, 0, 0, 0, 0 },
-  { 140238896.0066016, 48980188.523325615, 140238883.13712817, 48980226.39649096, 140238908.87607503, 48980150.65016027, 140238895.36312792, 48980190.41698388, 140238896.6500753, 48980186.62966735, 0, 0, 0, 0, 0 },
-  { 140238923.11473316, 48980197.734791726, 140238910.03862813, 48980235.53711278, 140238936.1908382, 48980159.93247067, 140238922.4609279, 48980199.62490778, 140238923.76853842, 48980195.844675675, 1, 0, 140238993.72570038, 48979993.60225804, 34 },
-  { 140238950.13384014, 48980207.080902524, 140238936.8457937, 48980244.809244946, 140238963.4218866, 48980169.3525601, 140238949.4694378, 48980208.967319645, 140238950.79824248, 48980205.1944854, 0, 0, 0, 0, 0 },
-  { 140238977.0773304, 48980216.57048853, 140238963.5724174, 48980254.22174779, 140238990.5822434, 48980178.91922926, 140238976.40208477, 48980218.45305149, 140238977.75257605, 48980214.68792556, 1, 4, 140239026.37026292, 48980079.1433922, 37 },
-  { 140239003.95861155, 48980226.21238021, 140238990.23231083, 48980263.783495024, 140239017.68491226, 48980188.64126539, 140239003.27229652, 48980228.090935946, 140239004.64492658, 48980224.33382447, 0, 0, 0, 0, 0 },
-  { 140239030.79109135, 48980236.015408106, 140239016.83930275, 48980273.50337411, 140239044.74287996, 48980198.527442105, 140239030.09350193, 48980237.889806405, 140239031.48868078, 48980234.14100981, 0, 0, 0, 0, 0 },
-  { 140239057.58817747, 48980245.98840265, 140239043.40723583, 48980283.390286215, 140239071.7691191, 48980208.586519085, 140239056.8791304, 48980247.85849683, 140239058.29722455, 48980244.11830847, 0, 0, 0, 0, 0 },
-  { 140239084.3632776, 48980256.14019439, 140239069.94996446, 48980293.45314662, 140239098.77659076, 48980218.827242166, 140239083.64261195, 48980258.00584201, 140239085.08394328, 48980254.27454678, 1, 4, 140239188.49946514, 48979986.55411454, 33 },
-  { 140239111.1297995, 48980266.47961378, 140239096.48135152, 48980303.70088421, 140239125.77824745, 48980229.258343354, 140239110.39737707, 48980268.3406773, 140239111.8622219, 48980264.61855026, 0, 0, 0, 0, 0 },
-  { 140239137.9011508, 48980277.015491314, 140239123.0152655, 48980314.14244135, 140239152.7870361, 48980239.88854128, 140239137.15685654, 48980278.871838816, 140239138.64544505, 48980275.15914381, 0, 0, 0, 0, 0 },
-  { 140239164.69073924, 48980287.756657526, 140239149.56557772, 48980324.78677349, 140239179.81590077, 48980250.726541564, 140239163.93448117, 48980289.60816333, 140239165.4469973, 48980285.905151725, 0, 0, 0, 0, 0 },
-  { 140239191.51197252, 48980298.71194285, 140239176.14615896, 48980335.64284825, 140239206.87778607, 48980261.78103745, 140239190.74368185, 48980300.55848812, 140239192.2802632, 48980296.86539758, 0, 0, 0, 0, 0 },
-  { 140239218.37825832, 48980309.89017782, 140239202.7708771, 48980346.71964498, 140239233.98563954, 48980273.06071067, 140239217.59788924, 48980311.73165118, 140239219.1586274, 48980308.04870447, 0, 0, 0, 0, 0 },
-  { 140239245.30300435, 48980321.300192915, 140239229.45359373, 48980358.02615353, 140239261.15241498, 48980284.5742323, 140239244.5105338, 48980323.13649095, 140239246.0954749, 48980319.46389488, 0, 0, 0, 0, 0 },
-  { 140239272.29961836, 48980332.95081862, 140239256.2081619, 48980369.57137335, 140239288.39107484, 48980296.33026389, 140239271.49504554, 48980334.78184636, 140239273.10419118, 48980331.11979088, 1, 5, 140239230.05954513, 48980429.07977478, 25 },
-  { 140239299.381508, 48980344.850885436, 140239283.0484233, 48980381.364312336, 140239315.7145927, 48980308.337458536, 140239298.56485376, 48980346.67655678, 140239300.19816223, 48980343.02521409, 0, 0, 0, 0, 0 },
-  { 140239326.56208104, 48980357.00922387, 140239309.9882061, 48980393.4139855, 140239343.135956, 48980320.60446224, 140239325.7333873, 48980358.829461955, 140239327.3907748, 48980355.18898579, 0, 0, 0, 0, 0 },
-  { 140239353.85474506, 48980369.4346644, 140239337.03862584, 48980405.728164285, 140239370.67086428, 48980333.14116451, 140239353.0139391, 48980371.249339394, 140239354.695551, 48980367.6199894, 0, 0, 0, 0, 0 },
-  { 140239381.27078265, 48980382.137527406, 140239363.97619542, 48980418.20548067, 140239398.56536987, 48980346.06957414, 140239380.40605327, 48980383.94092507, 140239382.13551202, 48980380.33412974, 0, 0, 0, 0, 0 },
-  { 140239408.63516328, 48980395.25875068, 140239390.21178302, 48980430.76338503, 140239427.05854353, 48980359.75411633, 140239407.71399426, 48980397.033982396, 140239409.5563323, 48980393.48351896, 1, 1, 140239468.05056456, 48980280.7563049, 39 },
-  { 140239435.44395578, 48980409.169852346, 140239415.19391313, 48980443.66529804, 140239455.69399843, 48980374.674406655, 140239434.43145365, 48980410.89462463, 140239436.4564579, 48980407.445080064, 0, 0, 0, 0, 0 },
-  { 140239461.15966573, 48980424.26588061, 140239438.38971567, 48980457.15249452, 140239483.9296158, 48980391.379266694, 140239460.02116823, 48980425.9102113, 140239462.29816324, 48980422.62154991, 1, 4, 140239647.3040074, 48980155.41781187, 43 },
-  { 140239485.24479863, 48980440.94188363, 140239459.3214982, 48980471.40468872, 140239511.16809908, 48980410.47907854, 140239483.9486336, 48980442.46502388, 140239486.54096365, 48980439.41874338, 1, 3, 140239380.25543183, 48980564.31624425, 32 },
-  { 140239507.16186008, 48980459.5929096, 140239477.63525683, 48980486.57771459, 140239536.68846333, 48980432.6081046, 140239505.68552992, 48980460.94214985, 140239508.63819024, 48980458.243669346, 0, 0, 0, 0, 0 },
-  { 140239526.3733556, 48980480.61400669, 140239493.16294435, 48980502.90904168, 140239559.58376685, 48980458.3189717, 140239524.71283504, 48980481.72875844, 140239528.03387615, 48980479.49925494, 0, 0, 0, 0, 0 },
-  { 140239542.3408308, 48980504.39896233, 140239505.838611, 48980520.75707805, 140239578.8430506, 48980488.0408466, 140239540.5157198, 48980505.21686811, 140239544.1659418, 48980503.58105654, 0, 0, 0, 0, 0 },
-  { 140239554.25621167, 48980530.98746791, 140239515.22707137, 48980539.74681766, 140239593.28535196, 48980522.22811815, 140239552.30475464, 48980531.425435394, 140239556.2076687, 48980530.54950042, 0, 0, 0, 0, 0 },
-  { 140239560.67361495, 48980559.58156906, 140239520.67860204, 48980558.949950755, 140239600.66862786, 48980560.21318737, 140239558.6738643, 48980559.54998814, 140239562.6733656, 48980559.61314998, 0, 0, 0, 0, 0 },
-  { 140239560.20643124, 48980589.164337955, 140239521.50976878, 48980579.03673635, 140239598.9030937, 48980599.291939564, 140239558.27159813, 48980588.657957874, 140239562.14126435, 48980589.67071804, 0, 0, 0, 0, 0 },
-  { 140239552.6756833, 48980617.93865419, 140239517.63165116, 48980598.65353528, 140239587.71971542, 48980637.22377311, 140239550.92348167, 48980616.97439825, 140239554.4278849, 48980618.902910136, 1, 1, 140239881.2134846, 48980798.736644015, 47 },
-  { 140239538.48014, 48980643.73414332, 140239509.85949653, 48980615.79029304, 140239567.10078347, 48980671.677993596, 140239537.04910782, 48980642.3369508, 140239539.91117218, 48980645.13133583, 0, 0, 0, 0, 0 },
-  { 140239518.13738632, 48980664.56959348, 140239497.1485595, 48980630.5186148, 140239539.12621313, 48980698.620572165, 140239517.08794498, 48980662.867044546, 140239519.18682766, 48980666.27214242, 0, 0, 0, 0, 0 },
-  { 140239493.09326267, 48980680.00664681, 140239479.16550848, 48980642.50974476, 140239507.02101687, 48980717.50354886, 140239492.39687496, 48980678.13180171, 140239493.78965038, 48980681.881491914, 0, 0, 0, 0, 0 },
-  { 140239465.24172163, 48980690.35175258, 140239457.6214425, 48980651.08431892, 140239472.86200076, 48980729.61918624, 140239464.86070767, 48980688.3883809, 140239465.6227356, 48980692.31512426, 1, 2, 140239501.81906143, 48980878.83543414, 29 },
-  { 140239436.41184437, 48980695.94650862, 140239434.1657526, 48980656.00962002, 140239438.65793616, 48980735.88339723, 140239436.29953977, 48980693.94966419, 140239436.52414897, 48980697.94335306, 1, 2, 140239430.01048276, 48980582.12637609, 41 },
-  { 140239407.44221595, 48980697.5757904, 140239409.11591706, 48980657.61082168, 140239405.76851484, 48980737.54075912, 140239407.525901, 48980695.57754196, 140239407.3585309, 48980699.57403883, 0, 0, 0, 0, 0 },
-  { 140239378.42080593, 48980696.36039683, 140239382.44244877, 48980656.56308048, 140239374.3991631, 48980736.15771318, 140239378.62188807, 48980694.370531015, 140239378.2197238, 48980698.35026265, 1, 0, 140239392.0943916, 48980561.04952124, 47 },
-  { 140239349.4169486, 48980693.42946666, 140239354.4322677, 48980653.74513002, 140239344.40162948, 48980733.1138033, 140239349.66771454, 48980691.445249826, 140239349.16618264, 48980695.41368349, 1, 3, 140239305.1567575, 48981043.64373748, 46 },
-  { 140239320.49183977, 48980689.77390219, 140239326.16284847, 48980650.17794709, 140239314.82083106, 48980729.3698573, 140239320.7753902, 48980687.794104435, 140239320.20828933, 48980691.75369995, 0, 0, 0, 0, 0 },
-  { 140239291.66313177, 48980685.644999295, 140239297.9835658, 48980646.14750427, 140239285.34269774, 48980725.14249432, 140239291.97915348, 48980683.670124546, 140239291.34711006, 48980687.619874045, 1, 2, 140239257.37477708, 48980899.918909825, 44 },
-  { 140239262.93397415, 48980681.04772684, 140239269.89754593, 48980641.65853203, 140239255.97040236, 48980720.43692165, 140239263.28215274, 48980679.0782671, 140239262.58579555, 48980683.01718658, 0, 0, 0, 0, 0 },
-  { 140239234.30750686, 48980675.98688563, 140239241.9077007, 48980636.71555953, 140239226.70731303, 48980715.25821173, 140239234.68751654, 48980674.02331933, 140239233.92749718, 48980677.95045193, 0, 0, 0, 0, 0 },
-  { 140239205.78686976, 48980670.46727649, 140239214.01696232, 48980631.32311247, 140239197.5567772, 48980709.61144051, 140239206.1983744, 48980668.51006829, 140239205.37536514, 48980672.42448469, 0, 0, 0, 0, 0 },
-  { 140239177.3752027, 48980664.49370022, 140239186.228283, 48980625.48571426, 140239168.52212238, 48980703.501686186, 140239177.8178567, 48980662.54330092, 140239176.93254867, 48980666.44409952, 0, 0, 0, 0, 0 },
-  { 140239149.07564554, 48980658.07095765, 140239158.5446348, 48980619.20788723, 140239139.60665628, 48980696.934028074, 140239149.549095, 48980656.12780413, 140239148.60219607, 48980660.014111176, 1, 0, 140239213.70149714, 48980392.83050202, 37 },
-  { 140239120.8913383, 48980651.20384964, 140239130.96900907, 48980612.494153805, 140239110.8136675, 48980689.91354548, 140239121.39522183, 48980649.268364854, 140239120.38745475, 48980653.13933443, 0, 0, 0, 0, 0 },
-  { 140239092.82542065, 48980643.89717694, 140239103.5044155, 48980605.34903731, 140239082.14642578, 48980682.445316575, 140239093.35937038, 48980641.96976996, 140239092.29147092, 48980645.824583925, 1, 2, 140239134.20652568, 48980494.52313588, 31 },
-  { 140239064.88103265, 48980636.15574043, 140239076.1538823, 48980597.777063265, 140239053.608183, 48980674.5344176, 140239065.44467512, 48980634.23680657, 140239064.31739017, 48980638.07467429, 1, 4, 140238959.47988853, 48980994.99637194, 42 },
-  { 140239037.06131405, 48980627.9843409, 140239048.92045477, 48980589.782760024, 140239025.20217332, 48980666.18592177, 140239037.6542711, 48980626.07426185, 140239036.468357, 48980629.894419946, 0, 0, 0, 0, 0 },
-  { 140239009.3694048, 48980619.38777916, 140239021.80719513, 48980581.37065971, 140238996.93161446, 48980657.40489861, 140239009.9912943, 48980617.48692319, 140239008.7475153, 48980621.288635135, 1, 5, 140238938.16305515, 48980837.035788044, 41 },
-  { 140238981.80844468, 48980610.37085605, 140238994.8171816, 48980572.54529902, 140238968.79970777, 48980648.19641307, 140238982.45888153, 48980608.4795782, 140238981.15800783, 48980612.2621339, 0, 0, 0, 0, 0 },
-  { 140238954.38157365, 48980600.93837236, 140238967.9356135, 48980563.30477031, 140238940.82753378, 48980638.571974404, 140238955.05927563, 48980599.05669226, 140238953.70387167, 48980602.82005246, 1, 4, 140238885.5948213, 48980791.92890276, 28 },
-  { 140238927.087313, 48980591.10812819, 140238941.04059198, 48980553.6207169, 140238913.134034, 48980628.59553948, 140238927.78497696, 48980589.23375762, 140238926.38964903, 48980592.98249876, 0, 0, 0, 0, 0 },
-  { 140238899.89288157, 48980580.98602384, 140238914.05117327, 48980543.57556039, 140238885.73458987, 48980618.396487296, 140238900.60079616, 48980579.11550067, 140238899.18496698, 48980582.85654701, 0, 0, 0, 0, 0 },
-  { 140238872.7525054, 48980570.71452952, 140238886.92275858, 48980533.30859517, 140238858.5822522, 48980608.12046387, 140238873.46101806, 48980568.844232805, 140238872.04399273, 48980572.58482624, 0, 0, 0, 0, 0 },
-  { 140238845.620368, 48980560.43623376, 140238859.6095038, 48980522.96218834, 140238831.6312322, 48980597.91027918, 140238846.31982478, 48980558.562531486, 140238844.92091122, 48980562.30993603, 1, 0, 140238724.6143434, 48980884.586726606, 33 },
-  { 140238818.45065323, 48980550.29372512, 140238832.06418228, 48980512.68160172, 140238804.83712417, 48980587.90584852, 140238819.1313297, 48980548.41311895, 140238817.76997676, 48980552.174331285, 0, 0, 0, 0, 0 },
-  { 140238791.1975447, 48980540.4295922, 140238804.23839366, 48980502.615094215, 140238778.15669572, 48980578.244090185, 140238791.84958714, 48980538.5388673, 140238790.54550225, 48980542.3203171, 0, 0, 0, 0, 0 },
-  { 140238763.81522608, 48980530.98642356, 140238776.0830104, 48980492.91410464, 140238751.54744175, 48980569.05874248, 140238764.4286153, 48980529.082807615, 140238763.20183685, 48980532.8900395, 0, 0, 0, 0, 0 },
-  { 140238736.25788116, 48980522.10680778, 140238747.54888132, 48980483.73346658, 140238724.966881, 48980560.480148986, 140238736.82243118, 48980520.18814072, 140238735.69333115, 48980524.02547485, 0, 0, 0, 0, 0 },
-  { 140238708.47969356, 48980513.93333341, 140238718.59425253, 48980475.233259805, 140238698.3651346, 48980552.63340702, 140238708.9854215, 48980511.99832973, 140238707.97396562, 48980515.868337095, 0, 0, 0, 0, 0 },
-  { 140238680.438042, 48980506.60443422, 140238689.26868263, 48980467.59136223, 140238671.6074014, 48980545.61750621, 140238680.87957403, 48980504.653780624, 140238679.99651, 48980508.55508782, 1, 4, 140238602.94917068, 48980848.94414098, 50 },
-  { 140238652.13657388, 48980500.19837387, 140238659.64413682, 48980460.909234166, 140238644.62901095, 48980539.48751357, 140238652.511952, 48980498.233916886, 140238651.76119575, 48980502.16283085, 0, 0, 0, 0, 0 },
-  { 140238623.61378437, 48980494.74809833, 140238629.75866148, 48980455.222910345, 140238617.46890727, 48980534.27328631, 140238623.92102823, 48980492.771838926, 140238623.30654052, 48980496.72435773, 1, 1, 140238571.6895729, 48980828.73593683, 29 },
-  { 140238594.90902162, 48980490.285444304, 140238599.64973226, 48980450.567367025, 140238590.16831097, 48980530.003521584, 140238595.14605716, 48980488.29954044, 140238594.67198607, 48980492.27134817, 1, 0, 140238614.22741744, 48980328.4342794, 44 },
-  { 140238566.0616341, 48980486.84224851, 140238569.3552081, 48980446.97807449, 140238562.7680601, 48980526.70642252, 140238566.2263128, 48980484.84903981, 140238565.8969554, 48980488.835457206, 0, 0, 0, 0, 0 },
-  { 140238537.11096984, 48980484.450347565, 140238538.91357535, 48980444.49098554, 140238535.30836433, 48980524.40970959, 140238537.2011001, 48980482.452379465, 140238537.02083957, 48980486.448315665, 1, 4, 140238551.30648825, 48980169.77037162, 38 },
-  { 140238508.09640133, 48980483.14147229, 140238508.3828374, 48980443.14249787, 140238507.80996525, 48980523.14044671, 140238508.11072314, 48980481.14152357, 140238508.08207953, 48980485.141421005, 1, 1, 140238506.9148525, 48980648.13724176, 29 },
-  { 140238479.06045535, 48980482.93354339, 140238477.8426695, 48980442.95208522, 140238480.27824122, 48980522.915001564, 140238478.99956605, 48980480.93447048, 140238479.12134466, 48980484.9326163, 1, 1, 140238469.6835043, 48980175.07631546, 45 },
-  { 140238450.05191106, 48980483.817107834, 140238447.34500143, 48980443.90880494, 140238452.75882068, 48980523.72541073, 140238449.91656557, 48980481.82169269, 140238450.18725654, 48980485.81252298, 1, 4, 140238466.63173258, 48980728.255463086, 37 },
-  { 140238421.12028393, 48980485.77948896, 140238416.937816, 48980445.99875289, 140238425.30275187, 48980525.560225025, 140238420.91116053, 48980483.79045215, 140238421.32940733, 48980487.768525764, 0, 0, 0, 0, 0 },
-  { 140238392.31508946, 48980488.808010146, 140238386.70902044, 48980449.202808596, 140238397.9211585, 48980528.413211696, 140238392.03478602, 48980486.82775007, 140238392.5953929, 48980490.78827022, 1, 2, 140238419.92497942, 48980683.8636278, 46 },
-  { 140238363.6726178, 48980492.86231784, 140238356.86469117, 48980453.4459236, 140238370.48054442, 48980532.27871208, 140238363.33222145, 48980490.891498126, 140238364.01301414, 48980494.83313755, 0, 0, 0, 0, 0 },
-  { 140238335.1730816, 48980497.78470495, 140238327.4302549, 48980458.541251555, 140238342.9159083, 48980537.02815835, 140238334.78594026, 48980495.82253228, 140238335.56022295, 48980499.746877626, 0, 0, 0, 0, 0 },
-  { 140238306.78183305, 48980503.38636583, 140238298.36889225, 48980464.28109218, 140238315.19477385, 48980542.49163948, 140238306.36118603, 48980501.43110215, 140238307.20248008, 48980505.34162951, 0, 0, 0, 0, 0 },
-  { 140238278.46422437, 48980509.47849467, 140238269.64289823, 48980470.4633155, 140238287.2855505, 48980548.49367383, 140238278.02315807, 48980507.52773571, 140238278.90529066, 48980511.42925362, 0, 0, 0, 0, 0 },
-  { 140238250.18560782, 48980515.87228562, 140238241.21503264, 48980476.89115197, 140238259.156183, 48980554.85341927, 140238249.73707905, 48980513.923228934, 140238250.6341366, 48980517.821342304, 0, 0, 0, 0, 0 },
-  { 140238221.91133544, 48980522.37893288, 140238213.04932237, 48980483.372975335, 140238230.7733485, 48980561.38489042, 140238221.46823478, 48980520.428635, 140238222.3544361, 48980524.329230756, 0, 0, 0, 0, 0 },
-  { 140238193.60675952, 48980528.809630595, 140238185.11134487, 48980489.72219105, 140238202.10217416, 48980567.89707014, 140238193.18198878, 48980526.85525862, 140238194.03153026, 48980530.76400257, 0, 0, 0, 0, 0 },
-  { 140238165.23723212, 48980534.97557294, 140238157.36800942, 48980495.75726938, 140238173.10645482, 48980574.193876505, 140238164.84377098, 48980533.014657766, 140238165.63069326, 48980536.93648812, 1, 0, 140238225.83024687, 48980836.956510365, 30 },
-  { 140238136.76810542, 48980540.68795409, 140238129.78490466, 48980501.30223451, 140238143.75130618, 48980580.07367367, 140238136.41894537, 48980538.71866811, 140238137.11726546, 48980542.65724007, 1, 2, 140238109.18446246, 48980385.114361726, 36 },
-  { 140238108.16514358, 48980545.759341046, 140238102.22575393, 48980506.20275309, 140238114.10453323, 48980585.315929, 140238107.8681741, 48980543.78151165, 140238108.46211305, 48980547.73717044, 0, 0, 0, 0, 0 },
-  { 140238079.41621476, 48980550.07596943, 140238074.52485397, 48980510.37616351, 140238084.30757555, 48980589.77577534, 140238079.1716467, 48980548.09097913, 140238079.6607828, 48980552.06095973, 0, 0, 0, 0, 0 },
-  { 140238050.54202592, 48980553.63352021, 140238046.69055626, 48980513.81937471, 140238054.3934956, 48980593.44766571, 140238050.34945244, 48980551.64281293, 140238050.7345994, 48980555.62422749, 0, 0, 0, 0, 0 },
-  { 140238021.56594914, 48980556.436556146, 140238018.74646103, 48980516.5360488, 140238024.38543725, 48980596.33706349, 140238021.42497474, 48980554.44153078, 140238021.70692354, 48980558.43158151, 0, 0, 0, 0, 0 },
-  { 140237992.5113562, 48980558.489639804, 140237990.71625027, 48980518.52994017, 140237994.30646214, 48980598.449339435, 140237992.4216009, 48980556.49165482, 140237992.6011115, 48980560.48762479, 1, 4, 140238001.7561517, 48980764.282092914, 42 },
-  { 140237963.40161914, 48980559.79733385, 140237962.6236774, 48980519.804899484, 140237964.17956087, 48980599.78976822, 140237963.36272204, 48980557.79771213, 140237963.44051623, 48980561.79695557, 1, 4, 140237958.09216684, 48980286.84896929, 48 },
-  { 140237934.26010984, 48980560.36420097, 140237934.49255562, 48980520.36487637, 140237934.02766407, 48980600.36352558, 140237934.27173212, 48980558.36423474, 140237934.24848756, 48980562.364167206, 0, 0, 0, 0, 0 },
-  { 140237905.11020032, 48980560.19480378, 140237906.34674758, 48980520.213921465, 140237903.87365305, 48980600.1756861, 140237905.17202768, 48980558.19575967, 140237905.04837295, 48980562.193847895, 0, 0, 0, 0, 0 },
-  { 140237875.9752624, 48980559.29370493, 140237878.21015546, 48980519.35618807, 140237873.74036935, 48980599.23122179, 140237876.08700705, 48980557.29682908, 140237875.86351776, 48980561.29058077, 1, 0, 140237866.19760525, 48980734.020341195, 28 },
-  { 140237846.87866813, 48980557.665467076, 140237850.10671216, 48980517.795933194, 140237843.6506241, 48980597.53500096, 140237847.04007033, 48980555.67199038, 140237846.71726593, 48980559.65894377, 1, 0, 140237868.42586204, 48980291.536328435, 44 },
-  { 140237817.8437894, 48980555.31465286, 140237822.06037185, 48980515.537518315, 140237813.62720695, 48980595.091787405, 140237818.0546185, 48980553.325796135, 140237817.6329603, 48980557.303509586, 0, 0, 0, 0, 0 },
-  { 140237788.89399812, 48980552.24582493, 140237794.0951017, 48980512.585409895, 140237783.69289452, 48980591.90623997, 140237789.1540533, 48980550.26280418, 140237788.63394293, 48980554.228845686, 1, 5, 140237804.36728135, 48980434.25609018, 27 },
-  { 140237760.05266628, 48980548.46354593, 140237766.23487374, 48980508.94417966, 140237753.8704588, 48980587.982912205, 140237760.36177665, 48980546.48757762, 140237759.7435559, 48980550.43951425, 0, 0, 0, 0, 0 },
-  { 140237731.34316576, 48980543.97237855, 140237738.5005643, 48980504.617942385, 140237724.1857672, 48980583.32681472, 140237731.70103568, 48980542.00465675, 140237730.98529583, 48980545.94010036, 0, 0, 0, 0, 0 },
-  { 140237702.78537023, 48980538.77856703, 140237710.90038136, 48980499.610383585, 140237694.6703591, 48980577.94675048, 140237703.19112077, 48980536.820157856, 140237702.3796197, 48980540.73697621, 1, 5, 140237633.19914985, 48980874.64574008, 26 },
-  { 140237674.38599885, 48980532.89467877, 140237683.43749723, 48980493.93225615, 140237665.33450046, 48980571.857101396, 140237674.83857375, 48980530.94655764, 140237673.93342394, 48980534.8427999, 1, 3, 140237761.50667086, 48980157.881361, 48 },
-  { 140237646.14867964, 48980526.33476714, 140237656.11480004, 48980487.5962018, 140237636.18255925, 48980565.07333248, 140237646.64698565, 48980524.397838876, 140237645.65037364, 48980528.271695405, 1, 0, 140237577.63160202, 48980792.662403844, 37 },
-  { 140237618.07704058, 48980519.11288549, 140237628.9353323, 48980480.61486605, 140237607.21874887, 48980557.61090493, 140237618.61995518, 48980517.18798452, 140237617.53412598, 48980521.03778646, 1, 5, 140237645.7656845, 48980420.94293592, 26 },
-  { 140237590.17470968, 48980511.243087165, 140237601.9023988, 48980473.00094669, 140237578.44702056, 48980549.48522764, 140237590.76109412, 48980509.330980144, 140237589.58832523, 48980513.155194186, 1, 3, 140237481.9867775, 48980864.02683301, 45 },
-  { 140237562.44538963, 48980502.73935696, 140237575.027737, 48980464.76983582, 140237549.86304227, 48980540.70887809, 140237563.074507, 48980500.8408809, 140237561.81627226, 48980504.637833014, 1, 5, 140237645.8034408, 48980251.19127944, 45 },
-  { 140237534.89815795, 48980493.61074993, 140237548.33417752, 48980455.93485076, 140237521.46213838, 48980531.2866491, 140237535.56995893, 48980491.726954974, 140237534.22635698, 48980495.494544886, 1, 3, 140237460.32824934, 48980702.71199031, 36 },
-  { 140237507.5509794, 48980483.85816979, 140237521.8410657, 48980446.49785082, 140237493.2608931, 48980521.21848875, 140237508.2654837, 48980481.99015384, 140237506.8364751, 48980485.72618573, 1, 4, 140237575.78614154, 48980305.46264673, 46 },
-  { 140237480.4226522, 48980473.48175578, 140237495.567231, 48980436.459576845, 140237465.27807343, 48980510.50393471, 140237481.17988116, 48980471.63064683, 140237479.66542327, 48980475.332864724, 0, 0, 0, 0, 0 },
-  { 140237453.5319746, 48980462.48164726, 140237469.53143448, 48980425.82080597, 140237437.53251475, 48980499.142488554, 140237454.3319476, 48980460.6486052, 140237452.73200163, 48980464.31468932, 0, 0, 0, 0, 0 },
-  { 140237426.89774472, 48980450.85798351, 140237443.75236312, 48980414.58234653, 140237410.0431263, 48980487.133620486, 140237427.74047562, 48980449.04420166, 140237426.0550138, 48980452.67176536, 0, 0, 0, 0, 0 },
-  { 140237400.53876072, 48980438.61090382, 140237418.2486248, 48980402.74503265, 140237382.82889664, 48980474.47677499, 140237401.4242539, 48980436.817610264, 140237399.65326753, 48980440.40419738, 0, 0, 0, 0, 0 },
-  { 140237374.47382087, 48980425.74054749, 140237393.03874254, 48980390.30971793, 140237355.9088992, 48980461.171377055, 140237375.40206695, 48980423.96900602, 140237373.54557478, 48980427.51208897, 1, 3, 140237263.54841387, 48980637.43975412, 40 },
-  { 140237348.72172332, 48980412.24705384, 140237368.14114934, 48980377.2772684, 140237329.3022973, 48980447.216839276, 140237349.6926946, 48980410.49856457, 140237347.75075203, 48980413.99554311, 0, 0, 0, 0, 0 },
-  { 140237323.30126622, 48980398.13056214, 140237343.5741829, 48980363.64855452, 140237303.02834955, 48980432.612569764, 140237324.31491205, 48980396.40646176, 140237322.2876204, 48980399.85466252, 0, 0, 0, 0, 0 },
-  { 140237298.23124784, 48980383.391211726, 140237319.3576276, 48980349.42540424, 140237277.10486808, 48980417.35701921, 140237299.28756684, 48980381.69292135, 140237297.17492884, 48980385.0895021, 1, 0, 140237477.27731636, 48980095.530993305, 25 },
-  { 140237273.53143904, 48980368.02818698, 140237295.6140243, 48980334.67613415, 140237251.44885376, 48980401.38023981, 140237274.6355683, 48980366.36058433, 140237272.42730978, 48980369.69578962, 0, 0, 0, 0, 0 },
-  { 140237249.28741068, 48980351.97607689, 140237272.5887031, 48980319.46377504, 140237225.98611826, 48980384.48837875, 140237250.4524753, 48980350.3504618, 140237248.12234604, 48980353.60169198, 0, 0, 0, 0, 0 },
-  { 140237225.6912479, 48980335.064906135, 140237250.47019726, 48980303.664210774, 140237200.91229856, 48980366.4656015, 140237226.9301954, 48980333.49487137, 140237224.45230043, 48980336.6349409, 0, 0, 0, 0, 0 },
-  { 140237202.9447483, 48980317.115164734, 140237229.42879927, 48980287.1385898, 140237176.46069735, 48980347.09173967, 140237204.26895085, 48980315.61633599, 140237201.62054577, 48980318.61399348, 0, 0, 0, 0, 0 },
-  { 140237181.24951667, 48980297.947610684, 140237209.50870556, 48980269.63827929, 140237152.99032778, 48980326.25694208, 140237182.66247612, 48980296.532144114, 140237179.8365572, 48980299.36307725, 0, 0, 0, 0, 0 },
-  { 140237160.74083778, 48980277.475257516, 140237190.55724615, 48980250.8110157, 140237130.92442942, 48980304.13949933, 140237162.2316582, 48980276.14204542, 140237159.25001737, 48980278.80846961, 0, 0, 0, 0, 0 },
-  { 140237141.3909664, 48980255.83790245, 140237172.5310204, 48980230.73218526, 140237110.25091237, 48980280.94361964, 140237142.94796908, 48980254.58261659, 140237139.8339637, 48980257.09318831, 0, 0, 0, 0, 0 },
-  { 140237123.1475581, 48980233.20956184, 140237155.4063414, 48980209.55853861, 140237090.88877478, 48980256.86058507, 140237124.76049727, 48980232.02701068, 140237121.5346189, 48980234.392113, 1, 5, 140237230.40801257, 48980154.56990959, 44 },
-  { 140237105.9582685, 48980209.76425198, 140237139.1641438, 48980187.46246179, 140237072.7523932, 48980232.06604216, 140237107.61856225, 48980208.64916247, 140237104.29797474, 48980210.87934148, 0, 0, 0, 0, 0 },
-  { 140237089.77011317, 48980185.66117045, 140237123.80275166, 48980164.64261873, 140237055.73747468, 48980206.679722175, 140237091.4717451, 48980184.610242866, 140237088.06848124, 48980186.71209804, 0, 0, 0, 0, 0 },
-  { 140237074.5266462, 48980160.97938419, 140237109.28508478, 48980141.18415883, 140237039.7682076, 48980180.77460955, 140237076.26456812, 48980159.98962292, 140237072.78872427, 48980161.96914546, 1, 3, 140236853.81056118, 48980286.67906524, 25 },
-  { 140237060.17025718, 48980135.770999, 140237095.5615281, 48980117.1307752, 140237024.77898628, 48980154.4112228, 140237061.93982074, 48980134.83898781, 140237058.40069363, 48980136.70301019, 1, 3, 140237208.813595, 48980057.48205905, 34 },
-  { 140237046.64333475, 48980110.08810046, 140237082.58280239, 48980092.528070085, 140237010.7038671, 48980127.64813084, 140237048.44030812, 48980109.210098945, 140237044.84636137, 48980110.96610198, 1, 3, 140236752.83818692, 48980253.64134878, 28 },
-  { 140237033.88826758, 48980083.982774116, 140237070.29959548, 48980067.42332968, 140236997.47693968, 48980100.54221855, 140237035.70883396, 48980083.1548019, 140237032.0677012, 48980084.810746334, 1, 3, 140237191.36726078, 48980012.36317692, 38 },
-  { 140237021.84744436, 48980057.50710555, 140237058.66227734, 48980041.86523635, 140236985.03261137, 48980073.148974754, 140237023.68818602, 48980056.725012094, 140237020.0067027, 48980058.28919901, 0, 0, 0, 0, 0 },
-  { 140237010.4632538, 48980030.71318031, 140237047.6206975, 48980015.90357605, 140236973.3058101, 48980045.52278457, 140237012.32112598, 48980029.9727001, 140237008.6053816, 48980031.453660525, 0, 0, 0, 0, 0 },
-  { 140236999.67808458, 48980003.65308399, 140237037.12405127, 48979989.58896015, 140236962.2321179, 48980017.71720783, 140237001.5503829, 48980002.9498778, 140236997.80578625, 48980004.35629018, 1, 0, 140236754.40700284, 48980095.773095146, 50 },
-  { 140236989.43432522, 48979976.37890209, 140237027.1207992, 48979962.9725723, 140236951.74785122, 48979989.78523189, 140236991.3186489, 48979975.708585605, 140236987.55000153, 48979977.04921858, 0, 0, 0, 0, 0 },
-  { 140236979.6743646, 48979948.94272026, 140237017.55817255, 48979936.10460925, 140236941.79055664, 48979961.78083126, 140236981.568555, 48979948.3008147, 140236977.7801742, 48979949.58462581, 0, 0, 0, 0, 0 },
-  { 140236970.33925843, 48979921.395881854, 140237008.3740769, 48979909.01232081, 140236932.30443996, 48979933.7794429, 140236972.24099934, 48979920.776703805, 140236968.43751752, 48979922.0150599, 0, 0, 0, 0, 0 },
-  { 140236961.34691772, 48979893.77684357, 140236999.48413515, 48979881.71232345, 140236923.2097003, 48979905.84136369, 140236963.25377858, 48979893.173617564, 140236959.44005686, 48979894.380069576, 0, 0, 0, 0, 0 },
-  { 140236952.59564292, 48979866.11314319, 140236990.7896757, 48979854.22971531, 140236914.40161014, 48979877.99657107, 140236954.50534457, 48979865.51897179, 140236950.68594128, 48979866.70731459, 1, 1, 140237282.97402668, 48979763.32149201, 28 },
-  { 140236943.9831147, 48979838.431973316, 140236982.19020718, 48979826.590601616, 140236905.7760222, 48979850.273345016, 140236945.8934693, 48979837.83990473, 140236942.07276008, 48979839.0240419, 1, 5, 140236596.29857305, 48979946.188455775, 30 },
-  { 140236935.40701362, 48979810.76052655, 140236973.5837725, 48979798.82172083, 140236897.23025474, 48979822.699332274, 140236937.31585157, 48979810.16358627, 140236933.49817568, 48979811.35746684, 0, 0, 0, 0, 0 },
-  { 140236926.76502025, 48979783.125995524, 140236964.86692935, 48979770.9504248, 140236888.66311115, 48979795.30156625, 140236928.6701157, 48979782.51721699, 140236924.8599248, 48979783.73477406, 0, 0, 0, 0, 0 },
-  { 140236917.9548152, 48979755.555572815, 140236955.93476468, 48979743.00473865, 140236879.97486573, 48979768.10640698, 140236919.8538127, 48979754.92803111, 140236916.05581772, 48979756.18311452, 1, 1, 140237138.23852214, 48979682.760734655, 42 },
-  { 140236908.87407905, 48979728.07645103, 140236946.68094805, 48979715.01350125, 140236871.06721005, 48979741.13940082, 140236910.7644225, 48979727.423303545, 140236906.9837356, 48979728.72959852, 1, 4, 140236590.3512078, 48979838.13180296, 37 },
-  { 140236899.42049238, 48979700.7158228, 140236936.99783432, 48979687.006578766, 140236861.84315044, 48979714.425066836, 140236901.29935947, 48979700.0303606, 140236897.5416253, 48979701.401285, 1, 2, 140237052.54816082, 48979644.85065334, 38 },
-  { 140236889.49173576, 48979673.500880696, 140236926.77663034, 48979659.01514166, 140236852.20684117, 48979687.98661973, 140236891.3559805, 48979672.776593745, 140236887.62749103, 48979674.22516765, 0, 0, 0, 0, 0 },
-  { 140236878.98548982, 48979646.45881736, 140236915.9085115, 48979631.07406938, 140236842.06246814, 48979661.843565345, 140236880.8316409, 48979645.68957996, 140236877.13933873, 48979647.22805476, 0, 0, 0, 0, 0 },
-  { 140236867.801508, 48979619.61753253, 140236904.30489582, 48979603.26202342, 140236831.2981202, 48979635.97304164, 140236869.6266774, 48979618.79975707, 140236865.97633862, 48979620.43530799, 1, 1, 140236776.5430385, 48979660.506305315, 26 },
-  { 140236855.88447627, 48979593.02025402, 140236891.92385954, 48979575.66620968, 140236819.845093, 48979610.374298364, 140236857.68644544, 48979592.15255181, 140236854.0825071, 48979593.88795624, 1, 3, 140237160.41726473, 48979446.37857934, 43 },
-  { 140236843.22253937, 48979566.725035, 140236878.7498347, 48979548.34539171, 140236807.69524404, 48979585.10467828, 140236844.99890414, 48979565.806052834, 140236841.4461746, 48979567.64401716, 0, 0, 0, 0, 0 },
-  { 140236829.80562004, 48979540.790535204, 140236864.76788956, 48979521.35758098, 140236794.84335053, 48979560.223489426, 140236831.55373353, 48979539.818887495, 140236828.05750656, 48979541.76218291, 0, 0, 0, 0, 0 },
-  { 140236815.62364095, 48979515.275414355, 140236849.96270636, 48979494.76130734, 140236781.28457555, 48979535.789521374, 140236817.34059423, 48979514.249709, 140236813.90668768, 48979516.30111971, 0, 0, 0, 0, 0 },
-  { 140236800.666525, 48979490.23833219, 140236834.3186093, 48979468.61572311, 140236767.01444072, 48979511.86094127, 140236802.34912923, 48979489.15720174, 140236798.98392078, 48979491.31946264, 0, 0, 0, 0, 0 },
-  { 140236784.92419487, 48979465.737948425, 140236817.81961623, 48979442.9807242, 140236752.02877352, 48979488.49517265, 140236786.56896594, 48979464.60008721, 140236783.2794238, 48979466.87580964, 1, 1, 140236559.59055865, 48979621.62493437, 42 },
-  { 140236768.38657334, 48979441.8329228, 140236800.44952077, 48979417.9170828, 140236736.32362592, 48979465.7487628, 140236769.9897207, 48979440.637130804, 140236766.783426, 48979443.0287148, 0, 0, 0, 0, 0 },
-  { 140236751.04358318, 48979418.581915036, 140236782.19201174, 48979393.48658883, 140236719.89515463, 48979443.67724124, 140236752.6010046, 48979417.32714873, 140236749.48616177, 48979419.83668134, 0, 0, 0, 0, 0 },
-  { 140236732.88514715, 48979396.04358487, 140236763.03324974, 48979369.75495785, 140236702.73704457, 48979422.33221189, 140236734.3925523, 48979394.729153514, 140236731.37774202, 48979397.35801622, 0, 0, 0, 0, 0 },
-  { 140236713.90268075, 48979374.274272084, 140236743.0189109, 48979346.847184345, 140236684.7864506, 48979401.70135982, 140236715.35849226, 48979372.9029177, 140236712.44686925, 48979375.64562647, 0, 0, 0, 0, 0 },
-  { 140236694.1225681, 48979353.27596858, 140236722.24285808, 48979324.82866131, 140236666.00227812, 48979381.723275855, 140236695.5285826, 48979351.85360322, 140236692.7165536, 48979354.69833394, 0, 0, 0, 0, 0 },
-  { 140236673.6065194, 48979332.99576303, 140236700.781553, 48979303.64414385, 140236646.4314858, 48979362.34738222, 140236674.9652711, 48979331.528182074, 140236672.24776772, 48979334.46334399, 0, 0, 0, 0, 0 },
-  { 140236652.41780895, 48979313.37831315, 140236678.70837656, 48979283.23190283, 140236626.12724134, 48979343.52472346, 140236653.73233733, 48979311.87099263, 140236651.10328057, 48979314.88563366, 0, 0, 0, 0, 0 },
-  { 140236630.61971122, 48979294.368276596, 140236656.09472662, 48979263.52960623, 140236605.14469582, 48979325.20694696, 140236631.893462, 48979292.826343074, 140236629.34596044, 48979295.91021012, 1, 0, 140236561.83716962, 48979377.63268657, 26 },
-  { 140236608.27550045, 48979275.91031109, 140236633.01023754, 48979244.474777356, 140236583.54076335, 48979307.34584482, 140236609.5122373, 48979274.3385344, 140236607.03876358, 48979277.482087776, 0, 0, 0, 0, 0 },
-  { 140236585.44845104, 48979257.94907428, 140236609.5230419, 48979226.0051535, 140236561.37386018, 48979289.89299507, 140236586.65218058, 48979256.35187824, 140236584.2447215, 48979259.546270326, 1, 5, 140236363.3603504, 48979552.63174352, 48 },
-  { 140236562.20183733, 48979240.429223865, 140236585.70004407, 48979208.058955416, 140236538.7036306, 48979272.799492314, 140236563.37674767, 48979238.810710445, 140236561.026927, 48979242.047737285, 0, 0, 0, 0, 0 },
-  { 140236538.59893364, 48979223.295417525, 140236561.60718238, 48979190.57507997, 140236515.5906849, 48979256.01575508, 140236539.74934608, 48979221.65940065, 140236537.4485212, 48979224.9314344, 0, 0, 0, 0, 0 },
-  { 140236514.7030144, 48979206.49231295, 140236537.3096656, 48979173.493232325, 140236492.09636322, 48979239.49139358, 140236515.83334696, 48979204.842358924, 140236513.57268184, 48979208.14226698, 1, 3, 140236629.43176916, 48979039.02197878, 36 },
-  { 140236490.5773538, 48979189.96456783, 140236512.87217656, 48979156.75401411, 140236468.28253105, 48979223.17512155, 140236491.69209495, 48979188.30404015, 140236489.46261266, 48979191.62509552, 0, 0, 0, 0, 0 },
-  { 140236466.28522632, 48979173.65683983, 140236488.35903832, 48979140.29897983, 140236444.2114143, 48979207.01469983, 140236467.3889169, 48979171.98894683, 140236465.18153572, 48979175.32473283, 0, 0, 0, 0, 0 },
-  { 140236441.88990632, 48979157.513786666, 140236463.83434206, 48979124.07067468, 140236419.94547057, 48979190.95689865, 140236442.9871281, 48979155.84163107, 140236440.79268453, 48979159.18594226, 1, 3, 140236291.0219105, 48979387.43518158, 42 },
-  { 140236417.45466807, 48979141.480066, 140236439.36107588, 48979108.01203203, 140236395.54826027, 48979174.94809997, 140236418.54998848, 48979139.8066643, 140236416.35934767, 48979143.1534677, 0, 0, 0, 0, 0 },
-  { 140236393.0421477, 48979125.50091924, 140236414.95072058, 48979092.03430252, 140236371.1335748, 48979158.96753596, 140236394.13757634, 48979123.8275884, 140236391.94671905, 48979127.174250074, 0, 0, 0, 0, 0 },
-  { 140236368.68069273, 48979109.5529459, 140236390.55480704, 48979076.06379656, 140236346.80657843, 48979143.04209524, 140236369.77439845, 48979107.87848843, 140236367.58698702, 48979111.227403365, 1, 4, 140236561.1728986, 48978814.84843171, 38 },
-  { 140236344.34768826, 48979093.65935255, 140236366.1441918, 48979060.11963828, 140236322.5511847, 48979127.19906682, 140236345.43751344, 48979091.98236684, 140236343.25786307, 48979095.33633826, 1, 2, 140236173.79004806, 48979356.10761672, 50 },
-  { 140236320.01638132, 48979077.847130254, 140236341.69178513, 48979044.22902695, 140236298.34097752, 48979111.46523356, 140236321.1001515, 48979076.16622509, 140236318.93261114, 48979079.52803542, 1, 1, 140236439.23110226, 48978892.947562076, 34 },
-  { 140236295.66001868, 48979062.14327002, 140236317.17046356, 48979028.419379964, 140236274.1495738, 48979095.86716008, 140236296.73554093, 48979060.45707552, 140236294.58449644, 48979063.829464525, 1, 1, 140236134.86944315, 48979314.229348205, 44 },
-  { 140236271.25184745, 48979046.57476291, 140236292.55308008, 48979012.718338296, 140236249.9506148, 48979080.431187525, 140236272.31690907, 48979044.881941676, 140236270.18678582, 48979048.267584145, 1, 4, 140236480.53645816, 48978713.93539105, 47 },
-  { 140236246.76511455, 48979031.16859997, 140236267.81247815, 48978997.15377253, 140236225.71775094, 48979065.18342741, 140236247.81748274, 48979029.4678586, 140236245.71274635, 48979032.86934134, 0, 0, 0, 0, 0 },
-  { 140236222.17306685, 48979015.95177224, 140236242.9215102, 48978981.75378839, 140236201.42462352, 48979050.1497561, 140236223.21048903, 48979014.24187305, 140236221.13564467, 48979017.66167144, 0, 0, 0, 0, 0 },
-  { 140236197.44895142, 48979000.95127075, 140236217.85305992, 48978966.54673098, 140236177.04484293, 48979035.35581052, 140236198.46915686, 48978999.23104376, 140236196.42874599, 48979002.67149774, 0, 0, 0, 0, 0 },
-  { 140236172.56601515, 48978986.194086544, 140236192.58006862, 48978951.56118796, 140236152.5519617, 48979020.82698513, 140236173.56671783, 48978984.462441616, 140236171.56531247, 48978987.92573147, 1, 4, 140236251.6215263, 48978849.394137144, 45 },
-  { 140236147.49750498, 48978971.707210675, 140236167.07556516, 48978936.82598994, 140236127.9194448, 48979006.58843141, 140236148.47640797, 48978969.96314964, 140236146.51860198, 48978973.45127171, 0, 0, 0, 0, 0 },
-  { 140236122.21666786, 48978957.51763417, 140236141.3076607, 48978922.3674707, 140236103.12567502, 48978992.66779764, 140236123.1712175, 48978955.760125995, 140236121.26211822, 48978959.27514234, 1, 2, 140236214.33070838, 48978787.91809543, 31 },
-  { 140236096.69567922, 48978943.65650342, 140236115.02937746, 48978908.10547658, 140236078.36198097, 48978979.20753025, 140236097.61236414, 48978941.87895207, 140236095.7789943, 48978945.43405476, 1, 0, 140235982.11006525, 48979165.850421146, 29 },
-  { 140236070.86070287, 48978930.33338163, 140236087.85196877, 48978894.12154816, 140236053.86943698, 48978966.5452151, 140236071.71026617, 48978928.522789955, 140236070.01113957, 48978932.143973306, 1, 2, 140236140.94967467, 48978780.95956856, 46 },
-  { 140236044.5754848, 48978917.99986835, 140236059.57917285, 48978880.920368016, 140236029.57179677, 48978955.07936868, 140236045.32566923, 48978916.14589333, 140236043.8253004, 48978919.85384337, 1, 2, 140235954.17826432, 48979141.40385786, 42 },
-  { 140236017.69932184, 48978907.124814436, 140236030.03197578, 48978869.07345905, 140236005.3666679, 48978945.17616982, 140236018.31595454, 48978905.22224667, 140236017.08268914, 48978909.0273822, 1, 0, 140236060.24697796, 48978775.84763836, 50 },
-  { 140235990.0916865, 48978898.177027695, 140235999.12382048, 48978859.210111536, 140235981.0595525, 48978937.14394385, 140235990.54329318, 48978896.228681885, 140235989.6400798, 48978900.125373505, 0, 0, 0, 0, 0 },
-  { 140235961.71593085, 48978891.59981675, 140235966.9731628, 48978851.94680283, 140235956.4586989, 48978931.25283066, 140235961.97879246, 48978889.61716605, 140235961.45306924, 48978893.582467444, 1, 3, 140235980.11624265, 48978752.81426805, 49 },
-  { 140235932.81434745, 48978887.76801905, 140235933.8064255, 48978847.78032368, 140235931.82226938, 48978927.755714424, 140235932.86395136, 48978885.76863428, 140235932.76474354, 48978889.76740382, 1, 2, 140235927.2091064, 48979113.6984979, 34 },
-  { 140235903.67556474, 48978887.04509799, 140235899.917832, 48978847.2219961, 140235907.4332975, 48978926.868199885, 140235903.4876781, 48978885.0539429, 140235903.86345136, 48978889.03625309, 0, 0, 0, 0, 0 },
-  { 140235874.59209457, 48978889.7894324, 140235865.87324274, 48978850.75122518, 140235883.3109464, 48978928.82763962, 140235874.15615198, 48978887.83752204, 140235875.02803716, 48978891.74134276, 1, 3, 140235919.27621016, 48979089.86024439, 39 },
-  { 140235845.99650335, 48978896.176014684, 140235832.35842198, 48978858.57278694, 140235859.63458472, 48978933.779242426, 140235845.31459928, 48978894.295853294, 140235846.67840743, 48978898.056176074, 1, 0, 140235804.05940315, 48978780.54608937, 45 },
-  { 140235818.4972254, 48978906.14955719, 140235799.9530997, 48978870.70783881, 140235837.0413511, 48978941.591275565, 140235817.57001913, 48978904.37747127, 140235819.42443168, 48978907.92164311, 0, 0, 0, 0, 0 },
-  { 140235792.71385768, 48978919.64015625, 140235769.43335816, 48978887.112962365, 140235815.9943572, 48978952.16735013, 140235791.5498327, 48978918.01379655, 140235793.87788266, 48978921.26651594, 0, 0, 0, 0, 0 },
-  { 140235769.1584724, 48978936.49931533, 140235742.1211117, 48978907.02082951, 140235796.1958331, 48978965.977801144, 140235767.80660436, 48978935.025391035, 140235770.51034042, 48978937.97323962, 1, 4, 140235951.66065717, 48979135.47909457, 25 },
-  { 140235747.74390218, 48978956.14053649, 140235718.0474681, 48978929.34274174, 140235777.44033626, 48978982.93833123, 140235746.25908047, 48978954.80064675, 140235749.22872388, 48978957.48042622, 0, 0, 0, 0, 0 },
-  { 140235728.1754602, 48978977.82563979, 140235696.6680756, 48978953.18249235, 140235759.6828448, 48979002.46878723, 140235726.60009095, 48978976.59348242, 140235729.75082943, 48978979.05779716, 0, 0, 0, 0, 0 },
-  { 140235710.1750555, 48979000.839975715, 140235677.15540102, 48978978.26338565, 140235743.19471, 48979023.416565776, 140235708.52407277, 48978999.71114621, 140235711.82603824, 48979001.968805216, 1, 0, 140235558.28464493, 48978896.98766144, 47 },
-  { 140235693.74701858, 48979024.866992265, 140235659.19718796, 48979004.70987925, 140235728.2968492, 48979045.02410528, 140235692.01952705, 48979023.85913661, 140235695.4745101, 48979025.87484792, 0, 0, 0, 0, 0 },
-  { 140235679.1301666, 48979049.92066734, 140235643.0852394, 48979032.57814087, 140235715.17509377, 48979067.263193816, 140235677.32792023, 48979049.05354102, 140235680.93241295, 48979050.787793666, 0, 0, 0, 0, 0 },
-  { 140235666.57042366, 48979076.02499648, 140235629.18068367, 48979061.81206776, 140235703.96016365, 48979090.2379252, 140235664.70093668, 48979075.314350046, 140235668.43991065, 48979076.73564292, 1, 0, 140235781.54387417, 48979119.729752295, 45 },
-  { 140235656.25770372, 48979103.15451531, 140235617.83876067, 48979092.019668385, 140235694.67664677, 48979114.28936224, 140235654.33675656, 48979102.59777296, 140235658.1786509, 48979103.71125766, 0, 0, 0, 0, 0 },
-  { 140235648.16150174, 48979131.08911783, 140235609.01131347, 48979122.88773023, 140235687.31169, 48979139.29050543, 140235646.2039923, 48979130.67904845, 140235650.11901116, 48979131.499187216, 0, 0, 0, 0, 0 },
-  { 140235642.19709876, 48979159.56082416, 140235602.56418648, 48979154.15413717, 140235681.83001104, 48979164.967511155, 140235640.21545315, 48979159.290489815, 140235644.17874438, 48979159.83115851, 1, 2, 140235400.43633386, 48979126.580033526, 38 },
-  { 140235638.2757751, 48979188.305502154, 140235598.3794547, 48979185.42737478, 140235678.1720955, 48979191.18362953, 140235636.28095907, 48979188.161595784, 140235640.27059114, 48979188.449408524, 1, 4, 140235906.5785299, 48979207.660908766, 34 },
-  { 140235636.19349045, 48979217.169928595, 140235596.20143688, 48979216.37265114, 140235676.185544, 48979217.96720605, 140235634.19388777, 48979217.130064726, 140235638.19309312, 48979217.209792465, 0, 0, 0, 0, 0 },
-  { 140235635.61622748, 48979246.125885144, 140235595.62439892, 48979246.93437038, 140235675.60805604, 48979245.317399904, 140235633.61663604, 48979246.16630941, 140235637.61581892, 48979246.08546088, 1, 5, 140235882.56576884, 48979241.133488774, 33 },
-  { 140235636.2030236, 48979275.15183294, 140235596.24997145, 48979277.08925951, 140235676.15607578, 48979273.21440636, 140235634.205371, 48979275.24870427, 140235638.20067623, 48979275.05496161, 0, 0, 0, 0, 0 },
-  { 140235637.6129163, 48979304.22623317, 140235597.69718865, 48979306.82136059, 140235677.52864394, 48979301.63110575, 140235635.61712992, 48979304.35598954, 140235639.60870266, 48979304.0964768, 1, 2, 140235859.14520475, 48979289.823276006, 40 },
-  { 140235639.50494286, 48979333.32754701, 140235599.60217682, 48979336.11488659, 140235679.4077089, 48979330.54020742, 140235637.50980458, 48979333.46691398, 140235641.50008115, 48979333.18818003, 0, 0, 0, 0, 0 },
-  { 140235641.5381409, 48979362.43423561, 140235601.617346, 48979364.95021146, 140235681.4589358, 48979359.91825976, 140235639.54210114, 48979362.5600344, 140235643.53418064, 48979362.30843682, 1, 2, 140235752.31834674, 48979355.452402644, 27 },
-  { 140235643.3715477, 48979391.52476016, 140235603.4110819, 48979393.30272922, 140235683.3320135, 48979389.746791095, 140235641.3735244, 48979391.61365861, 140235645.369571, 48979391.43586171, 0, 0, 0, 0, 0 },
-  { 140235644.66420075, 48979420.57758182, 140235604.66821784, 48979421.144459695, 140235684.66018367, 48979420.01070395, 140235642.66440162, 48979420.60592572, 140235646.6639999, 48979420.54923793, 1, 1, 140235795.64903626, 48979418.437617846, 36 },
-  { 140235645.0751375, 48979449.57116177, 140235605.09089288, 48979448.44858284, 140235685.0593821, 48979450.693740696, 140235643.07592526, 48979449.51503282, 140235647.07434973, 48979449.62729072, 0, 0, 0, 0, 0 },
-  { 140235644.26339528, 48979478.48396118, 140235604.39866146, 48979475.19716974, 140235684.1281291, 48979481.770752616, 140235642.2701586, 48979478.31962161, 140235646.25663197, 48979478.64830075, 0, 0, 0, 0, 0 },
-  { 140235641.88801157, 48979507.29444122, 140235602.32521722, 48979501.39653458, 140235681.45080593, 48979513.19234787, 140235639.90987185, 48979506.999545895, 140235643.8661513, 48979507.58933655, 0, 0, 0, 0, 0 },
-  { 140235637.61214748, 48979535.976674095, 140235598.58895347, 48979527.19087134, 140235676.6353415, 48979544.76247685, 140235635.6609878, 48979535.53738396, 140235639.56330717, 48979536.41596423, 0, 0, 0, 0, 0 },
-  { 140235631.21770585, 48979564.378351614, 140235593.00022548, 48979552.57054935, 140235669.4351862, 48979576.18615388, 140235629.30683184, 48979563.7879615, 140235633.12857985, 48979564.96874173, 1, 3, 140235282.48319748, 48979456.63215595, 30 },
-  { 140235622.62035298, 48979592.20479695, 140235585.52792373, 48979577.23310056, 140235659.71278223, 48979607.17649333, 140235620.7657315, 48979591.456212126, 140235624.47497445, 48979592.95338177, 0, 0, 0, 0, 0 },
-  { 140235611.74289665, 48979619.153732404, 140235576.14044416, 48979600.92009926, 140235647.34534913, 48979637.38736555, 140235609.962774, 48979618.242050745, 140235613.52301928, 48979620.06541406, 0, 0, 0, 0, 0 },
-  { 140235598.53359166, 48979644.94583041, 140235564.55881676, 48979623.833874755, 140235632.50836655, 48979666.05778607, 140235596.8348529, 48979643.89023263, 140235600.2323304, 48979646.001428194, 0, 0, 0, 0, 0 },
-  { 140235583.23426655, 48979669.56653041, 140235550.74932793, 48979646.22710534, 140235615.71920517, 48979692.90595547, 140235581.61001962, 48979668.399559155, 140235584.85851347, 48979670.73350166, 1, 2, 140235472.7854752, 48979590.2124852, 39 },
-  { 140235566.27508992, 48979693.17113123, 140235535.0326319, 48979668.19296443, 140235597.51754794, 48979718.149298035, 140235564.712967, 48979691.92222289, 140235567.83721283, 48979694.42003957, 1, 4, 140235676.40475443, 48979781.21916922, 25 },
-  { 140235548.08932203, 48979715.91772005, 140235517.79383993, 48979689.79907221, 140235578.38480413, 48979742.036367886, 140235546.57454792, 48979714.611787654, 140235549.60409614, 48979717.223652445, 0, 0, 0, 0, 0 },
-  { 140235529.08668905, 48979737.95921051, 140235499.57588518, 48979710.957128085, 140235558.59749293, 48979764.96129293, 140235527.61114886, 48979736.609106384, 140235530.56222925, 48979739.30931463, 0, 0, 0, 0, 0 },
-  { 140235509.46651548, 48979759.402263865, 140235480.65182832, 48979731.658547394, 140235538.28120264, 48979787.145980336, 140235508.02578112, 48979758.01507804, 140235510.90724984, 48979760.78944969, 0, 0, 0, 0, 0 },
-  { 140235489.31738448, 48979780.32919725, 140235461.10037372, 48979751.977825075, 140235517.53439525, 48979808.680569425, 140235487.90653396, 48979778.91162864, 140235490.728235, 48979781.74676586, 0, 0, 0, 0, 0 },
-  { 140235468.72689, 48979800.82211028, 140235441.0009129, 48979771.990353584, 140235496.4528671, 48979829.65386698, 140235467.34059113, 48979799.380522445, 140235470.11318886, 48979802.263698116, 1, 4, 140235284.3491423, 48979609.09092825, 34 },
-  { 140235447.78262582, 48979820.96310255, 140235420.43495598, 48979791.77226574, 140235475.13029566, 48979850.15393936, 140235446.41524234, 48979819.50356071, 140235449.1500093, 48979822.42264439, 0, 0, 0, 0, 0 },
-  { 140235426.5721857, 48979840.834273696, 140235399.48578903, 48979811.40083835, 140235453.65858236, 48979870.26770904, 140235425.21786585, 48979839.36260193, 140235427.92650554, 48979842.30594546, 1, 1, 140235207.1723728, 48979602.42344741, 34 },
-  { 140235405.18316343, 48979860.51772329, 140235378.2381859, 48979830.95477037, 140235432.12814096, 48979890.08067621, 140235403.83591455, 48979859.039575644, 140235406.53041232, 48979861.99587094, 1, 4, 140235498.81696036, 48979963.2489847, 49 },
-  { 140235383.70315298, 48979880.09555101, 140235356.77820027, 48979850.51435899, 140235410.6281057, 48979909.67674302, 140235382.35690534, 48979878.61649141, 140235385.04940063, 48979881.574610606, 0, 0, 0, 0, 0 },
-  { 140235362.21974802, 48979899.64985641, 140235335.1930511, 48979870.16159343, 140235389.24644494, 48979929.13811939, 140235360.86841318, 48979898.17544326, 140235363.57108286, 48979901.12426956, 0, 0, 0, 0, 0 },
-  { 140235340.82054242, 48979919.262739144, 140235313.57111272, 48979889.98017469, 140235368.06997213, 48979948.5453036, 140235339.45807093, 48979917.79861092, 140235342.18301392, 48979920.72686737, 0, 0, 0, 0, 0 },
-  { 140235319.59312996, 48979939.01629879, 140235292.002007, 48979910.0554643, 140235347.18425292, 48979967.97713329, 140235318.2135738, 48979937.56825707, 140235320.9726861, 48979940.464340515, 0, 0, 0, 0, 0 },
-  { 140235298.62510455, 48979958.99263501, 140235270.5767984, 48979930.47435099, 140235326.67341068, 48979987.510919034, 140235297.22268924, 48979957.56672081, 140235300.02751985, 48979960.41854921, 1, 2, 140235077.04348618, 48979733.698191226, 42 },
-  { 140235278.00405985, 48979979.273847364, 140235249.38827735, 48979951.325019255, 140235306.61984235, 48980007.22267547, 140235276.57327074, 48979977.87640596, 140235279.43484896, 48979980.671288766, 0, 0, 0, 0, 0 },
-  { 140235257.81758976, 48979999.94203549, 140235228.53131625, 48979972.69659212, 140235287.10386327, 48980027.187478855, 140235256.35327607, 48979998.57976332, 140235259.28190345, 48980001.304307655, 1, 5, 140235057.93877313, 48979813.99188449, 40 },
-  { 140235238.15328813, 48980021.079298995, 140235208.1032591, 48979994.67862184, 140235268.20331717, 48980047.47997615, 140235236.65078667, 48980019.75926514, 140235239.65578958, 48980022.39933285, 0, 0, 0, 0, 0 },
-  { 140235219.0987487, 48980042.7677375, 140235188.21182418, 48980017.35124889, 140235249.98567325, 48980068.18422611, 140235217.5544025, 48980041.49691307, 140235220.64309493, 48980044.03856193, 1, 5, 140235085.51280013, 48979932.84142427, 33 },
-  { 140235200.73543146, 48980065.08342409, 140235169.08788782, 48980040.62053419, 140235232.3829751, 48980089.54631399, 140235199.15305427, 48980063.8602796, 140235202.31780866, 48980066.306568585, 0, 0, 0, 0, 0 },
-  { 140235183.02966034, 48980087.98930995, 140235150.80946678, 48980064.285742134, 140235215.2498539, 48980111.69287777, 140235181.41865066, 48980086.80413156, 140235184.64067003, 48980089.17448834, 1, 4, 140234988.9029942, 48979945.17531385, 39 },
-  { 140235165.84542105, 48980111.34779845, 140235133.22788316, 48980088.19404665, 140235198.46295893, 48980134.50155026, 140235164.21454415, 48980110.19011086, 140235167.47629794, 48980112.50548604, 0, 0, 0, 0, 0 },
-  { 140235149.04313627, 48980135.01779219, 140235116.1873923, 48980112.203321174, 140235181.89888024, 48980157.8322632, 140235147.40034908, 48980133.87706864, 140235150.68592346, 48980136.15851574, 0, 0, 0, 0, 0 },
-  { 140235132.48650044, 48980158.861456476, 140235099.4666685, 48980136.28512602, 140235165.5063324, 48980181.43778693, 140235130.83550885, 48980157.73263995, 140235134.13749203, 48980159.990273, 1, 0, 140235220.81455097, 48980219.25314045, 49 },
-  { 140235116.11079356, 48980182.81234126, 140235082.92405525, 48980160.48208374, 140235149.29753187, 48980205.14259878, 140235114.45145664, 48980181.69582838, 140235117.7701305, 48980183.92885414, 1, 3, 140234816.6004804, 48979981.28176713, 42 },
-  { 140235099.9208999, 48980206.87340565, 140235066.56157243, 48980184.80181142, 140235133.28022736, 48980228.94499988, 140235098.25293353, 48980205.769825935, 140235101.58886626, 48980207.976985365, 0, 0, 0, 0, 0 },
-  { 140235083.92457935, 48980231.050476395, 140235050.38727614, 48980209.25026324, 140235117.46188256, 48980252.85068955, 140235082.2477142, 48980229.96046574, 140235085.6014445, 48980232.14048705, 1, 2, 140234901.1462769, 48980112.239314675, 27 },
-  { 140235068.1295919, 48980255.34938022, 140235034.40924224, 48980233.83338574, 140235101.84994158, 48980276.86537469, 140235066.44357443, 48980254.27358049, 140235069.8156094, 48980256.42517994, 0, 0, 0, 0, 0 },
-  { 140235052.54369754, 48980279.77594385, 140235018.63556638, 48980258.55711632, 140235086.4518287, 48980300.99477138, 140235050.84829098, 48980278.71500248, 140235054.2391041, 48980280.83688523, 0, 0, 0, 0, 0 },
-  { 140235037.1746562, 48980304.33599403, 140235003.07436433, 48980283.427381106, 140235071.2749481, 48980325.24460695, 140235035.46964163, 48980303.29056338, 140235038.8796708, 48980305.38142467, 0, 0, 0, 0, 0 },
-  { 140235022.03022778, 48980329.035357475, 140234987.7337715, 48980308.45009366, 140235056.32668406, 48980349.620621294, 140235020.31540495, 48980328.006094284, 140235023.7450506, 48980330.064620666, 0, 0, 0, 0, 0 },
-  { 140235007.11817232, 48980353.879860945, 140234972.62194362, 48980333.63115219, 140235041.614401, 48980374.1285697, 140235005.39336088, 48980352.86742551, 140235008.84298375, 48980354.89229638, 0, 0, 0, 0, 0 },
-  { 140234992.44624975, 48980378.87533113, 140234957.7470469, 48980358.976453766, 140235027.14545262, 48980398.7742085, 140234990.7112896, 48980377.88038726, 140234994.1812099, 48980379.870275006, 0, 0, 0, 0, 0 },
-  { 140234978.02223405, 48980404.027596645, 140234943.11225542, 48980384.500861324, 140235012.93221268, 48980423.554331966, 140234976.27673513, 48980403.05125988, 140234979.76773298, 48980405.00393341, 1, 0, 140235087.98866674, 48980465.5368129, 45 },
-  { 140234963.86188126, 48980429.343534276, 140234928.72082296, 48980410.235786565, 140234999.00293955, 48980448.45128199, 140234962.10482833, 48980428.38814689, 140234965.61893418, 48980430.29892166, 1, 2, 140234850.5319683, 48980367.72104791, 26 },
-  { 140234950.00223142, 48980454.83281591, 140234914.60915068, 48980436.19602878, 140234985.39531216, 48980473.46960304, 140234948.23257738, 48980453.90097655, 140234951.77188545, 48980455.76465526, 1, 2, 140235196.86896968, 48980584.82440616, 46 },
-  { 140234936.48383394, 48980480.50557432, 140234900.8196344, 48980462.39301314, 140234972.14803347, 48980498.618135504, 140234934.70062396, 48980479.59994626, 140234938.26704392, 48980481.411202386, 0, 0, 0, 0, 0 },
-  { 140234923.34723818, 48980506.371942274, 140234887.39493415, 48980488.838208094, 140234959.29954222, 48980523.905676454, 140234921.54962298, 48980505.49525557, 140234925.14485338, 48980507.24862898, 0, 0, 0, 0, 0 },
-  { 140234910.6329937, 48980532.44205253, 140234874.37799895, 48980515.54307754, 140234946.88798845, 48980549.34102751, 140234908.82024395, 48980531.59710378, 140234912.44574344, 48980533.287001275, 1, 2, 140234773.7703885, 48980468.648421966, 39 },
-  { 140234898.38164976, 48980558.72603783, 140234861.81208855, 48980542.51902721, 140234934.95121098, 48980574.93304845, 140234896.5531717, 48980557.9156873, 140234900.21012783, 48980559.53638836, 1, 0, 140235125.11292922, 48980659.20950367, 31 },
-  { 140234886.63375583, 48980585.234030955, 140234849.7407926, 48980569.777340986, 140234923.52671906, 48980600.69072092, 140234884.78910768, 48980584.46119645, 140234888.478404, 48980586.00686546, 0, 0, 0, 0, 0 },
-  { 140234875.42986128, 48980611.976164654, 140234838.2080867, 48980597.328997746, 140234912.65163586, 48980626.62333156, 140234873.56877255, 48980611.24380631, 140234877.29095, 48980612.708523, 0, 0, 0, 0, 0 },
-  { 140234864.81044808, 48980638.96250314, 140234827.26353946, 48980625.170126475, 140234902.3573567, 48980652.75487981, 140234862.93310264, 48980638.27288431, 140234866.68779352, 48980639.652121976, 1, 5, 140234503.42145273, 48980506.21087774, 42 },
-  { 140234854.80723044, 48980666.194205664, 140234816.95150077, 48980653.27353498, 140234892.6629601, 48980679.114876345, 140234852.91444397, 48980665.54817213, 140234856.70001692, 48980666.8402392, 0, 0, 0, 0, 0 },
-  { 140234845.43456048, 48980693.65479725, 140234807.28793946, 48980681.62004319, 140234883.5811815, 48980705.68955131, 140234843.52722943, 48980693.05305955, 140234847.34189153, 48980694.25653495, 0, 0, 0, 0, 0 },
-  { 140234836.70474786, 48980721.32572862, 140234798.28553808, 48980710.19180204, 140234875.12395763, 48980732.459655195, 140234834.78378737, 48980720.76903229, 140234838.62570834, 48980721.88242494, 0, 0, 0, 0, 0 },
-  { 140234828.63010234, 48980749.18845053, 140234789.95708084, 48980738.97094558, 140234867.30312383, 48980759.40595548, 140234826.69645125, 48980748.67757528, 140234830.56375343, 48980749.69932578, 0, 0, 0, 0, 0 },
-  { 140234821.22293368, 48980777.22441373, 140234782.31545484, 48980767.93958258, 140234860.13041252, 48980786.50924488, 140234819.27755973, 48980776.76017217, 140234823.16830763, 48980777.68865529, 1, 2, 140234934.05462235, 48980804.15042408, 42 },
-  { 140234814.49555165, 48980805.41506899, 140234775.3778332, 48980797.06018397, 140234853.6132701, 48980813.76995401, 140234812.53966573, 48980804.99732474, 140234816.45143756, 48980805.83281324, 1, 4, 140234604.23781502, 48980760.507562, 36 },
-  { 140234808.4455221, 48980833.74141361, 140234769.16333205, 48980826.19757211, 140234847.72771215, 48980841.285255104, 140234806.4814126, 48980833.364221536, 140234810.4096316, 48980834.11860568, 1, 3, 140235048.06688145, 48980879.75884672, 40 },
-  { 140234802.98376912, 48980862.18178034, 140234763.58279496, 48980855.2851699, 140234842.38474327, 48980869.07839078, 140234801.01372042, 48980861.83694982, 140234804.9538178, 48980862.52661086, 1, 1, 140234526.19192567, 48980813.73309199, 31 },
-  { 140234797.9896699, 48980890.71353175, 140234758.50745836, 48980884.29831755, 140234837.47188142, 48980897.12874594, 140234796.01555932, 48980890.392771035, 140234799.96378046, 48980891.03429246, 1, 2, 140234918.41041505, 48980910.27993504, 48 },
-  { 140234793.34255645, 48980919.314029, 140234753.8105188, 48980913.21337334, 140234832.8745941, 48980925.41468466, 140234791.36595458, 48980919.00899622, 140234795.31915832, 48980919.61906178, 1, 0, 140234575.91634938, 48980885.76042288, 42 },
-  { 140234788.9217606, 48980947.96063325, 140234749.3672735, 48980942.00726842, 140234828.47624767, 48980953.913998075, 140234786.94403625, 48980947.66296501, 140234790.89948493, 48980948.25830149, 1, 5, 140234903.62977308, 48980965.22539124, 44 },
-  { 140234784.60661423, 48980976.630705684, 140234745.05515614, 48980970.657250755, 140234824.15807232, 48980982.604160614, 140234782.6290413, 48980976.33203294, 140234786.58418715, 48980976.92937843, 0, 0, 0, 0, 0 },
-  { 140234780.27644923, 48981005.30160744, 140234740.75374657, 48980999.14076552, 140234819.7991519, 48981011.46244936, 140234778.3003141, 48981004.99356534, 140234782.25258437, 48981005.60964953, 0, 0, 0, 0, 0 },
-  { 140234775.81059754, 48981033.95069972, 140234736.34476686, 48981027.43547075, 140234815.27642822, 48981040.46592868, 140234773.837306, 48981033.62493827, 140234777.78388909, 48981034.27646116, 0, 0, 0, 0, 0 },
-  { 140234771.08839098, 48981062.55534366, 140234731.71206117, 48981055.51938951, 140234810.4647208, 48981069.591297805, 140234769.1195745, 48981062.20354595, 140234773.05720747, 48981062.907141365, 1, 4, 140235092.98988718, 48981120.07426878, 26 },
-  { 140234765.98916152, 48981091.092900425, 140234726.7415468, 48981083.37119462, 140234805.23677623, 48981098.81460623, 140234764.02678078, 48981090.70681514, 140234767.95154226, 48981091.47898571, 1, 4, 140234391.17444116, 48981017.35061003, 25 },
-  { 140234760.392241, 48981119.54073122, 140234721.3211112, 48981110.97061944, 140234799.4633708, 48981128.110843, 140234758.43868452, 48981119.11222563, 140234762.34579748, 48981119.96923681, 0, 0, 0, 0, 0 },
-  { 140234754.1769597, 48981147.87619159, 140234715.34298366, 48981138.288579464, 140234793.01093572, 48981157.46380372, 140234752.2352609, 48981147.396810986, 140234756.11865848, 48981148.3555722, 0, 0, 0, 0, 0 },
-  { 140234747.218358, 48981176.06153818, 140234708.70504245, 48981165.25762575, 140234785.73167357, 48981186.86545061, 140234745.29269224, 48981175.52134256, 140234749.14402378, 48981176.601733804, 0, 0, 0, 0, 0 },
-  { 140234739.37784585, 48981204.01105376, 140234701.29122382, 48981191.78774726, 140234777.46446788, 48981216.23436027, 140234737.47351477, 48981203.39988844, 140234741.28217694, 48981204.622219086, 1, 4, 140234543.23174238, 48981141.06102525, 50 },
-  { 140234730.51413214, 48981231.629514754, 140234692.98490155, 48981217.78910826, 140234768.04336274, 48981245.469921246, 140234728.6376706, 48981230.93749443, 140234732.39059368, 48981232.32153508, 0, 0, 0, 0, 0 },
-  { 140234720.48592588, 48981258.82169767, 140234683.66540274, 48981243.19322761, 140234757.30644903, 48981274.45016772, 140234718.64489973, 48981258.040274166, 140234722.32695204, 48981259.60312117, 0, 0, 0, 0, 0 },
-  { 140234709.16377687, 48981285.49657038, 140234673.1492832, 48981268.09093205, 140234745.17827055, 48981302.90220871, 140234707.3630522, 48981284.62628846, 140234710.96450156, 48981286.3668523, 0, 0, 0, 0, 0 },
-  { 140234696.544365, 48981311.60774888, 140234661.381958, 48981292.53931594, 140234731.70677197, 48981330.67618182, 140234694.78624463, 48981310.654327236, 140234698.30248535, 48981312.561170526, 0, 0, 0, 0, 0 },
-  { 140234682.70058888, 48981337.1358293, 140234648.4243193, 48981316.516970396, 140234716.97685847, 48981357.7546882, 140234680.9867754, 48981336.10488635, 140234684.41440237, 48981338.16677225, 0, 0, 0, 0, 0 },
-  { 140234667.70640457, 48981362.06178211, 140234634.34064043, 48981339.999919474, 140234701.0721687, 48981384.12364474, 140234666.03811637, 48981360.958688974, 140234669.37469277, 48981363.16487524, 0, 0, 0, 0, 0 },
-  { 140234651.63576818, 48981386.36657779, 140234619.19690847, 48981362.96315109, 140234684.07462788, 48981409.77000449, 140234650.01382518, 48981385.196406454, 140234653.25771117, 48981387.536749125, 0, 0, 0, 0, 0 },
-  { 140234634.5626359, 48981410.03118681, 140234603.06074238, 48981385.381020404, 140234666.06452942, 48981434.68135322, 140234632.98754123, 48981408.79867849, 140234636.13773057, 48981411.263695136, 1, 0, 140234369.94673023, 48981202.969788976, 25 },
-  { 140234616.56096366, 48981433.03657967, 140234586.0012653, 48981407.22757281, 140234647.12066203, 48981458.84558652, 140234615.03297874, 48981431.74612933, 140234618.08894858, 48981434.32703001, 1, 5, 140234844.99470907, 48981625.95890591, 27 },
-  { 140234597.7047077, 48981455.36372684, 140234568.09260786, 48981428.47277032, 140234627.31680757, 48981482.25468336, 140234596.2241027, 48981454.01917902, 140234599.18531272, 48981456.70827466, 0, 0, 0, 0, 0 },
-  { 140234578.06515044, 48981476.99064556, 140234549.4838972, 48981449.00650783, 140234606.64640367, 48981504.97478329, 140234576.63608778, 48981475.59143867, 140234579.4942131, 48981478.38985244, 0, 0, 0, 0, 0 },
-  { 140234557.65765607, 48981497.83358771, 140234530.27846774, 48981468.67231123, 140234585.0368444, 48981526.994864196, 140234556.28869665, 48981496.37552389, 140234559.0266155, 48981499.29165154, 1, 3, 140234379.0084522, 48981307.55625865, 46 },
-  { 140234536.44460368, 48981517.75027952, 140234510.4616759, 48981487.33831701, 140234562.42753145, 48981548.16224204, 140234535.1454573, 48981516.229681395, 140234537.74375007, 48981519.27087765, 1, 2, 140234749.50461146, 48981767.12837216, 34 },
-  { 140234514.3862859, 48981536.59614248, 140234490.0136911, 48981504.87900795, 140234538.7588807, 48981568.313277006, 140234513.16765615, 48981535.01028575, 140234515.60491565, 48981538.18199921, 0, 0, 0, 0, 0 },
-  { 140234491.44299513, 48981554.226597995, 140234468.90879005, 48981521.17800345, 140234513.9772002, 48981587.27519254, 140234490.31628487, 48981552.574168265, 140234492.5697054, 48981555.879027724, 1, 2, 140234680.73031783, 48981831.83479215, 33 },
-  { 140234467.5765704, 48981570.49993479, 140234446.89588627, 48981536.26093211, 140234488.2572545, 48981604.738937475, 140234466.5425362, 48981568.78798466, 140234468.61060458, 48981572.21188492, 0, 0, 0, 0, 0 },
-  { 140234442.83903357, 48981585.44164292, 140234423.65573815, 48981550.341768615, 140234462.022329, 48981620.54151722, 140234441.8798688, 48981583.6866492, 140234443.79819834, 48981587.19663663, 0, 0, 0, 0, 0 },
-  { 140234417.4207122, 48981599.33363479, 140234399.31499484, 48981563.665960364, 140234435.52642956, 48981635.00130921, 140234416.51542634, 48981597.55025107, 140234418.32599807, 48981601.117018506, 0, 0, 0, 0, 0 },
-  { 140234391.52366018, 48981612.47956348, 140234374.05799872, 48981576.49414047, 140234408.98932165, 48981648.464986496, 140234390.65037712, 48981610.68029233, 140234392.39694324, 48981614.27883463, 0, 0, 0, 0, 0 },
-  { 140234365.34993115, 48981625.18308208, 140234348.08964172, 48981589.09870307, 140234382.61022058, 48981661.26746109, 140234364.4869167, 48981623.37886313, 140234366.2129456, 48981626.98730103, 0, 0, 0, 0, 0 },
-  { 140234339.09696248, 48981637.74069982, 140234321.84015992, 48981601.65465313, 140234356.35376504, 48981673.82674651, 140234338.23412237, 48981635.936397485, 140234339.9598026, 48981639.545002155, 0, 0, 0, 0, 0 },
-  { 140234312.858399, 48981650.288311735, 140234295.6352469, 48981614.18619224, 140234330.0815511, 48981686.39043123, 140234311.9972414, 48981648.48320576, 140234313.7195566, 48981652.09341771, 1, 3, 140234253.43852428, 48981525.73599948, 25 },
-  { 140234286.62540245, 48981662.80322487, 140234269.47606716, 48981626.66598232, 140234303.77473775, 48981698.94046742, 140234285.7679357, 48981660.99636274, 140234287.4828692, 48981664.610087, 0, 0, 0, 0, 0 },
-  { 140234260.38478, 48981675.25600768, 140234243.34963158, 48981639.06479716, 140234277.4199284, 48981711.447218195, 140234259.53302258, 48981673.44644716, 140234261.2365374, 48981677.0655682, 0, 0, 0, 0, 0 },
-  { 140234234.1233388, 48981687.61722859, 140234217.24301615, 48981651.35354555, 140234251.00366142, 48981723.88091163, 140234233.27932265, 48981685.80404444, 140234234.96735492, 48981689.43041274, 1, 3, 140234328.65314552, 48981890.69385364, 45 },
-  { 140234207.8278859, 48981699.857456036, 140234191.1433557, 48981663.503275365, 140234224.5124161, 48981736.21163671, 140234206.99365938, 48981698.039747, 140234208.6621124, 48981701.67516507, 1, 3, 140234111.89183733, 48981490.82091716, 49 },
-  { 140234181.48522854, 48981711.947258465, 140234165.03783622, 48981675.48517836, 140234197.93262085, 48981748.40933857, 140234180.66285893, 48981710.124154456, 140234182.30759814, 48981713.770362474, 0, 0, 0, 0, 0 },
-  { 140234155.0821738, 48981723.85720432, 140234138.9136833, 48981687.2705959, 140234171.2506643, 48981760.443812735, 140234154.27374926, 48981722.027873896, 140234155.89059833, 48981725.68653474, 0, 0, 0, 0, 0 },
-  { 140234128.6055289, 48981735.55786201, 140234112.75814924, 48981698.83102499, 140234144.45290855, 48981772.28469904, 140234127.8131599, 48981733.72152016, 140234129.39789787, 48981737.394203864, 0, 0, 0, 0, 0 },
-  { 140234102.04210085, 48981747.01980002, 140234086.55849603, 48981710.13812459, 140234117.52570567, 48981783.90147545, 140234101.2679206, 48981745.17571625, 140234102.81628108, 48981748.86388379, 0, 0, 0, 0, 0 },
-  { 140234075.3786969, 48981758.21358677, 140234060.30197695, 48981721.16372151, 140234090.45541683, 48981795.26345203, 140234074.62486088, 48981756.361093506, 140234076.1325329, 48981760.066080034, 0, 0, 0, 0, 0 },
-  { 140234048.60212418, 48981769.109790705, 140234033.975814, 48981731.87981554, 140234063.22843435, 48981806.33976587, 140234047.87080866, 48981767.24829195, 140234049.3334397, 48981770.97128946, 1, 3, 140233911.846124, 48981421.00952295, 42 },
-  { 140234021.69918975, 48981779.67898024, 140234007.5577937, 48981742.26212685, 140234035.8405858, 48981817.09583363, 140234020.99211994, 48981777.808137566, 140234022.40625957, 48981781.54982291, 0, 0, 0, 0, 0 },
-  { 140233994.6595019, 48981789.89841079, 140233980.99089524, 48981752.3062681, 140234008.32810858, 48981827.490553476, 140233993.97607157, 48981788.018803656, 140233995.34293225, 48981791.77801792, 0, 0, 0, 0, 0 },
-  { 140233967.4865846, 48981799.778558396, 140233954.26366174, 48981762.02734237, 140233980.70950747, 48981837.52977442, 140233966.82543847, 48981797.890997596, 140233968.14773074, 48981801.666119196, 0, 0, 0, 0, 0 },
-  { 140233940.18827492, 48981809.3401959, 140233927.3834189, 48981771.44513472, 140233952.99313095, 48981847.23525708, 140233939.5480321, 48981807.44544284, 140233940.82851774, 48981811.23494896, 0, 0, 0, 0, 0 },
-  { 140233912.77241132, 48981818.60409932, 140233900.35758704, 48981780.5794739, 140233925.1872356, 48981856.62872474, 140233912.1516701, 48981816.702868044, 140233913.39315253, 48981820.50533059, 0, 0, 0, 0, 0 },
-  { 140233885.24683222, 48981827.59104459, 140233873.19366485, 48981789.450237624, 140233897.2999996, 48981865.731851555, 140233884.64417386, 48981825.68400424, 140233885.84949058, 48981829.49808494, 1, 5, 140233814.43447384, 48981603.51380366, 37 },
-  { 140233857.61937615, 48981836.32180775, 140233845.8992197, 48981798.07735805, 140233869.3395326, 48981874.56625745, 140233857.03336832, 48981834.40958527, 140233858.205384, 48981838.23403023, 0, 0, 0, 0, 0 },
-  { 140233829.89788154, 48981844.81716477, 140233818.48187774, 48981806.48082617, 140233841.31388533, 48981883.15350337, 140233829.32708135, 48981842.900347844, 140233830.46868172, 48981846.7339817, 0, 0, 0, 0, 0 },
-  { 140233802.09018683, 48981853.097891614, 140233790.94931516, 48981814.68069523, 140233813.2310585, 48981891.515088, 140233801.53314325, 48981851.17703179, 140233802.64723042, 48981855.018751435, 1, 3, 140233884.811159, 48982138.345574796, 31 },
-  { 140233774.20413047, 48981861.18476428, 140233763.30924985, 48981822.69708344, 140233785.0990111, 48981899.67244512, 140233773.65938643, 48981859.26038024, 140233774.74887452, 48981863.10914832, 1, 5, 140233678.32918096, 48981522.49317292, 43 },
-  { 140233746.24755093, 48981869.098558776, 140233735.56943417, 48981830.5501759, 140233756.9256677, 48981907.646941654, 140233745.7136451, 48981867.171139635, 140233746.78145677, 48981871.02597792, 0, 0, 0, 0, 0 },
-  { 140233718.2282866, 48981876.86005106, 140233707.7376477, 48981838.26022599, 140233728.71892548, 48981915.45987613, 140233717.70375466, 48981874.930059806, 140233718.75281852, 48981878.79004231, 0, 0, 0, 0, 0 },
-  { 140233690.15417603, 48981884.490017146, 140233679.8318308, 48981845.84484682, 140233700.47652125, 48981923.13518747, 140233689.63805875, 48981882.55775863, 140233690.6702933, 48981886.42227566, 0, 0, 0, 0, 0 },
-  { 140233662.03208405, 48981892.00158817, 140233651.91487518, 48981853.30220724, 140233672.14929292, 48981930.70096911, 140233661.5262236, 48981890.06661913, 140233662.5379445, 48981893.93655722, 0, 0, 0, 0, 0 },
-  { 140233633.86350507, 48981899.3657214, 140233624.00783998, 48981860.598907426, 140233643.71917015, 48981938.13253537, 140233633.37072182, 48981897.427380696, 140233634.3562883, 48981901.3040621, 1, 2, 140233687.08409655, 48982108.706516854, 30 },
-  { 140233605.64809152, 48981906.53890995, 140233596.11094755, 48981867.692508765, 140233615.1852355, 48981945.385311134, 140233605.17123434, 48981904.59658989, 140233606.1249487, 48981908.481230006, 0, 0, 0, 0, 0 },
-  { 140233577.38549417, 48981913.47763405, 140233568.22452983, 48981874.54080403, 140233586.5464585, 48981952.41446407, 140233576.92744595, 48981911.53079255, 140233577.8435424, 48981915.42447555, 1, 1, 140233619.29690608, 48982091.613631405, 46 },
-  { 140233549.0753638, 48981920.13837389, 140233540.34901938, 48981881.10184084, 140233557.80170825, 48981959.17490694, 140233548.63904658, 48981918.186547235, 140233549.51168105, 48981922.09020054, 0, 0, 0, 0, 0 },
-  { 140233520.71735117, 48981926.47760965, 140233512.48491514, 48981887.33393843, 140233528.9497872, 48981965.62128087, 140233520.30572936, 48981924.52042609, 140233521.12897298, 48981928.43479321, 0, 0, 0, 0, 0 },
-  { 140233492.31110713, 48981932.451821566, 140233484.63274238, 48981893.195704654, 140233499.98947188, 48981971.70793848, 140233491.9271889, 48981930.48901572, 140233492.69502535, 48981934.41462741, 1, 2, 140233468.89209464, 48981812.72066499, 28 },
-  { 140233463.8562824, 48981938.017489806, 140233456.79300344, 48981898.646052316, 140233470.9195614, 48981977.388927296, 140233463.50311846, 48981936.048917934, 140233464.20944637, 48981939.98606168, 1, 3, 140233506.05937436, 48982173.2618288, 28 },
-  { 140233435.35252783, 48981943.13109458, 140233428.96612173, 48981903.644213, 140233441.73893392, 48981982.61797617, 140233435.03320754, 48981941.1567505, 140233435.67184812, 48981945.105438665, 0, 0, 0, 0, 0 },
-  { 140233406.79949415, 48981947.74911609, 140233401.15237644, 48981908.149746634, 140233412.44661185, 48981987.34848555, 140233406.51713827, 48981945.76914762, 140233407.08185002, 48981949.729084566, 1, 3, 140233445.19989452, 48982217.02482843, 47 },
-  { 140233378.19683212, 48981951.82803455, 140233373.35182893, 48981912.122544445, 140233383.0418353, 48981991.533524655, 140233377.95458198, 48981949.84276004, 140233378.43908226, 48981953.81330906, 0, 0, 0, 0, 0 },
-  { 140233349.54419258, 48981955.32433013, 140233345.56247753, 48981915.52299918, 140233353.52590764, 48981995.125661075, 140233349.34510684, 48981953.33426358, 140233349.74327832, 48981957.31439668, 1, 1, 140233375.9230549, 48982219.00814765, 32 },
-  { 140233320.8412766, 48981958.195762575, 140233317.72484222, 48981918.317349404, 140233323.95771095, 48981998.074175745, 140233320.68545488, 48981956.20184191, 140233320.9970983, 48981960.189683236, 0, 0, 0, 0, 0 },
-  { 140233292.08945858, 48981960.44267127, 140233289.76786092, 48981920.5101008, 140233294.41105625, 48982000.37524174, 140233291.9733787, 48981958.44604275, 140233292.20553848, 48981962.43929979, 1, 2, 140233310.7783197, 48982281.899863556, 42 },
-  { 140233263.29213667, 48981962.11688843, 140233261.68944672, 48981922.14900902, 140233264.89482662, 48982002.08476785, 140233263.21200216, 48981960.118494466, 140233263.37227118, 48981964.1152824, 0, 0, 0, 0, 0 },
-  { 140233234.45283017, 48981963.27332874, 140233233.4923986, 48981923.28486076, 140233235.41326174, 48982003.26179671, 140233234.40480858, 48981961.27390534, 140233234.50085175, 48981965.272752136, 0, 0, 0, 0, 0 },
-  { 140233205.57505828, 48981963.966906786, 140233205.17991522, 48981923.96885856, 140233205.97020134, 48982003.96495501, 140233205.55530113, 48981961.96700437, 140233205.59481543, 48981965.9668092, 0, 0, 0, 0, 0 },
-  { 140233176.66234034, 48981964.25253723, 140233176.75548854, 48981924.252645686, 140233176.56919214, 48982004.25242877, 140233176.66699776, 48981962.25254265, 140233176.65768293, 48981966.252531804, 0, 0, 0, 0, 0 },
-  { 140233147.71819553, 48981964.18513468, 140233148.22280845, 48981924.18831773, 140233147.2135826, 48982004.18195163, 140233147.74342617, 48981962.18529383, 140233147.69296488, 48981966.18497553, 0, 0, 0, 0, 0 },
-  { 140233118.74614316, 48981963.819613785, 140233119.58568138, 48981923.82842506, 140233117.90660495, 48982003.81080251, 140233118.78812006, 48981961.820054345, 140233118.70416626, 48981965.819173224, 1, 3, 140233110.812507, 48982341.73634723, 25 },
-  { 140233089.7497025, 48981963.21088919, 140233090.84796175, 48981923.2259692, 140233088.65144327, 48982003.19580918, 140233089.80461547, 48981961.21164319, 140233089.69478956, 48981965.21013519, 0, 0, 0, 0, 0 },
-  { 140233060.73239276, 48981962.4138755, 140233062.01349726, 48981922.43439612, 140233059.45128825, 48982002.39335488, 140233060.796448, 48981960.41490153, 140233060.66833752, 48981964.41284946, 1, 3, 140233053.52617997, 48982187.298447, 42 },
-  { 140233031.69773325, 48981961.483487375, 140233033.0860878, 48981921.50758874, 140233030.3093787, 48982001.45938601, 140233031.76715097, 48981959.48469245, 140233031.62831554, 48981963.4822823, 1, 0, 140233037.73707548, 48981787.58832831, 49 },
-  { 140233002.6492432, 48981960.47463944, 140233004.06945622, 48981920.49985995, 140233001.2290302, 48982000.449418925, 140233002.72025385, 48981958.475900464, 140233002.57823256, 48981962.47337841, 0, 0, 0, 0, 0 },
-  { 140232973.59044194, 48981959.44224631, 140232974.96723205, 48981919.46594772, 140232972.21365184, 48981999.4185449, 140232973.65928143, 48981957.44343138, 140232973.52160245, 48981961.44106124, 1, 1, 140232981.1283677, 48981740.57201152, 47 },
-  { 140232944.52484864, 48981958.441222645, 140232945.7829466, 48981918.46101267, 140232943.2667507, 48981998.42143262, 140232944.58775353, 48981956.44221215, 140232944.46194375, 48981960.44023314, 0, 0, 0, 0, 0 },
-  { 140232915.45598263, 48981957.52648307, 140232916.5200402, 48981917.540638305, 140232914.39192504, 48981997.51232783, 140232915.5091855, 48981955.52719083, 140232915.40277976, 48981959.525775306, 0, 0, 0, 0, 0 },
-  { 140232886.38736314, 48981956.75294219, 140232887.18188092, 48981916.7608337, 140232885.59284535, 48981996.745050676, 140232886.42708904, 48981954.753336765, 140232886.34763724, 48981958.752547614, 0, 0, 0, 0, 0 },
-  { 140232857.32250944, 48981956.17551468, 140232857.7717954, 48981916.178037986, 140232856.87322348, 48981996.17299138, 140232857.34497374, 48981954.17564085, 140232857.30004513, 48981958.175388515, 0, 0, 0, 0, 0 },
-  { 140232828.2649408, 48981955.849115156, 140232828.2931118, 48981915.84912507, 140232828.2367698, 48981995.84910524, 140232828.26634935, 48981953.849115655, 140232828.26353225, 48981957.84911466, 1, 2, 140232828.1600038, 48982104.8490782, 45 },
-  { 140232799.21817645, 48981955.82865824, 140232798.7492156, 48981915.83140738, 140232799.6871373, 48981995.82590909, 140232799.1947284, 48981953.828795694, 140232799.2416245, 48981957.82852078, 0, 0, 0, 0, 0 },
-  { 140232770.1857357, 48981956.169058576, 140232769.14361814, 48981916.18263599, 140232771.22785327, 48981996.15548116, 140232770.13362983, 48981954.16973745, 140232770.23784158, 48981958.1683797, 0, 0, 0, 0, 0 },
-  { 140232741.17113778, 48981956.92523079, 140232739.4502367, 48981916.9622667, 140232742.89203885, 48981996.88819489, 140232741.08509272, 48981954.92708259, 140232741.25718284, 48981958.923379, 0, 0, 0, 0, 0 },
-  { 140232712.1817724, 48981958.1735824, 140232709.50457484, 48981918.263275295, 140232714.85897, 48981998.0838895, 140232712.04791254, 48981956.17806704, 140232712.31563228, 48981960.16909775, 0, 0, 0, 0, 0 },
-  { 140232683.2473576, 48981960.114513226, 140232679.27526668, 48981920.312220655, 140232687.21944854, 48981999.9168058, 140232683.04875305, 48981958.1243986, 140232683.44596216, 48981962.104627855, 0, 0, 0, 0, 0 },
-  { 140232654.4056013, 48981962.99279162, 140232648.80441588, 48981923.386899106, 140232660.0067867, 48982002.59868414, 140232654.125542, 48981961.012497, 140232654.68566057, 48981964.973086245, 0, 0, 0, 0, 0 },
-  { 140232625.69422156, 48981967.05324201, 140232618.15592366, 48981927.769987755, 140232633.23251945, 48982006.33649627, 140232625.31730667, 48981965.0890793, 140232626.07113644, 48981969.01740473, 0, 0, 0, 0, 0 },
-  { 140232597.16141334, 48981972.52857271, 140232587.4941868, 48981933.7143391, 140232606.8286399, 48982011.34280632, 140232596.678052, 48981970.58786103, 140232597.64477468, 48981974.469284385, 1, 0, 140232644.0474621, 48982160.77760573, 27 },
-  { 140232568.93571734, 48981979.5585762, 140232556.99381664, 48981941.382785335, 140232580.87761804, 48982017.73436706, 140232568.3386223, 48981977.64978665, 140232569.5328124, 48981981.46736574, 0, 0, 0, 0, 0 },
-  { 140232541.18285787, 48981988.240043804, 140232526.82250637, 48981950.90667663, 140232555.54320937, 48982025.57341098, 140232540.4648403, 48981986.373375446, 140232541.90087545, 48981990.10671216, 1, 4, 140232677.6061972, 48982342.90703195, 41 },
-  { 140232514.06876132, 48981998.66953321, 140232497.16044083, 48981962.418896, 140232530.9770818, 48982034.92017042, 140232513.2233453, 48981996.85700135, 140232514.91417733, 48982000.48206507, 1, 4, 140232388.94718975, 48981730.414817825, 44 },
-  { 140232487.7584109, 48982010.941423334, 140232468.37472966, 48981975.95181199, 140232507.14209214, 48982045.93103468, 140232486.78922683, 48982009.19194277, 140232488.72759497, 48982012.6909039, 0, 0, 0, 0, 0 },
-  { 140232462.35749844, 48982025.0131198, 140232440.84796858, 48981991.28864612, 140232483.8670283, 48982058.73759349, 140232461.28202194, 48982023.326896116, 140232463.43297493, 48982026.69934349, 0, 0, 0, 0, 0 },
-  { 140232437.87822318, 48982040.62604551, 140232414.58071402, 48982008.11103257, 140232461.17573234, 48982073.14105845, 140232436.71334773, 48982039.000294864, 140232439.04309863, 48982042.251796156, 1, 0, 140232581.7403423, 48982241.406250425, 25 },
-  { 140232414.3245499, 48982057.50261634, 140232389.51569718, 48982026.12554149, 140232439.13340265, 48982088.87969118, 140232413.08410728, 48982055.933762595, 140232415.56499255, 48982059.07147008, 1, 0, 140232217.09417066, 48981808.05487132, 48 },
-  { 140232391.68377215, 48982075.4039575, 140232365.54559237, 48982045.125325456, 140232417.82195193, 48982105.682589546, 140232390.37686315, 48982073.8900259, 140232392.99068114, 48982076.9178891, 0, 0, 0, 0, 0 },
-  { 140232369.88804194, 48982094.21923005, 140232342.58277583, 48982064.98872471, 140232397.19330806, 48982123.44973539, 140232368.52277863, 48982092.75770478, 140232371.25330526, 48982095.68075532, 1, 2, 140232241.5532912, 48981956.83585495, 40 },
-  { 140232348.85812607, 48982113.86403066, 140232320.54152185, 48982085.6121294, 140232377.1747303, 48982142.11593192, 140232347.44229585, 48982112.451435596, 140232350.2739563, 48982115.27662572, 0, 0, 0, 0, 0 },
-  { 140232328.51479128, 48982134.253956094, 140232299.3339984, 48982106.8955693, 140232357.69558415, 48982161.61234289, 140232327.05575165, 48982132.88603675, 140232329.9738309, 48982135.621875435, 0, 0, 0, 0, 0 },
-  { 140232308.77880445, 48982155.30460312, 140232278.87138093, 48982128.742486894, 140232338.68622798, 48982181.86671935, 140232307.2834333, 48982153.97649731, 140232310.2741756, 48982156.63270894, 1, 4, 140232424.6700706, 48982258.23280351, 37 },
-  { 140232289.5709323, 48982176.93156847, 140232259.06475425, 48982151.0593227, 140232320.07711035, 48982202.80381425, 140232288.0456234, 48982175.63795619, 140232291.0962412, 48982178.22518076, 0, 0, 0, 0, 0 },
-  { 140232270.8119416, 48982199.05044889, 140232239.82579732, 48982173.75501721, 140232301.79808587, 48982224.34588056, 140232269.26263437, 48982197.78567731, 140232272.36124882, 48982200.31522047, 1, 4, 140232360.67175996, 48982272.407200746, 49 },
-  { 140232252.42259923, 48982221.576841116, 140232221.06727135, 48982196.740508586, 140232283.7779271, 48982246.413173646, 140232250.85483283, 48982220.33502449, 140232253.99036562, 48982222.81865774, 1, 4, 140232077.6166463, 48982083.11428726, 34 },
-  { 140232234.32367194, 48982244.42634189, 140232202.7033473, 48982219.92827933, 140232265.94399658, 48982268.92440445, 140232232.7426557, 48982243.20143876, 140232235.90468818, 48982245.65124502, 1, 3, 140232511.7920207, 48982459.39684087, 25 },
-  { 140232216.43592653, 48982267.514547974, 140232184.64981395, 48982243.23198124, 140232248.2220391, 48982291.79711471, 140232214.8466209, 48982266.300419636, 140232218.02523217, 48982268.72867631, 0, 0, 0, 0, 0 },
-  { 140232198.68012977, 48982290.75705611, 140232166.82419923, 48982266.566155136, 140232230.5360603, 48982314.94795708, 140232197.08733323, 48982289.54751106, 140232200.2729263, 48982291.966601156, 1, 0, 140232317.343471, 48982380.86816224, 29 },
-  { 140232180.9770485, 48982314.06946304, 140232149.14583263, 48982289.84605087, 140232212.80826434, 48982338.2928752, 140232179.3854877, 48982312.85829243, 140232182.56860927, 48982315.28063364, 1, 0, 140232096.62432647, 48982249.8774208, 42 },
-  { 140232163.24744946, 48982337.367365494, 140232131.53586483, 48982312.98755005, 140232194.9590341, 48982361.74718094, 140232161.66187024, 48982336.14837472, 140232164.83302867, 48982338.58635627, 1, 5, 140232290.09378794, 48982434.88662726, 25 },
-  { 140232145.41209948, 48982360.56636023, 140232113.9172532, 48982335.9071904, 140232176.90694577, 48982385.22553006, 140232143.83735716, 48982359.33340174, 140232146.9868418, 48982361.799318716, 0, 0, 0, 0, 0 },
-  { 140232127.3917653, 48982383.58204401, 140232096.21470943, 48982358.52229165, 140232158.56882116, 48982408.64179637, 140232125.8329125, 48982382.3290564, 140232128.9506181, 48982384.83503163, 1, 1, 140232300.42442527, 48982522.66366962, 33 },
-  { 140232109.1072138, 48982406.33001355, 140232078.35459936, 48982380.751180395, 140232139.85982823, 48982431.908846706, 140232107.5695831, 48982405.05107189, 140232110.6448445, 48982407.60895521, 0, 0, 0, 0, 0 },
-  { 140232090.47921178, 48982428.725865625, 140232060.25911155, 48982402.5200353, 140232120.699312, 48982454.93169595, 140232088.96820676, 48982427.41557411, 140232091.9902168, 48982430.03615714, 1, 2, 140232179.6285074, 48982506.0330651, 25 },
-  { 140232071.4328599, 48982450.68978187, 140232041.77889213, 48982423.84500218, 140232101.08682767, 48982477.53456155, 140232069.95016152, 48982449.34754288, 140232072.91555828, 48982452.03202085, 0, 0, 0, 0, 0 },
-  { 140232051.9543779, 48982472.20660131, 140232022.83884984, 48982444.778768234, 140232081.06990594, 48982499.63443438, 140232050.4986015, 48982470.83520965, 140232053.41015428, 48982473.57799296, 0, 0, 0, 0, 0 },
-  { 140232032.07519695, 48982493.30899202, 140232003.46535078, 48982465.354087226, 140232060.68504313, 48982521.263896815, 140232030.64470464, 48982491.911246784, 140232033.50568926, 48982494.70673726, 1, 0, 140231840.38922763, 48982306.011129886, 29 },
-  { 140232011.8278097, 48982514.03074511, 140231983.68767405, 48982485.60306906, 140232039.96794534, 48982542.45842116, 140232010.42080292, 48982512.609361306, 140232013.23481646, 48982515.45212892, 1, 3, 140232125.09185567, 48982628.452141225, 49 },
-  { 140231991.244709, 48982534.40565173, 140231963.5355429, 48982505.55773822, 140232018.95387512, 48982563.253565244, 140231989.85925072, 48982532.96325606, 140231992.6301673, 48982535.848047405, 0, 0, 0, 0, 0 },
-  { 140231970.35838753, 48982554.46750304, 140231943.0390932, 48982525.25010826, 140231997.67768186, 48982583.684897825, 140231968.99242282, 48982553.006633304, 140231971.72435224, 48982555.92837278, 0, 0, 0, 0, 0 },
-  { 140231949.20133817, 48982574.25009018, 140231922.22884026, 48982544.71224402, 140231976.17383608, 48982603.787936345, 140231947.8527133, 48982572.773197874, 140231950.54996306, 48982575.72698249, 0, 0, 0, 0, 0 },
-  { 140231927.80605355, 48982593.78720426, 140231901.13564077, 48982563.97631561, 140231954.47646633, 48982623.598092906, 140231926.4725329, 48982592.29665983, 140231929.1395742, 48982595.27774869, 0, 0, 0, 0, 0 },
-  { 140231906.20502654, 48982613.11263644, 140231879.7906585, 48982583.07464115, 140231932.61939457, 48982643.150631726, 140231904.88430813, 48982611.610736676, 140231907.52574494, 48982614.6145362, 1, 5, 140231726.5873238, 48982408.85426851, 29 },
-  { 140231884.43074983, 48982632.26017786, 140231858.2253294, 48982602.039722204, 140231910.63617027, 48982662.48063351, 140231883.1204788, 48982630.749155074, 140231885.74102086, 48982633.77120064, 0, 0, 0, 0, 0 },
-  { 140231862.5157162, 48982651.26361966, 140231836.4713322, 48982620.90427081, 140231888.5601002, 48982681.62296851, 140231861.21349698, 48982649.74565222, 140231863.8179354, 48982652.7815871, 0, 0, 0, 0, 0 },
-  { 140231840.49241838, 48982670.156752974, 140231814.56056273, 48982639.70123029, 140231866.42427403, 48982700.61227566, 140231839.1958256, 48982668.63397684, 140231841.78901115, 48982671.67952911, 0, 0, 0, 0, 0 },
-  { 140231818.3933491, 48982688.973368935, 140231792.5251137, 48982658.46379016, 140231844.26158452, 48982719.48294771, 140231817.09993735, 48982687.44789, 140231819.68676087, 48982690.49884787, 1, 5, 140231698.10605448, 48982547.10382763, 31 },
-  { 140231796.25100118, 48982707.7472587, 140231770.3972607, 48982677.22539599, 140231822.10474166, 48982738.26912141, 140231794.95831415, 48982706.22116557, 140231797.5436882, 48982709.27335183, 1, 3, 140231974.6418105, 48982918.348111376, 38 },
-  { 140231774.09786743, 48982726.512213394, 140231748.20945394, 48982696.01975455, 140231799.98628092, 48982757.00467224, 140231772.80344674, 48982724.987590455, 140231775.39228812, 48982728.03683633, 1, 2, 140231549.5158803, 48982461.99013293, 44 },
-  { 140231751.9664405, 48982745.30202417, 140231725.9943157, 48982714.88083527, 140231777.93856528, 48982775.72321307, 140231750.66783425, 48982743.780964725, 140231753.26504675, 48982746.82308362, 1, 1, 140231913.6429173, 48982934.673925065, 37 },
-  { 140231729.88921323, 48982764.15048218, 140231703.78464577, 48982733.84286668, 140231755.9937807, 48982794.458097674, 140231728.58398485, 48982762.6351014, 140231731.19444162, 48982765.665862955, 1, 5, 140231554.335997, 48982560.33176796, 29 },
-  { 140231707.89867827, 48982783.091378525, 140231681.61343062, 48982752.94032952, 140231734.18392593, 48982813.24242753, 140231706.58441588, 48982781.58382607, 140231709.21294066, 48982784.59893098, 1, 1, 140231776.24032217, 48982861.48410592, 44 },
-  { 140231686.0273285, 48982802.15850437, 140231659.51386127, 48982772.20794418, 140231712.5407957, 48982832.10906456, 140231684.70165512, 48982800.66097636, 140231687.35300186, 48982803.656032376, 1, 1, 140231495.79320112, 48982587.26323502, 46 },
-  { 140231664.30765662, 48982821.385650866, 140231637.5193545, 48982791.68065349, 140231691.09595874, 48982851.09064824, 140231662.9682415, 48982819.900400996, 140231665.64707172, 48982822.870900735, 1, 4, 140231794.90062952, 48982966.19751306, 47 },
-  { 140231642.77215537, 48982840.80660912, 140231615.66358003, 48982811.393599376, 140231669.88073072, 48982870.21961886, 140231641.41672662, 48982839.33595863, 140231644.12758413, 48982842.2772596, 1, 0, 140231478.76527447, 48982662.85790018, 41 },
-  { 140231621.45331755, 48982860.4551703, 140231593.98049223, 48982831.382092215, 140231648.92614287, 48982889.52824839, 140231620.0796763, 48982859.0015164, 140231622.8269588, 48982861.908824205, 0, 0, 0, 0, 0 },
-  { 140231600.3836359, 48982880.36512553, 140231572.5043641, 48982851.681572676, 140231628.2629077, 48982909.04867838, 140231598.98967233, 48982878.930947885, 140231601.77759948, 48982881.799303174, 0, 0, 0, 0, 0 },
-  { 140231579.5956032, 48982900.57026598, 140231551.27040347, 48982872.326982506, 140231607.92080292, 48982928.81354945, 140231578.17934322, 48982899.158101805, 140231581.01186317, 48982901.98243015, 0, 0, 0, 0, 0 },
-  { 140231559.1214227, 48982921.10382936, 140231530.33032665, 48982893.335631944, 140231587.91251877, 48982948.87202678, 140231557.6818679, 48982919.71541949, 140231560.56097752, 48982922.49223923, 0, 0, 0, 0, 0 },
-  { 140231538.98460314, 48982941.98243008, 140231509.72834828, 48982914.70475509, 140231568.240858, 48982969.260105066, 140231537.5217904, 48982940.61854633, 140231540.4474159, 48982943.34631383, 1, 0, 140231658.2038416, 48983053.13895565, 39 },
-  { 140231519.19864842, 48982963.203554444, 140231489.4792709, 48982936.43120678, 140231548.91802594, 48982989.97590211, 140231517.71267954, 48982961.86493706, 140231520.6846173, 48982964.54217183, 1, 4, 140231404.77904496, 48982860.13001592, 39 },
-  { 140231499.7765095, 48982984.763631515, 140231469.59627676, 48982958.511897236, 140231529.95674223, 48983011.015365794, 140231498.26749787, 48982983.4510448, 140231501.28552112, 48982986.07621823, 1, 4, 140231631.06052184, 48983098.95867564, 48 },
-  { 140231480.73113728, 48983006.659090295, 140231450.0925912, 48982980.943735085, 140231511.36968336, 48983032.374445505, 140231479.19920996, 48983005.37332253, 140231482.2630646, 48983007.94485806, 1, 3, 140231394.17724457, 48982934.013211824, 46 },
-  { 140231462.07548276, 48983028.8863598, 140231430.98148432, 48983003.72362424, 140231493.1694812, 48983054.04909537, 140231460.52078283, 48983027.628223024, 140231463.63018268, 48983030.14449658, 1, 0, 140231743.47616857, 48983256.60911671, 31 },
-  { 140231443.82249683, 48983051.44186909, 140231412.27627257, 48983026.84846071, 140231475.3687211, 48983076.03527746, 140231442.2451856, 48983050.21219867, 140231445.39980805, 48983052.67153951, 0, 0, 0, 0, 0 },
-  { 140231425.9851304, 48983074.3220471, 140231393.99032003, 48983050.315129146, 140231457.97994077, 48983098.32896505, 140231424.3853899, 48983073.1217012, 140231427.5848709, 48983075.522392996, 0, 0, 0, 0, 0 },
-  { 140231408.57633445, 48983097.523322925, 140231376.13704026, 48983074.12049846, 140231441.01562864, 48983120.92614739, 140231406.95436972, 48983096.353181705, 140231410.19829917, 48983098.693464145, 0, 0, 0, 0, 0 },
-  { 140231391.60905993, 48983121.04212556, 140231358.70472628, 48983098.29778941, 140231424.51339358, 48983143.78646171, 140231389.96384326, 48983119.904908754, 140231393.2542766, 48983122.17934237, 0, 0, 0, 0, 0 },
-  { 140231375.12354115, 48983144.89179991, 140231341.63157952, 48983123.02199182, 140231408.61550277, 48983166.761608005, 140231373.44894308, 48983143.798309505, 140231376.7981392, 48983145.98529032, 0, 0, 0, 0, 0 },
-  { 140231359.2776315, 48983169.158615425, 140231325.06518805, 48983148.43402344, 140231393.49007493, 48983189.88320741, 140231357.56700933, 48983168.12238582, 140231360.98825365, 48983170.19484503, 0, 0, 0, 0, 0 },
-  { 140231344.2608728, 48983193.94848861, 140231309.22254354, 48983174.65301035, 140231379.29920208, 48983213.24396686, 140231342.50895634, 48983192.98371469, 140231346.01278928, 48983194.91326252, 0, 0, 0, 0, 0 },
-  { 140231330.2628075, 48983219.36733626, 140231294.32936186, 48983201.794986255, 140231366.19625312, 48983236.93968626, 140231328.4661352, 48983218.488718756, 140231332.05947977, 48983220.24595376, 1, 2, 140231676.12222174, 48983388.50120504, 31 },
-  { 140231317.4729777, 48983245.52107514, 140231280.61601037, 48983229.97874712, 140231354.32994503, 48983261.06340315, 140231315.63012934, 48983244.743958734, 140231319.31582606, 48983246.29819154, 1, 1, 140231208.74492413, 48983199.67120749, 47 },
-  { 140231306.10450366, 48983272.48019449, 140231268.319777, 48983259.353335306, 140231343.8892303, 48983285.60705367, 140231304.21526733, 48983271.823851526, 140231307.99374, 48983273.13653745, 0, 0, 0, 0, 0 },
-  { 140231296.5039724, 48983300.11463803, 140231257.83522347, 48983289.880975224, 140231335.17272136, 48983310.34830084, 140231294.57053497, 48983299.60295489, 140231298.43740985, 48983300.626321174, 1, 1, 140231006.48835528, 48983223.36216698, 26 },
-  { 140231289.06488192, 48983328.22386227, 140231249.6442501, 48983321.44051604, 140231328.48551375, 48983335.0072085, 140231287.0938503, 48983327.884694956, 140231291.03591353, 48983328.56302958, 1, 1, 140231553.18311518, 48983373.672282, 47 },
-  { 140231284.1807816, 48983356.60724621, 140231244.28353724, 48983353.741955295, 140231324.07802597, 48983359.47253713, 140231282.18591937, 48983356.463981666, 140231286.17564383, 48983356.75051076, 0, 0, 0, 0, 0 },
-  { 140231282.13526002, 48983385.08975533, 140231242.14170116, 48983385.807564884, 140231322.12881887, 48983384.37194577, 140231280.13558206, 48983385.1256458, 140231284.13493797, 48983385.05386485, 0, 0, 0, 0, 0 },
-  { 140231282.6474626, 48983413.627693035, 140231242.81289408, 48983417.26185717, 140231322.48203114, 48983409.9935289, 140231280.65573418, 48983413.809401244, 140231284.63919103, 48983413.445984825, 0, 0, 0, 0, 0 },
-  { 140231285.2559235, 48983442.219388664, 140231245.6877142, 48983448.08085696, 140231324.82413283, 48983436.35792037, 140231283.27751306, 48983442.51246208, 140231287.23433396, 48983441.92631525, 1, 5, 140231654.2294755, 48983387.561196834, 27 },
-  { 140231289.49909595, 48983470.86319032, 140231250.19321054, 48983478.28258201, 140231328.80498135, 48983463.44379864, 140231287.53380167, 48983471.23415991, 140231291.46439022, 48983470.49222074, 1, 5, 140231103.77878743, 48983505.919816025, 49 },
-  { 140231294.915433, 48983499.55744616, 140231255.79463744, 48983507.89791118, 140231334.03622854, 48983491.216981135, 140231292.9593932, 48983499.97446941, 140231296.87147278, 48983499.14042291, 1, 0, 140231647.9806127, 48983424.28474932, 27 },
-  { 140231301.0433879, 48983528.30050425, 140231261.99022675, 48983536.95212869, 140231340.09654903, 48983519.64887981, 140231299.09072983, 48983528.733085476, 140231302.99604595, 48983527.86792303, 1, 2, 140231034.50556317, 48983587.34784108, 28 },
-  { 140231307.42141375, 48983557.090712756, 140231268.30583826, 48983565.45562482, 140231346.53698924, 48983548.72580069, 140231305.46563497, 48983557.50895836, 140231309.37719253, 48983556.67246715, 0, 0, 0, 0, 0 },
-  { 140231313.5879638, 48983585.926419795, 140231274.29258657, 48983593.401266254, 140231352.883341, 48983578.451573335, 140231311.62319493, 48983586.300162114, 140231315.55273265, 48983585.552677475, 1, 0, 140230950.10572457, 48983655.06874957, 46 },
-  { 140231319.08149114, 48983614.80597346, 140231279.53060138, 48983620.78319008, 140231358.6323809, 48983608.82875685, 140231317.10394666, 48983615.104834296, 140231321.05903563, 48983614.50711263, 1, 0, 140231594.94894728, 48983573.11488756, 43 },
-  { 140231323.4523302, 48983643.72755769, 140231283.67645758, 48983647.95602747, 140231363.22820282, 48983639.49908791, 140231321.46353656, 48983643.938981175, 140231325.44112384, 48983643.5161342, 1, 0, 140231117.61218935, 48983665.609888814, 36 },
-  { 140231326.53077257, 48983672.68548755, 140231286.61644304, 48983675.30203083, 140231366.4451021, 48983670.068944275, 140231324.53505608, 48983672.81631472, 140231328.52648905, 48983672.55466039, 1, 3, 140231707.7126195, 48983647.69749927, 27 },
-  { 140231328.4308331, 48983701.67015713, 140231288.4479346, 48983702.83969888, 140231368.4137316, 48983700.50061537, 140231326.4316882, 48983701.728634216, 140231330.429978, 48983701.61168004, 0, 0, 0, 0, 0 },
-  { 140231329.27916119, 48983730.67178589, 140231289.2793012, 48983730.56594966, 140231369.27902117, 48983730.77762212, 140231327.2791682, 48983730.66649408, 140231331.27915418, 48983730.6770777, 1, 4, 140231481.27862912, 48983731.07396356, 34 },
-  { 140231329.20240635, 48983759.680593364, 140231289.22060147, 48983758.474244356, 140231369.18421122, 48983760.88694237, 140231327.2033161, 48983759.620275915, 140231331.2014966, 48983759.74091081, 1, 0, 140230962.3693465, 48983748.612341195, 49 },
-  { 140231328.32721806, 48983788.68679903, 140231288.3840324, 48983786.55562099, 140231368.2704037, 48983790.81797706, 140231326.33005878, 48983788.58024012, 140231330.32437733, 48983788.79335793, 1, 5, 140231506.07439423, 48983798.1705413, 47 },
-  { 140231326.7802458, 48983817.68062238, 140231286.88413167, 48983814.79963697, 140231366.67635995, 48983820.561607786, 140231324.78544012, 48983817.536573105, 140231328.7750515, 48983817.82467165, 0, 0, 0, 0, 0 },
-  { 140231324.68813902, 48983846.65228293, 140231284.8378145, 48983843.19516905, 140231364.53846353, 48983850.109396815, 140231322.6956228, 48983846.47942723, 140231326.68065524, 48983846.82513863, 1, 1, 140231460.17924237, 48983858.40647013, 39 },
-  { 140231322.17754722, 48983875.59200015, 140231282.36540633, 48983871.719864115, 140231361.9896881, 48983879.46413618, 140231320.18694016, 48983875.39839335, 140231324.16815427, 48983875.78560695, 0, 0, 0, 0, 0 },
-  { 140231319.36685577, 48983904.490686245, 140231279.5911188, 48983900.260940336, 140231359.14259273, 48983908.720432155, 140231317.37806892, 48983904.27919895, 140231321.35564262, 48983904.70217354, 0, 0, 0, 0, 0 },
-  { 140231316.29842582, 48983933.345625766, 140231276.56211668, 48983928.760242976, 140231356.03473496, 48983937.931008555, 140231314.31161037, 48983933.116356626, 140231318.28524128, 48983933.574894905, 0, 0, 0, 0, 0 },
-  { 140231312.9736672, 48983962.15753577, 140231273.2798191, 48983957.21805989, 140231352.6675153, 48983967.09701165, 140231310.9889748, 48983961.91056198, 140231314.9583596, 48983962.40450956, 0, 0, 0, 0, 0 },
-  { 140231309.3935936, 48983990.9271666, 140231269.74519417, 48983985.635246105, 140231349.04199305, 48983996.2190871, 140231307.41117364, 48983990.66257058, 140231311.37601358, 48983991.191762626, 0, 0, 0, 0, 0 },
-  { 140231305.55921862, 48984019.655268505, 140231265.95920715, 48984014.012654506, 140231345.15923008, 48984025.297882505, 140231303.57921803, 48984019.3731378, 140231307.5392192, 48984019.93739921, 0, 0, 0, 0, 0 },
-  { 140231301.47155586, 48984048.34259179, 140231261.9228207, 48984042.35113559, 140231341.02029103, 48984054.334047996, 140231299.4941191, 48984048.04301898, 140231303.4489926, 48984048.6421646, 1, 5, 140231142.28789684, 48984024.22698059, 36 },
-  { 140231297.131619, 48984076.98988678, 140231257.63699502, 48984070.65153715, 140231336.626243, 48984083.328236416, 140231295.1568878, 48984076.672969304, 140231299.1063502, 48984077.30680426, 1, 3, 140231609.1391485, 48984127.0628489, 30 },
-  { 140231292.54042163, 48984105.597903736, 140231253.10268784, 48984098.91470443, 140231331.97815543, 48984112.281103045, 140231290.56853494, 48984105.26374377, 140231294.51230833, 48984105.9320637, 0, 0, 0, 0, 0 },
-  { 140231287.69897735, 48984134.16739298, 140231248.32085466, 48984127.14148, 140231327.07710004, 48984141.193305954, 140231285.73007122, 48984133.81609733, 140231289.6678835, 48984134.51868863, 0, 0, 0, 0, 0 },
-  { 140231282.60829982, 48984162.69910479, 140231243.29244894, 48984155.3327034, 140231321.9241507, 48984170.06550619, 140231280.64250728, 48984162.33078472, 140231284.57409236, 48984163.06742486, 1, 4, 140231053.59346843, 48984119.78981666, 48 },
-  { 140231277.26940265, 48984191.19378947, 140231238.01842207, 48984183.489211366, 140231316.52038324, 48984198.89836757, 140231275.30685362, 48984190.808560565, 140231279.23195168, 48984191.57901837, 1, 4, 140231533.38205093, 48984241.46616159, 38 },
-  { 140231271.6832995, 48984219.65219731, 140231232.4997237, 48984211.61183748, 140231310.86687532, 48984227.69255714, 140231269.7241207, 48984219.25017932, 140231273.64247832, 48984220.0542153, 1, 5, 140230961.15346116, 48984155.93234564, 35 },
-  { 140231265.851004, 48984248.07507862, 140231226.73716807, 48984239.70203619, 140231304.96483994, 48984256.448121056, 140231263.89531222, 48984247.6564265, 140231267.8066958, 48984248.493730746, 1, 2, 140231410.5721969, 48984279.055335626, 37 },
-  { 140231259.77399245, 48984276.46323439, 140231220.72772482, 48984267.78055135, 140231298.82026008, 48984285.14591742, 140231257.82167906, 48984276.02910023, 140231261.72630584, 48984276.89736854, 1, 1, 140230927.88071766, 48984202.660428576, 39 },
-  { 140231253.46852756, 48984304.81908576, 140231214.4817269, 48984295.87317184, 140231292.4553282, 48984313.76499968, 140231251.5191875, 48984304.37179007, 140231255.4178676, 48984305.26638146, 1, 1, 140231389.92232978, 48984336.12978447, 48 },
-  { 140231246.96840808, 48984333.146975406, 140231208.0317529, 48984323.98526785, 140231285.90506324, 48984342.30868296, 140231245.02157533, 48984332.688890025, 140231248.91524082, 48984333.605060786, 0, 0, 0, 0, 0 },
-  { 140231240.30845052, 48984361.45135744, 140231201.41186658, 48984352.12098997, 140231279.20503446, 48984370.78172491, 140231238.36362132, 48984360.98483907, 140231242.25327972, 48984361.91787581, 0, 0, 0, 0, 0 },
-  { 140231233.52347142, 48984389.73668599, 140231194.65630013, 48984380.284543544, 140231272.3906427, 48984399.18882844, 140231231.58011284, 48984389.26407887, 140231235.46683, 48984390.20929311, 0, 0, 0, 0, 0 },
-  { 140231226.64828727, 48984418.00741523, 140231187.79945, 48984408.48019924, 140231265.49712452, 48984427.534631215, 140231224.70584542, 48984417.53105443, 140231228.59072912, 48984418.483776025, 0, 0, 0, 0, 0 },
-  { 140231219.71771464, 48984446.26799927, 140231180.8758736, 48984436.71230023, 140231258.55955568, 48984455.823698305, 140231217.77562258, 48984445.790214315, 140231221.6598067, 48984446.74578422, 0, 0, 0, 0, 0 },
-  { 140231212.76657003, 48984474.52289229, 140231173.920287, 48984464.98526697, 140231251.61285305, 48984484.06051761, 140231210.82425588, 48984474.04601102, 140231214.70888418, 48984474.999773555, 0, 0, 0, 0, 0 },
-  { 140231205.8296699, 48984502.77654841, 140231166.96756455, 48984493.30359914, 140231244.69177523, 48984512.249497674, 140231203.8865646, 48984502.30290095, 140231207.77277517, 48984503.25019587, 1, 0, 140230905.61990607, 48984429.59801531, 48 },
-  { 140231198.9418308, 48984531.03342178, 140231160.05273944, 48984521.67187422, 140231237.8309222, 48984540.39496934, 140231196.99737623, 48984530.5653444, 140231200.8862854, 48984531.50149915, 0, 0, 0, 0, 0 },
-  { 140231192.13786933, 48984559.29796653, 140231153.21100593, 48984550.09474392, 140231231.06473273, 48984568.50118914, 140231190.19152614, 48984558.837805405, 140231194.0842125, 48984559.75812766, 1, 2, 140231016.96698406, 48984517.88346477, 42 },
-  { 140231185.4526019, 48984587.57463683, 140231146.47772244, 48984578.5769277, 140231224.42748138, 48984596.572345965, 140231183.50385794, 48984587.124751374, 140231187.40134588, 48984588.02452229, 0, 0, 0, 0, 0 },
-  { 140231178.92084512, 48984615.86788679, 140231139.88841632, 48984607.12320264, 140231217.95327392, 48984624.61257094, 140231176.96922368, 48984615.43065258, 140231180.87246656, 48984616.305121, 1, 3, 140231059.87193725, 48984589.196600124, 32 },
-  { 140231172.5774154, 48984644.18217058, 140231133.47878894, 48984635.73839132, 140231211.67604187, 48984652.62594984, 140231170.6224841, 48984643.75998162, 140231174.53234673, 48984644.60435954, 1, 2, 140231398.37198326, 48984692.94499578, 49 },
-  { 140231166.4571294, 48984672.52194233, 140231127.28472215, 48984664.427344725, 140231205.62953663, 48984680.61653994, 140231164.49850902, 48984672.11721245, 140231168.41574976, 48984672.92667221, 1, 3, 140230837.40890852, 48984604.52732242, 40 },
-  { 140231160.59480348, 48984700.891656175, 140231121.34228373, 48984693.19492358, 140231199.84732324, 48984708.58838877, 140231158.6321775, 48984700.506819546, 140231162.55742946, 48984701.276492804, 0, 0, 0, 0, 0 },
-  { 140231155.02525428, 48984729.29576628, 140231115.68773383, 48984722.04597415, 140231194.36277473, 48984736.54555841, 140231153.05837825, 48984728.933276676, 140231156.9921303, 48984729.65825588, 0, 0, 0, 0, 0 },
-  { 140231149.78329828, 48984757.73872678, 140231110.35752946, 48984750.98530145, 140231189.2090671, 48984764.49215211, 140231147.81200984, 48984757.401055515, 140231151.75458673, 48984758.076398045, 0, 0, 0, 0, 0 },
-  { 140231144.903752, 48984786.22499179, 140231105.38832766, 48984780.01763811, 140231184.41917634, 48984792.43234547, 140231142.92798078, 48984785.91462411, 140231146.87952322, 48984786.53535947, 0, 0, 0, 0, 0 },
-  { 140231140.421432, 48984814.7590155, 140231100.8169863, 48984809.14760922, 140231180.02587768, 48984820.37042178, 140231138.4412097, 48984814.47844519, 140231142.40165427, 48984815.039585814, 0, 0, 0, 0, 0 },
-  { 140231136.3711547, 48984843.345252015, 140231096.6805609, 48984838.37969436, 140231176.0617485, 48984848.31080967, 140231134.386625, 48984843.096974134, 140231138.3556844, 48984843.593529895, 1, 3, 140230903.18891606, 48984814.17260077, 43 },
-  { 140231132.78773668, 48984871.9881555, 140231093.01629773, 48984867.718185574, 140231172.55917564, 48984876.258125424, 140231130.79916474, 48984871.774657, 140231134.77630863, 48984872.201653995, 1, 5, 140231392.2963759, 48984899.84970925, 30 },
-  { 140231129.7059945, 48984900.69218009, 140231089.8618712, 48984897.164313816, 140231169.55011776, 48984904.220046364, 140231127.71378833, 48984900.515786774, 140231131.69820064, 48984900.868573405, 1, 1, 140230935.4658935, 48984883.493832015, 26 },
-  { 140231127.15870824, 48984929.46152089, 140231087.25743464, 48984926.652897835, 140231167.05998185, 48984932.27014394, 140231125.16364455, 48984929.32108974, 140231129.15377194, 48984929.60195204, 0, 0, 0, 0, 0 },
-  { 140231125.1292042, 48984958.29408195, 140231085.18885323, 48984956.11042379, 140231165.0695552, 48984960.47774011, 140231123.13218665, 48984958.18489904, 140231127.12622178, 48984958.40326486, 1, 4, 140230957.37973008, 48984949.12271769, 34 },
-  { 140231123.5498546, 48984987.18128549, 140231083.58416602, 48984985.52486261, 140231163.5155432, 48984988.83770838, 140231121.55157018, 48984987.09846435, 140231125.54813904, 48984987.26410664, 0, 0, 0, 0, 0 },
-  { 140231122.3506951, 48985016.114256494, 140231082.36951292, 48985014.887443274, 140231162.3318773, 48985017.34106971, 140231120.351636, 48985016.052915834, 140231124.3497542, 48985016.17559715, 0, 0, 0, 0, 0 },
-  { 140231121.46176162, 48985045.084119976, 140231081.47176588, 48985044.18955865, 140231161.45175737, 48985045.9786813, 140231119.46226183, 48985045.03939191, 140231123.46126142, 48985045.12884804, 1, 3, 140231455.37822613, 48985052.55370704, 45 },
-  { 140231120.81308982, 48985074.082000874, 140231080.81852445, 48985073.42265103, 140231160.8076552, 48985074.74135072, 140231118.81336156, 48985074.04903338, 140231122.81281808, 48985074.11496837, 1, 4, 140230856.8489585, 48985069.73029188, 48 },
-  { 140231120.33471557, 48985103.09902423, 140231080.33810744, 48985102.57812287, 140231160.3313237, 48985103.61992559, 140231118.33488518, 48985103.07297916, 140231122.33454597, 48985103.1250693, 1, 3, 140231359.31444913, 48985106.21140987, 27 },
-  { 140231119.95667464, 48985132.12631502, 140231079.95954323, 48985131.64727581, 140231159.95380604, 48985132.60535423, 140231117.95681807, 48985132.10236306, 140231121.9565312, 48985132.15026698, 1, 4, 140230889.973169, 48985129.37183959, 34 },
-  { 140231119.60900277, 48985161.15499821, 140231079.6125637, 48985160.621274576, 140231159.60544184, 48985161.68872185, 140231117.6091808, 48985161.12831203, 140231121.60882473, 48985161.1816844, 1, 3, 140231406.58345318, 48985164.9844653, 47 },
-  { 140231119.22173578, 48985190.176198825, 140231079.2276026, 48985189.49113606, 140231159.21586895, 48985190.86126159, 140231117.22202912, 48985190.14194569, 140231121.22144243, 48985190.21045196, 1, 1, 140230885.25605667, 48985186.168581635, 34 },
-  { 140231118.72490945, 48985219.18104186, 140231078.735799, 48985218.247743174, 140231158.7140199, 48985220.114340544, 140231116.72545394, 48985219.13437693, 140231120.72436497, 48985219.22770679, 0, 0, 0, 0, 0 },
-  { 140231118.04855952, 48985248.16065226, 140231078.06893247, 48985246.88416475, 140231158.02818656, 48985249.437139764, 140231116.04957816, 48985248.09682788, 140231120.04754087, 48985248.224476635, 0, 0, 0, 0, 0 },
-  { 140231117.12436694, 48985277.10639148, 140231077.1587525, 48985275.4481807, 140231157.08998138, 48985278.764602266, 140231115.1260862, 48985277.023480944, 140231119.12264767, 48985277.18930202, 1, 0, 140231397.88280833, 48985288.75532223, 47 },
-  { 140231115.92490107, 48985306.015497014, 140231075.97589797, 48985303.9963012, 140231155.87390417, 48985308.03469283, 140231113.92745093, 48985305.91453722, 140231117.9223512, 48985306.11645681, 0, 0, 0, 0, 0 },
-  { 140231114.46539092, 48985334.891337015, 140231074.5348621, 48985332.53488436, 140231154.39591974, 48985337.247789666, 140231112.46886447, 48985334.77351438, 140231116.46191737, 48985335.00915965, 0, 0, 0, 0, 0 },
-  { 140231112.76306498, 48985363.73756696, 140231072.8522628, 48985361.067759976, 140231152.67386717, 48985366.40737395, 140231110.76752487, 48985363.60407662, 140231114.7586051, 48985363.87105731, 1, 2, 140230872.30048186, 48985347.65197986, 34 },
-  { 140231110.83515152, 48985392.557842344, 140231070.9447568, 48985389.598719425, 140231150.72554624, 48985395.51696526, 140231108.84063178, 48985392.409886196, 140231112.82967126, 48985392.70579849, 1, 4, 140231503.7555396, 48985421.70520309, 26 },
-  { 140231108.69887906, 48985421.355818644, 140231068.82904217, 48985418.13151931, 140231148.56871596, 48985424.58011798, 140231106.7053872, 48985421.194603674, 140231110.69237092, 48985421.517033614, 1, 3, 140230822.63279936, 48985398.221470945, 44 },
-  { 140231106.37147593, 48985450.13515133, 140231066.52185935, 48985446.66988686, 140231146.22109252, 48985453.600415796, 140231104.3789951, 48985449.961888105, 140231108.36395678, 48985450.30841455, 1, 3, 140231278.72106767, 48985465.12242016, 42 },
-  { 140231103.87017053, 48985478.89949588, 140231064.03999248, 48985475.21752398, 140231143.7003486, 48985482.58146778, 140231101.87866163, 48985478.71539728, 140231105.86167943, 48985479.08359447, 0, 0, 0, 0, 0 },
-  { 140231101.2121914, 48985507.65250781, 140231061.4002705, 48985503.778110504, 140231141.0241123, 48985511.52690512, 140231099.22159535, 48985507.45878795, 140231103.20278746, 48985507.846227676, 1, 2, 140231477.43484387, 48985544.26556233, 40 },
-  { 140231098.4147668, 48985536.39784256, 140231058.61956704, 48985532.355309136, 140231138.20996654, 48985540.44037599, 140231096.4250068, 48985536.19571589, 140231100.40452677, 48985536.59996924, 0, 0, 0, 0, 0 },
-  { 140231095.49512523, 48985565.13915565, 140231055.71480155, 48985560.95276721, 140231135.27544892, 48985569.32554409, 140231093.50610906, 48985564.92983623, 140231097.4841414, 48985565.34847507, 0, 0, 0, 0, 0 },
-  { 140231092.47049505, 48985593.88010254, 140231052.7029389, 48985589.57412083, 140231132.23805118, 48985598.18608425, 140231090.48211724, 48985593.66480345, 140231094.45887285, 48985594.09540162, 1, 4, 140230752.45789003, 48985557.06395893, 30 },
-  { 140231089.35810477, 48985622.62433871, 140231049.6009899, 48985618.22299596, 140231129.11521962, 48985627.02568146, 140231087.37024903, 48985622.40427157, 140231091.3459605, 48985622.844405845, 1, 0, 140231216.58087233, 48985636.7086355, 29 },
-  { 140231086.1751826, 48985651.37551965, 140231046.42601058, 48985646.90301218, 140231125.92435464, 48985655.84802712, 140231084.18772402, 48985651.15189427, 140231088.1626412, 48985651.599145025, 1, 0, 140230817.8682714, 48985621.18609424, 41 },
-  { 140231082.93895718, 48985680.13730084, 140231043.1951029, 48985675.61778235, 140231122.68281147, 48985684.656819336, 140231080.95176446, 48985679.91132492, 140231084.9261499, 48985680.363276765, 1, 5, 140231257.811916, 48985700.02318223, 26 },
-  { 140231079.66665676, 48985708.91333776, 140231039.9254137, 48985704.37091557, 140231119.40789983, 48985713.45575995, 140231077.6795946, 48985708.68621665, 140231081.65371892, 48985709.14045887, 1, 5, 140230808.43267283, 48985677.911306284, 34 },
-  { 140231076.37550986, 48985737.7072859, 140231036.634135, 48985733.1660167, 140231116.1168847, 48985742.24855511, 140231074.38844112, 48985737.48022244, 140231078.3625786, 48985737.934349366, 1, 1, 140231261.17290285, 48985758.8241877, 49 },
-  { 140231073.0827448, 48985766.52280074, 140231033.33850342, 48985762.00668768, 140231112.8269862, 48985771.03891381, 140231071.09553275, 48985766.29699509, 140231075.06995687, 48985766.7486064, 1, 1, 140230738.2375112, 48985728.47454818, 25 },
-  { 140231069.80559006, 48985795.36353775, 140231030.05579996, 48985790.89652691, 140231109.55538017, 48985799.83054859, 140231067.81810057, 48985795.14018721, 140231071.79307956, 48985795.58688829, 1, 3, 140231446.4348514, 48985837.68846544, 38 },
-  { 140231066.56127402, 48985824.23315244, 140231026.80334952, 48985819.839129195, 140231106.31919852, 48985828.62717569, 140231064.5733778, 48985824.01345128, 140231068.54917026, 48985824.452853605, 0, 0, 0, 0, 0 },
-  { 140231063.36702505, 48985853.135300264, 140231023.59852067, 48985848.838085, 140231103.13552943, 48985857.432515524, 140231061.37859982, 48985852.920439504, 140231065.35545027, 48985853.35016102, 0, 0, 0, 0, 0 },
-  { 140231060.24007162, 48985882.0736367, 140231020.45872512, 48985877.89697895, 140231100.02141812, 48985886.250294454, 140231058.2510043, 48985881.86480381, 140231062.22913894, 48985882.28246959, 1, 4, 140230868.29507473, 48985861.92126304, 43 },
-  { 140231057.19764212, 48985911.05181724, 140231017.40141717, 48985907.01938879, 140231096.99386707, 48985915.08424569, 140231055.20783088, 48985910.85019582, 140231059.18745336, 48985911.25343866, 0, 0, 0, 0, 0 },
-  { 140231054.25696498, 48985940.0734974, 140231014.44409323, 48985936.20888308, 140231094.06983674, 48985943.93811172, 140231052.2663214, 48985939.88026668, 140231056.24760857, 48985940.26672812, 0, 0, 0, 0, 0 },
-  { 140231051.43526858, 48985969.142332606, 140231011.60429108, 48985965.46901927, 140231091.26624608, 48985972.81564594, 140231049.4437197, 48985968.95866694, 140231053.42681745, 48985969.32599827, 1, 4, 140231401.94787064, 48986001.46748994, 31 },
-  { 140231048.7497813, 48985998.26197837, 140231008.89948067, 48985994.80458943, 140231088.60008195, 48986001.71936732, 140231046.75726628, 48985998.08910893, 140231050.74229634, 48985998.43484782, 0, 0, 0, 0, 0 },
-  { 140231046.21872166, 48986027.435290866, 140231006.34708476, 48986024.23332728, 140231086.09035856, 48986030.637254454, 140231044.22513983, 48986027.275192685, 140231048.2123035, 48986027.595389046, 1, 0, 140231221.65392402, 48986041.52393067, 38 },
-  { 140231043.87213394, 48986056.65557735, 140231003.97717625, 48986053.758621775, 140231083.76709163, 48986059.55253292, 140231041.87738606, 48986056.510729566, 140231045.86688182, 48986056.80042513, 0, 0, 0, 0, 0 },
-  { 140231041.74784648, 48986085.90986036, 140231001.82868433, 48986083.36811047, 140231081.66700864, 48986088.451610245, 140231039.75188836, 48986085.78277286, 140231043.7438046, 48986086.036947854, 1, 1, 140231283.25877756, 48986101.28744718, 33 },
-  { 140231039.88382402, 48986115.18505198, 140230999.94088468, 48986113.04926236, 140231079.82676336, 48986117.320841596, 140231037.88667706, 48986115.07826249, 140231041.88097098, 48986115.29184146, 0, 0, 0, 0, 0 },
-  { 140231038.31803155, 48986144.468064286, 140230998.35326105, 48986142.78963637, 140231078.28280205, 48986146.1464922, 140231036.31979302, 48986144.38414289, 140231040.31627008, 48986144.55198568, 1, 4, 140231153.2167467, 48986149.29354454, 45 },
-  { 140231037.08843398, 48986173.745809376, 140230997.1055183, 48986172.57685495, 140231077.07134965, 48986174.9147638, 140231035.0892882, 48986173.68736166, 140231039.08757976, 48986173.804257095, 1, 5, 140230797.19093996, 48986166.732082844, 49 },
-  { 140231036.23299628, 48986203.005199306, 140230996.2375965, 48986202.39857157, 140231076.22839606, 48986203.61182704, 140231034.2332263, 48986202.97486792, 140231038.23276627, 48986203.035530694, 0, 0, 0, 0, 0 },
-  { 140231035.78968322, 48986232.23314614, 140230995.7896843, 48986232.24243443, 140231075.78968215, 48986232.22385785, 140231033.78968328, 48986232.233610556, 140231037.78968316, 48986232.23268172, 0, 0, 0, 0, 0 },
-  { 140231035.79645982, 48986261.41656198, 140230995.8022314, 48986262.096041754, 140231075.79068825, 48986260.73708221, 140231033.7967484, 48986261.450535975, 140231037.79617125, 48986261.38258799, 0, 0, 0, 0, 0 },
-  { 140231036.29129097, 48986290.54235889, 140230996.3159575, 48986291.9468922, 140231076.26662445, 48986289.13782558, 140231034.2925243, 48986290.61258556, 140231038.29005763, 48986290.47213222, 1, 1, 140230736.47628993, 48986301.07635874, 46 },
-  { 140231037.31214154, 48986319.597448945, 140230997.3718573, 48986321.78232744, 140231077.2524258, 48986317.41257045, 140231035.3151273, 48986319.70669287, 140231039.30915576, 48986319.48820502, 0, 0, 0, 0, 0 },
-  { 140231038.89697653, 48986348.56874424, 140230999.01119918, 48986351.589466795, 140231078.78275388, 48986345.54802169, 140231036.90268767, 48986348.71978037, 140231040.8912654, 48986348.417708114, 1, 4, 140230910.26534456, 48986358.31057447, 47 },
-  { 140231041.08376077, 48986377.44315682, 140231001.2755152, 48986381.35513633, 140231080.89200634, 48986373.53117732, 140231039.0933485, 48986377.6387558, 140231043.07417303, 48986377.24755785, 1, 5, 140231187.37906328, 48986363.06663216, 38 },
-  { 140231043.91045925, 48986406.2075988, 140231004.20658064, 48986411.06579012, 140231083.61433786, 48986401.34940748, 140231041.9252653, 48986406.45050836, 140231045.8956532, 48986405.96468923, 0, 0, 0, 0, 0 },
-  { 140231047.41503677, 48986434.84898222, 140231007.84637994, 48986440.7074289, 140231086.9836936, 48986428.99053554, 140231045.43660393, 48986435.141904555, 140231049.3934696, 48986434.55605989, 0, 0, 0, 0, 0 },
-  { 140231051.6354583, 48986463.35421919, 140231012.23705748, 48986470.26551522, 140231091.0338591, 48986456.44292316, 140231049.66553825, 48986463.699783996, 140231053.60537833, 48986463.008654386, 0, 0, 0, 0, 0 },
-  { 140231056.60968882, 48986491.71022175, 140231017.42085007, 48986499.7248907, 140231095.79852757, 48986483.6955528, 140231054.6502469, 48986492.1109552, 140231058.56913075, 48986491.309488304, 1, 5, 140231327.01267612, 48986436.40900603, 34 },
-  { 140231062.37569314, 48986519.90390201, 140231023.4368201, 48986529.05617853, 140231101.3145662, 48986510.751625486, 140231060.4287495, 48986520.361515835, 140231064.32263678, 48986519.44628818, 0, 0, 0, 0, 0 },
-  { 140231068.9617557, 48986547.924674, 140231030.28494266, 48986558.12781732, 140231107.63856873, 48986537.721530676, 140231067.02791503, 48986548.434831165, 140231070.89559636, 48986547.41451683, 1, 0, 140231371.60781768, 48986468.08507749, 35 },
-  { 140231076.31116846, 48986575.7839184, 140231037.88401994, 48986586.89041458, 140231114.73831698, 48986564.677422225, 140231074.38981104, 48986576.33924321, 140231078.2325259, 48986575.228593595, 0, 0, 0, 0, 0 },
-  { 140231084.32314745, 48986603.5044075, 140231046.12310633, 48986615.3685071, 140231122.52318856, 48986591.6403079, 140231082.4131454, 48986604.097612485, 140231086.2331495, 48986602.91120252, 0, 0, 0, 0, 0 },
-  { 140231092.89653498, 48986631.109010234, 140231054.89285588, 48986643.58780729, 140231130.90021408, 48986618.63021318, 140231090.99635103, 48986631.732950084, 140231094.79671893, 48986630.485070385, 0, 0, 0, 0, 0 },
-  { 140231101.93017322, 48986658.620595455, 140231064.0856718, 48986671.5741167, 140231139.77467462, 48986645.66707421, 140231100.03794816, 48986659.26827152, 140231103.82239828, 48986657.97291939, 1, 4, 140231199.37976435, 48986625.26527824, 41 },
-  { 140231111.3229045, 48986686.06203207, 140231073.5955781, 48986699.35296296, 140231149.0502309, 48986672.77110117, 140231109.4365382, 48986686.72657861, 140231113.2092708, 48986685.397485524, 1, 3, 140230991.53864324, 48986728.260737665, 46 },
-  { 140231120.97357103, 48986713.456188954, 140231083.31809333, 48986726.94933534, 140231158.62904873, 48986699.96304257, 140231119.09079716, 48986714.13084628, 140231122.8563449, 48986712.78153163, 0, 0, 0, 0, 0 },
-  { 140231130.78101507, 48986740.82593502, 140231093.15012646, 48986754.38750655, 140231168.41190368, 48986727.26436349, 140231128.89947063, 48986741.5040136, 140231132.6625595, 48986740.147856444, 0, 0, 0, 0, 0 },
-  { 140231140.64407894, 48986768.19413915, 140231102.98990774, 48986781.69093107, 140231178.29825014, 48986754.69734724, 140231138.7613704, 48986768.868978746, 140231142.5267875, 48986767.51929956, 0, 0, 0, 0, 0 },
-  { 140231150.46160486, 48986795.58367024, 140231112.73696133, 48986808.882214196, 140231188.1862484, 48986782.28512629, 140231148.5753727, 48986796.24859744, 140231152.34783703, 48986794.918743044, 1, 3, 140230866.58366236, 48986895.65521348, 43 },
-  { 140231160.1324351, 48986823.0173972, 140231122.29212168, 48986835.98314747, 140231197.97274855, 48986810.05164693, 140231158.24041945, 48986823.665684715, 140231162.02445078, 48986822.36910969, 0, 0, 0, 0, 0 },
-  { 140231169.55541196, 48986850.5181889, 140231131.55759114, 48986863.014812976, 140231207.5532328, 48986838.02156483, 140231167.65552092, 48986851.14302011, 140231171.455303, 48986849.893357694, 1, 0, 140230914.97001252, 48986934.24557022, 29 },
-  { 140231178.62937766, 48986878.10891425, 140231140.43703166, 48986889.99776221, 140231216.82172367, 48986866.22006629, 140231176.71976036, 48986878.703356646, 140231180.53899497, 48986877.51447185, 1, 1, 140231464.11716413, 48986789.23977573, 40 },
-  { 140231187.25317445, 48986905.81244213, 140231148.83609322, 48986916.95371091, 140231225.6702557, 48986894.67117335, 140231185.3323204, 48986906.36950557, 140231189.17402852, 48986905.25537869, 0, 0, 0, 0, 0 },
-  { 140231195.3266996, 48986933.65139637, 140231156.685859, 48986943.98993764, 140231233.96754023, 48986923.3128551, 140231193.39465758, 48986934.168323435, 140231197.25874165, 48986933.13446931, 1, 4, 140231499.62331957, 48986852.23538388, 30 },
-  { 140231202.8134774, 48986961.63362129, 140231163.9866699, 48986971.250222534, 140231241.6402849, 48986952.01702005, 140231200.872137, 48986962.114451356, 140231204.75481778, 48986961.152791224, 1, 0, 140231012.56212065, 48987008.75496739, 47 },
-  { 140231209.77584204, 48986989.74400924, 140231170.79903314, 48986998.73335674, 140231248.75265095, 48986980.75466175, 140231207.8270016, 48986990.19347662, 140231211.72468248, 48986989.294541866, 0, 0, 0, 0, 0 },
-  { 140231216.28464952, 48987017.96547308, 140231177.1891802, 48987026.423858196, 140231255.38011885, 48987009.50708796, 140231214.32987607, 48987018.38839234, 140231218.23942298, 48987017.54255382, 0, 0, 0, 0, 0 },
-  { 140231222.41075587, 48987046.28092568, 140231183.2239844, 48987054.30569613, 140231261.59752735, 48987038.25615524, 140231220.4514173, 48987046.68216421, 140231224.37009445, 48987045.87968716, 1, 1, 140231351.72710177, 48987019.79918322, 33 },
-  { 140231228.22501707, 48987074.6732799, 140231188.971013, 48987082.36243887, 140231267.47902113, 48987066.98412092, 140231226.26231688, 48987075.05773784, 140231230.18771726, 48987074.28882195, 1, 5, 140231105.55625442, 48987098.7019017, 37 },
-  { 140231233.79828924, 48987103.12544859, 140231194.4985593, 48987110.57737634, 140231273.09801918, 48987095.67352084, 140231231.83330274, 48987103.49804498, 140231235.76327574, 48987102.7528522, 1, 1, 140231578.6534194, 48987037.73478255, 33 },
-  { 140231239.20142832, 48987131.620344654, 140231199.8756601, 48987138.93361708, 140231278.52719656, 48987124.30707223, 140231237.2351399, 48987131.98600827, 140231241.16771674, 48987131.254681036, 0, 0, 0, 0, 0 },
-  { 140231244.50529042, 48987160.14088093, 140231205.17210498, 48987167.41415549, 140231283.83847585, 48987152.867606364, 140231242.53863114, 48987160.50454465, 140231246.4719497, 48987159.7772172, 1, 3, 140231587.6873334, 48987096.68156033, 38 },
-  { 140231249.78073144, 48987188.669970274, 140231210.45843983, 48987196.00191285, 140231289.10302305, 48987181.3380277, 140231247.81461686, 48987189.036567405, 140231251.74684602, 48987188.30337314, 0, 0, 0, 0, 0 },
-  { 140231255.0986075, 48987217.190525584, 140231215.8059676, 48987224.67974778, 140231294.39124742, 48987209.701303385, 140231253.1339755, 48987217.56498669, 140231257.0632395, 48987216.81606448, 1, 2, 140231376.90579122, 48987193.973936774, 40 },
-  { 140231260.5297746, 48987245.68545969, 140231221.28575987, 48987253.42544083, 140231299.77378935, 48987237.94547854, 140231258.56757388, 48987246.072458744, 140231262.49197534, 48987245.29846063, 1, 2, 140231044.6876936, 48987288.25535598, 44 },
-  { 140231266.14149162, 48987274.138540015, 140231226.9544161, 48987282.16182568, 140231305.32856715, 48987266.11525435, 140231264.18213785, 48987274.5397043, 140231268.1008454, 48987273.73737573, 1, 2, 140231375.86530307, 48987251.673340164, 46 },
-  { 140231271.95729876, 48987302.54391942, 140231232.8276002, 48987310.84251515, 140231311.0869973, 48987294.245323695, 140231270.00081384, 48987302.95884921, 140231273.91378367, 48987302.12898964, 0, 0, 0, 0, 0 },
-  { 140231277.97160074, 48987330.90267209, 140231238.89938715, 48987339.46784144, 140231317.04381433, 48987322.33750274, 140231276.01799005, 48987331.33093055, 140231279.92521143, 48987330.474413626, 1, 2, 140231450.86614582, 48987293.00179772, 31 },
-  { 140231284.17827317, 48987359.21599795, 140231245.1634738, 48987368.03900378, 140231323.19307253, 48987350.39299212, 140231282.2275332, 48987359.65714824, 140231286.12901315, 48987358.77484766, 1, 5, 140231021.80374756, 48987418.55071217, 34 },
-  { 140231290.57119146, 48987387.48509683, 140231251.61356303, 48987396.55720724, 140231329.5288199, 48987378.41298641, 140231288.62331003, 48987387.938702345, 140231292.5190729, 48987387.03149131, 0, 0, 0, 0, 0 },
-  { 140231297.1442312, 48987415.71116862, 140231258.24336395, 48987425.02366165, 140231336.04509845, 48987406.39867558, 140231295.19918784, 48987416.17679327, 140231299.08927456, 48987415.245543964, 0, 0, 0, 0, 0 },
-  { 140231303.89126796, 48987443.89541318, 140231265.04659188, 48987453.43958105, 140231342.73594403, 48987434.351245314, 140231301.94903415, 48987444.37262157, 140231305.83350176, 48987443.41820479, 1, 1, 140231482.5767779, 48987399.99224098, 37 },
-  { 140231310.80617714, 48987472.03903042, 140231272.01696843, 48987481.80618388, 140231349.59538585, 48987462.27187695, 140231308.8667167, 48987472.52738809, 140231312.74563757, 48987471.55067275, 1, 4, 140230990.79520518, 48987552.618046485, 31 },
-  { 140231317.88283437, 48987500.1432202, 140231279.14822155, 48987510.12469154, 140231356.6174472, 48987490.161748864, 140231315.94610372, 48987500.642293766, 140231319.81956503, 48987499.644146636, 1, 3, 140231485.4100348, 48987456.97335666, 33 },
-  { 140231325.1151152, 48987528.209182404, 140231286.43408552, 48987538.3963284, 140231363.79614487, 48987518.02203641, 140231323.1810637, 48987528.7185397, 140231327.04916668, 48987527.69982511, 1, 1, 140230954.74425608, 48987625.75110528, 40 },
-  { 140231332.4968951, 48987556.2381169, 140231293.8683008, 48987566.62232134, 140231371.1254894, 48987545.85391246, 140231330.5654654, 48987556.75732712, 140231334.42832482, 48987555.71890668, 0, 0, 0, 0, 0 },
-  { 140231340.02204967, 48987584.23122357, 140231301.4446141, 48987594.803899065, 140231378.59948522, 48987573.65854807, 140231338.09317788, 48987584.75985734, 140231341.95092145, 48987583.702589795, 1, 5, 140231003.4339246, 48987676.477817275, 30 },
-  { 140231347.68445435, 48987612.18970229, 140231309.1567784, 48987622.94229202, 140231386.2121303, 48987601.437112555, 140231345.75807056, 48987612.72733177, 140231349.61083815, 48987611.6520728, 0, 0, 0, 0, 0 },
-  { 140231355.47798473, 48987640.11475293, 140231316.9985527, 48987651.03873163, 140231393.95741674, 48987629.19077424, 140231353.55401313, 48987640.66095187, 140231357.40195632, 48987639.568554, 0, 0, 0, 0, 0 },
-  { 140231363.39651632, 48987668.00757539, 140231324.9637021, 48987679.0944501, 140231401.82933053, 48987656.920700684, 140231361.4748756, 48987668.56191913, 140231365.31815705, 48987667.453231655, 0, 0, 0, 0, 0 },
-  { 140231371.43392465, 48987695.86936954, 140231333.04599768, 48987707.11068007, 140231409.8218516, 48987684.628059, 140231369.5145283, 48987696.43143506, 140231373.353321, 48987695.30730401, 0, 0, 0, 0, 0 },
-  { 140231379.58408523, 48987723.70133524, 140231341.2392164, 48987735.08865424, 140231417.92895406, 48987712.31401623, 140231377.66684178, 48987724.270701185, 140231381.50132868, 48987723.13196929, 0, 0, 0, 0, 0 },
-  { 140231387.84087366, 48987751.50467237, 140231349.53714105, 48987763.02960482, 140231426.14460626, 48987739.97973992, 140231385.92568702, 48987752.08091899, 140231389.7560603, 48987750.92842575, 0, 0, 0, 0, 0 },
-  { 140231396.19816542, 48987779.28058084, 140231357.93356007, 48987790.934763685, 140231434.46277076, 48987767.626398, 140231394.28493515, 48987779.86328998, 140231398.1113957, 48987778.6978717, 0, 0, 0, 0, 0 },
-  { 140231404.64983603, 48987807.030260496, 140231366.42226756, 48987818.80536174, 140231442.8774045, 48987795.25515925, 140231402.73845762, 48987807.61901556, 140231406.56121445, 48987806.44150543, 0, 0, 0, 0, 0 },
-  { 140231413.18976107, 48987834.754911214, 140231374.99706313, 48987846.64262861, 140231451.382459, 48987822.86719382, 140231411.28012618, 48987835.349297084, 140231415.09939596, 48987834.160525344, 1, 0, 140231644.25558355, 48987762.83422097, 47 },
-  { 140231421.811816, 48987862.45573288, 140231383.65175182, 48987874.44779284, 140231459.9718802, 48987850.46367292, 140231419.9038128, 48987863.05533588, 140231423.71981922, 48987861.856129885, 1, 2, 140231176.63340366, 48987939.50471812, 37 },
-  { 140231430.50987643, 48987890.13392538, 140231392.38014403, 48987902.22208104, 140231468.63960883, 48987878.045769714, 140231428.6033898, 48987890.73833316, 140231432.41636306, 48987889.5295176, 0, 0, 0, 0, 0 },
-  { 140231439.27781782, 48987917.79068857, 140231401.17605537, 48987929.96671829, 140231477.37958026, 48987905.61465885, 140231437.3727297, 48987918.39949005, 140231441.18290594, 48987917.18188708, 1, 3, 140231123.98573372, 48988018.54733451, 43 },
-  { 140231448.10951576, 48987945.427222356, 140231410.03330672, 48987957.68292741, 140231486.1857248, 48987933.171517305, 140231446.2057053, 48987946.040007606, 140231450.0133262, 48987944.814437106, 0, 0, 0, 0, 0 },
-  { 140231456.99884573, 48987973.04472658, 140231418.94572395, 48987985.371929154, 140231495.0519675, 48987960.71752401, 140231455.09618965, 48987973.66108671, 140231458.9015018, 48987972.42836645, 0, 0, 0, 0, 0 },
-  { 140231465.93968326, 48988000.644401155, 140231427.90713805, 48988013.03494206, 140231503.97222847, 48987988.25386025, 140231464.038056, 48988001.2639282, 140231467.84131053, 48988000.02487411, 0, 0, 0, 0, 0 },
-  { 140231474.92590395, 48988028.227445945, 140231436.9113849, 48988040.673181884, 140231512.94042298, 48988015.78171001, 140231473.025178, 48988028.84973274, 140231476.8266299, 48988027.60515915, 0, 0, 0, 0, 0 },
-  { 140231483.95138326, 48988055.79506081, 140231445.9523054, 48988068.287862, 140231521.95046112, 48988043.302259624, 140231482.05142936, 48988056.419700876, 140231485.85133716, 48988055.17042075, 0, 0, 0, 0, 0 },
-  { 140231493.00999674, 48988083.348445654, 140231455.02381808, 48988095.88041398, 140231530.9961754, 48988070.81647733, 140231491.11068782, 48988083.97504407, 140231494.90930566, 48988082.721847236, 0, 0, 0, 0, 0 },
-  { 140231502.09578165, 48988110.888752185, 140231464.1228173, 48988123.46070422, 140231540.068746, 48988098.31680015, 140231500.19713342, 48988111.51734979, 140231503.9944299, 48988110.26015458, 1, 2, 140231644.494398, 48988063.74393203, 48 },
-  { 140231511.20914954, 48988138.41523278, 140231473.25350025, 48988151.03936391, 140231549.16479883, 48988125.79110164, 140231509.31136706, 48988139.046439335, 140231513.106932, 48988137.78402622, 0, 0, 0, 0, 0 },
-  { 140231520.35884374, 48988165.92465743, 140231482.4249196, 48988178.613920614, 140231558.29276788, 48988153.23539424, 140231518.46214753, 48988166.55912059, 140231522.25553995, 48988165.290194266, 0, 0, 0, 0, 0 },
-  { 140231529.5541695, 48988193.413628586, 140231491.64645022, 48988206.180962615, 140231567.4618888, 48988180.64629456, 140231527.65878356, 48988194.051995285, 140231531.44955546, 48988192.77526189, 0, 0, 0, 0, 0 },
-  { 140231538.80443224, 48988220.87874875, 140231500.9274803, 48988233.73707334, 140231576.68138418, 48988208.020424165, 140231536.91058466, 48988221.521664985, 140231540.69827983, 48988220.23583252, 0, 0, 0, 0, 0 },
-  { 140231548.11893728, 48988248.31662042, 140231510.27741128, 48988261.27883126, 140231585.9604633, 48988235.354409575, 140231546.22686097, 48988248.964730956, 140231550.0110136, 48988247.66850988, 1, 1, 140231402.4290622, 48988298.221132144, 31 },
-  { 140231557.5069899, 48988275.72384604, 140231519.70565775, 48988288.80280961, 140231595.30832204, 48988262.64488247, 140231555.6169233, 48988276.37779422, 140231559.3970565, 48988275.06989786, 0, 0, 0, 0, 0 },
-  { 140231566.9778956, 48988303.097028166, 140231529.2216472, 48988316.30557498, 140231604.73414397, 48988289.88848135, 140231565.09008318, 48988303.757455505, 140231568.865708, 48988302.43660083, 0, 0, 0, 0, 0 },
-  { 140231576.54095948, 48988330.43276922, 140231538.8348198, 48988343.78368796, 140231614.24709916, 48988317.08185048, 140231574.6556525, 48988331.10031515, 140231578.42626646, 48988329.76522328, 0, 0, 0, 0, 0 },
-  { 140231586.205487, 48988357.7276717, 140231548.55462828, 48988371.233701356, 140231623.85634574, 48988344.22164204, 140231584.32294407, 48988358.40297318, 140231588.08802995, 48988357.05237021, 1, 4, 140231421.48298007, 48988416.81655146, 47 },
-  { 140231595.98078355, 48988384.97833812, 140231558.39053753, 48988398.65215997, 140231633.57102957, 48988371.30451628, 140231594.10127124, 48988385.662029214, 140231597.86029586, 48988384.29464703, 0, 0, 0, 0, 0 },
-  { 140231605.8761544, 48988412.18137094, 140231568.35202417, 48988426.03559958, 140231643.40028462, 48988398.32714229, 140231603.99994788, 48988412.87408237, 140231607.7523609, 48988411.4886595, 1, 4, 140231252.2112271, 48988542.75747592, 40 },
-  { 140231615.9009048, 48988439.333372645, 140231578.44857636, 48988453.380546525, 140231653.35323325, 48988425.286198765, 140231614.0282884, 48988440.03573134, 140231617.7735212, 48988438.63101395, 0, 0, 0, 0, 0 },
-  { 140231626.0643402, 48988466.430945724, 140231588.6896932, 48988480.68351612, 140231663.4389872, 48988452.178375326, 140231624.19560784, 48988467.143574245, 140231627.93307257, 48988465.7183172, 0, 0, 0, 0, 0 },
-  { 140231636.37576595, 48988493.47069269, 140231599.0848843, 48988507.94101214, 140231673.6666476, 48988479.00037324, 140231634.51122186, 48988494.19420866, 140231638.24031004, 48988492.747176714, 0, 0, 0, 0, 0 },
-  { 140231646.84448734, 48988520.449215986, 140231609.64366883, 48988535.149525575, 140231684.04530585, 48988505.7489064, 140231644.9844464, 48988521.18423147, 140231648.70452827, 48988519.714200504, 0, 0, 0, 0, 0 },
-  { 140231657.4798096, 48988547.36311813, 140231620.37557533, 48988562.30553419, 140231694.5840439, 48988532.42070206, 140231655.6245979, 48988548.11023893, 140231659.33502132, 48988546.61599732, 1, 3, 140231872.6843685, 48988460.69710495, 48 },
-  { 140231668.29103824, 48988574.20900158, 140231631.29014063, 48988589.4055004, 140231705.29193586, 48988559.01250276, 140231666.44099337, 48988574.96882652, 140231670.14108312, 48988573.44917664, 1, 2, 140231324.1826905, 48988715.53644058, 36 },
-  { 140231679.2874785, 48988600.983468845, 140231642.39690906, 48988616.44587115, 140231716.17804796, 48988585.52106654, 140231677.44295004, 48988601.75658896, 140231681.13200697, 48988600.21034873, 0, 0, 0, 0, 0 },
-  { 140231690.47843572, 48988627.68312239, 140231653.70543137, 48988643.42307637, 140231727.25144008, 48988611.94316841, 140231688.6397855, 48988628.47012009, 140231692.31708595, 48988626.89612469, 1, 2, 140231550.74101922, 48988687.49494752, 27 },
-  { 140231701.87321526, 48988654.30456472, 140231665.22526392, 48988670.333527975, 140231738.5211666, 48988638.27560147, 140231700.04081768, 48988655.10601289, 140231703.70561284, 48988653.503116556, 0, 0, 0, 0, 0 },
-  { 140231713.48112243, 48988680.844398305, 140231676.9659672, 48988697.17361869, 140231749.99627766, 48988664.51517792, 140231711.65536466, 48988681.660859324, 140231715.3068802, 48988680.027937286, 0, 0, 0, 0, 0 },
-  { 140231725.31146255, 48988707.299225636, 140231688.9371048, 48988723.93972133, 140231761.6858203, 48988690.65872994, 140231723.49274465, 48988708.13125042, 140231727.13018045, 48988706.46720085, 0, 0, 0, 0, 0 },
-  { 140231737.37354103, 48988733.665649205, 140231701.1482418, 48988750.62818719, 140231773.59884027, 48988716.703111224, 140231735.56227607, 48988734.5137761, 140231739.184806, 48988732.81752231, 0, 0, 0, 0, 0 },
-  { 140231749.6766631, 48988759.940271504, 140231713.6089434, 48988777.23534584, 140231785.7443828, 48988742.64519717, 140231747.87327713, 48988760.80502522, 140231751.48004907, 48988759.07551779, 1, 5, 140231982.3134551, 48988648.38704204, 43 },
-  { 140231762.23013416, 48988786.11969499, 140231726.32877335, 48988803.75750356, 140231798.13149497, 48988768.481886424, 140231760.4350661, 48988787.001585424, 140231764.0252022, 48988785.23780456, 1, 0, 140231486.68718985, 48988921.48987577, 36 },
-  { 140231775.04325953, 48988812.20052218, 140231739.31729198, 48988830.19094305, 140231810.7692271, 48988794.21010131, 140231773.25696117, 48988813.10004322, 140231776.8295579, 48988811.30100113, 1, 5, 140232103.72216094, 48988646.68865017, 36 },
-  { 140231788.12534457, 48988838.179355524, 140231752.58405462, 48988856.53192231, 140231823.66663453, 48988819.82678874, 140231786.34828007, 48988839.096983865, 140231789.90240908, 48988837.261727184, 0, 0, 0, 0, 0 },
-  { 140231801.48569456, 48988864.052797556, 140231766.13860947, 48988882.77667471, 140231836.83277965, 48988845.3289204, 140231799.7183403, 48988864.98899142, 140231803.2530488, 48988863.116603695, 0, 0, 0, 0, 0 },
-  { 140231815.13361487, 48988889.81745071, 140231779.9904957, 48988908.921407804, 140231850.27673402, 48988870.713493615, 140231813.3764589, 48988890.772648565, 140231816.89077082, 48988888.862252854, 0, 0, 0, 0, 0 },
-  { 140231829.0784108, 48988915.469917506, 140231794.14924142, 48988934.962303855, 140231864.0075802, 48988895.97753116, 140231827.33195233, 48988916.44453682, 140231830.82486928, 48988914.49529819, 1, 0, 140232063.97707498, 48988784.383619316, 45 },
-  { 140231843.32938775, 48988941.00680042, 140231808.6243612, 48988960.89551912, 140231878.03441432, 48988921.11808172, 140231841.59413642, 48988942.00123636, 140231845.0646391, 48988940.012364484, 0, 0, 0, 0, 0 },
-  { 140231857.895851, 48988966.424701944, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 0.0 },
+// control points of course (x, y)
+static const double bandaiazumaskyline_ctrl[422][2] = {
+  { 140239094.49577302, 48944583.504751615 },
+  { 140239271.521568, 48944622.15547658 },
+  { 140239373.445511, 48944583.504751615 },
+  { 140239405.63201898, 48944484.11710221 },
+  { 140239453.911781, 48944053.436106145 },
+  { 140239507.555962, 48943744.228052184 },
+  { 140239571.928978, 48943523.36455037 },
+  { 140239781.14128098, 48943020.8982013 },
+  { 140239904.52289602, 48942303.08459531 },
+  { 140239919.331696, 48942270.471243635 },
+  { 140239952.802658, 48942247.86794304 },
+  { 140240183.472633, 48942220.25960501 },
+  { 140240230.590909, 48942220.834401436 },
+  { 140240285.39657602, 48942236.824608795 },
+  { 140240338.435651, 48942274.983682476 },
+  { 140240371.22726402, 48942336.21457155 },
+  { 140240374.383898, 48942396.36821067 },
+  { 140240360.49842802, 48942452.1693987 },
+  { 140240145.921707, 48942971.20358517 },
+  { 140240060.09101897, 48943269.37089863 },
+  { 140239984.989166, 48943744.22805231 },
+  { 140239931.344986, 48944561.41861611 },
+  { 140239877.700806, 48945003.140365414 },
+  { 140239818.692207, 48945334.43035106 },
+  { 140239829.421043, 48945461.42454423 },
+  { 140239877.700806, 48945582.897094265 },
+  { 140239942.073822, 48945627.068892844 },
+  { 140240129.828453, 48945632.5903662 },
+  { 140240258.57448602, 48945538.725275666 },
+  { 140240322.947502, 48945400.68821183 },
+  { 140240360.49842802, 48945240.56497063 },
+  { 140240360.49842802, 48945003.140365414 },
+  { 140240349.769592, 48944688.413826145 },
+  { 140240443.430836, 48944454.24142079 },
+  { 140240612.626076, 48944246.690636836 },
+  { 140241186.618805, 48943998.22045487 },
+  { 140241342.186928, 48943987.17732083 },
+  { 140241487.026215, 48944053.436106145 },
+  { 140241664.05201, 48944163.867313914 },
+  { 140242195.12939498, 48944500.68171755 },
+  { 140242270.231247, 48944633.19853796 },
+  { 140242297.053337, 48944782.27974348 },
+  { 140242307.78217298, 48945003.140365414 },
+  { 140242313.14659098, 48945146.699498795 },
+  { 140242420.43495202, 48945908.66363328 },
+  { 140242474.079132, 48946184.73611087 },
+  { 140242795.94421402, 48946919.08505841 },
+  { 140243493.318558, 48948746.65104671 },
+  { 140243600.606918, 48948901.2471866 },
+  { 140243734.717369, 48949039.279245175 },
+  { 140245354.771614, 48950198.740745515 },
+  { 140246663.689613, 48951275.37109745 },
+  { 140247634.649277, 48951882.69574213 },
+  { 140247849.225998, 48951987.59688471 },
+  { 140248004.794121, 48952031.76575271 },
+  { 140248267.65060398, 48952037.28685973 },
+  { 140248938.202858, 48951965.51244311 },
+  { 140249421.72476098, 48951835.240086876 },
+  { 140249603.390694, 48951717.0621271 },
+  { 140249994.99321002, 48951297.45569687 },
+  { 140250000.35762802, 48951297.45569687 },
+  { 140250139.832497, 48951164.94802417 },
+  { 140250772.83382398, 48950491.3645423 },
+  { 140250960.588455, 48950259.47405932 },
+  { 140251464.84375, 48949652.13920184 },
+  { 140251727.700233, 48949337.42781823 },
+  { 140251920.81928298, 48949188.35364688 },
+  { 140252097.845078, 48949105.534563266 },
+  { 140252387.523651, 48949055.84307895 },
+  { 140252650.380135, 48949066.885633335 },
+  { 140252907.8722, 48949116.577111796 },
+  { 140253664.255142, 48949348.47034038 },
+  { 140253852.009773, 48949464.41674562 },
+  { 140253943.20488, 48949547.235521406 },
+  { 140254603.028297, 48950414.06777652 },
+  { 140254790.78292802, 48950629.39432718 },
+  { 140254999.995232, 48950778.46627333 },
+  { 140255568.62354302, 48951098.69411971 },
+  { 140256008.505821, 48951407.878618576 },
+  { 140256137.251854, 48951540.385957696 },
+  { 140256518.125534, 48952125.62453005 },
+  { 140256695.151329, 48952346.46835221 },
+  { 140257467.627525, 48953163.58610093 },
+  { 140257961.153984, 48953969.654940225 },
+  { 140258331.298828, 48954703.944667555 },
+  { 140258352.75649998, 48954759.1541957 },
+  { 140258433.222771, 48954974.4710537 },
+  { 140258460.04486102, 48955123.536289364 },
+  { 140258454.68044302, 48955327.81049768 },
+  { 140258422.493935, 48955438.22880867 },
+  { 140258352.75649998, 48955565.20971011 },
+  { 140258331.298828, 48955587.29332805 },
+  { 140258100.628853, 48955835.73368228 },
+  { 140257746.577263, 48956166.986493 },
+  { 140257580.280304, 48956382.30021031 },
+  { 140257472.991943, 48956570.00921297 },
+  { 140257371.068001, 48956835.009536475 },
+  { 140257242.321968, 48957287.71673922 },
+  { 140257220.864296, 48957464.382388644 },
+  { 140257226.228714, 48957641.04771462 },
+  { 140257263.77964, 48957751.463379204 },
+  { 140257297.24044502, 48957836.341274776 },
+  { 140257354.974747, 48957895.003554165 },
+  { 140257422.620916, 48957915.74736388 },
+  { 140257489.085197, 48957917.086639084 },
+  { 140257585.644722, 48957906.04509728 },
+  { 140257773.399353, 48957806.671164036 },
+  { 140258046.984673, 48957569.2774649 },
+  { 140258331.298828, 48957260.11270224 },
+  { 140258352.75649998, 48957238.02946704 },
+  { 140258620.977402, 48956901.25950365 },
+  { 140258803.367615, 48956592.092601046 },
+  { 140258919.295499, 48956453.040626176 },
+  { 140258987.68484798, 48956407.92285438 },
+  { 140259034.03759, 48956387.82106852 },
+  { 140259178.876877, 48956382.30021031 },
+  { 140259295.436915, 48956414.23934365 },
+  { 140259371.995926, 48956476.15475734 },
+  { 140259453.258488, 48956564.93260936 },
+  { 140259500.74195898, 48956669.384419546 },
+  { 140259504.988892, 48956744.50092426 },
+  { 140259473.919868, 48956829.48870389 },
+  { 140259398.818016, 48956973.030250095 },
+  { 140259125.23269698, 48957359.48719824 },
+  { 140258867.74063098, 48957845.31659463 },
+  { 140258352.75649998, 48958574.056103796 },
+  { 140258331.298828, 48958601.659764946 },
+  { 140257843.136787, 48959286.228034906 },
+  { 140257644.65332, 48959617.469002895 },
+  { 140257306.69498402, 48960307.550701305 },
+  { 140257017.016411, 48960970.02448939 },
+  { 140256931.18572202, 48961207.40982328 },
+  { 140256839.990616, 48961638.014287576 },
+  { 140256796.595344, 48961767.76656737 },
+  { 140256759.524345, 48961814.671973586 },
+  { 140256700.515747, 48961842.2747077 },
+  { 140256647.541636, 48961839.04867827 },
+  { 140256609.32064098, 48961825.713068195 },
+  { 140256556.35583898, 48961777.69192775 },
+  { 140256507.396698, 48961698.74040367 },
+  { 140256432.294846, 48961527.60306964 },
+  { 140256051.42116502, 48960412.44268747 },
+  { 140255976.319313, 48960285.46816342 },
+  { 140255831.48002598, 48960152.972829804 },
+  { 140255434.513092, 48959904.54358887 },
+  { 140255300.402641, 48959667.15505008 },
+  { 140255193.114281, 48959374.55907082 },
+  { 140255016.08848602, 48958988.11019164 },
+  { 140254721.045494, 48958563.01463712 },
+  { 140254549.384117, 48958391.87174247 },
+  { 140254383.087158, 48958325.62279841 },
+  { 140254254.341126, 48958320.1020511 },
+  { 140254120.230675, 48958347.70578479 },
+  { 140254043.485684, 48958406.61991903 },
+  { 140253979.48026797, 48958495.048900716 },
+  { 140253970.02697, 48958590.61830139 },
+  { 140254007.577896, 48959043.31726915 },
+  { 140254002.213478, 48959214.45900863 },
+  { 140253970.02697, 48959600.90698157 },
+  { 140253894.925118, 48959772.04773226 },
+  { 140253835.916519, 48959843.81634386 },
+  { 140252521.63410202, 48961113.55987735 },
+  { 140252355.337143, 48961317.82140756 },
+  { 140252265.362629, 48961445.64295401 },
+  { 140252227.660809, 48961578.2822192 },
+  { 140252242.68436402, 48961709.781511545 },
+  { 140252553.82061, 48962515.77897588 },
+  { 140252575.278282, 48962631.70956418 },
+  { 140252553.82061, 48963250.00368322 },
+  { 140252822.04151198, 48964492.10043092 },
+  { 140252860.700673, 48964552.24127324 },
+  { 140252940.05870798, 48964585.9470911 },
+  { 140253028.16689798, 48964591.039283924 },
+  { 140253106.355667, 48964558.345141664 },
+  { 140253159.99984702, 48964503.141219124 },
+  { 140253172.836673, 48964453.89275791 },
+  { 140253170.728684, 48964403.77407905 },
+  { 140252956.15196198, 48963851.73254874 },
+  { 140252929.32987198, 48963658.51726687 },
+  { 140252977.609634, 48963029.18480974 },
+  { 140252972.245216, 48962587.54554699 },
+  { 140252945.42312598, 48962311.51998134 },
+  { 140252938.734673, 48961999.658811204 },
+  { 140252943.118606, 48961939.20446673 },
+  { 140252963.28469598, 48961886.87082446 },
+  { 140253015.0151, 48961847.16942181 },
+  { 140253086.91159502, 48961830.927934214 },
+  { 140253170.728684, 48961836.7541615 },
+  { 140253233.334943, 48961858.89938331 },
+  { 140253261.92379, 48961908.521237664 },
+  { 140253299.47471598, 48962261.83529564 },
+  { 140253347.754478, 48962526.81999029 },
+  { 140253497.958183, 48962935.33663558 },
+  { 140253610.610962, 48963514.985664375 },
+  { 140253733.992577, 48963940.0594058 },
+  { 140253771.54350302, 48964055.98828302 },
+  { 140253884.19628102, 48964254.72317717 },
+  { 140254018.306732, 48964403.77407905 },
+  { 140254211.42578098, 48964558.345141664 },
+  { 140254490.375519, 48964729.47710071 },
+  { 140254699.587822, 48964889.56801338 },
+  { 140254946.351051, 48965137.98442097 },
+  { 140255112.64801, 48965386.40018909 },
+  { 140255203.912638, 48965570.4583149 },
+  { 140255231.541993, 48965607.664803185 },
+  { 140255260.465368, 48965621.8876899 },
+  { 140255365.652444, 48965646.30710987 },
+  { 140255455.97076398, 48965651.37630348 },
+  { 140255584.716797, 48965695.53891847 },
+  { 140255649.089813, 48965745.221836165 },
+  { 140255761.742592, 48965894.27043587 },
+  { 140255874.395371, 48966126.12335535 },
+  { 140255987.048149, 48966357.975717776 },
+  { 140256078.243256, 48966667.111334436 },
+  { 140256153.345108, 48967059.0497101 },
+  { 140256158.709526, 48967550.35049579 },
+  { 140256137.251854, 48967688.355884485 },
+  { 140256088.97209197, 48967887.08329726 },
+  { 140255987.048149, 48968163.09291387 },
+  { 140255734.920502, 48968726.150083356 },
+  { 140255525.708199, 48969018.7177074 },
+  { 140254801.511765, 48969758.413026355 },
+  { 140254603.028297, 48969912.97551106 },
+  { 140254034.399986, 48970227.61980402 },
+  { 140253750.085831, 48970387.70159432 },
+  { 140253390.669823, 48970586.423447266 },
+  { 140253159.99984702, 48970713.38441672 },
+  { 140252977.609634, 48970785.14489083 },
+  { 140252843.49918398, 48970774.1048214 },
+  { 140252746.939659, 48970735.464568324 },
+  { 140252645.015717, 48970652.66397396 },
+  { 140252596.735954, 48970580.90340131 },
+  { 140252215.862274, 48970062.01767251 },
+  { 140252124.667168, 48970006.81689883 },
+  { 140252076.387405, 48970001.296819724 },
+  { 140252017.378807, 48970006.81689883 },
+  { 140251953.005791, 48970034.41728958 },
+  { 140251652.598381, 48970255.2201317 },
+  { 140251582.86094698, 48970354.581245765 },
+  { 140251534.581184, 48970564.3432616 },
+  { 140251464.84375, 48971039.06613984 },
+  { 140251405.835152, 48971171.54652607 },
+  { 140251357.55538902, 48971243.306659445 },
+  { 140251282.453537, 48971315.06673926 },
+  { 140250923.037529, 48971657.3063861 },
+  { 140250821.113586, 48971905.7053694 },
+  { 140250756.74057, 48972341.78203756 },
+  { 140250729.91848, 48972700.57781802 },
+  { 140250665.54546398, 48972827.53600523 },
+  { 140250558.257103, 48972915.85464577 },
+  { 140250391.96014398, 48972943.45420425 },
+  { 140250214.934349, 48972915.85464577 },
+  { 140250016.450882, 48972777.856734425 },
+  { 140249994.99321002, 48972761.29697185 },
+  { 140249544.382095, 48972347.30198278 },
+  { 140249399.54280898, 48972192.74339794 },
+  { 140249276.161194, 48972132.02388624 },
+  { 140249158.14399698, 48972132.02388624 },
+  { 140249056.22005498, 48972247.9429209 },
+  { 140248943.567276, 48972490.82044683 },
+  { 140248804.092407, 48973070.41207191 },
+  { 140248745.08380902, 48973219.44935563 },
+  { 140248637.795448, 48973274.64829112 },
+  { 140248471.49848902, 48973285.68807441 },
+  { 140248240.828514, 48973263.608506516 },
+  { 140248058.438301, 48973274.64829112 },
+  { 140247908.23459598, 48973291.207965545 },
+  { 140247747.302055, 48973346.406860076 },
+  { 140247618.556023, 48973324.327306084 },
+  { 140247082.11422, 48973053.85235952 },
+  { 140246942.639351, 48972932.414381824 },
+  { 140246851.444244, 48972628.8187686 },
+  { 140246776.342392, 48972518.420127 },
+  { 140246647.59635898, 48972441.141002595 },
+  { 140246363.28220397, 48972325.22220012 },
+  { 140246239.900589, 48972308.66235981 },
+  { 140246132.612228, 48972314.18230685 },
+  { 140245950.22201502, 48972385.941590145 },
+  { 140245746.37412998, 48972529.45999687 },
+  { 140245547.890663, 48972750.257128626 },
+  { 140245263.576508, 48973153.21059122 },
+  { 140244995.355606, 48973633.440602005 },
+  { 140244791.507721, 48974080.549152724 },
+  { 140244721.77028698, 48974317.90223259 },
+  { 140244711.041451, 48974566.294365264 },
+  { 140244764.685631, 48974726.36895631 },
+  { 140244845.15190098, 48974820.20566213 },
+  { 140244941.71142602, 48974875.40368163 },
+  { 140245467.424393, 48974996.83921351 },
+  { 140246041.417122, 48975101.715231635 },
+  { 140246390.104294, 48975212.11091704 },
+  { 140246508.12149, 48975283.868044816 },
+  { 140246652.96077698, 48975427.38214023 },
+  { 140246813.893318, 48975626.09361201 },
+  { 140246851.444244, 48975753.047949135 },
+  { 140246883.63075298, 48975951.75875012 },
+  { 140246803.164482, 48976255.34390576 },
+  { 140246663.689613, 48976426.45511785 },
+  { 140246486.663818, 48976647.24333017 },
+  { 140246213.07849902, 48976834.912913315 },
+  { 140245880.484581, 48976879.070409164 },
+  { 140245703.458786, 48976923.22788486 },
+  { 140245462.059975, 48977083.298564725 },
+  { 140245397.68695801, 48977171.61330891 },
+  { 140245247.483253, 48977502.79287957 },
+  { 140245188.474655, 48977707.019714594 },
+  { 140245038.27095002, 48977955.403120376 },
+  { 140244888.067245, 48978087.87400867 },
+  { 140244153.14197502, 48978540.48150414 },
+  { 140243799.09038502, 48978849.578085445 },
+  { 140243627.429008, 48978954.44991471 },
+  { 140243477.22530398, 48979009.6455686 },
+  { 140243321.65718102, 48979042.76294575 },
+  { 140242951.512337, 48979004.12600468 },
+  { 140242817.401886, 48978948.93034767 },
+  { 140242613.554001, 48978810.94106689 },
+  { 140242511.630058, 48978783.3431871 },
+  { 140242398.97728, 48978816.460641995 },
+  { 140242093.205452, 48979086.919430986 },
+  { 140241975.188255, 48979131.075895935 },
+  { 140241798.16246, 48979164.19323135 },
+  { 140241664.05201, 48979169.712786175 },
+  { 140241347.551346, 48979169.712786175 },
+  { 140241047.14393598, 48979142.11500895 },
+  { 140240961.31324798, 48979153.1541208 },
+  { 140240902.30464903, 48979219.38876513 },
+  { 140240875.482559, 48979307.70155359 },
+  { 140240896.94023103, 48979401.53380274 },
+  { 140240966.677666, 48979456.729200654 },
+  { 140241063.23718998, 48979484.32688792 },
+  { 140241358.280182, 48979467.7682765 },
+  { 140241556.763649, 48979489.846424416 },
+  { 140241610.407829, 48979517.44410205 },
+  { 140241647.95875502, 48979578.15896509 },
+  { 140241658.687592, 48979644.3933177 },
+  { 140241605.043411, 48979732.70571693 },
+  { 140241519.21272302, 48979815.498517804 },
+  { 140241395.831108, 48979881.73270738 },
+  { 140241181.254387, 48979953.48636143 },
+  { 140240811.109543, 48980047.3179823 },
+  { 140240457.057953, 48980102.51301076 },
+  { 140240328.31192, 48980102.51301076 },
+  { 140240054.72660097, 48980030.7594676 },
+  { 140239813.327789, 48979942.44734123 },
+  { 140239657.759666, 48979914.84978514 },
+  { 140239239.33506, 48979909.33027296 },
+  { 140238794.08836398, 48979832.057069555 },
+  { 140238263.010979, 48979655.43237195 },
+  { 140238043.069839, 48979611.27614712 },
+  { 140237892.866135, 48979600.23708765 },
+  { 140237764.12010202, 48979622.31520527 },
+  { 140237689.01825, 48979677.510476835 },
+  { 140237656.831741, 48979760.303325154 },
+  { 140237667.560577, 48979854.135134004 },
+  { 140237726.56917602, 48979920.36929693 },
+  { 140237855.31520802, 48979975.564398065 },
+  { 140238531.23187998, 48980085.954505555 },
+  { 140238853.096962, 48980174.26650049 },
+  { 140239373.445511, 48980378.48767921 },
+  { 140239539.74247, 48980499.916283265 },
+  { 140239561.200142, 48980566.15000276 },
+  { 140239534.37805203, 48980648.94208824 },
+  { 140239453.911781, 48980693.09783819 },
+  { 140239346.623421, 48980693.09783819 },
+  { 140238949.656486, 48980599.26684548 },
+  { 140238697.528839, 48980510.95523964 },
+  { 140238515.138626, 48980483.3578463 },
+  { 140238391.757011, 48980488.877325594 },
+  { 140238118.171692, 48980544.07210133 },
+  { 140237731.93359402, 48980544.07210133 },
+  { 140237571.001053, 48980505.435761645 },
+  { 140237281.32247898, 48980372.96819369 },
+  { 140237184.762955, 48980301.21485163 },
+  { 140237104.296684, 48980207.38347776 },
+  { 140236975.550652, 48979936.927830614 },
+  { 140236873.626709, 48979633.35426213 },
+  { 140236723.423004, 48979384.975177154 },
+  { 140236401.557922, 48979131.075895935 },
+  { 140236106.51493102, 48978948.93034767 },
+  { 140235993.86215198, 48978899.25422935 },
+  { 140235886.57379198, 48978888.2150884 },
+  { 140235790.014267, 48978921.332507275 },
+  { 140235720.276833, 48978987.56731085 },
+  { 140235666.63265198, 48979075.88031146 },
+  { 140235639.81056198, 48979175.232340604 },
+  { 140235639.81056198, 48979522.96363659 },
+  { 140235607.624054, 48979627.83473384 },
+  { 140235543.25103799, 48979721.66667151 },
+  { 140235210.65712002, 48980052.83748655 },
+  { 140235140.919685, 48980146.66901083 },
+  { 140234979.987144, 48980400.565618604 },
+  { 140234867.334366, 48980632.383676894 },
+  { 140234813.690186, 48980809.0065853 },
+  { 140234754.68158698, 48981145.69310872 },
+  { 140234717.130661, 48981267.12074687 },
+  { 140234588.384628, 48981465.82018846 },
+  { 140234475.73185, 48981565.16975579 },
+  { 140234352.35023502, 48981631.40274378 },
+  { 140234019.756317, 48981780.42680065 },
+  { 140233687.162399, 48981885.29544323 },
+  { 140233333.11080903, 48981957.04760671 },
+  { 140232737.660408, 48981957.04760671 },
+  { 140232619.643211, 48981968.0863964 },
+  { 140232496.26159698, 48982006.7221502 },
+  { 140232415.795326, 48982056.39666807 },
+  { 140232083.201408, 48982437.23378836 },
+  { 140231568.217278, 48982911.8982389 },
+  { 140231391.191483, 48983121.632949665 },
+  { 140231316.08963, 48983248.577421345 },
+  { 140231283.903122, 48983358.96378275 },
+  { 140231321.45404798, 48983629.40983409 },
+  { 140231321.45404798, 48983883.297273725 },
+  { 140231262.44545, 48984264.12718007 },
+  { 140231128.334999, 48984915.39802758 },
+  { 140231117.606163, 48985263.10862835 },
+  { 140231047.868729, 48986008.19855133 },
+  { 140231063.96198303, 48986526.99850533 },
+  { 140231192.708015, 48986924.375305794 },
+  { 140231262.44545, 48987255.52138873 },
+  { 140231498.479843, 48988099.9387533 },
+  { 140231578.946114, 48988337.25733506 },
+  { 140231857.895851, 48988966.424701944 },
 };
 
 #endif
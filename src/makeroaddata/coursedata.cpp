@@ -0,0 +1,35 @@
+// Course data. Made by makeroaddata/make_course_list.py from courses.csv,
+// do not edit. Control points made by makeroaddata/make_ctrl_road.py
+
+#include "coursedata.h"
+#include "yasyajintouge.h"
+#include "motosuko.h"
+#include "bandaiazumaskyline.h"
+#include "housakatouge.h"
+
+#if COURSE_MAX != 4
+#error "COURSE_MAX of coursedata.h must be 4, lines of courses.csv"
+#endif
+
+// ----------------------------------------
+// order of course number
+const double (*course_ctrl[COURSE_MAX])[2] = {
+    yasyajintouge_ctrl,
+    motosuko_ctrl,
+    bandaiazumaskyline_ctrl,
+    housakatouge_ctrl,
+};
+
+const int course_ctrl_num[COURSE_MAX] = {
+    YASYAJINTOUGE_NUM,
+    MOTOSUKO_NUM,
+    BANDAIAZUMASKYLINE_NUM,
+    HOUSAKATOUGE_NUM,
+};
+
+const char *course_name[COURSE_MAX] = {
+    "To Yashajin Pass",
+    "To Lake Motosu",
+    "Bandai Azuma Skyline",
+    "Hosaka Pass, Fukushima",
+};
@@ -0,0 +1,71 @@
+#!python
+# -*- mode: python; Encoding: utf-8; coding: utf-8 -*-
+# Last updated: <2026/10/20 14:58:02 +0900>
+"""
+Make course list
+
+Read courses.csv (name of csv / header of make_ctrl_road.py, course name),
+and output the tables of course number order (coursedata.cpp).
+The order of lines is the course number.
+
+Usage:
+    python make_course_list.py -i courses.csv > coursedata.cpp
+
+License: CC0 / Public Domain
+"""
+
+import argparse
+import csv
+
+
+def load_csv(infile):
+    """load csv file. return list of (symbol name, course name)."""
+
+    courses = []
+    with open(infile, "r", newline="") as file:
+        for row in csv.reader(file):
+            if len(row) < 2 or row[0].startswith("#"):
+                continue
+            courses.append((row[0].strip(), row[1].strip()))
+    return courses
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-i", "--input", required=True, help="Input csv file")
+    args = parser.parse_args()
+
+    courses = load_csv(args.input)
+
+    print("// Course data. Made by makeroaddata/make_course_list.py from courses.csv,")
+    print("// do not edit. Control points made by makeroaddata/make_ctrl_road.py")
+    print()
+    print('#include "coursedata.h"')
+    for name, _ in courses:
+        print(f'#include "{name}.h"')
+    print()
+    print(f"#if COURSE_MAX != {len(courses)}")
+    print(f'#error "COURSE_MAX of coursedata.h must be {len(courses)}, lines of courses.csv"')
+    print("#endif")
+    print()
+    print("// ----------------------------------------")
+    print("// order of course number")
+    print("const double (*course_ctrl[COURSE_MAX])[2] = {")
+    for name, _ in courses:
+        print(f"    {name}_ctrl,")
+    print("};")
+    print()
+    print("const int course_ctrl_num[COURSE_MAX] = {")
+    for name, _ in courses:
+        print(f"    {name.upper()}_NUM,")
+    print("};")
+    print()
+    print("const char *course_name[COURSE_MAX] = {")
+    for _, title in courses:
+        title = title.replace("\\", "\\\\").replace('"', '\\"')
+        print(f'    "{title}",')
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+#!python
+# -*- mode: python; Encoding: utf-8; coding: utf-8 -*-
+# Last updated: <2026/10/19 23:40:18 +0900>
+"""
+Make control point road data
+
+QGISからエクスポートした座標値データを
+テキストエディタで編集して作成したcsvを読み込んで、
+制御点の座標値をC言語の配列の形で出力する。
+スプライン補間と描画用のポリゴンデータは実行時に求める (roadspline.cpp)。
+
+Usage:
+    python make_ctrl_road.py -i INPUT.csv > OUTPUT.h
+
+by mieki256
+License: CC0 / Public Domain
+"""
+
+import argparse
+import sys
+
+SCALE = 1000000.0
+
+
+def load_csv(infile):
+    """load csv file."""
+
+    ax = []
+    ay = []
+    with open(infile, "r") as file:
+        for line in file:
+            line = line.rstrip()
+            x, y = line.split(",")
+            ax.append(float(x))
+            ay.append(float(y) * 1.3)
+    return ax, ay
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-i", "--input", required=True, help="Input csv file")
+    args = parser.parse_args()
+
+    if args.input is None:
+        sys.exit()
+
+    x, y = load_csv(args.input)
+
+    symname = args.input.replace(".csv", "").replace(".CSV", "")
+    valname = symname
+    defname = symname.upper()
+
+    print(f"#ifndef __{defname}__")
+    print(f"#define __{defname}__")
+    print()
+    print(f"#define {defname}_NUM {len(x)}")
+    print()
+
+    print("// control points of course (x, y)")
+    print("static const double %s_ctrl[%d][2] = {" % (valname, len(x)))
+    for i in range(len(x)):
+        print(f"  {{ {x[i] * SCALE}, {y[i] * SCALE} }},")
+
+    print("};")
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
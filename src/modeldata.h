@@ -0,0 +1,26 @@
+// Last updated: <2026/10/20 10:12:05 +0900>
+//
+// Object data. Vertices of the vehicles, compiled once in modeldata.cpp,
+// so that render.cpp does not recompile them.
+
+#ifndef __MODELDATA_H__
+#define __MODELDATA_H__
+
+typedef struct modeldata
+{
+    float scale;
+    const int vtx_size;
+    const float *vtx;
+    const int nml_size;
+    const float *nml;
+    const int col_size;
+    const float *col;
+    const int uv_size;
+    const float *uv;
+} MODELDATA;
+
+#define MODEL_MAX 2
+
+extern MODELDATA models[MODEL_MAX];
+
+#endif
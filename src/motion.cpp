@@ -0,0 +1,129 @@
+// Last updated: <2026/10/20 10:52:11 +0900>
+//
+// Motion timeline of player.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "motion.h"
+
+static int fixed_speed = MOTION_FIXED_SPEED;
+
+// ========================================
+// speed after frames (1/60 sec). slow down before curves and at course exit
+float motion_step_speed(const TRAFFICCOURSE *c, float idx, float dist, float len,
+                        float spd, float spdmax, float frames)
+{
+    if (dist >= len - MOTION_END_DIST)
+    {
+        spd -= TRAFFIC_ACCEL * 2.0 * frames;
+        if (spd <= (spdmax * 0.1))
+            spd = spdmax * 0.1;
+        return spd;
+    }
+
+    if (fixed_speed)
+        return spdmax;
+
+    // same speed model as traffic
+    float a = traffic_get_curve(c, idx, 0);
+    if (a < TRAFFIC_CURVE_FAST)
+    {
+        spd += TRAFFIC_ACCEL * frames;
+        if (spd >= spdmax)
+            spd = spdmax;
+    }
+    else if (a > TRAFFIC_CURVE_SLOW)
+    {
+        spd -= TRAFFIC_ACCEL * frames;
+        if (spd <= spdmax * 0.4)
+            spd = spdmax * 0.4;
+    }
+    return spd;
+}
+
+// simulate from course entry (stopped) to exit. len : length of course (world unit)
+void motion_build(MOTION *m, const TRAFFICCOURSE *c, float len, float spdmax)
+{
+    memset(m, 0, sizeof(MOTION));
+    m->len = len;
+
+    int max = 1024;
+    m->dist = (float *)malloc(sizeof(float) * max);
+    m->spd = (float *)malloc(sizeof(float) * max);
+
+    float frames = MOTION_DT * 60.0;
+    float dist = 0.0;
+    float spd = 0.0;
+    for (;;)
+    {
+        if (m->num >= max)
+        {
+            max *= 2;
+            m->dist = (float *)realloc(m->dist, sizeof(float) * max);
+            m->spd = (float *)realloc(m->spd, sizeof(float) * max);
+        }
+        m->dist[m->num] = dist;
+        m->spd[m->num] = spd;
+        m->num++;
+        if (dist >= len)
+            break;
+
+        // same order as update() of render.cpp
+        float idx = roadarc_get_idx(c->arc, dist);
+        spd = motion_step_speed(c, idx, dist, len, spd, spdmax, frames);
+        dist += spd * ROADARC_UNIT_PER_M * MOTION_DT;
+        if (dist > len)
+            dist = len;
+    }
+}
+
+// 1 = fixed speed. call before motion_build()
+void motion_set_fixed_speed(int fg)
+{
+    fixed_speed = fg;
+}
+
+void motion_free(MOTION *m)
+{
+    free(m->dist);
+    free(m->spd);
+    memset(m, 0, sizeof(MOTION));
+}
+
+// travel distance and speed at time t (sec) from course entry
+void motion_get(const MOTION *m, float t, float *dist, float *spd)
+{
+    if (m->num <= 0)
+    {
+        *dist = 0.0;
+        *spd = 0.0;
+        return;
+    }
+
+    float k = t / MOTION_DT;
+    if (k <= 0.0)
+    {
+        *dist = m->dist[0];
+        *spd = m->spd[0];
+        return;
+    }
+
+    int i = (int)k;
+    if (i >= m->num - 1)
+    {
+        *dist = m->dist[m->num - 1];
+        *spd = m->spd[m->num - 1];
+        return;
+    }
+
+    float f = k - i;
+    *dist = m->dist[i] + (m->dist[i + 1] - m->dist[i]) * f;
+    *spd = m->spd[i] + (m->spd[i + 1] - m->spd[i]) * f;
+}
+
+// time to reach course exit (sec)
+float motion_get_duration(const MOTION *m)
+{
+    return (m->num > 0) ? (m->num - 1) * MOTION_DT : 0.0;
+}
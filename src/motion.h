@@ -0,0 +1,40 @@
+// Last updated: <2026/10/20 10:52:11 +0900>
+//
+// Motion timeline of player. The speed model is deterministic, so travel
+// distance and speed are sampled at fixed time steps once per course and
+// max speed. Position at any time is a lookup and interpolation, without
+// simulating all frames before it.
+
+#ifndef __MOTION_H__
+#define __MOTION_H__
+
+#include "traffic.h"
+
+// time step of timeline (sec)
+#define MOTION_DT (1.0 / 60.0)
+
+// 1 = fixed speed, 0 = with acceleration / deceleration. default of motion_set_fixed_speed()
+#define MOTION_FIXED_SPEED 0
+
+// slow down at this distance before course exit (world unit)
+#define MOTION_END_DIST 310.0
+
+typedef struct motion
+{
+    int num;
+    float len;   // length of course (world unit)
+    float *dist; // [num] travel distance at time k * MOTION_DT (world unit)
+    float *spd;  // [num] speed (m/s)
+} MOTION;
+
+// ----------------------------------------
+// prototype declaration
+float motion_step_speed(const TRAFFICCOURSE *c, float idx, float dist, float len,
+                        float spd, float spdmax, float frames);
+void motion_build(MOTION *m, const TRAFFICCOURSE *c, float len, float spdmax);
+void motion_free(MOTION *m);
+void motion_set_fixed_speed(int fg);
+void motion_get(const MOTION *m, float t, float *dist, float *spd);
+float motion_get_duration(const MOTION *m);
+
+#endif
@@ -0,0 +1,518 @@
+// Last updated: <2026/10/20 10:55:32 +0900>
+//
+// Movie output of offline rendering. Raw video stream (Y4M or RGBA).
+//
+// RGB to YUV conversion uses 8 bit fixed point coefficients, so SSE2 and
+// scalar code give the same bytes. Chroma is the average of 2 x 2 pixels
+// (center siting, same as C420jpeg of Y4M).
+//
+// Read back frames go to slots, and slots are written by worker threads.
+// Streams use one thread, so frames are written in order. PNG files use
+// a thread per CPU.
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "movie.h"
+#include "workers.h"
+#include "pngwrite.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define USE_X86_SIMD
+#include <emmintrin.h>
+#endif
+
+// BT.709 limited range. Y = 16 + (KY_R * r + KY_G * g + KY_B * b) / 256
+#define KY_R 47
+#define KY_G 157
+#define KY_B 16
+#define KU_R (-26)
+#define KU_G (-86)
+#define KU_B 112
+#define KV_R 112
+#define KV_G (-102)
+#define KV_B (-10)
+
+// slots of stream. PNG uses threads + 2
+#define SLOT_NUM 4
+
+typedef struct movie_job
+{
+    MOVIE *m;
+    int slot;
+    char path[MOVIE_PATH_MAX]; // PNG only
+} MOVIE_JOB;
+
+struct movie_writer
+{
+    WORKERS workers;
+
+    int slot_num;
+    unsigned char **slot; // [slot_num][h][w][4], bottom row first
+    MOVIE_JOB *job;       // [slot_num]
+    int *free_list;       // free slot numbers
+    int free_num;
+    WORKERS_SEM sem_free;
+    WORKERS_SEM lock;
+    volatile int err;
+
+    char path[MOVIE_PATH_MAX];                   // file name of PNG with %d of frame number
+    char pbo_path[MOVIE_PBO_NUM][MOVIE_PATH_MAX]; // file name of PNG in pixel buffer object
+
+    unsigned char *out; // converted frame of stream
+    int out_size;
+};
+
+// ----------------------------------------
+// prototype declaration
+static void convert_rows(const unsigned char *r0, const unsigned char *r1, int w,
+                         unsigned char *y0, unsigned char *y1, unsigned char *u, unsigned char *v);
+static void write_frame(MOVIE *m, const unsigned char *rgba);
+static void write_job(void *arg);
+static int get_slot(MOVIE *m);
+static void push_slot(MOVIE *m, int slot, const char *path);
+static void get_frame_path(MOVIE *m, const char *path, char *dst);
+static void read_pbo(MOVIE *m);
+static int has_suffix(const char *path, const char *ext);
+static int check_png_pattern(const char *path);
+
+// ========================================
+#ifdef USE_X86_SIMD
+// 4 pixels of 16 bit RGBA (lo = pixel 0, 1. hi = pixel 2, 3) -> 4 sums of products
+static inline __m128i dot4_sse2(__m128i lo, __m128i hi, __m128i k)
+{
+    __m128 a = _mm_castsi128_ps(_mm_madd_epi16(lo, k));
+    __m128 b = _mm_castsi128_ps(_mm_madd_epi16(hi, k));
+    __m128i even = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+    __m128i odd = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    return _mm_add_epi32(even, odd);
+}
+
+// 8 pixels of row -> 8 bytes of Y
+static inline void luma8_sse2(const unsigned char *src, unsigned char *dst, __m128i k)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_loadu_si128((const __m128i *)src);
+    __m128i b = _mm_loadu_si128((const __m128i *)(src + 16));
+    __m128i s0 = dot4_sse2(_mm_unpacklo_epi8(a, zero), _mm_unpackhi_epi8(a, zero), k);
+    __m128i s1 = dot4_sse2(_mm_unpacklo_epi8(b, zero), _mm_unpackhi_epi8(b, zero), k);
+    s0 = _mm_srai_epi32(_mm_add_epi32(s0, _mm_set1_epi32(128)), 8);
+    s1 = _mm_srai_epi32(_mm_add_epi32(s1, _mm_set1_epi32(128)), 8);
+    __m128i y = _mm_add_epi16(_mm_packs_epi32(s0, s1), _mm_set1_epi16(16));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(y, y));
+}
+
+// sums of 4 x 2 pixels -> 4 bytes of U or V
+static inline void chroma4_sse2(__m128i q0, __m128i q1, unsigned char *dst, __m128i k)
+{
+    __m128i s = dot4_sse2(q0, q1, k);
+    s = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(s, _mm_set1_epi32(512)), 10), _mm_set1_epi32(128));
+    s = _mm_packs_epi32(s, s);
+    *(int *)dst = _mm_cvtsi128_si32(_mm_packus_epi16(s, s));
+}
+#endif
+
+// two rows -> two rows of Y and one row of U, V. w is even
+static void convert_rows(const unsigned char *r0, const unsigned char *r1, int w,
+                         unsigned char *y0, unsigned char *y1, unsigned char *u, unsigned char *v)
+{
+    int x = 0;
+
+#ifdef USE_X86_SIMD
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ky = _mm_setr_epi16(KY_R, KY_G, KY_B, 0, KY_R, KY_G, KY_B, 0);
+    const __m128i ku = _mm_setr_epi16(KU_R, KU_G, KU_B, 0, KU_R, KU_G, KU_B, 0);
+    const __m128i kv = _mm_setr_epi16(KV_R, KV_G, KV_B, 0, KV_R, KV_G, KV_B, 0);
+
+    for (; x + 8 <= w; x += 8)
+    {
+        const unsigned char *p0 = r0 + x * 4;
+        const unsigned char *p1 = r1 + x * 4;
+        luma8_sse2(p0, y0 + x, ky);
+        luma8_sse2(p1, y1 + x, ky);
+
+        // sum of two rows. 16 bit, 2 pixels per register
+        __m128i a0 = _mm_loadu_si128((const __m128i *)p0);
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(p0 + 16));
+        __m128i b0 = _mm_loadu_si128((const __m128i *)p1);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(p1 + 16));
+        __m128i c0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        __m128i c1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        __m128i c2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        __m128i c3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+        // sum of pixel pairs -> 2 x 2 blocks 0, 1 and 2, 3
+        __m128i q0 = _mm_add_epi16(_mm_unpacklo_epi64(c0, c1), _mm_unpackhi_epi64(c0, c1));
+        __m128i q1 = _mm_add_epi16(_mm_unpacklo_epi64(c2, c3), _mm_unpackhi_epi64(c2, c3));
+        chroma4_sse2(q0, q1, u + x / 2, ku);
+        chroma4_sse2(q0, q1, v + x / 2, kv);
+    }
+#endif
+
+    for (; x < w; x += 2)
+    {
+        const unsigned char *p0 = r0 + x * 4;
+        const unsigned char *p1 = r1 + x * 4;
+        y0[x] = 16 + ((KY_R * p0[0] + KY_G * p0[1] + KY_B * p0[2] + 128) >> 8);
+        y0[x + 1] = 16 + ((KY_R * p0[4] + KY_G * p0[5] + KY_B * p0[6] + 128) >> 8);
+        y1[x] = 16 + ((KY_R * p1[0] + KY_G * p1[1] + KY_B * p1[2] + 128) >> 8);
+        y1[x + 1] = 16 + ((KY_R * p1[4] + KY_G * p1[5] + KY_B * p1[6] + 128) >> 8);
+
+        int r = p0[0] + p0[4] + p1[0] + p1[4];
+        int g = p0[1] + p0[5] + p1[1] + p1[5];
+        int b = p0[2] + p0[6] + p1[2] + p1[6];
+        u[x / 2] = 128 + ((KU_R * r + KU_G * g + KU_B * b + 512) >> 10);
+        v[x / 2] = 128 + ((KV_R * r + KV_G * g + KV_B * b + 512) >> 10);
+    }
+}
+
+// rgba : [h][w][4], bottom row first (glReadPixels). y : [h][w], u, v : [h / 2][w / 2], top row first
+void movie_rgba_to_yuv420(const unsigned char *rgba, int w, int h,
+                          unsigned char *y, unsigned char *u, unsigned char *v)
+{
+    int pitch = w * 4;
+    for (int j = 0; j + 1 < h; j += 2)
+    {
+        const unsigned char *r0 = rgba + (h - 1 - j) * pitch;
+        convert_rows(r0, r0 - pitch, w, y + j * w, y + (j + 1) * w, u + (j / 2) * (w / 2), v + (j / 2) * (w / 2));
+    }
+}
+
+// stream. one worker thread, in order
+static void write_frame(MOVIE *m, const unsigned char *rgba)
+{
+    struct movie_writer *wr = m->writer;
+    int w = m->w;
+    int h = m->h;
+
+    if (m->format == MOVIE_Y4M)
+    {
+        unsigned char *y = wr->out;
+        unsigned char *u = y + w * h;
+        unsigned char *v = u + (w / 2) * (h / 2);
+        movie_rgba_to_yuv420(rgba, w, h, y, u, v);
+        if (fputs("FRAME\n", m->fp) < 0 || fwrite(wr->out, 1, wr->out_size, m->fp) != (size_t)wr->out_size)
+            wr->err = 1;
+    }
+    else
+    {
+        // flip rows
+        for (int j = 0; j < h; j++)
+            memcpy(wr->out + j * w * 4, rgba + (h - 1 - j) * w * 4, w * 4);
+        if (fwrite(wr->out, 1, wr->out_size, m->fp) != (size_t)wr->out_size)
+            wr->err = 1;
+    }
+}
+
+static void write_job(void *arg)
+{
+    MOVIE_JOB *job = (MOVIE_JOB *)arg;
+    MOVIE *m = job->m;
+    struct movie_writer *wr = m->writer;
+
+    if (!wr->err)
+    {
+        if (m->format == MOVIE_PNG)
+        {
+            if (!png_write_rgba(job->path, wr->slot[job->slot], m->w, m->h, 1))
+                wr->err = 1;
+        }
+        else
+        {
+            write_frame(m, wr->slot[job->slot]);
+        }
+    }
+
+    workers_sem_wait(&wr->lock);
+    wr->free_list[wr->free_num++] = job->slot;
+    workers_sem_post(&wr->lock);
+    workers_sem_post(&wr->sem_free);
+}
+
+// wait for free slot
+static int get_slot(MOVIE *m)
+{
+    struct movie_writer *wr = m->writer;
+    workers_sem_wait(&wr->sem_free);
+    workers_sem_wait(&wr->lock);
+    int i = wr->free_list[--wr->free_num];
+    workers_sem_post(&wr->lock);
+    return i;
+}
+
+// pass slot of get_slot() to worker threads. path : file name of PNG
+static void push_slot(MOVIE *m, int slot, const char *path)
+{
+    struct movie_writer *wr = m->writer;
+    MOVIE_JOB *job = &wr->job[slot];
+    job->m = m;
+    job->slot = slot;
+    strcpy(job->path, path);
+    workers_push(&wr->workers, write_job, job);
+    m->frames++;
+}
+
+// path of PNG of this frame. NULL = file name of movie_open() with frame number
+static void get_frame_path(MOVIE *m, const char *path, char *dst)
+{
+    dst[0] = '\0';
+    if (m->format != MOVIE_PNG)
+        return;
+    if (path)
+        snprintf(dst, MOVIE_PATH_MAX, "%s", path);
+    else
+        snprintf(dst, MOVIE_PATH_MAX, m->writer->path, m->frames + m->pbo_busy);
+}
+
+// map oldest pixel buffer object and pass it to worker threads
+static void read_pbo(MOVIE *m)
+{
+    struct movie_writer *wr = m->writer;
+    int size = m->w * m->h * 4;
+    int i = (m->pbo_head - m->pbo_busy + MOVIE_PBO_NUM) % MOVIE_PBO_NUM;
+    int k = get_slot(m);
+    unsigned char *dst = wr->slot[k];
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m->pbo[i]);
+    void *p = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (p)
+    {
+        memcpy(dst, p, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else
+    {
+        memset(dst, 0, size);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    m->pbo_busy--;
+    push_slot(m, k, wr->pbo_path[i]);
+}
+
+static int has_suffix(const char *path, const char *ext)
+{
+    int len = strlen(path);
+    int n = strlen(ext);
+    if (len < n)
+        return 0;
+    for (int i = 0; i < n; i++)
+        if (tolower(path[len - n + i]) != ext[i])
+            return 0;
+    return 1;
+}
+
+// path of MOVIE_PNG is format of snprintf(). one integer conversion (%d, %05d, ...)
+// and no other %, so that each frame has its own file and nothing else is read
+static int check_png_pattern(const char *path)
+{
+    int num = 0;
+    for (const char *p = path; *p; p++)
+    {
+        if (*p != '%')
+            continue;
+        p++;
+        while (*p == '0')
+            p++;
+        while (*p >= '0' && *p <= '9')
+            p++;
+        if (*p != 'd')
+            return 0;
+        num++;
+    }
+    return (num == 1);
+}
+
+// .y4m = MOVIE_Y4M, .png = MOVIE_PNG, others = MOVIE_RGBA
+int movie_get_format(const char *path)
+{
+    if (has_suffix(path, ".y4m"))
+        return MOVIE_Y4M;
+    if (has_suffix(path, ".png"))
+        return MOVIE_PNG;
+    return MOVIE_RGBA;
+}
+
+// w, h must be even for MOVIE_Y4M. needs framebuffer object.
+// MOVIE_PNG : path has one %d of frame number, or NULL if every frame is named by movie_end_frame().
+// return 0 if failed
+int movie_open(MOVIE *m, const char *path, int format, int w, int h, int fps)
+{
+    memset(m, 0, sizeof(MOVIE));
+    if (!glf_has_fbo || w <= 0 || h <= 0)
+        return 0;
+    if (format == MOVIE_PNG && path && !check_png_pattern(path))
+        return 0;
+    if (format == MOVIE_Y4M && ((w & 1) || (h & 1)))
+        return 0;
+
+    if (format != MOVIE_PNG)
+    {
+        m->fp = fopen(path, "wb");
+        if (m->fp == NULL)
+            return 0;
+    }
+
+    m->format = format;
+    m->w = w;
+    m->h = h;
+    m->fps = fps;
+    if (format == MOVIE_Y4M)
+        fprintf(m->fp, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg XCOLORRANGE=LIMITED\n", w, h, fps);
+
+    glGenRenderbuffers(1, &m->color_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, m->color_rb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, w, h);
+    glGenRenderbuffers(1, &m->depth_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, m->depth_rb);
+    // stencil for overdraw heatmap. packed format is in OpenGL 3.0 and ARB_framebuffer_object
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, w, h);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &m->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, m->fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m->color_rb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m->depth_rb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m->depth_rb);
+    int ok = (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // pixel buffer objects and glMapBufferRange() (3.0, ES 3.0)
+    m->use_pbo = (glf_has_vbo && glf_version >= 30 && p_glMapBufferRange && p_glUnmapBuffer);
+    if (m->use_pbo)
+    {
+        glGenBuffers(MOVIE_PBO_NUM, m->pbo);
+        for (int i = 0; i < MOVIE_PBO_NUM; i++)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, m->pbo[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, w * h * 4, NULL, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    // streams are written in order by one thread
+    struct movie_writer *wr = (struct movie_writer *)calloc(1, sizeof(struct movie_writer));
+    int threads = (format == MOVIE_PNG) ? workers_get_cpu_num() : 1;
+    m->writer = wr;
+    if (format == MOVIE_PNG && path)
+        snprintf(wr->path, MOVIE_PATH_MAX, "%s", path);
+    wr->slot_num = (format == MOVIE_PNG) ? threads + 2 : SLOT_NUM;
+    wr->slot = (unsigned char **)malloc(sizeof(unsigned char *) * wr->slot_num);
+    wr->job = (MOVIE_JOB *)malloc(sizeof(MOVIE_JOB) * wr->slot_num);
+    wr->free_list = (int *)malloc(sizeof(int) * wr->slot_num);
+    for (int i = 0; i < wr->slot_num; i++)
+    {
+        wr->slot[i] = (unsigned char *)malloc(w * h * 4);
+        wr->free_list[i] = i;
+    }
+    wr->free_num = wr->slot_num;
+    if (format != MOVIE_PNG)
+    {
+        wr->out_size = (format == MOVIE_Y4M) ? w * h + (w / 2) * (h / 2) * 2 : w * h * 4;
+        wr->out = (unsigned char *)malloc(wr->out_size);
+    }
+    workers_sem_init(&wr->sem_free, wr->slot_num);
+    workers_sem_init(&wr->lock, 1);
+    workers_init(&wr->workers, threads, wr->slot_num);
+
+    if (!ok)
+    {
+        movie_close(m);
+        return 0;
+    }
+    return 1;
+}
+
+// draw frame after this
+void movie_begin_frame(MOVIE *m)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, m->fbo);
+}
+
+// read back drawn frame. path : file name of MOVIE_PNG, NULL = name of movie_open().
+// return 0 if write error
+int movie_end_frame(MOVIE *m, const char *path)
+{
+    struct movie_writer *wr = m->writer;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m->fbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+
+    if (m->use_pbo)
+    {
+        if (m->pbo_busy == MOVIE_PBO_NUM)
+            read_pbo(m);
+
+        get_frame_path(m, path, wr->pbo_path[m->pbo_head]);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m->pbo[m->pbo_head]);
+        glReadPixels(0, 0, m->w, m->h, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        m->pbo_head = (m->pbo_head + 1) % MOVIE_PBO_NUM;
+        m->pbo_busy++;
+    }
+    else
+    {
+        char name[MOVIE_PATH_MAX];
+        get_frame_path(m, path, name);
+        int k = get_slot(m);
+        glReadPixels(0, 0, m->w, m->h, GL_RGBA, GL_UNSIGNED_BYTE, wr->slot[k]);
+        push_slot(m, k, name);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return !wr->err;
+}
+
+// read back drawn frame into rgba ([h][w][4], bottom row first) at once, without writing
+void movie_read_frame(MOVIE *m, unsigned char *rgba)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, m->fbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glReadPixels(0, 0, m->w, m->h, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// write remaining frames and close. return 0 if write error
+int movie_close(MOVIE *m)
+{
+    struct movie_writer *wr = m->writer;
+    int ok = 1;
+
+    if (wr)
+    {
+        while (m->pbo_busy > 0)
+            read_pbo(m);
+        workers_free(&wr->workers);
+
+        ok = !wr->err;
+        workers_sem_destroy(&wr->sem_free);
+        workers_sem_destroy(&wr->lock);
+        for (int i = 0; i < wr->slot_num; i++)
+            free(wr->slot[i]);
+        free(wr->slot);
+        free(wr->job);
+        free(wr->free_list);
+        free(wr->out);
+        free(wr);
+        m->writer = NULL;
+    }
+
+    if (m->fp && fclose(m->fp) != 0)
+        ok = 0;
+    m->fp = NULL;
+
+    if (m->use_pbo)
+        glDeleteBuffers(MOVIE_PBO_NUM, m->pbo);
+    if (m->fbo)
+        glDeleteFramebuffers(1, &m->fbo);
+    if (m->color_rb)
+        glDeleteRenderbuffers(1, &m->color_rb);
+    if (m->depth_rb)
+        glDeleteRenderbuffers(1, &m->depth_rb);
+    m->use_pbo = 0;
+    m->fbo = 0;
+    m->color_rb = 0;
+    m->depth_rb = 0;
+    return ok;
+}
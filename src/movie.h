@@ -0,0 +1,66 @@
+// Last updated: <2026/10/20 04:38:17 +0900>
+//
+// Movie output of offline rendering. Raw video stream (Y4M or RGBA), or
+// PNG file per frame.
+//
+// Frames are drawn into a framebuffer object of movie size. Read back goes
+// through a ring of pixel buffer objects, so glReadPixels() returns at once
+// and the pixels of frame n are mapped after frame n + MOVIE_PBO_NUM - 1 is
+// drawn. Worker threads convert them (YUV 4:2:0 or PNG) and write files,
+// while next frames are drawn.
+
+#ifndef __MOVIE_H__
+#define __MOVIE_H__
+
+#include <stdio.h>
+#include "glfunc.h"
+
+// file format
+enum
+{
+    MOVIE_Y4M,  // YUV4MPEG2, 4:2:0, BT.709 limited range
+    MOVIE_RGBA, // raw RGBA, top row first, no header
+    MOVIE_PNG,  // PNG file per frame, RGB
+};
+
+// pixel buffer objects in flight
+#define MOVIE_PBO_NUM 3
+
+// max length of file name
+#define MOVIE_PATH_MAX 512
+
+struct movie_writer;
+
+typedef struct movie
+{
+    FILE *fp;
+    int format;
+    int w;
+    int h;
+    int fps;
+    int frames; // frames passed to worker threads
+
+    GLuint fbo;
+    GLuint color_rb;
+    GLuint depth_rb; // depth and stencil
+
+    int use_pbo;
+    GLuint pbo[MOVIE_PBO_NUM];
+    int pbo_head; // next pixel buffer object to read into
+    int pbo_busy; // reads in flight
+
+    struct movie_writer *writer;
+} MOVIE;
+
+// ----------------------------------------
+// prototype declaration
+int movie_open(MOVIE *m, const char *path, int format, int w, int h, int fps);
+void movie_begin_frame(MOVIE *m);
+int movie_end_frame(MOVIE *m, const char *path);
+void movie_read_frame(MOVIE *m, unsigned char *rgba);
+int movie_close(MOVIE *m);
+int movie_get_format(const char *path);
+void movie_rgba_to_yuv420(const unsigned char *rgba, int w, int h,
+                          unsigned char *y, unsigned char *u, unsigned char *v);
+
+#endif
@@ -0,0 +1,344 @@
+// Last updated: <2026/10/20 03:32:05 +0900>
+//
+// PNG writer without zlib. RGB 8 bit, adaptive row filter, deflate with
+// LZ77 and fixed Huffman codes.
+//
+// No global tables, so it can be called from many threads at once.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pngwrite.h"
+
+// LZ77
+#define WIN_SIZE 32768
+#define HASH_BITS 15
+#define CHAIN_MAX 32
+#define MATCH_MIN 3
+#define MATCH_MAX 258
+
+// bytes per pixel
+#define BPP 3
+
+typedef struct bits
+{
+    unsigned char *buf;
+    int size;
+    int max;
+    unsigned int acc; // bits not written yet, LSB first
+    int cnt;
+} BITS;
+
+static const unsigned short len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const unsigned char len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const unsigned short dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+    193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const unsigned char dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// ----------------------------------------
+// prototype declaration
+static void put_byte(BITS *b, int v);
+static void put_bits(BITS *b, unsigned int v, int n);
+static void put_code(BITS *b, unsigned int code, int n);
+static void put_lit(BITS *b, int v);
+static void put_match(BITS *b, int len, int dist);
+static void deflate_fixed(BITS *b, const unsigned char *d, int n);
+static void filter_rows(const unsigned char *rgba, int w, int h, int bottom_up, unsigned char *dst);
+static unsigned int crc32_update(unsigned int crc, const unsigned char *p, int n);
+static void put_be32(unsigned char *p, unsigned int v);
+static int write_chunk(FILE *fp, const char *type, const unsigned char *data, int n);
+
+// ========================================
+static void put_byte(BITS *b, int v)
+{
+    if (b->size >= b->max)
+    {
+        b->max = b->max * 2 + 1024;
+        b->buf = (unsigned char *)realloc(b->buf, b->max);
+    }
+    b->buf[b->size++] = (unsigned char)v;
+}
+
+// extra bits, LSB first
+static void put_bits(BITS *b, unsigned int v, int n)
+{
+    b->acc |= v << b->cnt;
+    b->cnt += n;
+    while (b->cnt >= 8)
+    {
+        put_byte(b, b->acc & 0xff);
+        b->acc >>= 8;
+        b->cnt -= 8;
+    }
+}
+
+// Huffman code, MSB first
+static void put_code(BITS *b, unsigned int code, int n)
+{
+    unsigned int r = 0;
+    for (int i = 0; i < n; i++)
+        r |= ((code >> i) & 1) << (n - 1 - i);
+    put_bits(b, r, n);
+}
+
+// fixed literal / length code
+static void put_lit(BITS *b, int v)
+{
+    if (v < 144)
+        put_code(b, 0x30 + v, 8);
+    else if (v < 256)
+        put_code(b, 0x190 + v - 144, 9);
+    else if (v < 280)
+        put_code(b, v - 256, 7);
+    else
+        put_code(b, 0xc0 + v - 280, 8);
+}
+
+static void put_match(BITS *b, int len, int dist)
+{
+    int i = 28;
+    while (len_base[i] > len)
+        i--;
+    put_lit(b, 257 + i);
+    put_bits(b, len - len_base[i], len_extra[i]);
+
+    int k = 29;
+    while (dist_base[k] > dist)
+        k--;
+    put_code(b, k, 5);
+    put_bits(b, dist - dist_base[k], dist_extra[k]);
+}
+
+static inline int get_hash(const unsigned char *p)
+{
+    return ((p[0] << 10) ^ (p[1] << 5) ^ p[2]) & ((1 << HASH_BITS) - 1);
+}
+
+// one final block with fixed Huffman codes
+static void deflate_fixed(BITS *b, const unsigned char *d, int n)
+{
+    int *head = (int *)malloc(sizeof(int) * (1 << HASH_BITS));
+    int *prev = (int *)malloc(sizeof(int) * WIN_SIZE);
+    for (int i = 0; i < (1 << HASH_BITS); i++)
+        head[i] = -1;
+
+    put_bits(b, 1, 1); // BFINAL
+    put_bits(b, 1, 2); // BTYPE = fixed Huffman
+
+    int i = 0;
+    while (i < n)
+    {
+        int best = 0;
+        int best_dist = 0;
+
+        if (i + MATCH_MIN <= n)
+        {
+            int h = get_hash(d + i);
+            int j = head[h];
+            int lim = (n - i < MATCH_MAX) ? n - i : MATCH_MAX;
+            for (int chain = 0; chain < CHAIN_MAX && j >= 0 && i - j <= WIN_SIZE; chain++)
+            {
+                int len = 0;
+                while (len < lim && d[j + len] == d[i + len])
+                    len++;
+                if (len > best)
+                {
+                    best = len;
+                    best_dist = i - j;
+                    if (len == lim)
+                        break;
+                }
+                int jn = prev[j & (WIN_SIZE - 1)];
+                if (jn >= j)
+                    break; // overwritten by newer position
+                j = jn;
+            }
+        }
+
+        int step = (best >= MATCH_MIN) ? best : 1;
+        if (best >= MATCH_MIN)
+            put_match(b, best, best_dist);
+        else
+            put_lit(b, d[i]);
+
+        // insert positions into hash chains
+        for (int k = 0; k < step; k++, i++)
+        {
+            if (i + MATCH_MIN > n)
+                continue;
+            int h = get_hash(d + i);
+            prev[i & (WIN_SIZE - 1)] = head[h];
+            head[h] = i;
+        }
+    }
+
+    put_lit(b, 256); // end of block
+    if (b->cnt > 0)
+        put_bits(b, 0, 8 - b->cnt);
+
+    free(head);
+    free(prev);
+}
+
+static inline int paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    return (pb <= pc) ? b : c;
+}
+
+// rows of filter type byte + RGB. filter with least sum of absolute values
+static void filter_rows(const unsigned char *rgba, int w, int h, int bottom_up, unsigned char *dst)
+{
+    int rowlen = w * BPP;
+    unsigned char *cur = (unsigned char *)malloc(rowlen);
+    unsigned char *up = (unsigned char *)calloc(rowlen, 1);
+    unsigned char *tmp = (unsigned char *)malloc(rowlen * 5);
+
+    for (int y = 0; y < h; y++)
+    {
+        const unsigned char *src = rgba + (bottom_up ? h - 1 - y : y) * w * 4;
+        for (int x = 0; x < w; x++)
+        {
+            cur[x * BPP + 0] = src[x * 4 + 0];
+            cur[x * BPP + 1] = src[x * 4 + 1];
+            cur[x * BPP + 2] = src[x * 4 + 2];
+        }
+
+        int best = 0;
+        long best_sum = -1;
+        for (int f = 0; f < 5; f++)
+        {
+            unsigned char *o = tmp + f * rowlen;
+            long sum = 0;
+            for (int i = 0; i < rowlen; i++)
+            {
+                int a = (i >= BPP) ? cur[i - BPP] : 0;
+                int b = up[i];
+                int c = (i >= BPP) ? up[i - BPP] : 0;
+                int p = 0;
+                if (f == 1)
+                    p = a;
+                else if (f == 2)
+                    p = b;
+                else if (f == 3)
+                    p = (a + b) >> 1;
+                else if (f == 4)
+                    p = paeth(a, b, c);
+                o[i] = (unsigned char)(cur[i] - p);
+                sum += (o[i] < 128) ? o[i] : 256 - o[i];
+            }
+            if (best_sum < 0 || sum < best_sum)
+            {
+                best = f;
+                best_sum = sum;
+            }
+        }
+
+        unsigned char *row = dst + y * (rowlen + 1);
+        row[0] = best;
+        memcpy(row + 1, tmp + best * rowlen, rowlen);
+
+        unsigned char *t = up;
+        up = cur;
+        cur = t;
+    }
+
+    free(cur);
+    free(up);
+    free(tmp);
+}
+
+// bitwise. no table, so no initialization between threads
+static unsigned int crc32_update(unsigned int crc, const unsigned char *p, int n)
+{
+    crc = ~crc;
+    for (int i = 0; i < n; i++)
+    {
+        crc ^= p[i];
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static void put_be32(unsigned char *p, unsigned int v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static int write_chunk(FILE *fp, const char *type, const unsigned char *data, int n)
+{
+    unsigned char hdr[8];
+    unsigned char crc[4];
+    put_be32(hdr, n);
+    memcpy(hdr + 4, type, 4);
+    put_be32(crc, crc32_update(crc32_update(0, hdr + 4, 4), data, n));
+
+    return (fwrite(hdr, 1, 8, fp) == 8 && (n == 0 || fwrite(data, 1, n, fp) == (size_t)n)
+            && fwrite(crc, 1, 4, fp) == 4);
+}
+
+// rgba : [h][w][4]. bottom_up = 1 : bottom row first (glReadPixels). alpha is not written.
+// return 0 if failed
+int png_write_rgba(const char *path, const unsigned char *rgba, int w, int h, int bottom_up)
+{
+    static const unsigned char sig[8] = {0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a};
+
+    int n = h * (w * BPP + 1);
+    unsigned char *raw = (unsigned char *)malloc(n);
+    filter_rows(rgba, w, h, bottom_up, raw);
+
+    // zlib stream. 32K window, no dictionary
+    BITS b;
+    memset(&b, 0, sizeof(b));
+    put_byte(&b, 0x78);
+    put_byte(&b, 0x01);
+    deflate_fixed(&b, raw, n);
+
+    unsigned int s1 = 1;
+    unsigned int s2 = 0;
+    for (int i = 0; i < n; i++)
+    {
+        s1 = (s1 + raw[i]) % 65521;
+        s2 = (s2 + s1) % 65521;
+    }
+    for (int i = 0; i < 4; i++)
+        put_byte(&b, ((s2 << 16) | s1) >> (24 - i * 8));
+    free(raw);
+
+    unsigned char ihdr[13];
+    put_be32(ihdr, w);
+    put_be32(ihdr + 4, h);
+    ihdr[8] = 8;  // bit depth
+    ihdr[9] = 2;  // RGB
+    ihdr[10] = 0; // deflate
+    ihdr[11] = 0; // adaptive filter
+    ihdr[12] = 0; // no interlace
+
+    int ok = 0;
+    FILE *fp = fopen(path, "wb");
+    if (fp)
+    {
+        ok = (fwrite(sig, 1, 8, fp) == 8 && write_chunk(fp, "IHDR", ihdr, 13)
+              && write_chunk(fp, "IDAT", b.buf, b.size) && write_chunk(fp, "IEND", NULL, 0));
+        if (fclose(fp) != 0)
+            ok = 0;
+    }
+    free(b.buf);
+    return ok;
+}
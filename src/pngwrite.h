@@ -0,0 +1,14 @@
+// Last updated: <2026/10/20 03:32:05 +0900>
+//
+// PNG writer without zlib. RGB 8 bit, adaptive row filter, deflate with
+// LZ77 and fixed Huffman codes. Flat colors of this program compress well
+// with fixed codes, and no library is needed on Windows.
+
+#ifndef __PNGWRITE_H__
+#define __PNGWRITE_H__
+
+// ----------------------------------------
+// prototype declaration
+int png_write_rgba(const char *path, const unsigned char *rgba, int w, int h, int bottom_up);
+
+#endif
@@ -0,0 +1,81 @@
+// Last updated: <2026/10/20 10:48:20 +0900>
+//
+// Quality governor
+
+#include "quality.h"
+
+// lowest to full quality
+static const QUALITY_LEVEL levels[QUALITY_LEVEL_MAX] = {
+    {80, 4, 2, 0.5},
+    {150, 2, 1, 0.75},
+    {300, 2, 0, 1.0},
+    {600, 1, 0, 1.0},
+};
+
+// ========================================
+// start at full quality
+void quality_init(QUALITY *q)
+{
+    q->level = QUALITY_LEVEL_MAX - 1;
+    q->frames = 0;
+    q->busy = 0.0;
+    q->time = 0.0;
+    q->probe = QUALITY_PROBE_MIN;
+    q->probing = 0;
+    q->changes = 0;
+}
+
+// busy : work time of last frame, delta : frame interval, budget : 1 / framerate (sec).
+// return level
+int quality_update(QUALITY *q, float busy, float delta, float budget)
+{
+    q->frames++;
+    q->busy += busy;
+    q->time += delta;
+    if (q->frames < QUALITY_WINDOW)
+        return q->level;
+
+    float avg = q->busy / q->frames;
+    q->frames = 0;
+    q->busy = 0.0;
+
+    if (avg > budget * QUALITY_DOWN && q->level > 0)
+    {
+        // failed probe waits longer before next one
+        if (q->probing)
+        {
+            q->probe *= 2.0;
+            if (q->probe > QUALITY_PROBE_MAX)
+                q->probe = QUALITY_PROBE_MAX;
+        }
+        q->probing = 0;
+        q->level--;
+        q->time = 0.0;
+        q->changes++;
+    }
+    else if (q->level < QUALITY_LEVEL_MAX - 1
+             && (avg < budget * QUALITY_UP || (q->time >= q->probe && avg <= budget * QUALITY_DOWN)))
+    {
+        // probe looks for room hidden by vsync. over budget at lowest level, there is none
+        q->probing = (avg >= budget * QUALITY_UP);
+        q->level++;
+        q->time = 0.0;
+        q->changes++;
+    }
+    else if (q->probing && q->time >= QUALITY_PROBE_MIN)
+    {
+        // probe held
+        q->probing = 0;
+        q->probe = QUALITY_PROBE_MIN;
+    }
+    return q->level;
+}
+
+const QUALITY_LEVEL *quality_get_level(int level)
+{
+    if (level < 0)
+        level = 0;
+    if (level >= QUALITY_LEVEL_MAX)
+        level = QUALITY_LEVEL_MAX - 1;
+    return &levels[level];
+}
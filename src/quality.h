@@ -0,0 +1,53 @@
+// Last updated: <2026/10/20 06:02:44 +0900>
+//
+// Quality governor. Busy time of frames (work and swap, without sleep of
+// frame rate control) is compared with the frame budget, and the quality
+// level goes down when frames are over budget, and up when there is room.
+//
+// With vsync, busy time is about the budget even when the GPU is idle, so
+// room cannot be seen. The governor then probes one level up after some
+// time, and waits longer each time the probe fails.
+
+#ifndef __QUALITY_H__
+#define __QUALITY_H__
+
+// frames of average busy time
+#define QUALITY_WINDOW 30
+
+// go down when average is over budget * DOWN, up when under budget * UP
+#define QUALITY_DOWN 1.10
+#define QUALITY_UP 0.70
+
+// probe one level up after this time at a level (sec). doubled on failure
+#define QUALITY_PROBE_MIN 5.0
+#define QUALITY_PROBE_MAX 80.0
+
+// level 0 is lowest. last level is full quality
+#define QUALITY_LEVEL_MAX 4
+
+typedef struct quality_level
+{
+    int disp_num;       // road data drawn before and after player
+    int tree_step;      // draw every n-th tree
+    int lod_bias;       // added to level of detail of roads
+    float render_scale; // resolution of scene / window (upscale.h)
+} QUALITY_LEVEL;
+
+typedef struct quality
+{
+    int level;
+    int frames;  // frames in window
+    float busy;  // sum of busy time in window (sec)
+    float time;  // time at this level (sec)
+    float probe; // probe up after this time (sec)
+    int probing; // 1 = level was raised by probe
+    int changes; // number of level changes
+} QUALITY;
+
+// ----------------------------------------
+// prototype declaration
+void quality_init(QUALITY *q);
+int quality_update(QUALITY *q, float busy, float delta, float budget);
+const QUALITY_LEVEL *quality_get_level(int level);
+
+#endif
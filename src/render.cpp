@@ -1,24 +1,37 @@
-// Last updated: <2024/05/28 08:48:18 +0900>
+// Last updated: <2026/10/20 14:49:27 +0900>
 //
 // Update objs and draw objs by OpenGL
 
+#include <string.h>
 #include "render.h"
 
-// font data
-#include "glbitmfont.h"
-
-// roads data
+// roads data. control points
 #include "roads.h"
-#include "motosuko.h"
-#include "housakatouge.h"
-#include "bandaiazumaskyline.h"
-#include "yasyajintouge.h"
+#include "roadspline.h"
+#include "roadarc.h"
+#include "motion.h"
+#include "coursedata.h"
 
 // object data
-#include "car.h"
-#include "scooter.h"
+#include "modeldata.h"
 
 #include "settings.h"
+#include "glfunc.h"
+
+// font data
+#include "glbitmfont.h"
+#include "roadmesh.h"
+#include "traffic.h"
+#include "roadbatch.h"
+#include "glring.h"
+#include "glcore.h"
+#include "tilecache.h"
+#include "quality.h"
+#include "upscale.h"
+#include "framestat.h"
+#include "framegraph.h"
+#include "telemetry.h"
+#include "softrast.h"
 
 // #if 0
 #ifdef _WIN32
@@ -35,9 +48,38 @@
 #define SCRH 720
 #define IDEAL_FRAMERATE (60.0)
 
-#define FIXED_SPEED 0
-#define IDX_SPD_MAX (0.25)
-// #define IDX_SPD_MAX (2.0)
+#define TRAFFIC_CULL_MARGIN 32.0
+
+// streaming ring buffer. bytes per frame, frames in flight
+#define STREAM_SLOT_SIZE (4 * 1024 * 1024)
+#define STREAM_SLOT_NUM 3
+
+// tile cache. prefetch tiles of this distance ahead (world unit), some tiles per frame
+#define TILE_AHEAD 1000.0
+#define TILE_PREFETCH_MAX 2
+
+// segments whose center or tree is this near tile are drawn into tile
+#define TILE_MARGIN 64.0
+
+// max speed of player (m/s). default of set_player_speed(). speed model is in motion.h
+#define SPD_MAX (42.0)
+// #define SPD_MAX (340.0)
+
+// fade in (sec)
+#define FADEIN_TIME 1.3
+
+// colors of overdraw heatmap. last one is this number of fragments or more
+#define OVERDRAW_LEVEL_MAX 8
+
+// primitive count queries in flight. result is read when it is ready
+#define PRIM_QUERY_NUM 3
+
+// jobs in queue of software renderer. one job per tile
+#define SOFT_QUEUE_MAX 1024
+
+// frame time graph at bottom left of window (pixel). width is 2 pixels per frame
+#define FRAME_GRAPH_MARGIN 8
+#define FRAME_GRAPH_H 160
 
 // globals for size of screen
 int Width, Height;
@@ -45,62 +87,11 @@ int Width, Height;
 #define deg2rad(x) ((x) * M_PI / 180.0)
 #define rad2deg(x) ((x) / M_PI * 180.0)
 
-// ----------------------------------------
-// object data
-typedef struct modeldata
-{
-    float scale;
-    const int vtx_size;
-    const float *vtx;
-    const int nml_size;
-    const float *nml;
-    const int col_size;
-    const float *col;
-    const int uv_size;
-    const float *uv;
-} MODELDATA;
-
-#define MODEL_MAX 2
-
-MODELDATA models[MODEL_MAX] = {
-    {// car
-     12.0,
-     car_obj_vtx_size, &car_obj_vtx[0][0],
-     car_obj_nml_size, &car_obj_nml[0][0],
-     car_obj_col_size, &car_obj_col[0][0],
-     car_obj_uv_size, &car_obj_uv[0][0]},
-    {// scooter
-     16.0,
-     scooter_obj_vtx_size, &scooter_obj_vtx[0][0],
-     scooter_obj_nml_size, &scooter_obj_nml[0][0],
-     scooter_obj_col_size, &scooter_obj_col[0][0],
-     scooter_obj_uv_size, &scooter_obj_uv[0][0]},
-};
-
 // ----------------------------------------
 // course data
-#define COURSE_MAX 4
-
-ROADDATA *course_data[COURSE_MAX] = {
-    yasyajintouge_data,
-    motosuko_data,
-    bandaiazumaskyline_data,
-    housakatouge_data,
-};
-
-const int course_size[COURSE_MAX] = {
-    YASYAJINTOUGE_NUM,
-    MOTOSUKO_NUM,
-    BANDAIAZUMASKYLINE_NUM,
-    HOUSAKATOUGE_NUM,
-};
-
-const char *course_name[COURSE_MAX] = {
-    "To Yashajin Pass",
-    "To Lake Motosu",
-    "Bandai Azuma Skyline",
-    "Hosaka Pass, Fukushima",
-};
+// made from control points by init_course_data()
+ROADDATA *course_data[COURSE_MAX];
+int course_size[COURSE_MAX];
 
 // ----------------------------------------
 // stage type
@@ -156,6 +147,20 @@ const float tree_cols[STG_MAX][6][4] = {
     },
 };
 
+// ----------------------------------------
+// overdraw heatmap color. 0 = black, 1 = blue ... 7 = red, 8 or more = white
+const float overdraw_cols[OVERDRAW_LEVEL_MAX + 1][4] = {
+    {0.00, 0.00, 0.00, 1.0},
+    {0.00, 0.00, 0.55, 1.0},
+    {0.00, 0.35, 1.00, 1.0},
+    {0.00, 0.80, 0.80, 1.0},
+    {0.00, 0.80, 0.00, 1.0},
+    {0.90, 0.90, 0.00, 1.0},
+    {1.00, 0.50, 0.00, 1.0},
+    {0.90, 0.00, 0.00, 1.0},
+    {1.00, 1.00, 1.00, 1.0},
+};
+
 // ----------------------------------------
 // define global work
 typedef struct gwk
@@ -172,9 +177,11 @@ typedef struct gwk
     int step;
 
     float ang;
-    float idx;
-    float idx_add;
-    float spd;
+    float time;    // time from course entry (sec)
+    float dist;    // travel distance (world unit)
+    float idx;     // road index of dist
+    float spd_add; // max speed. negative = backward
+    float spd;     // m/s
 
     int roads_len;
     ROADDATA *roads;
@@ -186,6 +193,11 @@ typedef struct gwk
 
     float course_name_timer;
 
+    // viewport
+    int id;
+    int vx;
+    int vy;
+
     // FPS check
     float rec_time;
     float prev_time;
@@ -195,13 +207,115 @@ typedef struct gwk
     int count_fps;
     int use_waittime;
     float wait_time;
+
+    // overdraw of last frame
+    float overdraw_avg;
+    int overdraw_max;
 } GWK;
 
-// reserve global work
-static GWK gw;
+// ----------------------------------------
+// views. A window is divided into rows x cols viewports (video wall).
+// gw is the view currently being updated / drawn.
+#define VIEW_MAX 64
+
+static GWK gw_views[VIEW_MAX];
+static GWK *gw_cur = &gw_views[0];
+#define gw (*gw_cur)
+
+static int view_num = 1;
+static int wall_rows = 1;
+static int wall_cols = 1;
+
+// draw order of views. sorted to minimize state changes
+static int course_order[VIEW_MAX];
+static int model_order[VIEW_MAX];
+
+// static course geometry. shared by all views
+static ROADMESH course_mesh[COURSE_MAX];
+
+// roads are drawn with static geometry, or made on CPU every frame
+static int road_path = ROAD_PATH_MESH;
+static ROADBATCH road_batch;
+
+// shadows and white lines of roads. ROADBATCH_SHADOW | ROADBATCH_LINE
+static int road_parts = ROADBATCH_ALL;
+
+// simplified static roads when segments are a few pixels long
+static int road_lod = 1;
+
+// traffic of each view
+static ROADARC course_arc[COURSE_MAX];
+static TRAFFICCOURSE course_curve[COURSE_MAX];
+
+// motion timeline of player. per course and model (max speed)
+static MOTION course_motion[COURSE_MAX][MODEL_MAX];
+static TRAFFIC traffic[VIEW_MAX];
+static int traffic_num = 0;
+
+// time step of offline rendering (sec). 0 = real time
+static float fixed_delta = 0.0;
+
+// fixed function or shader renderer
+static int render_backend = RENDER_FIXED;
+
+// per frame vertex / instance data of both renderers
+static GLRING stream_ring;
+
+// prerendered static course of ROAD_PATH_TILES
+static int tile_ready = 0;
+
+// static layers of ROAD_PATH_MESH in painter's order without depth buffer.
+// depth is cleared and tested around vehicles only
+static int painter = 0;
+static unsigned int *tree_idx_buf = NULL;
+static int tree_idx_buf_size = 0;
+static float model_radius[MODEL_MAX];
+
+// quality level. adjusted by frame time if quality_auto
+static QUALITY quality = {QUALITY_LEVEL_MAX - 1, 0, 0.0, 0.0, QUALITY_PROBE_MIN, 0, 0};
+static int quality_auto = 0;
+
+// draw every n-th tree. multiplied with tree step of quality level
+static int tree_step = 1;
+
+// max speed of player (m/s). set before SetupAnimation()
+static float spd_max = SPD_MAX;
+
+// scene at lower resolution, stretched to window. text is drawn at window
+// resolution. render_scale is multiplied by render scale of quality level
+static UPSCALE scene_target;
+static float render_scale = 1.0;
+
+// stage times and frame intervals. primitives of scene are counted by GPU
+static FRAMESTAT frame_stat;
+static double start_time = 0.0;
+static GLuint prim_query[PRIM_QUERY_NUM];
+static int prim_query_used[PRIM_QUERY_NUM];
+static int prim_query_head = 0;
+static unsigned int prim_count = 0;
+
+// frame time graph. vertices are in ring buffer, or in graph_buf without it
+static int frame_graph = 0;
+static FRAMEGRAPH_VTX *graph_buf = NULL;
+
+// overdraw heatmap. fragments of scene are counted in stencil buffer
+static int overdraw = 0;
+static unsigned char *overdraw_buf = NULL;
+static int overdraw_buf_size = 0;
+
+// software renderer. scene is drawn into soft_scene at render scale and
+// stretched into soft, which has text and is drawn to window at end of frame
+static WORKERS soft_workers;
+static SOFTRAST soft;
+static SOFTRAST soft_scene;
+static SOFTRAST *soft_cur = &soft;
+static int soft_ready = 0;
+static int soft_threads = 0;
 
 // ----------------------------------------
 // prototype declaration
+float get_now_time(void);
+double get_now_time_d(void);
 void initCountFps(void);
 void closeCountFps(void);
 float countFps(void);
@@ -211,31 +325,128 @@ void update(float delta);
 void init_gl(void);
 void clear_screen(void);
 void draw_gl(float delta);
+void layout_views(int w, int h);
+void draw_upscaled(void);
+void mark_stage(int stage);
+void begin_prim_query(void);
+void end_prim_query(void);
+void sort_views(void);
+void set_view(int k);
+void set_scene_state(void);
+void reset_scene_state(void);
+void set_scene_matrix(void);
+void set_overlay_matrix(void);
+void get_center_pos(double *xb, double *yb);
+void get_center_pos_at(float idx, double *xb, double *yb);
+void init_course_data(void);
+void free_course_data(void);
+void init_course_mesh(void);
+int get_view_lod(const ROADMESH *m);
+int get_tree_step(void);
+void draw_courses(int num);
+void draw_course_mesh(int layer, int num, const ROADMESH **bound);
+int use_painter(void);
+int use_layer(int layer);
+void draw_trees_idx(const ROADMESH *m, int stg, int idx, int num, int step, int sorted);
+float get_model_radius(int kind);
+void clear_vehicle_depth(void);
+void draw_courses_tiles(int num);
+void draw_tile(int course, int stg, double x, double z, double size);
+void get_tile_rect(float idx, double *u0, double *v0, double *u1, double *v1);
+void draw_cars(void);
+void draw_traffic(int num);
+int get_car_pos(double xb, double yb, float *p);
+int get_traffic_pos(const TRAFFIC *t, int v, int num, double xb, double yb, float *p);
+void init_traffic(const GWK *v);
+int init_core(void);
+void draw_courses_core(int num);
+void draw_vehicles_core(int num);
+void init_soft(void);
+void free_soft(void);
+void draw_gl_soft(float delta);
+void present_soft(void);
+void set_soft_view(int k);
+void set_soft_scene_matrix(void);
+void draw_courses_soft(int num);
+void draw_vehicles_soft(int num);
+void draw_model_soft(int kind, const float *p);
+void draw_text_soft(const char *buf, float x, float y, int kind, float c, float a);
 void draw_roads(int idx, int num, double xb, double yb);
+template <int PARTS, int EVEN>
+void draw_seg_immediate(const ROADDATA *p, const ROADDATA *c, double xb, double yb);
+template <int PARTS, int EVEN>
+void draw_run_immediate(const ROADDATA *rows, int s, int e, double xb, double yb);
+template <int PARTS>
+void draw_roads_immediate(int idx, int num, double xb, double yb);
 void draw_trees(int idx, int num, double xb, double yb);
+void set_obj_pointer(int kind);
 void draw_obj(void);
 double get_road_vec(float idx);
-double get_curve_angle(float idx);
+float get_course_len(void);
+float get_player_spdmax(void);
 void get_road_pos(float idx, float p, double *x, double *y);
 void draw_text(const char *buf, float x, float y, int kind, float a);
 void draw_fps(void);
+void draw_frame_graph(void);
 void draw_course_name(float delta);
 void draw_fadeout(float a);
+void draw_fill(const float col[4]);
+void count_overdraw(void);
+void draw_overdraw(void);
+void draw_overdraw_text(void);
+
+// ----------------------------------------
+// roads made on CPU. instance of parts is selected once per frame,
+// so that loops of segments have no tests of them
+typedef void (*EMIT_FUNC)(int idx, int num, double xb, double yb);
+
+static const EMIT_FUNC roads_immediate[ROADBATCH_PARTS_MAX] = {
+    draw_roads_immediate<0>,
+    draw_roads_immediate<1>,
+    draw_roads_immediate<2>,
+    draw_roads_immediate<3>,
+};
 
 // ========================================
 // main loop. Screensaver version. Update objs and draw objs by OpenGL
 void Render(void)
 {
-    gw.delta = countFps();
-    update(gw.delta);
-    draw_gl(gw.delta);
+    gw_cur = &gw_views[0];
+    float delta = countFps();
+
+    for (int k = 0; k < view_num; k++)
+    {
+        gw_cur = &gw_views[k];
+        gw.delta = delta;
+        update(delta);
+    }
+    mark_stage(FRAMESTAT_UPDATE);
+
+    draw_gl(delta);
+    gw_cur = &gw_views[0];
     // glFinish();
 }
 
 // setup animation
 void SetupAnimation(int Width, int Height)
 {
+    gw_cur = &gw_views[0];
+    view_num = 1;
+    init_course_data();
     init_work_first(Width, Height);
+    set_wall_grid(wall_rows, wall_cols);
+    glfunc_load();
+    glring_init(&stream_ring, STREAM_SLOT_SIZE, STREAM_SLOT_NUM);
+    init_course_mesh();
+    if (render_backend == RENDER_CORE && !init_core())
+    {
+        fprintf(stderr, "OpenGL 3.3 core profile is not available. use fixed function\n");
+        render_backend = RENDER_FIXED;
+    }
+    if (render_backend == RENDER_FIXED)
+        tile_ready = tilecache_init(draw_tile);
+    if (glf_has_query)
+        glGenQueries(PRIM_QUERY_NUM, prim_query);
     init_gl();
     initCountFps();
 }
@@ -244,32 +455,478 @@ void SetupAnimation(int Width, int Height)
 void CleanupAnimation()
 {
     closeCountFps();
+
+    glcore_cleanup();
+    free_soft();
+    glring_free(&stream_ring);
+    tilecache_free();
+    tile_ready = 0;
+
+    for (int i = 0; i < COURSE_MAX; i++)
+    {
+        roadmesh_release(&course_mesh[i]);
+        roadmesh_free(&course_mesh[i]);
+        traffic_free_course(&course_curve[i]);
+        roadarc_free(&course_arc[i]);
+        for (int kind = 0; kind < MODEL_MAX; kind++)
+            motion_free(&course_motion[i][kind]);
+    }
+    free_course_data();
+    roadbatch_free(&road_batch);
+
+    free(overdraw_buf);
+    overdraw_buf = NULL;
+    overdraw_buf_size = 0;
+    free(tree_idx_buf);
+    tree_idx_buf = NULL;
+    tree_idx_buf_size = 0;
+    free(graph_buf);
+    graph_buf = NULL;
+    upscale_free(&scene_target);
+    if (glf_has_query && prim_query[0])
+        glDeleteQueries(PRIM_QUERY_NUM, prim_query);
+    memset(prim_query, 0, sizeof(prim_query));
+    memset(prim_query_used, 0, sizeof(prim_query_used));
+}
+
+// set OpenGL function loader of window library. call before SetupAnimation()
+void set_gl_getproc(void *(*getproc)(const char *name))
+{
+    glfunc_set_getproc(getproc);
+}
+
+// use OpenGL features up to this version only (e.g. 11 = OpenGL 1.1)
+void set_gl_version_limit(int ver)
+{
+    glfunc_set_version_limit(ver);
+}
+
+// RENDER_FIXED, RENDER_CORE or RENDER_SOFT. call before SetupAnimation().
+// RENDER_FIXED and RENDER_SOFT can be switched while running
+void set_render_backend(int kind)
+{
+    render_backend = kind;
+}
+
+int get_render_backend(void)
+{
+    return render_backend;
+}
+
+// worker threads of software renderer. 0 = number of CPUs
+void set_soft_threads(int threads)
+{
+    soft_threads = threads;
+    free_soft();
+}
+
+// select SIMD kernel of software renderer. return selected kernel
+int set_soft_kernel(int kind)
+{
+    softrast_set_kernel(kind);
+    return softrast_get_kernel();
 }
 
 void set_use_waittime(int fg)
 {
-    gw.use_waittime = fg;
+    gw_views[0].use_waittime = fg;
 }
 
 void set_cfg_framerate(float fps)
 {
-    gw.cfg_framerate = fps;
+    gw_views[0].cfg_framerate = fps;
 }
 
 float get_cfg_framerate(void)
 {
-    return gw.cfg_framerate;
+    return gw_views[0].cfg_framerate;
 }
 
 void resize_window(int w, int h)
 {
     Width = w;
     Height = h;
-    gw.scrw = w;
-    gw.scrh = h;
+    layout_views(Width, Height);
     init_gl();
 }
 
+// divide window into rows x cols views. Each view runs a different course / stage / model
+void set_wall_grid(int rows, int cols)
+{
+    if (rows < 1)
+        rows = 1;
+    if (cols < 1)
+        cols = 1;
+    while (rows * cols > VIEW_MAX)
+    {
+        if (rows > cols)
+            rows--;
+        else
+            cols--;
+    }
+
+    GWK *v0 = &gw_views[0];
+    int n = rows * cols;
+    for (int k = 1; k < n; k++)
+    {
+        GWK *v = &gw_views[k];
+        *v = *v0;
+        v->id = k;
+        v->course_num = (v0->course_num + k) % COURSE_MAX;
+        v->stage_color_num = (v0->stage_color_num + k / COURSE_MAX) % STG_MAX;
+        v->model_kind = (v0->model_kind + k / (COURSE_MAX * STG_MAX)) % MODEL_MAX;
+        v->step = 0;
+    }
+
+    wall_rows = rows;
+    wall_cols = cols;
+    view_num = n;
+    layout_views(Width, Height);
+}
+
+int get_view_num(void)
+{
+    return view_num;
+}
+
+// skip fadein and course name. Used by benchmark
+void skip_intro(void)
+{
+    for (int k = 0; k < view_num; k++)
+    {
+        gw_cur = &gw_views[k];
+        if (gw.step <= 1)
+        {
+            if (gw.step == 0)
+                init_work();
+            gw.fadev = 0.0;
+            gw.step = 2;
+        }
+        gw.course_name_timer = 0.0;
+    }
+    gw_cur = &gw_views[0];
+}
+
+// jump to time sec from course entry on all views, by motion timeline.
+// traffic is placed again
+void seek_course_time(float sec)
+{
+    if (sec < 0.0)
+        sec = 0.0;
+
+    for (int k = 0; k < view_num; k++)
+    {
+        gw_cur = &gw_views[k];
+        if (gw.step == 0 || gw.step == 3)
+        {
+            if (gw.step == 3)
+            {
+                // fading out. seek in next course
+                gw.course_num = (gw.course_num + 1) % COURSE_MAX;
+                gw.stage_color_num = (gw.stage_color_num + 1) % STG_MAX;
+                gw.model_kind = (gw.model_kind + 1) % MODEL_MAX;
+            }
+            init_work();
+        }
+
+        const MOTION *m = &course_motion[gw.course_num][gw.model_kind];
+        float t = motion_get_duration(m);
+        if (sec < t)
+            t = sec;
+
+        gw.time = t;
+        gw.ang = gw.framerate * t;
+        motion_get(m, t, &gw.dist, &gw.spd);
+        gw.idx = roadarc_get_idx(&course_arc[gw.course_num], gw.dist);
+
+        gw.fadev = 1.0 - t / FADEIN_TIME;
+        if (gw.fadev < 0.0)
+            gw.fadev = 0.0;
+        gw.step = (gw.fadev > 0.0) ? 1 : 2;
+        gw.course_name_timer = (t < 7.5) ? 7.5 - t : 0.0;
+        init_traffic(&gw);
+    }
+    gw_cur = &gw_views[0];
+}
+
+// start course / stage / model on first view. other views of wall follow it.
+// negative value = keep current one
+void set_course(int course, int stg, int model)
+{
+    GWK *v = &gw_views[0];
+    if (course >= 0)
+        v->course_num = course % COURSE_MAX;
+    if (stg >= 0)
+        v->stage_color_num = stg % STG_MAX;
+    if (model >= 0)
+        v->model_kind = model % MODEL_MAX;
+    v->step = 0;
+    set_wall_grid(wall_rows, wall_cols);
+}
+
+int get_course_max(void)
+{
+    return COURSE_MAX;
+}
+
+int get_stage_max(void)
+{
+    return STG_MAX;
+}
+
+int get_model_max(void)
+{
+    return MODEL_MAX;
+}
+
+// first view finished fade out. call after Render(), next course starts at next frame
+int is_course_end(void)
+{
+    return (gw_views[0].step == 0);
+}
+
+// time from course entry of first view (sec)
+float get_course_time(void)
+{
+    return gw_views[0].time;
+}
+
+// time to reach course exit of first view (sec)
+float get_course_duration(void)
+{
+    const GWK *v = &gw_views[0];
+    return motion_get_duration(&course_motion[v->course_num][v->model_kind]);
+}
+
+void set_road_path(int path)
+{
+    road_path = path;
+}
+
+void set_road_lod(int fg)
+{
+    road_lod = fg;
+}
+
+// level of detail of static roads for current view
+int get_view_lod(const ROADMESH *m)
+{
+    if (!road_lod)
+        return 0;
+
+    // lower quality allows larger error (pixel)
+    int bias = quality_get_level(quality.level)->lod_bias;
+    return roadmesh_get_lod(m, 2.0 * gw.view_h / gw.scrh * (1 << bias));
+}
+
+int get_tree_step(void)
+{
+    return quality_get_level(quality.level)->tree_step * tree_step;
+}
+
+// level = 0 (lowest) - get_quality_max() - 1 (full). negative = adjusted by frame time
+void set_quality(int level)
+{
+    quality_init(&quality);
+    quality_auto = (level < 0);
+    if (level >= 0)
+        quality.level = (level < QUALITY_LEVEL_MAX) ? level : QUALITY_LEVEL_MAX - 1;
+}
+
+int get_quality(void)
+{
+    return quality.level;
+}
+
+int get_quality_max(void)
+{
+    return QUALITY_LEVEL_MAX;
+}
+
+// fill body of telemetry block. header is set by telemetry_open()
+void get_telemetry(TELEMETRY_DATA *d)
+{
+    static const float pct[TELEMETRY_PCT_NUM] = {50, 90, 99, 100};
+    const GWK *v = &gw_views[0];
+    float ms[TELEMETRY_PCT_NUM];
+
+    framestat_get_percentiles(&frame_stat, pct, TELEMETRY_PCT_NUM, ms);
+    for (int i = 0; i < TELEMETRY_PCT_NUM; i++)
+        d->frame_ms[i] = ms[i] * 1000.0;
+    for (int i = 0; i < TELEMETRY_STAGE_MAX && i < FRAMESTAT_STAGE_MAX; i++)
+        d->stage_ms[i] = frame_stat.last[i] * 1000.0;
+
+    d->frames = frame_stat.frames;
+    d->misses = frame_stat.misses;
+    d->uptime = get_now_time_d() - start_time;
+    d->framerate = v->cfg_framerate;
+    d->fps = v->count_fps;
+
+    d->views = view_num;
+    d->course = v->course_num;
+    d->stage = v->stage_color_num;
+    d->model = v->model_kind;
+    d->course_time = v->time;
+
+    d->prims = prim_count;
+    d->quality = quality.level + 1;
+    d->quality_max = QUALITY_LEVEL_MAX;
+    d->render_scale = render_scale;
+}
+
+// tree density. 1 = all trees, n = every n-th tree
+void set_tree_step(int step)
+{
+    tree_step = (step > 1) ? step : 1;
+}
+
+// max speed of player (m/s) and fixed speed (no acceleration) of motion timeline.
+// call before SetupAnimation()
+void set_player_speed(float spdmax, int fixed)
+{
+    if (spdmax > 0.0)
+        spd_max = spdmax;
+    motion_set_fixed_speed(fixed);
+}
+
+// resolution of scene / window. UPSCALE_MIN - 1.0. needs framebuffer object
+void set_render_scale(float scale)
+{
+    if (scale < UPSCALE_MIN)
+        scale = UPSCALE_MIN;
+    if (scale > 1.0)
+        scale = 1.0;
+    render_scale = scale;
+}
+
+float get_render_scale(void)
+{
+    return render_scale;
+}
+
+// size of scene in pixel, including scale of quality level.
+// return 0 if scene is drawn into window directly
+int get_render_size(int *w, int *h)
+{
+    *w = Width;
+    *h = Height;
+
+    float s = render_scale * quality_get_level(quality.level)->render_scale;
+    if (s >= 1.0 || (!glf_has_fbo && render_backend != RENDER_SOFT))
+        return 0;
+    if (s < UPSCALE_MIN)
+        s = UPSCALE_MIN;
+
+    // same size for all views of wall
+    int vw = (int)((Width / wall_cols) * s + 0.5);
+    int vh = (int)((Height / wall_rows) * s + 0.5);
+    *w = ((vw > 0) ? vw : 1) * wall_cols;
+    *h = ((vh > 0) ? vh : 1) * wall_rows;
+    return 1;
+}
+
+// select SIMD kernel of ROAD_PATH_BATCH. return selected kernel
+int set_road_kernel(int kind)
+{
+    roadbatch_set_kernel(kind);
+    return roadbatch_get_kernel();
+}
+
+// measure road batch kernel on view 0. return microseconds per call
+double time_road_batch(int loops)
+{
+    gw_cur = &gw_views[0];
+    int s0, s1;
+    double xb, yb;
+    const ROADMESH *m = &course_mesh[gw.course_num];
+    roadmesh_get_seg_range(m, static_cast<int>(gw.idx), 600, &s0, &s1);
+    get_center_pos(&xb, &yb);
+
+    double t0 = get_now_time_d();
+    for (int i = 0; i < loops; i++)
+        roadbatch_build(&road_batch, m, s0, s1, xb + i * 0.001, yb, road_parts);
+    double t1 = get_now_time_d();
+    return (t1 - t0) * 1000000.0 / loops;
+}
+
+// advance sec per frame, regardless of real time. 0 = real time
+void set_fixed_delta(float sec)
+{
+    fixed_delta = sec;
+}
+
+// static layers without depth buffer. ROAD_PATH_MESH and core renderer only
+void set_painter_order(int fg)
+{
+    painter = fg;
+}
+
+// draw shadows and white lines of roads
+void set_road_parts(int shadow, int line)
+{
+    road_parts = ((shadow) ? ROADBATCH_SHADOW : 0) | ((line) ? ROADBATCH_LINE : 0);
+}
+
+void get_road_parts(int *shadow, int *line)
+{
+    *shadow = (road_parts & ROADBATCH_SHADOW) != 0;
+    *line = (road_parts & ROADBATCH_LINE) != 0;
+}
+
+// overdraw heatmap instead of scene. needs stencil buffer
+void set_overdraw(int fg)
+{
+    overdraw = fg;
+}
+
+int get_overdraw(void)
+{
+    return overdraw;
+}
+
+void set_frame_graph(int fg)
+{
+    frame_graph = fg;
+}
+
+int get_frame_graph(void)
+{
+    return frame_graph;
+}
+
+// average and max fragments per pixel of first view in last frame
+void get_overdraw_stat(float *avg, int *max)
+{
+    *avg = gw_views[0].overdraw_avg;
+    *max = gw_views[0].overdraw_max;
+}
+
+// zoom of first view. 1.0 = 720 world units in height
+float get_view_scale(void)
+{
+    return gw_views[0].view_scale;
+}
+
+// set number of vehicles on each course
+void set_traffic_num(int num)
+{
+    traffic_num = num;
+    for (int k = 0; k < view_num; k++)
+    {
+        GWK *v = &gw_views[k];
+        if (v->step > 0)
+            init_traffic(v);
+    }
+}
+
+// traffic of view. same vehicles every time for course and view,
+// so that seek, export and compare are reproducible
+void init_traffic(const GWK *v)
+{
+    unsigned int seed = (unsigned int)(v->course_num * VIEW_MAX + v->id + 1) * 2654435761u;
+    traffic_init(&traffic[v->id], &course_curve[v->course_num], traffic_num, MODEL_MAX, spd_max, seed);
+}
+
 // ========================================
 
 // get random value. (0.0 - 1.0)
@@ -293,6 +950,23 @@ float get_now_time(void)
 #endif
 }
 
+// double version. for measuring short time
+double get_now_time_d(void)
+{
+#ifdef WINMM_TIMER
+    // Windows
+    LARGE_INTEGER freq, cnt;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&cnt);
+    return (double)cnt.QuadPart / (double)freq.QuadPart;
+#else
+    // Linux
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+#endif
+}
+
 void initCountFps(void)
 {
 #ifdef WINMM_TIMER
@@ -303,6 +977,9 @@ void initCountFps(void)
     gw.prev_time = gw.rec_time;
     gw.count_fps = 0;
     gw.count_frame = 0;
+
+    framestat_init(&frame_stat);
+    start_time = get_now_time_d();
 }
 
 void closeCountFps(void)
@@ -341,6 +1018,10 @@ float countFps(void)
 {
     float delta, t;
 
+    // work and swap of last frame, without sleep
+    float busy = get_now_time() - gw.prev_time;
+    mark_stage(FRAMESTAT_SWAP);
+
     if (gw.use_waittime != 0)
         waitFrame();
 
@@ -350,6 +1031,7 @@ float countFps(void)
     if (delta <= 0 || delta >= 1.0)
         delta = 1.0 / gw.framerate;
     gw.prev_time = gw.now_time;
+    framestat_end_frame(&frame_stat, delta, 1.0 / gw.cfg_framerate, get_now_time_d());
 
     // check FPS
     gw.count_frame++;
@@ -366,6 +1048,13 @@ float countFps(void)
         gw.count_fps = 0;
         gw.count_frame = 0;
     }
+
+    // offline rendering keeps quality
+    if (quality_auto && fixed_delta <= 0.0)
+        quality_update(&quality, busy, delta, 1.0 / gw.cfg_framerate);
+
+    if (fixed_delta > 0.0)
+        delta = fixed_delta;
     return delta;
 }
 
@@ -376,7 +1065,7 @@ void init_work_first(int Width, int Height)
     gw.scrw = Width;
     gw.scrh = Height;
     gw.framerate = 60.0;
-    gw.cfg_framerate = (1000.0 / (float)waitValue);
+    gw.cfg_framerate = 60.0;
     // gw.zfar = 1000.0;
     gw.zfar = 800.0;
     gw.use_waittime = 0;
@@ -393,13 +1082,16 @@ void init_work_first(int Width, int Height)
 void init_work(void)
 {
     gw.ang = 0.0;
+    gw.time = 0.0;
+    gw.dist = 0.0;
     gw.idx = 0.0;
-    gw.idx_add = IDX_SPD_MAX;
+    gw.spd_add = spd_max;
     gw.spd = 0.0;
     gw.fadev = 1.0;
     gw.roads = course_data[gw.course_num];
     gw.roads_len = course_size[gw.course_num];
     gw.course_name_timer = 7.5;
+    init_traffic(&gw);
 }
 
 void update(float delta)
@@ -417,7 +1109,7 @@ void update(float delta)
         break;
     case 1:
         // fadein
-        gw.fadev -= ((1.0 / (gw.framerate * 1.3)) * gw.framerate * delta);
+        gw.fadev -= ((1.0 / (gw.framerate * FADEIN_TIME)) * gw.framerate * delta);
         if (gw.fadev <= 0.0)
         {
             gw.fadev = 0.0;
@@ -426,7 +1118,7 @@ void update(float delta)
         break;
     case 2:
         // main job
-        if (gw.idx >= gw.roads_len - 10)
+        if (gw.dist >= get_course_len() - MOTION_END_DIST)
         {
             gw.fadev = 0.0;
             gw.step++;
@@ -461,55 +1153,45 @@ void update(float delta)
     gw.view_h = (float(SCRH) / 2.0) * gw.view_scale;
     gw.view_w = gw.view_h * float(gw.scrw) / float(gw.scrh);
 
-    // update index
-    float spdmax = fabsf(gw.idx_add);
-    if (gw.model_kind == 1)
-        spdmax *= 0.7;
+    // update travel distance
+    float frames = gw.framerate * delta;
+    float len = get_course_len();
+    gw.time += delta;
 
-    if (gw.idx >= gw.roads_len - 10)
+    if (traffic_num > 0)
     {
-        gw.spd -= 0.005;
-        if (gw.spd <= (spdmax * 0.1))
-            gw.spd = spdmax * 0.1;
+        // vehicles ahead change speed of player, so integrate every frame
+        gw.spd = motion_step_speed(&course_curve[gw.course_num], gw.idx, gw.dist, len,
+                                   gw.spd, get_player_spdmax(), frames);
+
+        // keep distance from vehicle ahead
+        TRAFFIC *t = &traffic[gw.id];
+        traffic_update(t, &course_curve[gw.course_num], frames, gw.dist);
+        if (gw.spd > t->player_spdmax)
+            gw.spd = t->player_spdmax;
+
+        gw.dist += (((gw.spd_add > 0) ? gw.spd : -gw.spd) * ROADARC_UNIT_PER_M * delta);
+
+        if (gw.dist < 0)
+            gw.dist = 0;
+        if (gw.dist >= len)
+            gw.dist = len;
     }
     else
     {
-        if (FIXED_SPEED)
-        {
-            // fixed speed
-            gw.spd = spdmax;
-        }
-        else
-        {
-            // With acceleration / deceleration
-            float a = get_curve_angle(gw.idx);
-            if (a < 20.0)
-            {
-                gw.spd += 0.0025;
-                if (gw.spd >= spdmax)
-                    gw.spd = spdmax;
-            }
-            else if (a > 30.0)
-            {
-                gw.spd -= 0.0025;
-                if (gw.spd <= spdmax * 0.4)
-                    gw.spd = spdmax * 0.4;
-            }
-        }
+        // same result as integration above, at any frame rate
+        motion_get(&course_motion[gw.course_num][gw.model_kind], gw.time, &gw.dist, &gw.spd);
     }
-    gw.idx += (((gw.idx_add > 0) ? gw.spd : -gw.spd) * gw.framerate * delta);
-
-    if (gw.idx < 0)
-        gw.idx = 0;
-    if (gw.idx >= gw.roads_len - 3)
-        gw.idx = gw.roads_len - 3;
+    gw.idx = roadarc_get_idx(&course_arc[gw.course_num], gw.dist);
 
     gw.ang += (1.0 * gw.framerate * delta);
 }
 
 void init_gl(void)
 {
-    glViewport(0, 0, gw.scrw, gw.scrh);
+    glViewport(0, 0, Width, Height);
+    if (render_backend == RENDER_CORE)
+        return;
     glShadeModel(GL_FLAT);
     // glShadeModel(GL_SMOOTH);
     glClearDepth(1.0);
@@ -527,32 +1209,275 @@ void clear_screen(void)
         glClearColor(clear_colors[n][0], clear_colors[n][1], clear_colors[n][2], 1.0);
     }
     glClearDepth(1.0);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // painter's order clears depth around vehicles later
+    GLbitfield bits = GL_COLOR_BUFFER_BIT;
+    if (!use_painter())
+        bits |= GL_DEPTH_BUFFER_BIT;
+    if (overdraw)
+    {
+        glClearStencil(0);
+        bits |= GL_STENCIL_BUFFER_BIT;
+    }
+    glClear(bits);
 }
 
 void draw_gl(float delta)
 {
-    clear_screen();
+    if (render_backend == RENDER_SOFT)
+    {
+        draw_gl_soft(delta);
+        return;
+    }
 
-    // set ortho
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(-gw.view_w, gw.view_w, -gw.view_h, gw.view_h, -gw.zfar, gw.zfar);
+    sort_views();
+    glring_begin_frame(&stream_ring);
 
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
+    // scene into framebuffer object of render scale.
+    // screen may be framebuffer object of movie output, it is kept by upscale
+    int sw, sh;
+    int scaled = (get_render_size(&sw, &sh) && upscale_begin(&scene_target, sw, sh));
+    if (scaled)
+        layout_views(sw, sh);
 
-    glEnable(GL_CULL_FACE);
-    glFrontFace(GL_CCW);
-    // glCullFace(GL_FRONT);
-    glCullFace(GL_BACK);
+    // clear each view
+    glEnable(GL_SCISSOR_TEST);
+    for (int k = 0; k < view_num; k++)
+    {
+        set_view(k);
+        clear_screen();
+    }
+    begin_prim_query();
 
-    glDepthFunc(GL_LESS);
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glEnable(GL_NORMALIZE);
+    // count all fragments of scene, passed or failed depth test
+    if (overdraw)
+    {
+        glEnable(GL_STENCIL_TEST);
+        glStencilFunc(GL_ALWAYS, 0, 0xff);
+        glStencilOp(GL_KEEP, GL_INCR, GL_INCR);
+    }
 
-    // set lighting
+    // draw roads and trees, then cars. all views at once
+    int disp_num = quality_get_level(quality.level)->disp_num;
+    if (render_backend == RENDER_CORE)
+    {
+        for (int k = 0; k < view_num; k++)
+            glcore_set_view_matrix(k, gw_views[k].view_w, gw_views[k].view_h, gw_views[k].zfar);
+        glcore_upload_views(view_num);
+
+        glcore_begin_scene();
+        if (use_painter())
+        {
+            glDisable(GL_DEPTH_TEST);
+            draw_courses_core(disp_num);
+            clear_vehicle_depth();
+            glEnable(GL_DEPTH_TEST);
+        }
+        else
+        {
+            draw_courses_core(disp_num);
+        }
+        draw_vehicles_core(disp_num);
+        glcore_end_scene();
+        mark_stage(FRAMESTAT_MODEL);
+    }
+    else
+    {
+        set_scene_state();
+        if (use_painter())
+        {
+            glDisable(GL_DEPTH_TEST);
+            draw_courses(disp_num);
+            clear_vehicle_depth();
+            glEnable(GL_DEPTH_TEST);
+        }
+        else
+        {
+            draw_courses(disp_num);
+        }
+        draw_cars();
+        draw_traffic(disp_num);
+        reset_scene_state();
+        mark_stage(FRAMESTAT_MODEL);
+    }
+    if (overdraw)
+        glDisable(GL_STENCIL_TEST);
+    end_prim_query();
+
+    // heatmap and fade are at render scale
+    for (int k = 0; k < view_num; k++)
+    {
+        set_view(k);
+        if (render_backend != RENDER_CORE)
+            set_overlay_matrix();
+        if (overdraw)
+        {
+            count_overdraw();
+            draw_overdraw();
+        }
+        draw_fadeout(gw.fadev);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+
+    if (scaled)
+    {
+        upscale_end(&scene_target);
+        layout_views(Width, Height);
+        draw_upscaled();
+    }
+
+    // text at window resolution
+    glEnable(GL_SCISSOR_TEST);
+    for (int k = 0; k < view_num; k++)
+    {
+        set_view(k);
+        if (render_backend != RENDER_CORE)
+            set_overlay_matrix();
+        if (overdraw)
+            draw_overdraw_text();
+        draw_course_name(delta);
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+
+    // whole window
+    gw_cur = &gw_views[0];
+    glViewport(0, 0, Width, Height);
+
+    if (fps_display != 0)
+        draw_fps();
+    if (frame_graph)
+        draw_frame_graph();
+
+    glring_end_frame(&stream_ring);
+    mark_stage(FRAMESTAT_OVERLAY);
+}
+
+// views of wall in screen of w x h
+void layout_views(int w, int h)
+{
+    int scrh = h;
+    w /= wall_cols;
+    h /= wall_rows;
+
+    for (int k = 0; k < view_num; k++)
+    {
+        GWK *v = &gw_views[k];
+        v->vx = (k % wall_cols) * w;
+        v->vy = scrh - ((k / wall_cols) + 1) * h;
+        v->scrw = w;
+        v->scrh = h;
+    }
+}
+
+static int cmp_course_order(const void *a, const void *b)
+{
+    const GWK *va = &gw_views[*(const int *)a];
+    const GWK *vb = &gw_views[*(const int *)b];
+    int ka = va->course_num * STG_MAX + va->stage_color_num;
+    int kb = vb->course_num * STG_MAX + vb->stage_color_num;
+    if (ka != kb)
+        return ka - kb;
+    return *(const int *)a - *(const int *)b;
+}
+
+static int cmp_model_order(const void *a, const void *b)
+{
+    const GWK *va = &gw_views[*(const int *)a];
+    const GWK *vb = &gw_views[*(const int *)b];
+    if (va->model_kind != vb->model_kind)
+        return va->model_kind - vb->model_kind;
+    return *(const int *)a - *(const int *)b;
+}
+
+// sort views by course and by model, so that same arrays are drawn in a row
+void sort_views(void)
+{
+    for (int k = 0; k < view_num; k++)
+    {
+        course_order[k] = k;
+        model_order[k] = k;
+    }
+    qsort(course_order, view_num, sizeof(int), cmp_course_order);
+    qsort(model_order, view_num, sizeof(int), cmp_model_order);
+}
+
+// stretch scene of render scale to views of window
+void draw_upscaled(void)
+{
+    // window size may not be a multiple of grid
+    int w = (Width / wall_cols) * wall_cols;
+    int h = (Height / wall_rows) * wall_rows;
+    glViewport(0, Height - h, w, h);
+
+    if (render_backend == RENDER_CORE)
+    {
+        glDisable(GL_BLEND);
+        glcore_draw_texture(scene_target.tex);
+    }
+    else
+    {
+        upscale_draw(&scene_target);
+    }
+}
+
+// add time from last mark to stage of frame statistics
+void mark_stage(int stage)
+{
+    framestat_mark(&frame_stat, stage, get_now_time_d());
+}
+
+// count primitives of scene. result of older query is read if GPU finished it
+void begin_prim_query(void)
+{
+    if (!glf_has_query || prim_query[0] == 0)
+        return;
+
+    GLuint q = prim_query[prim_query_head];
+    if (prim_query_used[prim_query_head])
+    {
+        GLuint ready = 0;
+        glGetQueryObjectuiv(q, GL_QUERY_RESULT_AVAILABLE, &ready);
+        if (ready)
+            glGetQueryObjectuiv(q, GL_QUERY_RESULT, &prim_count);
+    }
+    glBeginQuery(GL_PRIMITIVES_GENERATED, q);
+}
+
+void end_prim_query(void)
+{
+    if (!glf_has_query || prim_query[0] == 0)
+        return;
+
+    glEndQuery(GL_PRIMITIVES_GENERATED);
+    prim_query_used[prim_query_head] = 1;
+    prim_query_head = (prim_query_head + 1) % PRIM_QUERY_NUM;
+}
+
+void set_view(int k)
+{
+    gw_cur = &gw_views[k];
+    glViewport(gw.vx, gw.vy, gw.scrw, gw.scrh);
+    glScissor(gw.vx, gw.vy, gw.scrw, gw.scrh);
+}
+
+void set_scene_state(void)
+{
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    glEnable(GL_CULL_FACE);
+    glFrontFace(GL_CCW);
+    // glCullFace(GL_FRONT);
+    glCullFace(GL_BACK);
+
+    glDepthFunc(GL_LESS);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glEnable(GL_NORMALIZE);
+
+    // set lighting
     GLfloat light_pos[4] = {1.0, 1.0, 1.0, 0.0};
     GLfloat light_ambient[4] = {0.5, 0.5, 0.5, 1.0};
     GLfloat light_diffuse[4] = {1.0, 1.0, 1.0, 1.0};
@@ -569,207 +1494,1120 @@ void draw_gl(float delta)
     glColorMaterial(GL_FRONT, GL_AMBIENT_AND_DIFFUSE);
     // glColorMaterial(GL_FRONT, GL_DIFFUSE);
     glEnable(GL_COLOR_MATERIAL);
+}
+
+void reset_scene_state(void)
+{
+    glDisable(GL_LIGHTING);
+    glDisable(GL_LIGHT0);
+    glDisable(GL_COLOR_MATERIAL);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_TEXTURE_2D);
+}
+
+// set ortho and 30 degree tilt of current view
+void set_scene_matrix(void)
+{
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(-gw.view_w, gw.view_w, -gw.view_h, gw.view_h, -gw.zfar, gw.zfar);
+
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glRotatef(30, 1, 0, 0);
+}
+
+void set_overlay_matrix(void)
+{
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(-1.0, 1.0, -1.0, 1.0, -gw.zfar, gw.zfar);
+
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+}
+
+// get center position of current view
+void get_center_pos(double *xb, double *yb)
+{
+    get_center_pos_at(gw.idx, xb, yb);
+}
+
+// center position when player is at road index idx
+void get_center_pos_at(float idx, double *xb, double *yb)
+{
+    if (idx > gw.roads_len - 1)
+        idx = gw.roads_len - 1;
+
+    int i = static_cast<int>(idx);
+    double frac = idx - static_cast<double>(i);
+
+    if (i < gw.roads_len - 1)
+    {
+        double x0, y0, x1, y1;
+        x0 = gw.roads[i].cx;
+        y0 = gw.roads[i].cy;
+        x1 = gw.roads[i + 1].cx;
+        y1 = gw.roads[i + 1].cy;
+        *xb = x0 + (x1 - x0) * frac;
+        *yb = -(y0 + (y1 - y0) * frac);
+    }
+    else
+    {
+        double x0, y0;
+        x0 = gw.roads[i].cx;
+        y0 = gw.roads[i].cy;
+        *xb = x0;
+        *yb = -y0;
+    }
+}
+
+// make road data of all courses from control points.
+// trees are same every time, random seed is course number
+void init_course_data(void)
+{
+    for (int i = 0; i < COURSE_MAX; i++)
+    {
+        if (course_data[i] == NULL)
+            course_data[i] = roadspline_build(course_ctrl[i], course_ctrl_num[i], i + 1, &course_size[i]);
+    }
+}
+
+void free_course_data(void)
+{
+    for (int i = 0; i < COURSE_MAX; i++)
+    {
+        free(course_data[i]);
+        course_data[i] = NULL;
+        course_size[i] = 0;
+    }
+}
+
+void init_course_mesh(void)
+{
+    for (int i = 0; i < COURSE_MAX; i++)
+    {
+        if (!course_mesh[i].built)
+        {
+            roadmesh_build(&course_mesh[i], course_data[i], course_size[i], tree_cols);
+            roadarc_build(&course_arc[i], course_data[i], course_size[i]);
+            traffic_build_course(&course_curve[i], course_data[i], course_size[i], &course_arc[i]);
+            float len = roadarc_get_dist(&course_arc[i], (float)(course_size[i] - 3));
+            for (int kind = 0; kind < MODEL_MAX; kind++)
+                motion_build(&course_motion[i][kind], &course_curve[i], len, spd_max * ((kind == 1) ? 0.7 : 1.0));
+        }
+        roadmesh_upload(&course_mesh[i]);
+    }
+}
+
+// draw roads and trees of all views
+void draw_courses(int num)
+{
+    if (road_path == ROAD_PATH_TILES && tile_ready)
+    {
+        draw_courses_tiles(num);
+        mark_stage(FRAMESTAT_ROADS);
+        return;
+    }
+
+    if (road_path == ROAD_PATH_MESH || road_path == ROAD_PATH_TILES)
+    {
+        // static geometry. layer by layer, views sorted by course
+        const ROADMESH *bound = NULL;
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        for (int layer = 0; layer < ROADMESH_LAYER_MAX; layer++)
+        {
+            if (!use_layer(layer))
+                continue;
+            draw_course_mesh(layer, num, &bound);
+            mark_stage((layer == ROADMESH_TREE) ? FRAMESTAT_TREES : FRAMESTAT_ROADS);
+        }
+        roadmesh_unbind();
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        return;
+    }
+
+    // make polygons on CPU
+    EMIT_FUNC emit_roads = (road_path == ROAD_PATH_BATCH) ? draw_roads : roads_immediate[road_parts];
+    for (int n = 0; n < view_num; n++)
+    {
+        set_view(course_order[n]);
+        if (gw.fadev >= 1.0)
+            continue;
+
+        double xb, yb;
+        get_center_pos(&xb, &yb);
+        set_scene_matrix();
+
+        int i = static_cast<int>(gw.idx);
+        emit_roads(i, num, xb, yb);
+        mark_stage(FRAMESTAT_ROADS);
+        draw_trees(i, num, xb, yb);
+        mark_stage(FRAMESTAT_TREES);
+    }
+}
+
+// draw one layer of static geometry on all views
+// all layers share one array, so bound mesh is kept between layers
+void draw_course_mesh(int layer, int num, const ROADMESH **bound)
+{
+    for (int n = 0; n < view_num; n++)
+    {
+        set_view(course_order[n]);
+        if (gw.fadev >= 1.0)
+            continue;
+
+        // set arrays only when course changes
+        const ROADMESH *m = &course_mesh[gw.course_num];
+        if (m != *bound)
+        {
+            roadmesh_bind(m);
+            *bound = m;
+        }
+
+        double xb, yb;
+        get_center_pos(&xb, &yb);
+        set_scene_matrix();
+        glTranslated(m->ox - xb, 0.0, -m->oy - yb);
+        if (layer == ROADMESH_TREE && (use_painter() || get_tree_step() > 1))
+            draw_trees_idx(m, gw.stage_color_num, static_cast<int>(gw.idx), num, get_tree_step(), use_painter());
+        else
+            roadmesh_draw(m, layer, gw.stage_color_num, static_cast<int>(gw.idx), num, get_view_lod(m));
+    }
+}
+
+int use_painter(void)
+{
+    return painter && (road_path == ROAD_PATH_MESH || render_backend != RENDER_FIXED);
+}
+
+// layer of static geometry is drawn. shadows and white lines are optional
+int use_layer(int layer)
+{
+    if (layer == ROADMESH_SHADOW)
+        return road_parts & ROADBATCH_SHADOW;
+    if (layer == ROADMESH_LINE)
+        return road_parts & ROADBATCH_LINE;
+    return 1;
+}
+
+// every step-th tree of static geometry, from far to near if sorted. arrays of mesh are bound
+void draw_trees_idx(const ROADMESH *m, int stg, int idx, int num, int step, int sorted)
+{
+    int t0, t1;
+    roadmesh_get_tree_range(m, idx, num, &t0, &t1);
+    if (t1 <= t0)
+        return;
+
+    int size = sizeof(unsigned int) * (t1 - t0) * 3;
+    int ofs;
+    unsigned int *ip = (stream_ring.buf != 0) ? (unsigned int *)glring_alloc(&stream_ring, size, 4, &ofs) : NULL;
+    if (ip)
+    {
+        // index buffer of this frame, then index buffer of mesh again
+        int n = roadmesh_get_tree_idx(m, stg, t0, t1, step, sorted, ip);
+        glring_flush(&stream_ring, ofs, size);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, stream_ring.buf);
+        glDrawElements(GL_TRIANGLES, n, GL_UNSIGNED_INT, (const void *)(size_t)ofs);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+        return;
+    }
+
+    if (render_backend == RENDER_CORE)
+    {
+        // no client side arrays. depth order and density of trees are lost
+        roadmesh_draw(m, ROADMESH_TREE, stg, idx, num, 0);
+        return;
+    }
+
+    if (size > tree_idx_buf_size)
+    {
+        tree_idx_buf = (unsigned int *)realloc(tree_idx_buf, size);
+        tree_idx_buf_size = size;
+    }
+    int n = roadmesh_get_tree_idx(m, stg, t0, t1, step, sorted, tree_idx_buf);
+    if (m->ibo != 0)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glDrawElements(GL_TRIANGLES, n, GL_UNSIGNED_INT, tree_idx_buf);
+    if (m->ibo != 0)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+}
+
+// radius of model around its origin (world unit)
+float get_model_radius(int kind)
+{
+    if (model_radius[kind] > 0.0)
+        return model_radius[kind];
+
+    float r = 0.0;
+    for (int i = 0; i < models[kind].vtx_size; i++)
+    {
+        const float *v = &models[kind].vtx[i * 3];
+        float d = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        if (d > r)
+            r = d;
+    }
+    model_radius[kind] = r * models[kind].scale;
+    return model_radius[kind];
+}
+
+// clear depth of screen rect around player of each view.
+// vehicles of traffic are anywhere, so whole view is cleared
+void clear_vehicle_depth(void)
+{
+    for (int k = 0; k < view_num; k++)
+    {
+        set_view(k);
+        if (gw.fadev >= 1.0)
+            continue;
+        if (traffic_num > 0)
+        {
+            glClear(GL_DEPTH_BUFFER_BIT);
+            continue;
+        }
+
+        // position on screen. 30 degree tilt of set_scene_matrix()
+        double xb, yb;
+        float p[4];
+        get_center_pos(&xb, &yb);
+        get_car_pos(xb, yb, p);
+        double sx = p[0];
+        double sy = p[1] * cos(deg2rad(30.0)) - p[2] * sin(deg2rad(30.0));
+        double px_per_unit = gw.scrh / (gw.view_h * 2.0);
+        double cx = gw.vx + (sx + gw.view_w) * px_per_unit;
+        double cy = gw.vy + (sy + gw.view_h) * px_per_unit;
+        double r = get_model_radius(gw.model_kind) * px_per_unit + 2.0;
+
+        int x0 = (int)floor(cx - r);
+        int y0 = (int)floor(cy - r);
+        int x1 = (int)ceil(cx + r);
+        int y1 = (int)ceil(cy + r);
+        if (x0 < gw.vx)
+            x0 = gw.vx;
+        if (y0 < gw.vy)
+            y0 = gw.vy;
+        if (x1 > gw.vx + gw.scrw)
+            x1 = gw.vx + gw.scrw;
+        if (y1 > gw.vy + gw.scrh)
+            y1 = gw.vy + gw.scrh;
+        if (x1 <= x0 || y1 <= y0)
+            continue;
+
+        glScissor(x0, y0, x1 - x0, y1 - y0);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glScissor(gw.vx, gw.vy, gw.scrw, gw.scrh);
+    }
+}
+
+// draw static course of all views from tile cache.
+// vehicles are drawn over tiles, they are not hidden by trees
+void draw_courses_tiles(int num)
+{
+    static int level[VIEW_MAX];
+    static int ready[VIEW_MAX];
+    double u0, v0, u1, v1;
+
+    tilecache_begin_frame();
+
+    // make tiles of visible area
+    for (int n = 0; n < view_num; n++)
+    {
+        int k = course_order[n];
+        gw_cur = &gw_views[k];
+        ready[k] = 0;
+        if (gw.fadev >= 1.0)
+            continue;
+
+        level[k] = tilecache_get_level(gw.scrh, gw.view_h);
+        get_tile_rect(gw.idx, &u0, &v0, &u1, &v1);
+        ready[k] = (tilecache_prepare(gw.course_num, gw.stage_color_num, level[k], u0, v0, u1, v1, NULL) == 0);
+    }
+
+    // prefetch tiles of upcoming path
+    int budget = TILE_PREFETCH_MAX;
+    for (int n = 0; n < view_num && budget > 0; n++)
+    {
+        int k = course_order[n];
+        gw_cur = &gw_views[k];
+        if (!ready[k])
+            continue;
+
+        float ahead = roadarc_get_idx(&course_arc[gw.course_num], gw.dist + TILE_AHEAD);
+        get_tile_rect(ahead, &u0, &v0, &u1, &v1);
+        tilecache_prepare(gw.course_num, gw.stage_color_num, level[k], u0, v0, u1, v1, &budget);
+    }
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    for (int n = 0; n < view_num; n++)
+    {
+        int k = course_order[n];
+        set_view(k);
+        if (gw.fadev >= 1.0)
+            continue;
+
+        double xb, yb;
+        get_center_pos(&xb, &yb);
+
+        if (ready[k])
+        {
+            // ortho without tilt. x, y are on projected plane
+            glMatrixMode(GL_PROJECTION);
+            glLoadIdentity();
+            glOrtho(-gw.view_w, gw.view_w, -gw.view_h, gw.view_h, -1.0, 1.0);
+            glMatrixMode(GL_MODELVIEW);
+            glLoadIdentity();
+
+            get_tile_rect(gw.idx, &u0, &v0, &u1, &v1);
+            tilecache_draw(gw.course_num, gw.stage_color_num, level[k], u0, v0, u1, v1,
+                           xb, -yb * sin(deg2rad(30.0)));
+            continue;
+        }
+
+        // tile cache is full. static geometry
+        const ROADMESH *m = &course_mesh[gw.course_num];
+        roadmesh_bind(m);
+        set_scene_matrix();
+        glTranslated(m->ox - xb, 0.0, -m->oy - yb);
+        for (int layer = 0; layer < ROADMESH_LAYER_MAX; layer++)
+            if (use_layer(layer))
+                roadmesh_draw(m, layer, gw.stage_color_num, static_cast<int>(gw.idx), num, get_view_lod(m));
+        roadmesh_unbind();
+    }
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+// draw segments around tile. called by tile cache, (x, 0, z) is center of tile
+void draw_tile(int course, int stg, double x, double z, double size)
+{
+    const ROADMESH *m = &course_mesh[course];
+    const ROADDATA *roads = course_data[course];
+
+    glClearColor(clear_colors[stg][0], clear_colors[stg][1], clear_colors[stg][2], 1.0);
+    glClearDepth(1.0);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // ground point (x, -y) is at (x, y * sin30) of projected plane
+    double s = sin(deg2rad(30.0));
+    double vc = -z * s;
+    double r = size * 0.5 + TILE_MARGIN;
+    int s0 = m->roads_len;
+    int s1 = -1;
+    for (int i = 0; i < m->roads_len; i++)
+    {
+        const ROADDATA *d = &roads[i];
+        if ((fabs(d->cx - x) < r && fabs(d->cy * s - vc) < r)
+            || (d->tfg != 0 && fabs(d->tx - x) < r && fabs(d->ty * s - vc) < r))
+        {
+            if (i < s0)
+                s0 = i;
+            s1 = i;
+        }
+    }
+    if (s1 < 0)
+        return;
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    roadmesh_bind(m);
+    int lod = road_lod ? roadmesh_get_lod(m, size / TILECACHE_PX) : 0;
+    glTranslated(m->ox - x, 0.0, -m->oy - z);
+    for (int layer = 0; layer < ROADMESH_LAYER_MAX; layer++)
+        if (use_layer(layer))
+            roadmesh_draw(m, layer, stg, (s0 + s1) / 2, (s1 - s0) / 2 + 2, lod);
+    roadmesh_unbind();
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+// visible area of current view on projected plane (x, y * cos30 - z * sin30),
+// when player is at road index idx
+void get_tile_rect(float idx, double *u0, double *v0, double *u1, double *v1)
+{
+    double xb, yb;
+    get_center_pos_at(idx, &xb, &yb);
+    double cv = -yb * sin(deg2rad(30.0));
+    *u0 = xb - gw.view_w;
+    *u1 = xb + gw.view_w;
+    *v0 = cv - gw.view_h;
+    *v1 = cv + gw.view_h;
+}
+
+// draw cars of all views. views sorted by model
+void draw_cars(void)
+{
+    int bound = -1;
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    // glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    for (int n = 0; n < view_num; n++)
+    {
+        set_view(model_order[n]);
+        if (gw.fadev >= 1.0)
+            continue;
+
+        if (gw.model_kind != bound)
+        {
+            set_obj_pointer(gw.model_kind);
+            bound = gw.model_kind;
+        }
+
+        double xb, yb;
+        float p[4];
+        get_center_pos(&xb, &yb);
+        set_scene_matrix();
+        get_car_pos(xb, yb, p);
+        glTranslatef(p[0], p[1], p[2]);
+        glRotatef(p[3], 0, 1, 0);
+
+        float scale = models[gw.model_kind].scale;
+        glScalef(scale, scale, scale);
+
+        draw_obj();
+    }
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    // glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+// draw vehicles of traffic on all views. bind arrays once per model
+void draw_traffic(int num)
+{
+    if (traffic_num <= 0)
+        return;
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    for (int kind = 0; kind < MODEL_MAX; kind++)
+    {
+        set_obj_pointer(kind);
+        float scale = models[kind].scale;
+
+        for (int n = 0; n < view_num; n++)
+        {
+            set_view(model_order[n]);
+            if (gw.fadev >= 1.0)
+                continue;
+
+            const TRAFFIC *t = &traffic[gw.id];
+            double xb, yb;
+            get_center_pos(&xb, &yb);
+            set_scene_matrix();
+
+            for (int v = 0; v < t->num; v++)
+            {
+                float p[4];
+                if (t->kind[v] != kind || !get_traffic_pos(t, v, num, xb, yb, p))
+                    continue;
+
+                glPushMatrix();
+                glTranslatef(p[0], p[1], p[2]);
+                glRotatef(p[3], 0, 1, 0);
+                glScalef(scale, scale, scale);
+                glDrawArrays(GL_TRIANGLES, 0, models[kind].vtx_size);
+                glPopMatrix();
+            }
+        }
+    }
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+// get position and direction (x, y, z, degree) of player on current view
+int get_car_pos(double xb, double yb, float *p)
+{
+    double x, z;
+    get_road_pos(gw.idx, 0.75, &x, &z);
+    p[0] = x - xb;
+    p[1] = 5.1;
+    p[2] = -z - yb;
+    p[3] = get_road_vec(gw.idx) + 90.0;
+    return 1;
+}
+
+// get position and direction of vehicle v. return 0 if out of current view
+int get_traffic_pos(const TRAFFIC *t, int v, int num, double xb, double yb, float *p)
+{
+    if (!traffic_is_on_course(t, v) || fabsf(t->idx[v] - gw.idx) > num)
+        return 0;
+
+    double x, y, z;
+    get_road_pos(t->idx[v], t->ofs[v], &x, &z);
+    x = x - xb;
+    z = -z - yb;
+    y = 5.1;
+
+    // visible area. scene is tilted 30 degree
+    double wmax = gw.view_w + TRAFFIC_CULL_MARGIN;
+    double hmax = gw.view_h + TRAFFIC_CULL_MARGIN;
+    if (fabs(x) > wmax || fabs(y * 0.866 - z * 0.5) > hmax)
+        return 0;
+
+    p[0] = x;
+    p[1] = y;
+    p[2] = z;
+    p[3] = traffic_get_angle(&course_curve[gw.course_num], t->idx[v], t->lane[v]) + 90.0;
+    return 1;
+}
+
+// ----------------------------------------
+// shader renderer
+
+// make shaders and buffers of glcore. return 0 if not supported
+int init_core(void)
+{
+    if (!glcore_init(&stream_ring))
+        return 0;
+
+    for (int kind = 0; kind < MODEL_MAX; kind++)
+        glcore_add_model(kind, models[kind].vtx_size, models[kind].vtx, models[kind].nml, models[kind].col);
+
+    for (int kind = 0; kind < GL_FONT_MAX; kind++)
+        glcore_add_font(kind, fontdatatbl[kind].width, fontdatatbl[kind].height,
+                        fontdatatbl[kind].chrlen, fontdatatbl[kind].adrs);
+
+    for (int i = 0; i < COURSE_MAX; i++)
+        glcore_add_course(&course_mesh[i]);
+
+    for (int stg = 0; stg < STG_MAX; stg++)
+    {
+        float pal[ROADMESH_PAL_MAX][4];
+        memcpy(pal[ROADMESH_PAL_SHADOW], road_shadow_col, sizeof(float) * 4);
+        memcpy(pal[ROADMESH_PAL_ROAD], road_cols[0], sizeof(float) * 4);
+        memcpy(pal[ROADMESH_PAL_ROAD + 1], road_cols[1], sizeof(float) * 4);
+        memcpy(pal[ROADMESH_PAL_LINE], road_line_col, sizeof(float) * 4);
+        memcpy(pal[ROADMESH_PAL_TREE], tree_cols[stg], sizeof(float) * 4 * ROADMESH_TREE_COL_MAX);
+        memcpy(pal[ROADMESH_PAL_LOD], road_lod_col, sizeof(float) * 4);
+        glcore_set_palette(stg, pal);
+    }
+    return 1;
+}
+
+// draw roads and trees of all views. layer by layer, views sorted by course
+void draw_courses_core(int num)
+{
+    for (int layer = 0; layer < ROADMESH_LAYER_MAX; layer++)
+    {
+        if (!use_layer(layer))
+            continue;
+        const ROADMESH *bound = NULL;
+        for (int n = 0; n < view_num; n++)
+        {
+            set_view(course_order[n]);
+            if (gw.fadev >= 1.0)
+                continue;
+
+            const ROADMESH *m = &course_mesh[gw.course_num];
+            if (m != bound)
+            {
+                glcore_bind_course(m);
+                bound = m;
+            }
+
+            double xb, yb;
+            get_center_pos(&xb, &yb);
+            glcore_set_view(gw.id, gw.stage_color_num);
+            glcore_set_course_pos(m->ox - xb, 0.0, -m->oy - yb);
+
+            // trees get color of stage from palette
+            if (layer == ROADMESH_TREE && (painter || get_tree_step() > 1))
+                draw_trees_idx(m, 0, static_cast<int>(gw.idx), num, get_tree_step(), painter);
+            else
+                roadmesh_draw(m, layer, 0, static_cast<int>(gw.idx), num, get_view_lod(m));
+        }
+        mark_stage((layer == ROADMESH_TREE) ? FRAMESTAT_TREES : FRAMESTAT_ROADS);
+    }
+}
+
+// draw player and traffic of all views. one upload of instance data per frame
+void draw_vehicles_core(int num)
+{
+    static int first[MODEL_MAX][VIEW_MAX];
+    static int count[MODEL_MAX][VIEW_MAX];
+
+    // written to ring buffer directly. ring grows at next frame if it is full
+    GLCOREINST *inst = glcore_map_instances(view_num * (traffic_num + 1));
+    if (inst == NULL)
+        return;
+
+    int n_inst = 0;
+    for (int kind = 0; kind < MODEL_MAX; kind++)
+    {
+        for (int n = 0; n < view_num; n++)
+        {
+            int k = model_order[n];
+            gw_cur = &gw_views[k];
+            first[kind][k] = n_inst;
+            count[kind][k] = 0;
+            if (gw.fadev >= 1.0)
+                continue;
+
+            double xb, yb;
+            get_center_pos(&xb, &yb);
+
+            if (gw.model_kind == kind)
+                get_car_pos(xb, yb, &inst[n_inst++].x);
+
+            const TRAFFIC *t = &traffic[gw.id];
+            if (traffic_num > 0)
+            {
+                for (int v = 0; v < t->num; v++)
+                {
+                    if (t->kind[v] == kind && get_traffic_pos(t, v, num, xb, yb, &inst[n_inst].x))
+                        n_inst++;
+                }
+            }
+            count[kind][k] = n_inst - first[kind][k];
+        }
+    }
 
-    // get index
-    int i = static_cast<int>(gw.idx);
-    double frac = gw.idx - static_cast<double>(i);
+    glcore_unmap_instances(n_inst);
 
-    // get center position
-    double xb, yb;
-    if (i < gw.roads_len - 1)
+    for (int kind = 0; kind < MODEL_MAX; kind++)
     {
-        double x0, y0, x1, y1;
-        x0 = gw.roads[i].cx;
-        y0 = gw.roads[i].cy;
-        x1 = gw.roads[i + 1].cx;
-        y1 = gw.roads[i + 1].cy;
-        xb = x0 + (x1 - x0) * frac;
-        yb = -(y0 + (y1 - y0) * frac);
+        for (int n = 0; n < view_num; n++)
+        {
+            int k = model_order[n];
+            if (count[kind][k] <= 0)
+                continue;
+            set_view(k);
+            glcore_set_view(gw.id, gw.stage_color_num);
+            glcore_draw_model(kind, models[kind].scale, first[kind][k], count[kind][k]);
+        }
     }
-    else
+}
+
+// ----------------------------------------
+// software renderer
+
+// start worker threads and framebuffers. called at first frame of RENDER_SOFT
+void init_soft(void)
+{
+    workers_init(&soft_workers, soft_threads, SOFT_QUEUE_MAX);
+    softrast_init(&soft, &soft_workers);
+    softrast_init(&soft_scene, &soft_workers);
+    soft_ready = 1;
+}
+
+void free_soft(void)
+{
+    if (!soft_ready)
+        return;
+    softrast_free(&soft);
+    softrast_free(&soft_scene);
+    workers_free(&soft_workers);
+    soft_cur = &soft;
+    soft_ready = 0;
+}
+
+// same order as draw_gl(). scene at render scale, text at window resolution
+void draw_gl_soft(float delta)
+{
+    sort_views();
+    if (!soft_ready)
+        init_soft();
+
+    int sw, sh;
+    int scaled = get_render_size(&sw, &sh);
+    softrast_begin(&soft, Width, Height);
+    soft_cur = &soft;
+    if (scaled)
     {
-        double x0, y0;
-        x0 = gw.roads[i].cx;
-        y0 = gw.roads[i].cy;
-        xb = x0;
-        yb = -y0;
+        softrast_begin(&soft_scene, sw, sh);
+        soft_cur = &soft_scene;
+        layout_views(sw, sh);
     }
 
-    if (gw.fadev < 1.0)
+    // clear each view. courses of painter's order do not test depth
+    for (int k = 0; k < view_num; k++)
     {
-        // draw roads and trees
-        glPushMatrix();
+        set_soft_view(k);
+        float col[4] = {0.0, 0.0, 0.0, 1.0};
+        if (gw.fadev < 1.0)
+            memcpy(col, clear_colors[gw.stage_color_num], sizeof(float) * 3);
+        softrast_clear(soft_cur, SOFTRAST_COLOR | SOFTRAST_DEPTH, col, 1.0);
+    }
+
+    // same light as set_scene_state(). ambient of light and default ambient of scene
+    const float light_dir[3] = {1.0, 1.0, 1.0};
+    softrast_set_light(soft_cur, light_dir, 0.7, 1.0);
 
-        glRotatef(30, 1, 0, 0);
-        int disp_num = 600;
-        draw_roads(i, disp_num, xb, yb);
-        draw_trees(i, disp_num, xb, yb);
+    int disp_num = quality_get_level(quality.level)->disp_num;
+    draw_courses_soft(disp_num);
+    draw_vehicles_soft(disp_num);
 
-        // draw car
+    // each tile stays in cache from clear to vehicles
+    softrast_flush(soft_cur);
+    mark_stage(FRAMESTAT_MODEL);
+    prim_count = soft_cur->tris;
+
+    for (int k = 0; k < view_num; k++)
+    {
+        set_soft_view(k);
+        if (gw.fadev > 0.0)
         {
-            double x, y, z;
-            float road_angle, scale;
+            float col[4] = {0.0, 0.0, 0.0, (gw.fadev < 1.0) ? gw.fadev : 1.0f};
+            softrast_fill(soft_cur, col);
+        }
+    }
 
-            get_road_pos(gw.idx, 0.75, &x, &z);
-            x = x - xb;
-            z = -z - yb;
-            y = 5.1;
-            glTranslatef(x, y, z);
+    if (scaled)
+    {
+        softrast_flush(&soft_scene);
+        layout_views(Width, Height);
+        soft_cur = &soft;
+
+        // window size may not be a multiple of grid
+        int w = (Width / wall_cols) * wall_cols;
+        int h = (Height / wall_rows) * wall_rows;
+        softrast_set_view(&soft, 0, Height - h, w, h);
+        softrast_stretch(&soft, soft_scene.color, sw, sh, 0, Height - h, w, h);
+    }
 
-            road_angle = get_road_vec(gw.idx);
-            glRotatef(road_angle + 90.0, 0, 1, 0);
+    for (int k = 0; k < view_num; k++)
+    {
+        set_soft_view(k);
+        draw_course_name(delta);
+    }
 
-            scale = models[gw.model_kind].scale;
-            glScalef(scale, scale, scale);
+    // whole window
+    gw_cur = &gw_views[0];
+    softrast_set_view(&soft, 0, 0, Width, Height);
 
-            draw_obj();
-        }
+    if (fps_display != 0)
+        draw_fps();
+    if (frame_graph)
+        draw_frame_graph();
 
-        glPopMatrix();
-    }
+    softrast_flush(&soft);
+    present_soft();
+    mark_stage(FRAMESTAT_OVERLAY);
+}
 
-    glLoadIdentity();
+// draw framebuffer of software renderer to window
+void present_soft(void)
+{
+    glViewport(0, 0, Width, Height);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_TEXTURE_2D);
 
-    // reset ortho
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
-    glOrtho(-1.0, 1.0, -1.0, 1.0, -gw.zfar, gw.zfar);
-
+    glOrtho(0.0, Width, 0.0, Height, -1.0, 1.0);
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
 
-    glDisable(GL_LIGHTING);
-    glDisable(GL_LIGHT0);
-    glDisable(GL_COLOR_MATERIAL);
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_TEXTURE_2D);
+    glRasterPos3f(0.0, 0.0, 0.0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glDrawPixels(soft.w, soft.h, GL_RGBA, GL_UNSIGNED_BYTE, soft.color);
+}
+
+void set_soft_view(int k)
+{
+    gw_cur = &gw_views[k];
+    softrast_set_view(soft_cur, gw.vx, gw.vy, gw.scrw, gw.scrh);
+}
 
-    draw_fadeout(gw.fadev);
+// same as set_scene_matrix()
+void set_soft_scene_matrix(void)
+{
+    softrast_set_ortho(soft_cur, gw.view_w, gw.view_h, gw.zfar);
+    softrast_load_identity(soft_cur);
+    softrast_rotate(soft_cur, 30, 1, 0, 0);
+}
 
-    draw_course_name(delta);
+// roads and trees of all views, layer by layer. only binned, tiles are rasterised with vehicles
+void draw_courses_soft(int num)
+{
+    softrast_set_state(soft_cur, 1, !use_painter(), 1);
 
-    if (fps_display != 0)
-        draw_fps();
+    for (int layer = 0; layer < ROADMESH_LAYER_MAX; layer++)
+    {
+        if (!use_layer(layer))
+            continue;
+        for (int n = 0; n < view_num; n++)
+        {
+            set_soft_view(course_order[n]);
+            if (gw.fadev >= 1.0)
+                continue;
+
+            const ROADMESH *m = &course_mesh[gw.course_num];
+            double xb, yb;
+            get_center_pos(&xb, &yb);
+            set_soft_scene_matrix();
+            softrast_translate(soft_cur, m->ox - xb, 0.0, -m->oy - yb);
+
+            int idx = static_cast<int>(gw.idx);
+            if (layer == ROADMESH_TREE && (use_painter() || get_tree_step() > 1))
+            {
+                int t0, t1;
+                roadmesh_get_tree_range(m, idx, num, &t0, &t1);
+                int size = sizeof(unsigned int) * (t1 - t0) * 3;
+                if (size > tree_idx_buf_size)
+                {
+                    tree_idx_buf = (unsigned int *)realloc(tree_idx_buf, size);
+                    tree_idx_buf_size = size;
+                }
+                int cnt = roadmesh_get_tree_idx(m, gw.stage_color_num, t0, t1, get_tree_step(), use_painter(), tree_idx_buf);
+                softrast_draw_idx(soft_cur, SOFTRAST_TRIANGLES, m->vtx, NULL, m->col, tree_idx_buf, cnt);
+                continue;
+            }
+
+            ROADMESH_RANGE r;
+            if (!roadmesh_get_range(m, layer, gw.stage_color_num, idx, num, get_view_lod(m), &r))
+                continue;
+            int mode = (r.strip) ? SOFTRAST_TRIANGLE_STRIP : SOFTRAST_TRIANGLES;
+            if (r.idx)
+                softrast_draw_idx(soft_cur, mode, m->vtx, NULL, m->col, r.idx, r.count);
+            else
+                softrast_draw(soft_cur, mode, m->vtx, NULL, m->col, r.first, r.count);
+        }
+
+        mark_stage((layer == ROADMESH_TREE) ? FRAMESTAT_TREES : FRAMESTAT_ROADS);
+    }
+}
+
+// player and traffic of all views
+void draw_vehicles_soft(int num)
+{
+    softrast_set_state(soft_cur, 1, 1, 1);
+
+    for (int n = 0; n < view_num; n++)
+    {
+        set_soft_view(model_order[n]);
+        if (gw.fadev >= 1.0)
+            continue;
+
+        double xb, yb;
+        float p[4];
+        get_center_pos(&xb, &yb);
+        get_car_pos(xb, yb, p);
+        draw_model_soft(gw.model_kind, p);
+
+        if (traffic_num <= 0)
+            continue;
+        const TRAFFIC *t = &traffic[gw.id];
+        for (int v = 0; v < t->num; v++)
+        {
+            if (get_traffic_pos(t, v, num, xb, yb, p))
+                draw_model_soft(t->kind[v], p);
+        }
+    }
+}
+
+// model at position and direction p (x, y, z, degree)
+void draw_model_soft(int kind, const float *p)
+{
+    set_soft_scene_matrix();
+    softrast_translate(soft_cur, p[0], p[1], p[2]);
+    softrast_rotate(soft_cur, p[3], 0, 1, 0);
+    softrast_scale(soft_cur, models[kind].scale);
+    softrast_draw(soft_cur, SOFTRAST_TRIANGLES, models[kind].vtx, models[kind].nml, models[kind].col,
+                  0, models[kind].vtx_size);
 }
 
+// same position as glRasterPos3f() on overlay matrix and glBitmapFontDrawString()
+void draw_text_soft(const char *buf, float x, float y, int kind, float c, float a)
+{
+    const float col[4] = {c, c, c, a};
+    unsigned int pc = softrast_pack_col(col);
+    int w = fontdatatbl[kind].width;
+    int h = fontdatatbl[kind].height;
+    float wx = soft_cur->vx + (x + 1.0) * 0.5 * soft_cur->vw;
+    float wy = soft_cur->vy + (y + 1.0) * 0.5 * soft_cur->vh;
+
+    for (int i = 0; buf[i] != 0; i++)
+    {
+        int ch = (unsigned char)buf[i];
+        if (ch < 0x20 || ch > 0x7f)
+            ch = 0x20;
+        const unsigned char *bits = fontdatatbl[kind].adrs + fontdatatbl[kind].chrlen * (ch - 0x20);
+        softrast_bitmap(soft_cur, (int)floor(wx), (int)floor(wy), w, h, bits, pc);
+        wx += w;
+    }
+}
+
+// make quads of segments by batch kernel, and draw them at once
 void draw_roads(int i, int n, double xb, double yb)
 {
-    int nmax;
-    double px0, py0, px1, py1;
-    double lx0, ly0, lx1, ly1;
+    int s0, s1;
+    const ROADMESH *m = &course_mesh[gw.course_num];
+    roadmesh_get_seg_range(m, i, n, &s0, &s1);
+    if (roadbatch_build(&road_batch, m, s0, s1, xb, yb, road_parts) <= 0)
+        return;
 
-    px0 = 0.0;
-    py0 = 0.0;
-    px1 = 0.0;
-    py1 = 0.0;
-    lx0 = 0.0;
-    ly0 = 0.0;
-    lx1 = 0.0;
-    ly1 = 0.0;
+    int vsize = sizeof(float) * 3 * road_batch.num;
+    int csize = sizeof(float) * 4 * road_batch.num;
+    int ofs;
+    unsigned char *p = (unsigned char *)glring_alloc(&stream_ring, vsize + csize, 16, &ofs);
 
-    nmax = gw.roads_len;
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    if (p)
+    {
+        // ring buffer. no copy by driver
+        memcpy(p, road_batch.vtx, vsize);
+        memcpy(p + vsize, road_batch.col, csize);
+        glring_flush(&stream_ring, ofs, vsize + csize);
+        glBindBuffer(GL_ARRAY_BUFFER, stream_ring.buf);
+        glVertexPointer(3, GL_FLOAT, 0, (const void *)(size_t)ofs);
+        glColorPointer(4, GL_FLOAT, 0, (const void *)(size_t)(ofs + vsize));
+    }
+    else
+    {
+        glVertexPointer(3, GL_FLOAT, 0, road_batch.vtx);
+        glColorPointer(4, GL_FLOAT, 0, road_batch.col);
+    }
+    glDrawArrays(GL_QUADS, 0, road_batch.num);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    if (p)
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
 
-    glBegin(GL_QUADS);
+// quads between road data p and c. EVEN : band of c is even, it has white line
+template <int PARTS, int EVEN>
+inline void draw_seg_immediate(const ROADDATA *p, const ROADDATA *c, double xb, double yb)
+{
+    double px0, py0, px1, py1;
+    double px2, py2, px3, py3;
+    double z;
+
+    // get road edge
+    px0 = p->rx0 - xb;
+    px1 = p->rx1 - xb;
+    py0 = -(p->ry0) - yb;
+    py1 = -(p->ry1) - yb;
+    px2 = c->rx0 - xb;
+    px3 = c->rx1 - xb;
+    py2 = -(c->ry0) - yb;
+    py3 = -(c->ry1) - yb;
+
+    // draw shadow polygon
+    if (PARTS & ROADBATCH_SHADOW)
+    {
+        glColor4f(0.2, 0.2, 0.2, 1);
+        z = 0.0;
+        glVertex3d(px0, z, py0);
+        glVertex3d(px1, z, py1);
+        glVertex3d(px3, z, py3);
+        glVertex3d(px2, z, py2);
+    }
 
-    for (int j = -n; j < n; j++)
+    // draw road polygon
+    if (EVEN)
+        glColor4f(0.3, 0.4, 0.45, 1);
+    else
+        glColor4f(0.35, 0.45, 0.50, 1);
+    z = 5.0;
+    glVertex3d(px0, z, py0);
+    glVertex3d(px1, z, py1);
+    glVertex3d(px3, z, py3);
+    glVertex3d(px2, z, py2);
+
+    // draw white line polygon
+    if ((PARTS & ROADBATCH_LINE) && EVEN)
     {
-        double x0, y0, x1, y1;
-        double px2, py2, px3, py3;
+        double lx0, ly0, lx1, ly1;
         double lx2, ly2, lx3, ly3;
-        int i0, i1;
 
-        i0 = i + j;
-        i1 = i0 + 1;
-        if (i0 < 0 || i1 < 0)
-            continue;
-        if (i0 >= nmax || i1 >= nmax)
-            break;
+        // get white line edge
+        lx0 = p->lx0 - xb;
+        lx1 = p->lx1 - xb;
+        ly0 = -(p->ly0) - yb;
+        ly1 = -(p->ly1) - yb;
+        lx2 = c->lx0 - xb;
+        lx3 = c->lx1 - xb;
+        ly2 = -(c->ly0) - yb;
+        ly3 = -(c->ly1) - yb;
+
+        // z = 5.01;
+        z = 5.1;
+        glColor4f(1.0, 1.0, 1.0, 1.0);
+        glVertex3d(lx0, z, ly0);
+        glVertex3d(lx1, z, ly1);
+        glVertex3d(lx3, z, ly3);
+        glVertex3d(lx2, z, ly2);
+    }
+}
 
-        // get center line position
-        x0 = gw.roads[i0].cx - xb;
-        x1 = gw.roads[i1].cx - xb;
-        y0 = -(gw.roads[i0].cy) - yb;
-        y1 = -(gw.roads[i1].cy) - yb;
+// segments [s, e) of rows in one band
+template <int PARTS, int EVEN>
+void draw_run_immediate(const ROADDATA *rows, int s, int e, double xb, double yb)
+{
+    for (; s < e; s++)
+        draw_seg_immediate<PARTS, EVEN>(&rows[s], &rows[s + 1], xb, yb);
+}
 
-        // get road edge
-        px2 = gw.roads[i0].rx0 - xb;
-        px3 = gw.roads[i0].rx1 - xb;
-        py2 = -(gw.roads[i0].ry0) - yb;
-        py3 = -(gw.roads[i0].ry1) - yb;
+// per vertex version of draw_roads(). PARTS = ROADBATCH_SHADOW | ROADBATCH_LINE
+template <int PARTS>
+void draw_roads_immediate(int i, int n, double xb, double yb)
+{
+    const ROADMESH *m = &course_mesh[gw.course_num];
 
-        // get white line edge
-        lx2 = gw.roads[i0].lx0 - xb;
-        lx3 = gw.roads[i0].lx1 - xb;
-        ly2 = -(gw.roads[i0].ly0) - yb;
-        ly3 = -(gw.roads[i0].ly1) - yb;
+    // quads end at road data [k0, k1]. road data k1 + 1 must exist
+    int k0 = (i - n > 0) ? i - n + 1 : 1;
+    int k1 = (i + n - 1 < gw.roads_len - 2) ? i + n - 1 : gw.roads_len - 2;
 
-        // draw polygons
-        if (px0 != 0.0 && py0 != 0.0)
-        {
-            double z;
-
-            // draw shadow polygon
-            glColor4f(0.2, 0.2, 0.2, 1);
-            z = 0.0;
-            glVertex3d(px0, z, py0);
-            glVertex3d(px1, z, py1);
-            glVertex3d(px3, z, py3);
-            glVertex3d(px2, z, py2);
-
-            // draw road polygon
-            if (i0 % 2 == 0)
-            {
-                glColor4f(0.3, 0.4, 0.45, 1);
-            }
-            else
-            {
-                glColor4f(0.35, 0.45, 0.50, 1);
-            }
-            z = 5.0;
-            glVertex3d(px0, z, py0);
-            glVertex3d(px1, z, py1);
-            glVertex3d(px3, z, py3);
-            glVertex3d(px2, z, py2);
-
-            // draw white line polygon
-            if (i0 % 2 == 0)
-            {
-                // z = 5.01;
-                z = 5.1;
-                glColor4f(1.0, 1.0, 1.0, 1.0);
-                glVertex3d(lx0, z, ly0);
-                glVertex3d(lx1, z, ly1);
-                glVertex3d(lx3, z, ly3);
-                glVertex3d(lx2, z, ly2);
-            }
-        }
+    // segments [s, s1) of rows, in runs of one band as roadbatch_build()
+    int s = m->row_ofs[k0 - 1];
+    int s1 = m->row_ofs[k1];
+    if (s1 <= s)
+        return;
 
-        px0 = px2;
-        py0 = py2;
-        px1 = px3;
-        py1 = py3;
-        lx0 = lx2;
-        ly0 = ly2;
-        lx1 = lx3;
-        ly1 = ly3;
+    glBegin(GL_QUADS);
+    int k = roadmesh_get_band(m, s);
+    if (k & 1)
+    {
+        int e = roadmesh_get_band_end(m, k++, s1);
+        draw_run_immediate<PARTS, 0>(m->rows, s, e, xb, yb);
+        s = e;
+    }
+    while (s < s1)
+    {
+        int e = roadmesh_get_band_end(m, k, s1);
+        draw_run_immediate<PARTS, 1>(m->rows, s, e, xb, yb);
+        s = e;
+        e = roadmesh_get_band_end(m, k + 1, s1);
+        draw_run_immediate<PARTS, 0>(m->rows, s, e, xb, yb);
+        s = e;
+        k += 2;
     }
     glEnd();
 }
 
+// every get_tree_step()-th tree only. same trees as static geometry
 void draw_trees(int idx, int num, double xb, double yb)
 {
+    const ROADMESH *m = &course_mesh[gw.course_num];
     int n = gw.stage_color_num;
+    int step = get_tree_step();
+
+    // trees [t0, t1) of mesh, from multiple of step
+    int t0, t1;
+    roadmesh_get_tree_range(m, idx, num, &t0, &t1);
+    t0 = (t0 + step - 1) / step * step;
+
     glBegin(GL_TRIANGLES);
-    for (int a = -num; a < num; a++)
+    for (int t = t0; t < t1; t += step)
     {
-        int i = idx + a;
-        if (i < 0)
-            continue;
-        if (i >= gw.roads_len)
-            break;
-        if (gw.roads[i].tfg == 0)
-            continue;
-
+        int i = m->tree_road[t];
         double x, y, r;
         int c;
         x = gw.roads[i].tx;
@@ -787,26 +2625,18 @@ void draw_trees(int idx, int num, double xb, double yb)
     glEnd();
 }
 
-void draw_obj(void)
+void set_obj_pointer(int kind)
 {
-    // draw vertex array
-
-    glEnableClientState(GL_VERTEX_ARRAY);
-    // glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
-
-    glVertexPointer(3, GL_FLOAT, 0, models[gw.model_kind].vtx);
-    // glTexCoordPointer(2, GL_FLOAT, 0, models[gw.model_kind].uv);
-    glNormalPointer(GL_FLOAT, 0, models[gw.model_kind].nml);
-    glColorPointer(4, GL_FLOAT, 0, models[gw.model_kind].col);
+    glVertexPointer(3, GL_FLOAT, 0, models[kind].vtx);
+    // glTexCoordPointer(2, GL_FLOAT, 0, models[kind].uv);
+    glNormalPointer(GL_FLOAT, 0, models[kind].nml);
+    glColorPointer(4, GL_FLOAT, 0, models[kind].col);
+}
 
+void draw_obj(void)
+{
+    // draw vertex array. arrays are set by set_obj_pointer()
     glDrawArrays(GL_TRIANGLES, 0, models[gw.model_kind].vtx_size);
-
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
-    // glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
 }
 
 double get_road_vec(float idx)
@@ -830,26 +2660,19 @@ double get_road_vec(float idx)
     return angle;
 }
 
-double get_curve_angle(float idx)
+// length of current course for player (world unit). until road index roads_len - 3
+float get_course_len(void)
 {
-    double sumangle = 0.0;
-    double a0 = get_road_vec(idx);
-    for (int i = 0; i < 8; i++)
-    {
-        double a1 = get_road_vec(idx + i + 1);
-        double a = a1 - a0;
-        if (a > 180.0)
-        {
-            a = a1 - (a0 * 360.0);
-        }
-        else if (a < -180.0)
-        {
-            a = (a1 + 360.0) - a0;
-        }
-        sumangle += fabsf(a);
-        a0 = a1;
-    }
-    return sumangle;
+    return roadarc_get_dist(&course_arc[gw.course_num], (float)(gw.roads_len - 3));
+}
+
+// max speed of player (m/s). scooter is slower
+float get_player_spdmax(void)
+{
+    float spdmax = fabsf(gw.spd_add);
+    if (gw.model_kind == 1)
+        spdmax *= 0.7;
+    return spdmax;
 }
 
 void get_road_pos(float idx, float p, double *x, double *y)
@@ -885,7 +2708,10 @@ void get_road_pos(float idx, float p, double *x, double *y)
 void draw_fps(void)
 {
     char buf[512];
-    sprintf(buf, "FPS %d/%d", gw.count_fps, (int)gw.cfg_framerate);
+    if (quality_auto || quality.level < QUALITY_LEVEL_MAX - 1)
+        sprintf(buf, "FPS %d/%d Q%d/%d", gw.count_fps, (int)gw.cfg_framerate, quality.level + 1, QUALITY_LEVEL_MAX);
+    else
+        sprintf(buf, "FPS %d/%d", gw.count_fps, (int)gw.cfg_framerate);
 
     float x, y;
     x = -0.05;
@@ -893,6 +2719,93 @@ void draw_fps(void)
     draw_text(buf, x, y, GL_FONT_PROFONT, 1.0);
 }
 
+// frame times of history and stages of each frame. one draw call
+void draw_frame_graph(void)
+{
+    float w = FRAMESTAT_HIST * 2;
+    float h = FRAME_GRAPH_H;
+    if (w > Width - FRAME_GRAPH_MARGIN * 2)
+        w = Width - FRAME_GRAPH_MARGIN * 2;
+    if (h > Height / 3)
+        h = Height / 3;
+    if (w <= 0 || h <= 0)
+        return;
+
+    int size = sizeof(FRAMEGRAPH_VTX) * FRAMEGRAPH_VTX_MAX;
+    int ofs;
+    FRAMEGRAPH_VTX *v = (stream_ring.buf != 0 && render_backend != RENDER_SOFT)
+                            ? (FRAMEGRAPH_VTX *)glring_alloc(&stream_ring, size, 4, &ofs)
+                            : NULL;
+    if (v == NULL)
+    {
+        // core profile has no client side arrays
+        if (render_backend == RENDER_CORE)
+            return;
+        if (graph_buf == NULL)
+            graph_buf = (FRAMEGRAPH_VTX *)malloc(size);
+        v = graph_buf;
+    }
+
+    int n = framegraph_build(&frame_stat, 1.0 / gw.cfg_framerate, FRAME_GRAPH_MARGIN, FRAME_GRAPH_MARGIN, w, h, v);
+
+    if (render_backend == RENDER_SOFT)
+    {
+        // vertices are pixels of window
+        softrast_set_state(soft_cur, 0, 0, 0);
+        for (int i = 0; i + 2 < n; i += 3)
+        {
+            float p[3][3];
+            for (int k = 0; k < 3; k++)
+            {
+                p[k][0] = v[i + k].x;
+                p[k][1] = v[i + k].y;
+                p[k][2] = 0.0;
+            }
+            unsigned int col;
+            memcpy(&col, v[i + 2].col, sizeof(col));
+            softrast_tri(soft_cur, p[0], p[1], p[2], col);
+        }
+        return;
+    }
+
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    if (render_backend == RENDER_CORE)
+    {
+        glring_flush(&stream_ring, ofs, sizeof(FRAMEGRAPH_VTX) * n);
+        glcore_draw_colored(ofs, n);
+        glDisable(GL_BLEND);
+        return;
+    }
+
+    // pixels of window
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0.0, Width, 0.0, Height, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    const char *p = (const char *)v;
+    if (v != graph_buf)
+    {
+        glring_flush(&stream_ring, ofs, sizeof(FRAMEGRAPH_VTX) * n);
+        glBindBuffer(GL_ARRAY_BUFFER, stream_ring.buf);
+        p = (const char *)(size_t)ofs;
+    }
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(FRAMEGRAPH_VTX), p);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(FRAMEGRAPH_VTX), p + sizeof(float) * 2);
+    glDrawArrays(GL_TRIANGLES, 0, n);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    if (v != graph_buf)
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDisable(GL_BLEND);
+}
+
 void draw_course_name(float delta)
 {
     if (gw.course_name_timer <= 0.0)
@@ -915,6 +2828,12 @@ void draw_text(const char *buf, float x, float y, int kind, float a)
     float z = gw.zfar - 1;
     float c = (gw.stage_color_num == 2) ? 0.0 : 1.0;
 
+    if (render_backend == RENDER_SOFT)
+    {
+        draw_text_soft(buf, x, y, kind, c, a);
+        return;
+    }
+
     glDisable(GL_DEPTH_TEST);
 
     if (a >= 1.0)
@@ -930,20 +2849,86 @@ void draw_text(const char *buf, float x, float y, int kind, float a)
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     }
 
+    if (render_backend == RENDER_CORE)
+    {
+        float col[4] = {c, c, c, a};
+        glcore_draw_text(buf, x, y, kind, col);
+        return;
+    }
+
     // text
     glColor4f(c, c, c, a);
     glRasterPos3f(x, y, z);
     glBitmapFontDrawString(buf, kind);
 }
 
-void draw_fadeout(float a)
+// fragments per pixel of current view from stencil buffer
+void count_overdraw(void)
 {
-    float z = gw.zfar - 2;
+    int n = gw.scrw * gw.scrh;
+    gw.overdraw_avg = 0.0;
+    gw.overdraw_max = 0;
+
+    // OpenGL ES cannot read stencil buffer
+    if (glf_es || n <= 0)
+        return;
+
+    if (n > overdraw_buf_size)
+    {
+        overdraw_buf = (unsigned char *)realloc(overdraw_buf, n);
+        overdraw_buf_size = n;
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(gw.vx, gw.vy, gw.scrw, gw.scrh, GL_STENCIL_INDEX, GL_UNSIGNED_BYTE, overdraw_buf);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    long sum = 0;
+    int max = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int v = overdraw_buf[i];
+        sum += v;
+        if (v > max)
+            max = v;
+    }
+    gw.overdraw_avg = (float)sum / n;
+    gw.overdraw_max = max;
+}
+
+// fill current view with color of each stencil value
+void draw_overdraw(void)
+{
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    if (render_backend != RENDER_CORE)
+        glDisable(GL_TEXTURE_2D);
+
+    glEnable(GL_STENCIL_TEST);
+    glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+    for (int i = 0; i <= OVERDRAW_LEVEL_MAX; i++)
+    {
+        // last level : i <= stencil
+        glStencilFunc((i < OVERDRAW_LEVEL_MAX) ? GL_EQUAL : GL_LEQUAL, i, 0xff);
+        draw_fill(overdraw_cols[i]);
+    }
+    glDisable(GL_STENCIL_TEST);
+}
 
+void draw_overdraw_text(void)
+{
+    char buf[64];
+    sprintf(buf, "overdraw avg %.2f max %d", gw.overdraw_avg, gw.overdraw_max);
+    draw_text(buf, -0.95, 0.8, GL_FONT_PROFONT, 1.0);
+}
+
+void draw_fadeout(float a)
+{
     if (a <= 0.0)
     {
         glDisable(GL_BLEND);
-        glDisable(GL_TEXTURE_2D);
+        if (render_backend != RENDER_CORE)
+            glDisable(GL_TEXTURE_2D);
         return;
     }
 
@@ -958,15 +2943,47 @@ void draw_fadeout(float a)
         glDisable(GL_BLEND);
     }
 
+    float col[4] = {0.0, 0.0, 0.0, a};
+    draw_fill(col);
+    glDisable(GL_BLEND);
+}
+
+// fill current view. blend state is set by caller
+void draw_fill(const float col[4])
+{
+    if (render_backend == RENDER_CORE)
+    {
+        glcore_draw_fill(col);
+        return;
+    }
+
+    float z = gw.zfar - 2;
     float w, h;
     w = 2.0;
     h = 2.0;
-    glColor4f(0.0, 0.0, 0.0, a);
-    glBegin(GL_QUADS);
-    glVertex3f(-w, h, z);
-    glVertex3f(-w, -h, z);
-    glVertex3f(+w, -h, z);
-    glVertex3f(+w, h, z);
-    glEnd();
-    glDisable(GL_BLEND);
+    glColor4fv(col);
+
+    int ofs;
+    float *v = (float *)glring_alloc(&stream_ring, sizeof(float) * 3 * 4, 16, &ofs);
+    if (v)
+    {
+        const float quad[4][3] = {{-w, h, z}, {-w, -h, z}, {+w, -h, z}, {+w, h, z}};
+        memcpy(v, quad, sizeof(quad));
+        glring_flush(&stream_ring, ofs, sizeof(quad));
+        glBindBuffer(GL_ARRAY_BUFFER, stream_ring.buf);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(3, GL_FLOAT, 0, (const void *)(size_t)ofs);
+        glDrawArrays(GL_QUADS, 0, 4);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    else
+    {
+        glBegin(GL_QUADS);
+        glVertex3f(-w, h, z);
+        glVertex3f(-w, -h, z);
+        glVertex3f(+w, -h, z);
+        glVertex3f(+w, h, z);
+        glEnd();
+    }
 }
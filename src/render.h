@@ -1,4 +1,4 @@
-// Last updated: <2024/04/04 10:22:12 +0900>
+// Last updated: <2026/10/20 10:31:48 +0900>
 
 #ifndef __RENDER_H__
 #define __RENDER_H__
@@ -24,6 +24,25 @@
 #include <GL/glu.h>
 #include "resource.h"
 
+// how to draw roads
+enum
+{
+    ROAD_PATH_MESH,      // static geometry
+    ROAD_PATH_BATCH,     // made by batch kernel every frame
+    ROAD_PATH_IMMEDIATE, // glVertex3d()
+    ROAD_PATH_TILES,     // prerendered tiles (fixed function only)
+};
+
+// renderer
+enum
+{
+    RENDER_FIXED, // OpenGL 1.1 fixed function
+    RENDER_CORE,  // OpenGL 3.3 core profile shaders
+    RENDER_SOFT,  // software rasteriser on CPU, drawn to window by OpenGL 1.1
+};
+
+struct telemetry_data;
+
 // globals for size of screen
 extern int Width;
 extern int Height;
@@ -39,5 +58,46 @@ void set_use_waittime(int fg);
 void set_cfg_framerate(float fps);
 float get_cfg_framerate(void);
 void resize_window(int w, int h);
+void set_wall_grid(int rows, int cols);
+int get_view_num(void);
+void skip_intro(void);
+void seek_course_time(float sec);
+void set_course(int course, int stg, int model);
+int get_course_max(void);
+int get_stage_max(void);
+int get_model_max(void);
+int is_course_end(void);
+float get_course_time(void);
+float get_course_duration(void);
+void set_road_path(int path);
+void set_road_lod(int fg);
+int set_road_kernel(int kind);
+double time_road_batch(int loops);
+void set_traffic_num(int num);
+void set_fixed_delta(float sec);
+void set_painter_order(int fg);
+void set_road_parts(int shadow, int line);
+void get_road_parts(int *shadow, int *line);
+void set_quality(int level);
+int get_quality(void);
+int get_quality_max(void);
+void get_telemetry(struct telemetry_data *d);
+void set_tree_step(int step);
+void set_player_speed(float spdmax, int fixed);
+void set_render_scale(float scale);
+float get_render_scale(void);
+int get_render_size(int *w, int *h);
+void set_overdraw(int fg);
+int get_overdraw(void);
+void set_frame_graph(int fg);
+int get_frame_graph(void);
+void get_overdraw_stat(float *avg, int *max);
+float get_view_scale(void);
+void set_gl_getproc(void *(*getproc)(const char *name));
+void set_gl_version_limit(int ver);
+void set_render_backend(int kind);
+int get_render_backend(void);
+void set_soft_threads(int threads);
+int set_soft_kernel(int kind);
 
 #endif
@@ -0,0 +1,75 @@
+// Last updated: <2026/10/20 00:41:27 +0900>
+//
+// Arc length of course. Distance along center line <-> road index.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "roadarc.h"
+
+// ========================================
+void roadarc_build(ROADARC *a, const ROADDATA *roads, int roads_len)
+{
+    memset(a, 0, sizeof(ROADARC));
+    if (roads_len < 2)
+        return;
+
+    a->roads_len = roads_len;
+    a->dist = (double *)malloc(sizeof(double) * roads_len);
+    a->dist[0] = 0.0;
+    for (int i = 1; i < roads_len; i++)
+        a->dist[i] = a->dist[i - 1] + hypot(roads[i].cx - roads[i - 1].cx, roads[i].cy - roads[i - 1].cy);
+    a->len = a->dist[roads_len - 1];
+
+    a->cell_num = (int)(a->len / ROADARC_CELL) + 1;
+    a->cell = (int *)malloc(sizeof(int) * a->cell_num);
+    int i = 0;
+    for (int k = 0; k < a->cell_num; k++)
+    {
+        double d = k * ROADARC_CELL;
+        while (i < roads_len - 2 && a->dist[i + 1] <= d)
+            i++;
+        a->cell[k] = i;
+    }
+}
+
+void roadarc_free(ROADARC *a)
+{
+    free(a->dist);
+    free(a->cell);
+    memset(a, 0, sizeof(ROADARC));
+}
+
+// road index (segment + fraction) at distance d
+float roadarc_get_idx(const ROADARC *a, double d)
+{
+    if (a->roads_len < 2)
+        return 0.0;
+    if (d <= 0.0)
+        return 0.0;
+    if (d >= a->len)
+        return (float)(a->roads_len - 1);
+
+    int k = (int)(d / ROADARC_CELL);
+    if (k >= a->cell_num)
+        k = a->cell_num - 1;
+    int i = a->cell[k];
+    while (i < a->roads_len - 2 && a->dist[i + 1] <= d)
+        i++;
+
+    double sl = a->dist[i + 1] - a->dist[i];
+    double f = (sl > 0.0) ? (d - a->dist[i]) / sl : 0.0;
+    return (float)(i + f);
+}
+
+// distance at road index idx
+double roadarc_get_dist(const ROADARC *a, float idx)
+{
+    if (a->roads_len < 2 || idx <= 0.0)
+        return 0.0;
+
+    int i = (int)idx;
+    if (i >= a->roads_len - 1)
+        return a->len;
+    return a->dist[i] + (a->dist[i + 1] - a->dist[i]) * (idx - i);
+}
@@ -0,0 +1,36 @@
+// Last updated: <2026/10/20 00:41:27 +0900>
+//
+// Arc length of course. Distance along center line <-> road index.
+//
+// Distance of each road data is in a table. For the inverse lookup, a
+// table of uniform distance cells gives the segment at start of each cell.
+// Cells are shorter than segments, so only one or two segments are checked.
+
+#ifndef __ROADARC_H__
+#define __ROADARC_H__
+
+#include "roads.h"
+
+// world units per metre. course coordinates are 1e-6 degree (about 9 cm)
+#define ROADARC_UNIT_PER_M 11.0
+
+// cell size of inverse lookup table (world unit)
+#define ROADARC_CELL 4.0
+
+typedef struct roadarc
+{
+    int roads_len;
+    double len;   // distance of last road data
+    double *dist; // [roads_len] distance from road data 0
+    int cell_num;
+    int *cell;    // [cell_num] segment at distance k * ROADARC_CELL
+} ROADARC;
+
+// ----------------------------------------
+// prototype declaration
+void roadarc_build(ROADARC *a, const ROADDATA *roads, int roads_len);
+void roadarc_free(ROADARC *a);
+float roadarc_get_idx(const ROADARC *a, double d);
+double roadarc_get_dist(const ROADARC *a, float idx);
+
+#endif
@@ -0,0 +1,425 @@
+// Last updated: <2026/10/20 13:52:31 +0900>
+//
+// Batch transform of road segments into float vertex arrays.
+//
+// Segments are those of the rows of ROADMESH (road data split at ends of
+// color bands). Each row is converted once into 8 floats
+// (road edge x0, z0, x1, z1, white line x0, z0, x1, z1) relative to (xb, yb),
+// then quads are made from the rows of both ends of a segment.
+// SSE2 / AVX2 kernels are selected at runtime. Other CPUs use scalar code.
+//
+// Each kernel is a template of the parts to make (ROADBATCH_SHADOW, ROADBATCH_LINE),
+// and segments are made in runs of one band, even and odd bands in turn,
+// so that the loops have no tests of parts or band. roadbatch_build()
+// selects the instance from table.
+
+#include <stdlib.h>
+#include <string.h>
+#include "roadbatch.h"
+#include "roadmesh.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define USE_X86_SIMD
+#include <emmintrin.h>
+#include <immintrin.h>
+#endif
+
+typedef int (*ROADBATCH_KERNEL)(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb);
+
+static int kernel_kind = ROADBATCH_AUTO;
+static const ROADBATCH_KERNEL *kernel = NULL; // [ROADBATCH_PARTS_MAX]
+
+// ----------------------------------------
+// prototype declaration
+static void reserve(ROADBATCH *b, int segs);
+static void set_col(float *c, const float *col);
+template <int PARTS>
+static int build_scalar(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb);
+#ifdef USE_X86_SIMD
+template <int PARTS>
+static int build_sse2(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb);
+template <int PARTS>
+__attribute__((target("avx2"))) static int build_avx2(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb);
+#endif
+
+// ========================================
+static void reserve(ROADBATCH *b, int segs)
+{
+    int n = segs * 12;
+    if (n <= b->max)
+        return;
+
+    b->max = n;
+    b->vtx = (float *)realloc(b->vtx, sizeof(float) * n * 3);
+    b->col = (float *)realloc(b->col, sizeof(float) * n * 4);
+}
+
+static void set_col(float *c, const float *col)
+{
+    for (int k = 0; k < 4; k++)
+        memcpy(&c[k * 4], col, sizeof(float) * 4);
+}
+
+void roadbatch_free(ROADBATCH *b)
+{
+    free(b->vtx);
+    free(b->col);
+    memset(b, 0, sizeof(ROADBATCH));
+}
+
+// ----------------------------------------
+// scalar kernel
+static void set_quad_scalar(float *v, const float *p, const float *c, float y)
+{
+    // same vertex order as draw_roads()
+    v[0] = p[0];
+    v[1] = y;
+    v[2] = p[1];
+    v[3] = p[2];
+    v[4] = y;
+    v[5] = p[3];
+    v[6] = c[2];
+    v[7] = y;
+    v[8] = c[3];
+    v[9] = c[0];
+    v[10] = y;
+    v[11] = c[1];
+}
+
+static void get_row_scalar(float *r, const ROADDATA *d, double xb, double yb)
+{
+    r[0] = d->rx0 - xb;
+    r[1] = -(d->ry0) - yb;
+    r[2] = d->rx1 - xb;
+    r[3] = -(d->ry1) - yb;
+    r[4] = d->lx0 - xb;
+    r[5] = -(d->ly0) - yb;
+    r[6] = d->lx1 - xb;
+    r[7] = -(d->ly1) - yb;
+}
+
+// quads of segment. EVEN : band of segment is even, it has white line. return number of vertices
+template <int PARTS, int EVEN>
+static inline int set_seg_scalar(float *v, float *c, const float *prev, const float *cur)
+{
+    int n = 0;
+    if (PARTS & ROADBATCH_SHADOW)
+    {
+        set_quad_scalar(v, prev, cur, ROAD_SHADOW_Y);
+        set_col(c, road_shadow_col);
+        n += 4;
+    }
+
+    // color of road data at end of segment
+    set_quad_scalar(&v[n * 3], prev, cur, ROAD_Y);
+    set_col(&c[n * 4], road_cols[1 - EVEN]);
+    n += 4;
+
+    if ((PARTS & ROADBATCH_LINE) && EVEN)
+    {
+        set_quad_scalar(&v[n * 3], &prev[4], &cur[4], ROAD_LINE_Y);
+        set_col(&c[n * 4], road_line_col);
+        n += 4;
+    }
+    return n;
+}
+
+// segments [s, e) of rows in one band. prev : row s, and row e on return
+template <int PARTS, int EVEN>
+static inline int set_run_scalar(float *v, float *c, const ROADDATA *rows, int s, int e, float *prev,
+                                 double xb, double yb)
+{
+    float cur[8];
+    int n = 0;
+    for (; s < e; s++)
+    {
+        get_row_scalar(cur, &rows[s + 1], xb, yb);
+        n += set_seg_scalar<PARTS, EVEN>(&v[n * 3], &c[n * 4], prev, cur);
+        memcpy(prev, cur, sizeof(cur));
+    }
+    return n;
+}
+
+template <int PARTS>
+static int build_scalar(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb)
+{
+    float *v = b->vtx;
+    float *c = b->col;
+    float prev[8];
+    int n = 0;
+
+    get_row_scalar(prev, &m->rows[s0], xb, yb);
+    int s = s0;
+    int k = roadmesh_get_band(m, s0);
+    if (k & 1)
+    {
+        int e = roadmesh_get_band_end(m, k++, s1);
+        n += set_run_scalar<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, prev, xb, yb);
+        s = e;
+    }
+
+    // even and odd band
+    while (s < s1)
+    {
+        int e = roadmesh_get_band_end(m, k, s1);
+        n += set_run_scalar<PARTS, 1>(&v[n * 3], &c[n * 4], m->rows, s, e, prev, xb, yb);
+        s = e;
+        e = roadmesh_get_band_end(m, k + 1, s1);
+        n += set_run_scalar<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, prev, xb, yb);
+        s = e;
+        k += 2;
+    }
+    return n;
+}
+
+#ifdef USE_X86_SIMD
+// ----------------------------------------
+// SSE2 kernel.
+// p = (x0, z0, x1, z1) of start row, c = of end row. write 4 vertices (12 floats)
+static inline void set_quad_sse(float *v, __m128 p, __m128 c, __m128 y)
+{
+    __m128 plo = _mm_unpacklo_ps(p, y); // x0 y z0 y
+    __m128 phi = _mm_unpackhi_ps(p, y); // x1 y z1 y
+    __m128 clo = _mm_unpacklo_ps(c, y); // cx0 y cz0 y
+    __m128 chi = _mm_unpackhi_ps(c, y); // cx1 y cz1 y
+
+    _mm_storeu_ps(v + 0, _mm_shuffle_ps(plo, p, _MM_SHUFFLE(2, 1, 1, 0)));   // x0 y z0 x1
+    _mm_storeu_ps(v + 4, _mm_shuffle_ps(phi, chi, _MM_SHUFFLE(1, 0, 2, 1))); // y z1 cx1 y
+    _mm_storeu_ps(v + 8, _mm_shuffle_ps(c, clo, _MM_SHUFFLE(2, 1, 0, 3)));   // cz1 cx0 y cz0
+}
+
+static inline void set_col_sse(float *c, __m128 col)
+{
+    _mm_storeu_ps(c + 0, col);
+    _mm_storeu_ps(c + 4, col);
+    _mm_storeu_ps(c + 8, col);
+    _mm_storeu_ps(c + 12, col);
+}
+
+static inline __m128 get_pair_sse2(const double *d, __m128d sign, __m128d ofs)
+{
+    __m128d a = _mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(d), sign), ofs);
+    __m128d b = _mm_sub_pd(_mm_mul_pd(_mm_loadu_pd(d + 2), sign), ofs);
+    return _mm_movelh_ps(_mm_cvtpd_ps(a), _mm_cvtpd_ps(b));
+}
+
+// quads of segment. r = road edges, l = white line edges of start (p) and end (c) rows
+template <int PARTS, int EVEN>
+static inline int set_seg_sse(float *v, float *c, __m128 pr, __m128 cr, __m128 pl, __m128 cl)
+{
+    int n = 0;
+    if (PARTS & ROADBATCH_SHADOW)
+    {
+        set_quad_sse(v, pr, cr, _mm_set1_ps(ROAD_SHADOW_Y));
+        set_col_sse(c, _mm_loadu_ps(road_shadow_col));
+        n += 4;
+    }
+
+    set_quad_sse(&v[n * 3], pr, cr, _mm_set1_ps(ROAD_Y));
+    set_col_sse(&c[n * 4], _mm_loadu_ps(road_cols[1 - EVEN]));
+    n += 4;
+
+    if ((PARTS & ROADBATCH_LINE) && EVEN)
+    {
+        set_quad_sse(&v[n * 3], pl, cl, _mm_set1_ps(ROAD_LINE_Y));
+        set_col_sse(&c[n * 4], _mm_loadu_ps(road_line_col));
+        n += 4;
+    }
+    return n;
+}
+
+// segments [s, e) of rows in one band. pr, pl : row s, and row e on return
+template <int PARTS, int EVEN>
+static inline int set_run_sse2(float *v, float *c, const ROADDATA *rows, int s, int e, __m128 &pr, __m128 &pl,
+                               __m128d sign, __m128d ofs)
+{
+    int n = 0;
+    for (; s < e; s++)
+    {
+        __m128 cr = get_pair_sse2(&rows[s + 1].rx0, sign, ofs);
+        __m128 cl = get_pair_sse2(&rows[s + 1].lx0, sign, ofs);
+        n += set_seg_sse<PARTS, EVEN>(&v[n * 3], &c[n * 4], pr, cr, pl, cl);
+        pr = cr;
+        pl = cl;
+    }
+    return n;
+}
+
+template <int PARTS>
+static int build_sse2(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb)
+{
+    float *v = b->vtx;
+    float *c = b->col;
+    const __m128d sign = _mm_set_pd(-1.0, 1.0);
+    const __m128d ofs = _mm_set_pd(yb, xb);
+    int n = 0;
+
+    __m128 pr = get_pair_sse2(&m->rows[s0].rx0, sign, ofs);
+    __m128 pl = get_pair_sse2(&m->rows[s0].lx0, sign, ofs);
+    int s = s0;
+    int k = roadmesh_get_band(m, s0);
+    if (k & 1)
+    {
+        int e = roadmesh_get_band_end(m, k++, s1);
+        n += set_run_sse2<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+    }
+
+    // even and odd band
+    while (s < s1)
+    {
+        int e = roadmesh_get_band_end(m, k, s1);
+        n += set_run_sse2<PARTS, 1>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+        e = roadmesh_get_band_end(m, k + 1, s1);
+        n += set_run_sse2<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+        k += 2;
+    }
+    return n;
+}
+
+// ----------------------------------------
+// AVX2 kernel. converts 4 doubles at once
+__attribute__((target("avx2"))) static inline __m128 get_pair_avx2(const double *d, __m256d sign, __m256d ofs)
+{
+    return _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(d), sign), ofs));
+}
+
+// same as set_run_sse2()
+template <int PARTS, int EVEN>
+__attribute__((target("avx2"))) static inline int set_run_avx2(float *v, float *c, const ROADDATA *rows, int s, int e,
+                                                                __m128 &pr, __m128 &pl, __m256d sign, __m256d ofs)
+{
+    int n = 0;
+    for (; s < e; s++)
+    {
+        __m128 cr = get_pair_avx2(&rows[s + 1].rx0, sign, ofs);
+        __m128 cl = get_pair_avx2(&rows[s + 1].lx0, sign, ofs);
+        n += set_seg_sse<PARTS, EVEN>(&v[n * 3], &c[n * 4], pr, cr, pl, cl);
+        pr = cr;
+        pl = cl;
+    }
+    return n;
+}
+
+template <int PARTS>
+__attribute__((target("avx2"))) static int build_avx2(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb)
+{
+    float *v = b->vtx;
+    float *c = b->col;
+    const __m256d sign = _mm256_set_pd(-1.0, 1.0, -1.0, 1.0);
+    const __m256d ofs = _mm256_set_pd(yb, xb, yb, xb);
+    int n = 0;
+
+    __m128 pr = get_pair_avx2(&m->rows[s0].rx0, sign, ofs);
+    __m128 pl = get_pair_avx2(&m->rows[s0].lx0, sign, ofs);
+    int s = s0;
+    int k = roadmesh_get_band(m, s0);
+    if (k & 1)
+    {
+        int e = roadmesh_get_band_end(m, k++, s1);
+        n += set_run_avx2<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+    }
+
+    // even and odd band
+    while (s < s1)
+    {
+        int e = roadmesh_get_band_end(m, k, s1);
+        n += set_run_avx2<PARTS, 1>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+        e = roadmesh_get_band_end(m, k + 1, s1);
+        n += set_run_avx2<PARTS, 0>(&v[n * 3], &c[n * 4], m->rows, s, e, pr, pl, sign, ofs);
+        s = e;
+        k += 2;
+    }
+    return n;
+}
+#endif
+
+// ----------------------------------------
+// instances of all parts. index is parts
+static const ROADBATCH_KERNEL kernels_scalar[ROADBATCH_PARTS_MAX] = {
+    build_scalar<0>, build_scalar<1>, build_scalar<2>, build_scalar<3>,
+};
+#ifdef USE_X86_SIMD
+static const ROADBATCH_KERNEL kernels_sse2[ROADBATCH_PARTS_MAX] = {
+    build_sse2<0>, build_sse2<1>, build_sse2<2>, build_sse2<3>,
+};
+static const ROADBATCH_KERNEL kernels_avx2[ROADBATCH_PARTS_MAX] = {
+    build_avx2<0>, build_avx2<1>, build_avx2<2>, build_avx2<3>,
+};
+#endif
+
+// select kernel. ROADBATCH_AUTO selects the fastest one
+void roadbatch_set_kernel(int kind)
+{
+    if (kind == ROADBATCH_AUTO)
+    {
+        kind = ROADBATCH_SCALAR;
+#ifdef USE_X86_SIMD
+        kind = ROADBATCH_SSE2;
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            kind = ROADBATCH_AVX2;
+#endif
+    }
+
+    switch (kind)
+    {
+#ifdef USE_X86_SIMD
+    case ROADBATCH_SSE2:
+        kernel = kernels_sse2;
+        break;
+    case ROADBATCH_AVX2:
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            kernel = kernels_avx2;
+            break;
+        }
+        kind = ROADBATCH_SSE2;
+        kernel = kernels_sse2;
+        break;
+#endif
+    default:
+        kind = ROADBATCH_SCALAR;
+        kernel = kernels_scalar;
+        break;
+    }
+    kernel_kind = kind;
+}
+
+int roadbatch_get_kernel(void)
+{
+    if (kernel == NULL)
+        roadbatch_set_kernel(ROADBATCH_AUTO);
+    return kernel_kind;
+}
+
+const char *roadbatch_get_kernel_name(int kind)
+{
+    static const char *names[ROADBATCH_KIND_MAX] = {"auto", "scalar", "sse2", "avx2"};
+    if (kind < 0 || kind >= ROADBATCH_KIND_MAX)
+        return "unknown";
+    return names[kind];
+}
+
+// make quads between road data s0 and s1 of course mesh. parts = ROADBATCH_SHADOW | ROADBATCH_LINE,
+// road is always made. return number of vertices
+int roadbatch_build(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb, int parts)
+{
+    if (kernel == NULL)
+        roadbatch_set_kernel(ROADBATCH_AUTO);
+
+    b->num = 0;
+    s0 = m->row_ofs[s0];
+    s1 = m->row_ofs[s1];
+    if (s1 <= s0)
+        return 0;
+
+    reserve(b, s1 - s0);
+    b->num = kernel[parts & ROADBATCH_ALL](b, m, s0, s1, xb, yb);
+    return b->num;
+}
@@ -0,0 +1,45 @@
+// Last updated: <2026/10/20 13:52:31 +0900>
+//
+// Batch transform of road segments into float vertex arrays.
+// CPU side geometry of draw_roads(). Drawn with one glDrawArrays(GL_QUADS).
+
+#ifndef __ROADBATCH_H__
+#define __ROADBATCH_H__
+
+#include "roadmesh.h"
+
+// kernel type
+enum
+{
+    ROADBATCH_AUTO,
+    ROADBATCH_SCALAR,
+    ROADBATCH_SSE2,
+    ROADBATCH_AVX2,
+    ROADBATCH_KIND_MAX,
+};
+
+// parts of road made by roadbatch_build(), besides road itself
+#define ROADBATCH_SHADOW 1
+#define ROADBATCH_LINE 2
+#define ROADBATCH_ALL (ROADBATCH_SHADOW | ROADBATCH_LINE)
+#define ROADBATCH_PARTS_MAX 4
+
+// shadow, road and white line quads of segment s are stored in this order.
+// white line exists on segment of even band only. shadow and white line are optional
+typedef struct roadbatch
+{
+    int max;    // capacity (vertices)
+    int num;    // number of vertices
+    float *vtx; // [max][3]
+    float *col; // [max][4]
+} ROADBATCH;
+
+// ----------------------------------------
+// prototype declaration
+void roadbatch_set_kernel(int kind);
+int roadbatch_get_kernel(void);
+const char *roadbatch_get_kernel_name(int kind);
+int roadbatch_build(ROADBATCH *b, const ROADMESH *m, int s0, int s1, double xb, double yb, int parts);
+void roadbatch_free(ROADBATCH *b);
+
+#endif
@@ -0,0 +1,725 @@
+// Last updated: <2026/10/20 14:03:18 +0900>
+//
+// Static course geometry. Built once per course, shared by all views.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "glfunc.h"
+#include "roadmesh.h"
+
+// sort key of tree
+typedef struct tree_key
+{
+    float z;
+    int t;
+} TREE_KEY;
+
+// ----------------------------------------
+// prototype declaration
+static void set_edge(float *v, float *c, double x0, double y0, double x1, double y1,
+                     double y, double ox, double oy, const float *col);
+static void set_pal(unsigned char *p, int n, int pal);
+static const unsigned int *get_line_idx(const ROADMESH *m, int *step);
+static double get_seg_dist(double px, double py, double x0, double y0, double x1, double y1);
+static double get_row_dist(const ROADDATA *roads, int a, int b, int i);
+static int simplify_rows(const ROADDATA *roads, int rows, double tol, unsigned char *keep, int *stack);
+static void build_lod(ROADMESH *m, const ROADDATA *roads, int rows);
+static void lerp_row(ROADDATA *d, const ROADDATA *a, const ROADDATA *b, double f);
+static void build_band_rows(ROADMESH *m, const ROADDATA *roads, int rows);
+static void get_lod_range(const ROADMESH *m, int lod, int s0, int s1, int *k0, int *k1);
+static int cmp_tree_key(const void *a, const void *b);
+static void build_tree_order(ROADMESH *m);
+
+// ========================================
+// 2 vertices of road edge, and same color
+static void set_edge(float *v, float *c, double x0, double y0, double x1, double y1,
+                     double y, double ox, double oy, const float *col)
+{
+    v[0] = x0 - ox;
+    v[1] = y;
+    v[2] = -(y0 - oy);
+    v[3] = x1 - ox;
+    v[4] = y;
+    v[5] = -(y1 - oy);
+    memcpy(&c[0], col, sizeof(float) * 4);
+    memcpy(&c[4], col, sizeof(float) * 4);
+}
+
+static void set_pal(unsigned char *p, int n, int pal)
+{
+    memset(p, pal, n);
+}
+
+// distance between point and line segment (x0, y0) - (x1, y1)
+static double get_seg_dist(double px, double py, double x0, double y0, double x1, double y1)
+{
+    double dx = x1 - x0;
+    double dy = y1 - y0;
+    double l2 = dx * dx + dy * dy;
+    double t = 0.0;
+    if (l2 > 0.0)
+    {
+        t = ((px - x0) * dx + (py - y0) * dy) / l2;
+        if (t < 0.0)
+            t = 0.0;
+        if (t > 1.0)
+            t = 1.0;
+    }
+    double ex = x0 + dx * t - px;
+    double ey = y0 + dy * t - py;
+    return sqrt(ex * ex + ey * ey);
+}
+
+// error of row i when rows between a and b are removed. center line and both edges
+static double get_row_dist(const ROADDATA *roads, int a, int b, int i)
+{
+    const ROADDATA *ra = &roads[a];
+    const ROADDATA *rb = &roads[b];
+    const ROADDATA *r = &roads[i];
+    double d = get_seg_dist(r->cx, r->cy, ra->cx, ra->cy, rb->cx, rb->cy);
+    double d0 = get_seg_dist(r->rx0, r->ry0, ra->rx0, ra->ry0, rb->rx0, rb->ry0);
+    double d1 = get_seg_dist(r->rx1, r->ry1, ra->rx1, ra->ry1, rb->rx1, rb->ry1);
+    if (d0 > d)
+        d = d0;
+    if (d1 > d)
+        d = d1;
+    return d;
+}
+
+// Douglas-Peucker. keep[i] = 1 if row i is kept. stack : [rows * 2] work area.
+// return number of kept rows
+static int simplify_rows(const ROADDATA *roads, int rows, double tol, unsigned char *keep, int *stack)
+{
+    memset(keep, 0, rows);
+    keep[0] = 1;
+    keep[rows - 1] = 1;
+    int kept = 2;
+
+    int sp = 0;
+    stack[sp++] = 0;
+    stack[sp++] = rows - 1;
+    while (sp > 0)
+    {
+        int b = stack[--sp];
+        int a = stack[--sp];
+        double dmax = tol;
+        int k = -1;
+        for (int i = a + 1; i < b; i++)
+        {
+            double d = get_row_dist(roads, a, b, i);
+            if (d > dmax)
+            {
+                dmax = d;
+                k = i;
+            }
+        }
+        if (k < 0)
+            continue;
+
+        keep[k] = 1;
+        kept++;
+        stack[sp++] = a;
+        stack[sp++] = k;
+        stack[sp++] = k;
+        stack[sp++] = b;
+    }
+    return kept;
+}
+
+// kept rows of simplified levels
+static void build_lod(ROADMESH *m, const ROADDATA *roads, int rows)
+{
+    if (rows < 2)
+        return;
+
+    unsigned char *keep = (unsigned char *)malloc(rows);
+    int *stack = (int *)malloc(sizeof(int) * rows * 2);
+    for (int lod = 1; lod < ROADMESH_LOD_MAX; lod++)
+    {
+        int n = simplify_rows(roads, rows, ROADMESH_LOD_TOL * (1 << (lod - 1)), keep, stack);
+        m->lod_num[lod] = n;
+        m->lod_row[lod] = (int *)malloc(sizeof(int) * n);
+        n = 0;
+        for (int i = 0; i < rows; i++)
+        {
+            if (keep[i])
+                m->lod_row[lod][n++] = i;
+        }
+    }
+    free(stack);
+    free(keep);
+}
+
+// row between a and b, at f of segment
+static void lerp_row(ROADDATA *d, const ROADDATA *a, const ROADDATA *b, double f)
+{
+    memset(d, 0, sizeof(ROADDATA));
+    d->cx = a->cx + (b->cx - a->cx) * f;
+    d->cy = a->cy + (b->cy - a->cy) * f;
+    d->rx0 = a->rx0 + (b->rx0 - a->rx0) * f;
+    d->ry0 = a->ry0 + (b->ry0 - a->ry0) * f;
+    d->rx1 = a->rx1 + (b->rx1 - a->rx1) * f;
+    d->ry1 = a->ry1 + (b->ry1 - a->ry1) * f;
+    d->lx0 = a->lx0 + (b->lx0 - a->lx0) * f;
+    d->ly0 = a->ly0 + (b->ly0 - a->ly0) * f;
+    d->lx1 = a->lx1 + (b->lx1 - a->lx1) * f;
+    d->ly1 = a->ly1 + (b->ly1 - a->ly1) * f;
+}
+
+// Color bands of ROADMESH_BAND_LEN along arc length of center line. Only the
+// segments over an end of band are split, so the road data keep their
+// tessellation, and quads of one band have one color.
+static void build_band_rows(ROADMESH *m, const ROADDATA *roads, int rows)
+{
+    double total = 0.0;
+    for (int i = 0; i < rows - 1; i++)
+        total += hypot(roads[i + 1].cx - roads[i].cx, roads[i + 1].cy - roads[i].cy);
+    int max_bands = (int)(total / ROADMESH_BAND_LEN) + 2;
+
+    m->rows = (ROADDATA *)malloc(sizeof(ROADDATA) * (rows + max_bands));
+    m->row_ofs = (int *)malloc(sizeof(int) * (m->roads_len + 1));
+    m->band_first = (int *)malloc(sizeof(int) * (max_bands + 2));
+
+    int n = 0;
+    int k = 0; // band of next segment
+    double s = 0.0;
+    m->band_first[0] = 0;
+    for (int i = 0; i < rows; i++)
+    {
+        const ROADDATA *r = &roads[i];
+        if (i > 0)
+        {
+            const ROADDATA *p = &roads[i - 1];
+            double lg = hypot(r->cx - p->cx, r->cy - p->cy);
+            double end = s + lg;
+            while ((k + 1) * ROADMESH_BAND_LEN < end - ROADMESH_BAND_EPS)
+            {
+                lerp_row(&m->rows[n], p, r, ((k + 1) * ROADMESH_BAND_LEN - s) / lg);
+                m->rows[n++].band = k++;
+                m->band_first[k] = n - 1;
+            }
+            s = end;
+        }
+
+        m->row_ofs[i] = n;
+        m->rows[n] = *r;
+        m->rows[n++].band = k;
+
+        // end of band just on road data
+        if (i > 0 && i < rows - 1 && (k + 1) * ROADMESH_BAND_LEN <= s + ROADMESH_BAND_EPS)
+            m->band_first[++k] = n - 1;
+    }
+    int segs = (n > 0) ? n - 1 : 0;
+    for (int i = rows; i <= m->roads_len; i++)
+        m->row_ofs[i] = segs;
+
+    // and sentinel for the band after last
+    m->row_num = n;
+    m->band_num = (n > 1) ? k + 1 : 0;
+    m->band_first[m->band_num] = segs;
+    m->band_first[m->band_num + 1] = segs;
+}
+
+static int cmp_tree_key(const void *a, const void *b)
+{
+    const TREE_KEY *ka = (const TREE_KEY *)a;
+    const TREE_KEY *kb = (const TREE_KEY *)b;
+    if (ka->z != kb->z)
+        return (ka->z < kb->z) ? -1 : 1;
+    return ka->t - kb->t;
+}
+
+// Trees from far to near. View is ortho with tilt around x axis only, and
+// a tree is a vertical triangle at one z, so the order is same in all frames
+static void build_tree_order(ROADMESH *m)
+{
+    TREE_KEY *keys = (TREE_KEY *)malloc(sizeof(TREE_KEY) * (m->tree_num + 1));
+    for (int t = 0; t < m->tree_num; t++)
+    {
+        keys[t].z = m->vtx[(m->tree_first[0] + t * 3) * 3 + 2];
+        keys[t].t = t;
+    }
+    qsort(keys, m->tree_num, sizeof(TREE_KEY), cmp_tree_key);
+
+    m->tree_order = (int *)malloc(sizeof(int) * (m->tree_num + 1));
+    for (int t = 0; t < m->tree_num; t++)
+        m->tree_order[t] = keys[t].t;
+    free(keys);
+}
+
+void roadmesh_build(ROADMESH *m, const ROADDATA *roads, int roads_len,
+                    const float tree_cols[ROADMESH_STG_MAX][ROADMESH_TREE_COL_MAX][4])
+{
+    memset(m, 0, sizeof(ROADMESH));
+
+    m->roads_len = roads_len;
+    m->ox = roads[0].cx;
+    m->oy = roads[0].cy;
+    double ox = m->ox;
+    double oy = m->oy;
+
+    // the last road data has no edge, so the last segment is (len - 3, len - 2)
+    m->seg_num = (roads_len >= 3) ? roads_len - 2 : 0;
+    int rows = (m->seg_num > 0) ? m->seg_num + 1 : 0;
+    build_band_rows(m, roads, rows);
+    int segs = (m->row_num > 0) ? m->row_num - 1 : 0;
+
+    // white line pieces. band of segment s of rows is in row s + 1
+    m->line_ofs = (int *)malloc(sizeof(int) * (segs + 1));
+    m->line_num = 0;
+    for (int s = 0; s < segs; s++)
+    {
+        m->line_ofs[s] = m->line_num;
+        if ((m->rows[s + 1].band & 1) == 0)
+            m->line_num++;
+    }
+    m->line_ofs[segs] = m->line_num;
+
+    // trees
+    m->tree_ofs = (int *)malloc(sizeof(int) * (roads_len + 1));
+    m->tree_road = (int *)malloc(sizeof(int) * (roads_len + 1));
+    m->tree_num = 0;
+    for (int i = 0; i < roads_len; i++)
+    {
+        m->tree_ofs[i] = m->tree_num;
+        if (roads[i].tfg != 0)
+            m->tree_road[m->tree_num++] = i;
+    }
+    m->tree_ofs[roads_len] = m->tree_num;
+
+    m->seg_len = 0.0;
+    for (int i = 0; i < m->seg_num; i++)
+        m->seg_len += hypot(roads[i + 1].cx - roads[i].cx, roads[i + 1].cy - roads[i].cy);
+    if (m->seg_num > 0)
+        m->seg_len /= m->seg_num;
+
+    build_lod(m, roads, rows);
+
+    m->shadow_first = 0;
+    m->road_first = m->shadow_first + m->row_num * 2;
+    m->line_first = m->road_first + m->row_num * 2;
+    m->tree_first[0] = m->line_first + m->line_num * 4;
+    for (int stg = 1; stg < ROADMESH_STG_MAX; stg++)
+        m->tree_first[stg] = m->tree_first[stg - 1] + m->tree_num * 3;
+    m->vtx_num = m->tree_first[ROADMESH_STG_MAX - 1] + m->tree_num * 3;
+    for (int lod = 1; lod < ROADMESH_LOD_MAX; lod++)
+    {
+        m->lod_first[lod] = m->vtx_num;
+        m->vtx_num += m->lod_num[lod] * 4;
+    }
+
+    m->vtx = (float *)malloc(sizeof(float) * m->vtx_num * 3);
+    m->col = (float *)malloc(sizeof(float) * m->vtx_num * 4);
+    m->pal = (unsigned char *)malloc(m->vtx_num);
+    m->line_idx = (unsigned int *)malloc(sizeof(unsigned int) * m->line_num * 5);
+    m->line_idx_degen = (unsigned int *)malloc(sizeof(unsigned int) * m->line_num * 6);
+
+    // shadow and road. color alternates by band of end row
+    for (int i = 0; i < m->row_num; i++)
+    {
+        const ROADDATA *r = &m->rows[i];
+        int k = m->shadow_first + i * 2;
+        set_edge(&m->vtx[k * 3], &m->col[k * 4], r->rx0, r->ry0, r->rx1, r->ry1,
+                 ROAD_SHADOW_Y, ox, oy, road_shadow_col);
+        set_pal(&m->pal[k], 2, ROADMESH_PAL_SHADOW);
+        k = m->road_first + i * 2;
+        set_edge(&m->vtx[k * 3], &m->col[k * 4], r->rx0, r->ry0, r->rx1, r->ry1,
+                 ROAD_Y, ox, oy, road_cols[r->band & 1]);
+        set_pal(&m->pal[k], 2, ROADMESH_PAL_ROAD + (r->band & 1));
+    }
+
+    // white line of segment s of rows, piece p
+    for (int s = 0; s < segs; s++)
+    {
+        int p = m->line_ofs[s];
+        if (p == m->line_ofs[s + 1])
+            continue;
+
+        const ROADDATA *r0 = &m->rows[s];
+        const ROADDATA *r1 = &m->rows[s + 1];
+        unsigned int k = m->line_first + p * 4;
+        set_edge(&m->vtx[k * 3], &m->col[k * 4], r0->lx0, r0->ly0, r0->lx1, r0->ly1,
+                 ROAD_LINE_Y, ox, oy, road_line_col);
+        set_edge(&m->vtx[(k + 2) * 3], &m->col[(k + 2) * 4], r1->lx0, r1->ly0, r1->lx1, r1->ly1,
+                 ROAD_LINE_Y, ox, oy, road_line_col);
+        set_pal(&m->pal[k], 4, ROADMESH_PAL_LINE);
+
+        unsigned int *d = &m->line_idx[p * 5];
+        d[0] = k;
+        d[1] = k + 1;
+        d[2] = k + 2;
+        d[3] = k + 3;
+        d[4] = ROADMESH_RESTART_INDEX;
+
+        // piece starts at odd triangle, so begin with right edge to keep winding
+        d = &m->line_idx_degen[p * 6];
+        d[0] = k + 1;
+        d[1] = k + 1;
+        d[2] = k;
+        d[3] = k + 3;
+        d[4] = k + 2;
+        d[5] = k + 2;
+    }
+
+    for (int i = 0; i < roads_len; i++)
+    {
+        if (roads[i].tfg == 0)
+            continue;
+
+        float x = roads[i].tx - ox;
+        float y = -(roads[i].ty - oy);
+        float r = roads[i].r;
+
+        for (int stg = 0; stg < ROADMESH_STG_MAX; stg++)
+        {
+            int k = m->tree_first[stg] + m->tree_ofs[i] * 3;
+            float *v = &m->vtx[k * 3];
+            v[0] = x;
+            v[1] = r * 0.866 * 2;
+            v[2] = y;
+            v[3] = x - r;
+            v[4] = 0.0;
+            v[5] = y;
+            v[6] = x + r;
+            v[7] = 0.0;
+            v[8] = y;
+            for (int j = 0; j < 3; j++)
+                memcpy(&m->col[(k + j) * 4], tree_cols[stg][roads[i].col], sizeof(float) * 4);
+            set_pal(&m->pal[k], 3, ROADMESH_PAL_TREE + roads[i].col);
+        }
+    }
+
+    build_tree_order(m);
+
+    // simplified shadow and road
+    for (int lod = 1; lod < ROADMESH_LOD_MAX; lod++)
+    {
+        for (int j = 0; j < m->lod_num[lod]; j++)
+        {
+            const ROADDATA *r = &roads[m->lod_row[lod][j]];
+            int k = m->lod_first[lod] + j * 2;
+            set_edge(&m->vtx[k * 3], &m->col[k * 4], r->rx0, r->ry0, r->rx1, r->ry1,
+                     ROAD_SHADOW_Y, ox, oy, road_shadow_col);
+            set_pal(&m->pal[k], 2, ROADMESH_PAL_SHADOW);
+            k += m->lod_num[lod] * 2;
+            set_edge(&m->vtx[k * 3], &m->col[k * 4], r->rx0, r->ry0, r->rx1, r->ry1,
+                     ROAD_Y, ox, oy, road_lod_col);
+            set_pal(&m->pal[k], 2, ROADMESH_PAL_LOD);
+        }
+    }
+
+    m->built = 1;
+}
+
+void roadmesh_free(ROADMESH *m)
+{
+    if (!m->built)
+        return;
+
+    free(m->vtx);
+    free(m->col);
+    free(m->pal);
+    free(m->line_idx);
+    free(m->line_idx_degen);
+    free(m->line_ofs);
+    free(m->rows);
+    free(m->row_ofs);
+    free(m->band_first);
+    free(m->tree_ofs);
+    free(m->tree_road);
+    free(m->tree_order);
+    for (int lod = 1; lod < ROADMESH_LOD_MAX; lod++)
+        free(m->lod_row[lod]);
+    memset(m, 0, sizeof(ROADMESH));
+}
+
+// copy arrays to buffer objects. needs current OpenGL context
+void roadmesh_upload(ROADMESH *m)
+{
+    if (!m->built || m->vbo != 0 || !glf_has_vbo)
+        return;
+
+    GLuint buf[2];
+    glGenBuffers(2, buf);
+    m->vbo = buf[0];
+    m->ibo = buf[1];
+
+    int cofs = roadmesh_get_col_offset(m);
+    int pofs = roadmesh_get_pal_offset(m);
+    glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+    glBufferData(GL_ARRAY_BUFFER, pofs + m->vtx_num, NULL, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, cofs, m->vtx);
+    glBufferSubData(GL_ARRAY_BUFFER, cofs, pofs - cofs, m->col);
+    glBufferSubData(GL_ARRAY_BUFFER, pofs, m->vtx_num, m->pal);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    int step;
+    const unsigned int *idx = get_line_idx(m, &step);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * m->line_num * step, idx, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+// delete buffer objects. needs current OpenGL context
+void roadmesh_release(ROADMESH *m)
+{
+    if (m->vbo == 0)
+        return;
+
+    GLuint buf[2] = {m->vbo, m->ibo};
+    glDeleteBuffers(2, buf);
+    m->vbo = 0;
+    m->ibo = 0;
+}
+
+// offset of arrays in vertex buffer object. vtx, col, pal
+int roadmesh_get_col_offset(const ROADMESH *m)
+{
+    return sizeof(float) * m->vtx_num * 3;
+}
+
+int roadmesh_get_pal_offset(const ROADMESH *m)
+{
+    return sizeof(float) * m->vtx_num * 7;
+}
+
+static const unsigned int *get_line_idx(const ROADMESH *m, int *step)
+{
+    if (glf_has_restart)
+    {
+        *step = 5;
+        return m->line_idx;
+    }
+    *step = 6;
+    return m->line_idx_degen;
+}
+
+// set vertex and color arrays. GL_VERTEX_ARRAY and GL_COLOR_ARRAY must be enabled
+void roadmesh_bind(const ROADMESH *m)
+{
+    if (m->vbo != 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, m->vbo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m->ibo);
+        glVertexPointer(3, GL_FLOAT, 0, (const void *)0);
+        glColorPointer(4, GL_FLOAT, 0, (const void *)(size_t)roadmesh_get_col_offset(m));
+    }
+    else
+    {
+        if (glf_has_vbo)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
+        glVertexPointer(3, GL_FLOAT, 0, m->vtx);
+        glColorPointer(4, GL_FLOAT, 0, m->col);
+    }
+    glfunc_enable_restart(1);
+}
+
+void roadmesh_unbind(void)
+{
+    if (glf_has_vbo)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+    glfunc_enable_restart(0);
+}
+
+// level of detail for scale of view. unit_per_px : world units per pixel
+int roadmesh_get_lod(const ROADMESH *m, double unit_per_px)
+{
+    if (m->seg_num <= 0 || m->seg_len >= ROADMESH_LOD_SEG_PX * unit_per_px)
+        return 0;
+
+    int lod = 0;
+    for (int i = 1; i < ROADMESH_LOD_MAX; i++)
+    {
+        if (ROADMESH_LOD_TOL * (1 << (i - 1)) <= ROADMESH_LOD_ERR_PX * unit_per_px)
+            lod = i;
+    }
+    return lod;
+}
+
+// kept rows [k0, k1] of simplified level which cover rows s0 - s1
+static void get_lod_range(const ROADMESH *m, int lod, int s0, int s1, int *k0, int *k1)
+{
+    const int *row = m->lod_row[lod];
+
+    // last kept row <= s0
+    int lo = 0;
+    int hi = m->lod_num[lod] - 1;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (row[mid] <= s0)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    *k0 = lo;
+
+    // first kept row >= s1
+    hi = m->lod_num[lod] - 1;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (row[mid] >= s1)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    *k1 = lo;
+}
+
+// vertex range of one layer around road index idx. same range as draw_roads() and draw_trees()
+// lod : level of detail, 0 = full mesh. return 0 if nothing is drawn
+int roadmesh_get_range(const ROADMESH *m, int layer, int stg, int idx, int num, int lod, ROADMESH_RANGE *r)
+{
+    int s0, s1, t0, t1, k0, k1, step;
+
+    r->strip = 1;
+    r->first = 0;
+    r->count = 0;
+    r->idx = NULL;
+    r->idx_ofs = 0;
+
+    switch (layer)
+    {
+    case ROADMESH_SHADOW:
+    case ROADMESH_ROAD:
+        roadmesh_get_seg_range(m, idx, num, &s0, &s1);
+        if (s1 <= s0)
+            break;
+        if (lod > 0)
+        {
+            get_lod_range(m, lod, s0, s1, &k0, &k1);
+            r->first = m->lod_first[lod] + ((layer == ROADMESH_ROAD) ? m->lod_num[lod] * 2 : 0) + k0 * 2;
+            r->count = (k1 - k0 + 1) * 2;
+            break;
+        }
+        s0 = m->row_ofs[s0];
+        s1 = m->row_ofs[s1];
+        r->first = ((layer == ROADMESH_SHADOW) ? m->shadow_first : m->road_first) + s0 * 2;
+        r->count = (s1 - s0 + 1) * 2;
+        break;
+
+    case ROADMESH_LINE:
+        // white line exists on even band. thinner than pixel on simplified levels
+        if (lod > 0)
+            break;
+        roadmesh_get_seg_range(m, idx, num, &s0, &s1);
+        if (s1 <= s0)
+            break;
+        s0 = m->line_ofs[m->row_ofs[s0]];
+        s1 = m->line_ofs[m->row_ofs[s1]];
+        if (s1 <= s0)
+            break;
+        r->idx = get_line_idx(m, &step) + s0 * step;
+        r->idx_ofs = s0 * step;
+        r->count = (s1 - s0) * step;
+        break;
+
+    case ROADMESH_TREE:
+        roadmesh_get_tree_range(m, idx, num, &t0, &t1);
+        if (t1 <= t0)
+            break;
+        r->strip = 0;
+        r->first = m->tree_first[stg] + t0 * 3;
+        r->count = (t1 - t0) * 3;
+        break;
+    }
+    return r->count > 0;
+}
+
+// draw one layer around road index idx. same range as draw_roads() and draw_trees()
+// lod : level of detail, 0 = full mesh
+void roadmesh_draw(const ROADMESH *m, int layer, int stg, int idx, int num, int lod)
+{
+    ROADMESH_RANGE r;
+    if (!roadmesh_get_range(m, layer, stg, idx, num, lod, &r))
+        return;
+
+    GLenum mode = (r.strip) ? GL_TRIANGLE_STRIP : GL_TRIANGLES;
+    if (r.idx == NULL)
+        glDrawArrays(mode, r.first, r.count);
+    else if (m->vbo != 0)
+        glDrawElements(mode, r.count, GL_UNSIGNED_INT, (const void *)(sizeof(unsigned int) * r.idx_ofs));
+    else
+        glDrawElements(mode, r.count, GL_UNSIGNED_INT, r.idx);
+}
+
+// vertex indices of every step-th tree of [t0, t1).
+// sorted = 1 : from far to near, for drawing without depth test.
+// idx : [(t1 - t0) * 3]. return number of indices
+int roadmesh_get_tree_idx(const ROADMESH *m, int stg, int t0, int t1, int step, int sorted, unsigned int *idx)
+{
+    int n = 0;
+    if (sorted)
+    {
+        for (int i = 0; i < m->tree_num; i++)
+        {
+            int t = m->tree_order[i];
+            if (t < t0 || t >= t1 || t % step != 0)
+                continue;
+            unsigned int k = m->tree_first[stg] + t * 3;
+            idx[n++] = k;
+            idx[n++] = k + 1;
+            idx[n++] = k + 2;
+        }
+        return n;
+    }
+
+    // trees in order, from multiple of step
+    for (int t = (t0 + step - 1) / step * step; t < t1; t += step)
+    {
+        unsigned int k = m->tree_first[stg] + t * 3;
+        idx[n++] = k;
+        idx[n++] = k + 1;
+        idx[n++] = k + 2;
+    }
+    return n;
+}
+
+// get segment range [s0, s1) drawn around road index idx. same range as draw_roads()
+void roadmesh_get_seg_range(const ROADMESH *m, int idx, int num, int *s0, int *s1)
+{
+    int a = idx - num;
+    int b = idx + num - 1;
+    if (a < 0)
+        a = 0;
+    if (b > m->roads_len - 2)
+        b = m->roads_len - 2;
+    *s0 = a;
+    *s1 = (b > a) ? b : a;
+}
+
+// get tree range [t0, t1) drawn around road index idx. same range as draw_trees()
+void roadmesh_get_tree_range(const ROADMESH *m, int idx, int num, int *t0, int *t1)
+{
+    int a = idx - num;
+    int b = idx + num;
+    if (a < 0)
+        a = 0;
+    if (b > m->roads_len)
+        b = m->roads_len;
+    if (b < a)
+        b = a;
+    *t0 = m->tree_ofs[a];
+    *t1 = m->tree_ofs[b];
+}
+
+// band of segment s of rows
+int roadmesh_get_band(const ROADMESH *m, int s)
+{
+    return m->rows[s + 1].band;
+}
+
+// end of band k in segments of rows, not beyond s1
+int roadmesh_get_band_end(const ROADMESH *m, int k, int s1)
+{
+    int e = m->band_first[k + 1];
+    return (e < s1) ? e : s1;
+}
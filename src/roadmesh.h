@@ -0,0 +1,160 @@
+// Last updated: <2026/10/20 14:03:18 +0900>
+//
+// Static course geometry. Built once per course, shared by all views.
+
+#ifndef __ROADMESH_H__
+#define __ROADMESH_H__
+
+#include "roads.h"
+
+// road colors
+const float road_shadow_col[4] = {0.2, 0.2, 0.2, 1.0};
+const float road_cols[2][4] = {
+    {0.3, 0.4, 0.45, 1.0},   // even band, with white line
+    {0.35, 0.45, 0.50, 1.0}, // odd band
+};
+const float road_line_col[4] = {1.0, 1.0, 1.0, 1.0};
+
+// simplified road. mean of even and odd band
+const float road_lod_col[4] = {0.325, 0.425, 0.475, 1.0};
+
+// length of color band and white line dash along road (world unit).
+// ends of band closer than ROADMESH_BAND_EPS to road data are on it
+#define ROADMESH_BAND_LEN 32.0
+#define ROADMESH_BAND_EPS 0.01
+
+// polygon height
+#define ROAD_SHADOW_Y 0.0
+#define ROAD_Y 5.0
+#define ROAD_LINE_Y 5.1
+
+#define ROADMESH_STG_MAX 4
+#define ROADMESH_TREE_COL_MAX 6
+
+#define ROADMESH_RESTART_INDEX 0xffffffff
+
+// level of detail. level 0 is full mesh, level n (> 0) is simplified
+// by Douglas-Peucker with error of ROADMESH_LOD_TOL * 2^(n - 1) (world unit)
+#define ROADMESH_LOD_MAX 4
+#define ROADMESH_LOD_TOL 2.0
+
+// simplified levels are used when segments are shorter than this (pixel),
+// and error of level must be smaller than ROADMESH_LOD_ERR_PX (pixel)
+#define ROADMESH_LOD_SEG_PX 4.0
+#define ROADMESH_LOD_ERR_PX 0.5
+
+// palette index of each vertex. Used by shader renderer,
+// which gets colors of stage from uniform buffer
+enum
+{
+    ROADMESH_PAL_SHADOW,
+    ROADMESH_PAL_ROAD,      // even, odd
+    ROADMESH_PAL_LINE = 3,
+    ROADMESH_PAL_TREE,      // + tree color number
+    ROADMESH_PAL_LOD = ROADMESH_PAL_TREE + ROADMESH_TREE_COL_MAX, // simplified road
+    ROADMESH_PAL_MAX,
+};
+
+// layers. drawn in this order
+enum
+{
+    ROADMESH_SHADOW,
+    ROADMESH_ROAD,
+    ROADMESH_LINE,
+    ROADMESH_TREE,
+    ROADMESH_LAYER_MAX,
+};
+
+// ----------------------------------------
+// Vertices are stored in float, relative to (ox, -oy).
+// Segment s is between road data s and s + 1. Arguments idx, s0, s1 of
+// functions are indices of road data.
+//
+// Shadow, road and white line are made from rows: the road data with the
+// segments over an end of color band split there, and band set in each row.
+// Segment s of rows is between rows s and s + 1, and its band is in row s + 1.
+// Shadow and road are one triangle strip each, 2 vertices (edge) per row.
+// Each vertex has the color of the segment that ends at it, because
+// flat shading uses the last vertex of triangle.
+// White line pieces are 4 vertices per segment of even band, drawn as indexed
+// strips separated by primitive restart (or degenerate triangles on old OpenGL).
+//
+// Simplified levels keep some road data (rows) of the center line only.
+// Their road is one color, and white line is not drawn (thinner than pixel).
+typedef struct roadmesh
+{
+    int built;
+    int roads_len;
+    double ox; // origin x
+    double oy; // origin y
+
+    int seg_num;
+    int line_num; // white line exists on segments of even band only
+    int tree_num;
+    double seg_len; // mean length of segment
+
+    // all layers in one array
+    int vtx_num;
+    float *vtx;                          // [vtx_num][3]
+    float *col;                          // [vtx_num][4]
+    unsigned char *pal;                  // [vtx_num] palette index
+    int shadow_first;                    // [row_num * 2]
+    int road_first;                      // [row_num * 2]
+    int line_first;                      // [line_num * 4]
+    int *line_ofs;                       // [row_num] first white line piece of segment s of rows
+    int tree_first[ROADMESH_STG_MAX];    // [tree_num * 3] per stage color
+    int *tree_ofs;                       // [roads_len + 1] first tree of road data i
+    int *tree_road;                      // [tree_num] road data of tree t
+    int *tree_order;                     // [tree_num] trees from far to near
+
+    // rows split at ends of color bands
+    int row_num;
+    ROADDATA *rows;  // [row_num]
+    int *row_ofs;    // [roads_len + 1] row of road data i
+    int band_num;
+    int *band_first; // [band_num + 2] first segment of rows in band k, and sentinels
+
+    // simplified levels. index 0 is not used
+    int lod_num[ROADMESH_LOD_MAX];   // rows of level
+    int lod_first[ROADMESH_LOD_MAX]; // [lod_num * 2] shadow, and [lod_num * 2] road
+    int *lod_row[ROADMESH_LOD_MAX];  // [lod_num] road data index of row
+
+    unsigned int *line_idx;       // [line_num * 5] 4 vertices + restart
+    unsigned int *line_idx_degen; // [line_num * 6] first and last vertices doubled
+
+    // buffer objects. 0 = use client side arrays
+    unsigned int vbo;
+    unsigned int ibo;
+} ROADMESH;
+
+// vertices of one layer to draw. triangle strip or triangles
+typedef struct roadmesh_range
+{
+    int strip;
+    int first; // arrays [first, first + count) if idx is NULL
+    int count;
+    const unsigned int *idx; // [count] indices, strips separated by restart or degenerate triangles
+    int idx_ofs;             // offset of idx in index buffer (unsigned int)
+} ROADMESH_RANGE;
+
+// ----------------------------------------
+// prototype declaration
+void roadmesh_build(ROADMESH *m, const ROADDATA *roads, int roads_len,
+                    const float tree_cols[ROADMESH_STG_MAX][ROADMESH_TREE_COL_MAX][4]);
+void roadmesh_free(ROADMESH *m);
+void roadmesh_upload(ROADMESH *m);
+void roadmesh_release(ROADMESH *m);
+void roadmesh_bind(const ROADMESH *m);
+void roadmesh_unbind(void);
+int roadmesh_get_col_offset(const ROADMESH *m);
+int roadmesh_get_pal_offset(const ROADMESH *m);
+int roadmesh_get_lod(const ROADMESH *m, double unit_per_px);
+int roadmesh_get_range(const ROADMESH *m, int layer, int stg, int idx, int num, int lod, ROADMESH_RANGE *r);
+void roadmesh_draw(const ROADMESH *m, int layer, int stg, int idx, int num, int lod);
+void roadmesh_get_seg_range(const ROADMESH *m, int idx, int num, int *s0, int *s1);
+void roadmesh_get_tree_range(const ROADMESH *m, int idx, int num, int *t0, int *t1);
+int roadmesh_get_tree_idx(const ROADMESH *m, int stg, int t0, int t1, int step, int sorted, unsigned int *idx);
+int roadmesh_get_band(const ROADMESH *m, int s);
+int roadmesh_get_band_end(const ROADMESH *m, int k, int s1);
+
+#endif
@@ -18,6 +18,7 @@ typedef struct roaddata
   double tx;  // tree x
   double ty;  // tree y
   double r;   // tree size
+  int band;   // color band of segment ending here, set on rows of roadmesh. white line on even band
 } ROADDATA;
 
 #endif
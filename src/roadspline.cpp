@@ -0,0 +1,512 @@
+// Last updated: <2026/10/20 13:05:12 +0900>
+//
+// Course from control points. Same road data as make_spline_road.py made,
+// but built at startup.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "roadspline.h"
+
+// steps of arc length table per span of control points
+#define ARC_DIV 16
+
+// limit of recursion
+#define SUBDIV_DEPTH_MAX 16
+
+typedef struct spline
+{
+    int num;       // control points
+    double ox;     // origin. first control point
+    double oy;
+    double *t;     // [num] parameter (chord length)
+    double *x;     // [num] position relative to origin
+    double *y;     // [num]
+    double *mx;    // [num] second derivative
+    double *my;    // [num]
+    int arc_num;   // (num - 1) * ARC_DIV + 1
+    double *arc_s; // [arc_num] arc length
+    double *arc_t; // [arc_num] parameter
+} SPLINE;
+
+// road data in cells of grid, for test of trees on road
+typedef struct rowgrid
+{
+    double x0;   // corner of cell 0
+    double y0;
+    double cell; // size of cell
+    int cols;
+    int rows;
+    int *first;  // [cols * rows + 1] first entry of cell in idx
+    int *idx;    // [len] road data index sorted by cell
+} ROWGRID;
+
+typedef struct pointbuf
+{
+    int num;
+    int max;
+    double *p; // [max][2]
+} POINTBUF;
+
+// ----------------------------------------
+// prototype declaration
+static void solve_spline(const double *t, const double *y, int n, double *m);
+static void init_spline(SPLINE *sp, const double (*pts)[2], int num);
+static void free_spline(SPLINE *sp);
+static void eval_spline(const SPLINE *sp, double t, double *x, double *y);
+static void make_arc_table(SPLINE *sp);
+static double get_param(const SPLINE *sp, double s);
+static void add_point(POINTBUF *b, double x, double y);
+static double get_line_dist(double px, double py, double x0, double y0, double x1, double y1);
+static void subdivide(const SPLINE *sp, double s0, double s1, const double *p0, const double *p1,
+                      POINTBUF *b, int depth);
+static double get_rand(unsigned int *state);
+static void make_edges(ROADDATA *roads, int len);
+static void init_grid(ROWGRID *g, const ROADDATA *roads, int len, double cell);
+static void free_grid(ROWGRID *g);
+static int get_cell(const ROWGRID *g, double x, double y, int *cx, int *cy);
+static int is_on_road(const ROWGRID *g, const ROADDATA *roads, double x, double y, double d);
+static void make_trees(ROADDATA *roads, int len, unsigned int seed, double spacing);
+
+// ========================================
+// second derivatives of natural cubic spline y(t). tridiagonal system
+static void solve_spline(const double *t, const double *y, int n, double *m)
+{
+    double *c = (double *)malloc(sizeof(double) * n);
+    double *d = (double *)malloc(sizeof(double) * n);
+
+    c[0] = 0.0;
+    d[0] = 0.0;
+    for (int i = 1; i < n - 1; i++)
+    {
+        double h0 = t[i] - t[i - 1];
+        double h1 = t[i + 1] - t[i];
+        double r = 6.0 * ((y[i + 1] - y[i]) / h1 - (y[i] - y[i - 1]) / h0);
+        double w = 2.0 * (h0 + h1) - h0 * c[i - 1];
+        c[i] = h1 / w;
+        d[i] = (r - h0 * d[i - 1]) / w;
+    }
+
+    m[0] = 0.0;
+    m[n - 1] = 0.0;
+    for (int i = n - 2; i >= 1; i--)
+        m[i] = d[i] - c[i] * m[i + 1];
+
+    free(d);
+    free(c);
+}
+
+// same points are skipped
+static void init_spline(SPLINE *sp, const double (*pts)[2], int num)
+{
+    memset(sp, 0, sizeof(SPLINE));
+    if (num <= 0)
+        return;
+
+    sp->t = (double *)malloc(sizeof(double) * num);
+    sp->x = (double *)malloc(sizeof(double) * num);
+    sp->y = (double *)malloc(sizeof(double) * num);
+    sp->mx = (double *)malloc(sizeof(double) * num);
+    sp->my = (double *)malloc(sizeof(double) * num);
+
+    sp->ox = pts[0][0];
+    sp->oy = pts[0][1];
+    int n = 0;
+    for (int i = 0; i < num; i++)
+    {
+        double x = pts[i][0] - sp->ox;
+        double y = pts[i][1] - sp->oy;
+        double d = (n > 0) ? hypot(x - sp->x[n - 1], y - sp->y[n - 1]) : 0.0;
+        if (n > 0 && d < 1.0e-6)
+            continue;
+
+        sp->t[n] = (n > 0) ? sp->t[n - 1] + d : 0.0;
+        sp->x[n] = x;
+        sp->y[n] = y;
+        n++;
+    }
+    sp->num = n;
+    if (n < 2)
+        return;
+
+    solve_spline(sp->t, sp->x, n, sp->mx);
+    solve_spline(sp->t, sp->y, n, sp->my);
+}
+
+static void free_spline(SPLINE *sp)
+{
+    free(sp->t);
+    free(sp->x);
+    free(sp->y);
+    free(sp->mx);
+    free(sp->my);
+    free(sp->arc_s);
+    free(sp->arc_t);
+    memset(sp, 0, sizeof(SPLINE));
+}
+
+static void eval_spline(const SPLINE *sp, double t, double *x, double *y)
+{
+    // span i, t[i] <= t
+    int lo = 0;
+    int hi = sp->num - 2;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (sp->t[mid] <= t)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    int i = lo;
+    double h = sp->t[i + 1] - sp->t[i];
+    double a = (sp->t[i + 1] - t) / h;
+    double b = 1.0 - a;
+    double k = h * h / 6.0;
+    *x = a * sp->x[i] + b * sp->x[i + 1] + ((a * a * a - a) * sp->mx[i] + (b * b * b - b) * sp->mx[i + 1]) * k;
+    *y = a * sp->y[i] + b * sp->y[i + 1] + ((a * a * a - a) * sp->my[i] + (b * b * b - b) * sp->my[i + 1]) * k;
+}
+
+// arc length at ARC_DIV steps of each span
+static void make_arc_table(SPLINE *sp)
+{
+    sp->arc_num = (sp->num - 1) * ARC_DIV + 1;
+    sp->arc_s = (double *)malloc(sizeof(double) * sp->arc_num);
+    sp->arc_t = (double *)malloc(sizeof(double) * sp->arc_num);
+
+    double px = sp->x[0];
+    double py = sp->y[0];
+    sp->arc_s[0] = 0.0;
+    sp->arc_t[0] = sp->t[0];
+    for (int j = 1; j < sp->arc_num; j++)
+    {
+        int i = (j - 1) / ARC_DIV;
+        int k = j - i * ARC_DIV;
+        double t = sp->t[i] + (sp->t[i + 1] - sp->t[i]) * k / ARC_DIV;
+        double x, y;
+        eval_spline(sp, t, &x, &y);
+        sp->arc_s[j] = sp->arc_s[j - 1] + hypot(x - px, y - py);
+        sp->arc_t[j] = t;
+        px = x;
+        py = y;
+    }
+}
+
+// parameter at arc length s
+static double get_param(const SPLINE *sp, double s)
+{
+    int lo = 0;
+    int hi = sp->arc_num - 2;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (sp->arc_s[mid] <= s)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    double ds = sp->arc_s[lo + 1] - sp->arc_s[lo];
+    double f = (ds > 0.0) ? (s - sp->arc_s[lo]) / ds : 0.0;
+    if (f < 0.0)
+        f = 0.0;
+    if (f > 1.0)
+        f = 1.0;
+    return sp->arc_t[lo] + (sp->arc_t[lo + 1] - sp->arc_t[lo]) * f;
+}
+
+static void add_point(POINTBUF *b, double x, double y)
+{
+    if (b->num >= b->max)
+    {
+        b->max = (b->max > 0) ? b->max * 2 : 1024;
+        b->p = (double *)realloc(b->p, sizeof(double) * 2 * b->max);
+    }
+    b->p[b->num * 2 + 0] = x;
+    b->p[b->num * 2 + 1] = y;
+    b->num++;
+}
+
+// distance between point and line segment (x0, y0) - (x1, y1)
+static double get_line_dist(double px, double py, double x0, double y0, double x1, double y1)
+{
+    double dx = x1 - x0;
+    double dy = y1 - y0;
+    double l2 = dx * dx + dy * dy;
+    double t = 0.0;
+    if (l2 > 0.0)
+    {
+        t = ((px - x0) * dx + (py - y0) * dy) / l2;
+        if (t < 0.0)
+            t = 0.0;
+        if (t > 1.0)
+            t = 1.0;
+    }
+    return hypot(x0 + dx * t - px, y0 + dy * t - py);
+}
+
+// add points of curve between arc length s0 (p0) and s1 (p1), except p0.
+// divided at middle of arc length while chord error is larger than tolerance
+static void subdivide(const SPLINE *sp, double s0, double s1, const double *p0, const double *p1,
+                      POINTBUF *b, int depth)
+{
+    double len = s1 - s0;
+    int split = 0;
+    if (len > ROADSPLINE_SEG_MIN * 2.0 && depth < SUBDIV_DEPTH_MAX)
+    {
+        for (int k = 1; k <= 3 && !split; k++)
+        {
+            double x, y;
+            eval_spline(sp, get_param(sp, s0 + len * k / 4.0), &x, &y);
+            if (get_line_dist(x, y, p0[0], p0[1], p1[0], p1[1]) > ROADSPLINE_TOL)
+                split = 1;
+        }
+    }
+
+    if (!split)
+    {
+        add_point(b, p1[0], p1[1]);
+        return;
+    }
+
+    double sm = (s0 + s1) * 0.5;
+    double pm[2];
+    eval_spline(sp, get_param(sp, sm), &pm[0], &pm[1]);
+    subdivide(sp, s0, sm, p0, pm, b, depth + 1);
+    subdivide(sp, sm, s1, pm, p1, b, depth + 1);
+}
+
+// xorshift. return 0.0 - 1.0 (not include 1.0)
+static double get_rand(unsigned int *state)
+{
+    unsigned int v = *state;
+    v ^= v << 13;
+    v ^= v >> 17;
+    v ^= v << 5;
+    *state = v;
+    return (v >> 8) / 16777216.0;
+}
+
+// road edge and white line edge. the last road data has no edge
+static void make_edges(ROADDATA *roads, int len)
+{
+    for (int i = 0; i < len - 1; i++)
+    {
+        ROADDATA *r = &roads[i];
+        double xd = roads[i + 1].cx - r->cx;
+        double yd = roads[i + 1].cy - r->cy;
+        double lg = hypot(xd, yd);
+        double wx = xd / lg;
+        double wy = yd / lg;
+
+        r->rx0 = r->cx - wy * ROADSPLINE_ROAD_W;
+        r->ry0 = r->cy + wx * ROADSPLINE_ROAD_W;
+        r->rx1 = r->cx + wy * ROADSPLINE_ROAD_W;
+        r->ry1 = r->cy - wx * ROADSPLINE_ROAD_W;
+
+        r->lx0 = r->cx - wy * ROADSPLINE_LINE_W;
+        r->ly0 = r->cy + wx * ROADSPLINE_LINE_W;
+        r->lx1 = r->cx + wy * ROADSPLINE_LINE_W;
+        r->ly1 = r->cy - wx * ROADSPLINE_LINE_W;
+    }
+}
+
+// trees on left and right side by turns. not on road
+// cell must not be smaller than distance of is_on_road()
+static void init_grid(ROWGRID *g, const ROADDATA *roads, int len, double cell)
+{
+    double x1 = roads[0].cx;
+    double y1 = roads[0].cy;
+    g->x0 = x1;
+    g->y0 = y1;
+    for (int i = 1; i < len; i++)
+    {
+        g->x0 = fmin(g->x0, roads[i].cx);
+        g->y0 = fmin(g->y0, roads[i].cy);
+        x1 = fmax(x1, roads[i].cx);
+        y1 = fmax(y1, roads[i].cy);
+    }
+
+    // not many more cells than road data
+    for (;;)
+    {
+        g->cols = (int)((x1 - g->x0) / cell) + 1;
+        g->rows = (int)((y1 - g->y0) / cell) + 1;
+        if ((double)g->cols * g->rows <= 4.0 * len + 64.0)
+            break;
+        cell *= 2.0;
+    }
+    g->cell = cell;
+
+    // counting sort by cell
+    int n = g->cols * g->rows;
+    g->first = (int *)calloc(n + 1, sizeof(int));
+    g->idx = (int *)malloc(sizeof(int) * len);
+    int cx, cy;
+    for (int i = 0; i < len; i++)
+    {
+        get_cell(g, roads[i].cx, roads[i].cy, &cx, &cy);
+        g->first[cy * g->cols + cx + 1]++;
+    }
+    for (int k = 0; k < n; k++)
+        g->first[k + 1] += g->first[k];
+    int *pos = (int *)malloc(sizeof(int) * n);
+    memcpy(pos, g->first, sizeof(int) * n);
+    for (int i = 0; i < len; i++)
+    {
+        get_cell(g, roads[i].cx, roads[i].cy, &cx, &cy);
+        g->idx[pos[cy * g->cols + cx]++] = i;
+    }
+    free(pos);
+}
+
+static void free_grid(ROWGRID *g)
+{
+    free(g->first);
+    free(g->idx);
+    memset(g, 0, sizeof(ROWGRID));
+}
+
+// cell of point, clamped to grid. return 0 if point is outside
+static int get_cell(const ROWGRID *g, double x, double y, int *cx, int *cy)
+{
+    double fx = floor((x - g->x0) / g->cell);
+    double fy = floor((y - g->y0) / g->cell);
+    int in = (fx >= 0.0 && fy >= 0.0 && fx < g->cols && fy < g->rows);
+    *cx = (fx < 0.0) ? 0 : (fx >= g->cols) ? g->cols - 1 : (int)fx;
+    *cy = (fy < 0.0) ? 0 : (fy >= g->rows) ? g->rows - 1 : (int)fy;
+    return in;
+}
+
+// 1 if center of any road data is nearer than d to (x, y). d <= cell size
+static int is_on_road(const ROWGRID *g, const ROADDATA *roads, double x, double y, double d)
+{
+    int cx, cy;
+    get_cell(g, x, y, &cx, &cy);
+    for (int j = cy - 1; j <= cy + 1; j++)
+    {
+        for (int i = cx - 1; i <= cx + 1; i++)
+        {
+            if (i < 0 || j < 0 || i >= g->cols || j >= g->rows)
+                continue;
+            int c = j * g->cols + i;
+            for (int k = g->first[c]; k < g->first[c + 1]; k++)
+            {
+                double dx = x - roads[g->idx[k]].cx;
+                double dy = y - roads[g->idx[k]].cy;
+                if (dx * dx + dy * dy < d * d)
+                    return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// trees on left and right side by turns. not on road.
+// spacing : mean length of rows of make_spline_road.py. the probability per row of it
+// is kept per unit length, so long segments are not bare
+static void make_trees(ROADDATA *roads, int len, unsigned int seed, double spacing)
+{
+    unsigned int state = (seed != 0) ? seed : 1;
+    ROWGRID g;
+    init_grid(&g, roads, len, ROADSPLINE_ROAD_W + ROADSPLINE_TREE_R_MAX);
+
+    for (int i = 0; i < len - 1; i++)
+    {
+        ROADDATA *r = &roads[i];
+        double xd = roads[i + 1].cx - r->cx;
+        double yd = roads[i + 1].cy - r->cy;
+        double lg = hypot(xd, yd);
+
+        // same density of trees on long segments
+        if (get_rand(&state) >= ROADSPLINE_TREE_PROB * lg / spacing)
+            continue;
+
+        double wx = xd / lg;
+        double wy = yd / lg;
+        int w = ROADSPLINE_TREE_DIST_MIN
+                + (int)(get_rand(&state) * (ROADSPLINE_TREE_DIST_MAX - ROADSPLINE_TREE_DIST_MIN + 1));
+        if (i % 2 != 0)
+            w = -w;
+        double x = r->cx - wy * w;
+        double y = r->cy + wx * w;
+        int tr = ROADSPLINE_TREE_R_MIN
+                 + (int)(get_rand(&state) * (ROADSPLINE_TREE_R_MAX - ROADSPLINE_TREE_R_MIN + 1));
+        int col = (int)(get_rand(&state) * ROADSPLINE_TREE_COL_MAX);
+
+        if (is_on_road(&g, roads, x, y, tr + ROADSPLINE_ROAD_W))
+            continue;
+
+        r->tfg = 1;
+        r->col = col;
+        r->tx = x;
+        r->ty = y;
+        r->r = tr;
+    }
+    free_grid(&g);
+}
+
+// make road data from control points (x, y). seed : random seed of trees.
+// return array of *len road data (free() by caller), or NULL
+ROADDATA *roadspline_build(const double (*pts)[2], int num, unsigned int seed, int *len)
+{
+    SPLINE sp;
+    POINTBUF b;
+
+    *len = 0;
+    init_spline(&sp, pts, num);
+    if (sp.num < 2)
+    {
+        free_spline(&sp);
+        return NULL;
+    }
+    make_arc_table(&sp);
+
+    // spans of control points are divided to equal pieces not longer than
+    // ROADSPLINE_SEG_MAX, then subdivided by chord error
+    memset(&b, 0, sizeof(POINTBUF));
+    add_point(&b, sp.x[0], sp.y[0]);
+    for (int i = 0; i < sp.num - 1; i++)
+    {
+        double s0 = sp.arc_s[i * ARC_DIV];
+        double s1 = sp.arc_s[(i + 1) * ARC_DIV];
+        int n = (int)ceil((s1 - s0) / ROADSPLINE_SEG_MAX);
+        if (n < 1)
+            n = 1;
+
+        double p0[2] = {b.p[(b.num - 1) * 2], b.p[(b.num - 1) * 2 + 1]};
+        for (int k = 1; k <= n; k++)
+        {
+            double sb = (k < n) ? s0 + (s1 - s0) * k / n : s1;
+            double p1[2];
+            if (k < n)
+                eval_spline(&sp, get_param(&sp, sb), &p1[0], &p1[1]);
+            else
+            {
+                p1[0] = sp.x[i + 1];
+                p1[1] = sp.y[i + 1];
+            }
+            subdivide(&sp, s0 + (s1 - s0) * (k - 1) / n, sb, p0, p1, &b, 0);
+            p0[0] = p1[0];
+            p0[1] = p1[1];
+        }
+    }
+
+    ROADDATA *roads = (ROADDATA *)calloc(b.num, sizeof(ROADDATA));
+    for (int i = 0; i < b.num; i++)
+    {
+        roads[i].cx = sp.ox + b.p[i * 2];
+        roads[i].cy = sp.oy + b.p[i * 2 + 1];
+    }
+    make_edges(roads, b.num);
+
+    // rows of make_spline_road.py were evenly spaced on the curve
+    double spacing = sp.arc_s[sp.arc_num - 1] / (num * ROADSPLINE_TREE_DIV - 1);
+    make_trees(roads, b.num, seed, spacing);
+
+    *len = b.num;
+    free(b.p);
+    free_spline(&sp);
+    return roads;
+}
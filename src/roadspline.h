@@ -0,0 +1,41 @@
+// Last updated: <2026/10/20 13:05:12 +0900>
+//
+// Course from control points. Same road data as make_spline_road.py made,
+// but built at startup.
+//
+// Control points are interpolated by cubic spline (chord length parameter).
+// The curve is reparameterized by arc length, and divided at arc length
+// midpoints until the chord error is within tolerance. Straights get long
+// segments, hairpins get short ones.
+
+#ifndef __ROADSPLINE_H__
+#define __ROADSPLINE_H__
+
+#include "roads.h"
+
+// half width of road and white line (world unit)
+#define ROADSPLINE_ROAD_W 40.0
+#define ROADSPLINE_LINE_W 2.0
+
+// max distance between segment and curve (world unit)
+#define ROADSPLINE_TOL 0.5
+
+// length of segment (world unit)
+#define ROADSPLINE_SEG_MIN 8.0
+#define ROADSPLINE_SEG_MAX 64.0
+
+// trees. probability per row of make_spline_road.py, which made ROADSPLINE_TREE_DIV
+// rows per control point. distance from center, size
+#define ROADSPLINE_TREE_PROB 0.4
+#define ROADSPLINE_TREE_DIV 10
+#define ROADSPLINE_TREE_DIST_MIN 100
+#define ROADSPLINE_TREE_DIST_MAX 400
+#define ROADSPLINE_TREE_R_MIN 25
+#define ROADSPLINE_TREE_R_MAX 50
+#define ROADSPLINE_TREE_COL_MAX 6
+
+// ----------------------------------------
+// prototype declaration
+ROADDATA *roadspline_build(const double (*pts)[2], int num, unsigned int seed, int *len);
+
+#endif
@@ -0,0 +1,851 @@
+// Last updated: <2026/10/20 11:20:05 +0900>
+//
+// Tiled software rasteriser.
+//
+// Triangles are set up when they are submitted: vertices are snapped to
+// 1/256 pixel, clockwise ones are culled or turned, and integer edge
+// functions follow the fill rule of OpenGL with lower left origin: a pixel
+// center on a left or bottom edge is inside. So a pixel on a shared edge is
+// drawn once, and the same pixels as GL are drawn at any window size. Each
+// row of a tile gets its exact span from the edges, then the span is depth
+// tested 4 pixels at once (SSE2) or one by one. Other CPUs use the scalar kernel.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "softrast.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define USE_X86_SIMD
+#include <emmintrin.h>
+#endif
+
+#define CMD_INIT 4096
+#define BIN_INIT 256
+
+// fills span [xs, xe) of one row of triangle. z : depth at xs
+typedef void (*SOFTRAST_KERNEL)(const SOFTRAST_CMD *c, unsigned int *cp, float *zp, int xs, int xe, float z);
+
+static int kernel_kind = SOFTRAST_AUTO;
+static SOFTRAST_KERNEL kernel = NULL;
+
+// ----------------------------------------
+// prototype declaration
+static inline unsigned int blend(unsigned int d, unsigned int s);
+static void mul_matrix(float *m, const float *b);
+static void get_window_matrix(const SOFTRAST *r, float *w);
+static SOFTRAST_CMD *add_cmd(SOFTRAST *r, int type, int x0, int y0, int x1, int y1);
+static inline long long floor_div(long long a, long long b);
+static inline long long edge_at(const SOFTRAST_CMD *c, int i, int x, int y);
+static int tile_is_outside(const SOFTRAST_CMD *c, int x0, int y0, int x1, int y1);
+static void bin_cmd(SOFTRAST *r);
+static void draw_prims(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col,
+                       const unsigned int *idx, int first, int count);
+static int get_span(const SOFTRAST_CMD *c, int y, int xs, int xe, int *pxs, int *pxe, float *z);
+static void span_scalar(const SOFTRAST_CMD *c, unsigned int *cp, float *zp, int xs, int xe, float z);
+#ifdef USE_X86_SIMD
+static void span_sse2(const SOFTRAST_CMD *c, unsigned int *cp, float *zp, int xs, int xe, float z);
+#endif
+static void raster_tri(const SOFTRAST *r, const SOFTRAST_CMD *c, int x0, int y0, int x1, int y1);
+static void raster_tile(void *arg);
+
+// ========================================
+// src over dst by alpha of src. all channels, same as glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA).
+// 2 channels at once, x / 255 rounded
+static inline unsigned int blend(unsigned int d, unsigned int s)
+{
+    unsigned int a = s >> 24;
+    unsigned int ia = 255 - a;
+    unsigned int rb = (s & 0xff00ff) * a + (d & 0xff00ff) * ia + 0x800080;
+    unsigned int ga = ((s >> 8) & 0xff00ff) * a + ((d >> 8) & 0xff00ff) * ia + 0x800080;
+    rb = ((rb + ((rb >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+    ga = ((ga + ((ga >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+    return rb | (ga << 8);
+}
+
+// ----------------------------------------
+// select kernel. SOFTRAST_AUTO selects the fastest one
+void softrast_set_kernel(int kind)
+{
+    if (kind == SOFTRAST_AUTO)
+    {
+        kind = SOFTRAST_SCALAR;
+#ifdef USE_X86_SIMD
+        kind = SOFTRAST_SSE2;
+#endif
+    }
+
+    switch (kind)
+    {
+#ifdef USE_X86_SIMD
+    case SOFTRAST_SSE2:
+        kernel = span_sse2;
+        break;
+#endif
+    default:
+        kind = SOFTRAST_SCALAR;
+        kernel = span_scalar;
+        break;
+    }
+    kernel_kind = kind;
+}
+
+int softrast_get_kernel(void)
+{
+    if (kernel == NULL)
+        softrast_set_kernel(SOFTRAST_AUTO);
+    return kernel_kind;
+}
+
+const char *softrast_get_kernel_name(int kind)
+{
+    static const char *names[SOFTRAST_KIND_MAX] = {"auto", "scalar", "sse2"};
+    if (kind < 0 || kind >= SOFTRAST_KIND_MAX)
+        return "unknown";
+    return names[kind];
+}
+
+// workers : thread pool of tiles, NULL = calling thread
+void softrast_init(SOFTRAST *r, WORKERS *workers)
+{
+    memset(r, 0, sizeof(SOFTRAST));
+    r->workers = workers;
+    if (kernel == NULL)
+        softrast_set_kernel(SOFTRAST_AUTO);
+}
+
+void softrast_free(SOFTRAST *r)
+{
+    int n = r->tile_cols * r->tile_rows;
+    for (int i = 0; i < n; i++)
+        free(r->bins[i].cmd);
+    free(r->bins);
+    free(r->jobs);
+    free(r->cmd);
+    free(r->color);
+    free(r->depth);
+    memset(r, 0, sizeof(SOFTRAST));
+}
+
+// start commands of w x h pixels. contents of buffers are kept if size is same
+void softrast_begin(SOFTRAST *r, int w, int h)
+{
+    if (w < 1)
+        w = 1;
+    if (h < 1)
+        h = 1;
+
+    if (w != r->w || h != r->h)
+    {
+        int n = r->tile_cols * r->tile_rows;
+        for (int i = 0; i < n; i++)
+            free(r->bins[i].cmd);
+
+        r->w = w;
+        r->h = h;
+        r->color = (unsigned int *)realloc(r->color, sizeof(unsigned int) * w * h);
+        r->depth = (float *)realloc(r->depth, sizeof(float) * w * h);
+        memset(r->color, 0, sizeof(unsigned int) * w * h);
+        for (int i = 0; i < w * h; i++)
+            r->depth[i] = 1.0;
+
+        r->tile_cols = (w + SOFTRAST_TILE - 1) / SOFTRAST_TILE;
+        r->tile_rows = (h + SOFTRAST_TILE - 1) / SOFTRAST_TILE;
+        n = r->tile_cols * r->tile_rows;
+        r->bins = (SOFTRAST_BIN *)realloc(r->bins, sizeof(SOFTRAST_BIN) * n);
+        r->jobs = (SOFTRAST_JOB *)realloc(r->jobs, sizeof(SOFTRAST_JOB) * n);
+        memset(r->bins, 0, sizeof(SOFTRAST_BIN) * n);
+        for (int i = 0; i < n; i++)
+        {
+            r->jobs[i].r = r;
+            r->jobs[i].tile = i;
+        }
+    }
+
+    int n = r->tile_cols * r->tile_rows;
+    for (int i = 0; i < n; i++)
+        r->bins[i].num = 0;
+    r->cmd_num = 0;
+    r->tris = 0;
+
+    softrast_set_view(r, 0, 0, w, h);
+    softrast_set_ortho(r, 1.0, 1.0, 1.0);
+    softrast_load_identity(r);
+    softrast_set_state(r, 0, 0, 0);
+}
+
+// rasterise all commands. tiles in parallel
+void softrast_flush(SOFTRAST *r)
+{
+    if (r->cmd_num == 0)
+        return;
+
+    int n = r->tile_cols * r->tile_rows;
+    if (r->workers == NULL || r->workers->num <= 1)
+    {
+        for (int i = 0; i < n; i++)
+            raster_tile(&r->jobs[i]);
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (r->bins[i].num > 0)
+                workers_push(r->workers, raster_tile, &r->jobs[i]);
+        }
+        workers_wait(r->workers);
+    }
+
+    for (int i = 0; i < n; i++)
+        r->bins[i].num = 0;
+    r->cmd_num = 0;
+}
+
+// ----------------------------------------
+// state
+
+// viewport and scissor
+void softrast_set_view(SOFTRAST *r, int x, int y, int w, int h)
+{
+    r->vx = x;
+    r->vy = y;
+    r->vw = w;
+    r->vh = h;
+}
+
+// glOrtho(-w, w, -h, h, -zfar, zfar)
+void softrast_set_ortho(SOFTRAST *r, float w, float h, float zfar)
+{
+    memset(r->proj, 0, sizeof(r->proj));
+    r->proj[0] = 1.0 / w;
+    r->proj[5] = 1.0 / h;
+    r->proj[10] = -1.0 / zfar;
+    r->proj[15] = 1.0;
+}
+
+void softrast_load_identity(SOFTRAST *r)
+{
+    memset(r->mv, 0, sizeof(r->mv));
+    r->mv[0] = r->mv[5] = r->mv[10] = r->mv[15] = 1.0;
+}
+
+// m = m * b. column major
+static void mul_matrix(float *m, const float *b)
+{
+    float t[16];
+    for (int c = 0; c < 4; c++)
+    {
+        for (int k = 0; k < 4; k++)
+            t[c * 4 + k] = m[k] * b[c * 4] + m[4 + k] * b[c * 4 + 1] + m[8 + k] * b[c * 4 + 2] + m[12 + k] * b[c * 4 + 3];
+    }
+    memcpy(m, t, sizeof(t));
+}
+
+void softrast_translate(SOFTRAST *r, float x, float y, float z)
+{
+    float t[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, x, y, z, 1};
+    mul_matrix(r->mv, t);
+}
+
+// same as glRotatef()
+void softrast_rotate(SOFTRAST *r, float deg, float x, float y, float z)
+{
+    float l = sqrt(x * x + y * y + z * z);
+    if (l <= 0.0)
+        return;
+    x /= l;
+    y /= l;
+    z /= l;
+
+    float a = deg * M_PI / 180.0;
+    float c = cos(a);
+    float s = sin(a);
+    float d = 1.0 - c;
+    float t[16] = {
+        x * x * d + c, y * x * d + z * s, x * z * d - y * s, 0,
+        x * y * d - z * s, y * y * d + c, y * z * d + x * s, 0,
+        x * z * d + y * s, y * z * d - x * s, z * z * d + c, 0,
+        0, 0, 0, 1};
+    mul_matrix(r->mv, t);
+}
+
+void softrast_scale(SOFTRAST *r, float s)
+{
+    float t[16] = {s, 0, 0, 0, 0, s, 0, 0, 0, 0, s, 0, 0, 0, 0, 1};
+    mul_matrix(r->mv, t);
+}
+
+void softrast_set_state(SOFTRAST *r, int cull, int depth_test, int lighting)
+{
+    r->cull = cull;
+    r->depth_test = depth_test;
+    r->lighting = lighting;
+}
+
+// directional light in eye space. color = min(col * (amb + dif * max(n . dir, 0)), 1)
+void softrast_set_light(SOFTRAST *r, const float dir[3], float amb, float dif)
+{
+    float l = sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    for (int i = 0; i < 3; i++)
+        r->light_dir[i] = (l > 0.0) ? dir[i] / l : 0.0;
+    r->light_amb = amb;
+    r->light_dif = dif;
+}
+
+unsigned int softrast_pack_col(const float col[4])
+{
+    unsigned int v = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        float c = col[i];
+        int k = (c <= 0.0) ? 0 : (c >= 1.0) ? 255 : (int)(c * 255.0 + 0.5);
+        v |= (unsigned int)k << (i * 8);
+    }
+    return v;
+}
+
+// object -> window (x, y pixel and depth 0 - 1). 3 rows of 4, row major
+static void get_window_matrix(const SOFTRAST *r, float *w)
+{
+    float m[16];
+    memcpy(m, r->proj, sizeof(m));
+    mul_matrix(m, r->mv);
+
+    const float sc[3] = {r->vw * 0.5f, r->vh * 0.5f, 0.5f};
+    const float of[3] = {r->vx + r->vw * 0.5f, r->vy + r->vh * 0.5f, 0.5f};
+    for (int k = 0; k < 3; k++)
+    {
+        for (int c = 0; c < 4; c++)
+            w[k * 4 + c] = m[c * 4 + k] * sc[k];
+        w[k * 4 + 3] += of[k];
+    }
+}
+
+// ----------------------------------------
+// commands
+
+// new command of rect clipped by scissor. NULL if rect is empty
+static SOFTRAST_CMD *add_cmd(SOFTRAST *r, int type, int x0, int y0, int x1, int y1)
+{
+    if (x0 < r->vx)
+        x0 = r->vx;
+    if (y0 < r->vy)
+        y0 = r->vy;
+    if (x1 > r->vx + r->vw)
+        x1 = r->vx + r->vw;
+    if (y1 > r->vy + r->vh)
+        y1 = r->vy + r->vh;
+    if (x0 < 0)
+        x0 = 0;
+    if (y0 < 0)
+        y0 = 0;
+    if (x1 > r->w)
+        x1 = r->w;
+    if (y1 > r->h)
+        y1 = r->h;
+    if (x1 <= x0 || y1 <= y0)
+        return NULL;
+
+    if (r->cmd_num >= r->cmd_max)
+    {
+        r->cmd_max = (r->cmd_max > 0) ? r->cmd_max * 2 : CMD_INIT;
+        r->cmd = (SOFTRAST_CMD *)realloc(r->cmd, sizeof(SOFTRAST_CMD) * r->cmd_max);
+    }
+    SOFTRAST_CMD *c = &r->cmd[r->cmd_num];
+    c->type = type;
+    c->flags = 0;
+    c->x0 = x0;
+    c->y0 = y0;
+    c->x1 = x1;
+    c->y1 = y1;
+    return c;
+}
+
+// a / b rounded down. b > 0
+static inline long long floor_div(long long a, long long b)
+{
+    return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+// edge i of triangle at center of pixel (x, y)
+static inline long long edge_at(const SOFTRAST_CMD *c, int i, int x, int y)
+{
+    long long dx = (long long)x * SOFTRAST_SUBPIX + SOFTRAST_SUBPIX / 2 - c->fx;
+    long long dy = (long long)y * SOFTRAST_SUBPIX + SOFTRAST_SUBPIX / 2 - c->fy;
+    return c->a[i] * dx + c->b[i] * dy + c->c[i];
+}
+
+// 1 if no pixel center of tile is inside triangle
+static int tile_is_outside(const SOFTRAST_CMD *c, int x0, int y0, int x1, int y1)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        // corner of largest edge value
+        int x = (c->a[i] > 0) ? x1 - 1 : x0;
+        int y = (c->b[i] > 0) ? y1 - 1 : y0;
+        if (edge_at(c, i, x, y) < 0)
+            return 1;
+    }
+    return 0;
+}
+
+// add last command to bins of tiles under its rect
+static void bin_cmd(SOFTRAST *r)
+{
+    int ci = r->cmd_num++;
+    const SOFTRAST_CMD *c = &r->cmd[ci];
+    int tx0 = c->x0 / SOFTRAST_TILE;
+    int ty0 = c->y0 / SOFTRAST_TILE;
+    int tx1 = (c->x1 - 1) / SOFTRAST_TILE;
+    int ty1 = (c->y1 - 1) / SOFTRAST_TILE;
+    int test = (c->type == SOFTRAST_CMD_TRI && (tx0 != tx1 || ty0 != ty1));
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            int x = tx * SOFTRAST_TILE;
+            int y = ty * SOFTRAST_TILE;
+            if (test && tile_is_outside(c, x, y, x + SOFTRAST_TILE, y + SOFTRAST_TILE))
+                continue;
+
+            SOFTRAST_BIN *b = &r->bins[ty * r->tile_cols + tx];
+            if (b->num >= b->max)
+            {
+                b->max = (b->max > 0) ? b->max * 2 : BIN_INIT;
+                b->cmd = (int *)realloc(b->cmd, sizeof(int) * b->max);
+            }
+            b->cmd[b->num++] = ci;
+        }
+    }
+}
+
+// bits : SOFTRAST_COLOR, SOFTRAST_DEPTH. current view
+void softrast_clear(SOFTRAST *r, int bits, const float col[4], float depth)
+{
+    SOFTRAST_CMD *c = add_cmd(r, SOFTRAST_CMD_CLEAR, r->vx, r->vy, r->vx + r->vw, r->vy + r->vh);
+    if (c == NULL)
+        return;
+    c->flags = bits;
+    c->col = softrast_pack_col(col);
+    c->z = depth;
+    bin_cmd(r);
+}
+
+// fill current view, blended by alpha of col
+void softrast_fill(SOFTRAST *r, const float col[4])
+{
+    SOFTRAST_CMD *c = add_cmd(r, SOFTRAST_CMD_FILL, r->vx, r->vy, r->vx + r->vw, r->vy + r->vh);
+    if (c == NULL)
+        return;
+    c->col = softrast_pack_col(col);
+    bin_cmd(r);
+}
+
+// same as glBitmap() at window position (x, y). bits must be kept until softrast_flush()
+void softrast_bitmap(SOFTRAST *r, int x, int y, int w, int h, const unsigned char *bits, unsigned int col)
+{
+    SOFTRAST_CMD *c = add_cmd(r, SOFTRAST_CMD_BITMAP, x, y, x + w, y + h);
+    if (c == NULL)
+        return;
+    c->col = col;
+    c->src = bits;
+    c->w = w;
+    c->h = h;
+    c->px = x;
+    c->py = y;
+    bin_cmd(r);
+}
+
+// stretch RGBA8 of sw x sh to rect (x, y, w, h), nearest pixel. src must be kept until softrast_flush()
+void softrast_stretch(SOFTRAST *r, const unsigned int *src, int sw, int sh, int x, int y, int w, int h)
+{
+    if (sw <= 0 || sh <= 0)
+        return;
+    SOFTRAST_CMD *c = add_cmd(r, SOFTRAST_CMD_STRETCH, x, y, x + w, y + h);
+    if (c == NULL)
+        return;
+    c->src = src;
+    c->w = sw;
+    c->h = sh;
+    c->px = x;
+    c->py = y;
+    c->pw = w;
+    c->ph = h;
+    bin_cmd(r);
+}
+
+// flat shaded triangle. p : window x, y (pixel) and depth (0 - 1)
+void softrast_tri(SOFTRAST *r, const float *p0, const float *p1, const float *p2, unsigned int col)
+{
+    const int s = SOFTRAST_SUBPIX;
+    int x[3], y[3];
+    float z[3];
+    const float *p[3] = {p0, p1, p2};
+    for (int i = 0; i < 3; i++)
+    {
+        // also drops NaN
+        if (!(fabsf(p[i][0]) < SOFTRAST_GUARD && fabsf(p[i][1]) < SOFTRAST_GUARD))
+            return;
+        x[i] = (int)floor(p[i][0] * s + 0.5);
+        y[i] = (int)floor(p[i][1] * s + 0.5);
+        z[i] = p[i][2];
+    }
+
+    // counterclockwise = front face
+    long long area = (long long)(x[1] - x[0]) * (y[2] - y[0]) - (long long)(x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0 || (area < 0 && r->cull))
+        return;
+    if (area < 0)
+    {
+        int t;
+        t = x[1], x[1] = x[2], x[2] = t;
+        t = y[1], y[1] = y[2], y[2] = t;
+        float tz = z[1];
+        z[1] = z[2], z[2] = tz;
+    }
+
+    // pixel centers inside bounding box
+    int xmin = (x[0] < x[1]) ? ((x[0] < x[2]) ? x[0] : x[2]) : ((x[1] < x[2]) ? x[1] : x[2]);
+    int xmax = (x[0] > x[1]) ? ((x[0] > x[2]) ? x[0] : x[2]) : ((x[1] > x[2]) ? x[1] : x[2]);
+    int ymin = (y[0] < y[1]) ? ((y[0] < y[2]) ? y[0] : y[2]) : ((y[1] < y[2]) ? y[1] : y[2]);
+    int ymax = (y[0] > y[1]) ? ((y[0] > y[2]) ? y[0] : y[2]) : ((y[1] > y[2]) ? y[1] : y[2]);
+    if (xmax < r->vx * s || ymax < r->vy * s || xmin > (r->vx + r->vw) * s || ymin > (r->vy + r->vh) * s)
+        return;
+    SOFTRAST_CMD *c = add_cmd(r, SOFTRAST_CMD_TRI, (int)-floor_div(s / 2 - xmin, s), (int)-floor_div(s / 2 - ymin, s),
+                              (int)floor_div(xmax - s / 2, s) + 1, (int)floor_div(ymax - s / 2, s) + 1);
+    if (c == NULL)
+        return;
+
+    c->flags = r->depth_test;
+    c->col = col;
+    c->fx = x[0];
+    c->fy = y[0];
+    for (int i = 0; i < 3; i++)
+    {
+        // edge of vertex j -> k. left side is inside
+        int j = (i + 1) % 3;
+        int k = (i + 2) % 3;
+        int a = y[j] - y[k];
+        int b = x[k] - x[j];
+        c->a[i] = a;
+        c->b[i] = b;
+        c->c[i] = (long long)a * (x[0] - x[j]) + (long long)b * (y[0] - y[j]);
+
+        // window y is up. a pixel center just on right or top edge is outside
+        if (!(a > 0 || (a == 0 && b > 0)))
+            c->c[i] -= 1;
+    }
+
+    // depth plane in pixels
+    double dx1 = (double)(x[1] - x[0]) / s, dy1 = (double)(y[1] - y[0]) / s;
+    double dx2 = (double)(x[2] - x[0]) / s, dy2 = (double)(y[2] - y[0]) / s;
+    double ar = dx1 * dy2 - dx2 * dy1;
+    c->ox = (double)x[0] / s;
+    c->oy = (double)y[0] / s;
+    c->z = z[0];
+    c->dzdx = ((z[1] - z[0]) * dy2 - (z[2] - z[0]) * dy1) / ar;
+    c->dzdy = ((z[2] - z[0]) * dx1 - (z[1] - z[0]) * dx2) / ar;
+
+    r->tris++;
+    bin_cmd(r);
+}
+
+// vertex arrays of current matrix and state. vtx [][3], nml [][3] or NULL, col [][4].
+// flat shading, color of last vertex of each triangle
+void softrast_draw(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col, int first, int count)
+{
+    draw_prims(r, mode, vtx, nml, col, NULL, first, count);
+}
+
+// indexed version. strips are separated by SOFTRAST_RESTART_INDEX
+void softrast_draw_idx(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col,
+                       const unsigned int *idx, int count)
+{
+    draw_prims(r, mode, vtx, nml, col, idx, 0, count);
+}
+
+static void draw_prims(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col,
+                       const unsigned int *idx, int first, int count)
+{
+    float w[12];
+    get_window_matrix(r, w);
+
+    // normal matrix. rotation and uniform scale only, normalized later
+    float nm[9];
+    for (int k = 0; k < 3; k++)
+    {
+        for (int c = 0; c < 3; c++)
+            nm[k * 3 + c] = r->mv[c * 4 + k];
+    }
+
+    float p[3][3];
+    int n = 0; // vertices of current triangle or strip
+    int strip = (mode == SOFTRAST_TRIANGLE_STRIP);
+
+    for (int k = 0; k < count; k++)
+    {
+        unsigned int i = (idx) ? idx[k] : (unsigned int)(first + k);
+        if (i == SOFTRAST_RESTART_INDEX)
+        {
+            n = 0;
+            continue;
+        }
+
+        const float *v = &vtx[i * 3];
+        float *q = p[(strip) ? n % 3 : n];
+        for (int j = 0; j < 3; j++)
+            q[j] = w[j * 4] * v[0] + w[j * 4 + 1] * v[1] + w[j * 4 + 2] * v[2] + w[j * 4 + 3];
+        n++;
+        if (n < 3)
+            continue;
+
+        // color of provoking vertex
+        const float *cv = &col[i * 4];
+        float lc[4] = {cv[0], cv[1], cv[2], cv[3]};
+        if (r->lighting)
+        {
+            const float z1[3] = {0.0, 0.0, 1.0};
+            const float *nv = (nml) ? &nml[i * 3] : z1;
+            float e[3];
+            for (int j = 0; j < 3; j++)
+                e[j] = nm[j * 3] * nv[0] + nm[j * 3 + 1] * nv[1] + nm[j * 3 + 2] * nv[2];
+            float l = sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+            float d = (l > 0.0) ? (e[0] * r->light_dir[0] + e[1] * r->light_dir[1] + e[2] * r->light_dir[2]) / l : 0.0;
+            float lit = r->light_amb + r->light_dif * ((d > 0.0) ? d : 0.0);
+            for (int j = 0; j < 3; j++)
+                lc[j] = fminf(lc[j] * lit, 1.0);
+        }
+        unsigned int pc = softrast_pack_col(lc);
+
+        if (!strip)
+        {
+            softrast_tri(r, p[0], p[1], p[2], pc);
+            n = 0;
+            continue;
+        }
+
+        // vertices n - 3, n - 2, n - 1. every other triangle of strip is turned
+        const float *a = p[(n - 3) % 3];
+        const float *b = p[(n - 2) % 3];
+        const float *c = p[(n - 1) % 3];
+        if ((n - 3) & 1)
+            softrast_tri(r, b, a, c, pc);
+        else
+            softrast_tri(r, a, b, c, pc);
+    }
+}
+
+// ----------------------------------------
+// rasterisation
+
+// pixels [*pxs, *pxe) of row y in [xs, xe) that are inside. exact.
+// z : depth at *pxs. return 0 if row is outside
+static int get_span(const SOFTRAST_CMD *c, int y, int xs, int xe, int *pxs, int *pxe, float *z)
+{
+    long long lo = xs, hi = xe;
+    for (int i = 0; i < 3; i++)
+    {
+        // edge is v at xs and changes by st each pixel
+        long long v = edge_at(c, i, xs, y);
+        long long st = (long long)c->a[i] * SOFTRAST_SUBPIX;
+        if (st > 0)
+        {
+            if (v < 0 && (st - 1 - v) / st + xs > lo)
+                lo = (st - 1 - v) / st + xs;
+        }
+        else if (v < 0)
+        {
+            return 0;
+        }
+        else if (st < 0)
+        {
+            if (v / -st + xs + 1 < hi)
+                hi = v / -st + xs + 1;
+        }
+    }
+    if (lo >= hi)
+        return 0;
+
+    double dx = lo + 0.5 - c->ox;
+    double dy = y + 0.5 - c->oy;
+    *z = c->z + c->dzdx * dx + c->dzdy * dy;
+    *pxs = (int)lo;
+    *pxe = (int)hi;
+    return 1;
+}
+
+static void span_scalar(const SOFTRAST_CMD *c, unsigned int *cp, float *zp, int xs, int xe, float z)
+{
+    // locals. stores to zp may alias command
+    const float dz = c->dzdx;
+    const unsigned int col = c->col;
+    const int depth = c->flags;
+    const int opaque = ((col >> 24) == 255);
+
+    for (int x = xs; x < xe; x++)
+    {
+        if (!depth || z < zp[x])
+        {
+            if (depth)
+                zp[x] = z;
+            cp[x] = (opaque) ? col : blend(cp[x], col);
+        }
+        z += dz;
+    }
+}
+
+#ifdef USE_X86_SIMD
+// 4 pixels at once. blended triangles and last pixels of span are scalar
+static void span_sse2(const SOFTRAST_CMD *c, unsigned int *cp, float *zp, int xs, int xe, float z)
+{
+    if ((c->col >> 24) != 255)
+    {
+        span_scalar(c, cp, zp, xs, xe, z);
+        return;
+    }
+
+    const __m128 lane = _mm_set_ps(3.0, 2.0, 1.0, 0.0);
+    const __m128i col = _mm_set1_epi32((int)c->col);
+    const int depth = c->flags;
+    __m128 zv = _mm_add_ps(_mm_set1_ps(z), _mm_mul_ps(_mm_set1_ps(c->dzdx), lane));
+    const __m128 sz = _mm_set1_ps(c->dzdx * 4.0f);
+
+    int x = xs;
+    for (; x + 4 <= xe; x += 4)
+    {
+        int bits = 0xf;
+        __m128 m;
+        if (depth)
+        {
+            __m128 zd = _mm_loadu_ps(zp + x);
+            m = _mm_cmplt_ps(zv, zd);
+            bits = _mm_movemask_ps(m);
+            if (bits != 0)
+                _mm_storeu_ps(zp + x, _mm_or_ps(_mm_and_ps(m, zv), _mm_andnot_ps(m, zd)));
+        }
+        if (bits == 0xf)
+        {
+            _mm_storeu_si128((__m128i *)(cp + x), col);
+        }
+        else if (bits != 0)
+        {
+            __m128i mi = _mm_castps_si128(m);
+            __m128i d = _mm_loadu_si128((const __m128i *)(cp + x));
+            _mm_storeu_si128((__m128i *)(cp + x), _mm_or_si128(_mm_and_si128(mi, col), _mm_andnot_si128(mi, d)));
+        }
+        zv = _mm_add_ps(zv, sz);
+    }
+
+    if (x < xe)
+        span_scalar(c, cp, zp, x, xe, _mm_cvtss_f32(zv));
+}
+#endif
+
+// triangle in rect of tile
+static void raster_tri(const SOFTRAST *r, const SOFTRAST_CMD *c, int x0, int y0, int x1, int y1)
+{
+    for (int y = y0; y < y1; y++)
+    {
+        int xs, xe;
+        float z;
+        if (!get_span(c, y, x0, x1, &xs, &xe, &z))
+            continue;
+        kernel(c, r->color + y * r->w, r->depth + y * r->w, xs, xe, z);
+    }
+}
+
+// all commands of one tile. job of worker thread
+static void raster_tile(void *arg)
+{
+    const SOFTRAST_JOB *j = (const SOFTRAST_JOB *)arg;
+    const SOFTRAST *r = j->r;
+    const SOFTRAST_BIN *b = &r->bins[j->tile];
+    int tx = (j->tile % r->tile_cols) * SOFTRAST_TILE;
+    int ty = (j->tile / r->tile_cols) * SOFTRAST_TILE;
+
+    for (int k = 0; k < b->num; k++)
+    {
+        const SOFTRAST_CMD *c = &r->cmd[b->cmd[k]];
+        int x0 = (c->x0 > tx) ? c->x0 : tx;
+        int y0 = (c->y0 > ty) ? c->y0 : ty;
+        int x1 = (c->x1 < tx + SOFTRAST_TILE) ? c->x1 : tx + SOFTRAST_TILE;
+        int y1 = (c->y1 < ty + SOFTRAST_TILE) ? c->y1 : ty + SOFTRAST_TILE;
+
+        switch (c->type)
+        {
+        case SOFTRAST_CMD_TRI:
+            raster_tri(r, c, x0, y0, x1, y1);
+            break;
+
+        case SOFTRAST_CMD_CLEAR:
+        {
+            const unsigned int col = c->col;
+            const float z = c->z;
+            const int bits = c->flags;
+            for (int y = y0; y < y1; y++)
+            {
+                if (bits & SOFTRAST_COLOR)
+                {
+                    unsigned int *cp = r->color + y * r->w;
+                    for (int x = x0; x < x1; x++)
+                        cp[x] = col;
+                }
+                if (bits & SOFTRAST_DEPTH)
+                {
+                    float *zp = r->depth + y * r->w;
+                    for (int x = x0; x < x1; x++)
+                        zp[x] = z;
+                }
+            }
+            break;
+        }
+
+        case SOFTRAST_CMD_FILL:
+        {
+            const unsigned int col = c->col;
+            if ((col >> 24) == 0)
+                break;
+            for (int y = y0; y < y1; y++)
+            {
+                unsigned int *cp = r->color + y * r->w;
+                for (int x = x0; x < x1; x++)
+                    cp[x] = blend(cp[x], col);
+            }
+            break;
+        }
+
+        case SOFTRAST_CMD_BITMAP:
+        {
+            const unsigned char *bits = (const unsigned char *)c->src;
+            int row = (c->w + 7) / 8;
+            int opaque = ((c->col >> 24) == 255);
+            for (int y = y0; y < y1; y++)
+            {
+                unsigned int *cp = r->color + y * r->w;
+                const unsigned char *bp = bits + (y - c->py) * row;
+                for (int x = x0; x < x1; x++)
+                {
+                    int i = x - c->px;
+                    if (bp[i >> 3] & (0x80 >> (i & 7)))
+                        cp[x] = (opaque) ? c->col : blend(cp[x], c->col);
+                }
+            }
+            break;
+        }
+
+        case SOFTRAST_CMD_STRETCH:
+        {
+            const unsigned int *src = (const unsigned int *)c->src;
+            for (int y = y0; y < y1; y++)
+            {
+                unsigned int *cp = r->color + y * r->w;
+                const unsigned int *sp = src + (int)(((y - c->py) * 2 + 1) * (long)c->h / (c->ph * 2)) * c->w;
+                for (int x = x0; x < x1; x++)
+                    cp[x] = sp[((x - c->px) * 2 + 1) * (long)c->w / (c->pw * 2)];
+            }
+            break;
+        }
+        }
+    }
+}
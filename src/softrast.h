@@ -0,0 +1,160 @@
+// Last updated: <2026/10/20 11:20:05 +0900>
+//
+// Tiled software rasteriser for machines without GPU.
+// Draws the primitives of this scene into RGBA memory: flat shaded
+// triangles (roads, trees, lit vehicles), clears, blended fills and
+// bitmaps (text). Commands are binned into tiles of SOFTRAST_TILE pixels,
+// then softrast_flush() rasterises the tiles in parallel on worker threads.
+// Spans of triangles come from exact fixed point edge functions, and are
+// depth tested 4 pixels at once with SSE2.
+//
+// Coordinates are window pixels with y up, and row 0 of memory is the
+// bottom row, same as OpenGL. So the result can be given to glDrawPixels().
+// Projection is parallel only (glOrtho). There is no near / far clipping.
+
+#ifndef __SOFTRAST_H__
+#define __SOFTRAST_H__
+
+#include "workers.h"
+
+// tile size (pixel)
+#define SOFTRAST_TILE 64
+
+// vertices are snapped to 1 / SOFTRAST_SUBPIX pixel, same as common GL rasterisers
+#define SOFTRAST_SUBPIX 256
+
+// triangles with a vertex farther than this from origin (pixel) are dropped. keeps edge values in 64 bits
+#define SOFTRAST_GUARD (1 << 18)
+
+// restart index of softrast_draw_idx() strips
+#define SOFTRAST_RESTART_INDEX 0xffffffff
+
+// primitive of softrast_draw()
+enum
+{
+    SOFTRAST_TRIANGLES,
+    SOFTRAST_TRIANGLE_STRIP,
+};
+
+// bits of softrast_clear()
+#define SOFTRAST_COLOR 1
+#define SOFTRAST_DEPTH 2
+
+// kernel type
+enum
+{
+    SOFTRAST_AUTO,
+    SOFTRAST_SCALAR,
+    SOFTRAST_SSE2,
+    SOFTRAST_KIND_MAX,
+};
+
+// command types
+enum
+{
+    SOFTRAST_CMD_TRI,
+    SOFTRAST_CMD_CLEAR,
+    SOFTRAST_CMD_FILL,
+    SOFTRAST_CMD_BITMAP,
+    SOFTRAST_CMD_STRETCH,
+};
+
+// one command. rect is inside scissor
+typedef struct softrast_cmd
+{
+    int type;
+    int flags;          // TRI : depth test and write. CLEAR : SOFTRAST_COLOR | SOFTRAST_DEPTH
+    unsigned int col;   // RGBA8. blended if alpha < 255
+    int x0, y0, x1, y1; // pixels [x0, x1) x [y0, y1)
+
+    // TRI : edge i = a[i] * (X - fx) + b[i] * (Y - fy) + c[i] at pixel center (X, Y) in 1 / SOFTRAST_SUBPIX
+    // pixel, inside if >= 0. depth = z + dzdx * (x - ox) + dzdy * (y - oy) in pixels
+    int fx, fy;
+    int a[3], b[3];
+    long long c[3];
+    float ox, oy;
+    float z, dzdx, dzdy;
+
+    // BITMAP : w x h bits at (px, py), rows from bottom, MSB first, (w + 7) / 8 bytes per row.
+    // STRETCH : RGBA8 of w x h, stretched to pw x ph at (px, py)
+    const void *src;
+    int w, h;
+    int px, py, pw, ph;
+} SOFTRAST_CMD;
+
+// command indices of tile in submitted order
+typedef struct softrast_bin
+{
+    int num;
+    int max;
+    int *cmd;
+} SOFTRAST_BIN;
+
+typedef struct softrast_job
+{
+    struct softrast *r;
+    int tile;
+} SOFTRAST_JOB;
+
+typedef struct softrast
+{
+    int w;
+    int h;
+    unsigned int *color; // [h][w] RGBA8
+    float *depth;        // [h][w] 0.0 - 1.0
+
+    int tile_cols;
+    int tile_rows;
+    SOFTRAST_BIN *bins; // [tile_rows * tile_cols]
+    SOFTRAST_JOB *jobs;
+
+    int cmd_num;
+    int cmd_max;
+    SOFTRAST_CMD *cmd;
+
+    // NULL = tiles are rasterised by calling thread
+    WORKERS *workers;
+
+    // state. viewport is also scissor
+    int vx, vy, vw, vh;
+    float proj[16]; // column major, same as OpenGL
+    float mv[16];
+    int cull;       // cull clockwise triangles
+    int depth_test; // GL_LESS and write
+    int lighting;   // directional light, color material, normal (0, 0, 1) without normal array
+    float light_dir[3];
+    float light_amb;
+    float light_dif;
+
+    // triangles binned since softrast_begin()
+    int tris;
+} SOFTRAST;
+
+// ----------------------------------------
+// prototype declaration
+void softrast_set_kernel(int kind);
+int softrast_get_kernel(void);
+const char *softrast_get_kernel_name(int kind);
+void softrast_init(SOFTRAST *r, WORKERS *workers);
+void softrast_free(SOFTRAST *r);
+void softrast_begin(SOFTRAST *r, int w, int h);
+void softrast_flush(SOFTRAST *r);
+void softrast_set_view(SOFTRAST *r, int x, int y, int w, int h);
+void softrast_set_ortho(SOFTRAST *r, float w, float h, float zfar);
+void softrast_load_identity(SOFTRAST *r);
+void softrast_translate(SOFTRAST *r, float x, float y, float z);
+void softrast_rotate(SOFTRAST *r, float deg, float x, float y, float z);
+void softrast_scale(SOFTRAST *r, float s);
+void softrast_set_state(SOFTRAST *r, int cull, int depth_test, int lighting);
+void softrast_set_light(SOFTRAST *r, const float dir[3], float amb, float dif);
+unsigned int softrast_pack_col(const float col[4]);
+void softrast_clear(SOFTRAST *r, int bits, const float col[4], float depth);
+void softrast_fill(SOFTRAST *r, const float col[4]);
+void softrast_bitmap(SOFTRAST *r, int x, int y, int w, int h, const unsigned char *bits, unsigned int col);
+void softrast_stretch(SOFTRAST *r, const unsigned int *src, int sw, int sh, int x, int y, int w, int h);
+void softrast_tri(SOFTRAST *r, const float *p0, const float *p1, const float *p2, unsigned int col);
+void softrast_draw(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col, int first, int count);
+void softrast_draw_idx(SOFTRAST *r, int mode, const float *vtx, const float *nml, const float *col,
+                       const unsigned int *idx, int count);
+
+#endif
@@ -1,4 +1,4 @@
-// Last updated: <2024/04/30 03:59:18 +0900>
+// Last updated: <2026/10/20 14:40:12 +0900>
 //
 // pseudo 3d road screen saver by OpenGL
 //
@@ -76,6 +76,7 @@ LRESULT WINAPI ScreenSaverProc(HWND hWnd, UINT message,
     }
 
     SetupAnimation(Width, Height); // initialize work
+    set_cfg_framerate(1000.0 / (float)waitValue);
     SetIntervalGL(1);
 
     timeBeginPeriod(1);
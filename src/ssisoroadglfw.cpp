@@ -1,11 +1,70 @@
-// Last updated: <2024/04/30 04:58:20 +0900>
+// Last updated: <2026/10/20 15:10:48 +0900>
 //
 // Draw isometric roads by OpenGL + glfw
 //
 // F key : Change framerate 60, 30, 20 FPS
 // T key : Toggle FPS display
+// O key : Toggle overdraw heatmap
+// G key : Toggle frame time graph
+// Left / Right key : Seek -10 / +10 sec
 // ESC or Q key : exit
 //
+// Options. options can also be written in config file (config.h)
+// -config FILE : read options from FILE instead of ~/.config/ssisoroadgl/ssisoroadglfw.conf
+// -size WxH : window size (default 1280x720)
+// -framerate N : target frame rate (default 60)
+// -vsync on|off : wait for vertical sync (default on). same as -swap-interval 1 / 0
+// -swap-interval N : wait for N vertical syncs per frame
+// -fps on|off : FPS display (default on)
+// -graph on|off : frame time graph (default off)
+// -wall RxC : divide window into R x C views (video wall). max 64 views
+// -bench-wall : measure drawing time of 1 - 64 views and exit
+// -traffic N : N vehicles on each course
+// -bench-traffic : measure frame time of 0 - 2000 vehicles and exit
+// -roads mesh|batch|immediate|tiles : how to draw roads
+// -bench-roads : compare road batch kernels with glVertex3d() and parts of roads, and exit
+// -bench-frames N : measured frames of benchmark (default 120)
+// -bench-warmup SEC : frames drawn before measurement (default 1.5 sec)
+// -quality auto|N : adjust quality by frame time, or fix quality level N (1 - 4, default 4)
+// -render-scale S : draw scene at S x window resolution (0.25 - 1.0) and stretch it. text is not scaled
+// -bench-scale : measure frame time of render scale 1.0 - 0.25 and exit
+// -tree-step N : draw every N-th tree (default 1 = all trees)
+// -speed M/S : max speed of player (default 42)
+// -fixed-speed : player runs at max speed without acceleration / deceleration
+// -painter : draw static roads and trees in painter's order without depth buffer.
+//            mesh roads, core and soft renderers. no effect with -roads immediate|batch|tiles
+// -lod on|off : simplified roads on small views (default on)
+// -shadows on|off : shadows of roads (default on)
+// -lines on|off : white lines of roads (default on)
+// -seek SEC : start at SEC sec from course entry
+// -course N, -stage N, -model N : start with this course / stage / model
+// -export FILE : render one course into FILE (.y4m = YUV4MPEG2, %d.png = PNG files, others = raw RGBA) and exit
+// -export-size WxH : size of movie (default 3840x2160)
+// -export-fps N : frame rate of movie (default 60)
+// -export-sec SEC : length of movie (default until course exit)
+// -shots DIR : save PNG of all course / stage / model combinations into DIR and exit
+// -shots-sec LIST : times from course entry (default 5,30,90)
+// -shots-size LIST : sizes of PNG (default 1280x720,480x270)
+// -shots-part K/N : make combinations K, K + N, K + 2N, ... only. for N processes
+// -compare DIR : draw frames of -shots-sec / -shots-size by all road paths, compare them
+//                with reference frames in DIR, and exit. failed = exit code 1 and diff PNG.
+//                needs framebuffer object
+// -compare-tol N : allowed difference of color channel (default 8)
+// -compare-bad PERCENT : allowed pixels over tolerance (default 0.1).
+//                        tiles are compared in 2x2 pixels with tolerance 48 and 0.5 %
+// -overdraw : draw overdraw heatmap (fragments per pixel) instead of scene
+// -overdraw-report : print average / max overdraw of each course and zoom level and exit
+// -gl-limit VER : use OpenGL features up to VER only (e.g. 11, 15, 30)
+// -renderer fixed|core|soft : OpenGL 1.1 fixed function (default), 3.3 core profile shaders,
+//                             or software renderer on CPU (for machines without GPU)
+// -soft-threads N : worker threads of software renderer (default 0 = number of CPUs)
+// -bench-soft : compare OpenGL fixed function with software renderer of 1 - N threads and exit
+// -telemetry on|off|/NAME : live statistics in shared memory /ssisoroadgl or /NAME (default on).
+//                           read by ssisoroadmon. not on Windows
+// -capture FILE : record OpenGL calls of startup and -capture-frames frames into FILE and exit.
+//                 replayed by ssisoroadreplay
+// -capture-frames N : frames of -capture (default 300)
+//
 // Windows10 x64 22H2 + MSYS2 MinGW 64bit (g++ 13.2.0) + glfw 3.4.1
 // by mieki256
 // License: CC0 / Public Domain
@@ -14,6 +73,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 #include <math.h>
 #include <time.h>
 #include <GL/gl.h>
@@ -21,6 +81,11 @@
 #include <GLFW/glfw3.h>
 
 #include "render.h"
+#include "movie.h"
+#include "compare.h"
+#include "config.h"
+#include "telemetry.h"
+#include "workers.h"
 
 // #if 0
 #ifdef _WIN32
@@ -41,12 +106,84 @@
 #define SCRH 720
 
 // setting value
-int waitValue = 15;
 int fps_display = 1;
+static int swap_interval = 1;
+
+// benchmark
+#define BENCH_WARMUP_TIME 1.5
+#define BENCH_FRAMES 120
+
+static float bench_warmup = BENCH_WARMUP_TIME;
+static int bench_frame_num = BENCH_FRAMES;
+
+// OpenGL command capture
+#define CAPTURE_FRAMES 300
+
+// live statistics for ssisoroadmon
+static TELEMETRY telemetry;
+
+// movie export
+#define EXPORT_W 3840
+#define EXPORT_H 2160
+#define EXPORT_FPS 60
+
+// screenshots
+#define SHOTS_LIST_MAX 16
+#define SHOTS_SEC "5,30,90"
+#define SHOTS_SIZE "1280x720,480x270"
+
+// pixel comparison of render paths
+#define COMPARE_TOL 8
+#define COMPARE_BAD 0.1
+#define COMPARE_TILES_TOL 48
+#define COMPARE_TILES_BAD 0.5
+
+typedef struct compare_path
+{
+    const char *name;
+    int road_path;
+    int kernel;    // road batch kernel
+    int painter;   // static layers in painter's order
+    int tol;       // allowed difference of color channel. 0 = -compare-tol
+    float bad_max; // allowed pixels over tolerance (%). 0 = -compare-bad
+    int down;      // compared after mean of down x down pixels. 0 = per pixel
+} COMPARE_PATH;
+
+// first one is reference (legacy glVertex3d() path).
+// tiles are filtered textures, so edges of polygons move in a pixel and blur.
+// they are compared in means of 2 x 2 pixels, with their own tolerance
+static const COMPARE_PATH compare_paths[] = {
+    {"immediate", ROAD_PATH_IMMEDIATE, 0, 0, 0, 0.0, 0},
+    {"mesh", ROAD_PATH_MESH, 0, 0, 0, 0.0, 0},
+    {"painter", ROAD_PATH_MESH, 0, 1, 0, 0.0, 0},
+    {"batch-scalar", ROAD_PATH_BATCH, 1, 0, 0, 0.0, 0},
+    {"batch-sse2", ROAD_PATH_BATCH, 2, 0, 0, 0.0, 0},
+    {"batch-avx2", ROAD_PATH_BATCH, 3, 0, 0, 0.0, 0},
+    {"tiles", ROAD_PATH_TILES, 0, 0, COMPARE_TILES_TOL, COMPARE_TILES_BAD, 2},
+};
+#define COMPARE_PATH_NUM (int)(sizeof(compare_paths) / sizeof(COMPARE_PATH))
+
+// overdraw report. a frame every STEP sec, zoom levels of 0.2
+#define OVERDRAW_STEP 1.0
+#define OVERDRAW_ZOOM_NUM 5
 
 // ----------------------------------------
 // prototype declaration
-int main(void);
+int main(int argc, char *argv[]);
+static double bench_frames(GLFWwindow *window);
+static void bench_wall(GLFWwindow *window);
+static void bench_traffic(GLFWwindow *window);
+static void bench_roads(GLFWwindow *window);
+static void bench_scale(GLFWwindow *window);
+static void bench_soft(GLFWwindow *window);
+static int export_movie(GLFWwindow *window, const char *path, int w, int h, int fps, float sec);
+static int parse_sec_list(const char *s, float *secs);
+static int parse_size_list(const char *s, int (*sizes)[2]);
+static int make_shots(GLFWwindow *window, const char *dir, const char *sec_list, const char *size_list,
+                      int part, int parts);
+static int compare_frames(GLFWwindow *window, const char *dir, const char *sec_list, const char *size_list,
+                          int tol, float bad_max);
+static int overdraw_report(GLFWwindow *window);
 static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods);
 static void resize(GLFWwindow *window, int w, int h);
 void error_callback(int error, const char *description);
@@ -55,13 +192,307 @@ void error_exit(const char *description);
 
 // ----------------------------------------
 // Main
-int main(void)
+int main(int argc, char *argv[])
 {
     GLFWwindow *window;
+    int wall_rows = 1;
+    int wall_cols = 1;
+    int traffic = 0;
+    int road_path = ROAD_PATH_MESH;
+    int renderer = RENDER_FIXED;
+    int bench = 0;
+    float seek = -1.0;
+    int course = -1;
+    int stage = -1;
+    int model = -1;
+    const char *export_path = NULL;
+    int export_w = EXPORT_W;
+    int export_h = EXPORT_H;
+    int export_fps = EXPORT_FPS;
+    float export_sec = 0.0;
+    const char *shots_dir = NULL;
+    const char *shots_sec = SHOTS_SEC;
+    const char *shots_size = SHOTS_SIZE;
+    int shots_part = 0;
+    int shots_parts = 1;
+    const char *compare_dir = NULL;
+    int compare_tol = COMPARE_TOL;
+    float compare_bad = COMPARE_BAD;
+    int overdraw = 0;
+    int quality = 0;
+    float framerate = 60.0;
+    float speed = 0.0;
+    int fixed_speed = 0;
+    int road_shadows = 1;
+    int road_lines = 1;
+    const char *telemetry_name = TELEMETRY_NAME;
+    const char *capture_path = NULL;
+    int capture_frames = CAPTURE_FRAMES;
 
     Width = SCRW;
     Height = SCRH;
 
+    // options of config file come first, so command line overrides them
+    if (!config_merge_args(&argc, &argv))
+        exit(EXIT_FAILURE);
+
+    // parse options
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-config") == 0 && i + 1 < argc)
+        {
+            i++; // read by config_merge_args()
+        }
+        else if (strcmp(argv[i], "-size") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%dx%d", &Width, &Height) != 2 || Width <= 0 || Height <= 0)
+            {
+                errmsg("-size needs WxH. (e.g. -size 1920x1080)");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "-framerate") == 0 && i + 1 < argc)
+        {
+            framerate = atof(argv[++i]);
+            if (framerate <= 0.0)
+                framerate = 60.0;
+        }
+        else if (strcmp(argv[i], "-vsync") == 0 && i + 1 < argc)
+        {
+            swap_interval = (strcmp(argv[++i], "off") == 0) ? 0 : 1;
+        }
+        else if (strcmp(argv[i], "-swap-interval") == 0 && i + 1 < argc)
+        {
+            swap_interval = atoi(argv[++i]);
+            if (swap_interval < 0)
+                swap_interval = 0;
+        }
+        else if (strcmp(argv[i], "-fps") == 0 && i + 1 < argc)
+        {
+            fps_display = (strcmp(argv[++i], "off") == 0) ? 0 : 1;
+        }
+        else if (strcmp(argv[i], "-graph") == 0 && i + 1 < argc)
+        {
+            set_frame_graph(strcmp(argv[++i], "off") != 0);
+        }
+        else if (strcmp(argv[i], "-wall") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%dx%d", &wall_rows, &wall_cols) != 2)
+            {
+                errmsg("-wall needs RxC. (e.g. -wall 3x3)");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "-bench-wall") == 0)
+        {
+            bench = 1;
+        }
+        else if (strcmp(argv[i], "-traffic") == 0 && i + 1 < argc)
+        {
+            traffic = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-bench-traffic") == 0)
+        {
+            bench = 2;
+        }
+        else if (strcmp(argv[i], "-roads") == 0 && i + 1 < argc)
+        {
+            i++;
+            if (strcmp(argv[i], "batch") == 0)
+                road_path = ROAD_PATH_BATCH;
+            else if (strcmp(argv[i], "immediate") == 0)
+                road_path = ROAD_PATH_IMMEDIATE;
+            else if (strcmp(argv[i], "tiles") == 0)
+                road_path = ROAD_PATH_TILES;
+            else
+                road_path = ROAD_PATH_MESH;
+        }
+        else if (strcmp(argv[i], "-bench-roads") == 0)
+        {
+            bench = 3;
+        }
+        else if (strcmp(argv[i], "-bench-frames") == 0 && i + 1 < argc)
+        {
+            bench_frame_num = atoi(argv[++i]);
+            if (bench_frame_num <= 0)
+                bench_frame_num = BENCH_FRAMES;
+        }
+        else if (strcmp(argv[i], "-bench-warmup") == 0 && i + 1 < argc)
+        {
+            bench_warmup = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-quality") == 0 && i + 1 < argc)
+        {
+            i++;
+            quality = (strcmp(argv[i], "auto") == 0) ? -1 : atoi(argv[i]);
+        }
+        else if (strcmp(argv[i], "-render-scale") == 0 && i + 1 < argc)
+        {
+            set_render_scale(atof(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-bench-scale") == 0)
+        {
+            bench = 4;
+        }
+        else if (strcmp(argv[i], "-tree-step") == 0 && i + 1 < argc)
+        {
+            set_tree_step(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-speed") == 0 && i + 1 < argc)
+        {
+            speed = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-fixed-speed") == 0)
+        {
+            fixed_speed = 1;
+        }
+        else if (strcmp(argv[i], "-painter") == 0)
+        {
+            set_painter_order(1);
+        }
+        else if (strcmp(argv[i], "-seek") == 0 && i + 1 < argc)
+        {
+            seek = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-course") == 0 && i + 1 < argc)
+        {
+            course = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-stage") == 0 && i + 1 < argc)
+        {
+            stage = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-model") == 0 && i + 1 < argc)
+        {
+            model = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-export") == 0 && i + 1 < argc)
+        {
+            export_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "-export-size") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%dx%d", &export_w, &export_h) != 2)
+            {
+                errmsg("-export-size needs WxH. (e.g. -export-size 1920x1080)");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "-export-fps") == 0 && i + 1 < argc)
+        {
+            export_fps = atoi(argv[++i]);
+            if (export_fps <= 0)
+                export_fps = EXPORT_FPS;
+        }
+        else if (strcmp(argv[i], "-export-sec") == 0 && i + 1 < argc)
+        {
+            export_sec = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-shots") == 0 && i + 1 < argc)
+        {
+            shots_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "-shots-sec") == 0 && i + 1 < argc)
+        {
+            shots_sec = argv[++i];
+        }
+        else if (strcmp(argv[i], "-shots-size") == 0 && i + 1 < argc)
+        {
+            shots_size = argv[++i];
+        }
+        else if (strcmp(argv[i], "-shots-part") == 0 && i + 1 < argc)
+        {
+            if (sscanf(argv[++i], "%d/%d", &shots_part, &shots_parts) != 2 || shots_parts < 1
+                || shots_part < 0 || shots_part >= shots_parts)
+            {
+                errmsg("-shots-part needs K/N. (e.g. -shots-part 0/4)");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[i], "-compare") == 0 && i + 1 < argc)
+        {
+            compare_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "-compare-tol") == 0 && i + 1 < argc)
+        {
+            compare_tol = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-compare-bad") == 0 && i + 1 < argc)
+        {
+            compare_bad = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-overdraw") == 0)
+        {
+            set_overdraw(1);
+        }
+        else if (strcmp(argv[i], "-overdraw-report") == 0)
+        {
+            overdraw = 1;
+        }
+        else if (strcmp(argv[i], "-lod") == 0 && i + 1 < argc)
+        {
+            i++;
+            set_road_lod(strcmp(argv[i], "off") != 0);
+        }
+        else if (strcmp(argv[i], "-shadows") == 0 && i + 1 < argc)
+        {
+            i++;
+            road_shadows = (strcmp(argv[i], "off") != 0);
+        }
+        else if (strcmp(argv[i], "-lines") == 0 && i + 1 < argc)
+        {
+            i++;
+            road_lines = (strcmp(argv[i], "off") != 0);
+        }
+        else if (strcmp(argv[i], "-gl-limit") == 0 && i + 1 < argc)
+        {
+            set_gl_version_limit(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-renderer") == 0 && i + 1 < argc)
+        {
+            i++;
+            if (strcmp(argv[i], "core") == 0)
+                renderer = RENDER_CORE;
+            else if (strcmp(argv[i], "soft") == 0)
+                renderer = RENDER_SOFT;
+            else
+                renderer = RENDER_FIXED;
+        }
+        else if (strcmp(argv[i], "-soft-threads") == 0 && i + 1 < argc)
+        {
+            set_soft_threads(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-bench-soft") == 0)
+        {
+            bench = 5;
+        }
+        else if (strcmp(argv[i], "-telemetry") == 0 && i + 1 < argc)
+        {
+            i++;
+            if (strcmp(argv[i], "off") == 0)
+                telemetry_name = NULL;
+            else if (argv[i][0] == '/')
+                telemetry_name = argv[i];
+            else
+                telemetry_name = TELEMETRY_NAME;
+        }
+        else if (strcmp(argv[i], "-capture") == 0 && i + 1 < argc)
+        {
+            capture_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "-capture-frames") == 0 && i + 1 < argc)
+        {
+            capture_frames = atoi(argv[++i]);
+            if (capture_frames <= 0)
+                capture_frames = CAPTURE_FRAMES;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
 #ifdef WINMM_TIMER
     timeBeginPeriod(1);
 #endif
@@ -75,8 +506,26 @@ int main(void)
         exit(EXIT_FAILURE);
     }
 
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 1); // set OpenGL 1.1
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    if (renderer == RENDER_CORE)
+    {
+        // set OpenGL 3.3 core profile
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+    }
+    else
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 1); // set OpenGL 1.1
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    }
+
+    // stencil buffer counts fragments of overdraw heatmap
+    glfwWindowHint(GLFW_STENCIL_BITS, 8);
+
+    // movie is drawn offscreen
+    if (export_path || shots_dir || compare_dir || overdraw)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
 
     // create window
     window = glfwCreateWindow(Width, Height, WDW_TITLE, NULL, NULL);
@@ -92,11 +541,73 @@ int main(void)
     glfwSetWindowSizeCallback(window, resize);
 
     glfwMakeContextCurrent(window);
-    glfwSwapInterval(1);
+    glfwSwapInterval(swap_interval);
 
+    // objects made by SetupAnimation() are a part of capture
+    if (capture_path)
+    {
+        if (bench || export_path || shots_dir || compare_dir || overdraw)
+            error_exit("-capture is for normal drawing only");
+        if (!glcapture_start(capture_path, capture_frames, Width, Height, (renderer == RENDER_CORE)))
+            error_exit("Could not open capture file");
+    }
+
+    set_gl_getproc((void *(*)(const char *))glfwGetProcAddress);
+    set_render_backend(renderer);
+    set_player_speed(speed, fixed_speed);
+    set_road_parts(road_shadows, road_lines);
     SetupAnimation(Width, Height);
-    set_cfg_framerate(60.0);
+    if (get_render_backend() != renderer)
+        error_exit("Could not use OpenGL 3.3 core profile renderer");
+    set_cfg_framerate(framerate);
     set_use_waittime(1);
+    set_wall_grid(wall_rows, wall_cols);
+    set_traffic_num(traffic);
+    set_road_path(road_path);
+    if (quality != 0)
+        set_quality((quality < 0) ? -1 : quality - 1);
+    if (course >= 0 || stage >= 0 || model >= 0)
+        set_course(course, stage, model);
+    if (seek >= 0.0)
+        seek_course_time(seek);
+
+    if (export_path || shots_dir || compare_dir || overdraw)
+    {
+        int ok;
+        if (overdraw)
+            ok = overdraw_report(window);
+        else if (compare_dir)
+            ok = compare_frames(window, compare_dir, shots_sec, shots_size, compare_tol, compare_bad);
+        else if (shots_dir)
+            ok = make_shots(window, shots_dir, shots_sec, shots_size, shots_part, shots_parts);
+        else
+            ok = export_movie(window, export_path, export_w, export_h, export_fps, export_sec);
+        CleanupAnimation();
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (bench)
+    {
+        swap_interval = 0;
+        glfwSwapInterval(0);
+        set_use_waittime(0);
+        if (bench == 1)
+            bench_wall(window);
+        else if (bench == 2)
+            bench_traffic(window);
+        else if (bench == 3)
+            bench_roads(window);
+        else if (bench == 4)
+            bench_scale(window);
+        else
+            bench_soft(window);
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+    }
+
+    if (!bench && telemetry_name && !telemetry_open(&telemetry, telemetry_name))
+        fprintf(stderr, "Warning: Could not open telemetry %s\n", telemetry_name);
 
     // main loop
     while (!glfwWindowShouldClose(window))
@@ -105,7 +616,19 @@ int main(void)
         // glFlush();
         glfwSwapBuffers(window);
         glfwPollEvents();
+
+        if (telemetry.data)
+        {
+            TELEMETRY_DATA d;
+            get_telemetry(&d);
+            telemetry_publish(&telemetry, &d);
+        }
+
+        if (capture_path && !glcapture_end_frame())
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
     }
+    telemetry_close(&telemetry);
+    glcapture_stop();
 
 #ifdef WINMM_TIMER
     timeEndPeriod(1);
@@ -145,7 +668,7 @@ static void resize(GLFWwindow *window, int w, int h)
         return;
 
     glfwSetWindowSize(window, w, h);
-    glfwSwapInterval(1);
+    glfwSwapInterval(swap_interval);
     resize_window(w, h);
 }
 
@@ -164,6 +687,22 @@ static void key_callback(GLFWwindow *window, int key, int scancode, int action,
         {
             fps_display = (fps_display + 1) % 2;
         }
+        else if (key == GLFW_KEY_O)
+        {
+            set_overdraw(!get_overdraw());
+        }
+        else if (key == GLFW_KEY_G)
+        {
+            set_frame_graph(!get_frame_graph());
+        }
+        else if (key == GLFW_KEY_LEFT)
+        {
+            seek_course_time(get_course_time() - 10.0);
+        }
+        else if (key == GLFW_KEY_RIGHT)
+        {
+            seek_course_time(get_course_time() + 10.0);
+        }
         else if (key == GLFW_KEY_F)
         {
             float fps = get_cfg_framerate();
@@ -175,10 +714,585 @@ static void key_callback(GLFWwindow *window, int key, int scancode, int action,
             {
                 set_cfg_framerate(20.0);
             }
-            else if (fps == 20.0)
+            else
             {
                 set_cfg_framerate(60.0);
             }
         }
     }
 }
+
+// ----------------------------------------
+// Benchmark. Draw frames without wait and return time per frame (msec)
+static double bench_frames(GLFWwindow *window)
+{
+    skip_intro();
+
+    // warm up
+    double t0 = glfwGetTime();
+    while (glfwGetTime() - t0 < bench_warmup)
+    {
+        Render();
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+
+    glFinish();
+    t0 = glfwGetTime();
+    for (int i = 0; i < bench_frame_num; i++)
+    {
+        Render();
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+    glFinish();
+    return (glfwGetTime() - t0) * 1000.0 / bench_frame_num;
+}
+
+// 1x1 - 8x8 views
+static void bench_wall(GLFWwindow *window)
+{
+    double base = 0.0;
+
+    printf("views  grid  ms/frame  ms/view  relative\n");
+    for (int g = 1; g <= 8; g++)
+    {
+        set_wall_grid(g, g);
+        double ms = bench_frames(window);
+        int n = get_view_num();
+        if (g == 1)
+            base = ms;
+        printf("%5d  %dx%d  %8.3f  %7.3f  %8.2f\n", n, g, g, ms, ms / n, ms / base);
+    }
+}
+
+// 0 - 2000 vehicles
+static void bench_traffic(GLFWwindow *window)
+{
+    const int nums[] = {0, 250, 500, 1000, 2000};
+
+    printf("vehicles  ms/frame     fps\n");
+    for (int i = 0; i < (int)(sizeof(nums) / sizeof(int)); i++)
+    {
+        set_traffic_num(nums[i]);
+        double ms = bench_frames(window);
+        printf("%8d  %8.3f  %6.1f\n", nums[i], ms, 1000.0 / ms);
+    }
+}
+
+// road batch kernels, glVertex3d(), static mesh and tile cache
+static void bench_roads(GLFWwindow *window)
+{
+    const char *names[] = {"", "scalar", "sse2", "avx2"};
+    double ms;
+
+    printf("path              kernel(us)  ms/frame\n");
+
+    set_road_path(ROAD_PATH_IMMEDIATE);
+    ms = bench_frames(window);
+    printf("glVertex3d        %10s  %8.3f\n", "-", ms);
+
+    set_road_path(ROAD_PATH_BATCH);
+    for (int k = 1; k <= 3; k++)
+    {
+        if (set_road_kernel(k) != k)
+            continue; // not supported on this CPU
+        ms = bench_frames(window);
+        printf("batch %-10s  %10.2f  %8.3f\n", names[k], time_road_batch(1000), ms);
+    }
+    set_road_kernel(0);
+
+    // parts of roads by default kernel. index = shadow | line << 1
+    const char *parts[] = {"road only", "no lines", "no shadows", "all"};
+    int shadow, line;
+    get_road_parts(&shadow, &line);
+    for (int p = 3; p >= 0; p--)
+    {
+        set_road_parts(p & 1, p & 2);
+        ms = bench_frames(window);
+        printf("batch %-10s  %10.2f  %8.3f\n", parts[p], time_road_batch(1000), ms);
+    }
+    set_road_parts(shadow, line);
+
+    set_road_path(ROAD_PATH_MESH);
+    ms = bench_frames(window);
+    printf("static mesh       %10s  %8.3f\n", "-", ms);
+
+    set_road_path(ROAD_PATH_TILES);
+    ms = bench_frames(window);
+    printf("tile cache        %10s  %8.3f\n", "-", ms);
+    set_road_path(ROAD_PATH_MESH);
+}
+
+// render scale 1.0 - 0.25. fill = scene pixels / window pixels
+static void bench_scale(GLFWwindow *window)
+{
+    const float scales[] = {1.0, 0.75, 0.5, 0.25};
+    float scale = get_render_scale();
+    double base = 0.0;
+
+    printf("scale  scene size  fill(%%)  ms/frame  relative\n");
+    for (int i = 0; i < (int)(sizeof(scales) / sizeof(float)); i++)
+    {
+        set_render_scale(scales[i]);
+        int w, h;
+        if (!get_render_size(&w, &h) && i > 0)
+        {
+            errmsg("render scale needs framebuffer object");
+            break;
+        }
+        double ms = bench_frames(window);
+        if (i == 0)
+            base = ms;
+        printf("%5.2f  %4dx%-5d  %7.1f  %8.3f  %8.2f\n", scales[i], w, h,
+               100.0 * w * h / (Width * Height), ms, ms / base);
+    }
+    set_render_scale(scale);
+}
+
+// OpenGL fixed function (llvmpipe etc. without GPU) and software renderer of kernels and 1 - N threads
+static void bench_soft(GLFWwindow *window)
+{
+    const char *names[] = {"", "scalar", "sse2"};
+    int renderer = get_render_backend();
+    int cpus = workers_get_cpu_num();
+
+    if (renderer == RENDER_CORE)
+    {
+        errmsg("-bench-soft needs -renderer fixed or soft");
+        return;
+    }
+
+    printf("OpenGL : %s\n", (const char *)glGetString(GL_RENDERER));
+    printf("renderer  kernel  threads  ms/frame  relative\n");
+
+    set_render_backend(RENDER_FIXED);
+    double base = bench_frames(window);
+    printf("opengl    %6s  %7s  %8.3f  %8.2f\n", "-", "-", base, 1.0);
+
+    set_render_backend(RENDER_SOFT);
+    for (int k = 1; k <= 2; k++)
+    {
+        if (set_soft_kernel(k) != k)
+            continue; // not supported on this CPU
+        for (int t = 1;; t *= 2)
+        {
+            if (t > cpus)
+                t = cpus;
+            set_soft_threads(t);
+            double ms = bench_frames(window);
+            printf("soft      %6s  %7d  %8.3f  %8.2f\n", names[k], t, ms, ms / base);
+            if (t >= cpus)
+                break;
+        }
+    }
+    set_soft_kernel(0);
+    set_soft_threads(0);
+    set_render_backend(renderer);
+}
+
+// ----------------------------------------
+// Render frames at fixed time step into movie file, as fast as possible.
+// sec = 0 : until first view exits course. return 0 if failed
+static int export_movie(GLFWwindow *window, const char *path, int w, int h, int fps, float sec)
+{
+    MOVIE m;
+
+    if (!movie_open(&m, path, movie_get_format(path), w, h, fps))
+    {
+        fprintf(stderr, "Error: Could not open movie %s (%dx%d). size of .y4m must be even,"
+                        " .png needs one %%d of frame number and no other %%\n", path, w, h);
+        return 0;
+    }
+
+    fps_display = 0;
+    glfwSwapInterval(0);
+    set_use_waittime(0);
+    set_fixed_delta(1.0 / fps);
+    resize_window(w, h);
+
+    int frames_max = (sec > 0.0) ? (int)(sec * fps + 0.5) : -1;
+    int ok = 1;
+    double t0 = glfwGetTime();
+    for (int n = 0; frames_max < 0 || n < frames_max; n++)
+    {
+        movie_begin_frame(&m);
+        Render();
+        if (!movie_end_frame(&m, NULL))
+        {
+            ok = 0;
+            break;
+        }
+
+        glfwPollEvents();
+        if (glfwWindowShouldClose(window))
+            break;
+        if (frames_max < 0 && is_course_end())
+            break;
+        if (n % (fps * 10) == 0)
+            fprintf(stderr, "%.0f sec\r", (double)n / fps);
+    }
+
+    if (!movie_close(&m))
+        ok = 0;
+    if (!ok)
+        fprintf(stderr, "Error: Could not write movie %s\n", path);
+
+    double t = glfwGetTime() - t0;
+    printf("%s : %dx%d, %d frames, %.2f sec, %.1f frames/sec (%.2fx real time)\n",
+           path, w, h, m.frames, t, m.frames / t, m.frames / (t * fps));
+    set_fixed_delta(0.0);
+    return ok;
+}
+
+// "5,30,90" -> secs. return number of values
+static int parse_sec_list(const char *s, float *secs)
+{
+    int n = 0;
+    while (*s != '\0' && n < SHOTS_LIST_MAX)
+    {
+        char *e;
+        float v = strtod(s, &e);
+        if (e == s)
+            break;
+        secs[n++] = v;
+        s = (*e == ',') ? e + 1 : e;
+    }
+    return n;
+}
+
+// "1280x720,480x270" -> sizes. return number of sizes
+static int parse_size_list(const char *s, int (*sizes)[2])
+{
+    int n = 0;
+    while (*s != '\0' && n < SHOTS_LIST_MAX)
+    {
+        int w, h, len;
+        if (sscanf(s, "%dx%d%n", &w, &h, &len) != 2 || w <= 0 || h <= 0)
+            break;
+        sizes[n][0] = w;
+        sizes[n][1] = h;
+        n++;
+        s += len;
+        if (*s == ',')
+            s++;
+    }
+    return n;
+}
+
+// ----------------------------------------
+// Screenshots of all course / stage / model combinations, at some times and sizes.
+// Frames are drawn one by one, PNG files are encoded on worker threads (movie.h).
+// parts > 1 : run parts processes with -shots-part 0/N ... N-1/N. return 0 if failed
+static int make_shots(GLFWwindow *window, const char *dir, const char *sec_list, const char *size_list,
+                      int part, int parts)
+{
+    float secs[SHOTS_LIST_MAX];
+    int sizes[SHOTS_LIST_MAX][2];
+    int sec_num = parse_sec_list(sec_list, secs);
+    int size_num = parse_size_list(size_list, sizes);
+    int course_max = get_course_max();
+    int stage_max = get_stage_max();
+    int model_max = get_model_max();
+    int count = 0;
+    int ok = 1;
+
+    if (sec_num == 0 || size_num == 0)
+    {
+        errmsg("-shots-sec needs SEC,SEC,... and -shots-size needs WxH,WxH,...");
+        return 0;
+    }
+
+    fps_display = 0;
+    glfwSwapInterval(0);
+    set_use_waittime(0);
+    set_fixed_delta(1.0 / EXPORT_FPS);
+    set_wall_grid(1, 1);
+
+    double t0 = glfwGetTime();
+    for (int k = 0; k < size_num && ok; k++)
+    {
+        int w = sizes[k][0];
+        int h = sizes[k][1];
+        MOVIE m;
+        if (!movie_open(&m, NULL, MOVIE_PNG, w, h, EXPORT_FPS))
+        {
+            fprintf(stderr, "Error: Could not draw %dx%d offscreen\n", w, h);
+            ok = 0;
+            break;
+        }
+        resize_window(w, h);
+
+        for (int i = 0; i < course_max * stage_max * model_max && ok; i++)
+        {
+            if (i % parts != part)
+                continue;
+
+            int c = i / (stage_max * model_max);
+            int s = (i / model_max) % stage_max;
+            int md = i % model_max;
+            for (int j = 0; j < sec_num; j++)
+            {
+                char path[MOVIE_PATH_MAX];
+                snprintf(path, sizeof(path), "%s/course%d_stage%d_model%d_%gs_%dx%d.png", dir, c, s, md, secs[j], w, h);
+
+                set_course(c, s, md);
+                seek_course_time(secs[j]);
+                movie_begin_frame(&m);
+                Render();
+                if (!movie_end_frame(&m, path))
+                {
+                    ok = 0;
+                    break;
+                }
+                count++;
+            }
+        }
+
+        if (!movie_close(&m))
+            ok = 0;
+    }
+    set_fixed_delta(0.0);
+    if (!ok)
+    {
+        fprintf(stderr, "Error: Could not write PNG files into %s\n", dir);
+        return 0;
+    }
+
+    double t = glfwGetTime() - t0;
+    printf("%s : %d files, %.2f sec, %.1f files/sec\n", dir, count, t, count / t);
+    return ok;
+}
+
+// ----------------------------------------
+// Draw same frames by all road paths and compare them with reference frames.
+// reference is DIR/ref_*.rgba. if not exist, it is drawn by first path and saved.
+// core and software renderers have one path. return 0 if some frames differ
+static int compare_frames(GLFWwindow *window, const char *dir, const char *sec_list, const char *size_list,
+                          int tol, float bad_max)
+{
+    float secs[SHOTS_LIST_MAX];
+    int sizes[SHOTS_LIST_MAX][2];
+    int sec_num = parse_sec_list(sec_list, secs);
+    int size_num = parse_size_list(size_list, sizes);
+    int combi = get_course_max() * get_stage_max() * get_model_max();
+    int path_num = (get_render_backend() != RENDER_FIXED) ? 1 : COMPARE_PATH_NUM;
+    const char *renderer_name = (get_render_backend() == RENDER_SOFT) ? "soft" : "core";
+    int frames[COMPARE_PATH_NUM] = {0};
+    int failed[COMPARE_PATH_NUM] = {0};
+    int maxd[COMPARE_PATH_NUM] = {0};
+    float worst[COMPARE_PATH_NUM] = {0.0};
+    int saved = 0;
+    int ok = 1;
+
+    if (sec_num == 0 || size_num == 0)
+    {
+        errmsg("-shots-sec needs SEC,SEC,... and -shots-size needs WxH,WxH,...");
+        return 0;
+    }
+
+    fps_display = 0;
+    glfwSwapInterval(0);
+    set_use_waittime(0);
+    set_fixed_delta(1.0 / EXPORT_FPS);
+    set_wall_grid(1, 1);
+    set_road_lod(0);
+
+    for (int k = 0; k < size_num; k++)
+    {
+        int w = sizes[k][0];
+        int h = sizes[k][1];
+        int size = w * h * 4;
+        MOVIE m;
+        if (!movie_open(&m, NULL, MOVIE_PNG, w, h, EXPORT_FPS))
+        {
+            fprintf(stderr, "Error: Could not draw %dx%d offscreen\n", w, h);
+            return 0;
+        }
+        resize_window(w, h);
+        unsigned char *ref = (unsigned char *)malloc(size);
+        unsigned char *img = (unsigned char *)malloc(size);
+        unsigned char *ref_down = (unsigned char *)malloc(size);
+        unsigned char *img_down = (unsigned char *)malloc(size);
+
+        for (int i = 0; i < combi; i++)
+        {
+            int c = i / (get_stage_max() * get_model_max());
+            int s = (i / get_model_max()) % get_stage_max();
+            int md = i % get_model_max();
+            for (int j = 0; j < sec_num; j++)
+            {
+                char name[128];
+                char path[MOVIE_PATH_MAX];
+                snprintf(name, sizeof(name), "course%d_stage%d_model%d_%gs_%dx%d", c, s, md, secs[j], w, h);
+                snprintf(path, sizeof(path), "%s/ref_%s.rgba", dir, name);
+                int has_ref = compare_load_ref(path, ref, size);
+
+                for (int p = 0; p < path_num; p++)
+                {
+                    const COMPARE_PATH *cp = &compare_paths[p];
+                    if (get_render_backend() == RENDER_FIXED)
+                    {
+                        set_road_path(cp->road_path);
+                        set_painter_order(cp->painter);
+                        if (cp->road_path == ROAD_PATH_BATCH && set_road_kernel(cp->kernel) != cp->kernel)
+                            continue; // not supported on this CPU
+                    }
+
+                    // twice. tiles are made in first frame
+                    movie_begin_frame(&m);
+                    for (int n = 0; n < 2; n++)
+                    {
+                        set_course(c, s, md);
+                        seek_course_time(secs[j]);
+                        Render();
+                    }
+                    movie_read_frame(&m, img);
+
+                    if (!has_ref)
+                    {
+                        if (!compare_save_ref(path, img, size))
+                        {
+                            fprintf(stderr, "Error: Could not write %s\n", path);
+                            ok = 0;
+                        }
+                        memcpy(ref, img, size);
+                        has_ref = 1;
+                        saved++;
+                        continue;
+                    }
+
+                    // filtered path. both are downsampled into tail of buffers
+                    const unsigned char *cr = ref;
+                    const unsigned char *ci = img;
+                    int cw = w;
+                    int ch = h;
+                    if (cp->down > 1)
+                    {
+                        cw = w / cp->down;
+                        ch = h / cp->down;
+                        compare_downsample(ref, w, h, cp->down, ref_down);
+                        compare_downsample(img, w, h, cp->down, img_down);
+                        cr = ref_down;
+                        ci = img_down;
+                    }
+
+                    int ptol = (cp->tol > 0) ? cp->tol : tol;
+                    COMPARE_RESULT r;
+                    compare_rgba(cr, ci, cw, ch, ptol, &r);
+                    float bad = 100.0 * r.bad / (cw * ch);
+                    frames[p]++;
+                    if (r.maxd > maxd[p])
+                        maxd[p] = r.maxd;
+                    if (bad > worst[p])
+                        worst[p] = bad;
+                    if (bad > ((cp->bad_max > 0.0) ? cp->bad_max : bad_max))
+                    {
+                        char diff[MOVIE_PATH_MAX];
+                        const char *pname = (path_num == 1) ? renderer_name : cp->name;
+                        snprintf(diff, sizeof(diff), "%s/diff_%s_%s.png", dir, name, pname);
+                        compare_write_diff(diff, cr, ci, cw, ch, ptol);
+                        printf("FAIL %s %s : %.3f %% pixels, max %d -> %s\n", name, pname, bad, r.maxd, diff);
+                        failed[p]++;
+                        ok = 0;
+                    }
+                }
+            }
+        }
+
+        free(ref);
+        free(img);
+        free(ref_down);
+        free(img_down);
+        movie_close(&m);
+    }
+    set_road_kernel(0);
+    set_road_path(ROAD_PATH_MESH);
+    if (get_render_backend() == RENDER_FIXED)
+        set_painter_order(0);
+    set_fixed_delta(0.0);
+
+    if (saved > 0)
+        printf("%d reference frames saved in %s\n", saved, dir);
+    printf("path          frames  failed  max diff  worst bad %%\n");
+    for (int p = 0; p < path_num; p++)
+    {
+        if (frames[p] == 0)
+            continue;
+        printf("%-12s  %6d  %6d  %8d  %11.3f\n", (path_num == 1) ? renderer_name : compare_paths[p].name,
+               frames[p], failed[p], maxd[p], worst[p]);
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+// ----------------------------------------
+// Average / max fragments per pixel of each course and zoom level.
+// A frame every OVERDRAW_STEP sec by all models. Stages differ in colors only,
+// so first stage is drawn. return 0 if failed
+static int overdraw_report(GLFWwindow *window)
+{
+    MOVIE m;
+    if (!movie_open(&m, NULL, MOVIE_PNG, SCRW, SCRH, EXPORT_FPS))
+    {
+        fprintf(stderr, "Error: Could not draw %dx%d offscreen\n", SCRW, SCRH);
+        return 0;
+    }
+
+    fps_display = 0;
+    glfwSwapInterval(0);
+    set_use_waittime(0);
+    set_fixed_delta(1.0 / EXPORT_FPS);
+    set_wall_grid(1, 1);
+    resize_window(SCRW, SCRH);
+    set_overdraw(1);
+
+    printf("%dx%d, a frame every %.1f sec\n", SCRW, SCRH, OVERDRAW_STEP);
+    printf("course  zoom      frames  avg overdraw  max overdraw\n");
+    for (int c = 0; c < get_course_max(); c++)
+    {
+        int frames[OVERDRAW_ZOOM_NUM] = {0};
+        double sum[OVERDRAW_ZOOM_NUM] = {0.0};
+        int max[OVERDRAW_ZOOM_NUM] = {0};
+
+        for (int md = 0; md < get_model_max(); md++)
+        {
+            set_course(c, 0, md);
+            float len = get_course_duration();
+            for (float t = 0.0; t < len; t += OVERDRAW_STEP)
+            {
+                seek_course_time(t);
+                movie_begin_frame(&m);
+                Render();
+
+                float avg;
+                int mx;
+                get_overdraw_stat(&avg, &mx);
+                int z = (int)(get_view_scale() / (1.0 / OVERDRAW_ZOOM_NUM));
+                if (z < 0)
+                    z = 0;
+                if (z >= OVERDRAW_ZOOM_NUM)
+                    z = OVERDRAW_ZOOM_NUM - 1;
+                frames[z]++;
+                sum[z] += avg;
+                if (mx > max[z])
+                    max[z] = mx;
+            }
+            glfwPollEvents();
+        }
+
+        for (int z = 0; z < OVERDRAW_ZOOM_NUM; z++)
+        {
+            if (frames[z] == 0)
+                continue;
+            printf("%6d  %.1f-%.1f  %6d  %12.2f  %12d\n", c, (float)z / OVERDRAW_ZOOM_NUM,
+                   (float)(z + 1) / OVERDRAW_ZOOM_NUM, frames[z], sum[z] / frames[z], max[z]);
+        }
+    }
+
+    movie_close(&m);
+    set_overdraw(0);
+    set_fixed_delta(0.0);
+    return 1;
+}
+
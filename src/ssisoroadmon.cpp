@@ -0,0 +1,141 @@
+// Last updated: <2026/10/20 07:18:52 +0900>
+//
+// Monitor of ssisoroadglfw. Reads live telemetry in shared memory (telemetry.h)
+// and prints it. Linux only
+//
+// Options
+// -name /NAME : shared memory name (default /ssisoroadgl). same as -telemetry of ssisoroadglfw
+// -watch SEC : print every SEC sec until ssisoroadglfw exits (default print once)
+//
+// by mieki256
+// License: CC0 / Public Domain
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include "telemetry.h"
+
+// writer did not update block for this time (sec)
+#define STALL_TIME 2.0
+
+static const char *stage_names[TELEMETRY_STAGE_MAX] = {
+    "update", "roads", "trees", "model", "overlay", "swap",
+};
+
+// ----------------------------------------
+// prototype declaration
+int main(int argc, char *argv[]);
+static int is_alive(unsigned int pid);
+static int get_current_rss(unsigned int pid);
+static void print_data(const TELEMETRY_DATA *d, int stalled);
+
+// ========================================
+int main(int argc, char *argv[])
+{
+    const char *name = TELEMETRY_NAME;
+    float watch = 0.0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-name") == 0 && i + 1 < argc)
+        {
+            name = argv[++i];
+        }
+        else if (strcmp(argv[i], "-watch") == 0 && i + 1 < argc)
+        {
+            watch = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-name /NAME] [-watch SEC]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    TELEMETRY t;
+    if (!telemetry_attach(&t, name))
+    {
+        fprintf(stderr, "%s : not running (no telemetry)\n", name);
+        exit(EXIT_FAILURE);
+    }
+
+    TELEMETRY_DATA d;
+    unsigned int last_seq = 0;
+    float still = 0.0;
+    int ret = EXIT_SUCCESS;
+    while (1)
+    {
+        if (!telemetry_read(&t, &d))
+        {
+            fprintf(stderr, "%s : writer is busy\n", name);
+            ret = EXIT_FAILURE;
+            break;
+        }
+        if (!is_alive(d.pid))
+        {
+            // writer was killed without removing shared memory
+            fprintf(stderr, "%s : not running (pid %u)\n", name, d.pid);
+            ret = EXIT_FAILURE;
+            break;
+        }
+
+        // seq changes every frame
+        still = (d.seq == last_seq) ? still + watch : 0.0;
+        last_seq = d.seq;
+        print_data(&d, (still >= STALL_TIME));
+
+        if (watch <= 0.0)
+            break;
+        usleep((useconds_t)(watch * 1000000.0));
+    }
+
+    telemetry_close(&t);
+    exit(ret);
+}
+
+static int is_alive(unsigned int pid)
+{
+    return (pid != 0 && kill((pid_t)pid, 0) == 0);
+}
+
+// resident set size (KB) from /proc. 0 if unknown
+static int get_current_rss(unsigned int pid)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%u/statm", pid);
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+        return 0;
+
+    long size, resident;
+    int n = fscanf(fp, "%ld %ld", &size, &resident);
+    fclose(fp);
+    if (n != 2)
+        return 0;
+    return (int)(resident * (sysconf(_SC_PAGESIZE) / 1024));
+}
+
+static void print_data(const TELEMETRY_DATA *d, int stalled)
+{
+    printf("pid %u%s  uptime %.1f sec  frames %u  missed %u\n",
+           d->pid, stalled ? " (stalled)" : "", d->uptime, d->frames, d->misses);
+    printf("  fps %.0f / %.0f  frame ms p50 %.2f  p90 %.2f  p99 %.2f  max %.2f\n",
+           d->fps, d->framerate, d->frame_ms[0], d->frame_ms[1], d->frame_ms[2], d->frame_ms[3]);
+
+    printf("  stage ms");
+    for (int i = 0; i < TELEMETRY_STAGE_MAX; i++)
+        printf("  %s %.2f", stage_names[i], d->stage_ms[i]);
+    printf("\n");
+
+    printf("  views %u  course %d  stage %d  model %d  time %.1f sec\n",
+           d->views, d->course, d->stage, d->model, d->course_time);
+    if (d->prims)
+        printf("  prims %u", d->prims);
+    else
+        printf("  prims -");
+    printf("  quality %u / %u  render scale %.2f\n", d->quality, d->quality_max, d->render_scale);
+    printf("  rss %d KB  max rss %u KB\n", get_current_rss(d->pid), d->max_rss);
+    fflush(stdout);
+}
@@ -0,0 +1,844 @@
+// Last updated: <2026/10/20 09:31:52 +0900>
+//
+// Replay OpenGL command stream of ssisoroadglfw -capture (glcapture.h)
+// at full speed, and print frame times. Same calls on other drivers /
+// machines, without course, stage and timing state of the capture.
+//
+// Usage : ssisoroadreplay [options] FILE
+// -vsync on|off : wait for vertical sync (default off)
+// -finish : glFinish() before the end of each frame. frame time includes GPU time
+// -hidden : invisible window
+// -csv FILE : write time of each frame into FILE
+//
+// by mieki256
+// License: CC0 / Public Domain
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define GLCAPTURE_IMPL
+#include "glfunc.h"
+#include <GLFW/glfw3.h>
+
+#define WDW_TITLE "ssisoroadreplay"
+
+// slowest frames in report
+#define SLOW_NUM 5
+
+// object names of capture -> names of replay context
+enum
+{
+    MAP_BUFFER,
+    MAP_TEXTURE,
+    MAP_VAO,
+    MAP_PROGRAM, // shaders and programs
+    MAP_FRAMEBUFFER,
+    MAP_RENDERBUFFER,
+    MAP_QUERY,
+    MAP_MAX,
+};
+
+typedef struct namemap
+{
+    GLuint *v;
+    int size;
+} NAMEMAP;
+
+// uniform location or uniform block index of program
+typedef struct locmap
+{
+    uint32_t program; // name of capture
+    uint32_t rec;     // value of capture
+    GLint loc;        // value of replay
+    int block;        // 1 = uniform block index
+} LOCMAP;
+
+typedef struct client_mem
+{
+    unsigned char *p;
+    int size;
+} CLIENT_MEM;
+
+static NAMEMAP maps[MAP_MAX];
+static LOCMAP *locs = NULL;
+static int loc_num = 0;
+static uint32_t cur_program = 0;
+static GLuint cur_array_buffer = 0;
+static CLIENT_MEM client_mem[GLCAP_ARRAY_MAX];
+static unsigned char *scratch = NULL;
+static int scratch_size = 0;
+
+// ----------------------------------------
+// prototype declaration
+int main(int argc, char *argv[]);
+static float f32(uint32_t w);
+static double f64(uint32_t lo, uint32_t hi);
+static const void *ofs64(uint32_t lo, uint32_t hi);
+static GLuint get_name(int kind, uint32_t name);
+static void set_name(int kind, uint32_t name, GLuint v);
+static void gen_names(int kind, const uint32_t *w);
+static void delete_names(int kind, const uint32_t *w);
+static void add_loc(uint32_t program, uint32_t rec, GLint loc, int block);
+static GLint get_loc(uint32_t program, uint32_t rec, int block);
+static void set_pointer(int kind, GLint size, GLenum type, GLsizei stride, const void *ptr);
+static void *get_scratch(int size);
+static int replay(GLCAPTURE_REC *r, const uint32_t *w, const unsigned char *data);
+static int cmp_double(const void *a, const void *b);
+static void print_report(const double *ms, int num);
+void error_callback(int error, const char *description);
+
+// ========================================
+int main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    const char *csv_path = NULL;
+    int vsync = 0;
+    int finish = 0;
+    int hidden = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-vsync") == 0 && i + 1 < argc)
+            vsync = (strcmp(argv[++i], "on") == 0);
+        else if (strcmp(argv[i], "-finish") == 0)
+            finish = 1;
+        else if (strcmp(argv[i], "-hidden") == 0)
+            hidden = 1;
+        else if (strcmp(argv[i], "-csv") == 0 && i + 1 < argc)
+            csv_path = argv[++i];
+        else if (argv[i][0] != '-' && path == NULL)
+            path = argv[i];
+        else
+            path = NULL, i = argc;
+    }
+    if (path == NULL)
+    {
+        fprintf(stderr, "Usage: %s [-vsync on|off] [-finish] [-hidden] [-csv FILE] FILE\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Error: Could not open %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    GLCAPTURE_HEADER h;
+    if (fread(&h, sizeof(h), 1, fp) != 1 || h.magic != GLCAPTURE_MAGIC || h.version != GLCAPTURE_VERSION)
+    {
+        fprintf(stderr, "Error: %s is not a capture of this version\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    // same context as capture
+    if (h.core)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GLFW_TRUE);
+    }
+    else
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 1);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    }
+    glfwWindowHint(GLFW_STENCIL_BITS, 8);
+    if (hidden)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(h.width, h.height, WDW_TITLE, NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(vsync);
+
+    glfunc_set_getproc((GLFUNC_GETPROC)glfwGetProcAddress);
+    glfunc_load();
+    printf("capture : %ux%u, %s, OpenGL %u.%u, %u frames\n", h.width, h.height, h.core ? "core" : "fixed",
+           h.gl_version / 10, h.gl_version % 10, h.frames);
+    printf("replay  : %s\n", (const char *)glGetString(GL_RENDERER));
+    printf("          %s\n", (const char *)glGetString(GL_VERSION));
+    if (glf_version < (int)h.gl_version)
+        printf("Warning: OpenGL %d.%d is older than capture\n", glf_version / 10, glf_version % 10);
+
+    int max = (h.frames > 0) ? h.frames : 1024;
+    double *ms = (double *)malloc(sizeof(double) * max);
+    int frames = 0;
+    int ok = 1;
+
+    unsigned char *data = NULL;
+    uint32_t data_size = 0;
+    uint32_t w[GLCAPTURE_WORD_MAX];
+    GLCAPTURE_REC r;
+    double t0 = glfwGetTime();
+
+    while (fread(&r, sizeof(r), 1, fp) == 1)
+    {
+        uint32_t size = (r.size + 3) & ~3u;
+        if (r.words > GLCAPTURE_WORD_MAX || fread(w, sizeof(uint32_t), r.words, fp) != r.words)
+        {
+            ok = 0;
+            break;
+        }
+        if (size > data_size)
+        {
+            data = (unsigned char *)realloc(data, size);
+            data_size = size;
+        }
+        if (size > 0 && fread(data, 1, size, fp) != size)
+        {
+            ok = 0;
+            break;
+        }
+
+        if (r.op != GLCAP_FRAME)
+        {
+            if (!replay(&r, w, data))
+            {
+                fprintf(stderr, "Error: Unknown operation %d\n", r.op);
+                ok = 0;
+                break;
+            }
+            continue;
+        }
+
+        if (finish)
+            glFinish();
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+        double t1 = glfwGetTime();
+        if (frames >= max)
+        {
+            max *= 2;
+            ms = (double *)realloc(ms, sizeof(double) * max);
+        }
+        ms[frames++] = (t1 - t0) * 1000.0;
+        t0 = t1;
+        if (glfwWindowShouldClose(window))
+            break;
+    }
+    fclose(fp);
+    if (!ok)
+        fprintf(stderr, "Error: %s is broken after frame %d\n", path, frames);
+
+    if (csv_path)
+    {
+        FILE *csv = fopen(csv_path, "w");
+        if (csv)
+        {
+            fprintf(csv, "frame,ms\n");
+            for (int i = 0; i < frames; i++)
+                fprintf(csv, "%d,%.3f\n", i, ms[i]);
+            fclose(csv);
+        }
+    }
+    print_report(ms, frames);
+
+    free(ms);
+    free(data);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static float f32(uint32_t w)
+{
+    float f;
+    memcpy(&f, &w, sizeof(f));
+    return f;
+}
+
+static double f64(uint32_t lo, uint32_t hi)
+{
+    uint64_t u = ((uint64_t)hi << 32) | lo;
+    double d;
+    memcpy(&d, &u, sizeof(d));
+    return d;
+}
+
+// offset in buffer object
+static const void *ofs64(uint32_t lo, uint32_t hi)
+{
+    return (const void *)(size_t)(((uint64_t)hi << 32) | lo);
+}
+
+static GLuint get_name(int kind, uint32_t name)
+{
+    const NAMEMAP *m = &maps[kind];
+    if (name == 0 || (int)name >= m->size)
+        return 0;
+    return m->v[name];
+}
+
+static void set_name(int kind, uint32_t name, GLuint v)
+{
+    NAMEMAP *m = &maps[kind];
+    if ((int)name >= m->size)
+    {
+        int n = name + 256;
+        m->v = (GLuint *)realloc(m->v, sizeof(GLuint) * n);
+        memset(m->v + m->size, 0, sizeof(GLuint) * (n - m->size));
+        m->size = n;
+    }
+    m->v[name] = v;
+}
+
+// w : n, names of capture
+static void gen_names(int kind, const uint32_t *w)
+{
+    GLuint v[GLCAPTURE_WORD_MAX];
+    GLsizei n = w[0];
+    switch (kind)
+    {
+    case MAP_BUFFER:
+        glGenBuffers(n, v);
+        break;
+    case MAP_TEXTURE:
+        glGenTextures(n, v);
+        break;
+    case MAP_VAO:
+        glGenVertexArrays(n, v);
+        break;
+    case MAP_FRAMEBUFFER:
+        glGenFramebuffers(n, v);
+        break;
+    case MAP_RENDERBUFFER:
+        glGenRenderbuffers(n, v);
+        break;
+    case MAP_QUERY:
+        glGenQueries(n, v);
+        break;
+    }
+    for (int i = 0; i < n; i++)
+        set_name(kind, w[1 + i], v[i]);
+}
+
+static void delete_names(int kind, const uint32_t *w)
+{
+    GLuint v[GLCAPTURE_WORD_MAX];
+    GLsizei n = w[0];
+    for (int i = 0; i < n; i++)
+    {
+        v[i] = get_name(kind, w[1 + i]);
+        set_name(kind, w[1 + i], 0);
+    }
+    switch (kind)
+    {
+    case MAP_BUFFER:
+        glDeleteBuffers(n, v);
+        break;
+    case MAP_TEXTURE:
+        glDeleteTextures(n, v);
+        break;
+    case MAP_VAO:
+        glDeleteVertexArrays(n, v);
+        break;
+    case MAP_FRAMEBUFFER:
+        glDeleteFramebuffers(n, v);
+        break;
+    case MAP_RENDERBUFFER:
+        glDeleteRenderbuffers(n, v);
+        break;
+    case MAP_QUERY:
+        glDeleteQueries(n, v);
+        break;
+    }
+}
+
+static void add_loc(uint32_t program, uint32_t rec, GLint loc, int block)
+{
+    for (int i = 0; i < loc_num; i++)
+    {
+        LOCMAP *l = &locs[i];
+        if (l->program == program && l->rec == rec && l->block == block)
+        {
+            l->loc = loc;
+            return;
+        }
+    }
+    locs = (LOCMAP *)realloc(locs, sizeof(LOCMAP) * (loc_num + 1));
+    LOCMAP *l = &locs[loc_num++];
+    l->program = program;
+    l->rec = rec;
+    l->loc = loc;
+    l->block = block;
+}
+
+// -1 (and invalid index) is kept
+static GLint get_loc(uint32_t program, uint32_t rec, int block)
+{
+    for (int i = 0; i < loc_num; i++)
+    {
+        const LOCMAP *l = &locs[i];
+        if (l->program == program && l->rec == rec && l->block == block)
+            return l->loc;
+    }
+    return (GLint)rec;
+}
+
+static void set_pointer(int kind, GLint size, GLenum type, GLsizei stride, const void *ptr)
+{
+    switch (kind)
+    {
+    case GLCAP_ARRAY_VERTEX:
+        glVertexPointer(size, type, stride, ptr);
+        break;
+    case GLCAP_ARRAY_NORMAL:
+        glNormalPointer(type, stride, ptr);
+        break;
+    case GLCAP_ARRAY_COLOR:
+        glColorPointer(size, type, stride, ptr);
+        break;
+    case GLCAP_ARRAY_TEXCOORD:
+        glTexCoordPointer(size, type, stride, ptr);
+        break;
+    }
+}
+
+static void *get_scratch(int size)
+{
+    if (size > scratch_size)
+    {
+        scratch = (unsigned char *)realloc(scratch, size);
+        scratch_size = size;
+    }
+    return scratch;
+}
+
+// issue one call. return 0 if op is unknown
+static int replay(GLCAPTURE_REC *r, const uint32_t *w, const unsigned char *data)
+{
+    const void *d = (r->size > 0) ? data : NULL;
+
+    switch (r->op)
+    {
+    case GLCAP_ENABLE:
+        glEnable(w[0]);
+        break;
+    case GLCAP_DISABLE:
+        glDisable(w[0]);
+        break;
+    case GLCAP_ENABLE_CLIENT_STATE:
+        glEnableClientState(w[0]);
+        break;
+    case GLCAP_DISABLE_CLIENT_STATE:
+        glDisableClientState(w[0]);
+        break;
+    case GLCAP_ARRAY_POINTER:
+        // client side array is set by GLCAP_CLIENT_ARRAY of each draw call
+        if (!w[4])
+            set_pointer(w[0], w[1], w[2], w[3], ofs64(w[5], w[6]));
+        break;
+    case GLCAP_CLIENT_ARRAY:
+    {
+        int kind = w[0];
+        if (kind < 0 || kind >= GLCAP_ARRAY_MAX)
+            return 0;
+        CLIENT_MEM *m = &client_mem[kind];
+        if ((int)r->size > m->size)
+        {
+            m->p = (unsigned char *)realloc(m->p, r->size);
+            m->size = r->size;
+        }
+        memcpy(m->p, data, r->size);
+
+        GLsizei stride = w[3];
+        int elem = w[1] * ((w[2] == GL_UNSIGNED_BYTE || w[2] == GL_BYTE) ? 1 : (w[2] == GL_DOUBLE) ? 8 : 4);
+        const unsigned char *p = m->p - (size_t)((stride > 0) ? stride : elem) * w[4];
+        if (cur_array_buffer)
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        set_pointer(kind, w[1], w[2], stride, p);
+        if (cur_array_buffer)
+            glBindBuffer(GL_ARRAY_BUFFER, cur_array_buffer);
+        break;
+    }
+    case GLCAP_DRAW_ARRAYS:
+        glDrawArrays(w[0], w[1], w[2]);
+        break;
+    case GLCAP_DRAW_ELEMENTS:
+        glDrawElements(w[0], w[1], w[2], w[3] ? d : ofs64(w[4], w[5]));
+        break;
+    case GLCAP_DRAW_ARRAYS_INSTANCED:
+        glDrawArraysInstanced(w[0], w[1], w[2], w[3]);
+        break;
+    case GLCAP_BEGIN:
+        glBegin(w[0]);
+        break;
+    case GLCAP_END:
+        glEnd();
+        break;
+    case GLCAP_VERTEX2F:
+        glVertex2f(f32(w[0]), f32(w[1]));
+        break;
+    case GLCAP_VERTEX3F:
+        glVertex3f(f32(w[0]), f32(w[1]), f32(w[2]));
+        break;
+    case GLCAP_VERTEX2D:
+        glVertex2d(f64(w[0], w[1]), f64(w[2], w[3]));
+        break;
+    case GLCAP_VERTEX3D:
+        glVertex3d(f64(w[0], w[1]), f64(w[2], w[3]), f64(w[4], w[5]));
+        break;
+    case GLCAP_TEXCOORD2F:
+        glTexCoord2f(f32(w[0]), f32(w[1]));
+        break;
+    case GLCAP_COLOR4F:
+        glColor4f(f32(w[0]), f32(w[1]), f32(w[2]), f32(w[3]));
+        break;
+    case GLCAP_RASTER_POS3F:
+        glRasterPos3f(f32(w[0]), f32(w[1]), f32(w[2]));
+        break;
+    case GLCAP_BITMAP:
+        glBitmap(w[0], w[1], f32(w[2]), f32(w[3]), f32(w[4]), f32(w[5]), (const GLubyte *)d);
+        break;
+    case GLCAP_MATRIX_MODE:
+        glMatrixMode(w[0]);
+        break;
+    case GLCAP_LOAD_IDENTITY:
+        glLoadIdentity();
+        break;
+    case GLCAP_PUSH_MATRIX:
+        glPushMatrix();
+        break;
+    case GLCAP_POP_MATRIX:
+        glPopMatrix();
+        break;
+    case GLCAP_ORTHO:
+        glOrtho(f64(w[0], w[1]), f64(w[2], w[3]), f64(w[4], w[5]), f64(w[6], w[7]), f64(w[8], w[9]),
+                f64(w[10], w[11]));
+        break;
+    case GLCAP_TRANSLATEF:
+        glTranslatef(f32(w[0]), f32(w[1]), f32(w[2]));
+        break;
+    case GLCAP_TRANSLATED:
+        glTranslated(f64(w[0], w[1]), f64(w[2], w[3]), f64(w[4], w[5]));
+        break;
+    case GLCAP_ROTATEF:
+        glRotatef(f32(w[0]), f32(w[1]), f32(w[2]), f32(w[3]));
+        break;
+    case GLCAP_SCALEF:
+        glScalef(f32(w[0]), f32(w[1]), f32(w[2]));
+        break;
+    case GLCAP_VIEWPORT:
+        glViewport(w[0], w[1], w[2], w[3]);
+        break;
+    case GLCAP_SCISSOR:
+        glScissor(w[0], w[1], w[2], w[3]);
+        break;
+    case GLCAP_CLEAR:
+        glClear(w[0]);
+        break;
+    case GLCAP_CLEAR_COLOR:
+        glClearColor(f32(w[0]), f32(w[1]), f32(w[2]), f32(w[3]));
+        break;
+    case GLCAP_CLEAR_DEPTH:
+        glClearDepth(f64(w[0], w[1]));
+        break;
+    case GLCAP_CLEAR_STENCIL:
+        glClearStencil(w[0]);
+        break;
+    case GLCAP_BLEND_FUNC:
+        glBlendFunc(w[0], w[1]);
+        break;
+    case GLCAP_DEPTH_FUNC:
+        glDepthFunc(w[0]);
+        break;
+    case GLCAP_STENCIL_FUNC:
+        glStencilFunc(w[0], w[1], w[2]);
+        break;
+    case GLCAP_STENCIL_OP:
+        glStencilOp(w[0], w[1], w[2]);
+        break;
+    case GLCAP_CULL_FACE:
+        glCullFace(w[0]);
+        break;
+    case GLCAP_FRONT_FACE:
+        glFrontFace(w[0]);
+        break;
+    case GLCAP_SHADE_MODEL:
+        glShadeModel(w[0]);
+        break;
+    case GLCAP_COLOR_MATERIAL:
+        glColorMaterial(w[0], w[1]);
+        break;
+    case GLCAP_LIGHTFV:
+        glLightfv(w[0], w[1], (const GLfloat *)d);
+        break;
+    case GLCAP_PIXEL_STOREI:
+        glPixelStorei(w[0], w[1]);
+        break;
+    case GLCAP_PUSH_ATTRIB:
+        glPushAttrib(w[0]);
+        break;
+    case GLCAP_POP_ATTRIB:
+        glPopAttrib();
+        break;
+    case GLCAP_READ_PIXELS:
+    {
+        // largest pack alignment
+        int size = glcapture_image_size(w[2], w[3], w[4], w[5], 8);
+        if (size <= 0)
+            size = w[2] * w[3] * 16;
+        glReadPixels(w[0], w[1], w[2], w[3], w[4], w[5], get_scratch(size));
+        break;
+    }
+    case GLCAP_FINISH:
+        glFinish();
+        break;
+    case GLCAP_GEN_TEXTURES:
+        gen_names(MAP_TEXTURE, w);
+        break;
+    case GLCAP_DELETE_TEXTURES:
+        delete_names(MAP_TEXTURE, w);
+        break;
+    case GLCAP_BIND_TEXTURE:
+        glBindTexture(w[0], get_name(MAP_TEXTURE, w[1]));
+        break;
+    case GLCAP_TEX_IMAGE_2D:
+        glTexImage2D(w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7], d);
+        break;
+    case GLCAP_TEX_PARAMETERI:
+        glTexParameteri(w[0], w[1], w[2]);
+        break;
+    case GLCAP_TEX_ENVI:
+        glTexEnvi(w[0], w[1], w[2]);
+        break;
+    case GLCAP_GENERATE_MIPMAP:
+        glGenerateMipmap(w[0]);
+        break;
+    case GLCAP_GEN_BUFFERS:
+        gen_names(MAP_BUFFER, w);
+        break;
+    case GLCAP_DELETE_BUFFERS:
+        delete_names(MAP_BUFFER, w);
+        break;
+    case GLCAP_BIND_BUFFER:
+    {
+        GLuint b = get_name(MAP_BUFFER, w[1]);
+        if (w[0] == GL_ARRAY_BUFFER)
+            cur_array_buffer = b;
+        glBindBuffer(w[0], b);
+        break;
+    }
+    case GLCAP_BUFFER_DATA:
+        glBufferData(w[0], w[1], d, w[2]);
+        break;
+    case GLCAP_BUFFER_SUB_DATA:
+        glBufferSubData(w[0], w[1], r->size, d);
+        break;
+    case GLCAP_BIND_BUFFER_RANGE:
+        glBindBufferRange(w[0], w[1], get_name(MAP_BUFFER, w[2]), w[3], w[4]);
+        break;
+    case GLCAP_PRIMITIVE_RESTART_INDEX:
+        glPrimitiveRestartIndex(w[0]);
+        break;
+    case GLCAP_GEN_VERTEX_ARRAYS:
+        gen_names(MAP_VAO, w);
+        break;
+    case GLCAP_DELETE_VERTEX_ARRAYS:
+        delete_names(MAP_VAO, w);
+        break;
+    case GLCAP_BIND_VERTEX_ARRAY:
+        glBindVertexArray(get_name(MAP_VAO, w[0]));
+        break;
+    case GLCAP_ENABLE_VERTEX_ATTRIB_ARRAY:
+        glEnableVertexAttribArray(w[0]);
+        break;
+    case GLCAP_DISABLE_VERTEX_ATTRIB_ARRAY:
+        glDisableVertexAttribArray(w[0]);
+        break;
+    case GLCAP_VERTEX_ATTRIB_POINTER:
+        glVertexAttribPointer(w[0], w[1], w[2], w[3], w[4], ofs64(w[5], w[6]));
+        break;
+    case GLCAP_VERTEX_ATTRIB_DIVISOR:
+        glVertexAttribDivisor(w[0], w[1]);
+        break;
+    case GLCAP_VERTEX_ATTRIB4F:
+        glVertexAttrib4f(w[0], f32(w[1]), f32(w[2]), f32(w[3]), f32(w[4]));
+        break;
+    case GLCAP_CREATE_SHADER:
+        set_name(MAP_PROGRAM, w[1], glCreateShader(w[0]));
+        break;
+    case GLCAP_DELETE_SHADER:
+        glDeleteShader(get_name(MAP_PROGRAM, w[0]));
+        set_name(MAP_PROGRAM, w[0], 0);
+        break;
+    case GLCAP_SHADER_SOURCE:
+    {
+        // (length, string) * count
+        int count = w[1];
+        const GLchar **str = (const GLchar **)malloc(sizeof(GLchar *) * count);
+        GLint *len = (GLint *)malloc(sizeof(GLint) * count);
+        const unsigned char *p = data;
+        for (int i = 0; i < count; i++)
+        {
+            uint32_t n;
+            memcpy(&n, p, sizeof(n));
+            len[i] = n;
+            str[i] = (const GLchar *)(p + sizeof(n));
+            p += sizeof(n) + n;
+        }
+        glShaderSource(get_name(MAP_PROGRAM, w[0]), count, str, len);
+        free(str);
+        free(len);
+        break;
+    }
+    case GLCAP_COMPILE_SHADER:
+        glCompileShader(get_name(MAP_PROGRAM, w[0]));
+        break;
+    case GLCAP_CREATE_PROGRAM:
+        set_name(MAP_PROGRAM, w[0], glCreateProgram());
+        break;
+    case GLCAP_DELETE_PROGRAM:
+        glDeleteProgram(get_name(MAP_PROGRAM, w[0]));
+        set_name(MAP_PROGRAM, w[0], 0);
+        break;
+    case GLCAP_ATTACH_SHADER:
+        glAttachShader(get_name(MAP_PROGRAM, w[0]), get_name(MAP_PROGRAM, w[1]));
+        break;
+    case GLCAP_LINK_PROGRAM:
+        glLinkProgram(get_name(MAP_PROGRAM, w[0]));
+        break;
+    case GLCAP_USE_PROGRAM:
+        cur_program = w[0];
+        glUseProgram(get_name(MAP_PROGRAM, w[0]));
+        break;
+    case GLCAP_GET_UNIFORM_LOCATION:
+        add_loc(w[0], w[1], glGetUniformLocation(get_name(MAP_PROGRAM, w[0]), (const GLchar *)data), 0);
+        break;
+    case GLCAP_GET_UNIFORM_BLOCK_INDEX:
+        add_loc(w[0], w[1], glGetUniformBlockIndex(get_name(MAP_PROGRAM, w[0]), (const GLchar *)data), 1);
+        break;
+    case GLCAP_UNIFORM_BLOCK_BINDING:
+        glUniformBlockBinding(get_name(MAP_PROGRAM, w[0]), get_loc(w[0], w[1], 1), w[2]);
+        break;
+    case GLCAP_UNIFORM1I:
+        glUniform1i(get_loc(cur_program, w[0], 0), w[1]);
+        break;
+    case GLCAP_UNIFORM1F:
+        glUniform1f(get_loc(cur_program, w[0], 0), f32(w[1]));
+        break;
+    case GLCAP_UNIFORM2F:
+        glUniform2f(get_loc(cur_program, w[0], 0), f32(w[1]), f32(w[2]));
+        break;
+    case GLCAP_UNIFORM4FV:
+        glUniform4fv(get_loc(cur_program, w[0], 0), w[1], (const GLfloat *)d);
+        break;
+    case GLCAP_GEN_FRAMEBUFFERS:
+        gen_names(MAP_FRAMEBUFFER, w);
+        break;
+    case GLCAP_DELETE_FRAMEBUFFERS:
+        delete_names(MAP_FRAMEBUFFER, w);
+        break;
+    case GLCAP_BIND_FRAMEBUFFER:
+        glBindFramebuffer(w[0], get_name(MAP_FRAMEBUFFER, w[1]));
+        break;
+    case GLCAP_FRAMEBUFFER_TEXTURE_2D:
+        glFramebufferTexture2D(w[0], w[1], w[2], get_name(MAP_TEXTURE, w[3]), w[4]);
+        break;
+    case GLCAP_GEN_RENDERBUFFERS:
+        gen_names(MAP_RENDERBUFFER, w);
+        break;
+    case GLCAP_DELETE_RENDERBUFFERS:
+        delete_names(MAP_RENDERBUFFER, w);
+        break;
+    case GLCAP_BIND_RENDERBUFFER:
+        glBindRenderbuffer(w[0], get_name(MAP_RENDERBUFFER, w[1]));
+        break;
+    case GLCAP_RENDERBUFFER_STORAGE:
+        glRenderbufferStorage(w[0], w[1], w[2], w[3]);
+        break;
+    case GLCAP_FRAMEBUFFER_RENDERBUFFER:
+        glFramebufferRenderbuffer(w[0], w[1], w[2], get_name(MAP_RENDERBUFFER, w[3]));
+        break;
+    case GLCAP_GEN_QUERIES:
+        gen_names(MAP_QUERY, w);
+        break;
+    case GLCAP_DELETE_QUERIES:
+        delete_names(MAP_QUERY, w);
+        break;
+    case GLCAP_BEGIN_QUERY:
+        glBeginQuery(w[0], get_name(MAP_QUERY, w[1]));
+        break;
+    case GLCAP_END_QUERY:
+        glEndQuery(w[0]);
+        break;
+    case GLCAP_DRAW_PIXELS:
+        glDrawPixels(w[0], w[1], w[2], w[3], d);
+        break;
+    default:
+        return 0;
+    }
+    return 1;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// first frame includes startup (objects, shaders, textures), so it is not in statistics
+static void print_report(const double *ms, int num)
+{
+    if (num <= 0)
+    {
+        printf("no frames\n");
+        return;
+    }
+    printf("startup + frame 0 : %.2f ms\n", ms[0]);
+    int n = num - 1;
+    if (n <= 0)
+        return;
+
+    double *v = (double *)malloc(sizeof(double) * n);
+    double sum = 0.0;
+    memcpy(v, ms + 1, sizeof(double) * n);
+    for (int i = 0; i < n; i++)
+        sum += v[i];
+    qsort(v, n, sizeof(double), cmp_double);
+
+    // nearest rank
+    const int pct[3] = {50, 90, 99};
+    double p[3];
+    for (int i = 0; i < 3; i++)
+    {
+        int k = (int)ceil(pct[i] / 100.0 * n) - 1;
+        p[i] = v[(k < 0) ? 0 : k];
+    }
+    printf("frames 1 - %d : avg %.2f ms (%.1f FPS), p50 %.2f, p90 %.2f, p99 %.2f, max %.2f ms\n",
+           n, sum / n, 1000.0 * n / sum, p[0], p[1], p[2], v[n - 1]);
+
+    // slowest frames, for a look at the capture
+    printf("slowest :");
+    for (int k = 0; k < SLOW_NUM && k < n; k++)
+    {
+        double th = v[n - 1 - k];
+        for (int i = 1; i < num; i++)
+        {
+            if (ms[i] == th)
+            {
+                printf(" #%d %.2f", i, ms[i]);
+                break;
+            }
+        }
+    }
+    printf(" ms\n");
+    free(v);
+}
+
+void error_callback(int error, const char *description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
@@ -0,0 +1,155 @@
+// Last updated: <2026/10/20 07:18:52 +0900>
+//
+// Live telemetry in POSIX shared memory.
+//
+// Seqlock. Writer : seq + 1 (odd), release fence, copy, seq + 1 (even, release).
+// Reader : seq (acquire), copy, acquire fence, seq again. Copy is good when
+// both are the same even number.
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "telemetry.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#endif
+
+// tries of reader while writer is busy
+#define READ_RETRY 1000
+
+// fields copied under seqlock. after seq
+#define BODY_OFS (offsetof(TELEMETRY_DATA, seq) + sizeof(uint32_t))
+
+// ========================================
+// make shared memory of writer. return 0 if failed
+int telemetry_open(TELEMETRY *t, const char *name)
+{
+    memset(t, 0, sizeof(TELEMETRY));
+#ifdef _WIN32
+    return 0;
+#else
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+        return 0;
+    if (ftruncate(fd, sizeof(TELEMETRY_DATA)) != 0)
+    {
+        close(fd);
+        shm_unlink(name);
+        return 0;
+    }
+    void *p = mmap(NULL, sizeof(TELEMETRY_DATA), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+    {
+        shm_unlink(name);
+        return 0;
+    }
+
+    t->data = (TELEMETRY_DATA *)p;
+    t->writer = 1;
+    snprintf(t->name, sizeof(t->name), "%s", name);
+
+    // header is written once. magic last, so readers see a complete header
+    TELEMETRY_DATA *d = t->data;
+    memset(d, 0, sizeof(TELEMETRY_DATA));
+    d->version = TELEMETRY_VERSION;
+    d->size = sizeof(TELEMETRY_DATA);
+    d->pid = getpid();
+    __atomic_store_n(&d->magic, TELEMETRY_MAGIC, __ATOMIC_RELEASE);
+    return 1;
+#endif
+}
+
+// copy d into shared memory. header fields of d are ignored
+void telemetry_publish(TELEMETRY *t, const TELEMETRY_DATA *d)
+{
+    if (t->data == NULL || !t->writer)
+        return;
+
+    TELEMETRY_DATA *s = t->data;
+    uint32_t seq = s->seq;
+    __atomic_store_n(&s->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy((char *)s + BODY_OFS, (const char *)d + BODY_OFS, sizeof(TELEMETRY_DATA) - BODY_OFS);
+#ifndef _WIN32
+    // system call without file access
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0)
+        s->max_rss = ru.ru_maxrss;
+#endif
+    __atomic_store_n(&s->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+// map shared memory of writer read only. return 0 if not found or other layout
+int telemetry_attach(TELEMETRY *t, const char *name)
+{
+    memset(t, 0, sizeof(TELEMETRY));
+#ifdef _WIN32
+    return 0;
+#else
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return 0;
+
+    struct stat st;
+    void *p = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(TELEMETRY_DATA))
+        p = mmap(NULL, sizeof(TELEMETRY_DATA), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return 0;
+
+    t->data = (TELEMETRY_DATA *)p;
+    snprintf(t->name, sizeof(t->name), "%s", name);
+    const TELEMETRY_DATA *d = t->data;
+    if (__atomic_load_n(&d->magic, __ATOMIC_ACQUIRE) != TELEMETRY_MAGIC || d->version != TELEMETRY_VERSION
+        || d->size != sizeof(TELEMETRY_DATA))
+    {
+        telemetry_close(t);
+        return 0;
+    }
+    return 1;
+#endif
+}
+
+// consistent copy of shared memory. return 0 if writer was always busy
+int telemetry_read(const TELEMETRY *t, TELEMETRY_DATA *d)
+{
+    if (t->data == NULL)
+        return 0;
+
+    const TELEMETRY_DATA *s = t->data;
+    for (int i = 0; i < READ_RETRY; i++)
+    {
+        uint32_t s0 = __atomic_load_n(&s->seq, __ATOMIC_ACQUIRE);
+        if (s0 & 1)
+            continue;
+        memcpy(d, (const void *)s, sizeof(TELEMETRY_DATA));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint32_t s1 = __atomic_load_n(&s->seq, __ATOMIC_RELAXED);
+        if (s0 == s1)
+        {
+            d->seq = s0;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// writer removes shared memory name. readers keep their mapping
+void telemetry_close(TELEMETRY *t)
+{
+#ifndef _WIN32
+    if (t->data)
+        munmap(t->data, sizeof(TELEMETRY_DATA));
+    if (t->writer)
+        shm_unlink(t->name);
+#endif
+    t->data = NULL;
+    t->writer = 0;
+}
@@ -0,0 +1,75 @@
+// Last updated: <2026/10/20 07:18:52 +0900>
+//
+// Live telemetry in POSIX shared memory. The renderer writes a block of
+// fixed layout once per frame, and monitors map it read only
+// (ssisoroadmon). Nothing waits : the writer is a memory copy between two
+// increments of a sequence counter (seqlock), and readers copy again when
+// the counter was odd or changed during the copy.
+//
+// All fields are 4 bytes, so the layout is the same for 32 / 64 bit
+// processes. Fields are only appended, and version is raised when the
+// meaning of a field changes.
+// Windows has no POSIX shared memory, so telemetry_open() fails there.
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <stdint.h>
+
+// shared memory object name
+#define TELEMETRY_NAME "/ssisoroadgl"
+
+#define TELEMETRY_MAGIC 0x52495353 // "SSIR"
+#define TELEMETRY_VERSION 1
+
+// stages of frame. same order as framestat.h
+#define TELEMETRY_STAGE_MAX 6
+
+// frame interval percentiles
+#define TELEMETRY_PCT_NUM 4 // 50, 90, 99, 100
+
+typedef struct telemetry_data
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size; // bytes of this struct
+    uint32_t pid;  // writer process
+    uint32_t seq;  // odd while writing
+
+    uint32_t frames;    // frames since start
+    uint32_t misses;    // frames over budget * FRAMESTAT_MISS
+    float uptime;       // sec
+    float framerate;    // target frame rate
+    float fps;          // frames of last second
+    float frame_ms[TELEMETRY_PCT_NUM];   // frame interval percentiles of last frames
+    float stage_ms[TELEMETRY_STAGE_MAX]; // CPU time of stages of last frame
+
+    uint32_t views;
+    int32_t course; // view 0
+    int32_t stage;
+    int32_t model;
+    float course_time; // sec from course entry of view 0
+
+    uint32_t prims;     // primitives of scene counted by GPU, 1 - 2 frames ago. 0 = unknown
+    uint32_t quality;   // quality level 1 - quality_max
+    uint32_t quality_max;
+    float render_scale; // scene resolution / window
+    uint32_t max_rss;   // peak resident set size (KB). current one is in /proc/PID/statm
+} TELEMETRY_DATA;
+
+typedef struct telemetry
+{
+    TELEMETRY_DATA *data; // mapped shared memory
+    int writer;
+    char name[64];
+} TELEMETRY;
+
+// ----------------------------------------
+// prototype declaration
+int telemetry_open(TELEMETRY *t, const char *name);
+void telemetry_publish(TELEMETRY *t, const TELEMETRY_DATA *d);
+int telemetry_attach(TELEMETRY *t, const char *name);
+int telemetry_read(const TELEMETRY *t, TELEMETRY_DATA *d);
+void telemetry_close(TELEMETRY *t);
+
+#endif
@@ -0,0 +1,312 @@
+// Last updated: <2026/10/20 02:41:17 +0900>
+//
+// Prerendered tiles of static course (roads and trees).
+//
+// Tiles are rendered into textures through one framebuffer object with
+// depth renderbuffer, and mipmapped for zoom between levels.
+// Fixed function OpenGL only.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "glfunc.h"
+#include "tilecache.h"
+
+// 30 degree tilt of scene
+#define TILT_SIN 0.5
+
+// depth range of tile is tile size + this. trees are lower than this
+#define DEPTH_MARGIN 400.0
+
+typedef struct tile
+{
+    GLuint tex;
+    int valid;
+    int course;
+    int stg;
+    int level;
+    int tx;
+    int ty;
+    unsigned int used; // frame number of last use
+} TILE;
+
+static TILE tiles[TILECACHE_MAX];
+static GLuint fbo = 0;
+static GLuint depth_rb = 0;
+static TILECACHE_DRAWFUNC draw_func = NULL;
+static unsigned int frame = 0;
+
+// ----------------------------------------
+// prototype declaration
+static double get_tile_size(int level);
+static void get_tile_range(int level, double u0, double v0, double u1, double v1,
+                           int *tx0, int *ty0, int *tx1, int *ty1);
+static TILE *find_tile(int course, int stg, int level, int tx, int ty);
+static TILE *alloc_tile(void);
+static int make_tile(TILE *t);
+
+// ========================================
+static double get_tile_size(int level)
+{
+    return TILECACHE_UNIT * (1 << level);
+}
+
+// tiles which cover rectangle (u0, v0) - (u1, v1) of projected plane
+static void get_tile_range(int level, double u0, double v0, double u1, double v1,
+                           int *tx0, int *ty0, int *tx1, int *ty1)
+{
+    double size = get_tile_size(level);
+    *tx0 = (int)floor(u0 / size);
+    *ty0 = (int)floor(v0 / size);
+    *tx1 = (int)floor(u1 / size);
+    *ty1 = (int)floor(v1 / size);
+}
+
+static TILE *find_tile(int course, int stg, int level, int tx, int ty)
+{
+    for (int i = 0; i < TILECACHE_MAX; i++)
+    {
+        TILE *t = &tiles[i];
+        if (t->valid && t->tx == tx && t->ty == ty && t->level == level
+            && t->course == course && t->stg == stg)
+            return t;
+    }
+    return NULL;
+}
+
+// unused tile, or least recently used one. tiles used in this frame are kept
+static TILE *alloc_tile(void)
+{
+    TILE *lru = NULL;
+    for (int i = 0; i < TILECACHE_MAX; i++)
+    {
+        TILE *t = &tiles[i];
+        if (!t->valid)
+        {
+            lru = t;
+            break;
+        }
+        if (t->used != frame && (lru == NULL || t->used < lru->used))
+            lru = t;
+    }
+    if (lru == NULL)
+        return NULL;
+
+    lru->valid = 0;
+
+    if (lru->tex == 0)
+    {
+        glGenTextures(1, &lru->tex);
+        glBindTexture(GL_TEXTURE_2D, lru->tex);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TILECACHE_PX, TILECACHE_PX, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    return lru;
+}
+
+// render static geometry into texture of tile
+static int make_tile(TILE *t)
+{
+    double size = get_tile_size(t->level);
+    double uc = (t->tx + 0.5) * size;
+    double vc = (t->ty + 0.5) * size;
+    double zr = size + DEPTH_MARGIN;
+
+    // screen may be framebuffer object of movie output (movie.h)
+    GLint prev_fbo = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prev_fbo);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t->tex, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo);
+        return 0;
+    }
+
+    glPushAttrib(GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
+    glViewport(0, 0, TILECACHE_PX, TILECACHE_PX);
+    glDisable(GL_SCISSOR_TEST);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(-size * 0.5, size * 0.5, -size * 0.5, size * 0.5, -zr, zr);
+
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+    glRotatef(30, 1, 0, 0);
+
+    // ground point (uc, 0, -vc / sin30) comes to center of tile
+    draw_func(t->course, t->stg, uc, -vc / TILT_SIN, size);
+
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopAttrib();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo);
+
+    glBindTexture(GL_TEXTURE_2D, t->tex);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return 1;
+}
+
+// func draws static geometry into tile. return 0 if framebuffer object is not supported
+int tilecache_init(TILECACHE_DRAWFUNC func)
+{
+    tilecache_free();
+    if (!glf_has_fbo)
+        return 0;
+
+    draw_func = func;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &depth_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_rb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, TILECACHE_PX, TILECACHE_PX);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_rb);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return 1;
+}
+
+// delete all tiles. needs current OpenGL context
+void tilecache_free(void)
+{
+    for (int i = 0; i < TILECACHE_MAX; i++)
+    {
+        if (tiles[i].tex)
+            glDeleteTextures(1, &tiles[i].tex);
+    }
+    memset(tiles, 0, sizeof(tiles));
+
+    if (fbo)
+    {
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &depth_rb);
+    }
+    fbo = 0;
+    depth_rb = 0;
+    draw_func = NULL;
+}
+
+void tilecache_begin_frame(void)
+{
+    frame++;
+}
+
+// coarsest level whose texels are not larger than pixels of view
+int tilecache_get_level(int scrh, float view_h)
+{
+    double px = scrh / (2.0 * view_h); // pixels per world unit
+    for (int level = TILECACHE_LEVEL_MAX - 1; level > 0; level--)
+    {
+        if (TILECACHE_PX / get_tile_size(level) >= px)
+            return level;
+    }
+    return 0;
+}
+
+// make tiles of rectangle (u0, v0) - (u1, v1) which are not in cache.
+// budget : max number of tiles to make (decreased), NULL = no limit.
+// return number of tiles which are not ready
+int tilecache_prepare(int course, int stg, int level, double u0, double v0, double u1, double v1,
+                      int *budget)
+{
+    if (fbo == 0)
+        return 1;
+
+    int tx0, ty0, tx1, ty1;
+    int missing = 0;
+    get_tile_range(level, u0, v0, u1, v1, &tx0, &ty0, &tx1, &ty1);
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            TILE *t = find_tile(course, stg, level, tx, ty);
+            if (t == NULL)
+            {
+                if ((budget && *budget <= 0) || (t = alloc_tile()) == NULL)
+                {
+                    missing++;
+                    continue;
+                }
+
+                t->course = course;
+                t->stg = stg;
+                t->level = level;
+                t->tx = tx;
+                t->ty = ty;
+                if (!make_tile(t))
+                {
+                    missing++;
+                    continue;
+                }
+                t->valid = 1;
+                if (budget)
+                    (*budget)--;
+            }
+            t->used = frame;
+        }
+    }
+    return missing;
+}
+
+// draw tiles of rectangle (u0, v0) - (u1, v1) with current matrices.
+// (cu, cv) of projected plane comes to origin
+void tilecache_draw(int course, int stg, int level, double u0, double v0, double u1, double v1,
+                    double cu, double cv)
+{
+    int tx0, ty0, tx1, ty1;
+    double size = get_tile_size(level);
+    get_tile_range(level, u0, v0, u1, v1, &tx0, &ty0, &tx1, &ty1);
+
+    glPushAttrib(GL_ENABLE_BIT | GL_TEXTURE_BIT | GL_CURRENT_BIT);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_TEXTURE_2D);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+    glColor4f(1.0, 1.0, 1.0, 1.0);
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            const TILE *t = find_tile(course, stg, level, tx, ty);
+            if (t == NULL)
+                continue;
+
+            double x0 = tx * size - cu;
+            double y0 = ty * size - cv;
+            double x1 = x0 + size;
+            double y1 = y0 + size;
+            glBindTexture(GL_TEXTURE_2D, t->tex);
+            glBegin(GL_QUADS);
+            glTexCoord2f(0.0, 0.0);
+            glVertex2d(x0, y0);
+            glTexCoord2f(1.0, 0.0);
+            glVertex2d(x1, y0);
+            glTexCoord2f(1.0, 1.0);
+            glVertex2d(x1, y1);
+            glTexCoord2f(0.0, 1.0);
+            glVertex2d(x0, y1);
+            glEnd();
+        }
+    }
+
+    glPopAttrib();
+}
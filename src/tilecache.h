@@ -0,0 +1,39 @@
+// Last updated: <2026/10/19 22:31:08 +0900>
+//
+// Prerendered tiles of static course (roads and trees).
+//
+// The scene is orthographic with fixed 30 degree tilt, so static geometry
+// only moves in 2D on screen. It is rendered once into textures of a tile
+// grid on the projected plane (u = x, v = y * cos30 - z * sin30), and drawn
+// as textured quads after that. Tiles are made in a few zoom levels
+// (level n tile is 2^n times larger), and evicted in least recently used order.
+
+#ifndef __TILECACHE_H__
+#define __TILECACHE_H__
+
+// texture size of tile (pixel)
+#define TILECACHE_PX 256
+
+// tile size of level 0 (world unit)
+#define TILECACHE_UNIT 32.0
+
+#define TILECACHE_LEVEL_MAX 6
+#define TILECACHE_MAX 128
+
+// draw static geometry of course / stage into tile (size x size), including clear.
+// projection and tilt are set by tile cache. world point (x, 0, z) must come
+// to origin. course coordinates are large, so translate in double precision
+typedef void (*TILECACHE_DRAWFUNC)(int course, int stg, double x, double z, double size);
+
+// ----------------------------------------
+// prototype declaration
+int tilecache_init(TILECACHE_DRAWFUNC func);
+void tilecache_free(void);
+void tilecache_begin_frame(void);
+int tilecache_get_level(int scrh, float view_h);
+int tilecache_prepare(int course, int stg, int level, double u0, double v0, double u1, double v1,
+                      int *budget);
+void tilecache_draw(int course, int stg, int level, double u0, double v0, double u1, double v1,
+                    double cu, double cv);
+
+#endif
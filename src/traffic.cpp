@@ -0,0 +1,281 @@
+// Last updated: <2026/10/20 14:12:40 +0900>
+//
+// Traffic. Many vehicles on the course, stored as structure of arrays.
+//
+// Each lane keeps vehicle numbers sorted by travel distance. The order
+// changes little between frames, so insertion sort is almost O(n).
+// Positions are distance along the course, speeds are m/s.
+
+#define _USE_MATH_DEFINES
+#include <stdlib.h>
+#include <math.h>
+#include "traffic.h"
+
+#define rad2deg(x) ((x) / M_PI * 180.0)
+
+// curve ahead of speed model (world unit)
+#define CURVE_LOOKAHEAD 248.0
+
+// keep course entry of player lane clear (world unit)
+#define ENTRY_CLEAR 620.0
+
+#define PLAYER_LANE 0
+
+// ----------------------------------------
+// prototype declaration
+static float wrap_angle(float a);
+static float get_dist(const TRAFFIC *t, int v);
+static void set_dist(TRAFFIC *t, const TRAFFICCOURSE *c, int v, float d);
+static void sort_lane(TRAFFIC *t, int lane);
+static float get_rand(TRAFFIC *t);
+
+// ========================================
+static float wrap_angle(float a)
+{
+    while (a > 180.0)
+        a -= 360.0;
+    while (a < -180.0)
+        a += 360.0;
+    return a;
+}
+
+// travel distance from course entry of each lane
+static float get_dist(const TRAFFIC *t, int v)
+{
+    if (t->lane[v] == 0)
+        return t->pos[v];
+    return t->len - t->pos[v];
+}
+
+static void set_dist(TRAFFIC *t, const TRAFFICCOURSE *c, int v, float d)
+{
+    t->pos[v] = (t->lane[v] == 0) ? d : t->len - d;
+    t->idx[v] = roadarc_get_idx(c->arc, t->pos[v]);
+}
+
+static void sort_lane(TRAFFIC *t, int lane)
+{
+    int *o = t->order[lane];
+    int n = t->order_num[lane];
+
+    for (int i = 1; i < n; i++)
+    {
+        int v = o[i];
+        float d = get_dist(t, v);
+        int j = i - 1;
+        while (j >= 0 && get_dist(t, o[j]) > d)
+        {
+            o[j + 1] = o[j];
+            j--;
+        }
+        o[j + 1] = v;
+    }
+}
+
+void traffic_build_course(TRAFFICCOURSE *c, const ROADDATA *roads, int roads_len, const ROADARC *arc)
+{
+    c->roads_len = roads_len;
+    c->arc = arc;
+    c->ang = (float *)malloc(sizeof(float) * roads_len);
+    c->ang_sum = (float *)malloc(sizeof(float) * (roads_len + 1));
+
+    for (int i = 0; i < roads_len; i++)
+    {
+        int i0 = (i < roads_len - 1) ? i : roads_len - 2;
+        double xd = roads[i0 + 1].cx - roads[i0].cx;
+        double yd = roads[i0 + 1].cy - roads[i0].cy;
+        c->ang[i] = rad2deg(atan2(yd, xd));
+    }
+
+    c->ang_sum[0] = 0.0;
+    for (int i = 0; i < roads_len; i++)
+    {
+        float a = (i < roads_len - 1) ? fabsf(wrap_angle(c->ang[i + 1] - c->ang[i])) : 0.0;
+        c->ang_sum[i + 1] = c->ang_sum[i] + a;
+    }
+}
+
+void traffic_free_course(TRAFFICCOURSE *c)
+{
+    free(c->ang);
+    free(c->ang_sum);
+    c->ang = NULL;
+    c->ang_sum = NULL;
+    c->arc = NULL;
+    c->roads_len = 0;
+}
+
+// length of lanes (world unit). vehicles run until road index roads_len - 3
+float traffic_get_len(const TRAFFICCOURSE *c)
+{
+    return roadarc_get_dist(c->arc, (float)(c->roads_len - 3));
+}
+
+// get sum of angle change in CURVE_LOOKAHEAD ahead. O(1)
+float traffic_get_curve(const TRAFFICCOURSE *c, float idx, int lane)
+{
+    double d = roadarc_get_dist(c->arc, idx);
+    d += (lane == 0) ? CURVE_LOOKAHEAD : -CURVE_LOOKAHEAD;
+
+    int last = c->roads_len - 1;
+    int i = (int)idx;
+    int k = (int)roadarc_get_idx(c->arc, d);
+    if (i < 0)
+        i = 0;
+    if (i > last)
+        i = last;
+    if (k > last)
+        k = last;
+    return fabsf(c->ang_sum[k] - c->ang_sum[i]);
+}
+
+// get direction of vehicle (degree)
+float traffic_get_angle(const TRAFFICCOURSE *c, float idx, int lane)
+{
+    int i = (int)idx;
+    if (i < 0)
+        i = 0;
+    if (i > c->roads_len - 2)
+        i = c->roads_len - 2;
+    float f = idx - (float)i;
+    float a = c->ang[i] + wrap_angle(c->ang[i + 1] - c->ang[i]) * f;
+    return (lane == 0) ? a : a + 180.0;
+}
+
+int traffic_is_on_course(const TRAFFIC *t, int v)
+{
+    return (t->pos[v] >= 0.0 && t->pos[v] <= t->len);
+}
+
+// xorshift. return 0.0 - 1.0 (not include 1.0)
+static float get_rand(TRAFFIC *t)
+{
+    unsigned int v = t->seed;
+    v ^= v << 13;
+    v ^= v >> 17;
+    v ^= v << 5;
+    t->seed = v;
+    return (v >> 8) / 16777216.0;
+}
+
+// place num vehicles evenly on both lanes. seed : random seed of kind and max speed
+void traffic_init(TRAFFIC *t, const TRAFFICCOURSE *c, int num, int kind_max, float spdmax, unsigned int seed)
+{
+    if (num > TRAFFIC_MAX)
+        num = TRAFFIC_MAX;
+    if (num < 0)
+        num = 0;
+
+    t->num = num;
+    t->len = traffic_get_len(c);
+    t->player_spdmax = spdmax;
+    t->seed = (seed != 0) ? seed : 1;
+    for (int lane = 0; lane < TRAFFIC_LANE_MAX; lane++)
+        t->order_num[lane] = 0;
+
+    for (int v = 0; v < num; v++)
+    {
+        int lane = v % TRAFFIC_LANE_MAX;
+        int n = v / TRAFFIC_LANE_MAX;
+        int cnt = (num - lane + TRAFFIC_LANE_MAX - 1) / TRAFFIC_LANE_MAX;
+
+        t->lane[v] = lane;
+        t->kind[v] = (int)(get_rand(t) * kind_max);
+        t->spdmax[v] = spdmax * (0.5 + 0.4 * get_rand(t));
+        if (t->kind[v] == 1)
+            t->spdmax[v] *= 0.7;
+        t->spd[v] = t->spdmax[v] * 0.5;
+        t->ofs[v] = (lane == 0) ? 0.75 : 0.25;
+
+        float d = ENTRY_CLEAR + (t->len - ENTRY_CLEAR * 2) * (float)n / (float)cnt;
+        set_dist(t, c, v, d);
+        t->order[lane][t->order_num[lane]++] = v;
+    }
+}
+
+// frames : elapsed time in 1/60 sec. player_pos : distance of player (world unit)
+void traffic_update(TRAFFIC *t, const TRAFFICCOURSE *c, float frames, float player_pos)
+{
+    float len = t->len;
+    float gap = TRAFFIC_GAP_MIN * ROADARC_UNIT_PER_M;
+    float step = frames / 60.0 * ROADARC_UNIT_PER_M; // distance of 1 m/s
+
+    for (int lane = 0; lane < TRAFFIC_LANE_MAX; lane++)
+    {
+        sort_lane(t, lane);
+
+        int *o = t->order[lane];
+        int n = t->order_num[lane];
+
+        // from front to rear, so that leader is already moved
+        for (int k = n - 1; k >= 0; k--)
+        {
+            int v = o[k];
+            float d = get_dist(t, v);
+            float spd = t->spd[v];
+            float spdmax = t->spdmax[v];
+
+            // speed model. slow down before curve
+            float a = traffic_get_curve(c, t->idx[v], lane);
+            if (a < TRAFFIC_CURVE_FAST)
+            {
+                spd += TRAFFIC_ACCEL * frames;
+                if (spd >= spdmax)
+                    spd = spdmax;
+            }
+            else if (a > TRAFFIC_CURVE_SLOW)
+            {
+                spd -= TRAFFIC_ACCEL * frames;
+                if (spd <= spdmax * 0.4)
+                    spd = spdmax * 0.4;
+            }
+
+            // car following. leader is next vehicle in sorted order, or player
+            float lead = 1.0e9;
+            if (k < n - 1)
+                lead = get_dist(t, o[k + 1]);
+            if (lead < d)
+                lead = 1.0e9; // leader moved to entry in this frame
+            if (lane == PLAYER_LANE && player_pos > d && player_pos < lead)
+                lead = player_pos;
+
+            float limit = ((lead - d) / ROADARC_UNIT_PER_M - TRAFFIC_GAP_MIN) / TRAFFIC_HEADWAY;
+            if (limit < 0.0)
+                limit = 0.0;
+            if (spd > limit)
+                spd = limit;
+
+            t->spd[v] = spd;
+            d += spd * step;
+
+            // reached course exit. move to entry, behind rearmost vehicle
+            if (d >= len)
+            {
+                float rear = get_dist(t, o[0]);
+                d = 0.0;
+                if (o[0] != v && rear < gap * 2)
+                    d = rear - gap * 2;
+                t->spd[v] = spdmax * 0.5;
+            }
+            set_dist(t, c, v, d);
+        }
+    }
+
+    // speed limit of player by vehicle ahead
+    {
+        int *o = t->order[PLAYER_LANE];
+        int n = t->order_num[PLAYER_LANE];
+        float lead = 1.0e9;
+        for (int k = 0; k < n; k++)
+        {
+            float d = get_dist(t, o[k]);
+            if (d > player_pos)
+            {
+                lead = d;
+                break;
+            }
+        }
+        float limit = ((lead - player_pos) / ROADARC_UNIT_PER_M - TRAFFIC_GAP_MIN) / TRAFFIC_HEADWAY;
+        t->player_spdmax = (limit < 0.0) ? 0.0 : limit;
+    }
+}
@@ -0,0 +1,65 @@
+// Last updated: <2026/10/20 14:12:40 +0900>
+//
+// Traffic. Many vehicles on the course, stored as structure of arrays.
+
+#ifndef __TRAFFIC_H__
+#define __TRAFFIC_H__
+
+#include "roads.h"
+#include "roadarc.h"
+
+#define TRAFFIC_MAX 2048
+
+// lane 0 : same direction as player. lane 1 : opposite direction
+#define TRAFFIC_LANE_MAX 2
+
+// car following. min gap (m) and headway (sec)
+#define TRAFFIC_GAP_MIN 8.5
+#define TRAFFIC_HEADWAY (1.0 / 3.0)
+
+// speed model of traffic and player (motion.cpp). sum of angle change ahead (degree)
+// over TRAFFIC_CURVE_SLOW slows down, under TRAFFIC_CURVE_FAST speeds up
+#define TRAFFIC_CURVE_SLOW 30.0
+#define TRAFFIC_CURVE_FAST 20.0
+#define TRAFFIC_ACCEL 0.42 // (m/s per 1/60 sec)
+
+// vehicles waiting at course entry have negative travel distance
+typedef struct traffic
+{
+    int num;
+    float len;                       // length of lanes (world unit)
+    float pos[TRAFFIC_MAX];          // distance from road data 0 (world unit)
+    float idx[TRAFFIC_MAX];          // position (road index), made from pos
+    float spd[TRAFFIC_MAX];          // speed (m/s)
+    float spdmax[TRAFFIC_MAX];       // max speed
+    float ofs[TRAFFIC_MAX];          // lane offset. 0.0 = left edge, 1.0 = right edge
+    unsigned char lane[TRAFFIC_MAX]; // lane number
+    unsigned char kind[TRAFFIC_MAX]; // model kind
+    int order_num[TRAFFIC_LANE_MAX];
+    int order[TRAFFIC_LANE_MAX][TRAFFIC_MAX]; // vehicle number sorted by travel distance
+
+    float player_spdmax; // speed limit of player (m/s), set by traffic_update()
+    unsigned int seed;   // xorshift state of traffic_init()
+} TRAFFIC;
+
+// per course table for speed model
+typedef struct trafficcourse
+{
+    int roads_len;
+    const ROADARC *arc;
+    float *ang;     // [roads_len] direction of road (degree)
+    float *ang_sum; // [roads_len + 1] sum of absolute angle change
+} TRAFFICCOURSE;
+
+// ----------------------------------------
+// prototype declaration
+void traffic_build_course(TRAFFICCOURSE *c, const ROADDATA *roads, int roads_len, const ROADARC *arc);
+void traffic_free_course(TRAFFICCOURSE *c);
+void traffic_init(TRAFFIC *t, const TRAFFICCOURSE *c, int num, int kind_max, float spdmax, unsigned int seed);
+void traffic_update(TRAFFIC *t, const TRAFFICCOURSE *c, float frames, float player_pos);
+float traffic_get_len(const TRAFFICCOURSE *c);
+float traffic_get_curve(const TRAFFICCOURSE *c, float idx, int lane);
+float traffic_get_angle(const TRAFFICCOURSE *c, float idx, int lane);
+int traffic_is_on_course(const TRAFFIC *t, int v);
+
+#endif
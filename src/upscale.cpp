@@ -0,0 +1,118 @@
+// Last updated: <2026/10/20 06:02:44 +0900>
+//
+// Scene at lower resolution than window.
+//
+// Color is a texture, depth and stencil are one packed renderbuffer
+// (stencil counts overdraw). They are made again when size changes.
+// upscale_draw() is fixed function. Shader renderer uses glcore_draw_texture().
+
+#include <stdlib.h>
+#include "glfunc.h"
+#include "upscale.h"
+
+// ----------------------------------------
+// prototype declaration
+static int make_target(UPSCALE *u, int w, int h);
+
+// ========================================
+// return 0 if failed
+static int make_target(UPSCALE *u, int w, int h)
+{
+    upscale_free(u);
+
+    glGenTextures(1, &u->tex);
+    glBindTexture(GL_TEXTURE_2D, u->tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &u->depth_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, u->depth_rb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, w, h);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &u->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, u->fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, u->tex, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, u->depth_rb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, u->depth_rb);
+    int ok = (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+    glBindFramebuffer(GL_FRAMEBUFFER, u->prev_fbo);
+
+    if (!ok)
+    {
+        upscale_free(u);
+        return 0;
+    }
+    u->w = w;
+    u->h = h;
+    return 1;
+}
+
+// bind framebuffer object of w x h. current framebuffer (window or movie)
+// is kept for upscale_end(). return 0 if not supported
+int upscale_begin(UPSCALE *u, int w, int h)
+{
+    if (!glf_has_fbo || w <= 0 || h <= 0)
+        return 0;
+
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &u->prev_fbo);
+    if ((u->fbo == 0 || u->w != w || u->h != h) && !make_target(u, w, h))
+        return 0;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, u->fbo);
+    return 1;
+}
+
+void upscale_end(UPSCALE *u)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, u->prev_fbo);
+}
+
+// stretch scene to current viewport
+void upscale_draw(const UPSCALE *u)
+{
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_LIGHTING);
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    glBindTexture(GL_TEXTURE_2D, u->tex);
+    glEnable(GL_TEXTURE_2D);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+    glBegin(GL_QUADS);
+    glTexCoord2f(0, 0);
+    glVertex2f(-1, -1);
+    glTexCoord2f(1, 0);
+    glVertex2f(1, -1);
+    glTexCoord2f(1, 1);
+    glVertex2f(1, 1);
+    glTexCoord2f(0, 1);
+    glVertex2f(-1, 1);
+    glEnd();
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    glDisable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void upscale_free(UPSCALE *u)
+{
+    if (u->fbo)
+        glDeleteFramebuffers(1, &u->fbo);
+    if (u->tex)
+        glDeleteTextures(1, &u->tex);
+    if (u->depth_rb)
+        glDeleteRenderbuffers(1, &u->depth_rb);
+    u->fbo = 0;
+    u->tex = 0;
+    u->depth_rb = 0;
+    u->w = 0;
+    u->h = 0;
+}
@@ -0,0 +1,33 @@
+// Last updated: <2026/10/20 06:02:44 +0900>
+//
+// Scene at lower resolution than window. The scene is drawn into a
+// framebuffer object of scaled size, and stretched to the window with one
+// textured quad (bilinear). Fill cost of the scene is scale ^ 2.
+// Text is drawn after that at window resolution, so it stays sharp.
+
+#ifndef __UPSCALE_H__
+#define __UPSCALE_H__
+
+#include "glfunc.h"
+
+// smallest scale of scene
+#define UPSCALE_MIN 0.25
+
+typedef struct upscale
+{
+    int w;
+    int h;
+    GLuint fbo;
+    GLuint tex;
+    GLuint depth_rb; // depth and stencil
+    GLint prev_fbo;  // framebuffer before upscale_begin()
+} UPSCALE;
+
+// ----------------------------------------
+// prototype declaration
+int upscale_begin(UPSCALE *u, int w, int h);
+void upscale_end(UPSCALE *u);
+void upscale_draw(const UPSCALE *u);
+void upscale_free(UPSCALE *u);
+
+#endif
@@ -0,0 +1,192 @@
+// Last updated: <2026/10/20 03:32:05 +0900>
+//
+// Worker threads. Jobs are run in pushed order. With one thread they also
+// finish in that order.
+//
+// Queue is a ring with two counting semaphores (free and filled). Lock is
+// a semaphore of count 1.
+
+#include <stdlib.h>
+#include "workers.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#define SEM_MAX 0x7fffffff
+
+// ----------------------------------------
+// prototype declaration
+#ifdef _WIN32
+static DWORD WINAPI worker_main(LPVOID arg);
+#else
+static void *worker_main(void *arg);
+#endif
+
+// ========================================
+void workers_sem_init(WORKERS_SEM *s, int n)
+{
+#ifdef _WIN32
+    *s = CreateSemaphore(NULL, n, SEM_MAX, NULL);
+#else
+    sem_init(s, 0, n);
+#endif
+}
+
+void workers_sem_destroy(WORKERS_SEM *s)
+{
+#ifdef _WIN32
+    CloseHandle(*s);
+#else
+    sem_destroy(s);
+#endif
+}
+
+void workers_sem_wait(WORKERS_SEM *s)
+{
+#ifdef _WIN32
+    WaitForSingleObject(*s, INFINITE);
+#else
+    while (sem_wait(s) != 0)
+        ; // interrupted by signal
+#endif
+}
+
+void workers_sem_post(WORKERS_SEM *s)
+{
+#ifdef _WIN32
+    ReleaseSemaphore(*s, 1, NULL);
+#else
+    sem_post(s);
+#endif
+}
+
+int workers_get_cpu_num(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    int n = si.dwNumberOfProcessors;
+#else
+    int n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (n < 1) ? 1 : n;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker_main(LPVOID arg)
+#else
+static void *worker_main(void *arg)
+#endif
+{
+    WORKERS *w = (WORKERS *)arg;
+
+    while (1)
+    {
+        workers_sem_wait(&w->sem_filled);
+        workers_sem_wait(&w->lock);
+        WORKERS_JOB job = w->queue[w->tail];
+        w->tail = (w->tail + 1) % w->queue_max;
+        workers_sem_post(&w->lock);
+        workers_sem_post(&w->sem_free);
+
+        if (job.func == NULL)
+            break;
+        job.func(job.arg);
+
+        workers_sem_wait(&w->lock);
+        w->busy--;
+        if (w->busy == 0 && w->waiting)
+        {
+            w->waiting = 0;
+            workers_sem_post(&w->sem_done);
+        }
+        workers_sem_post(&w->lock);
+    }
+    return 0;
+}
+
+// threads = 0 : number of CPUs
+void workers_init(WORKERS *w, int threads, int queue_max)
+{
+    if (threads <= 0)
+        threads = workers_get_cpu_num();
+    if (threads > WORKERS_THREAD_MAX)
+        threads = WORKERS_THREAD_MAX;
+    if (queue_max < 1)
+        queue_max = 1;
+
+    w->num = threads;
+    w->queue_max = queue_max;
+    w->queue = (WORKERS_JOB *)malloc(sizeof(WORKERS_JOB) * queue_max);
+    w->head = 0;
+    w->tail = 0;
+    w->busy = 0;
+    w->waiting = 0;
+    workers_sem_init(&w->sem_free, queue_max);
+    workers_sem_init(&w->sem_filled, 0);
+    workers_sem_init(&w->lock, 1);
+    workers_sem_init(&w->sem_done, 0);
+
+    for (int i = 0; i < threads; i++)
+    {
+#ifdef _WIN32
+        w->th[i] = CreateThread(NULL, 0, worker_main, w, 0, NULL);
+#else
+        pthread_create(&w->th[i], NULL, worker_main, w);
+#endif
+    }
+}
+
+// wait if queue is full. func = NULL stops one thread
+void workers_push(WORKERS *w, WORKERS_FUNC func, void *arg)
+{
+    workers_sem_wait(&w->sem_free);
+    workers_sem_wait(&w->lock);
+    w->queue[w->head].func = func;
+    w->queue[w->head].arg = arg;
+    w->head = (w->head + 1) % w->queue_max;
+    if (func)
+        w->busy++;
+    workers_sem_post(&w->lock);
+    workers_sem_post(&w->sem_filled);
+}
+
+// wait until all pushed jobs finish
+void workers_wait(WORKERS *w)
+{
+    workers_sem_wait(&w->lock);
+    if (w->busy == 0)
+    {
+        workers_sem_post(&w->lock);
+        return;
+    }
+    w->waiting = 1;
+    workers_sem_post(&w->lock);
+    workers_sem_wait(&w->sem_done);
+}
+
+// finish all jobs and stop threads
+void workers_free(WORKERS *w)
+{
+    for (int i = 0; i < w->num; i++)
+        workers_push(w, NULL, NULL);
+
+    for (int i = 0; i < w->num; i++)
+    {
+#ifdef _WIN32
+        WaitForSingleObject(w->th[i], INFINITE);
+        CloseHandle(w->th[i]);
+#else
+        pthread_join(w->th[i], NULL);
+#endif
+    }
+
+    workers_sem_destroy(&w->sem_free);
+    workers_sem_destroy(&w->sem_filled);
+    workers_sem_destroy(&w->lock);
+    workers_sem_destroy(&w->sem_done);
+    free(w->queue);
+    w->queue = NULL;
+    w->num = 0;
+}
@@ -0,0 +1,67 @@
+// Last updated: <2026/10/20 03:32:05 +0900>
+//
+// Worker threads. Jobs are run in pushed order. With one thread they also
+// finish in that order. Windows threads or pthreads, without std::thread
+// (MinGW gcc 6.3.0 does not have it).
+
+#ifndef __WORKERS_H__
+#define __WORKERS_H__
+
+#ifdef _WIN32
+// Windows
+#include <windows.h>
+typedef HANDLE WORKERS_SEM;
+#else
+// Linux
+#include <pthread.h>
+#include <semaphore.h>
+typedef sem_t WORKERS_SEM;
+#endif
+
+#define WORKERS_THREAD_MAX 64
+
+typedef void (*WORKERS_FUNC)(void *arg);
+
+typedef struct workers_job
+{
+    WORKERS_FUNC func; // NULL = quit
+    void *arg;
+} WORKERS_JOB;
+
+typedef struct workers
+{
+    int num; // threads
+#ifdef _WIN32
+    HANDLE th[WORKERS_THREAD_MAX];
+#else
+    pthread_t th[WORKERS_THREAD_MAX];
+#endif
+
+    // queue of jobs. pushed from one thread
+    int queue_max;
+    WORKERS_JOB *queue;
+    int head;
+    int tail;
+    WORKERS_SEM sem_free;
+    WORKERS_SEM sem_filled;
+
+    WORKERS_SEM lock;
+    int busy;    // pushed and not finished jobs
+    int waiting; // workers_wait() is waiting
+    WORKERS_SEM sem_done;
+} WORKERS;
+
+// ----------------------------------------
+// prototype declaration
+int workers_get_cpu_num(void);
+void workers_init(WORKERS *w, int threads, int queue_max);
+void workers_push(WORKERS *w, WORKERS_FUNC func, void *arg);
+void workers_wait(WORKERS *w);
+void workers_free(WORKERS *w);
+
+void workers_sem_init(WORKERS_SEM *s, int n);
+void workers_sem_destroy(WORKERS_SEM *s);
+void workers_sem_wait(WORKERS_SEM *s);
+void workers_sem_post(WORKERS_SEM *s);
+
+#endif
@@ -1,3481 +1,357 @@
 #ifndef __YASYAJINTOUGE__
 #define __YASYAJINTOUGE__
 
-#include "roads.h"
+#define YASYAJINTOUGE_NUM 347
 
-#define YASYAJINTOUGE_NUM 3470
-
-static ROADDATA yasyajintouge_data[3470] = {
-  { 138358464.64281902, 46322042.67960672, 138358424.64283523, 46322042.64359961, 138358504.6428028, 46322042.715613835, 138358462.64281982, 46322042.67780636, 138358466.6428182, 46322042.68140708, 0, 0, 0, 0, 0 },
-  { 138358464.6242538, 46322063.30353174, 138358424.63632235, 46322064.28604739, 138358504.61218527, 46322062.321016096, 138358462.62485725, 46322063.35265753, 138358466.62365037, 46322063.25440596, 0, 0, 0, 0, 0 },
-  { 138358465.12358904, 46322083.62624406, 138358425.1717926, 46322085.58939481, 138358505.07538548, 46322081.66309331, 138358463.1259992, 46322083.7244016, 138358467.12117887, 46322083.52808652, 1, 2, 138358285.34050503, 46322092.460422434, 32 },
-  { 138358466.10903648, 46322103.68094205, 138358426.21416003, 46322106.57901607, 138358506.00391293, 46322100.782868035, 138358464.11429265, 46322103.82584575, 138358468.1037803, 46322103.536038354, 0, 0, 0, 0, 0 },
-  { 138358467.54880744, 46322123.500824004, 138358427.72782183, 46322127.28091715, 138358507.36979306, 46322119.720730856, 138358465.55775815, 46322123.689828664, 138358469.53985673, 46322123.311819345, 1, 5, 138358245.5468126, 46322144.5748433, 36 },
-  { 138358469.4111136, 46322143.11908828, 138358429.67681655, 46322147.72187422, 138358509.14541063, 46322138.51630233, 138358467.42439875, 46322143.34922758, 138358471.39782843, 46322142.88894898, 0, 0, 0, 0, 0 },
-  { 138358471.66416648, 46322162.56893318, 138358432.02499422, 46322167.929532245, 138358511.30333874, 46322157.20833412, 138358469.68220785, 46322162.83696313, 138358473.6461251, 46322162.30090323, 1, 5, 138358337.8819601, 46322180.66095503, 33 },
-  { 138358474.2761775, 46322181.88355704, 138358434.7361881, 46322187.93246108, 138358513.81616688, 46322175.83465299, 138358472.29917803, 46322182.18600224, 138358476.25317696, 46322181.58111183, 0, 0, 0, 0, 0 },
-  { 138358477.21535838, 46322201.096158184, 138358437.77437744, 46322207.76016762, 138358516.65633932, 46322194.43214875, 138358475.24330932, 46322201.42935865, 138358479.18740743, 46322200.762957714, 1, 0, 138358142.95304483, 46322257.57363814, 26 },
-  { 138358480.44992065, 46322220.23993498, 138358441.10383132, 46322227.44307689, 138358519.79601, 46322213.03679307, 138358478.4826162, 46322220.600092076, 138358482.41722512, 46322219.879777886, 0, 0, 0, 0, 0 },
-  { 138358483.9480757, 46322239.34808572, 138358444.68922997, 46322247.01248586, 138358523.20692146, 46322231.68368557, 138358481.9851334, 46322239.731305726, 138358485.911018, 46322238.96486571, 0, 0, 0, 0, 0 },
-  { 138358487.67803526, 46322258.45380877, 138358448.49575844, 46322266.50049648, 138358526.86031207, 46322250.40712106, 138358485.71892142, 46322258.856143154, 138358489.6371491, 46322258.051474385, 0, 0, 0, 0, 0 },
-  { 138358491.60801077, 46322277.59030244, 138358452.48917234, 46322285.939942, 138358530.7268492, 46322269.24066287, 138358489.65206885, 46322278.00778442, 138358493.56395268, 46322277.17282046, 0, 0, 0, 0, 0 },
-  { 138358495.7062138, 46322296.79076505, 138358456.6358368, 46322305.36430821, 138358534.7765908, 46322288.217221886, 138358493.75269496, 46322297.2194422, 138358497.65973264, 46322296.36208789, 0, 0, 0, 0, 0 },
-  { 138358499.9408559, 46322316.08839494, 138358460.90274057, 46322324.807658225, 138358538.9789712, 46322307.369131655, 138358497.98895013, 46322316.5243581, 138358501.89276165, 46322315.65243178, 0, 0, 0, 0, 0 },
-  { 138358504.28014857, 46322335.516390435, 138358465.25748834, 46322344.30456372, 138358543.3028088, 46322326.72821715, 138358502.32901555, 46322335.9557991, 138358506.23128158, 46322335.07698177, 0, 0, 0, 0, 0 },
-  { 138358508.69230342, 46322355.107949905, 138358469.6785065, 46322363.93538725, 138358547.70610034, 46322346.280512564, 138358506.74161357, 46322355.54932177, 138358510.64299327, 46322354.66657804, 1, 1, 138358290.21504068, 46322404.541599, 44 },
-  { 138358513.16576928, 46322374.87890742, 138358474.24765512, 46322384.119058475, 138358552.08388343, 46322365.638756365, 138358511.21986356, 46322375.34091497, 138358515.111675, 46322374.41689987, 1, 3, 138358660.08165017, 46322339.9973372, 42 },
-  { 138358517.8694824, 46322394.69023334, 138358479.20184818, 46322404.92810735, 138358556.53711662, 46322384.45235933, 138358515.9361007, 46322395.20212704, 138358519.8028641, 46322394.178339645, 0, 0, 0, 0, 0 },
-  { 138358523.06718716, 46322414.32154999, 138358484.8580389, 46322426.15628656, 138358561.27633542, 46322402.48681342, 138358521.15672976, 46322414.91328682, 138358524.97764456, 46322413.72981316, 1, 1, 138358631.00803098, 46322380.88841919, 27 },
-  { 138358529.02346867, 46322433.55175778, 138358491.5712573, 46322447.59924379, 138358566.47568005, 46322419.504271775, 138358527.1508581, 46322434.254132085, 138358530.89607924, 46322432.84938348, 0, 0, 0, 0, 0 },
-  { 138358536.00291267, 46322452.159757234, 138358499.73761663, 46322469.036614284, 138358572.2682087, 46322435.282900184, 138358534.18964788, 46322453.00360008, 138358537.81617746, 46322451.315914385, 0, 0, 0, 0, 0 },
-  { 138358544.27010453, 46322469.924448796, 138358509.78897262, 46322490.198854886, 138358578.75123644, 46322449.650042705, 138358542.54604793, 46322470.9381691, 138358545.99416113, 46322468.91072849, 0, 0, 0, 0, 0 },
-  { 138358554.0896297, 46322486.624732964, 138358522.15443754, 46322510.71090123, 138358586.02482188, 46322462.5385647, 138358552.4928701, 46322487.82904138, 138358555.68638933, 46322485.42042455, 0, 0, 0, 0, 0 },
-  { 138358565.71958974, 46322502.04457909, 138358536.60513535, 46322529.473551825, 138358594.83404413, 46322474.61560635, 138358564.26386702, 46322503.416027725, 138358567.17531246, 46322500.67313045, 0, 0, 0, 0, 0 },
-  { 138358579.083413, 46322516.2295953, 138358551.99050298, 46322545.65703534, 138358606.17632303, 46322486.80215526, 138358577.7287675, 46322517.700967304, 138358580.4380585, 46322514.7582233, 1, 1, 138358709.12938106, 46322374.97788312, 43 },
-  { 138358593.61483756, 46322529.60821666, 138358567.47525212, 46322559.8856352, 138358619.754423, 46322499.33079812, 138358592.3078583, 46322531.12208758, 138358594.92181683, 46322528.09434573, 0, 0, 0, 0, 0 },
-  { 138358608.7086993, 46322542.63929088, 138358582.39955863, 46322572.76949364, 138358635.01783994, 46322512.509088114, 138358607.39324224, 46322544.145801015, 138358610.02415633, 46322541.13278074, 0, 0, 0, 0, 0 },
-  { 138358623.759834, 46322555.78166576, 138358596.1787446, 46322584.75205596, 138358651.34092337, 46322526.81127556, 138358622.38077953, 46322557.23018527, 138358625.13888845, 46322554.333146244, 0, 0, 0, 0, 0 },
-  { 138358638.16307762, 46322569.49418904, 138358608.5194995, 46322596.35044115, 138358667.80665573, 46322542.63793693, 138358636.68089873, 46322570.837001644, 138358639.64525652, 46322568.15137643, 0, 0, 0, 0, 0 },
-  { 138358651.43220624, 46322584.14047881, 138358619.8969975, 46322608.748010375, 138358682.96741498, 46322559.53294725, 138358649.8554458, 46322585.37085539, 138358653.00896668, 46322582.91010223, 0, 0, 0, 0, 0 },
-  { 138358663.5686772, 46322599.69369038, 138358630.51388922, 46322622.218809545, 138358696.62346515, 46322577.16857122, 138358661.91593778, 46322600.81994634, 138358665.2214166, 46322598.56743442, 0, 0, 0, 0, 0 },
-  { 138358674.6989225, 46322616.026917994, 138358640.45148337, 46322636.693628296, 138358708.9463616, 46322595.36020769, 138358672.98655054, 46322617.06025351, 138358676.41129443, 46322614.99358248, 0, 0, 0, 0, 0 },
-  { 138358684.9493742, 46322633.01325572, 138358649.7870587, 46322652.08185737, 138358720.1116897, 46322613.94465408, 138358683.19125843, 46322633.9666858, 138358686.70748997, 46322632.059825644, 0, 0, 0, 0, 0 },
-  { 138358694.44646457, 46322650.52579776, 138358658.6009912, 46322668.27691148, 138358730.29193795, 46322632.77468404, 138358692.6541909, 46322651.41335345, 138358696.23873824, 46322649.63824207, 0, 0, 0, 0, 0 },
-  { 138358703.31662548, 46322668.43763821, 138358666.9807418, 46322685.161978476, 138358739.65250915, 46322651.71329794, 138358701.4998313, 46322669.273855224, 138358705.13341966, 46322667.60142119, 1, 1, 138358816.86626196, 46322616.17407488, 26 },
-  { 138358711.6862936, 46322686.62187045, 138358675.04203779, 46322702.65928031, 138358748.33054942, 46322670.584460594, 138358709.8540808, 46322687.423740946, 138358713.5185064, 46322685.819999956, 0, 0, 0, 0, 0 },
-  { 138358719.7065086, 46322704.94744877, 138358682.9784315, 46322720.791954175, 138358756.43458572, 46322689.10294336, 138358717.87010476, 46322705.73967404, 138358721.54291245, 46322704.155223496, 0, 0, 0, 0, 0 },
-  { 138358727.61063805, 46322723.269477025, 138358691.0303983, 46322739.45237107, 138358764.1908778, 46322707.08658298, 138358725.78162608, 46322724.07862173, 138358729.43965003, 46322722.46033232, 1, 4, 138358397.4739743, 46322869.320095785, 47 },
-  { 138358735.64924923, 46322741.440165356, 138358699.4670502, 46322758.494445555, 138358771.83144826, 46322724.38588516, 138358733.84013927, 46322742.292879365, 138358737.45835918, 46322740.587451346, 0, 0, 0, 0, 0 },
-  { 138358744.07290995, 46322759.311724015, 138358708.58295855, 46322777.76337297, 138358779.56286135, 46322740.86007506, 138358742.29841238, 46322760.23430646, 138358745.84740752, 46322758.38914157, 0, 0, 0, 0, 0 },
-  { 138358753.13218763, 46322776.736363165, 138358718.69557783, 46322797.08629942, 138358787.56879744, 46322756.38642691, 138358751.41035715, 46322777.753859974, 138358754.85401812, 46322775.718866356, 1, 3, 138359046.70428616, 46322603.25315659, 30 },
-  { 138358763.07764977, 46322793.56629298, 138358730.10746446, 46322816.21506515, 138358796.04783508, 46322770.917520806, 138358761.4291405, 46322794.69873159, 138358764.72615904, 46322792.43385437, 0, 0, 0, 0, 0 },
-  { 138358774.13796976, 46322809.666980326, 138358742.73020545, 46322834.43696903, 138358805.54573408, 46322784.896991625, 138358772.56758153, 46322810.90547976, 138358775.708358, 46322808.42848089, 1, 3, 138359030.111249, 46322607.79157243, 41 },
-  { 138358786.2798037, 46322825.062540784, 138358756.2276617, 46322851.46081274, 138358816.3319457, 46322798.66426883, 138358784.7771966, 46322826.38245438, 138358787.7824108, 46322823.74262719, 0, 0, 0, 0, 0 },
-  { 138358799.29713404, 46322839.88164184, 138358770.32663107, 46322867.462612785, 138358828.267637, 46322812.3006709, 138358797.84860888, 46322841.26069039, 138358800.7456592, 46322838.502593294, 0, 0, 0, 0, 0 },
-  { 138358812.9808978, 46322854.25479498, 138358784.78042027, 46322882.622612424, 138358841.18137535, 46322825.88697753, 138358811.57087395, 46322855.67318585, 138358814.39092168, 46322852.83640411, 1, 5, 138358703.70404735, 46322964.18008758, 47 },
-  { 138358827.12203223, 46322868.31251176, 138358799.35945234, 46322897.10902471, 138358854.8846121, 46322839.5159988, 138358825.73390323, 46322869.7523374, 138358828.51016122, 46322866.87268611, 1, 1, 138359001.33222097, 46322687.61439297, 25 },
-  { 138358841.51147413, 46322882.18530361, 138358813.87329277, 46322911.10123228, 138358869.1496555, 46322853.269374944, 138358840.12956506, 46322883.63110004, 138358842.8933832, 46322880.73950718, 1, 2, 138358650.8080227, 46323081.70521143, 39 },
-  { 138358855.95747122, 46322895.99295586, 138358828.34343928, 46322924.931947544, 138358883.57150316, 46322867.05396418, 138358854.57676962, 46322897.43990545, 138358857.33817282, 46322894.54600628, 1, 0, 138358941.56097028, 46322806.28208165, 42 },
-  { 138358870.39961252, 46322909.77386971, 138358842.80847913, 46322938.734694265, 138358897.9907459, 46322880.81304515, 138358869.02005586, 46322911.22191094, 138358871.77916917, 46322908.32582848, 1, 1, 138358695.88569388, 46323092.95108501, 36 },
-  { 138358884.83771458, 46322923.52912723, 138358857.26874068, 46322952.511047095, 138358912.40668848, 46322894.54720737, 138358883.4592659, 46322924.97822323, 138358886.21616328, 46322922.08003124, 0, 0, 0, 0, 0 },
-  { 138358899.27190846, 46322937.25961562, 138358871.72434857, 46322966.26189043, 138358926.81946835, 46322908.25734082, 138358897.89453048, 46322938.709729366, 138358900.64928645, 46322935.80950188, 0, 0, 0, 0, 0 },
-  { 138358913.7023251, 46322950.96622207, 138358886.17542768, 46322979.988108955, 138358941.22922254, 46322921.944335185, 138358912.32598025, 46322952.417316414, 138358915.07866997, 46322949.515127726, 1, 3, 138359103.63791734, 46322750.71520258, 45 },
-  { 138358928.1290956, 46322964.649833806, 138358900.6221032, 46322993.69058739, 138358955.636088, 46322935.609080225, 138358926.753746, 46322966.10187148, 138358929.50444523, 46322963.19779613, 0, 0, 0, 0, 0 },
-  { 138358942.55235103, 46322978.311338015, 138358915.0645003, 46323007.37021037, 138358970.04020175, 46322949.25246566, 138358941.1779585, 46322979.76428163, 138358943.92674357, 46322976.8583944, 0, 0, 0, 0, 0 },
-  { 138358956.97222227, 46322991.95162189, 138358929.5027446, 46323021.02786299, 138358984.44169995, 46322962.87538079, 138358955.5987484, 46322993.405433945, 138358958.34569615, 46322990.497809835, 1, 1, 138358739.2766117, 46323222.380832575, 42 },
-  { 138358971.3888405, 46323005.57157267, 138358943.93696168, 46323034.66443003, 138358998.8407193, 46322976.47871531, 138358970.01624656, 46323007.02621554, 138358972.76143444, 46323004.1169298, 1, 5, 138359069.52930728, 46322901.564607605, 38 },
-  { 138358985.80233654, 46323019.17207749, 138358958.36727753, 46323048.28079677, 138359013.23739555, 46322990.06335822, 138358984.4305836, 46323020.62751345, 138358987.1740895, 46323017.71664153, 0, 0, 0, 0, 0 },
-  { 138359000.21284163, 46323032.75402363, 138358972.7938183, 46323061.87784824, 138359027.63186496, 46323003.630199015, 138358998.84189045, 46323034.21021486, 138359001.5837928, 46323031.29783239, 0, 0, 0, 0, 0 },
-  { 138359014.62048665, 46323046.318298236, 138358987.21671033, 46323075.456469834, 138359042.02426296, 46323017.18012664, 138359013.25029784, 46323047.77520682, 138359015.99067545, 46323044.86138965, 0, 0, 0, 0, 0 },
-  { 138359029.0254027, 46323059.865788534, 138359001.63608018, 46323089.01754684, 138359056.4147252, 46323030.71403023, 138359027.65593657, 46323061.32337645, 138359030.39486882, 46323058.40820062, 0, 0, 0, 0, 0 },
-  { 138359043.42772076, 46323073.39738173, 138359016.05205467, 46323102.56196482, 138359070.80338684, 46323044.23279864, 138359042.05893746, 46323074.855610885, 138359044.79650405, 46323071.939152576, 0, 0, 0, 0, 0 },
-  { 138359057.8275719, 46323086.913965024, 138359030.46476078, 46323116.090609245, 138359085.19038302, 46323057.7373208, 138359056.45943135, 46323088.372797236, 138359059.19571245, 46323085.45513281, 0, 0, 0, 0, 0 },
-  { 138359072.22508708, 46323100.4164256, 138359044.87432572, 46323129.60436581, 138359099.57584843, 46323071.22848539, 138359070.857549, 46323101.87582261, 138359073.59262514, 46323098.95702859, 0, 0, 0, 0, 0 },
-  { 138359086.62039733, 46323113.90565068, 138359059.28087708, 46323143.104120374, 138359113.95991758, 46323084.70718099, 138359085.2534213, 46323115.365574166, 138359087.98737335, 46323112.4457272, 0, 0, 0, 0, 0 },
-  { 138359101.01363373, 46323127.382527456, 138359073.68454245, 46323156.59075867, 138359128.342725, 46323098.174296245, 138359099.64717916, 46323128.84293902, 138359102.3800883, 46323125.92211589, 0, 0, 0, 0, 0 },
-  { 138359115.40492725, 46323140.84794313, 138359088.0854498, 46323170.065166675, 138359142.7244047, 46323111.63071958, 138359114.0389534, 46323142.3088043, 138359116.7709011, 46323139.38708195, 1, 4, 138359193.265438, 46323057.57885601, 47 },
-  { 138359129.79440892, 46323154.3027849, 138359102.4837273, 46323183.52823049, 138359157.10509053, 46323125.07733931, 138359128.42887485, 46323155.764057174, 138359131.15994298, 46323152.84151262, 1, 4, 138358901.7502175, 46323398.335255615, 36 },
-  { 138359144.1822098, 46323167.74793999, 138359116.8795034, 46323196.98083626, 138359171.48491618, 46323138.51504372, 138359142.81707448, 46323169.2095848, 138359145.5473451, 46323166.286295176, 1, 1, 138359230.1857349, 46323075.664316736, 31 },
-  { 138359158.56846088, 46323181.18429559, 138359131.2729067, 46323210.423870176, 138359185.86401507, 46323151.944721, 138359157.20368317, 46323182.64627431, 138359159.9332386, 46323179.72231686, 1, 5, 138358938.83924976, 46323416.562871024, 39 },
-  { 138359172.95329317, 46323194.61273888, 138359145.66406608, 46323223.8582186, 138359200.24252027, 46323165.36725915, 138359171.5888318, 46323196.07501286, 138359174.31775454, 46323193.15046489, 0, 0, 0, 0, 0 },
-  { 138359187.33683777, 46323208.03415711, 138359160.05311072, 46323237.28476801, 138359214.62056482, 46323178.78354622, 138359185.97265142, 46323209.49668766, 138359188.70102412, 46323206.57162657, 1, 1, 138359097.30053848, 46323304.56117307, 29 },
-  { 138359201.71922562, 46323221.449437425, 138359174.4401698, 46323250.70440478, 138359228.99828142, 46323192.19447007, 138359200.35527283, 46323222.912185796, 138359203.0831784, 46323219.98668905, 1, 0, 138359316.29125994, 46323098.57857453, 44 },
-  { 138359216.10058773, 46323234.85946707, 138359188.82537314, 46323264.118015714, 138359243.3758023, 46323205.60091842, 138359214.736827, 46323236.3223945, 138359217.46434847, 46323233.396539636, 0, 0, 0, 0, 0 },
-  { 138359230.48105517, 46323248.265133224, 138359203.2088505, 46323277.526487485, 138359257.75325984, 46323219.003778964, 138359229.11744493, 46323249.728200935, 138359231.8446654, 46323246.802065514, 1, 1, 138359371.6147143, 46323096.837624945, 34 },
-  { 138359244.86075902, 46323261.66732312, 138359217.59073198, 46323290.93070681, 138359272.13078606, 46323232.40393943, 138359243.49725768, 46323263.13049231, 138359246.22426036, 46323260.20415393, 0, 0, 0, 0, 0 },
-  { 138359259.23983017, 46323275.06692391, 138359231.97114784, 46323304.33156067, 138359286.5085125, 46323245.80228715, 138359257.87639606, 46323276.53015575, 138359260.60326427, 46323273.60369207, 1, 1, 138359419.44333878, 46323103.13718295, 44 },
-  { 138359273.61839974, 46323288.46482285, 138359246.3502288, 46323317.729936086, 138359300.8865707, 46323259.19970962, 138359272.2549912, 46323289.92807851, 138359274.98180827, 46323287.00156719, 1, 0, 138359013.20736712, 46323567.94665425, 49 },
-  { 138359287.99659872, 46323301.86190711, 138359260.72810552, 46323331.12672009, 138359315.26509193, 46323272.597094126, 138359286.63317406, 46323303.325147755, 138359289.36002338, 46323300.398666464, 1, 3, 138359515.00680453, 46323058.232339, 41 },
-  { 138359302.37455812, 46323315.2590639, 138359275.10490924, 46323344.5228, 138359329.644207, 46323285.9953278, 138359301.01107568, 46323316.72225071, 138359303.73804057, 46323313.79587709, 0, 0, 0, 0, 0 },
-  { 138359316.75240904, 46323328.65718042, 138359289.48077524, 46323357.919066705, 138359344.02404284, 46323299.39529414, 138359315.38882735, 46323330.12027474, 138359318.11599073, 46323327.194086105, 0, 0, 0, 0, 0 },
-  { 138359331.13028297, 46323342.05714066, 138359303.85626242, 46323371.31680235, 138359358.40430352, 46323312.797478974, 138359329.76658195, 46323343.52012375, 138359332.49398398, 46323340.59415758, 1, 2, 138359097.2555566, 46323592.958739646, 38 },
-  { 138359345.50837278, 46323355.45949376, 138359318.23235884, 46323384.71729722, 138359372.78438672, 46323326.201690294, 138359344.14457208, 46323356.92238393, 138359346.8721735, 46323353.996603586, 0, 0, 0, 0, 0 },
-  { 138359359.88698533, 46323368.864164986, 138359332.60945788, 46323398.12055738, 138359387.16451278, 46323339.60777259, 138359358.52310896, 46323370.32698461, 138359361.2508617, 46323367.401345365, 1, 1, 138359195.53988242, 46323545.13392917, 35 },
-  { 138359374.26643986, 46323382.271011606, 138359346.98787862, 46323411.526440114, 138359401.5450011, 46323353.0155831, 138359372.9025118, 46323383.73378303, 138359375.6303679, 46323380.80824018, 0, 0, 0, 0, 0 },
-  { 138359388.64705563, 46323395.67989084, 138359361.3679401, 46323424.9348025, 138359415.92617115, 46323366.42497918, 138359387.28309986, 46323397.142636426, 138359390.0110114, 46323394.21714526, 0, 0, 0, 0, 0 },
-  { 138359403.0291519, 46323409.09065994, 138359375.74996147, 46323438.345501766, 138359430.3083423, 46323379.83581811, 138359401.66519237, 46323410.55340203, 138359404.3931114, 46323407.62791785, 0, 0, 0, 0, 0 },
-  { 138359417.41304797, 46323422.503176145, 138359390.13426176, 46323451.75839487, 138359444.69183418, 46323393.24795742, 138359416.04910865, 46323423.96593708, 138359418.77698728, 46323421.04041521, 1, 5, 138359193.04503134, 46323663.12735014, 25 },
-  { 138359431.79906303, 46323435.91729665, 138359404.52116004, 46323465.1733389, 138359459.07696602, 46323406.6612544, 138359430.43516788, 46323437.38009876, 138359433.16295817, 46323434.454494536, 0, 0, 0, 0, 0 },
-  { 138359446.18751642, 46323449.332878724, 138359418.91097546, 46323478.59019085, 138359473.4640574, 46323420.0755666, 138359444.82368937, 46323450.79574433, 138359447.55134347, 46323447.87001312, 0, 0, 0, 0, 0 },
-  { 138359460.57872742, 46323462.74977959, 138359433.30402708, 46323492.008807614, 138359487.85342777, 46323433.490751565, 138359459.2149924, 46323464.21273099, 138359461.94246244, 46323461.28682819, 1, 4, 138359611.27144682, 46323301.093649745, 44 },
-  { 138359474.97301528, 46323476.167856485, 138359447.7006339, 46323505.429046035, 138359502.24539664, 46323446.906666934, 138359473.60939622, 46323477.63091596, 138359476.33663434, 46323474.70479701, 1, 4, 138359397.9285379, 46323558.830716975, 40 },
-  { 138359489.37069917, 46323489.58696664, 138359462.1011152, 46323518.850763224, 138359516.64028314, 46323460.32317006, 138359488.00721997, 46323491.050156474, 138359490.73417836, 46323488.12377681, 0, 0, 0, 0, 0 },
-  { 138359503.77209854, 46323503.0069673, 138359476.50578988, 46323532.27381565, 138359531.0384072, 46323473.74011895, 138359502.4087831, 46323504.47030972, 138359505.13541397, 46323501.54362488, 0, 0, 0, 0, 0 },
-  { 138359518.17753246, 46323516.42771568, 138359490.91497722, 46323545.69806044, 138359545.4400877, 46323487.157370925, 138359516.8144047, 46323517.89123292, 138359519.54066023, 46323514.96419844, 0, 0, 0, 0, 0 },
-  { 138359532.58732042, 46323529.849069044, 138359505.32899615, 46323559.12335399, 138359559.84564468, 46323500.5747841, 138359531.22440422, 46323531.31278329, 138359533.95023662, 46323528.385354795, 0, 0, 0, 0, 0 },
-  { 138359547.00178146, 46323543.2708846, 138359519.74816594, 46323572.54955329, 138359574.255397, 46323513.99221592, 138359545.6391007, 46323544.73481804, 138359548.36446223, 46323541.806951165, 1, 0, 138359684.63253993, 46323395.41360773, 44 },
-  { 138359561.42123502, 46323556.6930196, 138359534.17280552, 46323585.976514764, 138359588.66966453, 46323527.40952443, 138359560.05881354, 46323558.15719435, 138359562.7836565, 46323555.228844844, 0, 0, 0, 0, 0 },
-  { 138359575.84600025, 46323570.115331255, 138359548.60323408, 46323599.40409515, 138359603.08876643, 46323540.82656736, 138359574.48386195, 46323571.57976945, 138359577.20813856, 46323568.65089306, 0, 0, 0, 0, 0 },
-  { 138359590.27639648, 46323583.537676826, 138359563.0397707, 46323612.83215098, 138359617.51302227, 46323554.24320267, 138359588.9145652, 46323585.00240053, 138359591.63822776, 46323582.07295312, 1, 2, 138359515.3756756, 46323664.09748076, 32 },
-  { 138359604.71274295, 46323596.95991354, 138359577.48273456, 46323626.26053883, 138359631.94275135, 46323567.65928824, 138359603.35124254, 46323598.4249448, 138359606.07424337, 46323595.49488227, 0, 0, 0, 0, 0 },
-  { 138359619.15535897, 46323610.38189861, 138359591.93244472, 46323639.689115115, 138359646.37827322, 46323581.07468211, 138359617.79421327, 46323611.84725944, 138359620.51650468, 46323608.916537784, 1, 0, 138359465.3458934, 46323775.96767186, 49 },
-  { 138359633.6045638, 46323623.803489305, 138359606.3892202, 46323653.117736235, 138359660.8199074, 46323594.489242375, 138359632.24379662, 46323625.26920165, 138359634.965331, 46323622.33777696, 1, 0, 138359861.53306642, 46323378.29667128, 47 },
-  { 138359648.0606766, 46323637.22454283, 138359620.85338026, 46323666.54625877, 138359675.26797295, 46323607.90282688, 138359646.70031178, 46323638.690628625, 138359649.42104143, 46323635.75845703, 1, 0, 138359395.71300307, 46323909.18345822, 47 },
-  { 138359662.5240168, 46323650.64491643, 138359635.32524395, 46323679.974538915, 138359689.72278965, 46323621.315293945, 138359661.16407815, 46323652.11139756, 138359663.88395545, 46323649.1784353, 1, 1, 138359860.3950893, 46323437.271912836, 40 },
-  { 138359676.99490356, 46323664.06446734, 138359649.80513033, 46323693.402433045, 138359704.1846768, 46323634.726501636, 138359675.6354149, 46323665.531365626, 138359678.35439223, 46323662.597569056, 1, 1, 138359519.97396317, 46323833.4912193, 44 },
-  { 138359691.47365618, 46323677.483052805, 138359664.2933586, 46323706.8297975, 138359718.65395376, 46323648.13630811, 138359690.1146413, 46323678.95039004, 138359692.83267105, 46323676.01571557, 0, 0, 0, 0, 0 },
-  { 138359705.96059394, 46323690.900530055, 138359678.79024777, 46323720.25648838, 138359733.1309401, 46323661.54457173, 138359704.60207662, 46323692.368327975, 138359707.31911126, 46323689.432732135, 0, 0, 0, 0, 0 },
-  { 138359720.456036, 46323704.3167563, 138359693.2961171, 46323733.68236212, 138359747.6159549, 46323674.951150484, 138359719.09804004, 46323705.78503659, 138359721.81403196, 46323702.84847601, 0, 0, 0, 0, 0 },
-  { 138359734.96030182, 46323717.7315888, 138359707.81128556, 46323747.1072746, 138359762.10931808, 46323688.35590301, 138359733.602851, 46323719.20037309, 138359736.31775263, 46323716.262804516, 1, 4, 138359656.22815466, 46323802.92107762, 36 },
-  { 138359749.4737105, 46323731.144884795, 138359722.3360724, 46323760.531082176, 138359776.61134863, 46323701.758687414, 138359748.1168286, 46323732.61419466, 138359750.83059242, 46323729.67557493, 0, 0, 0, 0, 0 },
-  { 138359763.99658144, 46323744.55650151, 138359736.87079662, 46323773.953640796, 138359791.12236625, 46323715.15936222, 138359762.6402922, 46323746.02635847, 138359765.35287067, 46323743.086644545, 0, 0, 0, 0, 0 },
-  { 138359778.5292338, 46323757.96629616, 138359751.41577733, 46323787.374806456, 138359805.6426903, 46323728.55778586, 138359777.17356098, 46323759.436721675, 138359779.88490665, 46323756.49587064, 0, 0, 0, 0, 0 },
-  { 138359793.07198685, 46323771.37412599, 138359765.9713337, 46323800.79443529, 138359820.17264, 46323741.95381668, 138359791.7169542, 46323772.845141456, 138359794.4270195, 46323769.90311052, 0, 0, 0, 0, 0 },
-  { 138359807.62515995, 46323784.77984827, 138359780.53778496, 46323814.21238328, 138359834.71253493, 46323755.34731326, 138359806.2707912, 46323786.25147502, 138359808.9795287, 46323783.30822152, 0, 0, 0, 0, 0 },
-  { 138359822.18907237, 46323798.1833202, 138359795.11545, 46323827.62850607, 138359849.26269475, 46323768.73813433, 138359820.83539125, 46323799.65557949, 138359823.5427535, 46323796.71106091, 0, 0, 0, 0, 0 },
-  { 138359836.76404318, 46323811.584399, 138359809.70464805, 46323841.042659886, 138359863.82343832, 46323782.12613811, 138359835.41107342, 46323813.05731204, 138359838.11701295, 46323810.11148596, 1, 2, 138359942.29568422, 46323696.69718153, 46 },
-  { 138359851.3503919, 46323824.98294194, 138359824.3056982, 46323854.45470032, 138359878.3950856, 46323795.51118356, 138359849.9981572, 46323826.456529856, 138359852.7026266, 46323823.509354025, 0, 0, 0, 0, 0 },
-  { 138359865.94843763, 46323838.37880623, 138359838.9189195, 46323867.86448327, 138359892.97795576, 46323808.8931292, 138359864.59696174, 46323839.853090085, 138359867.29991353, 46323836.90452238, 1, 1, 138360067.99408558, 46323617.97337039, 41 },
-  { 138359880.5584997, 46323851.771849126, 138359853.54463118, 46323881.271864526, 138359907.5723682, 46323822.271833725, 138359879.20780626, 46323853.246849895, 138359881.90919313, 46323850.29684836, 1, 3, 138359698.89023405, 46324050.15945271, 27 },
-  { 138359895.18089738, 46323865.16192784, 138359868.18315226, 46323894.676699705, 138359922.1786425, 46323835.64715598, 138359893.83101013, 46323866.637666434, 138359896.53078464, 46323863.68618925, 0, 0, 0, 0, 0 },
-  { 138359909.81594992, 46323878.54889963, 138359882.83480182, 46323908.078844555, 138359936.797098, 46323849.0189547, 138359908.4668925, 46323880.025396876, 138359911.16500732, 46323877.07240238, 0, 0, 0, 0, 0 },
-  { 138359924.46397653, 46323891.932621695, 138359897.49989906, 46323921.478154786, 138359951.428054, 46323862.387088604, 138359923.11577266, 46323893.40989835, 138359925.8121804, 46323890.45534504, 0, 0, 0, 0, 0 },
-  { 138359939.12529665, 46323905.31295132, 138359912.178763, 46323934.874485865, 138359966.0718303, 46323875.75141677, 138359937.77796996, 46323906.791028045, 138359940.47262335, 46323903.83487459, 1, 5, 138359848.85440895, 46324004.34409204, 30 },
-  { 138359953.8002294, 46323918.689745694, 138359926.87171274, 46323948.267693415, 138359980.72874606, 46323889.11179797, 138359952.45380357, 46323920.16864308, 138359955.14665523, 46323917.21084831, 0, 0, 0, 0, 0 },
-  { 138359968.48909408, 46323932.06286207, 138359941.57906738, 46323961.65763294, 138359995.39912078, 46323902.4680912, 138359967.14359275, 46323933.54260061, 138359969.8345954, 46323930.58312353, 0, 0, 0, 0, 0 },
-  { 138359983.19220993, 46323945.43215767, 138359956.301146, 46323975.044159986, 138360010.08327386, 46323915.82015536, 138359981.84765673, 46323946.91275779, 138359984.53676313, 46323943.951557554, 0, 0, 0, 0, 0 },
-  { 138359997.90989628, 46323958.797489755, 138359971.03826773, 46323988.427129954, 138360024.78152484, 46323929.167849556, 138359996.56631485, 46323960.27897176, 138359999.25347772, 46323957.31600775, 1, 3, 138359907.8899406, 46324058.05678442, 40 },
-  { 138360012.6424724, 46323972.158715546, 138359985.7907516, 46324001.806398265, 138360039.49419317, 46323942.51103283, 138360011.29988635, 46323973.641099684, 138360013.98505843, 46323970.67633141, 0, 0, 0, 0, 0 },
-  { 138360027.39025748, 46323985.51569226, 138360000.55891666, 46324015.18182023, 138360054.2215983, 46323955.849564284, 138360026.04869044, 46323986.99899866, 138360028.73182452, 46323984.032385856, 0, 0, 0, 0, 0 },
-  { 138360042.15357083, 46323998.868277155, 138360015.34342718, 46324028.55356302, 138360068.96371448, 46323969.18299129, 138360040.81306365, 46324000.35254145, 138360043.494078, 46323997.38401286, 0, 0, 0, 0, 0 },
-  { 138360056.93284884, 46324012.21612121, 138360030.16123006, 46324041.93615532, 138360083.70446762, 46323982.496087104, 138360055.5942679, 46324013.70212292, 138360058.27142978, 46324010.730119504, 0, 0, 0, 0, 0 },
-  { 138360071.7341247, 46324025.5490169, 138360045.04190606, 46324055.340382494, 138360098.42634332, 46323995.75765131, 138360070.39951375, 46324027.03858518, 138360073.06873563, 46324024.05944862, 1, 2, 138360320.63906354, 46323747.74453274, 43 },
-  { 138360086.5713726, 46324038.84277022, 138360060.00158155, 46324068.74337562, 138360113.14116365, 46324008.942164816, 138360085.24288306, 46324040.33780049, 138360087.89986214, 46324037.34773995, 0, 0, 0, 0, 0 },
-  { 138360101.4591701, 46324052.07212339, 138360075.05544052, 46324082.11947043, 138360127.8628997, 46324022.024776354, 138360100.13898364, 46324053.57449075, 138360102.77935657, 46324050.56975604, 1, 2, 138360342.39320257, 46323777.890081696, 44 },
-  { 138360116.412095, 46324065.21181873, 138360090.21889287, 46324095.442865066, 138360142.60529715, 46324034.9807724, 138360115.1024349, 46324066.72337105, 138360117.72175512, 46324063.70026641, 1, 1, 138359948.12077138, 46324259.44629143, 27 },
-  { 138360131.4447252, 46324078.2365985, 138360105.50756314, 46324108.68760218, 138360157.38188723, 46324047.78559482, 138360130.14786708, 46324079.75914868, 138360132.7415833, 46324076.71404832, 1, 4, 138360282.52869412, 46323900.85950208, 33 },
-  { 138360146.57163844, 46324091.12120501, 138360120.9372758, 46324121.827547215, 138360172.20600107, 46324060.414862804, 138360145.2899203, 46324092.65652212, 138360147.85335657, 46324089.5858879, 1, 4, 138359988.27944905, 46324280.732868105, 28 },
-  { 138360161.80741242, 46324103.84038051, 138360136.52403632, 46324134.8363624, 138360187.0907885, 46324072.844398625, 138360160.54324362, 46324105.390179604, 138360163.0715812, 46324102.29058142, 1, 4, 138360251.56339756, 46323993.8046448, 27 },
-  { 138360177.16662505, 46324116.3688673, 138360152.28400642, 46324147.68747662, 138360202.0492437, 46324085.05025798, 138360175.9224941, 46324117.934797764, 138360178.410756, 46324114.80293684, 0, 0, 0, 0, 0 },
-  { 138360192.66385415, 46324128.681407675, 138360168.23347265, 46324160.35405297, 138360217.09423566, 46324097.00876238, 138360191.44233507, 46324130.26503994, 138360193.88537323, 46324127.09777541, 1, 0, 138360367.3410819, 46323902.22199385, 47 },
-  { 138360208.3136773, 46324140.75274389, 138360184.3888082, 46324172.80895449, 138360232.23854643, 46324108.69653329, 138360207.11743385, 46324142.355554424, 138360209.50992078, 46324139.14993336, 1, 4, 138360022.29781994, 46324389.98978129, 46 },
-  { 138360224.13067245, 46324152.55761825, 138360200.76642507, 46324185.02470843, 138360247.49491984, 46324120.09052808, 138360222.96246007, 46324154.18097276, 138360225.29888484, 46324150.93426374, 0, 0, 0, 0, 0 },
-  { 138360240.1294174, 46324164.070773035, 138360217.382717, 46324196.97347234, 138360262.87611777, 46324131.16807373, 138360238.99208236, 46324165.715908, 138360241.26675242, 46324162.42563807, 0, 0, 0, 0, 0 },
-  { 138360256.3244899, 46324175.26695054, 138360234.25399217, 46324208.62700346, 138360278.3949876, 46324141.90689762, 138360255.220965, 46324176.93495318, 138360257.42801479, 46324173.5989479, 0, 0, 0, 0, 0 },
-  { 138360272.73046768, 46324186.12089301, 138360251.3963951, 46324219.95663368, 138360294.06454027, 46324152.28515234, 138360271.66376406, 46324187.81268004, 138360273.7971713, 46324184.429105975, 0, 0, 0, 0, 0 },
-  { 138360289.36192858, 46324196.60734276, 138360268.82581863, 46324230.93325407, 138360309.89803854, 46324162.281431444, 138360288.3351231, 46324198.32363832, 138360290.38873407, 46324194.891047195, 1, 2, 138360343.26921725, 46324106.501825556, 45 },
-  { 138360306.23345038, 46324206.701042056, 138360286.55533248, 46324241.52591357, 138360325.91156828, 46324171.876170546, 138360305.2495445, 46324208.442285635, 138360307.21735626, 46324204.95979848, 0, 0, 0, 0, 0 },
-  { 138360323.35879278, 46324216.37787624, 138360304.54743376, 46324251.67848206, 138360342.1701518, 46324181.07727041, 138360322.41822484, 46324218.14290653, 138360324.29936072, 46324214.61284594, 1, 3, 138360422.58871162, 46324030.1671805, 28 },
-  { 138360340.73478848, 46324225.63738003, 138360322.7485782, 46324261.36546757, 138360358.72099876, 46324189.90929248, 138360339.83547798, 46324227.423784405, 138360341.63409898, 46324223.85097565, 1, 2, 138360231.91821626, 46324441.79230968, 28 },
-  { 138360358.34233108, 46324234.50135752, 138360341.13555428, 46324270.611284584, 138360375.54910788, 46324198.39143045, 138360357.48199224, 46324236.30685387, 138360359.20266992, 46324232.69586117, 0, 0, 0, 0, 0 },
-  { 138360376.1616938, 46324242.99247954, 138360359.68691105, 46324279.44219193, 138360392.63647658, 46324206.54276715, 138360375.33795467, 46324244.81496516, 138360376.98543295, 46324241.16999392, 0, 0, 0, 0, 0 },
-  { 138360394.17314985, 46324251.133416906, 138360378.38162675, 46324287.884305306, 138360409.96467295, 46324214.382528506, 138360393.3835737, 46324252.970961325, 138360394.962726, 46324249.29587249, 0, 0, 0, 0, 0 },
-  { 138360412.3569725, 46324258.94684041, 138360397.19903472, 46324295.963551804, 138360427.51491025, 46324221.93012902, 138360411.5990756, 46324260.79767598, 138360413.1148694, 46324257.09600484, 0, 0, 0, 0, 0 },
-  { 138360430.69343492, 46324266.4554209, 138360416.11875296, 46324303.70563761, 138360445.2681169, 46324229.20520418, 138360429.96470082, 46324268.317931734, 138360431.42216903, 46324264.59291006, 0, 0, 0, 0, 0 },
-  { 138360449.16281042, 46324273.68182916, 138360435.12061843, 46324311.13602579, 138360463.2050024, 46324236.22763254, 138360448.4607008, 46324275.554538995, 138360449.86492002, 46324271.80911933, 0, 0, 0, 0, 0 },
-  { 138360467.7453722, 46324280.64873604, 138360454.18462753, 46324318.27992263, 138360481.30611688, 46324243.01754945, 138360467.06733498, 46324282.530295365, 138360468.42340943, 46324278.76717671, 1, 2, 138360543.68554232, 46324069.914091125, 36 },
-  { 138360486.42139348, 46324287.378812306, 138360473.29088223, 46324325.16226999, 138360499.55190474, 46324249.595354624, 138360485.76486793, 46324289.26798519, 138360487.07791904, 46324285.489639424, 1, 5, 138360445.7168086, 46324404.507531114, 35 },
-  { 138360505.1711475, 46324293.894728824, 138360492.4305243, 46324331.81143386, 138360517.9117707, 46324255.97802379, 138360504.53411633, 46324295.790564075, 138360505.80817866, 46324291.998893574, 0, 0, 0, 0, 0 },
-  { 138360523.9768162, 46324300.21373621, 138360511.69639876, 46324338.281982124, 138360536.25723365, 46324262.14549029, 138360523.36279532, 46324302.1171485, 138360524.5908371, 46324298.31032391, 0, 0, 0, 0, 0 },
-  { 138360542.83972892, 46324306.2987143, 138360531.15557295, 46324344.554177955, 138360554.5238849, 46324268.04325065, 138360542.25552112, 46324308.21148749, 138360543.42393672, 46324304.38594112, 1, 3, 138360612.94466472, 46324076.76593238, 39 },
-  { 138360561.77226174, 46324312.081173725, 138360550.82399282, 46324350.553701684, 138360572.72053066, 46324273.60864577, 138360561.2248483, 46324314.004800126, 138360562.31967518, 46324310.157547325, 0, 0, 0, 0, 0 },
-  { 138360580.78692427, 46324317.49224625, 138360570.71701825, 46324356.20396272, 138360590.8568303, 46324278.780529775, 138360580.28342897, 46324319.427832074, 138360581.29041958, 46324315.55666042, 0, 0, 0, 0, 0 },
-  { 138360599.89622602, 46324322.46306363, 138360590.84962887, 46324361.42662455, 138360608.94282317, 46324283.4995027, 138360599.44389617, 46324324.41124167, 138360600.34855586, 46324320.51488558, 1, 3, 138360558.7342089, 46324499.74726582, 33 },
-  { 138360619.11267668, 46324326.92475768, 138360611.2358374, 46324366.14153219, 138360626.98951596, 46324287.70798317, 138360618.71883473, 46324328.88559641, 138360619.50651863, 46324324.963918954, 0, 0, 0, 0, 0 },
-  { 138360638.44877768, 46324330.80848759, 138360631.83568788, 46324370.2580382, 138360645.06186748, 46324291.35893697, 138360638.11812317, 46324332.78096512, 138360638.77943218, 46324328.836010054, 1, 4, 138360608.35921913, 46324510.30394287, 31 },
-  { 138360657.9095453, 46324334.07077579, 138360652.50271153, 46324373.70366805, 138360663.31637907, 46324294.43788353, 138360657.6392036, 46324336.05242041, 138360658.179887, 46324332.08913118, 1, 4, 138360711.97788304, 46323937.74185324, 34 },
-  { 138360677.4786567, 46324336.74045056, 138360673.19224122, 46324376.510120444, 138360681.7650722, 46324296.97078068, 138360677.26433593, 46324338.72893406, 138360677.6929775, 46324334.751967065, 0, 0, 0, 0, 0 },
-  { 138360697.13601154, 46324338.85914026, 138360693.8833617, 46324378.72667428, 138360700.38866138, 46324298.99160624, 138360696.97337905, 46324340.852516964, 138360697.29864404, 46324336.86576356, 0, 0, 0, 0, 0 },
-  { 138360716.86150935, 46324340.46847325, 138360714.55599034, 46324380.40197525, 138360719.16702837, 46324300.534971245, 138360716.7462334, 46324342.465148345, 138360716.9767853, 46324338.47179815, 0, 0, 0, 0, 0 },
-  { 138360736.63504976, 46324341.61007794, 138360735.19063652, 46324381.58399031, 138360738.079463, 46324301.63616557, 138360736.5628291, 46324343.60877356, 138360736.7072704, 46324339.61138232, 1, 5, 138360750.176424, 46323966.85464945, 29 },
-  { 138360756.43653238, 46324342.32558268, 138360755.76818657, 46324382.31999872, 138360757.1048782, 46324302.33116665, 138360756.4031151, 46324344.32530349, 138360756.46994966, 46324340.32586188, 0, 0, 0, 0, 0 },
-  { 138360776.24585682, 46324342.656615876, 138360776.2719941, 46324382.65660734, 138360776.21971953, 46324302.656624414, 138360776.24716368, 46324344.65661545, 138360776.24454996, 46324340.6566163, 1, 0, 138360776.08380553, 46324094.65666882, 33 },
-  { 138360796.04597175, 46324342.64367783, 138360796.6957304, 46324382.63840015, 138360795.3962131, 46324302.64895551, 138360796.07845968, 46324344.643413946, 138360796.01348382, 46324340.643941715, 1, 5, 138360802.18619072, 46324720.593803786, 37 },
-  { 138360815.83350596, 46324342.32220739, 138360817.03846142, 46324382.304054305, 138360814.6285505, 46324302.34036048, 138360815.89375374, 46324344.32129974, 138360815.77325818, 46324340.32311504, 0, 0, 0, 0, 0 },
-  { 138360835.60892376, 46324341.72622448, 138360837.3003572, 46324381.690446645, 138360833.91749033, 46324301.76200232, 138360835.69349542, 46324343.72443559, 138360835.5243521, 46324339.728013374, 0, 0, 0, 0, 0 },
-  { 138360855.37268943, 46324340.88974895, 138360857.48177618, 46324380.83410717, 138360853.26360267, 46324300.94539074, 138360855.47814375, 46324342.88696686, 138360855.2672351, 46324338.892531045, 0, 0, 0, 0, 0 },
-  { 138360875.1252674, 46324339.846800655, 138360877.5832015, 46324379.77121123, 138360872.66733328, 46324299.92239008, 138360875.2481641, 46324341.843021184, 138360875.0023707, 46324337.850580126, 1, 1, 138360884.28107193, 46324488.56523006, 39 },
-  { 138360894.8671219, 46324338.63139943, 138360897.60518497, 46324378.53757703, 138360892.12905884, 46324298.72522183, 138360895.00402507, 46324340.626708314, 138360894.73021874, 46324336.63609055, 1, 5, 138360868.23945856, 46323950.54382227, 33 },
-  { 138360914.59871742, 46324337.27756511, 138360917.54830104, 46324377.168666326, 138360911.6491338, 46324297.38646389, 138360914.7461966, 46324339.27212017, 138360914.45123824, 46324335.28301004, 1, 4, 138360923.74242666, 46324460.93997888, 45 },
-  { 138360934.32051817, 46324335.81931756, 138360937.41310933, 46324375.69958686, 138360931.227927, 46324295.93904825, 138360934.47514772, 46324337.81333102, 138360934.1658886, 46324333.82530409, 0, 0, 0, 0, 0 },
-  { 138360954.03298867, 46324334.290676616, 138360957.20012704, 46324374.16509491, 138360950.8658503, 46324294.41625832, 138360954.19134557, 46324336.28439753, 138360953.87463176, 46324332.296955705, 0, 0, 0, 0, 0 },
-  { 138360973.73659316, 46324332.72566214, 138360976.90980938, 46324372.59959722, 138360970.56337693, 46324292.85172706, 138360973.89525396, 46324334.7193589, 138360973.57793236, 46324330.731965385, 1, 3, 138360964.93091813, 46324222.07549229, 34 },
-  { 138360993.43179604, 46324331.158293955, 138360996.54254, 46324371.03715141, 138360990.32105207, 46324291.2794365, 138360993.58733323, 46324333.15223683, 138360993.27625886, 46324329.16435108, 0, 0, 0, 0, 0 },
-  { 138361013.11906156, 46324329.62259193, 138361016.09862968, 46324369.51146474, 138361010.13949344, 46324289.73371912, 138361013.26803997, 46324331.61703557, 138361012.97008315, 46324327.62814829, 1, 3, 138360990.84678987, 46324031.45326769, 43 },
-  { 138361032.79885423, 46324328.15257589, 138361035.57832453, 46324368.05589085, 138361030.01938394, 46324288.249260925, 138361032.93782774, 46324330.14774164, 138361032.65988073, 46324326.15741014, 0, 0, 0, 0, 0 },
-  { 138361052.4716383, 46324326.7822657, 138361054.98182264, 46324366.703425184, 138361049.96145394, 46324286.86110622, 138361052.5971475, 46324328.77832367, 138361052.3461291, 46324324.78620773, 0, 0, 0, 0, 0 },
-  { 138361072.13787812, 46324325.54568119, 138361074.30953115, 46324365.48668673, 138361069.9662251, 46324285.60467566, 138361072.24646077, 46324327.54273147, 138361072.02929547, 46324323.548630916, 0, 0, 0, 0, 0 },
-  { 138361091.79804906, 46324324.476727895, 138361093.5890736, 46324364.43661067, 138361090.00702453, 46324284.51684512, 138361091.8876003, 46324326.474722035, 138361091.70849782, 46324322.478733756, 1, 0, 138361079.3504286, 46324046.75554263, 50 },
-  { 138361111.45393014, 46324323.5957402, 138361112.8753128, 46324363.57047811, 138361110.03254747, 46324283.62100229, 138361111.52499926, 46324325.594477095, 138361111.38286102, 46324321.5970033, 0, 0, 0, 0, 0 },
-  { 138361131.10981858, 46324322.89683532, 138361132.1789882, 46324362.88254372, 138361130.04064897, 46324282.91112692, 138361131.16327706, 46324324.89612074, 138361131.0563601, 46324320.8975499, 0, 0, 0, 0, 0 },
-  { 138361150.77029914, 46324322.37113778, 138361151.5050444, 46324362.364389084, 138361150.03555387, 46324282.37788648, 138361150.8070364, 46324324.370800346, 138361150.73356187, 46324320.37147522, 1, 1, 138361155.85841015, 46324599.32440302, 39 },
-  { 138361170.43995675, 46324322.009772114, 138361170.858376, 46324362.00758362, 138361170.0215375, 46324282.01196061, 138361170.46087772, 46324324.00966269, 138361170.4190358, 46324320.00988154, 0, 0, 0, 0, 0 },
-  { 138361190.12337607, 46324321.80386281, 138361190.2438285, 46324361.80368145, 138361190.00292364, 46324281.80404417, 138361190.1293987, 46324323.80385374, 138361190.11735344, 46324319.80387188, 0, 0, 0, 0, 0 },
-  { 138361209.82514197, 46324321.744534396, 138361209.66620138, 46324361.74421862, 138361209.98408255, 46324281.74485017, 138361209.81719494, 46324323.74451861, 138361209.833089, 46324319.74455018, 0, 0, 0, 0, 0 },
-  { 138361229.5498392, 46324321.82291138, 138361229.13024977, 46324361.82071063, 138361229.96942863, 46324281.825112134, 138361229.52885973, 46324323.822801344, 138361229.57081866, 46324319.82302142, 1, 2, 138361226.36095956, 46324625.80618567, 41 },
-  { 138361249.30205262, 46324322.03011828, 138361248.64068702, 46324362.02465035, 138361249.96341822, 46324282.03558621, 138361249.26898435, 46324324.02984488, 138361249.3351209, 46324320.03039168, 0, 0, 0, 0, 0 },
-  { 138361269.08636695, 46324322.35727962, 138361268.20218715, 46324362.347506255, 138361269.97054675, 46324282.36705299, 138361269.04215795, 46324324.35679095, 138361269.13057595, 46324320.35776829, 1, 4, 138361261.23927134, 46324677.27054098, 26 },
-  { 138361288.907367, 46324322.79551989, 138361287.81938705, 46324362.7807209, 138361289.99534693, 46324282.81031888, 138361288.852968, 46324324.79477994, 138361288.96176597, 46324320.796259835, 1, 5, 138361292.0353093, 46324207.83806699, 41 },
-  { 138361308.7696376, 46324323.33596364, 138361307.4968894, 46324363.31570991, 138361310.04238582, 46324283.35621736, 138361308.7060002, 46324325.33495095, 138361308.83327502, 46324321.33697632, 0, 0, 0, 0, 0 },
-  { 138361328.67776352, 46324323.96973533, 138361327.23926416, 46324363.943860956, 138361330.11626288, 46324283.99560971, 138361328.60583857, 46324325.96844161, 138361328.74968848, 46324321.97102905, 0, 0, 0, 0, 0 },
-  { 138361348.63632953, 46324324.68795953, 138361347.04284728, 46324364.65620711, 138361350.2298118, 46324284.71971195, 138361348.5566554, 46324326.68637191, 138361348.71600366, 46324322.68954715, 1, 5, 138361344.5729498, 46324426.60699085, 28 },
-  { 138361368.64748302, 46324325.485778295, 138361366.87124103, 46324365.44632089, 138361370.423725, 46324285.5252357, 138361368.5586709, 46324327.483805425, 138361368.73629513, 46324323.48775116, 0, 0, 0, 0, 0 },
-  { 138361388.7019279, 46324326.37719629, 138361386.70383114, 46324366.32726023, 138361390.70002466, 46324286.427132346, 138361388.60202307, 46324328.37469949, 138361388.80183274, 46324324.37969309, 0, 0, 0, 0, 0 },
-  { 138361408.78701255, 46324327.381748945, 138361406.52783895, 46324367.31789967, 138361411.04618615, 46324287.44559822, 138361408.67405388, 46324329.37855648, 138361408.89997122, 46324325.38494141, 1, 4, 138361424.8836244, 46324042.83667503, 44 },
-  { 138361428.8900849, 46324328.51897247, 138361426.330384, 46324368.436987594, 138361431.4497858, 46324288.60095735, 138361428.76209983, 46324330.51487323, 138361429.01806995, 46324326.523071714, 0, 0, 0, 0, 0 },
-  { 138361448.9984929, 46324329.808403075, 138361446.0984939, 46324369.70313964, 138361451.8984919, 46324289.91366651, 138361448.85349295, 46324331.8031399, 138361449.14349285, 46324327.81366625, 1, 4, 138361469.1534859, 46324052.53998393, 36 },
-  { 138361469.09958452, 46324331.269576915, 138361465.819117, 46324371.13483162, 138361472.38005203, 46324291.40432221, 138361468.93556115, 46324333.26283965, 138361469.2636079, 46324329.27631418, 0, 0, 0, 0, 0 },
-  { 138361489.1807078, 46324332.92203024, 138361485.47913718, 46324372.75039168, 138361492.88227844, 46324293.0936688, 138361488.99562928, 46324334.91344831, 138361489.36578634, 46324330.93061217, 0, 0, 0, 0, 0 },
-  { 138361509.22921053, 46324334.78529918, 138361505.06538948, 46324374.56799133, 138361513.39303157, 46324295.00260703, 138361509.0210195, 46324336.77443379, 138361509.43740156, 46324332.79616457, 0, 0, 0, 0, 0 },
-  { 138361529.2324408, 46324336.87891996, 138361524.56468028, 46324376.60563656, 138361533.90020132, 46324297.15220336, 138361528.99905276, 46324338.86525579, 138361529.46582884, 46324334.89258413, 1, 1, 138361567.39138314, 46324012.11301178, 49 },
-  { 138361549.17774647, 46324339.22242878, 138361543.96380848, 46324378.88115859, 138361554.39168447, 46324299.56369896, 138361548.9170496, 46324341.20536527, 138361549.43844336, 46324337.23949228, 0, 0, 0, 0, 0 },
-  { 138361569.05247557, 46324341.835361816, 138361563.24959147, 46324381.41220525, 138361574.85535967, 46324302.25851838, 138361568.76233137, 46324343.814203985, 138361569.34261978, 46324339.85651965, 0, 0, 0, 0, 0 },
-  { 138361588.84397602, 46324344.737255275, 138361582.40889448, 46324384.216233544, 138361595.27905756, 46324305.25827701, 138361588.52222195, 46324346.711204186, 138361589.1657301, 46324342.763306364, 0, 0, 0, 0, 0 },
-  { 138361608.53959575, 46324347.94764533, 138361601.42866397, 46324387.31050409, 138361615.65052754, 46324308.58478657, 138361608.18404916, 46324349.91578826, 138361608.89514235, 46324345.979502395, 1, 1, 138361627.73911154, 46324241.66792669, 38 },
-  { 138361628.1266828, 46324351.4860682, 138361620.29596654, 46324390.71207848, 138361635.95739904, 46324312.26005791, 138361627.73514697, 46324353.44736871, 138361628.5182186, 46324349.52476768, 0, 0, 0, 0, 0 },
-  { 138361647.592585, 46324355.37206005, 138361638.9980315, 46324394.437820636, 138361656.1871385, 46324316.30629947, 138361647.16285732, 46324357.32534808, 138361648.02231267, 46324353.41877203, 0, 0, 0, 0, 0 },
-  { 138361666.92465046, 46324359.6251571, 138361657.52229905, 46324398.50440334, 138361676.32700187, 46324320.74591087, 138361666.4545329, 46324361.569119416, 138361667.39476803, 46324357.68119479, 0, 0, 0, 0, 0 },
-  { 138361686.11022696, 46324364.26489552, 138361675.85647246, 46324402.92832163, 138361696.36398146, 46324325.60146941, 138361685.59753925, 46324366.19806682, 138361686.62291467, 46324362.33172422, 1, 1, 138361748.40178552, 46324129.38458189, 30 },
-  { 138361705.13666263, 46324369.31081152, 138361693.9885744, 46324407.72591439, 138361716.28475088, 46324330.89570865, 138361704.57925823, 46324371.23156666, 138361705.69406703, 46324367.39005638, 0, 0, 0, 0, 0 },
-  { 138361723.9913053, 46324374.78244129, 138361711.9070052, 46324412.91339579, 138361736.0756054, 46324336.651486784, 138361723.3870903, 46324376.68898901, 138361724.5955203, 46324372.87589356, 1, 0, 138361804.9561159, 46324119.30504612, 37 },
-  { 138361742.661503, 46324380.69932102, 138361729.60060275, 46324418.5068981, 138361755.72240323, 46324342.891743936, 138361742.008458, 46324382.58969987, 138361743.314548, 46324378.80894216, 0, 0, 0, 0, 0 },
-  { 138361761.1346036, 46324387.08098689, 138361747.05870003, 46324424.52252717, 138361775.21050715, 46324349.6394466, 138361760.43080842, 46324388.953063905, 138361761.83839875, 46324385.20890987, 1, 3, 138361896.2632777, 46324027.64220013, 31 },
-  { 138361779.39795512, 46324393.94697511, 138361764.27117893, 46324430.976431526, 138361794.5247313, 46324356.9175187, 138361778.6416163, 46324395.79844793, 138361780.15429392, 46324392.095502295, 0, 0, 0, 0, 0 },
-  { 138361797.43890557, 46324401.31682188, 138361781.22851476, 46324437.88488486, 138361813.64929637, 46324364.748758905, 138361796.62838602, 46324403.14522503, 138361798.2494251, 46324399.48841873, 0, 0, 0, 0, 0 },
-  { 138361815.24480274, 46324409.21006337, 138361797.93854028, 46324445.272416025, 138361832.5510652, 46324373.14771071, 138361814.37948963, 46324411.013181, 138361816.11011586, 46324407.406945735, 0, 0, 0, 0, 0 },
-  { 138361832.80790392, 46324417.63856612, 138361814.47776154, 46324453.191426486, 138361851.1380463, 46324382.08570576, 138361831.8913968, 46324419.41620914, 138361833.72441104, 46324415.860923104, 1, 2, 138361907.0449806, 46324273.64948165, 35 },
-  { 138361850.14439285, 46324426.5768149, 138361830.886858, 46324461.6360127, 138361869.4019277, 46324391.51761709, 138361849.1815161, 46324428.32977479, 138361851.1072696, 46324424.823855005, 0, 0, 0, 0, 0 },
-  { 138361867.27773246, 46324435.98792256, 138361847.1877055, 46324470.576805405, 138361887.36775944, 46324401.39903971, 138361866.27323112, 46324437.717366695, 138361868.2822338, 46324434.25847842, 0, 0, 0, 0, 0 },
-  { 138361884.2313873, 46324445.83499926, 138361863.40143272, 46324479.983395904, 138361905.06134185, 46324411.68660262, 138361883.18988955, 46324447.5424191, 138361885.27288502, 46324444.12757943, 1, 2, 138361779.0401168, 46324618.28440231, 47 },
-  { 138361901.0288217, 46324456.08115516, 138361879.54868627, 46324489.82435864, 138361922.50895715, 46324422.337951675, 138361899.95481494, 46324457.76831533, 138361902.10282847, 46324454.39399499, 1, 3, 138362078.77694252, 46324176.85614634, 41 },
-  { 138361917.6935003, 46324466.68950044, 138361895.64985704, 46324500.06730431, 138361939.73714358, 46324433.311696574, 138361916.59131816, 46324468.35839064, 138361918.79568246, 46324465.02061025, 1, 0, 138361802.51546422, 46324641.088525675, 32 },
-  { 138361934.24888763, 46324477.62314526, 138361911.72526866, 46324510.67895547, 138361956.7725066, 46324444.56733505, 138361933.12270668, 46324479.27593577, 138361935.37506858, 46324475.97035475, 0, 0, 0, 0, 0 },
-  { 138361950.7184481, 46324488.845199786, 138361927.79532903, 46324521.62523354, 138361973.64156717, 46324456.065166034, 138361949.57229215, 46324490.484201476, 138361951.86460406, 46324487.2061981, 0, 0, 0, 0, 0 },
-  { 138361967.12564623, 46324500.318774186, 138361943.88064703, 46324532.87134724, 138361990.37064543, 46324467.76620113, 138361965.96339628, 46324501.94640284, 138361968.2878962, 46324498.69114553, 0, 0, 0, 0, 0 },
-  { 138361983.4939466, 46324512.00697863, 138361960.00205946, 46324544.381833665, 138362006.98583376, 46324479.6321236, 138361982.31935227, 46324513.62572138, 138361984.66854095, 46324510.38823588, 1, 1, 138361910.0817993, 46324613.17840062, 41 },
-  { 138361999.8467816, 46324523.872945406, 138361975.91521862, 46324555.92415899, 138362023.7783446, 46324491.82173182, 138361998.65020347, 46324525.47550608, 138362001.04335976, 46324522.27038473, 1, 4, 138362069.8466034, 46324430.12314566, 42 },
-  { 138362016.06218705, 46324535.980443165, 138361990.63372603, 46324566.85751184, 138362041.49064806, 46324505.10337449, 138362014.790764, 46324537.5242966, 138362017.3336101, 46324534.43658973, 0, 0, 0, 0, 0 },
-  { 138362031.53815544, 46324548.72550207, 138362003.44570655, 46324577.20030348, 138362059.63060433, 46324520.25070065, 138362030.133533, 46324550.14924214, 138362032.94277787, 46324547.30176199, 1, 0, 138362234.50609863, 46324342.99506184, 41 },
-  { 138362045.57374755, 46324562.572627746, 138362013.90614346, 46324587.00954351, 138362077.24135163, 46324538.13571198, 138362043.99036735, 46324563.79447354, 138362047.15712774, 46324561.350781955, 0, 0, 0, 0, 0 },
-  { 138362057.46802422, 46324577.98632595, 138362022.14694974, 46324596.75922386, 138362092.7890987, 46324559.213428035, 138362055.7019705, 46324578.92497084, 138362059.23407796, 46324577.047681056, 0, 0, 0, 0, 0 },
-  { 138362066.65971455, 46324595.28042621, 138362028.91115737, 46324608.5109376, 138362104.40827173, 46324582.04991482, 138362064.77228668, 46324595.94195178, 138362068.54714242, 46324594.61890064, 1, 1, 138361953.41404304, 46324634.97196037, 43 },
-  { 138362073.24253154, 46324614.06215249, 138362034.1486767, 46324622.52799641, 138362112.33638638, 46324605.59630857, 138362071.2878388, 46324614.48544469, 138362075.1972243, 46324613.63886029, 1, 1, 138362460.2716945, 46324530.25029762, 31 },
-  { 138362077.50202316, 46324633.731774166, 138362037.7474859, 46324638.15633819, 138362117.25656042, 46324629.30721014, 138362075.5142963, 46324633.95300237, 138362079.48975003, 46324633.51054596, 0, 0, 0, 0, 0 },
-  { 138362079.72355476, 46324653.69214997, 138362039.73391885, 46324654.60265444, 138362119.71319067, 46324652.78164549, 138362077.72407296, 46324653.73767519, 138362081.72303656, 46324653.646624744, 0, 0, 0, 0, 0 },
-  { 138362080.17583266, 46324673.556334, 138362040.23520833, 46324671.37768114, 138362120.116457, 46324675.73498685, 138362078.17880145, 46324673.44740135, 138362082.17286387, 46324673.66526664, 0, 0, 0, 0, 0 },
-  { 138362079.09896857, 46324693.29817775, 138362039.3870736, 46324688.505954996, 138362118.81086352, 46324698.0904005, 138362077.11337382, 46324693.058566615, 138362081.08456331, 46324693.53778888, 1, 2, 138362304.46397245, 46324720.49404186, 29 },
-  { 138362076.73025906, 46324712.9270531, 138362037.33121273, 46324706.01943786, 138362116.1293054, 46324719.834668346, 138362074.76030675, 46324712.58167234, 138362078.70021138, 46324713.27243386, 0, 0, 0, 0, 0 },
-  { 138362073.30700073, 46324732.45233192, 138362034.22679248, 46324723.92371396, 138362112.38720897, 46324740.980949886, 138362071.35299033, 46324732.02590103, 138362075.26101112, 46324732.87876282, 1, 2, 138362324.39733863, 46324787.24870234, 44 },
-  { 138362069.0664901, 46324751.883386105, 138362030.25320938, 46324742.21233456, 138362107.87977085, 46324761.55443765, 138362067.1258261, 46324751.39983353, 138362071.00715414, 46324752.36693868, 1, 0, 138361758.56024417, 46324674.51497375, 41 },
-  { 138362064.24602383, 46324771.22958752, 138362025.60876596, 46324760.87766485, 138362102.8832817, 46324781.581510186, 138362062.31416094, 46324770.711991385, 138362066.17788672, 46324771.74718365, 1, 1, 138362317.320063, 46324839.03468099, 39 },
-  { 138362059.0828984, 46324790.50030804, 138362020.51721695, 46324779.88483752, 138362097.64857987, 46324801.11577855, 138362057.15461433, 46324789.96953451, 138362061.0111825, 46324791.031081565, 1, 5, 138361949.17070627, 46324760.24621707, 39 },
-  { 138362053.79681438, 46324809.7044905, 138362015.26718408, 46324798.95890587, 138362092.3264447, 46324820.45007513, 138362051.87033287, 46324809.167211264, 138362055.7232959, 46324810.24176973, 1, 3, 138362177.09163132, 46324844.09036132, 43 },
-  { 138362048.45801124, 46324828.84743324, 138362009.96725577, 46324817.96342006, 138362086.9487667, 46324839.731446415, 138362046.53347346, 46324828.30323258, 138362050.38254902, 46324829.3916339, 1, 2, 138361677.02222088, 46324723.8167061, 37 },
-  { 138362043.06130868, 46324847.932595596, 138362004.6126397, 46324836.90082999, 138362081.50997767, 46324858.9643612, 138362041.13887525, 46324847.381007314, 138362044.98374212, 46324848.48418388, 0, 0, 0, 0, 0 },
-  { 138362037.60094738, 46324866.963422745, 138361999.19766632, 46324855.77467827, 138362076.00422844, 46324878.15216722, 138362035.68078333, 46324866.40398552, 138362039.52111143, 46324867.52285997, 1, 0, 138361824.46273744, 46324804.86589089, 33 },
-  { 138362032.07116812, 46324885.9433599, 138361993.71666715, 46324874.588525906, 138362070.4256691, 46324897.29819389, 138362030.15344307, 46324885.3756182, 138362033.98889318, 46324886.511101596, 1, 5, 138362179.73599687, 46324929.65947075, 50 },
-  { 138362026.46621168, 46324904.87585224, 138361988.16397387, 46324893.34595285, 138362064.7684495, 46324916.40575163, 138362024.55109978, 46324904.29935727, 138362028.38132358, 46324905.45234721, 0, 0, 0, 0, 0 },
-  { 138362020.7803188, 46324923.764345005, 138361982.53391778, 46324912.05055786, 138362059.0267198, 46324935.47813215, 138362018.86799875, 46324923.17865565, 138362022.69263884, 46324924.35003436, 0, 0, 0, 0, 0 },
-  { 138362015.00773022, 46324942.61228334, 138361976.82082888, 46324930.70595871, 138362053.19463155, 46324954.518607974, 138362013.09838516, 46324942.01696711, 138362016.91707528, 46324943.20759957, 0, 0, 0, 0, 0 },
-  { 138362009.1426867, 46324961.42311248, 138361971.01903537, 46324949.315792, 138362047.26633802, 46324973.53043296, 138362007.23650414, 46324960.81774646, 138362011.04886925, 46324962.0284785, 0, 0, 0, 0, 0 },
-  { 138362003.17942902, 46324980.20027764, 138361965.12286288, 46324967.88371269, 138362041.23599517, 46324992.516842596, 138362001.27660072, 46324979.584449396, 138362005.08225733, 46324980.81610589, 1, 1, 138361732.02639514, 46324892.44475236, 29 },
-  { 138361997.1121979, 46324998.947224, 138361959.12663338, 46324986.413394295, 138362035.09776244, 46325011.4810537, 138361995.21291968, 46324998.320532516, 138361999.01147613, 46324999.57391548, 1, 2, 138362116.7667262, 46325038.428787574, 38 },
-  { 138361990.9352341, 46325017.66739675, 138361953.02466467, 46325004.90852827, 138362028.84580353, 46325030.426265225, 138361989.03970563, 46325017.02945332, 138361992.83076257, 46325018.30534017, 0, 0, 0, 0, 0 },
-  { 138361984.64277843, 46325036.36424107, 138361946.8112696, 46325023.372823134, 138362022.47428724, 46325049.35565901, 138361982.75120297, 46325035.714670174, 138361986.53435388, 46325037.01381197, 1, 1, 138362152.9929927, 46325094.1760509, 42 },
-  { 138361978.22907156, 46325055.04120221, 138361940.48075494, 46325041.81000454, 138362015.97738817, 46325068.27239988, 138361976.34165573, 46325054.37964232, 138361980.11648738, 46325055.7027621, 1, 1, 138361700.77894434, 46324957.79189932, 34 },
-  { 138361971.68835425, 46325073.701725155, 138361934.02836892, 46325060.22116493, 138362009.3483396, 46325087.18228538, 138361969.80535498, 46325073.027697146, 138361973.57135352, 46325074.375753164, 0, 0, 0, 0, 0 },
-  { 138361965.0143426, 46325092.34658683, 138361927.45139298, 46325078.59795722, 138362002.57729223, 46325106.09521644, 138361963.13619512, 46325091.659155354, 138361966.8924901, 46325093.03401831, 0, 0, 0, 0, 0 },
-  { 138361958.1989094, 46325110.967189856, 138361920.74292913, 46325096.92975625, 138361995.65488967, 46325125.004623465, 138361956.3261104, 46325110.26531818, 138361960.0717084, 46325111.669061534, 1, 0, 138362227.88196734, 46325212.03671182, 26 },
-  { 138361951.2335229, 46325129.55287916, 138361913.89501506, 46325115.205899246, 138361988.57203072, 46325143.89985908, 138361949.3665975, 46325128.83553017, 138361953.10044828, 46325130.270228155, 1, 5, 138361833.6172232, 46325084.35989242, 46 },
-  { 138361944.10965127, 46325148.09299966, 138361906.8997404, 46325133.41572016, 138361981.31956214, 46325162.77027916, 138361942.24915573, 46325147.35913569, 138361945.9701468, 46325148.82686363, 0, 0, 0, 0, 0 },
-  { 138361936.81876263, 46325166.576896235, 138361899.74924713, 46325151.54855562, 138361973.88827813, 46325181.60523685, 138361934.96528685, 46325165.8254792, 138361938.6722384, 46325167.32831327, 0, 0, 0, 0, 0 },
-  { 138361929.35232532, 46325184.99391382, 138361892.43573108, 46325169.59374919, 138361966.26891956, 46325200.394078456, 138361927.5064956, 46325184.22390559, 138361931.19815505, 46325185.76392205, 0, 0, 0, 0, 0 },
-  { 138361921.7018074, 46325203.33339733, 138361884.95144105, 46325187.54065938, 138361958.45217377, 46325219.126135275, 138361919.8642891, 46325202.543760434, 138361923.5393257, 46325204.123034224, 1, 0, 138361660.7742062, 46325091.204957925, 42 },
-  { 138361913.8586772, 46325221.58469165, 138361877.28867996, 46325205.37866493, 138361950.42867446, 46325237.79071837, 138361912.03017735, 46325220.77439032, 138361915.68717706, 46325222.394992985, 1, 4, 138362130.53591084, 46325317.60539997, 43 },
-  { 138361905.81440285, 46325239.737141736, 138361869.43980387, 46325223.09717328, 138361942.18900183, 46325256.37711019, 138361903.9956729, 46325238.90514331, 138361907.6331328, 46325240.56914016, 0, 0, 0, 0, 0 },
-  { 138361897.56045258, 46325257.78009246, 138361861.39722157, 46325240.68562782, 138361933.7236836, 46325274.87455711, 138361895.75229102, 46325256.92536923, 138361899.36861414, 46325258.63481569, 1, 4, 138362076.5684462, 46325342.39769246, 45 },
-  { 138361889.08829457, 46325275.70288876, 138361853.15339267, 46325258.133516945, 138361925.02319646, 46325293.27226057, 138361887.29154947, 46325274.82442017, 138361890.88503966, 46325276.581357345, 1, 3, 138361615.98304015, 46325142.17566301, 37 },
-  { 138361880.389397, 46325293.49487553, 138361844.70082575, 46325275.4303832, 138361916.07796824, 46325311.55936786, 138361878.60496843, 46325292.59165091, 138361882.17382556, 46325294.398100145, 1, 5, 138362156.97582406, 46325433.49469111, 46 },
-  { 138361871.45522812, 46325311.14539769, 138361836.03207523, 46325292.56583262, 138361906.878381, 46325329.72496276, 138361869.68407047, 46325310.216419436, 138361873.22638577, 46325312.07437595, 0, 0, 0, 0, 0 },
-  { 138361862.27725607, 46325328.643800154, 138361827.13973644, 46325309.52954595, 138361897.4147757, 46325347.75805436, 138361860.52038008, 46325327.68808744, 138361864.03413206, 46325329.59951287, 0, 0, 0, 0, 0 },
-  { 138361852.84694916, 46325345.97942783, 138361818.0164412, 46325326.311288215, 138361887.67745712, 46325365.64756744, 138361851.10542375, 46325344.996020846, 138361854.58847457, 46325346.96283481, 0, 0, 0, 0, 0 },
-  { 138361843.15577546, 46325363.14162564, 138361808.65484965, 46325342.900921136, 138361877.65670127, 46325383.38233015, 138361841.43072918, 46325362.129590414, 138361844.88082173, 46325364.15366087, 1, 1, 138362178.67727888, 46325559.982476965, 25 },
-  { 138361833.19520319, 46325380.119738474, 138361799.04764235, 46325359.288413785, 138361867.34276402, 46325400.95106316, 138361831.48782516, 46325379.07817224, 138361834.90258121, 46325381.16130471, 0, 0, 0, 0, 0 },
-  { 138361822.95670065, 46325396.90311127, 138361789.18603402, 46325375.46617875, 138361856.72736728, 46325418.34004379, 138361821.26816732, 46325395.831264645, 138361824.645234, 46325397.9749579, 0, 0, 0, 0, 0 },
-  { 138361812.4324843, 46325413.482433036, 138361778.99375865, 46325391.531313986, 138361845.87120995, 46325435.43355209, 138361810.76054803, 46325412.384877086, 138361814.10442057, 46325414.579988986, 0, 0, 0, 0, 0 },
-  { 138361801.64879662, 46325429.909512356, 138361768.3935247, 46325407.68144698, 138361834.90406853, 46325452.137577735, 138361799.98603302, 46325428.798109084, 138361803.3115602, 46325431.02091563, 1, 5, 138361992.03522825, 46325557.165186666, 29 },
-  { 138361790.67917025, 46325446.321102895, 138361757.44588655, 46325424.060176276, 138361823.91245395, 46325468.582029514, 138361789.01750606, 46325445.20805656, 138361792.34083444, 46325447.43414923, 1, 2, 138361511.5195871, 46325259.32931928, 43 },
-  { 138361779.60062936, 46325462.860229895, 138361746.3747344, 46325440.58827657, 138361812.82652432, 46325485.13218322, 138361777.9393346, 46325461.746632226, 138361781.26192412, 46325463.97382756, 0, 0, 0, 0, 0 },
-  { 138361768.41012672, 46325479.55452069, 138361735.9040032, 46325456.24461006, 138361800.91625023, 46325502.86443132, 138361766.78482053, 46325478.38902516, 138361770.0354329, 46325480.72001622, 1, 4, 138361579.0619572, 46325343.77429124, 45 },
-  { 138361756.71271113, 46325495.866794124, 138361726.0188029, 46325470.21754466, 138361787.40661934, 46325521.51604359, 138361755.1780157, 46325494.584331654, 138361758.24740654, 46325497.149256594, 0, 0, 0, 0, 0 },
-  { 138361743.99371865, 46325511.08734037, 138361716.57658648, 46325481.96173542, 138361771.41085082, 46325540.21294532, 138361742.62286204, 46325509.63106012, 138361745.36457527, 46325512.543620616, 1, 4, 138361560.29893312, 46325315.94578721, 29 },
-  { 138361729.73845577, 46325524.50640676, 138361707.39427027, 46325491.32904439, 138361752.08264127, 46325557.68376914, 138361728.6212465, 46325522.84753864, 138361730.85566506, 46325526.16527488, 0, 0, 0, 0, 0 },
-  { 138361713.48466426, 46325535.45295907, 138361696.81761047, 46325499.090762794, 138361730.15171805, 46325571.81515534, 138361712.65131158, 46325533.63484926, 138361714.31801695, 46325537.27106888, 0, 0, 0, 0, 0 },
-  { 138361695.4177067, 46325543.73416825, 138361683.98222128, 46325505.40363638, 138361706.85319212, 46325582.06470011, 138361694.84593242, 46325541.81764165, 138361695.98948097, 46325545.65069484, 0, 0, 0, 0, 0 },
-  { 138361676.1595777, 46325549.479615614, 138361669.50209156, 46325510.03753303, 138361682.81706384, 46325588.9216982, 138361675.8267034, 46325547.50751148, 138361676.492452, 46325551.451719746, 0, 0, 0, 0, 0 },
-  { 138361656.3404428, 46325552.82491604, 138361654.08614722, 46325512.88848967, 138361658.5947384, 46325592.76134241, 138361656.22772804, 46325550.82809472, 138361656.45315757, 46325554.821737364, 1, 2, 138361664.28683475, 46325693.60081901, 36 },
-  { 138361636.4992856, 46325553.94489189, 138361638.01270494, 46325513.973532625, 138361634.98586628, 46325593.91625116, 138361636.57495657, 46325551.94632393, 138361636.42361465, 46325555.94345985, 1, 3, 138361651.2929596, 46325163.22485503, 49 },
-  { 138361616.75003773, 46325553.197134145, 138361621.2061196, 46325513.44611737, 138361612.29395586, 46325592.94815092, 138361616.97284183, 46325551.209583305, 138361616.52723363, 46325555.184684984, 1, 5, 138361583.88643387, 46325846.360882826, 48 },
-  { 138361597.08287323, 46325550.992448516, 138361603.6597225, 46325511.53683987, 138361590.50602394, 46325590.44805716, 138361597.4117157, 46325549.01966809, 138361596.75403076, 46325552.965228945, 0, 0, 0, 0, 0 },
-  { 138361577.4944123, 46325547.727251, 138361585.98853257, 46325508.63953015, 138361569.00029203, 46325586.81497185, 138361577.91911831, 46325545.77286496, 138361577.0697063, 46325549.68163704, 0, 0, 0, 0, 0 },
-  { 138361558.10847667, 46325543.51450937, 138361568.898326, 46325504.99725154, 138361547.31862733, 46325582.031767204, 138361558.64796913, 46325541.58864648, 138361557.5689842, 46325545.440372266, 0, 0, 0, 0, 0 },
-  { 138361539.16523382, 46325538.20793388, 138361552.6080376, 46325500.53445479, 138361525.72243005, 46325575.88141297, 138361539.837374, 46325536.32425993, 138361538.49309364, 46325540.09160783, 0, 0, 0, 0, 0 },
-  { 138361520.87304705, 46325531.68084153, 138361536.92388275, 46325495.04246448, 138361504.82221135, 46325568.319218576, 138361521.67558885, 46325529.84892268, 138361520.07050526, 46325533.51276038, 1, 2, 138361681.38140416, 46325165.29707101, 28 },
-  { 138361503.24989316, 46325523.96034814, 138361521.69893947, 46325488.46904371, 138361484.80084684, 46325559.451652564, 138361504.17234546, 46325522.18578292, 138361502.32744086, 46325525.73491336, 0, 0, 0, 0, 0 },
-  { 138361486.25119203, 46325515.12410418, 138361506.8663105, 46325480.84558482, 138361465.63607356, 46325549.40262354, 138361487.28194797, 46325513.410178214, 138361485.2204361, 46325516.838030145, 0, 0, 0, 0, 0 },
-  { 138361469.83232635, 46325505.249790244, 138361492.37281963, 46325472.20548419, 138361447.29183307, 46325538.2940963, 138361470.959351, 46325503.59757494, 138361468.7053017, 46325506.902005546, 0, 0, 0, 0, 0 },
-  { 138361453.9486788, 46325494.41508696, 138361478.1765069, 46325462.58723211, 138361429.72085068, 46325526.24294181, 138361455.1600702, 46325492.82369422, 138361452.73728737, 46325496.0064797, 0, 0, 0, 0, 0 },
-  { 138361438.55563208, 46325482.697674915, 138361464.24349245, 46325452.03607303, 138361412.86777171, 46325513.3592768, 138361439.8400251, 46325481.16459482, 138361437.27123907, 46325484.23075501, 0, 0, 0, 0, 0 },
-  { 138361423.60856873, 46325470.175234705, 138361450.54488194, 46325440.60438707, 138361396.67225552, 46325499.74608234, 138361424.9553844, 46325468.696692325, 138361422.26175305, 46325471.653777085, 0, 0, 0, 0, 0 },
-  { 138361409.06287158, 46325456.925446965, 138361437.0541438, 46325428.351180926, 138361381.07159936, 46325485.499713, 138361410.4624352, 46325455.496733665, 138361407.66330796, 46325458.354160264, 1, 2, 138361315.29210964, 46325552.64923819, 27 },
-  { 138361394.8739232, 46325443.025992274, 138361423.7451258, 46325415.34109276, 138361366.00272062, 46325470.71089179, 138361396.31748334, 46325441.641747296, 138361393.4303631, 46325444.41023725, 1, 1, 138361625.8435439, 46325221.54679612, 27 },
-  { 138361380.99710634, 46325428.55455124, 138361410.59069484, 46325401.64322426, 138361351.40351784, 46325455.46587821, 138361382.47678578, 46325427.20898489, 138361379.5174269, 46325429.90011758, 0, 0, 0, 0, 0 },
-  { 138361367.3878036, 46325413.58880447, 138361397.5618913, 46325387.33000722, 138361337.21371594, 46325439.84760172, 138361368.896508, 46325412.27586461, 138361365.87909922, 46325414.90174433, 0, 0, 0, 0, 0 },
-  { 138361354.00139773, 46325398.20643257, 138361384.6274617, 46325372.47621287, 138361323.37533376, 46325423.93665228, 138361355.53270093, 46325396.91992159, 138361352.47009453, 46325399.492943555, 0, 0, 0, 0, 0 },
-  { 138361340.79327127, 46325382.48511615, 138361371.75364456, 46325357.15814858, 138361309.832898, 46325407.81208371, 138361342.34128994, 46325381.21876777, 138361339.2452526, 46325383.75146452, 0, 0, 0, 0, 0 },
-  { 138361327.718807, 46325366.502535805, 138361358.90410674, 46325341.45304318, 138361296.5335073, 46325391.55202843, 138361329.278072, 46325365.25006118, 138361326.15954202, 46325367.75501043, 0, 0, 0, 0, 0 },
-  { 138361314.73338756, 46325350.33637214, 138361346.03995773, 46325325.438607894, 138361283.4268174, 46325375.23413638, 138361316.29871607, 46325349.09148393, 138361313.16805905, 46325351.581260346, 0, 0, 0, 0, 0 },
-  { 138361301.79239562, 46325334.06430577, 138361333.11979157, 46325309.19275046, 138361270.46499968, 46325358.93586107, 138361303.35876542, 46325332.820728004, 138361300.22602582, 46325335.30788353, 1, 0, 138361019.06264722, 46325558.5300924, 36 },
-  { 138361288.8512138, 46325317.764017284, 138361320.09972656, 46325292.793425545, 138361257.60270107, 46325342.73460902, 138361290.41363946, 46325316.5154877, 138361287.28878817, 46325319.01254687, 0, 0, 0, 0, 0 },
-  { 138361275.86522487, 46325301.5131873, 138361306.93342757, 46325276.31860889, 138361244.79702216, 46325326.707765706, 138361277.418635, 46325300.25345837, 138361274.31181473, 46325302.77291622, 0, 0, 0, 0, 0 },
-  { 138361262.78981146, 46325285.38949642, 138361293.57210898, 46325259.84639249, 138361232.00751394, 46325310.93260036, 138361264.32892632, 46325284.112341225, 138361261.2506966, 46325286.66665162, 1, 3, 138361480.5745665, 46325104.67203608, 40 },
-  { 138361249.58035624, 46325269.47062525, 138361279.96452788, 46325243.45520455, 138361219.1961846, 46325295.48604596, 138361251.09956482, 46325268.16985422, 138361248.06114766, 46325270.77139629, 1, 2, 138360955.61349574, 46325521.16982056, 44 },
-  { 138361236.19224182, 46325253.834254384, 138361266.05699027, 46325227.22416606, 138361206.32749337, 46325280.44434271, 138361237.68547925, 46325252.50374997, 138361234.69900438, 46325255.1647588, 0, 0, 0, 0, 0 },
-  { 138361222.58085096, 46325238.55806443, 138361251.7934088, 46325211.23359802, 138361193.3682931, 46325265.88253084, 138361224.04147884, 46325237.19184111, 138361221.12022308, 46325239.92428775, 0, 0, 0, 0, 0 },
-  { 138361208.70156628, 46325223.71973601, 138361237.1154702, 46325195.565694325, 138361180.28766236, 46325251.873777695, 138361210.12226146, 46325222.31203393, 138361207.2808711, 46325225.12743809, 0, 0, 0, 0, 0 },
-  { 138361194.50977048, 46325209.396949716, 138361221.96299195, 46325180.30535933, 138361167.056549, 46325238.488540106, 138361195.88243157, 46325207.9423702, 138361193.1371094, 46325210.85152923, 0, 0, 0, 0, 0 },
-  { 138361179.96084622, 46325195.66738614, 138361206.27457038, 46325165.54118624, 138361153.64712206, 46325225.79358603, 138361181.2765324, 46325194.16107614, 138361178.64516002, 46325197.17369613, 1, 2, 138361322.05495676, 46325032.985906705, 43 },
-  { 138361165.01017615, 46325182.60872591, 138361189.98863533, 46325151.366501644, 138361140.03171697, 46325213.85095018, 138361166.2590991, 46325181.0466147, 138361163.7612532, 46325184.17083713, 1, 5, 138361005.7724989, 46325381.77790561, 42 },
-  { 138361149.61314297, 46325170.2986496, 138361173.0450135, 46325137.88033004, 138361126.18127245, 46325202.71696916, 138361150.78473648, 46325168.67773362, 138361148.44154945, 46325171.91956558, 0, 0, 0, 0, 0 },
-  { 138361133.7251293, 46325158.81483785, 138361155.3870506, 46325125.188045464, 138361112.063208, 46325192.44163024, 138361134.80822536, 46325157.13349823, 138361132.64203325, 46325160.49617747, 1, 0, 138361060.61614498, 46325272.30526216, 39 },
-  { 138361117.30151787, 46325148.23497124, 138361136.96421528, 46325113.401390724, 138361097.63882047, 46325183.06855176, 138361118.28465274, 46325146.49329221, 138361116.318383, 46325149.97665027, 1, 5, 138361211.1908979, 46324981.90462429, 30 },
-  { 138361100.29769135, 46325138.63673039, 138361117.73491684, 46325102.63751974, 138361082.86046585, 46325174.635941036, 138361101.16955262, 46325136.83676986, 138361099.42583007, 46325140.43669092, 0, 0, 0, 0, 0 },
-  { 138361082.66903237, 46325130.09779589, 138361097.68156064, 46325093.021873854, 138361067.6565041, 46325167.17371792, 138361083.41965878, 46325128.24399979, 138361081.91840595, 46325131.95159199, 1, 0, 138361170.49232277, 46324913.20365198, 25 },
-  { 138361064.3955759, 46325122.69863313, 138361076.8494405, 46325084.686776325, 138361051.94171134, 46325160.71048993, 138361065.01826915, 46325120.798040286, 138361063.77288267, 46325124.59922597, 0, 0, 0, 0, 0 },
-  { 138361045.57764816, 46325116.5332957, 138361055.34931087, 46325077.74522269, 138361035.80598545, 46325155.32136871, 138361046.0662313, 46325114.593892045, 138361045.08906502, 46325118.47269935, 0, 0, 0, 0, 0 },
-  { 138361026.35371837, 46325111.69031838, 138361034.3513423, 46325072.49799756, 138361018.35609445, 46325150.88263921, 138361026.75359955, 46325109.73070234, 138361025.9538372, 46325113.649934426, 1, 5, 138360983.96631154, 46325319.40961874, 38 },
-  { 138361006.94481912, 46325107.72971912, 138361015.6834528, 46325068.69593527, 138360998.20618543, 46325146.76350296, 138361007.38175082, 46325105.778029926, 138361006.50788742, 46325109.68140831, 0, 0, 0, 0, 0 },
-  { 138360987.69556805, 46325103.42031999, 138360999.68092215, 46325065.258149095, 138360975.71021396, 46325141.582490884, 138360988.29483575, 46325101.51221144, 138360987.09630036, 46325105.32842854, 0, 0, 0, 0, 0 },
-  { 138360968.94649193, 46325097.53191503, 138360984.82803407, 46325060.81983774, 138360953.06494978, 46325134.24399232, 138360969.74056903, 46325095.69631117, 138360968.15241483, 46325099.367518894, 0, 0, 0, 0, 0 },
-  { 138360950.85034692, 46325089.70357322, 138360970.0220645, 46325054.597373694, 138360931.67862934, 46325124.809772745, 138360951.8089328, 46325087.94826324, 138360949.89176103, 46325091.458883196, 0, 0, 0, 0, 0 },
-  { 138360933.4271921, 46325080.188678175, 138360955.3092998, 46325046.704751246, 138360911.5450844, 46325113.672605105, 138360934.52129748, 46325078.51448183, 138360932.3330867, 46325081.86287452, 1, 1, 138361052.13762635, 46324898.538374566, 36 },
-  { 138360916.6942926, 46325069.253547736, 138360940.78348732, 46325037.32063842, 138360892.6050979, 46325101.18645705, 138360917.89875233, 46325067.65690227, 138360915.48983288, 46325070.8501932, 0, 0, 0, 0, 0 },
-  { 138360900.6689137, 46325057.164499745, 138360926.59832948, 46325026.706899755, 138360874.7394979, 46325087.622099735, 138360901.96538448, 46325055.64161974, 138360899.3724429, 46325058.68737975, 1, 3, 138361152.8324822, 46324760.96433984, 45 },
-  { 138360885.38775107, 46325044.15521407, 138360913.1450446, 46325015.3536055, 138360857.63045755, 46325072.95682264, 138360886.77561575, 46325042.715133645, 138360883.9998864, 46325045.5952945, 1, 2, 138360659.85974118, 46325278.16828371, 37 },
-  { 138360870.99290916, 46325030.282313496, 138360900.6593801, 46325003.45135188, 138360841.32643822, 46325057.11327511, 138360872.4762327, 46325028.94076542, 138360869.50958562, 46325031.62386157, 1, 0, 138361094.97476488, 46324827.70855332, 43 },
-  { 138360857.6620684, 46325015.54266286, 138360889.2868051, 46324991.05029612, 138360826.0373317, 46325040.0350296, 138360859.24330524, 46325014.31804452, 138360856.08083156, 46325016.7672812, 1, 4, 138360697.16652966, 46325139.84142408, 32 },
-  { 138360845.57293665, 46324999.93308081, 138360879.15161544, 46324978.19665217, 138360811.99425787, 46325021.66950945, 138360847.2518706, 46324998.84625938, 138360843.8940027, 46325001.01990224, 0, 0, 0, 0, 0 },
-  { 138360834.90322202, 46324983.45038596, 138360870.25267217, 46324964.730974264, 138360799.55377188, 46325002.16979765, 138360836.67069453, 46324982.514415376, 138360833.13574952, 46324984.38635654, 1, 2, 138360663.4583888, 46325074.239532664, 32 },
-  { 138360825.73064914, 46324966.129039906, 138360862.273067, 46324949.86092088, 138360789.1882313, 46324982.39715893, 138360827.55777004, 46324965.31563395, 138360823.90352824, 46324966.94244586, 0, 0, 0, 0, 0 },
-  { 138360817.72912446, 46324948.15553859, 138360854.938759, 46324933.47755857, 138360780.5194899, 46324962.83351861, 138360819.5896062, 46324947.42163959, 138360815.86864272, 46324948.889437586, 0, 0, 0, 0, 0 },
-  { 138360810.47061935, 46324929.75475579, 138360847.94538674, 46324915.767554134, 138360772.99585196, 46324943.74195744, 138360812.34435773, 46324929.05539571, 138360808.59688097, 46324930.45411587, 0, 0, 0, 0, 0 },
-  { 138360803.5271052, 46324911.151565276, 138360840.92120326, 46324896.950106494, 138360766.13300717, 46324925.35302406, 138360805.3968101, 46324910.441492334, 138360801.6574003, 46324911.86163822, 0, 0, 0, 0, 0 },
-  { 138360796.47055334, 46324892.57084081, 138360833.42311046, 46324877.25716969, 138360759.51799622, 46324907.88451193, 138360798.3181812, 46324891.80515726, 138360794.6229255, 46324893.33652437, 0, 0, 0, 0, 0 },
-  { 138360788.8729351, 46324874.23745621, 138360824.96683055, 46324856.997076005, 138360752.77903962, 46324891.477836415, 138360790.67762986, 46324873.3754372, 138360787.0682403, 46324875.09947522, 1, 5, 138360445.98092812, 46325038.021068186, 36 },
-  { 138360780.33577907, 46324856.36434592, 138360815.34641075, 46324837.018657275, 138360745.3251474, 46324875.71003457, 138360782.08631065, 46324855.39706149, 138360778.5852475, 46324857.33163036, 1, 0, 138361084.0530089, 46324688.54049691, 36 },
-  { 138360770.76398376, 46324839.04190233, 138360804.63610676, 46324817.765641324, 138360736.89186075, 46324860.31816334, 138360772.4575899, 46324837.97808928, 138360769.07037762, 46324840.10571539, 0, 0, 0, 0, 0 },
-  { 138360760.24061814, 46324822.28854823, 138360792.94050765, 46324799.251247495, 138360727.54072863, 46324845.32584897, 138360761.87561262, 46324821.136683196, 138360758.60562366, 46324823.44041327, 1, 1, 138360930.28004366, 46324702.4945844, 29 },
-  { 138360748.85102287, 46324806.12178845, 138360780.36050022, 46324781.48131691, 138360717.34154552, 46324830.76225999, 138360750.42649674, 46324804.889764875, 138360747.275549, 46324807.353812024, 1, 1, 138360530.6478923, 46324976.75705386, 50 },
-  { 138360736.67592227, 46324790.55264418, 138360766.99294007, 46324764.45899684, 138360706.35890448, 46324816.64629152, 138360738.19177318, 46324789.24796181, 138360735.16007137, 46324791.857326545, 0, 0, 0, 0, 0 },
-  { 138360723.77939272, 46324775.56875515, 138360752.91809708, 46324748.165545344, 138360694.64068836, 46324802.971964955, 138360725.23632795, 46324774.19859466, 138360722.3224575, 46324776.93891564, 0, 0, 0, 0, 0 },
-  { 138360710.22175923, 46324761.152492344, 138360738.20965672, 46324732.57492081, 138360682.23386174, 46324789.73006388, 138360711.6211541, 46324759.72361377, 138360708.82236436, 46324762.58137092, 1, 4, 138360811.6778876, 46324657.55879554, 36 },
-  { 138360696.0633467, 46324747.28622671, 138360722.9385622, 46324717.65983997, 138360669.1881312, 46324776.91261345, 138360697.4071075, 46324745.804907374, 138360694.71958593, 46324748.76754605, 0, 0, 0, 0, 0 },
-  { 138360681.36448026, 46324733.95232922, 138360707.17328775, 46324703.39246247, 138360655.55567276, 46324764.51219597, 138360682.65492064, 46324732.42433588, 138360680.07403988, 46324735.480322555, 1, 2, 138360871.7044355, 46324508.573311925, 35 },
-  { 138360666.18548477, 46324721.13317082, 138360690.98014063, 46324689.744876176, 138360641.3908289, 46324752.521465465, 138360667.42521757, 46324719.563756086, 138360664.94575197, 46324722.702585556, 1, 3, 138360540.97247264, 46324879.644058764, 50 },
-  { 138360650.58667302, 46324708.811151624, 138360674.3733831, 46324676.65228934, 138360626.79996294, 46324740.97001391, 138360651.77600852, 46324707.203208506, 138360649.39733753, 46324710.41909474, 0, 0, 0, 0, 0 },
-  { 138360634.61600065, 46324696.99824139, 138360657.24915165, 46324664.01733062, 138360611.98284966, 46324729.97915216, 138360635.7476582, 46324695.349195845, 138360633.4843431, 46324698.64728693, 0, 0, 0, 0, 0 },
-  { 138360618.28580397, 46324685.791643426, 138360639.57394585, 46324651.92698611, 138360596.9976621, 46324719.65630074, 138360619.35021105, 46324684.09841056, 138360617.2213969, 46324687.48487629, 0, 0, 0, 0, 0 },
-  { 138360601.60204002, 46324675.303826265, 138360621.33698687, 46324640.51112771, 138360581.86709318, 46324710.09652482, 138360602.58878738, 46324673.564191334, 138360600.61529267, 46324677.043461196, 0, 0, 0, 0, 0 },
-  { 138360584.5709736, 46324665.64354682, 138360602.6603394, 46324629.96757668, 138360566.48160782, 46324701.31951696, 138360585.4754419, 46324663.85974831, 138360583.6665053, 46324667.42734533, 0, 0, 0, 0, 0 },
-  { 138360567.20559257, 46324656.838496014, 138360583.69693103, 46324620.39627111, 138360550.7142541, 46324693.28072092, 138360568.0301595, 46324655.016384766, 138360566.38102564, 46324658.66060726, 0, 0, 0, 0, 0 },
-  { 138360549.52541518, 46324648.83761819, 138360564.48938355, 46324611.74207061, 138360534.56144682, 46324685.93316577, 138360550.2736136, 46324646.982840806, 138360548.77721676, 46324650.69239557, 0, 0, 0, 0, 0 },
-  { 138360531.5502293, 46324641.58661017, 138360545.07215244, 46324603.9414565, 138360518.0283062, 46324679.23176384, 138360532.22632545, 46324639.70435248, 138360530.87413317, 46324643.46886785, 0, 0, 0, 0, 0 },
-  { 138360513.29982254, 46324635.03116881, 138360525.47648695, 46324596.92960921, 138360501.12315813, 46324673.13272841, 138360513.90865576, 46324633.12609083, 138360512.69098932, 46324636.93624679, 0, 0, 0, 0, 0 },
-  { 138360494.79398274, 46324629.11699094, 138360505.73063606, 46324590.64115938, 138360483.85732943, 46324667.5928225, 138360495.3408154, 46324627.19319936, 138360494.2471501, 46324631.04078252, 1, 5, 138360433.54872417, 46324844.58164768, 46 },
-  { 138360476.0524976, 46324623.789773375, 138360485.86020824, 46324585.010799535, 138360466.24478695, 46324662.568747215, 138360476.54288313, 46324621.850824684, 138360475.56211206, 46324625.728722066, 0, 0, 0, 0, 0 },
-  { 138360457.09515473, 46324618.99521295, 138360465.8886122, 46324579.97374314, 138360448.30169725, 46324658.01668276, 138360457.53482762, 46324617.04413946, 138360456.65548185, 46324620.94628644, 0, 0, 0, 0, 0 },
-  { 138360437.94174197, 46324614.67900648, 138360445.83751932, 46324575.466040514, 138360430.04596463, 46324653.891972445, 138360438.33653083, 46324612.71835818, 138360437.5469531, 46324616.63965478, 0, 0, 0, 0, 0 },
-  { 138360418.612047, 46324610.78685081, 138360425.72730651, 46324571.42477411, 138360411.49678746, 46324650.14892751, 138360418.96780998, 46324608.81874698, 138360418.256284, 46324612.75495464, 1, 4, 138360354.75259283, 46324964.06148918, 49 },
-  { 138360399.1258576, 46324607.264442794, 138360405.57745373, 46324567.78815995, 138360392.67426145, 46324646.74072564, 138360399.4484374, 46324605.29062865, 138360398.8032778, 46324609.23825694, 0, 0, 0, 0, 0 },
-  { 138360379.50296143, 46324604.05747922, 138360385.4068829, 46324564.49558201, 138360373.59903994, 46324643.61937643, 138360379.7981575, 46324602.07938436, 138360379.20776534, 46324606.03557408, 1, 4, 138360340.24188358, 46324867.14409569, 33 },
-  { 138360359.76314622, 46324601.11165692, 138360365.23423573, 46324561.48758369, 138360354.2920567, 46324640.73573015, 138360360.0367007, 46324599.13045326, 138360359.48959175, 46324603.09286058, 0, 0, 0, 0, 0 },
-  { 138360339.9261998, 46324598.372672744, 138360345.07809132, 46324558.70583504, 138360334.77430826, 46324638.03951045, 138360340.18379438, 46324596.38933086, 138360339.6686052, 46324600.35601463, 0, 0, 0, 0, 0 },
-  { 138360320.01190972, 46324595.7862235, 138360324.95712847, 46324556.09309045, 138360315.06669098, 46324635.47935655, 138360320.25917065, 46324593.80156685, 138360319.7646488, 46324597.770880155, 0, 0, 0, 0, 0 },
-  { 138360300.04006383, 46324593.298006035, 138360304.89023954, 46324553.59314744, 138360295.18988812, 46324633.00286463, 138360300.28257263, 46324591.3127631, 138360299.79755503, 46324595.28324897, 0, 0, 0, 0, 0 },
-  { 138360280.03044984, 46324590.85371718, 138360284.89659926, 46324551.15081313, 138360275.1643004, 46324630.55662122, 138360280.2737573, 46324588.868571974, 138360279.78714237, 46324592.83886238, 1, 2, 138360305.33442685, 46324384.398616135, 32 },
-  { 138360260.00285548, 46324588.399053745, 138360264.99569413, 46324548.711882494, 138360255.01001683, 46324628.086224996, 138360260.2524974, 46324586.41469518, 138360259.75321355, 46324590.38341231, 1, 2, 138360216.4403382, 46324934.669622935, 31 },
-  { 138360239.97706845, 46324585.8797126, 138360245.20731407, 46324546.22313016, 138360234.74682283, 46324625.536295034, 138360240.23858073, 46324583.89688347, 138360239.71555617, 46324587.86254172, 0, 0, 0, 0, 0 },
-  { 138360219.97287646, 46324583.2413905, 138360225.55150625, 46324543.632314645, 138360214.39424667, 46324622.85046635, 138360220.25180796, 46324581.26093671, 138360219.69394496, 46324585.221844286, 1, 3, 138360202.8185899, 46324705.03929874, 47 },
-  { 138360200.01006728, 46324580.429784335, 138360206.0484918, 46324540.8881932, 138360193.97164276, 46324619.97137547, 138360200.3119885, 46324578.45270478, 138360199.70814607, 46324582.40686389, 0, 0, 0, 0, 0 },
-  { 138360180.10842857, 46324577.39059093, 138360186.71854082, 46324537.9405413, 138360173.49831632, 46324616.84064056, 138360180.43893418, 46324575.41808844, 138360179.77792296, 46324579.36309341, 0, 0, 0, 0, 0 },
-  { 138360160.28774813, 46324574.06950708, 138360167.58180362, 46324534.74017, 138360152.99369264, 46324613.39884415, 138360160.6524509, 46324572.103040226, 138360159.92304537, 46324576.03597393, 1, 3, 138360204.78148657, 46324334.16055094, 32 },
-  { 138360140.56781366, 46324570.412229665, 138360148.65809512, 46324531.23893078, 138360132.4775322, 46324609.58552855, 138360140.97232774, 46324568.45356472, 138360140.1632996, 46324572.37089461, 0, 0, 0, 0, 0 },
-  { 138360120.96841288, 46324566.36445546, 138360129.96662936, 46324527.38969311, 138360111.9701964, 46324605.33921781, 138360121.4183237, 46324564.41571734, 138360120.51850206, 46324568.31319358, 0, 0, 0, 0, 0 },
-  { 138360101.5093335, 46324561.871881336, 138360111.52570763, 46324523.14627935, 138360091.49295935, 46324600.59748332, 138360102.0101522, 46324559.935601234, 138360101.0085148, 46324563.80816144, 0, 0, 0, 0, 0 },
-  { 138360082.21036327, 46324556.8802041, 138360093.35236484, 46324518.463335395, 138360071.0683617, 46324595.2970728, 138360082.76746336, 46324554.95936066, 138360081.65326318, 46324558.801047534, 0, 0, 0, 0, 0 },
-  { 138360063.0912899, 46324551.33512057, 138360075.4619913, 46324513.296117604, 138360050.7205885, 46324589.37412354, 138360063.70982498, 46324549.43317042, 138360062.47275484, 46324553.237070724, 0, 0, 0, 0, 0 },
-  { 138360044.1719011, 46324545.18232761, 138360057.8681021, 46324507.60022977, 138360030.4757001, 46324582.76442546, 138360044.85671115, 46324543.30322272, 138360043.48709106, 46324547.0614325, 0, 0, 0, 0, 0 },
-  { 138360025.47219574, 46324538.36751583, 138360040.6019178, 46324501.33926297, 138360010.3424737, 46324575.395768695, 138360026.22868186, 46324536.516103186, 138360024.71570963, 46324540.21892848, 1, 4, 138359939.23277995, 46324749.42855715, 29 },
-  { 138360007.0386914, 46324530.835596934, 138360023.7449873, 46324494.4914134, 138359990.3323955, 46324567.17978047, 138360007.8740062, 46324529.01838776, 138360006.2033766, 46324532.65280611, 0, 0, 0, 0, 0 },
-  { 138359988.96994588, 46324522.529954046, 138360007.39941826, 46324487.02848158, 138359970.5404735, 46324558.03142651, 138359989.8914195, 46324520.75488042, 138359988.04847226, 46324524.30502767, 0, 0, 0, 0, 0 },
-  { 138359971.3705712, 46324513.393792436, 138359991.6642186, 46324478.923981376, 138359951.0769238, 46324547.863603495, 138359972.38525358, 46324511.670301884, 138359970.3558888, 46324515.11728299, 1, 5, 138360128.13899752, 46324247.11450202, 25 },
-  { 138359954.34517977, 46324503.37031739, 138359976.63116947, 46324470.15383559, 138359932.05919006, 46324536.5867992, 138359955.45947924, 46324501.7094933, 138359953.2308803, 46324505.03114148, 1, 3, 138359852.9439267, 46324654.50530961, 45 },
-  { 138359937.99838382, 46324492.40273425, 138359962.31910002, 46324460.64580173, 138359913.67766762, 46324524.15966677, 138359939.21441963, 46324490.81488762, 138359936.782348, 46324493.99058088, 0, 0, 0, 0, 0 },
-  { 138359922.40608206, 46324480.46153225, 138359948.41896698, 46324450.07518961, 138359896.39319715, 46324510.84787489, 138359923.7067263, 46324478.942215115, 138359921.10543782, 46324481.980849385, 0, 0, 0, 0, 0 },
-  { 138359907.47416663, 46324467.67874354, 138359934.73109102, 46324438.40315519, 138359880.21724224, 46324496.95433189, 138359908.83701286, 46324466.21496412, 138359906.1113204, 46324469.14252296, 0, 0, 0, 0, 0 },
-  { 138359893.0461928, 46324454.24563377, 138359921.13923025, 46324425.771413036, 138359864.95315534, 46324482.71985451, 138359894.45084468, 46324452.821922734, 138359891.6415409, 46324455.66934481, 1, 1, 138359718.16703463, 46324631.49765785, 40 },
-  { 138359878.96562126, 46324440.3535583, 138359907.5208078, 46324412.34282246, 138359850.41043472, 46324468.36429414, 138359880.39338058, 46324438.95302151, 138359877.53786194, 46324441.75409509, 1, 0, 138359962.48954186, 46324358.42215598, 40 },
-  { 138359865.0759128, 46324426.19387259, 138359893.7407236, 46324398.29533103, 138359836.411102, 46324454.092414156, 138359866.50915334, 46324424.79894552, 138359863.64267227, 46324427.58879967, 0, 0, 0, 0, 0 },
-  { 138359851.22052813, 46324411.957931995, 138359879.64861733, 46324383.818213716, 138359822.79243892, 46324440.097650275, 138359852.64193258, 46324410.55094608, 138359849.79912367, 46324413.36491791, 1, 2, 138359951.42954254, 46324312.76542507, 43 },
-  { 138359837.24292806, 46324397.83709192, 138359865.07893136, 46324369.11154718, 138359809.40692475, 46324426.562636666, 138359838.63472822, 46324396.40081468, 138359835.8511279, 46324399.27336916, 0, 0, 0, 0, 0 },
-  { 138359822.98684576, 46324384.02247649, 138359849.93628228, 46324354.4635883, 138359796.03740925, 46324413.58136468, 138359824.3343176, 46324382.544532076, 138359821.63937393, 46324385.5004209, 0, 0, 0, 0, 0 },
-  { 138359808.33955303, 46324370.6682433, 138359834.26387364, 46324340.20630636, 138359782.41523242, 46324401.13018023, 138359809.63576907, 46324369.14514645, 138359807.043337, 46324372.19134014, 0, 0, 0, 0, 0 },
-  { 138359793.27926278, 46324357.851336956, 138359818.0504829, 46324326.44454383, 138359768.50804266, 46324389.25813008, 138359794.5178238, 46324356.2809973, 138359792.04070178, 46324359.42167661, 0, 0, 0, 0, 0 },
-  { 138359777.7955857, 46324345.63902442, 138359801.2852259, 46324313.26253908, 138359754.3059455, 46324378.01550976, 138359778.9700677, 46324344.020200156, 138359776.62110367, 46324347.25784869, 0, 0, 0, 0, 0 },
-  { 138359761.88042182, 46324334.0923272, 138359784.07792923, 46324300.816650435, 138359739.6829144, 46324367.368003964, 138359762.9902972, 46324332.42854336, 138359760.77054644, 46324335.75611104, 1, 4, 138359876.19758505, 46324162.722591855, 45 },
-  { 138359745.55213317, 46324323.20006764, 138359766.53782102, 46324289.14715433, 138359724.56644532, 46324357.25298095, 138359746.60141757, 46324321.49742197, 138359744.50284877, 46324324.902713306, 0, 0, 0, 0, 0 },
-  { 138359728.8460838, 46324312.90468015, 138359748.71471974, 46324278.188152306, 138359708.97744784, 46324347.62120799, 138359729.8395156, 46324311.16885375, 138359727.85265198, 46324314.64050654, 1, 0, 138359818.25494558, 46324156.68030486, 36 },
-  { 138359711.7979179, 46324303.147834554, 138359730.65439838, 46324267.87131058, 138359692.94143742, 46324338.42435853, 138359712.74074194, 46324301.384008355, 138359710.85509387, 46324304.91166075, 1, 2, 138359623.64387167, 46324468.065584145, 31 },
-  { 138359694.44327977, 46324293.87120074, 138359712.3999601, 46324258.12826253, 138359676.48659945, 46324329.61413895, 138359695.34111378, 46324292.08405383, 138359693.54544577, 46324295.65834765, 0, 0, 0, 0, 0 },
-  { 138359676.8178136, 46324285.01644852, 138359693.99228412, 46324248.89114489, 138359659.6433431, 46324321.14175215, 138359677.67653713, 46324283.21018334, 138359675.95909008, 46324286.8227137, 1, 2, 138359606.40248448, 46324433.130193405, 40 },
-  { 138359658.9571637, 46324276.52524777, 138359675.47048932, 46324240.092980795, 138359642.44383806, 46324312.95751474, 138359659.78282997, 46324274.70363442, 138359658.1314974, 46324278.34686112, 0, 0, 0, 0, 0 },
-  { 138359640.89697427, 46324268.33926831, 138359656.87236968, 46324231.66793425, 138359624.92157885, 46324305.01060238, 138359641.69574404, 46324266.50570161, 138359640.0982045, 46324270.172835015, 0, 0, 0, 0, 0 },
-  { 138359622.67288956, 46324260.40018002, 138359638.23477578, 46324223.55146637, 138359607.11100334, 46324297.24889367, 138359623.45098388, 46324258.55774434, 138359621.89479524, 46324262.2426157, 1, 1, 138359673.6380669, 46324139.72064282, 28 },
-  { 138359604.32055378, 46324252.64965272, 138359619.59392753, 46324215.68042153, 138359589.04718003, 46324289.61888391, 138359605.08422247, 46324250.80119116, 138359603.5568851, 46324254.49811428, 1, 0, 138359553.91842043, 46324374.648115635, 49 },
-  { 138359585.87561122, 46324245.02935626, 138359600.985653, 46324207.99306816, 138359570.76556942, 46324282.06564437, 138359586.63111332, 46324243.17754186, 138359585.1201091, 46324246.88117067, 0, 0, 0, 0, 0 },
-  { 138359567.3737061, 46324237.48096051, 138359582.44555348, 46324200.42911283, 138359552.30185872, 46324274.53280819, 138359568.12729847, 46324235.628368124, 138359566.62011373, 46324239.3335529, 0, 0, 0, 0, 0 },
-  { 138359548.8504827, 46324229.9461353, 138359564.00909364, 46324192.92969957, 138359533.69187176, 46324266.962571025, 138359549.60841325, 46324228.09531351, 138359548.09255216, 46324231.79695708, 0, 0, 0, 0, 0 },
-  { 138359530.34158468, 46324222.366551295, 138359545.6892371, 46324185.42809484, 138359514.99393228, 46324259.30500775, 138359531.1089673, 46324220.51962847, 138359529.57420206, 46324224.21347412, 1, 1, 138359460.5097662, 46324390.43652816, 36 },
-  { 138359511.87645087, 46324214.69442628, 138359527.4368018, 46324177.84506429, 138359496.31609994, 46324251.54378828, 138359512.65446842, 46324212.851958185, 138359511.09843332, 46324216.53689438, 0, 0, 0, 0, 0 },
-  { 138359493.46279448, 46324206.91890618, 138359509.24232197, 46324170.1628657, 138359477.683267, 46324243.674946666, 138359494.25177085, 46324205.08110416, 138359492.6738181, 46324208.756708205, 0, 0, 0, 0, 0 },
-  { 138359475.10357663, 46324199.03721438, 138359491.108745, 46324162.37886492, 138359459.09840825, 46324235.695563845, 138359475.90383506, 46324197.20429691, 138359474.3033182, 46324200.87013186, 1, 2, 138359577.13652503, 46323965.34023657, 47 },
-  { 138359456.80175865, 46324191.04657425, 138359473.03901473, 46324154.490432285, 138359440.56450257, 46324227.602716215, 138359457.61362144, 46324189.21876715, 138359455.98989585, 46324192.87438135, 1, 3, 138359365.06126183, 46324397.588776335, 39 },
-  { 138359438.5603015, 46324182.9442091, 138359455.03607115, 46324146.494942784, 138359422.08453187, 46324219.39347541, 138359439.38409, 46324181.12174578, 138359437.73651302, 46324184.76667242, 0, 0, 0, 0, 0 },
-  { 138359420.3821665, 46324174.72734234, 138359437.1028505, 46324138.38977601, 138359403.6614825, 46324211.06490867, 138359421.2182007, 46324172.91046402, 138359419.5461323, 46324176.544220656, 0, 0, 0, 0, 0 },
-  { 138359402.27031487, 46324166.39319731, 138359419.24228412, 46324130.17231578, 138359385.29834563, 46324202.61407885, 138359403.11891332, 46324164.58215324, 138359401.42171642, 46324168.20424139, 0, 0, 0, 0, 0 },
-  { 138359384.22770762, 46324157.93899734, 138359401.45729837, 46324121.839950226, 138359366.99811688, 46324194.03804446, 138359385.08918718, 46324156.13404499, 138359383.36622807, 46324159.7439497, 0, 0, 0, 0, 0 },
-  { 138359366.25730604, 46324149.36196583, 138359383.75081426, 46324113.39007165, 138359348.76379782, 46324185.33386, 138359367.13198146, 46324147.56337112, 138359365.38263062, 46324151.16056053, 0, 0, 0, 0, 0 },
-  { 138359348.36207137, 46324140.659326114, 138359366.12574655, 46324104.82007606, 138359330.59839618, 46324176.498576164, 138359349.25025514, 46324138.86736361, 138359347.4738876, 46324142.45128862, 1, 4, 138359242.22411215, 46324354.79884516, 48 },
-  { 138359330.5449646, 46324131.828301564, 138359348.5850037, 46324096.127363354, 138359312.50492552, 46324167.529239774, 138359331.44696656, 46324130.04325465, 138359329.64296266, 46324133.61334848, 1, 1, 138359409.01913473, 46323976.52922035, 26 },
-  { 138359312.80894706, 46324122.86611552, 138359331.13148713, 46324087.309336625, 138359294.48640698, 46324158.42289441, 138359313.72507405, 46324121.08827657, 138359311.89282006, 46324124.64395446, 0, 0, 0, 0, 0 },
-  { 138359295.15697986, 46324113.76999134, 138359313.7680906, 46324078.36340217, 138359276.5458691, 46324149.1765805, 138359296.0875354, 46324111.99966188, 138359294.2264243, 46324115.5403208, 1, 4, 138359380.30281156, 46323951.784845896, 39 },
-  { 138359277.5920242, 46324104.5371524, 138359296.49770007, 46324069.28696913, 138359258.68634835, 46324139.78733567, 138359278.537308, 46324102.77464324, 138359276.6467404, 46324106.29966156, 0, 0, 0, 0, 0 },
-  { 138359260.1170413, 46324095.16482205, 138359279.3231926, 46324060.077448934, 138359240.91088998, 46324130.252195165, 138359261.07734886, 46324093.410453394, 138359259.15673372, 46324096.919190705, 1, 4, 138359346.06456837, 46323938.14882735, 39 },
-  { 138359242.7349922, 46324085.650223635, 138359262.2474363, 46324050.732255116, 138359223.2225481, 46324120.568192154, 138359243.7106144, 46324083.90432521, 138359241.75937, 46324087.39612206, 0, 0, 0, 0, 0 },
-  { 138359225.4488382, 46324075.99058054, 138359245.27328962, 46324041.24880272, 138359205.6243868, 46324110.73235835, 138359226.44006076, 46324074.25349165, 138359224.45761564, 46324077.727669425, 0, 0, 0, 0, 0 },
-  { 138359208.26154038, 46324066.183116086, 138359228.40360084, 46324031.62450788, 138359188.11947992, 46324100.74172429, 138359209.2686434, 46324064.455185674, 138359207.25443736, 46324067.9110465, 0, 0, 0, 0, 0 },
-  { 138359191.17606005, 46324056.22505367, 138359211.6412074, 46324021.85678714, 138359170.7109127, 46324090.5933202, 138359192.19931743, 46324054.506640345, 138359190.15280268, 46324057.94346699, 0, 0, 0, 0, 0 },
-  { 138359174.1953583, 46324046.11361663, 138359194.98893556, 46324011.943057, 138359153.40178105, 46324080.28417626, 138359175.23503718, 46324044.40508865, 138359173.15567943, 46324047.82214461, 1, 1, 138359121.17173633, 46324133.24854368, 45 },
-  { 138359157.32239634, 46324035.846028335, 138359178.44959983, 46324001.88073322, 138359136.19519284, 46324069.81132345, 138359158.37875652, 46324034.14776358, 138359156.26603615, 46324037.54429309, 0, 0, 0, 0, 0 },
-  { 138359140.56013528, 46324025.41951211, 138359162.0260025, 46323991.66723005, 138359119.09426805, 46324059.17179417, 138359141.63342863, 46324023.731898, 138359139.48684192, 46324027.10712621, 0, 0, 0, 0, 0 },
-  { 138359123.91153637, 46324014.83129135, 138359145.72093314, 46323981.29995955, 138359102.1021396, 46324048.36262315, 138359125.0020062, 46324013.154724754, 138359122.82106653, 46324016.50785794, 0, 0, 0, 0, 0 },
-  { 138359107.3795607, 46324004.0785894, 138359129.53716838, 46323970.77633089, 138359085.22195303, 46324037.380847916, 138359108.4874411, 46324002.413476475, 138359106.27168033, 46324005.74370233, 0, 0, 0, 0, 0 },
-  { 138359090.96716955, 46323993.1586296, 138359113.4774711, 46323960.093749076, 138359068.456868, 46324026.22351013, 138359092.09268463, 46323991.50538558, 138359089.84165448, 46323994.81187363, 0, 0, 0, 0, 0 },
-  { 138359074.67732403, 46323982.06863535, 138359097.54459068, 46323949.249614716, 138359051.81005737, 46324014.88765599, 138359075.82068735, 46323980.42768432, 138359073.5339607, 46323983.70958638, 0, 0, 0, 0, 0 },
-  { 138359058.51298538, 46323970.80582997, 138359081.74126205, 46323938.241322264, 138359035.2847087, 46324003.37033768, 138359059.67439923, 46323969.177604586, 138359057.35157153, 46323972.43405536, 1, 3, 138359236.209302, 46323721.687346004, 38 },
-  { 138359042.47711468, 46323959.36743683, 138359066.0702061, 46323927.0662598, 138359018.88402325, 46323991.668613866, 138359043.65676925, 46323957.75237798, 138359041.2974601, 46323960.98249569, 1, 4, 138358880.8644385, 46324180.63049949, 28 },
-  { 138359026.5726732, 46323947.7506793, 138359050.53412896, 46323915.72180735, 138359002.61121744, 46323979.779551245, 138359027.770746, 46323946.1492357, 138359025.3746004, 46323949.352122895, 0, 0, 0, 0, 0 },
-  { 138359010.80262205, 46323935.952780716, 138359035.13572225, 46323904.20533619, 138358986.46952185, 46323967.70022524, 138359012.01927707, 46323934.36540849, 138359009.58596703, 46323937.540152945, 1, 3, 138358872.71227834, 46324116.11952842, 36 },
-  { 138358995.16992238, 46323923.97096444, 138359019.8776631, 46323892.51420764, 138358970.46218166, 46323955.42772124, 138358996.4053094, 46323922.3981266, 138358993.93453535, 46323925.543802276, 1, 0, 138359186.65491298, 46323680.181099236, 29 },
-  { 138358979.6775355, 46323911.80245385, 138359004.7567009, 46323880.64101193, 138358954.5983701, 46323942.963895775, 138358980.9314938, 46323910.244381756, 138358978.42357722, 46323913.36052595, 0, 0, 0, 0, 0 },
-  { 138358964.3260611, 46323899.447372, 138358989.74455988, 46323868.562101714, 138358938.90756232, 46323930.33264228, 138358965.59698603, 46323897.903108485, 138358963.05513617, 46323900.99163551, 1, 4, 138359156.8711893, 46323665.49144963, 50 },
-  { 138358949.10450944, 46323886.920073755, 138358974.82222608, 46323856.28350978, 138358923.3867928, 46323917.55663773, 138358950.39039528, 46323885.38824556, 138358947.8186236, 46323888.45190195, 1, 5, 138358745.93454814, 46324128.94892911, 38 },
-  { 138358933.99834087, 46323874.239273034, 138358959.9760626, 46323843.82286342, 138358908.02061915, 46323904.655682646, 138358935.29722697, 46323872.71845255, 138358932.69945478, 46323875.76009352, 1, 2, 138359096.35910168, 46323684.13671296, 46 },
-  { 138358918.993015, 46323861.42368483, 138358945.1923654, 46323831.19796668, 138358892.79366457, 46323891.649402976, 138358920.3029825, 46323859.91239892, 138358917.68304747, 46323862.93497074, 0, 0, 0, 0, 0 },
-  { 138358904.0739913, 46323848.49202419, 138358930.45734447, 46323818.426783875, 138358877.69063812, 46323878.55726451, 138358905.39315894, 46323846.98876218, 138358902.75482365, 46323849.995286204, 1, 5, 138359009.607404, 46323728.23106291, 36 },
-  { 138358889.22672924, 46323835.46300615, 138358915.75710964, 46323805.52742673, 138358862.69634885, 46323865.39858558, 138358890.55324826, 46323833.96622718, 138358887.90021023, 46323836.959785126, 0, 0, 0, 0, 0 },
-  { 138358874.43668842, 46323822.35534575, 138358901.07765904, 46323792.518142715, 138358847.7957178, 46323852.19254878, 138358875.76873696, 46323820.8634856, 138358873.1046399, 46323823.8472059, 1, 2, 138359116.869521, 46323550.836798154, 25 },
-  { 138358859.68932825, 46323809.187758006, 138358886.4048707, 46323779.417306334, 138358832.97378582, 46323838.95820968, 138358861.0251054, 46323807.699235424, 138358858.35355112, 46323810.67628059, 0, 0, 0, 0, 0 },
-  { 138358844.97010836, 46323795.97895796, 138358871.7244959, 46323766.24341109, 138358818.21572083, 46323825.71450483, 138358846.30782774, 46323794.492180616, 138358843.63238898, 46323797.4657353, 1, 2, 138359013.5227498, 46323608.645012654, 35 },
-  { 138358830.26448816, 46323782.74766064, 138358857.02215555, 46323753.015065126, 138358803.50682077, 46323812.48025615, 138358831.60237154, 46323781.26103086, 138358828.92660478, 46323784.23429041, 1, 4, 138358654.33282506, 46323978.23947612, 37 },
-  { 138358815.55792716, 46323769.51258106, 138358842.28333804, 46323739.750988126, 138358788.83251628, 46323799.27417399, 138358816.8941977, 46323768.02450141, 138358814.22165662, 46323771.0006607, 1, 3, 138359028.69307885, 46323532.16387742, 50 },
-  { 138358800.83588493, 46323756.29243426, 138358827.4933991, 46323726.47001087, 138358774.17837074, 46323786.11485765, 138358802.16876063, 46323754.80131309, 138358799.50300923, 46323757.78355543, 0, 0, 0, 0, 0 },
-  { 138358786.08382094, 46323743.10593529, 138358812.63756424, 46323713.191077515, 138358759.53007764, 46323773.020793065, 138358787.4115081, 46323741.6101924, 138358784.75613376, 46323744.60167818, 0, 0, 0, 0, 0 },
-  { 138358771.28719476, 46323729.97179919, 138358797.7009323, 46323699.933249466, 138358744.87345722, 46323760.01034891, 138358772.60788164, 46323728.4698717, 138358769.96650788, 46323731.473726675, 0, 0, 0, 0, 0 },
-  { 138358756.43146583, 46323716.90874094, 138358782.6684818, 46323686.71571205, 138358730.19444987, 46323747.10176983, 138358757.74331662, 46323715.39908949, 138358755.11961505, 46323718.41839238, 1, 1, 138358881.71321702, 46323572.73702798, 31 },
-  { 138358741.5020937, 46323703.93547561, 138358767.5250796, 46323673.557783075, 138358715.4791078, 46323734.313168146, 138358742.803243, 46323702.41659098, 138358740.2009444, 46323705.45436024, 0, 0, 0, 0, 0 },
-  { 138358726.48453784, 46323691.070718214, 138358752.25549194, 46323660.47892317, 138358700.71358374, 46323721.662513256, 138358727.77308553, 46323689.541128464, 138358725.19599015, 46323692.600307964, 0, 0, 0, 0, 0 },
-  { 138358711.36425784, 46323678.3331838, 138358736.84439805, 46323647.498747624, 138358685.88411763, 46323709.16761998, 138358712.63826486, 46323676.791462, 138358710.09025082, 46323679.87490561, 0, 0, 0, 0, 0 },
-  { 138358696.12671313, 46323665.74158739, 138358721.27640745, 46323634.63703988, 138358670.9770188, 46323696.84613491, 138358697.38419783, 46323664.18636002, 138358694.86922842, 46323667.29681477, 0, 0, 0, 0, 0 },
-  { 138358680.75736326, 46323653.31464401, 138358705.53608003, 46323621.91376511, 138358655.9786465, 46323684.71552291, 138358681.9962991, 46323651.744600065, 138358679.51842743, 46323654.88468795, 0, 0, 0, 0, 0 },
-  { 138358665.24166772, 46323641.07106871, 138358689.60795054, 46323609.349084824, 138358640.8753849, 46323672.7930526, 138358666.45998186, 46323639.48496952, 138358664.02335358, 46323642.657167904, 1, 2, 138358734.68557373, 46323550.66341463, 25 },
-  { 138358649.56508607, 46323629.029576495, 138358673.47655597, 46323596.96336987, 138358625.65361616, 46323661.09578312, 138358650.76065958, 46323627.42626616, 138358648.36951256, 46323630.63288683, 0, 0, 0, 0, 0 },
-  { 138358633.71307778, 46323617.208882414, 138358657.12660623, 46323584.77731314, 138358610.29954934, 46323649.640451685, 138358634.8837542, 46323615.58730395, 138358632.54240137, 46323618.830460876, 0, 0, 0, 0, 0 },
-  { 138358617.67130086, 46323605.62774067, 138358640.54737717, 46323572.814860076, 138358594.79522455, 46323638.44062127, 138358618.81510466, 46323603.987096645, 138358616.52749705, 46323607.2683847, 0, 0, 0, 0, 0 },
-  { 138358601.43195653, 46323594.306196414, 138358623.73515424, 46323561.10126648, 138358579.12875882, 46323627.51112635, 138358602.54711643, 46323592.645949915, 138358600.31679663, 46323595.96644291, 1, 3, 138358822.7911938, 46323264.74726684, 41 },
-  { 138358584.9951221, 46323583.26584883, 138358606.68874013, 46323549.6594962, 138358563.30150408, 46323616.87220146, 138358586.07980302, 46323581.5855312, 138358583.9104412, 46323584.94616646, 0, 0, 0, 0, 0 },
-  { 138358568.36134318, 46323572.52838945, 138358589.40704948, 46323538.51253657, 138358547.31563687, 46323606.54424232, 138358569.4136285, 46323570.827596806, 138358567.30905786, 46323574.22918209, 0, 0, 0, 0, 0 },
-  { 138358551.53116518, 46323562.11550978, 138358571.8889882, 46323527.683561794, 138358531.17334217, 46323596.54745776, 138358552.54905632, 46323560.39391238, 138358550.51327404, 46323563.837107174, 1, 4, 138358433.45579168, 46323761.82080809, 42 },
-  { 138358534.50513363, 46323552.04890137, 138358554.13347906, 46323517.19595235, 138358514.8767882, 46323586.901850395, 138358535.4865509, 46323550.30625392, 138358533.52371636, 46323553.791548826, 1, 2, 138358685.1526848, 46323284.55251761, 30 },
-  { 138358517.283794, 46323542.3502557, 138358536.13949135, 46323507.07331313, 138358498.42809662, 46323577.627198264, 138358518.22657886, 46323540.58640857, 138358516.3410091, 46323544.114102826, 0, 0, 0, 0, 0 },
-  { 138358499.86769173, 46323533.04126434, 138358517.9061477, 46323497.339526206, 138358481.82923576, 46323568.743002474, 138358500.76961452, 46323531.25617743, 138358498.96576893, 46323534.82635125, 0, 0, 0, 0, 0 },
-  { 138358482.2573813, 46323524.14357963, 138358499.45933425, 46323488.03135436, 138358465.05542833, 46323560.255804904, 138358483.11747894, 46323522.33796837, 138358481.39728364, 46323525.94919089, 1, 3, 138358345.50185513, 46323811.235770516, 29 },
-  { 138358464.45671746, 46323515.664285436, 138358480.8706462, 46323479.187128976, 138358448.0427887, 46323552.1414419, 138358465.2774139, 46323513.840427615, 138358463.63602102, 46323517.48814326, 0, 0, 0, 0, 0 },
-  { 138358446.47778144, 46323507.57415443, 138358462.16567802, 46323470.77891152, 138358430.78988487, 46323544.369397335, 138358447.26217628, 46323505.734392285, 138358445.6933866, 46323509.41391657, 1, 0, 138358326.46537256, 46323789.057762675, 37 },
-  { 138358428.33391485, 46323499.83839621, 138358443.36055157, 46323462.76819, 138358413.30727813, 46323536.90860242, 138358429.08524668, 46323497.984885894, 138358427.582583, 46323501.69190652, 1, 5, 138358494.8267824, 46323335.80273373, 50 },
-  { 138358410.0384591, 46323492.42222037, 138358424.47075456, 46323455.11660621, 138358395.60616362, 46323529.72783453, 138358410.76007387, 46323490.55693966, 138358409.3168443, 46323494.28750108, 1, 1, 138358296.7449397, 46323785.27129152, 40 },
-  { 138358391.6047557, 46323485.290836535, 138358405.5112316, 46323447.78603781, 138358377.6982798, 46323522.79563526, 138358392.3000795, 46323483.4155966, 138358390.9094319, 46323487.166076474, 1, 0, 138358436.45314053, 46323364.33786064, 35 },
-  { 138358373.04614618, 46323478.409454286, 138358386.49647355, 46323440.73866064, 138358359.59581882, 46323516.08024793, 138358373.71866256, 46323476.5259146, 138358372.3736298, 46323480.29299397, 0, 0, 0, 0, 0 },
-  { 138358354.37597212, 46323471.743283264, 138358367.4406011, 46323433.936994515, 138358341.31134313, 46323509.54957201, 138358355.02920356, 46323469.85296883, 138358353.72274068, 46323473.6335977, 0, 0, 0, 0, 0 },
-  { 138358335.60757497, 46323465.25753304, 138358348.3574815, 46323427.343948625, 138358322.85766843, 46323503.17111746, 138358336.2450703, 46323463.36185382, 138358334.97007963, 46323467.153212264, 0, 0, 0, 0, 0 },
-  { 138358316.75462985, 46323458.91750237, 138358329.26145014, 46323420.92303638, 138358304.24780956, 46323496.911968365, 138358317.37997088, 46323457.017779075, 138358316.12928882, 46323460.81722567, 1, 3, 138358392.4208927, 46323229.05098313, 26 },
-  { 138358297.8345418, 46323452.68948639, 138358310.170126, 46323414.639080845, 138358285.4989576, 46323490.73989194, 138358298.451321, 46323450.786966115, 138358297.2177626, 46323454.59200667, 1, 1, 138358196.6827513, 46323764.70281188, 30 },
-  { 138358278.8670542, 46323446.540405005, 138358291.10314563, 46323408.45788846, 138358266.63096276, 46323484.62292155, 138358279.47885877, 46323444.63627918, 138358278.25524962, 46323448.44453083, 1, 5, 138358353.8131142, 46323213.28499116, 40 },
-  { 138358259.87194654, 46323440.4371877, 138358272.08021247, 46323402.345741905, 138358247.6636806, 46323478.5286335, 138358260.48235983, 46323438.53261541, 138358259.26153326, 46323442.341759995, 0, 0, 0, 0, 0 },
-  { 138358240.86899817, 46323434.34676392, 138358253.12108186, 46323396.26938946, 138358228.61691448, 46323472.424138375, 138358241.48160234, 46323432.4428952, 138358240.256394, 46323436.250632636, 0, 0, 0, 0, 0 },
-  { 138358221.8779885, 46323428.23606319, 138358234.2455661, 46323390.196044475, 138358209.51041088, 46323466.276081905, 138358222.49636737, 46323426.334062256, 138358221.2596096, 46323430.13806412, 1, 3, 138358148.90928057, 46323652.67217362, 37 },
-  { 138358202.91869688, 46323422.07201495, 138358215.47352666, 46323384.0933861, 138358190.3638671, 46323460.0506438, 138358203.54643837, 46323420.17308351, 138358202.2909554, 46323423.970946394, 0, 0, 0, 0, 0 },
-  { 138358184.0109027, 46323415.821548715, 138358196.82485524, 46323377.92956249, 138358171.19695017, 46323453.713534944, 138358184.65160033, 46323413.926949404, 138358183.37020507, 46323417.71614803, 0, 0, 0, 0, 0 },
-  { 138358165.17438543, 46323409.45159394, 138358178.31944144, 46323371.673194, 138358152.02932942, 46323447.22999389, 138358165.83163822, 46323407.56267395, 138358164.51713264, 46323411.34051394, 0, 0, 0, 0, 0 },
-  { 138358146.42892435, 46323402.92908012, 138358159.97712782, 46323365.29337656, 138358132.88072088, 46323440.564783685, 138358147.10633454, 46323401.047294945, 138358145.75151417, 46323404.8108653, 1, 0, 138358033.64013055, 46323716.24631231, 48 },
-  { 138358127.79429895, 46323396.22093672, 138358141.81765077, 46323358.759682015, 138358113.77094713, 46323433.68219143, 138358128.49546653, 46323394.347873986, 138358127.09313136, 46323398.09399946, 1, 3, 138358258.9126383, 46323045.958205216, 27 },
-  { 138358109.29028857, 46323389.29409326, 138358123.8605671, 46323352.042153925, 138358094.72001004, 46323426.54603259, 138358110.0188025, 46323387.43149629, 138358108.56177464, 46323391.156690225, 0, 0, 0, 0, 0 },
-  { 138358090.93667266, 46323382.11547919, 138358106.12516522, 46323345.111294374, 138358075.7481801, 46323419.11966401, 138358091.69609728, 46323380.26526995, 138358090.17724803, 46323383.96568844, 0, 0, 0, 0, 0 },
-  { 138358072.7532305, 46323374.65202399, 138358088.63036183, 46323337.9380389, 138358056.8760992, 46323411.36600909, 138358073.54708707, 46323372.81632474, 138358071.95937395, 46323376.487723246, 0, 0, 0, 0, 0 },
-  { 138358054.7597416, 46323366.87065715, 138358071.39458477, 46323330.493714005, 138358038.12489843, 46323403.2476003, 138358055.59148377, 46323365.05181, 138358053.92799944, 46323368.68950431, 0, 0, 0, 0, 0 },
-  { 138358036.97598532, 46323358.73830817, 138358054.43564448, 46323322.74997253, 138358019.51632616, 46323394.72664381, 138358037.84896827, 46323356.93889139, 138358036.10300237, 46323360.53772495, 0, 0, 0, 0, 0 },
-  { 138358019.42174104, 46323350.2219065, 138358037.77059817, 46323314.67870121, 138358001.0728839, 46323385.76511179, 138358020.3391839, 46323348.44474623, 138358018.50429818, 46323351.99906676, 1, 1, 138358164.3777123, 46323069.43058471, 39 },
-  { 138358002.1167881, 46323341.28838161, 138358021.4088179, 46323306.24815349, 138357982.8247583, 46323376.32860972, 138358003.08138958, 46323339.5363702, 138358001.1521866, 46323343.04039301, 0, 0, 0, 0, 0 },
-  { 138357985.07894042, 46323331.90788717, 138358005.29410583, 46323297.39199101, 138357964.863775, 46323366.423783325, 138357986.0896987, 46323330.18209236, 138357984.06818214, 46323333.633681975, 1, 1, 138358112.93986163, 46323113.59484397, 28 },
-  { 138357968.30556858, 46323322.084109604, 138357989.3813896, 46323288.08690724, 138357947.22974756, 46323356.08131197, 138357969.35935962, 46323320.384249486, 138357967.25177753, 46323323.78396972, 1, 5, 138357803.91416475, 46323587.26228809, 37 },
-  { 138357951.78191352, 46323311.84063155, 138357973.65593946, 46323278.3514245, 138357929.90788758, 46323345.329838604, 138357952.87561482, 46323310.1661712, 138357950.68821222, 46323313.5150919, 0, 0, 0, 0, 0 },
-  { 138357935.49305695, 46323301.201297194, 138357958.10388213, 46323268.20507642, 138357912.88223177, 46323334.19751797, 138357936.62359822, 46323299.55148616, 138357934.3625157, 46323302.85110823, 1, 1, 138357815.09041294, 46323476.90617281, 28 },
-  { 138357919.42408034, 46323290.189950675, 138357942.7117032, 46323257.66785631, 138357896.13645747, 46323322.712045036, 138357920.5884615, 46323288.563845955, 138357918.2596992, 46323291.816055395, 0, 0, 0, 0, 0 },
-  { 138357903.56006524, 46323278.83043623, 138357927.46614903, 46323246.76021394, 138357879.65398145, 46323310.90065852, 138357904.75536942, 46323277.22692511, 138357902.36476105, 46323280.43394735, 0, 0, 0, 0, 0 },
-  { 138357887.88609317, 46323267.14659798, 138357912.3541367, 46323235.50303868, 138357863.41804963, 46323298.79015728, 138357889.10949534, 46323265.564420015, 138357886.662691, 46323268.72877595, 0, 0, 0, 0, 0 },
-  { 138357872.3872458, 46323255.16228014, 138357897.36267513, 46323223.91763372, 138357847.41181648, 46323286.406926565, 138357873.63601726, 46323253.60004782, 138357871.13847435, 46323256.724512465, 0, 0, 0, 0, 0 },
-  { 138357857.0486046, 46323242.901326895, 138357882.4787971, 46323212.02568424, 138357831.6184121, 46323273.77696955, 138357858.32011423, 46323241.357544765, 138357855.777095, 46323244.445109025, 0, 0, 0, 0, 0 },
-  { 138357841.85525116, 46323230.387582414, 138357867.6895021, 46323199.849221624, 138357816.02100024, 46323260.9259432, 138357843.14696372, 46323228.860664375, 138357840.5635386, 46323231.91450045, 0, 0, 0, 0, 0 },
-  { 138357826.79226705, 46323217.6448909, 138357852.98170882, 46323187.41058687, 138357800.60282528, 46323247.87919492, 138357828.10173914, 46323216.13317569, 138357825.48279497, 46323219.1566061, 1, 1, 138358006.8446792, 46323009.78405071, 30 },
-  { 138357811.84473377, 46323204.6970965, 138357838.3422174, 46323174.73239456, 138357785.34725016, 46323234.66179843, 138357813.16960797, 46323203.1988614, 138357810.51985958, 46323206.195331596, 0, 0, 0, 0, 0 },
-  { 138357796.9977329, 46323191.56804342, 138357823.75767905, 46323161.8374988, 138357770.23778677, 46323221.29858804, 138357798.33573022, 46323190.081516184, 138357795.6597356, 46323193.05457065, 0, 0, 0, 0, 0 },
-  { 138357782.23634604, 46323178.28157583, 138357809.2145726, 46323148.74896181, 138357755.25811946, 46323207.81418985, 138357783.58525735, 46323176.804945126, 138357780.88743472, 46323179.75820653, 0, 0, 0, 0, 0 },
-  { 138357767.54565468, 46323164.86153792, 138357794.69918707, 46323135.49002657, 138357740.3921223, 46323194.233049266, 138357768.9033313, 46323163.39296235, 138357766.18797806, 46323166.330113485, 0, 0, 0, 0, 0 },
-  { 138357752.9107404, 46323151.33177385, 138357780.19760835, 46323122.08409297, 138357725.62387246, 46323180.57945473, 138357754.2750838, 46323149.8693898, 138357751.546397, 46323152.79415789, 0, 0, 0, 0, 0 },
-  { 138357738.31668475, 46323137.716127835, 138357765.69571054, 46323108.55469874, 138357710.93765897, 46323166.87755693, 138357739.68563604, 46323136.25805638, 138357736.94773346, 46323139.17419929, 0, 0, 0, 0, 0 },
-  { 138357723.7485694, 46323124.03844404, 138357751.17914915, 46323094.925503716, 138357696.31798965, 46323153.15138437, 138357725.12009838, 46323122.58279703, 138357722.37704042, 46323125.49409106, 1, 3, 138357596.19637355, 46323259.41361655, 45 },
-  { 138357709.1914757, 46323110.32256665, 138357736.63335854, 46323081.22028039, 138357681.74959284, 46323139.424852915, 138357710.56356984, 46323108.86745234, 138357707.81938154, 46323111.77768096, 0, 0, 0, 0, 0 },
-  { 138357694.63048533, 46323096.59233982, 138357722.04354993, 46323067.46290645, 138357667.21742073, 46323125.72177319, 138357696.00113857, 46323095.135868154, 138357693.25983208, 46323098.04881149, 0, 0, 0, 0, 0 },
-  { 138357680.05067983, 46323082.87160777, 138357707.39471263, 46323053.67736399, 138357652.70664704, 46323112.065851554, 138357681.41788146, 46323081.41189558, 138357678.6834782, 46323084.331319965, 1, 5, 138357792.16121432, 46322963.17520826, 49 },
-  { 138357665.4371408, 46323069.184214674, 138357692.6716162, 46323039.887741335, 138357638.2026654, 46323098.48068801, 138357666.79886457, 46323067.71939101, 138357664.075417, 46323070.64903834, 0, 0, 0, 0, 0 },
-  { 138357650.77494967, 46323055.55400469, 138357677.85881537, 46323026.1182404, 138357623.69108397, 46323084.98976898, 138357652.12914294, 46323054.08221648, 138357649.4207564, 46323057.025792904, 1, 0, 138357883.01909795, 46322803.142325915, 47 },
-  { 138357636.04918814, 46323042.004822016, 138357662.94065657, 46323012.393187046, 138357609.1577197, 46323071.616456985, 138357637.39376155, 46323040.52424027, 138357634.70461473, 46323043.48540376, 0, 0, 0, 0, 0 },
-  { 138357621.24493763, 46323028.56051083, 138357647.90128773, 46322998.73704694, 138357594.58858752, 46323058.383974716, 138357622.57775512, 46323027.069337636, 138357619.91212013, 46323030.05168402, 0, 0, 0, 0, 0 },
-  { 138357606.34727985, 46323015.24491532, 138357632.72467038, 46322985.17444362, 138357579.9698893, 46323045.315387025, 138357607.66614938, 46323013.74139173, 138357605.02841032, 46323016.74843891, 0, 0, 0, 0, 0 },
-  { 138357591.3412962, 46323002.08187967, 138357617.3945965, 46322971.73018211, 138357565.2879959, 46323032.433577225, 138357592.64396122, 46323000.56429479, 138357590.03863117, 46323003.59946454, 1, 3, 138357784.13571826, 46322777.47931773, 39 },
-  { 138357576.21206835, 46322989.09524802, 138357601.8947089, 46322958.42927382, 138357550.5294278, 46323019.76122222, 138357577.49620038, 46322987.56194931, 138357574.92793632, 46322990.62854673, 0, 0, 0, 0, 0 },
-  { 138357560.9446778, 46322976.30886461, 138357586.20852846, 46322945.29696609, 138357535.68082714, 46323007.320763126, 138357562.20787033, 46322974.75826968, 138357559.68148527, 46322977.859459534, 0, 0, 0, 0, 0 },
-  { 138357545.5242061, 46322963.74657359, 138357570.3194863, 46322932.358772136, 138357520.7289259, 46322995.13437504, 138357546.7639701, 46322962.17718352, 138357544.2844421, 46322965.31596366, 0, 0, 0, 0, 0 },
-  { 138357529.93573487, 46322951.432219155, 138357554.2109641, 46322919.64050256, 138357505.66050562, 46322983.22393575, 138357531.14949632, 46322949.84263332, 138357528.72197342, 46322953.02180499, 0, 0, 0, 0, 0 },
-  { 138357514.16434562, 46322939.38964547, 138357537.86634246, 46322907.16829623, 138357490.4623488, 46322971.61099471, 138357515.34944546, 46322937.77857801, 138357512.97924578, 46322941.00071293, 1, 4, 138357377.28531396, 46323125.46793731, 29 },
-  { 138357498.19511986, 46322927.642696716, 138357521.26905766, 46322894.968649, 138357475.12118205, 46322960.31674443, 138357499.34881675, 46322926.00899433, 138357497.04142296, 46322929.2763991, 1, 5, 138357602.02783996, 46322780.609481975, 50 },
-  { 138357482.01313925, 46322916.215217106, 138357504.40266797, 46322883.06843742, 138357459.62361053, 46322949.36199679, 138357483.1326157, 46322914.55787812, 138357480.8936628, 46322917.87255609, 1, 0, 138357319.68905598, 46323156.529369816, 45 },
-  { 138357465.60348526, 46322905.13105077, 138357487.25092813, 46322871.494936004, 138357443.95604238, 46322938.76716554, 138357466.68585742, 46322903.449245036, 138357464.5211131, 46322906.81285651, 1, 2, 138357678.28961158, 46322574.65622318, 45 },
-  { 138357448.9512395, 46322894.414041944, 138357469.7978637, 46322860.27581908, 138357428.1046153, 46322928.55226481, 138357449.99357072, 46322892.7071308, 138357447.90890828, 46322896.12095309, 0, 0, 0, 0, 0 },
-  { 138357432.04148546, 46322884.088042, 138357452.01421008, 46322849.43129271, 138357412.06876084, 46322918.744791284, 138357433.0401217, 46322882.35520454, 138357431.0428492, 46322885.82087946, 1, 1, 138357504.44261223, 46322758.45732584, 26 },
-  { 138357414.8622235, 46322874.1876135, 138357433.8432046, 46322838.97792226, 138357395.88124242, 46322909.39730474, 138357415.81127256, 46322872.42712894, 138357413.91317445, 46322875.94809806, 1, 1, 138357290.0622729, 46323105.69133341, 35 },
-  { 138357397.41022256, 46322864.77951908, 138357415.2661392, 46322828.98613645, 138357379.5543059, 46322900.57290171, 138357398.3030184, 46322862.98984995, 138357396.51742673, 46322866.569188215, 1, 3, 138357496.0641621, 46322667.02108005, 38 },
-  { 138357379.6838928, 46322855.93654745, 138357396.27323437, 46322819.538831234, 138357363.0945512, 46322892.33426367, 138357380.51335987, 46322854.11666164, 138357378.8544257, 46322857.75643326, 0, 0, 0, 0, 0 },
-  { 138357361.68164405, 46322847.73148723, 138357376.8551851, 46322810.72116904, 138357346.508103, 46322884.74180542, 138357362.44032112, 46322845.88097132, 138357360.922967, 46322849.58200314, 0, 0, 0, 0, 0 },
-  { 138357343.4018864, 46322840.23712711, 138357357.00395575, 46322802.6208579, 138357329.79981706, 46322877.85339632, 138357344.08198988, 46322838.35631365, 138357342.72178292, 46322842.11794057, 0, 0, 0, 0, 0 },
-  { 138357324.84303504, 46322833.52623343, 138357336.81296936, 46322795.35922316, 138357312.87310073, 46322871.6932437, 138357325.44153175, 46322831.617882915, 138357324.24453834, 46322835.43458394, 0, 0, 0, 0, 0 },
-  { 138357306.0153947, 46322827.621510565, 138357316.61015466, 46322789.050134376, 138357295.42063472, 46322866.192886755, 138357306.5451327, 46322825.692941755, 138357305.48565668, 46322829.550079376, 1, 3, 138357207.21925795, 46323187.29959353, 35 },
-  { 138357286.96643925, 46322822.38915615, 138357296.51634943, 46322783.54589141, 138357277.41652906, 46322861.232420884, 138357287.44393477, 46322820.44699291, 138357286.48894373, 46322824.331319384, 0, 0, 0, 0, 0 },
-  { 138357267.7508864, 46322817.66486726, 138357276.59255958, 46322778.65429413, 138357258.90921324, 46322856.675440386, 138357268.19297007, 46322815.7143386, 138357267.30880275, 46322819.61539592, 1, 1, 138357200.77521214, 46323113.16995868, 37 },
-  { 138357248.4234538, 46322813.28434094, 138357256.89565095, 46322774.191862434, 138357239.95125666, 46322852.37681945, 138357248.84706366, 46322811.32971702, 138357247.99984396, 46322815.23896486, 0, 0, 0, 0, 0 },
-  { 138357229.0388589, 46322809.08327424, 138357237.48083687, 46322769.98425881, 138357220.5968809, 46322848.18228967, 138357229.4609578, 46322807.128323466, 138357228.61676, 46322811.03822501, 0, 0, 0, 0, 0 },
-  { 138357209.65181938, 46322804.89736421, 138357218.40297192, 46322765.86638511, 138357200.90066683, 46322843.9283433, 138357210.08937702, 46322802.94581525, 138357209.21426174, 46322806.84891316, 0, 0, 0, 0, 0 },
-  { 138357190.31705287, 46322800.562307924, 138357199.7166568, 46322761.68239735, 138357180.91744894, 46322839.4422185, 138357190.78703308, 46322798.618312396, 138357189.84707266, 46322802.50630345, 0, 0, 0, 0, 0 },
-  { 138357171.08927697, 46322795.91380243, 138357181.4751534, 46322757.28565762, 138357160.70340055, 46322834.54194724, 138357171.60857078, 46322793.98239519, 138357170.56998315, 46322797.84520967, 0, 0, 0, 0, 0 },
-  { 138357152.02320927, 46322790.78754478, 138357163.72809586, 46322752.53841891, 138357140.3183227, 46322829.03667065, 138357152.6084536, 46322788.87508848, 138357151.43796495, 46322792.700001076, 1, 0, 138357046.97185206, 46323134.073449455, 35 },
-  { 138357133.17356747, 46322785.01923205, 138357146.51804933, 46322747.310813844, 138357119.82908562, 46322822.727650255, 138357133.84079155, 46322783.13381114, 138357132.5063434, 46322786.90465296, 0, 0, 0, 0, 0 },
-  { 138357114.59506905, 46322778.44456127, 138357129.83571267, 46322741.461825, 138357099.35442543, 46322815.42729755, 138357115.35710123, 46322776.59542446, 138357113.83303687, 46322780.29369809, 0, 0, 0, 0, 0 },
-  { 138357096.3406425, 46322770.92188347, 138357113.4561637, 46322734.768613435, 138357079.22512132, 46322807.07515351, 138357097.19641858, 46322769.11421997, 138357095.48486644, 46322772.72954697, 0, 0, 0, 0, 0 },
-  { 138357078.4518814, 46322762.45306531, 138357097.32443854, 46322727.18513956, 138357059.57932428, 46322797.72099107, 138357079.39550927, 46322760.68966903, 138357077.50825354, 46322764.2164616, 0, 0, 0, 0, 0 },
-  { 138357060.96595415, 46322753.0960035, 138357081.48609382, 46322718.76054271, 138357040.4458145, 46322787.43146429, 138357061.99196115, 46322751.37923046, 138357059.93994716, 46322754.81277654, 0, 0, 0, 0, 0 },
-  { 138357043.92001894, 46322742.90872297, 138357065.98746496, 46322709.54665129, 138357021.85257292, 46322776.270794645, 138357045.02339125, 46322741.240619384, 138357042.81664664, 46322744.57682655, 1, 5, 138356845.31300485, 46323043.16736806, 41 },
-  { 138357027.35123402, 46322731.94924868, 138357050.87501806, 46322699.597562715, 138357003.82744998, 46322764.30093464, 138357028.52742323, 46322730.33166438, 138357026.1750448, 46322733.566832975, 0, 0, 0, 0, 0 },
-  { 138357011.2967577, 46322720.275605634, 138357036.18915448, 46322688.96476754, 138356986.40436092, 46322751.58644373, 138357012.54137754, 46322718.710063726, 138357010.05213785, 46322721.84114754, 0, 0, 0, 0, 0 },
-  { 138356995.78969786, 46322707.94735414, 138357021.87223485, 46322677.62077729, 138356969.70716086, 46322738.27393099, 138356997.0938247, 46322706.4310253, 138356994.485571, 46322709.46368298, 0, 0, 0, 0, 0 },
-  { 138356980.79404184, 46322695.0502588, 138357007.81737918, 46322665.55891704, 138356953.7707045, 46322724.54160056, 138356982.14520872, 46322693.575691715, 138356979.44287497, 46322696.524825886, 0, 0, 0, 0, 0 },
-  { 138356966.21584293, 46322681.69204709, 138356993.94310048, 46322652.8615218, 138356938.48858538, 46322710.522572376, 138356967.6022058, 46322680.250520825, 138356964.82948005, 46322683.13357335, 0, 0, 0, 0, 0 },
-  { 138356951.95936364, 46322667.981125444, 138356980.16745803, 46322639.62088195, 138356923.75126925, 46322696.341368936, 138356953.36976835, 46322666.56311327, 138356950.54895893, 46322669.399137616, 1, 1, 138356734.7570368, 46322886.3550003, 30 },
-  { 138356937.92886662, 46322654.02590026, 138356966.40534315, 46322625.935149364, 138356909.4523901, 46322682.116651155, 138356939.35269046, 46322652.621362716, 138356936.5050428, 46322655.4304378, 1, 1, 138357086.7184564, 46322507.25172684, 40 },
-  { 138356924.02861437, 46322639.934777945, 138356952.5672987, 46322611.907229066, 138356895.48993003, 46322667.962326825, 138356925.45554858, 46322638.5334005, 138356922.60168016, 46322641.33615539, 1, 4, 138356807.7334757, 46322754.14703963, 42 },
-  { 138356910.16286948, 46322625.816164926, 138356938.55890593, 46322597.64410227, 138356881.76683304, 46322653.98822758, 138356911.5826713, 46322624.407561794, 138356908.74306765, 46322627.22476806, 0, 0, 0, 0, 0 },
-  { 138356896.23589453, 46322611.77846761, 138356924.28063306, 46322583.25667523, 138356868.191156, 46322640.30025999, 138356897.63813147, 46322610.35237799, 138356894.8336576, 46322613.20455723, 0, 0, 0, 0, 0 },
-  { 138356882.15195212, 46322597.9300924, 138356909.6281227, 46322568.86017581, 138356854.67578155, 46322627.00000899, 138356883.52576065, 46322596.47659657, 138356880.77814358, 46322599.38358823, 1, 1, 138356950.84237856, 46322525.25530093, 48 },
-  { 138356867.81530476, 46322584.37944573, 138356894.49298367, 46322554.57505934, 138356841.13762584, 46322614.183832124, 138356869.1491887, 46322582.889226414, 138356866.48142081, 46322585.86966505, 1, 3, 138356775.77731255, 46322687.20457879, 44 },
-  { 138356853.1302151, 46322571.23493401, 138356878.79145688, 46322540.5510511, 138356827.46897334, 46322601.91881692, 138356854.4132772, 46322569.70073987, 138356851.847153, 46322572.76912815, 0, 0, 0, 0, 0 },
-  { 138356838.01247093, 46322558.59181157, 138356862.6945661, 46322527.11492833, 138356813.33037576, 46322590.06869481, 138356839.24657568, 46322557.0179674, 138356836.77836618, 46322560.16565573, 0, 0, 0, 0, 0 },
-  { 138356822.4885717, 46322546.41899398, 138356846.38826403, 46322514.34400829, 138356798.58887938, 46322578.49397967, 138356823.68355632, 46322544.8152447, 138356821.2935871, 46322548.02274326, 1, 1, 138357044.15821797, 46322248.92350171, 46 },
-  { 138356806.64675206, 46322534.61494771, 138356829.9744053, 46322502.121554606, 138356783.31909883, 46322567.10834081, 138356807.81313473, 46322532.99027805, 138356805.4803694, 46322536.23961736, 0, 0, 0, 0, 0 },
-  { 138356790.57591626, 46322523.077375025, 138356813.54928252, 46322490.33253661, 138356767.60255, 46322555.82221344, 138356791.72458458, 46322521.4401331, 138356789.42724794, 46322524.71461695, 1, 5, 138356885.9153862, 46322387.18629559, 26 },
-  { 138356774.36496848, 46322511.70397822, 138356797.20579925, 46322478.86655369, 138356751.5241377, 46322544.54140275, 138356775.50701, 46322510.06210699, 138356773.22292694, 46322513.34584945, 0, 0, 0, 0, 0 },
-  { 138356758.10281304, 46322500.39245956, 138356781.03427944, 46322467.6182647, 138356735.17134663, 46322533.166654415, 138356759.24938637, 46322498.75374981, 138356756.9562397, 46322502.0311693, 0, 0, 0, 0, 0 },
-  { 138356741.8783541, 46322489.040521346, 138356765.12277377, 46322456.48753447, 138356718.63393444, 46322521.59350822, 138356743.0405751, 46322487.412872, 138356740.71613312, 46322490.66817069, 1, 3, 138356643.67068103, 46322626.57689091, 41 },
-  { 138356725.780496, 46322477.545865856, 138356749.5568456, 46322445.3793429, 138356702.0041464, 46322509.71238881, 138356726.96931347, 46322475.93753971, 138356724.59167853, 46322479.154192, 0, 0, 0, 0, 0 },
-  { 138356709.8981429, 46322465.80619538, 138356734.41884696, 46322434.20342536, 138356685.37743884, 46322497.408965394, 138356711.1241781, 46322464.226056874, 138356708.6721077, 46322467.38633388, 0, 0, 0, 0, 0 },
-  { 138356694.32019907, 46322453.719212174, 138356719.77772808, 46322422.86610508, 138356668.86267006, 46322484.57231927, 138356695.5930755, 46322452.17655682, 138356693.04732263, 46322455.26186753, 0, 0, 0, 0, 0 },
-  { 138356679.13190347, 46322441.187039174, 138356705.56591558, 46322411.16632959, 138356652.69789135, 46322471.207748756, 138356680.45360407, 46322439.68600369, 138356677.81020287, 46322442.688074656, 0, 0, 0, 0, 0 },
-  { 138356664.3611275, 46322428.18098847, 138356691.69828245, 46322398.98030425, 138356637.02397254, 46322457.38167269, 138356665.72798523, 46322426.720954254, 138356662.99426976, 46322429.64102268, 1, 4, 138356891.25951365, 46322185.815309465, 49 },
-  { 138356649.9902536, 46322414.727235, 138356678.15646386, 46322386.325393505, 138356621.82404333, 46322443.12907649, 138356651.3985641, 46322413.30714292, 138356648.5819431, 46322416.14732707, 1, 5, 138356477.47221583, 46322588.688514136, 33 },
-  { 138356636.00041482, 46322400.85346063, 138356664.92449108, 46322373.22380605, 138356607.07633856, 46322428.48311521, 138356637.44661865, 46322399.471977904, 138356634.554211, 46322402.23494336, 0, 0, 0, 0, 0 },
-  { 138356622.37274414, 46322386.58734722, 138356651.98679453, 46322359.69853876, 138356592.75869375, 46322413.476155676, 138356623.85344666, 46322385.242906794, 138356620.89204162, 46322387.93178764, 1, 2, 138356381.01823357, 46322605.73113613, 37 },
-  { 138356609.0883746, 46322371.95657661, 138356639.3280447, 46322345.77333096, 138356578.84870452, 46322398.13982226, 138356610.60035813, 46322370.64741433, 138356607.5763911, 46322373.26573889, 0, 0, 0, 0, 0 },
-  { 138356596.12843928, 46322356.98883066, 138356626.93301642, 46322331.472600006, 138356565.32386214, 46322382.50506132, 138356597.66866812, 46322355.71301913, 138356594.58821043, 46322358.264642194, 0, 0, 0, 0, 0 },
-  { 138356583.4740711, 46322341.71179126, 138356614.78647667, 46322316.82136626, 138356552.1616655, 46322366.602216266, 138356585.03969136, 46322340.46727001, 138356581.9084508, 46322342.956312515, 0, 0, 0, 0, 0 },
-  { 138356571.10640305, 46322326.153140195, 138356602.8730943, 46322301.84517178, 138356539.33971182, 46322350.46110861, 138356572.6947376, 46322324.93774177, 138356569.5180685, 46322327.36853862, 1, 2, 138356388.4479285, 46322465.92395858, 31 },
-  { 138356559.00656828, 46322310.34055938, 138356591.1773699, 46322286.56999935, 138356526.83576667, 46322334.111119404, 138356560.61510837, 46322309.15203138, 138356557.3980282, 46322311.52908738, 0, 0, 0, 0, 0 },
-  { 138356547.15569973, 46322294.30173065, 138356579.6835828, 46322271.02219409, 138356514.62781665, 46322317.58126721, 138356548.78209388, 46322293.13775382, 138356545.52930558, 46322295.46570747, 1, 5, 138356243.01999295, 46322511.96539749, 41 },
-  { 138356535.5349304, 46322278.06433585, 138356568.37575212, 46322255.22838987, 138356502.6941087, 46322300.90028184, 138356537.1769715, 46322276.922538556, 138356533.89288932, 46322279.20613315, 0, 0, 0, 0, 0 },
-  { 138356524.12539333, 46322261.65605685, 138356557.2376296, 46322239.21547285, 138356491.01315707, 46322284.096640855, 138356525.78100514, 46322260.53402765, 138356522.46978152, 46322262.77808605, 0, 0, 0, 0, 0 },
-  { 138356512.9082081, 46322245.10452293, 138356546.25403523, 46322223.01253767, 138356479.56238097, 46322267.196508184, 138356514.57549945, 46322243.99992367, 138356511.24091676, 46322246.20912219, 0, 0, 0, 0, 0 },
-  { 138356501.8635283, 46322228.43359097, 138356535.4091687, 46322206.646209046, 138356468.31788793, 46322250.220972896, 138356503.54081032, 46322227.344221875, 138356500.1862463, 46322229.52296007, 0, 0, 0, 0, 0 },
-  { 138356490.9699124, 46322211.66088635, 138356524.6831016, 46322190.1336739, 138356457.25672323, 46322233.188098796, 138356492.65557188, 46322210.58452573, 138356489.28425294, 46322212.73724697, 0, 0, 0, 0, 0 },
-  { 138356480.2057691, 46322194.80345064, 138356514.05535167, 46322173.49134705, 138356446.3561865, 46322216.11555422, 138356481.89824823, 46322193.73784546, 138356478.51328996, 46322195.869055815, 1, 3, 138356360.03975093, 46322270.46141835, 28 },
-  { 138356469.5495071, 46322177.87832551, 138356503.5052481, 46322156.73576999, 138356435.59376612, 46322199.02088103, 138356471.24729416, 46322176.82119773, 138356467.85172006, 46322178.93545328, 0, 0, 0, 0, 0 },
-  { 138356458.9795354, 46322160.902552575, 138356493.0119206, 46322139.88359073, 138356424.9471502, 46322181.92151442, 138356460.68115467, 46322159.851604484, 138356457.27791613, 46322161.953500666, 1, 2, 138356344.97104496, 46322231.31607475, 33 },
-  { 138356448.4742626, 46322143.89317345, 138356482.55429235, 46322122.95155051, 138356414.39423284, 46322164.834796384, 138356450.17826408, 46322142.8460923, 138356446.7702611, 46322144.9402546, 0, 0, 0, 0, 0 },
-  { 138356438.01209766, 46322126.867229775, 138356472.11107397, 46322105.95647141, 138356403.91312134, 46322147.777988136, 138356439.71704647, 46322125.821691856, 138356436.30714884, 46322127.91276769, 1, 3, 138356147.31832469, 46322305.13144478, 32 },
-  { 138356427.5714494, 46322109.8417632, 138356461.6607594, 46322088.91525023, 138356393.4821394, 46322130.76827617, 138356429.2759149, 46322108.79543755, 138356425.8669839, 46322110.888088845, 0, 0, 0, 0, 0 },
-  { 138356417.13072643, 46322092.83381532, 138356451.18162403, 46322071.84485697, 138356383.07982883, 46322113.82277367, 138356418.8332713, 46322091.784367405, 138356415.42818156, 46322093.88326324, 0, 0, 0, 0, 0 },
-  { 138356406.6683378, 46322075.86042779, 138356440.6517231, 46322054.76233491, 138356372.6849525, 46322096.958520666, 138356408.36750707, 46322074.80552314, 138356404.9691685, 46322076.91533244, 1, 0, 138356671.7387432, 46321911.29530335, 38 },
-  { 138356396.16269216, 46322058.938642226, 138356430.04889247, 46322037.68480894, 138356362.27649185, 46322080.19247551, 138356397.85700217, 46322057.87595056, 138356394.46838215, 46322060.00133389, 1, 2, 138356073.39663434, 46322261.38140432, 35 },
-  { 138356385.59219837, 46322042.08550026, 138356419.35075063, 46322020.62949529, 138356351.83364612, 46322063.54150523, 138356387.28012598, 46322041.012700014, 138356383.90427077, 46322043.15830051, 0, 0, 0, 0, 0 },
-  { 138356374.9352652, 46322025.31804353, 138356408.5347032, 46322003.61371752, 138356341.33582723, 46322047.02236954, 138356376.61523712, 46322024.23282723, 138356373.2552933, 46322026.40325983, 1, 5, 138356270.7770075, 46322092.60145417, 39 },
-  { 138356364.17030153, 46322008.653313674, 138356397.57794943, 46321986.65492599, 138356330.76265362, 46322030.65170136, 138356365.84068394, 46322007.55339429, 138356362.49991912, 46322009.75323306, 0, 0, 0, 0, 0 },
-  { 138356353.27571607, 46321992.10835227, 138356386.45749244, 46321969.77072223, 138356320.0939397, 46322014.445982315, 138356354.9348049, 46321990.99147077, 138356351.61662725, 46321993.22523378, 0, 0, 0, 0, 0 },
-  { 138356342.22991768, 46321975.70020103, 138356375.15015322, 46321952.97888741, 138356309.30968213, 46321998.421514645, 138356343.87592945, 46321974.56413534, 138356340.5839059, 46321976.83626671, 0, 0, 0, 0, 0 },
-  { 138356331.01131517, 46321959.44590151, 138356363.63258913, 46321936.297413744, 138356298.3900412, 46321982.59438928, 138356332.64237887, 46321958.28847712, 138356329.38025147, 46321960.6033259, 0, 0, 0, 0, 0 },
-  { 138356319.5983173, 46321943.36249538, 138356351.88131908, 46321919.74454043, 138356287.3153155, 46321966.980450325, 138356321.21246737, 46321942.18159763, 138356317.98416722, 46321944.54339313, 1, 1, 138356455.1869248, 46321844.16708459, 40 },
-  { 138356307.969333, 46321927.46702425, 138356339.8727544, 46321903.3387897, 138356276.0659116, 46321951.5952588, 138356309.56450406, 46321926.260612525, 138356306.37416193, 46321928.67343598, 0, 0, 0, 0, 0 },
-  { 138356296.1027709, 46321911.77652976, 138356327.58323854, 46321887.09900646, 138356264.62230325, 46321936.45405306, 138356297.6767943, 46321910.5426536, 138356294.5287475, 46321913.01040592, 1, 3, 138356584.93606165, 46321685.36025351, 46 },
-  { 138356283.9770399, 46321896.30805354, 138356314.9890946, 46321871.04439457, 138356252.96498522, 46321921.57171251, 138356285.52764264, 46321895.04487059, 138356282.42643717, 46321897.571236484, 1, 4, 138356101.0059173, 46322045.36364147, 43 },
-  { 138356271.5705488, 46321881.07863721, 138356302.06668216, 46321855.194552325, 138356241.07441545, 46321906.9627221, 138356273.09535548, 46321879.78443297, 138356270.04574212, 46321882.372841455, 0, 0, 0, 0, 0 },
-  { 138356258.86170644, 46321866.105322406, 138356288.79246354, 46321839.56950173, 138356228.93094933, 46321892.64114308, 138356260.3582443, 46321864.77853137, 138356257.36516857, 46321867.43211344, 0, 0, 0, 0, 0 },
-  { 138356245.82892156, 46321851.40515076, 138356275.14307886, 46321824.18971064, 138356216.51476425, 46321878.62059089, 138356247.29462942, 46321850.04437876, 138356244.3632137, 46321852.76592277, 0, 0, 0, 0, 0 },
-  { 138356232.450603, 46321836.99516391, 138356261.0954286, 46321809.07610289, 138356203.80577743, 46321864.91422493, 138356233.8828443, 46321835.59921086, 138356231.01836172, 46321838.39111696, 0, 0, 0, 0, 0 },
-  { 138356218.70515957, 46321822.89240346, 138356246.62676182, 46321794.25005496, 138356190.78355733, 46321851.53475196, 138356220.10123968, 46321821.460286036, 138356217.30907947, 46321824.324520886, 1, 3, 138356490.24274155, 46321544.34556435, 48 },
-  { 138356204.57100004, 46321809.11391107, 138356231.71476763, 46321779.73337533, 138356177.42723244, 46321838.49444681, 138356205.9281884, 46321807.64488428, 138356203.21381167, 46321810.58293786, 0, 0, 0, 0, 0 },
-  { 138356190.02653322, 46321795.67672834, 138356216.33687735, 46321765.54757649, 138356163.7161891, 46321825.80588019, 138356191.34205043, 46321794.17027075, 138356188.711016, 46321797.18318593, 1, 4, 138356417.61101004, 46321535.05956486, 27 },
-  { 138356175.0500575, 46321782.598489955, 138356200.3372813, 46321751.60564703, 138356149.7628337, 46321813.59133288, 138356176.3144187, 46321781.04884781, 138356173.7856963, 46321784.1481321, 0, 0, 0, 0, 0 },
-  { 138356159.60174087, 46321769.99412704, 138356183.35958648, 46321737.813934825, 138356135.84389526, 46321802.17431926, 138356160.78963315, 46321768.385117434, 138356158.41384858, 46321771.60313665, 0, 0, 0, 0, 0 },
-  { 138356143.60363597, 46321758.18311908, 138356165.2070133, 46321724.51868551, 138356122.00025862, 46321791.84755265, 138356144.68380484, 46321756.499897406, 138356142.5234671, 46321759.86634076, 0, 0, 0, 0, 0 },
-  { 138356126.9729816, 46321747.510778464, 138356145.69678706, 46321712.1636554, 138356108.24917614, 46321782.85790153, 138356127.90917188, 46321745.743422315, 138356126.03679132, 46321749.278134614, 1, 0, 138356234.16676793, 46321545.148498945, 38 },
-  { 138356109.6270197, 46321738.32240928, 138356124.98569274, 46321701.38853374, 138356094.26834667, 46321775.25628482, 138356110.39495337, 46321736.4757155, 138356108.85908604, 46321740.169103056, 1, 1, 138355988.29350263, 46322030.10002603, 42 },
-  { 138356091.53881273, 46321730.800565094, 138356104.24817398, 46321692.87336989, 138356078.82945147, 46321768.7277603, 138356092.1742808, 46321728.90420533, 138356090.90334466, 46321732.69692486, 0, 0, 0, 0, 0 },
-  { 138356072.88025075, 46321724.54810157, 138356084.01290575, 46321686.12852332, 138356061.74759576, 46321762.96767981, 138356073.4368835, 46321722.627122656, 138356072.323618, 46321726.46908048, 0, 0, 0, 0, 0 },
-  { 138356053.86747319, 46321719.03886115, 138356064.52180782, 46321680.48389839, 138356043.21313855, 46321757.59382391, 138356054.4001899, 46321717.11111301, 138356053.33475646, 46321720.966609284, 0, 0, 0, 0, 0 },
-  { 138356034.71661955, 46321713.746686324, 138356045.9877563, 46321675.36750608, 138356023.4454828, 46321752.12586657, 138356035.2801764, 46321711.82772731, 138356034.1530627, 46321715.66564534, 0, 0, 0, 0, 0 },
-  { 138356015.6438294, 46321708.14541958, 138356028.61294594, 46321670.30625976, 138356002.67471287, 46321745.98457941, 138356016.29228523, 46321706.25346159, 138356014.99537358, 46321710.03737757, 0, 0, 0, 0, 0 },
-  { 138355996.8651709, 46321701.70916117, 138356012.2633452, 46321664.79173672, 138355981.46699658, 46321738.62658562, 138355997.63507962, 46321699.863289945, 138355996.09526217, 46321703.555032395, 1, 4, 138355870.21518722, 46322005.354977265, 46 },
-  { 138355978.55281067, 46321694.0711171, 138355996.24844778, 46321658.198224455, 138355960.85717356, 46321729.94400975, 138355979.43759254, 46321692.27747247, 138355977.6680288, 46321695.86476173, 0, 0, 0, 0, 0 },
-  { 138355960.76031664, 46321685.294308364, 138355980.49913022, 46321650.503803365, 138355941.02150306, 46321720.084813364, 138355961.74725732, 46321683.55478311, 138355959.77337596, 46321687.033833615, 1, 4, 138355838.3796724, 46321900.995439366, 41 },
-  { 138355943.52142817, 46321675.51361659, 138355965.07310256, 46321641.816059835, 138355921.96975377, 46321709.21117335, 138355944.5990119, 46321673.82873876, 138355942.44384444, 46321677.19849443, 1, 0, 138356135.87012205, 46321374.76292256, 28 },
-  { 138355926.86988494, 46321664.86392349, 138355950.03189224, 46321632.2522474, 138355903.70787764, 46321697.47559958, 138355928.0279853, 46321663.23333968, 138355925.71178457, 46321666.4945073, 0, 0, 0, 0, 0 },
-  { 138355910.83626068, 46321653.476256035, 138355935.45336795, 46321621.94852175, 138355886.2191534, 46321685.00399032, 138355912.06711605, 46321651.89986932, 138355909.6054053, 46321655.05264275, 0, 0, 0, 0, 0 },
-  { 138355895.40942034, 46321641.430855624, 138355921.3477011, 46321610.98080487, 138355869.47113958, 46321671.88090638, 138355896.70633438, 46321639.90835309, 138355894.1125063, 46321642.95335816, 0, 0, 0, 0, 0 },
-  { 138355880.54879057, 46321628.77211852, 138355907.67507672, 46321599.375441834, 138355853.42250443, 46321658.16879521, 138355881.90510488, 46321627.30228469, 138355879.19247627, 46321630.24195236, 1, 0, 138356065.68569347, 46321428.13980014, 34 },
-  { 138355866.21317986, 46321615.54368857, 138355894.3975821, 46321587.15989973, 138355838.0287776, 46321643.92747742, 138355867.62239996, 46321614.12449913, 138355864.80395976, 46321616.96287802, 0, 0, 0, 0, 0 },
-  { 138355852.3613968, 46321601.789209634, 138355881.4794662, 46321574.364074565, 138355823.24332738, 46321629.2143447, 138355853.81730026, 46321600.41795288, 138355850.90549332, 46321603.16046639, 1, 2, 138356059.82764137, 46321406.38512227, 27 },
-  { 138355838.95224994, 46321587.55232556, 138355868.88638708, 46321561.02031783, 138355809.0181128, 46321614.08433329, 138355840.4489568, 46321586.225725174, 138355837.4555431, 46321588.87892595, 0, 0, 0, 0, 0 },
-  { 138355825.94454792, 46321572.8766802, 138355856.58474666, 46321547.16329415, 138355795.30434918, 46321598.590066254, 138355827.47655785, 46321571.5910109, 138355824.412538, 46321574.16234951, 1, 2, 138355984.50757632, 46321439.80990739, 33 },
-  { 138355813.2970992, 46321557.8059174, 138355844.5411413, 46321532.82973208, 138355782.0530571, 46321582.78210271, 138355814.8593013, 46321556.557108134, 138355811.7348971, 46321559.05472666, 0, 0, 0, 0, 0 },
-  { 138355800.96871248, 46321542.383681014, 138355832.7219332, 46321518.05811884, 138355769.21549177, 46321566.709243186, 138355802.5563735, 46321541.16740291, 138355799.38105145, 46321543.59995912, 1, 2, 138355921.63095114, 46321449.94654476, 45 },
-  { 138355788.91819626, 46321526.65361491, 138355821.0929339, 46321502.888382785, 138355756.74345863, 46321550.41884703, 138355790.52693313, 46321525.4653533, 138355787.3094594, 46321527.841876514, 0, 0, 0, 0, 0 },
-  { 138355777.1043591, 46321510.659362905, 138355809.61918303, 46321487.36158995, 138355744.58953515, 46321533.957135856, 138355778.73010027, 46321509.494474255, 138355775.4786179, 46321511.824251555, 0, 0, 0, 0, 0 },
-  { 138355765.48600957, 46321494.4445689, 138355798.26480153, 46321471.51967421, 138355732.7072176, 46321517.36946359, 138355767.12494916, 46321493.29832417, 138355763.84706998, 46321495.59081364, 0, 0, 0, 0, 0 },
-  { 138355754.0219563, 46321478.0528767, 138355786.9929006, 46321455.40520947, 138355721.05101198, 46321500.70054394, 138355755.6705035, 46321476.92049334, 138355752.3734091, 46321479.185260065, 1, 1, 138355892.4999224, 46321382.93267431, 47 },
-  { 138355742.67100784, 46321461.52793021, 138355775.76552963, 46321439.06122977, 138355709.57648605, 46321483.99463064, 138355744.32573393, 46321460.40459519, 138355741.01628175, 46321462.65126523, 0, 0, 0, 0, 0 },
-  { 138355731.3919727, 46321444.91337323, 138355764.54364982, 46321422.5310967, 138355698.24029556, 46321467.29564977, 138355733.04955655, 46321443.79425941, 138355729.73438883, 46321446.03248706, 0, 0, 0, 0, 0 },
-  { 138355720.14365953, 46321428.252849646, 138355753.28712353, 46321405.85841296, 138355687.00019553, 46321450.64728633, 138355721.80083272, 46321427.13312781, 138355718.48648635, 46321429.37257148, 0, 0, 0, 0, 0 },
-  { 138355708.88487688, 46321411.5900033, 138355741.9547133, 46321389.08698308, 138355675.81504044, 46321434.093023516, 138355710.5383687, 46321410.46485229, 138355707.23138505, 46321412.715154305, 0, 0, 0, 0, 0 },
-  { 138355697.5744333, 46321394.96847803, 138355730.50408798, 46321372.2608176, 138355664.6447786, 46321417.67613846, 138355699.22091603, 46321393.83309501, 138355695.92795056, 46321396.103861056, 0, 0, 0, 0, 0 },
-  { 138355686.1711374, 46321378.43191771, 138355718.89183572, 46321355.42418202, 138355653.45043907, 46321401.439653404, 138355687.8071723, 46321377.281530924, 138355684.5351025, 46321379.5823045, 0, 0, 0, 0, 0 },
-  { 138355674.63379768, 46321362.02396617, 138355707.0734878, 46321338.621690534, 138355642.19410756, 46321385.42624181, 138355676.2557822, 46321360.85385239, 138355673.01181316, 46321363.19407995, 0, 0, 0, 0, 0 },
-  { 138355662.92122278, 46321345.7882673, 138355695.00355977, 46321321.89844409, 138355630.83888578, 46321369.67809051, 138355664.52533963, 46321344.59377614, 138355661.31710592, 46321346.98275846, 0, 0, 0, 0, 0 },
-  { 138355650.99222127, 46321329.76846494, 138355682.63561964, 46321305.30021326, 138355619.3488229, 46321354.23671661, 138355652.5743912, 46321328.54505236, 138355649.41005135, 46321330.99187752, 0, 0, 0, 0, 0 },
-  { 138355638.8056017, 46321314.008202896, 138355669.92239645, 46321288.873663254, 138355607.68880692, 46321339.14274254, 138355640.36144143, 46321312.751475915, 138355637.24976194, 46321315.264929876, 1, 3, 138355732.9339059, 46321237.97622049, 36 },
-  { 138355626.32017258, 46321298.55112507, 138355656.83715546, 46321272.69162478, 138355595.8031897, 46321324.41062536, 138355627.8460217, 46321297.258150056, 138355624.79432344, 46321299.84410009, 1, 0, 138355370.74044088, 46321515.12444001, 38 },
-  { 138355613.50602162, 46321283.42905306, 138355643.44252563, 46321256.89971594, 138355583.5695176, 46321309.958390184, 138355615.0028468, 46321282.1025862, 138355612.00919643, 46321284.75551992, 1, 2, 138355892.66392142, 46321036.042984374, 39 },
-  { 138355600.38346338, 46321268.62116264, 138355629.79060486, 46321241.50622153, 138355570.9763219, 46321295.73610374, 138355601.85382044, 46321267.26541559, 138355598.91310632, 46321269.97690969, 0, 0, 0, 0, 0 },
-  { 138355586.98678836, 46321254.09198052, 138355615.92109692, 46321226.47304158, 138355558.0524798, 46321281.710919455, 138355588.43350378, 46321252.71103357, 138355585.54007295, 46321255.472927466, 0, 0, 0, 0, 0 },
-  { 138355573.35028777, 46321239.80603286, 138355601.87276986, 46321211.76199579, 138355544.82780567, 46321267.850069925, 138355574.77641186, 46321238.403831005, 138355571.92416367, 46321241.20823471, 1, 4, 138355374.40597513, 46321435.4131914, 41 },
-  { 138355559.50825256, 46321225.72784574, 138355587.68353298, 46321197.33500205, 138355531.33297214, 46321254.12068944, 138355560.9170166, 46321224.308203556, 138355558.09948853, 46321227.14748793, 1, 2, 138355656.00858802, 46321128.48235609, 40 },
-  { 138355545.49497387, 46321211.82194533, 138355573.39052024, 46321183.15421971, 138355517.5994275, 46321240.489670955, 138355546.8897512, 46321210.38855905, 138355544.10019654, 46321213.25533161, 0, 0, 0, 0, 0 },
-  { 138355531.3447429, 46321198.052857764, 138355559.03017056, 46321169.182161644, 138355503.65931523, 46321226.923553884, 138355532.72901428, 46321196.60932296, 138355529.9604715, 46321199.49639257, 0, 0, 0, 0, 0 },
-  { 138355517.0918507, 46321184.38510918, 138355544.63829932, 46321155.381778866, 138355489.54540208, 46321213.38843949, 138355518.46917313, 46321182.93494266, 138355515.71452826, 46321185.835275695, 0, 0, 0, 0, 0 },
-  { 138355502.77058825, 46321170.78322568, 138355530.2501556, 46321141.716520004, 138355475.2910209, 46321199.84993135, 138355504.14456663, 46321169.32989039, 138355501.39660987, 46321172.23656096, 0, 0, 0, 0, 0 },
-  { 138355488.4152468, 46321157.2117334, 138355515.90046132, 46321128.15036759, 138355460.9300323, 46321186.273099214, 138355489.78950754, 46321155.75866511, 138355487.0409861, 46321158.664801694, 0, 0, 0, 0, 0 },
-  { 138355474.06011745, 46321143.635158494, 138355501.6234312, 46321114.6478555, 138355446.4968037, 46321172.62246149, 138355475.43828315, 46321142.18579335, 138355472.68195176, 46321145.08452364, 1, 5, 138355638.06183425, 46320971.16070565, 45 },
-  { 138355459.7394912, 46321130.01802707, 138355487.45277205, 46321101.17406645, 138355432.02621034, 46321158.86198769, 138355461.12515524, 46321128.57582904, 138355458.35382715, 46321131.4602251, 1, 2, 138355376.59964862, 46321216.54990892, 41 },
-  { 138355445.48765934, 46321116.32486529, 138355473.4216614, 46321087.694609806, 138355417.55365726, 46321144.95512077, 138355446.88435945, 46321114.893352516, 138355444.09095922, 46321117.75637806, 1, 1, 138355543.25666654, 46321016.118971094, 29 },
-  { 138355431.33891276, 46321102.52019923, 138355459.56270748, 46321074.175580494, 138355403.11511803, 46321130.86481797, 138355432.7501025, 46321101.1029683, 138355429.92772302, 46321103.937430166, 0, 0, 0, 0, 0 },
-  { 138355417.32754263, 46321088.56855509, 138355445.90789232, 46321060.58349457, 138355388.74719295, 46321116.55361561, 138355418.75656012, 46321087.16930206, 138355415.89852515, 46321089.96780811, 0, 0, 0, 0, 0 },
-  { 138355403.48784018, 46321074.434458956, 138355432.4885006, 46321046.885199524, 138355374.48717976, 46321101.98371839, 138355404.93787318, 46321073.05699599, 138355402.03780717, 46321075.811921924, 1, 5, 138355231.65892717, 46321237.66382108, 26 },
-  { 138355389.8540963, 46321060.082436986, 138355419.3153865, 46321033.026340075, 138355360.39280608, 46321087.1385339, 138355391.3271608, 46321058.72963214, 138355388.38103178, 46321061.43524183, 1, 3, 138355483.39369267, 46320974.179329306, 43 },
-  { 138355376.45082012, 46321045.48765599, 138355406.1207334, 46321018.660501, 138355346.78090683, 46321072.31481098, 138355377.93431577, 46321044.14629824, 138355374.96732447, 46321046.82901374, 0, 0, 0, 0, 0 },
-  { 138355363.15628347, 46321030.784354426, 138355392.56406733, 46321003.670110054, 138355333.7484996, 46321057.8985988, 138355364.62667266, 46321029.428642206, 138355361.68589428, 46321032.140066646, 0, 0, 0, 0, 0 },
-  { 138355349.73625287, 46321016.229150385, 138355378.3874041, 46320988.31658094, 138355321.08510163, 46321044.14171983, 138355351.16881043, 46321014.83352191, 138355348.30369532, 46321017.62477886, 0, 0, 0, 0, 0 },
-  { 138355335.9536046, 46321002.08180574, 138355363.30718133, 46320972.89650395, 138355308.6000279, 46321031.26710754, 138355337.32128343, 46321000.62254065, 138355334.5859258, 46321003.541070834, 1, 3, 138355531.53167814, 46320793.406897925, 46 },
-  { 138355321.57121503, 46320988.602082305, 138355347.04452127, 46320957.762000114, 138355296.0979088, 46321019.442164496, 138355322.84488034, 46320987.060078196, 138355320.29754972, 46320990.14408641, 0, 0, 0, 0, 0 },
-  { 138355306.3634394, 46320976.04075633, 138355329.69692528, 46320943.5515514, 138355283.02995354, 46321008.52996126, 138355307.5301137, 46320974.41629608, 138355305.19676512, 46320977.66521658, 0, 0, 0, 0, 0 },
-  { 138355290.29436928, 46320964.500079304, 138355311.54249868, 46320930.61030212, 138355269.04623988, 46320998.38985649, 138355291.35677576, 46320962.80559044, 138355289.2319628, 46320966.194568165, 0, 0, 0, 0, 0 },
-  { 138355273.48393375, 46320953.960313655, 138355292.72547403, 46320918.89233499, 138355254.24239346, 46320989.02829232, 138355274.44601077, 46320952.20691472, 138355272.52185673, 46320955.71371259, 1, 1, 138355364.40021157, 46320788.26411446, 28 },
-  { 138355256.05667883, 46320944.3981079, 138355273.37675261, 46320908.34238652, 138355238.73660505, 46320980.45382928, 138355256.92268252, 46320942.595321834, 138355255.19067514, 46320946.20089397, 0, 0, 0, 0, 0 },
-  { 138355238.13715038, 46320935.79011053, 138355253.62052566, 46320898.90833875, 138355222.6537751, 46320972.67188231, 138355238.91131914, 46320933.94602194, 138355237.36298162, 46320937.63419912, 1, 5, 138355341.10159603, 46320690.526328176, 27 },
-  { 138355219.84976768, 46320928.112865224, 138355233.597918, 46320890.54974018, 138355206.10161737, 46320965.67599027, 138355220.5371752, 46320926.23470897, 138355219.16236016, 46320929.99102148, 0, 0, 0, 0, 0 },
-  { 138355201.29222384, 46320921.320781186, 138355213.46336016, 46320883.21745534, 138355189.12108752, 46320959.42410703, 138355201.90078065, 46320919.415614896, 138355200.68366703, 46320923.22594748, 1, 5, 138355232.02434307, 46320825.10988342, 36 },
-  { 138355182.50263402, 46320915.3189256, 138355193.27953407, 46320876.79804262, 138355171.72573397, 46320953.839808576, 138355183.04147902, 46320913.392881446, 138355181.96378902, 46320917.24496975, 1, 2, 138355088.47418115, 46321251.41362959, 34 },
-  { 138355163.51105985, 46320910.00569598, 138355173.08909005, 46320871.16935556, 138355153.93302965, 46320948.842036396, 138355163.98996136, 46320908.06387895, 138355163.03215834, 46320911.947513, 1, 2, 138355238.21969542, 46320607.08224068, 48 },
-  { 138355144.3475633, 46320905.27948988, 138355152.92969283, 46320866.21099807, 138355135.76543376, 46320944.34798169, 138355144.77666977, 46320903.326065294, 138355143.91845682, 46320907.23291447, 0, 0, 0, 0, 0 },
-  { 138355125.04220605, 46320901.03870481, 138355132.8354279, 46320861.80522812, 138355117.2489842, 46320940.2721815, 138355125.43186715, 46320899.07703098, 138355124.65254495, 46320903.000378646, 1, 1, 138355199.27264425, 46320527.339839354, 30 },
-  { 138355105.62504998, 46320897.18173832, 138355112.83807364, 46320857.83745932, 138355098.41202632, 46320936.526017316, 138355105.98570117, 46320895.214524366, 138355105.26439878, 46320899.14895227, 0, 0, 0, 0, 0 },
-  { 138355086.1261569, 46320893.606987916, 138355092.96813792, 46320854.19649064, 138355079.28417587, 46320933.017485194, 138355086.46825594, 46320891.63646305, 138355085.78405786, 46320895.57751278, 1, 4, 138355104.42845613, 46320788.183907695, 45 },
-  { 138355066.5755886, 46320890.21285117, 138355073.25562155, 46320850.77458092, 138355059.89555568, 46320929.651121415, 138355066.90959027, 46320888.24093766, 138355066.24158695, 46320892.184764676, 1, 5, 138355006.2882913, 46321246.143240124, 39 },
-  { 138355047.00340688, 46320886.89772558, 138355053.73050117, 46320847.467455454, 138355040.2763126, 46320926.32799571, 138355047.33976158, 46320884.92621207, 138355046.66705218, 46320888.86923909, 0, 0, 0, 0, 0 },
-  { 138355027.43967357, 46320883.56000869, 138355034.42293835, 46320844.174300455, 138355020.4564088, 46320922.945716925, 138355027.7888368, 46320881.590723276, 138355027.09051034, 46320885.5292941, 1, 4, 138354965.81236196, 46321231.13888386, 32 },
-  { 138355007.9144505, 46320880.09809805, 138355015.36321917, 46320840.79776923, 138355000.46568182, 46320919.39842686, 138355008.28688893, 46320878.13308161, 138355007.54201207, 46320882.06311449, 0, 0, 0, 0, 0 },
-  { 138354988.4577995, 46320876.410391174, 138354996.5813501, 46320837.24397794, 138354980.3342489, 46320915.57680441, 138354988.86397702, 46320874.45207051, 138354988.05162197, 46320878.36871184, 0, 0, 0, 0, 0 },
-  { 138354969.0997719, 46320872.39532051, 138354978.04795945, 46320833.40904165, 138354960.15158433, 46320911.381599374, 138354969.54718128, 46320870.44600657, 138354968.6523625, 46320874.34463446, 1, 3, 138355016.07775652, 46320667.71735648, 48 },
-  { 138354949.86196917, 46320867.97983199, 138354959.61879805, 46320829.18802499, 138354940.1051403, 46320906.771639, 138354950.34981063, 46320866.040241644, 138354949.37412772, 46320869.91942234, 1, 0, 138354907.66368428, 46321035.754397266, 26 },
-  { 138354930.74227896, 46320863.17089011, 138354941.26234114, 46320824.57907372, 138354920.22221678, 46320901.762706496, 138354931.2682821, 46320861.24129929, 138354930.21627584, 46320865.10048093, 1, 4, 138355027.52685094, 46320508.12617936, 30 },
-  { 138354911.73445976, 46320857.98939158, 138354922.9719257, 46320819.60033899, 138354900.4969938, 46320896.37844417, 138354912.29633304, 46320856.06993895, 138354911.17258647, 46320859.90884421, 0, 0, 0, 0, 0 },
-  { 138354892.83227035, 46320852.45623315, 138354904.74115148, 46320814.270129, 138354880.92338923, 46320890.6423373, 138354893.4277144, 46320850.546927944, 138354892.2368263, 46320854.36553836, 0, 0, 0, 0, 0 },
-  { 138354874.0294694, 46320846.59231153, 138354886.56383944, 46320808.606925294, 138354861.49509937, 46320884.57769777, 138354874.6561879, 46320844.69304222, 138354873.4027509, 46320848.491580844, 1, 4, 138354822.01183373, 46321004.23166443, 43 },
-  { 138354855.31981555, 46320840.41852345, 138354868.4339917, 46320802.62939296, 138354842.2056394, 46320878.20765395, 138354855.97552437, 46320838.52906693, 138354854.66410673, 46320842.30797998, 0, 0, 0, 0, 0 },
-  { 138354836.69706747, 46320833.95576563, 138354850.34575298, 46320796.35638553, 138354823.04838195, 46320871.555145726, 138354837.37950173, 46320832.07579662, 138354836.0146332, 46320835.835734636, 1, 1, 138354723.07176062, 46321146.97060496, 50 },
-  { 138354818.1549839, 46320827.22493479, 138354832.2933744, 46320789.80694561, 138354804.01659343, 46320864.642923966, 138354818.86190343, 46320825.354035325, 138354817.4480644, 46320829.09583425, 1, 5, 138354896.9765109, 46320618.619645104, 46 },
-  { 138354799.68732345, 46320820.24692766, 138354814.2711806, 46320783.00030217, 138354785.1034663, 46320857.493553154, 138354800.4165163, 46320818.38459639, 138354798.9581306, 46320822.109258935, 1, 0, 138354706.71523407, 46321057.69416516, 32 },
-  { 138354781.28784484, 46320813.042640984, 138354796.27353984, 46320775.9558651, 138354766.30214983, 46320850.12941687, 138354782.03712958, 46320811.18830219, 138354780.5385601, 46320814.89697978, 0, 0, 0, 0, 0 },
-  { 138354762.95030668, 46320805.63297144, 138354778.29483727, 46320768.693218045, 138354747.6057761, 46320842.57272484, 138354763.7175332, 46320803.78598377, 138354762.18308017, 46320807.479959115, 0, 0, 0, 0, 0 },
-  { 138354744.6684678, 46320798.03881582, 138354760.32945225, 46320761.232110366, 138354729.00748333, 46320834.84552127, 138354745.45151702, 46320796.19848055, 138354743.88541856, 46320799.87915109, 1, 2, 138354865.25804803, 46320514.62718385, 31 },
-  { 138354726.4360867, 46320790.281070784, 138354742.3717376, 46320753.592448145, 138354710.50043583, 46320826.96969342, 138354727.23286927, 46320788.44663965, 138354725.63930416, 46320792.11550192, 1, 1, 138354642.37552837, 46320983.81355522, 43 },
-  { 138354708.2469221, 46320782.3806331, 138354724.41600344, 46320745.794285804, 138354692.07784078, 46320818.9669804, 138354709.05537617, 46320780.55131573, 138354707.43846804, 46320784.20995047, 1, 4, 138354802.4318209, 46320569.265160084, 44 },
-  { 138354690.09473273, 46320774.35839945, 138354706.45650223, 46320737.85781728, 138354673.73296323, 46320810.858981624, 138354690.9128212, 46320772.533370346, 138354689.27664426, 46320776.183428556, 0, 0, 0, 0, 0 },
-  { 138354671.97327724, 46320766.23526661, 138354688.48741767, 46320729.80336897, 138354655.4591368, 46320802.66716425, 138354672.79898426, 46320764.41367173, 138354671.14757022, 46320768.05686149, 0, 0, 0, 0, 0 },
-  { 138354653.87631434, 46320758.03213128, 138354670.50285494, 46320721.65139259, 138354637.24977374, 46320794.41286997, 138354654.70764136, 46320756.21309434, 138354653.04498732, 46320759.851168215, 1, 3, 138354581.96652627, 46320915.37882612, 36 },
-  { 138354635.79760262, 46320749.76989018, 138354652.49683386, 46320713.422460064, 138354619.0983714, 46320786.1173203, 138354636.6325642, 46320747.95251868, 138354634.96264106, 46320751.587261684, 0, 0, 0, 0, 0 },
-  { 138354617.7309008, 46320741.469440036, 138354634.46328366, 46320705.137259215, 138354600.99851793, 46320777.801620856, 138354618.56751993, 46320739.652830996, 138354616.89428166, 46320743.286049075, 0, 0, 0, 0, 0 },
-  { 138354599.6699676, 46320733.151677586, 138354616.3960397, 46320696.81659107, 138354582.9438955, 46320769.4867641, 138354600.50627118, 46320731.33492326, 138354598.833664, 46320734.96843191, 0, 0, 0, 0, 0 },
-  { 138354581.6085616, 46320724.83749954, 138354598.28884187, 46320688.48136868, 138354564.92828134, 46320761.19363039, 138354582.4425756, 46320723.019692995, 138354580.7745476, 46320726.65530608, 1, 5, 138354471.51871192, 46320964.78796317, 48 },
-  { 138354563.54044157, 46320716.54780262, 138354580.135335, 46320680.15261733, 138354546.94554815, 46320752.94298791, 138354564.37018624, 46320714.728043355, 138354562.7106969, 46320718.367561884, 1, 2, 138354609.17639846, 46320616.46104306, 40 },
-  { 138354545.45936614, 46320708.30348357, 138354561.92907077, 46320671.85147636, 138354528.9896615, 46320744.75549078, 138354546.28285137, 46320706.48088321, 138354544.63588092, 46320710.126083925, 0, 0, 0, 0, 0 },
-  { 138354527.359094, 46320700.1254391, 138354543.67209345, 46320663.603034355, 138354511.04609454, 46320736.647843845, 138354528.17474398, 46320698.299318865, 138354526.543444, 46320701.951559335, 0, 0, 0, 0, 0 },
-  { 138354509.23531607, 46320692.030321, 138354525.47102612, 46320655.47349238, 138354492.999606, 46320728.58714963, 138354510.04710156, 46320690.20247957, 138354508.42353058, 46320693.85816243, 1, 3, 138354439.42176285, 46320849.22468409, 48 },
-  { 138354491.1087106, 46320683.979887694, 138354507.42439702, 46320647.45868322, 138354474.79302415, 46320720.501092166, 138354491.92449492, 46320682.15382747, 138354490.29292625, 46320685.805947915, 0, 0, 0, 0, 0 },
-  { 138354473.01736215, 46320675.897657864, 138354489.57189608, 46320639.484097116, 138354456.46282822, 46320712.31121861, 138354473.84508884, 46320674.07697982, 138354472.18963546, 46320677.718335904, 1, 0, 138354415.4903567, 46320802.434781455, 30 },
-  { 138354454.9997092, 46320667.70637304, 138354471.95115793, 46320631.47588331, 138354438.04826045, 46320703.936862774, 138354455.84728163, 46320665.894848555, 138354454.15213674, 46320669.51789753, 0, 0, 0, 0, 0 },
-  { 138354437.09419024, 46320659.32877482, 138354454.59876242, 46320623.36226328, 138354419.58961806, 46320695.29528636, 138354437.96941885, 46320657.53044924, 138354436.21896163, 46320661.12710039, 1, 1, 138354281.3034977, 46320979.43072752, 47 },
-  { 138354419.33924362, 46320650.687604696, 138354437.5498836, 46320615.073385745, 138354401.12860364, 46320686.301823646, 138354420.24977562, 46320648.906893745, 138354418.42871162, 46320652.468315646, 1, 1, 138354536.34260553, 46320421.86624795, 50 },
-  { 138354401.77330792, 46320641.70560423, 138354420.83781838, 46320606.54107039, 138354382.70879745, 46320676.87013808, 138354402.72653344, 46320639.94737754, 138354400.8200824, 46320643.463830926, 1, 1, 138354259.7427049, 46320903.68138136, 34 },
-  { 138354384.43482146, 46320632.30551498, 138354404.49342602, 46320597.69840034, 138354364.3762169, 46320666.91262961, 138354385.43775168, 46320630.575159244, 138354383.43189123, 46320634.03587071, 0, 0, 0, 0, 0 },
-  { 138354367.36222276, 46320622.41007846, 138354388.50276035, 46320588.453081094, 138354346.22168517, 46320656.36707582, 138354368.41924965, 46320620.71222859, 138354366.30519587, 46320624.10792833, 0, 0, 0, 0, 0 },
-  { 138354350.58247143, 46320611.963543385, 138354372.14524502, 46320578.27308784, 138354329.01969784, 46320645.653998934, 138354351.6606101, 46320610.27902061, 138354349.50433275, 46320613.64806616, 0, 0, 0, 0, 0 },
-  { 138354333.91621923, 46320601.29670565, 138354354.6080842, 46320567.064458795, 138354313.22435427, 46320635.5289525, 138354334.9508125, 46320599.585093305, 138354332.88162598, 46320603.00831799, 1, 0, 138354243.38931006, 46320751.06278564, 40 },
-  { 138354317.00553903, 46320591.07495443, 138354335.44626018, 46320555.57932367, 138354298.56481788, 46320626.570585184, 138354317.92757508, 46320589.30017289, 138354316.08350298, 46320592.84973597, 0, 0, 0, 0, 0 },
-  { 138354299.48729292, 46320581.97385987, 138354314.64625025, 46320544.95756599, 138354284.32833558, 46320618.990153745, 138354300.24524078, 46320580.123045176, 138354298.72934505, 46320583.82467456, 0, 0, 0, 0, 0 },
-  { 138354281.1577331, 46320574.467516415, 138354293.02291206, 46320536.267810546, 138354269.29255417, 46320612.667222284, 138354281.75099206, 46320572.55753112, 138354280.56447417, 46320576.37750171, 0, 0, 0, 0, 0 },
-  { 138354262.17580715, 46320568.571556136, 138354270.8849823, 46320529.53118897, 138354253.466632, 46320607.6119233, 138354262.6112659, 46320566.61953778, 138354261.7403484, 46320570.523574494, 0, 0, 0, 0, 0 },
-  { 138354242.75065315, 46320564.23816789, 138354248.42756808, 46320524.64305914, 138354237.07373822, 46320603.83327664, 138354243.0344989, 46320562.25841245, 138354242.4668074, 46320566.21792333, 0, 0, 0, 0, 0 },
-  { 138354223.09140933, 46320561.419540584, 138354225.85845822, 46320521.51536235, 138354220.32436043, 46320601.323718816, 138354223.22976178, 46320559.42433167, 138354222.95305687, 46320563.414749496, 0, 0, 0, 0, 0 },
-  { 138354203.38524574, 46320560.05306919, 138354203.52046007, 46320520.05329773, 138354203.2500314, 46320600.05284065, 138354203.39200646, 46320558.05308062, 138354203.37848502, 46320562.05305776, 0, 0, 0, 0, 0 },
-  { 138354183.686178, 46320559.9864789, 138354181.56115344, 46320520.042965405, 138354185.81120256, 46320599.9299924, 138354183.57992676, 46320557.989303224, 138354183.79242924, 46320561.98365458, 0, 0, 0, 0, 0 },
-  { 138354163.99831682, 46320561.03388773, 138354160.00173616, 46320521.234046735, 138354167.99489748, 46320600.83372872, 138354163.79848778, 46320559.04389568, 138354164.19814587, 46320563.02387978, 1, 5, 138354151.0094297, 46320431.6844045, 47 },
-  { 138354144.3256851, 46320563.0093544, 138354138.84679094, 46320523.38635958, 138354149.8045793, 46320602.632349215, 138354144.0517404, 46320561.02820466, 138354144.59962982, 46320564.99050414, 0, 0, 0, 0, 0 },
-  { 138354124.67230564, 46320565.72693763, 138354118.0922894, 46320526.271857016, 138354131.2523219, 46320605.18201824, 138354124.34330484, 46320563.7541836, 138354125.00130644, 46320567.69969166, 0, 0, 0, 0, 0 },
-  { 138354105.0422012, 46320569.00069615, 138354097.73178172, 46320529.67439748, 138354112.35262066, 46320608.32699482, 138354104.6766802, 46320567.03438122, 138354105.40772218, 46320570.96701109, 0, 0, 0, 0, 0 },
-  { 138354085.43939456, 46320572.644688696, 138354077.76070464, 46320533.38863539, 138354093.1180845, 46320611.900742, 138354085.05546007, 46320570.68188603, 138354085.82332906, 46320574.60749136, 1, 5, 138354024.20184246, 46320259.577663586, 25 },
-  { 138354065.86790863, 46320576.472973995, 138354058.17815843, 46320537.21908576, 138354073.55765882, 46320615.72686223, 138354065.48342112, 46320574.51027958, 138354066.25239614, 46320578.43566841, 0, 0, 0, 0, 0 },
-  { 138354046.3317473, 46320580.30006495, 138354038.86125088, 46320541.00386051, 138354053.8022437, 46320619.59626939, 138354045.95822248, 46320578.33525473, 138354046.7052721, 46320582.26487517, 1, 1, 138353982.64576533, 46320245.29992211, 41 },
-  { 138354026.8321641, 46320584.0070786, 138354019.55029133, 46320544.67548407, 138354034.1140369, 46320623.33867314, 138354026.46807048, 46320582.040498875, 138354027.19625774, 46320585.97365833, 0, 0, 0, 0, 0 },
-  { 138354007.36478943, 46320587.61127893, 138354000.20800194, 46320548.25673164, 138354014.5215769, 46320626.96582622, 138354007.00695005, 46320585.643551566, 138354007.7226288, 46320589.57900629, 0, 0, 0, 0, 0 },
-  { 138353987.9245671, 46320591.14656391, 138353980.82861975, 46320551.78100116, 138353995.02051446, 46320630.51212666, 138353987.56976974, 46320589.17828577, 138353988.27936447, 46320593.11484205, 1, 4, 138354014.17957234, 46320736.79914611, 41 },
-  { 138353968.5064407, 46320594.64683148, 138353961.4066573, 46320555.28196039, 138353975.6062241, 46320634.011702575, 138353968.15145153, 46320592.67858793, 138353968.86142987, 46320596.61507504, 0, 0, 0, 0, 0 },
-  { 138353949.1053538, 46320598.1459796, 138353941.936901, 46320558.79355547, 138353956.2738066, 46320637.49840373, 138353948.74693117, 46320596.17835839, 138353949.46377644, 46320600.113600805, 0, 0, 0, 0, 0 },
-  { 138353929.7162501, 46320601.67790622, 138353922.414414, 46320562.35001294, 138353937.0180862, 46320641.0057995, 138353929.3511583, 46320599.71151156, 138353930.0813419, 46320603.644300885, 0, 0, 0, 0, 0 },
-  { 138353910.33407328, 46320605.276509315, 138353902.84638464, 46320565.98357714, 138353917.8217619, 46320644.56944149, 138353909.95968884, 46320603.31186271, 138353910.7084577, 46320607.24115592, 0, 0, 0, 0, 0 },
-  { 138353890.95345786, 46320608.969692945, 138353883.3649284, 46320569.69611123, 138353898.54198733, 46320648.24327466, 138353890.57403138, 46320607.00601386, 138353891.33288434, 46320610.93337203, 0, 0, 0, 0, 0 },
-  { 138353871.56545615, 46320612.71588608, 138353864.04893157, 46320573.42845987, 138353879.08198074, 46320652.00331229, 138353871.1896299, 46320610.75151477, 138353871.9412824, 46320614.68025739, 0, 0, 0, 0, 0 },
-  { 138353852.15881434, 46320616.42879157, 138353844.8885218, 46320577.09505482, 138353859.4291069, 46320655.762528315, 138353851.7952997, 46320614.46210473, 138353852.52232897, 46320618.395478405, 1, 4, 138353784.72685096, 46320251.60838326, 48 },
-  { 138353832.72224033, 46320620.02137114, 138353825.8729684, 46320580.61214031, 138353839.57151225, 46320659.43060197, 138353832.37977675, 46320618.0509096, 138353833.0647039, 46320621.99183268, 0, 0, 0, 0, 0 },
-  { 138353813.2444421, 46320623.40658657, 138353806.98686692, 46320583.899084084, 138353819.5020173, 46320662.91408906, 138353812.93156335, 46320621.43121145, 138353813.55732086, 46320625.381961696, 0, 0, 0, 0, 0 },
-  { 138353793.71589938, 46320626.4997035, 138353788.19983095, 46320586.88186674, 138353799.2319678, 46320666.117540255, 138353793.44009596, 46320624.51881166, 138353793.9917028, 46320628.480595335, 0, 0, 0, 0, 0 },
-  { 138353774.13480502, 46320629.226017326, 138353769.50561348, 46320589.494787976, 138353778.76399657, 46320668.957246676, 138353773.90334544, 46320627.23945586, 138353774.3662646, 46320631.212578796, 0, 0, 0, 0, 0 },
-  { 138353754.50145012, 46320631.5135519, 138353750.9057039, 46320591.675497115, 138353758.09719634, 46320671.35160668, 138353754.3216628, 46320629.52164916, 138353754.68123743, 46320633.50545464, 0, 0, 0, 0, 0 },
-  { 138353734.81612587, 46320633.29033117, 138353732.40062472, 46320593.363330856, 138353737.23162702, 46320673.217331484, 138353734.69535083, 46320631.29398116, 138353734.9369009, 46320635.28668118, 0, 0, 0, 0, 0 },
-  { 138353715.0791235, 46320634.4843791, 138353713.98585796, 46320594.49932226, 138353716.17238903, 46320674.46943594, 138353715.02446023, 46320632.48512626, 138353715.13378677, 46320636.48363194, 0, 0, 0, 0, 0 },
-  { 138353695.29141957, 46320635.02541158, 138353695.58454478, 46320595.02648563, 138353694.99829435, 46320675.02433754, 138353695.3060758, 46320633.02546529, 138353695.27676332, 46320637.02535788, 0, 0, 0, 0, 0 },
-  { 138353675.4689799, 46320634.880146265, 138353677.13977012, 46320594.91505575, 138353673.79818967, 46320674.84523678, 138353675.5525194, 46320632.88189174, 138353675.38544038, 46320636.87840079, 0, 0, 0, 0, 0 },
-  { 138353655.6423409, 46320634.051269, 138353658.68069085, 46320594.16683056, 138353652.60399094, 46320673.93570744, 138353655.7942584, 46320632.057047084, 138353655.4904234, 46320636.04549092, 0, 0, 0, 0, 0 },
-  { 138353635.84264058, 46320632.54295094, 138353640.2401549, 46320592.78541244, 138353631.44512627, 46320672.30048945, 138353636.0625163, 46320630.55507402, 138353635.62276486, 46320634.530827865, 1, 0, 138353612.75569043, 46320841.270028085, 30 },
-  { 138353616.10101706, 46320630.35936324, 138353621.85102457, 46320590.774802946, 138353610.35100955, 46320669.94392354, 138353616.38851744, 46320628.38013523, 138353615.81351668, 46320632.338591255, 1, 1, 138353640.53854895, 46320462.12498199, 26 },
-  { 138353596.4486083, 46320627.50467705, 138353603.54613543, 46320588.13939909, 138353589.3510812, 46320666.86995501, 138353596.80348468, 46320625.536413155, 138353596.09373194, 46320629.472940944, 0, 0, 0, 0, 0 },
-  { 138353576.91655248, 46320623.98306351, 138353585.35825604, 46320584.883988835, 138353568.47484893, 46320663.08213819, 138353577.33863765, 46320622.028109774, 138353576.49446732, 46320625.93801725, 1, 2, 138353621.868624, 46320415.780490845, 50 },
-  { 138353557.53598756, 46320619.79869379, 138353567.3200471, 46320581.013745956, 138353547.751928, 46320658.583641626, 138353558.02519053, 46320617.8594464, 138353557.04678458, 46320621.73794118, 1, 1, 138353487.82456326, 46320896.141447134, 34 },
-  { 138353538.33805165, 46320614.95573902, 138353549.4591217, 46320576.532805756, 138353527.2169816, 46320653.37867229, 138353538.89410514, 46320613.03459236, 138353537.78199816, 46320616.87688568, 1, 2, 138353634.53530777, 46320282.5973663, 47 },
-  { 138353519.352476, 46320609.4605855, 138353531.68050733, 46320571.40773221, 138353507.02444467, 46320647.51343878, 138353519.96887755, 46320607.55794283, 138353518.73607445, 46320611.363228165, 1, 1, 138353442.91868168, 46320845.38827587, 47 },
-  { 138353500.5728522, 46320603.376526855, 138353513.8460386, 46320565.64295398, 138353487.29966578, 46320641.11009973, 138353501.23651153, 46320601.48984821, 138353499.90919286, 46320605.2632055, 0, 0, 0, 0, 0 },
-  { 138353481.95439523, 46320596.827286184, 138353495.90836355, 46320559.34013148, 138353468.00042692, 46320634.31444089, 138353482.65209365, 46320594.952928446, 138353481.25669682, 46320598.70164392, 1, 4, 138353401.71907735, 46320812.37842575, 31 },
-  { 138353463.45046562, 46320589.939506896, 138353477.82530633, 46320552.611716256, 138353449.0756249, 46320627.267297536, 138353464.16920766, 46320588.07311736, 138353462.73172358, 46320591.80589643, 0, 0, 0, 0, 0 },
-  { 138353445.0144238, 46320582.83983236, 138353459.5537795, 46320545.57581305, 138353430.47506806, 46320620.10385167, 138353445.74139157, 46320580.976631396, 138353444.287456, 46320584.70303332, 0, 0, 0, 0, 0 },
-  { 138353426.5996301, 46320575.65490596, 138353441.04889065, 46320538.355859466, 138353412.15036952, 46320612.953952454, 138353427.32209313, 46320573.789953634, 138353425.87716705, 46320577.519858286, 0, 0, 0, 0, 0 },
-  { 138353408.15944508, 46320568.51137112, 138353422.2636061, 46320531.08046622, 138353394.05528405, 46320605.94227602, 138353408.86465314, 46320566.63982587, 138353407.454237, 46320570.38291637, 0, 0, 0, 0, 0 },
-  { 138353389.64722922, 46320561.53587122, 138353403.14898732, 46320523.88348049, 138353376.14547113, 46320599.188261956, 138353390.32231712, 46320559.653251685, 138353388.97214133, 46320563.41849076, 1, 2, 138353432.17776728, 46320442.93084041, 36 },
-  { 138353371.01635155, 46320554.85503107, 138353383.71268287, 46320516.92347203, 138353358.32002023, 46320592.786590114, 138353371.6511681, 46320552.95845312, 138353370.381535, 46320556.75160903, 0, 0, 0, 0, 0 },
-  { 138353352.23304763, 46320548.567943074, 138353364.09255505, 46320510.36647604, 138353340.37354022, 46320586.76941011, 138353352.826023, 46320546.65786972, 138353351.64007226, 46320550.47801643, 0, 0, 0, 0, 0 },
-  { 138353333.30222908, 46320542.69093885, 138353344.32573882, 46320504.23990203, 138353322.27871934, 46320581.14197568, 138353333.85340455, 46320540.76838701, 138353332.7510536, 46320544.61349069, 1, 0, 138353255.3108977, 46320814.73202441, 29 },
-  { 138353314.2360445, 46320537.22486333, 138353324.42418274, 46320498.54409499, 138353304.04790625, 46320575.90563167, 138353314.74545142, 46320535.29082491, 138353313.72663757, 46320539.15890174, 1, 4, 138353363.90321842, 46320348.65611768, 29 },
-  { 138353295.04664248, 46320532.17056144, 138353304.3997938, 46320493.27944985, 138353285.69349116, 46320571.06167303, 138353295.51430005, 46320530.22600586, 138353294.57898492, 46320534.11511702, 1, 2, 138353233.78350136, 46320786.90734234, 32 },
-  { 138353275.74617177, 46320527.528878145, 138353284.264442, 46320488.44641312, 138353267.22790155, 46320566.61134317, 138353276.1720853, 46320525.574754894, 138353275.32025826, 46320529.483001396, 0, 0, 0, 0, 0 },
-  { 138353256.3467811, 46320523.30065836, 138353264.02996436, 46320484.04548424, 138353248.66359785, 46320562.55583248, 138353256.73094025, 46320521.337899655, 138353255.96262196, 46320525.263417065, 0, 0, 0, 0, 0 },
-  { 138353236.86061907, 46320519.48674702, 138353243.70816913, 46320480.077216975, 138353230.013069, 46320558.89627706, 138353237.20299658, 46320517.51627052, 138353236.51824155, 46320521.45722352, 0, 0, 0, 0, 0 },
-  { 138353217.29983446, 46320516.087989114, 138353223.31084022, 46320476.54222057, 138353211.2888287, 46320555.63375766, 138353217.60038474, 46320514.11070069, 138353216.99928418, 46320518.06527754, 1, 5, 138353161.09693047, 46320885.840924986, 41 },
-  { 138353197.67657584, 46320513.10522951, 138353202.84974012, 46320473.44116049, 138353192.50341156, 46320552.76929853, 138353197.93523404, 46320511.12202606, 138353197.41791764, 46320515.08843296, 0, 0, 0, 0, 0 },
-  { 138353178.0029919, 46320510.539313205, 138353182.33661452, 46320470.7747597, 138353173.6693693, 46320550.30386671, 138353178.21967304, 46320508.55108553, 138353177.7863108, 46320512.52754088, 0, 0, 0, 0, 0 },
-  { 138353158.29123145, 46320508.39108511, 138353161.78319556, 46320468.543799296, 138353154.79926735, 46320548.238370925, 138353158.46582967, 46320506.39872082, 138353158.11663324, 46320510.3834494, 0, 0, 0, 0, 0 },
-  { 138353138.55344307, 46320506.66139018, 138353141.20120534, 46320466.749119446, 138353135.9056808, 46320546.57366091, 138353138.6858312, 46320504.66577664, 138353138.42105496, 46320508.657003716, 0, 0, 0, 0, 0 },
-  { 138353118.80177546, 46320505.35107335, 138353120.6023599, 46320465.391620204, 138353117.00119102, 46320545.31052649, 138353118.89180467, 46320503.35310069, 138353118.71174625, 46320507.34904601, 1, 0, 138353136.40248832, 46320114.74741885, 47 },
-  { 138353099.04837728, 46320504.46097955, 138353100.01528826, 46320464.47266772, 138353098.0814663, 46320544.449291386, 138353099.0967228, 46320502.46156396, 138353099.00003174, 46320506.46039514, 1, 1, 138353093.80288512, 46320721.397571236, 42 },
-  { 138353079.30153066, 46320503.98350395, 138353079.51494026, 46320463.98407325, 138353079.08812106, 46320543.982934654, 138353079.31220114, 46320501.98353242, 138353079.29086018, 46320505.983475484, 0, 0, 0, 0, 0 },
-  { 138353059.55446517, 46320503.87814712, 138353059.11262158, 46320463.88058751, 138353059.99630877, 46320543.875706725, 138353059.53237298, 46320501.878269136, 138353059.57655737, 46320505.8780251, 1, 2, 138353060.85790378, 46320621.87094795, 37 },
-  { 138353039.79674795, 46320504.09640595, 138353038.79934552, 46320464.10884303, 138353040.79415038, 46320544.08396888, 138353039.74687782, 46320502.09702781, 138353039.8466181, 46320506.0957841, 0, 0, 0, 0, 0 },
-  { 138353020.01797292, 46320504.58974431, 138353018.57788825, 46320464.61567576, 138353021.45805758, 46320544.56381285, 138353019.9459687, 46320502.59104088, 138353020.08997715, 46320506.588447735, 1, 3, 138353033.15874556, 46320869.35311979, 36 },
-  { 138353000.21288502, 46320505.30323194, 138352998.46983433, 46320465.34122781, 138353001.95593572, 46320545.26523607, 138353000.12573248, 46320503.30513173, 138353000.30003756, 46320507.301332146, 0, 0, 0, 0, 0 },
-  { 138352980.3874821, 46320506.167970404, 138352978.48373374, 46320466.21329931, 138352982.29123047, 46320546.1226415, 138352980.29229468, 46320504.17023685, 138352980.48266953, 46320508.16570396, 0, 0, 0, 0, 0 },
-  { 138352960.5492481, 46320507.11321671, 138352958.62639558, 46320467.15946047, 138352962.47210062, 46320547.066972956, 138352960.45310548, 46320505.115528904, 138352960.64539072, 46320509.11090452, 1, 0, 138352950.1177732, 46320290.36408908, 31 },
-  { 138352940.70566687, 46320508.0682278, 138352938.90513945, 46320468.108772084, 138352942.5061943, 46320548.02768351, 138352940.6156405, 46320506.07025501, 138352940.79569325, 46320510.066200584, 0, 0, 0, 0, 0 },
-  { 138352920.8642223, 46320508.962260626, 138352919.32780492, 46320468.991778746, 138352922.40063965, 46320548.932742506, 138352920.7874014, 46320506.963736534, 138352920.94104317, 46320510.96078472, 0, 0, 0, 0, 0 },
-  { 138352901.03239822, 46320509.724572144, 138352899.9026848, 46320469.74052848, 138352902.16211164, 46320549.70861581, 138352900.97591254, 46320507.72536996, 138352901.0888839, 46320511.72377433, 1, 5, 138352904.19559577, 46320621.6798944, 45 },
-  { 138352881.21767864, 46320510.284419335, 138352880.6383803, 46320470.288614385, 138352881.79697698, 46320550.280224286, 138352881.18871373, 46320508.28462909, 138352881.24664354, 46320512.28420958, 1, 3, 138352878.2342921, 46320304.30602386, 45 },
-  { 138352861.4275474, 46320510.57105916, 138352861.54357168, 46320470.57122743, 138352861.3115231, 46320550.57089089, 138352861.4333486, 46320508.57106757, 138352861.4217462, 46320512.57105075, 0, 0, 0, 0, 0 },
-  { 138352841.66948837, 46320510.51374856, 138352842.62669876, 46320470.52520334, 138352840.71227798, 46320550.50229377, 138352841.7173489, 46320508.5143213, 138352841.62162784, 46320512.513175815, 0, 0, 0, 0, 0 },
-  { 138352821.95098543, 46320510.04174449, 138352823.89554545, 46320470.08903887, 138352820.0064254, 46320549.994450115, 138352822.04821342, 46320508.04410921, 138352821.85375744, 46320512.039379776, 1, 5, 138352812.71432528, 46320699.81709618, 27 },
-  { 138352802.2795226, 46320509.084303945, 138352805.3567294, 46320469.20284461, 138352799.2023158, 46320548.96576328, 138352802.43338293, 46320507.09023098, 138352802.12566227, 46320511.07837691, 0, 0, 0, 0, 0 },
-  { 138352782.6625836, 46320507.57068385, 138352787.01510745, 46320467.808194794, 138352778.31005973, 46320547.33317291, 138352782.88020977, 46320505.5825594, 138352782.4449574, 46320509.558808304, 1, 3, 138352769.60501203, 46320626.858151026, 38 },
-  { 138352763.10765237, 46320505.43014118, 138352768.8541755, 46320465.84507491, 138352757.36112922, 46320545.015207455, 138352763.39497852, 46320503.45088787, 138352762.8203262, 46320507.409394495, 1, 0, 138352779.19791713, 46320394.59195561, 35 },
-  { 138352743.62133792, 46320502.60133307, 138352750.62392855, 46320463.219056286, 138352736.6187473, 46320541.98360985, 138352743.97146747, 46320500.632219225, 138352743.27120838, 46320504.57044691, 1, 1, 138352700.20527598, 46320746.771449104, 49 },
-  { 138352724.19862708, 46320499.147767045, 138352732.14389127, 46320459.94479807, 138352716.2533629, 46320538.35073602, 138352724.59589028, 46320497.1876186, 138352723.8013639, 46320501.10791549, 1, 5, 138352780.8086345, 46320219.82661306, 46 },
-  { 138352704.82625777, 46320495.22156971, 138352713.40340889, 46320456.151984625, 138352696.24910665, 46320534.291154794, 138352705.25511533, 46320493.26809046, 138352704.3974002, 46320497.17504896, 1, 5, 138352669.6599382, 46320655.40686856, 37 },
-  { 138352685.49079227, 46320490.976753466, 138352694.39684936, 46320451.98082872, 138352676.58473518, 46320529.972678214, 138352685.93609512, 46320489.02695723, 138352685.04548943, 46320492.9265497, 1, 5, 138352770.76628885, 46320117.59077397, 33 },
-  { 138352666.17908117, 46320486.56626179, 138352675.56556922, 46320447.683182664, 138352656.79259312, 46320525.44934092, 138352666.64840558, 46320484.62210783, 138352665.70975676, 46320488.51041575, 0, 0, 0, 0, 0 },
-  { 138352646.9377757, 46320481.92135486, 138352657.9530666, 46320443.46796273, 138352635.92248482, 46320520.37474699, 138352647.48854023, 46320479.998685256, 138352646.38701117, 46320483.844024464, 0, 0, 0, 0, 0 },
-  { 138352627.94630173, 46320476.48109072, 138352641.8268204, 46320438.966677465, 138352614.06578305, 46320513.99550397, 138352628.64032766, 46320474.60537005, 138352627.2522758, 46320478.35681138, 0, 0, 0, 0, 0 },
-  { 138352609.40224245, 46320469.61969696, 138352626.93156645, 46320433.66524243, 138352591.87291846, 46320505.574151486, 138352610.27870867, 46320467.82197423, 138352608.52577624, 46320471.41741969, 0, 0, 0, 0, 0 },
-  { 138352591.54548287, 46320460.913768075, 138352612.79517943, 46320427.02497352, 138352570.29578632, 46320494.80256263, 138352592.6079677, 46320459.219328344, 138352590.48299804, 46320462.60820781, 0, 0, 0, 0, 0 },
-  { 138352574.702107, 46320450.35226447, 138352599.66923013, 46320419.100980274, 138352549.7349839, 46320481.60354867, 138352575.95046318, 46320448.78970026, 138352573.45375085, 46320451.91482868, 1, 0, 138352819.37991345, 46320144.08967937, 31 },
-  { 138352559.20869097, 46320437.97434031, 138352587.73875162, 46320409.93801319, 138352530.67863032, 46320466.010667436, 138352560.635194, 46320436.57252396, 138352557.78218794, 46320439.376156665, 0, 0, 0, 0, 0 },
-  { 138352545.33795467, 46320423.85933351, 138352576.73723382, 46320399.0785896, 138352513.93867552, 46320448.64007741, 138352546.90791863, 46320422.620296314, 138352543.7679907, 46320425.0983707, 1, 4, 138352858.54576424, 46320176.671413034, 50 },
-  { 138352533.04675266, 46320408.28535056, 138352566.5830971, 46320386.48366249, 138352499.51040822, 46320430.08703863, 138352534.72356987, 46320407.19526616, 138352531.36993545, 46320409.375434965, 1, 5, 138352350.27367553, 46320527.104550526, 41 },
-  { 138352522.19444987, 46320391.59184669, 138352557.2908022, 46320372.40210849, 138352487.09809753, 46320410.78158489, 138352523.94926748, 46320390.63235978, 138352520.43963227, 46320392.5513336, 0, 0, 0, 0, 0 },
-  { 138352512.64038327, 46320374.11829472, 138352548.86436132, 46320357.15293544, 138352476.41640523, 46320391.08365401, 138352514.45158216, 46320373.27002676, 138352510.82918438, 46320374.96656269, 0, 0, 0, 0, 0 },
-  { 138352504.23940462, 46320356.18075146, 138352541.29462972, 46320341.11720964, 138352467.1841795, 46320371.24429327, 138352506.0921659, 46320355.42757437, 138352502.38664335, 46320356.93392855, 0, 0, 0, 0, 0 },
-  { 138352496.80983222, 46320337.904539846, 138352534.4659817, 46320324.413268335, 138352459.15368274, 46320351.39581136, 138352498.69263968, 46320337.229976274, 138352494.92702475, 46320338.57910342, 0, 0, 0, 0, 0 },
-  { 138352490.15218472, 46320319.32205347, 138352528.21909997, 46320307.03751179, 138352452.08526948, 46320331.60659515, 138352492.0555305, 46320318.70782638, 138352488.24883896, 46320319.936280556, 0, 0, 0, 0, 0 },
-  { 138352484.06686118, 46320300.46506218, 138352522.39727375, 46320289.02917686, 138352445.73644862, 46320311.9009475, 138352485.9833818, 46320299.893267915, 138352482.15034056, 46320301.03685644, 1, 5, 138352321.16260782, 46320349.06757479, 25 },
-  { 138352478.36840427, 46320281.365167566, 138352516.91633728, 46320270.685426876, 138352439.82047126, 46320292.044908255, 138352480.29580092, 46320280.83118053, 138352476.4410076, 46320281.8991546, 0, 0, 0, 0, 0 },
-  { 138352473.01773682, 46320262.05222952, 138352511.78517702, 46320252.19902795, 138352434.25029662, 46320271.9054311, 138352474.95610884, 46320261.55956945, 138352471.0793648, 46320262.5448896, 1, 3, 138352145.43286723, 46320345.31178286, 36 },
-  { 138352468.0623062, 46320242.55507838, 138352507.04817834, 46320233.605119, 138352429.07643405, 46320251.50503776, 138352470.0115998, 46320242.10758041, 138352466.11301258, 46320243.00257635, 0, 0, 0, 0, 0 },
-  { 138352463.5506847, 46320222.90253118, 138352502.74955672, 46320214.93707879, 138352424.35181266, 46320230.867983565, 138352465.51062828, 46320222.50425856, 138352461.5907411, 46320223.300803795, 1, 0, 138352343.994125, 46320247.19716097, 28 },
-  { 138352459.5314443, 46320203.12340482, 138352498.9327197, 46320196.22851564, 138352420.1301689, 46320210.01829401, 138352461.5015081, 46320202.778660364, 138352457.56138054, 46320203.46814928, 0, 0, 0, 0, 0 },
-  { 138352456.05315733, 46320183.246516354, 138352495.6401274, 46320177.51312289, 138352416.46618727, 46320188.97990982, 138352458.03250584, 46320182.95984668, 138352454.07380882, 46320183.533186026, 0, 0, 0, 0, 0 },
-  { 138352453.1643959, 46320163.30068272, 138352492.91315272, 46320158.824486755, 138352413.41563907, 46320167.77687869, 138352455.15183374, 46320163.07687292, 138352451.17695805, 46320163.524492525, 1, 4, 138352595.2662016, 46320147.29828213, 33 },
-  { 138352450.91373226, 46320143.31472092, 138352490.79195347, 46320140.19583116, 138352411.03551105, 46320146.433610685, 138352452.90764332, 46320143.15877643, 138352448.9198212, 46320143.47066541, 0, 0, 0, 0, 0 },
-  { 138352449.34973848, 46320123.31744792, 138352489.31537175, 46320121.65969164, 138352409.3841052, 46320124.97520421, 138352451.34802014, 46320123.23456011, 138352447.35145682, 46320123.40033574, 0, 0, 0, 0, 0 },
-  { 138352448.52098683, 46320103.33768071, 138352488.52088517, 46320103.24750605, 138352408.52108848, 46320103.42785537, 138352450.52098173, 46320103.33317198, 138352446.52099192, 46320103.342189446, 1, 4, 138352249.5214925, 46320103.78629963, 32 },
-  { 138352448.47604942, 46320083.40423628, 138352488.44463864, 46320084.98912626, 138352408.5074602, 46320081.8193463, 138352450.47447887, 46320083.48348078, 138352446.47761998, 46320083.32499178, 0, 0, 0, 0, 0 },
-  { 138352449.26349849, 46320063.54593158, 138352489.12159497, 46320066.912256636, 138352409.405402, 46320060.17960652, 138352451.2564033, 46320063.71424783, 138352447.27059367, 46320063.377615325, 1, 1, 138352089.54417768, 46320033.1648479, 30 },
-  { 138352450.93190622, 46320043.79158361, 138352490.58584303, 46320049.04184993, 138352411.27796942, 46320038.54131729, 138352452.91460305, 46320044.05409693, 138352448.9492094, 46320043.529070295, 1, 5, 138352824.67026055, 46320093.27534372, 47 },
-  { 138352453.52984476, 46320024.17000935, 138352492.8710995, 46320031.399509765, 138352414.18859002, 46320016.94050894, 138352455.4969075, 46320024.53148437, 138352451.56278202, 46320023.80853433, 0, 0, 0, 0, 0 },
-  { 138352457.10588625, 46320004.71002579, 138352496.0114423, 46320014.00291056, 138352418.2003302, 46319995.41714101, 138352459.05116406, 46320005.174670026, 138352455.16060844, 46320004.24538155, 1, 0, 138352708.04672286, 46320064.6491326, 29 },
-  { 138352461.7085558, 46319985.44050701, 138352500.04767329, 46319996.84717475, 138352423.3694383, 46319974.03383927, 138352463.62551168, 46319986.01084039, 138352459.7915999, 46319984.870173626, 1, 0, 138352350.525115, 46319952.361170575, 41 },
-  { 138352467.3707353, 46319966.409272805, 138352505.0159853, 46319979.93092769, 138352429.72548527, 46319952.88761792, 138352469.2529978, 46319967.08535555, 138352465.4884728, 46319965.73319006, 1, 2, 138352590.6589291, 46320010.69269254, 34 },
-  { 138352474.08711228, 46319947.71040101, 138352510.90274084, 46319963.350397594, 138352437.27148372, 46319932.07040443, 138352475.9278937, 46319948.49240084, 138352472.24633086, 46319946.92840119, 1, 4, 138352326.824598, 46319885.15041468, 32 },
-  { 138352481.84665436, 46319929.444897085, 138352517.683279, 46319947.213868186, 138352446.0100297, 46319911.675925985, 138352483.63848558, 46319930.333345644, 138352480.05482313, 46319928.55644853, 1, 4, 138352651.1747058, 46320013.40328555, 50 },
-  { 138352490.63832906, 46319911.71376654, 138352525.3299645, 46319931.62583404, 138352455.94669363, 46319891.801699035, 138352492.37291083, 46319912.70936991, 138352488.9037473, 46319910.71816316, 1, 3, 138352158.46591994, 46319721.05572023, 27 },
-  { 138352500.4509682, 46319894.61777689, 138352533.87057036, 46319916.59799965, 138352467.03136605, 46319872.63755414, 138352502.1219483, 46319895.71678803, 138352498.7799881, 46319893.518765755, 0, 0, 0, 0, 0 },
-  { 138352511.24443868, 46319878.206956446, 138352543.41212142, 46319901.98173692, 138352479.07675594, 46319854.43217597, 138352512.8528228, 46319879.39569547, 138352509.63605455, 46319877.01821742, 0, 0, 0, 0, 0 },
-  { 138352522.91389868, 46319862.4179784, 138352553.91401967, 46319887.696279325, 138352491.91377768, 46319837.13967747, 138352524.46390474, 46319863.681893446, 138352521.3638926, 46319861.15406335, 1, 1, 138352791.06494534, 46320081.07528144, 42 },
-  { 138352535.3457374, 46319847.17215528, 138352565.3007799, 46319873.68055827, 138352505.3906949, 46319820.663752295, 138352536.84348953, 46319848.49757543, 138352533.84798527, 46319845.846735135, 1, 0, 138352340.63796115, 46319674.86753587, 25 },
-  { 138352548.42634425, 46319832.39079957, 138352577.48676625, 46319859.877011985, 138352519.36592224, 46319804.90458715, 138352549.87936535, 46319833.76511019, 138352546.97332314, 46319831.01648895, 0, 0, 0, 0, 0 },
-  { 138352562.04210848, 46319817.99522376, 138352590.3777937, 46319846.2279874, 138352533.70642325, 46319789.76246012, 138352563.45889273, 46319819.406861946, 138352560.62532422, 46319816.583585575, 0, 0, 0, 0, 0 },
-  { 138352576.07941937, 46319803.90674032, 138352603.87305275, 46319832.67328242, 138352548.285786, 46319775.14019822, 138352577.46910104, 46319805.34506743, 138352574.6897377, 46319802.46841322, 1, 0, 138352828.30664214, 46320064.96310989, 49 },
-  { 138352590.4246663, 46319790.04666177, 138352617.8668993, 46319819.14861784, 138352562.98243326, 46319760.9447057, 138352591.79677793, 46319791.501759574, 138352589.05255464, 46319788.59156397, 1, 1, 138352327.6652851, 46319511.395432435, 39 },
-  { 138352604.9642385, 46319776.3363006, 138352632.25026435, 46319805.58476712, 138352577.67821264, 46319747.087834075, 138352606.3285398, 46319777.79872392, 138352603.5999372, 46319774.87387727, 1, 5, 138352741.3943677, 46319922.578633204, 45 },
-  { 138352619.58452538, 46319762.69696927, 138352646.91153318, 46319791.90714978, 138352592.25751758, 46319733.486788765, 138352620.95087576, 46319764.157478295, 138352618.218175, 46319761.236460246, 0, 0, 0, 0, 0 },
-  { 138352634.17194337, 46319749.04999831, 138352661.69340172, 46319778.07704311, 138352606.650485, 46319720.02295352, 138352635.54801628, 46319750.50135055, 138352632.79587045, 46319747.598646075, 0, 0, 0, 0, 0 },
-  { 138352648.63860807, 46319735.333696395, 138352676.3823519, 46319764.14835722, 138352620.89486423, 46319706.51903557, 138352650.02579525, 46319736.77442943, 138352647.2514209, 46319733.89296336, 0, 0, 0, 0, 0 },
-  { 138352662.97006112, 46319721.5348818, 138352690.9414893, 46319750.128573515, 138352634.99863294, 46319692.94119009, 138352664.36863253, 46319722.96456639, 138352661.57148972, 46319720.10519721, 0, 0, 0, 0, 0 },
-  { 138352677.1648735, 46319707.6489807, 138352705.36914513, 46319736.013025954, 138352648.9606019, 46319679.284935445, 138352678.5750871, 46319709.067182966, 138352675.75465992, 46319706.23077843, 0, 0, 0, 0, 0 },
-  { 138352691.22161612, 46319693.67141922, 138352719.66363457, 46319721.797058515, 138352662.77959767, 46319665.54577992, 138352692.64371705, 46319695.07770118, 138352689.7995152, 46319692.265137255, 0, 0, 0, 0, 0 },
-  { 138352705.13885984, 46319679.59762347, 138352733.82325715, 46319707.47602642, 138352676.45446253, 46319651.71922051, 138352706.5730797, 46319680.99154361, 138352703.70463997, 46319678.20370332, 1, 2, 138352449.13061392, 46319430.782877065, 50 },
-  { 138352718.9151757, 46319665.423019625, 138352747.84629762, 46319693.04529658, 138352689.9840538, 46319637.80074267, 138352720.3617318, 46319666.804133475, 138352717.4686196, 46319664.041905776, 1, 3, 138352876.5897902, 46319815.96442903, 28 },
-  { 138352732.54913446, 46319651.14303381, 138352761.73102492, 46319678.50024983, 138352703.367244, 46319623.78581779, 138352734.008229, 46319652.51089461, 138352731.09003994, 46319649.77517301, 1, 3, 138352531.1940902, 46319462.37824326, 46 },
-  { 138352746.03930718, 46319636.75309215, 138352775.47569424, 46319663.83628097, 138352716.60292011, 46319609.66990332, 138352747.51112652, 46319638.10725159, 138352744.56748784, 46319635.3989327, 0, 0, 0, 0, 0 },
-  { 138352759.38426474, 46319622.24862081, 138352789.07854658, 46319649.0488004, 138352729.6899829, 46319595.448441215, 138352760.86897883, 46319623.58862979, 138352757.89955065, 46319620.90861183, 1, 0, 138352666.589634, 46319538.498059586, 27 },
-  { 138352772.582578, 46319607.625045896, 138352802.5378094, 46319634.13323541, 138352742.6273466, 46319581.11685638, 138352774.08033958, 46319608.950455375, 138352771.08481643, 46319606.299636416, 0, 0, 0, 0, 0 },
-  { 138352785.632818, 46319592.87779357, 138352815.85169852, 46319619.08503037, 138352755.4139375, 46319566.670556776, 138352787.14376205, 46319594.18815541, 138352784.12187397, 46319591.56743173, 0, 0, 0, 0, 0 },
-  { 138352798.53355554, 46319578.00228996, 138352829.01841736, 46319603.899648875, 138352768.04869372, 46319552.10493104, 138352800.05779862, 46319579.297157906, 138352797.00931245, 46319576.70742201, 0, 0, 0, 0, 0 },
-  { 138352811.2833616, 46319562.9939612, 138352842.03610796, 46319588.57263577, 138352780.53061527, 46319537.41528663, 138352812.82099894, 46319564.27289493, 138352809.7457243, 46319561.715027474, 1, 3, 138352685.19710162, 46319458.121395476, 36 },
-  { 138352823.88082647, 46319547.84827254, 138352854.8986011, 46319573.10490843, 138352792.86305183, 46319522.59163665, 138352825.43171522, 46319549.11110433, 138352822.32993773, 46319546.58544075, 1, 3, 138352952.60459125, 46319652.66331147, 47 },
-  { 138352836.3262069, 46319532.56405152, 138352867.5984682, 46319557.50489498, 138352805.05394557, 46319507.62320805, 138352837.88981995, 46319533.81109369, 138352834.76259384, 46319531.317009345, 0, 0, 0, 0, 0 },
-  { 138352848.62268296, 46319517.14602392, 138352880.13840955, 46319541.778502025, 138352817.10695636, 46319492.51354582, 138352850.19846928, 46319518.377647825, 138352847.04689664, 46319515.91440002, 0, 0, 0, 0, 0 },
-  { 138352860.7737307, 46319501.59951266, 138352892.52221078, 46319525.93126174, 138352829.0252506, 46319477.26776358, 138352862.3611547, 46319502.81610011, 138352859.1863067, 46319500.382925205, 1, 2, 138352658.37717026, 46319346.484612264, 32 },
-  { 138352872.7828261, 46319485.929840714, 138352904.75365427, 46319509.968687296, 138352840.81199792, 46319461.89099413, 138352874.3813675, 46319487.131783046, 138352871.1842847, 46319484.72789838, 1, 3, 138353131.74653444, 46319680.64449801, 47 },
-  { 138352884.6534452, 46319470.14233098, 138352916.83651823, 46319493.896274045, 138352852.4703722, 46319446.38838792, 138352886.26259887, 46319471.33002813, 138352883.04429156, 46319468.95463383, 0, 0, 0, 0, 0 },
-  { 138352896.38906407, 46319454.2423064, 138352928.77457523, 46319477.719501, 138352864.0035529, 46319430.76511179, 138352898.00833964, 46319455.41616613, 138352894.7697885, 46319453.068446666, 1, 2, 138353215.38634905, 46319685.49267326, 37 },
-  { 138352907.99315873, 46319438.23508989, 138352940.57159168, 46319461.44383192, 138352875.41472578, 46319415.02634786, 138352909.6220804, 46319439.39552699, 138352906.36423707, 46319437.07465279, 0, 0, 0, 0, 0 },
-  { 138352919.46920517, 46319422.1260044, 138352952.23132655, 46319445.07471684, 138352886.7070838, 46319399.17729195, 138352921.10731125, 46319423.27344002, 138352917.8310991, 46319420.97856878, 0, 0, 0, 0, 0 },
-  { 138352930.82067946, 46319405.92037285, 138352963.75753108, 46319428.61759307, 138352897.88382784, 46319383.22315263, 138352932.46752203, 46319407.055233866, 138352929.1738369, 46319404.78551184, 1, 2, 138352683.79429236, 46319235.69122117, 34 },
-  { 138352942.05105764, 46319389.62351817, 138352975.15394795, 46319412.0778864, 138352908.94816732, 46319367.169149935, 138352943.70620215, 46319390.74623658, 138352940.39591312, 46319388.50079976, 0, 0, 0, 0, 0 },
-  { 138352953.16381568, 46319373.2407633, 138352986.42431068, 46319395.46101244, 138352919.90332067, 46319351.02051416, 138352954.82684043, 46319374.35177576, 138352951.50079092, 46319372.12975084, 0, 0, 0, 0, 0 },
-  { 138352964.16242957, 46319356.77743113, 138352997.572343, 46319378.77237796, 138352930.75251615, 46319334.7824843, 138352965.83292523, 46319357.877178475, 138352962.4919339, 46319355.677683786, 0, 0, 0, 0, 0 },
-  { 138352975.0503755, 46319340.23884465, 138353008.60175928, 46319362.017381, 138352941.4989917, 46319318.4603083, 138352976.72794467, 46319341.32777146, 138352973.3728063, 46319339.14991783, 0, 0, 0, 0, 0 },
-  { 138352985.83112937, 46319323.63032674, 138353019.5162631, 46319345.20141307, 138352952.14599565, 46319302.05924041, 138352987.51538604, 46319324.70888106, 138352984.1468727, 46319322.55177242, 0, 0, 0, 0, 0 },
-  { 138352996.50816724, 46319306.95720037, 138353030.31954753, 46319328.3298596, 138352962.69678694, 46319285.58454114, 138352998.19873625, 46319308.02583333, 138352994.81759822, 46319305.88856741, 1, 1, 138352909.44386297, 46319251.922602855, 30 },
-  { 138353007.0849652, 46319290.22478844, 138353041.01533687, 46319311.40803369, 138352973.15459353, 46319269.04154319, 138353008.78148377, 46319291.2839507, 138353005.38844663, 46319289.16562618, 1, 3, 138353268.34882694, 46319453.33577684, 33 },
-  { 138353017.56498232, 46319273.43836729, 138353051.60889572, 46319294.43865208, 138352983.52106893, 46319252.4380825, 138353019.267178, 46319274.488381535, 138353015.86278665, 46319272.38835305, 0, 0, 0, 0, 0 },
-  { 138353027.95101887, 46319256.601389505, 138353062.1052242, 46319277.421818405, 138352993.79681355, 46319235.780960605, 138353029.65872914, 46319257.64241095, 138353026.2433086, 46319255.56036806, 0, 0, 0, 0, 0 },
-  { 138353038.24501625, 46319239.71493142, 138353072.50644702, 46319260.35843797, 138353003.98358548, 46319219.07142487, 138353039.95808777, 46319240.747106746, 138353036.53194472, 46319238.682756096, 0, 0, 0, 0, 0 },
-  { 138353048.4488583, 46319222.7799099, 138353082.81448904, 46319243.249483004, 138353014.08322755, 46319202.3103368, 138353050.16713983, 46319223.80338856, 138353046.73057675, 46319221.756431244, 0, 0, 0, 0, 0 },
-  { 138353058.56442896, 46319205.79724179, 138353093.03127608, 46319226.09592276, 138353024.09758183, 46319185.49856082, 138353060.2877713, 46319206.81217584, 138353056.8410866, 46319204.782307744, 0, 0, 0, 0, 0 },
-  { 138353068.5936119, 46319188.76784389, 138353103.15873322, 46319208.89872531, 138353034.02849057, 46319168.636962466, 138353070.32186797, 46319189.774387956, 138353066.86535582, 46319187.76129982, 0, 0, 0, 0, 0 },
-  { 138353078.53829113, 46319171.69263307, 138353113.19878685, 46319191.658855416, 138353043.8777954, 46319151.726410724, 138353080.2713159, 46319172.69094419, 138353076.80526635, 46319170.69432195, 0, 0, 0, 0, 0 },
-  { 138353088.40035033, 46319154.572526164, 138353123.15336257, 46319174.3772766, 138353053.6473381, 46319134.76777573, 138353090.13800094, 46319155.56276368, 138353086.66269973, 46319153.582288645, 0, 0, 0, 0, 0 },
-  { 138353098.18167347, 46319137.40844001, 138353133.02438667, 46319157.05494951, 138353063.33896026, 46319117.76193051, 138353099.92380914, 46319138.39076548, 138353096.4395378, 46319136.42611454, 0, 0, 0, 0, 0 },
-  { 138353107.88414428, 46319120.201291434, 138353142.8137849, 46319139.69283332, 138353072.95450366, 46319100.70974955, 138353109.63062632, 46319121.175868526, 138353106.13766223, 46319119.22671434, 0, 0, 0, 0, 0 },
-  { 138353117.50964665, 46319102.95199731, 138353152.5234832, 46319122.29188487, 138353082.49581012, 46319083.61210975, 138353119.2603385, 46319103.918991685, 138353115.75895482, 46319101.985002935, 0, 0, 0, 0, 0 },
-  { 138353127.06006446, 46319085.661474444, 138353162.15540725, 46319104.853058904, 138353091.96472168, 46319066.46988998, 138353128.8148316, 46319086.621053666, 138353125.30529732, 46319084.70189522, 1, 2, 138353395.53943685, 46319232.477095574, 28 },
-  { 138353136.53728145, 46319068.33063969, 138353171.7114822, 46319087.37730873, 138353101.3630807, 46319049.283970654, 138353138.29599148, 46319069.28297314, 138353134.77857143, 46319067.37830624, 0, 0, 0, 0, 0 },
-  { 138353145.94318154, 46319050.96040989, 138353181.19363323, 46319069.865585245, 138353110.69272986, 46319032.05523453, 138353147.70570412, 46319051.90566865, 138353144.18065897, 46319050.01515112, 0, 0, 0, 0, 0 },
-  { 138353155.2796485, 46319033.551701866, 138353190.6037848, 46319052.31883791, 138353119.95551223, 46319014.78456582, 138353157.0458553, 46319034.49005867, 138353153.5134417, 46319032.613345064, 0, 0, 0, 0, 0 },
-  { 138353164.5485662, 46319016.10543246, 138353199.94386092, 46319034.738014445, 138353129.15327147, 46318997.47285047, 138353166.3183309, 46319017.03706156, 138353162.77880147, 46319015.17380336, 1, 0, 138353396.38774663, 46319138.14884446, 39 },
-  { 138353173.75181848, 46318998.62251853, 138353209.2157853, 46319017.12406057, 138353138.28785166, 46318980.12097649, 138353175.5250168, 46318999.547595635, 138353171.97862014, 46318997.69744143, 0, 0, 0, 0, 0 },
-  { 138353182.89128914, 46318981.10387691, 138353218.42148072, 46318999.47792075, 138353147.36109757, 46318962.729833074, 138353184.66779873, 46318982.0225791, 138353181.11477956, 46318980.18517472, 1, 4, 138353523.98112822, 46319157.494697765, 35 },
-  { 138353191.9688621, 46318963.55042442, 138353227.5628696, 46318981.80053751, 138353156.37485456, 46318945.30031133, 138353193.74856246, 46318964.462930076, 138353190.18916172, 46318962.63791876, 0, 0, 0, 0, 0 },
-  { 138353200.98642108, 46318945.96307792, 138353236.64187342, 46318964.09285227, 138353165.33096874, 46318927.83330356, 138353202.7691937, 46318946.869566634, 138353199.20364845, 46318945.0565892, 1, 2, 138353499.60083446, 46319097.79993814, 33 },
-  { 138353209.94585004, 46318928.34275423, 138353245.6604132, 46318946.35580443, 138353174.23128688, 46318910.32970403, 138353211.7315782, 46318929.24340674, 138353208.1601219, 46318927.44210172, 0, 0, 0, 0, 0 },
-  { 138353218.8490327, 46318910.69037022, 138353254.6204087, 46318928.59033271, 138353183.0776567, 46318892.790407725, 138353220.6376015, 46318911.58536834, 138353217.0604639, 46318909.79537209, 0, 0, 0, 0, 0 },
-  { 138353227.69785303, 46318893.006842695, 138353263.52377957, 46318910.797373526, 138353191.8719265, 46318875.216311865, 138353229.48914936, 46318893.896369234, 138353225.9065567, 46318892.11731616, 0, 0, 0, 0, 0 },
-  { 138353236.4941947, 46318875.2930885, 138353272.37244362, 46318892.977863126, 138353200.61594576, 46318857.60831388, 138353238.28810713, 46318876.17732724, 138353234.70028225, 46318874.40884977, 1, 2, 138353549.53191662, 46319029.592747085, 25 },
-  { 138353245.2399417, 46318857.5500245, 138353281.1683187, 46318875.13273551, 138353209.31156468, 46318839.96731349, 138353247.03636053, 46318858.42916005, 138353243.44352284, 46318856.67088895, 0, 0, 0, 0, 0 },
-  { 138353253.9369778, 46318839.77856752, 138353289.9155372, 46318857.25836338, 138353217.9584184, 46318822.298771665, 138353255.73590577, 46318840.65255731, 138353252.13804984, 46318838.90457773, 0, 0, 0, 0, 0 },
-  { 138353262.58480093, 46318821.97880484, 138353298.62546185, 46318839.33019555, 138353226.54414, 46318804.62741413, 138353264.38683397, 46318822.84637438, 138353260.7827679, 46318821.111235306, 0, 0, 0, 0, 0 },
-  { 138353271.17004505, 46318804.1463511, 138353307.28841236, 46318821.335404105, 138353235.05167773, 46318786.95729809, 138353272.9759634, 46318805.00580375, 138353269.36412668, 46318803.28689845, 1, 0, 138353580.8850447, 46318951.542480625, 44 },
-  { 138353279.67502797, 46318786.275320224, 138353315.88627633, 46318803.267833024, 138353243.4637796, 46318769.282807425, 138353281.4855904, 46318787.124945864, 138353277.86446553, 46318785.425694585, 0, 0, 0, 0, 0 },
-  { 138353288.0820643, 46318768.35982507, 138353324.4008433, 46318785.121277645, 138353251.7632853, 46318751.59837249, 138353289.89800325, 46318769.197897695, 138353286.26612535, 46318767.52175244, 0, 0, 0, 0, 0 },
-  { 138353296.37346876, 46318750.39397846, 138353332.8138066, 46318766.88948626, 138353259.93313092, 46318733.89847066, 138353298.19548565, 46318751.21875385, 138353294.55145186, 46318749.56920307, 0, 0, 0, 0, 0 },
-  { 138353304.53155577, 46318732.37189326, 138353341.10675752, 46318748.56617056, 138353267.95635402, 46318716.177615955, 138353306.36031586, 46318733.18160712, 138353302.70279568, 46318731.562179394, 0, 0, 0, 0, 0 },
-  { 138353312.53864017, 46318714.28768228, 138353349.26118147, 46318730.14501369, 138353275.81609887, 46318698.43035087, 138353314.37476724, 46318715.08054885, 138353310.7025131, 46318713.49481571, 0, 0, 0, 0, 0 },
-  { 138353320.37703642, 46318696.13545838, 138353357.25845093, 46318711.61968468, 138353283.49562192, 46318680.65123208, 138353322.22110716, 46318696.9096697, 138353318.5329657, 46318695.36124706, 0, 0, 0, 0, 0 },
-  { 138353328.02905932, 46318677.9093344, 138353365.0798215, 46318692.983850025, 138353290.97829714, 46318662.83481877, 138353329.88159743, 46318678.66306018, 138353326.1765212, 46318677.15560862, 0, 0, 0, 0, 0 },
-  { 138353335.47702336, 46318659.60342319, 138353372.70642582, 46318674.231191054, 138353298.2476209, 46318644.97565533, 138353337.3384935, 46318660.33481158, 138353333.61555323, 46318658.8720348, 1, 0, 138353578.3988744, 46318755.049608506, 49 },
-  { 138353342.70324317, 46318641.21183756, 138353380.11926982, 46318655.35542087, 138353305.2872165, 46318627.06825425, 138353344.5740445, 46318641.91901673, 138353340.83244184, 46318640.50465839, 0, 0, 0, 0, 0 },
-  { 138353349.69003347, 46318622.72869037, 138353387.29923004, 46318636.35030313, 138353312.0808369, 46318609.10707761, 138353351.57049328, 46318623.40977101, 138353347.80957365, 46318622.04760973, 0, 0, 0, 0, 0 },
-  { 138353356.4197088, 46318604.14809448, 138353394.22705102, 46318617.209674515, 138353318.61236656, 46318591.08651445, 138353358.3100759, 46318604.801173486, 138353354.52934167, 46318603.49501548, 0, 0, 0, 0, 0 },
-  { 138353362.87458384, 46318585.46416271, 138353400.88334683, 46318597.927466325, 138353324.86582085, 46318573.00085909, 138353364.775022, 46318586.08732789, 138353360.97414568, 46318584.840997525, 0, 0, 0, 0, 0 },
-  { 138353369.03697315, 46318566.67100788, 138353407.24840727, 46318578.49836184, 138353330.82553902, 46318554.84365392, 138353370.94754484, 46318567.26237558, 138353367.12640145, 46318566.07964018, 0, 0, 0, 0, 0 },
-  { 138353374.88945052, 46318547.76301254, 138353413.2938462, 46318558.94793065, 138353336.48505485, 46318536.57809444, 138353376.8096703, 46318548.32225845, 138353372.96923074, 46318547.20376664, 0, 0, 0, 0, 0 },
-  { 138353380.42741874, 46318528.74791376, 138353419.0027875, 46318539.32812764, 138353341.85204998, 46318518.16769989, 138353382.35618716, 46318529.27692445, 138353378.4986503, 46318528.21890307, 0, 0, 0, 0, 0 },
-  { 138353385.66474462, 46318509.652668685, 138353424.39052892, 46318519.66833794, 138353346.9389603, 46318499.63699943, 138353387.60103384, 46318510.15345215, 138353383.7284554, 46318509.15188522, 0, 0, 0, 0, 0 },
-  { 138353390.61672807, 46318490.50572622, 138353429.4746072, 46318499.995996416, 138353351.75884894, 46318481.01545602, 138353392.55962202, 46318490.98023973, 138353388.67383412, 46318490.03121271, 0, 0, 0, 0, 0 },
-  { 138353395.29866892, 46318471.335535266, 138353434.27230728, 46318480.33861886, 138353356.32503057, 46318462.33245167, 138353397.24735084, 46318471.78568944, 138353393.349987, 46318470.88538109, 0, 0, 0, 0, 0 },
-  { 138353399.72586694, 46318452.17054443, 138353438.80706304, 46318460.694634564, 138353360.64467084, 46318443.6464543, 138353401.67992675, 46318452.59674894, 138353397.77180713, 46318451.74433992, 0, 0, 0, 0, 0 },
-  { 138353403.90538567, 46318433.00831263, 138353443.10797834, 46318440.95543338, 138353364.702793, 46318425.06119187, 138353405.8655153, 46318433.40566867, 138353401.94525605, 46318432.61095659, 0, 0, 0, 0, 0 },
-  { 138353407.8133768, 46318413.730464764, 138353447.14932576, 46318420.98877873, 138353368.47742787, 46318406.472150795, 138353409.78017426, 46318414.093380466, 138353405.84657937, 46318413.36754906, 0, 0, 0, 0, 0 },
-  { 138353411.4187413, 46318394.191432245, 138353450.93152523, 46318400.41557108, 138353371.90595734, 46318387.96729341, 138353413.39438048, 46318394.50263919, 138353409.4431021, 46318393.8802253, 1, 5, 138353617.87303746, 46318426.71255765, 35 },
-  { 138353414.55381885, 46318374.288977325, 138353454.53687045, 46318375.45327371, 138353374.57076725, 46318373.12468094, 138353416.55297142, 46318374.347192146, 138353412.55466628, 46318374.230762504, 0, 0, 0, 0, 0 },
-  { 138353415.12917662, 46318354.53064143, 138353453.7070391, 46318343.95952384, 138353376.55131415, 46318365.10175902, 138353417.05806974, 46318354.00208555, 138353413.2002835, 46318355.05919731, 0, 0, 0, 0, 0 },
-  { 138353410.00220644, 46318335.8204579, 138353444.3664732, 46318315.34859498, 138353375.6379397, 46318356.29232082, 138353411.7204198, 46318334.796864755, 138353408.2839931, 46318336.84405104, 0, 0, 0, 0, 0 },
-  { 138353399.70044732, 46318318.52782558, 138353429.90420812, 46318292.30316479, 138353369.49668652, 46318344.75248637, 138353401.21063536, 46318317.21659254, 138353398.19025928, 46318319.839058615, 0, 0, 0, 0, 0 },
-  { 138353386.40258864, 46318303.21226645, 138353408.06504017, 46318269.585815646, 138353364.7401371, 46318336.83871726, 138353387.48571122, 46318301.530943915, 138353385.31946605, 46318304.89358899, 0, 0, 0, 0, 0 },
-  { 138353370.08117777, 46318292.697871886, 138353377.48172098, 46318253.38843332, 138353362.68063456, 46318332.00731045, 138353370.45120493, 46318290.732399955, 138353369.71115062, 46318294.66334382, 1, 5, 138353441.12639254, 46317915.327261664, 44 },
-  { 138353350.7907548, 46318289.06618408, 138353347.22733998, 46318249.225224316, 138353354.3541696, 46318328.907143846, 138353350.61258405, 46318287.07413609, 138353350.96892554, 46318291.05823207, 0, 0, 0, 0, 0 },
-  { 138353330.3867587, 46318290.89113765, 138353319.7458314, 46318252.3324724, 138353341.02768597, 46318329.449802905, 138353329.8547123, 46318288.96320439, 138353330.91880506, 46318292.81907091, 0, 0, 0, 0, 0 },
-  { 138353310.83210492, 46318296.28758091, 138353295.00919607, 46318259.55019456, 138353326.65501377, 46318333.02496725, 138353310.04095948, 46318294.45071159, 138353311.62325037, 46318298.12445022, 0, 0, 0, 0, 0 },
-  { 138353292.60921317, 46318304.136238195, 138353273.12576503, 46318269.20208229, 138353312.09266132, 46318339.0703941, 138353291.63504076, 46318302.3895304, 138353293.5833856, 46318305.88294599, 0, 0, 0, 0, 0 },
-  { 138353275.45452952, 46318313.70373397, 138353253.6876169, 46318280.14480796, 138353297.22144213, 46318347.26265999, 138353274.3661839, 46318312.025787674, 138353276.54287514, 46318315.38168027, 1, 2, 138353469.1800518, 46318612.378175505, 43 },
-  { 138353259.11300915, 46318324.303132944, 138353235.6196586, 46318291.92933984, 138353282.60635972, 46318356.67692605, 138353257.93834162, 46318322.68444329, 138353260.2876767, 46318325.9218226, 1, 1, 138353042.97418407, 46318026.464236416, 38 },
-  { 138353243.4641137, 46318335.65938599, 138353218.3965564, 46318304.48860526, 138353268.53167102, 46318366.83016671, 138353242.21073586, 46318334.10084695, 138353244.71749157, 46318337.21792502, 0, 0, 0, 0, 0 },
-  { 138353228.46146113, 46318347.72452663, 138353201.97229645, 46318317.75247039, 138353254.9506258, 46318377.69658287, 138353227.1370029, 46318346.225923814, 138353229.78591937, 46318349.223129444, 0, 0, 0, 0, 0 },
-  { 138353214.05944446, 46318360.45296235, 138353186.30082735, 46318331.65262942, 138353241.81806156, 46318389.25329527, 138353212.67151362, 46318359.0129457, 138353215.4473753, 46318361.892978996, 0, 0, 0, 0, 0 },
-  { 138353200.2124569, 46318373.79910061, 138353171.33214495, 46318346.12370393, 138353229.09276888, 46318401.47449729, 138353198.76844132, 46318372.415330775, 138353201.6564725, 46318375.18287044, 0, 0, 0, 0, 0 },
-  { 138353186.87489173, 46318387.717348926, 138353157.01340312, 46318361.10360251, 138353216.73638034, 46318414.33109534, 138353185.3818173, 46318386.386661604, 138353188.36796615, 46318389.04803625, 0, 0, 0, 0, 0 },
-  { 138353174.0011419, 46318402.16211472, 138353143.28997204, 46318376.53353604, 138353204.71231177, 46318427.790693395, 138353172.4655834, 46318400.880685784, 138353175.5367004, 46318403.44354365, 0, 0, 0, 0, 0 },
-  { 138353161.5456007, 46318417.08780553, 138353130.10635844, 46318392.35778239, 138353192.984843, 46318441.81782867, 138353159.9736386, 46318415.851304375, 138353163.11756283, 46318418.32430669, 0, 0, 0, 0, 0 },
-  { 138353149.46266127, 46318432.448828794, 138353117.4069402, 46318408.52330378, 138353181.51838234, 46318456.37435381, 138353147.8598752, 46318431.25255255, 138353151.06544733, 46318433.64510504, 0, 0, 0, 0, 0 },
-  { 138353137.70671672, 46318448.19959201, 138353105.1365177, 46318424.97929624, 138353170.27691573, 46318471.41988778, 138353136.07820678, 46318447.03857722, 138353139.33522666, 46318449.3606068, 0, 0, 0, 0, 0 },
-  { 138353126.2321603, 46318464.294502676, 138353093.24069887, 46318441.6767337, 138353159.22362173, 46318486.91227165, 138353124.58258724, 46318463.16361423, 138353127.88173336, 46318465.42539112, 1, 5, 138352971.99707815, 46318358.55643274, 47 },
-  { 138353114.99338514, 46318480.68796826, 138353081.66614875, 46318458.5679476, 138353148.32062152, 46318502.80798893, 138353113.32702333, 46318479.58196723, 138353116.65974694, 46318481.793969296, 0, 0, 0, 0, 0 },
-  { 138353103.94478434, 46318497.33439622, 138353070.36073714, 46318475.60626298, 138353137.52883154, 46318519.06252946, 138353102.265582, 46318496.24798956, 138353105.6239867, 46318498.420802884, 1, 5, 138352849.54562685, 46318332.743786916, 27 },
-  { 138353093.04075116, 46318514.18819406, 138353059.27361494, 46318492.74570092, 138353126.80788738, 46318535.6306872, 138353091.35239434, 46318513.1160694, 138353094.72910798, 46318515.26031872, 0, 0, 0, 0, 0 },
-  { 138353082.23567867, 46318531.20376925, 138353048.35524115, 46318509.9407508, 138353116.1161162, 46318552.4667877, 138353080.5416568, 46318530.14061833, 138353083.92970055, 46318532.26692017, 0, 0, 0, 0, 0 },
-  { 138353071.4839601, 46318548.33552928, 138353037.55738294, 46318527.14620739, 138353105.41053724, 46318569.52485117, 138353069.78763124, 46318547.27606319, 138353073.18028894, 46318549.39499538, 0, 0, 0, 0, 0 },
-  { 138353060.7399885, 46318565.53788162, 138353026.83309817, 46318544.31707135, 138353094.64687884, 46318586.75869189, 138353059.044644, 46318564.47684111, 138353062.435333, 46318566.59892213, 0, 0, 0, 0, 0 },
-  { 138353049.9581572, 46318582.765233755, 138353016.13671184, 46318561.40850572, 138353083.7796026, 46318604.12196179, 138353048.26708496, 46318581.69739735, 138353051.64922947, 46318583.83307016, 0, 0, 0, 0, 0 },
-  { 138353039.09285927, 46318599.97199316, 138353005.423785, 46318578.37584911, 138353072.76193354, 46318621.56813721, 138353037.40940556, 46318598.89218596, 138353040.77631298, 46318601.05180036, 0, 0, 0, 0, 0 },
-  { 138353028.09848782, 46318617.11256733, 138352994.65108025, 46318595.174679406, 138353061.5458954, 46318639.05045525, 138353026.42611745, 46318616.01567293, 138353029.7708582, 46318618.209461726, 0, 0, 0, 0, 0 },
-  { 138353016.92943606, 46318634.14136372, 138352983.7765154, 46318611.760929145, 138353050.08235672, 46318656.52179829, 138353015.27179003, 46318633.02234199, 138353018.5870821, 46318635.260385446, 0, 0, 0, 0, 0 },
-  { 138353005.54009718, 46318651.01278983, 138352972.75909865, 46318628.09105045, 138353038.3210957, 46318673.93452921, 138353003.90104726, 46318649.86670286, 138353007.1791471, 46318652.1588768, 0, 0, 0, 0, 0 },
-  { 138352993.8848643, 46318667.681253135, 138352961.55883217, 46318644.12222841, 138353026.21089643, 46318691.240277864, 138352992.2685627, 46318666.503301896, 138352995.5011659, 46318668.859204374, 0, 0, 0, 0, 0 },
-  { 138352981.9181306, 46318684.10116111, 138352950.13656995, 46318659.812637046, 138353013.69969127, 46318708.38968517, 138352980.32905257, 46318682.8867349, 138352983.50720865, 46318685.31558731, 1, 0, 138353105.86621723, 46318778.82640495, 39 },
-  { 138352969.5942892, 46318700.22692124, 138352938.45381075, 46318675.121730514, 138353000.73476768, 46318725.33211196, 138352968.0372653, 46318698.9716617, 138352971.15131313, 46318701.482180774, 1, 4, 138352718.13492563, 46318497.502506144, 49 },
-  { 138352956.8677334, 46318716.012941025, 138352926.5080155, 46318689.9689872, 138352987.22745126, 46318742.05689485, 138352955.3497475, 46318714.71074333, 138352958.38571927, 46318717.31513872, 0, 0, 0, 0, 0 },
-  { 138352943.68231145, 46318731.38332959, 138352914.5317618, 46318703.99272071, 138352972.8328611, 46318758.77393848, 138352942.22478396, 46318730.013799146, 138352945.13983893, 46318732.75286004, 0, 0, 0, 0, 0 },
-  { 138352929.9061584, 46318746.044647835, 138352902.6126786, 46318716.80313693, 138352957.1996382, 46318775.28615874, 138352928.5414844, 46318744.58257229, 138352931.2708324, 46318747.50672338, 0, 0, 0, 0, 0 },
-  { 138352915.3743235, 46318759.60839096, 138352890.74233633, 46318728.092280656, 138352940.00631064, 46318791.12450126, 138352914.14272413, 46318758.03258544, 138352916.60592285, 46318761.18419647, 0, 0, 0, 0, 0 },
-  { 138352899.92171717, 46318771.68565547, 138352878.9199774, 46318737.642639644, 138352920.92345694, 46318805.72867129, 138352898.8716302, 46318769.983504675, 138352900.97180414, 46318773.38780626, 0, 0, 0, 0, 0 },
-  { 138352883.38363752, 46318781.88828989, 138352866.6054877, 46318745.57722149, 138352900.16178733, 46318818.19935829, 138352882.54473004, 46318780.07273647, 138352884.222545, 46318783.70384331, 0, 0, 0, 0, 0 },
-  { 138352865.7117389, 46318790.05389271, 138352852.4871696, 46318752.30325343, 138352878.93630823, 46318827.80453199, 138352865.05051044, 46318788.16636074, 138352866.3729674, 46318791.941424675, 0, 0, 0, 0, 0 },
-  { 138352847.13651276, 46318796.56105049, 138352836.48419535, 46318758.00553034, 138352857.78883016, 46318835.11657064, 138352846.6038969, 46318794.63327448, 138352847.66912863, 46318798.4888265, 0, 0, 0, 0, 0 },
-  { 138352827.929351, 46318801.86770392, 138352818.84339112, 46318762.91330323, 138352837.01531088, 46318840.82210461, 138352827.475053, 46318799.919983886, 138352828.383649, 46318803.81542396, 0, 0, 0, 0, 0 },
-  { 138352808.36164588, 46318806.43179374, 138352799.85476655, 46318767.346847735, 138352816.8685252, 46318845.51673975, 138352807.93630192, 46318804.47754644, 138352808.78698984, 46318808.386041045, 0, 0, 0, 0, 0 },
-  { 138352788.7041496, 46318810.71026834, 138352780.07859462, 46318771.65134105, 138352797.32970458, 46318849.76919563, 138352788.27287185, 46318808.757321976, 138352789.13542736, 46318812.663214706, 1, 4, 138352833.34139666, 46319012.840217076, 25 },
-  { 138352769.14368492, 46318815.02989193, 138352760.2594893, 46318776.028980814, 138352778.02788055, 46318854.03080305, 138352768.69947514, 46318813.079846375, 138352769.5878947, 46318816.97993749, 1, 5, 138352730.275329, 46318644.400905795, 40 },
-  { 138352749.70043823, 46318819.45895788, 138352740.48328862, 46318780.53538979, 138352758.91758785, 46318858.38252597, 138352749.23958075, 46318817.512779474, 138352750.1612957, 46318821.40513629, 1, 3, 138352810.99448308, 46319078.30068571, 47 },
-  { 138352730.37493393, 46318824.03526147, 138352720.75052637, 46318785.210388266, 138352739.9993415, 46318862.86013467, 138352729.89371356, 46318822.0940178, 138352730.8561543, 46318825.97650513, 0, 0, 0, 0, 0 },
-  { 138352711.1676963, 46318828.7965979, 138352701.0621458, 46318790.09417098, 138352721.2732468, 46318867.499024816, 138352710.66241878, 46318826.861476555, 138352711.6729738, 46318830.73171924, 0, 0, 0, 0, 0 },
-  { 138352692.07924965, 46318833.780762374, 138352681.4195708, 46318795.22727683, 138352702.7389285, 46318872.33424792, 138352691.54626572, 46318831.853088096, 138352692.61223358, 46318835.70843665, 0, 0, 0, 0, 0 },
-  { 138352673.1101183, 46318839.025550105, 138352661.82478282, 46318800.650542565, 138352684.39545378, 46318877.400557645, 138352672.54585153, 46318837.10679973, 138352673.67438507, 46318840.94430048, 0, 0, 0, 0, 0 },
-  { 138352654.2608266, 46318844.56875632, 138352642.28040102, 46318806.40503791, 138352666.24125215, 46318882.73247473, 138352653.6618053, 46318842.6605704, 138352654.85984787, 46318846.47694224, 0, 0, 0, 0, 0 },
-  { 138352635.53189883, 46318850.44817621, 138352622.78975964, 46318812.53198061, 138352648.27403802, 46318888.364371814, 138352634.89479187, 46318848.552366436, 138352636.16900578, 46318852.34398599, 1, 1, 138352675.98819074, 46318970.832097255, 38 },
-  { 138352616.92385927, 46318856.70160502, 138352603.35782084, 46318819.0723265, 138352630.4898977, 46318894.33088354, 138352616.24555734, 46318854.8201411, 138352617.6021612, 46318858.583068945, 0, 0, 0, 0, 0 },
-  { 138352598.43730596, 46318863.36634329, 138352584.02281046, 46318826.053847805, 138352612.85180146, 46318900.678838775, 138352597.7165812, 46318861.50071851, 138352599.15803072, 46318865.23196807, 1, 4, 138352664.0232605, 46319033.13819775, 32 },
-  { 138352580.07580924, 46318870.45972336, 138352564.83377275, 46318833.47756113, 138352595.31784573, 46318907.44188559, 138352579.3137074, 46318868.610615246, 138352580.83791107, 46318872.308831476, 0, 0, 0, 0, 0 },
-  { 138352561.84686545, 46318877.97270286, 138352545.8005869, 46318841.332329705, 138352577.89314398, 46318914.61307602, 138352561.04455152, 46318876.1406842, 138352562.64917937, 46318879.80472152, 1, 4, 138352628.03776446, 46319029.114242114, 35 },
-  { 138352543.75824007, 46318885.89443226, 138352526.9302753, 46318849.60642321, 138352560.58620486, 46318922.18244132, 138352542.91684183, 46318884.08003181, 138352544.5996383, 46318887.70883271, 0, 0, 0, 0, 0 },
-  { 138352525.8176985, 46318894.214062065, 138352508.22982576, 46318858.2882116, 138352543.40557125, 46318930.13991253, 138352524.93830487, 46318892.417769544, 138352526.69709215, 46318896.010354586, 0, 0, 0, 0, 0 },
-  { 138352508.03300613, 46318902.9207427, 138352489.70620078, 46318867.36616205, 138352526.35981148, 46318938.47532335, 138352507.11666587, 46318901.14301366, 138352508.9493464, 46318904.69847173, 0, 0, 0, 0, 0 },
-  { 138352490.41192847, 46318912.00362469, 138352471.36634701, 46318876.82883505, 138352509.45750993, 46318947.17841434, 138352489.4596494, 46318910.24488521, 138352491.36420754, 46318913.76236417, 1, 4, 138352678.96318498, 46319260.23404218, 42 },
-  { 138352472.9622309, 46318921.451858506, 138352453.21720138, 46318886.66488091, 138352492.7072604, 46318956.2388361, 138352471.97497943, 46318919.712509625, 138352473.94948235, 46318923.19120739, 1, 4, 138352423.10603142, 46318833.61474008, 37 },
-  { 138352455.6916788, 46318931.254594594, 138352435.26569796, 46318896.86303595, 138352476.11765963, 46318965.64615324, 138352454.67037976, 46318929.53501666, 138352456.71297783, 46318932.974172525, 1, 3, 138352611.9504323, 46319194.35001826, 46 },
-  { 138352438.6080376, 46318941.40098347, 138352417.5187733, 46318907.41211865, 138352459.6973019, 46318975.389848284, 138352437.55357438, 46318939.701540224, 138352439.6625008, 46318943.10042671, 0, 0, 0, 0, 0 },
-  { 138352421.71907273, 46318951.88017557, 138352399.98337102, 46318918.30102622, 138352443.45477444, 46318985.45932492, 138352420.63228765, 46318950.2012181, 138352422.8058578, 46318953.55913304, 0, 0, 0, 0, 0 },
-  { 138352405.03254962, 46318962.6813214, 138352382.66635475, 46318929.518792436, 138352427.3987445, 46318995.84385036, 138352403.91423988, 46318961.02319495, 138352406.15085936, 46318964.33944785, 0, 0, 0, 0, 0 },
-  { 138352388.55617455, 46318973.79367703, 138352365.5724936, 46318941.0560777, 138352411.53985548, 46319006.53127637, 138352387.4069905, 46318972.15679707, 138352389.7053586, 46318975.430557, 0, 0, 0, 0, 0 },
-  { 138352372.29617643, 46318985.209132545, 138352348.70544264, 46318952.906233616, 138352395.88691023, 46319017.51203147, 138352371.11663973, 46318983.5939876, 138352373.47571313, 46318986.82427749, 1, 3, 138352147.59443703, 46318677.52402028, 42 },
-  { 138352356.25724053, 46318996.92233104, 138352332.06970257, 46318965.06384697, 138352380.4447785, 46319028.78081512, 138352355.04786363, 46318995.32940684, 138352357.46661744, 46318998.51525524, 0, 0, 0, 0, 0 },
-  { 138352340.44397935, 46319008.92804526, 138352315.66981182, 46318977.523577064, 138352365.2181469, 46319040.33251345, 138352339.20527098, 46319007.357821845, 138352341.68268773, 46319010.49826867, 0, 0, 0, 0, 0 },
-  { 138352324.86100546, 46319021.22104776, 138352299.51030898, 46318990.28010098, 138352350.21170193, 46319052.16199454, 138352323.59347063, 46319019.67400042, 138352326.12854028, 46319022.7680951, 0, 0, 0, 0, 0 },
-  { 138352309.51293132, 46319033.79611121, 138352283.59573424, 46319003.32811333, 138352335.4301284, 46319064.26410909, 138352308.21707147, 46319032.272711314, 138352310.80879116, 46319035.31951111, 1, 2, 138352179.92694587, 46318881.4561218, 31 },
-  { 138352294.4043696, 46319046.64800826, 138352267.9306314, 46319016.66232525, 138352320.8781078, 46319076.633691266, 138352293.0806827, 46319045.14872411, 138352295.7280565, 46319048.147292405, 1, 5, 138352489.64818886, 46319267.792420425, 42 },
-  { 138352279.53993276, 46319059.77151154, 138352252.51954833, 46319030.277464256, 138352306.5603172, 46319089.265558824, 138352278.18891352, 46319058.296809174, 138352280.890952, 46319061.246213906, 1, 1, 138352168.080847, 46318938.108566485, 38 },
-  { 138352264.92423335, 46319073.16139367, 138352237.36703864, 46319044.168273464, 138352292.48142806, 46319102.15451388, 138352263.5463736, 46319071.71173766, 138352266.3020931, 46319074.61104968, 0, 0, 0, 0, 0 },
-  { 138352250.56188393, 46319086.81242732, 138352222.4776631, 46319058.32951069, 138352278.64610475, 46319115.29534395, 138352249.15767288, 46319085.38828149, 138352251.96609497, 46319088.23657315, 0, 0, 0, 0, 0 },
-  { 138352236.45749694, 46319100.719385095, 138352207.85598984, 46319072.7559484, 138352265.05900404, 46319128.68282179, 138352235.0274216, 46319099.32121326, 138352237.8875723, 46319102.11755693, 0, 0, 0, 0, 0 },
-  { 138352222.61568516, 46319114.877039686, 138352193.5065975, 46319087.442371584, 138352251.72477284, 46319142.31170779, 138352221.1602308, 46319113.50530628, 138352224.07113954, 46319116.24877309, 0, 0, 0, 0, 0 },
-  { 138352209.04106095, 46319129.28016368, 138352179.4340737, 46319102.38357831, 138352238.64804822, 46319156.17674906, 138352207.5607116, 46319127.935334414, 138352210.52141032, 46319130.62499295, 0, 0, 0, 0, 0 },
-  { 138352195.7382368, 46319143.92352973, 138352165.64301756, 46319117.57437836, 138352225.83345607, 46319170.2726811, 138352194.23347586, 46319142.60607216, 138352197.24299777, 46319145.2409873, 0, 0, 0, 0, 0 },
-  { 138352182.71182543, 46319158.80191048, 138352152.13804537, 46319133.009586565, 138352213.2856055, 46319184.5942344, 138352181.18313643, 46319157.512294285, 138352184.24051443, 46319160.09152668, 0, 0, 0, 0, 0 },
-  { 138352169.96643606, 46319173.91007727, 138352138.9300095, 46319148.67636516, 138352201.0028626, 46319199.14378937, 138352168.41461474, 46319172.648391664, 138352171.51825738, 46319175.17176287, 0, 0, 0, 0, 0 },
-  { 138352157.50195262, 46319189.24087851, 138352126.03691086, 46319164.543689445, 138352188.96699437, 46319213.93806757, 138352155.92870054, 46319188.006019056, 138352159.0752047, 46319190.47573796, 0, 0, 0, 0, 0 },
-  { 138352145.30406925, 46319204.781388335, 138352113.44658357, 46319180.59253541, 138352177.16155493, 46319228.97024126, 138352143.71119496, 46319203.57194569, 138352146.89694354, 46319205.99083098, 0, 0, 0, 0, 0 },
-  { 138352133.35582733, 46319220.5176015, 138352101.14062023, 46319196.80725709, 138352165.57103443, 46319244.2279459, 138352131.74506697, 46319219.332084276, 138352134.9665877, 46319221.70311872, 0, 0, 0, 0, 0 },
-  { 138352121.6402684, 46319236.43551274, 138352089.1006124, 46319213.17243493, 138352154.17992437, 46319259.69859054, 138352120.01328558, 46319235.27235885, 138352123.2672512, 46319237.59866662, 0, 0, 0, 0, 0 },
-  { 138352110.1404339, 46319252.52111675, 138352077.30817866, 46319229.67285608, 138352142.97268915, 46319275.36937742, 138352108.49882114, 46319251.37870371, 138352111.78204668, 46319253.66352978, 0, 0, 0, 0, 0 },
-  { 138352098.83936536, 46319268.76040832, 138352065.7449891, 46319246.293493554, 138352131.93374163, 46319291.227323085, 138352097.18464655, 46319267.63706258, 138352100.49408418, 46319269.88375406, 1, 1, 138351953.22410977, 46319169.90598334, 31 },
-  { 138352087.7201043, 46319285.13938216, 138352054.3927859, 46319263.019485034, 138352121.0474227, 46319307.25927929, 138352086.0537384, 46319284.0333873, 138352089.38647023, 46319286.24537702, 0, 0, 0, 0, 0 },
-  { 138352076.76569223, 46319301.644033015, 138352043.23340026, 46319279.83611257, 138352110.2979842, 46319323.45195346, 138352075.08907762, 46319300.55363699, 138352078.44230685, 46319302.73442904, 0, 0, 0, 0, 0 },
-  { 138352065.95917052, 46319318.260355614, 138352032.24876532, 46319296.7287839, 138352099.66957572, 46319339.79192733, 138352064.27365026, 46319317.18377703, 138352067.64469078, 46319319.3369342, 1, 5, 138352339.0134527, 46319492.66608652, 37 },
-  { 138352055.2835808, 46319334.974344715, 138352021.4209287, 46319313.68301335, 138352089.14623293, 46319356.26567608, 138352053.5904482, 46319333.90977815, 138352056.97671342, 46319336.03891128, 0, 0, 0, 0, 0 },
-  { 138352044.7219645, 46319351.771995015, 138352010.73205963, 46319330.684407026, 138352078.7118694, 46319372.859583005, 138352043.02246925, 46319350.71761562, 138352046.42145976, 46319352.82637441, 0, 0, 0, 0, 0 },
-  { 138352034.25736314, 46319368.63930128, 138352000.1644568, 46319347.71864791, 138352068.35026947, 46319389.55995464, 138352032.55271783, 46319367.59326861, 138352035.96200845, 46319369.685333945, 0, 0, 0, 0, 0 },
-  { 138352023.87281823, 46319385.56225826, 138351989.7005532, 46319364.77148378, 138352058.04508325, 46319406.35303274, 138352022.16420498, 46319384.52271953, 138352025.58143148, 46319386.601796985, 0, 0, 0, 0, 0 },
-  { 138352013.55137122, 46319402.52686066, 138351979.32291993, 46319381.82871768, 138352047.7798225, 46319423.225003645, 138352011.83994865, 46319401.491953515, 138352015.26279378, 46319403.56176781, 0, 0, 0, 0, 0 },
-  { 138352003.2760636, 46319419.51910324, 138351969.0142694, 46319398.87619987, 138352037.53785777, 46319440.1620066, 138352001.5629739, 46319418.48695807, 138352004.9891533, 46319420.5512484, 0, 0, 0, 0, 0 },
-  { 138351993.02993685, 46319436.524980724, 138351958.75745738, 46319415.89982251, 138352027.30241632, 46319457.15013894, 138351991.31631288, 46319435.49372281, 138351994.74356082, 46319437.55623864, 1, 4, 138351870.50582278, 46319362.790040106, 33 },
-  { 138351982.79603255, 46319453.53048785, 138351948.53548464, 46319432.885516115, 138352017.05658045, 46319474.175459586, 138351981.08300516, 46319452.498239264, 138351984.50905994, 46319454.56273644, 0, 0, 0, 0, 0 },
-  { 138351972.55739215, 46319470.52161936, 138351938.33149752, 46319449.819249034, 138352006.78328678, 46319491.22398968, 138351970.8460974, 46319469.486500844, 138351974.2686869, 46319471.55673787, 0, 0, 0, 0, 0 },
-  { 138351962.29705712, 46319487.48437, 138351928.12878832, 46319466.687028654, 138351996.46532592, 46319508.28171135, 138351960.58864367, 46319486.444502935, 138351964.00547057, 46319488.52423707, 1, 1, 138352104.94957936, 46319574.31327014, 46 },
-  { 138351951.99806896, 46319504.404734485, 138351917.91079506, 46319483.47490508, 138351986.08534285, 46319525.33456389, 138351950.29370525, 46319503.35824301, 138351953.70243266, 46319505.45122596, 0, 0, 0, 0, 0 },
-  { 138351941.64346915, 46319521.26870756, 138351907.66110045, 46319500.16897729, 138351975.62583786, 46319542.36843783, 138351939.94435072, 46319520.213721044, 138351943.3425876, 46319522.32369407, 0, 0, 0, 0, 0 },
-  { 138351931.21629924, 46319538.06228398, 138351897.36343002, 46319516.755401365, 138351965.06916845, 46319559.36916659, 138351929.52365577, 46319536.996939845, 138351932.9089427, 46319539.12762811, 0, 0, 0, 0, 0 },
-  { 138351920.69960073, 46319554.771458454, 138351887.00164932, 46319533.22040115, 138351954.39755213, 46319576.322515756, 138351919.01470315, 46319553.69390559, 138351922.3844983, 46319555.84901132, 0, 0, 0, 0, 0 },
-  { 138351910.07641497, 46319571.38222573, 138351876.5597587, 46319549.55028236, 138351943.59307125, 46319593.2141691, 138351908.40058216, 46319570.29062856, 138351911.75224778, 46319572.4738229, 1, 2, 138351635.2398334, 46319392.360290095, 33 },
-  { 138351899.32978365, 46319587.88058056, 138351866.02188888, 46319565.73144634, 138351932.6376784, 46319610.02971478, 138351897.66438892, 46319586.773123845, 138351900.99517837, 46319588.98803727, 0, 0, 0, 0, 0 },
-  { 138351888.44274816, 46319604.25251766, 138351855.37229142, 46319581.7504091, 138351921.5132049, 46319626.75462623, 138351886.7892253, 46319603.12741224, 138351890.096271, 46319605.37762309, 0, 0, 0, 0, 0 },
-  { 138351877.39834997, 46319620.484031774, 138351844.59532836, 46319597.59382048, 138351910.20137158, 46319643.374243066, 138351875.7581989, 46319619.33952121, 138351879.03850105, 46319621.62854234, 0, 0, 0, 0, 0 },
-  { 138351866.17963064, 46319636.56111766, 138351833.67545903, 46319613.24848529, 138351898.68380225, 46319659.87375002, 138351864.55442205, 46319635.395486034, 138351867.80483922, 46319637.72674928, 0, 0, 0, 0, 0 },
-  { 138351854.76963168, 46319652.46977002, 138351822.6102139, 46319628.68381099, 138351886.92904946, 46319676.25572906, 138351853.1616608, 46319651.28047207, 138351856.37760258, 46319653.65906797, 0, 0, 0, 0, 0 },
-  { 138351843.14073431, 46319668.19243096, 138351811.6420342, 46319643.53818405, 138351874.63943443, 46319692.84667787, 138351841.5657993, 46319666.959718615, 138351844.71566933, 46319669.4251433, 0, 0, 0, 0, 0 },
-  { 138351831.04998872, 46319683.63978051, 138351800.8040422, 46319657.46378543, 138351861.29593524, 46319709.81577558, 138351829.53769138, 46319682.330980755, 138351832.56228605, 46319684.94858026, 0, 0, 0, 0, 0 },
-  { 138351818.054498, 46319698.65586363, 138351789.7924561, 46319670.34938049, 138351846.31653988, 46319726.96234676, 138351816.6413959, 46319697.24053947, 138351819.46760008, 46319700.07118779, 0, 0, 0, 0, 0 },
-  { 138351803.7030512, 46319712.984778605, 138351780.4135502, 46319680.4640292, 138351826.99255222, 46319745.50552801, 138351802.53857616, 46319711.358741134, 138351804.86752626, 46319714.61081608, 0, 0, 0, 0, 0 },
-  { 138351787.53080466, 46319724.56641677, 138351776.18733615, 46319686.20855288, 138351798.87427318, 46319762.92428066, 138351786.96363124, 46319722.64852358, 138351788.0979781, 46319726.484309964, 0, 0, 0, 0, 0 },
-  { 138351769.13188386, 46319730.00748041, 138351769.855383, 46319690.01402409, 138351768.4083847, 46319770.00093674, 138351769.1680588, 46319728.0078076, 138351769.0957089, 46319732.00715323, 1, 4, 138351765.44203827, 46319933.97410768, 40 },
-  { 138351749.1439373, 46319729.64588971, 138351755.0480946, 46319690.084027685, 138351743.23977998, 46319769.20775173, 138351749.43914515, 46319727.667796604, 138351748.84872943, 46319731.62398281, 0, 0, 0, 0, 0 },
-  { 138351728.99355522, 46319726.63867469, 138351739.237133, 46319687.97255109, 138351718.74997744, 46319765.30479829, 138351729.50573412, 46319724.70536851, 138351728.48137632, 46319728.57198087, 0, 0, 0, 0, 0 },
-  { 138351709.89432833, 46319721.57883424, 138351729.92688185, 46319686.956633285, 138351689.8617748, 46319756.2010352, 138351710.895956, 46319719.84772419, 138351708.89270064, 46319723.309944294, 1, 3, 138351808.0538406, 46319551.93004955, 34 },
-  { 138351692.7977214, 46319711.68666436, 138351722.5223699, 46319684.920169055, 138351663.07307288, 46319738.45315966, 138351694.28395382, 46319710.348339595, 138351691.31148896, 46319713.02498912, 1, 4, 138351480.2664845, 46319903.06710576, 50 },
-  { 138351679.4144053, 46319696.82426409, 138351716.06982508, 46319680.812387265, 138351642.7589855, 46319712.83614091, 138351681.2471763, 46319696.02367025, 138351677.58163428, 46319697.624857925, 0, 0, 0, 0, 0 },
-  { 138351671.6061195, 46319678.949033335, 138351711.03395778, 46319672.20770046, 138351632.17828125, 46319685.69036621, 138351673.57751143, 46319678.61196669, 138351669.6347276, 46319679.28609998, 0, 0, 0, 0, 0 },
-  { 138351668.2582688, 46319659.368555866, 138351708.18360186, 46319656.92565152, 138351628.33293575, 46319661.81146021, 138351670.25453547, 46319659.246410646, 138351666.26200214, 46319659.49070109, 0, 0, 0, 0, 0 },
-  { 138351667.01801974, 46319639.09868443, 138351706.95842463, 46319636.91601268, 138351627.07761484, 46319641.28135618, 138351669.01503998, 46319638.989550844, 138351665.0209995, 46319639.20781802, 0, 0, 0, 0, 0 },
-  { 138351665.92046314, 46319619.01464992, 138351705.88334048, 46319617.29173498, 138351625.9575858, 46319620.73756486, 138351667.918607, 46319618.92850418, 138351663.9223193, 46319619.100795664, 1, 4, 138352002.6077046, 46319604.499091506, 49 },
-  { 138351665.06854898, 46319599.254567474, 138351705.06692165, 46319599.61537773, 138351625.0701763, 46319598.89375722, 138351667.06846762, 46319599.27260799, 138351663.06863034, 46319599.23652696, 0, 0, 0, 0, 0 },
-  { 138351665.24481434, 46319579.714304015, 138351705.05319238, 46319583.624935284, 138351625.4364363, 46319575.803672746, 138351667.23523325, 46319579.90983558, 138351663.25439543, 46319579.51877245, 1, 1, 138351780.6891107, 46319591.05513469, 41 },
-  { 138351667.15244967, 46319560.29547794, 138351706.48452008, 46319567.57477988, 138351627.82037926, 46319553.016176, 138351669.11905318, 46319560.659443036, 138351665.18584615, 46319559.93151285, 0, 0, 0, 0, 0 },
-  { 138351670.73164222, 46319540.956116214, 138351709.561302, 46319550.56119407, 138351631.90198243, 46319531.35103836, 138351672.6731252, 46319541.436370105, 138351668.79015923, 46319540.475862324, 1, 5, 138351990.10559398, 46319619.95788156, 32 },
-  { 138351675.4984833, 46319521.68559906, 138351713.9716378, 46319532.6316661, 138351637.02532881, 46319510.739532016, 138351677.42214102, 46319522.23290241, 138351673.57482558, 46319521.13829571, 0, 0, 0, 0, 0 },
-  { 138351680.96451172, 46319502.47364329, 138351719.30569494, 46319513.873365685, 138351642.6233285, 46319491.07392089, 138351682.88157088, 46319503.04362941, 138351679.04745257, 46319501.90365717, 1, 0, 138351822.82688957, 46319544.65261614, 30 },
-  { 138351686.66222388, 46319483.31027966, 138351724.97720805, 46319494.79775053, 138351648.3472397, 46319471.82280879, 138351688.5779731, 46319483.8846532, 138351684.74647465, 46319482.73590612, 0, 0, 0, 0, 0 },
-  { 138351692.39492375, 46319464.18959528, 138351730.68847144, 46319475.74832379, 138351654.10137606, 46319452.63086677, 138351694.30960113, 46319464.76753171, 138351690.48024637, 46319463.611658856, 0, 0, 0, 0, 0 },
-  { 138351698.15446275, 46319445.10850158, 138351736.42930606, 46319456.729016654, 138351659.87961945, 46319433.48798651, 138351700.0682049, 46319445.68952734, 138351696.2407206, 46319444.52747583, 1, 2, 138351463.72104755, 46319373.93284676, 38 },
-  { 138351703.93651906, 46319426.0639672, 138351742.1954529, 46319437.73675528, 138351665.6775852, 46319414.391179115, 138351705.84946576, 46319426.647606604, 138351702.02357236, 46319425.48032779, 0, 0, 0, 0, 0 },
-  { 138351709.7367708, 46319407.05296088, 138351747.9826448, 46319418.76846868, 138351671.49089682, 46319395.33745308, 138351711.6490645, 46319407.63873627, 138351707.8244771, 46319406.46718549, 0, 0, 0, 0, 0 },
-  { 138351715.55089623, 46319388.072451286, 138351753.78660634, 46319399.821088314, 138351677.3151861, 46319376.32381426, 138351717.46268174, 46319388.659883134, 138351713.6391107, 46319387.48501944, 0, 0, 0, 0, 0 },
-  { 138351721.3745735, 46319369.11940716, 138351759.6030537, 46319380.89154813, 138351683.1460933, 46319357.3472662, 138351723.2859975, 46319369.70801421, 138351719.4631495, 46319368.53080011, 0, 0, 0, 0, 0 },
-  { 138351727.20348075, 46319350.19079715, 138351765.42769417, 46319361.97678491, 138351688.97926733, 46319338.40480939, 138351729.11469144, 46319350.78009654, 138351725.29227006, 46319349.60149776, 0, 0, 0, 0, 0 },
-  { 138351733.03329626, 46319331.28358998, 138351771.25622687, 46319343.07373739, 138351694.81036565, 46319319.49344257, 138351734.94444278, 46319331.87309735, 138351731.12214974, 46319330.69408261, 0, 0, 0, 0, 0 },
-  { 138351738.85969818, 46319312.394754365, 138351777.0843418, 46319324.17934684, 138351700.63505456, 46319300.61016189, 138351740.77093035, 46319312.983983986, 138351736.948466, 46319311.805524744, 0, 0, 0, 0, 0 },
-  { 138351744.67836463, 46319293.52125897, 138351782.9077201, 46319305.29055722, 138351706.44900918, 46319281.751960725, 138351746.5898324, 46319294.10972389, 138351742.76689687, 46319292.93279406, 0, 0, 0, 0, 0 },
-  { 138351750.48497388, 46319274.66007251, 138351788.72203416, 46319286.404314585, 138351712.2479136, 46319262.91583044, 138351752.3968269, 46319275.24728461, 138351748.57312086, 46319274.07286041, 0, 0, 0, 0, 0 },
-  { 138351756.27520406, 46319255.8081637, 138351794.52294725, 46319267.51756768, 138351718.02746087, 46319244.098759726, 138351758.18759122, 46319256.3936339, 138351754.3628169, 46319255.2226935, 0, 0, 0, 0, 0 },
-  { 138351762.04473338, 46319236.9625012, 138351800.30611363, 46319248.627267845, 138351723.78335312, 46319225.29773455, 138351763.95780239, 46319237.54573953, 138351760.13166437, 46319236.379262865, 0, 0, 0, 0, 0 },
-  { 138351767.78924, 46319218.12005375, 138351806.0671785, 46319229.730369195, 138351729.51130152, 46319206.50973831, 138351769.70313692, 46319218.700569525, 138351765.87534308, 46319217.53953798, 0, 0, 0, 0, 0 },
-  { 138351773.50440216, 46319199.277790025, 138351811.801778, 46319210.82382847, 138351735.20702633, 46319187.731751576, 138351775.41927096, 46319199.855091944, 138351771.58953336, 46319198.700488105, 0, 0, 0, 0, 0 },
-  { 138351779.18589795, 46319180.43267874, 138351817.5055389, 46319191.90460608, 138351740.86625698, 46319168.96075139, 138351781.10187998, 46319181.0062751, 138351777.2699159, 46319179.85908237, 0, 0, 0, 0, 0 },
-  { 138351784.82940567, 46319161.58168857, 138351823.17407933, 46319172.96966477, 138351746.484732, 46319150.19371237, 138351786.74663934, 46319162.15108738, 138351782.912172, 46319161.012289755, 0, 0, 0, 0, 0 },
-  { 138351790.43060333, 46319142.72178821, 138351828.8030076, 46319154.01597206, 138351752.05819905, 46319131.42760436, 138351792.34922355, 46319143.28649741, 138351788.5119831, 46319142.15707902, 0, 0, 0, 0, 0 },
-  { 138351795.9851693, 46319123.84994641, 138351834.38792378, 46319135.04049814, 138351757.5824148, 46319112.65939468, 138351797.90530702, 46319124.40947399, 138351794.06503156, 46319123.290418826, 0, 0, 0, 0, 0 },
-  { 138351801.4887817, 46319104.96313181, 138351839.9244184, 46319116.04021769, 138351763.053145, 46319093.886045925, 138351803.41056353, 46319105.5169861, 138351799.56699985, 46319104.40927751, 0, 0, 0, 0, 0 },
-  { 138351806.93711865, 46319086.05831314, 138351845.40807307, 46319097.01211006, 138351768.46616423, 46319075.104516216, 138351808.86066636, 46319086.60600299, 138351805.01357093, 46319085.51062329, 1, 2, 138351905.03805238, 46319113.990495294, 43 },
-  { 138351812.3258584, 46319067.1324591, 138351850.8344608, 46319077.95315886, 138351773.81725603, 46319056.31175933, 138351814.25128853, 46319067.673494086, 138351810.4004283, 46319066.59142411, 0, 0, 0, 0, 0 },
-  { 138351817.6506791, 46319048.18253835, 138351856.1991456, 46319058.86035331, 138351779.10221264, 46319037.50472339, 138351819.57810244, 46319048.7164291, 138351815.72325578, 46319047.64864761, 0, 0, 0, 0, 0 },
-  { 138351822.90725902, 46319029.20551965, 138351861.49768323, 46319039.73068751, 138351784.3168348, 46319018.68035179, 138351824.83678022, 46319029.73177804, 138351820.9777378, 46319028.67926125, 0, 0, 0, 0, 0 },
-  { 138351828.09127623, 46319010.19837164, 138351866.72562078, 46319020.56116191, 138351789.45693168, 46318999.83558137, 138351830.02299345, 46319010.71651115, 138351826.159559, 46319009.68023213, 0, 0, 0, 0, 0 },
-  { 138351833.19840893, 46318991.15806307, 138351871.92382237, 46319001.17516616, 138351794.4729955, 46318981.14095998, 138351835.13467962, 46318991.658918224, 138351831.26213825, 46318990.65720791, 0, 0, 0, 0, 0 },
-  { 138351838.13869435, 46318972.0592684, 138351877.1634493, 46318980.838135116, 138351799.1139394, 46318963.280401684, 138351840.08993208, 46318972.498211734, 138351836.1874566, 46318971.620325066, 1, 0, 138352007.8963784, 46319010.247338615, 36 },
-  { 138351842.47431433, 46318952.78610787, 138351881.94934306, 46318959.24537318, 138351802.9992856, 46318946.326842554, 138351844.44806576, 46318953.109071136, 138351840.5005629, 46318952.4631446, 0, 0, 0, 0, 0 },
-  { 138351845.67909044, 46318933.20050135, 138351885.56005943, 46318936.2840567, 138351805.79812145, 46318930.116946004, 138351847.6731389, 46318933.35467912, 138351843.685042, 46318933.04632358, 1, 4, 138352110.8875341, 46318953.70614443, 30 },
-  { 138351847.21659708, 46318913.31525603, 138351887.19253826, 46318911.92812704, 138351807.2406559, 46318914.702385016, 138351849.21539414, 46318913.24589958, 138351845.21780002, 46318913.38461248, 0, 0, 0, 0, 0 },
-  { 138351846.52806216, 46318893.472233795, 138351885.902433, 46318886.425325274, 138351807.15369132, 46318900.519142315, 138351848.4967807, 46318893.119888365, 138351844.55934364, 46318893.824579224, 0, 0, 0, 0, 0 },
-  { 138351843.05317035, 46318874.05638946, 138351880.8400176, 46318860.93563579, 138351805.26632312, 46318887.17714313, 138351844.94251272, 46318873.40035178, 138351841.163828, 46318874.71242714, 0, 0, 0, 0, 0 },
-  { 138351836.57019448, 46318855.38587518, 138351872.30224663, 46318837.407542385, 138351800.83814234, 46318873.364207976, 138351838.3567971, 46318854.48695854, 138351834.78359187, 46318856.28479182, 0, 0, 0, 0, 0 },
-  { 138351827.6342266, 46318837.62558148, 138351860.67826584, 46318815.08469709, 138351794.59018734, 46318860.16646587, 138351829.28642854, 46318836.49853726, 138351825.98202464, 46318838.752625704, 0, 0, 0, 0, 0 },
-  { 138351816.46753052, 46318821.25564954, 138351843.26863155, 46318791.56219937, 138351789.6664295, 46318850.949099705, 138351817.80758557, 46318819.77097703, 138351815.12747547, 46318822.740322046, 0, 0, 0, 0, 0 },
-  { 138351801.7681781, 46318807.98811656, 138351818.90625763, 46318771.84553461, 138351784.63009858, 46318844.13069852, 138351802.62508208, 46318806.18098746, 138351800.91127414, 46318809.79524566, 1, 2, 138351701.51041287, 46319019.42222098, 31 },
-  { 138351783.73368898, 46318799.43652749, 138351789.1642351, 46318759.80687737, 138351778.30314288, 46318839.066177614, 138351784.00521627, 46318797.455044985, 138351783.4621617, 46318801.41801, 1, 4, 138351798.5319271, 46318691.4457309, 42 },
-  { 138351764.02701315, 46318796.73607439, 138351758.1354614, 46318757.17233319, 138351769.91856492, 46318836.29981559, 138351763.73243555, 46318794.757887326, 138351764.32159075, 46318798.71426145, 0, 0, 0, 0, 0 },
-  { 138351744.39313945, 46318799.65981162, 138351729.66050234, 46318762.47178393, 138351759.12577656, 46318836.84783932, 138351743.65650758, 46318797.80041024, 138351745.12977132, 46318801.519213006, 1, 1, 138351602.22319135, 46318440.795344375, 36 },
-  { 138351726.02434543, 46318806.93690571, 138351707.2771726, 46318771.60217053, 138351744.77151826, 46318842.2716409, 138351725.08698678, 46318805.17016895, 138351726.96170408, 46318808.70364247, 1, 5, 138351897.5609769, 46319130.24973266, 33 },
-  { 138351708.48804864, 46318816.24095129, 138351687.69701347, 46318782.068844885, 138351729.27908382, 46318850.4130577, 138351707.44849688, 46318814.53234597, 138351709.5276004, 46318817.94955661, 1, 1, 138351598.8153381, 46318635.98308999, 27 },
-  { 138351691.51970786, 46318826.564850144, 138351668.86061004, 46318793.601760395, 138351714.17880568, 46318859.52793989, 138351690.38675296, 46318824.916695654, 138351692.65266275, 46318828.213004634, 1, 4, 138351887.52090406, 46319111.69557645, 44 },
-  { 138351675.1377349, 46318837.825952515, 138351650.75559634, 46318806.116154045, 138351699.51987344, 46318869.535750985, 138351673.91862795, 46318836.240462594, 138351676.35684183, 46318839.41144244, 0, 0, 0, 0, 0 },
-  { 138351659.36442268, 46318849.95428831, 138351633.39486265, 46318819.53090993, 138351685.3339827, 46318880.37766669, 138351658.06594467, 46318848.433119394, 138351660.6629007, 46318851.47545723, 1, 5, 138351746.36244875, 46318951.87260589, 36 },
-  { 138351644.22206402, 46318862.87988741, 138351616.79034758, 46318833.76801812, 138351671.65378046, 46318891.9917567, 138351642.8504782, 46318861.42429394, 138351645.59364983, 46318864.335480876, 0, 0, 0, 0, 0 },
-  { 138351629.73295182, 46318876.532779746, 138351600.95369104, 46318848.7523163, 138351658.5122126, 46318904.31324319, 138351628.2939888, 46318875.143756576, 138351631.17191485, 46318877.921802916, 1, 3, 138351882.27096516, 46319120.30634644, 40 },
-  { 138351615.9193789, 46318890.8429952, 138351585.89671627, 46318864.41120129, 138351645.94204155, 46318917.2747891, 138351614.41824576, 46318889.5214055, 138351617.42051205, 46318892.16458489, 1, 5, 138351437.2845363, 46318733.57382148, 50 },
-  { 138351602.80363816, 46318905.74056367, 138351571.64500457, 46318880.65790926, 138351633.96227175, 46318930.82321808, 138351601.24570647, 46318904.48643095, 138351604.36156985, 46318906.994696386, 0, 0, 0, 0, 0 },
-  { 138351590.3927299, 46318921.15786905, 138351558.2518122, 46318897.3469176, 138351622.53364763, 46318944.9688205, 138351588.78568402, 46318919.96732148, 138351591.9997758, 46318922.34841662, 1, 2, 138351448.16916904, 46318815.7944089, 30 },
-  { 138351578.6287882, 46318937.03727996, 138351545.6624307, 46318914.382936604, 138351611.5951457, 46318959.69162332, 138351576.98047033, 46318935.90456279, 138351580.27710608, 46318938.16999713, 0, 0, 0, 0, 0 },
-  { 138351567.43675134, 46318953.323811986, 138351533.78860673, 46318931.69507268, 138351601.08489594, 46318974.95255129, 138351565.7543441, 46318952.24237502, 138351569.11915857, 46318954.40524895, 0, 0, 0, 0, 0 },
-  { 138351556.74155754, 46318969.96248068, 138351522.54195207, 46318949.216710344, 138351590.941163, 46318990.708251014, 138351555.03157726, 46318968.92519216, 138351558.45153782, 46318970.999769196, 0, 0, 0, 0, 0 },
-  { 138351546.4681451, 46318986.89830163, 138351511.8349681, 46318966.88473, 138351581.1013221, 46319006.911873266, 138351544.73648626, 46318985.89762305, 138351548.19980395, 46318987.898980215, 0, 0, 0, 0, 0 },
-  { 138351536.5414523, 46319004.07629043, 138351501.58175883, 46318984.63870225, 138351571.50114575, 46319023.513878606, 138351534.7934676, 46319003.10441102, 138351538.28943697, 46319005.04816984, 0, 0, 0, 0, 0 },
-  { 138351526.88641724, 46319021.44146261, 138351491.69849363, 46319002.42015792, 138351562.07434085, 46319040.46276731, 138351525.12702107, 46319020.49039738, 138351528.6458134, 46319022.39252785, 0, 0, 0, 0, 0 },
-  { 138351517.42797825, 46319038.938833795, 138351482.10368758, 46319020.17198829, 138351552.7522689, 46319057.7056793, 138351515.66176373, 46319038.00049152, 138351519.19419277, 46319039.87717607, 0, 0, 0, 0, 0 },
-  { 138351508.09107354, 46319056.513419546, 138351472.71835884, 46319037.83800644, 138351543.46378824, 46319075.188832656, 138351506.3224378, 46319055.57964889, 138351509.8597093, 46319057.4471902, 1, 3, 138351314.42546058, 46318954.26553277, 44 },
-  { 138351498.8006414, 46319074.11023543, 138351463.46611017, 46319055.36267813, 138351534.1351726, 46319092.85779273, 138351497.03391483, 46319073.17285757, 138351500.56736794, 46319075.04761329, 0, 0, 0, 0, 0 },
-  { 138351489.48162, 46319091.67429705, 138351454.27316287, 46319072.691026874, 138351524.69007716, 46319110.657567225, 138351487.72119716, 46319090.72513354, 138351491.24204287, 46319092.62346056, 1, 5, 138351234.22030583, 46318954.045588255, 29 },
-  { 138351480.05894756, 46319109.15061993, 138351445.06835225, 46319089.76871497, 138351515.04954287, 46319128.53252489, 138351478.30941778, 46319108.18152469, 138351481.80847734, 46319110.11971518, 0, 0, 0, 0, 0 },
-  { 138351470.4575624, 46319126.48421969, 138351435.78307816, 46319106.5423004, 138351505.1320466, 46319146.42613898, 138351468.72383818, 46319125.48712373, 138351472.1912866, 46319127.48131566, 1, 5, 138351338.69452238, 46319050.70492641, 38 },
-  { 138351460.6024027, 46319143.620111905, 138351426.3511796, 46319122.95967344, 138351494.85362577, 46319164.28055037, 138351458.88984153, 46319142.58708998, 138351462.31496385, 46319144.65313383, 0, 0, 0, 0, 0 },
-  { 138351450.41840667, 46319160.50331214, 138351416.7086889, 46319138.97066414, 138351484.12812442, 46319182.03596014, 138351448.73292077, 46319159.42667974, 138351452.10389256, 46319161.57994454, 0, 0, 0, 0, 0 },
-  { 138351439.8305126, 46319177.07883597, 138351406.7934015, 46319154.52779855, 138351472.86762372, 46319199.629873395, 138351438.17865705, 46319175.9512841, 138351441.48236817, 46319178.20638784, 0, 0, 0, 0, 0 },
-  { 138351428.76365876, 46319193.29169898, 138351396.5441857, 46319169.587151825, 138351460.98313183, 46319216.99624613, 138351427.1526851, 46319192.10647162, 138351430.37463242, 46319194.476926334, 1, 5, 138351233.03035992, 46319049.28657501, 29 },
-  { 138351417.14278328, 46319209.086916745, 138351385.88529572, 46319184.12756037, 138351448.40027085, 46319234.04627312, 138351415.5799089, 46319207.83894893, 138351418.70565766, 46319210.33488456, 0, 0, 0, 0, 0 },
-  { 138351404.90246114, 46319224.41590647, 138351374.65034807, 46319198.24703841, 138351435.15457422, 46319250.584774524, 138351403.38985547, 46319223.10746306, 138351406.4150668, 46319225.72434987, 1, 3, 138351189.35615557, 46319037.96272157, 30 },
-  { 138351392.04746893, 46319239.27672035, 138351362.7882911, 46319212.00218071, 138351421.30664676, 46319266.551259995, 138351390.58451003, 46319237.91299337, 138351393.51042783, 46319240.64044733, 0, 0, 0, 0, 0 },
-  { 138351378.61365345, 46319253.68805052, 138351350.3253591, 46319225.40780293, 138351406.9019478, 46319281.968298115, 138351377.19923875, 46319252.27403814, 138351380.02806816, 46319255.1020629, 1, 1, 138351300.11363667, 46319175.21036346, 32 },
-  { 138351364.63699988, 46319267.66868096, 138351337.289625, 46319238.47756782, 138351391.98437476, 46319296.859794095, 138351363.26963112, 46319266.2091253, 138351366.00436863, 46319269.128236614, 0, 0, 0, 0, 0 },
-  { 138351350.15349323, 46319281.23739567, 138351323.7105866, 46319251.22452027, 138351376.59639984, 46319311.25027106, 138351348.83134788, 46319279.7367519, 138351351.47563857, 46319282.738039434, 0, 0, 0, 0, 0 },
-  { 138351335.1991187, 46319294.41297861, 138351309.61904868, 46319263.661392994, 138351360.77918872, 46319325.16456423, 138351333.9201152, 46319292.87539933, 138351336.4781222, 46319295.950557895, 0, 0, 0, 0, 0 },
-  { 138351319.80986136, 46319307.21421381, 138351295.09272334, 46319275.764840394, 138351344.52699938, 46319338.66358723, 138351318.57400447, 46319305.64174514, 138351321.04571825, 46319308.78668248, 0, 0, 0, 0, 0 },
-  { 138351304.01356286, 46319319.62906498, 138351280.41722584, 46319287.330258824, 138351327.60989988, 46319351.92787113, 138351302.83374602, 46319318.01412467, 138351305.1933797, 46319321.244005285, 0, 0, 0, 0, 0 },
-  { 138351287.79394802, 46319331.47852766, 138351265.69914535, 46319298.134567276, 138351309.8887507, 46319364.82248804, 138351286.68920788, 46319329.81132964, 138351288.89868817, 46319333.145725675, 1, 5, 138351066.84592113, 46318998.03892382, 38 },
-  { 138351271.11987126, 46319342.52731826, 138351250.9605696, 46319307.97876465, 138351291.27917293, 46319377.07587187, 138351270.11190617, 46319340.79989058, 138351272.12783635, 46319344.254745945, 0, 0, 0, 0, 0 },
-  { 138351253.96017578, 46319352.540110156, 138351236.2288347, 46319316.68485192, 138351271.69151688, 46319388.39536839, 138351253.07360873, 46319350.74734724, 138351254.84674284, 46319354.33287307, 0, 0, 0, 0, 0 },
-  { 138351236.28370458, 46319361.2815767, 138351221.52475813, 46319324.10398265, 138351251.04265103, 46319398.45917075, 138351235.54575726, 46319359.422697, 138351237.0216519, 46319363.1404564, 1, 0, 138351376.12472227, 46319713.53928033, 31 },
-  { 138351218.05930078, 46319368.51639129, 138351206.81423676, 46319330.12956367, 138351229.3043648, 46319406.90321892, 138351217.49704757, 46319366.597049914, 138351218.621554, 46319370.43573267, 0, 0, 0, 0, 0 },
-  { 138351199.26205942, 46319374.022868276, 138351191.642621, 46319334.75527148, 138351206.88149783, 46319413.29046507, 138351198.8810875, 46319372.05948844, 138351199.64303133, 46319375.98624811, 1, 0, 138351221.54891676, 46319488.88058891, 32 },
-  { 138351179.95416725, 46319377.769349016, 138351175.72415856, 46319337.99364002, 138351184.18417594, 46319417.54505801, 138351179.7426668, 46319375.78056356, 138351180.16566768, 46319379.75813447, 0, 0, 0, 0, 0 },
-  { 138351160.2616996, 46319379.863574654, 138351159.1534828, 46319339.87892941, 138351161.36991638, 46319419.8482199, 138351160.20628875, 46319377.86434239, 138351160.31711042, 46319381.862806916, 0, 0, 0, 0, 0 },
-  { 138351140.3122029, 46319380.41649609, 138351142.0584974, 46319340.45463358, 138351138.5659084, 46319420.3783586, 138351140.39951763, 46319378.41840296, 138351140.22488818, 46319382.41458922, 1, 5, 138351154.32621616, 46319059.722549416, 49 },
-  { 138351120.2332238, 46319379.53906425, 138351124.58323467, 46319339.77630019, 138351115.88321292, 46319419.30182831, 138351120.45072433, 46319377.550926045, 138351120.01572326, 46319381.52720246, 0, 0, 0, 0, 0 },
-  { 138351100.15230876, 46319377.34223009, 138351106.88086948, 46319337.912210174, 138351093.42374805, 46319416.772250004, 138351100.4887368, 46319375.370729096, 138351099.81588072, 46319379.31373108, 0, 0, 0, 0, 0 },
-  { 138351080.19700423, 46319373.93694451, 138351089.1103361, 46319334.942681916, 138351071.28367236, 46319412.9312071, 138351080.6426708, 46319371.98723138, 138351079.75133765, 46319375.88665763, 0, 0, 0, 0, 0 },
-  { 138351060.4948105, 46319369.43340527, 138351071.54802185, 46319330.99089601, 138351049.44159913, 46319407.87591454, 138351061.04747105, 46319367.51127981, 138351059.94214994, 46319371.35553074, 1, 3, 138351151.68380433, 46319052.28270387, 28 },
-  { 138351041.1692378, 46319363.876805454, 138351054.53882042, 46319326.17727946, 138351027.79965517, 46319401.57633145, 138351041.83771694, 46319361.99182916, 138351040.50075865, 46319365.76178175, 0, 0, 0, 0, 0 },
-  { 138351022.3367874, 46319357.19815381, 138351038.21463332, 46319320.48447776, 138351006.4589415, 46319393.91182986, 138351023.1306797, 46319355.36247001, 138351021.5428951, 46319359.03383761, 0, 0, 0, 0, 0 },
-  { 138351004.11324993, 46319349.31688037, 138351022.6710021, 46319313.88229508, 138350985.55549777, 46319384.751465656, 138351005.04113755, 46319347.5451511, 138351003.1853623, 46319351.088609636, 0, 0, 0, 0, 0 },
-  { 138350986.61441606, 46319340.152415216, 138351007.98453864, 46319306.339431606, 138350965.24429348, 46319373.965398826, 138350987.68292218, 46319338.461766034, 138350985.54590994, 46319341.8430644, 0, 0, 0, 0, 0 },
-  { 138350969.9560764, 46319329.62418841, 138350994.20915064, 46319297.81556709, 138350945.70300218, 46319361.432809725, 138350971.16873014, 46319328.033757344, 138350968.7434227, 46319331.21461947, 1, 0, 138350763.8049454, 46319599.997469604, 47 },
-  { 138350954.25921252, 46319317.65582293, 138350981.39296436, 46319288.26603709, 138350927.12546068, 46319347.045608774, 138350955.61590013, 46319316.18633364, 138350952.90252492, 46319319.125312224, 0, 0, 0, 0, 0 },
-  { 138350939.71136394, 46319304.22470386, 138350969.66844532, 46319277.71860503, 138350909.75428256, 46319330.7308027, 138350941.209218, 46319302.89939892, 138350938.2135099, 46319305.5500088, 0, 0, 0, 0, 0 },
-  { 138350926.54615813, 46319289.34544366, 138350959.19310632, 46319266.23317909, 138350893.89920995, 46319312.457708225, 138350928.17850554, 46319288.18983043, 138350924.91381073, 46319290.50105689, 0, 0, 0, 0, 0 },
-  { 138350914.99814382, 46319273.0334365, 138350950.05491146, 46319253.771478094, 138350879.94137618, 46319292.295394905, 138350916.7509822, 46319272.07033858, 138350913.24530545, 46319273.99653442, 0, 0, 0, 0, 0 },
-  { 138350905.29838714, 46319255.37987765, 138350942.3243102, 46319240.24445494, 138350868.27246407, 46319270.515300356, 138350907.1496833, 46319254.62310652, 138350903.44709098, 46319256.13664878, 0, 0, 0, 0, 0 },
-  { 138350897.66713437, 46319236.71147417, 138350936.21789867, 46319226.04195815, 138350859.11637008, 46319247.38099019, 138350899.5946726, 46319236.17799837, 138350895.73959616, 46319237.244949974, 0, 0, 0, 0, 0 },
-  { 138350892.32253635, 46319217.400538385, 138350931.9084024, 46319211.659527265, 138350852.7366703, 46319223.141549505, 138350894.30182967, 46319217.11348783, 138350890.34324303, 46319217.68758894, 0, 0, 0, 0, 0 },
-  { 138350889.48274416, 46319197.81938257, 138350929.4817465, 46319197.536872976, 138350849.48374182, 46319198.101892166, 138350891.48269427, 46319197.80525709, 138350887.48279405, 46319197.83350805, 0, 0, 0, 0, 0 },
-  { 138350889.3450751, 46319178.327567235, 138350929.03476435, 46319183.30034991, 138350849.65538585, 46319173.354784556, 138350891.32955956, 46319178.57620637, 138350887.36059064, 46319178.0789281, 1, 5, 138351251.51348948, 46319223.70420915, 32 },
-  { 138350891.757762, 46319159.070985936, 138350930.6765536, 46319168.30828315, 138350852.83897042, 46319149.83368872, 138350893.7037016, 46319159.532850794, 138350889.81182244, 46319158.60912108, 1, 2, 138350687.43410608, 46319110.57517555, 41 },
-  { 138350896.27982822, 46319140.018513314, 138350934.29496756, 46319152.46235443, 138350858.26468888, 46319127.5746722, 138350898.18058518, 46319140.64070537, 138350894.37907127, 46319139.39632126, 0, 0, 0, 0, 0 },
-  { 138350902.46157128, 46319121.133683346, 138350939.67525733, 46319135.80138835, 138350865.24788523, 46319106.46597834, 138350904.32225558, 46319121.867068596, 138350900.60088697, 46319120.400298096, 1, 1, 138350773.14401224, 46319070.16340844, 40 },
-  { 138350909.85328883, 46319102.38002991, 138350946.5077274, 46319118.394152805, 138350873.19885024, 46319086.36590701, 138350911.68601075, 46319103.18073606, 138350908.0205669, 46319101.57932376, 0, 0, 0, 0, 0 },
-  { 138350918.00527853, 46319083.72108695, 138350954.41426045, 46319100.28568885, 138350881.5962966, 46319067.15648505, 138350919.8257276, 46319084.54931705, 138350916.18482944, 46319082.89285685, 0, 0, 0, 0, 0 },
-  { 138350926.4678378, 46319065.120388314, 138350962.91118106, 46319081.60925521, 138350890.02449456, 46319048.63152142, 138350928.29000497, 46319065.94483166, 138350924.64567065, 46319064.29594497, 1, 4, 138351049.46412134, 46319120.7703141, 28 },
-  { 138350934.869592, 46319046.5510097, 138350971.37124738, 46319062.91038485, 138350898.36793664, 46319030.19163455, 138350936.6946748, 46319047.368978456, 138350933.04450923, 46319045.733040944, 0, 0, 0, 0, 0 },
-  { 138350943.17191154, 46319028.02656098, 138350979.68733436, 46319044.355182946, 138350906.65648872, 46319011.69793901, 138350944.9976827, 46319028.842992075, 138350941.34614038, 46319027.21012988, 0, 0, 0, 0, 0 },
-  { 138350951.42450994, 46319009.57141388, 138350987.9088555, 46319025.96935672, 138350914.9401644, 46318993.17347104, 138350953.24872723, 46319010.39131103, 138350949.60029265, 46319008.75151674, 0, 0, 0, 0, 0 },
-  { 138350959.67710134, 46318991.209940165, 138350996.08436596, 46319007.77831617, 138350923.26983672, 46318974.64156416, 138350961.49746457, 46318992.038358964, 138350957.85673812, 46318990.38152137, 0, 0, 0, 0, 0 },
-  { 138350967.97939998, 46318972.966511644, 138351004.26153556, 46318989.80713627, 138350931.6972644, 46318956.12588702, 138350969.79350677, 46318973.80854288, 138350966.1652932, 46318972.12448041, 0, 0, 0, 0, 0 },
-  { 138350976.3811199, 46318954.865500055, 138351012.48713598, 46318972.08048201, 138350940.27510384, 46318937.6505181, 138350978.1864207, 46318955.72624915, 138350974.5758191, 46318954.00475096, 0, 0, 0, 0, 0 },
-  { 138350984.93197533, 46318936.93127717, 138351020.8070494, 46318954.62249141, 138350949.05690128, 46318919.24006293, 138350986.72572905, 46318937.81583788, 138350983.13822162, 46318936.04671646, 0, 0, 0, 0, 0 },
-  { 138350993.6816804, 46318919.1882148, 138351029.26630354, 46318937.456619136, 138350958.09705728, 46318900.91981047, 138350995.46091157, 46318920.10163502, 138350991.90244925, 46318918.274794586, 1, 5, 138351179.61133626, 46319014.640627444, 35 },
-  { 138351002.67994928, 46318901.66068471, 138351037.9091446, 46318920.605441146, 138350967.45075396, 46318882.71592828, 138351004.44140905, 46318902.60792253, 138351000.91848952, 46318900.71344689, 0, 0, 0, 0, 0 },
-  { 138351011.97649613, 46318884.37305866, 138351046.77916023, 46318904.090425916, 138350977.17383203, 46318864.65569141, 138351013.71662933, 46318885.35892703, 138351010.23636293, 46318883.3871903, 0, 0, 0, 0, 0 },
-  { 138351021.62103504, 46318867.349708445, 138351055.9194648, 46318887.93168398, 138350987.32260528, 46318846.76773291, 138351023.3359565, 46318868.378807224, 138351019.90611356, 46318866.32060967, 0, 0, 0, 0, 0 },
-  { 138351031.6632802, 46318850.61500583, 138351065.37296084, 46318872.1477119, 138350997.95359954, 46318829.082299754, 138351033.3487642, 46318851.69164113, 138351029.97779617, 46318849.53837053, 0, 0, 0, 0, 0 },
-  { 138351042.15294582, 46318834.19332259, 138351075.1826843, 46318856.755157106, 138351009.12320733, 46318811.63148808, 138351043.80443275, 46318835.321414314, 138351040.50145888, 46318833.06523087, 1, 3, 138350947.19244772, 46318769.32804837, 46 },
-  { 138351053.13974598, 46318818.109030515, 138351085.39223376, 46318841.768638134, 138351020.8872582, 46318794.449422896, 138351054.75237036, 46318819.292010896, 138351051.5271216, 46318816.926050134, 0, 0, 0, 0, 0 },
-  { 138351064.6733949, 46318802.38650137, 138351096.04627573, 46318827.20065758, 138351033.30051404, 46318777.57234517, 138351066.24203894, 46318803.62720918, 138351063.10475084, 46318801.145793565, 0, 0, 0, 0, 0 },
-  { 138351076.80360663, 46318787.05010693, 138351107.2573269, 46318812.98407928, 138351046.34988636, 46318761.11613458, 138351078.32629263, 46318788.34680554, 138351075.28092062, 46318785.75340831, 1, 4, 138351156.74462232, 46318855.12678435, 43 },
-  { 138351089.53784364, 46318772.09655926, 138351119.31181479, 46318798.80817924, 138351059.7638725, 46318745.384939276, 138351091.02654222, 46318773.43214025, 138351088.04914507, 46318770.76097826, 1, 2, 138351005.42637515, 46318696.63623282, 25 },
-  { 138351102.71301627, 46318757.410920195, 138351132.13613507, 46318784.50852305, 138351073.28989747, 46318730.31331734, 138351104.1841722, 46318758.765800335, 138351101.24186033, 46318756.056040056, 0, 0, 0, 0, 0 },
-  { 138351116.12300727, 46318742.85008394, 138351145.53421625, 46318769.960613005, 138351086.71179828, 46318715.739554875, 138351117.59356773, 46318744.205610394, 138351114.6524468, 46318741.494557485, 0, 0, 0, 0, 0 },
-  { 138351129.56169927, 46318728.27094467, 138351159.2986983, 46318755.023718156, 138351099.82470024, 46318701.518171184, 138351131.04854923, 46318729.608583346, 138351128.0748493, 46318726.93330599, 0, 0, 0, 0, 0 },
-  { 138351142.822975, 46318713.530396596, 138351173.2112221, 46318739.54105666, 138351112.4347279, 46318687.51973653, 138351144.34238738, 46318714.8309296, 138351141.30356264, 46318712.22986359, 0, 0, 0, 0, 0 },
-  { 138351155.70071718, 46318698.485333905, 138351187.03984544, 46318723.34210442, 138351124.36158893, 46318673.62856339, 138351157.26767358, 46318699.72817243, 138351154.13376078, 46318697.24249538, 0, 0, 0, 0, 0 },
-  { 138351167.98880848, 46318682.99265077, 138351200.5341394, 46318706.24778861, 138351135.44347757, 46318659.73751293, 138351169.61607504, 46318684.15540766, 138351166.36154193, 46318681.82989388, 0, 0, 0, 0, 0 },
-  { 138351179.4811381, 46318666.90925134, 138351213.36811572, 46318688.16184527, 138351145.5941605, 46318645.65665741, 138351181.17548698, 46318667.97188104, 138351177.78678924, 46318665.84662164, 1, 0, 138351431.9391213, 46318825.241076075, 49 },
-  { 138351190.00054154, 46318650.13620285, 138351225.14594448, 46318669.23595813, 138351154.8551386, 46318631.03644757, 138351191.7578117, 46318651.091190614, 138351188.24327138, 46318649.181215085, 0, 0, 0, 0, 0 },
-  { 138351199.4652808, 46318632.720164254, 138351235.74641213, 46318649.562952295, 138351163.18414947, 46318615.87737621, 138351201.27933738, 46318633.562303655, 138351197.65122423, 46318631.878024854, 0, 0, 0, 0, 0 },
-  { 138351207.81325445, 46318614.73775377, 138351245.1033293, 46318629.21015224, 138351170.5231796, 46318600.265355304, 138351209.6777582, 46318615.461373694, 138351205.9487507, 46318614.01413385, 0, 0, 0, 0, 0 },
-  { 138351214.982361, 46318596.265589654, 138351253.15471533, 46318608.218470655, 138351176.81000665, 46318584.31270865, 138351216.8909787, 46318596.86323371, 138351213.07374328, 46318595.6679456, 1, 4, 138351390.57519096, 46318651.24884225, 50 },
-  { 138351220.8971031, 46318577.37645056, 138351259.86085472, 46318586.422226414, 138351181.9333515, 46318568.33067471, 138351222.8452907, 46318577.82873935, 138351218.9489155, 46318576.92416177, 0, 0, 0, 0, 0 },
-  { 138351225.36975786, 46318558.11094897, 138351264.9721374, 46318563.736918636, 138351185.76737833, 46318552.48497931, 138351227.34987685, 46318558.39224745, 138351223.38963887, 46318557.82965049, 1, 0, 138351363.97808626, 46318577.80184278, 27 },
-  { 138351228.15661874, 46318538.49365114, 138351268.13378483, 46318539.8450177, 138351188.17945266, 46318537.14228457, 138351230.15547705, 46318538.56121947, 138351226.15776044, 46318538.426082805, 0, 0, 0, 0, 0 },
-  { 138351228.82804823, 46318518.630907245, 138351268.3586617, 46318512.52103023, 138351189.29743475, 46318524.74078426, 138351230.8045789, 46318518.32541339, 138351226.85151756, 46318518.9364011, 1, 3, 138351571.75612026, 46318465.627724186, 34 },
-  { 138351225.81467733, 46318499.134540915, 138351262.33470437, 46318482.816219136, 138351189.2946503, 46318515.452862695, 138351227.64067867, 46318498.318624824, 138351223.98867598, 46318499.95045701, 1, 1, 138351055.08355096, 46318575.42269524, 31 },
-  { 138351217.71907493, 46318481.01676985, 138351247.95311958, 46318454.82702865, 138351187.4850303, 46318507.20651105, 138351219.23077717, 46318479.70728279, 138351216.2073727, 46318482.32625691, 0, 0, 0, 0, 0 },
-  { 138351204.50887617, 46318465.76661003, 138351224.88138786, 46318431.34335092, 138351184.1363645, 46318500.189869136, 138351205.52750176, 46318464.045447074, 138351203.4902506, 46318467.48777298, 0, 0, 0, 0, 0 },
-  { 138351187.2362929, 46318455.544280306, 138351192.47520298, 46318415.88884157, 138351181.99738282, 46318495.19971904, 138351187.4982384, 46318453.56150837, 138351186.97434738, 46318457.52705224, 0, 0, 0, 0, 0 },
-  { 138351168.10460836, 46318453.01677896, 138351161.190235, 46318413.6189181, 138351175.01898172, 46318492.41463982, 138351167.75888968, 46318451.046885915, 138351168.45032704, 46318454.98667201, 0, 0, 0, 0, 0 },
-  { 138351148.38255644, 46318456.4780235, 138351139.10745546, 46318417.56822394, 138351157.6576574, 46318495.38782306, 138351147.9188014, 46318454.53253352, 138351148.84631148, 46318458.42351348, 1, 0, 138351106.41272452, 46318280.41118049, 43 },
-  { 138351128.56854734, 46318461.201176465, 138351120.3506629, 46318422.05444767, 138351136.7864318, 46318500.347905256, 138351128.15765312, 46318459.243840024, 138351128.97944155, 46318463.158512905, 0, 0, 0, 0, 0 },
-  { 138351108.87102348, 46318465.33618289, 138351101.34442267, 46318426.05068582, 138351116.39762428, 46318504.62167996, 138351108.49469343, 46318463.37190804, 138351109.24735352, 46318467.300457746, 0, 0, 0, 0, 0 },
-  { 138351089.3089034, 46318469.08403592, 138351082.0089239, 46318429.75579798, 138351096.6088829, 46318508.412273854, 138351088.94390443, 46318467.11762402, 138351089.67390236, 46318471.050447814, 0, 0, 0, 0, 0 },
-  { 138351069.89727718, 46318472.687158786, 138351062.3440625, 46318433.40676994, 138351077.45049185, 46318511.96754763, 138351069.51961645, 46318470.723139346, 138351070.2749379, 46318474.651178226, 0, 0, 0, 0, 0 },
-  { 138351050.65123504, 46318476.38797469, 138351042.35742423, 46318437.257261656, 138351058.94504586, 46318515.51868772, 138351050.2365445, 46318474.431439035, 138351051.0659256, 46318478.34451034, 0, 0, 0, 0, 0 },
-  { 138351031.58586717, 46318480.42890678, 138351022.0665647, 46318441.578129694, 138351041.10516962, 46318519.27968387, 138351031.10990205, 46318478.486367926, 138351032.06183228, 46318482.37144564, 0, 0, 0, 0, 0 },
-  { 138351012.71626377, 46318485.05237832, 138351001.54705074, 46318446.64341218, 138351023.8854768, 46318523.46134446, 138351012.15780312, 46318483.13193001, 138351013.27472442, 46318486.97282663, 0, 0, 0, 0, 0 },
-  { 138350994.05431613, 46318490.47921715, 138350981.27608112, 46318452.57517106, 138351006.83255115, 46318528.38326324, 138350993.41540438, 46318488.58401485, 138350994.6932279, 46318492.37441945, 1, 4, 138350933.0382439, 46318309.48739709, 47 },
-  { 138350975.57894158, 46318496.70764663, 138350961.49178973, 46318459.27033699, 138350989.66609344, 46318534.14495627, 138350974.874584, 46318494.83578115, 138350976.28329918, 46318498.57951211, 1, 3, 138351019.24911234, 46318612.7633065, 44 },
-  { 138350957.2496273, 46318503.604719, 138350942.14645973, 46318466.56562708, 138350972.35279486, 46318540.64381091, 138350956.49446893, 46318501.752764404, 138350958.00478566, 46318505.45667359, 1, 0, 138350893.81632355, 46318348.04053296, 30 },
-  { 138350939.0256103, 46318511.03579703, 138350923.1871774, 46318474.305100836, 138350954.8640432, 46318547.76649322, 138350938.23368865, 46318509.19926222, 138350939.81753194, 46318512.87233184, 1, 4, 138350994.46012548, 46318639.59323371, 46 },
-  { 138350920.86612743, 46318518.86624352, 138350904.5619784, 46318482.339886956, 138350937.17027646, 46318555.39260008, 138350920.05091998, 46318517.03992569, 138350921.68133488, 46318520.69256135, 0, 0, 0, 0, 0 },
-  { 138350902.73041567, 46318526.96142123, 138350886.22148722, 46318490.52716151, 138350919.23934412, 46318563.39568095, 138350901.90496925, 46318525.13970824, 138350903.5558621, 46318528.783134215, 0, 0, 0, 0, 0 },
-  { 138350884.577712, 46318535.18669295, 138350868.11981317, 46318498.72935396, 138350901.03561082, 46318571.64403195, 138350883.75481707, 46318533.36382601, 138350885.40060693, 46318537.0095599, 1, 3, 138350766.49228802, 46318273.60528565, 40 },
-  { 138350866.36725333, 46318543.40742146, 138350850.21485552, 46318506.81370554, 138350882.51965114, 46318580.00113738, 138350865.55963343, 46318541.57773566, 138350867.17487323, 46318545.23710726, 1, 2, 138350937.03399372, 46318703.50492863, 50 },
-  { 138350848.05827662, 46318551.48896956, 138350832.45091859, 46318514.659492575, 138350863.66563466, 46318588.31844654, 138350847.2779087, 46318549.64749571, 138350848.83864453, 46318553.330443405, 0, 0, 0, 0, 0 },
-  { 138350829.61362076, 46318559.305326775, 138350814.54261726, 46318522.25313584, 138350844.68462425, 46318596.35751771, 138350828.8600706, 46318557.45271723, 138350830.36717093, 46318561.15793632, 0, 0, 0, 0, 0 },
-  { 138350811.04877815, 46318566.85658895, 138350796.31370527, 46318529.66952632, 138350825.78385103, 46318604.04365158, 138350810.3120245, 46318564.99723582, 138350811.7855318, 46318568.715942085, 1, 5, 138350666.27668706, 46318201.493698604, 45 },
-  { 138350792.4191479, 46318574.2384293, 138350777.81316254, 46318537.00047567, 138350807.02513328, 46318611.47638293, 138350791.68884864, 46318572.376531616, 138350793.14944717, 46318576.100326985, 0, 0, 0, 0, 0 },
-  { 138350773.78112006, 46318581.54889445, 138350759.09625134, 46318544.34197802, 138350788.46598879, 46318618.75581088, 138350773.04687664, 46318579.68854863, 138350774.51536348, 46318583.40924027, 0, 0, 0, 0, 0 },
-  { 138350755.19108468, 46318588.88603108, 138350740.21860966, 46318551.79391613, 138350770.1635597, 46318625.978146024, 138350754.44246092, 46318587.03142533, 138350755.93970844, 46318590.740636826, 0, 0, 0, 0, 0 },
-  { 138350736.70543188, 46318596.347885855, 138350721.2363779, 46318559.4601051, 138350752.17448586, 46318633.23566661, 138350735.93197918, 46318594.50349682, 138350737.47888458, 46318598.19227489, 1, 0, 138350582.01489204, 46318227.47007833, 27 },
-  { 138350718.38055167, 46318604.03250541, 138350702.20665094, 46318567.44828839, 138350734.5544524, 46318640.61672243, 138350717.57185662, 46318602.20329456, 138350719.1892467, 46318605.861716256, 0, 0, 0, 0, 0 },
-  { 138350700.27283412, 46318612.037936434, 138350683.18827024, 46318575.870026946, 138350717.357398, 46318648.20584592, 138350699.41860592, 46318610.22954096, 138350701.12706232, 46318613.84633191, 1, 2, 138350630.65323624, 46318464.653705284, 29 },
-  { 138350682.43866938, 46318620.46222557, 138350664.24295413, 46318584.8403791, 138350700.63438463, 46318656.084072046, 138350681.5288836, 46318618.68113325, 138350683.34845516, 46318622.243317895, 1, 3, 138350795.70699686, 46318842.20821988, 26 },
-  { 138350664.9344475, 46318629.403419495, 138350645.43672907, 46318594.47722623, 138350684.43216592, 46318664.32961276, 138350663.9595616, 46318627.657109834, 138350665.9093334, 46318631.149729155, 0, 0, 0, 0, 0 },
-  { 138350647.81655848, 46318638.959564865, 138350626.84154713, 46318604.90007427, 138350668.79156983, 46318673.019055456, 138350646.7678079, 46318637.25659034, 138350648.86530906, 46318640.66253939, 1, 0, 138350793.06851202, 46318874.82153719, 28 },
-  { 138350631.1413925, 46318649.22870834, 138350608.53686023, 46318616.22817621, 138350653.74592477, 46318682.22924048, 138350630.0111659, 46318647.57868174, 138350632.2716191, 46318650.878734946, 1, 0, 138350535.6372437, 46318509.80146007, 49 },
-  { 138350614.96533963, 46318660.30889661, 138350590.61627838, 46318628.57369193, 138350639.31440088, 46318692.04410129, 138350613.74788657, 46318658.72213638, 138350616.1827927, 46318661.89565684, 0, 0, 0, 0, 0 },
-  { 138350599.34306788, 46318672.295195594, 138350573.44734147, 46318641.808947, 138350625.2387943, 46318702.78144419, 138350598.04828155, 46318670.770883165, 138350600.63785422, 46318673.81950802, 1, 3, 138350467.27486318, 46318516.815327734, 41 },
-  { 138350584.23841318, 46318685.12543951, 138350557.370765, 46318655.49218994, 138350611.10606137, 46318714.75868908, 138350582.89503077, 46318683.64377703, 138350585.5817956, 46318686.60710199, 1, 3, 138350686.33547634, 46318797.73178789, 29 },
-  { 138350569.4811657, 46318698.505427845, 138350542.18975142, 46318669.26198916, 138350596.77258, 46318727.74886653, 138350568.116595, 46318697.04325591, 138350570.8457364, 46318699.96759978, 0, 0, 0, 0, 0 },
-  { 138350554.89033854, 46318712.122304894, 138350527.69521084, 46318682.7893025, 138350582.08546624, 46318741.45530729, 138350553.53058216, 46318710.65565477, 138350556.25009492, 46318713.588955015, 0, 0, 0, 0, 0 },
-  { 138350540.28494483, 46318725.663214944, 138350513.71525577, 46318695.76251891, 138350566.8546339, 46318755.563910976, 138350538.9564604, 46318724.168180145, 138350541.61342928, 46318727.15824974, 0, 0, 0, 0, 0 },
-  { 138350525.4839976, 46318738.815302275, 138350500.11488217, 46318707.88945578, 138350550.85311306, 46318769.74114877, 138350524.21554184, 46318737.26900995, 138350526.7524534, 46318740.3615946, 0, 0, 0, 0, 0 },
-  { 138350510.30651003, 46318751.26571118, 138350486.790097, 46318718.90866684, 138350533.82292306, 46318783.62275552, 138350509.13068938, 46318749.64785896, 138350511.48233068, 46318752.8835634, 0, 0, 0, 0, 0 },
-  { 138350494.5714952, 46318762.70158597, 138350473.55935183, 46318728.6649905, 138350515.58363858, 46318796.73818144, 138350493.52088803, 46318760.999756195, 138350495.62210238, 46318764.40341575, 0, 0, 0, 0, 0 },
-  { 138350478.1238572, 46318772.855366714, 138350459.71341357, 46318737.344022535, 138350496.53430083, 46318808.366710894, 138350477.20333502, 46318771.0797995, 138350479.04437938, 46318774.630933926, 0, 0, 0, 0, 0 },
-  { 138350460.97288784, 46318781.74708743, 138350444.96930194, 46318745.0880471, 138350476.97647375, 46318818.40612775, 138350460.17270854, 46318779.91413541, 138350461.77306715, 46318783.58003944, 0, 0, 0, 0, 0 },
-  { 138350443.192189, 46318789.50929121, 138350429.3461859, 46318751.98212508, 138350457.03819212, 46318827.03645734, 138350442.49988884, 46318787.6329329, 138350443.88448918, 46318791.38564952, 0, 0, 0, 0, 0 },
-  { 138350424.85551143, 46318796.27478195, 138350412.88631907, 46318758.107539, 138350436.82470378, 46318834.4420249, 138350424.2570518, 46318794.3664198, 138350425.45397106, 46318798.1831441, 1, 0, 138350506.54524922, 46319056.766215086, 32 },
-  { 138350406.036606, 46318802.17636355, 138350395.64914393, 46318763.54864512, 138350416.4240681, 46318840.804081984, 138350405.51723292, 46318800.24497763, 138350406.5559791, 46318804.10774947, 0, 0, 0, 0, 0 },
-  { 138350386.80922362, 46318807.34683992, 138350377.70553175, 46318768.39657941, 138350395.9129155, 46318846.29710043, 138350386.354039, 46318805.39932689, 138350387.26440823, 46318809.29435295, 0, 0, 0, 0, 0 },
-  { 138350367.24711505, 46318811.91901496, 138350359.1327543, 46318772.75069678, 138350375.3614758, 46318851.08733314, 138350366.84139702, 46318809.96059905, 138350367.65283307, 46318813.87743087, 1, 0, 138350329.10961947, 46318627.82791949, 27 },
-  { 138350347.42403117, 46318816.02569254, 138350340.010649, 46318776.71867326, 138350354.83741334, 46318855.332711816, 138350347.05336207, 46318814.060341574, 138350347.79470026, 46318817.9910435, 0, 0, 0, 0, 0 },
-  { 138350327.41372278, 46318819.79967658, 138350320.4189665, 46318780.41600758, 138350334.40847906, 46318859.183345586, 138350327.06398496, 46318817.83049313, 138350327.7634606, 46318821.768860035, 1, 1, 138350264.28604725, 46318464.3620638, 48 },
-  { 138350307.28994077, 46318823.37377098, 138350300.4357016, 46318783.96540378, 138350314.14417994, 46318862.78213818, 138350306.94722882, 46318821.403352626, 138350307.63265273, 46318825.34418934, 1, 2, 138350331.62248987, 46318963.27347454, 39 },
-  { 138350287.12643597, 46318826.88077963, 138350280.13619208, 46318787.49630947, 138350294.11667985, 46318866.265249796, 138350286.77692378, 46318824.911556125, 138350287.47594815, 46318828.85000314, 1, 2, 138350218.62204584, 46318440.912971996, 31 },
-  { 138350266.99695918, 46318830.45350643, 138350259.59283528, 46318791.14474215, 138350274.40108308, 46318869.76227071, 138350266.62675297, 46318828.488068216, 138350267.3671654, 46318832.41894465, 0, 0, 0, 0, 0 },
-  { 138350246.9752613, 46318834.22475528, 138350238.87536833, 46318795.05344264, 138350255.07515427, 46318873.39606792, 138350246.57026666, 46318832.26618965, 138350247.38025594, 46318836.18332091, 0, 0, 0, 0, 0 },
-  { 138350227.13509312, 46318838.327330045, 138350218.0517609, 46318799.37231656, 138350236.21842533, 46318877.28234353, 138350226.6809265, 46318836.37957937, 138350227.58925974, 46318840.27508072, 1, 4, 138350299.34758428, 46319148.01968727, 29 },
-  { 138350207.55020553, 46318842.894034676, 138350197.18986744, 46318804.25903249, 138350217.91054362, 46318881.529036865, 138350207.03218862, 46318840.962284565, 138350208.06822243, 46318844.82578479, 0, 0, 0, 0, 0 },
-  { 138350188.29434937, 46318848.05767306, 138350176.36004663, 46318809.87950629, 138350200.22865212, 46318886.23583983, 138350187.69763425, 46318846.14876472, 138350188.8910645, 46318849.9665814, 1, 2, 138350293.0178559, 46319183.07108649, 25 },
-  { 138350169.44127545, 46318853.95104906, 138350155.6389442, 46318816.40779863, 138350183.2436067, 46318891.49429949, 138350168.7511589, 46318852.073886536, 138350170.131392, 46318855.82821158, 0, 0, 0, 0, 0 },
-  { 138350151.06473458, 46318860.7069666, 138350135.1144502, 46318824.02470348, 138350167.01501897, 46318897.38922972, 138350150.26722035, 46318858.87285344, 138350151.8622488, 46318862.54107976, 1, 5, 138350259.92542556, 46319111.063412406, 41 },
-  { 138350133.23847768, 46318868.45822956, 138350114.89138052, 46318832.91411576, 138350151.58557484, 46318904.00234336, 138350132.32112283, 46318866.681023866, 138350134.15583253, 46318870.23543525, 1, 4, 138350065.35421818, 46318736.9450085, 42 },
-  { 138350116.0362555, 46318877.337641865, 138350095.10180727, 46318843.25320442, 138350136.97070375, 46318911.42207931, 138350114.9895331, 46318875.63341999, 138350117.08297792, 46318879.04186374, 1, 1, 138350228.0355537, 46319059.68938222, 49 },
-  { 138350099.5307143, 46318887.47524202, 138350076.09252056, 46318855.06149378, 138350122.96890804, 46318919.88899026, 138350098.3588046, 46318885.85455461, 138350100.702624, 46318889.09592943, 1, 3, 138349871.0083255, 46318571.441196695, 35 },
-  { 138350083.74892053, 46318898.886965744, 138350058.1738428, 46318868.13122808, 138350109.32399827, 46318929.64270341, 138350082.47016665, 46318897.34917886, 138350085.0276744, 46318900.42475263, 0, 0, 0, 0, 0 },
-  { 138350068.65715924, 46318911.436590545, 138350041.2957073, 46318882.25867171, 138350096.0186112, 46318940.61450938, 138350067.28908664, 46318909.9776946, 138350070.02523184, 46318912.89548649, 1, 2, 138349919.53724614, 46318752.4169329, 33 },
-  { 138350054.21749118, 46318924.97731927, 138350025.37790787, 46318897.259483226, 138350083.0570745, 46318952.695155315, 138350052.775512, 46318923.59142747, 138350055.65947035, 46318926.36321107, 1, 4, 138350136.4103036, 46319003.973152004, 41 },
-  { 138350040.3919774, 46318939.3623548, 138350010.3403836, 46318912.9634588, 138350070.4435712, 46318965.7612508, 138350038.8893977, 46318938.04241, 138350041.8945571, 46318940.6822996, 0, 0, 0, 0, 0 },
-  { 138350027.14267874, 46318954.444899976, 138349996.10686597, 46318929.21043296, 138350058.1784915, 46318979.67936699, 138350025.5908881, 46318953.18317662, 138350028.69446936, 46318955.70662333, 0, 0, 0, 0, 0 },
-  { 138350014.4316559, 46318970.078157626, 138349982.60662797, 46318945.84661625, 138350046.25668386, 46318994.309699, 138350012.8404045, 46318968.86658056, 138350016.02290732, 46318971.28973469, 1, 5, 138349813.93397993, 46318817.419447, 41 },
-  { 138350002.22096997, 46318986.11533063, 138349969.76904675, 46318962.730021566, 138350034.6728932, 46319009.50063969, 138350000.5983738, 46318984.94606517, 138350003.84356615, 46318987.284596086, 1, 0, 138350252.91207677, 46319166.766843155, 28 },
-  { 138349990.47358078, 46319002.41724783, 138349957.47719097, 46318979.806669354, 138350023.46997058, 46319025.02782631, 138349988.82376128, 46319001.286718905, 138349992.12340027, 46319003.54777676, 1, 5, 138349868.38693845, 46318918.75810747, 32 },
-  { 138349979.16188586, 46319018.92479077, 138349945.662445, 46318997.066440806, 138350012.6613267, 46319040.783140734, 138349977.48691383, 46319017.83187327, 138349980.8368579, 46319020.01770827, 0, 0, 0, 0, 0 },
-  { 138349968.26392227, 46319035.62667755, 138349934.3012335, 46319014.49528454, 138350002.22661105, 46319056.75807056, 138349966.56578782, 46319034.5701079, 138349969.96205673, 46319036.6832472, 0, 0, 0, 0, 0 },
-  { 138349957.75780287, 46319052.51226874, 138349923.37032747, 46319032.07941441, 138349992.14527828, 46319072.94512306, 138349956.0384291, 46319051.49062602, 138349959.47717664, 46319053.53391145, 0, 0, 0, 0, 0 },
-  { 138349947.6216405, 46319069.57092479, 138349912.8463165, 46319049.805378, 138349982.39696452, 46319089.33647158, 138349945.8828743, 46319068.58264745, 138349949.3604067, 46319070.55920213, 1, 3, 138349675.5047301, 46318914.905521154, 50 },
-  { 138349937.83354792, 46319086.79200623, 138349902.70566225, 46319067.66005265, 138349972.9614336, 46319105.923959814, 138349936.07715362, 46319085.83540855, 138349939.58994222, 46319087.74860391, 1, 5, 138350152.11365056, 46319203.49692306, 29 },
-  { 138349928.37163797, 46319104.16487355, 138349892.92474917, 46319085.63063294, 138349963.81852677, 46319122.69911416, 138349926.59929353, 46319103.23816152, 138349930.1439824, 46319105.09158558, 1, 1, 138349612.89432773, 46318939.21013212, 31 },
-  { 138349919.21402344, 46319121.67888724, 138349883.4799296, 46319103.7046129, 138349954.9481173, 46319139.65316158, 138349917.42731875, 46319120.780173525, 138349921.00072813, 46319122.577600956, 0, 0, 0, 0, 0 },
-  { 138349910.33881718, 46319139.323407814, 138349874.3475642, 46319121.869763285, 138349946.33007017, 46319156.77705234, 138349908.53925452, 46319138.450725585, 138349912.13837984, 46319140.19609004, 0, 0, 0, 0, 0 },
-  { 138349901.72413203, 46319157.08779577, 138349865.50405666, 46319140.114106156, 138349937.9442074, 46319174.06148539, 138349899.91312826, 46319156.23911129, 138349903.5351358, 46319157.936480254, 0, 0, 0, 0, 0 },
-  { 138349893.34808078, 46319174.96141161, 138349856.92588335, 46319158.425888196, 138349929.77027822, 46319191.496935025, 138349891.52697092, 46319174.13463544, 138349895.16919065, 46319175.78818778, 0, 0, 0, 0, 0 },
-  { 138349885.18877617, 46319192.933615826, 138349848.5896176, 46319176.79355411, 138349921.78793472, 46319209.07367754, 138349883.35881823, 46319192.12661274, 138349887.0187341, 46319193.740618914, 0, 0, 0, 0, 0 },
-  { 138349877.22433117, 46319210.99376891, 138349840.47195068, 46319195.205718756, 138349913.97671166, 46319226.78181906, 138349875.38671213, 46319210.2043664, 138349879.0619502, 46319211.783171415, 1, 0, 138349584.1240967, 46319085.08406892, 34 },
-  { 138349869.43285853, 46319229.13123138, 138349832.54970688, 46319213.65114342, 138349906.31601018, 46319244.61131935, 138349867.58870095, 46319228.35722698, 138349871.2770161, 46319229.90523578, 0, 0, 0, 0, 0 },
-  { 138349861.79247105, 46319247.33536372, 138349824.79985675, 46319232.118712045, 138349898.78508535, 46319262.5520154, 138349859.94284034, 46319246.57453114, 138349863.64210176, 46319248.09619631, 1, 3, 138349671.28050748, 46319168.969607584, 46 },
-  { 138349854.28128156, 46319265.59552644, 138349817.1995081, 46319250.59745736, 138349891.36305502, 46319280.59359553, 138349852.4271929, 46319264.84562299, 138349856.13537022, 46319266.3454299, 0, 0, 0, 0, 0 },
-  { 138349846.87742504, 46319283.901091546, 138349809.72226587, 46319269.085756704, 138349884.03258422, 46319298.71642639, 138349845.0196671, 46319283.160324804, 138349848.735183, 46319284.64185829, 1, 3, 138349489.25901794, 46319141.3034937, 28 },
-  { 138349839.563446, 46319302.24371148, 138349802.34206992, 46319287.59553197, 138349876.78482205, 46319316.89189099, 138349837.70237717, 46319301.5113025, 138349841.4245148, 46319302.97612046, 0, 0, 0, 0, 0 },
-  { 138349832.33158186, 46319320.62005197, 138349795.04988405, 46319306.12608739, 138349869.61327967, 46319335.114016555, 138349830.46749696, 46319319.89535374, 138349834.19566676, 46319321.3447502, 0, 0, 0, 0, 0 },
-  { 138349825.1753597, 46319339.02744566, 138349787.83907205, 46319324.67468894, 138349862.51164734, 46319353.380202375, 138349823.30854532, 46319338.30980782, 138349827.04217407, 46319339.745083496, 1, 0, 138350068.79463655, 46319432.679183215, 27 },
-  { 138349818.08830646, 46319357.46322518, 138349780.70301038, 46319343.2386114, 138349855.47360253, 46319371.68783896, 138349816.21904165, 46319356.75199449, 138349819.95757127, 46319358.174455866, 0, 0, 0, 0, 0 },
-  { 138349811.06394914, 46319375.92472313, 138349773.63508868, 46319361.815137595, 138349848.4928096, 46319390.03430867, 138349809.1925061, 46319375.219243854, 138349812.93539217, 46319376.63020241, 1, 4, 138349926.15769508, 46319419.31169867, 46 },
-  { 138349804.09581485, 46319394.40927217, 138349766.62871045, 46319380.40155691, 138349841.56291926, 46319408.416987434, 138349802.22245964, 46319393.70888641, 138349805.96917006, 46319395.109657936, 0, 0, 0, 0, 0 },
-  { 138349797.1774305, 46319412.914204895, 138349759.67729247, 46319398.99516591, 138349834.67756855, 46319426.833243884, 138349795.3024236, 46319412.21825295, 138349799.05243742, 46319413.61015684, 0, 0, 0, 0, 0 },
-  { 138349790.30232316, 46319431.436853975, 138349752.77426583, 46319417.59326658, 138349827.8303805, 46319445.28044137, 138349788.4259203, 46319430.74467461, 138349792.17872602, 46319432.12903334, 0, 0, 0, 0, 0 },
-  { 138349783.46401975, 46319449.974552, 138349745.91307542, 46319436.19316674, 138349821.01496407, 46319463.755937256, 138349781.58647254, 46319449.285482734, 138349785.34156695, 46319450.66362126, 1, 1, 138350140.1979909, 46319580.89771198, 40 },
-  { 138349776.6560473, 46319468.52463161, 138349739.0871806, 46319454.79217899, 138349814.224914, 46319482.257084236, 138349774.77760398, 46319467.83800898, 138349778.53449064, 46319469.21125425, 1, 3, 138349617.9275855, 46319410.50501927, 37 },
-  { 138349769.87193292, 46319487.08442542, 138349732.29005522, 46319473.38762035, 138349807.45381063, 46319500.78123049, 138349767.99283904, 46319486.399585165, 138349771.7510268, 46319487.769265674, 0, 0, 0, 0, 0 },
-  { 138349763.1052035, 46319505.65126608, 138349725.51518723, 46319491.97681262, 138349800.69521978, 46319519.32571954, 138349761.2257027, 46319504.96754341, 138349764.98470432, 46319506.33498876, 1, 3, 138349403.18079782, 46319374.71837418, 25 },
-  { 138349756.34938613, 46319524.222486205, 138349718.7560794, 46319510.55708139, 138349793.94269285, 46319537.887891024, 138349754.46972078, 46319523.53921597, 138349758.22905147, 46319524.905756444, 1, 3, 138350109.72646943, 46319652.6772915, 45 },
-  { 138349749.59800777, 46319542.79541843, 138349712.00624886, 46319529.125756316, 138349787.18976668, 46319556.46508054, 138349747.71841982, 46319542.11193532, 138349751.47759572, 46319543.478901535, 1, 2, 138349619.90643954, 46319495.635084145, 30 },
-  { 138349742.8445954, 46319561.367395364, 138349705.2592273, 46319547.680171184, 138349780.4299635, 46319575.05461954, 138349740.965327, 46319560.68303415, 138349744.7238638, 46319562.051756576, 0, 0, 0, 0, 0 },
-  { 138349736.08267605, 46319579.93574965, 138349698.50856104, 46319566.217663705, 138349773.65679106, 46319593.653835595, 138349734.2039703, 46319579.249845356, 138349737.9613818, 46319580.621653944, 1, 2, 138349582.96815744, 46319524.03454943, 47 },
-  { 138349729.30577677, 46319598.49781391, 138349691.74781102, 46319584.7355754, 138349766.86374253, 46319612.26005242, 138349727.4278785, 46319597.80970199, 138349731.18367505, 46319599.185925834, 0, 0, 0, 0, 0 },
-  { 138349722.5074245, 46319617.05092077, 138349684.9705524, 46319603.231252424, 138349760.0442966, 46319630.870589115, 138349720.6305809, 46319616.359937355, 138349724.3842681, 46319617.741904184, 0, 0, 0, 0, 0 },
-  { 138349715.68114626, 46319635.59240286, 138349678.17037487, 46319621.7020454, 138349753.19191766, 46319649.48276032, 138349713.8056077, 46319634.89788499, 138349717.55668482, 46319636.286920734, 0, 0, 0, 0, 0 },
-  { 138349708.82046914, 46319654.119592816, 138349671.34088266, 46319640.14530939, 138349746.30005562, 46319668.09387624, 138349706.9464898, 46319653.42087864, 138349710.69444847, 46319654.81830699, 0, 0, 0, 0, 0 },
-  { 138349701.91892004, 46319672.629823245, 138349664.47541502, 46319658.55914694, 138349739.36242506, 46319686.70049955, 138349700.0467448, 46319671.92628943, 138349703.7910953, 46319673.33335706, 0, 0, 0, 0, 0 },
-  { 138349694.9703853, 46319691.12058299, 138349657.56017816, 46319676.96161406, 138349732.38059247, 46319705.27955192, 138349693.09987494, 46319690.412634544, 138349696.84089568, 46319691.82853144, 1, 0, 138349446.19250777, 46319596.96343959, 39 },
-  { 138349687.9787072, 46319709.59368848, 138349650.59032646, 46319695.37718444, 138349725.36708793, 46319723.81019252, 138349686.10928816, 46319708.882863276, 138349689.84812623, 46319710.304513685, 0, 0, 0, 0, 0 },
-  { 138349680.9587247, 46319728.05573634, 138349643.58010712, 46319713.813582465, 138349718.3373423, 46319742.297890216, 138349679.08979383, 46319727.343628645, 138349682.82765558, 46319728.767844036, 1, 5, 138349318.3861341, 46319589.906843744, 29 },
-  { 138349673.9258453, 46319746.513570204, 138349636.5448618, 46319732.277627215, 138349711.3068288, 46319760.749513194, 138349672.05679613, 46319745.80177306, 138349675.79489446, 46319747.22536735, 0, 0, 0, 0, 0 },
-  { 138349666.89547634, 46319764.9740337, 138349629.50001702, 46319750.77615984, 138349704.29093567, 46319779.17190756, 138349665.02570337, 46319764.26414, 138349668.7652493, 46319765.683927394, 1, 5, 138349302.28974795, 46319626.54476355, 35 },
-  { 138349659.88302517, 46319783.44397047, 138349622.46108407, 46319769.3160434, 138349697.30496627, 46319797.571897544, 138349658.0119281, 46319782.737574115, 138349661.75412223, 46319784.15036683, 1, 2, 138349782.4398823, 46319829.712931626, 25 },
-  { 138349652.90389913, 46319801.930224136, 138349615.44365928, 46319787.904161595, 138349690.364139, 46319815.956286676, 138349651.03088713, 46319801.22892101, 138349654.77691114, 46319802.63152726, 0, 0, 0, 0, 0 },
-  { 138349645.97350568, 46319820.43963834, 138349608.46433675, 46319806.54495422, 138349683.4826746, 46319834.33432246, 138349644.09804723, 46319819.74490413, 138349647.84896412, 46319821.13437255, 1, 0, 138349955.42414927, 46319935.07078234, 26 },
-  { 138349639.1061105, 46319838.97840345, 138349601.5445345, 46319825.22602158, 138349676.66768652, 46319852.73078532, 138349637.22803172, 46319838.29078436, 138349640.9841893, 46319839.66602254, 0, 0, 0, 0, 0 },
-  { 138349632.30733046, 46319857.54776083, 138349594.69308233, 46319843.94010354, 138349669.9215786, 46319871.15541812, 138349630.42661804, 46319856.86737797, 138349634.18804288, 46319858.22814369, 0, 0, 0, 0, 0 },
-  { 138349625.5788218, 46319876.146685585, 138349587.91166887, 46319862.68616595, 138349663.24597475, 46319889.60720522, 138349623.69546416, 46319875.473659605, 138349627.46217945, 46319876.819711566, 0, 0, 0, 0, 0 },
-  { 138349618.92222023, 46319894.774141036, 138349581.20194635, 46319881.46320803, 138349656.6424941, 46319908.085074045, 138349617.03620654, 46319894.10859439, 138349620.80823392, 46319895.439687684, 1, 1, 138349948.9746168, 46320011.24480485, 41 },
-  { 138349612.3391614, 46319913.42909048, 138349574.5655676, 46319900.27022984, 138349650.11275518, 46319926.587951116, 138349610.4504817, 46319912.771147445, 138349614.22784108, 46319914.08703351, 0, 0, 0, 0, 0 },
-  { 138349605.83128107, 46319932.11049723, 138349568.00418654, 46319919.10623174, 138349643.6583756, 46319945.114762716, 138349603.93992633, 46319931.46028396, 138349607.7226358, 46319932.7607105, 0, 0, 0, 0, 0 },
-  { 138349599.40021485, 46319950.8173246, 138349561.5194575, 46319937.9702151, 138349637.2809722, 46319963.664434105, 138349597.50617698, 46319950.17496913, 138349601.29425272, 46319951.45968007, 0, 0, 0, 0, 0 },
-  { 138349593.0475984, 46319969.54853589, 138349555.11303556, 46319956.86118225, 138349630.98216122, 46319982.23588953, 138349591.15087026, 46319968.91416821, 138349594.94432652, 46319970.18290357, 0, 0, 0, 0, 0 },
-  { 138349586.7750675, 46319988.303094454, 138349548.78657708, 46319975.77813557, 138349624.76355794, 46320000.82805334, 138349584.875643, 46319987.67684651, 138349588.67449203, 46319988.9293424, 1, 1, 138349440.51937938, 46319940.08200273, 48 },
-  { 138349580.58425784, 46320007.07996357, 138349542.541739, 46319994.720078535, 138349618.6267767, 46320019.43984861, 138349578.6821319, 46320006.46196932, 138349582.4863838, 46320007.69795782, 0, 0, 0, 0, 0 },
-  { 138349574.4768051, 46320025.87810658, 138349536.38017926, 46320013.686014906, 138349612.57343093, 46320038.07019825, 138349572.5719738, 46320025.268502, 138349576.38163638, 46320026.48771116, 1, 0, 138349223.03543168, 46319913.40606088, 33 },
-  { 138349568.4543448, 46320044.696486734, 138349530.3035564, 46320032.67495, 138349606.6051332, 46320056.718023464, 138349566.54680538, 46320044.0954099, 138349570.36188424, 46320045.29756357, 0, 0, 0, 0, 0 },
-  { 138349562.51851287, 46320063.534067415, 138349524.31353074, 46320051.68588861, 138349600.723495, 46320075.38224622, 138349560.60826376, 46320062.941658475, 138349564.428762, 46320064.126476355, 1, 3, 138349233.9556666, 46319961.63972971, 48 },
-  { 138349556.67094484, 46320082.38981191, 138349518.4117629, 46320070.7178371, 138349594.9301268, 46320094.06178672, 138349554.75798574, 46320081.80621317, 138349558.58390394, 46320082.97341065, 0, 0, 0, 0, 0 },
-  { 138349550.91327646, 46320101.262683526, 138349512.59991494, 46320089.7698019, 138349589.226638, 46320112.75556515, 138349548.9976084, 46320100.688039444, 138349552.82894453, 46320101.83732761, 1, 4, 138349172.56883132, 46319987.77047745, 46 },
-  { 138349545.2471434, 46320120.151645586, 138349506.8796499, 46320108.84079047, 138349583.61463687, 46320131.4625007, 138349543.3287687, 46320119.58610283, 138349547.16551808, 46320120.71718834, 0, 0, 0, 0, 0 },
-  { 138349539.67418137, 46320139.055661395, 138349501.24909234, 46320127.94204217, 138349578.0992704, 46320150.16928062, 138349537.75292692, 46320138.499980435, 138349541.59543583, 46320139.611342356, 1, 1, 138349355.23375398, 46320085.71028914, 44 },
-  { 138349534.2018334, 46320157.97618171, 138349495.65548614, 46320147.290718995, 138349572.74818066, 46320168.66164442, 138349532.27451605, 46320157.441908576, 138349536.12915075, 46320158.51045484, 0, 0, 0, 0, 0 },
-  { 138349528.93974844, 46320176.95843448, 138349490.16920888, 46320167.11743534, 138349567.710288, 46320186.79943361, 138349527.00122145, 46320176.46638452, 138349530.87827542, 46320177.45048443, 0, 0, 0, 0, 0 },
-  { 138349524.0849018, 46320196.085051656, 138349485.01479253, 46320187.5102886, 138349563.1550111, 46320204.65981471, 138349522.13139635, 46320195.6563135, 138349526.03840727, 46320196.51378981, 0, 0, 0, 0, 0 },
-  { 138349519.83707738, 46320215.43986808, 138349480.4334391, 46320208.558495305, 138349559.24071565, 46320222.32124085, 138349517.86689547, 46320215.09579944, 138349521.8072593, 46320215.78393672, 1, 1, 138349141.56215, 46320149.37868946, 29 },
-  { 138349516.40334952, 46320235.101841785, 138349476.63749143, 46320230.78020666, 138349556.1692076, 46320239.42347691, 138349514.41505662, 46320234.88576003, 138349518.39164242, 46320235.31792354, 0, 0, 0, 0, 0 },
-  { 138349514.24291065, 46320254.98128622, 138349474.24361485, 46320254.74393314, 138349554.24220645, 46320255.2186393, 138349512.24294585, 46320254.96941856, 138349516.24287546, 46320254.99315388, 0, 0, 0, 0, 0 },
-  { 138349514.12542146, 46320274.780838825, 138349474.50961953, 46320280.31150216, 138349553.7412234, 46320269.25017549, 138349512.14463136, 46320275.05737199, 138349516.10621157, 46320274.50430566, 0, 0, 0, 0, 0 },
-  { 138349516.83522493, 46320294.190994665, 138349478.65248007, 46320306.1106421, 138349555.0179698, 46320282.27134723, 138349514.92608768, 46320294.78697704, 138349518.74436218, 46320293.59501229, 0, 0, 0, 0, 0 },
-  { 138349522.6972922, 46320312.9692195, 138349486.50626642, 46320330.004760355, 138349558.888318, 46320295.93367864, 138349520.8877409, 46320313.82099654, 138349524.5068435, 46320312.11744246, 0, 0, 0, 0, 0 },
-  { 138349531.18335468, 46320330.99737065, 138349497.04685122, 46320351.84681025, 138349565.31985813, 46320310.147931054, 138349529.4765295, 46320332.039842635, 138349532.89017984, 46320329.95489867, 1, 2, 138349360.5008374, 46320435.24456865, 26 },
-  { 138349541.6723353, 46320348.17083575, 138349509.40632844, 46320371.81200328, 138349573.93834215, 46320324.52966822, 138349540.05903494, 46320349.35289413, 138349543.28563565, 46320346.98877737, 0, 0, 0, 0, 0 },
-  { 138349553.55275774, 46320364.38550837, 138349523.11624584, 46320390.33967457, 138349583.98926964, 46320338.43134218, 138349552.03093216, 46320365.68321668, 138349555.07458332, 46320363.08780006, 0, 0, 0, 0, 0 },
-  { 138349566.48538247, 46320379.55162789, 138349538.10633725, 46320407.74080654, 138349594.8644277, 46320351.362449236, 138349565.0664302, 46320380.961086825, 138349567.90433472, 46320378.142168954, 0, 0, 0, 0, 0 },
-  { 138349580.4352648, 46320393.59546883, 138349554.3616249, 46320423.92969542, 138349606.5089047, 46320363.26124223, 138349579.1315828, 46320395.11218016, 138349581.7389468, 46320392.078757495, 0, 0, 0, 0, 0 },
-  { 138349595.38349733, 46320406.44415085, 138349571.84565282, 46320438.78560839, 138349618.92134184, 46320374.10269331, 138349594.2066051, 46320408.06122373, 138349596.56038955, 46320404.82707797, 0, 0, 0, 0, 0 },
-  { 138349611.30602887, 46320418.03243723, 138349590.21777317, 46320452.02192784, 138349632.39428458, 46320384.042946614, 138349610.2516161, 46320419.731911756, 138349612.36044165, 46320416.3329627, 0, 0, 0, 0, 0 },
-  { 138349628.08110836, 46320428.4402768, 138349609.0261299, 46320463.60997676, 138349647.13608682, 46320393.27057684, 138349627.12835944, 46320430.1987618, 138349629.0338573, 46320426.681791805, 0, 0, 0, 0, 0 },
-  { 138349645.49952203, 46320437.87759068, 138349628.0045037, 46320473.84875043, 138349662.99454036, 46320401.90643093, 138349644.62477112, 46320439.67614867, 138349646.37427294, 46320436.07903269, 0, 0, 0, 0, 0 },
-  { 138349663.34896785, 46320446.55888937, 138349646.96530136, 46320483.04964809, 138349679.73263434, 46320410.06813064, 138349662.52978453, 46320448.3834273, 138349664.16815117, 46320444.734351434, 0, 0, 0, 0, 0 },
-  { 138349681.43748915, 46320454.68029628, 138349665.99591464, 46320491.57958863, 138349696.87906367, 46320417.78100393, 138349680.66541043, 46320456.525260895, 138349682.20956787, 46320452.83533166, 0, 0, 0, 0, 0 },
-  { 138349699.70038164, 46320462.322931066, 138349685.1382047, 46320499.57803814, 138349714.26255858, 46320425.06782399, 138349698.97227278, 46320464.18568642, 138349700.4284905, 46320460.460175715, 0, 0, 0, 0, 0 },
-  { 138349718.12204042, 46320469.52353994, 138349704.3730885, 46320507.086371586, 138349731.87099233, 46320431.96070829, 138349717.4345928, 46320471.40168152, 138349718.80948803, 46320467.645398356, 0, 0, 0, 0, 0 },
-  { 138349736.68696526, 46320476.318774685, 138349723.68214577, 46320514.145678736, 138349749.69178474, 46320438.491870634, 138349736.03672427, 46320478.21011989, 138349737.33720624, 46320474.42742948, 1, 0, 138349866.0849192, 46320099.9410794, 41 },
-  { 138349755.37965572, 46320482.745287016, 138349743.04763928, 46320520.79684901, 138349767.71167216, 46320444.69372502, 138349754.7630549, 46320484.64786512, 138349755.99625653, 46320480.842708915, 1, 1, 138349670.59704262, 46320744.34977573, 47 },
-  { 138349774.18461162, 46320488.8397287, 138349762.45239955, 46320527.08048183, 138349785.9168237, 46320450.59897557, 138349773.598001, 46320490.751766354, 138349774.77122223, 46320486.92769104, 0, 0, 0, 0, 0 },
-  { 138349793.08633262, 46320494.6387515, 138349781.87971222, 46320533.03681993, 138349804.292953, 46320456.24068307, 138349792.5260016, 46320496.55865492, 138349793.64666364, 46320492.71884808, 1, 4, 138349732.85074797, 46320701.02836932, 50 },
-  { 138349812.0693183, 46320500.17900712, 138349801.31321293, 46320538.70570172, 138349822.82542366, 46320461.65231252, 138349811.53151304, 46320502.10534185, 138349812.60712355, 46320498.25267239, 1, 1, 138349894.08462176, 46320206.41296075, 38 },
-  { 138349831.11806846, 46320505.49714734, 138349820.7366302, 46320544.12648515, 138349841.4995067, 46320466.86780953, 138349830.59899655, 46320507.42861423, 138349831.63714036, 46320503.565680444, 0, 0, 0, 0, 0 },
-  { 138349850.21708366, 46320510.629910626, 138349840.1221446, 46320549.33510673, 138349860.31202272, 46320471.92471452, 138349849.71233672, 46320512.56517043, 138349850.7218306, 46320508.69465082, 0, 0, 0, 0, 0 },
-  { 138349869.35093266, 46320515.62032688, 138349859.43411723, 46320554.371543266, 138349879.2677481, 46320476.86911049, 138349868.8550919, 46320517.557887696, 138349869.84677342, 46320513.68276606, 1, 3, 138349812.08132356, 46320739.40860153, 25 },
-  { 138349888.5042971, 46320520.52186024, 138349878.65494603, 46320559.290278874, 138349898.3536482, 46320481.75344161, 138349888.01182956, 46320522.46028117, 138349888.99676466, 46320518.58343931, 0, 0, 0, 0, 0 },
-  { 138349907.66186926, 46320525.38895724, 138349897.7691121, 46320564.14632243, 138349917.5546264, 46320486.63159205, 138349907.1672314, 46320527.3268255, 138349908.1565071, 46320523.45108898, 0, 0, 0, 0, 0 },
-  { 138349926.80834144, 46320530.27606446, 138349916.76129764, 46320568.993720785, 138349936.85538524, 46320491.55840814, 138349926.30598927, 46320532.21194728, 138349927.31069362, 46320528.34018165, 0, 0, 0, 0, 0 },
-  { 138349945.92840603, 46320535.23762838, 138349935.61640146, 46320573.88555926, 138349956.2404106, 46320496.589697495, 138349945.4128058, 46320537.170024924, 138349946.44400626, 46320533.30523183, 0, 0, 0, 0, 0 },
-  { 138349965.0067551, 46320540.32809554, 138349954.31959793, 46320578.873973034, 138349975.6939123, 46320501.78221805, 138349964.47239727, 46320542.255389415, 138349965.54111296, 46320538.400801666, 1, 4, 138350049.96965462, 46320233.88836948, 46 },
-  { 138349984.02808118, 46320545.60191247, 138349972.85680914, 46320584.010279804, 138349995.19935322, 46320507.19354513, 138349983.4695176, 46320547.522330835, 138349984.58664477, 46320543.6814941, 1, 0, 138349949.1178561, 46320665.628060386, 47 },
-  { 138350002.97713023, 46320551.113341264, 138349991.26857382, 46320589.36134391, 138350014.68568665, 46320512.865338616, 138350002.3917024, 46320553.0257414, 138350003.56255805, 46320549.20094113, 1, 2, 138350101.621718, 46320228.87391893, 35 },
-  { 138350021.84652096, 46320556.889677554, 138350009.65923584, 46320594.98784131, 138350034.0338061, 46320518.7915138, 138350021.2371567, 46320558.79458574, 138350022.45588523, 46320554.98476937, 0, 0, 0, 0, 0 },
-  { 138350040.6449511, 46320562.90313872, 138350028.05049047, 46320600.86864361, 138350053.23941174, 46320524.93763383, 138350040.01522806, 46320564.80141396, 138350041.27467415, 46320561.00486348, 0, 0, 0, 0, 0 },
-  { 138350059.38308114, 46320569.119219385, 138350046.4523225, 46320606.971504405, 138350072.31383976, 46320531.266934365, 138350058.7365432, 46320571.01183364, 138350060.02961907, 46320567.22660513, 1, 4, 138349997.9619777, 46320748.91757324, 31 },
-  { 138350078.07157156, 46320575.50341412, 138350064.87473786, 46320613.26375813, 138350091.26840526, 46320537.7430701, 138350077.41172987, 46320577.39143132, 138350078.73141325, 46320573.61539692, 0, 0, 0, 0, 0 },
-  { 138350096.72108278, 46320582.02121751, 138350083.32781532, 46320619.71233565, 138350110.11435023, 46320544.33009937, 138350096.0514194, 46320583.905773416, 138350097.39074615, 46320580.136661604, 1, 4, 138349992.92326006, 46320874.12738314, 48 },
-  { 138350115.3422752, 46320588.63812416, 138350101.82174683, 46320626.283778794, 138350128.86280358, 46320550.99246953, 138350114.6662488, 46320590.520406894, 138350116.0183016, 46320586.75584143, 1, 1, 138350202.88769642, 46320344.88251043, 48 },
-  { 138350133.9458093, 46320595.319628656, 138350120.3668662, 46320632.9442523, 138350147.5247524, 46320557.695005015, 138350133.26686215, 46320597.20085984, 138350134.62475646, 46320593.438397475, 1, 0, 138350089.8142442, 46320717.599655494, 48 },
-  { 138350152.54234555, 46320602.03122556, 138350138.97366753, 46320639.65955235, 138350166.11102358, 46320564.40289877, 138350151.86391166, 46320603.9126419, 138350153.22077945, 46320600.14980923, 0, 0, 0, 0, 0 },
-  { 138350171.14254442, 46320608.73840951, 138350157.6528138, 46320646.39511101, 138350184.63227504, 46320571.081708014, 138350170.4680579, 46320610.62124459, 138350171.81703094, 46320606.85557444, 0, 0, 0, 0, 0 },
-  { 138350189.75706625, 46320615.406675056, 138350176.41513482, 46320653.11599573, 138350203.09899768, 46320577.697354384, 138350189.08996966, 46320617.29214109, 138350190.42416283, 46320613.521209024, 0, 0, 0, 0, 0 },
-  { 138350208.39657158, 46320622.0015168, 138350195.2716159, 46320659.78690469, 138350221.52152726, 46320584.2161289, 138350207.74032378, 46320623.89078619, 138350209.05281937, 46320620.1122474, 0, 0, 0, 0, 0 },
-  { 138350227.0717208, 46320628.488429315, 138350214.23337588, 46320666.372158006, 138350239.91006574, 46320590.604700625, 138350226.42980355, 46320630.38261575, 138350227.71363807, 46320626.59424288, 1, 4, 138350342.29586658, 46320288.48196433, 32 },
-  { 138350245.79317445, 46320634.832907215, 138350233.31163478, 46320672.835685626, 138350258.2747141, 46320596.830128804, 138350245.16909745, 46320636.73304614, 138350246.41725144, 46320632.93276829, 0, 0, 0, 0, 0 },
-  { 138350264.57159287, 46320641.000445075, 138350252.5176704, 46320679.14101341, 138350276.62551534, 46320602.85987674, 138350263.96889675, 46320642.90747349, 138350265.174289, 46320639.09341666, 0, 0, 0, 0, 0 },
-  { 138350283.4176366, 46320646.9565375, 138350271.8627636, 46320685.25124876, 138350294.9725096, 46320608.66182624, 138350282.83989295, 46320648.87127306, 138350283.99538025, 46320645.04180194, 1, 2, 138350249.3307613, 46320759.925935715, 50 },
-  { 138350302.341966, 46320652.66667906, 138350291.35813168, 46320691.12906826, 138350313.32580033, 46320614.20428986, 138350301.7927743, 46320654.589798525, 138350302.89115772, 46320650.7435596, 0, 0, 0, 0, 0 },
-  { 138350321.3552416, 46320658.096364364, 138350311.01484996, 46320696.73670987, 138350331.69563323, 46320619.45601886, 138350320.83822203, 46320660.02838164, 138350321.87226117, 46320656.16434709, 0, 0, 0, 0, 0 },
-  { 138350340.46812376, 46320663.211087964, 138350330.8437624, 46320702.03597262, 138350350.09248513, 46320624.38620331, 138350339.9869057, 46320665.152332194, 138350340.94934183, 46320661.269843735, 1, 0, 138350401.82342747, 46320415.7024483, 25 },
-  { 138350359.69127297, 46320667.97634448, 138350350.83773136, 46320706.98422574, 138350368.5448146, 46320628.96846322, 138350359.2485959, 46320669.926738545, 138350360.13395005, 46320666.02595042, 0, 0, 0, 0, 0 },
-  { 138350379.0325416, 46320672.36619395, 138350370.87725362, 46320711.52601108, 138350387.18782958, 46320633.20637682, 138350378.6247772, 46320674.324184805, 138350379.440306, 46320670.408203095, 0, 0, 0, 0, 0 },
-  { 138350398.47962654, 46320676.41617656, 138350390.8939332, 46320715.690306164, 138350406.06531987, 46320637.14204695, 138350398.10034186, 46320678.379883036, 138350398.85891122, 46320674.45247008, 1, 2, 138350358.65473652, 46320882.605357006, 30 },
-  { 138350418.01141962, 46320680.188690275, 138350410.866184, 46320719.545336574, 138350425.15665525, 46320640.832043976, 138350417.65415785, 46320682.15652259, 138350418.3686814, 46320678.22085796, 0, 0, 0, 0, 0 },
-  { 138350437.60677588, 46320683.74624537, 138350430.77291828, 46320723.15815208, 138350444.44063348, 46320644.33433866, 138350437.26508301, 46320685.71684071, 138350437.94846874, 46320681.77565003, 0, 0, 0, 0, 0 },
-  { 138350457.24455032, 46320687.15135223, 138350450.5931314, 46320726.59445842, 138350463.89596924, 46320647.70824603, 138350456.91197938, 46320689.12350754, 138350457.57712126, 46320685.17919692, 0, 0, 0, 0, 0 },
-  { 138350476.90359798, 46320690.46652119, 138350470.30574718, 46320729.91862335, 138350483.50144878, 46320651.01441903, 138350476.57370543, 46320692.4391263, 138350477.23349053, 46320688.49391608, 0, 0, 0, 0, 0 },
-  { 138350496.56277385, 46320693.75426258, 138350489.88952845, 46320733.193681896, 138350503.23601925, 46320654.31484327, 138350496.22911158, 46320695.72623355, 138350496.89643613, 46320691.78229161, 1, 1, 138350520.9201196, 46320549.80038209, 50 },
-  { 138350516.20093298, 46320697.07708674, 138350509.32305035, 46320736.48133436, 138350523.0788156, 46320657.67283912, 138350515.85703886, 46320699.04729912, 138350516.5448271, 46320695.10687436, 0, 0, 0, 0, 0 },
-  { 138350535.7969304, 46320700.49750404, 138350528.58473656, 46320739.84193516, 138350543.00912425, 46320661.15307292, 138350535.43632072, 46320702.4647256, 138350536.15754008, 46320698.53028248, 0, 0, 0, 0, 0 },
-  { 138350555.32962117, 46320704.0780248, 138350547.65295896, 46320743.33447468, 138350563.00628337, 46320664.82157491, 138350554.94578806, 46320706.040847294, 138350555.71345428, 46320702.1152023, 0, 0, 0, 0, 0 },
-  { 138350574.7778602, 46320707.881159365, 138350566.50620592, 46320747.01656195, 138350583.04951447, 46320668.74575678, 138350574.36427748, 46320709.837929495, 138350575.1914429, 46320705.924389236, 0, 0, 0, 0, 0 },
-  { 138350594.1205026, 46320711.969418086, 138350585.12332126, 46320750.94441941, 138350603.11768392, 46320672.994416766, 138350593.67064354, 46320713.91816815, 138350594.57036164, 46320710.02066802, 1, 0, 138350511.5713638, 46321069.5650552, 36 },
-  { 138350613.33640337, 46320716.4053113, 138350603.4838174, 46320755.17290795, 138350623.18898934, 46320677.637714654, 138350612.84377408, 46320718.34369113, 138350613.82903266, 46320714.46693147, 0, 0, 0, 0, 0 },
-  { 138350632.40441748, 46320721.25134935, 138350621.56826138, 46320759.75560523, 138350643.24057359, 46320682.74709348, 138350631.86260968, 46320723.176562145, 138350632.9462253, 46320719.32613656, 0, 0, 0, 0, 0 },
-  { 138350651.3034, 46320726.57004258, 138350639.358725, 46320764.74496549, 138350663.248075, 46320688.39511967, 138350650.70616627, 46320728.478788726, 138350651.90063375, 46320724.661296435, 0, 0, 0, 0, 0 },
-  { 138350670.01220596, 46320732.42390133, 138350656.83927885, 46320770.19259194, 138350683.18513307, 46320694.65521071, 138350669.3535596, 46320734.312335856, 138350670.6708523, 46320730.5354668, 1, 0, 138350544.21075192, 46321093.11489673, 34 },
-  { 138350688.5096904, 46320738.87543593, 138350673.99649295, 46320776.14965088, 138350703.02288786, 46320701.60122099, 138350687.78403053, 46320740.73914668, 138350689.23535028, 46320737.01172519, 1, 0, 138350747.65096998, 46320586.983010024, 50 },
-  { 138350706.77470827, 46320745.987156756, 138350690.8297635, 46320782.67174121, 138350722.71965304, 46320709.3025723, 138350705.97746104, 46320747.82138598, 138350707.5719555, 46320744.15292753, 1, 1, 138350654.9536378, 46320865.21205624, 33 },
-  { 138350724.7864985, 46320753.81597652, 138350707.42668992, 46320789.85258356, 138350742.14630705, 46320717.77936949, 138350723.91850805, 46320755.617806874, 138350725.65448892, 46320752.01414617, 0, 0, 0, 0, 0 },
-  { 138350742.528153, 46320762.362611495, 138350723.82709083, 46320797.721772596, 138350761.22921517, 46320727.00345039, 138350741.5930999, 46320764.13056955, 138350743.4632061, 46320760.59465344, 0, 0, 0, 0, 0 },
-  { 138350759.98498836, 46320771.595335156, 138350740.01395148, 46320806.25305703, 138350779.95602524, 46320736.93761328, 138350758.98643652, 46320773.32822125, 138350760.9835402, 46320769.862449065, 0, 0, 0, 0, 0 },
-  { 138350777.14234802, 46320781.482028335, 138350755.96916306, 46320815.41867871, 138350798.31553298, 46320747.54537796, 138350776.08368877, 46320783.17886085, 138350778.20100728, 46320779.78519582, 0, 0, 0, 0, 0 },
-  { 138350793.98557544, 46320791.990571916, 138350771.6743409, 46320825.19010225, 138350816.29680997, 46320758.79104158, 138350792.8700137, 46320793.650548436, 138350795.10113716, 46320790.3305954, 1, 3, 138351007.0578651, 46320474.93505726, 30 },
-  { 138350810.50001407, 46320803.08884679, 138350787.11094967, 46320835.53806352, 138350833.88907847, 46320770.63963006, 138350809.33056083, 46320804.71130762, 138350811.6694673, 46320801.46638595, 0, 0, 0, 0, 0 },
-  { 138350826.67100734, 46320814.74473377, 138350802.26040298, 46320846.432624124, 138350851.0816117, 46320783.05684342, 138350825.45047712, 46320816.32912829, 138350827.89153755, 46320813.16033926, 0, 0, 0, 0, 0 },
-  { 138350842.4838986, 46320826.92611374, 138350817.10414213, 46320857.84322811, 138350867.8636551, 46320796.00899937, 138350841.21491078, 46320828.471969455, 138350843.75288644, 46320825.380258024, 0, 0, 0, 0, 0 },
-  { 138350857.92403153, 46320839.60086756, 138350831.62369457, 46320869.738755286, 138350884.22436848, 46320809.46297984, 138350856.6090147, 46320841.10776195, 138350859.23904836, 46320838.093973175, 1, 4, 138351108.43474096, 46320552.53748699, 45 },
-  { 138350872.97674933, 46320852.73687609, 138350845.80071834, 46320882.08757181, 138350900.15278032, 46320823.38618038, 138350871.6179478, 46320854.20441088, 138350874.33555087, 46320851.269341305, 1, 0, 138350621.59846258, 46321124.23081148, 41 },
-  { 138350887.62739557, 46320866.30202018, 138350859.6213152, 46320894.86177268, 138350915.63347593, 46320837.742267676, 138350886.22709155, 46320867.730007805, 138350889.0276996, 46320864.87403255, 1, 2, 138351085.7704141, 46320664.24177124, 50 },
-  { 138350901.86391017, 46320880.262539335, 138350873.15628377, 46320908.11702168, 138350930.57153657, 46320852.40805699, 138350900.42852885, 46320881.65526345, 138350903.2992915, 46320878.869815215, 1, 0, 138350635.6006753, 46321138.61286306, 39 },
-  { 138350915.7276496, 46320894.55090582, 138350886.51884064, 46320921.8793796, 138350944.93645856, 46320867.22243205, 138350914.26720914, 46320895.91732951, 138350917.18809006, 46320893.184482135, 1, 3, 138351107.04534832, 46320715.5494026, 27 },
-  { 138350929.3101036, 46320909.067900345, 138350899.79368943, 46320936.063849956, 138350958.82651776, 46320882.07195073, 138350927.83428288, 46320910.417697825, 138350930.78592432, 46320907.718102865, 0, 0, 0, 0, 0 },
-  { 138350942.70470062, 46320923.71307782, 138350913.06807628, 46320950.57700342, 138350972.34132496, 46320896.84915222, 138350941.2228694, 46320925.0562741, 138350944.18653184, 46320922.36988154, 0, 0, 0, 0, 0 },
-  { 138350956.00486943, 46320938.38599318, 138350926.43374646, 46320965.322004125, 138350985.5759924, 46320911.44998224, 138350954.52631328, 46320939.732793726, 138350957.4834256, 46320937.03919264, 0, 0, 0, 0, 0 },
-  { 138350969.30403864, 46320952.986201406, 138350939.98728004, 46320980.19883936, 138350998.62079725, 46320925.77356345, 138350967.83820072, 46320954.3468333, 138350970.76987657, 46320951.62556951, 0, 0, 0, 0, 0 },
-  { 138350982.69563684, 46320967.413257405, 138350953.83009508, 46320995.1040591, 138351011.5611786, 46320939.72245571, 138350981.25235975, 46320968.797797486, 138350984.13891393, 46320966.028717324, 0, 0, 0, 0, 0 },
-  { 138350996.2730927, 46320981.566716135, 138350968.06807095, 46321009.93001547, 138351024.47811443, 46320953.2034168, 138350994.8628416, 46320982.9848811, 138350997.68334377, 46320980.148551166, 0, 0, 0, 0, 0 },
-  { 138351010.1298348, 46320995.346132554, 138350982.78689203, 46321024.54139726, 138351037.47277758, 46320966.15086785, 138351008.76268765, 46320996.80589579, 138351011.49698195, 46320993.88636932, 1, 3, 138350777.7148213, 46321243.50588253, 27 },
-  { 138351024.3486605, 46321008.66283104, 138350997.92176387, 46321038.68980448, 138351050.77555713, 46320978.6358576, 138351023.02731568, 46321010.16417971, 138351025.67000532, 46321007.161482364, 0, 0, 0, 0, 0 },
-  { 138351038.9417641, 46321021.50629796, 138351013.41644415, 46321052.30334395, 138351064.46708402, 46320990.70925197, 138351037.66549808, 46321023.04615026, 138351040.2180301, 46321019.96644566, 0, 0, 0, 0, 0 },
-  { 138351053.89256492, 46321033.89787522, 138351029.24841094, 46321065.404472545, 138351078.5367189, 46321002.391277894, 138351052.66035724, 46321035.47320508, 138351055.1247726, 46321032.32254536, 0, 0, 0, 0, 0 },
-  { 138351069.18439782, 46321045.85899817, 138351045.39584595, 46321078.016498074, 138351092.97294968, 46321013.70149827, 138351067.99497023, 46321047.46687317, 138351070.3738254, 46321044.251123175, 1, 2, 138351006.73944917, 46321130.27243542, 47 },
-  { 138351084.80059782, 46321057.41110218, 138351061.83755457, 46321090.16318067, 138351107.76364106, 46321024.659023695, 138351083.65244564, 46321059.04870611, 138351085.94875, 46321055.77349826, 0, 0, 0, 0, 0 },
-  { 138351100.72449985, 46321068.575622655, 138351078.5529652, 46321101.868610665, 138351122.8960345, 46321035.282634646, 138351099.6159231, 46321070.24027205, 138351101.8330766, 46321066.91097326, 1, 4, 138350979.88963595, 46321250.022407316, 32 },
-  { 138351116.9394387, 46321079.37399493, 138351095.52210715, 46321113.15709588, 138351138.35677025, 46321045.590893984, 138351115.86857212, 46321081.06314998, 138351118.0103053, 46321077.68483988, 0, 0, 0, 0, 0 },
-  { 138351133.42874935, 46321089.8276544, 138351112.72557324, 46321124.053061604, 138351154.13192546, 46321055.60224719, 138351132.39359054, 46321091.53892476, 138351134.46390817, 46321088.11638404, 1, 1, 138350952.79353768, 46321388.44433227, 27 },
-  { 138351150.17576674, 46321099.95803644, 138351130.1444709, 46321134.58096507, 138351170.20706257, 46321065.3351078, 138351149.17420194, 46321101.68918287, 138351151.17733154, 46321098.226890005, 0, 0, 0, 0, 0 },
-  { 138351167.16382584, 46321109.7865764, 138351147.76036683, 46321144.76522386, 138351186.56728485, 46321074.807928935, 138351166.1936529, 46321111.535508774, 138351168.13399878, 46321108.03764402, 1, 2, 138351058.5044554, 46321305.6670022, 50 },
-  { 138351184.3762614, 46321119.33470968, 138351165.5552294, 46321154.630159155, 138351203.19729343, 46321084.03926021, 138351183.4352098, 46321121.09948216, 138351185.31731302, 46321117.56993721, 1, 1, 138351325.06347576, 46320855.50122485, 48 },
-  { 138351201.79640856, 46321128.62387166, 138351183.51136974, 46321164.19995008, 138351220.0814474, 46321093.04779325, 138351200.8821566, 46321130.402675584, 138351202.71066052, 46321126.84506774, 0, 0, 0, 0, 0 },
-  { 138351219.40760204, 46321137.675497666, 138351201.6113858, 46321173.498600364, 138351237.2038183, 46321101.85239497, 138351218.51779124, 46321139.4666528, 138351220.29741284, 46321135.88434253, 0, 0, 0, 0, 0 },
-  { 138351237.19317687, 46321146.51102312, 138351219.83810985, 46321182.549913906, 138351254.54824388, 46321110.47213233, 138351236.3254235, 46321148.31296766, 138351238.06093022, 46321144.70907858, 0, 0, 0, 0, 0 },
-  { 138351255.13646793, 46321155.15188337, 138351238.17456016, 46321191.3774777, 138351272.0983757, 46321118.926289044, 138351254.28837255, 46321156.963163085, 138351255.98456332, 46321153.34060366, 0, 0, 0, 0, 0 },
-  { 138351273.22081015, 46321163.6195138, 138351256.6038981, 46321200.00465135, 138351289.83772218, 46321127.23437625, 138351272.38996455, 46321165.43877068, 138351274.05165574, 46321161.80025692, 0, 0, 0, 0, 0 },
-  { 138351291.42953843, 46321171.935349785, 138351275.10939068, 46321208.45456085, 138351307.74968618, 46321135.416138716, 138351290.61353105, 46321173.76131034, 138351292.2455458, 46321170.10938923, 0, 0, 0, 0, 0 },
-  { 138351309.7459877, 46321180.12082669, 138351293.67437795, 46321216.75009585, 138351325.81759748, 46321143.49155753, 138351308.94240722, 46321181.95229015, 138351310.5495682, 46321178.289363235, 1, 1, 138351216.9324413, 46321391.65485611, 33 },
-  { 138351328.15349293, 46321188.19737988, 138351312.28224605, 46321224.91390916, 138351344.0247398, 46321151.4808506, 138351327.35993057, 46321190.03320634, 138351328.94705528, 46321186.361553416, 1, 4, 138351368.2283913, 46321095.488143444, 40 },
-  { 138351346.63538897, 46321196.18644477, 138351330.91640532, 46321232.96841797, 138351362.35437262, 46321159.40447156, 138351345.8494398, 46321198.02554343, 138351347.42133814, 46321194.347346105, 1, 3, 138351192.98232374, 46321555.73023285, 27 },
-  { 138351365.1750107, 46321204.10945666, 138351349.5602723, 46321240.93580517, 138351380.78974912, 46321167.283108145, 138351364.3942738, 46321205.95077408, 138351365.95574763, 46321202.268139236, 1, 5, 138351456.9115988, 46320987.754659146, 48 },
-  { 138351383.75569317, 46321211.987851, 138351368.1972576, 46321248.83802174, 138351399.31412873, 46321175.13768026, 138351382.9777714, 46321213.83035954, 138351384.53361493, 46321210.14534246, 0, 0, 0, 0, 0 },
-  { 138351402.36077118, 46321219.8430631, 138351386.81075633, 46321256.69678798, 138351417.91078603, 46321182.98933822, 138351401.58327043, 46321221.685749345, 138351403.13827193, 46321218.00037686, 1, 3, 138351458.72957507, 46321086.24831041, 37 },
-  { 138351420.97357967, 46321227.69652838, 138351405.3841441, 46321264.533595294, 138351436.56301525, 46321190.85946147, 138351420.1941079, 46321229.538381726, 138351421.75305146, 46321225.85467504, 0, 0, 0, 0, 0 },
-  { 138351439.57745358, 46321235.56968219, 138351423.9007762, 46321272.36970647, 138351455.25413096, 46321198.76965791, 138351438.79361972, 46321237.4096834, 138351440.36128744, 46321233.72968098, 1, 5, 138351555.19294915, 46320964.169503145, 30 },
-  { 138351458.15572786, 46321243.4839599, 138351442.3439908, 46321280.22615596, 138351473.96746492, 46321206.74176384, 138351457.365141, 46321245.3210697, 138351458.94631472, 46321241.646850094, 0, 0, 0, 0, 0 },
-  { 138351476.6917374, 46321251.4607969, 138351460.6971163, 46321288.12374952, 138351492.68635854, 46321214.79784428, 138351475.89200637, 46321253.29394453, 138351477.49146846, 46321249.62764927, 0, 0, 0, 0, 0 },
-  { 138351495.16881707, 46321259.52162855, 138351478.94348267, 46321296.08306347, 138351511.39415148, 46321222.960193634, 138351494.35755035, 46321261.349700294, 138351495.9800838, 46321257.69355681, 1, 1, 138351366.17740846, 46321550.18503613, 42 },
-  { 138351513.5703019, 46321267.68789023, 138351497.06643707, 46321304.12444394, 138351530.07416672, 46321231.25133652, 138351512.74510866, 46321269.50971792, 138351514.39549512, 46321265.866062544, 0, 0, 0, 0, 0 },
-  { 138351531.87952667, 46321275.98101732, 138351515.04936397, 46321312.26800704, 138351548.70968938, 46321239.6940276, 138351531.03801852, 46321277.79536681, 138351532.72103482, 46321274.166667834, 0, 0, 0, 0, 0 },
-  { 138351550.07982638, 46321284.42244517, 138351532.8757094, 46321320.53363954, 138351567.28394336, 46321248.3112508, 138351549.21962053, 46321286.22800489, 138351550.94003224, 46321282.61688545, 0, 0, 0, 0, 0 },
-  { 138351568.15453592, 46321293.033609174, 138351550.52901098, 46321328.94100216, 138351585.78006086, 46321257.12621619, 138351567.27325967, 46321294.82897882, 138351569.03581217, 46321291.23823953, 0, 0, 0, 0, 0 },
-  { 138351586.08699027, 46321301.835944705, 138351567.99293187, 46321337.50953508, 138351604.18104866, 46321266.16235433, 138351585.18228734, 46321303.61962423, 138351586.9916932, 46321300.05226518, 1, 3, 138351738.98178378, 46321000.394106, 46 },
-  { 138351603.8605243, 46321310.85088711, 138351585.25130007, 46321346.25846784, 138351622.46974853, 46321275.44330639, 138351602.9300631, 46321312.62126615, 138351604.7909855, 46321309.080508076, 0, 0, 0, 0, 0 },
-  { 138351621.45847294, 46321320.099871814, 138351602.28815284, 46321355.20683447, 138351640.62879303, 46321284.992909156, 138351620.49995694, 46321321.855219945, 138351622.41698894, 46321318.34452368, 0, 0, 0, 0, 0 },
-  { 138351638.864171, 46321329.60433412, 138351619.08778483, 46321364.373495035, 138351658.64055717, 46321294.83517321, 138351637.8753517, 46321331.34279217, 138351639.8529903, 46321327.86587608, 1, 1, 138351486.58599758, 46321597.32687314, 28 },
-  { 138351656.0609536, 46321339.385709465, 138351635.63480008, 46321373.77716557, 138351676.4871071, 46321304.99425336, 138351655.0396459, 46321341.10528227, 138351657.08226126, 46321337.66613666, 1, 5, 138351841.4282966, 46321027.283245295, 32 },
-  { 138351673.03215554, 46321349.465433195, 138351651.91416582, 46321383.43645777, 138351694.15014526, 46321315.49440862, 138351671.97625607, 46321351.163984425, 138351674.088055, 46321347.766881965, 0, 0, 0, 0, 0 },
-  { 138351689.7611117, 46321359.86494067, 138351667.91126728, 46321393.369929835, 138351711.61095613, 46321326.35995151, 138351688.66861948, 46321361.54019013, 138351690.85360393, 46321358.189691216, 0, 0, 0, 0, 0 },
-  { 138351706.2311571, 46321370.6056673, 138351683.61195993, 46321403.59614957, 138351728.85035425, 46321337.61518503, 138351705.10019723, 46321372.255191416, 138351707.36211696, 46321368.956143185, 0, 0, 0, 0, 0 },
-  { 138351722.42562658, 46321381.70904842, 138351699.00261667, 46321414.13377058, 138351745.84863648, 46321349.28432626, 138351721.25447607, 46321383.33028453, 138351723.59677708, 46321380.08781231, 1, 3, 138351937.33174244, 46321084.212222606, 26 },
-  { 138351738.32785508, 46321393.19651943, 138351714.06937826, 46321425.00102072, 138351762.5863319, 46321361.39201813, 138351737.11493123, 46321394.78674449, 138351739.54077893, 46321391.606294364, 0, 0, 0, 0, 0 },
-  { 138351753.9211861, 46321405.09013333, 138351728.77392647, 46321436.19664926, 138351779.0684457, 46321373.9836174, 138351752.6638231, 46321406.64545913, 138351755.17854908, 46321403.53480753, 0, 0, 0, 0, 0 },
-  { 138351769.18925855, 46321417.43321229, 138351743.07859042, 46321447.73557211, 138351795.29992667, 46321387.13085247, 138351767.88372514, 46321418.948330276, 138351770.49479195, 46321415.9180943, 1, 1, 138351579.23414803, 46321637.882879995, 43 },
-  { 138351784.11607426, 46321430.2952182, 138351756.9814357, 46321459.684185326, 138351811.25071284, 46321400.90625107, 138351782.75934234, 46321431.76466656, 138351785.4728062, 46321428.82576984, 0, 0, 0, 0, 0 },
-  { 138351798.68565744, 46321443.7472178, 138351770.48468295, 46321472.1145412, 138351826.88663194, 46321415.37989439, 138351797.27560872, 46321445.16558397, 138351800.09570616, 46321442.328851625, 1, 2, 138351610.44415265, 46321633.09910153, 29 },
-  { 138351812.88197118, 46321457.86028289, 138351783.43043885, 46321484.92700127, 138351842.3335035, 46321430.79356451, 138351811.40939456, 46321459.21361881, 138351814.3545478, 46321456.50694697, 0, 0, 0, 0, 0 },
-  { 138351826.53659594, 46321472.71799918, 138351795.18873706, 46321497.56375826, 138351857.88445482, 46321447.872240104, 138351824.969203, 46321473.96028714, 138351828.1039889, 46321471.47571123, 0, 0, 0, 0, 0 },
-  { 138351839.0003005, 46321488.44343749, 138351805.1501014, 46321509.754561834, 138351872.8504996, 46321467.13231314, 138351837.30779055, 46321489.50899371, 138351840.69281045, 46321487.377881266, 0, 0, 0, 0, 0 },
-  { 138351849.52925593, 46321505.1674372, 138351812.91315275, 46321521.2690206, 138351886.1453591, 46321489.065853804, 138351847.69845077, 46321505.97251637, 138351851.36006108, 46321504.36235803, 1, 5, 138351584.97791046, 46321621.50137728, 29 },
-  { 138351857.3800534, 46321523.02068823, 138351818.5983485, 46321532.81759406, 138351896.1617583, 46321513.2237824, 138351855.44096816, 46321523.51053352, 138351859.31913865, 46321522.53084294, 0, 0, 0, 0, 0 },
-  { 138351862.17545533, 46321542.0036065, 138351822.46748453, 46321546.82823666, 138351901.88342613, 46321537.178976335, 138351860.1900568, 46321542.24483801, 138351864.16085386, 46321541.76237499, 1, 0, 138351547.48978686, 46321580.238800526, 49 },
-  { 138351864.5744482, 46321561.747946575, 138351824.60972616, 46321563.42752771, 138351904.53917024, 46321560.06836544, 138351862.5762121, 46321561.83192563, 138351866.5726843, 46321561.66396752, 0, 0, 0, 0, 0 },
-  { 138351865.4180379, 46321581.82070571, 138351825.41804126, 46321581.80428149, 138351905.41803452, 46321581.837129936, 138351863.41803807, 46321581.8198845, 138351867.4180377, 46321581.82152692, 1, 0, 138351546.41806477, 46321581.68972251, 42 },
-  { 138351865.40980685, 46321601.866808094, 138351825.4325611, 46321600.51780015, 138351905.3870526, 46321603.215816036, 138351863.41094455, 46321601.7993577, 138351867.40866914, 46321601.93425849, 0, 0, 0, 0, 0 },
-  { 138351864.73635206, 46321621.82433902, 138351824.81822237, 46321619.26642529, 138351904.65448174, 46321624.382252745, 138351862.74044558, 46321621.696443334, 138351866.73225853, 46321621.9522347, 0, 0, 0, 0, 0 },
-  { 138351863.46271977, 46321641.70030995, 138351823.6285613, 46321638.061653994, 138351903.29687825, 46321645.3389659, 138351861.47101185, 46321641.51837715, 138351865.4544277, 46321641.88224275, 0, 0, 0, 0, 0 },
-  { 138351861.65395647, 46321661.501732424, 138351821.91802597, 46321656.91306943, 138351901.38988698, 46321666.09039542, 138351859.66715994, 46321661.272299275, 138351863.640753, 46321661.73116557, 1, 0, 138351593.43642566, 46321630.52825722, 50 },
-  { 138351859.37510836, 46321681.235617936, 138351819.74221334, 46321675.828804344, 138351899.00800338, 46321686.64243153, 138351857.3934636, 46321680.965277255, 138351861.3567531, 46321681.50595862, 0, 0, 0, 0, 0 },
-  { 138351856.6912219, 46321700.90897801, 138351817.15800303, 46321694.81598153, 138351896.22444075, 46321707.001974486, 138351854.71456096, 46321700.604328185, 138351858.66788283, 46321701.21362783, 0, 0, 0, 0, 0 },
-  { 138351853.66734332, 46321720.52882415, 138351814.22361207, 46321713.88111284, 138351893.11107457, 46321727.176535465, 138351851.69515675, 46321720.19643859, 138351855.63952988, 46321720.86120971, 1, 4, 138352136.67611498, 46321768.226152815, 30 },
-  { 138351850.36851904, 46321740.10216785, 138351810.99859893, 46321733.03043609, 138351889.73843914, 46321747.17389961, 138351848.40002304, 46321739.74858126, 138351852.33701503, 46321740.455754444, 0, 0, 0, 0, 0 },
-  { 138351846.85979545, 46321759.63602065, 138351807.5438381, 46321752.2701874, 138351886.1757528, 46321767.001853906, 138351844.89399758, 46321759.26772899, 138351848.82559332, 46321760.004312314, 0, 0, 0, 0, 0 },
-  { 138351843.20621878, 46321779.137394026, 138351803.9214853, 46321771.606808655, 138351882.49095225, 46321786.6679794, 138351841.2419821, 46321778.76086476, 138351845.17045546, 46321779.513923295, 1, 3, 138351742.04803008, 46321759.7461367, 32 },
-  { 138351839.47283545, 46321798.613299526, 138351800.1949479, 46321791.047088504, 138351878.750723, 46321806.17951055, 138351837.50894108, 46321798.23498897, 138351841.43672982, 46321798.99161008, 0, 0, 0, 0, 0 },
-  { 138351835.72469178, 46321818.07074862, 138351796.4288692, 46321810.598243855, 138351875.02051437, 46321825.543253385, 138351833.75990066, 46321817.69712338, 138351837.6894829, 46321818.44437386, 0, 0, 0, 0, 0 },
-  { 138351832.0268341, 46321837.51675285, 138351792.6891332, 46321830.26793996, 138351871.364535, 46321844.76556573, 138351830.05994907, 46321837.1543122, 138351833.99371913, 46321837.87919349, 1, 2, 138352088.70533246, 46321884.8152569, 27 },
-  { 138351828.4443088, 46321856.958323695, 138351789.04289073, 46321850.06424982, 138351867.84572685, 46321863.85239757, 138351826.4742379, 46321856.61362, 138351830.4143797, 46321857.30302739, 1, 5, 138351468.90636897, 46321794.04989958, 48 },
-  { 138351825.0421622, 46321876.40247269, 138351785.55860433, 46321869.99555005, 138351864.5257201, 46321882.80939533, 138351823.0679843, 46321876.08212656, 138351827.0163401, 46321876.72281882, 0, 0, 0, 0, 0 },
-  { 138351821.88544065, 46321895.856211334, 138351782.30610505, 46321890.07034976, 138351861.46477625, 46321901.64207291, 138351819.90647388, 46321895.566918254, 138351823.86440742, 46321896.145504415, 0, 0, 0, 0, 0 },
-  { 138351819.03919047, 46321915.32655114, 138351779.35664928, 46321910.29704565, 138351858.72173166, 46321920.35605663, 138351817.05506343, 46321915.075075865, 138351821.02331752, 46321915.578026414, 1, 4, 138352209.9122211, 46321964.86718021, 30 },
-  { 138351816.56845805, 46321934.82050362, 138351776.78295767, 46321930.6836015, 138351856.35395843, 46321938.957405746, 138351814.57918304, 46321934.61365852, 138351818.55773306, 46321935.02734873, 0, 0, 0, 0, 0 },
-  { 138351814.53828973, 46321954.34508028, 138351774.65921277, 46321951.23715151, 138351854.41736668, 46321957.45300905, 138351812.54433587, 46321954.18968384, 138351816.53224358, 46321954.50047672, 0, 0, 0, 0, 0 },
-  { 138351813.0137318, 46321973.90729263, 138351773.06098711, 46321971.96353565, 138351852.9664765, 46321975.8510496, 138351811.01609457, 46321973.81010478, 138351815.01136905, 46321974.00448047, 1, 1, 138351543.3327051, 46321960.78693306, 28 },
-  { 138351812.05983064, 46321993.51415218, 138351772.06506953, 46321992.866786234, 138351852.05459175, 46321994.16151812, 138351810.06009257, 46321993.48178388, 138351814.0595687, 46321993.54652047, 1, 1, 138352159.01438338, 46321999.13005173, 36 },
-  { 138351811.74163258, 46322013.172670424, 138351771.74898508, 46322013.93957772, 138351851.73428008, 46322012.40576313, 138351809.7420002, 46322013.21101579, 138351813.74126497, 46322013.13432506, 1, 3, 138351707.7607491, 46322015.166629404, 26 },
-  { 138351812.11965737, 46322032.88589005, 138351772.18128967, 46322035.105526686, 138351852.05802506, 46322030.66625342, 138351810.122739, 46322032.99687188, 138351814.11657575, 46322032.77490822, 1, 3, 138352119.64508852, 46322015.79468795, 33 },
-  { 138351813.216617, 46322052.62370476, 138351773.38592634, 46322056.30012708, 138351853.04730764, 46322048.94728244, 138351811.22508246, 46322052.80752588, 138351815.20815152, 46322052.43988364, 0, 0, 0, 0, 0 },
-  { 138351815.0364107, 46322072.33951369, 138351775.3681936, 46322077.48077359, 138351854.70462778, 46322067.19825379, 138351813.05299982, 46322072.59657668, 138351817.01982155, 46322072.082450695, 1, 2, 138352064.94617832, 46322039.94957632, 43 },
-  { 138351817.5828008, 46322091.9865959, 138351778.13410047, 46322098.60475597, 138351857.03150114, 46322085.36843583, 138351815.61036578, 46322092.3175039, 138351819.55523583, 46322091.6556879, 1, 0, 138351591.73899144, 46322129.87556231, 34 },
-  { 138351820.85954967, 46322111.51823047, 138351781.68936878, 46322119.623594694, 138351860.02973056, 46322103.41286624, 138351818.9010406, 46322111.92349868, 138351822.81805873, 46322111.11296225, 0, 0, 0, 0, 0 },
-  { 138351824.86801577, 46322130.88964151, 138351786.01565078, 46322140.40246096, 138351863.72038075, 46322121.376822054, 138351822.92539752, 46322131.36528248, 138351826.81063402, 46322130.41400053, 0, 0, 0, 0, 0 },
-  { 138351829.56888044, 46322150.08896627, 138351791.04404685, 46322160.85173531, 138351868.09371403, 46322139.32619724, 138351827.64263877, 46322150.62710472, 138351831.4951221, 46322149.55082782, 1, 5, 138352134.87818658, 46322064.79402165, 39 },
-  { 138351834.88891414, 46322169.13178065, 138351796.68553382, 46322180.98512329, 138351873.09229445, 46322157.278438, 138351832.97874513, 46322169.72444778, 138351836.79908314, 46322168.539113514, 0, 0, 0, 0, 0 },
-  { 138351840.75385064, 46322188.034499176, 138351802.85272145, 46322200.821383305, 138351878.65497983, 46322175.24761505, 138351838.85879418, 46322188.673843384, 138351842.6489071, 46322187.39515497, 1, 5, 138352172.3887311, 46322076.14926303, 44 },
-  { 138351847.08942372, 46322206.81353645, 138351809.46042237, 46322220.380343616, 138351884.71842507, 46322193.246729285, 138351845.20797366, 46322207.49187681, 138351848.97087377, 46322206.13519609, 0, 0, 0, 0, 0 },
-  { 138351853.8213672, 46322225.48530701, 138351816.42554745, 46322239.682231516, 138351891.21718696, 46322211.2883825, 138351851.9515762, 46322226.19515324, 138351855.6911582, 46322224.77546078, 0, 0, 0, 0, 0 },
-  { 138351860.8754149, 46322244.066225454, 138351823.6669377, 46322258.747139096, 138351898.0838921, 46322229.38531181, 138351859.01499104, 46322244.80027114, 138351862.73583877, 46322243.33217977, 0, 0, 0, 0, 0 },
-  { 138351868.1773006, 46322262.57270631, 138351831.10517874, 46322277.59461632, 138351905.24942246, 46322247.5507963, 138351866.3236945, 46322263.323801816, 138351870.0309067, 46322261.82161081, 0, 0, 0, 0, 0 },
-  { 138351875.65275818, 46322281.02116421, 138351838.66243154, 46322296.24337612, 138351912.64308482, 46322265.7989523, 138351873.80324185, 46322281.782274805, 138351877.5022745, 46322280.26005361, 0, 0, 0, 0, 0 },
-  { 138351883.22752133, 46322299.42801366, 138351846.26230282, 46322314.711096495, 138351920.19273984, 46322284.144930825, 138351881.3792604, 46322300.1921678, 138351885.07578227, 46322298.66385952, 1, 3, 138352153.07361642, 46322187.86150899, 48 },
-  { 138351890.82732397, 46322317.80966927, 138351853.8297684, 46322333.01430278, 138351927.82487956, 46322302.60503576, 138351888.9774462, 46322318.569900945, 138351892.67720175, 46322317.0494376, 0, 0, 0, 0, 0 },
-  { 138351898.37789986, 46322336.18254559, 138351861.29115835, 46322351.168325655, 138351935.46464136, 46322321.19676552, 138351896.5235628, 46322336.93183459, 138351900.23223692, 46322335.43325658, 1, 0, 138352210.83369708, 46322209.927348524, 37 },
-  { 138351905.80498278, 46322354.56305721, 138351868.5742074, 46322369.18733029, 138351943.03575817, 46322339.93878412, 138351903.943444, 46322355.29427086, 138351907.66652155, 46322353.831843555, 1, 4, 138351588.4126225, 46322479.23498527, 35 },
-  { 138351913.03430665, 46322372.96761868, 138351875.60816813, 46322387.08442266, 138351950.46044517, 46322358.8508147, 138351911.16299972, 46322373.67345888, 138351914.90561357, 46322372.26177848, 1, 4, 138352228.34952375, 46322254.03354512, 38 },
-  { 138351919.99160507, 46322391.41264456, 138351882.32398215, 46322404.87184897, 138351957.659228, 46322377.953440145, 138351918.10822392, 46322392.08560478, 138351921.87498623, 46322390.739684336, 0, 0, 0, 0, 0 },
-  { 138351926.6026121, 46322409.914549455, 138351888.65449357, 46322422.56130003, 138351964.55073065, 46322397.26779888, 138351924.7052062, 46322410.54688698, 138351928.50001803, 46322409.28221193, 1, 0, 138352194.13684773, 46322320.754957885, 49 },
-  { 138351932.79306135, 46322428.48974788, 138351894.53468168, 46322440.164352134, 138351971.051441, 46322416.81514363, 138351930.88014236, 46322429.073478095, 138351934.70598033, 46322427.90601767, 0, 0, 0, 0, 0 },
-  { 138351938.4886867, 46322447.15465446, 138351899.90455824, 46322457.70287848, 138351977.07281518, 46322436.60643043, 138351936.55948028, 46322447.68206566, 138351940.41789314, 46322446.62724326, 1, 2, 138352315.64854252, 46322344.04576463, 29 },
-  { 138351943.62015408, 46322465.924941845, 138351904.74108905, 46322475.32804245, 138351982.49921912, 46322456.52184124, 138351941.67620084, 46322466.395096876, 138351945.56410733, 46322465.454786815, 1, 0, 138351772.55226788, 46322507.29858451, 38 },
-  { 138351948.18662947, 46322484.8059792, 138351909.06678057, 46322493.15088316, 138351987.30647838, 46322476.46107524, 138351946.23063704, 46322485.2232244, 138351950.1426219, 46322484.388734, 1, 4, 138352211.26761332, 46322428.68650004, 36 },
-  { 138351952.23742482, 46322503.79559281, 138351912.9244426, 46322511.1772883, 138351991.55040705, 46322496.41389731, 138351950.27177572, 46322504.16467758, 138351954.20307392, 46322503.42650803, 0, 0, 0, 0, 0 },
-  { 138351955.8230012, 46322522.89143615, 138351916.35757548, 46322529.40911758, 138351995.28842694, 46322516.373754725, 138351953.84972993, 46322523.217320226, 138351957.7962725, 46322522.56555208, 0, 0, 0, 0, 0 },
-  { 138351958.99381968, 46322542.0911627, 138351919.41008908, 46322547.84687914, 138351998.5775503, 46322536.33544625, 138351957.01463315, 46322542.37894852, 138351960.97300622, 46322541.803376876, 1, 5, 138351750.18964076, 46322572.452566944, 27 },
-  { 138351961.80034137, 46322561.39242594, 138351922.1264816, 46322566.48995979, 138352001.47420114, 46322556.29489209, 138351959.8166484, 46322561.647302635, 138351963.78403434, 46322561.137549244, 0, 0, 0, 0, 0 },
-  { 138351964.2930272, 46322580.79287931, 138351924.55196145, 46322585.33685255, 138352004.03409293, 46322576.248906076, 138351962.30597392, 46322581.02007797, 138351966.28008047, 46322580.56568065, 0, 0, 0, 0, 0 },
-  { 138351966.5223382, 46322600.29017631, 138351926.7325225, 46322604.385364324, 138352006.31215394, 46322596.194988295, 138351964.53284743, 46322600.49493571, 138351968.511829, 46322600.085416906, 0, 0, 0, 0, 0 },
-  { 138351968.5387356, 46322619.881970435, 138351928.7149825, 46322623.63279563, 138352008.3624887, 46322616.13114524, 138351966.54754794, 46322620.0695117, 138351970.52992326, 46322619.694429174, 0, 0, 0, 0, 0 },
-  { 138351970.3926803, 46322639.5659151, 138351930.54699454, 46322643.07608998, 138352010.23836604, 46322636.05574022, 138351968.400396, 46322639.741423845, 138351972.3849646, 46322639.390406355, 0, 0, 0, 0, 0 },
-  { 138351972.1346334, 46322659.339663826, 138351932.2770405, 46322662.7119463, 138352011.99222627, 46322655.96738135, 138351970.14175373, 46322659.50827795, 138351974.12751305, 46322659.1710497, 0, 0, 0, 0, 0 },
-  { 138351973.81505594, 46322679.20087006, 138351933.95441228, 46322682.53689887, 138352013.6756996, 46322675.86484125, 138351971.82202375, 46322679.3676715, 138351975.80808812, 46322679.03406862, 1, 3, 138352309.64097863, 46322651.094827354, 48 },
-  { 138351975.48440903, 46322699.14718731, 138351935.62918597, 46322702.547363, 138352015.3396321, 46322695.74701162, 138351973.49164787, 46322699.31719609, 138351977.4771702, 46322698.97717852, 1, 3, 138351752.29515988, 46322718.18817116, 30 },
-  { 138351977.19315362, 46322719.176268995, 138351937.352191, 46322722.73965182, 138352017.03411624, 46322715.61288617, 138351975.20110548, 46322719.35443813, 138351979.18520176, 46322718.998099856, 0, 0, 0, 0, 0 },
-  { 138351978.99175087, 46322739.285768636, 138351939.1749762, 46322743.1099621, 138352018.80852553, 46322735.46157517, 138351977.00091213, 46322739.47697831, 138351980.9825896, 46322739.09455896, 0, 0, 0, 0, 0 },
-  { 138351980.93066174, 46322759.47333968, 138351941.1497711, 46322763.65433715, 138352020.71155238, 46322755.2923422, 138351978.94161722, 46322759.68238955, 138351982.91970626, 46322759.264289804, 1, 5, 138352121.15830123, 46322744.73532357, 41 },
-  { 138351983.06034732, 46322779.73663561, 138351943.34243456, 46322784.478724405, 138352022.77826008, 46322774.994546816, 138351981.07445168, 46322779.97374005, 138351985.04624295, 46322779.49953117, 1, 4, 138351585.88121974, 46322827.157523565, 41 },
-  { 138351985.48414317, 46322800.03741787, 138351945.97367442, 46322806.27623654, 138352024.99461192, 46322793.79859919, 138351983.50861973, 46322800.3493588, 138351987.4596666, 46322799.725476936, 1, 5, 138352191.92634243, 46322767.439590275, 36 },
-  { 138351988.65238366, 46322820.101900145, 138351949.68213582, 46322829.11964835, 138352027.6226315, 46322811.08415194, 138351986.70387125, 46322820.55278756, 138351990.60089606, 46322819.65101273, 1, 0, 138351860.05056575, 46322849.86046923, 36 },
-  { 138351993.15531087, 46322839.56132455, 138351955.37452418, 46322852.699519165, 138352030.93609756, 46322826.42312994, 138351991.26627153, 46322840.218234286, 138351995.0443502, 46322838.90441482, 0, 0, 0, 0, 0 },
-  { 138351999.5835538, 46322858.04667065, 138351964.12048325, 46322876.54993059, 138352035.04662433, 46322839.54341072, 138351997.81040028, 46322858.97183365, 138352001.3567073, 46322857.12150766, 0, 0, 0, 0, 0 },
-  { 138352008.52771974, 46322875.18892498, 138351976.72265044, 46322899.44665707, 138352040.33278903, 46322850.9311929, 138352006.93746626, 46322876.401811585, 138352010.1179732, 46322873.97603838, 1, 2, 138352292.38796335, 46322658.688666105, 42 },
-  { 138352020.3514572, 46322890.69139605, 138351992.53774872, 46322919.438528426, 138352048.1651657, 46322861.944263674, 138352018.96077177, 46322892.12875267, 138352021.74214265, 46322889.25403943, 0, 0, 0, 0, 0 },
-  { 138352034.63179946, 46322904.508053355, 138352010.5921175, 46322936.478253394, 138352058.67148143, 46322872.537853315, 138352033.42981535, 46322906.10656336, 138352035.83378357, 46322902.90954335, 0, 0, 0, 0, 0 },
-  { 138352050.7754764, 46322916.64713472, 138352030.16667166, 46322950.929450385, 138352071.38428113, 46322882.36481906, 138352049.74503615, 46322918.361250505, 138352051.80591664, 46322914.93301894, 1, 2, 138351912.69648463, 46323146.33864966, 29 },
-  { 138352068.19020078, 46322927.11599155, 138352050.97351146, 46322963.22119351, 138352085.4068901, 46322891.01078959, 138352067.3293663, 46322928.92125165, 138352069.05103526, 46322925.31073145, 0, 0, 0, 0, 0 },
-  { 138352086.4128839, 46322935.805439524, 138352073.2330473, 46322973.57171955, 138352099.5927205, 46322898.0391595, 138352085.75389206, 46322937.693753526, 138352087.07187575, 46322933.91712552, 1, 4, 138352002.06192967, 46323177.50963171, 46 },
-  { 138352105.2370942, 46322942.37479228, 138352096.94084367, 46322981.50498813, 138352113.53334472, 46322903.24459643, 138352104.82228166, 46322944.33130207, 138352105.65190673, 46322940.41828249, 0, 0, 0, 0, 0 },
-  { 138352124.48670477, 46322946.45602899, 138352121.9127259, 46322986.373125985, 138352127.06068364, 46322906.538931996, 138352124.35800582, 46322948.45188384, 138352124.6154037, 46322944.46017414, 1, 1, 138352106.14710534, 46323230.865345106, 45 },
-  { 138352143.98847136, 46322947.7135637, 138352146.53152642, 46322987.63264274, 138352141.4454163, 46322907.79448467, 138352144.1156241, 46322949.70951766, 138352143.86131862, 46322945.71760975, 1, 4, 138352137.31295186, 46322842.92598124, 44 },
-  { 138352163.62698093, 46322946.462487474, 138352169.3362946, 46322986.05293755, 138352157.91766727, 46322906.872037396, 138352163.91244662, 46322948.44200998, 138352163.34151524, 46322944.48296497, 0, 0, 0, 0, 0 },
-  { 138352183.34030324, 46322943.61964179, 138352190.33311933, 46322983.00365534, 138352176.34748715, 46322904.23562824, 138352183.68994406, 46322945.58884247, 138352182.99066243, 46322941.65044111, 0, 0, 0, 0, 0 },
-  { 138352203.0689029, 46322940.11673651, 138352210.27903542, 46322979.46154543, 138352195.8587704, 46322900.77192759, 138352203.42940953, 46322942.083976954, 138352202.7083963, 46322938.14949606, 0, 0, 0, 0, 0 },
-  { 138352222.7720009, 46322936.506045505, 138352230.1869912, 46322975.812761456, 138352215.3570106, 46322897.199329555, 138352223.1427504, 46322938.4713813, 138352222.4012514, 46322934.54070971, 1, 4, 138352188.8484202, 46322756.67782004, 25 },
-  { 138352242.43567145, 46322932.79660494, 138352250.1234587, 46322972.05087766, 138352234.74788418, 46322893.54233222, 138352242.82006082, 46322934.759318575, 138352242.05128208, 46322930.8338913, 0, 0, 0, 0, 0 },
-  { 138352262.04805762, 46322928.955600075, 138352270.07674864, 46322968.14156849, 138352254.0193666, 46322889.76963166, 138352262.44949216, 46322930.91489849, 138352261.64662308, 46322926.99630166, 0, 0, 0, 0, 0 },
-  { 138352281.59730235, 46322924.950216204, 138352290.03513384, 46322964.05012669, 138352273.15947086, 46322885.85030572, 138352282.01919392, 46322926.905211724, 138352281.17541078, 46322922.99522068, 0, 0, 0, 0, 0 },
-  { 138352301.07154867, 46322920.747638576, 138352309.98680094, 46322959.74146215, 138352292.1562964, 46322881.753815, 138352301.51731128, 46322922.69732975, 138352300.62578607, 46322918.7979474, 0, 0, 0, 0, 0 },
-  { 138352320.4589396, 46322916.31505246, 138352329.91979134, 46322955.18010468, 138352310.99808788, 46322877.450000234, 138352320.9319822, 46322918.258305065, 138352319.98589703, 46322914.37179985, 1, 2, 138352367.99971956, 46323111.61193989, 48 },
-  { 138352339.74761817, 46322911.61964315, 138352349.8219316, 46322950.33021288, 138352329.67330474, 46322872.90907342, 138352340.25133383, 46322913.55517164, 138352339.2439025, 46322909.684114665, 1, 1, 138352242.2786357, 46322537.09488101, 28 },
-  { 138352358.9257273, 46322906.6285959, 138352369.68075275, 46322945.155591995, 138352348.17070186, 46322868.10159981, 138352359.46347857, 46322908.55494571, 138352358.38797605, 46322904.7022461, 0, 0, 0, 0, 0 },
-  { 138352377.98141006, 46322901.30909598, 138352389.48340085, 46322939.61972384, 138352366.47941926, 46322862.998468116, 138352378.55650958, 46322903.224627376, 138352377.40631053, 46322899.39356458, 1, 2, 138352333.98629522, 46322754.770944394, 47 },
-  { 138352396.9028095, 46322895.628328666, 138352409.2165401, 46322933.68581202, 138352384.5890789, 46322857.57084531, 138352397.51849604, 46322897.53120283, 138352396.28712296, 46322893.7254545, 1, 4, 138352496.64402723, 46323203.89394382, 48 },
-  { 138352415.67806852, 46322889.55347923, 138352428.86625025, 46322927.31684591, 138352402.4898868, 46322851.790112555, 138352416.3374776, 46322891.44164757, 138352415.01865944, 46322887.6653109, 0, 0, 0, 0, 0 },
-  { 138352434.29533017, 46322883.05173292, 138352448.41792586, 46322920.47568636, 138352420.17273447, 46322845.627779484, 138352435.00145996, 46322884.92293059, 138352433.58920038, 46322881.18053525, 1, 4, 138352498.90620548, 46323054.266319886, 37 },
-  { 138352452.7427375, 46322876.09027504, 138352467.85618076, 46322913.12517524, 138352437.62929425, 46322839.055374846, 138352453.49840966, 46322877.94202005, 138352451.98706535, 46322874.23853003, 0, 0, 0, 0, 0 },
-  { 138352471.0084335, 46322868.63629086, 138352487.1647659, 46322905.22826981, 138352454.8521011, 46322832.04431192, 138352471.81625012, 46322870.46588981, 138352470.20061687, 46322866.806691915, 0, 0, 0, 0, 0 },
-  { 138352489.08056113, 46322860.65696561, 138352506.32650995, 46322896.748200685, 138352471.8346123, 46322824.56573054, 138352489.94285858, 46322862.46152737, 138352488.2182637, 46322858.85240386, 0, 0, 0, 0, 0 },
-  { 138352506.94726345, 46322852.11948461, 138352525.32329273, 46322887.64864936, 138352488.57123417, 46322816.590319864, 138352507.8660649, 46322853.89594285, 138352506.028462, 46322850.34302637, 1, 4, 138352628.22905675, 46323086.61197194, 37 },
-  { 138352524.59668338, 46322842.9910331, 138352544.22899503, 46322877.84174815, 138352504.96437174, 46322808.14031805, 138352525.57829896, 46322844.733568855, 138352523.6150678, 46322841.248497345, 0, 0, 0, 0, 0 },
-  { 138352541.97023156, 46322833.20406283, 138352564.08419666, 46322866.535317644, 138352519.85626647, 46322799.87280801, 138352543.07592982, 46322834.87062557, 138352540.8645333, 46322831.53750008, 0, 0, 0, 0, 0 },
-  { 138352558.4464976, 46322822.27271404, 138352584.76555407, 46322852.39425559, 138352532.1274411, 46322792.15117249, 138352559.76245043, 46322823.77879112, 138352557.13054475, 46322820.76663696, 1, 1, 138352403.82204068, 46322645.30865744, 42 },
-  { 138352573.0872373, 46322809.48019295, 138352603.3672675, 46322835.616753004, 138352542.8072071, 46322783.3436329, 138352574.60123882, 46322810.78702095, 138352571.57323578, 46322808.17336495, 0, 0, 0, 0, 0 },
-  { 138352585.77186048, 46322794.78465643, 138352618.5867228, 46322817.657889955, 138352552.95699817, 46322771.9114229, 138352587.4126036, 46322795.928318106, 138352584.13111737, 46322793.64099475, 0, 0, 0, 0, 0 },
-  { 138352597.00906786, 46322778.663306005, 138352631.23752165, 46322799.36144485, 138352562.78061408, 46322757.96516716, 138352598.72049055, 46322779.69821295, 138352595.29764518, 46322777.62839906, 0, 0, 0, 0, 0 },
-  { 138352607.32344687, 46322761.606446564, 138352642.12578234, 46322781.32439385, 138352572.5211114, 46322741.888499275, 138352609.06356364, 46322762.59234393, 138352605.5833301, 46322760.6205492, 1, 3, 138352326.29458788, 46322602.38402219, 37 },
-  { 138352617.239585, 46322744.10438303, 138352651.91177598, 46322764.050289206, 138352582.56739405, 46322724.15847685, 138352618.97319457, 46322745.10167834, 138352615.50597546, 46322743.10708772, 1, 2, 138352809.6702449, 46322854.80416232, 31 },
-  { 138352627.28206953, 46322726.64742028, 138352661.09610385, 46322748.0158803, 138352593.46803522, 46322705.27896026, 138352628.97277126, 46322727.71584328, 138352625.5913678, 46322725.57899728, 1, 3, 138352533.44812432, 46322667.34994372, 46 },
-  { 138352637.9754879, 46322709.72586324, 138352670.02665722, 46322733.65748549, 138352605.92431855, 46322685.79424099, 138352639.57804635, 46322710.92244435, 138352636.37292942, 46322708.52928213, 1, 0, 138352821.4684324, 46322846.73440062, 38 },
-  { 138352649.84442747, 46322693.8300168, 138352679.1744594, 46322721.02834813, 138352620.51439553, 46322666.631685466, 138352651.31092906, 46322695.18993337, 138352648.37792587, 46322692.47010023, 0, 0, 0, 0, 0 },
-  { 138352663.27760887, 46322679.343994305, 138352689.8372824, 46322709.25358711, 138352636.71793535, 46322649.4344015, 138352664.60559255, 46322680.83947395, 138352661.9496252, 46322677.84851466, 1, 1, 138352781.46815607, 46322812.44168231, 35 },
-  { 138352678.08229822, 46322666.19745238, 138352702.19708958, 46322698.11103628, 138352653.96750686, 46322634.283868484, 138352679.28803778, 46322667.793131575, 138352676.87655866, 46322664.60177319, 1, 4, 138352517.7189356, 46322453.97211946, 30 },
-  { 138352693.93167755, 46322654.22122066, 138352715.6683441, 46322687.79974545, 138352672.195011, 46322620.64269587, 138352695.01851088, 46322655.900146894, 138352692.84484422, 46322652.54229442, 0, 0, 0, 0, 0 },
-  { 138352710.64561617, 46322643.401647344, 138352729.93553478, 46322678.44303774, 138352691.35569757, 46322608.36025695, 138352711.6101121, 46322645.15371686, 138352709.68112025, 46322641.649577826, 0, 0, 0, 0, 0 },
-  { 138352728.10541508, 46322633.79021082, 138352744.87382728, 46322670.10577707, 138352711.33700287, 46322597.47464457, 138352728.94383568, 46322635.605989136, 138352727.26699448, 46322631.974432506, 1, 5, 138352803.14405972, 46322796.30236978, 45 },
-  { 138352746.19258362, 46322625.43861041, 138352760.35481817, 46322662.84758143, 138352732.03034908, 46322588.02963939, 138352746.90069535, 46322627.309058964, 138352745.4844719, 46322623.56816186, 1, 2, 138352659.448897, 46322396.30866293, 32 },
-  { 138352764.78863114, 46322618.39854544, 138352776.2471816, 46322656.72218855, 138352753.3300807, 46322580.074902326, 138352765.36155868, 46322620.31472759, 138352764.2157036, 46322616.48236328, 0, 0, 0, 0, 0 },
-  { 138352783.77506894, 46322612.72170895, 138352792.49855968, 46322651.75887982, 138352775.0515782, 46322573.68453809, 138352784.21124348, 46322614.673567496, 138352783.3388944, 46322610.76985041, 0, 0, 0, 0, 0 },
-  { 138352803.04699373, 46322608.415083915, 138352809.29044214, 46322647.92482135, 138352796.80354533, 46322568.90534648, 138352803.35916615, 46322610.39057079, 138352802.73482132, 46322606.43959704, 1, 5, 138352832.85945985, 46322797.07408016, 45 },
-  { 138352822.5456274, 46322605.33385076, 138352826.65631953, 46322645.122067735, 138352818.43493524, 46322565.54563378, 138352822.751162, 46322607.3232616, 138352822.34009278, 46322603.34443991, 0, 0, 0, 0, 0 },
-  { 138352842.22197226, 46322603.301002786, 138352844.56375253, 46322643.23239476, 138352839.88019198, 46322563.36961081, 138352842.33906126, 46322605.29757238, 138352842.10488325, 46322601.30443319, 0, 0, 0, 0, 0 },
-  { 138352862.02703047, 46322602.13953327, 138352862.9663802, 46322642.12850202, 138352861.08768073, 46322562.150564514, 138352862.07399794, 46322604.13898171, 138352861.980063, 46322600.140084825, 0, 0, 0, 0, 0 },
-  { 138352881.9118043, 46322601.672435515, 138352881.80580994, 46322641.67229508, 138352882.01779863, 46322561.67257595, 138352881.90650457, 46322603.672428496, 138352881.917104, 46322599.67244253, 1, 1, 138352881.10624725, 46322905.671368204, 48 },
-  { 138352901.8271189, 46322601.72520847, 138352900.7023319, 46322641.70939102, 138352902.9519059, 46322561.74102592, 138352901.77087957, 46322603.7244176, 138352901.88335824, 46322599.72599934, 1, 2, 138352910.3473805, 46322298.84502565, 38 },
-  { 138352921.71241075, 46322602.28459762, 138352919.07028753, 46322642.197242044, 138352924.35453397, 46322562.3719532, 138352921.5803046, 46322604.280229844, 138352921.8445169, 46322600.2889654, 0, 0, 0, 0, 0 },
-  { 138352941.4890056, 46322603.5937617, 138352936.77434373, 46322643.31493947, 138352946.20366746, 46322563.872583926, 138352941.2532725, 46322605.57982059, 138352941.7247387, 46322601.60770281, 0, 0, 0, 0, 0 },
-  { 138352961.0766168, 46322605.91869184, 138352953.7362289, 46322645.23940782, 138352968.41700467, 46322566.59797585, 138352960.7095974, 46322607.884727634, 138352961.44363618, 46322603.95265604, 0, 0, 0, 0, 0 },
-  { 138352980.39504206, 46322609.52505381, 138352970.2035767, 46322648.20494567, 138352990.5865074, 46322570.845161945, 138352979.88546878, 46322611.4590484, 138352980.90461534, 46322607.591059215, 0, 0, 0, 0, 0 },
-  { 138352999.40188494, 46322614.53301973, 138352986.9250969, 46322652.537358426, 138353011.878673, 46322576.52868103, 138352998.77804554, 46322616.433236666, 138353000.02572435, 46322612.63280279, 0, 0, 0, 0, 0 },
-  { 138353018.15196013, 46322620.68865149, 138353004.05623746, 46322658.12273492, 138353032.2476828, 46322583.254568055, 138353017.447174, 46322622.560355656, 138353018.85674626, 46322618.81694732, 1, 2, 138353068.89656177, 46322485.925951146, 33 },
-  { 138353036.71549147, 46322627.67870883, 138353021.6310016, 46322664.72541131, 138353051.79998136, 46322590.63200635, 138353035.96126696, 46322629.531043954, 138353037.46971598, 46322625.826373704, 0, 0, 0, 0, 0 },
-  { 138353055.16270283, 46322635.18995152, 138353039.60499513, 46322672.04042955, 138353070.72041053, 46322598.339473486, 138353054.38481745, 46322637.03247542, 138353055.9405882, 46322633.347427614, 0, 0, 0, 0, 0 },
-  { 138353073.5519323, 46322642.95360269, 138353057.61751866, 46322679.6427627, 138353089.48634595, 46322606.264442675, 138353072.75521162, 46322644.78806069, 138353074.348653, 46322641.119144686, 0, 0, 0, 0, 0 },
-  { 138353091.88416132, 46322650.915445365, 138353075.5462151, 46322687.42669723, 138353108.22210756, 46322614.4041935, 138353091.06726402, 46322652.74100796, 138353092.70105863, 46322649.08988277, 0, 0, 0, 0, 0 },
-  { 138353110.143093, 46322659.08589772, 138353093.374757, 46322695.40149917, 138353126.911429, 46322622.770296276, 138353109.3046762, 46322660.901677795, 138353110.98150977, 46322657.27011765, 0, 0, 0, 0, 0 },
-  { 138353128.3124269, 46322667.47539104, 138353111.08685672, 46322703.57635684, 138353145.53799707, 46322631.37442523, 138353127.4511484, 46322669.280439325, 138353129.1737054, 46322665.67034275, 0, 0, 0, 0, 0 },
-  { 138353146.37586278, 46322676.09435663, 138353128.66625935, 46322711.960356496, 138353164.0854662, 46322640.22835677, 138353145.4903826, 46322677.88765663, 138353147.26134294, 46322674.30105664, 0, 0, 0, 0, 0 },
-  { 138353164.31710017, 46322684.95322578, 138353146.09675843, 46322720.562482245, 138353182.5374419, 46322649.34396931, 138353163.40608308, 46322686.7336886, 138353165.22811726, 46322683.17276295, 1, 3, 138353293.6815266, 46322432.12750483, 36 },
-  { 138353182.1198388, 46322694.06242979, 138353163.36221364, 46322729.39161741, 138353200.87746397, 46322658.73324218, 138353181.18195754, 46322695.828889176, 138353183.05772007, 46322692.29597041, 1, 3, 138353065.82256272, 46322913.10339303, 34 },
-  { 138353199.76777825, 46322703.432399936, 138353180.44656944, 46322738.45654718, 138353219.08898705, 46322668.40825269, 138353198.80171782, 46322705.183607295, 138353200.73383868, 46322701.68119258, 0, 0, 0, 0, 0 },
-  { 138353217.24461815, 46322713.073567525, 138353197.33387607, 46322747.76596367, 138353237.15536022, 46322678.381171376, 138353216.24908105, 46322714.80818733, 138353218.24015525, 46322711.33894772, 0, 0, 0, 0, 0 },
-  { 138353234.53405818, 46322722.99636385, 138353214.0083116, 46322757.32847311, 138353255.05980477, 46322688.66425458, 138353233.50777087, 46322724.71296931, 138353235.5603455, 46322721.27975839, 1, 5, 138353372.05656037, 46322492.971231766, 29 },
-  { 138353251.6197979, 46322733.211220175, 138353230.45420545, 46322767.15260636, 138353272.78539032, 46322699.26983399, 138353250.56151825, 46322734.908289485, 138353252.67807752, 46322731.514150865, 0, 0, 0, 0, 0 },
-  { 138353268.48553693, 46322743.728567846, 138353246.65606385, 46322777.246833086, 138353290.31501, 46322710.210302606, 138353267.39406326, 46322745.404481106, 138353269.5770106, 46322742.05265459, 0, 0, 0, 0, 0 },
-  { 138353285.11497504, 46322754.558838114, 138353262.59859473, 46322787.61957945, 138353307.63135535, 46322721.49809678, 138353283.989156, 46322756.21187518, 138353286.24079406, 46322752.90580105, 0, 0, 0, 0, 0 },
-  { 138353301.49181172, 46322765.71246227, 138353278.26673403, 46322798.279251575, 138353324.7168894, 46322733.14567296, 138353300.33055782, 46322767.34080173, 138353302.65306562, 46322764.08412281, 1, 4, 138353437.35851628, 46322575.196744815, 32 },
-  { 138353317.59974667, 46322777.199871644, 138353293.64567107, 46322809.23426351, 138353341.55382228, 46322745.16547978, 138353316.4020429, 46322778.80159124, 138353318.79745045, 46322775.59815205, 0, 0, 0, 0, 0 },
-  { 138353333.4224795, 46322789.031497486, 138353308.72087207, 46322820.49307072, 138353358.12408695, 46322757.56992425, 138353332.18739915, 46322790.60457615, 138353334.65755987, 46322787.458418824, 0, 0, 0, 0, 0 },
-  { 138353348.9437099, 46322801.21777111, 138353323.4781014, 46322832.064209856, 138353374.40931842, 46322770.37133237, 138353347.6704295, 46322802.76009305, 138353350.21699032, 46322799.67544918, 1, 5, 138353259.81408012, 46322909.180306725, 47 },
-  { 138353364.1471374, 46322813.76912382, 138353337.90343878, 46322843.956344336, 138353390.39083603, 46322783.58190331, 138353362.83495247, 46322815.27848485, 138353365.45932233, 46322812.259762794, 0, 0, 0, 0, 0 },
-  { 138353379.0164617, 46322826.69598688, 138353351.98329034, 46322856.17831459, 138353406.04963306, 46322797.213659175, 138353377.66480315, 46322828.17010327, 138353380.36812025, 46322825.2218705, 1, 3, 138353239.7956293, 46322978.52997459, 32 },
-  { 138353393.53538242, 46322840.0087916, 138353365.70459488, 46322868.739389665, 138353421.36616996, 46322811.27819354, 138353392.14384305, 46322841.44532151, 138353394.92692178, 46322838.5722617, 1, 5, 138353664.88556093, 46322559.88546052, 37 },
-  { 138353407.6876987, 46322853.717873, 138353379.10063136, 46322881.69607133, 138353436.27476603, 46322825.73967467, 138353406.25834534, 46322855.11678292, 138353409.11705205, 46322852.31896308, 1, 3, 138353126.81976217, 46323128.603671536, 28 },
-  { 138353421.48058954, 46322867.81092841, 138353392.28063217, 46322895.14885976, 138353450.6805469, 46322840.47299706, 138353420.02059168, 46322869.17782498, 138353422.9405874, 46322866.44403184, 0, 0, 0, 0, 0 },
-  { 138353434.9745747, 46322882.22400842, 138353405.31052184, 46322909.05764343, 138353464.6386276, 46322855.39037341, 138353433.49137208, 46322883.56569017, 138353436.45777735, 46322880.88232667, 1, 0, 138353193.2125439, 46323100.918133765, 25 },
-  { 138353448.23757723, 46322896.88599542, 138353418.25010133, 46322923.35770275, 138353478.22505313, 46322870.41428809, 138353446.73820344, 46322898.20958079, 138353449.73695102, 46322895.56241005, 1, 4, 138353673.8933334, 46322697.686397776, 38 },
-  { 138353461.33751997, 46322911.72577181, 138353431.1611926, 46322937.981995195, 138353491.51384735, 46322885.46954842, 138353459.8287036, 46322913.03858297, 138353462.84633633, 46322910.41296064, 0, 0, 0, 0, 0 },
-  { 138353474.34232593, 46322926.67221997, 138353444.10796204, 46322952.86159265, 138353504.5766898, 46322900.48284729, 138353472.83060774, 46322927.981688604, 138353475.8540441, 46322925.362751335, 1, 1, 138353626.2700044, 46322795.07062226, 42 },
-  { 138353487.31991807, 46322941.65422232, 138353457.15708914, 46322967.92595144, 138353517.482747, 46322915.38249319, 138353485.8117766, 46322942.967808776, 138353488.82805952, 46322940.34063586, 0, 0, 0, 0, 0 },
-  { 138353500.33821937, 46322956.600661255, 138353470.37781107, 46322983.10299955, 138353530.29862767, 46322930.09832296, 138353498.84019896, 46322957.92577817, 138353501.83623978, 46322955.27554434, 0, 0, 0, 0, 0 },
-  { 138353513.46515277, 46322971.44041915, 138353483.84185374, 46322998.319038056, 138353543.0884518, 46322944.56180025, 138353511.9839878, 46322972.7843501, 138353514.94631773, 46322970.09648821, 1, 4, 138353260.9265285, 46323200.58064532, 42 },
-  { 138353526.76864117, 46322986.102378406, 138353497.62323773, 46323013.49846314, 138353555.91404462, 46322958.70629367, 138353525.311371, 46322987.47218264, 138353528.22591135, 46322984.73257417, 0, 0, 0, 0, 0 },
-  { 138353540.31660762, 46323000.51542143, 138353511.7979284, 46323028.5633257, 138353568.83528686, 46322972.46751715, 138353538.89067367, 46323001.91781664, 138353541.74254158, 46322999.11302622, 1, 2, 138353284.36146146, 46323252.24536233, 33 },
-  { 138353554.17697504, 46323014.60843061, 138353526.44328314, 46323043.43276641, 138353581.91066694, 46322985.78409481, 138353552.79029045, 46323016.0496474, 138353555.56365964, 46323013.16721382, 0, 0, 0, 0, 0 },
-  { 138353568.41766647, 46323028.31028834, 138353541.63724285, 46323058.02238876, 138353595.19809008, 46322998.59818792, 138353567.0786453, 46323029.79589336, 138353569.75668764, 46323026.824683316, 1, 4, 138353399.7009977, 46323215.49652095, 34 },
-  { 138353583.1066047, 46323041.54987702, 138353557.4572241, 46323072.24367566, 138353608.7559853, 46323010.85607838, 138353581.82413566, 46323043.08456695, 138353584.38907373, 46323040.015187085, 1, 2, 138353665.82585713, 46322942.5623764, 39 },
-  { 138353598.31171286, 46323054.25607904, 138353573.97870162, 46323086.00359177, 138353622.6447241, 46323022.50856631, 138353597.0950623, 46323055.843454674, 138353599.52836344, 46323052.66870341, 1, 2, 138353483.94656008, 46323203.469388865, 30 },
-  { 138353614.1009138, 46323066.3577768, 138353591.4602604, 46323099.33353781, 138353636.7415672, 46323033.38201579, 138353612.96888113, 46323068.00656485, 138353615.23294646, 46323064.70898875, 0, 0, 0, 0, 0 },
-  { 138353630.55722806, 46323077.656430595, 138353610.84959924, 46323112.46461019, 138353650.26485687, 46323042.848251, 138353629.5718466, 46323079.396839574, 138353631.5426095, 46323075.916021615, 0, 0, 0, 0, 0 },
-  { 138353647.82531813, 46323087.433244936, 138353632.7818903, 46323124.49664035, 138353662.86874595, 46323050.369849525, 138353647.07314673, 46323089.286414705, 138353648.57748953, 46323085.58007517, 1, 1, 138353747.11194178, 46322842.814835235, 36 },
-  { 138353666.06557462, 46323094.83666761, 138353657.10865483, 46323133.82094121, 138353675.0224944, 46323055.852394015, 138353665.61772862, 46323096.78588129, 138353666.5134206, 46323092.887453936, 0, 0, 0, 0, 0 },
-  { 138353685.31631896, 46323099.25966584, 138353681.81812754, 46323139.10640544, 138353688.81451038, 46323059.41292624, 138353685.1414094, 46323101.25200282, 138353685.49122852, 46323097.26732886, 1, 2, 138353709.62874937, 46322822.32482562, 50 },
-  { 138353705.16316047, 46323101.002043046, 138353706.02276906, 46323140.99280539, 138353704.30355188, 46323061.0112807, 138353705.2061409, 46323103.00158116, 138353705.12018004, 46323099.00250493, 1, 5, 138353713.63030514, 46323494.91105216, 41 },
-  { 138353725.0867829, 46323100.573781215, 138353729.43176085, 46323140.337095544, 138353720.74180496, 46323060.810466886, 138353725.3040318, 46323102.56194693, 138353724.86953402, 46323098.5856155, 0, 0, 0, 0, 0 },
-  { 138353744.6384111, 46323098.43735485, 138353752.1090565, 46323137.73353096, 138353737.1677657, 46323059.141178735, 138353745.01194337, 46323100.402163655, 138353744.26487884, 46323096.47254604, 0, 0, 0, 0, 0 },
-  { 138353763.73924425, 46323094.80607147, 138353774.0644267, 46323133.45048384, 138353753.4140618, 46323056.16165909, 138353764.2555034, 46323096.73829208, 138353763.22298512, 46323092.87385085, 0, 0, 0, 0, 0 },
-  { 138353782.43135935, 46323089.81183074, 138353795.2975753, 46323127.68610284, 138353769.5651434, 46323051.937558636, 138353783.07467014, 46323091.705544345, 138353781.78804857, 46323087.91811713, 1, 4, 138353854.48216864, 46323301.9077545, 39 },
-  { 138353800.75690138, 46323083.58648651, 138353815.83254683, 46323120.636788994, 138353785.68125594, 46323046.53618403, 138353801.51068366, 46323085.439001635, 138353800.0031191, 46323081.73397139, 1, 5, 138353722.7404361, 46322891.85117117, 26 },
-  { 138353818.75801548, 46323076.26189276, 138353835.7123802, 46323112.49101801, 138353801.80365077, 46323040.032767504, 138353819.60573372, 46323078.07334902, 138353817.91029724, 46323074.450436495, 0, 0, 0, 0, 0 },
-  { 138353836.47684652, 46323067.96990332, 138353854.9925814, 46323103.426462114, 138353817.96111163, 46323032.51334453, 138353837.40263325, 46323069.74273126, 138353835.55105978, 46323066.19707538, 0, 0, 0, 0, 0 },
-  { 138353853.95553958, 46323058.84237211, 138353873.73513654, 46323093.60970656, 138353834.17594263, 46323024.075037666, 138353854.94451943, 46323060.580738835, 138353852.96655974, 46323057.10400539, 0, 0, 0, 0, 0 },
-  { 138353871.2362396, 46323049.011153035, 138353892.0038556, 46323083.19749719, 138353850.46862364, 46323014.82480888, 138353872.2746204, 46323050.72047024, 138353870.1978588, 46323047.30183583, 0, 0, 0, 0, 0 },
-  { 138353888.36109173, 46323038.60809997, 138353909.86116552, 46323072.33860288, 138353866.86101794, 46323004.87759706, 138353889.43609542, 46323040.29462511, 138353887.28608805, 46323036.92157482, 1, 2, 138353996.93646443, 46323208.94713966, 31 },
-  { 138353905.37224087, 46323027.765066795, 138353927.36611116, 46323061.17568889, 138353883.37837058, 46322994.3544447, 138353906.47193438, 46323029.4355979, 138353904.27254736, 46323026.09453569, 0, 0, 0, 0, 0 },
-  { 138353922.31183204, 46323016.61390744, 138353944.5732286, 46323049.84687637, 138353900.05043548, 46322983.380938515, 138353923.42490187, 46323018.27555589, 138353921.1987622, 46323014.952259, 0, 0, 0, 0, 0 },
-  { 138353939.22201028, 46323005.28647581, 138353961.53198522, 46323038.48685258, 138353916.91203535, 46322972.086099036, 138353940.33750904, 46323006.94649465, 138353938.10651153, 46323003.62645697, 0, 0, 0, 0, 0 },
-  { 138353956.14492065, 46322993.91462576, 138353978.2865712, 46323027.22749579, 138353934.0032701, 46322960.60175572, 138353957.25200316, 46322995.580269255, 138353955.03783813, 46322992.24898226, 1, 5, 138354086.780659, 46323190.46055897, 47 },
-  { 138353973.12270805, 46322982.63021118, 138353994.8759221, 46323016.19801834, 138353951.369494, 46322949.06240402, 138353974.21036875, 46322984.30860154, 138353972.03504735, 46322980.95182082, 0, 0, 0, 0, 0 },
-  { 138353990.1975176, 46322971.56508603, 138354011.33394915, 46323005.524639346, 138353969.06108606, 46322937.60553271, 138353991.2543392, 46322973.26306369, 138353989.14069602, 46322969.86710837, 0, 0, 0, 0, 0 },
-  { 138354007.41149426, 46322960.85110414, 138354027.69003433, 46322995.329804994, 138353987.13295418, 46322926.37240329, 138354008.42542127, 46322962.575039186, 138354006.39756724, 46322959.127169095, 0, 0, 0, 0, 0 },
-  { 138354024.80678305, 46322950.62011944, 138354043.96994242, 46322985.73099131, 138354005.64362368, 46322915.509247564, 138354025.764941, 46322952.375663035, 138354023.8486251, 46322948.86457584, 1, 0, 138354156.55350363, 46323192.00736354, 25 },
-  { 138354042.42552897, 46322941.00398581, 138354060.19736874, 46322976.839187935, 138354024.6536892, 46322905.16878368, 138354043.31412095, 46322942.79574592, 138354041.536937, 46322939.2122257, 0, 0, 0, 0, 0 },
-  { 138354060.30987707, 46322932.13455715, 138354076.39639297, 46322968.75728242, 138354044.22336116, 46322895.51183188, 138354061.11420286, 46322933.965693414, 138354059.50555128, 46322930.30342089, 0, 0, 0, 0, 0 },
-  { 138354078.50197232, 46322924.143687345, 138354092.59659216, 46322961.57818603, 138354064.40735248, 46322886.70918866, 138354079.2067033, 46322926.01541228, 138354077.79724133, 46322922.27196241, 1, 1, 138354022.82822394, 46322776.277417555, 30 },
-  { 138354097.04356804, 46322917.1625135, 138354108.96508694, 46322955.344674096, 138354085.12204915, 46322878.98035291, 138354097.639644, 46322919.07162153, 138354096.4474921, 46322915.253405474, 1, 3, 138354153.67078277, 46323098.52777631, 50 },
-  { 138354115.94326472, 46322911.26150928, 138354125.747491, 46322950.04136419, 138354106.13903844, 46322872.48165436, 138354116.43347603, 46322913.20050202, 138354115.4530534, 46322909.32251653, 0, 0, 0, 0, 0 },
-  { 138354135.1517931, 46322906.405257, 138354142.92880458, 46322945.64195019, 138354127.3747816, 46322867.16856381, 138354135.54064366, 46322908.36709166, 138354134.76294252, 46322904.44342234, 1, 5, 138354168.39851716, 46323074.14212039, 30 },
-  { 138354154.61406243, 46322902.547686964, 138354160.46070355, 46322942.118089885, 138354148.7674213, 46322862.977284044, 138354154.90639448, 46322904.52620711, 138354154.32173038, 46322900.56916682, 1, 3, 138354130.35050178, 46322738.33051483, 28 },
-  { 138354174.274982, 46322899.64272941, 138354178.2908769, 46322939.44062619, 138354170.25908712, 46322859.84483263, 138354174.47577676, 46322901.632624246, 138354174.07418725, 46322897.65283457, 0, 0, 0, 0, 0 },
-  { 138354194.07946104, 46322897.64431461, 138354196.36385757, 46322937.57903049, 138354191.7950645, 46322857.70959873, 138354194.19368085, 46322899.641050406, 138354193.96524122, 46322895.64757881, 1, 0, 138354182.77169824, 46322699.967470996, 48 },
-  { 138354213.9724089, 46322896.50637285, 138354214.62179264, 46322936.501101255, 138354213.32302514, 46322856.51164444, 138354214.00487807, 46322898.50610927, 138354213.9399397, 46322894.506636426, 1, 3, 138354219.1350098, 46323214.46446372, 48 },
-  { 138354233.89873487, 46322896.182834394, 138354233.00399876, 46322936.17282623, 138354234.79347098, 46322856.19284256, 138354233.85399806, 46322898.18233398, 138354233.94347167, 46322894.183334805, 0, 0, 0, 0, 0 },
-  { 138354253.8034696, 46322896.62818295, 138354251.38319868, 46322936.55489442, 138354256.22374052, 46322856.70147148, 138354253.68245605, 46322898.62451852, 138354253.92448315, 46322894.631847374, 0, 0, 0, 0, 0 },
-  { 138354273.639029, 46322897.83057167, 138354269.60495052, 46322937.6266294, 138354277.67310748, 46322858.034513935, 138354273.43732506, 46322899.820374556, 138354273.84073293, 46322895.84076878, 0, 0, 0, 0, 0 },
-  { 138354293.36933482, 46322899.83060902, 138354287.62482527, 46322939.415967554, 138354299.11384436, 46322860.24525049, 138354293.08210933, 46322901.80987695, 138354293.6565603, 46322897.8513411, 1, 2, 138354236.49869028, 46323291.72565848, 44 },
-  { 138354312.9593054, 46322902.67344732, 138354305.41082728, 46322941.954746656, 138354320.50778353, 46322863.39214798, 138354312.5818815, 46322904.63751229, 138354313.33672932, 46322900.70938235, 0, 0, 0, 0, 0 },
-  { 138354332.37385914, 46322906.40423873, 138354322.9338612, 46322945.27436144, 138354341.81385708, 46322867.53411602, 138354331.90185925, 46322908.34774487, 138354332.84585902, 46322904.460732594, 0, 0, 0, 0, 0 },
-  { 138354351.5779145, 46322911.06813558, 138354340.1716248, 46322949.40736556, 138354362.9842042, 46322872.7289056, 138354351.0076, 46322912.98509708, 138354352.148229, 46322909.15117408, 0, 0, 0, 0, 0 },
-  { 138354370.53578413, 46322916.70828414, 138354357.1564733, 46322954.40435876, 138354383.91509494, 46322879.01220952, 138354369.86681858, 46322918.593087874, 138354371.20474967, 46322914.823480405, 0, 0, 0, 0, 0 },
-  { 138354389.20131293, 46322923.33316257, 138354373.89198494, 46322960.28751924, 138354404.51064092, 46322886.3788059, 138354388.43584654, 46322925.180880405, 138354389.96677932, 46322921.48544473, 0, 0, 0, 0, 0 },
-  { 138354407.5195029, 46322930.92196139, 138354390.32254878, 46322967.03656741, 138354424.71645704, 46322894.80735537, 138354406.6596552, 46322932.72769169, 138354408.3793506, 46322929.11623109, 0, 0, 0, 0, 0 },
-  { 138354425.43507805, 46322939.45295087, 138354406.3912228, 46322974.628675126, 138354444.4789333, 46322904.27722662, 138354424.4828853, 46322941.21173709, 138354426.3872708, 46322937.694164656, 0, 0, 0, 0, 0 },
-  { 138354442.89276233, 46322948.90440126, 138354422.04180482, 46322983.03997757, 138354463.74371985, 46322914.76882494, 138354441.85021445, 46322950.611180075, 138354443.9353102, 46322947.19762244, 0, 0, 0, 0, 0 },
-  { 138354459.83727977, 46322959.25458284, 138354437.22185975, 46322992.24765449, 138354482.45269978, 46322926.261511184, 138354458.70650876, 46322960.90423642, 138354460.96805078, 46322957.60492925, 0, 0, 0, 0, 0 },
-  { 138354476.2145091, 46322970.48051306, 138354451.9249169, 46323002.2612574, 138354500.5041013, 46322938.699768715, 138354475.0000295, 46322972.069550276, 138354477.4289887, 46322968.89147584, 1, 3, 138354337.76383358, 46323151.6307558, 38 },
-  { 138354491.99019456, 46322982.53765566, 138354466.15153116, 46323013.07228312, 138354517.82885796, 46322952.0030282, 138354490.69826138, 46322984.06438703, 138354493.28212774, 46322981.01092429, 1, 2, 138354581.13358328, 46322877.19319093, 37 },
-  { 138354507.146815, 46322995.36331775, 138354479.8773569, 46323024.62723159, 138354534.41627312, 46322966.09940391, 138354505.7833421, 46322996.82651344, 138354508.5102879, 46322993.90012206, 1, 3, 138354336.7127017, 46323178.26277927, 42 },
-  { 138354521.66737202, 46323008.89423927, 138354493.0767149, 46323036.868769206, 138354550.25802913, 46322980.91970933, 138354520.23783916, 46323010.29296576, 138354523.09690487, 46323007.495512776, 1, 0, 138354606.00981054, 46322926.36937597, 46 },
-  { 138354535.5348672, 46323023.06716017, 138354505.72378987, 46323049.73736205, 138354565.34594452, 46322996.396958284, 138354534.04431334, 46323024.40067026, 138354537.02542105, 46323021.73365007, 1, 0, 138354451.31857374, 46323098.41048049, 46 },
-  { 138354548.73230225, 46323037.81882041, 138354517.79308444, 46323063.17162698, 138354579.67152005, 46323012.46601384, 138354547.18534136, 46323039.08646074, 138354550.27926314, 46323036.55118008, 0, 0, 0, 0, 0 },
-  { 138354561.24283993, 46323053.08601575, 138354529.2758339, 46323077.129944816, 138354593.20984596, 46323029.04208669, 138354559.64448962, 46323054.28821221, 138354562.84119025, 46323051.8838193, 1, 5, 138354382.22760612, 46323187.73201852, 29 },
-  { 138354573.0721009, 46323068.813314565, 138354540.20324063, 46323091.608884834, 138354605.94096118, 46323046.017744295, 138354571.4286579, 46323069.95309308, 138354574.71554393, 46323067.67353605, 1, 0, 138354787.54141423, 46322920.07221854, 48 },
-  { 138354584.27099085, 46323084.960958354, 138354550.62233934, 46323106.58890905, 138354617.91964236, 46323063.333007656, 138354582.5885583, 46323086.04235589, 138354585.9534234, 46323083.87956082, 0, 0, 0, 0, 0 },
-  { 138354594.89585942, 46323101.49107278, 138354560.58033612, 46323122.04453626, 138354629.21138272, 46323080.9376093, 138354593.18008325, 46323102.51874596, 138354596.6116356, 46323100.463399604, 0, 0, 0, 0, 0 },
-  { 138354605.00305632, 46323118.365783505, 138354570.123842, 46323137.94741796, 138354639.88227063, 46323098.78414905, 138354603.2590956, 46323119.344865225, 138354606.74701703, 46323117.386701785, 0, 0, 0, 0, 0 },
-  { 138354614.64893112, 46323135.5472162, 138354579.29952446, 46323154.26671004, 138354649.99833778, 46323116.827722356, 138354612.8814608, 46323136.483190894, 138354616.41640145, 46323134.611241505, 1, 4, 138354903.63033044, 46322982.51535402, 35 },
-  { 138354623.88983345, 46323152.997496486, 138354588.15460107, 46323170.96950712, 138354659.62506583, 46323135.02548585, 138354622.10307184, 46323153.89609702, 138354625.67659506, 46323152.09889595, 0, 0, 0, 0, 0 },
-  { 138354632.78211302, 46323170.67875003, 138354596.7371896, 46323188.02128434, 138354668.82703644, 46323153.33621572, 138354630.97986683, 46323171.54587675, 138354634.5843592, 46323169.81162331, 1, 2, 138354822.919084, 46323079.19688154, 27 },
-  { 138354641.3821194, 46323188.5531025, 138354605.09654126, 46323205.38630838, 138354677.66769752, 46323171.71989662, 138354639.5678405, 46323189.39476279, 138354643.1963983, 46323187.71144221, 0, 0, 0, 0, 0 },
-  { 138354649.74620226, 46323206.58267956, 138354613.28318426, 46323223.027992524, 138354686.20922026, 46323190.1373666, 138354647.92305136, 46323207.40494521, 138354651.56935316, 46323205.760413915, 0, 0, 0, 0, 0 },
-  { 138354657.93071124, 46323224.72960683, 138354621.3490055, 46323240.9091867, 138354694.512417, 46323208.55002696, 138354656.10162595, 46323225.53858583, 138354659.75979653, 46323223.92062783, 0, 0, 0, 0, 0 },
-  { 138354665.99199596, 46323242.956009984, 138354629.34729245, 46323258.99239687, 138354702.63669947, 46323226.9196231, 138354664.15976077, 46323243.75782933, 138354667.82423115, 46323242.15419064, 1, 0, 138354784.1711648, 46323191.23866229, 44 },
-  { 138354673.98640615, 46323261.22401469, 138354637.33275202, 46323277.239933014, 138354710.64006028, 46323245.20809637, 138354672.15372345, 46323262.024810605, 138354675.81908885, 46323260.42321878, 1, 1, 138354520.9574002, 46323328.0904737, 45 },
-  { 138354681.97029132, 46323279.495746575, 138354645.3615186, 46323295.613989644, 138354718.57906404, 46323263.37750351, 138354680.13985267, 46323280.30165873, 138354683.80072996, 46323278.68983442, 1, 5, 138354945.55345494, 46323163.4443965, 31 },
-  { 138354690.0000012, 46323297.73333132, 138354653.49115655, 46323314.07665602, 138354726.50884584, 46323281.390006624, 138354688.17455897, 46323298.550497554, 138354691.82544342, 46323296.91616509, 0, 0, 0, 0, 0 },
-  { 138354698.13188544, 46323315.898894586, 138354661.78065854, 46323332.5898593, 138354734.48311234, 46323299.20792987, 138354696.31432408, 46323316.73344282, 138354699.9494468, 46323315.06434635, 0, 0, 0, 0, 0 },
-  { 138354706.42229357, 46323333.95456197, 138354670.28227517, 46323351.09804672, 138354742.56231198, 46323316.81107722, 138354704.61529264, 46323334.81173621, 138354708.2292945, 46323333.09738773, 0, 0, 0, 0, 0 },
-  { 138354714.91960636, 46323351.867666855, 138354678.97488907, 46323369.41694884, 138354750.86432365, 46323334.31838487, 138354713.12237048, 46323352.745130956, 138354716.71684223, 46323350.990202755, 0, 0, 0, 0, 0 },
-  { 138354723.60212484, 46323369.65133873, 138354687.79598787, 46323387.481665574, 138354759.4082618, 46323351.82101188, 138354721.811818, 46323370.54285507, 138354725.39243168, 46323368.75982238, 0, 0, 0, 0, 0 },
-  { 138354732.41175923, 46323387.342488095, 138354696.68381646, 46323405.32898596, 138354768.139702, 46323369.35599023, 138354730.6253621, 46323388.24181299, 138354734.19815636, 46323386.4431632, 0, 0, 0, 0, 0 },
-  { 138354741.29010978, 46323404.97822814, 138354705.57807913, 46323422.9962987, 138354777.00214043, 46323386.96015757, 138354739.50450826, 46323405.87913167, 138354743.0757113, 46323404.07732461, 1, 5, 138354392.20501018, 46323581.104867876, 44 },
-  { 138354750.1787767, 46323422.59567195, 138354714.41991776, 46323440.5206268, 138354785.93763566, 46323404.670717105, 138354748.39083377, 46323423.4919197, 138354751.96671966, 46323421.69942421, 1, 3, 138354925.3971856, 46323334.763393216, 34 },
-  { 138354759.01936018, 46323440.2319327, 138354723.15191454, 46323457.93860777, 138354794.88680583, 46323422.52525763, 138354757.2259879, 46323441.117266454, 138354760.81273246, 46323439.346598946, 1, 2, 138354590.4423656, 46323523.45330551, 46 },
-  { 138354767.75346062, 46323457.924123436, 138354731.73192167, 46323475.31517668, 138354803.77499956, 46323440.53307019, 138354765.95238367, 46323458.7936761, 138354769.55453756, 46323457.05457077, 1, 3, 138355028.90961787, 46323331.83898742, 28 },
-  { 138354776.33609274, 46323475.7010581, 138354740.16830224, 46323492.78587388, 138354812.50388324, 46323458.61624231, 138354774.52770323, 46323476.55529889, 138354778.14448225, 46323474.84681731, 0, 0, 0, 0, 0 },
-  { 138354784.77247125, 46323493.56049389, 138354748.4776762, 46323510.373817585, 138354821.0672663, 46323476.74717019, 138354782.9577315, 46323494.40116007, 138354786.587211, 46323492.719827704, 0, 0, 0, 0, 0 },
-  { 138354793.07955116, 46323511.49292462, 138354756.67615798, 46323528.06980504, 138354829.48294434, 46323494.916044205, 138354791.2593815, 46323512.32176864, 138354794.89972082, 46323510.664080605, 1, 1, 138354433.59604344, 46323675.18961875, 48 },
-  { 138354801.2742874, 46323529.48884412, 138354764.77996367, 46323545.86456808, 138354837.76861113, 46323513.11312016, 138354799.44957122, 46323530.307630315, 138354803.09900358, 46323528.67005792, 1, 1, 138354909.84490052, 46323480.77106534, 47 },
-  { 138354809.37363502, 46323547.53874621, 138354772.80541515, 46323563.748783104, 138354845.9418549, 46323531.32870931, 138354807.54522404, 46323548.34924805, 138354811.202046, 46323546.728244364, 1, 0, 138354642.07402915, 46323621.699664995, 41 },
-  { 138354817.39454892, 46323565.6331247, 138354780.76894307, 46323581.713081054, 138354854.02015477, 46323549.55316835, 138354815.56326863, 46323566.43712252, 138354819.2258292, 46323564.82912689, 0, 0, 0, 0, 0 },
-  { 138354825.35398412, 46323583.76247343, 138354788.68708897, 46323599.748054445, 138354862.02087927, 46323567.77689241, 138354823.52063936, 46323584.561752476, 138354827.18732888, 46323582.96319438, 0, 0, 0, 0, 0 },
-  { 138354833.26889563, 46323601.917286195, 138354796.57650676, 46323617.84426331, 138354869.9612845, 46323585.99030908, 138354831.4342762, 46323602.71363505, 138354835.10351506, 46323601.12093734, 0, 0, 0, 0, 0 },
-  { 138354841.1562384, 46323620.088056855, 138354804.45396382, 46323635.99223994, 138354877.858513, 46323604.18387377, 138354839.32112467, 46323620.88326601, 138354842.99135214, 46323619.2928477, 0, 0, 0, 0, 0 },
-  { 138354849.03296745, 46323638.2652792, 138354812.3363414, 46323654.18249119, 138354885.7295935, 46323622.34806722, 138354847.19813615, 46323639.0611398, 138354850.86779875, 46323637.46941861, 0, 0, 0, 0, 0 },
-  { 138354856.91603774, 46323656.43944706, 138354820.24063498, 46323672.40549956, 138354893.5914405, 46323640.47339456, 138354855.0822676, 46323657.23774969, 138354858.74980786, 46323655.64114443, 1, 4, 138354506.6659414, 46323808.91524847, 26 },
-  { 138354864.8224042, 46323674.60105429, 138354828.18395412, 46323690.65172332, 138354901.4608543, 46323658.55038526, 138354862.9904817, 46323675.403587736, 138354866.6543267, 46323673.79852084, 0, 0, 0, 0, 0 },
-  { 138354872.769022, 46323692.74059466, 138354836.18352178, 46323708.91159257, 138354909.3545222, 46323676.56959675, 138354870.93974698, 46323693.54914456, 138354874.598297, 46323691.93204477, 1, 5, 138354729.1709336, 46323756.21176147, 41 },
-  { 138354880.77284592, 46323710.848562025, 138354844.25667346, 46323727.17550747, 138354917.2890184, 46323694.52161658, 138354878.9470373, 46323711.664909296, 138354882.59865454, 46323710.03221475, 1, 0, 138355085.2634118, 46323619.41766751, 31 },
-  { 138354888.85083103, 46323728.915450186, 138354852.42085594, 46323745.43383129, 138354925.28080612, 46323712.39706908, 138354887.02933228, 46323729.74136924, 138354890.67232978, 46323728.08953113, 1, 5, 138354619.2690153, 46323851.151470356, 32 },
-  { 138354897.0199323, 46323746.93175299, 138354860.69362518, 46323763.676883966, 138354933.34623942, 46323730.18662201, 138354895.20361695, 46323747.76900954, 138354898.83624765, 46323746.09449644, 0, 0, 0, 0, 0 },
-  { 138354905.29710478, 46323764.88796425, 138354869.0926435, 46323781.8949329, 138354941.50156605, 46323747.880995594, 138354903.4868817, 46323765.738312684, 138354907.10732785, 46323764.03761581, 1, 3, 138354813.88084003, 46323807.830560096, 39 },
-  { 138354913.69930342, 46323782.774577774, 138354877.6356757, 46323800.07818304, 138354949.76293114, 46323765.47097251, 138354911.89612204, 46323783.639758036, 138354915.5024848, 46323781.90939751, 1, 5, 138355149.01447433, 46323669.868553415, 39 },
-  { 138354922.24348316, 46323800.5820874, 138354886.34058443, 46323818.21676527, 138354958.14638188, 46323782.947409526, 138354920.4483382, 46323801.46382129, 138354924.0386281, 46323799.7003535, 0, 0, 0, 0, 0 },
-  { 138354930.94659898, 46323818.300986946, 138354895.22532386, 46323836.300723165, 138354966.6678741, 46323800.301250726, 138354929.16053522, 46323819.20097376, 138354932.73266274, 46323817.401000135, 1, 0, 138355199.74919423, 46323682.85297187, 27 },
-  { 138354939.82560596, 46323835.92177023, 138354904.30793133, 46323854.31999812, 138354975.34328058, 46323817.52354234, 138354938.04972222, 46323836.84168162, 138354941.6014897, 46323835.00185884, 0, 0, 0, 0, 0 },
-  { 138354948.897459, 46323853.434931085, 138354913.6065178, 46323872.26441509, 138354984.1884002, 46323834.605447076, 138354947.13291195, 46323854.376405284, 138354950.66200605, 46323852.493456885, 0, 0, 0, 0, 0 },
-  { 138354958.17911315, 46323870.83096333, 138354923.13925523, 46323890.123665474, 138354993.21897107, 46323851.53826118, 138354956.42712024, 46323871.79559843, 138354959.93110606, 46323869.866328225, 0, 0, 0, 0, 0 },
-  { 138354967.6875233, 46323888.100360766, 138354932.9243622, 46323907.88729159, 138355002.4506844, 46323868.313429944, 138354965.94936526, 46323889.08970731, 138354969.42568135, 46323887.111014225, 0, 0, 0, 0, 0 },
-  { 138354977.43964452, 46323905.23361724, 138354942.98008636, 46323925.54466967, 138355011.89920267, 46323884.922564805, 138354975.7166666, 46323906.249169864, 138354979.16262242, 46323904.21806461, 0, 0, 0, 0, 0 },
-  { 138354987.45243174, 46323922.221226566, 138354953.3179562, 46323943.07398611, 138355021.58690727, 46323901.36846702, 138354985.74570796, 46323923.26386454, 138354989.15915552, 46323921.17858859, 0, 0, 0, 0, 0 },
-  { 138354997.73704302, 46323939.05639945, 138354963.92198902, 46323960.42324579, 138355031.55209702, 46323917.68955311, 138354996.0462903, 46323940.12474177, 138354999.42779574, 46323937.98805713, 0, 0, 0, 0, 0 },
-  { 138355008.2811054, 46323955.743374825, 138354974.77151364, 46323977.5861599, 138355041.79069716, 46323933.90058975, 138355006.6056258, 46323956.835514076, 138355009.956585, 46323954.65123557, 0, 0, 0, 0, 0 },
-  { 138355019.06627625, 46323972.289189436, 138354985.84681067, 46323994.57073128, 138355052.28574184, 46323950.00764759, 138355017.40530297, 46323973.40326653, 138355020.72724953, 46323971.175112344, 0, 0, 0, 0, 0 },
-  { 138355030.07421285, 46323988.70088003, 138354997.12831208, 46324011.384963065, 138355063.02011362, 46323966.01679699, 138355028.42691782, 46323989.83508418, 138355031.72150788, 46323987.56667588, 1, 5, 138355224.45502734, 46323854.86479013, 35 },
-  { 138355041.28657272, 46324004.98548343, 138355008.5965885, 46324028.03683762, 138355073.97655696, 46323981.93412924, 138355039.6520735, 46324006.13805114, 138355042.92107195, 46324003.83291572, 1, 0, 138354766.69070506, 46324198.61685865, 31 },
-  { 138355052.68501303, 46324021.15003631, 138355020.232337, 46324044.53430063, 138355085.13768905, 46323997.76577199, 138355051.0623792, 46324022.319249526, 138355054.30764684, 46324019.9808231, 0, 0, 0, 0, 0 },
-  { 138355064.25119126, 46324037.2015755, 138355032.01636875, 46324060.88524534, 138355096.48601377, 46324013.51790567, 138355062.63945013, 46324038.385758996, 138355065.86293238, 46324036.01739201, 0, 0, 0, 0, 0 },
-  { 138355075.96676472, 46324053.14713773, 138355043.92970115, 46324077.097639985, 138355108.0038283, 46324029.19663548, 138355074.36491153, 46324054.344662845, 138355077.5686179, 46324051.94961262, 0, 0, 0, 0, 0 },
-  { 138355087.81347552, 46324068.99372929, 138355055.96061555, 46324093.18867323, 138355119.6663355, 46324044.79878536, 138355086.22083253, 46324070.20347649, 138355089.4061185, 46324067.7839821, 0, 0, 0, 0, 0 },
-  { 138355099.77886394, 46324084.746270105, 138355068.1080091, 46324109.178972654, 138355131.44971877, 46324060.31356756, 138355098.1953212, 46324085.96790523, 138355101.36240667, 46324083.52463498, 1, 2, 138355268.42616597, 46323954.64212904, 36 },
-  { 138355111.85989505, 46324100.40628897, 138355080.36980042, 46324125.07152646, 138355143.34998968, 46324075.74105147, 138355110.28539032, 46324101.63955084, 138355113.43439978, 46324099.17302709, 0, 0, 0, 0, 0 },
-  { 138355124.05439788, 46324115.975003764, 138355092.74371254, 46324140.86759271, 138355155.36508322, 46324091.08241482, 138355122.48886362, 46324117.219633214, 138355125.61993214, 46324114.730374314, 1, 0, 138355358.1017707, 46323929.90290141, 41 },
-  { 138355136.36020136, 46324131.453632414, 138355105.22747216, 46324156.56843229, 138355167.49293056, 46324106.33883254, 138355134.8035649, 46324132.70937241, 138355137.9168378, 46324130.19789242, 1, 0, 138354867.06209376, 46324348.69665128, 35 },
-  { 138355148.7751345, 46324146.84339278, 138355117.8188094, 46324172.17530813, 138355179.73145962, 46324121.51147743, 138355147.22731826, 46324148.10998855, 138355150.32295075, 46324145.576797016, 1, 5, 138355335.28699332, 46323994.21860281, 45 },
-  { 138355161.29702634, 46324162.14550276, 138355130.51545796, 46324187.6894854, 138355192.0785947, 46324136.60152012, 138355159.75794792, 46324163.422701895, 138355162.83610475, 46324160.86830363, 0, 0, 0, 0, 0 },
-  { 138355173.92370594, 46324177.36118024, 138355143.31515503, 46324203.11223092, 138355204.53225684, 46324151.61012956, 138355172.3932784, 46324178.648732774, 138355175.45413348, 46324176.0736277, 1, 3, 138355441.74852642, 46323952.03948681, 36 },
-  { 138355186.65300232, 46324192.49164312, 138355156.21564102, 46324218.4448132, 138355217.09036362, 46324166.53847305, 138355185.13113427, 46324193.78930163, 138355188.17487037, 46324191.19398462, 0, 0, 0, 0, 0 },
-  { 138355199.4827444, 46324207.538109265, 138355169.21465993, 46324233.68850242, 138355229.75082886, 46324181.38771611, 138355197.96934018, 46324208.845628925, 138355200.99614862, 46324206.230589606, 0, 0, 0, 0, 0 },
-  { 138355212.41076127, 46324222.501796596, 138355182.30995902, 46324248.84456987, 138355242.5115635, 46324196.15902332, 138355210.90572116, 46324223.81893526, 138355213.91580138, 46324221.18465793, 0, 0, 0, 0, 0 },
-  { 138355225.43488196, 46324237.38392299, 138355195.4992887, 46324263.914287806, 138355255.3704752, 46324210.85355817, 138355223.9381023, 46324238.710441224, 138355226.9316616, 46324236.05740475, 0, 0, 0, 0, 0 },
-  { 138355238.5529354, 46324252.18570632, 138355208.78040275, 46324278.89892965, 138355268.32546803, 46324225.47248299, 138355237.06430876, 46324253.52136748, 138355240.04156202, 46324250.85004515, 1, 1, 138355084.48007903, 46324390.42663706, 43 },
-  { 138355251.76275066, 46324266.9083645, 138355222.15105796, 46324293.799769364, 138355281.37444335, 46324240.01695963, 138355250.28216603, 46324268.25293474, 138355253.24333528, 46324265.563794255, 0, 0, 0, 0, 0 },
-  { 138355265.06215674, 46324281.553115405, 138355235.60901424, 46324308.61808164, 138355294.51529923, 46324254.48814917, 138355263.58949962, 46324282.90636372, 138355266.53481385, 46324280.19986709, 1, 5, 138355154.61287236, 46324383.046738766, 38 },
-  { 138355278.44898272, 46324296.12117693, 138355249.15203434, 46324323.35514132, 138355307.7459311, 46324268.88721254, 138355276.9841353, 46324297.482875146, 138355279.91383013, 46324294.75947871, 0, 0, 0, 0, 0 },
-  { 138355291.92105755, 46324310.61376696, 138355262.77788398, 46324338.01222375, 138355321.06423113, 46324283.21531017, 138355290.46389887, 46324311.9836898, 138355293.37821624, 46324309.24384412, 0, 0, 0, 0, 0 },
-  { 138355305.47621027, 46324325.03210341, 138355276.48433167, 46324352.59060439, 138355334.46808887, 46324297.47360244, 138355304.02661633, 46324326.41002846, 138355306.9258042, 46324323.654178366, 0, 0, 0, 0, 0 },
-  { 138355319.11226985, 46324339.37740413, 138355290.26914862, 46324367.09155861, 138355347.95539108, 46324311.66324965, 138355317.6701138, 46324340.76311185, 138355320.5544259, 46324337.99169641, 0, 0, 0, 0, 0 },
-  { 138355332.82706538, 46324353.65088703, 138355304.13010862, 46324381.51636159, 138355361.52402213, 46324325.78541247, 138355331.39221755, 46324355.04416075, 138355334.2619132, 46324352.2576133, 1, 0, 138355573.1640783, 46324120.27753759, 50 },
-  { 138355346.61842582, 46324367.85377, 138355318.06498802, 46324395.86628846, 138355375.17186362, 46324339.841251545, 138355345.19075394, 46324369.254395925, 138355348.0460977, 46324366.45314408, 0, 0, 0, 0, 0 },
-  { 138355360.4841802, 46324381.98727093, 138355332.0715656, 46324410.14261377, 138355388.89679483, 46324353.83192809, 138355359.0635495, 46324383.39503807, 138355361.90481094, 46324380.57950379, 0, 0, 0, 0, 0 },
-  { 138355374.42215756, 46324396.0526077, 138355346.14762238, 46324424.34661167, 138355402.69669273, 46324367.75860373, 138355373.0084308, 46324397.467307895, 138355375.8358843, 46324394.637907505, 0, 0, 0, 0, 0 },
-  { 138355388.43018684, 46324410.05099821, 138355360.29094183, 46324438.47955586, 138355416.56943184, 46324381.62244056, 138355387.0232246, 46324411.472426094, 138355389.83714908, 46324408.62957033, 1, 1, 138355472.14444077, 46324325.47603921, 47 },
-  { 138355402.50609714, 46324423.98366035, 138355374.49930936, 46324452.54271912, 138355430.5128849, 46324395.42460158, 138355401.10575774, 46324425.411613286, 138355403.90643653, 46324422.55570741, 0, 0, 0, 0, 0 },
-  { 138355416.64771742, 46324437.851812, 138355388.77051258, 46324466.53737371, 138355444.52492225, 46324409.16625029, 138355415.25385717, 46324439.28609008, 138355418.04157767, 46324436.41753391, 1, 4, 138355557.42760184, 46324292.98972537, 41 },
-  { 138355430.85287675, 46324451.65667106, 138355403.10234097, 46324480.46479082, 138355458.60341254, 46324422.8485513, 138355429.46534997, 46324453.09707705, 138355432.24040353, 46324450.216265075, 1, 0, 138355215.78622445, 46324674.91959919, 35 },
-  { 138355445.11940408, 46324465.3994554, 138355417.49258593, 46324494.3262409, 138355472.74622223, 46324436.4726699, 138355443.73806316, 46324466.84579467, 138355446.500745, 46324463.95311613, 1, 4, 138355699.97680143, 46324198.54985916, 27 },
-  { 138355459.4451285, 46324479.081382945, 138355431.93904066, 46324508.122993305, 138355486.95121634, 46324450.039772585, 138355458.0698241, 46324480.53346346, 138355460.8204329, 46324477.62930243, 0, 0, 0, 0, 0 },
-  { 138355473.82787898, 46324492.70367155, 138355446.43949994, 46324521.85631627, 138355501.21625802, 46324463.551026836, 138355472.45846003, 46324494.16130379, 138355475.19729793, 46324491.246039316, 0, 0, 0, 0, 0 },
-  { 138355488.2654845, 46324506.267539136, 138355460.9917603, 46324535.52747709, 138355515.5392087, 46324477.00760118, 138355486.9017983, 46324507.730536036, 138355489.62917072, 46324504.804542236, 1, 1, 138355239.39275134, 46324773.26447298, 47 },
-  { 138355502.75577417, 46324519.774203576, 138355475.59361973, 46324549.13774161, 138355529.9179286, 46324490.41066554, 138355501.39766645, 46324521.24238048, 138355504.1138819, 46324518.306026675, 1, 2, 138355612.08344582, 46324401.58596298, 27 },
-  { 138355517.2965769, 46324533.22488274, 138355490.2428776, 46324562.688374646, 138355544.35027617, 46324503.76139083, 138355515.9438919, 46324534.69805733, 138355518.64926186, 46324531.75170814, 0, 0, 0, 0, 0 },
-  { 138355531.8857218, 46324546.62079455, 138355504.9373347, 46324576.180639476, 138355558.83410892, 46324517.06094962, 138355530.53830245, 46324548.09878679, 138355533.23314115, 46324545.142802306, 0, 0, 0, 0, 0 },
-  { 138355546.52103782, 46324559.96315688, 138355519.674793, 46324589.61579824, 138355573.36728263, 46324530.310515516, 138355545.17872557, 46324561.44578895, 138355547.86335006, 46324558.48052481, 0, 0, 0, 0, 0 },
-  { 138355561.20035398, 46324573.25318762, 138355534.45305583, 46324602.99511158, 138355587.94765213, 46324543.51126366, 138355559.86298907, 46324574.74028382, 138355562.5377189, 46324571.76609142, 0, 0, 0, 0, 0 },
-  { 138355575.92149934, 46324586.49210467, 138355549.2699274, 46324616.31983865, 138355602.57307127, 46324556.66437069, 138355574.58892074, 46324587.98349137, 138355577.25407794, 46324585.000717975, 0, 0, 0, 0, 0 },
-  { 138355590.68230286, 46324599.6811259, 138355564.1232132, 46324629.59123717, 138355617.24139252, 46324569.77101463, 138355589.3543484, 46324601.176631466, 138355592.01025733, 46324598.18562034, 0, 0, 0, 0, 0 },
-  { 138355605.4805936, 46324612.8214692, 138355579.01071948, 46324642.81056329, 138355631.9504677, 46324582.83237512, 138355604.15709987, 46324614.32092391, 138355606.8040873, 46324611.322014496, 0, 0, 0, 0, 0 },
-  { 138355620.31420055, 46324625.9143525, 138355593.92877278, 46324655.97777215, 138355646.69962832, 46324595.85093285, 138355618.99492916, 46324627.41752348, 138355621.63347194, 46324624.41118152, 0, 0, 0, 0, 0 },
-  { 138355635.1803385, 46324638.96175076, 138355608.8544946, 46324669.07736039, 138355661.5061824, 46324608.84614113, 138355633.8640463, 46324640.46753124, 138355636.4966307, 46324637.45597028, 0, 0, 0, 0, 0 },
-  { 138355650.06792077, 46324651.975871064, 138355623.76222456, 46324682.10908108, 138355676.373617, 46324621.842661045, 138355648.75263596, 46324653.48253156, 138355651.3832056, 46324650.469210565, 0, 0, 0, 0, 0 },
-  { 138355664.95989677, 46324664.9762715, 138355638.6344923, 46324695.09226525, 138355691.28530124, 46324634.86027776, 138355663.64362654, 46324666.48207119, 138355666.276167, 46324663.470471814, 0, 0, 0, 0, 0 },
-  { 138355679.83908513, 46324677.982671194, 138355653.45415094, 46324708.04652403, 138355706.22401932, 46324647.918818355, 138355678.51983842, 46324679.485863835, 138355681.15833184, 46324676.47947855, 1, 2, 138355915.9842462, 46324408.91118829, 49 },
-  { 138355694.68830472, 46324691.01478933, 138355668.2041942, 46324720.991311625, 138355721.17241526, 46324661.03826703, 138355693.3640992, 46324692.513615444, 138355696.01251024, 46324689.51596321, 1, 0, 138355516.58266136, 46324892.60690177, 46 },
-  { 138355709.49037406, 46324704.092345044, 138355682.86776194, 46324733.94592981, 138355736.11298618, 46324674.23876028, 138355708.15924346, 46324705.58502428, 138355710.82150465, 46324702.599665806, 0, 0, 0, 0, 0 },
-  { 138355724.22811195, 46324717.23505747, 138355697.42814776, 46324746.92953373, 138355751.02807614, 46324687.54058122, 138355722.88811374, 46324718.71978129, 138355725.56811017, 46324715.75033366, 0, 0, 0, 0, 0 },
-  { 138355738.88433704, 46324730.46264579, 138355711.86881042, 46324759.96114271, 138355765.89986366, 46324700.96414887, 138355737.5335607, 46324731.93757064, 138355740.23511338, 46324728.987720944, 0, 0, 0, 0, 0 },
-  { 138355753.44186816, 46324743.794829145, 138355726.17338637, 46324773.05965274, 138355780.71034995, 46324714.53000555, 138355752.07844406, 46324745.25807033, 138355754.80529225, 46324742.33158796, 1, 1, 138355547.56483054, 46324964.744247295, 44 },
-  { 138355767.88352388, 46324757.25132667, 138355740.32570586, 46324786.243854426, 138355795.4413419, 46324728.25879892, 138355766.50563297, 46324758.70095306, 138355769.2614148, 46324755.80170029, 0, 0, 0, 0, 0 },
-  { 138355782.19212294, 46324770.85185755, 138355754.3098099, 46324799.53245411, 138355810.07443598, 46324742.17126099, 138355780.79800728, 46324772.285887375, 138355783.5862386, 46324769.417827725, 1, 1, 138355623.26293856, 46324934.33125793, 31 },
-  { 138355796.35048407, 46324784.616140895, 138355768.10996765, 46324812.944099374, 138355824.5910005, 46324756.288182415, 138355794.93845826, 46324786.03253882, 138355797.76250988, 46324783.19974297, 0, 0, 0, 0, 0 },
-  { 138355810.34142596, 46324798.56389588, 138355781.71069476, 46324826.49741035, 138355838.97215715, 46324770.63038141, 138355808.9098894, 46324799.9605716, 138355811.7729625, 46324797.16722016, 0, 0, 0, 0, 0 },
-  { 138355824.14776734, 46324812.71484167, 138355795.09676978, 46324840.211014874, 138355853.1987649, 46324785.21866847, 138355822.69521746, 46324814.08965033, 138355825.6003172, 46324811.34003301, 1, 0, 138355981.74942908, 46324663.54810204, 39 },
-  { 138355837.75232688, 46324827.088697374, 138355808.25324857, 46324854.10358919, 138355867.25140518, 46324800.073805556, 138355836.27737296, 46324828.439441964, 138355839.2272808, 46324825.73795278, 0, 0, 0, 0, 0 },
-  { 138355851.13792327, 46324841.70518219, 138355821.1654754, 46324868.19390373, 138355881.11037114, 46324815.216460645, 138355849.63930088, 46324843.02961826, 138355852.63654566, 46324840.38074611, 0, 0, 0, 0, 0 },
-  { 138355864.2873753, 46324856.584015235, 138355833.81908783, 46324882.50087189, 138355894.75566277, 46324830.66715858, 138355862.76396093, 46324857.87985807, 138355865.81078967, 46324855.2881724, 1, 1, 138355618.255954, 46325065.86263271, 34 },
-  { 138355877.1835016, 46324871.74491567, 138355846.19988874, 46324897.043447934, 138355908.16711447, 46324846.44638341, 138355875.63432094, 46324873.009842284, 138355878.73268226, 46324870.47998906, 1, 5, 138356079.35157546, 46324706.67199265, 33 },
-  { 138355889.80902296, 46324887.20764141, 138355858.05156326, 46324911.527669236, 138355921.56648266, 46324862.88761358, 138355888.22114998, 46324888.4236428, 138355891.39689595, 46324885.99164002, 1, 5, 138355750.8701368, 46324993.607763164, 28 },
-  { 138355901.9548581, 46324903.06785639, 138355868.49343023, 46324924.984353475, 138355935.41628596, 46324881.1513593, 138355900.2817867, 46324904.16368124, 138355903.62792948, 46324901.97203153, 0, 0, 0, 0, 0 },
-  { 138355912.81951225, 46324919.65567331, 138355876.89952955, 46324937.25552679, 138355948.73949495, 46324902.05581983, 138355911.0235131, 46324920.53566598, 138355914.6155114, 46324918.77568064, 1, 5, 138355677.54362553, 46325034.934713595, 35 },
-  { 138355921.48747122, 46324937.34632834, 138355883.14451334, 46324948.74008013, 138355959.8304291, 46324925.95257655, 138355919.57032332, 46324937.91601593, 138355923.40461913, 46324936.77664075, 1, 1, 138356053.77067596, 46324898.03788465, 39 },
-  { 138355927.1495229, 46324956.40061467, 138355887.45569813, 46324961.34027821, 138355966.84334767, 46324951.460951135, 138355925.16483167, 46324956.64759785, 138355929.13421413, 46324956.15363149, 1, 4, 138355720.74163413, 46324982.08686505, 41 },
-  { 138355929.6370446, 46324976.38967872, 138355889.65561172, 46324975.1710628, 138355969.6184775, 46324977.608294636, 138355927.63797295, 46324976.32874792, 138355931.63611627, 46324976.45060951, 0, 0, 0, 0, 0 },
-  { 138355929.02020222, 46324996.62759143, 138355889.6832055, 46324989.37495823, 138355968.35719895, 46325003.88022463, 138355927.0533524, 46324996.26495977, 138355930.98705205, 46324996.990223095, 1, 1, 138355576.9540815, 46324931.71652428, 42 },
-  { 138355925.36956754, 46325016.427986726, 138355887.638564, 46325003.14749835, 138355963.1005711, 46325029.708475105, 138355923.48301736, 46325015.763962306, 138355927.25611773, 46325017.092011146, 0, 0, 0, 0, 0 },
-  { 138355918.78179905, 46325035.14440056, 138355883.25992796, 46325016.754276216, 138355954.30367014, 46325053.5345249, 138355917.0057055, 46325034.224894345, 138355920.5578926, 46325036.063906774, 1, 2, 138355782.02259532, 46324964.34242184, 47 },
-  { 138355909.70758924, 46325052.67190093, 138355876.21537197, 46325030.802484326, 138355943.1998065, 46325074.54131753, 138355908.0329784, 46325051.5784301, 138355911.3822001, 46325053.765371755, 0, 0, 0, 0, 0 },
-  { 138355898.85271925, 46325069.29574009, 138355866.76981625, 46325045.406677, 138355930.93562225, 46325093.18480318, 138355897.2485741, 46325068.10128693, 138355900.4568644, 46325070.49019325, 1, 3, 138355679.0848337, 46324905.65565792, 28 },
-  { 138355886.92859867, 46325085.30977975, 138355855.49001244, 46325060.578922585, 138355918.3671849, 46325110.04063691, 138355885.35666937, 46325084.07323689, 138355888.50052798, 46325086.54632261, 1, 3, 138356164.3741221, 46325303.55959422, 34 },
-  { 138355874.59858683, 46325100.98405007, 138355843.62156078, 46325075.67745295, 138355905.57561287, 46325126.290647194, 138355873.04973552, 46325099.71872022, 138355876.14743814, 46325102.249379925, 1, 3, 138355688.73643062, 46324949.14446735, 36 },
-  { 138355862.04529712, 46325116.35014534, 138355831.7297553, 46325090.254783206, 138355892.36083892, 46325142.445507474, 138355860.52952003, 46325115.04537723, 138355863.5610742, 46325117.65491345, 0, 0, 0, 0, 0 },
-  { 138355849.17454368, 46325131.30237562, 138355819.74663216, 46325104.20997773, 138355878.6024552, 46325158.39477351, 138355847.7031481, 46325129.947755724, 138355850.64593926, 46325132.65699552, 0, 0, 0, 0, 0 },
-  { 138355835.88881853, 46325145.73340331, 138355807.56166247, 46325117.492082, 138355864.2159746, 46325173.97472462, 138355834.47246072, 46325144.321337245, 138355837.30517635, 46325147.145469375, 1, 4, 138356061.79788813, 46325370.95794076, 49 },
-  { 138355822.10816973, 46325159.555936076, 138355794.92260504, 46325130.21407056, 138355849.29373443, 46325188.89780159, 138355820.7488915, 46325158.0888428, 138355823.46744797, 46325161.02302935, 0, 0, 0, 0, 0 },
-  { 138355807.8366793, 46325172.77863066, 138355781.76731366, 46325142.4407307, 138355833.90604496, 46325203.11653062, 138355806.53321102, 46325171.26173566, 138355809.1401476, 46325174.295525655, 1, 4, 138355912.7658761, 46325294.88867799, 39 },
-  { 138355793.10354298, 46325185.4388187, 138355768.1125354, 46325154.20663116, 138355818.09455058, 46325216.67100624, 138355791.8539926, 46325183.87720932, 138355794.35309336, 46325187.00042808, 1, 4, 138355582.55430385, 46324922.30763867, 29 },
-  { 138355777.9379613, 46325197.57383699, 138355753.97673395, 46325165.54479417, 138355801.89918867, 46325229.60287981, 138355776.73989993, 46325195.97238485, 138355779.1360227, 46325199.17528913, 0, 0, 0, 0, 0 },
-  { 138355762.36913455, 46325209.22102232, 138355739.38012463, 46325176.48716489, 138355785.35814446, 46325241.95487975, 138355761.21968403, 46325207.58432945, 138355763.51858506, 46325210.8577152, 0, 0, 0, 0, 0 },
-  { 138355746.42626324, 46325220.41771148, 138355724.3446176, 46325187.065036535, 138355768.50790888, 46325253.77038643, 138355745.32218096, 46325218.75007773, 138355747.53034553, 46325222.08534523, 1, 3, 138355812.11915898, 46325319.64191946, 41 },
-  { 138355730.13854763, 46325231.201241285, 138355708.89368045, 46325197.309418984, 138355751.3834148, 46325265.093063585, 138355729.07630426, 46325229.50665017, 138355731.200791, 46325232.8958324, 0, 0, 0, 0, 0 },
-  { 138355713.53518826, 46325241.60894853, 138355693.05215546, 46325207.2513385, 138355734.01822105, 46325275.96655856, 138355712.5110366, 46325239.89106803, 138355714.5593399, 46325243.32682903, 1, 4, 138355771.39975592, 46325338.66919687, 28 },
-  { 138355696.64538547, 46325251.678169996, 138355676.84605137, 46325216.922071695, 138355716.44471958, 46325286.434268296, 138355695.65541875, 46325249.94036508, 138355697.6353522, 46325253.41597491, 0, 0, 0, 0, 0 },
-  { 138355679.4983397, 46325261.4462425, 138355660.3023342, 46325226.353317685, 138355698.69434524, 46325296.53916731, 138355678.53853944, 46325259.691596255, 138355680.45814, 46325263.20088874, 0, 0, 0, 0, 0 },
-  { 138355662.12325135, 46325270.950502805, 138355643.4487271, 46325235.57731884, 138355680.7977756, 46325306.32368677, 138355661.18952513, 46325269.18184361, 138355663.05697757, 46325272.719162, 0, 0, 0, 0, 0 },
-  { 138355644.54932076, 46325280.228287734, 138355626.31353083, 46325244.62693992, 138355662.78511068, 46325315.829635546, 138355643.63753125, 46325278.44822034, 138355645.46111026, 46325282.008355126, 0, 0, 0, 0, 0 },
-  { 138355626.80574834, 46325289.31693406, 138355608.92546776, 46325253.53571598, 138355644.68602893, 46325325.09815213, 138355625.9117343, 46325287.52787315, 138355627.69976237, 46325291.10599496, 0, 0, 0, 0, 0 },
-  { 138355608.9217346, 46325298.2537786, 138355591.31355318, 46325262.337877564, 138355626.52991602, 46325334.169679634, 138355608.04132554, 46325296.457983546, 138355609.80214366, 46325300.04957365, 1, 4, 138355709.7285732, 46325503.87231203, 43 },
-  { 138355590.92647985, 46325307.076158136, 138355573.5069916, 46325271.06836135, 138355608.3459681, 46325343.08395492, 138355590.05550542, 46325305.275768295, 138355591.79745427, 46325308.87654798, 0, 0, 0, 0, 0 },
-  { 138355572.84918454, 46325315.82140947, 138355555.53510094, 46325279.7628112, 138355590.16326815, 46325351.880007744, 138355571.98348036, 46325314.018479556, 138355573.71488872, 46325317.62433939, 0, 0, 0, 0, 0 },
-  { 138355554.71904904, 46325324.52686939, 138355537.42725945, 46325288.45757479, 138355572.01083863, 46325360.59616398, 138355553.85445955, 46325322.72340465, 138355555.58363852, 46325326.33033412, 1, 2, 138355419.84309015, 46325043.186371565, 27 },
-  { 138355536.56527376, 46325333.2298747, 138355519.21287763, 46325297.18969784, 138355553.9176699, 46325369.27005156, 138355535.69765395, 46325331.427865855, 138355537.43289357, 46325335.031883545, 1, 1, 138355679.72254193, 46325630.561333805, 40 },
-  { 138355518.41705906, 46325341.967762195, 138355500.92139137, 46325305.996918276, 138355535.91272676, 46325377.93860611, 138355517.54227567, 46325340.16922, 138355519.29184246, 46325343.76630439, 0, 0, 0, 0, 0 },
-  { 138355500.30360547, 46325350.777868666, 138355482.58227864, 46325314.917659864, 138355518.0249323, 46325386.63807747, 138355499.41753912, 46325348.98485822, 138355501.1896718, 46325352.57087911, 0, 0, 0, 0, 0 },
-  { 138355482.25411326, 46325359.69753091, 138355464.225096, 46325323.991025396, 138355500.28313053, 46325395.404036425, 138355481.35266238, 46325357.91220564, 138355483.15556413, 46325361.482856184, 1, 2, 138355310.97844914, 46325020.48572853, 29 },
-  { 138355464.29778293, 46325368.76408573, 138355445.87953964, 46325333.25678629, 138355482.71602622, 46325404.27138518, 138355463.37687075, 46325366.98872076, 138355465.2186951, 46325370.539450705, 1, 3, 138355644.79656723, 46325716.73562029, 38 },
-  { 138355446.46381482, 46325378.0148699, 138355427.57552677, 46325342.75536657, 138355465.35210288, 46325413.274373226, 138355445.51940042, 46325376.251894735, 138355447.40822923, 46325379.77784506, 1, 2, 138355328.41201454, 46325157.642974116, 29 },
-  { 138355428.78140932, 46325387.48722024, 138355409.34330118, 46325352.52781591, 138355448.21951747, 46325422.44662458, 138355427.8095039, 46325385.73925003, 138355429.75331473, 46325389.23519046, 0, 0, 0, 0, 0 },
-  { 138355411.27976692, 46325397.21847352, 138355391.21356007, 46325362.61576635, 138355431.34597376, 46325431.82118069, 138355410.27645656, 46325395.48833816, 138355412.28307727, 46325398.948608875, 1, 0, 138355303.92556036, 46325212.09399016, 48 },
-  { 138355393.98808798, 46325407.245966576, 138355373.21956024, 46325373.06017632, 138355414.75661573, 46325441.43175683, 138355392.94966158, 46325405.53667706, 138355395.02651438, 46325408.95525609, 0, 0, 0, 0, 0 },
-  { 138355376.93489102, 46325417.60611305, 138355355.4516516, 46325383.86488568, 138355398.41813043, 46325451.34734041, 138355375.86072904, 46325415.91905168, 138355378.009053, 46325419.293174416, 0, 0, 0, 0, 0 },
-  { 138355360.12792444, 46325428.30720826, 138355337.986694, 46325394.99405898, 138355382.26915488, 46325461.62035754, 138355359.0208629, 46325426.6415508, 138355361.23498598, 46325429.97286572, 0, 0, 0, 0, 0 },
-  { 138355343.55087256, 46325439.32496952, 138355320.8112353, 46325406.41738837, 138355366.29050982, 46325472.23255067, 138355342.4138907, 46325437.67959046, 138355344.68785444, 46325440.97034858, 0, 0, 0, 0, 0 },
-  { 138355327.18607438, 46325450.63329306, 138355303.9064064, 46325418.10550404, 138355350.46574235, 46325483.16108208, 138355326.02209097, 46325449.00690361, 138355328.35005778, 46325452.259682514, 0, 0, 0, 0, 0 },
-  { 138355311.015869, 46325462.2060751, 138355287.25321144, 46325430.02943597, 138355334.77852654, 46325494.382714234, 138355309.8277361, 46325460.597243145, 138355312.20400187, 46325463.81490706, 1, 2, 138355216.55930522, 46325334.303934544, 36 },
-  { 138355295.02259532, 46325474.01721187, 138355270.83259907, 46325442.16059431, 138355319.21259156, 46325505.87382943, 138355293.8130955, 46325472.42438099, 138355296.23209512, 46325475.61004275, 1, 3, 138355389.9683305, 46325599.0544358, 46 },
-  { 138355279.1885926, 46325486.04059963, 138355254.6255276, 46325454.47074317, 138355303.75165763, 46325517.61045609, 138355277.96043935, 46325484.46210681, 138355280.41674587, 46325487.61909245, 0, 0, 0, 0, 0 },
-  { 138355263.49619976, 46325498.25013459, 138355238.61301637, 46325466.93197397, 138355288.37938315, 46325529.5682952, 138355262.2520406, 46325496.68422656, 138355264.74035892, 46325499.81604262, 1, 5, 138355345.61070496, 46325601.60006462, 28 },
-  { 138355247.92775592, 46325510.619712986, 138355222.77619323, 46325479.51667626, 138355273.0793186, 46325541.72274971, 138355246.6701778, 46325509.06456115, 138355249.18533406, 46325512.17486482, 0, 0, 0, 0, 0 },
-  { 138355232.4656001, 46325523.12323105, 138355207.09633029, 46325492.19751118, 138355257.83486992, 46325554.048950925, 138355231.1971366, 46325521.57694506, 138355233.7340636, 46325524.66951705, 1, 4, 138355299.69416508, 46325605.07638872, 37 },
-  { 138355217.09207132, 46325535.734585, 138355191.5548743, 46325504.94738688, 138355242.62926835, 46325566.52178312, 138355215.81521147, 46325534.1952251, 138355218.36893117, 46325537.27394491, 1, 2, 138355007.04862577, 46325282.50988049, 39 },
-  { 138355201.7895087, 46325548.42767111, 138355176.13347057, 46325517.73943709, 138355227.44554684, 46325579.115905136, 138355200.5067068, 46325546.89325941, 138355203.0723106, 46325549.96208281, 0, 0, 0, 0, 0 },
-  { 138355186.54025117, 46325561.17638557, 138355160.81397954, 46325530.54700509, 138355212.2665228, 46325591.805766046, 138355185.25393757, 46325559.64491654, 138355187.82656476, 46325562.70785459, 1, 4, 138355038.61418936, 46325385.05744781, 37 },
-  { 138355171.32663792, 46325573.954624645, 138355145.5784911, 46325543.34363095, 138355197.07478476, 46325604.56561834, 138355170.03923059, 46325572.42407496, 138355172.61404526, 46325575.48517433, 1, 0, 138355398.55403367, 46325844.09664401, 45 },
-  { 138355156.131008, 46325586.73628454, 138355130.4093312, 46325556.10304535, 138355181.8526848, 46325617.36952373, 138355154.84492415, 46325585.20462258, 138355157.41709185, 46325588.2679465, 1, 4, 138355053.88734275, 46325464.969158776, 39 },
-  { 138355140.93570033, 46325599.49526149, 138355115.2890656, 46325568.799168475, 138355166.58233505, 46325630.191354506, 138355139.6533686, 46325597.96045684, 138355142.21803206, 46325601.03006614, 0, 0, 0, 0, 0 },
-  { 138355125.72305405, 46325612.20545175, 138355100.2004998, 46325581.40611371, 138355151.2456083, 46325643.00478979, 138355124.44692633, 46325610.665484846, 138355126.99918178, 46325613.74541865, 0, 0, 0, 0, 0 },
-  { 138355110.4754082, 46325624.840751514, 138355085.12667266, 46325593.89819819, 138355135.82414374, 46325655.78330484, 138355109.20797142, 46325623.29362385, 138355111.74284497, 46325626.38787918, 0, 0, 0, 0, 0 },
-  { 138355095.1751019, 46325637.375057064, 138355070.05084717, 46325606.24995749, 138355120.29935664, 46325668.50015664, 138355093.91888916, 46325635.81880209, 138355096.43131465, 46325638.93131204, 0, 0, 0, 0, 0 },
-  { 138355079.80447406, 46325649.78226459, 138355054.95649272, 46325618.43616717, 138355104.6524554, 46325681.12836201, 138355078.562075, 46325648.21495972, 138355081.04687312, 46325651.34956946, 0, 0, 0, 0, 0 },
-  { 138355064.34586385, 46325662.03627034, 138355039.8272648, 46325630.43186717, 138355088.8644629, 46325693.64067352, 138355063.1199339, 46325660.45605019, 138355065.5717938, 46325663.6164905, 1, 1, 138354825.28952304, 46325353.89333934, 50 },
-  { 138355048.78161025, 46325674.11097055, 138355024.6469737, 46325642.21239191, 138355072.9162468, 46325706.009549186, 138355047.57487842, 46325672.516041614, 138355049.98834208, 46325675.705899484, 0, 0, 0, 0, 0 },
-  { 138355033.0940523, 46325685.980261445, 138355009.39954722, 46325653.75340264, 138355056.7885574, 46325718.20712025, 138355031.90932706, 46325684.36891851, 138355034.27877757, 46325687.59160438, 1, 3, 138354851.83108836, 46325439.44479159, 31 },
-  { 138355017.26552916, 46325697.618039265, 138354994.06898308, 46325665.030921414, 138355040.46207523, 46325730.205157116, 138355016.10570186, 46325695.98868337, 138355018.42535645, 46325699.24739516, 0, 0, 0, 0, 0 },
-  { 138355001.2783798, 46325708.99820024, 138354978.6392905, 46325676.02136539, 138355023.91746908, 46325741.975035086, 138355000.14642534, 46325707.3493585, 138355002.41033426, 46325710.64704198, 1, 0, 138354936.1909981, 46325614.189800054, 44 },
-  { 138354985.11494333, 46325720.094640605, 138354963.09442174, 46325686.701578006, 138355007.1354649, 46325753.487703204, 138354984.01391724, 46325718.42498747, 138354986.2159694, 46325721.76429374, 0, 0, 0, 0, 0 },
-  { 138354968.75755864, 46325730.88125657, 138354947.41819018, 46325697.04885562, 138354990.0969271, 46325764.71365753, 138354967.69059023, 46325729.18963653, 138354969.82452706, 46325732.57287662, 1, 3, 138354873.26388484, 46325579.48126231, 32 },
-  { 138354952.188565, 46325741.33194439, 138354931.59418043, 46325707.04096416, 138354972.78294954, 46325775.622924626, 138354951.15884575, 46325739.61739538, 138354953.21828422, 46325743.0464934, 0, 0, 0, 0, 0 },
-  { 138354935.39030138, 46325751.4206003, 138354915.60564566, 46325716.65614434, 138354955.1749571, 46325786.18505626, 138354934.4010686, 46325749.6823775, 138354936.37953416, 46325753.1588231, 1, 3, 138354804.31695727, 46325521.10607957, 44 },
-  { 138354918.34510672, 46325761.12112052, 138354899.43147135, 46325725.87520732, 138354937.2587421, 46325796.36703372, 138354917.39942494, 46325759.35882486, 138354919.2907885, 46325762.88341618, 0, 0, 0, 0, 0 },
-  { 138354901.03696468, 46325770.40900265, 138354883.00772086, 46325734.70261153, 138354919.0662085, 46325806.115393765, 138354900.1355025, 46325768.62368309, 138354901.93842688, 46325772.194322206, 0, 0, 0, 0, 0 },
-  { 138354883.46982467, 46325779.27918641, 138354866.30565116, 46325743.148989245, 138354900.6339982, 46325815.40938358, 138354882.611616, 46325777.47267655, 138354884.32803336, 46325781.08569627, 0, 0, 0, 0, 0 },
-  { 138354865.66093203, 46325787.73955883, 138354849.3411114, 46325751.22020158, 138354881.98075268, 46325824.25891608, 138354864.844941, 46325785.91359097, 138354866.47692308, 46325789.565526694, 0, 0, 0, 0, 0 },
-  { 138354847.62777337, 46325795.7982416, 138354832.13101462, 46325758.92209121, 138354863.12453213, 46325832.67439199, 138354846.85293543, 46325793.95443408, 138354848.40261132, 46325797.64204912, 1, 0, 138354978.96280396, 46326108.32361616, 32 },
-  { 138354829.38783497, 46325803.46335638, 138354814.69249055, 46325766.26057621, 138354844.08317938, 46325840.666136555, 138354828.65306774, 46325801.60321738, 138354830.1226022, 46325805.32349539, 0, 0, 0, 0, 0 },
-  { 138354810.9586033, 46325810.74302488, 138354797.04285938, 46325773.241663955, 138354824.8743472, 46325848.2443858, 138354810.2628161, 46325808.86795683, 138354811.65439048, 46325812.618092924, 0, 0, 0, 0, 0 },
-  { 138354792.35756475, 46325817.64536876, 138354779.1996047, 46325779.87146127, 138354805.5155248, 46325855.41927625, 138354791.69966674, 46325815.75667339, 138354793.01546276, 46325819.53406414, 1, 0, 138354759.46266457, 46325723.21060004, 30 },
-  { 138354773.60220584, 46325824.17850976, 138354761.1803505, 46325786.15618066, 138354786.02406117, 46325862.20083886, 138354772.98111308, 46325822.277393304, 138354774.2232986, 46325826.07962621, 1, 1, 138354851.549348, 46326062.76862487, 25 },
-  { 138354754.71001297, 46325830.350569494, 138354743.00283852, 46325792.102143824, 138354766.41718742, 46325868.598995164, 138354754.12465426, 46325828.43814821, 138354755.29537168, 46325832.26299078, 0, 0, 0, 0, 0 },
-  { 138354735.6984725, 46325836.16966968, 138354724.68490887, 46325797.71578281, 138354746.71203613, 46325874.623556554, 138354735.1477943, 46325834.24697534, 138354736.2491507, 46325838.09236402, 0, 0, 0, 0, 0 },
-  { 138354716.58507094, 46325841.643932015, 138354706.24448323, 46325803.00363898, 138354726.92565864, 46325880.28422505, 138354716.06804156, 46325839.71191736, 138354717.1021003, 46325843.57594667, 0, 0, 0, 0, 0 },
-  { 138354697.38729474, 46325846.78147817, 138354687.69856566, 46325807.97260638, 138354707.07602382, 46325885.59034995, 138354696.9028583, 46325844.84103458, 138354697.8717312, 46325848.72192176, 0, 0, 0, 0, 0 },
-  { 138354678.12248155, 46325851.59098556, 138354669.03786716, 46325812.63627107, 138354687.20709595, 46325890.54570005, 138354677.66825083, 46325849.64324983, 138354678.57671228, 46325853.538721286, 0, 0, 0, 0, 0 },
-  { 138354658.8039195, 46325856.09626019, 138354650.24515948, 46325817.02264215, 138354667.3626795, 46325895.16987823, 138354658.37598148, 46325854.14257929, 138354659.2318575, 46325858.04994109, 0, 0, 0, 0, 0 },
-  { 138354639.44046423, 46325860.33766846, 138354631.32652846, 46325821.16926224, 138354647.5544, 46325899.50607469, 138354639.03476745, 46325858.37924815, 138354639.846161, 46325862.29608878, 1, 3, 138354588.93121403, 46325616.51433971, 36 },
-  { 138354620.04074565, 46325864.35641944, 138354612.28967544, 46325825.1145934, 138354627.79181585, 46325903.59824547, 138354619.65319213, 46325862.39432813, 138354620.42829916, 46325866.31851074, 0, 0, 0, 0, 0 },
-  { 138354600.6133937, 46325868.19372224, 138354593.1425675, 46325828.8975805, 138354608.0842199, 46325907.489863984, 138354600.2398524, 46325866.228915155, 138354600.986935, 46325870.15852933, 1, 1, 138354581.0024749, 46325765.04135016, 35 },
-  { 138354581.1670383, 46325871.890786, 138354573.89336616, 46325832.55767407, 138354588.44071043, 46325911.22389793, 138354580.80335468, 46325869.9241304, 138354581.5307219, 46325873.8574416, 1, 4, 138354649.35771462, 46326240.63871028, 42 },
-  { 138354561.71030942, 46325875.488819815, 138354554.55037168, 46325836.13484554, 138354568.87024716, 46325914.84279409, 138354561.35231254, 46325873.5211211, 138354562.0683063, 46325877.45651853, 0, 0, 0, 0, 0 },
-  { 138354542.25183704, 46325879.029032804, 138354535.12198362, 46325839.66959696, 138354549.38169047, 46325918.388468646, 138354541.89534438, 46325877.06106101, 138354542.6083297, 46325880.9970046, 0, 0, 0, 0, 0 },
-  { 138354522.80025095, 46325882.55263407, 138354515.6166775, 46325843.20296733, 138354529.9838244, 46325921.902300805, 138354522.4410723, 46325880.58515073, 138354523.1594296, 46325884.5201174, 0, 0, 0, 0, 0 },
-  { 138354503.36418122, 46325886.10083272, 138354496.04299986, 46325846.776536115, 138354510.68536258, 46325925.42512933, 138354502.99812216, 46325884.134617895, 138354503.7302403, 46325888.06704755, 0, 0, 0, 0, 0 },
-  { 138354483.9522578, 46325889.71483791, 138354476.40957934, 46325850.43242452, 138354491.4949363, 46325928.997251295, 138354483.57512388, 46325887.75071724, 138354484.32939175, 46325891.67895858, 1, 1, 138354462.2670572, 46325776.77789942, 25 },
-  { 138354464.57311058, 46325893.43585869, 138354456.72515494, 46325854.21329386, 138354472.42106622, 46325932.65842352, 138354464.1807128, 46325891.47473045, 138354464.96550837, 46325895.39698693, 0, 0, 0, 0, 0 },
-  { 138354445.23536956, 46325897.305104226, 138354436.99862334, 46325858.16233974, 138354453.47211578, 46325936.44786871, 138354444.82353225, 46325895.347966, 138354445.64720687, 46325899.26224245, 0, 0, 0, 0, 0 },
-  { 138354425.9476646, 46325901.3637836, 138354417.23910114, 46325862.32327998, 138354434.65622804, 46325940.40428722, 138354425.51223642, 46325899.411758415, 138354426.38309276, 46325903.31580878, 1, 3, 138354460.1287761, 46326054.597760305, 29 },
-  { 138354406.71862575, 46325905.653105944, 138354397.45600578, 46325866.74033334, 138354415.98124573, 46325944.56587855, 138354406.25549474, 46325903.70746732, 138354407.18175676, 46325907.59874457, 0, 0, 0, 0, 0 },
-  { 138354387.5568828, 46325910.21428036, 138354377.65914902, 46325871.45818579, 138354397.45461658, 46325948.97037493, 138354387.0619961, 46325908.27647563, 138354388.0517695, 46325912.15208509, 0, 0, 0, 0, 0 },
-  { 138354368.47106582, 46325915.08851595, 138354357.86245328, 46325876.52094745, 138354379.07967836, 46325953.656084456, 138354367.9406352, 46325913.16013753, 138354369.00149643, 46325917.01689438, 0, 0, 0, 0, 0 },
-  { 138354349.4694846, 46325920.31519786, 138354338.142858, 46325881.95235738, 138354360.7961112, 46325958.678038344, 138354348.90315327, 46325918.39705584, 138354350.03581592, 46325922.23333988, 1, 4, 138354454.807112, 46326277.08961434, 46 },
-  { 138354330.55450603, 46325925.899844274, 138354318.56175625, 46325887.73999689, 138354342.5472558, 46325964.05969166, 138354329.95486856, 46325923.9918519, 138354331.1541435, 46325927.807836644, 0, 0, 0, 0, 0 },
-  { 138354311.72324917, 46325931.81806899, 138354299.1175304, 46325893.85630067, 138354324.32896793, 46325969.77983731, 138354311.09296322, 46325929.91998057, 138354312.35353512, 46325933.71615741, 1, 4, 138354387.0424188, 46326158.63963473, 48 },
-  { 138354292.9726529, 46325938.04445816, 138354279.8062361, 46325900.27349751, 138354306.13906974, 46325975.81541881, 138354292.31433207, 46325936.15591013, 138354293.63097376, 46325939.93300619, 0, 0, 0, 0, 0 },
-  { 138354274.29965603, 46325944.553597875, 138354260.62386346, 46325906.96406878, 138354287.9754486, 46325982.14312697, 138354273.6158664, 46325942.67412142, 138354274.98344567, 46325946.43307433, 1, 4, 138354325.58387816, 46326085.51433198, 34 },
-  { 138354255.7011973, 46325951.320074335, 138354241.5663812, 46325913.90073477, 138354269.8360134, 46325988.7394139, 138354254.9944565, 46325949.44910736, 138354256.4079381, 46325953.19104131, 0, 0, 0, 0, 0 },
-  { 138354237.17421558, 46325958.31847363, 138354222.628852, 46325921.056798965, 138354251.71957916, 46325995.580148295, 138354236.4469474, 46325956.455389895, 138354237.90148377, 46325960.181557365, 1, 0, 138354294.99203578, 46326106.433630414, 44 },
-  { 138354218.7158451, 46325965.52383173, 138354203.76766062, 46325928.421921, 138354233.6640296, 46326002.625742465, 138354217.96843588, 46325963.6687362, 138354219.46325433, 46325967.37892727, 0, 0, 0, 0, 0 },
-  { 138354200.3317101, 46325972.93071285, 138354184.9339849, 46325936.01310108, 138354215.7294353, 46326009.84832462, 138354199.56182384, 46325971.08483226, 138354201.10159636, 46325974.77659344, 1, 5, 138354239.98085248, 46326067.993563145, 43 },
-  { 138354182.03900537, 46325980.56029741, 138354166.14155555, 46325943.855105825, 138354197.9364552, 46326017.26548899, 138354181.24413288, 46325978.72503783, 138354182.83387786, 46325982.39555699, 0, 0, 0, 0, 0 },
-  { 138354163.8557566, 46325988.43567613, 138354147.40898556, 46325951.97331578, 138354180.30252767, 46326024.89803647, 138354163.03341806, 46325986.61255811, 138354164.67809516, 46325990.258794144, 1, 1, 138354307.35383403, 46326306.56977015, 30 },
-  { 138354145.79998922, 46325996.57993968, 138354128.7550724, 46325960.393328734, 138354162.84490603, 46326032.76655062, 138354144.9477434, 46325994.77060913, 138354146.65223506, 46325998.38927022, 0, 0, 0, 0, 0 },
-  { 138354127.88972875, 46326005.016178705, 138354110.19885197, 46325969.14093823, 138354145.58060554, 46326040.89141918, 138354127.00518492, 46326003.222416684, 138354128.7742726, 46326006.809940726, 0, 0, 0, 0, 0 },
-  { 138354110.14300078, 46326013.76748388, 138354091.75965533, 46325978.242104076, 138354128.52634624, 46326049.29286369, 138354109.2238335, 46326011.991214894, 138354111.06216806, 46326015.54375287, 1, 2, 138353984.2170845, 46325770.418632224, 32 },
-  { 138354092.57783064, 46326022.8569459, 138354073.4571674, 46325987.72291345, 138354111.6984939, 46326057.99097835, 138354091.62179747, 46326021.100244276, 138354093.5338638, 46326024.61364753, 1, 2, 138354172.88461635, 46326170.41988221, 25 },
-  { 138354075.21224394, 46326032.30765544, 138354055.3114881, 46325997.60952989, 138354095.1129998, 46326067.00578099, 138354074.21720615, 46326030.57274916, 138354076.20728174, 46326034.04256172, 0, 0, 0, 0, 0 },
-  { 138354058.06426615, 46326042.14270313, 138354037.34318966, 46326007.92813037, 138354078.78534263, 46326076.35727589, 138354057.0282123, 46326040.43197449, 138354059.10031998, 46326043.85343177, 0, 0, 0, 0, 0 },
-  { 138354041.15192285, 46326052.385179676, 138354019.57337102, 46326018.704827815, 138354062.73047468, 46326086.06553154, 138354040.07299528, 46326050.701162085, 138354042.23085043, 46326054.06919727, 1, 5, 138353872.8392187, 46325789.678435154, 44 },
-  { 138354024.49323946, 46326063.058175735, 138354002.0260594, 46326029.96397958, 138354046.96041954, 46326096.15237189, 138354023.36988047, 46326061.40346593, 138354025.61659846, 46326064.71288554, 1, 3, 138354141.32257587, 46326235.147995755, 41 },
-  { 138354008.1071832, 46326074.18243678, 138353984.7382951, 46326041.718686685, 138354031.47607127, 46326106.64618687, 138354006.9387388, 46326072.559249274, 138354009.27562758, 46326075.805624284, 0, 0, 0, 0, 0 },
-  { 138353992.018789, 46326085.76359675, 138353967.74188995, 46326053.97315523, 138354016.29568803, 46326117.55403827, 138353990.80494404, 46326084.17407467, 138353993.23263395, 46326087.35311883, 0, 0, 0, 0, 0 },
-  { 138353976.25549805, 46326097.80129754, 138353951.06503376, 46326066.729758985, 138354001.44596234, 46326128.87283609, 138353974.99597484, 46326096.24772061, 138353977.51502126, 46326099.35487447, 0, 0, 0, 0, 0 },
-  { 138353960.84475735, 46326110.29516593, 138353934.73628134, 46326079.990917385, 138353986.95323336, 46326140.59941448, 138353959.53933355, 46326108.77995351, 138353962.15018114, 46326111.81037836, 1, 4, 138354031.9903545, 46326192.87424322, 36 },
-  { 138353945.81401402, 46326123.24482879, 138353918.78459778, 46326093.75905836, 138353972.84343025, 46326152.730599225, 138353944.46254322, 46326121.77054027, 138353947.16548482, 46326124.71911731, 0, 0, 0, 0, 0 },
-  { 138353931.1907151, 46326136.64991291, 138353903.2393922, 46326108.036567286, 138353959.14203802, 46326165.26325853, 138353929.79314896, 46326135.21924563, 138353932.58828124, 46326138.08058019, 0, 0, 0, 0, 0 },
-  { 138353917.0023078, 46326150.51004514, 138353888.13055074, 46326122.825723864, 138353945.87406486, 46326178.19436642, 138353915.55871996, 46326149.12582908, 138353918.44589564, 46326151.8942612, 0, 0, 0, 0, 0 },
-  { 138353903.27623913, 46326164.82485229, 138353873.48846272, 46326138.12862826, 138353933.06401554, 46326191.521076314, 138353901.7868503, 46326163.490041085, 138353904.76562795, 46326166.15966349, 0, 0, 0, 0, 0 },
-  { 138353890.03995612, 46326179.593961135, 138353859.34403977, 46326153.94711496, 138353920.73587248, 46326205.24080731, 138353888.5051603, 46326178.31161883, 138353891.57475194, 46326180.87630344, 0, 0, 0, 0, 0 },
-  { 138353877.32090598, 46326194.81699856, 138353845.7344117, 46326170.275332384, 138353908.90740028, 46326219.35866474, 138353875.74158126, 46326193.58991525, 138353878.9002307, 46326196.044081874, 1, 2, 138354094.47805417, 46326363.540953554, 34 },
-  { 138353865.14404976, 46326210.48929223, 138353832.71067175, 46326187.0782694, 138353897.57742777, 46326233.900315054, 138353863.52238086, 46326209.31874108, 138353866.76571867, 46326211.65984337, 1, 3, 138353630.00205907, 46326040.75937673, 46 },
-  { 138353853.52377865, 46326226.58789025, 138353820.2920962, 46326204.32457331, 138353886.7554611, 46326248.8512072, 138353851.86219454, 46326225.474724405, 138353855.18536276, 46326227.7010561, 0, 0, 0, 0, 0 },
-  { 138353842.47167474, 46326243.08498313, 138353808.48850477, 46326221.986543395, 138353876.4548447, 46326264.18342287, 138353840.77251625, 46326242.03006115, 138353844.17083323, 46326244.13990512, 0, 0, 0, 0, 0 },
-  { 138353831.99932024, 46326259.95276138, 138353797.30992085, 46326240.03679869, 138353866.68871963, 46326279.86872407, 138353830.26485026, 46326258.95696325, 138353833.73379022, 46326260.948559515, 1, 0, 138354096.50599062, 46326411.81197687, 43 },
-  { 138353822.11829746, 46326277.16341552, 138353786.7666026, 46326258.4482433, 138353857.4699923, 46326295.878587745, 138353820.35071272, 46326276.22765691, 138353823.8858822, 46326278.099174134, 0, 0, 0, 0, 0 },
-  { 138353812.84018847, 46326294.68913603, 138353776.86906928, 46326277.19403434, 138353848.81130767, 46326312.18423772, 138353811.0416325, 46326293.814380944, 138353814.63874444, 46326295.56389111, 0, 0, 0, 0, 0 },
-  { 138353804.1765756, 46326312.50211345, 138353767.62812713, 46326296.24754748, 138353840.72502407, 46326328.756679416, 138353802.3491532, 46326311.689385146, 138353806.003998, 46326313.31484175, 0, 0, 0, 0, 0 },
-  { 138353796.13904095, 46326330.574538246, 138353759.05510214, 46326315.58182396, 138353833.22297975, 46326345.56725253, 138353794.284844, 46326329.824902534, 138353797.99323788, 46326331.32417396, 1, 2, 138353984.34003046, 46326406.662563235, 34 },
-  { 138353788.73882976, 46326348.878694095, 138353751.17183447, 46326335.14112279, 138353826.30582505, 46326362.6162654, 138353786.86048, 46326348.19181553, 138353790.6171795, 46326349.56557266, 1, 5, 138353499.47296607, 46326243.099395014, 33 },
-  { 138353781.96887526, 46326367.39192639, 138353743.9841669, 46326354.85550221, 138353819.95358363, 46326379.928350575, 138353780.06963983, 46326366.76510518, 138353783.8681107, 46326368.018747605, 1, 4, 138353896.87261802, 46326405.314609535, 49 },
-  { 138353775.79477146, 46326386.09913737, 138353737.45327565, 46326374.70046644, 138353814.13626727, 46326397.49780831, 138353773.87769666, 46326385.529203825, 138353777.71184626, 46326386.66907092, 0, 0, 0, 0, 0 },
-  { 138353770.17987874, 46326404.985846795, 138353731.53647712, 46326394.656882145, 138353808.82328036, 46326415.314811446, 138353768.24770865, 46326404.469398566, 138353772.11204883, 46326405.502295025, 1, 3, 138353913.16046476, 46326443.203016, 38 },
-  { 138353765.08755735, 46326424.037574396, 138353726.1910753, 46326414.70678216, 138353803.9840394, 46326433.36836663, 138353763.14273325, 46326423.57103478, 138353767.03238145, 46326424.50411401, 0, 0, 0, 0, 0 },
-  { 138353760.48116776, 46326443.23983989, 138353721.37453648, 46326434.83321216, 138353799.58779904, 46326451.64646762, 138353758.5258362, 46326442.8195085, 138353762.43649933, 46326443.66017128, 1, 5, 138354039.11591566, 46326503.13706246, 42 },
-  { 138353756.32407016, 46326462.578163005, 138353717.04461977, 46326455.02006945, 138353795.60352054, 46326470.13625656, 138353754.36009765, 46326462.20025833, 138353758.28804266, 46326462.95606768, 0, 0, 0, 0, 0 },
-  { 138353752.57962498, 46326482.03806349, 138353713.1594717, 46326475.25193688, 138353791.99977827, 46326488.824190095, 138353750.6086173, 46326481.69875716, 138353754.55063266, 46326482.37736982, 0, 0, 0, 0, 0 },
-  { 138353749.21119255, 46326501.605061054, 138353709.67768663, 46326495.51392743, 138353788.74469846, 46326507.69619468, 138353747.23451725, 46326501.30050437, 138353751.18786785, 46326501.90961774, 1, 4, 138353556.48535115, 46326471.91078464, 32 },
-  { 138353746.18213314, 46326521.26467543, 138353706.55834234, 46326515.791540734, 138353785.80592394, 46326526.73781013, 138353744.2009436, 46326520.9910187, 138353748.1633227, 46326521.538332164, 0, 0, 0, 0, 0 },
-  { 138353743.45580718, 46326541.002426356, 138353703.7610161, 46326536.07053411, 138353783.15059826, 46326545.9343186, 138353741.47106764, 46326540.75583174, 138353745.44054672, 46326541.24902097, 0, 0, 0, 0, 0 },
-  { 138353740.9955749, 46326560.80383355, 138353701.24578586, 46326556.33681304, 138353780.74536392, 46326565.27085406, 138353739.00808543, 46326560.58048253, 138353742.98306435, 46326561.027184576, 0, 0, 0, 0, 0 },
-  { 138353738.7647967, 46326580.654416755, 138353698.9731051, 46326576.57749628, 138353778.5564883, 46326584.73133723, 138353736.77521214, 46326580.45057073, 138353740.75438127, 46326580.85826278, 1, 0, 138353626.35326797, 46326569.13711641, 26 },
-  { 138353736.72740397, 46326600.53984348, 138353696.901157, 46326596.81559168, 138353776.55365095, 46326604.26409528, 138353734.7360916, 46326600.353630885, 138353738.71871632, 46326600.72605607, 0, 0, 0, 0, 0 },
-  { 138353734.86550996, 46326620.45048721, 138353695.00730613, 46326617.08543344, 138353774.7237138, 46326623.815540984, 138353732.87259975, 46326620.28223452, 138353736.85842016, 46326620.6187399, 1, 4, 138353531.5886704, 46326603.28871296, 27 },
-  { 138353733.18275478, 46326640.38229311, 138353693.2951611, 46326637.385649845, 138353773.07034847, 46326643.37893638, 138353731.18837512, 46326640.232460946, 138353735.17713445, 46326640.53212528, 0, 0, 0, 0, 0 },
-  { 138353731.68402454, 46326660.331528835, 138353691.7698477, 46326657.71265744, 138353771.5982014, 46326662.95040023, 138353729.6883157, 46326660.20058527, 138353733.6797334, 46326660.4624724, 0, 0, 0, 0, 0 },
-  { 138353730.37420535, 46326680.29446204, 138353690.4365039, 46326678.06287046, 138353770.3119068, 46326682.52605362, 138353728.3773203, 46326680.18288246, 138353732.3710904, 46326680.40604162, 1, 5, 138353964.00975898, 46326693.34927282, 36 },
-  { 138353729.2581834, 46326700.2673604, 138353689.3002803, 46326698.432699494, 138353769.21608648, 46326702.1020213, 138353727.26028824, 46326700.17562735, 138353731.25607854, 46326700.35909344, 1, 2, 138353423.58022475, 46326686.23220449, 38 },
-  { 138353728.3408447, 46326720.24649157, 138353688.3663405, 46326718.81855151, 138353768.3153489, 46326721.67443162, 138353726.3421195, 46326720.17509457, 138353730.3395699, 46326720.317888565, 0, 0, 0, 0, 0 },
-  { 138353727.62707543, 46326740.2281232, 138353687.63986146, 46326739.21682772, 138353767.6142894, 46326741.239418685, 138353725.62771472, 46326740.17755843, 138353729.62643614, 46326740.27868798, 0, 0, 0, 0, 0 },
-  { 138353727.1217617, 46326760.208522975, 138353687.1260339, 46326759.62392324, 138353767.11748952, 46326760.79312271, 138353725.12197533, 46326760.17929299, 138353729.1215481, 46326760.23775296, 0, 0, 0, 0, 0 },
-  { 138353726.82978967, 46326780.18395854, 138353686.83006248, 46326780.03622526, 138353766.82951686, 46326780.33169182, 138353724.82980332, 46326780.176571876, 138353728.82977602, 46326780.1913452, 0, 0, 0, 0, 0 },
-  { 138353726.75604537, 46326800.15069757, 138353686.757166, 46326800.45011258, 138353766.75492474, 46326799.85128255, 138353724.7561014, 46326800.165668316, 138353728.75598934, 46326800.13572682, 0, 0, 0, 0, 0 },
-  { 138353726.90541506, 46326820.105007716, 138353686.91257778, 46326820.861952685, 138353766.89825234, 46326819.348062746, 138353724.9057732, 46326820.142854966, 138353728.90505692, 46326820.067160465, 1, 4, 138353626.92332184, 46326821.99737014, 41 },
-  { 138353727.28278467, 46326840.04315664, 138353687.30154523, 46326841.26810227, 138353767.2640241, 46326838.818211004, 138353725.2837227, 46326840.10440392, 138353729.28184664, 46326839.98190936, 0, 0, 0, 0, 0 },
-  { 138353727.8930404, 46326859.96141199, 138353687.9293304, 46326861.6649042, 138353767.85675037, 46326858.25791978, 138353725.8948549, 46326860.0465866, 138353729.89122587, 46326859.87623738, 1, 3, 138353385.20422742, 46326874.568857715, 48 },
-  { 138353728.74106842, 46326879.85604147, 138353688.80120975, 46326882.04868581, 138353768.6809271, 46326877.663397126, 138353726.74407548, 46326879.965673685, 138353730.73806137, 46326879.74640925, 0, 0, 0, 0, 0 },
-  { 138353729.8317548, 46326899.7233127, 138353689.92247346, 46326902.415758, 138353769.74103615, 46326897.0308674, 138353727.83629075, 46326899.85793497, 138353731.82721886, 46326899.58869043, 0, 0, 0, 0, 0 },
-  { 138353731.16998565, 46326919.559493355, 138353691.29842553, 46326922.76241288, 138353771.04154578, 46326916.35657383, 138353729.17640764, 46326919.71963933, 138353733.16356367, 46326919.39934738, 0, 0, 0, 0, 0 },
-  { 138353732.76064715, 46326939.36085112, 138353692.9343832, 46326943.08492146, 138353772.58691108, 46326935.636780776, 138353730.76933396, 46326939.54705463, 138353734.75196034, 46326939.1746476, 0, 0, 0, 0, 0 },
-  { 138353734.60862532, 46326959.1236536, 138353694.83567604, 46326963.37953249, 138353774.3815746, 46326954.8677747, 138353732.61997786, 46326959.336447544, 138353736.59727278, 46326958.91085965, 0, 0, 0, 0, 0 },
-  { 138353736.71880636, 46326978.844168514, 138353697.00764537, 46326983.64246962, 138353776.42996734, 46326974.045867406, 138353734.7332483, 46326979.08408357, 138353738.70436442, 46326978.604253456, 0, 0, 0, 0, 0 },
-  { 138353739.09607634, 46326998.51866349, 138353699.45564306, 46327003.8699296, 138353778.73650962, 46326993.16739738, 138353737.11405468, 46326998.786226794, 138353741.078098, 46326998.25110018, 0, 0, 0, 0, 0 },
-  { 138353741.74532136, 46327018.143406205, 138353702.1850303, 46327024.05808043, 138353781.30561242, 46327012.22873198, 138353739.7673068, 46327018.43913992, 138353743.72333592, 46327017.84767249, 0, 0, 0, 0, 0 },
-  { 138353744.67142764, 46327037.714664325, 138353705.20117626, 46327044.2030582, 138353784.14167902, 46327031.22627045, 138353742.69791508, 46327038.03908402, 138353746.6449402, 46327037.39024463, 0, 0, 0, 0, 0 },
-  { 138353747.87928116, 46327057.22870549, 138353708.5094561, 46327064.30096646, 138353787.24910623, 46327050.15644452, 138353745.9107899, 46327057.58231854, 138353749.84777242, 46327056.87509244, 0, 0, 0, 0, 0 },
-  { 138353751.37376818, 46327076.68179738, 138353712.11524945, 46327084.3478725, 138353790.6322869, 46327069.01572225, 138353749.41084224, 46327077.06510113, 138353753.33669412, 46327076.298493624, 1, 3, 138353995.75804722, 46327028.96047972, 42 },
-  { 138353755.15977475, 46327096.07020766, 138353716.02393776, 46327104.33980643, 138353794.29561174, 46327087.800608896, 138353753.2029829, 46327096.4836876, 138353757.1165666, 46327095.656727724, 0, 0, 0, 0, 0 },
-  { 138353759.24218693, 46327115.39020397, 138353720.24090213, 46327124.27275902, 138353798.24347174, 46327106.507648915, 138353757.2921227, 46327115.83433172, 138353761.19225118, 46327114.946076214, 0, 0, 0, 0, 0 },
-  { 138353763.6258909, 46327134.63805397, 138353724.77152058, 46327144.14267945, 138353802.48026124, 46327125.133428484, 138353761.6831724, 46327135.11328524, 138353765.56860942, 46327134.16282269, 0, 0, 0, 0, 0 },
-  { 138353768.3157728, 46327153.810025364, 138353729.62116492, 46327163.94547412, 138353807.0103807, 46327143.67457661, 138353766.38104242, 46327154.3167978, 138353770.25050318, 46327153.30325293, 1, 3, 138353969.52773374, 46327101.10569186, 41 },
-  { 138353773.3167187, 46327172.90238577, 138353734.79519773, 46327183.67700508, 138353811.83823967, 46327162.12776646, 138353771.39064264, 46327173.441116735, 138353775.24279475, 46327172.36365481, 0, 0, 0, 0, 0 },
-  { 138353778.63361475, 46327191.91140287, 138353740.29822648, 46327203.33059753, 138353816.96900302, 46327180.49220822, 138353776.71684533, 46327192.482362606, 138353780.55038416, 46327191.34044314, 1, 2, 138353886.9310866, 46327159.652177975, 31 },
-  { 138353784.2700925, 46327210.83362717, 138353746.12492952, 46327222.8730018, 138353822.41525546, 46327198.794252545, 138353782.36283433, 46327211.4355959, 138353786.17735064, 46327210.231658444, 1, 4, 138353531.55838776, 46327290.59448406, 27 },
-  { 138353790.21490082, 46327229.66896454, 138353752.25662598, 46327242.285199, 138353828.17317566, 46327217.05273008, 138353788.31698707, 46327230.29977626, 138353792.11281458, 46327229.03815282, 0, 0, 0, 0, 0 },
-  { 138353796.44704336, 46327248.419518046, 138353758.67039043, 46327261.56959384, 138353834.2236963, 46327235.26944225, 138353794.5582107, 46327249.07702184, 138353798.33587602, 46327247.762014255, 1, 1, 138353574.5092074, 46327325.676213324, 39 },
-  { 138353802.9453544, 46327267.08742877, 138353765.34339917, 46327280.72901823, 138353840.54730964, 46327253.44583931, 138353801.06525666, 46327267.76950824, 138353804.82545215, 46327266.4053493, 0, 0, 0, 0, 0 },
-  { 138353809.68866876, 46327285.6748379, 138353772.25299144, 46327299.76632695, 138353847.12434608, 46327271.583348855, 138353807.8168849, 46327286.37941235, 138353811.5604526, 46327284.97026345, 0, 0, 0, 0, 0 },
-  { 138353816.65582082, 46327304.18388656, 138353779.37666002, 46327318.68437521, 138353853.9349816, 46327289.683397904, 138353814.7918628, 46327304.90891099, 138353818.51977885, 46327303.458862126, 0, 0, 0, 0, 0 },
-  { 138353823.8256451, 46327322.61671584, 138353786.6920416, 46327337.48599598, 138353860.95924857, 46327307.747435704, 138353821.9689649, 46327323.36017985, 138353825.68232527, 46327321.87325183, 0, 0, 0, 0, 0 },
-  { 138353831.17697614, 46327340.9754669, 138353794.17690635, 46327356.17398115, 138353868.17704594, 46327325.77695265, 138353829.32697266, 46327341.735392615, 138353833.02697963, 46327340.215541184, 0, 0, 0, 0, 0 },
-  { 138353838.68864855, 46327359.262280904, 138353801.80916324, 46327374.75110147, 138353875.56813386, 46327343.773460336, 138353836.8446743, 46327360.03672193, 138353840.5326228, 46327358.48783988, 0, 0, 0, 0, 0 },
-  { 138353846.33951786, 46327377.47929886, 138353809.57061848, 46327393.22883975, 138353883.10841724, 46327361.72975797, 138353844.50107288, 46327378.266775906, 138353848.17796284, 46327376.69182181, 0, 0, 0, 0, 0 },
-  { 138353854.1135812, 46327395.628637634, 138353817.45348912, 46327411.62981407, 138353890.7736733, 46327379.627461195, 138353852.28057662, 46327396.42869645, 138353855.9465858, 46327394.828578815, 1, 0, 138353657.06558618, 46327481.634961, 48 },
-  { 138353862.00665492, 46327413.71235855, 138353825.45464218, 46327429.95890786, 138353898.55866766, 46327397.46580924, 138353860.1790543, 46327414.524686016, 138353863.83425555, 46327412.90003108, 0, 0, 0, 0, 0 },
-  { 138353870.0162101, 46327431.732515186, 138353833.5714042, 46327448.218149, 138353906.46101603, 46327415.24688137, 138353868.19396982, 46327432.55679688, 138353871.8384504, 46327430.90823349, 0, 0, 0, 0, 0 },
-  { 138353878.13971776, 46327449.69116106, 138353841.8011052, 46327466.409571186, 138353914.4783303, 46327432.97275093, 138353876.32278714, 46327450.527081564, 138353879.95664838, 46327448.85524055, 0, 0, 0, 0, 0 },
-  { 138353886.37464905, 46327467.590349756, 138353850.1410788, 46327484.535212874, 138353922.6082193, 46327450.64548664, 138353884.56297055, 46327468.43759291, 138353888.18632755, 46327466.7431066, 1, 2, 138353784.01481307, 46327515.459588066, 28 },
-  { 138353894.71847504, 46327485.43213481, 138353858.58866224, 46327502.59711735, 138353930.84828785, 46327468.267152265, 138353892.9119844, 46327486.290383935, 138353896.52496567, 46327484.57388568, 0, 0, 0, 0, 0 },
-  { 138353903.16866678, 46327503.21856977, 138353867.14119667, 46327520.59733258, 138353939.1961369, 46327485.83980696, 138353901.36729327, 46327504.08750791, 138353904.9700403, 46327502.34963163, 0, 0, 0, 0, 0 },
-  { 138353911.7226953, 46327520.95170819, 138353875.7960273, 46327538.537910946, 138353947.64936328, 46327503.365505435, 138353909.9263619, 46327521.83101833, 138353913.5190287, 46327520.07239805, 1, 2, 138354211.71037298, 46327374.10691519, 25 },
-  { 138353920.37803173, 46327538.63360365, 138353884.5505034, 46327556.42090847, 138353956.20556006, 46327520.84629882, 138353918.58665532, 46327539.52296889, 138353922.16940814, 46327537.74423841, 0, 0, 0, 0, 0 },
-  { 138353929.1321471, 46327556.26630965, 138353893.40197834, 46327574.248385176, 138353964.86231586, 46327538.28423412, 138353927.34563866, 46327557.165413424, 138353930.91865554, 46327555.36720587, 0, 0, 0, 0, 0 },
-  { 138353937.98251253, 46327573.85187978, 138353902.34780973, 46327592.02240416, 138353973.61721534, 46327555.68135541, 138353936.20077738, 46327574.760406, 138353939.7642477, 46327572.94335356, 0, 0, 0, 0, 0 },
-  { 138353946.92659894, 46327591.39236757, 138353911.38535964, 46327609.7450325, 138353982.46783823, 46327573.03970265, 138353945.14953697, 46327592.310000814, 138353948.7036609, 46327590.47473433, 0, 0, 0, 0, 0 },
-  { 138353955.96187764, 46327608.8898266, 138353920.5119942, 46327627.41833879, 138353991.41176108, 46327590.361314416, 138353954.18938348, 46327609.81625221, 138353957.7343718, 46327607.963401, 0, 0, 0, 0, 0 },
-  { 138353965.08581942, 46327626.34631039, 138353929.72508416, 46327645.04439589, 138354000.4465547, 46327607.6482249, 138353963.31778267, 46327627.28121467, 138353966.85385618, 46327625.411406115, 0, 0, 0, 0, 0 },
-  { 138353974.2958956, 46327643.76387252, 138353939.02200446, 46327662.62527764, 138354009.56978676, 46327624.9024674, 138353972.53220105, 46327644.706942774, 138353976.05959016, 46327642.820802264, 0, 0, 0, 0, 0 },
-  { 138353983.58957714, 46327661.14456652, 138353948.4001344, 46327680.1630607, 138354018.77901986, 46327642.12607234, 138353981.830105, 46327662.09549123, 138353985.34904927, 46327660.19364181, 1, 5, 138354295.8958813, 46327492.355430655, 27 },
-  { 138353992.96433505, 46327678.490445934, 138353957.85685787, 46327697.65982372, 138354028.07181224, 46327659.321068145, 138353991.2089612, 46327679.448914826, 138353994.71970892, 46327677.53197704, 1, 5, 138353673.48629257, 46327852.931783825, 50 },
-  { 138354002.41764057, 46327695.803564355, 138353967.3895628, 46327715.117646426, 138354037.44571835, 46327676.48948228, 138354000.66623667, 46327696.76926846, 138354004.16904446, 46327694.83786025, 1, 4, 138354324.67595625, 46327518.114009336, 42 },
-  { 138354011.9469646, 46327713.0859753, 138353976.9956416, 46327732.53861061, 138354046.8982876, 46327693.633339986, 138354010.19939843, 46327714.058607064, 138354013.69453076, 46327712.11334353, 0, 0, 0, 0, 0 },
-  { 138354021.54977828, 46327730.33973231, 138353986.67249092, 46327749.92479873, 138354056.42706564, 46327710.7546659, 138354019.80591393, 46327731.31898563, 138354023.29364264, 46327729.36047899, 0, 0, 0, 0, 0 },
-  { 138354031.2235526, 46327747.566888966, 138353996.4175118, 46327767.27829485, 138354066.02959344, 46327727.855483085, 138354029.48325056, 46327748.55245926, 138354032.96385467, 46327746.58131867, 0, 0, 0, 0, 0 },
-  { 138354040.96575877, 46327764.76949883, 138354006.22810933, 46327784.601183385, 138354075.7034082, 46327744.93781428, 138354039.2288763, 46327765.76108306, 138354042.70264125, 46327763.777914606, 0, 0, 0, 0, 0 },
-  { 138354050.7738678, 46327781.94961541, 138354016.10169283, 46327801.89554942, 138354085.44604275, 46327762.00368141, 138354049.04025903, 46327782.94691211, 138354052.50747654, 46327780.95231871, 0, 0, 0, 0, 0 },
-  { 138354060.6453507, 46327799.10929229, 138354026.0356757, 46327819.16347881, 138354095.25502568, 46327779.055105776, 138354058.91486695, 46327800.11200162, 138354062.37583444, 46327798.10658296, 0, 0, 0, 0, 0 },
-  { 138354070.57767862, 46327816.25058302, 138354036.02747542, 46327836.40705736, 138354105.12788182, 46327796.094108686, 138354068.85016847, 46327817.258406736, 138354072.30518878, 46327815.24275931, 1, 1, 138353736.3044625, 46328011.26447222, 44 },
-  { 138354080.56832257, 46327833.375541136, 138354046.07451344, 46327853.628371336, 138354115.0621317, 46327813.122710936, 138354078.8436321, 46327834.38818265, 138354082.29301304, 46327832.362899624, 1, 0, 138354307.36511767, 46327700.21318258, 32 },
-  { 138354090.6147537, 46327850.4862202, 138354056.1742151, 46327870.82950662, 138354125.05529228, 46327830.142933786, 138354088.89272678, 46327851.50338452, 138354092.3367806, 46327849.46905588, 0, 0, 0, 0, 0 },
-  { 138354100.71444297, 46327867.58467377, 138354066.32400972, 46327888.01254935, 138354135.10487622, 46327847.15679819, 138354098.9949213, 46327868.606067546, 138354102.43396464, 46327866.563279994, 1, 4, 138354205.6052644, 46327805.27965325, 44 },
-  { 138354110.8648615, 46327884.67295538, 138354076.52133036, 46327905.17958526, 138354145.20839262, 46327864.166325495, 138354109.14768493, 46327885.698286876, 138354112.58203804, 46327883.64762388, 0, 0, 0, 0, 0 },
-  { 138354121.06348038, 46327901.75311859, 138354086.76361382, 46327922.332699575, 138354155.36334693, 46327881.173537605, 138354119.34848705, 46327902.78209764, 138354122.7784737, 46327900.72413954, 0, 0, 0, 0, 0 },
-  { 138354131.30777067, 46327918.82721695, 138354097.04830053, 46327939.47397715, 138354165.5672408, 46327898.18045676, 138354129.59479716, 46327919.85955496, 138354133.02074417, 46327917.794878945, 0, 0, 0, 0, 0 },
-  { 138354141.5952034, 46327935.89730403, 138354107.37283468, 46327956.60550238, 138354175.81757212, 46327915.189105675, 138354139.88408497, 46327936.93271395, 138354143.30632183, 46327934.86189411, 0, 0, 0, 0, 0 },
-  { 138354151.92324966, 46327952.965433344, 138354117.7346639, 46327973.72935888, 138354186.11183542, 46327932.20150781, 138354150.21382037, 46327954.00362962, 138354153.63267896, 46327951.92723707, 0, 0, 0, 0, 0 },
-  { 138354162.28938058, 46327970.03365849, 138354128.131239, 46327990.84762889, 138354196.44752216, 46327949.21968809, 138354160.5814735, 46327971.07435701, 138354163.99728766, 46327968.99295997, 1, 3, 138354351.86706635, 46327854.51612276, 47 },
-  { 138354172.6910668, 46327987.10403304, 138354138.55764046, 46328007.958509944, 138354206.82449314, 46327966.24955613, 138354170.98439547, 46327988.14675688, 138354174.39773813, 46327986.061309196, 0, 0, 0, 0, 0 },
-  { 138354183.12334657, 46328004.17899754, 138354149.00085485, 46328025.05136104, 138354217.24583828, 46327983.30663404, 138354181.417222, 46328005.22261571, 138354184.82947114, 46328003.13537937, 0, 0, 0, 0, 0 },
-  { 138354193.5730217, 46328021.26230263, 138354159.44599012, 46328042.12724249, 138354227.7000533, 46328000.39736277, 138354191.86667013, 46328022.30554962, 138354195.2793733, 46328020.21905564, 1, 2, 138353917.1440659, 46328190.26831548, 50 },
-  { 138354204.02515244, 46328038.35797595, 138354169.87814748, 46328059.19021183, 138354238.1721574, 46328017.52574007, 138354202.3178022, 46328039.39958774, 138354205.7325027, 46328037.31636416, 0, 0, 0, 0, 0 },
-  { 138354214.46479902, 46328055.47004522, 138354180.2824641, 46328076.244259484, 138354248.64713395, 46328034.69583095, 138354212.75568226, 46328056.50875593, 138354216.17391577, 46328054.4313345, 0, 0, 0, 0, 0 },
-  { 138354224.87702152, 46328072.60253805, 138354190.64411396, 46328093.293309905, 138354259.10992908, 46328051.911766194, 138354223.16537616, 46328073.63707664, 138354226.5886669, 46328071.56799946, 0, 0, 0, 0, 0 },
-  { 138354235.24688026, 46328089.75948213, 138354200.9483091, 46328110.34122201, 138354269.54545143, 46328069.17774225, 138354233.5319517, 46328090.78856912, 138354236.96180883, 46328088.73039514, 0, 0, 0, 0, 0 },
-  { 138354245.5594354, 46328106.94490514, 138354211.18030155, 46328127.39179135, 138354279.93856925, 46328086.49801893, 138354243.84047872, 46328107.96724945, 138354247.27839208, 46328105.922560826, 1, 1, 138354579.8965121, 46327908.09893675, 42 },
-  { 138354255.7997471, 46328124.162834726, 138354221.325386, 46328144.44875163, 138354290.27410823, 46328103.876917824, 138354254.07602906, 46328125.17713057, 138354257.52346516, 46328123.14853888, 0, 0, 0, 0, 0 },
-  { 138354265.95287564, 46328141.41729857, 138354231.36890298, 46328161.515776984, 138354300.5368483, 46328121.318820156, 138354264.223677, 46328142.42222249, 138354267.68207428, 46328140.41237465, 1, 2, 138354451.84172875, 46328033.38797711, 40 },
-  { 138354276.00388122, 46328158.712324336, 138354241.2962428, 46328178.596484765, 138354310.71151963, 46328138.82816391, 138354274.26849928, 46328159.70653236, 138354277.73926315, 46328157.71811631, 0, 0, 0, 0, 0 },
-  { 138354285.93782398, 46328176.05193969, 138354251.09285003, 46328195.6944393, 138354320.78279793, 46328156.40944008, 138354284.1955753, 46328177.034064665, 138354287.68007267, 46328175.06981471, 0, 0, 0, 0, 0 },
-  { 138354295.7397642, 46328193.440172285, 138354260.74422833, 46328212.813155234, 138354330.7353001, 46328174.067189336, 138354293.98998743, 46328194.408821434, 138354297.489541, 46328192.471523136, 1, 5, 138353951.03373578, 46328384.26405435, 26 },
-  { 138354305.39476204, 46328210.881049804, 138354270.23594624, 46328229.95610344, 138354340.55357784, 46328191.80599617, 138354303.63682124, 46328211.834802486, 138354307.15270284, 46328209.92729712, 1, 5, 138354535.68500558, 46328085.93944852, 42 },
-  { 138354314.88787776, 46328228.378599934, 138354279.55364284, 46328247.12671566, 138354350.2221127, 46328209.63048421, 138354313.12116602, 46328229.31600572, 138354316.6545895, 46328227.44119415, 1, 2, 138354025.14715147, 46328382.11314886, 41 },
-  { 138354324.20417145, 46328245.936850294, 138354288.68303454, 46328264.328392714, 138354359.72530836, 46328227.545307875, 138354322.4281146, 46328246.856427416, 138354325.9802283, 46328245.01727317, 0, 0, 0, 0, 0 },
-  { 138354333.32870352, 46328263.559828594, 138354297.60992107, 46328281.564510755, 138354369.04748598, 46328245.55514643, 138354331.5427644, 46328264.460062705, 138354335.11464265, 46328262.65959448, 0, 0, 0, 0, 0 },
-  { 138354342.24653396, 46328281.251562476, 138354306.3201927, 46328298.83843269, 138354378.17287523, 46328263.66469226, 138354340.4502169, 46328282.130905986, 138354344.04285103, 46328280.37221897, 1, 3, 138354568.5824839, 46328170.45428012, 39 },
-  { 138354350.94272307, 46328299.01607962, 138354314.7998368, 46328316.153517395, 138354387.08560932, 46328281.878641844, 138354349.13557875, 46328299.87295151, 138354352.74986738, 46328298.15920773, 0, 0, 0, 0, 0 },
-  { 138354359.40233105, 46328316.85740767, 138354323.0349442, 46328333.51313262, 138354395.7697179, 46328300.20168272, 138354357.58396173, 46328317.690193914, 138354361.22070038, 46328316.02462142, 1, 2, 138354468.5044916, 46328266.89023282, 32 },
-  { 138354367.61041814, 46328334.77957433, 138354331.01171514, 46328350.92066904, 138354404.20912114, 46328318.63847961, 138354365.78048298, 46328335.58662906, 138354369.4403533, 46328333.97251959, 0, 0, 0, 0, 0 },
-  { 138354375.55204448, 46328352.78660724, 138354338.71646455, 46328368.379556015, 138354412.3876244, 46328337.19365847, 138354373.7102655, 46328353.56625468, 138354377.39382347, 46328352.0069598, 0, 0, 0, 0, 0 },
-  { 138354383.2122703, 46328370.88253407, 138354346.13562617, 46328385.89327891, 138354420.2889144, 46328355.87178923, 138354381.35843807, 46328371.63307131, 138354385.0661025, 46328370.13199683, 1, 1, 138354078.2568724, 46328494.345910355, 30 },
-  { 138354390.5761558, 46328389.071382515, 138354353.2557551, 46328403.4653983, 138354427.89655653, 46328374.67736673, 138354388.7101358, 46328389.791083306, 138354392.44217584, 46328388.351681724, 0, 0, 0, 0, 0 },
-  { 138354397.62876123, 46328407.3571802, 138354360.0635286, 46328421.09957074, 138354435.19399387, 46328393.614789665, 138354395.7504996, 46328408.04429973, 138354399.50702286, 46328406.67006067, 0, 0, 0, 0, 0 },
-  { 138354404.35514677, 46328425.74395481, 138354366.54574463, 46328438.799570836, 138354442.1645489, 46328412.68833878, 138354402.46467665, 46328426.39673561, 138354406.24561688, 46328425.09117401, 1, 3, 138354721.00888968, 46328316.40317054, 37 },
-  { 138354410.74037254, 46328444.23573401, 138354372.6893177, 46328456.569315195, 138354448.79142737, 46328431.90215282, 138354408.83781978, 46328444.852413066, 138354412.6429253, 46328443.61905495, 0, 0, 0, 0, 0 },
-  { 138354416.7694989, 46328462.83654548, 138354378.48127136, 46328474.41288475, 138354455.05772647, 46328451.260206215, 138354414.85508755, 46328463.41536245, 138354418.68391028, 46328462.25772852, 1, 0, 138354666.6001837, 46328387.30093177, 43 },
-  { 138354422.42758596, 46328481.55041688, 138354383.9087275, 46328492.334550686, 138354460.94644442, 46328470.76628307, 138354420.50164303, 46328482.08962357, 138354424.3535289, 46328481.01121019, 0, 0, 0, 0, 0 },
-  { 138354427.69969395, 46328500.381375864, 138354388.9602089, 46328510.34392066, 138354466.439179, 46328490.418831065, 138354425.7627197, 46328500.8795031, 138354429.6366682, 46328499.88324863, 0, 0, 0, 0, 0 },
-  { 138354432.57345548, 46328519.333060995, 138354393.64202908, 46328528.516962074, 138354471.5048819, 46328510.149159916, 138354430.62688416, 46328519.79225605, 138354434.5200268, 46328518.87386594, 0, 0, 0, 0, 0 },
-  { 138354437.07221052, 46328538.403709635, 138354397.986343, 46328546.90635396, 138354476.15807804, 46328529.90106531, 138354435.11791715, 46328538.82884185, 138354439.0265039, 46328537.97857742, 0, 0, 0, 0, 0 },
-  { 138354441.2454287, 46328557.58760668, 138354402.0377086, 46328565.50939213, 138354480.4531488, 46328549.66582124, 138354439.2850427, 46328557.983695954, 138354443.20581472, 46328557.19151741, 0, 0, 0, 0, 0 },
-  { 138354445.1431778, 46328576.87894657, 138354405.84162936, 46328584.321277425, 138354484.44472626, 46328569.43661572, 138354443.17810038, 46328577.251063116, 138354447.10825524, 46328576.50683003, 1, 1, 138354645.58107495, 46328538.92305923, 50 },
-  { 138354448.81552553, 46328596.27192371, 138354409.44433406, 46328603.33657394, 138354488.186717, 46328589.20727348, 138354446.84696597, 46328596.625156224, 138354450.7840851, 46328595.9186912, 0, 0, 0, 0, 0 },
-  { 138354452.3125398, 46328615.76073253, 138354412.8928169, 46328622.54935885, 138354491.73226267, 46328608.97210621, 138354450.34155363, 46328616.10016385, 138354454.28352594, 46328615.421301216, 0, 0, 0, 0, 0 },
-  { 138354455.68428835, 46328635.33956746, 138354416.2348529, 46328641.95334427, 138354495.1337238, 46328628.72579065, 138354453.71181658, 46328635.6702563, 138354457.65676013, 46328635.00887862, 1, 0, 138354100.63936943, 46328694.863558784, 30 },
-  { 138354458.98083895, 46328655.002622895, 138354419.51897863, 46328661.54185666, 138354498.44269928, 46328648.46338913, 138354457.00774595, 46328655.32958458, 138354460.95393196, 46328654.675661206, 0, 0, 0, 0, 0 },
-  { 138354462.2522017, 46328674.74408874, 138354422.78491616, 46328681.25049879, 138354501.71948725, 46328668.23767869, 138354460.27883744, 46328675.069409244, 138354464.22556597, 46328674.418768235, 0, 0, 0, 0, 0 },
-  { 138354465.51827398, 46328694.55578307, 138354426.0276642, 46328700.91909513, 138354505.00888374, 46328688.19247101, 138354463.5437435, 46328694.87394867, 138354467.49280447, 46328694.23761747, 0, 0, 0, 0, 0 },
-  { 138354468.71961865, 46328714.42327533, 138354429.1852056, 46328720.50851857, 138354508.2540317, 46328708.33803209, 138354466.742898, 46328714.72753749, 138354470.6963393, 46328714.11901317, 0, 0, 0, 0, 0 },
-  { 138354471.78388736, 46328734.33111795, 138354432.18794292, 46328740.002201185, 138354511.3798318, 46328728.660034716, 138354469.80409014, 46328734.61467211, 138354473.76368457, 46328734.04756379, 1, 2, 138354627.19796923, 46328712.072116256, 36 },
-  { 138354474.63873172, 46328754.26386343, 138354434.9675879, 46328759.3824909, 138354514.30987555, 46328749.145235956, 138354472.65517452, 46328754.5197948, 138354476.6222889, 46328754.00793206, 0, 0, 0, 0, 0 },
-  { 138354477.2118034, 46328774.20606426, 138354437.45728996, 46328778.630842224, 138354516.96631685, 46328769.7812863, 138354475.22407773, 46328774.42730316, 138354479.19952908, 46328773.984825365, 0, 0, 0, 0, 0 },
-  { 138354479.4307539, 46328794.142272905, 138354439.59180346, 46328797.72808217, 138354519.2697043, 46328790.55646364, 138354477.43880635, 46328794.32156337, 138354481.42270142, 46328793.96298244, 1, 3, 138354360.90987635, 46328804.81005549, 36 },
-  { 138354481.22323492, 46328814.057041846, 138354441.3076763, 46328816.65476775, 138354521.13879356, 46328811.45931594, 138354479.227457, 46328814.18692814, 138354483.21901286, 46328813.927155554, 0, 0, 0, 0, 0 },
-  { 138354482.5168981, 46328833.93492355, 138354442.5434331, 46328835.3916653, 138354522.4903631, 46328832.4781818, 138354480.51822484, 46328834.00776064, 138354484.51557136, 46328833.86208647, 0, 0, 0, 0, 0 },
-  { 138354483.23939493, 46328853.76047051, 138354443.23971453, 46328853.920370206, 138354523.23907533, 46328853.60057081, 138354481.2394109, 46328853.7684655, 138354485.23937896, 46328853.75247552, 0, 0, 0, 0, 0 },
-  { 138354483.31837708, 46328873.51823517, 138354443.33931804, 46328872.224080086, 138354523.29743612, 46328874.81239025, 138354481.31942412, 46328873.45352741, 138354485.31733003, 46328873.582942925, 0, 0, 0, 0, 0 },
-  { 138354482.68149617, 46328893.19277006, 138354442.78706908, 46328890.2885169, 138354522.57592326, 46328896.09702321, 138354480.68677482, 46328893.0475574, 138354484.67621753, 46328893.337982714, 1, 1, 138354763.93720722, 46328913.6677548, 45 },
-  { 138354481.25640374, 46328912.76862759, 138354441.52944154, 46328908.10295781, 138354520.98336595, 46328917.434297375, 138354479.27005562, 46328912.5353441, 138354483.24275187, 46328913.00191108, 0, 0, 0, 0, 0 },
-  { 138354478.97075155, 46328932.2303603, 138354439.51384795, 46328925.66128434, 138354518.42765516, 46328938.79943626, 138354476.9979064, 46328931.901906505, 138354480.94359672, 46328932.55881409, 0, 0, 0, 0, 0 },
-  { 138354475.7521911, 46328951.562520646, 138354436.68755764, 46328942.96284553, 138354514.81682456, 46328960.162195764, 138354473.79895943, 46328951.13253689, 138354477.70542276, 46328951.9925044, 0, 0, 0, 0, 0 },
-  { 138354471.5283736, 46328970.749510854, 138354433.0001982, 46328959.99871097, 138354510.056549, 46328981.50031074, 138354469.60196483, 46328970.21197086, 138354473.45478237, 46328971.28705085, 0, 0, 0, 0, 0 },
-  { 138354466.22688106, 46328989.74873294, 138354428.41178852, 46328976.70960812, 138354504.0419736, 46329002.787857756, 138354464.33612642, 46328989.0967767, 138354468.1176357, 46328990.40068918, 0, 0, 0, 0, 0 },
-  { 138354459.7751461, 46329008.45957113, 138354422.88332325, 46328993.00015955, 138354496.66696894, 46329023.918982714, 138354457.93055496, 46329007.68660055, 138354461.61973724, 46329009.23254171, 1, 3, 138354552.00470322, 46329047.108100094, 33 },
-  { 138354452.10058254, 46329026.77389297, 138354416.38697723, 46329008.758943744, 138354487.81418785, 46329044.788842194, 138354450.31490228, 46329025.873145506, 138354453.8862628, 46329027.67464043, 0, 0, 0, 0, 0 },
-  { 138354443.1281241, 46329044.56127809, 138354408.97076634, 46329023.74602141, 138354477.28548184, 46329065.37653477, 138354441.4202562, 46329043.520515256, 138354444.83599198, 46329045.602040924, 0, 0, 0, 0, 0 },
-  { 138354432.76826984, 46329061.561560795, 138354400.68357438, 46329037.674905166, 138354464.8529653, 46329085.44821642, 138354431.16403505, 46329060.367228016, 138354434.37250462, 46329062.75589357, 0, 0, 0, 0, 0 },
-  { 138354420.92630935, 46329077.46775135, 138354391.56395438, 46329050.30431802, 138354450.2886643, 46329104.631184675, 138354419.4581916, 46329076.10957968, 138354422.3944271, 46329078.82592301, 0, 0, 0, 0, 0 },
-  { 138354407.50753006, 46329091.972801425, 138354381.5076225, 46329061.57535404, 138354433.50743762, 46329122.37024881, 138354406.2075347, 46329090.45292906, 138354408.80752543, 46329093.49267379, 0, 0, 0, 0, 0 },
-  { 138354392.47998527, 46329104.82634042, 138354370.03618574, 46329071.716283605, 138354414.9237848, 46329137.93639724, 138354391.3577953, 46329103.17083758, 138354393.60217524, 46329106.48184326, 0, 0, 0, 0, 0 },
-  { 138354376.03122592, 46329115.97620523, 138354357.15745562, 46329080.70892869, 138354394.90499622, 46329151.24348177, 138354375.0875374, 46329114.2128414, 138354376.97491443, 46329117.73956906, 0, 0, 0, 0, 0 },
-  { 138354358.39675656, 46329125.41353515, 138354343.05903685, 46329088.47095329, 138354373.73447627, 46329162.356117, 138354357.62987056, 46329123.56640606, 138354359.16364256, 46329127.26066424, 0, 0, 0, 0, 0 },
-  { 138354339.81208178, 46329133.1294694, 138354327.9629451, 46329094.92478435, 138354351.66121846, 46329171.33415446, 138354339.21962494, 46329131.21923515, 138354340.40453863, 46329135.03970365, 0, 0, 0, 0, 0 },
-  { 138354320.51270622, 46329139.1151473, 138354312.1178397, 46329100.005989596, 138354328.90757275, 46329178.224305004, 138354320.0929629, 46329137.15968941, 138354320.93244955, 46329141.07060519, 1, 4, 138354369.41280374, 46329366.9259909, 48 },
-  { 138354300.73433942, 46329143.36061714, 138354295.98552874, 46329103.64350751, 138354305.4831501, 46329183.07772677, 138354300.4968989, 46329141.374761656, 138354300.97177994, 46329145.34647262, 1, 3, 138354267.01778367, 46328861.36913878, 29 },
-  { 138354280.73218378, 46329145.75219223, 138354280.25832605, 46329105.75499909, 138354281.2060415, 46329185.749385364, 138354280.7084909, 46329143.752332576, 138354280.75587666, 46329147.75205188, 0, 0, 0, 0, 0 },
-  { 138354260.7967336, 46329145.98837299, 138354265.34543335, 46329106.247847944, 138354256.24803382, 46329185.72889803, 138354261.02416858, 46329144.00134674, 138354260.5692986, 46329147.97539924, 0, 0, 0, 0, 0 },
-  { 138354241.22220132, 46329143.74787239, 138354251.47661862, 46329105.08462206, 138354230.96778402, 46329182.41112272, 138354241.73492217, 46329141.81470987, 138354240.70948046, 46329145.68103491, 0, 0, 0, 0, 0 },
-  { 138354222.2969646, 46329138.72844766, 138354238.0096269, 46329101.94377364, 138354206.58430228, 46329175.51312168, 138354223.0825977, 46329136.88921396, 138354221.51133147, 46329140.567681365, 0, 0, 0, 0, 0 },
-  { 138354204.19638035, 46329130.9967394, 138354224.36345914, 46329096.45272497, 138354184.02930155, 46329165.540753834, 138354205.2047343, 46329129.26953868, 138354203.1880264, 46329132.72394013, 1, 3, 138354128.5698349, 46329260.53679353, 49 },
-  { 138354186.9934331, 46329120.95351778, 138354210.69373882, 46329088.730924636, 138354163.29312736, 46329153.17611092, 138354188.17844838, 46329119.34238812, 138354185.8084178, 46329122.564647436, 0, 0, 0, 0, 0 },
-  { 138354170.75740835, 46329109.011625074, 138354197.24014333, 46329079.03388754, 138354144.27467337, 46329138.989362605, 138354172.0815451, 46329107.5127382, 138354169.4332716, 46329110.51051195, 0, 0, 0, 0, 0 },
-  { 138354155.55759192, 46329095.58390358, 138354184.2929463, 46329067.758027, 138354126.82223752, 46329123.40978016, 138354156.99435964, 46329094.19260975, 138354154.1208242, 46329096.97519741, 1, 1, 138354314.32042497, 46328941.845935464, 30 },
-  { 138354141.48059985, 46329081.046810575, 138354172.38082668, 46329055.64649598, 138354110.58037302, 46329106.44712517, 138354143.0256112, 46329079.77679484, 138354139.9355885, 46329082.31682631, 0, 0, 0, 0, 0 },
-  { 138354128.7287736, 46329065.53384035, 138354161.81741303, 46329043.05847737, 138354095.64013416, 46329088.00920333, 138354130.38320556, 46329064.4100722, 138354127.07434162, 46329066.6576085, 1, 4, 138354292.51753876, 46328954.2807936, 29 },
-  { 138354117.5518532, 46329049.07897425, 138354152.76834294, 46329030.11060979, 138354082.33536348, 46329068.0473387, 138354119.3126777, 46329048.130556025, 138354115.7910287, 46329050.02739247, 1, 2, 138353946.75187793, 46329141.07554184, 30 },
-  { 138354108.1997217, 46329031.7158935, 138354145.35035074, 46329016.88920263, 138354071.04909265, 46329046.54258437, 138354110.05725315, 46329030.97455896, 138354106.34219024, 46329032.45722804, 1, 4, 138354224.29543743, 46328985.38248453, 25 },
-  { 138354100.9213013, 46329013.478655115, 138354139.55370238, 46329003.10862203, 138354062.28890023, 46329023.8486882, 138354102.85292137, 46329012.96015346, 138354098.98968124, 46329013.99715677, 0, 0, 0, 0, 0 },
-  { 138354095.8160846, 46328994.45973993, 138354135.31099054, 46328988.1231475, 138354056.32117864, 46329000.79633236, 138354097.7908299, 46328994.14291031, 138354093.8413393, 46328994.77656955, 0, 0, 0, 0, 0 },
-  { 138354092.67354748, 46328974.872839026, 138354132.5710921, 46328972.011732176, 138354052.77600285, 46328977.73394588, 138354094.6684247, 46328974.729783684, 138354090.67867026, 46328975.01589437, 0, 0, 0, 0, 0 },
-  { 138354091.24461818, 46328954.946714826, 138354131.24455503, 46328955.01779829, 138354051.24468133, 46328954.87563136, 138354093.24461502, 46328954.950269, 138354089.24462134, 46328954.94316065, 0, 0, 0, 0, 0 },
-  { 138354091.28022498, 46328934.91012978, 138354131.19935495, 46328937.45238518, 138354051.361095, 46328932.36787438, 138354093.2761815, 46328935.03724255, 138354089.28426847, 46328934.78301701, 0, 0, 0, 0, 0 },
-  { 138354092.54905045, 46328914.986715004, 138354132.22137213, 46328920.09620551, 138354052.87672877, 46328909.8772245, 138354094.53266653, 46328915.24218953, 138354090.56543437, 46328914.73124048, 0, 0, 0, 0, 0 },
-  { 138354095.0813941, 46328895.32448998, 138354134.23961452, 46328903.48744131, 138354055.9231737, 46328887.16153865, 138354097.03930512, 46328895.73263755, 138354093.1234831, 46328894.916342415, 0, 0, 0, 0, 0 },
-  { 138354099.10690224, 46328876.01385973, 138354137.3733931, 46328887.66185002, 138354060.8404114, 46328864.36586943, 138354101.02022678, 46328876.596259244, 138354097.1935777, 46328875.43146021, 0, 0, 0, 0, 0 },
-  { 138354104.85045177, 46328857.144897796, 138354141.87402523, 46328872.28606715, 138354067.8268783, 46328842.00372844, 138354106.70163044, 46328857.90195626, 138354102.9992731, 46328856.38783933, 1, 4, 138353928.06288856, 46328784.84581413, 34 },
-  { 138354112.34047145, 46328838.83011066, 138354147.8975182, 46328857.152130954, 138354076.7834247, 46328820.50809037, 138354114.11832377, 46328839.74621168, 138354110.56261912, 46328837.914009646, 0, 0, 0, 0, 0 },
-  { 138354121.42358145, 46328821.20276599, 138354155.36999768, 46328842.36029004, 138354087.47716522, 46328800.04524193, 138354123.12090227, 46328822.260642186, 138354119.72626063, 46328820.14488979, 0, 0, 0, 0, 0 },
-  { 138354131.9192013, 46328804.3629562, 138354164.4255138, 46328827.67260331, 138354099.41288882, 46328781.0533091, 138354133.54451695, 46328805.52843856, 138354130.29388568, 46328803.19747385, 1, 1, 138354367.5899669, 46328973.3578977, 47 },
-  { 138354143.51537406, 46328788.19159104, 138354174.9780682, 46328812.891770735, 138354112.05267993, 46328763.49141134, 138354145.08850878, 46328789.426600024, 138354141.94223934, 46328786.956582054, 0, 0, 0, 0, 0 },
-  { 138354155.84796667, 46328772.482531674, 138354186.74611002, 46328797.885380656, 138354124.94982332, 46328747.07968269, 138354157.39287385, 46328773.752674125, 138354154.3030595, 46328771.21238922, 0, 0, 0, 0, 0 },
-  { 138354168.55271372, 46328757.02941868, 138354199.4029968, 46328782.49036982, 138354137.70243064, 46328731.568467535, 138354170.09522787, 46328758.302466236, 138354167.01019958, 46328755.75637112, 1, 2, 138353903.2402791, 46328538.06523886, 26 },
-  { 138354181.2653499, 46328741.6258926, 138354212.59022275, 46328766.500625566, 138354149.94047704, 46328716.75115964, 138354182.83159354, 46328742.86962925, 138354179.69910625, 46328740.382155955, 0, 0, 0, 0, 0 },
-  { 138354193.62160987, 46328726.065593995, 138354225.91796473, 46328749.665286005, 138354161.325255, 46328702.465901986, 138354195.2364276, 46328727.245578595, 138354192.00679213, 46328724.885609396, 0, 0, 0, 0, 0 },
-  { 138354205.25722817, 46328710.14216341, 138354238.95249757, 46328731.697413795, 138354171.56195876, 46328688.58691303, 138354206.94199163, 46328711.21992593, 138354203.5724647, 46328709.06440089, 0, 0, 0, 0, 0 },
-  { 138354215.80793956, 46328693.649241425, 138354251.19392735, 46328712.2994926, 138354180.42195177, 46328674.99899025, 138354217.57723895, 46328694.581753984, 138354214.03864017, 46328692.716728866, 0, 0, 0, 0, 0 },
-  { 138354224.90947866, 46328676.38046855, 138354262.03491813, 46328691.27012078, 138354187.7840392, 46328661.49081632, 138354226.76575065, 46328677.12495116, 138354223.05320668, 46328675.63598593, 0, 0, 0, 0, 0 },
-  { 138354232.21898323, 46328658.15515574, 138354270.68673354, 46328669.1201996, 138354193.75123292, 46328647.19011188, 138354234.14237076, 46328658.703407936, 138354230.2955957, 46328657.606903546, 0, 0, 0, 0, 0 },
-  { 138354237.65038845, 46328639.100609094, 138354276.97595283, 46328646.41497759, 138354198.32482406, 46328631.7862406, 138354239.61666667, 46328639.46632752, 138354235.68411022, 46328638.73489067, 0, 0, 0, 0, 0 },
-  { 138354241.28717676, 46328619.54748528, 138354281.09675124, 46328623.44591823, 138354201.47760227, 46328615.64905232, 138354243.27765548, 46328619.74240693, 138354239.29669803, 46328619.35256363, 0, 0, 0, 0, 0 },
-  { 138354243.2202566, 46328599.80748034, 138354283.21383053, 46328600.52444956, 138354203.22668266, 46328599.09051113, 138354245.2199353, 46328599.843328804, 138354241.2205779, 46328599.77163188, 0, 0, 0, 0, 0 },
-  { 138354243.57505938, 46328580.01607061, 138354283.51542953, 46328577.83276303, 138354203.63468924, 46328582.19937819, 138354245.5720779, 46328579.906905234, 138354241.57804087, 46328580.12523599, 0, 0, 0, 0, 0 },
-  { 138354242.4932456, 46328560.22589384, 138354282.2063493, 46328555.443698436, 138354202.7801419, 46328565.008089244, 138354244.4789008, 46328559.98678407, 138354240.5075904, 46328560.46500361, 0, 0, 0, 0, 0 },
-  { 138354240.11656982, 46328540.48910687, 138354279.48524478, 46328533.41044663, 138354200.74789485, 46328547.56776711, 138354242.08500355, 46328540.13517386, 138354238.14813608, 46328540.843039885, 1, 0, 138354065.91018307, 46328571.81217844, 31 },
-  { 138354236.5867868, 46328520.85786659, 138354275.54162538, 46328511.773784295, 138354197.63194823, 46328529.94194889, 138354238.53452873, 46328520.40366248, 138354234.63904488, 46328521.312070705, 0, 0, 0, 0, 0 },
-  { 138354232.04565105, 46328501.384329855, 138354270.55542487, 46328490.567799896, 138354193.53587723, 46328512.200859815, 138354233.97113973, 46328500.843503356, 138354230.12016237, 46328501.925156355, 1, 0, 138353886.42043102, 46328598.46268626, 41 },
-  { 138354226.63491732, 46328482.12065353, 138354264.68920386, 46328469.79704705, 138354188.58063078, 46328494.444260016, 138354228.53763163, 46328481.50447321, 138354224.732203, 46328482.736833856, 0, 0, 0, 0, 0 },
-  { 138354220.48087087, 46328463.11746262, 138354258.02845958, 46328449.32693756, 138354182.93328217, 46328476.90798768, 138354222.35825032, 46328462.42793637, 138354218.60349143, 46328463.80698887, 1, 1, 138353872.22698548, 46328591.0245825, 43 },
-  { 138354213.6120658, 46328444.41570419, 138354250.57663167, 46328429.13104294, 138354176.64749992, 46328459.70036544, 138354215.4602941, 46328443.65147113, 138354211.7638375, 46328445.17993725, 0, 0, 0, 0, 0 },
-  { 138354206.01899698, 46328426.052556485, 138354242.31810516, 46328409.248546705, 138354169.7198888, 46328442.856566265, 138354207.8339524, 46328425.21235599, 138354204.20404157, 46328426.892756976, 1, 4, 138354001.83651343, 46328520.57511149, 47 },
-  { 138354197.69207352, 46328408.06518921, 138354233.23714533, 46328389.71994816, 138354162.1470017, 46328426.41043027, 138354199.46932712, 46328407.14792716, 138354195.91481993, 46328408.98245127, 0, 0, 0, 0, 0 },
-  { 138354188.62170452, 46328390.490772136, 138354223.3181339, 46328370.587059185, 138354153.92527515, 46328410.394485086, 138354190.356526, 46328389.495586485, 138354186.88688305, 46328391.48595779, 0, 0, 0, 0, 0 },
-  { 138354178.798299, 46328373.36647497, 138354212.54581848, 46328351.89312103, 138354145.05077955, 46328394.839828916, 138354180.48567498, 46328372.29280727, 138354177.11092305, 46328374.44014267, 1, 3, 138354483.36966226, 46328179.569455646, 48 },
-  { 138354168.21226612, 46328356.72946744, 138354200.93972158, 46328333.73134452, 138354135.48481065, 46328379.72759035, 138354169.8486389, 46328355.57956129, 138354166.57589334, 46328357.87937358, 0, 0, 0, 0, 0 },
-  { 138354156.87636903, 46328340.59793059, 138354188.731827, 46328316.406407304, 138354125.02091107, 46328364.78945387, 138354158.46914193, 46328339.38835442, 138354155.28359613, 46328341.807506755, 1, 0, 138354440.38994476, 46328125.29337334, 39 },
-  { 138354144.93718192, 46328324.87637935, 138354176.18475038, 46328299.904605985, 138354113.68961346, 46328349.84815271, 138354146.49956036, 46328323.62779068, 138354143.37480348, 46328326.124968015, 0, 0, 0, 0, 0 },
-  { 138354132.5908493, 46328309.4272213, 138354163.5221314, 46328284.06473348, 138354101.6595672, 46328334.78970911, 138354134.1374134, 46328308.159096904, 138354131.0442852, 46328310.69534569, 1, 0, 138354429.53115737, 46328065.94733826, 32 },
-  { 138354120.0335962, 46328294.112795465, 138354150.92150518, 46328268.69750325, 138354089.1456872, 46328319.52808768, 138354121.57799163, 46328292.84203085, 138354118.48920074, 46328295.38356008, 1, 4, 138353982.5824012, 46328407.21084583, 41 },
-  { 138354107.44179085, 46328278.80962547, 138354138.37951335, 46328253.4549942, 138354076.50406834, 46328304.16425674, 138354108.98867697, 46328277.54189391, 138354105.89490473, 46328280.07735703, 0, 0, 0, 0, 0 },
-  { 138354094.87605724, 46328263.47691661, 138354125.8908141, 46328238.216575034, 138354063.86130038, 46328288.73725819, 138354096.4267951, 46328262.21389953, 138354093.32531938, 46328264.73993369, 0, 0, 0, 0, 0 },
-  { 138354082.35519677, 46328248.10374987, 138354113.4738396, 46328222.97149832, 138354051.23655394, 46328273.236001424, 138354083.9111289, 46328246.847137295, 138354080.79926464, 46328249.36036245, 0, 0, 0, 0, 0 },
-  { 138354069.897954, 46328232.67924689, 138354101.14696714, 46328207.70928141, 138354038.64894083, 46328257.64921237, 138354071.46040463, 46328231.43074861, 138354068.33550334, 46328233.92774516, 0, 0, 0, 0, 0 },
-  { 138354057.5230735, 46328217.192529306, 138354088.9284798, 46328192.41955097, 138354026.1176672, 46328241.96550764, 138354059.0933438, 46328215.95388039, 138354055.9528032, 46328218.43117822, 0, 0, 0, 0, 0 },
-  { 138354045.24929982, 46328201.63271879, 138354076.83655822, 46328177.09203608, 138354013.66204143, 46328226.17340149, 138354046.82866275, 46328200.40568465, 138354043.6699369, 46328202.85975292, 0, 0, 0, 0, 0 },
-  { 138354033.09537748, 46328185.988936976, 138354064.88927102, 46328161.71655901, 138354001.30148393, 46328210.26131494, 138354034.68507215, 46328184.77531808, 138354031.5056828, 46328187.20255587, 0, 0, 0, 0, 0 },
-  { 138354021.08005098, 46328170.2503055, 138354053.1045637, 46328146.28302398, 138353989.05553824, 46328194.217587024, 138354022.68127662, 46328169.051941425, 138354019.47882533, 46328171.44866958, 0, 0, 0, 0, 0 },
-  { 138354009.22206497, 46328154.40594604, 138354041.50024623, 46328130.7814034, 138353976.94388372, 46328178.03048868, 138354010.83597404, 46328153.224718906, 138354007.6081559, 46328155.58717317, 0, 0, 0, 0, 0 },
-  { 138353997.540164, 46328138.444980234, 138354030.09398, 46328115.20172181, 138353964.98634797, 46328161.68823866, 138353999.1678548, 46328137.28281731, 138353995.9124732, 46328139.607143156, 1, 0, 138353685.83737555, 46328360.99917964, 49 },
-  { 138353986.05309248, 46328122.35652973, 138354018.90326488, 46328099.534037024, 138353953.20292008, 46328145.17902243, 138353987.6956011, 46328121.21540509, 138353984.41058385, 46328123.49765436, 0, 0, 0, 0, 0 },
-  { 138353974.77959505, 46328106.12971616, 138354007.9454254, 46328083.76841707, 138353941.6137647, 46328128.49101525, 138353976.43788657, 46328105.0116512, 138353973.12130353, 46328107.24778111, 1, 1, 138353784.07607052, 46328234.70718591, 47 },
-  { 138353963.73841625, 46328089.7536612, 138353997.23759845, 46328067.89491486, 138353930.23923406, 46328111.61240754, 138353965.41337538, 46328088.66072388, 138353962.06345713, 46328090.84659852, 0, 0, 0, 0, 0 },
-  { 138353952.94830066, 46328073.21748649, 138353986.79672185, 46328051.90353842, 138353919.09987947, 46328094.531434566, 138353954.6407217, 46328072.15178909, 138353951.2558796, 46328074.283183895, 0, 0, 0, 0, 0 },
-  { 138353942.42799273, 46328056.510313675, 138353976.6395255, 46328035.784218386, 138353908.21645996, 46328077.236408964, 138353944.13856936, 46328055.47400891, 138353940.7174161, 46328057.54661844, 0, 0, 0, 0, 0 },
-  { 138353932.19623706, 46328039.621264406, 138353966.78252548, 46328019.526771285, 138353897.60994864, 46328059.71575753, 138353933.92555147, 46328038.61653975, 138353930.46692264, 46328040.625989065, 0, 0, 0, 0, 0 },
-  { 138353922.27177826, 46328022.53946033, 138353957.2418757, 46328003.1205962, 138353887.3016808, 46328041.95832446, 138353924.02028313, 46328021.568517126, 138353920.52327338, 46328023.510403536, 0, 0, 0, 0, 0 },
-  { 138353912.67323503, 46328005.25410369, 138353948.00570953, 46327986.50267051, 138353877.34076053, 46328024.00553687, 138353914.43985876, 46328004.31653203, 138353910.9066113, 46328006.19167535, 0, 0, 0, 0, 0 },
-  { 138353903.39436015, 46327987.77034089, 138353939.00924122, 46327969.56099586, 138353867.7794791, 46328005.97968592, 138353905.1751042, 46327986.85987364, 138353901.6136161, 46327988.68080814, 0, 0, 0, 0, 0 },
-  { 138353894.3742776, 46327970.128346235, 138353930.1902283, 46327952.31774058, 138353858.55832687, 46327987.93895189, 138353896.16507512, 46327969.237815954, 138353892.58348006, 46327971.018876515, 0, 0, 0, 0, 0 },
-  { 138353885.54484957, 46327952.3729501, 138353921.48581448, 46327934.81598448, 138353849.60388467, 46327969.92991572, 138353887.34189782, 46327951.49510182, 138353883.74780133, 46327953.25079838, 0, 0, 0, 0, 0 },
-  { 138353876.83793867, 46327934.548982896, 138353912.8312175, 46327917.09951644, 138353840.84465984, 46327951.998449355, 138353878.6376026, 46327933.676509574, 138353875.03827474, 46327935.42145622, 0, 0, 0, 0, 0 },
-  { 138353868.18540713, 46327916.70127501, 138353904.15966693, 46327899.21263204, 138353832.21114734, 46327934.18991799, 138353869.98412013, 46327915.82684287, 138353866.38669413, 46327917.57570716, 0, 0, 0, 0, 0 },
-  { 138353859.51911733, 46327898.87465683, 138353895.402375, 46327881.20004742, 138353823.63585964, 46327916.54926625, 138353861.3132802, 46327897.99092636, 138353857.72495446, 46327899.758387305, 0, 0, 0, 0, 0 },
-  { 138353850.77093163, 46327881.11395875, 138353886.4885331, 46327863.10693388, 138353815.05333015, 46327899.12098363, 138353852.5568117, 46327880.21360751, 138353848.98505157, 46327882.014309995, 1, 1, 138354202.58930618, 46327703.74476375, 32 },
-  { 138353841.8727125, 46327863.46401118, 138353877.34533665, 46327844.979073115, 138353806.40008834, 46327881.94894924, 138353843.6463437, 46327862.53976428, 138353840.09908128, 46327864.38825808, 0, 0, 0, 0, 0 },
-  { 138353832.75632226, 46327845.96964451, 138353867.89805377, 46327826.86313498, 138353797.61459076, 46327865.07615404, 138353834.51340884, 46327845.01431903, 138353830.9992357, 46327846.924969986, 1, 2, 138354124.4326938, 46327687.385615416, 25 },
-  { 138353823.35362327, 46327828.675689116, 138353858.07016322, 46327808.80707432, 138353788.63708332, 46327848.54430391, 138353825.08945027, 46327827.682258375, 138353821.61779627, 46327829.66911986, 0, 0, 0, 0, 0 },
-  { 138353813.59647796, 46327811.62697542, 138353847.78359804, 46327790.86063679, 138353779.40935788, 46327832.39331404, 138353815.30583397, 46327810.58865849, 138353811.88712195, 46327812.665292345, 0, 0, 0, 0, 0 },
-  { 138353803.41674867, 46327794.868333764, 138353836.98253348, 46327773.1119993, 138353769.85096386, 46327816.624668226, 138353805.0950379, 46327793.78051704, 138353801.73845944, 46327795.95615049, 0, 0, 0, 0, 0 },
-  { 138353792.7637784, 46327778.43287636, 138353825.7031208, 46327755.739271045, 138353759.82443598, 46327801.12648168, 138353794.4107455, 46327777.2981961, 138353791.11681128, 46327779.56755663, 0, 0, 0, 0, 0 },
-  { 138353781.6547069, 46327762.30826749, 138353813.99084005, 46327738.763108894, 138353749.31857374, 46327785.853426084, 138353783.27151355, 46327761.13100956, 138353780.03790024, 46327763.48552542, 1, 1, 138353458.29337546, 46327997.75985346, 34 },
-  { 138353770.12310773, 46327746.47115497, 138353801.88579157, 46327722.157950446, 138353738.3604239, 46327770.7843595, 138353771.71124193, 46327745.25549474, 138353768.53497353, 46327747.6868152, 1, 1, 138354030.57711533, 46327547.102877825, 49 },
-  { 138353758.20255443, 46327730.89818658, 138353789.4271786, 46327705.89772965, 138353726.97793028, 46327755.89864351, 138353759.76378563, 46327729.648163736, 138353756.64132324, 46327732.14820942, 1, 0, 138353492.79324913, 46327943.402070455, 31 },
-  { 138353745.9266207, 46327715.56601012, 138353776.65334544, 46327689.956082605, 138353715.19989595, 46327741.17593763, 138353747.46295694, 46327714.285513744, 138353744.39028445, 46327716.84650649, 1, 5, 138354006.3356128, 46327498.52187446, 38 },
-  { 138353733.32887995, 46327700.45127339, 138353763.60184148, 46327674.3065263, 138353703.05591843, 46327726.596020475, 138353734.84252802, 46327699.14403603, 138353731.8152319, 46327701.758510746, 1, 5, 138353510.06578866, 46327893.268783145, 34 },
-  { 138353720.44290578, 46327685.530624166, 138353750.30949914, 46327658.92260655, 138353690.57631242, 46327712.13864178, 138353721.93623546, 46327684.20022328, 138353718.9495761, 46327686.86102505, 0, 0, 0, 0, 0 },
-  { 138353707.3022719, 46327670.78071028, 138353736.81251776, 46327643.77801802, 138353677.79202604, 46327697.78340254, 138353708.7777842, 46327669.43057567, 138353705.8267596, 46327672.13084489, 0, 0, 0, 0, 0 },
-  { 138353693.94055182, 46327656.1781795, 138353723.1465475, 46327628.846699186, 138353664.73455614, 46327683.50965982, 138353695.4008516, 46327654.81160548, 138353692.48025203, 46327657.54475352, 0, 0, 0, 0, 0 },
-  { 138353680.39131904, 46327641.699679635, 138353709.3467679, 46327614.10290481, 138353651.43587017, 46327669.29645446, 138353681.83909148, 46327640.31984089, 138353678.9435466, 46327643.07951838, 0, 0, 0, 0, 0 },
-  { 138353666.68814716, 46327627.32185849, 138353695.44795766, 46327599.52125958, 138353637.92833665, 46327655.12245739, 138353668.12613767, 46327625.93182854, 138353665.25015664, 46327628.71188843, 0, 0, 0, 0, 0 },
-  { 138353652.86460975, 46327613.02136382, 138353681.4845535, 46327585.0767969, 138353624.244666, 46327640.96593074, 138353654.29560694, 46327611.62413547, 138353651.43361256, 46327614.41859216, 0, 0, 0, 0, 0 },
-  { 138353638.95428047, 46327598.77484346, 138353667.49069685, 46327570.74498545, 138353610.41786408, 46327626.80470148, 138353640.38110128, 46327597.37335056, 138353637.52745965, 46327600.17633636, 0, 0, 0, 0, 0 },
-  { 138353624.99073282, 46327584.5589452, 138353653.50026774, 46327556.501746155, 138353596.4811979, 46327612.61614425, 138353626.41620958, 46327583.156085245, 138353623.56525606, 46327585.96180516, 1, 3, 138353342.0335987, 46327863.02664574, 45 },
-  { 138353611.00754035, 46327570.35031684, 138353639.54690537, 46327542.32346106, 138353582.46817532, 46327598.37717261, 138353612.4345086, 46327568.94897405, 138353609.5805721, 46327571.751659624, 0, 0, 0, 0, 0 },
-  { 138353597.03827667, 46327556.12560615, 138353625.66401476, 46327528.18697483, 138353568.4125386, 46327584.06423747, 138353598.46956357, 46327554.72867458, 138353595.60698977, 46327557.522537716, 0, 0, 0, 0, 0 },
-  { 138353583.11651534, 46327541.86146096, 138353611.88476077, 46327514.06959065, 138353554.3482699, 46327569.65333127, 138353584.55492762, 46327540.47186745, 138353581.67810306, 46327543.25105447, 0, 0, 0, 0, 0 },
-  { 138353569.27582994, 46327527.53452902, 138353598.242048, 46327499.949057996, 138353540.3096119, 46327555.12000005, 138353570.72414085, 46327526.155255474, 138353567.82751903, 46327528.91380257, 0, 0, 0, 0, 0 },
-  { 138353555.54979408, 46327513.121458195, 138353584.76848835, 46327485.80355371, 138353526.3310998, 46327540.43936268, 138353557.01072878, 46327511.75556297, 138353554.08885938, 46327514.48735342, 1, 1, 138353703.83466747, 46327374.48309293, 49 },
-  { 138353541.9719813, 46327498.59889623, 138353571.49635553, 46327471.61165248, 138353512.44760704, 46327525.58613998, 138353543.4482, 46327497.24953404, 138353540.4957626, 46327499.948258415, 0, 0, 0, 0, 0 },
-  { 138353528.5759651, 46327483.94349092, 138353558.4575286, 46327457.35228631, 138353498.69440162, 46327510.534695536, 138353530.0700433, 46327482.613930695, 138353527.08188692, 46327485.27305115, 1, 2, 138353719.8179715, 46327313.759781376, 36 },
-  { 138353515.39531916, 46327469.13189008, 138353545.68342474, 46327443.00468855, 138353485.1072136, 46327495.25909161, 138353516.90972444, 46327467.82553001, 138353513.88091388, 46327470.438250154, 1, 1, 138353435.13183933, 46327538.368974134, 30 },
-  { 138353502.46361703, 46327454.14074151, 138353533.20492476, 46327428.5483208, 138353471.7223093, 46327479.733162224, 138353504.0006824, 46327452.86112048, 138353500.92655164, 46327455.42036255, 0, 0, 0, 0, 0 },
-  { 138353489.81443226, 46327438.94669301, 138353521.05229387, 46327413.96277815, 138353458.57657066, 46327463.93060787, 138353491.37632534, 46327437.69749727, 138353488.2525392, 46327440.19588875, 0, 0, 0, 0, 0 },
-  { 138353477.4813384, 46327423.52639234, 138353509.25510305, 46327399.22767055, 138353445.70757377, 46327447.82511413, 138353479.07002664, 46327422.31145625, 138353475.8926502, 46327424.74132843, 1, 3, 138353661.76917332, 46327282.59380597, 34 },
-  { 138353465.4979091, 46327407.85648732, 138353497.8421571, 46327384.322477445, 138353433.1536611, 46327431.39049719, 138353467.1151215, 46327406.67978682, 138353463.88069668, 46327409.033187814, 0, 0, 0, 0, 0 },
-  { 138353453.8977179, 46327391.91362576, 138353486.83181992, 46327369.21241602, 138353420.96361586, 46327414.6148355, 138353455.54442298, 46327390.77856527, 138353452.2510128, 46327393.04868625, 0, 0, 0, 0, 0 },
-  { 138353442.70795938, 46327375.67992488, 138353476.20269132, 46327353.8143599, 138353409.21322745, 46327397.54548986, 138353444.38269597, 46327374.58664663, 138353441.0332228, 46327376.773203135, 1, 0, 138353129.53221568, 46327580.12295744, 25 },
-  { 138353431.92578235, 46327359.16326365, 138353465.93993637, 46327338.11481176, 138353397.91162834, 46327380.211715534, 138353433.62649006, 46327358.11084106, 138353430.22507465, 46327360.21568624, 0, 0, 0, 0, 0 },
-  { 138353421.53949776, 46327342.37909892, 138353456.03385922, 46327322.12720946, 138353387.0451363, 46327362.63098838, 138353423.26421583, 46327341.366504446, 138353419.8147797, 46327343.3916934, 1, 0, 138353211.98625183, 46327465.40932739, 42 },
-  { 138353411.5374153, 46327325.34288861, 138353446.4748401, 46327305.86530285, 138353376.5999905, 46327344.820474364, 138353413.28428653, 46327324.36900932, 138353409.79054406, 46327326.316767894, 0, 0, 0, 0, 0 },
-  { 138353401.9078445, 46327308.07009056, 138353437.2532952, 46327289.343128346, 138353366.5623938, 46327326.79705278, 138353403.67511705, 46327307.13374245, 138353400.14057198, 46327309.00643867, 0, 0, 0, 0, 0 },
-  { 138353392.63909507, 46327290.576162666, 138353428.3596433, 46327272.574983984, 138353356.91854683, 46327308.57734135, 138353394.42512247, 46327289.67610373, 138353390.85306767, 46327291.4762216, 1, 4, 138353488.19156158, 46327242.423009686, 32 },
-  { 138353383.71947667, 46327272.876562834, 138353419.78427753, 46327255.57540279, 138353347.6546758, 46327290.17772288, 138353385.5227167, 46327272.01150483, 138353381.91623664, 46327273.74162084, 1, 0, 138353170.93715158, 46327374.953407094, 25 },
-  { 138353375.13729885, 46327254.986748904, 138353411.5175432, 46327238.359126665, 138353338.7570545, 46327271.61437114, 138353376.95631108, 46327254.15536779, 138353373.31828663, 46327255.81813002, 0, 0, 0, 0, 0 },
-  { 138353366.88087142, 46327236.9221788, 138353403.54971963, 46327220.94107841, 138353330.2120232, 46327252.903279185, 138353368.71431383, 46327236.12312378, 138353365.047429, 46327237.721233815, 0, 0, 0, 0, 0 },
-  { 138353358.93850386, 46327218.6983104, 138353395.87100694, 46327203.336337335, 138353322.0060008, 46327234.06028346, 138353360.785129, 46327217.930211745, 138353357.0918787, 46327219.46640905, 1, 3, 138353657.1684662, 46327094.65037793, 26 },
-  { 138353351.2985059, 46327200.33060157, 138353388.47151598, 46327185.56011339, 138353314.12549582, 46327215.10108975, 138353353.1571564, 46327199.592077166, 138353349.4398554, 46327201.06912598, 0, 0, 0, 0, 0 },
-  { 138353343.9491872, 46327181.83451022, 138353381.34126177, 46327167.62772461, 138353306.5571126, 46327196.041295834, 138353345.8187909, 46327181.124170944, 138353342.07958347, 46327182.5448495, 0, 0, 0, 0, 0 },
-  { 138353336.87885734, 46327163.225494206, 138353374.4701593, 46327149.55457547, 138353299.2875554, 46327176.89641294, 138353338.75842243, 46327162.54194827, 138353334.99929225, 46327163.909040146, 0, 0, 0, 0, 0 },
-  { 138353330.075826, 46327144.51901143, 138353367.84802148, 46327131.356137596, 138353292.3036305, 46327157.681885265, 138353331.96443576, 46327143.86086774, 138353328.18721622, 46327145.17715512, 0, 0, 0, 0, 0 },
-  { 138353323.5284029, 46327125.73051979, 138353361.46455887, 46327113.047930524, 138353285.59224692, 46327138.41310905, 138353325.42521068, 46327125.09639032, 138353321.6315951, 46327126.36464925, 0, 0, 0, 0, 0 },
-  { 138353317.22489756, 46327106.87547714, 138353355.30959058, 46327094.646161646, 138353279.14020455, 46327119.10479264, 138353319.1291322, 46327106.26401137, 138353315.32066292, 46327107.48694292, 0, 0, 0, 0, 0 },
-  { 138353311.1538986, 46327087.969093375, 138353349.37911773, 46327076.18636781, 138353272.92867947, 46327099.75181894, 138353313.06515956, 46327087.379957095, 138353309.24263763, 46327088.558229655, 0, 0, 0, 0, 0 },
-  { 138353305.31260625, 46327069.01892103, 138353343.6776572, 46327057.69978388, 138353266.9475553, 46327080.33805819, 138353307.2308588, 46327068.45296417, 138353303.3943537, 46327069.58487789, 1, 4, 138353633.33379182, 46326972.240298316, 27 },
-  { 138353299.70826468, 46327050.02358184, 138353338.21224242, 46327039.186437495, 138353261.20428693, 46327060.860726185, 138353301.63346356, 46327049.48172462, 138353297.7830658, 46327050.56543906, 1, 3, 138353001.30243713, 46327134.01145054, 34 },
-  { 138353294.34868547, 46327030.98119283, 138353332.99001577, 46327020.6444819, 138353255.70735517, 46327041.31790376, 138353296.28075197, 46327030.46435728, 138353292.41661897, 46327031.498028375, 0, 0, 0, 0, 0 },
-  { 138353289.2416803, 46327011.8898711, 138353328.0180901, 46327002.072028026, 138353250.4652705, 46327021.70771417, 138353291.18050078, 46327011.39897894, 138353287.3028598, 46327012.380763255, 0, 0, 0, 0, 0 },
-  { 138353284.39506087, 46326992.74773369, 138353323.30355048, 46326983.46713916, 138353245.48657125, 46327002.02832822, 138353286.34048533, 46326992.28370396, 138353282.4496364, 46326993.21176342, 0, 0, 0, 0, 0 },
-  { 138353279.81663874, 46326973.55289769, 138353318.85345665, 46326964.8278276, 138353240.77982083, 46326982.27796778, 138353281.76847965, 46326973.11664419, 138353277.86479783, 46326973.989151195, 0, 0, 0, 0, 0 },
-  { 138353275.51422563, 46326954.303480186, 138353314.67484573, 46326946.152048804, 138353236.35360554, 46326962.45491157, 138353277.47225663, 46326953.89590862, 138353273.55619463, 46326954.711051755, 1, 1, 138353448.79996955, 46326918.23339632, 44 },
-  { 138353271.49563318, 46326934.997598216, 138353310.7734758, 46326927.43115393, 138353232.21779057, 46326942.5640425, 138353273.45952532, 46326934.619276, 138353269.53174105, 46326935.37592043, 1, 0, 138353069.2147437, 46326973.9647863, 38 },
-  { 138353267.76546207, 46326915.63406782, 138353307.14591888, 46326908.62124944, 138353228.38500527, 46326922.6468862, 138353269.7344849, 46326915.283426896, 138353265.79643923, 46326915.98470874, 0, 0, 0, 0, 0 },
-  { 138353264.3075585, 46326896.2162226, 138353303.77458683, 46326889.708252445, 138353224.8405302, 46326902.72419275, 138353266.28090993, 46326895.890824094, 138353262.3342071, 46326896.541621104, 1, 5, 138353059.07901123, 46326930.05766742, 43 },
-  { 138353261.0975157, 46326876.7491926, 138353300.63696966, 46326870.69678972, 138353221.55806175, 46326882.80159549, 138353263.0744884, 46326876.44657246, 138353259.120543, 46326877.051812746, 1, 4, 138353443.96749026, 46326848.756829254, 49 },
-  { 138353258.11090598, 46326857.23811246, 138353297.71037367, 46326851.59168355, 138353218.51143828, 46326862.88454136, 138353260.09087935, 46326856.95579101, 138353256.1309326, 46326857.5204339, 1, 1, 138352922.50541738, 46326905.091597445, 25 },
-  { 138353255.32330132, 46326837.6881168, 138353294.97192466, 46326832.3978741, 138353215.67467797, 46326842.97835949, 138353257.3057325, 46326837.42360466, 138353253.34087014, 46326837.95262893, 0, 0, 0, 0, 0 },
-  { 138353252.71027413, 46326818.10434028, 138353292.3985622, 46326813.12038703, 138353213.02198607, 46326823.08829352, 138353254.69468853, 46326817.855142616, 138353250.72585973, 46326818.35353794, 0, 0, 0, 0, 0 },
-  { 138353250.24739647, 46326798.4919175, 138353289.96703556, 46326793.764310256, 138353210.52775738, 46326803.21952474, 138353252.2333784, 46326798.25553714, 138353248.26141453, 46326798.72829786, 1, 0, 138353442.88764608, 46326775.56302235, 34 },
-  { 138353247.91024065, 46326778.85598312, 138353287.6539021, 46326774.33476948, 138353208.1665792, 46326783.37719677, 138353249.8974237, 46326778.62992244, 138353245.9230576, 46326779.082043804, 1, 0, 138353043.23038408, 46326802.140233375, 27 },
-  { 138353245.6743787, 46326759.20167174, 138353285.43552643, 46326754.83691177, 138353205.91323096, 46326763.566431716, 138353247.66243607, 46326758.983433746, 138353243.68632132, 46326759.41990974, 0, 0, 0, 0, 0 },
-  { 138353243.5153829, 46326739.534118004, 138353283.28808063, 46326735.27588902, 138353203.74268514, 46326743.79234699, 138353245.50401777, 46326739.321206555, 138353241.526748, 46326739.74702945, 0, 0, 0, 0, 0 },
-  { 138353241.40882546, 46326719.85845657, 138353281.18754438, 46326715.65684724, 138353201.63010654, 46326724.060065895, 138353243.3977614, 46326719.6483761, 138353239.4198895, 46326720.068537034, 0, 0, 0, 0, 0 },
-  { 138353239.33027852, 46326700.17982202, 138353279.10970527, 46326695.98491944, 138353199.55085176, 46326704.374724604, 138353241.31924984, 46326699.97007689, 138353237.3413072, 46326700.38956715, 0, 0, 0, 0, 0 },
-  { 138353237.2553143, 46326680.50334901, 138353277.030159, 46326676.26522103, 138353197.48046958, 46326684.741477, 138353239.24405652, 46326680.29144262, 138353235.26657206, 46326680.71525541, 1, 0, 138353408.2871465, 46326662.27939869, 35 },
-  { 138353235.159505, 46326660.8341722, 138353274.92430907, 46326656.50284936, 138353195.39470094, 46326665.16549503, 138353237.14774522, 46326660.61760605, 138353233.1712648, 46326661.05073834, 1, 3, 138353099.95917118, 46326675.56066984, 40 },
-  { 138353233.01842284, 46326641.17742618, 138353272.7673662, 46326636.7028869, 138353193.26947948, 46326645.65196546, 138353235.00587, 46326640.953699216, 138353231.03097567, 46326641.40115315, 0, 0, 0, 0, 0 },
-  { 138353230.80763993, 46326621.53824561, 138353270.53434747, 46326616.870408155, 138353191.08093238, 46326626.20608307, 138353232.7939753, 46326621.30485374, 138353228.82130456, 46326621.771637484, 1, 5, 138352925.9051594, 46326657.36389806, 35 },
-  { 138353228.5027285, 46326601.92176508, 138353268.20156416, 46326597.02253597, 138353188.80389282, 46326606.82099419, 138353230.48767027, 46326601.676803626, 138353226.5177867, 46326602.16672654, 1, 1, 138353617.55131814, 46326553.90931984, 47 },
-  { 138353226.08511642, 46326582.331665814, 138353265.76215693, 46326577.25894912, 138353186.4080759, 46326587.404382505, 138353228.06896845, 46326582.07802998, 138353224.1012644, 46326582.585301645, 1, 5, 138352937.43464655, 46326619.23567976, 45 },
-  { 138353223.58288178, 46326562.76004943, 138353263.25096497, 46326557.61775649, 138353183.9147986, 46326567.90234237, 138353225.56628594, 46326562.50293478, 138353221.59947762, 46326563.01716408, 0, 0, 0, 0, 0 },
-  { 138353221.04640865, 46326543.19348096, 138353260.71896642, 46326538.08582409, 138353181.37385088, 46326548.301137835, 138353223.03003654, 46326542.93809812, 138353219.06278077, 46326543.448863804, 0, 0, 0, 0, 0 },
-  { 138353218.52621993, 46326523.61849088, 138353258.21639422, 46326518.64958096, 138353178.83604565, 46326528.5874008, 138353220.51072866, 46326523.370045386, 138353216.5417112, 46326523.86693638, 0, 0, 0, 0, 0 },
-  { 138353216.0728385, 46326504.021609694, 138353255.79263547, 46326499.2953293, 138353176.3530415, 46326508.747890085, 138353218.05882832, 46326503.78529567, 138353214.08684865, 46326504.257923715, 1, 1, 138352822.8468482, 46326550.811785534, 41 },
-  { 138353213.7367873, 46326484.389367916, 138353253.49624076, 46326480.00920135, 138353173.9773338, 46326488.76953448, 138353215.72475997, 46326484.17035959, 138353211.7488146, 46326484.60837624, 1, 3, 138353325.06325704, 46326472.124901526, 37 },
-  { 138353211.56858915, 46326464.708296046, 138353251.37510377, 46326460.77874224, 138353171.76207453, 46326468.63784985, 138353213.55891487, 46326464.51181836, 138353209.57826343, 46326464.904773735, 1, 3, 138353104.09099966, 46326475.318091325, 28 },
-  { 138353209.61968145, 46326444.96579427, 138353249.48017225, 46326441.6279396, 138353169.75919065, 46326448.30364895, 138353211.61270598, 46326444.798901536, 138353207.62665692, 46326445.13268701, 1, 1, 138353514.552436, 46326419.431205995, 37 },
-  { 138353207.96190104, 46326425.16866494, 138353247.8794722, 46326422.60204976, 138353168.04432988, 46326427.73528012, 138353209.9577796, 46326425.04033418, 138353205.9660225, 46326425.2969957, 1, 0, 138352964.46471703, 46326440.82501751, 47 },
-  { 138353206.68713894, 46326405.34278412, 138353246.65470147, 46326403.73221088, 138353166.71957642, 46326406.95335736, 138353208.68551707, 46326405.26225546, 138353204.68876082, 46326405.42331278, 0, 0, 0, 0, 0 },
-  { 138353205.88813177, 46326385.51483189, 138353245.88542214, 46326385.0492535, 138353165.8908414, 46326385.980410285, 138353207.8879963, 46326385.49155297, 138353203.88826725, 46326385.538110815, 1, 2, 138353064.89768323, 46326387.155995734, 40 },
-  { 138353205.65761593, 46326365.71148839, 138353245.64810935, 46326366.583518416, 138353165.6671225, 46326364.83945836, 138353207.6571406, 46326365.75508989, 138353203.65809125, 46326365.66788689, 1, 0, 138353386.61459863, 46326369.65742426, 25 },
-  { 138353206.0883279, 46326345.95943373, 138353246.01600745, 46326348.36368148, 138353166.16064838, 46326343.55518597, 138353208.08471188, 46326346.07964612, 138353204.09194395, 46326345.839221336, 1, 3, 138353090.2980573, 46326338.987115234, 39 },
-  { 138353207.27300423, 46326326.285348006, 138353247.0592426, 46326330.41514657, 138353167.48676586, 46326322.155549444, 138353209.26231617, 46326326.49183793, 138353205.2836923, 46326326.07885808, 1, 1, 138353499.7018563, 46326356.63936742, 45 },
-  { 138353209.30430686, 46326306.71589697, 138353248.86051297, 46326312.65782912, 138353169.74810076, 46326300.77396482, 138353211.28211716, 46326307.01299358, 138353207.32649657, 46326306.41880036, 0, 0, 0, 0, 0 },
-  { 138353212.225633, 46326287.26825341, 138353251.50507036, 46326294.82641457, 138353172.94619563, 46326279.71009225, 138353214.18960488, 46326287.64616147, 138353210.2616611, 46326286.89034535, 0, 0, 0, 0, 0 },
-  { 138353215.94599456, 46326267.933694944, 138353254.93626523, 46326276.86447278, 138353176.95572388, 46326259.00291711, 138353217.89550808, 46326268.38023384, 138353213.99648103, 46326267.48715605, 0, 0, 0, 0, 0 },
-  { 138353220.3517007, 46326248.69912456, 138353259.06511134, 46326258.76251546, 138353181.63829005, 46326238.63573366, 138353222.28737122, 46326249.202294104, 138353218.41603017, 46326248.195955016, 1, 5, 138353503.92743364, 46326322.41346293, 43 },
-  { 138353225.3290607, 46326229.55144523, 138353263.79765862, 46326240.513514996, 138353186.86046278, 46326218.589375466, 138353227.2524906, 46326230.09954872, 138353223.4056308, 46326229.00334174, 1, 2, 138352999.32604787, 46326165.14928537, 43 },
-  { 138353230.76438385, 46326210.47755998, 138353269.0352768, 46326222.11107852, 138353192.4934909, 46326198.84404143, 138353232.6779285, 46326211.0592359, 138353228.8508392, 46326209.89588405, 0, 0, 0, 0, 0 },
-  { 138353236.5439793, 46326191.46437173, 138353274.67511708, 46326203.54809347, 138353198.4128415, 46326179.38065, 138353238.4505362, 46326192.06855782, 138353234.63742238, 46326190.860185646, 1, 4, 138353002.99076033, 46326117.45157611, 33 },
-  { 138353242.55415636, 46326172.49878354, 138353280.60881546, 46326184.8212395, 138353204.49949726, 46326160.176327586, 138353244.45688933, 46326173.11490634, 138353240.6514234, 46326171.88266075, 0, 0, 0, 0, 0 },
-  { 138353248.684096, 46326153.56807977, 138353286.6928288, 46326166.031475455, 138353210.6753632, 46326141.104684085, 138353250.58453265, 46326154.19124956, 138353246.78365937, 46326152.94490998, 1, 3, 138353060.5408687, 46326091.87427115, 37 },
-  { 138353254.8818078, 46326134.667358205, 138353292.841719, 46326147.27866824, 138353216.9218966, 46326122.05604817, 138353256.77980337, 46326135.29792371, 138353252.98381224, 46326134.0367927, 1, 2, 138353557.6120997, 46326235.24255573, 49 },
-  { 138353261.15037668, 46326115.7990315, 138353299.0571279, 46326128.56923952, 138353223.24362546, 46326103.02882349, 138353263.04571423, 46326116.4375419, 138353259.25503913, 46326115.160521105, 0, 0, 0, 0, 0 },
-  { 138353267.495008, 46326096.96579399, 138353305.34411055, 46326109.90586493, 138353229.64590544, 46326084.02572305, 138353269.38746312, 46326097.612797536, 138353265.60255286, 46326096.31879044, 0, 0, 0, 0, 0 },
-  { 138353273.92090696, 46326078.17033991, 138353311.70771164, 46326091.291216105, 138353236.13410228, 46326065.04946372, 138353275.81024718, 46326078.826383725, 138353272.03156674, 46326077.5142961, 1, 1, 138353042.4767283, 46325997.80497323, 31 },
-  { 138353280.4332788, 46326059.415363565, 138353318.15296572, 46326072.72795977, 138353242.71359187, 46326046.10276736, 138353282.31926316, 46326060.08099338, 138353278.54729444, 46326058.74973375, 0, 0, 0, 0, 0 },
-  { 138353287.03732872, 46326040.70355922, 138353324.68489742, 46326054.218757, 138353249.38976002, 46326027.188361436, 138353288.91970715, 46326041.37931911, 138353285.1549503, 46326040.02779933, 0, 0, 0, 0, 0 },
-  { 138353293.73826197, 46326022.03762115, 138353331.30852157, 46326035.766262464, 138353256.16800237, 46326008.30897983, 138353295.61677495, 46326022.72405321, 138353291.859749, 46326021.351189084, 0, 0, 0, 0, 0 },
-  { 138353300.54128385, 46326003.420243636, 138353338.02884376, 46326017.37312334, 138353263.05372393, 46325989.46736393, 138353302.41566184, 46326004.11788762, 138353298.66690585, 46326002.72259965, 0, 0, 0, 0, 0 },
-  { 138353307.4515996, 46325984.854121, 138353344.8508603, 46325999.04197847, 138353270.0523389, 46325970.66626353, 138353309.32156262, 46325985.563513875, 138353305.58163658, 46325984.144728124, 0, 0, 0, 0, 0 },
-  { 138353314.47441435, 46325966.34194746, 138353351.77955836, 46325980.77545814, 138353277.16927034, 46325951.908436775, 138353316.33967155, 46325967.063622996, 138353312.60915715, 46325965.62027192, 1, 2, 138353001.1112047, 46325845.100457706, 35 },
-  { 138353321.6149334, 46325947.886417314, 138353358.81991702, 46325962.576182276, 138353284.40994978, 46325933.19665235, 138353323.4751826, 46325948.62090556, 138353319.7546842, 46325947.151929066, 1, 4, 138353675.99240226, 46326087.806428604, 30 },
-  { 138353328.87836203, 46325929.49022488, 138353365.9769074, 46325944.44675959, 138353291.77981666, 46325914.53369018, 138353330.7332893, 46325930.238051616, 138353327.02343476, 46325928.74239815, 0, 0, 0, 0, 0 },
-  { 138353336.26990542, 46325911.156064376, 138353373.2554931, 46325926.38978699, 138353299.28431773, 46325895.922341764, 138353338.1191848, 46325911.91775051, 138353334.42062604, 46325910.394378245, 0, 0, 0, 0, 0 },
-  { 138353343.79476878, 46325892.886630125, 138353380.66063082, 46325908.4078484, 138353306.92890674, 46325877.36541185, 138353345.63806188, 46325893.66269104, 138353341.95147568, 46325892.11056921, 0, 0, 0, 0, 0 },
-  { 138353351.45815742, 46325874.68461639, 138353388.19727147, 46325890.5035133, 138353314.71904337, 46325858.865719475, 138353353.29511312, 46325875.47556123, 138353349.62120172, 46325873.89367154, 0, 0, 0, 0, 0 },
-  { 138353359.26527655, 46325856.552717455, 138353395.87036046, 46325872.67933621, 138353322.66019264, 46325840.4260987, 138353361.09553075, 46325857.35904839, 138353357.43502235, 46325855.74638652, 0, 0, 0, 0, 0 },
-  { 138353367.22133145, 46325838.49362761, 138353403.68483907, 46325854.93785493, 138353330.75782382, 46325822.049400285, 138353369.04450682, 46325839.31583898, 138353365.39815608, 46325837.67141624, 0, 0, 0, 0, 0 },
-  { 138353375.3315272, 46325820.510041095, 138353411.64564455, 46325837.28159084, 138353339.01740986, 46325803.73849135, 138353377.14723307, 46325821.34861858, 138353373.51582134, 46325819.67146361, 0, 0, 0, 0, 0 },
-  { 138353383.60106924, 46325802.60465223, 138353419.75771272, 46325819.71304584, 138353347.44442576, 46325785.496258624, 138353385.40890142, 46325803.460071914, 138353381.79323706, 46325801.74923255, 1, 1, 138353615.90750363, 46325912.52608118, 33 },
-  { 138353392.0351627, 46325784.78015528, 138353428.02597758, 46325802.23470322, 138353356.0443478, 46325767.32560734, 138353393.83470345, 46325785.65288267, 138353390.23562193, 46325783.907427885, 1, 0, 138353221.07879198, 46325701.87105254, 31 },
-  { 138353400.6390128, 46325767.03924453, 138353436.4553736, 46325784.84902558, 138353364.82265204, 46325749.22946349, 138353402.42983085, 46325767.92973358, 138353398.84819478, 46325766.14875548, 0, 0, 0, 0, 0 },
-  { 138353409.41782486, 46325749.38461426, 138353445.05083677, 46325767.5584543, 138353373.78481296, 46325731.21077422, 138353411.19947547, 46325750.29330626, 138353407.63617426, 46325748.47592226, 1, 5, 138353306.08209032, 46325696.68047814, 46 },
-  { 138353418.37680408, 46325731.81895876, 138353453.81730634, 46325750.365408525, 138353382.93630183, 46325713.272508994, 138353420.1488292, 46325732.746281244, 138353416.60477898, 46325730.891636275, 0, 0, 0, 0, 0 },
-  { 138353427.52115566, 46325714.34497227, 138353462.759726, 46325733.27228484, 138353392.28258532, 46325695.41765969, 138353429.28308418, 46325715.2913379, 138353425.75922713, 46325713.398606636, 0, 0, 0, 0, 0 },
-  { 138353436.85608488, 46325696.9653491, 138353471.87959084, 46325716.28772033, 138353401.83257893, 46325677.64297787, 138353438.60726017, 46325697.93146766, 138353435.1049096, 46325695.99923054, 1, 5, 138353642.6191824, 46325810.48428009, 35 },
-  { 138353446.38953364, 46325679.68513047, 138353481.16864267, 46325699.444016464, 138353411.6104246, 46325659.926244475, 138353448.12848908, 46325680.67307477, 138353444.6505782, 46325678.69718617, 0, 0, 0, 0, 0 },
-  { 138353456.14159954, 46325662.51978202, 138353490.6408473, 46325682.76334652, 138353421.64235178, 46325642.27621752, 138353457.86656192, 46325663.53196025, 138353454.41663715, 46325661.507603794, 0, 0, 0, 0, 0 },
-  { 138353466.13575387, 46325645.48766267, 138353500.31753105, 46325666.26279466, 138353431.9539767, 46325624.71253069, 138353467.84484273, 46325646.526419275, 138353464.426665, 46325644.44890607, 1, 3, 138353343.08135602, 46325570.697187535, 44 },
-  { 138353476.39546806, 46325628.607131444, 138353510.21987376, 46325649.959170654, 138353442.57106236, 46325607.25509223, 138353478.08668834, 46325629.67473341, 138353474.70424777, 46325627.53952948, 0, 0, 0, 0, 0 },
-  { 138353486.9442135, 46325611.89654739, 138353520.36894932, 46325633.86896274, 138353453.5194777, 46325589.92413204, 138353488.6154503, 46325612.99516816, 138353485.27297673, 46325610.79792663, 1, 4, 138353334.0260472, 46325511.37274715, 30 },
-  { 138353497.80546173, 46325595.3742695, 138353530.7857758, 46325618.00829001, 138353464.82514766, 46325572.74024899, 138353499.45447743, 46325596.50597052, 138353496.15644604, 46325594.24256848, 0, 0, 0, 0, 0 },
-  { 138353509.00268415, 46325579.05865683, 138353541.4913756, 46325602.392857656, 138353476.5139927, 46325555.724456, 138353510.6271187, 46325580.22536687, 138353507.3782496, 46325577.891946785, 0, 0, 0, 0, 0 },
-  { 138353520.5593522, 46325562.96806838, 138353552.5068466, 46325587.037916765, 138353488.61185777, 46325538.89822, 138353522.1567269, 46325564.1715608, 138353518.96197748, 46325561.764575966, 0, 0, 0, 0, 0 },
-  { 138353532.49893722, 46325547.1208632, 138353563.85344324, 46325571.95823327, 138353501.1444312, 46325522.28349313, 138353534.06666252, 46325548.3627317, 138353530.93121192, 46325545.878994696, 1, 3, 138353406.29705048, 46325447.15044867, 43 },
-  { 138353544.8449108, 46325531.53540057, 138353575.54556146, 46325557.176579334, 138353514.14426014, 46325505.894221805, 138353546.37994334, 46325532.81745951, 138353543.30987826, 46325530.25334163, 0, 0, 0, 0, 0 },
-  { 138353557.6192635, 46325516.24043526, 138353587.5739306, 46325542.74926246, 138353527.6645964, 46325489.731608056, 138353559.11699685, 46325517.56587662, 138353556.12153015, 46325514.9149939, 0, 0, 0, 0, 0 },
-  { 138353570.83856627, 46325501.30277654, 138353599.93854338, 46325528.74710806, 138353541.73858917, 46325473.85844502, 138353572.29356512, 46325502.67499311, 138353569.38356742, 46325499.93055996, 0, 0, 0, 0, 0 },
-  { 138353584.51814994, 46325486.79793894, 138353612.6425335, 46325515.241199106, 138353556.39376637, 46325458.35467878, 138353585.92436913, 46325488.22010195, 138353583.11193076, 46325485.37577593, 0, 0, 0, 0, 0 },
-  { 138353598.67334542, 46325472.80143697, 138353625.6881269, 46325502.3006163, 138353571.65856394, 46325443.302257635, 138353600.02408448, 46325474.27639593, 138353597.32260635, 46325471.326478004, 0, 0, 0, 0, 0 },
-  { 138353613.31948355, 46325459.38878515, 138353639.07706776, 46325489.99183819, 138353587.56189933, 46325428.78573212, 138353614.60736275, 46325460.9189378, 138353612.03160435, 46325457.858632505, 0, 0, 0, 0, 0 },
-  { 138353628.47189528, 46325446.63549806, 138353652.81127706, 46325478.378127046, 138353604.1325135, 46325414.89286908, 138353629.68886438, 46325448.22262951, 138353627.25492617, 46325445.04836661, 0, 0, 0, 0, 0 },
-  { 138353644.1459114, 46325434.61709018, 138353666.89379132, 46325467.518974006, 138353621.39803147, 46325401.715206355, 138353645.28330538, 46325436.262184374, 138353643.0085174, 46325432.97199599, 0, 0, 0, 0, 0 },
-  { 138353660.3568629, 46325423.40907607, 138353681.34341893, 46325457.46145434, 138353639.37030688, 46325389.356697805, 138353661.4061907, 46325425.111694984, 138353659.3075351, 46325421.70645716, 1, 0, 138353857.10582575, 46325742.65012233, 46 },
-  { 138353677.11666477, 46325413.07997312, 138353696.42385864, 46325448.11184809, 138353657.8094709, 46325378.04809814, 138353678.08202446, 46325414.83156686, 138353676.15130508, 46325411.32837937, 0, 0, 0, 0, 0 },
-  { 138353694.37404838, 46325403.56887354, 138353712.33385235, 46325439.3102423, 138353676.4142444, 46325367.82750478, 138353695.27203858, 46325405.35594198, 138353693.4760582, 46325401.7818051, 0, 0, 0, 0, 0 },
-  { 138353712.02208316, 46325394.70085152, 138353728.99803457, 46325430.91986688, 138353695.04613176, 46325358.48183616, 138353712.87088072, 46325396.51180229, 138353711.1732856, 46325392.88990075, 0, 0, 0, 0, 0 },
-  { 138353729.95193467, 46325386.29708116, 138353746.31967944, 46325422.794984266, 138353713.5841899, 46325349.79917805, 138353730.7703219, 46325388.121976316, 138353729.13354743, 46325384.472186, 0, 0, 0, 0, 0 },
-  { 138353748.05476817, 46325378.178736456, 138353764.19514924, 46325414.77775419, 138353731.9143871, 46325341.579718724, 138353748.86178723, 46325380.00868734, 138353747.24774912, 46325376.34878557, 0, 0, 0, 0, 0 },
-  { 138353766.22174922, 46325370.166991465, 138353782.51712835, 46325406.69726137, 138353749.92637008, 46325333.63672156, 138353767.0365182, 46325371.99350496, 138353765.40698025, 46325368.34047797, 0, 0, 0, 0, 0 },
-  { 138353784.3440432, 46325362.08302023, 138353801.17583388, 46325398.36925485, 138353767.5122525, 46325325.796785615, 138353785.18563274, 46325363.89733196, 138353783.50245366, 46325360.268708505, 0, 0, 0, 0, 0 },
-  { 138353802.31281555, 46325353.74799682, 138353820.05818847, 46325389.59631254, 138353784.56744263, 46325317.899681106, 138353803.20008418, 46325355.540412605, 138353801.4255469, 46325351.95558104, 1, 5, 138353865.75252375, 46325481.90572551, 27 },
-  { 138353820.01923174, 46325344.98309526, 138353839.0449606, 46325380.168626964, 138353800.9935029, 46325309.79756355, 138353820.97051817, 46325346.74237184, 138353819.0679453, 46325343.223818675, 1, 1, 138353639.2748075, 46325010.720544085, 34 },
-  { 138353837.35445717, 46325335.609489605, 138353858.00507382, 46325369.86663531, 138353816.70384052, 46325301.3523439, 138353838.386988, 46325337.32234689, 138353836.32192633, 46325333.89663232, 0, 0, 0, 0, 0 },
-  { 138353854.20986968, 46325325.448845595, 138353876.67112786, 46325358.54706128, 138353831.7486115, 46325292.35062991, 138353855.3329326, 46325327.103756376, 138353853.08680677, 46325323.793934815, 0, 0, 0, 0, 0 },
-  { 138353870.5058654, 46325314.389984585, 138353894.6962642, 46325346.24629645, 138353846.31546658, 46325282.53367272, 138353871.71538535, 46325315.98280018, 138353869.29634544, 46325312.79716899, 0, 0, 0, 0, 0 },
-  { 138353886.2210713, 46325302.456490844, 138353912.02881524, 46325333.01725578, 138353860.41332737, 46325271.895725906, 138353887.5114585, 46325303.98452909, 138353884.93068412, 46325300.928452596, 1, 0, 138353741.05251172, 46325130.552188076, 28 },
-  { 138353901.34107432, 46325289.688055016, 138353928.65603197, 46325318.90950413, 138353874.02611667, 46325260.4666059, 138353902.7068222, 46325291.14912747, 138353899.97532645, 46325288.226982564, 1, 3, 138354007.1865352, 46325402.92117034, 28 },
-  { 138353915.85146105, 46325276.124367684, 138353944.5664488, 46325303.971261196, 138353887.1364733, 46325248.27747417, 138353917.28721043, 46325277.51671236, 138353914.41571167, 46325274.73202301, 1, 2, 138353713.4107974, 46325079.80376841, 32 },
-  { 138353929.73781836, 46325261.80511948, 138353959.7495516, 46325288.24932241, 138353899.72608513, 46325235.36091655, 138353931.23840502, 46325263.127329625, 138353928.2372317, 46325260.48290933, 1, 0, 138354014.52096474, 46325336.509992756, 49 },
-  { 138353942.98569554, 46325246.7699998, 138353974.22606608, 46325271.75077739, 138353911.745325, 46325221.78922221, 138353944.54771405, 46325248.019038685, 138353941.42367703, 46325245.52096092, 0, 0, 0, 0, 0 },
-  { 138353955.5497451, 46325231.05769611, 138353988.03609672, 46325254.39515438, 138353923.0633935, 46325207.72023784, 138353957.1740627, 46325232.22456902, 138353953.92542753, 46325229.8908232, 1, 2, 138354243.05395696, 46325437.59420178, 35 },
-  { 138353967.2978115, 46325214.70408076, 138354001.0511595, 46325236.16827186, 138353933.54446352, 46325193.23988966, 138353968.9854789, 46325215.777290314, 138353965.6101441, 46325213.63087121, 1, 5, 138353855.06792945, 46325143.33564534, 35 },
-  { 138353978.08260608, 46325197.744535334, 138354013.103636, 46325217.07139393, 138353943.06157616, 46325178.41767674, 138353979.83365756, 46325198.71087826, 138353976.3315546, 46325196.77819241, 1, 5, 138354093.65200484, 46325261.52316869, 42 },
-  { 138353987.7568403, 46325180.21444144, 138354024.01498, 46325197.106667615, 138353951.4987006, 46325163.32221527, 138353989.56974727, 46325181.05905275, 138353985.9439333, 46325179.36983013, 0, 0, 0, 0, 0 },
-  { 138353996.1732255, 46325162.14918069, 138354033.59358457, 46325176.281297535, 138353958.75286642, 46325148.01706384, 138353998.04424345, 46325162.85578653, 138353994.30220753, 46325161.442574844, 0, 0, 0, 0, 0 },
-  { 138354003.184473, 46325143.58413467, 138354041.63375512, 46325154.61376319, 138353964.7351909, 46325132.554506145, 138354005.1069371, 46325144.135616094, 138354001.2620089, 46325143.03265324, 0, 0, 0, 0, 0 },
-  { 138354008.64329433, 46325124.554684974, 138354047.9164955, 46325132.145183675, 138353969.37009317, 46325116.96418627, 138354010.6069544, 46325124.934209906, 138354006.67963427, 46325124.17516004, 1, 1, 138354361.12027475, 46325192.6794108, 25 },
-  { 138354012.40384504, 46325105.09761499, 138354052.20522764, 46325109.078813665, 138353972.60246244, 46325101.11641631, 138354014.39391416, 46325105.29667492, 138354010.41377592, 46325104.898555055, 1, 0, 138353886.03445527, 46325092.4573092, 36 },
-  { 138354014.38306913, 46325085.31064589, 138354054.38104698, 46325085.71284967, 138353974.38509127, 46325084.90844212, 138354016.382968, 46325085.33075608, 138354012.38317025, 46325085.2905357, 1, 0, 138354151.37614328, 46325086.68819383, 32 },
-  { 138354014.58353806, 46325065.37460303, 138354054.4596771, 46325062.22920391, 138353974.707399, 46325068.52000216, 138354016.577345, 46325065.21733308, 138354012.5897311, 46325065.53187299, 0, 0, 0, 0, 0 },
-  { 138354013.01397374, 46325045.47628096, 138354052.45272687, 46325038.79909951, 138353973.5752206, 46325052.1534624, 138354014.9859114, 46325045.14242189, 138354011.0420361, 46325045.81014003, 1, 3, 138354236.8288977, 46325007.583276264, 25 },
-  { 138354009.68309823, 46325025.80247424, 138354048.359097, 46325015.59624483, 138353971.00709945, 46325036.00870365, 138354011.61689818, 46325025.29216277, 138354007.74929827, 46325026.31278571, 0, 0, 0, 0, 0 },
-  { 138354004.59985176, 46325006.53976454, 138354042.2017972, 46324992.898148105, 138353966.99790633, 46325020.18138097, 138354006.47994903, 46325005.85768372, 138354002.7197545, 46325007.22184536, 0, 0, 0, 0, 0 },
-  { 138353997.81394252, 46324987.834987864, 138354034.13001418, 46324971.0676703, 138353961.49787086, 46325004.60230543, 138353999.6297461, 46324986.99662199, 138353995.99813893, 46324988.67335374, 1, 5, 138353644.6401455, 46325150.89715117, 30 },
-  { 138353989.46346223, 46324969.74881281, 138354024.3541287, 46324950.18759112, 138353954.57279578, 46324989.3100345, 138353991.20799556, 46324968.77075172, 138353987.7189289, 46324970.7268739, 1, 3, 138354241.54852742, 46324828.41898613, 32 },
-  { 138353979.6980722, 46324952.330628395, 138354013.0749975, 46324930.2856549, 138353946.32114688, 46324974.37560189, 138353981.36691847, 46324951.22837972, 138353978.02922592, 46324953.43287707, 0, 0, 0, 0, 0 },
-  { 138353968.66743365, 46324935.6298236, 138354000.47891977, 46324911.3805071, 138353936.85594752, 46324959.87914011, 138353970.25800794, 46324934.41735778, 138353967.07685935, 46324936.842289425, 1, 5, 138354235.88391703, 46324731.93556495, 47 },
-  { 138353956.52120805, 46324919.6957874, 138353986.73888662, 46324893.487164736, 138353926.30352947, 46324945.904410064, 138353958.03209198, 46324918.38535627, 138353955.01032412, 46324921.00621853, 0, 0, 0, 0, 0 },
-  { 138353943.4090567, 46324904.57790883, 138353972.01654938, 46324876.62059563, 138353914.801564, 46324932.53522203, 138353944.83943132, 46324903.18004317, 138353941.97868207, 46324905.97577449, 0, 0, 0, 0, 0 },
-  { 138353929.48063174, 46324890.32556232, 138353956.47773418, 46324860.8102026, 138353902.4835293, 46324919.84092204, 138353930.83048686, 46324888.849794336, 138353928.1307766, 46324891.801330306, 1, 3, 138353751.29975563, 46325085.12693651, 40 },
-  { 138353914.86747655, 46324876.9592049, 138353940.31182587, 46324846.0952277, 138353889.42312723, 46324907.82318209, 138353916.139694, 46324875.416006036, 138353913.5952591, 46324878.50240376, 0, 0, 0, 0, 0 },
-  { 138353899.6451266, 46324864.40985694, 138353923.63661954, 46324832.40347839, 138353875.65363368, 46324896.416235484, 138353900.84470126, 46324862.809538014, 138353898.44555196, 46324866.01017586, 1, 0, 138353796.48170707, 46325002.03728467, 40 },
-  { 138353883.87832287, 46324852.59130146, 138353906.54567397, 46324819.633886606, 138353861.21097177, 46324885.54871632, 138353885.01169044, 46324850.94343072, 138353882.7449553, 46324854.239172205, 1, 3, 138354019.31574568, 46324655.670747675, 26 },
-  { 138353867.63180634, 46324841.41732147, 138353889.12535003, 46324807.6826571, 138353846.13826266, 46324875.15198585, 138353868.7064835, 46324839.73058826, 138353866.55712917, 46324843.10405469, 0, 0, 0, 0, 0 },
-  { 138353850.970318, 46324830.801699996, 138353871.45569798, 46324796.44548941, 138353830.484938, 46324865.157910585, 138353851.994587, 46324829.08388947, 138353849.94604897, 46324832.51951052, 0, 0, 0, 0, 0 },
-  { 138353833.95859864, 46324820.658219986, 138353853.61168364, 46324785.81921526, 138353814.30551365, 46324855.49722471, 138353834.9412529, 46324818.91626975, 138353832.9759444, 46324822.40017022, 0, 0, 0, 0, 0 },
-  { 138353816.66138944, 46324810.90066447, 138353835.66446894, 46324775.70289509, 138353797.65830994, 46324846.09843385, 138353817.61154342, 46324809.140776, 138353815.71123546, 46324812.66055294, 1, 2, 138353986.738951, 46324495.880628504, 25 },
-  { 138353799.14343116, 46324801.44281644, 138353817.68256637, 46324765.99848734, 138353780.60429594, 46324836.887145534, 138353800.07038793, 46324799.67059998, 138353798.21647438, 46324803.21503289, 1, 1, 138353699.9590577, 46324991.0699771, 36 },
-  { 138353781.46946493, 46324792.198458925, 138353799.7327694, 46324756.611218095, 138353763.20616046, 46324827.785699755, 138353782.38263014, 46324790.41909689, 138353780.55629972, 46324793.97782096, 1, 1, 138353933.05489203, 46324496.82436004, 45 },
-  { 138353763.70423162, 46324783.0813749, 138353781.88081935, 46324747.44976452, 138353745.5276439, 46324818.71298528, 138353764.613061, 46324781.29979438, 138353762.79540223, 46324784.862955414, 1, 2, 138353695.9964423, 46324915.80912355, 32 },
-  { 138353745.91247216, 46324774.00534736, 138353764.1729808, 46324738.41667184, 138353727.65196353, 46324809.594022885, 138353746.8254976, 46324772.225913584, 138353744.99944672, 46324775.78478114, 1, 3, 138353877.8446469, 46324516.87716675, 36 },
-  { 138353728.15250713, 46324764.89272966, 138353746.5426101, 46324729.3708475, 138353709.76240414, 46324800.414611824, 138353729.07201228, 46324763.11663555, 138353727.23300198, 46324766.66882377, 0, 0, 0, 0, 0 },
-  { 138353710.44003332, 46324755.72277026, 138353728.95448717, 46324720.26554253, 138353691.92557946, 46324791.17999799, 138353711.365756, 46324753.949908875, 138353709.51431063, 46324757.49563164, 1, 4, 138353782.183542, 46324618.3260128, 25 },
-  { 138353692.7733822, 46324746.49789798, 138353711.4067986, 46324711.103042535, 138353674.13996577, 46324781.89275343, 138353693.705053, 46324744.72815521, 138353691.84171137, 46324748.267640755, 0, 0, 0, 0, 0 },
-  { 138353675.15083393, 46324737.220609635, 138353693.8978303, 46324701.88578083, 138353656.40383756, 46324772.55543844, 138353676.08818376, 46324735.453868195, 138353674.2134841, 46324738.987351075, 1, 0, 138353785.2894377, 46324529.628490426, 47 },
-  { 138353657.57066903, 46324727.89340191, 138353676.4258683, 46324692.61619312, 138353638.71546975, 46324763.1706107, 138353658.513429, 46324726.12954147, 138353656.62790906, 46324729.657262355, 1, 3, 138353478.9176559, 46325062.144955225, 40 },
-  { 138353640.03116775, 46324718.518771574, 138353658.98919907, 46324683.29671814, 138353621.07313642, 46324753.740825005, 138353640.97906932, 46324716.757668905, 138353639.08326617, 46324720.27987424, 0, 0, 0, 0, 0 },
-  { 138353622.53061056, 46324709.09921538, 138353641.58610934, 46324673.92979732, 138353603.47511178, 46324744.26863344, 138353623.4833855, 46324707.34074448, 138353621.57783562, 46324710.85768628, 0, 0, 0, 0, 0 },
-  { 138353605.06727776, 46324699.63723008, 138353624.21488586, 46324664.51787496, 138353585.91966966, 46324734.7565852, 138353606.02465817, 46324697.881262325, 138353604.10989735, 46324701.39319784, 1, 2, 138353736.22839326, 46324459.06964752, 33 },
-  { 138353587.63944975, 46324690.135312416, 138353606.87381548, 46324655.06339808, 138353568.405084, 46324725.20722675, 138353588.60116804, 46324688.3817167, 138353586.67773145, 46324691.88890813, 1, 3, 138353535.22580314, 46324785.70627897, 31 },
-  { 138353570.24540693, 46324680.595959134, 138353589.5611848, 46324645.568816446, 138353550.92962906, 46324715.62310182, 138353571.21119583, 46324678.844601996, 138353569.27961802, 46324682.34731627, 0, 0, 0, 0, 0 },
-  { 138353552.88342965, 46324671.021667, 138353572.27528033, 46324636.03658265, 138353533.49157897, 46324706.00675136, 138353553.8530222, 46324669.272412784, 138353551.9138371, 46324672.77092122, 0, 0, 0, 0, 0 },
-  { 138353535.55179822, 46324661.41493274, 138353555.01438817, 46324626.46915198, 138353516.08920828, 46324696.360713504, 138353536.52492774, 46324659.6676437, 138353534.5786687, 46324663.16222178, 1, 3, 138353663.0317623, 46324432.520068765, 26 },
-  { 138353518.2487931, 46324651.778253116, 138353537.77679414, 46324616.86898249, 138353498.72079206, 46324686.687523745, 138353519.22519314, 46324650.03278959, 138353517.27239305, 46324653.52371664, 1, 5, 138353421.09698796, 46324825.45187449, 41 },
-  { 138353500.97269464, 46324642.114124864, 138353520.56078342, 46324607.23853486, 138353481.38460585, 46324676.98971487, 138353501.95209908, 46324640.37034536, 138353499.9932902, 46324643.85790437, 0, 0, 0, 0, 0 },
-  { 138353483.72178316, 46324632.42504475, 138353503.36464083, 46324597.58027265, 138353464.0789255, 46324667.26981685, 138353484.70392606, 46324630.68280615, 138353482.73964027, 46324634.167283356, 0, 0, 0, 0, 0 },
-  { 138353466.49433905, 46324622.7135095, 138353486.1866504, 46324587.89666195, 138353446.8020277, 46324657.53035705, 138353467.4789546, 46324620.97266712, 138353465.50972348, 46324624.45435188, 1, 5, 138353614.18667427, 46324361.58715288, 49 },
-  { 138353449.2886427, 46324612.982015885, 138353469.02509567, 46324578.19017167, 138353429.55218974, 46324647.773860104, 138353450.27546534, 46324611.242423676, 138353448.30182007, 46324614.721608095, 0, 0, 0, 0, 0 },
-  { 138353432.1029745, 46324603.23306064, 138353451.87825924, 46324568.46327327, 138353412.32768977, 46324638.002848014, 138353433.09173873, 46324601.494571276, 138353431.11421028, 46324604.97155001, 0, 0, 0, 0, 0 },
-  { 138353414.9356148, 46324593.46914053, 138353434.74442297, 46324558.71844099, 138353395.12680662, 46324628.21984007, 138353415.9260552, 46324591.73160555, 138353413.9451744, 46324595.20667551, 1, 3, 138353324.31031737, 46324752.45359092, 36 },
-  { 138353397.7848439, 46324583.69275227, 138353417.62186795, 46324548.95815171, 138353377.94781983, 46324618.42735283, 138353398.7766951, 46324581.95602224, 138353396.79299268, 46324585.4294823, 0, 0, 0, 0, 0 },
-  { 138353380.6489423, 46324573.90639265, 138353400.50887436, 46324539.184884936, 138353360.78901023, 46324608.62790036, 138353381.6419389, 46324572.17031726, 138353379.6559457, 46324575.642468035, 0, 0, 0, 0, 0 },
-  { 138353363.52619028, 46324564.11255839, 138353383.40372136, 46324529.401122846, 138353343.6486592, 46324598.82399393, 138353364.52006683, 46324562.37698661, 138353362.53231373, 46324565.84813017, 0, 0, 0, 0, 0 },
-  { 138353346.4148682, 46324554.31374623, 138353366.30468732, 46324519.60935032, 138353326.5250491, 46324589.018142134, 138353347.40935916, 46324552.57852643, 138353345.42037725, 46324556.04896603, 0, 0, 0, 0, 0 },
-  { 138353329.31325656, 46324544.51245295, 138353349.2100495, 46324509.81205481, 138353309.4164636, 46324579.21285109, 138353330.3080962, 46324542.777433045, 138353328.31841692, 46324546.24747286, 1, 1, 138353485.0056613, 46324272.98183753, 47 },
-  { 138353312.21963558, 46324534.711175285, 138353332.1180842, 46324500.01172654, 138353292.32118696, 46324569.41062403, 138353313.214558, 46324532.976202846, 138353311.22471315, 46324536.446147725, 0, 0, 0, 0, 0 },
-  { 138353295.13228565, 46324524.91240998, 138353315.0270668, 46324490.21085839, 138353275.2375045, 46324559.61396158, 138353296.1270247, 46324523.1773324, 138353294.1375466, 46324526.647487566, 0, 0, 0, 0, 0 },
-  { 138353278.04948723, 46324515.11865378, 138353297.93527162, 46324480.4119458, 138353258.16370285, 46324549.825361766, 138353279.04377645, 46324513.38331838, 138353277.055198, 46324516.853989184, 1, 3, 138353085.1573786, 46324851.773721226, 43 },
-  { 138353260.96952066, 46324505.332403444, 138353280.84097192, 46324470.61748698, 138353241.0980694, 46324540.047319904, 138353261.96309322, 46324503.59665762, 138353259.9759481, 46324507.06814927, 1, 2, 138353363.80428094, 46324325.68271077, 26 },
-  { 138353243.89066625, 46324495.55615572, 138353263.74244007, 46324460.82998294, 138353224.03889242, 46324530.2823285, 138353244.88325495, 46324493.81984708, 138353242.89807755, 46324497.29246436, 0, 0, 0, 0, 0 },
-  { 138353226.8112044, 46324485.792407334, 138353246.63794732, 46324451.05193719, 138353206.9844615, 46324520.532877475, 138353227.80254155, 46324484.055383824, 138353225.81986725, 46324487.529430844, 1, 4, 138353418.13927352, 46324150.5468705, 45 },
-  { 138353209.7294155, 46324476.04365507, 138353229.5257641, 46324441.2858562, 138353189.9330669, 46324510.80145393, 138353210.71923295, 46324474.30576512, 138353208.73959807, 46324477.78154501, 0, 0, 0, 0, 0 },
-  { 138353192.64357993, 46324466.312395655, 138353212.40415984, 46324431.534249045, 138353172.88300002, 46324501.090542264, 138353193.63160893, 46324464.573488325, 138353191.65555093, 46324468.051302984, 1, 2, 138353301.8207839, 46324274.16313562, 33 },
-  { 138353175.551978, 46324456.60112583, 138353195.27140298, 46324421.79962761, 138353155.832553, 46324491.40262405, 138353176.53794923, 46324454.86105092, 138353174.56600675, 46324458.34120074, 0, 0, 0, 0, 0 },
-  { 138353158.45289013, 46324446.91234237, 138353178.12576124, 46324412.08450663, 138353138.78001902, 46324481.74017811, 138353159.4365337, 46324445.170950584, 138353157.46924657, 46324448.653734155, 0, 0, 0, 0, 0 },
-  { 138353141.34459665, 46324437.24854198, 138353160.9655014, 46324402.391403586, 138353121.7236919, 46324472.10568038, 138353142.3256419, 46324435.50568506, 138353140.3635514, 46324438.9913989, 1, 5, 138353061.38940987, 46324579.29138096, 44 },
-  { 138353124.22537804, 46324427.61222147, 138353143.78888956, 46324392.722838886, 138353104.66186652, 46324462.50160406, 138353125.20355362, 46324425.86775234, 138353123.24720246, 46324429.3566906, 1, 1, 138353316.4368787, 46324084.82403759, 27 },
-  { 138353107.09351456, 46324418.00587755, 138353126.59419096, 46324383.081335746, 138353087.59283817, 46324452.93041935, 138353108.06854838, 46324416.259650454, 138353106.11848074, 46324419.75210464, 1, 3, 138353041.76624864, 46324535.00309259, 41 },
-  { 138353089.94728655, 46324408.43200695, 138353109.37967035, 46324373.46942037, 138353070.51490274, 46324443.39459352, 138353090.91890574, 46324406.68387762, 138353088.97566736, 46324410.18013628, 1, 0, 138353163.790345, 46324275.57417798, 45 },
-  { 138353072.78497452, 46324398.89310645, 138353092.14302638, 46324363.88930912, 138353053.42692265, 46324433.89690378, 138353073.75287712, 46324397.14291659, 138353071.8170719, 46324400.643296316, 0, 0, 0, 0, 0 },
-  { 138353055.60467836, 46324389.39193545, 138353074.8527775, 46324354.32755639, 138353036.3565792, 46324424.45631452, 138353056.56708333, 46324387.6387165, 138353054.6422734, 46324391.14515441, 1, 0, 138353192.74738482, 46324139.558234625, 40 },
-  { 138353038.3950797, 46324379.94496761, 138353057.45390993, 46324344.77735481, 138353019.33624947, 46324415.11258042, 138353039.3480212, 46324378.18658697, 138353037.4421382, 46324381.70334826, 0, 0, 0, 0, 0 },
-  { 138353021.13101634, 46324370.588834904, 138353039.91727775, 46324335.27486625, 138353002.34475493, 46324405.902803555, 138353022.07032943, 46324368.82313647, 138353020.19170326, 46324372.35453334, 1, 5, 138353081.24705288, 46324257.58413522, 26 },
-  { 138353003.78621915, 46324361.36178094, 138353022.21597785, 46324325.8604571, 138352985.35646045, 46324396.86310478, 138353004.70770708, 46324359.58671475, 138353002.86473122, 46324363.13684713, 0, 0, 0, 0, 0 },
-  { 138352986.33441913, 46324352.302049406, 138353004.32306096, 46324316.57518605, 138352968.3457773, 46324388.02891276, 138352987.23385122, 46324350.51570624, 138352985.43498704, 46324354.08839257, 0, 0, 0, 0, 0 },
-  { 138352968.74934715, 46324343.4478839, 138352986.21162835, 46324307.460820444, 138352951.28706595, 46324379.43494735, 138352969.6224612, 46324341.64853072, 138352967.8762331, 46324345.24723707, 1, 1, 138352891.91530994, 46324501.790963076, 32 },
-  { 138352951.00473425, 46324334.83752811, 138352967.85495067, 46324298.55984618, 138352934.15451783, 46324371.11521004, 138352951.84724507, 46324333.023644015, 138352950.16222343, 46324336.651412204, 0, 0, 0, 0, 0 },
-  { 138352933.07431123, 46324326.50922563, 138352949.22660607, 46324289.91546425, 138352916.92201638, 46324363.10298701, 138352933.88192597, 46324324.67953756, 138352932.26669648, 46324328.3389137, 0, 0, 0, 0, 0 },
-  { 138352914.93180913, 46324318.501220115, 138352930.30063447, 46324281.57156797, 138352899.56298378, 46324355.43087226, 138352915.7002504, 46324316.65473751, 138352914.16336787, 46324320.34770272, 0, 0, 0, 0, 0 },
-  { 138352896.5509588, 46324310.85175521, 138352911.0517017, 46324273.57269332, 138352882.05021593, 46324348.1308171, 138352897.27599597, 46324308.98780212, 138352895.82592165, 46324312.7157083, 0, 0, 0, 0, 0 },
-  { 138352877.90549126, 46324303.59907456, 138352891.45526472, 46324265.963936195, 138352864.3557178, 46324341.23421292, 138352878.58297995, 46324301.71731764, 138352877.22800258, 46324305.480831474, 0, 0, 0, 0, 0 },
-  { 138352858.96913734, 46324296.78142178, 138352871.3950084, 46324258.76040485, 138352846.5432663, 46324334.80243871, 138352859.5904309, 46324294.88037094, 138352858.3478438, 46324298.682472624, 1, 3, 138352794.35460788, 46324494.490709834, 48 },
-  { 138352839.73485592, 46324290.495353706, 138352850.39788082, 46324251.94279348, 138352829.07183102, 46324329.04791393, 138352840.26800716, 46324288.567725696, 138352839.20170468, 46324292.42298172, 0, 0, 0, 0, 0 },
-  { 138352820.2876473, 46324285.116565146, 138352828.33044913, 46324245.9334905, 138352812.24484548, 46324324.29963979, 138352820.6897874, 46324283.15741141, 138352819.88550723, 46324287.07571888, 1, 3, 138352776.25330737, 46324499.64389885, 34 },
-  { 138352800.74002033, 46324281.10417737, 138352805.18991497, 46324241.3524675, 138352796.2901257, 46324320.85588724, 138352800.96251506, 46324279.11659188, 138352800.5175256, 46324283.09176286, 0, 0, 0, 0, 0 },
-  { 138352781.20448893, 46324278.91732663, 138352781.00290897, 46324238.917834565, 138352781.4060689, 46324318.91681869, 138352781.19440994, 46324276.91735203, 138352781.21456793, 46324280.91730123, 0, 0, 0, 0, 0 },
-  { 138352761.79356685, 46324279.01514919, 138352756.28073832, 46324239.39686148, 138352767.30639538, 46324318.6334369, 138352761.5179254, 46324277.03423481, 138352762.0692083, 46324280.996063575, 1, 1, 138352734.6428863, 46324083.89508219, 28 },
-  { 138352742.5956073, 46324281.68651803, 138352732.67131615, 46324242.937215514, 138352752.51989847, 46324320.43582054, 138352742.09939274, 46324279.749052905, 138352743.09182188, 46324283.62398315, 0, 0, 0, 0, 0 },
-  { 138352723.6039282, 46324286.55057856, 138352710.522714, 46324248.7500252, 138352736.68514243, 46324324.351131916, 138352722.9498675, 46324284.66055089, 138352724.25798893, 46324288.44060622, 1, 5, 138352687.30355874, 46324181.65404298, 41 },
-  { 138352704.7884837, 46324293.06182875, 138352689.6847923, 46324256.02295045, 138352719.8921751, 46324330.10070705, 138352704.03329915, 46324291.20988483, 138352705.54366827, 46324294.913772665, 1, 4, 138352833.54745302, 46324608.81826625, 47 },
-  { 138352686.11922798, 46324300.67476657, 138352669.99979243, 46324264.066518895, 138352702.23866352, 46324337.283014245, 138352685.3132562, 46324298.84435419, 138352686.92519975, 46324302.50517895, 0, 0, 0, 0, 0 },
-  { 138352667.56612638, 46324308.844114855, 138352651.14354882, 46324272.37085141, 138352683.98870394, 46324345.3173783, 138352666.7449975, 46324307.02045168, 138352668.38725525, 46324310.66777803, 0, 0, 0, 0, 0 },
-  { 138352649.10574472, 46324317.15615006, 138352632.48458812, 46324280.77295128, 138352665.72690132, 46324353.53934883, 138352648.2746869, 46324315.33699012, 138352649.93680254, 46324318.97531, 1, 2, 138352570.15525088, 46324144.335955866, 28 },
-  { 138352630.73234132, 46324325.549782984, 138352613.91862094, 46324289.255171716, 138352647.5460617, 46324361.84439425, 138352629.8916553, 46324323.73505242, 138352631.57302734, 46324327.364513546, 1, 1, 138352726.15020445, 46324531.521701925, 47 },
-  { 138352612.44310784, 46324334.02239219, 138352595.44289193, 46324297.81475959, 138352629.44332376, 46324370.23002479, 138352611.59309706, 46324332.21201056, 138352613.29311863, 46324335.83277382, 1, 4, 138352544.44224417, 46324189.191861786, 48 },
-  { 138352594.23523608, 46324342.5713563, 138352577.05464193, 46324306.44896456, 138352611.41583022, 46324378.693748035, 138352593.37620637, 46324340.76523671, 138352595.0942658, 46324344.37747588, 0, 0, 0, 0, 0 },
-  { 138352576.1059178, 46324351.19405386, 138352558.75110778, 46324315.15503932, 138352593.46072784, 46324387.2330684, 138352575.2381773, 46324349.39210313, 138352576.97365832, 46324352.99600459, 0, 0, 0, 0, 0 },
-  { 138352558.05234477, 46324359.88786345, 138352540.52952233, 46324323.93023986, 138352575.5751672, 46324395.845487036, 138352557.17620364, 46324358.08998227, 138352558.9284859, 46324361.68574463, 1, 2, 138352690.34965414, 46324631.367921524, 27 },
-  { 138352540.07170865, 46324368.650163695, 138352522.38711494, 46324332.77182558, 138352557.75630236, 46324404.52850181, 138352539.18747896, 46324366.85624679, 138352540.95593834, 46324370.4440806, 0, 0, 0, 0, 0 },
-  { 138352522.16120118, 46324377.47833312, 138352504.3211112, 46324341.677059546, 138352540.00129116, 46324413.2796067, 138352521.2691967, 46324375.688269444, 138352523.05320567, 46324379.2683968, 0, 0, 0, 0, 0 },
-  { 138352504.3180142, 46324386.369750366, 138352486.32873407, 46324350.643208414, 138352522.30729434, 46324422.09629232, 138352503.4185502, 46324384.583423264, 138352505.21747822, 46324388.15607747, 0, 0, 0, 0, 0 },
-  { 138352486.5393394, 46324395.32179398, 138352468.4072029, 46324359.66754281, 138352504.6714759, 46324430.976045154, 138352485.63273257, 46324393.539081424, 138352487.44594622, 46324397.10450654, 0, 0, 0, 0, 0 },
-  { 138352468.82236847, 46324404.33184255, 138352450.55373436, 46324368.747337386, 138352487.09100258, 46324439.91634771, 138352467.90893677, 46324402.55261729, 138352469.73580018, 46324406.11106781, 0, 0, 0, 0, 0 },
-  { 138352451.16429323, 46324413.39727466, 138352432.76554245, 46324377.87987091, 138352469.563044, 46324448.91467841, 138352450.24435568, 46324411.62140447, 138352452.08423078, 46324415.17314485, 0, 0, 0, 0, 0 },
-  { 138352433.56230542, 46324422.51546892, 138352415.03983888, 46324387.06242628, 138352452.08477196, 46324457.96851156, 138352432.6361821, 46324420.74281678, 138352434.48842874, 46324424.28812105, 0, 0, 0, 0, 0 },
-  { 138352416.0135967, 46324431.68380387, 138352397.37383252, 46324396.292290896, 138352434.6533609, 46324467.07531685, 138352415.0816085, 46324429.91422822, 138352416.94558492, 46324433.45337952, 0, 0, 0, 0, 0 },
-  { 138352398.51535898, 46324440.89965812, 138352379.7647309, 46324405.56675636, 138352417.26598707, 46324476.23255988, 138352397.57782757, 46324439.13301303, 138352399.4528904, 46324442.66630321, 0, 0, 0, 0, 0 },
-  { 138352381.0647838, 46324450.16041024, 138352362.20973876, 46324414.88311902, 138352399.91982886, 46324485.43770146, 138352380.12203157, 46324448.39654568, 138352382.00753605, 46324451.9242748, 1, 5, 138352538.50441006, 46324744.72579193, 49 },
-  { 138352363.65906307, 46324459.46343883, 138352344.70605987, 46324424.238679506, 138352382.61206627, 46324494.68819816, 138352362.7114129, 46324457.70220087, 138352364.60671324, 46324461.224676795, 1, 2, 138352230.51421556, 46324212.00950457, 41 },
-  { 138352346.29538837, 46324468.80612246, 138352327.25089556, 46324433.630743384, 138352365.33988118, 46324503.981501535, 138352345.34316373, 46324467.047353506, 138352347.247613, 46324470.56489141, 0, 0, 0, 0, 0 },
-  { 138352328.97095168, 46324478.18583972, 138352309.8414468, 46324443.0566205, 138352348.10045657, 46324513.31505894, 138352328.01447642, 46324476.429378755, 138352329.92742693, 46324479.942300685, 0, 0, 0, 0, 0 },
-  { 138352311.6829445, 46324487.59996918, 138352292.47491208, 46324452.513625816, 138352330.89097694, 46324522.68631254, 138352310.72254288, 46324485.845652014, 138352312.64334613, 46324489.35428634, 1, 0, 138352382.75266448, 46324617.41943962, 44 },
-  { 138352294.4285587, 46324497.045889445, 138352275.14848953, 46324461.99907886, 138352313.70862788, 46324532.09270003, 138352293.46455523, 46324495.29354891, 138352295.39256218, 46324498.79822998, 0, 0, 0, 0, 0 },
-  { 138352277.20498607, 46324506.52097909, 138352257.85937625, 46324471.510303855, 138352296.55059588, 46324541.53165433, 138352276.2377056, 46324504.77044533, 138352278.17226654, 46324508.27151285, 0, 0, 0, 0, 0 },
-  { 138352260.00941816, 46324516.02261667, 138352240.60476762, 46324481.0446302, 138352279.4140687, 46324551.00060314, 138352259.03918564, 46324514.273717344, 138352260.97965068, 46324517.771515995, 0, 0, 0, 0, 0 },
-  { 138352242.8390469, 46324525.54818082, 138352223.38185936, 46324490.59939182, 138352262.29623443, 46324560.49696982, 138352241.8661875, 46324523.80074137, 138352243.81190628, 46324527.29562027, 1, 0, 138352413.5758676, 46324832.22380433, 27 },
-  { 138352225.69106397, 46324535.09505009, 138352206.18784574, 46324500.171927676, 138352245.1942822, 46324570.0181725, 138352224.71590307, 46324533.34889397, 138352226.66622487, 46324536.84120621, 0, 0, 0, 0, 0 },
-  { 138352208.56266117, 46324544.66060307, 138352189.01992095, 46324509.759581536, 138352228.1054014, 46324579.5616246, 138352207.58552417, 46324542.91555199, 138352209.53979817, 46324546.40565415, 0, 0, 0, 0, 0 },
-  { 138352191.4510301, 46324554.24221834, 138352171.87527803, 46324519.35970223, 138352211.02678218, 46324589.12473445, 138352190.4722425, 46324552.49809253, 138352192.4298177, 46324555.986344144, 0, 0, 0, 0, 0 },
-  { 138352174.35336262, 46324563.83727447, 138352154.75111002, 46324528.96964346, 138352193.95561522, 46324598.70490548, 138352173.37324998, 46324562.09389292, 138352175.33347526, 46324565.58065602, 0, 0, 0, 0, 0 },
-  { 138352157.2668505, 46324573.443150096, 138352137.6446099, 46324538.58676369, 138352176.8890911, 46324608.299536504, 138352156.28573847, 46324571.70033077, 138352158.24796253, 46324575.18596942, 1, 0, 138352073.87232792, 46324425.30350785, 41 },
-  { 138352140.18868536, 46324583.05722373, 138352120.5529695, 46324548.208426595, 138352159.82440123, 46324617.906020865, 138352139.20689955, 46324581.31478387, 138352141.17047116, 46324584.79966359, 1, 0, 138352320.83727148, 46324903.66615738, 33 },
-  { 138352123.116059, 46324592.67687399, 138352103.47338086, 46324557.83200069, 138352142.75873715, 46324627.52174729, 138352122.1339251, 46324590.93463033, 138352124.0981929, 46324594.41911765, 0, 0, 0, 0, 0 },
-  { 138352106.0461632, 46324602.29947948, 138352086.40303582, 46324567.45485942, 138352125.68929058, 46324637.14409953, 138352105.06400684, 46324600.55724847, 138352107.02831957, 46324604.04171048, 0, 0, 0, 0, 0 },
-  { 138352088.97618973, 46324611.92241876, 138352069.33912596, 46324577.07438113, 138352108.6132535, 46324646.77045639, 138352087.99433655, 46324610.180016875, 138352089.95804292, 46324613.66482064, 0, 0, 0, 0, 0 },
-  { 138352071.90333024, 46324621.543070406, 138352052.27884215, 46324586.68794929, 138352091.52781832, 46324656.39819152, 138352070.92210582, 46324619.80031435, 138352072.88455465, 46324623.28582646, 0, 0, 0, 0, 0 },
-  { 138352054.82477653, 46324631.15881302, 138352035.2193756, 46324596.29295215, 138352074.43017745, 46324666.024673894, 138352053.84450647, 46324629.415519975, 138352055.8050466, 46324632.90210607, 0, 0, 0, 0, 0 },
-  { 138352037.7377203, 46324640.767025165, 138352018.15791675, 46324605.886783004, 138352057.31752387, 46324675.64726733, 138352036.75873014, 46324639.023013055, 138352038.71671048, 46324642.511037275, 0, 0, 0, 0, 0 },
-  { 138352020.63935333, 46324650.36508543, 138352001.0916559, 46324615.46684012, 138352040.18705076, 46324685.26333074, 138352019.66196847, 46324648.62017316, 138352021.6167382, 46324652.1099977, 0, 0, 0, 0, 0 },
-  { 138352003.52686742, 46324659.95037242, 138351984.01778325, 46324625.030526556, 138352023.03595158, 46324694.870218284, 138352002.5514132, 46324658.204380125, 138352004.50232163, 46324661.696364716, 0, 0, 0, 0, 0 },
-  { 138351986.39745423, 46324669.52026471, 138351966.9334882, 46324634.57525038, 138352005.86142027, 46324704.465279035, 138351985.42425594, 46324667.773013994, 138351987.37065253, 46324671.26751542, 0, 0, 0, 0, 0 },
-  { 138351969.24830547, 46324679.07214086, 138351949.83595955, 46324644.098424636, 138351988.6606514, 46324714.04585708, 138351968.27768818, 46324677.32345504, 138351970.21892276, 46324680.82082667, 1, 4, 138352033.30904698, 46324794.48540438, 44 },
-  { 138351952.07661298, 46324688.60337947, 138351932.72238606, 46324653.59746712, 138351971.4308399, 46324723.60929183, 138351951.10890162, 46324686.85308386, 138351953.04432434, 46324690.35367509, 0, 0, 0, 0, 0 },
-  { 138351934.87956846, 46324698.11135912, 138351915.58995533, 46324663.06980056, 138351954.1691816, 46324733.152917676, 138351933.9150878, 46324696.35928119, 138351935.84404913, 46324699.86343705, 0, 0, 0, 0, 0 },
-  { 138351917.65436363, 46324707.59345839, 138351898.4358544, 46324672.5128526, 138351936.87287286, 46324742.67406418, 138351916.69343817, 46324705.839428104, 138351918.6152891, 46324709.34748868, 1, 0, 138351818.19857836, 46324526.051323414, 31 },
-  { 138351900.3981903, 46324717.04705588, 138351881.25726947, 46324681.924055584, 138351919.5391111, 46324752.17005617, 138351899.44114426, 46324715.29090586, 138351901.35523632, 46324718.80320589, 0, 0, 0, 0, 0 },
-  { 138351883.10824016, 46324726.46953015, 138351864.05138564, 46324691.300846696, 138351902.16509467, 46324761.638213605, 138351882.15539744, 46324724.711095974, 138351884.06108287, 46324728.22796433, 0, 0, 0, 0, 0 },
-  { 138351865.78170493, 46324735.8582598, 138351846.81538674, 46324700.64066796, 138351884.74802312, 46324771.075851634, 138351864.833389, 46324734.097380206, 138351866.73002085, 46324737.61913939, 0, 0, 0, 0, 0 },
-  { 138351848.41577646, 46324745.21062342, 138351829.5464559, 46324709.940965906, 138351867.28509703, 46324780.480280936, 138351847.47231042, 46324743.447140545, 138351849.3592425, 46324746.9741063, 0, 0, 0, 0, 0 },
-  { 138351831.00764638, 46324754.523999564, 138351812.24177405, 46324719.19919191, 138351849.7735187, 46324789.848807216, 138351830.06935278, 46324752.75775918, 138351831.94594, 46324756.290239945, 0, 0, 0, 0, 0 },
-  { 138351813.55450645, 46324763.795766845, 138351794.89852098, 46324728.41280193, 138351832.21049193, 46324799.17873176, 138351812.62170717, 46324762.0266186, 138351814.48730573, 46324765.56491509, 0, 0, 0, 0, 0 },
-  { 138351796.05354849, 46324773.02330383, 138351777.51387486, 46324737.57925635, 138351814.5932221, 46324808.46735131, 138351795.1265648, 46324771.25110146, 138351796.98053217, 46324774.7955062, 0, 0, 0, 0, 0 },
-  { 138351778.50196418, 46324782.2039891, 138351760.08501172, 46324746.69602012, 138351796.91891664, 46324817.71195809, 138351777.58111656, 46324780.428590655, 138351779.4228118, 46324783.97938755, 0, 0, 0, 0, 0 },
-  { 138351760.89694524, 46324791.33520123, 138351742.60910526, 46324755.76056267, 138351779.18478522, 46324826.909839794, 138351759.98255324, 46324789.55646931, 138351761.81133723, 46324793.11393316, 0, 0, 0, 0, 0 },
-  { 138351743.23568356, 46324800.414318845, 138351725.0836494, 46324764.770193726, 138351761.38771772, 46324836.05844396, 138351742.32808185, 46324798.632112585, 138351744.14328527, 46324802.196525104, 0, 0, 0, 0, 0 },
-  { 138351725.51535308, 46324809.43852811, 138351707.52618995, 46324773.711927235, 138351743.5045162, 46324845.16512899, 138351724.6158949, 46324807.65219807, 138351726.41481125, 46324811.22485816, 1, 4, 138351788.02769494, 46324933.58846616, 33 },
-  { 138351707.7320152, 46324818.392846696, 138351689.96531898, 46324782.55509418, 138351725.4987114, 46324854.23059921, 138351706.84368038, 46324816.60095907, 138351708.62035, 46324820.18473432, 0, 0, 0, 0, 0 },
-  { 138351689.87997243, 46324827.24306186, 138351672.39895064, 46324791.26509809, 138351707.36099422, 46324863.22102564, 138351689.00592133, 46324825.44416367, 138351690.75402352, 46324829.04196005, 1, 2, 138351817.49143147, 46325089.88219741, 37 },
-  { 138351671.95337206, 46324835.95326274, 138351654.82231313, 46324799.8073526, 138351689.084431, 46324872.099172875, 138351671.0968191, 46324834.14596723, 138351672.80992502, 46324837.76055825, 0, 0, 0, 0, 0 },
-  { 138351653.94636127, 46324844.48753846, 138351637.23091, 46324808.14756475, 138351670.66181254, 46324880.82751217, 138351653.1105887, 46324842.670539774, 138351654.78213385, 46324846.30453714, 0, 0, 0, 0, 0 },
-  { 138351635.85308728, 46324852.80997815, 138351619.6204802, 46324816.25177158, 138351652.08569434, 46324889.36818472, 138351635.04145694, 46324850.98206782, 138351636.6647176, 46324854.637888476, 0, 0, 0, 0, 0 },
-  { 138351617.66769743, 46324860.88467096, 138351601.98694804, 46324824.08638161, 138351633.34844682, 46324897.68296031, 138351616.88365996, 46324859.04475649, 138351618.4517349, 46324862.72458543, 1, 0, 138351768.20289144, 46325214.14824871, 26 },
-  { 138351599.38433892, 46324868.67570602, 138351584.32636023, 46324831.6182199, 138351614.4423176, 46324905.733192146, 138351598.63143998, 46324866.82283171, 138351600.13723785, 46324870.52858033, 0, 0, 0, 0, 0 },
-  { 138351580.99715897, 46324876.14717246, 138351566.63480943, 46324838.814573884, 138351595.3595085, 46324913.47977103, 138351580.2790415, 46324874.28054253, 138351581.71527645, 46324878.01380239, 1, 5, 138351635.21502843, 46325017.077732064, 35 },
-  { 138351562.50030482, 46324883.26315942, 138351548.90834153, 46324845.643237375, 138351576.0922681, 46324920.88308146, 138351561.82070667, 46324881.382163316, 138351563.17990297, 46324885.14415552, 1, 3, 138351510.1712462, 46324738.426459566, 32 },
-  { 138351543.88792375, 46324889.98775602, 138351531.1428447, 46324852.07254851, 138351556.6330028, 46324927.902963534, 138351543.2506698, 46324888.09199565, 138351544.5251777, 46324891.88351639, 0, 0, 0, 0, 0 },
-  { 138351525.154163, 46324896.285051405, 138351513.33391982, 46324858.07141704, 138351536.97440618, 46324934.49868577, 138351524.56315085, 46324894.37436969, 138351525.74517515, 46324898.19573312, 0, 0, 0, 0, 0 },
-  { 138351506.29316977, 46324902.11913472, 138351495.47673258, 46324863.609334834, 138351517.10960695, 46324940.6289346, 138351505.75234792, 46324900.193644725, 138351506.83399162, 46324904.04462471, 0, 0, 0, 0, 0 },
-  { 138351487.29909134, 46324907.45409508, 138351477.5658501, 46324868.656362996, 138351497.03233257, 46324946.251827165, 138351486.81242928, 46324905.51420847, 138351487.7857534, 46324909.39398169, 1, 0, 138351410.16315454, 46324599.9820683, 36 },
-  { 138351468.16607493, 46324912.25402163, 138351459.5950655, 46324873.183088735, 138351476.73708436, 46324951.324954525, 138351467.73752445, 46324910.30047499, 138351468.5946254, 46324914.20756827, 0, 0, 0, 0, 0 },
-  { 138351448.88826784, 46324916.48300349, 138351441.55721834, 46324877.160545364, 138351456.21931735, 46324955.805461615, 138351448.52171537, 46324914.51688059, 138351449.25482032, 46324918.44912639, 0, 0, 0, 0, 0 },
-  { 138351429.45982, 46324920.10512987, 138351423.44097123, 46324880.560554266, 138351435.47866878, 46324959.64970547, 138351429.15887755, 46324918.127901085, 138351429.76076245, 46324922.08235865, 0, 0, 0, 0, 0 },
-  { 138351409.8836607, 46324923.08470268, 138351405.23944062, 46324883.355227225, 138351414.5278808, 46324962.81417813, 138351409.6514497, 46324921.0982289, 138351410.1158717, 46324925.071176454, 0, 0, 0, 0, 0 },
-  { 138351390.19091967, 46324925.38670698, 138351386.9855734, 46324885.51534187, 138351393.39626592, 46324965.258072086, 138351390.03065234, 46324923.39313872, 138351390.351187, 46324927.380275235, 0, 0, 0, 0, 0 },
-  { 138351370.4183782, 46324926.97626484, 138351368.71976638, 46324887.01234714, 138351372.11699003, 46324966.940182544, 138351370.3334476, 46324924.978068955, 138351370.5033088, 46324928.97446073, 0, 0, 0, 0, 0 },
-  { 138351350.60281754, 46324927.818498224, 138351350.4816768, 46324887.818681665, 138351350.72395828, 46324967.81831478, 138351350.5967605, 46324925.818507396, 138351350.60887456, 46324929.81848905, 1, 3, 138351351.78393975, 46325317.8167097, 50 },
-  { 138351330.78101897, 46324927.87852918, 138351332.3099694, 46324887.907760985, 138351329.25206855, 46324967.84929738, 138351330.8574665, 46324925.87999077, 138351330.70457146, 46324929.877067596, 0, 0, 0, 0, 0 },
-  { 138351310.98976374, 46324927.12147973, 138351314.24201748, 46324887.25391339, 138351307.73751, 46324966.98904607, 138351311.1523764, 46324925.12810141, 138351310.82715106, 46324929.114858046, 0, 0, 0, 0, 0 },
-  { 138351291.26583296, 46324925.51247187, 138351296.2541756, 46324885.824735254, 138351286.27749032, 46324965.200208485, 138351291.5152501, 46324923.52808504, 138351291.01641583, 46324927.4968587, 0, 0, 0, 0, 0 },
-  { 138351271.64123684, 46324923.04586083, 138351278.14559853, 46324883.57823765, 138351265.13687515, 46324962.513484, 138351271.96645492, 46324921.072479665, 138351271.31601876, 46324925.01924199, 0, 0, 0, 0, 0 },
-  { 138351252.12933853, 46324919.83025184, 138351259.87669224, 46324880.5876919, 138351244.38198483, 46324959.07281178, 138351252.51670623, 46324917.868123844, 138351251.74197084, 46324921.79237984, 0, 0, 0, 0, 0 },
-  { 138351232.73894647, 46324916.0021574, 138351241.46361905, 46324876.96525065, 138351224.01427388, 46324955.03906415, 138351233.1751801, 46324914.05031206, 138351232.30271283, 46324917.95400274, 1, 5, 138351207.437396, 46325029.20918697, 48 },
-  { 138351213.47875234, 46324911.69754155, 138351222.99715453, 46324872.846543886, 138351203.96035016, 46324950.548539214, 138351213.95467246, 46324909.754991665, 138351213.00283223, 46324913.640091434, 1, 1, 138351291.7676104, 46324592.14808575, 43 },
-  { 138351194.34857675, 46324907.010693945, 138351204.60622033, 46324868.34829945, 138351184.09093317, 46324945.67308844, 138351194.86145893, 46324905.07757422, 138351193.83569458, 46324908.94381367, 0, 0, 0, 0, 0 },
-  { 138351175.33329335, 46324901.965688266, 138351186.28639948, 46324863.49453718, 138351164.3801872, 46324940.43683935, 138351175.88094866, 46324900.04213071, 138351174.78563803, 46324903.88924582, 1, 5, 138351230.3726517, 46324708.64815405, 37 },
-  { 138351156.4163396, 46324896.579849884, 138351168.0198248, 46324858.29984033, 138351144.8128544, 46324934.85985944, 138351156.99651387, 46324894.6658494, 138351155.83616534, 46324898.493850365, 0, 0, 0, 0, 0 },
-  { 138351137.58115268, 46324890.87050407, 138351149.78899416, 46324852.77892224, 138351125.3733112, 46324928.962085895, 138351138.19154474, 46324888.96592498, 138351136.9707606, 46324892.775083154, 0, 0, 0, 0, 0 },
-  { 138351118.81116983, 46324884.85497612, 138351131.57673973, 46324846.94666272, 138351106.04559994, 46324922.76328952, 138351119.44944832, 46324882.95956045, 138351118.17289135, 46324886.75039179, 0, 0, 0, 0, 0 },
-  { 138351100.0898284, 46324878.55059137, 138351113.3661928, 46324840.81813653, 138351086.81346402, 46324916.283046216, 138351100.7536466, 46324876.66396863, 138351099.4260102, 46324880.437214114, 0, 0, 0, 0, 0 },
-  { 138351081.40056565, 46324871.974675134, 138351095.1407465, 46324834.408634216, 138351067.6603848, 46324909.54071605, 138351082.0875747, 46324870.09637309, 138351080.71355662, 46324873.85297718, 0, 0, 0, 0, 0 },
-  { 138351062.72681877, 46324865.144552685, 138351076.8840188, 46324827.7336761, 138351048.56961873, 46324902.55542927, 138351063.43467876, 46324863.274008855, 138351062.01895878, 46324867.015096515, 1, 5, 138351176.692279, 46324563.98699613, 44 },
-  { 138351044.0520252, 46324858.07754939, 138351058.60472998, 46324820.818741255, 138351029.49932042, 46324895.33635753, 138351044.77966043, 46324856.21460898, 138351043.32438996, 46324859.9404898, 0, 0, 0, 0, 0 },
-  { 138351025.36898574, 46324850.78024786, 138351040.8854708, 46324813.91239342, 138351009.85250068, 46324887.6481023, 138351026.14481, 46324848.93685514, 138351024.5931615, 46324852.62364058, 0, 0, 0, 0, 0 },
-  { 138351006.89278308, 46324843.00421296, 138351024.53713322, 46324807.10606665, 138350989.24843293, 46324878.90235927, 138351007.77500057, 46324841.209305644, 138351006.01056558, 46324844.79912028, 0, 0, 0, 0, 0 },
-  { 138350989.06469426, 46324834.24150308, 138351009.99084875, 46324800.15197305, 138350968.13853976, 46324868.33103312, 138350990.11100197, 46324832.537026584, 138350988.01838654, 46324835.94597958, 0, 0, 0, 0, 0 },
-  { 138350972.33614245, 46324823.972536065, 138350997.4799051, 46324792.863193415, 138350947.1923798, 46324855.081878714, 138350973.5933306, 46324822.41706893, 138350971.0789543, 46324825.5280032, 0, 0, 0, 0, 0 },
-  { 138350957.1468881, 46324811.69599875, 138350986.24157032, 46324784.24605401, 138350928.0522059, 46324839.14594349, 138350958.60162222, 46324810.32350151, 138350955.692154, 46324813.06849599, 0, 0, 0, 0, 0 },
-  { 138350943.63829428, 46324797.37800109, 138350975.5618006, 46324773.27634669, 138350911.71478796, 46324821.47965548, 138350945.2344696, 46324796.172918364, 138350942.04211897, 46324798.58308381, 0, 0, 0, 0, 0 },
-  { 138350931.6355452, 46324781.47992911, 138350965.495905, 46324760.1849524, 138350897.77518538, 46324802.77490582, 138350933.32856318, 46324780.41518027, 138350929.9425272, 46324782.54467795, 1, 0, 138351144.95581204, 46324647.32157582, 32 },
-  { 138350920.9486026, 46324764.48701445, 138350956.10396883, 46324745.40560401, 138350885.79323635, 46324783.56842489, 138350922.7063709, 46324763.53294393, 138350919.19083428, 46324765.44108497, 1, 2, 138350666.95108148, 46324902.35020486, 45 },
-  { 138350911.3896706, 46324746.875750564, 138350947.49810335, 46324729.66583816, 138350875.28123787, 46324764.08566297, 138350913.19509226, 46324746.015254945, 138350909.58424896, 46324747.73624618, 0, 0, 0, 0, 0 },
-  { 138350902.8260004, 46324728.90815707, 138350939.73062268, 46324713.4793252, 138350865.9213781, 46324744.33698895, 138350904.6712315, 46324728.13671548, 138350900.98076928, 46324729.67959867, 1, 5, 138350709.07673332, 46324809.90952441, 31 },
-  { 138350895.1818857, 46324710.624001265, 138350932.74466833, 46324696.87491551, 138350857.61910304, 46324724.37308702, 138350897.06002483, 46324709.936546974, 138350893.30374655, 46324711.311455555, 0, 0, 0, 0, 0 },
-  { 138350888.3842625, 46324692.0527561, 138350926.48183927, 46324679.86363621, 138350850.28668573, 46324704.24187599, 138350890.28914133, 46324691.443300106, 138350886.47938368, 46324692.662212096, 0, 0, 0, 0, 0 },
-  { 138350882.36006698, 46324673.2238945, 138350920.88498762, 46324662.46143709, 138350843.83514634, 46324683.98635191, 138350884.286313, 46324672.68577163, 138350880.43382096, 46324673.76201737, 0, 0, 0, 0, 0 },
-  { 138350877.03623497, 46324654.16688942, 138350915.89703637, 46324644.688592404, 138350838.17543358, 46324663.64518644, 138350878.97927505, 46324653.69297457, 138350875.0931949, 46324654.640804276, 1, 5, 138350651.64358684, 46324709.1410121, 42 },
-  { 138350872.33970258, 46324634.91121379, 138350911.46010473, 46324626.568903804, 138350833.21930042, 46324643.25352378, 138350874.2957227, 46324634.49409829, 138350870.38368246, 46324635.328329295, 0, 0, 0, 0, 0 },
-  { 138350868.19740584, 46324615.48634056, 138350907.51492515, 46324608.12884943, 138350828.87988654, 46324622.84383169, 138350870.1632818, 46324615.118466005, 138350866.2315299, 46324615.854215115, 0, 0, 0, 0, 0 },
-  { 138350864.53628078, 46324595.92174268, 138350904.00050214, 46324589.39677281, 138350825.07205942, 46324602.446712546, 138350866.50949186, 46324595.59549418, 138350862.5630697, 46324596.247991174, 1, 0, 138350965.17004526, 46324579.283069514, 41 },
-  { 138350861.28326333, 46324576.246893056, 138350900.85394928, 46324570.402167775, 138350821.71257737, 46324582.09161834, 138350863.26179764, 46324575.954656795, 138350859.304729, 46324576.53912932, 1, 5, 138350630.78401768, 46324610.29241781, 39 },
-  { 138350858.36528963, 46324556.49126465, 138350898.01054102, 46324551.17581144, 138350818.72003824, 46324561.80671786, 138350860.3475522, 46324556.225491986, 138350856.38302705, 46324556.75703731, 0, 0, 0, 0, 0 },
-  { 138350855.70962963, 46324536.68405267, 138350895.4063826, 46324531.76797664, 138350816.01287666, 46324541.600128695, 138350857.69446728, 46324536.438248865, 138350853.72479197, 46324536.92985647, 0, 0, 0, 0, 0 },
-  { 138350853.25294915, 46324516.84663813, 138350892.98481685, 46324512.2229287, 138350813.52108145, 46324521.47034755, 138350855.23954254, 46324516.615452655, 138350851.26635575, 46324517.0778236, 0, 0, 0, 0, 0 },
-  { 138350850.94237435, 46324496.99170265, 138350890.69549918, 46324492.55446624, 138350811.18924952, 46324501.42893907, 138350852.93003058, 46324496.76984083, 138350848.9547181, 46324497.21356448, 0, 0, 0, 0, 0 },
-  { 138350848.72557914, 46324477.13147248, 138350888.4876046, 46324472.77471539, 138350808.9635537, 46324481.48822958, 138350850.71368042, 46324476.91363463, 138350846.73747787, 46324477.34931034, 1, 5, 138351212.54811198, 46324437.267145015, 49 },
-  { 138350846.55023724, 46324457.27817377, 138350886.30943897, 46324452.89572261, 138350806.7910355, 46324461.66062492, 138350848.53819734, 46324457.05905121, 138350844.56227714, 46324457.497296326, 1, 1, 138350735.2244724, 46324469.54903699, 32 },
-  { 138350844.36402246, 46324437.44403272, 138350884.10843515, 46324432.92942767, 138350804.61960977, 46324441.958637774, 138350846.3512431, 46324437.218302466, 138350842.37680182, 46324437.66976298, 1, 1, 138351079.84966773, 46324410.69499779, 45 },
-  { 138350842.11460873, 46324417.64127555, 138350881.8311448, 46324412.88767031, 138350802.39807266, 46324422.39488079, 138350844.10043553, 46324417.40359528, 138350840.12878194, 46324417.87895581, 0, 0, 0, 0, 0 },
-  { 138350839.74966973, 46324397.88212842, 138350879.42322615, 46324392.78223419, 138350800.0761133, 46324402.98202264, 138350841.73334756, 46324397.627133705, 138350837.7659919, 46324398.13712313, 1, 4, 138351224.583167, 46324348.41315444, 46 },
-  { 138350837.21687937, 46324378.17881754, 138350876.8294312, 46324372.62492368, 138350797.60432753, 46324383.7327114, 138350839.19750696, 46324377.901122846, 138350835.23625177, 46324378.456512235, 0, 0, 0, 0, 0 },
-  { 138350834.4639114, 46324358.54356909, 138350873.9935954, 46324352.427681185, 138350794.93422744, 46324364.65945699, 138350836.44039562, 46324358.23777469, 138350832.4874272, 46324358.84936348, 0, 0, 0, 0, 0 },
-  { 138350831.43843967, 46324338.988609284, 138350870.8586377, 46324332.20274254, 138350792.01824164, 46324345.77447603, 138350833.40944958, 46324338.649315946, 138350829.46742976, 46324339.32790262, 0, 0, 0, 0, 0 },
-  { 138350828.08813792, 46324319.5261643, 138350867.36658, 46324311.96283247, 138350788.80969584, 46324327.08949613, 138350830.05206004, 46324319.14799771, 138350826.1242158, 46324319.904330894, 0, 0, 0, 0, 0 },
-  { 138350824.36068004, 46324300.16846034, 138350863.4585973, 46324291.721397825, 138350785.26276278, 46324308.615522854, 138350826.3155759, 46324299.74610721, 138350822.4057842, 46324300.590813465, 1, 5, 138350665.03666717, 46324334.59024008, 39 },
-  { 138350820.2037398, 46324280.9277236, 138350859.07511255, 46324271.49287436, 138350781.33236703, 46324290.36257284, 138350822.14730844, 46324280.45598114, 138350818.26017115, 46324281.39946606, 0, 0, 0, 0, 0 },
-  { 138350815.5649911, 46324261.81618027, 138350854.15595013, 46324251.29297355, 138350776.97403204, 46324272.339386985, 138350817.49453905, 46324261.29001993, 138350813.63544312, 46324262.3423406, 0, 0, 0, 0, 0 },
-  { 138350810.39210764, 46324242.846056536, 138350848.64056206, 46324231.13897605, 138350772.1436532, 46324254.55313702, 138350812.30453035, 46324242.26070251, 138350808.47968492, 46324243.43141056, 1, 3, 138350960.51729128, 46324196.895765625, 30 },
-  { 138350804.63276324, 46324224.02957859, 138350842.46833628, 46324211.05000189, 138350766.7971902, 46324237.00915529, 138350806.52454188, 46324223.38059975, 138350802.7409846, 46324224.678557426, 1, 0, 138350454.65371245, 46324344.09066307, 44 },
-  { 138350798.23463178, 46324205.37897265, 138350835.57898948, 46324191.04722646, 138350760.89027408, 46324219.71071884, 138350800.10184968, 46324204.66238534, 138350796.36741388, 46324206.09555996, 0, 0, 0, 0, 0 },
-  { 138350791.145387, 46324186.906464875, 138350827.91237554, 46324171.15246366, 138350754.37839845, 46324202.66046609, 138350792.98373643, 46324186.11876481, 138350789.30703756, 46324187.69416494, 1, 1, 138350632.1281616, 46324255.042520136, 28 },
-  { 138350783.31278357, 46324168.6265856, 138350819.38982686, 46324151.3509685, 138350747.23574027, 46324185.9022027, 138350785.11663574, 46324167.76280475, 138350781.5089314, 46324169.49036646, 1, 1, 138350912.2882134, 46324106.86625447, 25 },
-  { 138350774.68662715, 46324150.61239734, 138350809.91926807, 46324131.674049646, 138350739.45398623, 46324169.55074504, 138350776.4482592, 46324149.66547996, 138350772.9249951, 46324151.55931473, 0, 0, 0, 0, 0 },
-  { 138350765.2188886, 46324132.99874711, 138350799.41918838, 46324112.254121415, 138350731.01858884, 46324153.743372805, 138350766.9289036, 46324131.96151583, 138350763.5088736, 46324134.03597839, 1, 1, 138350948.19049242, 46324022.01499965, 50 },
-  { 138350754.86164272, 46324115.92343712, 138350787.80431652, 46324093.23466803, 138350721.91896892, 46324138.612206206, 138350756.5087764, 46324114.78899866, 138350753.21450904, 46324117.05787557, 0, 0, 0, 0, 0 },
-  { 138350743.56696373, 46324099.52426958, 138350774.98587513, 46324074.76842165, 138350712.14805233, 46324124.28011751, 138350745.1379093, 46324098.286477186, 138350741.99601817, 46324100.762061976, 0, 0, 0, 0, 0 },
-  { 138350731.28692633, 46324083.93904672, 138350760.87430093, 46324057.020888075, 138350701.69955173, 46324110.85720536, 138350732.76629505, 46324082.593138784, 138350729.8075576, 46324085.28495465, 1, 3, 138350649.18196183, 46324158.636936955, 38 },
-  { 138350717.97360486, 46324069.305570684, 138350745.39117563, 46324040.18037863, 138350690.5560341, 46324098.43076274, 138350719.3444834, 46324067.84931108, 138350716.6027263, 46324070.761830285, 0, 0, 0, 0, 0 },
-  { 138350703.58212665, 46324055.757870406, 138350728.8672407, 46324024.763306245, 138350678.2970126, 46324086.75243457, 138350704.84638235, 46324054.2081422, 138350702.31787094, 46324057.30759861, 0, 0, 0, 0, 0 },
-  { 138350688.2278221, 46324043.231953286, 138350712.08002654, 46324011.12163808, 138350664.37561765, 46324075.34226849, 138350689.42043233, 46324041.62643752, 138350687.03521186, 46324044.83746905, 0, 0, 0, 0, 0 },
-  { 138350672.26196536, 46324031.37218559, 138350695.5062375, 46323998.81909337, 138350649.01769322, 46324063.92527781, 138350673.42417896, 46324029.744530976, 138350671.09975177, 46324032.9998402, 0, 0, 0, 0, 0 },
-  { 138350656.05474642, 46324019.79955202, 138350679.54358658, 46323987.42248625, 138350632.56590626, 46324052.176617794, 138350657.22918844, 46324018.18069874, 138350654.8803044, 46324021.41840531, 0, 0, 0, 0, 0 },
-  { 138350639.97635537, 46324008.13503739, 138350664.55684295, 46323976.57874435, 138350615.3958678, 46324039.69133043, 138350641.20537975, 46324006.55722274, 138350638.747331, 46324009.712852046, 0, 0, 0, 0, 0 },
-  { 138350624.39698234, 46323995.999626406, 138350650.8684553, 46323966.0119436, 138350597.9255094, 46324025.98730921, 138350625.720556, 46323994.50024226, 138350623.0734087, 46323997.49901055, 1, 3, 138350886.46456453, 46323699.12156666, 47 },
-  { 138350609.68681738, 46323983.01430385, 138350638.71258962, 46323955.49150337, 138350580.66104513, 46324010.53710432, 138350611.138106, 46323981.63816383, 138350608.23552877, 46323984.39044387, 1, 3, 138350460.92973468, 46324124.068656296, 46 },
-  { 138350596.21238115, 46323968.804052345, 138350627.71050176, 46323944.14906505, 138350564.71426055, 46323993.45903964, 138350597.78728718, 46323967.57130298, 138350594.63747513, 46323970.03680171, 0, 0, 0, 0, 0 },
-  { 138350584.0686251, 46323953.289727055, 138350617.12949902, 46323930.773541436, 138350551.00775117, 46323975.80591267, 138350585.72166878, 46323952.16391777, 138350582.4155814, 46323954.41553634, 0, 0, 0, 0, 0 },
-  { 138350572.8970065, 46323936.886261575, 138350606.75308612, 46323915.58448056, 138350539.0409269, 46323958.18804259, 138350574.5898105, 46323935.82117252, 138350571.20420253, 46323937.95135063, 1, 1, 138350726.94216868, 46323839.96315795, 31 },
-  { 138350562.30245957, 46323920.04777167, 138350596.58335593, 46323899.43660613, 138350528.0215632, 46323940.65893721, 138350564.01650438, 46323919.0172134, 138350560.58841476, 46323921.07832994, 0, 0, 0, 0, 0 },
-  { 138350552.06525257, 46323903.02104742, 138350586.72102913, 46323883.046634994, 138350517.409476, 46323922.99545985, 138350553.7980414, 46323902.0223268, 138350550.33246374, 46323904.019768044, 0, 0, 0, 0, 0 },
-  { 138350542.15579212, 46323885.8280487, 138350577.1531381, 46323866.45833591, 138350507.15844613, 46323905.19776148, 138350543.9056594, 46323884.85956306, 138350540.40592483, 46323886.79653434, 0, 0, 0, 0, 0 },
-  { 138350532.55400893, 46323868.47947301, 138350567.86124846, 46323849.68056783, 138350497.2467694, 46323887.27837819, 138350534.3193709, 46323867.53952775, 138350530.78864697, 46323869.41941827, 0, 0, 0, 0, 0 },
-  { 138350523.23983404, 46323850.98601789, 138350558.82693887, 46323832.72244841, 138350487.6527292, 46323869.24958737, 138350525.01918927, 46323850.07283942, 138350521.4604788, 46323851.899196364, 0, 0, 0, 0, 0 },
-  { 138350514.19319832, 46323833.35838087, 138350550.0317682, 46323815.593333445, 138350478.35462844, 46323851.12342829, 138350515.98512682, 46323832.4701285, 138350512.40126982, 46323834.24663324, 0, 0, 0, 0, 0 },
-  { 138350505.39403266, 46323815.60725947, 138350541.45724747, 46323798.30279364, 138350469.33081785, 46323832.9117253, 138350507.19719338, 46323814.74203618, 138350503.59087193, 46323816.472482756, 1, 0, 138350381.87752193, 46323874.87505495, 48 },
-  { 138350496.822268, 46323797.74335123, 138350533.08481592, 46323780.860590205, 138350460.5597201, 46323814.62611225, 138350498.6353954, 46323796.89921318, 138350495.0091406, 46323798.58748928, 1, 3, 138350654.56435138, 46323724.303340785, 26 },
-  { 138350488.45783526, 46323779.77735367, 138350524.89582127, 46323763.276651405, 138350452.01984924, 46323796.27805593, 138350490.27973455, 46323778.95231856, 138350486.63593596, 46323780.60238878, 0, 0, 0, 0, 0 },
-  { 138350480.28066528, 46323761.71996432, 138350516.8715039, 46323745.56104947, 138350443.68982667, 46323777.87887917, 138350482.1102072, 46323760.912018575, 138350478.45112336, 46323762.52791006, 0, 0, 0, 0, 0 },
-  { 138350472.270689, 46323743.58188069, 138350508.99298385, 46323727.72397848, 138350435.54839417, 46323759.439782895, 138350474.10680375, 46323742.78898558, 138350470.43457428, 46323744.3747758, 0, 0, 0, 0, 0 },
-  { 138350464.40783733, 46323725.37380034, 138350501.24125096, 46323709.775735036, 138350427.5744237, 46323740.97186564, 138350466.24950802, 46323724.593897074, 138350462.56616664, 46323726.1537036, 0, 0, 0, 0, 0 },
-  { 138350456.67204118, 46323707.10642077, 138350493.59715703, 46323691.726699755, 138350419.74692532, 46323722.486141786, 138350458.51829696, 46323706.33743472, 138350454.8257854, 46323707.875406824, 0, 0, 0, 0, 0 },
-  { 138350449.0432315, 46323688.790439524, 138350486.04140994, 46323673.58732174, 138350412.04505304, 46323703.993557304, 138350450.8931404, 46323688.03028364, 138350447.19332257, 46323689.55059541, 0, 0, 0, 0, 0 },
-  { 138350441.50133908, 46323670.436554134, 138350478.55456927, 46323655.36810593, 138350404.44810888, 46323685.505002335, 138350443.3540006, 46323669.683131725, 138350439.64867756, 46323671.18997654, 0, 0, 0, 0, 0 },
-  { 138350434.0262949, 46323652.0554621, 138350471.1170431, 46323637.07960165, 138350396.93554667, 46323667.03132255, 138350435.88083228, 46323651.30666908, 138350432.1717575, 46323652.80425512, 0, 0, 0, 0, 0 },
-  { 138350426.59802988, 46323633.65786097, 138350463.70908552, 46323618.73239449, 138350389.48697424, 46323648.58332746, 138350428.45358267, 46323632.91158765, 138350424.7424771, 46323634.404134296, 0, 0, 0, 0, 0 },
-  { 138350419.19647488, 46323615.25444827, 138350456.31079507, 46323600.337101415, 138350382.0821547, 46323630.17179513, 138350421.0521909, 46323614.50858093, 138350417.34075886, 46323616.000315614, 0, 0, 0, 0, 0 },
-  { 138350411.8015609, 46323596.855921544, 138350448.9021135, 46323581.90436652, 138350374.70100832, 46323611.807476565, 138350413.65658852, 46323596.108343795, 138350409.9465333, 46323597.60349929, 0, 0, 0, 0, 0 },
-  { 138350404.39321876, 46323578.47297829, 138350441.46282515, 46323563.444861874, 138350367.32361236, 46323593.5010947, 138350406.24669906, 46323577.721572466, 138350402.53973845, 46323579.22438411, 0, 0, 0, 0, 0 },
-  { 138350396.95137936, 46323560.116316035, 138350433.9725567, 46323544.96928902, 138350359.930202, 46323575.26334305, 138350398.80243823, 46323559.35896468, 138350395.1003205, 46323560.87366739, 1, 1, 138350213.69655147, 46323635.09409975, 47 },
-  { 138350389.45597365, 46323541.796632335, 138350426.4107776, 46323526.48838404, 138350352.5011697, 46323557.10488063, 138350391.30371386, 46323541.03121992, 138350387.60823345, 46323542.56204475, 0, 0, 0, 0, 0 },
-  { 138350381.88693255, 46323523.52462469, 138350418.75680065, 46323508.01292501, 138350345.01706445, 46323539.036324374, 138350383.73042595, 46323522.74903971, 138350380.04343915, 46323524.30020967, 1, 2, 138350202.14632562, 46323599.144160636, 34 },
-  { 138350374.2241869, 46323505.31099064, 138350410.98978415, 46323489.55374283, 138350337.45858964, 46323521.068238445, 138350376.06246677, 46323504.52312825, 138350372.38590702, 46323506.09885303, 1, 0, 138350520.367436, 46323442.67593061, 25 },
-  { 138350366.44766766, 46323487.16642771, 138350403.0887346, 46323471.121733434, 138350329.80660072, 46323503.211121984, 138350368.279721, 46323486.36419299, 138350364.61561432, 46323487.968662426, 1, 4, 138350032.09793195, 46323633.57426297, 40 },
-  { 138350358.5373057, 46323469.10163342, 138350395.03251094, 46323452.72787404, 138350322.0421005, 46323485.4753928, 138350360.36206597, 46323468.282945454, 138350356.71254545, 46323469.92032139, 0, 0, 0, 0, 0 },
-  { 138350350.47303203, 46323451.12730534, 138350386.79983073, 46323434.38324082, 138350314.14623332, 46323467.87136985, 138350352.28937197, 46323450.29010211, 138350348.6566921, 46323451.96450856, 1, 0, 138350248.75799567, 46323498.01068597, 39 },
-  { 138350342.2347774, 46323433.254140936, 138350378.36927867, 46323416.099030405, 138350306.1002761, 46323450.40925147, 138350344.04150245, 46323432.39638541, 138350340.42805234, 46323434.11189646, 0, 0, 0, 0, 0 },
-  { 138350333.80247286, 46323415.49283777, 138350369.7193176, 46323397.886581324, 138350297.88562813, 46323433.09909422, 138350335.5983151, 46323414.61252495, 138350332.00663063, 46323416.373150595, 0, 0, 0, 0, 0 },
-  { 138350325.15604916, 46323397.85409337, 138350360.82830322, 46323379.75740058, 138350289.4837951, 46323415.950786166, 138350326.93966186, 46323396.94925873, 138350323.37243646, 46323398.758928016, 0, 0, 0, 0, 0 },
-  { 138350316.27543736, 46323380.34860525, 138350351.6745026, 46323361.72318772, 138350280.8763721, 46323398.97402278, 138350318.0453906, 46323379.41733438, 138350314.5054841, 46323381.27987613, 0, 0, 0, 0, 0 },
-  { 138350307.14056832, 46323362.98707095, 138350342.23611683, 46323343.79586268, 138350272.0450198, 46323382.17827921, 138350308.89534575, 46323362.02751053, 138350305.38579088, 46323363.946631365, 0, 0, 0, 0, 0 },
-  { 138350297.7313729, 46323345.780187994, 138350332.49891642, 46323326.00095856, 138350262.96382937, 46323365.55941743, 138350299.46975008, 46323344.79122652, 138350295.9929957, 46323346.76914947, 0, 0, 0, 0, 0 },
-  { 138350288.03422043, 46323328.734722614, 138350322.5777092, 46323308.566743456, 138350253.49073166, 46323348.90270177, 138350289.76139486, 46323327.72632366, 138350286.307046, 46323329.74312157, 0, 0, 0, 0, 0 },
-  { 138350278.1424139, 46323311.792147234, 138350312.67902833, 46323291.61239834, 138350243.6057995, 46323331.97189613, 138350279.86924464, 46323310.78315979, 138350276.4155832, 46323312.801134676, 1, 2, 138350097.68860364, 46323417.23133521, 39 },
-  { 138350268.23735452, 46323294.840141594, 138350302.98728156, 46323275.0299783, 138350233.48742747, 46323314.65030489, 138350269.97485086, 46323293.84963343, 138350266.49985817, 46323295.830649756, 0, 0, 0, 0, 0 },
-  { 138350258.50307012, 46323277.76478145, 138350293.67321536, 46323258.71062487, 138350223.33292487, 46323296.81893803, 138350260.26157737, 46323276.812073626, 138350256.74456286, 46323278.71748928, 0, 0, 0, 0, 0 },
-  { 138350249.12358847, 46323260.45214258, 138350284.8936019, 46323242.54945731, 138350213.35357505, 46323278.35482785, 138350250.91208914, 46323259.55700832, 138350247.3350878, 46323261.347276844, 1, 2, 138350398.4633945, 46323185.708431564, 50 },
-  { 138350240.2829376, 46323242.78830076, 138350276.7900626, 46323226.44113515, 138350203.77581257, 46323259.13546637, 138350242.10829383, 46323241.97094248, 138350238.45758134, 46323243.60565904, 0, 0, 0, 0, 0 },
-  { 138350232.16514528, 46323224.659331754, 138350269.48859003, 46323210.27321094, 138350194.84170052, 46323239.045452565, 138350234.0313175, 46323223.94002572, 138350230.29897305, 46323225.37863779, 0, 0, 0, 0, 0 },
-  { 138350224.95423955, 46323205.95131135, 138350263.10129276, 46323193.917927295, 138350186.80718634, 46323217.984695405, 138350226.8615922, 46323205.34964215, 138350223.0468869, 46323206.55298055, 0, 0, 0, 0, 0 },
-  { 138350218.8342482, 46323186.55031533, 138350257.5629079, 46323176.545770586, 138350180.10558847, 46323196.55486007, 138350220.77068117, 46323186.05008809, 138350216.8978152, 46323187.05054256, 0, 0, 0, 0, 0 },
-  { 138350213.6741965, 46323166.57520496, 138350251.97824863, 46323155.051334456, 138350175.3701444, 46323178.09907547, 138350215.58939913, 46323165.999011435, 138350211.7589939, 46323167.15139849, 0, 0, 0, 0, 0 },
-  { 138350207.8578795, 46323147.24242, 138350243.67605925, 46323129.436297506, 138350172.03969973, 46323165.0485425, 138350209.64878848, 46323146.35211388, 138350206.0669705, 46323148.132726125, 0, 0, 0, 0, 0 },
-  { 138350199.33176494, 46323130.09158305, 138350228.2746381, 46323102.481619395, 138350170.3888918, 46323157.701546706, 138350200.77890858, 46323128.711084865, 138350197.8846213, 46323131.47208124, 1, 1, 138349932.33376002, 46323384.79349778, 43 },
-  { 138350186.33039114, 46323116.4625498, 138350207.39781913, 46323082.46014581, 138350165.26296315, 46323150.46495379, 138350187.38376254, 46323114.762429595, 138350185.27701974, 46323118.16267, 0, 0, 0, 0, 0 },
-  { 138350169.49090138, 46323106.0290305, 138350185.76225, 46323069.48805058, 138350153.21955276, 46323142.57001042, 138350170.3044688, 46323104.20198151, 138350168.67733395, 46323107.8560795, 1, 1, 138350094.64269763, 46323274.11753813, 29 },
-  { 138350150.64430326, 46323097.63682073, 138350165.18875116, 46323060.37478865, 138350136.09985536, 46323134.89885282, 138350151.37152565, 46323095.77371913, 138350149.91708088, 46323099.499922335, 0, 0, 0, 0, 0 },
-  { 138350131.54547653, 46323090.18199675, 138350145.2854291, 46323052.61587233, 138350117.80552396, 46323127.748121165, 138350132.23247415, 46323088.30369053, 138350130.8584789, 46323092.060302965, 0, 0, 0, 0, 0 },
-  { 138350112.797885, 46323083.324994005, 138350125.1525608, 46323045.28078307, 138350100.4432092, 46323121.36920494, 138350113.41561878, 46323081.42278346, 138350112.18015122, 46323085.227204554, 1, 0, 138350144.6111752, 46322985.36115085, 50 },
-  { 138350094.17493075, 46323077.27727855, 138350104.5133588, 46323038.63640763, 138350083.8365027, 46323115.91814947, 138350094.69185215, 46323075.345235005, 138350093.65800935, 46323079.209322095, 0, 0, 0, 0, 0 },
-  { 138350075.43167716, 46323072.26249047, 138350083.33310884, 46323033.050663464, 138350067.53024548, 46323111.47431748, 138350075.82674876, 46323070.30189912, 138350075.03660557, 46323074.22308183, 0, 0, 0, 0, 0 },
-  { 138350056.36988404, 46323068.42141835, 138350062.30209768, 46323028.86375359, 138350050.4376704, 46323107.979083106, 138350056.66649473, 46323066.44353511, 138350056.07327336, 46323070.39930158, 0, 0, 0, 0, 0 },
-  { 138350037.00412935, 46323065.51725819, 138350041.6904204, 46323025.792723246, 138350032.3178383, 46323105.24179313, 138350037.2384439, 46323063.531031445, 138350036.7698148, 46323067.503484935, 0, 0, 0, 0, 0 },
-  { 138350017.4095855, 46323063.20569595, 138350021.56615794, 46323023.4222458, 138350013.25301307, 46323102.9891461, 138350017.61741412, 46323061.21652344, 138350017.2017569, 46323065.19486846, 0, 0, 0, 0, 0 },
-  { 138349997.6614294, 46323061.14240982, 138350001.99225566, 46323021.37755166, 138349993.33060315, 46323100.90726797, 138349997.87797073, 46323059.15416691, 138349997.4448881, 46323063.130652726, 0, 0, 0, 0, 0 },
-  { 138349977.83483773, 46323058.983077995, 138349983.03435728, 46323019.32245525, 138349972.6353182, 46323098.64370074, 138349978.0948137, 46323057.00004686, 138349977.57486176, 46323060.966109134, 0, 0, 0, 0, 0 },
-  { 138349958.00498748, 46323056.38337867, 138349964.68860647, 46323016.94571599, 138349951.3213685, 46323095.821041346, 138349958.33916843, 46323054.41149554, 138349957.67080653, 46323058.3552618, 1, 2, 138349998.94215375, 46322814.82769478, 31 },
-  { 138349938.25107697, 46323053.035624206, 138349946.67769915, 46323013.93329642, 138349929.82445478, 46323092.13795199, 138349938.67240807, 46323051.080507815, 138349937.82974586, 46323054.9907406, 1, 1, 138349875.05141053, 46323346.303082615, 49 },
-  { 138349918.67253533, 46323048.81641316, 138349928.99825218, 46323010.17214357, 138349908.34681848, 46323087.46068274, 138349919.18882117, 46323046.88419968, 138349918.1562495, 46323050.748626634, 0, 0, 0, 0, 0 },
-  { 138349899.375139, 46323043.66016483, 138349911.76212293, 46323005.62646098, 138349886.98815507, 46323081.69386869, 138349899.99448818, 46323041.75847964, 138349898.75578982, 46323045.561850026, 0, 0, 0, 0, 0 },
-  { 138349880.46466675, 46323037.50131907, 138349895.07578754, 46323000.26538012, 138349865.85354596, 46323074.737258025, 138349881.1952228, 46323035.63952213, 138349879.7341107, 46323039.36311602, 0, 0, 0, 0, 0 },
-  { 138349862.04689723, 46323030.27431574, 138349879.03746316, 46322994.06215384, 138349845.0563313, 46323066.486477636, 138349862.89642552, 46323028.46370764, 138349861.19736895, 46323032.08492383, 1, 1, 138349777.94359592, 46323209.52451715, 42 },
-  { 138349844.2276093, 46323021.91359463, 138349863.7302662, 46322986.99015876, 138349824.7249524, 46323056.83703051, 138349845.20274216, 46323020.16742284, 138349843.25247645, 46323023.65976643, 0, 0, 0, 0, 0 },
-  { 138349827.11126387, 46323012.35513613, 138349848.97520187, 46322978.85934214, 138349805.24732587, 46323045.85093011, 138349828.20446077, 46323010.68034643, 138349826.01806697, 46323014.02992582, 1, 1, 138349704.12661254, 46323200.768977284, 29 },
-  { 138349810.706388, 46323001.64706963, 138349834.36655575, 46322969.39499276, 138349787.04622024, 46323033.899146505, 138349811.88939637, 46323000.03446579, 138349809.52337962, 46323003.259673476, 0, 0, 0, 0, 0 },
-  { 138349794.86220446, 46322990.0237549, 138349819.75995994, 46322958.717177756, 138349769.964449, 46323021.33033205, 138349796.10709223, 46322988.45842604, 138349793.6173167, 46322991.58908376, 0, 0, 0, 0, 0 },
-  { 138349779.41291326, 46322977.7371139, 138349805.037609, 46322947.022704124, 138349753.7882175, 46323008.45152368, 138349780.69414806, 46322976.20139341, 138349778.13167846, 46322979.27283439, 0, 0, 0, 0, 0 },
-  { 138349764.1927142, 46322965.0390685, 138349790.06844446, 46322934.53584598, 138349738.31698397, 46322995.542291015, 138349765.48650074, 46322963.51390737, 138349762.8989277, 46322966.56422962, 0, 0, 0, 0, 0 },
-  { 138349749.03580734, 46322952.18154062, 138349774.70117253, 46322921.501106635, 138349723.37044215, 46322982.86197461, 138349750.3190756, 46322950.647518925, 138349747.75253907, 46322953.71556232, 1, 5, 138349919.0688517, 46322748.92366545, 26 },
-  { 138349733.77639255, 46322939.416452184, 138349758.76241446, 46322908.18027589, 138349708.79037064, 46322970.65262848, 138349735.02569366, 46322937.85464337, 138349732.52709144, 46322940.978261, 1, 1, 138349628.21045002, 46323071.38929702, 34 },
-  { 138349718.24866983, 46322926.99572513, 138349742.07121116, 46322894.8633968, 138349694.4261285, 46322959.128053464, 138349719.4397969, 46322925.38910872, 138349717.05754277, 46322928.60234155, 0, 0, 0, 0, 0 },
-  { 138349702.29172057, 46322915.165425144, 138349724.68568367, 46322882.02164117, 138349679.89775747, 46322948.309209116, 138349703.41141874, 46322913.50823595, 138349701.1720224, 46322916.82261434, 0, 0, 0, 0, 0 },
-  { 138349685.84403434, 46322904.05236458, 138349706.7725935, 46322869.96431078, 138349664.9154752, 46322938.14041838, 138349686.8904623, 46322902.34796189, 138349684.79760638, 46322905.75676727, 0, 0, 0, 0, 0 },
-  { 138349668.93684438, 46322893.67209684, 138349688.37386724, 46322858.71208909, 138349649.4998215, 46322928.63210459, 138349669.90869552, 46322891.92409645, 138349667.96499324, 46322895.42009723, 0, 0, 0, 0, 0 },
-  { 138349651.60493076, 46322884.03592044, 138349669.52552447, 46322848.2748757, 138349633.68433705, 46322919.79696518, 138349652.50096044, 46322882.2478682, 138349650.70890108, 46322885.82397268, 0, 0, 0, 0, 0 },
-  { 138349633.88307345, 46322875.1551339, 138349650.26313567, 46322838.66275715, 138349617.50301123, 46322911.647510655, 138349634.70207655, 46322873.330515064, 138349633.06407034, 46322876.97975274, 0, 0, 0, 0, 0 },
-  { 138349615.80605257, 46322867.04103574, 138349630.62188804, 46322829.88607619, 138349600.9902171, 46322904.19599529, 138349616.54684433, 46322865.18328776, 138349615.0652608, 46322868.89878372, 0, 0, 0, 0, 0 },
-  { 138349597.40864813, 46322859.70492448, 138349610.639144, 46322821.956361875, 138349584.17815226, 46322897.45348708, 138349598.07017294, 46322857.81749635, 138349596.74712333, 46322861.59235261, 0, 0, 0, 0, 0 },
-  { 138349578.7258313, 46322853.15678293, 138349590.3922375, 46322814.895902574, 138349567.0594251, 46322891.41766329, 138349579.30915162, 46322851.24373891, 138349578.14251098, 46322855.06982695, 0, 0, 0, 0, 0 },
-  { 138349559.7957567, 46322847.384674765, 138349569.9569018, 46322808.696806766, 138349549.6346116, 46322886.072542764, 138349560.30381396, 46322845.45028137, 138349559.28769943, 46322849.31906816, 1, 5, 138349517.88103318, 46323006.97213027, 34 },
-  { 138349540.6592067, 46322842.35857043, 138349549.37747562, 46322803.32023303, 138349531.94093776, 46322881.39690782, 138349541.09512013, 46322840.40665355, 138349540.22329324, 46322844.3104873, 1, 4, 138349581.19915724, 46322660.83030152, 27 },
-  { 138349521.35704237, 46322838.04789864, 138349528.6958561, 46322798.72688882, 138349514.01822865, 46322877.368908465, 138349521.72398305, 46322836.08184815, 138349520.9901017, 46322840.01394913, 0, 0, 0, 0, 0 },
-  { 138349501.93012485, 46322834.42208818, 138349507.95354035, 46322794.87820793, 138349495.90670934, 46322873.96596844, 138349502.23129562, 46322832.44489417, 138349501.62895408, 46322836.399282195, 1, 3, 138349543.19052112, 46322563.54650845, 50 },
-  { 138349482.41559038, 46322831.44958905, 138349487.1932745, 46322791.73594235, 138349477.63790625, 46322871.163235754, 138349482.6544746, 46322829.46390671, 138349482.17670617, 46322833.43527139, 0, 0, 0, 0, 0 },
-  { 138349462.8295235, 46322829.09331989, 138349466.43647096, 46322789.25627771, 138349459.22257605, 46322868.930362076, 138349463.0098709, 46322827.10146778, 138349462.64917612, 46322831.085172005, 0, 0, 0, 0, 0 },
-  { 138349443.18062103, 46322827.31425812, 138349445.6948014, 46322787.3933501, 138349440.66644067, 46322867.23516614, 138349443.30633005, 46322825.31821272, 138349443.054912, 46322829.310303524, 1, 4, 138349418.6673625, 46323216.54311131, 32 },
-  { 138349423.47757158, 46322826.07337903, 138349424.97884646, 46322786.10156179, 138349421.9762967, 46322866.04519627, 138349423.5526353, 46322824.07478817, 138349423.40250784, 46322828.0719699, 1, 4, 138349436.53866297, 46322478.31856901, 37 },
-  { 138349403.729064, 46322825.33165798, 138349404.2982937, 46322785.33570847, 138349403.15983427, 46322865.3276075, 138349403.75752547, 46322823.331860505, 138349403.7006025, 46322827.33145546, 0, 0, 0, 0, 0 },
-  { 138349383.9437869, 46322825.05007027, 138349383.66212338, 46322785.051061966, 138349384.2254504, 46322865.049078576, 138349383.9297037, 46322823.050119855, 138349383.95787007, 46322827.05002069, 0, 0, 0, 0, 0 },
-  { 138349364.1304291, 46322825.18959123, 138349363.07878542, 46322785.203418046, 138349365.18207276, 46322865.17576441, 138349364.0778469, 46322823.19028257, 138349364.18301126, 46322827.18889989, 1, 3, 138349373.8844241, 46323196.06134748, 41 },
-  { 138349344.29767922, 46322825.71119618, 138349342.55636021, 46322785.74911655, 138349346.03899822, 46322865.673275806, 138349344.21061328, 46322823.71309219, 138349344.38474515, 46322827.70930016, 1, 4, 138349338.33366165, 46322688.84107345, 49 },
-  { 138349324.45422608, 46322826.57586043, 138349322.10270163, 46322786.6450411, 138349326.80575052, 46322866.506679766, 138349324.33664986, 46322824.57931947, 138349324.5718023, 46322828.5724014, 0, 0, 0, 0, 0 },
-  { 138349304.6087582, 46322827.74455928, 138349301.72555962, 46322787.84860503, 138349307.4919568, 46322867.64051353, 138349304.46459827, 46322825.74976157, 138349304.75291815, 46322829.739356995, 0, 0, 0, 0, 0 },
-  { 138349284.7699646, 46322829.17826811, 138349281.4326865, 46322789.31772904, 138349288.1072427, 46322869.03880718, 138349284.6031007, 46322827.185241155, 138349284.93682852, 46322831.17129507, 0, 0, 0, 0, 0 },
-  { 138349264.94653383, 46322830.8379622, 138349261.23192304, 46322791.010814846, 138349268.6611446, 46322870.66510956, 138349264.76080328, 46322828.84660483, 138349265.13226438, 46322832.829319574, 0, 0, 0, 0, 0 },
-  { 138349245.1471546, 46322832.68461688, 138349241.13073665, 46322792.88677288, 138349249.16357255, 46322872.48246088, 138349244.9463337, 46322830.69472468, 138349245.3479755, 46322834.67450908, 0, 0, 0, 0, 0 },
-  { 138349225.38047728, 46322834.67947965, 138349221.09878403, 46322794.90930109, 138349229.66217053, 46322874.449658215, 138349225.16639262, 46322832.69097073, 138349225.59456193, 46322836.667988576, 0, 0, 0, 0, 0 },
-  { 138349205.65238568, 46322836.80342377, 138349201.07804605, 46322797.065841846, 138349210.2267253, 46322876.54100569, 138349205.4236687, 46322834.816544674, 138349205.88110265, 46322838.790302865, 0, 0, 0, 0, 0 },
-  { 138349185.96418464, 46322839.06980521, 138349181.06388715, 46322799.3711014, 138349190.86448213, 46322878.76850902, 138349185.71916977, 46322837.08487002, 138349186.20919952, 46322841.05474041, 1, 3, 138349156.1948773, 46322597.90017955, 26 },
-  { 138349166.31674922, 46322841.495029956, 138349161.05729082, 46322801.84231129, 138349171.5762076, 46322881.14774862, 138349166.0537763, 46322839.512394026, 138349166.57972214, 46322843.47766589, 1, 3, 138349209.9702539, 46323170.61259486, 44 },
-  { 138349146.71095413, 46322844.09550395, 138349141.059307, 46322804.49678068, 138349152.36260125, 46322883.69422722, 138349146.4283718, 46322842.11556779, 138349146.99353647, 46322846.07544011, 0, 0, 0, 0, 0 },
-  { 138349127.1476745, 46322846.88763319, 138349121.07106462, 46322807.35189224, 138349133.22428438, 46322886.42337414, 138349126.843844, 46322844.910846144, 138349127.451505, 46322848.864420235, 1, 2, 138349178.95077372, 46323183.92982478, 49 },
-  { 138349107.62778515, 46322849.88782364, 138349101.09378228, 46322810.42509684, 138349114.16178802, 46322889.35055044, 138349107.301085, 46322847.9146873, 138349107.9544853, 46322851.860959984, 0, 0, 0, 0, 0 },
-  { 138349088.152161, 46322853.112481296, 138349081.12878147, 46322813.733906664, 138349095.17554054, 46322892.49105593, 138349087.800992, 46322851.143552564, 138349088.50333, 46322855.08141003, 1, 1, 138349111.3293135, 46322983.06177758, 50 },
-  { 138349068.721677, 46322856.57801211, 138349061.17749876, 46322817.295886725, 138349076.26585525, 46322895.86013749, 138349068.3444681, 46322854.61390584, 138349069.09888592, 46322858.54211838, 1, 0, 138349020.81614524, 46322607.13651591, 50 },
-  { 138349049.33720818, 46322860.30082207, 138349041.24149898, 46322821.12864454, 138349057.4329174, 46322899.4729996, 138349048.93242273, 46322858.3422132, 138349049.74199364, 46322862.259430945, 0, 0, 0, 0, 0 },
-  { 138349029.99962935, 46322864.297317155, 138349021.32248652, 46322825.249817975, 138349038.67677218, 46322903.344816335, 138349029.5657722, 46322862.3449422, 138349030.4334865, 46322866.24969211, 1, 0, 138349006.13748658, 46322756.9166944, 48 },
-  { 138349010.7098155, 46322868.58390332, 138349001.42231753, 46322829.67706098, 138349019.99731347, 46322907.49074566, 138349010.2454406, 46322866.638561204, 138349011.1741904, 46322870.529245436, 0, 0, 0, 0, 0 },
-  { 138348991.46864146, 46322873.176986545, 138348981.54300922, 46322834.42802753, 138349001.3942737, 46322911.92594556, 138348990.97235984, 46322871.239538595, 138348991.96492308, 46322875.114434496, 1, 0, 138348904.86750007, 46322535.092319176, 25 },
-  { 138348972.27698228, 46322878.09297284, 138348961.6867492, 46322839.520353496, 138348982.86721537, 46322916.66559218, 138348971.74747062, 46322876.16434187, 138348972.80649394, 46322880.02160381, 0, 0, 0, 0, 0 },
-  { 138348953.13571283, 46322883.34826814, 138348941.8532042, 46322844.9724294, 138348964.41822147, 46322921.72410687, 138348952.5715874, 46322881.4294762, 138348953.69983825, 46322885.26706007, 1, 4, 138348864.85008267, 46322583.057330035, 40 },
-  { 138348934.04798523, 46322888.96006605, 138348922.0174409, 46322850.81211718, 138348946.07852957, 46322927.10801492, 138348933.446458, 46322887.05266861, 138348934.64951244, 46322890.86746349, 1, 3, 138349037.51066646, 46323217.03242634, 39 },
-  { 138348915.04150546, 46322894.95405273, 138348902.18882167, 46322857.075186335, 138348927.89418924, 46322932.83291913, 138348914.39887127, 46322893.060109414, 138348915.68413964, 46322896.84799605, 1, 1, 138348838.56803697, 46322669.57479765, 39 },
-  { 138348896.1589547, 46322901.36109383, 138348882.408936, 46322863.79865267, 138348909.90897343, 46322938.92353498, 138348895.4714538, 46322899.48297177, 138348896.84645563, 46322903.23921588, 0, 0, 0, 0, 0 },
-  { 138348877.44322753, 46322908.212128825, 138348862.72011986, 46322871.0203273, 138348892.1663352, 46322945.40393035, 138348876.70707214, 46322906.35253875, 138348878.17938292, 46322910.0717189, 0, 0, 0, 0, 0 },
-  { 138348858.93721858, 46322915.53809722, 138348843.16520876, 46322878.77883027, 138348874.7092284, 46322952.29736417, 138348858.14861807, 46322913.70013387, 138348859.72581908, 46322917.37606057, 1, 4, 138348996.5480042, 46323236.262701325, 28 },
-  { 138348840.68382233, 46322923.36993851, 138348823.78779453, 46322887.11357018, 138348857.57985014, 46322959.62630683, 138348839.83902094, 46322921.55712009, 138348841.52862373, 46322925.18275692, 1, 4, 138348770.14290622, 46322771.999600746, 39 },
-  { 138348822.7259335, 46322931.73859216, 138348804.6325231, 46322896.06467311, 138348840.8193439, 46322967.412511215, 138348821.821263, 46322929.95489621, 138348823.630604, 46322933.522288114, 0, 0, 0, 0, 0 },
-  { 138348805.10644662, 46322940.67499767, 138348785.7454267, 46322905.67284191, 138348824.46746653, 46322975.67715344, 138348804.13839564, 46322938.924889885, 138348806.0744976, 46322942.42510546, 1, 5, 138348615.8524771, 46322598.52892503, 41 },
-  { 138348787.8682563, 46322950.21009454, 138348767.1742803, 46322915.979123816, 138348808.56223232, 46322984.44106527, 138348786.8335575, 46322948.498546004, 138348788.9029551, 46322951.92164308, 1, 3, 138348875.81765437, 46323095.69172012, 36 },
-  { 138348771.05425712, 46322960.37482222, 138348748.97777537, 46322927.01872903, 138348793.13073888, 46322993.73091541, 138348769.95043305, 46322958.70701756, 138348772.1580812, 46322962.04262688, 1, 5, 138348672.26200125, 46322811.10630519, 43 },
-  { 138348754.70373893, 46322971.19629087, 138348731.3236666, 46322938.74059464, 138348778.08381125, 46323003.651987106, 138348753.53473532, 46322969.573506065, 138348755.87274253, 46322972.81907568, 0, 0, 0, 0, 0 },
-  { 138348738.80601257, 46322982.64851761, 138348714.28817275, 46322951.043525435, 138348763.3238524, 46323014.25350978, 138348737.5801206, 46322981.068268, 138348740.03190455, 46322984.228767216, 1, 1, 138348529.79142806, 46322713.21595932, 34 },
-  { 138348723.31384432, 46322994.666698076, 138348697.8193663, 46322963.84411561, 138348748.80832234, 46323025.489280544, 138348722.03912044, 46322993.12556895, 138348724.5885682, 46322996.2078272, 1, 3, 138348929.1817544, 46323243.55905151, 33 },
-  { 138348708.17916554, 46323007.18514088, 138348681.86095306, 46322977.062861875, 138348734.49737802, 46323037.30741988, 138348706.8632549, 46323005.679026924, 138348709.49507618, 46323008.69125483, 1, 5, 138348533.82100794, 46322807.62504247, 33 },
-  { 138348693.35390744, 46323020.13815458, 138348666.35616186, 46322990.62338314, 138348720.351653, 46323049.65292602, 138348692.00402015, 46323018.66241601, 138348694.70379472, 46323021.61389315, 0, 0, 0, 0, 0 },
-  { 138348678.7900013, 46323033.46004777, 138348651.24853504, 46323004.45198619, 138348706.33146757, 46323062.46810934, 138348677.412928, 46323032.00964469, 138348680.16707462, 46323034.910450846, 1, 5, 138348534.19730344, 46322881.167724505, 33 },
-  { 138348664.43937844, 46323047.085129, 138348636.48250905, 46323018.47720259, 138348692.39624783, 46323075.69305541, 138348663.04153496, 46323045.65473268, 138348665.83722192, 46323048.51552532, 0, 0, 0, 0, 0 },
-  { 138348650.25397012, 46323060.94770688, 138348622.00381774, 46323032.62935786, 138348678.5041225, 46323089.2660559, 138348648.8414625, 46323059.53178943, 138348651.66647774, 46323062.36362433, 1, 4, 138348503.35317782, 46322913.69229197, 27 },
-  { 138348636.18570763, 46323074.982089974, 138348607.75975734, 46323046.84021103, 138348664.61165792, 46323103.12396892, 138348634.7644101, 46323073.574996024, 138348637.60700515, 46323076.38918392, 1, 4, 138348898.41509897, 46323334.59092327, 48 },
-  { 138348622.18652213, 46323089.12258684, 138348593.69934574, 46323061.04268688, 138348650.6736985, 46323117.2024868, 138348620.7621633, 46323087.71859184, 138348623.61088094, 46323090.52658184, 1, 4, 138348372.2115494, 46322842.72146467, 26 },
-  { 138348608.20834512, 46323103.30350609, 138348579.7734077, 46323075.17070789, 138348636.64328253, 46323131.43630429, 138348606.78659824, 46323101.89686618, 138348609.630092, 46323104.710146, 1, 4, 138348702.75451198, 46323196.845060125, 44 },
-  { 138348594.20310766, 46323117.45915629, 138348565.93459514, 46323089.15913509, 138348622.47162017, 46323145.75917749, 138348592.78968203, 46323116.04415523, 138348595.61653328, 46323118.87415735, 0, 0, 0, 0, 0 },
-  { 138348580.12274113, 46323131.52384601, 138348552.13735795, 46323102.94381228, 138348608.10812432, 46323160.103879735, 138348578.72347197, 46323130.09484432, 138348581.5220103, 46323132.9528477, 0, 0, 0, 0, 0 },
-  { 138348565.91917682, 46323145.43188383, 138348538.33785334, 46323116.46171648, 138348593.5005003, 46323174.40205117, 138348564.54011065, 46323143.98337546, 138348567.298243, 46323146.880392194, 0, 0, 0, 0, 0 },
-  { 138348551.54434595, 46323159.11757833, 138348524.49378267, 46323129.65120722, 138348578.59490922, 46323188.58394943, 138348550.1918178, 46323157.64425977, 138348552.8968741, 46323160.59089688, 0, 0, 0, 0, 0 },
-  { 138348536.95017982, 46323172.51523809, 138348510.56140673, 46323142.454754815, 138348563.3389529, 46323202.57572137, 138348535.63074115, 46323171.01221393, 138348538.26961848, 46323174.01826225, 1, 0, 138348397.08968243, 46323013.19467674, 47 },
-  { 138348522.0896691, 46323185.56062534, 138348496.4171624, 46323154.88616694, 138348547.76217583, 46323216.23508374, 138348520.80604377, 46323184.026902415, 138348523.37329444, 46323187.09434826, 0, 0, 0, 0, 0 },
-  { 138348506.9477861, 46323198.23338678, 138348481.94850415, 46323167.0078219, 138348531.94706804, 46323229.45895165, 138348505.697822, 46323196.67210853, 138348508.19775018, 46323199.79466502, 0, 0, 0, 0, 0 },
-  { 138348491.5463931, 46323210.56378873, 138348467.16731334, 46323178.85163854, 138348515.92547286, 46323242.27593891, 138348490.3274391, 46323208.97818122, 138348492.7653471, 46323212.14939623, 0, 0, 0, 0, 0 },
-  { 138348475.90939993, 46323222.58490687, 138348452.0935629, 46323190.44760911, 138348499.72523695, 46323254.722204626, 138348474.71860808, 46323220.978041984, 138348477.10019177, 46323224.19177175, 0, 0, 0, 0, 0 },
-  { 138348460.06071618, 46323234.32981685, 138348436.74793792, 46323201.82574987, 138348483.37349445, 46323266.83388383, 138348458.89507726, 46323232.7046135, 138348461.2263551, 46323235.9550202, 0, 0, 0, 0, 0 },
-  { 138348444.02425152, 46323245.831594296, 138348421.15175763, 46323213.01621646, 138348466.8967454, 46323278.646972135, 138348442.88062683, 46323244.1908254, 138348445.1678762, 46323247.47236319, 0, 0, 0, 0, 0 },
-  { 138348427.82391584, 46323257.12331493, 138348405.3268961, 46323224.049396165, 138348450.32093558, 46323290.1972337, 138348426.69906485, 46323255.46961899, 138348428.94876683, 46323258.77701087, 0, 0, 0, 0, 0 },
-  { 138348411.48361865, 46323268.23805435, 138348389.29570234, 46323234.95598155, 138348433.67153496, 46323301.52012715, 138348410.37422284, 46323266.57395071, 138348412.59301445, 46323269.90215799, 0, 0, 0, 0, 0 },
-  { 138348395.02726972, 46323279.208888255, 138348373.08093175, 46323245.76702452, 138348416.9736077, 46323312.65075199, 138348393.92995283, 46323277.536795065, 138348396.1245866, 46323280.880981445, 1, 3, 138348466.90152654, 46323388.73099199, 39 },
-  { 138348378.47877878, 46323290.068892285, 138348356.70568445, 46323256.51397664, 138348400.2518731, 46323323.62380793, 138348377.39012405, 46323288.3911465, 138348379.5674335, 46323291.74663807, 0, 0, 0, 0, 0 },
-  { 138348361.8620555, 46323300.8511421, 138348340.19335657, 46323267.228716746, 138348383.53075445, 46323334.473567456, 138348360.77862057, 46323299.17002083, 138348362.94549045, 46323302.53226337, 1, 4, 138348433.91047946, 46323412.64570641, 36 },
-  { 138348345.20100957, 46323311.58871336, 138348323.56760436, 46323277.94356841, 138348366.83441478, 46323345.23385832, 138348344.11933932, 46323309.90645611, 138348346.28267983, 46323313.27097061, 0, 0, 0, 0, 0 },
-  { 138348328.51955068, 46323322.31468171, 138348306.85232192, 46323288.69130892, 138348350.18677944, 46323355.938054495, 138348327.43618923, 46323320.63351307, 138348329.60291213, 46323323.99585035, 1, 1, 138348511.60763374, 46323606.43218176, 47 },
-  { 138348311.8415886, 46323333.06212285, 138348290.0733252, 46323299.50407302, 138348333.609852, 46323366.62017269, 138348310.7531754, 46323331.38422036, 138348312.93000177, 46323334.74002534, 1, 1, 138348136.06286162, 46323062.08087046, 36 },
-  { 138348295.1904669, 46323343.863286935, 138348273.2940044, 46323310.38874542, 138348317.0869294, 46323377.33782845, 138348294.0956438, 46323342.18955986, 138348296.28529003, 46323345.53701401, 1, 1, 138348512.5128573, 46323676.09811148, 46 },
-  { 138348278.57623425, 46323354.73103616, 138348256.5645937, 46323321.33211881, 138348300.5878748, 46323388.1299535, 138348277.47565222, 46323353.06109029, 138348279.67681628, 46323356.40098202, 1, 1, 138348148.15726396, 46323156.84245086, 46 },
-  { 138348261.99548912, 46323365.65861797, 138348239.88335726, 46323332.326146945, 138348284.10762098, 46323398.991089, 138348260.88988253, 46323363.991994426, 138348263.1010957, 46323367.32524152, 1, 3, 138348378.08418137, 46323540.65409086, 39 },
-  { 138348245.44423246, 46323376.6384091, 138348223.24618986, 46323343.36308935, 138348267.64227507, 46323409.91372885, 138348244.33433032, 46323374.97464311, 138348246.5541346, 46323378.30217509, 0, 0, 0, 0, 0 },
-  { 138348228.9184656, 46323387.66278631, 138348206.6490017, 46323354.43522281, 138348251.18792954, 46323420.89034981, 138348227.8049924, 46323386.00140814, 138348230.03193882, 46323389.32416449, 1, 4, 138348319.66653115, 46323523.06510758, 40 },
-  { 138348212.41418973, 46323398.724126294, 138348190.08771747, 46323365.53484134, 138348234.74066198, 46323431.91341125, 138348211.2978661, 46323397.06466205, 138348213.53051335, 46323400.38359054, 0, 0, 0, 0, 0 },
-  { 138348195.9274059, 46323409.81480578, 138348173.55827713, 46323376.65425575, 138348218.29653466, 46323442.97535582, 138348194.80894947, 46323408.15677828, 138348197.04586232, 46323411.47283328, 0, 0, 0, 0, 0 },
-  { 138348179.45411542, 46323420.92720155, 138348157.0566373, 46323387.785792805, 138348201.85159355, 46323454.06861029, 138348178.3342415, 46323419.27013111, 138348180.57398933, 46323422.58427198, 1, 2, 138348066.34685087, 46323253.563087404, 26 },
-  { 138348162.99031943, 46323432.05369027, 138348140.57877016, 46323398.921795376, 138348185.4018687, 46323465.18558516, 138348161.86974198, 46323430.397095524, 138348164.1108969, 46323433.710285015, 0, 0, 0, 0, 0 },
-  { 138348146.5320191, 46323443.186648704, 138348124.12066457, 46323410.054622084, 138348168.94337365, 46323476.318675324, 138348145.41145137, 46323441.53004737, 138348147.65258685, 46323444.843250036, 0, 0, 0, 0, 0 },
-  { 138348130.0752157, 46323454.31845359, 138348107.67832613, 46323421.17664708, 138348152.47210526, 46323487.46026009, 138348128.95537123, 46323452.66136326, 138348131.19506016, 46323455.975543916, 0, 0, 0, 0, 0 },
-  { 138348113.61591038, 46323465.441481635, 138348091.24777693, 46323432.28026023, 138348135.98404384, 46323498.60270304, 138348112.4975037, 46323463.78342056, 138348114.73431706, 46323467.09954271, 1, 1, 138347941.94048598, 46323210.92910735, 36 },
-  { 138348097.15010428, 46323476.54810958, 138348074.82505524, 46323443.35786727, 138348119.47515333, 46323509.7383519, 138348096.03385183, 46323474.888597466, 138348098.26635674, 46323478.2076217, 1, 3, 138348307.5636916, 46323789.36614339, 42 },
-  { 138348080.67379865, 46323487.63071416, 138348058.40621606, 46323454.40188984, 138348102.94138125, 46323520.85953849, 138348079.56041953, 46323485.96927295, 138348081.78717777, 46323489.29215538, 1, 5, 138347932.59437448, 46323266.659032404, 25 },
-  { 138348064.18299463, 46323498.68167211, 138348041.9873303, 46323465.40476594, 138348086.37865898, 46323531.95857828, 138348063.0732114, 46323497.0178268, 138348065.29277787, 46323500.34551742, 0, 0, 0, 0, 0 },
-  { 138348047.6736934, 46323509.693360135, 138348025.5644842, 46323476.35895044, 138348069.78290257, 46323543.02776983, 138348046.56823292, 46323508.02663965, 138348048.77915385, 46323511.36008062, 0, 0, 0, 0, 0 },
-  { 138348031.14189613, 46323520.65815499, 138348009.1337794, 46323487.25691551, 138348053.15001285, 46323554.059394464, 138348030.0414903, 46323518.98809301, 138348032.24230197, 46323522.32821696, 1, 4, 138348090.01360837, 46323610.00647058, 33 },
-  { 138348014.58360416, 46323531.56843341, 138347992.69133252, 46323498.091150925, 138348036.4758758, 46323565.0457159, 138348013.48899058, 46323529.894569285, 138348015.67821774, 46323533.24229754, 1, 0, 138347898.55456448, 46323354.13883624, 30 },
-  { 138347997.99481845, 46323542.41657209, 138347976.23327267, 46323508.85416566, 138348019.75636423, 46323575.978978515, 138347996.90674117, 46323540.738451764, 138347999.08289573, 46323544.09469241, 1, 4, 138348194.39276913, 46323845.31729009, 32 },
-  { 138347981.3715404, 46323553.1949478, 138347959.7557433, 46323519.53848756, 138348002.9873375, 46323586.85140804, 138347980.29075053, 46323551.51212479, 138347982.45233026, 46323554.87777081, 0, 0, 0, 0, 0 },
-  { 138347964.70977104, 46323563.89593725, 138347943.25489864, 46323530.13666519, 138347986.16464344, 46323597.65520931, 138347963.6370274, 46323562.207973644, 138347965.78251466, 46323565.583900854, 1, 4, 138348116.50299326, 46323802.7427871, 45 },
-  { 138347948.0055116, 46323574.511917174, 138347926.72690415, 46323540.64126815, 138347969.28411907, 46323608.3825662, 138347946.94158125, 46323572.81838472, 138347949.06944197, 46323576.205449626, 0, 0, 0, 0, 0 },
-  { 138347931.25476333, 46323585.0352643, 138347910.16793475, 46323551.0448883, 138347952.34159192, 46323619.025640294, 138347930.2004219, 46323583.3357455, 138347932.30910477, 46323586.7347831, 1, 1, 138348053.0311984, 46323781.32968567, 44 },
-  { 138347914.4535273, 46323595.45835536, 138347893.57417274, 46323561.34014097, 138347935.33288187, 46323629.57656975, 138347913.40955958, 46323593.75244464, 138347915.49749503, 46323597.16426608, 0, 0, 0, 0, 0 },
-  { 138347897.59780484, 46323605.773567095, 138347876.94180748, 46323571.51966553, 138347918.2538022, 46323640.02746866, 138347896.56500497, 46323604.06087202, 138347898.6306047, 46323607.48626217, 1, 4, 138347999.32859194, 46323774.47403229, 26 },
-  { 138347880.68359703, 46323615.97327622, 138347860.2670319, 46323581.576127075, 138347901.10016215, 46323650.370425366, 138347879.66276878, 46323614.253418766, 138347881.70442528, 46323617.693133675, 1, 5, 138347728.06977287, 46323358.85458636, 33 },
-  { 138347863.70690507, 46323626.049859464, 138347843.54604176, 46323591.502217144, 138347883.86776838, 46323660.597501785, 138347862.6988619, 46323624.32247735, 138347864.71494824, 46323627.77724158, 0, 0, 0, 0, 0 },
-  { 138347846.66373017, 46323635.99569358, 138347826.7750328, 46323601.2906548, 138347866.55242756, 46323670.70073236, 138347845.6692953, 46323634.26044164, 138347847.65816504, 46323637.73094552, 1, 1, 138347777.05328938, 46323514.52805784, 27 },
-  { 138347829.5500735, 46323645.80315527, 138347809.95019838, 46323610.93418777, 138347849.14994863, 46323680.67212278, 138347828.57007974, 46323644.0597069, 138347830.53006727, 46323647.54660365, 1, 2, 138347883.93972698, 46323742.564540096, 36 },
-  { 138347812.36193624, 46323655.464621276, 138347793.06772673, 46323620.42559333, 138347831.65614575, 46323690.50364922, 138347811.39722577, 46323653.71266988, 138347813.32664672, 46323657.21657267, 0, 0, 0, 0, 0 },
-  { 138347795.0953196, 46323664.97246834, 138347776.12379837, 46323629.757679075, 138347814.06684083, 46323700.1872576, 138347794.14674354, 46323663.21172888, 138347796.04389566, 46323666.7332078, 0, 0, 0, 0, 0 },
-  { 138347777.74622482, 46323674.31907318, 138347759.11458293, 46323638.923283584, 138347796.37786672, 46323709.71486277, 138347776.81464273, 46323672.5492837, 138347778.6778069, 46323676.08886266, 1, 3, 138347714.39864242, 46323553.973388575, 47 },
-  { 138347760.31065297, 46323683.49681252, 138347742.0362352, 46323647.915277205, 138347778.58507073, 46323719.07834784, 138347759.3969321, 46323681.71773576, 138347761.22437385, 46323685.275889285, 1, 3, 138347818.3319294, 46323796.468187146, 42 },
-  { 138347742.78460535, 46323692.49806312, 138347724.88489294, 46323656.726561956, 138347760.68431777, 46323728.26956428, 138347741.88961974, 46323690.70948806, 138347743.67959097, 46323694.28663818, 0, 0, 0, 0, 0 },
-  { 138347725.16408303, 46323701.31520168, 138347707.65667176, 46323665.350072026, 138347742.6714943, 46323737.28033133, 138347724.28871247, 46323699.5169452, 138347726.0394536, 46323703.11345816, 1, 4, 138347891.92217535, 46324043.883061595, 46 },
-  { 138347707.44508728, 46323709.94060492, 138347690.34766248, 46323673.77877331, 138347724.5425121, 46323746.10243653, 138347706.59021604, 46323708.13251334, 138347708.29995853, 46323711.7486965, 0, 0, 0, 0, 0 },
-  { 138347689.6236193, 46323718.3666496, 138347672.95392665, 46323682.005662985, 138347706.29331192, 46323754.72763621, 138347688.79013467, 46323716.548600264, 138347690.4571039, 46323720.18469893, 0, 0, 0, 0, 0 },
-  { 138347671.6956802, 46323726.58571245, 138347655.47149247, 46323690.02376868, 138347687.91986793, 46323763.14765622, 138347670.88447082, 46323724.75761526, 138347672.50688958, 46323728.413809635, 1, 2, 138347627.8903733, 46323627.86846427, 40 },
-  { 138347653.65727124, 46323734.59017018, 138347637.89635083, 46323697.82614717, 138347669.41819164, 46323771.354193196, 138347652.8692252, 46323732.75196903, 138347654.44531727, 46323736.42837133, 0, 0, 0, 0, 0 },
-  { 138347635.50439358, 46323742.37239955, 138347620.22445145, 46323705.4058827, 138347650.7843357, 46323779.338916406, 138347634.74039647, 46323740.52407371, 138347636.2683907, 46323744.220725395, 0, 0, 0, 0, 0 },
-  { 138347617.23304835, 46323749.92477726, 138347602.45327747, 46323712.75545695, 138347632.01281923, 46323787.09409758, 138347616.4940598, 46323748.06631125, 138347617.9720369, 46323751.783243276, 1, 0, 138347750.2509863, 46324084.44866009, 33 },
-  { 138347598.8396837, 46323757.23859718, 138347584.59679997, 46323719.86025769, 138347613.08256745, 46323794.61693666, 138347598.12753952, 46323755.3696802, 138347599.5518279, 46323759.10751415, 0, 0, 0, 0, 0 },
-  { 138347580.3256361, 46323764.29330939, 138347566.6682678, 46323726.6970823, 138347593.9830044, 46323801.88953648, 138347579.64276767, 46323762.41349804, 138347581.0085045, 46323766.173120745, 0, 0, 0, 0, 0 },
-  { 138347561.69525534, 46323771.0610622, 138347548.6737266, 46323733.23990689, 138347574.7167841, 46323808.88221751, 138347561.0441789, 46323769.170004435, 138347562.34633178, 46323772.95211997, 0, 0, 0, 0, 0 },
-  { 138347542.95293579, 46323777.51389663, 138347530.61916354, 46323739.46290371, 138347555.28670803, 46323815.56488955, 138347542.33624718, 46323775.61134698, 138347543.5696244, 46323779.416446276, 0, 0, 0, 0, 0 },
-  { 138347524.10307163, 46323783.62385365, 138347512.51057768, 46323745.340514146, 138347535.69556558, 46323821.90719316, 138347523.52344692, 46323781.70968668, 138347524.68269634, 46323785.538020626, 1, 0, 138347413.9743791, 46323419.93212832, 32 },
-  { 138347505.15005726, 46323789.36297431, 138347494.35393238, 46323750.84747499, 138347515.94618213, 46323827.878473625, 138347504.610251, 46323787.43719934, 138347505.6898635, 46323791.28874928, 1, 0, 138347582.61225328, 46324065.711681895, 40 },
-  { 138347486.0982868, 46323794.703299545, 138347476.15509653, 46323755.95884231, 138347496.04147708, 46323833.44775678, 138347485.6011273, 46323792.766076684, 138347486.59544632, 46323796.640522406, 1, 0, 138347391.38939932, 46323425.66234432, 48 },
-  { 138347466.9521546, 46323799.616870396, 138347457.91977918, 46323760.65001019, 138347475.98453003, 46323838.5837306, 138347466.50053585, 46323797.66852739, 138347467.40377337, 46323801.565213405, 0, 0, 0, 0, 0 },
-  { 138347447.71605486, 46323804.075727835, 138347439.65345207, 46323764.896722786, 138347455.77865764, 46323843.254732884, 138347447.3129247, 46323802.116777584, 138347448.119185, 46323806.03467809, 0, 0, 0, 0, 0 },
-  { 138347428.3943819, 46323808.05191288, 138347421.3608234, 46323768.67515508, 138347435.42794043, 46323847.42867068, 138347428.042704, 46323806.083074994, 138347428.74605983, 46323810.02075077, 1, 0, 138347463.0346576, 46324001.98244503, 38 },
-  { 138347408.9905591, 46323811.51786414, 138347403.0412196, 46323771.96277142, 138347414.9398986, 46323851.07295685, 138347408.69309214, 46323809.5401095, 138347409.28802606, 46323813.495618775, 0, 0, 0, 0, 0 },
-  { 138347389.49973342, 46323814.44940926, 138347384.68544802, 46323774.74018293, 138347394.31401882, 46323854.158635594, 138347389.25901914, 46323812.463947944, 138347389.7404477, 46323816.43487058, 0, 0, 0, 0, 0 },
-  { 138347369.91286358, 46323816.82409117, 138347366.2810127, 46323776.98931166, 138347373.54471445, 46323856.65887069, 138347369.73127103, 46323814.8323522, 138347370.09445614, 46323818.81583015, 1, 5, 138347350.48246136, 46323603.708020754, 47 },
-  { 138347350.22087568, 46323818.61946608, 138347347.8146319, 46323778.69190679, 138347352.62711945, 46323858.547025375, 138347350.1005635, 46323816.623088114, 138347350.34118786, 46323820.61584405, 0, 0, 0, 0, 0 },
-  { 138347330.4146958, 46323819.81309018, 138347329.272829, 46323779.829391755, 138347331.5565626, 46323859.79678861, 138347330.35760245, 46323817.81390526, 138347330.47178915, 46323821.812275104, 1, 5, 138347320.05225462, 46323456.96102692, 38 },
-  { 138347310.48564354, 46323820.38223021, 138347310.68803295, 46323780.382742226, 138347310.28325412, 46323860.38171819, 138347310.495763, 46323818.38225581, 138347310.47552407, 46323822.38220461, 1, 3, 138347309.3320239, 46324048.37931168, 40 },
-  { 138347290.45666394, 46323820.280887574, 138347292.16620153, 46323780.31743576, 138347288.74712634, 46323860.24433939, 138347290.5421408, 46323818.282714985, 138347290.37118706, 46323822.27906016, 0, 0, 0, 0, 0 },
-  { 138347270.4049903, 46323819.423126586, 138347273.80216575, 46323779.56764768, 138347267.00781482, 46323859.27860549, 138347270.57484907, 46323817.43035264, 138347270.2351315, 46323821.41590053, 1, 1, 138347260.38332266, 46323936.99678936, 30 },
-  { 138347250.41320083, 46323817.7190794, 138347255.68723574, 46323778.068296865, 138347245.1391659, 46323857.36986193, 138347250.67690256, 46323815.73654027, 138347250.1494991, 46323819.70161852, 1, 3, 138347291.55067328, 46323508.44297563, 33 },
-  { 138347230.56387392, 46323815.0788782, 138347237.90961128, 46323775.759161234, 138347223.21813655, 46323854.39859517, 138347230.93116078, 46323813.11289235, 138347230.19658706, 46323817.04486405, 0, 0, 0, 0, 0 },
-  { 138347210.93958777, 46323811.41265516, 138347220.55196896, 46323772.58480269, 138347201.32720658, 46323850.24050763, 138347211.42020684, 46323809.47126254, 138347210.4589687, 46323813.35404778, 0, 0, 0, 0, 0 },
-  { 138347191.62292072, 46323806.63054244, 138347203.6884943, 46323768.493658274, 138347179.55734715, 46323844.76742661, 138347192.2261994, 46323804.723698236, 138347191.01964206, 46323808.53738665, 0, 0, 0, 0, 0 },
-  { 138347172.69645104, 46323800.64267223, 138347187.3816168, 46323763.43587304, 138347158.01128528, 46323837.84947143, 138347173.43070933, 46323798.78233227, 138347171.96219274, 46323802.503012195, 0, 0, 0, 0, 0 },
-  { 138347154.24275702, 46323793.3591767, 138347171.67891258, 46323757.359447815, 138347136.80660146, 46323829.35890559, 138347155.1145648, 46323791.55919026, 138347153.37094924, 46323795.15916315, 1, 0, 138347023.47159043, 46324063.35714334, 44 },
-  { 138347136.34451002, 46323784.69031645, 138347156.5769507, 46323750.18454384, 138347116.11206934, 46323819.19608907, 138347137.35613206, 46323782.965027824, 138347135.33288798, 46323786.41560508, 1, 4, 138347294.15754738, 46323515.545290045, 49 },
-  { 138347119.11397487, 46323774.5872017, 138347142.08210003, 46323741.83868683, 138347096.1458497, 46323807.33571657, 138347120.26238114, 46323772.94977596, 138347117.9655686, 46323776.22462744, 1, 2, 138346894.60055128, 46324094.70393452, 35 },
-  { 138347102.73511308, 46323763.09990986, 138347128.37738568, 46323732.40017279, 138347077.0928405, 46323793.79964692, 138347104.01722673, 46323761.564923, 138347101.45299944, 46323764.63489671, 0, 0, 0, 0, 0 },
-  { 138347087.40253156, 46323750.29321271, 138347115.6562811, 46323721.97845267, 138347059.148782, 46323778.607972756, 138347088.81521904, 46323748.87747471, 138347085.98984408, 46323751.70895071, 1, 2, 138346864.19791016, 46323973.97981709, 40 },
-  { 138347073.3108372, 46323736.23188207, 138347104.09235713, 46323710.68784106, 138347042.5293173, 46323761.77592309, 138347074.8499132, 46323734.954680026, 138347071.7717612, 46323737.50908412, 0, 0, 0, 0, 0 },
-  { 138347060.65463686, 46323720.98068971, 138347093.80193007, 46323698.59192128, 138347027.50734365, 46323743.36945815, 138347062.31200153, 46323719.86125129, 138347058.9972722, 46323722.10012814, 0, 0, 0, 0, 0 },
-  { 138347049.60002998, 46323704.613987945, 138347084.68280086, 46323685.3994313, 138347014.5172591, 46323723.82854459, 138347051.35416853, 46323703.65326011, 138347047.84589142, 46323705.57471578, 0, 0, 0, 0, 0 },
-  { 138347040.10431546, 46323687.276300535, 138347076.64683217, 46323671.00840352, 138347003.56179875, 46323703.54419755, 138347041.9314413, 46323686.46290568, 138347038.2771896, 46323688.08969539, 1, 3, 138346849.16966572, 46323772.276062444, 46 },
-  { 138347032.031941, 46323669.143355735, 138347069.64554575, 46323655.53392011, 138346994.41833624, 46323682.75279136, 138347033.91262123, 46323668.46288396, 138347030.15126076, 46323669.82382751, 0, 0, 0, 0, 0 },
-  { 138347025.24693182, 46323650.39102387, 138347063.6281589, 46323639.12685911, 138346986.86570475, 46323661.65518862, 138347027.16599318, 46323649.82781563, 138347023.32787046, 46323650.954232104, 0, 0, 0, 0, 0 },
-  { 138347019.61331302, 46323631.19517515, 138347058.53272155, 46323621.960477516, 138346980.6939045, 46323640.42987278, 138347021.55928344, 46323630.733440265, 138347017.6673426, 46323631.65691003, 0, 0, 0, 0, 0 },
-  { 138347014.9949978, 46323611.731398, 138347054.28012586, 46323604.20287135, 138346975.70986974, 46323619.25992465, 138347016.9592542, 46323611.35497167, 138347013.0307414, 46323612.10782433, 0, 0, 0, 0, 0 },
-  { 138347011.23930398, 46323592.13355108, 138347050.7584975, 46323585.95023939, 138346971.72011045, 46323598.31686278, 138347013.21526366, 46323591.8243855, 138347009.2633443, 46323592.442716666, 1, 3, 138347246.3785054, 46323555.342846505, 39 },
-  { 138347008.15954405, 46323572.44998433, 138347047.81812087, 46323567.234882765, 138346968.50096723, 46323577.66508589, 138347010.1424729, 46323572.18922925, 138347006.1766152, 46323572.710739404, 0, 0, 0, 0, 0 },
-  { 138347005.56486374, 46323552.71857024, 138347045.29601604, 46323548.088717386, 138346965.83371145, 46323557.34842309, 138347007.55142134, 46323552.487077594, 138347003.57830614, 46323552.950062886, 1, 2, 138347250.90472916, 46323524.129228845, 44 },
-  { 138347003.2644088, 46323532.97718135, 138347043.01827392, 46323528.546582416, 138346963.51054367, 46323537.40778029, 138347005.25210205, 46323532.75565141, 138347001.27671555, 46323533.1987113, 0, 0, 0, 0, 0 },
-  { 138347001.067325, 46323513.26369017, 138347040.79963225, 46323508.64375933, 138346961.33501774, 46323517.883621015, 138347003.05394036, 46323513.03269363, 138346999.08070964, 46323513.494686715, 0, 0, 0, 0, 0 },
-  { 138346998.78275815, 46323493.615969226, 138347038.4432057, 46323488.41511372, 138346959.12231058, 46323498.816824734, 138347000.76578054, 46323493.35592645, 138346996.79973575, 46323493.876012005, 0, 0, 0, 0, 0 },
-  { 138346996.21985397, 46323474.071891025, 138347035.74019697, 46323467.89593047, 138346956.69951096, 46323480.24785158, 138346998.1958711, 46323473.763092995, 138346994.24383682, 46323474.380689055, 0, 0, 0, 0, 0 },
-  { 138346993.18775824, 46323454.66932809, 138347032.46976697, 46323447.1245425, 138346953.9057495, 46323462.21411369, 138346995.1518587, 46323454.292088814, 138346991.2236578, 46323455.04656737, 1, 2, 138346654.38043287, 46323519.74310383, 27 },
-  { 138346989.49561673, 46323435.44615296, 138347028.39962935, 46323426.146808766, 138346950.5916041, 46323444.74549716, 138346991.44081736, 46323434.98118576, 138346987.5504161, 46323435.91112017, 1, 5, 138347323.0975249, 46323355.704276495, 32 },
-  { 138346984.95257524, 46323416.44023813, 138347023.3025018, 46323405.06996407, 138346946.60264868, 46323427.81051219, 138346986.87007156, 46323415.87172443, 138346983.0350789, 46323417.00875184, 1, 1, 138346671.44192553, 46323509.39222857, 42 },
-  { 138346979.39194292, 46323397.685207255, 138347017.09885776, 46323384.33647796, 138346941.68502808, 46323411.03393655, 138346981.27728865, 46323397.01777079, 138346977.5065972, 46323398.35264372, 0, 0, 0, 0, 0 },
-  { 138346972.84106332, 46323379.18056508, 138347009.90134212, 46323364.12946097, 138346935.78078452, 46323394.231669195, 138346974.69407725, 46323378.428009875, 138346970.9880494, 46323379.93312029, 0, 0, 0, 0, 0 },
-  { 138346965.42068407, 46323360.9093923, 138347001.86430448, 46323344.42113793, 138346928.97706366, 46323377.397646666, 138346967.2428651, 46323360.08497958, 138346963.59850305, 46323361.733805016, 0, 0, 0, 0, 0 },
-  { 138346957.2521503, 46323342.85466453, 138346993.13496426, 46323325.17915427, 138346921.36933634, 46323360.530174784, 138346959.046291, 46323341.97088902, 138346955.4580096, 46323343.73844004, 0, 0, 0, 0, 0 },
-  { 138346948.45680705, 46323324.999357335, 138346983.854134, 46323306.37063635, 138346913.0594801, 46323343.62807832, 138346950.2266734, 46323324.06792129, 138346946.6869407, 46323325.93079338, 1, 3, 138347261.72315046, 46323160.135176614, 31 },
-  { 138346939.15599945, 46323307.32644638, 138346974.15640548, 46323287.96226353, 138346904.15559343, 46323326.69062922, 138346940.90601975, 46323306.35823724, 138346937.40597916, 46323308.29465552, 0, 0, 0, 0, 0 },
-  { 138346929.47016555, 46323289.8194789, 138346964.08193398, 46323269.768905684, 138346894.85839713, 46323309.870052114, 138346931.200754, 46323288.81695024, 138346927.7395771, 46323290.82200756, 1, 5, 138347075.70488718, 46323205.10580708, 46 },
-  { 138346919.44300833, 46323272.51036559, 138346953.50908405, 46323251.54605102, 138346885.37693262, 46323293.47468016, 138346921.14631212, 46323271.46214986, 138346917.73970455, 46323273.55858132, 0, 0, 0, 0, 0 },
-  { 138346908.98429894, 46323255.51542952, 138346942.3065123, 46323233.38784273, 138346875.6620856, 46323277.64301631, 138346910.6504096, 46323254.40905018, 138346907.31818828, 46323256.62180886, 0, 0, 0, 0, 0 },
-  { 138346897.99033776, 46323238.95948405, 138346930.33760223, 46323215.42962046, 138346865.6430733, 46323262.48934764, 138346899.60770097, 46323237.782990865, 138346896.37297454, 46323240.13597723, 1, 0, 138346677.22025767, 46323399.55080303, 44 },
-  { 138346886.3574249, 46323222.967342526, 138346917.46013957, 46323197.81538154, 138346855.25471026, 46323248.11930351, 138346887.91256064, 46323221.709744476, 138346884.8022892, 46323224.224940576, 0, 0, 0, 0, 0 },
-  { 138346873.98186064, 46323207.66381829, 138346903.5295747, 46323180.70213078, 138346844.43414658, 46323234.625505805, 138346875.45924634, 46323206.31573392, 138346872.50447494, 46323209.01190267, 1, 0, 138346605.09766266, 46323453.01517469, 40 },
-  { 138346860.75994524, 46323193.1737247, 138346888.44735748, 46323164.30493179, 138346833.072533, 46323222.04251762, 138346862.14431587, 46323191.730285056, 138346859.37557462, 46323194.61716435, 1, 4, 138347041.42031002, 46323004.80485096, 49 },
-  { 138346846.60847056, 46323179.60136252, 138346872.46178386, 46323149.07913797, 138346820.75515726, 46323210.123587064, 138346847.90113622, 46323178.07525129, 138346845.3158049, 46323181.12747375, 0, 0, 0, 0, 0 },
-  { 138346831.60346317, 46323166.89163501, 138346855.85648763, 46323135.082975745, 138346807.3504387, 46323198.70029427, 138346832.8161144, 46323165.301202044, 138346830.39081195, 46323168.48206797, 1, 2, 138347033.5098919, 46322902.08454665, 28 },
-  { 138346815.89548478, 46323154.91483393, 138346838.82320106, 46323122.13801551, 138346792.9677685, 46323187.69165236, 138346817.0418706, 46323153.27599301, 138346814.74909896, 46323156.553674854, 0, 0, 0, 0, 0 },
-  { 138346799.63552234, 46323143.540825605, 138346821.53625453, 46323110.06907737, 138346777.73479015, 46323177.01257384, 138346800.73055893, 46323141.867238194, 138346798.54048574, 46323145.21441302, 0, 0, 0, 0, 0 },
-  { 138346782.97456262, 46323132.639476374, 138346804.159322, 46323098.710050054, 138346761.78980324, 46323166.56890269, 138346784.03380057, 46323130.943005055, 138346781.91532466, 46323134.33594769, 1, 1, 138346684.46543154, 46323290.41130875, 33 },
-  { 138346766.06359234, 46323122.08065252, 138346786.8385528, 46323087.898771085, 138346745.2886319, 46323156.262533955, 138346767.10234037, 46323120.37155845, 138346765.02484432, 46323123.78974659, 0, 0, 0, 0, 0 },
-  { 138346749.0484766, 46323111.73925697, 138346769.50768855, 46323077.3674568, 138346728.58926466, 46323146.11105714, 138346750.0714372, 46323110.020666964, 138346748.025516, 46323113.45784698, 0, 0, 0, 0, 0 },
-  { 138346731.98262513, 46323101.58110783, 138346752.03169897, 46323066.96847086, 138346711.93355128, 46323136.19374481, 138346732.9850788, 46323099.85047598, 138346730.98017144, 46323103.31173968, 0, 0, 0, 0, 0 },
-  { 138346714.8392058, 46323091.65092886, 138346734.37501392, 46323056.74602662, 138346695.3033977, 46323126.555831105, 138346715.8159962, 46323089.90568375, 138346713.8624154, 46323093.39617398, 0, 0, 0, 0, 0 },
-  { 138346697.5887223, 46323081.996063374, 138346716.50548378, 46323046.75182789, 138346678.6719608, 46323117.24029886, 138346698.53456035, 46323080.2338516, 138346696.64288422, 46323083.75827515, 1, 0, 138346776.09328243, 46322935.7324861, 28 },
-  { 138346680.20167845, 46323072.66385467, 138346698.3910314, 46323037.038759045, 138346662.0123255, 46323108.2889503, 138346681.1111461, 46323070.88259989, 138346679.29221082, 46323074.44510946, 0, 0, 0, 0, 0 },
-  { 138346662.64857817, 46323063.70164612, 138346679.99991274, 46323027.66095816, 138346645.2972436, 46323099.742334075, 138346663.5161449, 46323061.89961172, 138346661.78101143, 46323065.50368052, 1, 1, 138346712.5336651, 46322960.08466825, 39 },
-  { 138346644.89992514, 46323055.15678101, 138346661.30282548, 46323018.674664006, 138346628.4970248, 46323091.638898015, 138346645.72007015, 46323053.33267516, 138346644.07978013, 46323056.98088686, 1, 4, 138346530.89976788, 46323308.70749417, 30 },
-  { 138346626.92681137, 46323047.075802766, 138346642.33819917, 46323010.1638924, 138346611.51542357, 46323083.98771313, 138346627.69738075, 46323045.23020725, 138346626.15624198, 46323048.92139828, 1, 1, 138346771.79385662, 46322700.103845395, 33 },
-  { 138346608.72245637, 46323039.47515648, 138346623.18754607, 46323002.18224589, 138346594.25736666, 46323076.76806707, 138346609.44571084, 46323037.61051095, 138346607.9992019, 46323041.339802004, 0, 0, 0, 0, 0 },
-  { 138346590.30840674, 46323032.332756616, 138346603.8798072, 46322994.70541164, 138346576.73700628, 46323069.96010159, 138346590.98697677, 46323030.451389365, 138346589.6298367, 46323034.21412387, 0, 0, 0, 0, 0 },
-  { 138346571.7080609, 46323025.623998865, 138346584.4395459, 46322987.70422448, 138346558.97657588, 46323063.54377325, 138346572.34463513, 46323023.72801015, 138346571.07148665, 46323027.51998758, 0, 0, 0, 0, 0 },
-  { 138346552.94481707, 46323019.32427896, 138346564.89086398, 46322981.14978534, 138346540.99877015, 46323057.49877258, 138346553.5421194, 46323017.41555428, 138346552.34751472, 46323021.23300364, 0, 0, 0, 0, 0 },
-  { 138346534.04207355, 46323013.4089926, 138346545.257504, 46322975.01349651, 138346522.8266431, 46323051.804488696, 138346534.60284507, 46323011.489217795, 138346533.48130202, 46323015.32876741, 0, 0, 0, 0, 0 },
-  { 138346515.0232288, 46323007.85353553, 138346525.56294262, 46322969.26708153, 138346504.48351496, 46323046.43998954, 138346515.5502145, 46323005.924212836, 138346514.4962431, 46323009.78285823, 1, 1, 138346576.41706184, 46322783.087440975, 29 },
-  { 138346495.91168097, 46323002.633303456, 138346505.83039615, 46322963.882573284, 138346485.9929658, 46323041.38403363, 138346496.40761673, 46323000.69576695, 138346495.4157452, 46323004.570839964, 0, 0, 0, 0, 0 },
-  { 138346476.7308107, 46322997.72372915, 138346486.0451426, 46322958.82330214, 138346467.4164788, 46323036.624156155, 138346477.1965273, 46322995.778707795, 138346476.2650941, 46322999.6687505, 0, 0, 0, 0, 0 },
-  { 138346457.4954686, 46322993.11801208, 138346466.1229328, 46322954.05950645, 138346448.86800438, 46323032.1765177, 138346457.9268418, 46322991.1650868, 138346457.06409538, 46322995.07093736, 0, 0, 0, 0, 0 },
-  { 138346438.1983256, 46322988.855549715, 138346446.03991634, 46322949.63171188, 138346430.35673487, 46323028.07938755, 138346438.59040514, 46322986.89435782, 138346437.80624607, 46322990.81674161, 0, 0, 0, 0, 0 },
-  { 138346418.8284938, 46322984.98315216, 138346425.7849503, 46322945.5927001, 138346411.87203732, 46323024.373604216, 138346419.17631662, 46322983.013629556, 138346418.480671, 46322986.95267476, 1, 4, 138346361.78555053, 46323307.984859005, 37 },
-  { 138346399.37508512, 46322981.54762948, 138346405.3475969, 46322941.996028975, 138346393.40257332, 46323021.09922999, 138346399.6737107, 46322979.57004946, 138346399.07645953, 46322983.52520951, 1, 5, 138346429.53626972, 46322781.812046915, 50 },
-  { 138346379.82721165, 46322978.595791794, 138346384.71836248, 46322938.89596001, 138346374.93606082, 46323018.29562358, 138346380.07176918, 46322976.61080021, 138346379.58265412, 46322980.58078338, 1, 1, 138346331.40481836, 46323371.624126434, 45 },
-  { 138346360.17398545, 46322976.1744492, 138346363.87322682, 46322936.34587135, 138346356.47474408, 46323016.003027044, 138346360.35894752, 46322974.18302031, 138346359.9890234, 46322978.16587809, 1, 1, 138346375.71079916, 46322808.89442223, 33 },
-  { 138346340.41107655, 46322974.338888556, 138346342.6891331, 46322934.403810516, 138346338.13301998, 46323014.273966596, 138346340.52497938, 46322972.342134655, 138346340.2971737, 46322976.33564246, 1, 2, 138346332.66568425, 46323110.1181539, 29 },
-  { 138346320.58322805, 46322973.20782878, 138346321.14627716, 46322933.21179178, 138346320.02017894, 46323013.20386578, 138346320.61138052, 46322971.20802693, 138346320.5550756, 46322975.207630634, 0, 0, 0, 0, 0 },
-  { 138346300.7574173, 46322972.928728506, 138346299.29972005, 46322932.95529835, 138346302.21511453, 46323012.90215866, 138346300.68453243, 46322970.930057, 138346300.83030215, 46322974.927400015, 1, 0, 138346308.41032785, 46323182.78923684, 37 },
-  { 138346281.00073165, 46322973.64918873, 138346277.21036872, 46322933.829179324, 138346284.79109457, 46323013.46919813, 138346280.8112135, 46322971.65818825, 138346281.1902498, 46322975.6401892, 0, 0, 0, 0, 0 },
-  { 138346261.38025844, 46322975.51681044, 138346255.02212447, 46322936.02536665, 138346267.7383924, 46323015.00825423, 138346261.06235173, 46322973.54223825, 138346261.69816515, 46322977.49138263, 0, 0, 0, 0, 0 },
-  { 138346241.954576, 46322978.644350976, 138346233.18818393, 46322939.61679186, 138346250.72096804, 46323017.67191009, 138346241.5162564, 46322976.69297302, 138346242.39289558, 46322980.595728934, 1, 4, 138346158.89301133, 46322608.85822836, 39 },
-  { 138346222.73741367, 46322982.96092067, 138346211.85513026, 46322944.46967611, 138346233.6196971, 46323021.45216523, 138346222.1932995, 46322981.03635844, 138346223.28152785, 46322984.8854829, 1, 5, 138346285.31054324, 46323204.285576895, 25 },
-  { 138346203.72777852, 46322988.33534385, 138346191.01811987, 46322950.4082483, 138346216.43743718, 46323026.26243941, 138346203.0922956, 46322986.43898907, 138346204.36326146, 46322990.23169863, 1, 4, 138346116.03113383, 46322726.63838454, 31 },
-  { 138346184.92466867, 46322994.63640921, 138346170.66432366, 46322957.26472796, 138346199.18501368, 46323032.00809046, 138346184.2116514, 46322992.76782515, 138346185.63768592, 46322996.50499327, 0, 0, 0, 0, 0 },
-  { 138346166.3270825, 46323001.73290544, 138346150.77712014, 46322964.87915841, 138346181.8770449, 46323038.58665247, 138346165.5495844, 46322999.89021809, 138346167.10458064, 46323003.57559279, 0, 0, 0, 0, 0 },
-  { 138346147.9340182, 46323009.49362127, 138346131.33921164, 46322973.09839637, 138346164.52882475, 46323045.88884617, 138346147.10427788, 46323007.67386002, 138346148.7637585, 46323011.313382514, 1, 3, 138346278.61811978, 46323296.10601735, 48 },
-  { 138346129.7444742, 46323017.78734564, 138346112.2426127, 46322981.81951497, 138346147.24633572, 46323053.75517631, 138346128.86938113, 46323015.988954104, 138346130.61956728, 46323019.585737176, 1, 1, 138346011.6069089, 46322775.00448862, 31 },
-  { 138346111.78088287, 46323026.528386794, 138346093.15456787, 46322991.12979375, 138346130.40719786, 46323061.92697984, 138346110.84956712, 46323024.75845714, 138346112.71219862, 46323028.29831645, 1, 3, 138346287.33390173, 46323360.16012625, 35 },
-  { 138346094.15433413, 46323035.80326528, 138346074.1088138, 46323001.18857021, 138346114.19985446, 46323070.41796035, 138346093.15205812, 46323034.07253053, 138346095.15661013, 46323037.53400003, 0, 0, 0, 0, 0 },
-  { 138346076.99688095, 46323045.73922097, 138346055.25058162, 46323012.1669338, 138346098.74318027, 46323079.31150814, 138346075.909566, 46323044.060606614, 138346078.0841959, 46323047.417835325, 1, 5, 138346273.25723234, 46323348.72911268, 50 },
-  { 138346060.44057602, 46323056.46349367, 138346036.738093, 46323024.24250208, 138346084.14305905, 46323088.68448526, 138346059.25545186, 46323054.85244409, 138346061.62570018, 46323058.074543245, 1, 3, 138345893.93063286, 46322830.111027755, 27 },
-  { 138346044.61747226, 46323068.103323154, 138346018.77861026, 46323037.568863764, 138346070.45633426, 46323098.637782544, 138346043.32552916, 46323066.57660019, 138346045.90941536, 46323069.63004612, 0, 0, 0, 0, 0 },
-  { 138346029.64664224, 46323080.771934904, 138346001.8688937, 46323051.99005367, 138346057.42439076, 46323109.55381614, 138346028.2577548, 46323079.332840845, 138346031.03552967, 46323082.21102896, 0, 0, 0, 0, 0 },
-  { 138346015.50066623, 46323094.42439079, 138345986.17337075, 46323067.22310886, 138346044.8279617, 46323121.62567273, 138346014.03430146, 46323093.064326696, 138346016.967031, 46323095.78445489, 0, 0, 0, 0, 0 },
-  { 138346002.05966243, 46323108.915924355, 138345971.53326362, 46323083.06753995, 138346032.58606124, 46323134.76430876, 138346000.53334248, 46323107.62350514, 138346003.58598238, 46323110.20834357, 0, 0, 0, 0, 0 },
-  { 138345989.2022977, 46323124.100201935, 138345957.78335133, 46323099.344398364, 138346020.62124404, 46323148.856005505, 138345987.63135037, 46323122.86241175, 138345990.773245, 46323125.33799212, 1, 5, 138346261.76165724, 46323338.85679792, 31 },
-  { 138345976.80757442, 46323139.83102417, 138345944.58747384, 46323116.12732997, 138346009.027675, 46323163.53471837, 138345975.19656938, 46323138.64583946, 138345978.41857946, 46323141.01620888, 0, 0, 0, 0, 0 },
-  { 138345964.8979666, 46323156.01958781, 138345931.52388066, 46323133.970315985, 138345998.27205253, 46323178.06885963, 138345963.2292623, 46323154.91712422, 138345966.5666709, 46323157.122051395, 0, 0, 0, 0, 0 },
-  { 138345953.86213145, 46323172.7235821, 138345918.9857608, 46323153.13688329, 138345988.7385021, 46323192.310280904, 138345952.11831293, 46323171.74424715, 138345955.60594997, 46323173.70291704, 0, 0, 0, 0, 0 },
-  { 138345944.1463041, 46323190.02373048, 138345907.56354102, 46323173.84654141, 138345980.72906718, 46323206.200919546, 138345942.31716594, 46323189.21487103, 138345945.97544226, 46323190.83258993, 0, 0, 0, 0, 0 },
-  { 138345936.1967201, 46323208.000756465, 138345897.9538702, 46323196.27538091, 138345974.43956998, 46323219.72613202, 138345934.2845776, 46323207.41448769, 138345938.10886258, 46323208.58702524, 0, 0, 0, 0, 0 },
-  { 138345930.45360848, 46323226.732178256, 138345891.0375299, 46323219.922424294, 138345969.86968708, 46323233.54193222, 138345928.48280457, 46323226.39169056, 138345932.4244124, 46323227.07266595, 1, 3, 138346132.46101123, 46323261.63216732, 44 },
-  { 138345927.09766078, 46323246.1570061, 138345887.16347006, 46323243.86344734, 138345967.0318515, 46323248.45056486, 138345925.10095125, 46323246.042328164, 138345929.0943703, 46323246.271684036, 0, 0, 0, 0, 0 },
-  { 138345925.95652485, 46323266.0258408, 138345885.99465325, 46323267.77192779, 138345965.91839644, 46323264.279753804, 138345923.95843127, 46323266.11314514, 138345927.95461842, 46323265.93853645, 0, 0, 0, 0, 0 },
-  { 138345926.83258426, 46323286.07580042, 138345887.19215837, 46323291.427121244, 138345966.47301015, 46323280.72447959, 138345924.85056296, 46323286.34336646, 138345928.81460556, 46323285.80823438, 0, 0, 0, 0, 0 },
-  { 138345929.52822277, 46323306.04400304, 138345890.4626736, 46323314.63951747, 138345968.59377193, 46323297.44848861, 138345927.5749453, 46323306.47377876, 138345931.48150024, 46323305.61422732, 1, 0, 138346281.11816528, 46323228.684373185, 28 },
-  { 138345933.84728056, 46323325.673586115, 138345895.55116904, 46323337.223817386, 138345972.1433921, 46323314.123354845, 138345931.932475, 46323326.25109768, 138345935.76208612, 46323325.09607455, 0, 0, 0, 0, 0 },
-  { 138345939.6162029, 46323344.801107265, 138345902.23793077, 46323359.04416777, 138345976.994475, 46323330.55804676, 138345937.74728927, 46323345.51326029, 138345941.4851165, 46323344.08895424, 0, 0, 0, 0, 0 },
-  { 138345946.67926064, 46323363.33679309, 138345910.3304919, 46323380.03311036, 138345983.02802938, 46323346.64047582, 138345944.86182222, 46323364.171608955, 138345948.49669906, 46323362.50197722, 0, 0, 0, 0, 0 },
-  { 138345954.88120872, 46323381.19286931, 138345919.64941117, 46323400.13278596, 138345990.11300626, 46323362.252952665, 138345953.11961883, 46323382.139865145, 138345956.6427986, 46323380.24587348, 0, 0, 0, 0, 0 },
-  { 138345964.0693824, 46323398.28459579, 138345930.04157785, 46323419.310972475, 138345998.09718695, 46323377.2582191, 138345962.36799216, 46323399.33591462, 138345965.77077264, 46323397.233276956, 0, 0, 0, 0, 0 },
-  { 138345974.14550218, 46323414.591172986, 138345941.40047166, 46323437.564265415, 138346006.8905327, 46323391.61808056, 138345972.50825065, 46323415.73982761, 138345975.7827537, 46323413.44251836, 1, 0, 138346096.93936667, 46323328.442076385, 37 },
-  { 138345985.06304756, 46323430.152654655, 138345953.65111852, 46323454.917361684, 138346016.4749766, 46323405.38794763, 138345983.4924511, 46323431.39089001, 138345986.633644, 46323428.9144193, 0, 0, 0, 0, 0 },
-  { 138345996.7775531, 46323445.011510715, 138345966.71978545, 46323471.40337696, 138346026.83532077, 46323418.61964447, 138345995.27466473, 46323446.331104025, 138345998.2804415, 46323443.691917405, 0, 0, 0, 0, 0 },
-  { 138346009.2445535, 46323459.21021109, 138345980.5344137, 46323487.06210281, 138346037.95469332, 46323431.35831937, 138346007.8090465, 46323460.602805674, 138346010.6800605, 46323457.81761651, 0, 0, 0, 0, 0 },
-  { 138346022.41958332, 46323472.79122569, 138345995.02595556, 46323501.93893842, 138346049.81321108, 46323443.64351296, 138346021.04990193, 46323474.24861132, 138346023.7892647, 46323471.33384005, 0, 0, 0, 0, 0 },
-  { 138346036.25817707, 46323485.79702445, 138346010.12914744, 46323516.08355299, 138346062.3872067, 46323455.510495916, 138346034.9517256, 46323487.311350875, 138346037.56462854, 46323484.28269803, 0, 0, 0, 0, 0 },
-  { 138346050.71586937, 46323498.27007728, 138346025.7827679, 46323529.54851156, 138346075.64897084, 46323466.991643004, 138346049.4692143, 46323499.83399899, 138346051.96252444, 46323496.70615557, 0, 0, 0, 0, 0 },
-  { 138346065.7481949, 46323510.25285412, 138346041.92949677, 46323542.38803141, 138346089.56689304, 46323478.11767684, 138346064.55726, 46323511.85961299, 138346066.9391298, 46323508.64609526, 0, 0, 0, 0, 0 },
-  { 138346081.31068817, 46323521.787824854, 138346058.515512, 46323554.65695845, 138346104.10586435, 46323488.918691255, 138346080.17092937, 46323523.43128154, 138346082.45044696, 46323520.14436817, 0, 0, 0, 0, 0 },
-  { 138346097.35888377, 46323532.917459436, 138346075.48994875, 46323566.40999115, 138346119.2278188, 46323499.42492772, 138346096.265437, 46323534.592086025, 138346098.45233053, 46323531.24283285, 0, 0, 0, 0, 0 },
-  { 138346113.84831637, 46323543.68422778, 138346092.8043163, 46323577.701136254, 138346134.89231643, 46323509.667319305, 138346112.79611638, 46323545.3850732, 138346114.90051636, 46323541.98338236, 0, 0, 0, 0, 0 },
-  { 138346130.73452052, 46323554.130599804, 138346110.41193956, 46323588.583360255, 138346151.0571015, 46323519.67783935, 138346129.71839148, 46323555.85323783, 138346131.75064957, 46323552.40796178, 0, 0, 0, 0, 0 },
-  { 138346147.97303084, 46323564.299045436, 138346128.26746088, 46323599.10839063, 138346167.6786008, 46323529.48970024, 138346146.98775235, 46323566.039512694, 138346148.95830932, 46323562.55857818, 1, 4, 138346305.61759043, 46323285.824283876, 32 },
-  { 138346165.51938188, 46323574.23203458, 138346146.32642025, 46323609.32662425, 138346184.7123435, 46323539.137444906, 138346164.5597338, 46323575.986764066, 138346166.47902995, 46323572.47730509, 0, 0, 0, 0, 0 },
-  { 138346183.32910824, 46323583.972037174, 138346164.54491642, 46323619.28710672, 138346202.11330006, 46323548.656967625, 138346182.38989866, 46323585.73779065, 138346184.26831782, 46323582.206283696, 0, 0, 0, 0, 0 },
-  { 138346201.35774457, 46323593.561523125, 138346182.87934384, 46323629.03755314, 138346219.8361453, 46323558.08549311, 138346200.43382454, 46323595.33532462, 138346202.2816646, 46323591.78772163, 0, 0, 0, 0, 0 },
-  { 138346219.56082544, 46323603.042962365, 138346201.2861985, 46323638.62439025, 138346237.83545238, 46323567.46153448, 138346218.6470941, 46323604.822033755, 138346220.47455677, 46323601.263890974, 1, 5, 138346389.05799028, 46323273.02521873, 27 },
-  { 138346237.89388537, 46323612.45882482, 138346219.72194293, 46323648.09280449, 138346256.06582782, 46323576.82484515, 138346236.98528826, 46323614.24052381, 138346238.8024825, 46323610.677125834, 0, 0, 0, 0, 0 },
-  { 138346256.31245905, 46323621.85158039, 138346238.14292186, 46323657.48678656, 138346274.48199624, 46323586.21637422, 138346255.4039822, 46323623.633340694, 138346257.2209359, 46323620.06982008, 0, 0, 0, 0, 0 },
-  { 138346274.77208102, 46323631.26369901, 138346256.50532407, 46323666.84916783, 138346293.03883797, 46323595.67823019, 138346273.85874316, 46323633.04297245, 138346275.68541887, 46323629.48442557, 0, 0, 0, 0, 0 },
-  { 138346293.2282859, 46323640.737650596, 138346274.7651841, 46323676.22164518, 138346311.6913877, 46323605.253656015, 138346292.3051308, 46323642.51185033, 138346294.151441, 46323638.963450864, 0, 0, 0, 0, 0 },
-  { 138346311.63660827, 46323650.31590507, 138346292.87842393, 46323685.6447958, 138346330.39479262, 46323614.987014346, 138346310.69869906, 46323652.082349606, 138346312.5745175, 46323648.54946054, 0, 0, 0, 0, 0 },
-  { 138346329.95258278, 46323660.04093236, 138346310.80093336, 46323695.15808379, 138346349.1042322, 46323624.923780926, 138346328.9950003, 46323661.79678993, 138346330.91016525, 46323658.285074785, 0, 0, 0, 0, 0 },
-  { 138346348.13174397, 46323669.955202386, 138346328.48869193, 46323704.79986491, 138346367.774796, 46323635.11053986, 138346347.14959136, 46323671.69743551, 138346349.11389658, 46323668.21296926, 1, 3, 138346170.8531993, 46323984.42828167, 42 },
-  { 138346366.12962645, 46323680.10118506, 138346345.89793456, 46323714.607396714, 138346386.36131835, 46323645.59497341, 138346365.11804184, 46323681.82649564, 138346367.14121106, 46323678.37587448, 1, 0, 138346451.60852477, 46323534.31244084, 42 },
-  { 138346383.90176478, 46323690.5213503, 138346362.98536488, 46323724.616866365, 138346404.81816468, 46323656.42583424, 138346382.85594478, 46323692.226126105, 138346384.94758478, 46323688.8165745, 1, 2, 138346298.66743523, 46323829.46057826, 26 },
-  { 138346401.4036936, 46323701.25816804, 138346379.70841825, 46323734.86345079, 138346423.09896892, 46323667.652885295, 138346400.31892982, 46323702.93843218, 138346402.48845735, 46323699.577903904, 1, 0, 138346593.9492621, 46323403.01128366, 26 },
-  { 138346418.59094754, 46323712.35410821, 138346396.02557296, 46323745.381428264, 138346441.15632212, 46323679.32678815, 138346417.46267882, 46323714.00547421, 138346419.71921626, 46323710.702742204, 1, 0, 138346217.19497943, 46324007.12293972, 28 },
-  { 138346435.4190611, 46323723.85164071, 138346411.896705, 46323756.20436492, 138346458.9414172, 46323691.4989165, 138346434.2429433, 46323725.46927692, 138346436.5951789, 46323722.2340045, 1, 0, 138346580.66961, 46323524.073568724, 31 },
-  { 138346451.84356892, 46323735.793235466, 138346427.28347015, 46323767.36539961, 138346476.4036677, 46323704.221071325, 138346450.615564, 46323737.37184367, 138346453.07157385, 46323734.21462726, 1, 3, 138346321.061043, 46323903.91500951, 29 },
-  { 138346467.82000563, 46323748.2213624, 138346442.14871123, 46323778.89683541, 138346493.49130002, 46323717.545889385, 138346466.5364409, 46323749.75513605, 138346469.10357034, 46323746.687588744, 0, 0, 0, 0, 0 },
-  { 138346483.30318642, 46323761.17872713, 138346456.33682105, 46323790.72217208, 138346510.26955178, 46323731.635282174, 138346481.95486814, 46323762.655899376, 138346484.6515047, 46323759.70155488, 1, 3, 138346360.60622406, 46323895.60140166, 32 },
-  { 138346498.15779567, 46323774.73756635, 138346469.4985436, 46323802.64181817, 138346526.81704774, 46323746.83331453, 138346496.72483307, 46323776.13277894, 138346499.59075826, 46323773.34235376, 1, 4, 138346632.13979918, 46323644.285189085, 43 },
-  { 138346512.07178414, 46323789.02802308, 138346481.35122544, 46323814.64534678, 138346542.79234284, 46323763.410699375, 138346510.5357562, 46323790.30888926, 138346513.60781208, 46323787.747156896, 1, 1, 138346287.81170568, 46323976.03448609, 46 },
-  { 138346524.71255943, 46323804.186971135, 138346491.67664355, 46323826.73975947, 138346557.7484753, 46323781.6341828, 138346523.06076363, 46323805.31461055, 138346526.36435524, 46323803.05933172, 0, 0, 0, 0, 0 },
-  { 138346535.74752924, 46323820.35128435, 138346500.41380417, 46323839.10036096, 138346571.0812543, 46323801.602207735, 138346533.98084298, 46323821.288738176, 138346537.5142155, 46323819.41383052, 0, 0, 0, 0, 0 },
-  { 138346544.91102716, 46323837.620429, 138346507.91663665, 46323852.83276187, 138346581.90541768, 46323822.408096135, 138346543.06130764, 46323838.38104565, 138346546.7607467, 46323836.85981236, 0, 0, 0, 0, 0 },
-  { 138346552.40089414, 46323855.834799275, 138346514.40166065, 46323868.32712713, 138346590.40012762, 46323843.34247142, 138346550.50093246, 46323856.45941567, 138346554.30085582, 46323855.21018288, 1, 4, 138346201.85796532, 46323971.076523714, 35 },
-  { 138346558.61113513, 46323874.72514542, 138346520.05250674, 46323885.3662063, 138346597.1697635, 46323864.08408454, 138346556.6832037, 46323875.25719847, 138346560.53906655, 46323874.193092376, 0, 0, 0, 0, 0 },
-  { 138346563.9364579, 46323894.021824986, 138346525.10854766, 46323903.633972816, 138346602.76436815, 46323884.409677155, 138346561.99506238, 46323894.502432376, 138346565.87785342, 46323893.541217595, 0, 0, 0, 0, 0 },
-  { 138346568.75114816, 46323913.47058552, 138346529.7648846, 46323922.418839715, 138346607.73741174, 46323904.52233132, 138346566.801835, 46323913.917998224, 138346570.70046133, 46323913.02317281, 1, 2, 138346697.40581793, 46323883.94134665, 31 },
-  { 138346573.22671446, 46323932.969987676, 138346534.11691132, 46323941.36184669, 138346612.3365176, 46323924.57812866, 138346571.2712243, 46323933.38958063, 138346575.18220463, 46323932.55039472, 1, 3, 138346395.27711013, 46323971.15294622, 46 },
-  { 138346577.418603, 46323952.50605653, 138346538.21489576, 46323960.44767721, 138346616.62231025, 46323944.564435855, 138346575.45841765, 46323952.903137565, 138346579.37878835, 46323952.1089755, 1, 2, 138346740.11398804, 46323919.548330724, 36 },
-  { 138346581.38089263, 46323972.06584779, 138346542.10929337, 46323979.664630085, 138346620.6524919, 46323964.4670655, 138346579.41731268, 46323972.44578691, 138346583.3444726, 46323971.685908675, 0, 0, 0, 0, 0 },
-  { 138346585.16766217, 46323991.63641714, 138346545.8514116, 46323999.00068501, 138346624.48391274, 46323984.27214928, 138346583.20184964, 46323992.004630536, 138346587.1334747, 46323991.26820375, 0, 0, 0, 0, 0 },
-  { 138346588.83299038, 46324011.20482024, 138346549.49344537, 46324018.44361837, 138346628.1725354, 46324003.966022104, 138346586.86601314, 46324011.566760145, 138346590.79996762, 46324010.84288033, 0, 0, 0, 0, 0 },
-  { 138346592.43095618, 46324030.75811281, 138346553.08850178, 46324037.98108181, 138346631.7734106, 46324023.53514381, 138346590.46383345, 46324031.11926126, 138346594.39807892, 46324030.396964364, 1, 5, 138346782.2582987, 46323995.90728738, 28 },
-  { 138346596.01563814, 46324050.28335049, 138346556.69061854, 46324057.600647345, 138346635.34065774, 46324042.966053635, 138346594.04938716, 46324050.64921533, 138346597.98188913, 46324049.91748565, 0, 0, 0, 0, 0 },
-  { 138346599.64111522, 46324069.76758898, 138346560.35477912, 46324077.28980914, 138346638.9274513, 46324062.24536882, 138346597.6767984, 46324070.14369999, 138346601.60543203, 46324069.39147797, 0, 0, 0, 0, 0 },
-  { 138346603.36146614, 46324089.197883986, 138346564.13692382, 46324097.035950094, 138346642.58600846, 46324081.35981788, 138346601.40023902, 46324089.58978729, 138346605.32269326, 46324088.80598068, 0, 0, 0, 0, 0 },
-  { 138346607.2307698, 46324108.56129118, 138346568.0939556, 46324116.82626391, 138346646.36758402, 46324100.29631845, 138346605.2739291, 46324108.97453982, 138346609.18761054, 46324108.148042545, 0, 0, 0, 0, 0 },
-  { 138346611.3031049, 46324127.84486622, 138346572.28373533, 46324136.64763843, 138346650.32247448, 46324119.042094015, 138346609.35213643, 46324128.28500483, 138346613.25407338, 46324127.404727615, 0, 0, 0, 0, 0 },
-  { 138346615.63255027, 46324147.035664834, 138346576.76505968, 46324156.48649423, 138346654.50004086, 46324137.58483544, 138346613.68917575, 46324147.5082063, 138346617.57592478, 46324146.56312337, 0, 0, 0, 0, 0 },
-  { 138346620.2731847, 46324166.120742664, 138346581.59761146, 46324176.32858451, 138346658.94875792, 46324155.91290082, 138346618.339406, 46324166.631134756, 138346622.20696336, 46324165.61035057, 0, 0, 0, 0, 0 },
-  { 138346625.279087, 46324185.087155424, 138346586.8418706, 46324196.158758566, 138346663.7163034, 46324174.01555228, 138346623.3572262, 46324185.64073558, 138346627.20094782, 46324184.53357527, 0, 0, 0, 0, 0 },
-  { 138346630.70433596, 46324203.92195877, 138346592.55897304, 46324215.96069988, 138346668.84969887, 46324191.883217655, 138346628.79706782, 46324204.52389582, 138346632.6116041, 46324203.32002171, 0, 0, 0, 0, 0 },
-  { 138346636.6030104, 46324222.61220842, 138346598.81050375, 46324235.71665205, 138346674.39551702, 46324209.50776479, 138346634.71338505, 46324223.2674306, 138346638.49263573, 46324221.95698623, 0, 0, 0, 0, 0 },
-  { 138346643.02918902, 46324241.144960016, 138346605.65821472, 46324255.407157555, 138346680.40016332, 46324226.88276248, 138346641.1606403, 46324241.8580699, 138346644.89773774, 46324240.431850135, 1, 1, 138346517.83642507, 46324288.92332178, 33 },
-  { 138346650.0369507, 46324259.50726928, 138346613.15935898, 46324275.00059779, 138346686.91454244, 46324244.01394077, 138346648.19307113, 46324260.28193571, 138346651.8808303, 46324258.73260285, 0, 0, 0, 0, 0 },
-  { 138346657.6732417, 46324277.68335207, 138346621.33828872, 46324294.409714244, 138346694.00819468, 46324260.95698989, 138346655.85649407, 46324278.51967017, 138346659.48998934, 46324276.84703396, 0, 0, 0, 0, 0 },
-  { 138346665.93894976, 46324295.639086284, 138346630.1867294, 46324313.5772785, 138346701.69117013, 46324277.700894065, 138346664.15133876, 46324296.53599589, 138346667.72656077, 46324294.742176674, 0, 0, 0, 0, 0 },
-  { 138346674.81666338, 46324313.33306401, 138346639.68927577, 46324332.465932064, 138346709.944051, 46324294.20019596, 138346673.060294, 46324314.289707415, 138346676.57303277, 46324312.37642061, 0, 0, 0, 0, 0 },
-  { 138346684.28892434, 46324330.723858796, 138346649.83116776, 46324351.037967466, 138346718.74668092, 46324310.40975013, 138346682.5660365, 46324331.73956423, 138346686.01181218, 46324329.70815336, 0, 0, 0, 0, 0 },
-  { 138346694.33827457, 46324347.77004427, 138346660.5870933, 46324369.23764226, 138346728.08945584, 46324326.302446276, 138346692.6507155, 46324348.843424164, 138346696.02583364, 46324346.69666437, 1, 0, 138346472.42425779, 46324488.919501044, 48 },
-  { 138346704.94268185, 46324364.44220631, 138346671.89105356, 46324386.97196146, 138346737.99431014, 46324341.912451155, 138346703.29010043, 46324365.56869406, 138346706.59526327, 46324363.315718554, 1, 2, 138346978.44490597, 46324178.008482434, 39 },
-  { 138346716.06298143, 46324380.75592147, 138346683.6848415, 46324404.24328095, 138346748.44112134, 46324357.26856199, 138346714.44407442, 46324381.93028944, 138346717.68188843, 46324379.5815535, 0, 0, 0, 0, 0 },
-  { 138346727.6559985, 46324396.737297714, 138346695.91658258, 46324421.08086928, 138346759.3954144, 46324372.39372615, 138346726.0690277, 46324397.95447629, 138346729.2429693, 46324395.52011914, 1, 2, 138346983.15829673, 46324200.77154662, 31 },
-  { 138346739.6785581, 46324412.41244296, 138346708.53569806, 46324437.51467927, 138346770.82141817, 46324387.31020665, 138346738.1214151, 46324413.66755477, 138346741.2357011, 46324411.15733115, 0, 0, 0, 0, 0 },
-  { 138346752.08748537, 46324427.80746516, 138346721.49282786, 46324453.575020954, 138346782.68214288, 46324402.03990936, 138346750.5577525, 46324429.09584295, 138346753.61721826, 46324426.51908737, 1, 5, 138346843.8714579, 46324350.50479777, 29 },
-  { 138346764.83960536, 46324442.948472194, 138346734.73971406, 46324469.29228632, 138346794.93949667, 46324416.60465807, 138346763.3346108, 46324444.2656629, 138346766.34459993, 46324441.63128149, 0, 0, 0, 0, 0 },
-  { 138346777.8917432, 46324457.86157206, 138346748.22906458, 46324484.69672617, 138346807.55442184, 46324431.02641794, 138346776.40860927, 46324459.203329764, 138346779.37487715, 46324456.51981435, 0, 0, 0, 0, 0 },
-  { 138346791.20072392, 46324472.57287261, 138346761.9144117, 46324499.81827435, 138346820.48703614, 46324445.32747087, 138346789.7364083, 46324473.935142696, 138346792.66503954, 46324471.21060252, 1, 0, 138346542.26707, 46324704.15878743, 39 },
-  { 138346804.72337267, 46324487.108481854, 138346775.74997604, 46324514.68641301, 138346833.6967693, 46324459.530550696, 138346803.27470285, 46324488.48737841, 138346806.1720425, 46324485.7295853, 1, 0, 138347014.78049833, 46324287.16848095, 30 },
-  { 138346818.41651452, 46324501.494507685, 138346789.69478437, 46324529.33444694, 138346847.13824466, 46324473.654568434, 138346816.980428, 46324502.88650465, 138346819.85260102, 46324500.10251072, 1, 2, 138346681.98829633, 46324633.734219134, 30 },
-  { 138346832.23944, 46324515.75525487, 138346803.75432962, 46324543.83725066, 138346860.72455037, 46324487.67325909, 138346830.81518447, 46324517.159354664, 138346833.6636955, 46324514.35115508, 1, 5, 138346943.3313704, 46324406.23547131, 26 },
-  { 138346846.17897412, 46324529.89488979, 138346817.9452641, 46324558.22963203, 138346874.41268414, 46324501.560147546, 138346844.76728863, 46324531.311626896, 138346847.59065962, 46324528.47815268, 1, 3, 138346722.65649274, 46324653.8593871, 44 },
-  { 138346860.23918545, 46324543.90496711, 138346832.27253655, 46324572.50333331, 138346888.20583436, 46324515.306600906, 138346858.840853, 46324545.33488542, 138346861.6375179, 46324542.475048795, 0, 0, 0, 0, 0 },
-  { 138346874.42440745, 46324557.77684777, 138346846.7409192, 46324586.649403565, 138346902.1078957, 46324528.90429198, 138346873.04023305, 46324559.22047556, 138346875.80858186, 46324556.33321998, 0, 0, 0, 0, 0 },
-  { 138346888.73897368, 46324571.501892716, 138346861.3551957, 46324600.65885936, 138346916.12275165, 46324542.344926074, 138346887.36978477, 46324572.95974105, 138346890.10816258, 46324570.04404438, 0, 0, 0, 0, 0 },
-  { 138346903.18721756, 46324585.07146282, 138346876.12015834, 46324614.52268191, 138346930.25427678, 46324555.62024373, 138346901.8338646, 46324586.544023775, 138346904.54057053, 46324583.59890186, 1, 5, 138346757.02509785, 46324744.108045906, 50 },
-  { 138346917.7734726, 46324598.47691906, 138346891.04060516, 46324628.23181443, 138346944.50634006, 46324568.722023696, 138346916.43682924, 46324599.96466383, 138346919.11011598, 46324596.98917429, 0, 0, 0, 0, 0 },
-  { 138346932.50207227, 46324611.709622376, 138346906.121336, 46324641.77715892, 138346958.88280854, 46324581.64208583, 138346931.18303546, 46324613.2129992, 138346933.8211091, 46324610.20624555, 0, 0, 0, 0, 0 },
-  { 138346947.37735, 46324624.760933645, 138346921.3671487, 46324655.14957344, 138346973.3875513, 46324594.37229385, 138346946.07683992, 46324626.28036563, 138346948.67786008, 46324623.24150166, 1, 2, 138347122.94620878, 46324419.63761506, 30 },
-  { 138346962.40363935, 46324637.622213826, 138346936.78283453, 46324668.339869335, 138346988.02444416, 46324606.904558316, 138346961.1225991, 46324639.158096604, 138346963.6846796, 46324636.08633105, 1, 5, 138346777.9338446, 46324858.7893335, 29 },
-  { 138346977.58527377, 46324650.28482385, 138346952.3731733, 46324681.33880894, 138347002.79737425, 46324619.23083876, 138346976.32466874, 46324651.8375231, 138346978.8458788, 46324648.7321246, 0, 0, 0, 0, 0 },
-  { 138346992.92658678, 46324662.740124635, 138346968.1429279, 46324694.13710304, 138347017.71024564, 46324631.34314623, 138346991.68740383, 46324664.30997355, 138346994.16576973, 46324661.17027572, 0, 0, 0, 0, 0 },
-  { 138347008.4319118, 46324674.97947713, 138346984.09683865, 46324706.72540939, 138347032.76698494, 46324643.23354487, 138347007.21515813, 46324676.56677374, 138347009.64866546, 46324673.39218052, 1, 5, 138347079.00362393, 46324582.91627359, 40 },
-  { 138347024.10558233, 46324686.99424223, 138347000.2396167, 46324719.094330765, 138347047.97154796, 46324654.89415369, 138347022.91228405, 46324688.59924666, 138347025.2988806, 46324685.3892378, 0, 0, 0, 0, 0 },
-  { 138347039.9519319, 46324698.775780894, 138347016.57593754, 46324731.234414384, 138347063.32792625, 46324666.317147404, 138347038.78313217, 46324700.39871257, 138347041.12073162, 46324697.15284922, 0, 0, 0, 0, 0 },
-  { 138347055.97529396, 46324710.31545404, 138347033.11043376, 46324743.13615129, 138347078.84015417, 46324677.494756795, 138347054.83205095, 46324711.95648891, 138347057.11853698, 46324708.67441918, 1, 0, 138346906.7820811, 46324924.47050357, 27 },
-  { 138347072.18000194, 46324721.60462258, 138347049.84887552, 46324754.79077621, 138347094.51112837, 46324688.41846895, 138347071.06344563, 46324723.26393026, 138347073.29655826, 46324719.9453149, 0, 0, 0, 0, 0 },
-  { 138347088.57061926, 46324732.633949794, 138347066.8238066, 46324766.20590446, 138347110.3174319, 46324699.06199513, 138347087.48327863, 46324734.31254753, 138347089.65795988, 46324730.95535206, 0, 0, 0, 0, 0 },
-  { 138347105.1569945, 46324743.37806041, 138347084.07475865, 46324777.37128521, 138347126.23923033, 46324709.38483561, 138347104.1028827, 46324745.07772165, 138347106.21110627, 46324741.67839917, 1, 2, 138347187.90477014, 46324609.95465307, 50 },
-  { 138347121.95425963, 46324753.79554528, 138347101.62098345, 46324788.24199473, 138347142.28753582, 46324719.34909583, 138347120.9375958, 46324755.51786775, 138347122.97092345, 46324752.07322281, 0, 0, 0, 0, 0 },
-  { 138347138.9777765, 46324763.844298504, 138347119.480718, 46324798.77086016, 138347158.474835, 46324728.91773685, 138347138.00292358, 46324765.59062659, 138347139.95262942, 46324762.09797042, 1, 4, 138347325.66211185, 46324429.42247067, 40 },
-  { 138347156.24290672, 46324773.48221413, 138347137.67195576, 46324808.90988383, 138347174.81385767, 46324738.054544434, 138347155.31435916, 46324775.25359762, 138347157.17145428, 46324771.710830644, 0, 0, 0, 0, 0 },
-  { 138347173.76501203, 46324782.66718625, 138347156.21209425, 46324818.61012822, 138347191.3179298, 46324746.72424429, 138347172.88736615, 46324784.46433335, 138347174.6426579, 46324780.87003916, 0, 0, 0, 0, 0 },
-  { 138347191.55938765, 46324791.357159734, 138347175.09508866, 46324827.81160883, 138347208.02368665, 46324754.90271064, 138347190.7361727, 46324793.17988219, 138347192.3826026, 46324789.53443728, 0, 0, 0, 0, 0 },
-  { 138347209.6301274, 46324799.51863438, 138347194.27794087, 46324836.45520662, 138347224.98231393, 46324762.58206214, 138347208.86251807, 46324801.36546299, 138347210.39773673, 46324797.67180577, 1, 5, 138347280.63399005, 46324628.68698776, 39 },
-  { 138347227.9576248, 46324807.13621071, 138347213.7363112, 46324844.522762306, 138347242.1789384, 46324769.74965911, 138347227.2465591, 46324809.00553829, 138347228.66869047, 46324805.26688313, 0, 0, 0, 0, 0 },
-  { 138347246.51925778, 46324814.196792446, 138347233.4490532, 46324852.00115399, 138347259.58946237, 46324776.3924309, 138347245.86574754, 46324816.087010525, 138347247.17276803, 46324812.30657437, 0, 0, 0, 0, 0 },
-  { 138347265.2924042, 46324820.687283345, 138347253.39504707, 46324858.87697951, 138347277.18976134, 46324782.49758718, 138347264.69753635, 46324822.596768156, 138347265.88727206, 46324818.77779853, 0, 0, 0, 0, 0 },
-  { 138347284.25444204, 46324826.59458712, 138347273.55317366, 46324865.13654938, 138347294.9557104, 46324788.05262485, 138347283.71937862, 46324828.52168523, 138347284.78950545, 46324824.66748901, 1, 1, 138347324.38419843, 46324682.06222862, 41 },
-  { 138347303.38274905, 46324831.90560749, 138347293.90228638, 46324870.76588062, 138347312.86321172, 46324793.04533436, 138347302.90872592, 46324833.848621145, 138347303.85677218, 46324829.96259384, 0, 0, 0, 0, 0 },
-  { 138347322.6547032, 46324836.607248195, 138347314.42117956, 46324875.75069067, 138347330.88822684, 46324797.46380572, 138347322.24302703, 46324838.56442032, 138347323.06637937, 46324834.65007607, 1, 4, 138347372.6733593, 46324598.81083518, 41 },
-  { 138347342.04768237, 46324840.68641299, 138347335.08855334, 46324880.07639297, 138347349.0068114, 46324801.29643301, 138347341.69972593, 46324842.65591199, 138347342.39563882, 46324838.71691399, 0, 0, 0, 0, 0 },
-  { 138347361.53906444, 46324844.13000557, 138347355.88266575, 46324883.728050396, 138347367.19546312, 46324804.53196074, 138347361.2562445, 46324846.109907806, 138347361.82188436, 46324842.15010333, 0, 0, 0, 0, 0 },
-  { 138347381.10629138, 46324846.925093986, 138347376.75584096, 46324886.68780995, 138347385.4567418, 46324807.16237802, 138347380.88876885, 46324848.913229786, 138347381.32381392, 46324844.93695819, 0, 0, 0, 0, 0 },
-  { 138347400.73211893, 46324849.072361544, 138347397.64377537, 46324888.95296001, 138347403.8204625, 46324809.19176308, 138347400.57770175, 46324851.06639147, 138347400.88653612, 46324847.07833162, 0, 0, 0, 0, 0 },
-  { 138347420.40851524, 46324850.59609675, 138347418.53056347, 46324890.55198864, 138347422.28646702, 46324810.640204854, 138347420.31461766, 46324852.593891345, 138347420.50241283, 46324848.59830215, 0, 0, 0, 0, 0 },
-  { 138347440.12836716, 46324851.52294205, 138347439.40648764, 46324891.51642764, 138347440.85024667, 46324811.52945646, 138347440.09227318, 46324853.522616334, 138347440.16446114, 46324849.52326777, 1, 3, 138347444.74839607, 46324595.56463425, 35 },
-  { 138347459.88456163, 46324851.87953993, 138347460.26261514, 46324891.87775333, 138347459.5065081, 46324811.88132653, 138347459.90346432, 46324853.8794506, 138347459.86565894, 46324849.87962926, 0, 0, 0, 0, 0 },
-  { 138347479.6699855, 46324851.69253285, 138347481.0907079, 46324891.66729424, 138347478.2492631, 46324811.71777146, 138347479.74102163, 46324853.691270925, 138347479.59894937, 46324849.69379478, 0, 0, 0, 0, 0 },
-  { 138347499.47752562, 46324850.98856327, 138347501.88312584, 46324890.916161336, 138347497.0719254, 46324811.0609652, 138347499.59780562, 46324852.984943174, 138347499.35724562, 46324848.992183365, 0, 0, 0, 0, 0 },
-  { 138347519.30006889, 46324849.79427368, 138347522.63272956, 46324889.65519907, 138347515.9674082, 46324809.93334829, 138347519.46670192, 46324851.78731995, 138347519.13343585, 46324847.80122741, 0, 0, 0, 0, 0 },
-  { 138347539.1305021, 46324848.136306524, 138347543.3328302, 46324887.91494952, 138347534.92817402, 46324808.35766353, 138347539.34061852, 46324850.12523867, 138347538.9203857, 46324846.14737438, 0, 0, 0, 0, 0 },
-  { 138347558.9617035, 46324846.04128245, 138347564.23294666, 46324885.692436226, 138347553.69046035, 46324806.39012868, 138347559.22526568, 46324848.023840144, 138347558.69814134, 46324844.05872476, 1, 5, 138347525.88465267, 46324597.23029252, 28 },
-  { 138347578.73703885, 46324843.41234001, 138347586.14278084, 46324882.72079947, 138347571.33129686, 46324804.10388055, 138347579.10732594, 46324845.37776298, 138347578.36675176, 46324841.446917035, 0, 0, 0, 0, 0 },
-  { 138347598.23406175, 46324839.73908689, 138347609.02900988, 46324878.254916035, 138347587.43911362, 46324801.22325774, 138347598.77380916, 46324841.664878346, 138347597.69431433, 46324837.81329543, 0, 0, 0, 0, 0 },
-  { 138347617.1956552, 46324834.42466365, 138347632.46717498, 46324871.39466072, 138347601.92413542, 46324797.45466658, 138347617.9592312, 46324836.273163505, 138347616.4320792, 46324832.57616379, 1, 3, 138347704.625106, 46325046.07789687, 39 },
-  { 138347635.37460354, 46324826.91532658, 138347654.85990596, 46324861.848448254, 138347615.88930112, 46324791.98220491, 138347636.34886867, 46324828.66198266, 138347634.4003384, 46324825.1686705, 1, 2, 138347544.76794732, 46324664.476310804, 48 },
-  { 138347652.66464573, 46324817.27113549, 138347675.30823147, 46324850.24488301, 138347630.02106, 46324784.297387965, 138347653.79682502, 46324818.919822864, 138347651.53246644, 46324815.62244811, 0, 0, 0, 0, 0 },
-  { 138347669.06446174, 46324806.00912654, 138347693.99656186, 46324837.288359, 138347644.13236162, 46324774.72989407, 138347670.31106675, 46324807.57308816, 138347667.81785673, 46324804.44516491, 0, 0, 0, 0, 0 },
-  { 138347684.57806888, 46324793.643516, 138347711.30656797, 46324823.40233548, 138347657.8495698, 46324763.88469651, 138347685.91449383, 46324795.13145697, 138347683.24164394, 46324792.15557502, 0, 0, 0, 0, 0 },
-  { 138347699.2568689, 46324780.45944823, 138347727.5129121, 46324808.77191938, 138347671.0008257, 46324752.14697709, 138347700.66967106, 46324781.875071794, 138347697.84406674, 46324779.04382467, 0, 0, 0, 0, 0 },
-  { 138347713.19144666, 46324766.552642666, 138347742.7238795, 46324793.5310676, 138347683.65901384, 46324739.57421773, 138347714.6680683, 46324767.90156391, 138347711.71482503, 46324765.20372142, 1, 4, 138347935.42300358, 46324969.56529033, 33 },
-  { 138347726.47356457, 46324752.013126165, 138347757.04940656, 46324777.80300572, 138347695.89772257, 46324726.22324661, 138347728.00235668, 46324753.30262014, 138347724.94477245, 46324750.72363219, 0, 0, 0, 0, 0 },
-  { 138347739.19498482, 46324736.930925615, 138347770.6019694, 46324761.701902986, 138347707.78800026, 46324712.159948245, 138347740.76533404, 46324738.16947448, 138347737.6246356, 46324735.69237675, 1, 3, 138347904.86682844, 46324867.597831264, 29 },
-  { 138347751.4474699, 46324721.39606788, 138347783.49366462, 46324745.334351085, 138347719.40127516, 46324697.457784675, 138347753.04977962, 46324722.59298204, 138347749.84516016, 46324720.19915372, 1, 5, 138347552.7610625, 46324572.97871201, 47 },
-  { 138347763.3227822, 46324705.49857986, 138347795.8341952, 46324728.80111241, 138347730.81136918, 46324682.196047306, 138347764.94835284, 46324706.66370649, 138347761.69721153, 46324704.33345323, 0, 0, 0, 0, 0 },
-  { 138347774.91268393, 46324689.3284884, 138347807.72960868, 46324712.19876279, 138347742.09575918, 46324666.458214015, 138347776.55353016, 46324690.47200212, 138347773.2718377, 46324688.184974685, 0, 0, 0, 0, 0 },
-  { 138347786.30893773, 46324672.975820445, 138347819.2815803, 46324695.621015124, 138347753.33629516, 46324650.330625765, 138347787.95756987, 46324674.10808018, 138347784.6603056, 46324671.84356071, 1, 5, 138347968.4827879, 46324798.090521045, 34 },
-  { 138347797.6033056, 46324656.5306028, 138347830.5870395, 46324679.1596394, 138347764.61957172, 46324633.90156619, 138347799.2524923, 46324657.66205463, 138347795.9541189, 46324655.39915097, 1, 2, 138347590.63037536, 46324514.533398084, 47 },
-  { 138347808.88755018, 46324640.08286238, 138347841.73801294, 46324662.90493712, 138347776.0370874, 46324617.260787636, 138347810.53007331, 46324641.223966114, 138347807.24502704, 46324638.94175864, 0, 0, 0, 0, 0 },
-  { 138347820.25343376, 46324623.722626075, 138347852.8216014, 46324646.94577094, 138347787.68526614, 46324600.49948121, 138347821.88184214, 46324624.88378332, 138347818.6250254, 46324622.56146883, 0, 0, 0, 0, 0 },
-  { 138347831.7927177, 46324607.53991975, 138347863.9572576, 46324631.31895196, 138347799.6281778, 46324583.76088754, 138347833.40094468, 46324608.72887136, 138347830.1844907, 46324606.35096814, 0, 0, 0, 0, 0 },
-  { 138347843.57546857, 46324591.60206503, 138347875.3428025, 46324615.90919352, 138347811.80813465, 46324567.29493653, 138347845.16383526, 46324592.81742145, 138347841.98710188, 46324590.3867086, 0, 0, 0, 0, 0 },
-  { 138347855.5939411, 46324575.89495137, 138347887.00375172, 46324600.662345186, 138347824.18413046, 46324551.12755756, 138347857.16443163, 46324577.13332106, 138347854.02345055, 46324574.656581685, 0, 0, 0, 0, 0 },
-  { 138347867.82295138, 46324560.3862184, 138347898.91861984, 46324585.546890125, 138347836.7272829, 46324535.22554667, 138347869.3777348, 46324561.64425199, 138347866.26816794, 46324559.12818481, 0, 0, 0, 0, 0 },
-  { 138347880.23731565, 46324545.043505765, 138347911.06529862, 46324570.53145325, 138347849.4093327, 46324519.55555828, 138347881.7787148, 46324546.31790314, 138347878.6959165, 46324543.76910839, 1, 2, 138348049.7912219, 46324685.22721695, 38 },
-  { 138347892.81185016, 46324529.83445311, 138347923.42106935, 46324555.58470941, 138347862.20263097, 46324504.08419681, 138347894.3423111, 46324531.12196593, 138347891.2813892, 46324528.5469403, 0, 0, 0, 0, 0 },
-  { 138347905.5213711, 46324514.7267001, 138347935.9626231, 46324540.675306566, 138347875.0801191, 46324488.77809363, 138347907.0434337, 46324516.02413042, 138347903.9993085, 46324513.429269776, 0, 0, 0, 0, 0 },
-  { 138347918.3406947, 46324499.68788634, 138347948.66191578, 46324525.7766493, 138347888.0194736, 46324473.59912339, 138347919.85675576, 46324500.992324494, 138347916.82463363, 46324498.38344819, 1, 5, 138347725.80094087, 46324334.02424157, 30 },
-  { 138347931.24650583, 46324484.688326836, 138347961.44868982, 46324510.914803565, 138347901.04432184, 46324458.46185011, 138347932.756615, 46324485.99965067, 138347929.73639664, 46324483.377003, 0, 0, 0, 0, 0 },
-  { 138347944.23678833, 46324469.72882974, 138347974.29037425, 46324496.12545781, 138347914.18320242, 46324443.332201675, 138347945.73946762, 46324471.04866114, 138347942.73410904, 46324468.40899834, 0, 0, 0, 0, 0 },
-  { 138347957.3230686, 46324454.82959159, 138347987.19736174, 46324481.42896394, 138347927.44877544, 46324428.23021924, 138347958.81678325, 46324456.1595602, 138347955.82935393, 46324453.49962297, 0, 0, 0, 0, 0 },
-  { 138347970.51708978, 46324440.01111949, 138348000.18058202, 46324466.84537425, 138347940.85359755, 46324413.176864736, 138347972.0002644, 46324441.35283223, 138347969.03391516, 46324438.66940676, 1, 4, 138347777.70439026, 46324265.588463575, 38 },
-  { 138347983.8305952, 46324425.2939206, 138348013.25080815, 46324452.39467834, 138347954.41038224, 46324398.19316286, 138347985.30160585, 46324426.64895849, 138347982.35958454, 46324423.93888271, 1, 0, 138348058.11663288, 46324493.7233339, 38 },
-  { 138347997.27532804, 46324410.69850201, 138348026.41866332, 46324438.0967868, 138347968.13199276, 46324383.300217226, 138347998.7324948, 46324412.06841625, 138347995.81816128, 46324409.32858777, 0, 0, 0, 0, 0 },
-  { 138348010.8630317, 46324396.24537087, 138348039.69463122, 46324423.97151139, 138347982.03143215, 46324368.51923036, 138348012.30461165, 46324397.631677896, 138348009.42145172, 46324394.85906385, 0, 0, 0, 0, 0 },
-  { 138348024.60544926, 46324381.955034286, 138348053.0890662, 46324410.03854484, 138347996.1218323, 46324353.87152373, 138348026.0296301, 46324383.35920981, 138348023.18126842, 46324380.55085876, 0, 0, 0, 0, 0 },
-  { 138348038.5143241, 46324367.847999394, 138348066.61220908, 46324396.31743667, 138348010.41643912, 46324339.378562115, 138348039.91921836, 46324369.271471255, 138348037.10942984, 46324366.42452753, 0, 0, 0, 0, 0 },
-  { 138348052.60139942, 46324353.94477333, 138348080.27420428, 46324382.827568755, 138348024.92859456, 46324325.06197791, 138348053.98503965, 46324355.3889131, 138348051.2177592, 46324352.50063356, 0, 0, 0, 0, 0 },
-  { 138348066.8784185, 46324340.265863195, 138348094.08512238, 46324369.588128865, 138348039.67171463, 46324310.943597525, 138348068.2387537, 46324341.73197648, 138348065.5180833, 46324338.79974991, 1, 3, 138348168.90355805, 46324450.22435945, 35 },
-  { 138348081.35712463, 46324326.83177613, 138348108.05498752, 46324356.61808366, 138348054.65926173, 46324297.04546859, 138348082.69201776, 46324328.3210915, 138348080.0222315, 46324325.34246075, 0, 0, 0, 0, 0 },
-  { 138348096.04926097, 46324313.66301926, 138348122.19380975, 46324343.93615207, 138348069.9047122, 46324283.389886454, 138348097.3564884, 46324315.1766759, 138348094.74203354, 46324312.14936262, 0, 0, 0, 0, 0 },
-  { 138348110.96657082, 46324300.780099705, 138348136.51162422, 46324331.560779475, 138348085.42151743, 46324269.999419935, 138348112.2438235, 46324302.31913369, 138348109.68931815, 46324299.24106572, 0, 0, 0, 0, 0 },
-  { 138348126.12079754, 46324288.203524604, 138348151.0188329, 46324319.509879164, 138348101.2227622, 46324256.897170044, 138348127.36569932, 46324289.76884233, 138348124.87589577, 46324286.63820688, 0, 0, 0, 0, 0 },
-  { 138348141.52358142, 46324275.95364554, 138348165.75244448, 46324307.78071256, 138348117.29471835, 46324244.126578525, 138348142.73502457, 46324277.54499889, 138348140.31213826, 46324274.36229219, 1, 3, 138348069.4427138, 46324181.268121175, 49 },
-  { 138348157.17738867, 46324264.03693477, 138348180.7635386, 46324296.34318078, 138348133.59123874, 46324231.73068876, 138348158.35669616, 46324265.65224707, 138348155.99808118, 46324262.42162247, 0, 0, 0, 0, 0 },
-  { 138348173.06839773, 46324252.435224004, 138348196.0457585, 46324285.17725956, 138348150.09103698, 46324219.69318845, 138348174.21726575, 46324254.07232578, 138348171.9195297, 46324250.79812223, 1, 1, 138347980.63300133, 46323978.22067623, 38 },
-  { 138348189.18111312, 46324241.12781235, 138348211.5858809, 46324274.26429347, 138348166.77634534, 46324207.99133123, 138348190.30135152, 46324242.7846364, 138348188.06087473, 46324239.470988296, 1, 0, 138348288.8823297, 46324388.585153334, 48 },
-  { 138348205.50003922, 46324230.093998946, 138348227.37032872, 46324263.58564623, 138348183.62974972, 46324196.602351665, 138348206.5935537, 46324231.76858131, 138348204.40652475, 46324228.419416584, 0, 0, 0, 0, 0 },
-  { 138348222.0096806, 46324219.31308293, 138348243.38520518, 46324253.12265182, 138348200.63415602, 46324185.503514044, 138348223.07845682, 46324221.00356138, 138348220.94090438, 46324217.62260449, 0, 0, 0, 0, 0 },
-  { 138348238.6945417, 46324208.76436344, 138348259.61632824, 46324242.856574394, 138348217.77275515, 46324174.67215248, 138348239.740631, 46324210.46897399, 138348237.64845237, 46324207.05975289, 0, 0, 0, 0, 0 },
-  { 138348255.53912693, 46324198.42713957, 138348276.04926628, 46324232.768574946, 138348235.0289876, 46324164.0857042, 138348256.5646339, 46324200.144211344, 138348254.51361996, 46324196.7100678, 0, 0, 0, 0, 0 },
-  { 138348272.52794078, 46324188.280710466, 138348292.669373, 46324222.839684814, 138348252.38650855, 46324153.72173612, 138348273.5350124, 46324190.008659184, 138348271.52086917, 46324186.55276175, 0, 0, 0, 0, 0 },
-  { 138348289.64548776, 46324178.30437527, 138348309.46182027, 46324213.05078466, 138348269.82915524, 46324143.557965875, 138348290.63630438, 46324180.04169574, 138348288.65467113, 46324176.5670548, 0, 0, 0, 0, 0 },
-  { 138348306.8762723, 46324168.47743309, 138348326.4116278, 46324203.38258866, 138348287.34091678, 46324133.57227752, 138348307.85304007, 46324170.22269087, 138348305.8995045, 46324166.73217531, 0, 0, 0, 0, 0 },
-  { 138348324.20479885, 46324158.779183045, 138348343.5036902, 46324193.81563252, 138348304.90590748, 46324123.74273357, 138348325.16974342, 46324160.53100552, 138348323.23985428, 46324157.02736057, 0, 0, 0, 0, 0 },
-  { 138348341.61557183, 46324149.18892429, 138348360.7228005, 46324184.3302648, 138348322.50834316, 46324114.04758378, 138348342.57093325, 46324150.945991315, 138348340.6602104, 46324147.431857266, 0, 0, 0, 0, 0 },
-  { 138348359.09309578, 46324139.68595594, 138348378.05367, 46324174.90664057, 138348340.13252157, 46324104.46527132, 138348360.0411245, 46324141.44699017, 138348358.14506707, 46324137.924921714, 0, 0, 0, 0, 0 },
-  { 138348376.62187517, 46324130.24957712, 138348395.47845843, 46324165.52604615, 138348357.7652919, 46324094.97310809, 138348377.56470433, 46324132.01340057, 138348375.679046, 46324128.48575367, 0, 0, 0, 0, 0 },
-  { 138348394.18706948, 46324120.86032819, 138348412.94291103, 46324156.190462746, 138348375.43122792, 46324085.530193634, 138348395.12486154, 46324122.62683492, 138348393.2492774, 46324119.09382146, 0, 0, 0, 0, 0 },
-  { 138348411.7842381, 46324111.51845303, 138348430.41087398, 46324146.916877225, 138348393.15760222, 46324076.12002884, 138348412.71556988, 46324113.28837424, 138348410.85290632, 46324109.748531826, 1, 4, 138348350.31633967, 46323994.703653194, 46 },
-  { 138348429.4172623, 46324102.23996314, 138348447.8851101, 46324137.72148786, 138348410.94941446, 46324066.758438416, 138348430.34065467, 46324104.014039375, 138348428.4938699, 46324100.4658869, 0, 0, 0, 0, 0 },
-  { 138348447.09025672, 46324093.04131188, 138348465.36943516, 46324128.620401755, 138348428.81107828, 46324057.46222201, 138348448.00421563, 46324094.82026637, 138348446.1762978, 46324091.26235739, 1, 3, 138348379.00031707, 46323960.50920212, 34 },
-  { 138348464.80733618, 46324083.93895266, 138348482.86760393, 46324119.62966195, 138348446.74706843, 46324048.24824338, 138348465.71034956, 46324085.72348813, 138348463.9043228, 46324082.154417194, 0, 0, 0, 0, 0 },
-  { 138348482.57261515, 46324074.94933881, 138348500.38331366, 46324110.76524336, 138348464.76191664, 46324039.13343426, 138348483.46315008, 46324076.74013404, 138348481.6820802, 46324073.15854358, 1, 3, 138348364.13147005, 46323836.77357357, 30 },
-  { 138348500.3902084, 46324066.08892371, 138348517.92021143, 46324102.04304716, 138348482.86020535, 46324030.134800255, 138348501.26670855, 46324067.88662988, 138348499.51370823, 46324064.291217536, 0, 0, 0, 0, 0 },
-  { 138348518.26423058, 46324057.374160744, 138348535.48190027, 46324093.478895195, 138348501.04656088, 46324021.26942629, 138348519.12511405, 46324059.179397464, 138348517.4033471, 46324055.568924025, 0, 0, 0, 0, 0 },
-  { 138348536.1987962, 46324048.82150326, 138348553.0719464, 46324085.088524126, 138348519.325646, 46324012.55448239, 138348537.04245374, 46324050.6348543, 138348535.3551387, 46324047.00815222, 0, 0, 0, 0, 0 },
-  { 138348554.19802016, 46324040.44740465, 138348570.6938904, 46324076.88757844, 138348537.70214993, 46324004.00723086, 138348555.02281368, 46324042.269413345, 138348553.37322664, 46324038.62539596, 0, 0, 0, 0, 0 },
-  { 138348572.2660169, 46324032.268318266, 138348588.35125577, 46324068.891604446, 138348556.18077803, 46323995.645032085, 138348573.07027885, 46324034.09948257, 138348571.46175495, 46324030.43715396, 0, 0, 0, 0, 0 },
-  { 138348590.40690112, 46324024.30069748, 138348606.04756296, 46324061.116043426, 138348574.7662393, 46323987.48535154, 138348591.1889342, 46324026.14146478, 138348589.62486804, 46324022.45993019, 1, 2, 138348460.5894078, 46323718.733326145, 30 },
-  { 138348608.62478748, 46324016.56099566, 138348623.7863425, 46324053.57622562, 138348593.46323246, 46323979.5457657, 138348609.38286522, 46324018.411757156, 138348607.86670974, 46324014.710234165, 0, 0, 0, 0, 0 },
-  { 138348626.9237907, 46324009.06566619, 138348641.57115144, 46324046.28736448, 138348612.27642995, 46323971.8439679, 138348627.65615872, 46324010.92675111, 138348626.19142267, 46324007.204581276, 1, 0, 138348533.180682, 46323770.84679714, 25 },
-  { 138348645.30802533, 46324001.83116242, 138348659.4055902, 46324039.264552124, 138348631.21046045, 46323964.39777272, 138348646.01290357, 46324003.70283191, 138348644.6031471, 46323999.95949294, 0, 0, 0, 0, 0 },
-  { 138348663.78160608, 46323994.873937726, 138348677.29332292, 46324032.522755876, 138348650.26988924, 46323957.225119576, 138348664.4571919, 46323996.756378636, 138348663.10602024, 46323992.99149682, 0, 0, 0, 0, 0 },
-  { 138348682.34864762, 46323988.21044548, 138348695.2380983, 46324026.076816596, 138348669.45919695, 46323950.34407436, 138348682.99312016, 46323990.103764035, 138348681.70417508, 46323986.31712692, 0, 0, 0, 0, 0 },
-  { 138348701.01326457, 46323981.85713904, 138348713.24377242, 46324019.941449165, 138348688.78275672, 46323943.77282892, 138348701.62478995, 46323983.76135455, 138348700.40173918, 46323979.95292354, 1, 1, 138348664.93326637, 46323869.508424185, 25 },
-  { 138348719.77957153, 46323975.830471784, 138348731.31433314, 46324014.1312456, 138348708.24480993, 46323937.52969797, 138348720.35630962, 46323977.745510474, 138348719.20283344, 46323973.915433094, 0, 0, 0, 0, 0 },
-  { 138348738.6516832, 46323970.146897085, 138348749.45392537, 46324008.66068117, 138348727.84944105, 46323931.633113, 138348739.19179532, 46323972.07258629, 138348738.1115711, 46323968.22120788, 0, 0, 0, 0, 0 },
-  { 138348757.63371423, 46323964.82286829, 138348767.66687632, 46324003.544124186, 138348747.60055214, 46323926.10161239, 138348758.13537234, 46323966.758931085, 138348757.13205612, 46323962.88680549, 1, 2, 138348852.94875416, 46324332.67479932, 38 },
-  { 138348776.7297793, 46323959.87483879, 138348785.957706, 46323998.79585328, 138348767.5018526, 46323920.953824304, 138348777.19117564, 46323961.82088952, 138348776.26838297, 46323957.928788066, 1, 4, 138348696.4468171, 46323621.26201272, 38 },
-  { 138348795.94395766, 46323955.31927847, 138348804.32844576, 46323994.43066248, 138348787.55946955, 46323916.20789446, 138348796.36318207, 46323957.27484767, 138348795.52473325, 46323953.36370927, 1, 4, 138348819.00129992, 46324062.875584505, 49 },
-  { 138348815.274794, 46323951.17523777, 138348822.771553, 46323990.4664404, 138348807.778035, 46323911.88403513, 138348815.64963195, 46323953.139797896, 138348814.89995608, 46323949.21067764, 1, 4, 138348746.4920302, 46323590.67845359, 47 },
-  { 138348834.70933476, 46323947.46712861, 138348841.27176785, 46323986.92513758, 138348828.14690167, 46323908.009119645, 138348835.03745642, 46323949.44002906, 138348834.3812131, 46323945.49422816, 0, 0, 0, 0, 0 },
-  { 138348854.23319396, 46323944.220030665, 138348859.81315127, 46323983.82891952, 138348848.65323666, 46323904.61114181, 138348854.51219183, 46323946.20047511, 138348853.9541961, 46323942.23958622, 0, 0, 0, 0, 0 },
-  { 138348873.83198592, 46323941.459023595, 138348878.37994534, 46323981.19963337, 138348869.2840265, 46323901.71841382, 138348874.0593839, 46323943.446054086, 138348873.60458794, 46323939.4719931, 1, 0, 138348916.35540646, 46324313.03372497, 30 },
-  { 138348893.49132475, 46323939.209187075, 138348896.95663896, 46323979.058799334, 138348890.02601054, 46323899.35957482, 138348893.66459048, 46323941.20166769, 138348893.31805903, 46323937.21670646, 0, 0, 0, 0, 0 },
-  { 138348913.1968248, 46323937.49560078, 138348915.528069, 46323977.42760925, 138348910.8655806, 46323897.563592315, 138348913.313387, 46323939.49220121, 138348913.08026257, 46323935.499000356, 0, 0, 0, 0, 0 },
-  { 138348932.9341013, 46323936.34333189, 138348934.10416228, 46323976.32621519, 138348931.76404035, 46323896.360448584, 138348932.99260437, 46323938.342476055, 138348932.87559825, 46323934.34418772, 1, 2, 138348926.2062507, 46323706.44175289, 28 },
-  { 138348952.68996787, 46323935.76519528, 138348952.74334645, 46323975.76515967, 138348952.6365893, 46323895.765230894, 138348952.6926368, 46323937.7651935, 138348952.68729895, 46323933.76519706, 0, 0, 0, 0, 0 },
-  { 138348972.45467848, 46323935.73881996, 138348971.44967875, 46323975.72619266, 138348973.4596782, 46323895.75144725, 138348972.40442848, 46323937.738188595, 138348972.50492847, 46323933.73945132, 0, 0, 0, 0, 0 },
-  { 138348992.2191011, 46323936.23555776, 138348990.21463168, 46323976.185302466, 138348994.22357053, 46323896.28581305, 138348992.11887762, 46323938.23304499, 138348992.31932458, 46323934.238070525, 0, 0, 0, 0, 0 },
-  { 138349011.97410357, 46323937.226760544, 138349009.02916586, 46323977.11820501, 138349014.91904128, 46323897.33531608, 138349011.82685667, 46323939.221332766, 138349012.12135047, 46323935.23218832, 1, 1, 138349036.41708663, 46323606.12777145, 27 },
-  { 138349031.71055388, 46323938.683780156, 138349027.88382983, 46323978.50031169, 138349035.53727794, 46323898.867248625, 138349031.51921767, 46323940.67460673, 138349031.9018901, 46323936.69295358, 0, 0, 0, 0, 0 },
-  { 138349051.4193198, 46323940.57796846, 138349046.76885384, 46323980.3067133, 138349056.06978577, 46323900.84922363, 138349051.18679652, 46323942.5644057, 138349051.6518431, 46323938.591531225, 0, 0, 0, 0, 0 },
-  { 138349071.09126925, 46323942.88067729, 138349065.67416355, 46323982.512166865, 138349076.50837496, 46323903.249187715, 138349070.82041398, 46323944.862251766, 138349071.36212453, 46323940.899102814, 0, 0, 0, 0, 0 },
-  { 138349090.7172763, 46323945.563295476, 138349084.57595915, 46323985.089036755, 138349096.85859346, 46323906.0375542, 138349090.41021046, 46323947.53958254, 138349091.02434215, 46323943.58700841, 0, 0, 0, 0, 0 },
-  { 138349110.2894096, 46323948.604318224, 138349103.43599898, 46323988.01282952, 138349117.14282024, 46323909.19580693, 138349109.94673908, 46323950.57474379, 138349110.63208014, 46323946.633892655, 0, 0, 0, 0, 0 },
-  { 138349129.80234483, 46323951.9977516, 138349122.24503917, 46323991.27735358, 138349137.3596505, 46323912.718149625, 138349129.42447954, 46323953.9617317, 138349130.1802101, 46323950.0337715, 0, 0, 0, 0, 0 },
-  { 138349149.25110164, 46323955.73964797, 138349140.99811944, 46323994.87899243, 138349157.50408384, 46323916.60030351, 138349148.83845252, 46323957.69661519, 138349149.66375077, 46323953.78268075, 1, 3, 138349074.1489635, 46324311.90768254, 47 },
-  { 138349168.6306997, 46323959.826059744, 138349159.69025812, 46323998.814115666, 138349177.57114127, 46323920.83800382, 138349168.1836776, 46323961.77546254, 138349169.07772177, 46323957.87665695, 0, 0, 0, 0, 0 },
-  { 138349187.9361588, 46323964.25303937, 138349178.31645405, 46324003.07907806, 138349197.55586356, 46323925.42700067, 138349187.45517358, 46323966.1943413, 138349188.41714403, 46323962.31173743, 0, 0, 0, 0, 0 },
-  { 138349207.16249844, 46323969.01663918, 138349196.87168753, 46324007.67021871, 138349217.45330936, 46323930.36305965, 138349206.6479579, 46323970.949318156, 138349207.677039, 46323967.083960205, 0, 0, 0, 0, 0 },
-  { 138349226.30473852, 46323974.11291165, 138349215.35092288, 46324012.583860725, 138349237.25855416, 46323935.64196257, 138349225.75704774, 46323976.0364591, 138349226.8524293, 46323972.189364195, 0, 0, 0, 0, 0 },
-  { 138349245.35789856, 46323979.53790914, 138349233.74910942, 46324017.816310555, 138349256.9666877, 46323941.25950773, 138349244.7774591, 46323981.45182921, 138349245.938338, 46323977.623989075, 0, 0, 0, 0, 0 },
-  { 138349264.31699833, 46323985.287684046, 138349252.06118307, 46324023.3638576, 138349276.5728136, 46323947.211510494, 138349263.70420757, 46323987.19149272, 138349264.9297891, 46323983.38387537, 0, 0, 0, 0, 0 },
-  { 138349283.17705742, 46323991.358288795, 138349270.2820683, 46324029.222774215, 138349296.07204652, 46323953.493803374, 138349282.53230795, 46323993.251513064, 138349283.82180688, 46323989.465064526, 0, 0, 0, 0, 0 },
-  { 138349301.93309554, 46323997.74577577, 138349288.40667918, 46324035.389315195, 138349315.4595119, 46323960.10223634, 138349301.25677472, 46323999.62795274, 138349302.60941637, 46323995.863598794, 0, 0, 0, 0, 0 },
-  { 138349320.58013242, 46324004.44619737, 138349306.42992082, 46324041.85971781, 138349334.73034403, 46323967.03267693, 138349319.87262183, 46324006.316873394, 138349321.28764302, 46324002.57552134, 1, 2, 138349424.58418763, 46323729.45682212, 29 },
-  { 138349339.1131877, 46324011.45560601, 138349324.34669092, 46324048.63020182, 138349353.87968448, 46323974.28101021, 138349338.37486285, 46324013.3143358, 138349339.85151255, 46324009.59687623, 0, 0, 0, 0, 0 },
-  { 138349357.52728114, 46324018.7700541, 138349342.15138018, 46324055.696760826, 138349372.9031821, 46323981.84334738, 138349356.7584861, 46324020.61638944, 138349358.29607618, 46324016.923718765, 0, 0, 0, 0, 0 },
-  { 138349375.817297, 46324026.38582864, 138349359.78725538, 46324063.03330829, 138349391.84733865, 46323989.73834898, 138349375.01579493, 46324028.21820262, 138349376.6187991, 46324024.55345465, 0, 0, 0, 0, 0 },
-  { 138349393.96413454, 46324034.3234703, 138349377.1410291, 46324070.613732405, 138349410.78724, 46323998.0332082, 138349393.12297928, 46324036.137983404, 138349394.8052898, 46324032.5089572, 0, 0, 0, 0, 0 },
-  { 138349411.9227279, 46324042.6485496, 138349394.1608878, 46324078.48870914, 138349429.68456802, 46324006.808390066, 138349411.0346359, 46324044.44055758, 138349412.81081992, 46324040.856541626, 0, 0, 0, 0, 0 },
-  { 138349429.64518824, 46324051.43153246, 138349410.80456606, 46324086.71652864, 138349448.48581043, 46324016.146536276, 138349428.70315713, 46324053.19578227, 138349430.58721936, 46324049.66728265, 0, 0, 0, 0, 0 },
-  { 138349447.08362675, 46324060.74288479, 138349427.03246573, 46324095.354312696, 138349467.13478777, 46324026.13145689, 138349446.0810687, 46324062.47345619, 138349448.0861848, 46324059.012313396, 0, 0, 0, 0, 0 },
-  { 138349464.1901548, 46324070.65307253, 138349442.80842248, 46324104.458715886, 138349485.5718871, 46324036.84742917, 138349463.12106818, 46324072.343354695, 138349465.2592414, 46324068.96279036, 1, 5, 138349626.69132048, 46323813.73018303, 35 },
-  { 138349480.91688347, 46324081.232561626, 138349458.10314736, 46324114.0888159, 138349503.73061958, 46324048.37630735, 138349479.77619666, 46324082.87537434, 138349482.05757028, 46324079.58974891, 0, 0, 0, 0, 0 },
-  { 138349497.21169063, 46324092.546858974, 138349472.90144315, 46324124.31180611, 138349521.52193812, 46324060.781911835, 138349495.99617827, 46324094.13510633, 138349498.427203, 46324090.958611615, 0, 0, 0, 0, 0 },
-  { 138349512.98706603, 46324104.62001869, 138349487.13116506, 46324135.140051216, 138349538.842967, 46324074.099986166, 138349511.69427097, 46324106.146020316, 138349514.2798611, 46324103.094017066, 0, 0, 0, 0, 0 },
-  { 138349528.13787866, 46324117.45545425, 138349500.69304803, 46324146.55496063, 138349555.58270928, 46324088.355947874, 138349526.76563713, 46324118.910429575, 138349529.51012018, 46324116.00047893, 0, 0, 0, 0, 0 },
-  { 138349542.55886894, 46324131.05642847, 138349513.4929407, 46324158.5368181, 138349571.6247972, 46324103.57603884, 138349541.10557252, 46324132.43044795, 138349544.01216537, 46324129.68240899, 0, 0, 0, 0, 0 },
-  { 138349556.14477724, 46324145.4262042, 138349525.4507713, 46324171.07533674, 138349586.83878317, 46324119.777071655, 138349554.61007693, 46324146.708660826, 138349557.67947754, 46324144.14374757, 1, 5, 138349738.7741125, 46323992.813865565, 43 },
-  { 138349568.7953537, 46324160.56499568, 138349536.79532665, 46324184.56495961, 138349600.79538077, 46324136.565031745, 138349567.19535235, 46324161.764993876, 138349570.39535508, 46324159.36499748, 0, 0, 0, 0, 0 },
-  { 138349580.62731993, 46324176.34098768, 138349548.00565156, 46324199.48891964, 138349613.2489883, 46324153.19305573, 138349578.9962365, 46324177.49838428, 138349582.25840336, 46324175.18359108, 0, 0, 0, 0, 0 },
-  { 138349592.05282164, 46324192.44259573, 138349559.45604664, 46324215.62556923, 138349624.64959663, 46324169.25962222, 138349590.4229829, 46324193.601744406, 138349593.68266037, 46324191.28344705, 1, 2, 138349305.20120177, 46324396.45276259, 34 },
-  { 138349603.50517523, 46324208.54535291, 138349571.58102491, 46324232.64615427, 138349635.42932555, 46324184.44455156, 138349601.9089677, 46324209.75039298, 138349605.10138276, 46324207.340312846, 0, 0, 0, 0, 0 },
-  { 138349615.41769695, 46324224.324792296, 138349584.8845326, 46324250.1651846, 138349645.9508613, 46324198.48439999, 138349613.89103875, 46324225.61681191, 138349616.94435516, 46324223.03277268, 0, 0, 0, 0, 0 },
-  { 138349628.22370318, 46324239.45644696, 138349599.82883978, 46324267.62969193, 138349656.61856657, 46324211.28320199, 138349626.80396, 46324240.865109205, 138349629.64344636, 46324238.047784716, 0, 0, 0, 0, 0 },
-  { 138349642.30692616, 46324253.65045243, 138349615.5227463, 46324283.35916679, 138349669.09110603, 46324223.94173806, 138349640.96771717, 46324255.135888144, 138349643.64613515, 46324252.16501671, 0, 0, 0, 0, 0 },
-  { 138349657.28343076, 46324267.15266554, 138349630.43167964, 46324296.80032079, 138349684.13518187, 46324237.50501029, 138349655.9408432, 46324268.6350483, 138349658.62601832, 46324265.67028278, 0, 0, 0, 0, 0 },
-  { 138349672.16487977, 46324280.63072854, 138349643.52697542, 46324308.55688894, 138349700.80278412, 46324252.70456815, 138349670.73298454, 46324282.02703656, 138349673.596775, 46324279.23442052, 0, 0, 0, 0, 0 },
-  { 138349685.9465915, 46324294.76368978, 138349654.0231494, 46324318.86542923, 138349717.8700336, 46324270.66195033, 138349684.3504194, 46324295.968776755, 138349687.5427636, 46324293.5586028, 1, 2, 138349852.74657646, 46324168.83210114, 36 },
-  { 138349697.62388435, 46324310.23059759, 138349661.82982683, 46324328.08516134, 138349733.41794187, 46324292.37603384, 138349695.8341815, 46324311.12332578, 138349699.4135872, 46324309.337869406, 0, 0, 0, 0, 0 },
-  { 138349706.2974538, 46324327.61899463, 138349668.0487223, 46324339.32516985, 138349744.54618528, 46324315.912819415, 138349704.38501722, 46324328.20430339, 138349708.20989037, 46324327.03368587, 0, 0, 0, 0, 0 },
-  { 138349712.11016682, 46324346.61144056, 138349672.78941616, 46324353.95164278, 138349751.43091747, 46324339.27123834, 138349710.14412928, 46324346.97845067, 138349714.07620436, 46324346.24443045, 1, 2, 138349608.89319637, 46324365.8794714, 26 },
-  { 138349715.7993904, 46324366.37425313, 138349676.02327836, 46324370.60047006, 138349755.57550246, 46324362.148036204, 138349713.8105848, 46324366.58556398, 138349717.788196, 46324366.16294228, 0, 0, 0, 0, 0 },
-  { 138349717.91021103, 46324386.24077654, 138349677.9219841, 46324387.21119266, 138349757.89843795, 46324385.27036042, 138349715.91079968, 46324386.28929734, 138349719.90962237, 46324386.192255735, 0, 0, 0, 0, 0 },
-  { 138349718.3912353, 46324406.062487125, 138349678.47933662, 46324403.409122586, 138349758.30313396, 46324408.715851665, 138349716.39564034, 46324405.9298189, 138349720.38683024, 46324406.19515535, 0, 0, 0, 0, 0 },
-  { 138349717.07991117, 46324425.78741923, 138349677.62530747, 46324419.20454403, 138349756.53451487, 46324432.37029443, 138349715.10718098, 46324425.45827547, 138349719.05264136, 46324426.11656299, 1, 2, 138349332.39752498, 46324361.604386, 27 },
-  { 138349713.8136867, 46324445.36360566, 138349675.28253704, 46324434.62347032, 138349752.34483635, 46324456.103741005, 138349711.88712922, 46324444.8265989, 138349715.74024418, 46324445.90061243, 0, 0, 0, 0, 0 },
-  { 138349708.43771017, 46324464.65037903, 138349671.43830225, 46324449.45025355, 138349745.43711808, 46324479.85050451, 138349706.58773977, 46324463.89037276, 138349710.28768057, 46324465.4103853, 0, 0, 0, 0, 0 },
-  { 138349700.82556888, 46324483.17948399, 138349666.20354903, 46324463.14661747, 138349735.44758874, 46324503.2123505, 138349699.09446788, 46324482.177840665, 138349702.5566699, 46324484.18112731, 1, 5, 138349956.16296536, 46324630.92187454, 32 },
-  { 138349690.85741362, 46324500.40705695, 138349659.7563321, 46324475.25307658, 138349721.95849514, 46324525.56103732, 138349689.30235955, 46324499.14935793, 138349692.4124677, 46324501.66475597, 0, 0, 0, 0, 0 },
-  { 138349678.41542464, 46324515.79067846, 138349651.9040827, 46324485.838237025, 138349704.9267666, 46324545.74311989, 138349677.08985755, 46324514.293056384, 138349679.74099174, 46324517.28830053, 0, 0, 0, 0, 0 },
-  { 138349663.57546118, 46324528.92574616, 138349642.0522392, 46324495.21000925, 138349685.09868315, 46324562.64148307, 138349662.4993001, 46324527.239959314, 138349664.65162227, 46324530.611533, 0, 0, 0, 0, 0 },
-  { 138349646.764432, 46324539.657456204, 138349630.42628676, 46324503.146293394, 138349663.10257727, 46324576.168619014, 138349645.94752476, 46324537.83189806, 138349647.58133927, 46324541.483014345, 0, 0, 0, 0, 0 },
-  { 138349628.4472154, 46324547.85410957, 138349617.941153, 46324509.2584796, 138349638.95327783, 46324586.44973954, 138349627.92191228, 46324545.924328074, 138349628.97251853, 46324549.78389107, 0, 0, 0, 0, 0 },
-  { 138349609.16964588, 46324553.101629786, 138349606.33596957, 46324513.20212755, 138349612.00332218, 46324593.00113202, 138349609.02796206, 46324551.106654674, 138349609.3113297, 46324555.0966049, 0, 0, 0, 0, 0 },
-  { 138349589.61971322, 46324554.49007269, 138349595.66342193, 46324514.949288875, 138349583.5760045, 46324594.030856505, 138349589.92189866, 46324552.5130335, 138349589.31752777, 46324556.46711188, 0, 0, 0, 0, 0 },
-  { 138349570.35717386, 46324551.545842305, 138349583.47286773, 46324513.75723854, 138349557.24148, 46324589.33444607, 138349571.01295856, 46324549.65641212, 138349569.70138916, 46324553.43527249, 1, 1, 138349460.1853455, 46324868.970113955, 47 },
-  { 138349551.58023733, 46324545.02873062, 138349569.56807184, 46324509.30146079, 138349533.59240282, 46324580.75600046, 138349552.47962904, 46324543.24236713, 138349550.68084562, 46324546.81509411, 0, 0, 0, 0, 0 },
-  { 138349533.4307282, 46324535.89088247, 138349554.55161202, 46324501.92165719, 138349512.30984437, 46324569.86010775, 138349534.4867724, 46324534.192421205, 138349532.374684, 46324537.589343734, 1, 5, 138349477.46038604, 46324625.90932946, 49 },
-  { 138349516.05047125, 46324525.08444267, 138349539.1579262, 46324492.43409006, 138349492.9430163, 46324557.73479527, 138349517.20584399, 46324523.45192504, 138349514.8950985, 46324526.716960296, 1, 0, 138349616.5679003, 46324383.05540882, 30 },
-  { 138349499.5965034, 46324513.43956626, 138349525.03505775, 46324482.570812605, 138349474.15794906, 46324544.30831992, 138349500.86843112, 46324511.89612858, 138349498.3245757, 46324514.983003944, 0, 0, 0, 0, 0 },
-  { 138349484.34048063, 46324500.86726843, 138349512.90216926, 46324472.86316263, 138349455.778792, 46324528.87137423, 138349485.76856506, 46324499.46706314, 138349482.9123962, 46324502.26747372, 0, 0, 0, 0, 0 },
-  { 138349470.60630068, 46324486.859630615, 138349502.57825875, 46324462.82228679, 138349438.6343426, 46324510.89697444, 138349472.2048986, 46324485.65776342, 138349469.00770277, 46324488.06149781, 0, 0, 0, 0, 0 },
-  { 138349458.71094838, 46324471.03767841, 138349493.5742936, 46324451.427804396, 138349423.84760314, 46324490.64755243, 138349460.45411563, 46324470.05718471, 138349456.96778113, 46324472.018172115, 0, 0, 0, 0, 0 },
-  { 138349448.93647963, 46324453.660173684, 138349486.08255172, 46324438.82206974, 138349411.79040754, 46324468.49827763, 138349450.79378322, 46324452.91826849, 138349447.07917604, 46324454.40207888, 0, 0, 0, 0, 0 },
-  { 138349441.55434304, 46324435.179552525, 138349480.31181985, 46324425.28723267, 138349402.79686624, 46324445.07187238, 138349443.49221689, 46324434.68493653, 138349439.6164692, 46324435.67416852, 0, 0, 0, 0, 0 },
-  { 138349436.6670682, 46324416.03152217, 138349476.09132725, 46324409.26928889, 138349397.24280918, 46324422.79375545, 138349438.63828117, 46324415.69341051, 138349434.69585526, 46324416.36963383, 0, 0, 0, 0, 0 },
-  { 138349433.3250457, 46324396.54731397, 138349472.81440315, 46324390.17623493, 138349393.83568826, 46324402.918393016, 138349435.29951358, 46324396.22876002, 138349431.35057783, 46324396.86586793, 0, 0, 0, 0, 0 },
-  { 138349430.17425266, 46324377.018001586, 138349469.20916814, 46324368.28442422, 138349391.13933718, 46324385.75157895, 138349432.12599844, 46324376.581322715, 138349428.22250688, 46324377.45468046, 1, 3, 138349193.0371411, 46324430.07448409, 37 },
-  { 138349425.85982558, 46324357.73457519, 138349463.57149488, 46324344.39928369, 138349388.1481563, 46324371.06986669, 138349427.74540904, 46324357.06781062, 138349423.97424212, 46324358.40133976, 0, 0, 0, 0, 0 },
-  { 138349419.23476228, 46324338.999161996, 138349454.94278595, 46324320.973151736, 138349383.5267386, 46324357.025172256, 138349421.02016348, 46324338.09786148, 138349417.4493611, 46324339.90046251, 1, 5, 138349271.93916467, 46324413.35645432, 26 },
-  { 138349410.23527443, 46324321.171926774, 138349443.46221736, 46324298.90153692, 138349377.0083315, 46324343.44231663, 138349411.89662158, 46324320.058407284, 138349408.57392728, 46324322.285446264, 0, 0, 0, 0, 0 },
-  { 138349399.1492918, 46324304.63187902, 138349429.39488015, 46324278.45547003, 138349368.90370348, 46324330.808288, 138349400.66157123, 46324303.32305857, 138349397.6370124, 46324305.940699466, 1, 5, 138349320.51076218, 46324372.69054237, 43 },
-  { 138349386.2654962, 46324289.74526953, 138349413.34184438, 46324260.30259014, 138349359.189148, 46324319.18794892, 138349387.6193136, 46324288.27313556, 138349384.9116788, 46324291.2174035, 0, 0, 0, 0, 0 },
-  { 138349371.88832387, 46324276.523601815, 138349396.2473902, 46324244.796076104, 138349347.52925754, 46324308.251127526, 138349373.1062772, 46324274.93722553, 138349370.67037055, 46324278.1099781, 0, 0, 0, 0, 0 },
-  { 138349356.3396382, 46324264.58597173, 138349378.69986486, 46324231.419418335, 138349333.97941154, 46324297.75252512, 138349357.45764953, 46324262.92764406, 138349355.22162688, 46324266.2442994, 0, 0, 0, 0, 0 },
-  { 138349339.9422049, 46324253.5311503, 138349361.13655102, 46324219.60771162, 138349318.74785876, 46324287.45458897, 138349341.0019222, 46324251.834978364, 138349338.8824876, 46324255.22732223, 1, 2, 138349179.39503288, 46324510.50119827, 25 },
-  { 138349323.01878977, 46324242.95790855, 138349343.9153704, 46324208.850242, 138349302.12220913, 46324277.0655751, 138349324.0636188, 46324241.25252522, 138349321.97396073, 46324244.66329188, 0, 0, 0, 0, 0 },
-  { 138349305.89215866, 46324232.46501753, 138349327.35412213, 46324198.710253075, 138349284.43019518, 46324266.21978198, 138349306.96525684, 46324230.7772793, 138349304.81906047, 46324234.15275575, 0, 0, 0, 0, 0 },
-  { 138349288.88495559, 46324221.65149306, 138349311.06827626, 46324188.366356984, 138349266.7016349, 46324254.93662913, 138349289.9941216, 46324219.987236254, 138349287.77578956, 46324223.31574986, 0, 0, 0, 0, 0 },
-  { 138349272.1347304, 46324210.488083184, 138349293.11915743, 46324176.43439289, 138349251.15030336, 46324244.541773476, 138349273.18395174, 46324208.78539867, 138349271.08550906, 46324212.1907677, 0, 0, 0, 0, 0 },
-  { 138349255.2212608, 46324200.065733485, 138349272.41605625, 46324163.950099625, 138349238.02646533, 46324236.181367345, 138349256.08100057, 46324198.25995179, 138349254.361521, 46324201.87151518, 0, 0, 0, 0, 0 },
-  { 138349237.61968014, 46324191.68555164, 138349248.37289336, 46324153.15804971, 138349226.8664669, 46324230.21305358, 138349238.1573408, 46324189.759176545, 138349237.08201948, 46324193.61192674, 0, 0, 0, 0, 0 },
-  { 138349218.88685012, 46324186.457127646, 138349223.9193395, 46324146.77496477, 138349213.85436073, 46324226.13929052, 138349219.13847458, 46324184.4730195, 138349218.63522565, 46324188.44123579, 0, 0, 0, 0, 0 },
-  { 138349199.23071823, 46324183.964338236, 138349201.02903536, 46324144.00478299, 138349197.4324011, 46324223.92389348, 138349199.32063407, 46324181.96636047, 138349199.14080238, 46324185.962316, 0, 0, 0, 0, 0 },
-  { 138349179.1705394, 46324183.061561346, 138349179.77816942, 46324143.06617679, 138349178.5629094, 46324223.056945905, 138349179.2009209, 46324181.06179212, 138349179.1401579, 46324185.06133057, 0, 0, 0, 0, 0 },
-  { 138349159.15390754, 46324182.757458605, 138349158.99516866, 46324142.75777358, 138349159.31264642, 46324222.75714363, 138349159.14597058, 46324180.757474355, 138349159.1618445, 46324184.757442854, 0, 0, 0, 0, 0 },
-  { 138349139.26896858, 46324182.83637205, 138349138.2928336, 46324142.84828432, 138349140.24510357, 46324222.82445978, 138349139.22016183, 46324180.83696766, 138349139.31777534, 46324184.83577643, 0, 0, 0, 0, 0 },
-  { 138349119.49430212, 46324183.3190844, 138349117.65259486, 46324143.36150546, 138349121.33600938, 46324223.27666333, 138349119.40221676, 46324181.32120545, 138349119.5863875, 46324185.316963345, 1, 2, 138349130.45246026, 46324421.06667907, 40 },
-  { 138349099.80846173, 46324184.22643554, 138349097.0567174, 46324144.32119901, 138349102.56020606, 46324224.13167208, 138349099.6708745, 46324182.23117372, 138349099.94604895, 46324186.22169737, 0, 0, 0, 0, 0 },
-  { 138349080.19000056, 46324185.579265244, 138349076.48819718, 46324145.75092544, 138349083.89180395, 46324225.40760505, 138349080.00491038, 46324183.58784825, 138349080.37509075, 46324187.570682235, 0, 0, 0, 0, 0 },
-  { 138349060.6174721, 46324187.398413435, 138349055.93123668, 46324147.673871934, 138349065.30370754, 46324227.122954935, 138349060.38316035, 46324185.41218636, 138349060.85178387, 46324189.38464051, 0, 0, 0, 0, 0 },
-  { 138349041.0698722, 46324189.70440997, 138349035.38838476, 46324150.10995707, 138349046.75135964, 46324229.298862875, 138349040.78579783, 46324187.72468733, 138349041.35394657, 46324191.68413261, 0, 0, 0, 0, 0 },
-  { 138349021.54238427, 46324192.50644837, 138349014.87917593, 46324153.06533208, 138349028.2055926, 46324231.94756467, 138349021.20922384, 46324190.53439256, 138349021.8755447, 46324194.47850419, 0, 0, 0, 0, 0 },
-  { 138349002.0506501, 46324195.79939486, 138348994.4197731, 46324156.53401932, 138349009.68152708, 46324235.0647704, 138349001.66910625, 46324193.83612608, 138349002.43219393, 46324197.76266364, 1, 2, 138349041.5404385, 46324398.99771329, 41 },
-  { 138348982.61162278, 46324199.577197164, 138348974.02610704, 46324160.50944935, 138348991.19713852, 46324238.64494498, 138348982.182347, 46324197.62380977, 138348983.04089856, 46324201.53058456, 0, 0, 0, 0, 0 },
-  { 138348963.24225548, 46324203.83380311, 138348953.7141066, 46324164.98519465, 138348972.77040437, 46324242.68241157, 138348962.76584804, 46324201.89137269, 138348963.71866292, 46324205.77623353, 0, 0, 0, 0, 0 },
-  { 138348943.95950136, 46324208.563160464, 138348933.4997068, 46324169.95496576, 138348954.4192959, 46324247.171355166, 138348943.43651164, 46324206.63275073, 138348944.48249108, 46324210.4935702, 0, 0, 0, 0, 0 },
-  { 138348924.78031358, 46324213.75921703, 138348913.3988572, 46324175.412607655, 138348936.16176996, 46324252.10582641, 138348924.21124077, 46324211.841886565, 138348925.3493864, 46324215.6765475, 0, 0, 0, 0, 0 },
-  { 138348905.72164533, 46324219.41592058, 138348893.42752883, 46324181.35209655, 138348918.01576182, 46324257.479744606, 138348905.1069395, 46324217.51272938, 138348906.33635116, 46324221.31911178, 0, 0, 0, 0, 0 },
-  { 138348886.8004497, 46324225.527218886, 138348873.60172102, 46324187.7675372, 138348899.99917838, 46324263.28690057, 138348886.14051327, 46324223.6392348, 138348887.46038613, 46324227.41520297, 0, 0, 0, 0, 0 },
-  { 138348868.03367984, 46324232.08705977, 138348853.9374684, 46324194.65316039, 138348882.12989128, 46324269.520959154, 138348867.32886928, 46324230.21536481, 138348868.7384904, 46324233.95875474, 0, 0, 0, 0, 0 },
-  { 138348849.43828893, 46324239.08939099, 138348834.45084718, 46324202.00332096, 138348864.42573068, 46324276.175461024, 138348848.68891683, 46324237.23508749, 138348850.18766102, 46324240.943694495, 0, 0, 0, 0, 0 },
-  { 138348831.03123015, 46324246.52816034, 138348815.15798235, 46324209.81249605, 138348846.90447795, 46324283.24382463, 138348830.23756775, 46324244.69237713, 138348831.82489255, 46324248.363943554, 0, 0, 0, 0, 0 },
-  { 138348812.82945657, 46324254.3973156, 138348796.0772006, 46324218.074293695, 138348829.58171254, 46324290.7203375, 138348811.99184376, 46324252.5811645, 138348813.66706938, 46324256.2134667, 0, 0, 0, 0, 0 },
-  { 138348794.84849212, 46324262.690175146, 138348777.24460822, 46324226.77216752, 138348812.452376, 46324298.60818277, 138348793.96829793, 46324260.894274764, 138348795.7286863, 46324264.48607553, 0, 0, 0, 0, 0 },
-  { 138348777.08988163, 46324271.39390171, 138348758.67384088, 46324235.88545985, 138348795.50592238, 46324306.90234358, 138348776.1690796, 46324269.61847962, 138348778.01068366, 46324273.16932381, 0, 0, 0, 0, 0 },
-  { 138348759.547264, 46324280.49217648, 138348740.35876256, 46324245.39514794, 138348778.73576546, 46324315.58920502, 138348758.58783895, 46324278.73732505, 138348760.50668907, 46324282.24702791, 0, 0, 0, 0, 0 },
-  { 138348742.21418822, 46324289.96864112, 138348722.2927626, 46324255.28237867, 138348762.13561383, 46324324.65490356, 138348741.21811694, 46324288.234327994, 138348743.2102595, 46324291.70295424, 0, 0, 0, 0, 0 },
-  { 138348725.08420318, 46324299.80693727, 138348704.46901447, 46324265.52846014, 138348745.6993919, 46324334.0854144, 138348724.05344376, 46324298.09301341, 138348726.1149626, 46324301.52086113, 0, 0, 0, 0, 0 },
-  { 138348708.15085804, 46324309.99070664, 138348686.88051063, 46324276.11486981, 138348729.42120546, 46324343.866543464, 138348707.08734068, 46324308.29691479, 138348709.2143754, 46324311.68449848, 1, 5, 138348840.55877072, 46324520.86779089, 49 },
-  { 138348691.40770176, 46324320.503590874, 138348669.5200945, 46324287.023258604, 138348713.295309, 46324353.983923145, 138348690.3133214, 46324318.82957426, 138348692.5020821, 46324322.17760749, 0, 0, 0, 0, 0 },
-  { 138348674.84828323, 46324331.32923161, 138348652.38049152, 46324298.2354507, 138348697.31607494, 46324364.423012525, 138348673.72489366, 46324329.67454257, 138348675.9716728, 46324332.983920656, 1, 4, 138348822.012319, 46324548.093496606, 32 },
-  { 138348658.46615165, 46324342.45127056, 138348635.4543395, 46324309.73343901, 138348681.4779638, 46324375.1691021, 138348657.31556106, 46324340.81537898, 138348659.61674225, 46324344.08716214, 0, 0, 0, 0, 0 },
-  { 138348642.25485587, 46324353.85334936, 138348618.73421314, 46324321.4993795, 138348665.7754986, 46324386.207319215, 138348641.07882375, 46324352.23565087, 138348643.430888, 46324355.47104785, 1, 3, 138348863.34889758, 46324657.980666, 31 },
-  { 138348626.207945, 46324365.51910968, 138348602.2126494, 46324333.515581906, 138348650.20324057, 46324397.52263746, 138348625.0081802, 46324363.918933295, 138348627.40770978, 46324367.11928607, 0, 0, 0, 0, 0 },
-  { 138348610.318968, 46324377.432193205, 138348585.88216788, 46324345.76449988, 138348634.75576812, 46324409.09988653, 138348609.097128, 46324375.84880854, 138348611.540808, 46324379.01557787, 1, 4, 138348841.85764903, 46324677.483587444, 41 },
-  { 138348594.58147383, 46324389.57624157, 138348569.73528898, 46324358.228720166, 138348619.42765868, 46324420.92376297, 138348593.33916458, 46324388.0088655, 138348595.82378307, 46324391.14361764, 0, 0, 0, 0, 0 },
-  { 138348578.98901162, 46324401.934896454, 138348553.76455095, 46324370.890950434, 138348604.21347228, 46324432.978842475, 138348577.7277886, 46324400.382699154, 138348580.25023463, 46324403.487093754, 1, 2, 138348817.99077633, 46324696.07628502, 26 },
-  { 138348563.5351303, 46324414.49179953, 138348537.9614289, 46324383.73491741, 138348589.10883167, 46324445.24868166, 138348562.25644523, 46324412.95395543, 138348564.81381536, 46324416.02964364, 0, 0, 0, 0, 0 },
-  { 138348548.21392763, 46324427.231057696, 138348522.291751, 46324396.767296284, 138348574.13610426, 46324457.69481911, 138348546.91781878, 46324425.70786963, 138348549.51003647, 46324428.754245766, 0, 0, 0, 0, 0 },
-  { 138348533.03333327, 46324440.1485055, 138348506.7346925, 46324410.009137645, 138348559.33197403, 46324470.28787336, 138348531.71840122, 46324438.64153711, 138348534.34826532, 46324441.655473895, 0, 0, 0, 0, 0 },
-  { 138348518.0158174, 46324453.25230571, 138348491.31190857, 46324423.47141832, 138348544.71972623, 46324483.0331931, 138348516.68062195, 46324451.76326134, 138348519.35101286, 46324454.74135008, 0, 0, 0, 0, 0 },
-  { 138348503.18454048, 46324466.55120649, 138348476.04722553, 46324437.16471065, 138348530.32185543, 46324495.937702335, 138348501.82767475, 46324465.0818817, 138348504.5414062, 46324468.02053128, 1, 2, 138348352.57244256, 46324303.45615456, 32 },
-  { 138348488.56266302, 46324480.05395605, 138348460.96460414, 46324451.09973102, 138348516.1607219, 46324509.00818107, 138348487.1827601, 46324478.606244795, 138348489.94256595, 46324481.5016673, 0, 0, 0, 0, 0 },
-  { 138348474.1733456, 46324493.76930256, 138348446.08817127, 46324465.2873261, 138348502.25851992, 46324522.251279026, 138348472.76908687, 46324492.345203735, 138348475.57760432, 46324495.19340139, 1, 4, 138348402.5561511, 46324421.140262574, 41 },
-  { 138348460.03974894, 46324507.70599429, 138348431.44225517, 46324479.73845328, 138348488.6372427, 46324535.67353531, 138348458.60987425, 46324506.30761724, 138348461.46962363, 46324509.10437135, 0, 0, 0, 0, 0 },
-  { 138348446.18503335, 46324521.87277936, 138348417.0514194, 46324494.46415775, 138348475.3186473, 46324549.28140097, 138348444.72835267, 46324520.50234828, 138348447.64171404, 46324523.24321044, 0, 0, 0, 0, 0 },
-  { 138348432.63235945, 46324536.278405994, 138348402.94050235, 46324509.47554005, 138348462.32421654, 46324563.08127194, 138348431.1477666, 46324534.93826269, 138348434.1169523, 46324537.618549295, 0, 0, 0, 0, 0 },
-  { 138348419.40488788, 46324550.93162241, 138348389.13465476, 46324524.78371643, 138348449.675121, 46324577.079528384, 138348417.89137623, 46324549.62422711, 138348420.91839954, 46324552.23901771, 1, 5, 138348267.29696646, 46324419.5383949, 45 },
-  { 138348406.5257791, 46324565.84117676, 138348375.65937525, 46324540.39977127, 138348437.39218295, 46324591.28258225, 138348404.98245892, 46324564.56910649, 138348408.06909928, 46324567.11324704, 0, 0, 0, 0, 0 },
-  { 138348394.0181937, 46324581.01581727, 138348362.54054534, 46324556.334697895, 138348425.49584204, 46324605.696936645, 138348392.44431126, 46324579.7817613, 138348395.59207612, 46324582.249873236, 0, 0, 0, 0, 0 },
-  { 138348381.90529224, 46324596.46429214, 138348349.80464074, 46324572.59908372, 138348414.00594375, 46324620.329500556, 138348380.30025968, 46324595.271031715, 138348383.5103248, 46324597.65755256, 0, 0, 0, 0, 0 },
-  { 138348370.2101003, 46324612.19527905, 138348337.49827152, 46324589.17493461, 138348402.92192906, 46324635.21562348, 138348368.57450885, 46324611.04426183, 138348371.84569174, 46324613.346296266, 1, 4, 138348287.61273262, 46324554.068909355, 44 },
-  { 138348358.94039658, 46324628.20948854, 138348325.66798565, 46324606.00708616, 138348392.2128075, 46324650.411890924, 138348357.27677605, 46324627.09936842, 138348360.6040171, 46324629.31960866, 0, 0, 0, 0, 0 },
-  { 138348348.07491082, 46324644.49245201, 138348314.29442254, 46324623.070999876, 138348381.8553991, 46324665.913904145, 138348346.3858864, 46324643.4213794, 138348349.76393524, 46324645.56352462, 0, 0, 0, 0, 0 },
-  { 138348337.58911246, 46324661.02799714, 138348303.35030937, 46324640.346982576, 138348371.82791555, 46324681.70901171, 138348335.87717232, 46324659.99394642, 138348339.3010526, 46324662.06204787, 0, 0, 0, 0, 0 },
-  { 138348327.45847106, 46324677.79995168, 138348292.80824772, 46324657.81590747, 138348362.1086944, 46324697.78399589, 138348325.7259599, 46324676.80074947, 138348329.19098222, 46324678.79915389, 1, 3, 138348181.06127748, 46324593.367364906, 31 },
-  { 138348317.65845603, 46324694.79214335, 138348282.6408017, 46324675.45916929, 138348352.67611036, 46324714.12511741, 138348315.9075733, 46324693.82549465, 138348319.40933874, 46324695.75879206, 1, 3, 138348566.28380167, 46324832.056259185, 26 },
-  { 138348308.1645368, 46324711.988399886, 138348272.82057333, 46324693.25863091, 138348343.50850028, 46324730.71816886, 138348306.39733863, 46324711.051911436, 138348309.93173498, 46324712.924888335, 0, 0, 0, 0, 0 },
-  { 138348298.95218298, 46324729.37254902, 138348263.32026458, 46324711.196565084, 138348334.58410138, 46324747.548532955, 138348297.17058706, 46324728.463749826, 138348300.7337789, 46324730.28134821, 0, 0, 0, 0, 0 },
-  { 138348289.99686384, 46324746.92841844, 138348254.11272496, 46324729.255598135, 138348325.88100272, 46324764.60123875, 138348288.2026569, 46324746.04477743, 138348291.7910708, 46324747.812059455, 0, 0, 0, 0, 0 },
-  { 138348281.274049, 46324764.63983593, 138348245.17099085, 46324747.41865156, 138348317.37710717, 46324781.861020304, 138348279.4688961, 46324763.77877671, 138348283.07920194, 46324765.50089515, 1, 3, 138348422.9785523, 46324832.23298458, 48 },
-  { 138348272.75920796, 46324782.49062918, 138348236.46831265, 46324765.668889746, 138348309.05010328, 46324799.31236862, 138348270.9446632, 46324781.64954221, 138348274.57375273, 46324783.33171615, 0, 0, 0, 0, 0 },
-  { 138348264.42781004, 46324800.46462592, 138348227.978175, 46324783.98967204, 138348300.87744507, 46324816.93957979, 138348262.6053283, 46324799.64087822, 138348266.2502918, 46324801.28837361, 0, 0, 0, 0, 0 },
-  { 138348256.25532487, 46324818.545653895, 138348219.6743118, 46324802.36450799, 138348292.83633795, 46324834.7267998, 138348254.4262742, 46324817.7365966, 138348258.08437553, 46324819.35471119, 0, 0, 0, 0, 0 },
-  { 138348248.2172218, 46324836.717540815, 138348211.5307141, 46324820.777021624, 138348284.9037295, 46324852.65806001, 138348246.38289642, 46324835.92051486, 138348250.05154717, 46324837.51456677, 0, 0, 0, 0, 0 },
-  { 138348240.28897038, 46324854.96411441, 138348203.52163684, 46324839.210918404, 138348277.05630392, 46324870.71731042, 138348238.4506037, 46324854.17645461, 138348242.12733707, 46324855.751774214, 0, 0, 0, 0, 0 },
-  { 138348232.44603994, 46324873.26920241, 138348195.6216009, 46324857.649961464, 138348269.270479, 46324888.88844336, 138348230.604818, 46324872.48824036, 138348234.2872619, 46324874.05016446, 1, 3, 138348324.5071376, 46324912.31730477, 36 },
-  { 138348224.66390017, 46324891.61663255, 138348187.80539593, 46324876.07794969, 138348261.5224044, 46324907.155315414, 138348222.82097495, 46324890.83969841, 138348226.5068254, 46324892.39356669, 1, 5, 138347986.92654783, 46324791.39212809, 25 },
-  { 138348216.91802037, 46324909.99023255, 138348180.04807943, 46324894.47870599, 138348253.7879613, 46324925.50175911, 138348215.07452333, 46324909.21465622, 138348218.7615174, 46324910.76580888, 0, 0, 0, 0, 0 },
-  { 138348209.18387014, 46324928.373830125, 138348172.32497814, 46324912.83606706, 138348246.04276213, 46324943.91159319, 138348207.34092554, 46324927.59694197, 138348211.02681473, 46324929.15071828, 1, 2, 138348116.11516786, 46324889.14097838, 35 },
-  { 138348201.4369188, 46324946.751253024, 138348164.6116865, 46324931.133882344, 138348238.2621511, 46324962.3686237, 138348199.59565717, 46324945.97038449, 138348203.27818042, 46324947.532121554, 1, 4, 138348376.35677215, 46325020.933763735, 33 },
-  { 138348193.65263593, 46324965.10632896, 138348156.88406762, 46324949.35601514, 138348230.42120424, 46324980.856642775, 138348191.81420752, 46324964.318813264, 138348195.49106434, 46324965.89384465, 1, 1, 138347827.8053814, 46324808.39070644, 30 },
-  { 138348185.806491, 46324983.422885664, 138348149.11825192, 46324967.48635174, 138348222.49473006, 46324999.359419584, 138348183.97207904, 46324982.626058966, 138348187.64090294, 46324984.21971236, 0, 0, 0, 0, 0 },
-  { 138348177.87395343, 46325001.68475087, 138348141.2906362, 46324985.508814976, 138348214.45727065, 46325017.860686764, 138348176.0447876, 46325000.87595408, 138348179.70311928, 46325002.49354766, 0, 0, 0, 0, 0 },
-  { 138348169.83049276, 46325019.8757523, 138348133.37788215, 46325003.40738326, 138348206.28310338, 46325036.34412134, 138348168.00786224, 46325019.05233385, 138348171.6531233, 46325020.69917075, 1, 0, 138348268.25254145, 46325064.340348706, 26 },
-  { 138348161.65157834, 46325037.97971768, 138348125.35691163, 46325021.16611695, 138348197.94624504, 46325054.793318406, 138348159.836845, 46325037.13903765, 138348163.46631166, 46325038.82039771, 1, 2, 138347915.75521147, 46324924.06757275, 30 },
-  { 138348153.31267983, 46325055.98047474, 138348117.20490247, 46325038.769187324, 138348189.42045718, 46325073.19176216, 138348151.50729096, 46325055.11991037, 138348155.1180687, 46325056.84103911, 1, 4, 138348489.11500922, 46325216.0454477, 32 },
-  { 138348144.78926653, 46325073.86185121, 138348108.89684415, 46325056.20586025, 138348180.6816889, 46325091.517842166, 138348142.99464542, 46325072.97905166, 138348146.58388764, 46325074.74465076, 0, 0, 0, 0, 0 },
-  { 138348136.059018, 46325091.609355085, 138348100.38949287, 46325073.507284, 138348171.7285431, 46325109.71142617, 138348134.27554172, 46325090.70425153, 138348137.84249425, 46325092.51445864, 1, 5, 138348490.97079295, 46325271.72496239, 48 },
-  { 138348127.1197792, 46325109.22382588, 138348091.66813388, 46325090.69868501, 138348162.5714245, 46325127.748966746, 138348125.34719694, 46325108.297568835, 138348128.89236146, 46325110.15008292, 1, 2, 138347997.72127378, 46325041.607061714, 35 },
-  { 138348117.98018566, 46325126.71430711, 138348082.74029264, 46325107.789457284, 138348153.22007868, 46325145.63915693, 138348116.218191, 46325125.76806462, 138348119.74218032, 46325127.660549596, 0, 0, 0, 0, 0 },
-  { 138348108.64897504, 46325144.089919955, 138348073.61376557, 46325124.78877758, 138348143.68418452, 46325163.39106233, 138348106.89721456, 46325143.124862835, 138348110.40073553, 46325145.054977074, 1, 3, 138347920.3347241, 46325040.34627972, 40 },
-  { 138348099.1348851, 46325161.35978553, 138348064.29640913, 46325141.70576327, 138348133.97336107, 46325181.01380778, 138348097.3929613, 46325160.37708441, 138348100.8768089, 46325162.34248664, 0, 0, 0, 0, 0 },
-  { 138348089.44665334, 46325178.533024944, 138348054.79614145, 46325158.549481064, 138348124.09716523, 46325198.516568825, 138348087.71412775, 46325177.53384775, 138348091.17917892, 46325179.53220214, 0, 0, 0, 0, 0 },
-  { 138348079.59301755, 46325195.618759386, 138348045.1209457, 46325175.32895254, 138348114.0650894, 46325215.90856623, 138348077.86941394, 46325194.60426904, 138348081.31662115, 46325196.63324973, 0, 0, 0, 0, 0 },
-  { 138348069.5827153, 46325212.62610997, 138348035.27886948, 46325192.05316266, 138348103.88656113, 46325233.19905729, 138348067.867523, 46325211.59746261, 138348071.2979076, 46325213.654757336, 0, 0, 0, 0, 0 },
-  { 138348059.4244843, 46325229.56419786, 138348025.2780263, 46325208.731065445, 138348093.5709423, 46325250.39733028, 138348057.71716142, 46325228.52254124, 138348061.1318072, 46325230.60585448, 1, 0, 138348225.88846704, 46325331.1257184, 31 },
-  { 138348049.12706223, 46325246.44214418, 138348015.12659487, 46325225.37159082, 138348083.1275296, 46325267.51269753, 138348047.42703885, 46325245.38861651, 138348050.8270856, 46325247.495671846, 0, 0, 0, 0, 0 },
-  { 138348038.69918674, 46325263.2690701, 138348004.83281866, 46325241.98364991, 138348072.56555483, 46325284.55449028, 138348037.00586835, 46325262.204799086, 138348040.39250514, 46325264.33334111, 0, 0, 0, 0, 0 },
-  { 138348028.14959538, 46325280.054096706, 138347994.4050041, 46325258.576141484, 138348061.89418665, 46325301.53205193, 138348026.4623658, 46325278.98019894, 138348029.83682495, 46325281.12799447, 0, 0, 0, 0, 0 },
-  { 138348017.48702607, 46325296.80634522, 138347983.85161364, 46325275.15781106, 138348051.1224385, 46325318.45487937, 138348015.80525544, 46325295.72391851, 138348019.1687967, 46325297.88877192, 0, 0, 0, 0, 0 },
-  { 138348006.7201579, 46325313.53487053, 138347973.2192512, 46325291.67876725, 138348040.2210646, 46325335.39097381, 138348005.04511255, 46325312.442065366, 138348008.39520323, 46325314.62767569, 0, 0, 0, 0, 0 },
-  { 138347995.83371228, 46325330.2215504, 138347962.59205765, 46325307.97312582, 138348029.0753669, 46325352.46997497, 138347994.17162955, 46325329.10912917, 138347997.495795, 46325331.33397163, 0, 0, 0, 0, 0 },
-  { 138347984.75167406, 46325346.77936491, 138347951.91764152, 46325323.933658354, 138348017.5857066, 46325369.62507147, 138347983.10997242, 46325345.63707959, 138347986.3933757, 46325347.92165024, 1, 4, 138347826.3274671, 46325236.54883078, 47 },
-  { 138347973.38854825, 46325363.11054037, 138347941.12409908, 46325339.46724703, 138348005.65299743, 46325386.7538337, 138347971.7753258, 46325361.9283757, 138347975.0017707, 46325364.29270504, 0, 0, 0, 0, 0 },
-  { 138347961.65883973, 46325379.11730301, 138347930.14408192, 46325354.48358546, 138347993.17359754, 46325403.75102055, 138347960.08310184, 46325377.88561713, 138347963.23457763, 46325380.34898888, 1, 0, 138347646.5112616, 46325132.78012756, 40 },
-  { 138347949.47705337, 46325394.70187915, 138347918.9139847, 46325368.89686349, 138347980.04012206, 46325420.50689481, 138347947.94889995, 46325393.411628366, 138347951.0052068, 46325395.99212994, 0, 0, 0, 0, 0 },
-  { 138347936.75769415, 46325409.76649506, 138347907.37249532, 46325382.62777568, 138347966.142893, 46325436.90521444, 138347935.2884342, 46325408.409559086, 138347938.2269541, 46325411.12343103, 1, 2, 138347689.187394, 46325181.122784264, 47 },
-  { 138347923.41526696, 46325424.213377036, 138347895.4579914, 46325395.60584755, 138347951.37254253, 46325452.82090652, 138347922.0174032, 46325422.78300056, 138347924.81313074, 46325425.64375351, 0, 0, 0, 0, 0 },
-  { 138347909.36440787, 46325437.944857754, 138347883.02600992, 46325407.840226986, 138347935.70280582, 46325468.04948852, 138347908.04748797, 46325436.43962622, 138347910.68132776, 46325439.45008929, 1, 3, 138347733.5556016, 46325236.996447355, 42 },
-  { 138347894.56072876, 46325450.89652603, 138347869.8382724, 46325419.4513332, 138347919.28318512, 46325482.34171886, 138347893.32460594, 46325449.32426639, 138347895.79685158, 46325452.46878567, 0, 0, 0, 0, 0 },
-  { 138347879.0587862, 46325463.08427441, 138347855.903816, 46325430.46760145, 138347902.2137564, 46325495.700947374, 138347877.9010377, 46325461.45344076, 138347880.21653473, 46325464.71510806, 0, 0, 0, 0, 0 },
-  { 138347862.92777398, 46325474.53587488, 138347841.27841288, 46325440.90099471, 138347884.5771351, 46325508.17075505, 138347861.84530592, 46325472.85413087, 138347864.01024204, 46325476.21761889, 0, 0, 0, 0, 0 },
-  { 138347846.2368856, 46325485.279099405, 138347826.0220637, 46325450.76300206, 138347866.4517075, 46325519.79519675, 138347845.22614452, 46325483.55329454, 138347847.2476267, 46325487.00490427, 0, 0, 0, 0, 0 },
-  { 138347829.0553149, 46325495.34171999, 138347810.19826525, 46325460.06550026, 138347847.91236454, 46325530.617939726, 138347828.1124624, 46325493.57790901, 138347829.9981674, 46325497.10553098, 0, 0, 0, 0, 0 },
-  { 138347811.45225525, 46325504.75150858, 138347793.87326375, 46325468.82131157, 138347829.03124675, 46325540.68170559, 138347810.57330567, 46325502.95499873, 138347812.33120483, 46325506.548018426, 1, 5, 138347726.1941464, 46325330.49005307, 43 },
-  { 138347793.4969005, 46325513.536237165, 138347777.1154114, 46325477.04450092, 138347809.8783896, 46325550.02797341, 138347792.67782605, 46325511.71165035, 138347794.31597495, 46325515.36082398, 0, 0, 0, 0, 0 },
-  { 138347775.2584237, 46325521.72366369, 138347760.01747084, 46325484.741054855, 138347790.49937654, 46325558.70627252, 138347774.49637604, 46325519.87453324, 138347776.02047133, 46325523.57279413, 0, 0, 0, 0, 0 },
-  { 138347756.7937568, 46325529.33316249, 138347742.6989989, 46325491.89871579, 138347770.88851473, 46325566.76760919, 138347756.0890189, 46325527.46144015, 138347757.4984947, 46325531.20488482, 1, 3, 138347875.89446115, 46325845.65423708, 44 },
-  { 138347738.12692213, 46325536.36156918, 138347725.1945846, 46325498.50982356, 138347751.05925965, 46325574.2133148, 138347737.48030525, 46325534.4689819, 138347738.773539, 46325538.25415646, 0, 0, 0, 0, 0 },
-  { 138347719.27646813, 46325542.80197053, 138347707.52304134, 46325504.56773248, 138347731.02989492, 46325581.03620857, 138347718.6887968, 46325540.890258625, 138347719.86413947, 46325544.71368243, 0, 0, 0, 0, 0 },
-  { 138347700.26094317, 46325548.647453316, 138347689.70319623, 46325510.0659295, 138347710.81869012, 46325587.22897713, 138347699.73305583, 46325546.71837713, 138347700.78883052, 46325550.5765295, 0, 0, 0, 0, 0 },
-  { 138347681.09889585, 46325553.89110433, 138347671.75387236, 46325514.99803894, 138347690.44391933, 46325592.784169726, 138347680.63164467, 46325551.94645106, 138347681.56614703, 46325555.835757606, 1, 1, 138347768.4748655, 46325917.541265786, 50 },
-  { 138347661.8088745, 46325558.52601035, 138347653.6938679, 46325519.357825965, 138347669.92388108, 46325597.694194734, 138347661.40312415, 46325556.56760113, 138347662.21462482, 46325560.48441957, 0, 0, 0, 0, 0 },
-  { 138347642.40942767, 46325562.54525814, 138347635.54193625, 46325523.139198184, 138347649.2769191, 46325601.9513181, 138347642.0660531, 46325560.57495514, 138347642.75280225, 46325564.51556114, 1, 4, 138347676.91857204, 46325760.56070945, 38 },
-  { 138347622.91910377, 46325565.941934496, 138347617.31676307, 46325526.336205386, 138347628.52144447, 46325605.54766361, 138347622.63898674, 46325563.96164804, 138347623.1992208, 46325567.92222095, 1, 5, 138347578.66061223, 46325253.056674495, 39 },
-  { 138347603.35645127, 46325568.70912618, 138347599.03694332, 46325528.94303697, 138347607.67595923, 46325608.47521539, 138347603.14047587, 46325566.72082172, 138347603.57242668, 46325570.69743064, 0, 0, 0, 0, 0 },
-  { 138347583.74001867, 46325570.839919984, 138347580.71782723, 46325530.954253905, 138347586.7622101, 46325610.725586064, 138347583.5889091, 46325568.84563668, 138347583.89112824, 46325572.83420329, 1, 4, 138347572.48235554, 46325422.26581383, 49 },
-  { 138347564.0880282, 46325572.328978166, 138347562.30379486, 46325532.36879159, 138347565.87226152, 46325612.289164744, 138347563.99881652, 46325570.330968834, 138347564.17723987, 46325574.3269875, 1, 3, 138347579.65546402, 46325920.981606066, 29 },
-  { 138347544.41112527, 46325573.2075573, 138347543.72864288, 46325533.21338, 138347545.09360766, 46325613.201734595, 138347544.37700117, 46325571.20784843, 138347544.44524938, 46325575.20726617, 1, 3, 138347539.49725208, 46325285.24948075, 44 },
-  { 138347524.71233714, 46325573.54370813, 138347524.98946062, 46325533.54466811, 138347524.43521366, 46325613.54274815, 138347524.7261933, 46325571.54375613, 138347524.69848096, 46325575.543660134, 0, 0, 0, 0, 0 },
-  { 138347504.99435654, 46325573.40709696, 138347506.08788466, 46325533.4220473, 138347503.90082842, 46325613.39214662, 138347505.04903296, 46325571.40784448, 138347504.93968013, 46325575.40634944, 0, 0, 0, 0, 0 },
-  { 138347485.25987616, 46325572.86739001, 138347487.02668107, 46325532.90642905, 138347483.49307126, 46325612.82835096, 138347485.3482164, 46325570.86934196, 138347485.1715359, 46325574.86543805, 1, 0, 138347477.35342416, 46325751.692690276, 47 },
-  { 138347465.5115888, 46325571.99425357, 138347467.80927473, 46325532.060300104, 138347463.2139029, 46325611.92820703, 138347465.6264731, 46325569.9975559, 138347465.39670452, 46325573.99095124, 0, 0, 0, 0, 0 },
-  { 138347445.75218713, 46325570.85735388, 138347448.43936175, 46325530.947717294, 138347443.0650125, 46325610.76699047, 138347445.88654587, 46325568.861872055, 138347445.6178284, 46325572.85283571, 0, 0, 0, 0, 0 },
-  { 138347425.98436388, 46325569.526357226, 138347428.92061087, 46325529.63427213, 138347423.0481169, 46325609.418442324, 138347426.13117623, 46325567.531752974, 138347425.83755153, 46325571.52096148, 0, 0, 0, 0, 0 },
-  { 138347406.21081182, 46325568.07092985, 138347409.25644907, 46325528.18704721, 138347403.16517457, 46325607.95481248, 138347406.36309367, 46325566.07673571, 138347406.05852997, 46325570.06512398, 0, 0, 0, 0, 0 },
-  { 138347386.43422374, 46325566.56073803, 138347389.44992784, 46325526.67458092, 138347383.41851965, 46325606.44689514, 138347386.58500895, 46325564.566430174, 138347386.28343853, 46325568.55504588, 0, 0, 0, 0, 0 },
-  { 138347366.6572923, 46325565.065448, 138347369.50366488, 46325525.166849494, 138347363.81091973, 46325604.96404651, 138347366.79961094, 46325563.07051808, 138347366.51497367, 46325567.060377926, 0, 0, 0, 0, 0 },
-  { 138347346.8827102, 46325563.65472606, 138347349.4198608, 46325523.73527132, 138347344.34555957, 46325603.5741808, 138347347.0095677, 46325561.65875332, 138347346.75585267, 46325565.650698796, 0, 0, 0, 0, 0 },
-  { 138347327.11317024, 46325562.39823844, 138347329.20038906, 46325522.452731594, 138347325.02595142, 46325602.34374529, 138347327.21753117, 46325560.4009631, 138347327.0088093, 46325564.39551379, 0, 0, 0, 0, 0 },
-  { 138347307.35136515, 46325561.36565143, 138347308.8469639, 46325521.3936214, 138347305.8557664, 46325601.33768146, 138347307.42614508, 46325559.367049925, 138347307.27658522, 46325563.36425293, 0, 0, 0, 0, 0 },
-  { 138347287.5999876, 46325560.626631275, 138347288.36139014, 46325520.6338786, 138347286.83858505, 46325600.619383946, 138347287.63805774, 46325558.62699364, 138347287.56191745, 46325562.62626891, 1, 4, 138347283.43130863, 46325779.58695214, 32 },
-  { 138347267.86173037, 46325560.2508442, 138347267.74589863, 46325520.251011916, 138347267.9775621, 46325600.25067649, 138347267.8559388, 46325558.25085259, 138347267.86752194, 46325562.25083581, 0, 0, 0, 0, 0 },
-  { 138347248.13928625, 46325560.30795656, 138347247.0291142, 46325520.323365554, 138347249.2494583, 46325600.29254757, 138347248.08377764, 46325558.30872701, 138347248.19479486, 46325562.30718611, 0, 0, 0, 0, 0 },
-  { 138347228.43524653, 46325560.85503917, 138347226.34327102, 46325520.90978115, 138347230.52722204, 46325600.80029719, 138347228.33064777, 46325558.85777627, 138347228.5398453, 46325562.852302074, 0, 0, 0, 0, 0 },
-  { 138347208.75169355, 46325561.885887705, 138347205.7318593, 46325522.00004309, 138347211.7715278, 46325601.77173232, 138347208.60070184, 46325559.891595475, 138347208.90268525, 46325563.880179934, 0, 0, 0, 0, 0 },
-  { 138347189.09055018, 46325563.3744708, 138347185.19752908, 46325523.56436672, 138347192.9835713, 46325603.18457488, 138347188.89589912, 46325561.3839656, 138347189.28520125, 46325565.364976004, 1, 2, 138347171.96125734, 46325388.21001286, 27 },
-  { 138347169.45373908, 46325565.29475013, 138347164.74250528, 46325525.57316562, 138347174.16497287, 46325605.016334645, 138347169.21817738, 46325563.30867091, 138347169.68930078, 46325567.280829355, 0, 0, 0, 0, 0 },
-  { 138347149.843183, 46325567.62068742, 138347144.36867392, 46325527.997086495, 138347155.3176921, 46325607.24428834, 138347149.56945756, 46325565.63950737, 138347150.11690846, 46325569.60186747, 1, 5, 138347114.12201124, 46325309.07669138, 48 },
-  { 138347130.26080468, 46325570.32624435, 138347124.07765025, 46325530.80702622, 138347136.44395912, 46325609.84546247, 138347129.95164695, 46325568.350283444, 138347130.5699624, 46325572.30220525, 1, 5, 138347173.07914925, 46325843.99682985, 43 },
-  { 138347110.70852685, 46325573.385382645, 138347103.87084332, 46325533.97413953, 138347117.54621038, 46325612.79662576, 138347110.36664268, 46325571.41482049, 138347111.05041102, 46325575.3559448, 0, 0, 0, 0, 0 },
-  { 138347091.1882723, 46325576.77206402, 138347083.74951497, 46325537.46983903, 138347098.62702963, 46325616.07428902, 138347090.81633443, 46325574.806952775, 138347091.56021017, 46325578.73717527, 0, 0, 0, 0, 0 },
-  { 138347071.70196366, 46325580.46025016, 138347063.71483195, 46325541.26578975, 138347079.68909538, 46325619.654710576, 138347071.3026071, 46325578.50052714, 138347072.10132024, 46325582.41997318, 0, 0, 0, 0, 0 },
-  { 138347052.2515238, 46325584.423902765, 138347043.76791367, 46325545.33389945, 138347060.73513392, 46325623.51390608, 138347051.82734329, 46325582.4694026, 138347052.6757043, 46325586.37840293, 0, 0, 0, 0, 0 },
-  { 138347032.83887532, 46325588.636983536, 138347023.909872, 46325549.646306455, 138347041.76787865, 46325627.62766062, 138347032.39242515, 46325586.68744968, 138347033.2853255, 46325590.58651739, 0, 0, 0, 0, 0 },
-  { 138347013.465941, 46325593.0734542, 138347004.1418473, 46325554.17536586, 138347022.7900347, 46325631.971542545, 138347012.99973634, 46325591.128549784, 138347013.93214568, 46325595.01835862, 1, 2, 138347041.43822208, 46325709.76771924, 32 },
-  { 138346994.13464367, 46325597.707276456, 138346984.4650386, 46325558.893635325, 138347003.80424875, 46325636.52091759, 138346993.65116343, 46325595.7665944, 138346994.61812392, 46325599.64795851, 0, 0, 0, 0, 0 },
-  { 138346974.846906, 46325602.51241199, 138346964.88072863, 46325563.77386131, 138346984.81308338, 46325641.25096267, 138346974.34859714, 46325600.575484455, 138346975.34521487, 46325604.449339524, 0, 0, 0, 0, 0 },
-  { 138346955.6046507, 46325607.46282253, 138346945.39022654, 46325568.7889872, 138346965.81907487, 46325646.13665786, 138346955.0939295, 46325605.52913076, 138346956.1153719, 46325609.3965143, 1, 5, 138346874.14461806, 46325299.03898577, 30 },
-  { 138346936.40979037, 46325612.532514825, 138346925.98354107, 46325573.915247634, 138346946.83603966, 46325651.14978202, 138346935.8884779, 46325610.60165147, 138346936.93110284, 46325614.46337818, 1, 5, 138346962.73606986, 46325710.04111449, 25 },
-  { 138346917.26277503, 46325617.702004276, 138346906.63758436, 46325579.138999686, 138346927.8879657, 46325656.26500887, 138346916.7315155, 46325615.77385405, 138346917.79403457, 46325619.630154505, 0, 0, 0, 0, 0 },
-  { 138346898.1610765, 46325622.96505863, 138346887.3470234, 46325584.454589196, 138346908.97512957, 46325661.47552807, 138346897.62037385, 46325621.03953516, 138346898.70177913, 46325624.89058211, 0, 0, 0, 0, 0 },
-  { 138346879.10180447, 46325628.31705725, 138346868.10901114, 46325589.85722762, 138346890.0945978, 46325666.77688688, 138346878.5521648, 46325626.39406577, 138346879.65144414, 46325630.24004874, 1, 3, 138346769.44869116, 46325244.680256695, 44 },
-  { 138346860.08206865, 46325633.75337943, 138346848.9206935, 46325595.34213492, 138346871.24344382, 46325672.16462393, 138346859.5239999, 46325631.832817204, 138346860.6401374, 46325635.67394165, 1, 5, 138346912.54053196, 46325814.28622859, 27 },
-  { 138346841.09897867, 46325639.26940454, 138346829.7792103, 46325600.90453983, 138346852.41874704, 46325677.634269245, 138346840.53299025, 46325637.3511613, 138346841.6649671, 46325641.187647775, 0, 0, 0, 0, 0 },
-  { 138346822.14964423, 46325644.860511884, 138346810.6816956, 46325606.53968003, 138346833.61759284, 46325683.18134374, 138346821.5762468, 46325642.944470294, 138346822.72304165, 46325646.776553474, 0, 0, 0, 0, 0 },
-  { 138346803.2311751, 46325650.52208084, 138346791.62527874, 46325612.24280225, 138346814.83707145, 46325688.80135943, 138346802.65088028, 46325648.60811691, 138346803.8114699, 46325652.43604477, 0, 0, 0, 0, 0 },
-  { 138346784.34068087, 46325656.249490716, 138346772.60708374, 46325618.009162545, 138346796.074278, 46325694.489818886, 138346783.75400102, 46325654.33747431, 138346784.9273607, 46325658.16150712, 1, 5, 138346867.64922047, 46325927.755820714, 25 },
-  { 138346765.47527125, 46325662.03812085, 138346753.62423068, 46325623.834026344, 138346777.32631183, 46325700.24221536, 138346764.88271922, 46325660.12791613, 138346766.0678233, 46325663.948325574, 0, 0, 0, 0, 0 },
-  { 138346746.63205597, 46325667.88335058, 138346734.67383575, 46325629.712668516, 138346758.59027618, 46325706.054032646, 138346746.03414497, 46325665.97481648, 138346747.22996697, 46325669.79188468, 0, 0, 0, 0, 0 },
-  { 138346727.80814463, 46325673.78055925, 138346715.7530115, 46325635.64037354, 138346739.86327776, 46325711.920744956, 138346727.20538798, 46325671.87354996, 138346728.41090128, 46325675.68756854, 1, 0, 138346640.70980784, 46325398.21771754, 45 },
-  { 138346709.00064704, 46325679.72512619, 138346696.85886785, 46325641.61243541, 138346721.14242622, 46325717.837816976, 138346708.39355808, 46325677.819491655, 138346709.607736, 46325681.63076073, 0, 0, 0, 0, 0 },
-  { 138346690.2066727, 46325685.71243072, 138346677.98851112, 46325647.62415789, 138346702.42483428, 46325723.800703555, 138346689.5957646, 46325683.80801708, 138346690.8175808, 46325687.61684436, 0, 0, 0, 0, 0 },
-  { 138346671.4233315, 46325691.737852216, 138346659.13904607, 46325653.670854285, 138346683.70761693, 46325729.804850146, 138346670.80911723, 46325689.83450232, 138346672.03754577, 46325693.641202115, 0, 0, 0, 0, 0 },
-  { 138346652.64773303, 46325697.79677, 138346640.30757472, 46325659.74784764, 138346664.98789135, 46325735.84569236, 138346652.03072512, 46325695.89432388, 138346653.26474094, 46325699.69921612, 0, 0, 0, 0, 0 },
-  { 138346633.87698698, 46325703.88456339, 138346621.4911972, 46325665.85047064, 138346646.26277676, 46325741.91865613, 138346633.2576975, 46325701.98285875, 138346634.49627647, 46325705.786268026, 0, 0, 0, 0, 0 },
-  { 138346615.10820296, 46325709.99661173, 138346602.6870117, 46325671.97406569, 138346627.52939424, 46325748.01915777, 138346614.4871434, 46325708.09548443, 138346615.72926253, 46325711.89773903, 0, 0, 0, 0, 0 },
-  { 138346596.3384908, 46325716.128294356, 138346583.89211515, 46325678.11398478, 138346608.78486648, 46325754.142603934, 138346595.71617204, 46325714.22757888, 138346596.9608096, 46325718.029009834, 0, 0, 0, 0, 0 },
-  { 138346577.56496018, 46325722.274990626, 138346565.10360292, 46325684.26558948, 138346590.02631745, 46325760.28439177, 138346576.94189233, 46325720.37452057, 138346578.18802804, 46325724.17546068, 1, 4, 138346500.927613, 46325488.51717361, 43 },
-  { 138346558.78472066, 46325728.43207985, 138346546.31856862, 46325690.424251005, 138346571.2508727, 46325766.4399087, 138346558.16141304, 46325726.53168841, 138346559.40802827, 46325730.332471296, 0, 0, 0, 0, 0 },
-  { 138346539.994882, 46325734.59494136, 138346527.53410482, 46325696.58535004, 138346552.45565915, 46325772.60453269, 138346539.37184313, 46325732.6944618, 138346540.61792085, 46325736.495420925, 0, 0, 0, 0, 0 },
-  { 138346521.19255388, 46325740.75895451, 138346508.74730277, 46325702.744276755, 138346533.63780499, 46325778.773632266, 138346520.5702913, 46325738.85822062, 138346521.81481645, 46325742.6596884, 0, 0, 0, 0, 0 },
-  { 138346502.37484598, 46325746.919498645, 138346489.94414452, 46325708.90006071, 138346514.80554745, 46325784.938936576, 138346501.75331092, 46325745.01852675, 138346502.99638104, 46325748.82047054, 1, 1, 138346468.50118446, 46325643.31653027, 27 },
-  { 138346483.54153273, 46325753.07717239, 138346471.06902665, 46325715.071428195, 138346496.0140388, 46325791.08291659, 138346482.91790742, 46325751.17688518, 138346484.16515803, 46325754.9774596, 0, 0, 0, 0, 0 },
-  { 138346464.70568302, 46325759.25861298, 138346452.11791533, 46325721.290888466, 138346477.2934507, 46325797.2263375, 138346464.07629463, 46325757.36022676, 138346465.3350714, 46325761.15699921, 0, 0, 0, 0, 0 },
-  { 138346445.884503, 46325765.498561375, 138346433.10819066, 46325727.593867175, 138346458.66081536, 46325803.403255574, 138346445.2456874, 46325763.60332666, 138346446.52331862, 46325767.39379609, 0, 0, 0, 0, 0 },
-  { 138346427.09520024, 46325771.83176116, 138346414.05728504, 46325734.01625154, 138346440.13311544, 46325809.64727078, 138346426.44330448, 46325769.94098568, 138346427.747096, 46325773.72253664, 1, 3, 138346325.72540963, 46325477.816173896, 40 },
-  { 138346408.3549823, 46325778.29295591, 138346394.9827094, 46325740.59438408, 138346421.72725517, 46325815.99152774, 138346407.68636864, 46325776.40802732, 138346409.02359593, 46325780.177884504, 0, 0, 0, 0, 0 },
-  { 138346389.6810568, 46325784.916889265, 138346375.90209985, 46325747.365053825, 138346403.46001375, 46325822.468724705, 138346388.99210894, 46325783.03929749, 138346390.37000465, 46325786.79448104, 0, 0, 0, 0, 0 },
-  { 138346371.09063134, 46325791.738304764, 138346356.83327597, 46325754.365482844, 138346385.3479867, 46325829.11112668, 138346370.37776357, 46325789.86966367, 138346371.8034991, 46325793.60694586, 0, 0, 0, 0, 0 },
-  { 138346352.6009134, 46325798.79194603, 138346337.7943131, 46325761.633305214, 138346367.4075137, 46325835.95058685, 138346351.8605834, 46325796.93401399, 138346353.34124342, 46325800.64987807, 1, 5, 138346275.60659182, 46325605.56701378, 35 },
-  { 138346334.22911063, 46325806.11255665, 138346318.80362555, 46325769.206535324, 138346349.6545957, 46325843.01857798, 138346333.45783636, 46325804.26725558, 138346335.0003849, 46325807.95785772, 0, 0, 0, 0, 0 },
-  { 138346315.9924306, 46325813.73488021, 138346299.88006, 46325777.1235225, 138346332.1048012, 46325850.34623792, 138346315.18681207, 46325811.90431232, 138346316.79804912, 46325815.5654481, 0, 0, 0, 0, 0 },
-  { 138346297.90808088, 46325821.6936603, 138346281.04299638, 46325785.422887966, 138346314.77316537, 46325857.96443263, 138346297.06482664, 46325819.88012168, 138346298.7513351, 46325823.507198915, 0, 0, 0, 0, 0 },
-  { 138346279.993269, 46325830.02364051, 138346262.3124523, 46325794.14344096, 138346297.6740857, 46325865.903840065, 138346279.10922816, 46325828.22963054, 138346280.87730983, 46325831.81765049, 1, 0, 138346117.77177557, 46325500.82280961, 43 },
-  { 138346262.26520258, 46325838.75956442, 138346243.70918527, 46325803.32407061, 138346280.8212199, 46325874.195058234, 138346261.33740172, 46325836.98778973, 138346263.19300345, 46325840.53133912, 0, 0, 0, 0, 0 },
-  { 138346244.74108922, 46325847.93617566, 138346225.25478646, 46325813.00361199, 138346264.227392, 46325882.86873933, 138346243.7667741, 46325846.18954748, 138346245.71540436, 46325849.68280384, 1, 1, 138346053.2881646, 46325504.72373758, 43 },
-  { 138346227.4381365, 46325857.58821777, 138346206.9797813, 46325823.215907656, 138346247.89649168, 46325891.96052789, 138346226.41521874, 46325855.86960227, 138346228.46105424, 46325859.306833275, 0, 0, 0, 0, 0 },
-  { 138346210.37159443, 46325867.746201865, 138346188.9902448, 46325833.940316446, 138346231.75294405, 46325901.552087285, 138346209.30252695, 46325866.05590759, 138346211.4406619, 46325869.43649614, 0, 0, 0, 0, 0 },
-  { 138346193.53543812, 46325878.394636, 138346171.3309021, 46325845.12364894, 138346215.73997414, 46325911.665623054, 138346192.4252113, 46325876.73108664, 138346194.64566493, 46325880.058185354, 1, 3, 138346324.54220068, 46326074.69345963, 42 },
-  { 138346176.91058794, 46325889.48980081, 138346153.97905803, 46325856.71565039, 138346199.84211785, 46325922.263951235, 138346175.76401144, 46325887.85109329, 138346178.05716443, 46325891.12850833, 0, 0, 0, 0, 0 },
-  { 138346160.47777507, 46325900.98756765, 138346136.91094342, 46325868.66722658, 138346184.04460672, 46325933.307908714, 138346159.2994335, 46325899.3715506, 138346161.65611663, 46325902.6035847, 0, 0, 0, 0, 0 },
-  { 138346144.21773073, 46325912.843807854, 138346120.1028991, 46325880.93025438, 138346168.33256236, 46325944.75736133, 138346143.01198915, 46325911.24813018, 138346145.42347232, 46325914.43948553, 1, 2, 138346015.20338154, 46325742.10629674, 44 },
-  { 138346128.1111861, 46325925.014392756, 138346103.53154406, 46325893.45744109, 138346152.6908281, 46325956.57134442, 138346126.882204, 46325923.43654517, 138346129.34016818, 46325926.59224034, 1, 1, 138346294.63826075, 46326138.812740274, 44 },
-  { 138346112.13887233, 46325937.45519371, 138346087.1739022, 46325906.20218959, 138346137.10384244, 46325968.70819784, 138346110.8906238, 46325935.89254351, 138346113.38712084, 46325939.01784392, 0, 0, 0, 0, 0 },
-  { 138346096.28152058, 46325950.122082025, 138346071.00749338, 46325919.1184766, 138346121.55554777, 46325981.12568745, 138346095.01781923, 46325948.57190175, 138346097.54522192, 46325951.672262296, 0, 0, 0, 0, 0 },
-  { 138346080.51986212, 46325962.970929086, 138346055.01039976, 46325932.160746835, 138346106.02932447, 46325993.78111134, 138346079.244389, 46325961.430419974, 138346081.79533523, 46325964.5114382, 0, 0, 0, 0, 0 },
-  { 138346064.83462805, 46325975.95760618, 138346039.16130948, 46325945.28382724, 138346090.5079466, 46326006.631385125, 138346063.55096212, 46325974.423917234, 138346066.11829397, 46325977.49129513, 1, 3, 138346149.55657926, 46326077.18107669, 37 },
-  { 138346049.20654953, 46325989.03798467, 138346023.43954813, 46325958.44286023, 138346074.97355092, 46326019.63310911, 138346047.91819945, 46325987.50822845, 138346050.4948996, 46325990.56774089, 0, 0, 0, 0, 0 },
-  { 138346033.6163578, 46326002.1679359, 138346007.82509902, 46325971.59325732, 138346059.4076166, 46326032.74261448, 138346032.32679486, 46326000.63920197, 138346034.90592074, 46326003.69666983, 1, 0, 138346258.6450907, 46326268.93200651, 32 },
-  { 138346018.044784, 46326015.303331204, 138345992.29861546, 46325984.6906736, 138346043.79095256, 46326045.91598881, 138346016.75747558, 46326013.77269832, 138346019.33209243, 46326016.83396409, 0, 0, 0, 0, 0 },
-  { 138346002.47255936, 46326028.4000419, 138345976.84142834, 46325997.69100216, 138346028.1036904, 46326059.10908164, 138346001.19100282, 46326026.864589915, 138346003.7541159, 46326029.93549389, 1, 4, 138346252.37608695, 46326327.81317938, 47 },
-  { 138345986.88041505, 46326041.41393935, 138345961.4355474, 46326010.550389476, 138346012.3252827, 46326072.27748922, 138345985.60817167, 46326039.87076186, 138345988.15265843, 46326042.95711684, 0, 0, 0, 0, 0 },
-  { 138345971.2490822, 46326054.30089489, 138345946.06365654, 46326023.225272074, 138345996.43450788, 46326085.37651771, 138345969.9898109, 46326052.74711375, 138345972.5083535, 46326055.85467604, 0, 0, 0, 0, 0 },
-  { 138345955.55929202, 46326067.01677985, 138345930.70910016, 46326035.67243483, 138345980.40948388, 46326098.361124866, 138345954.31678241, 46326065.449562594, 138345956.80180162, 46326068.5839971, 0, 0, 0, 0, 0 },
-  { 138345939.79177567, 46326079.51746557, 138345915.35585767, 46326047.84909158, 138345964.22769368, 46326111.185839556, 138345938.5699798, 46326077.93404687, 138345941.01357156, 46326081.100884266, 1, 2, 138346110.84320176, 46326301.196083464, 36 },
-  { 138345923.92726436, 46326091.758823395, 138345899.98849973, 46326059.71298828, 138345947.866029, 46326123.80465851, 138345922.73032615, 46326090.15653164, 138345925.12420258, 46326093.36111515, 1, 4, 138345794.65793538, 46325918.711313784, 32 },
-  { 138345907.9464892, 46326103.69672464, 138345884.59212, 46326071.22252813, 138345931.30085844, 46326136.17092115, 138345906.77877074, 46326102.07301481, 138345909.11420768, 46326105.320434466, 1, 1, 138345969.83556762, 46326189.75334538, 50 },
-  { 138345891.8301815, 46326115.28704067, 138345869.15223515, 46326082.3369155, 138345914.50812787, 46326148.237165846, 138345890.6962842, 46326113.639534414, 138345892.9640788, 46326116.93454693, 0, 0, 0, 0, 0 },
-  { 138345875.5590723, 46326126.48564281, 138345853.65464, 46326093.01631587, 138345897.46350458, 46326159.95496976, 138345874.46385068, 46326124.812176466, 138345876.6542939, 46326128.15910916, 0, 0, 0, 0, 0 },
-  { 138345859.11389285, 46326137.2484024, 138345838.08521304, 46326103.22202109, 138345880.14257267, 46326171.274783716, 138345858.06245887, 46326135.54708333, 138345860.16532683, 46326138.94972147, 1, 3, 138345783.41064554, 46326014.753429666, 27 },
-  { 138345842.4753743, 46326147.5311908, 138345822.42965713, 46326112.91660973, 138345862.5210915, 46326182.14577187, 138345841.47308844, 46326145.80046175, 138345843.47766018, 46326149.26191985, 1, 2, 138345933.68338746, 46326305.02753468, 30 },
-  { 138345825.62424788, 46326157.28987931, 138345806.67317277, 46326122.06408262, 138345844.575323, 46326192.51567599, 138345824.67669412, 46326155.52858947, 138345826.57180163, 46326159.05116914, 0, 0, 0, 0, 0 },
-  { 138345808.54124478, 46326166.480339296, 138345790.80006084, 46326130.62995028, 138345826.2824287, 46326202.330728315, 138345807.6541856, 46326164.687819846, 138345809.42830396, 46326168.27285875, 0, 0, 0, 0, 0 },
-  { 138345791.207096, 46326175.05844207, 138345774.793261, 46326138.58124345, 138345807.62093103, 46326211.535640694, 138345790.38640425, 46326173.23458214, 138345792.02778777, 46326176.882302, 0, 0, 0, 0, 0 },
-  { 138345773.60253295, 46326182.98005899, 138345758.63384983, 46326145.88641364, 138345788.57121608, 46326220.07370434, 138345772.8540988, 46326181.12537672, 138345774.3509671, 46326184.83474126, 0, 0, 0, 0, 0 },
-  { 138345755.7082867, 46326190.20106139, 138345742.30052835, 46326152.51509562, 138345769.11604506, 46326227.88702716, 138345755.03789878, 46326188.3167631, 138345756.37867463, 46326192.08535968, 0, 0, 0, 0, 0 },
-  { 138345737.50508842, 46326196.67732062, 138345725.76915592, 46326158.437709115, 138345749.24102092, 46326234.91693213, 138345736.9182918, 46326194.765340045, 138345738.09188503, 46326198.5893012, 0, 0, 0, 0, 0 },
-  { 138345718.97366932, 46326202.364708, 138345709.0123928, 46326163.624896824, 138345728.93494585, 46326241.10451917, 138345718.4756055, 46326200.42771744, 138345719.47173315, 46326204.30169856, 0, 0, 0, 0, 0 },
-  { 138345700.09476057, 46326207.219094865, 138345691.9993597, 46326168.04685361, 138345708.19016144, 46326246.39133612, 138345699.68999052, 46326205.2604828, 138345700.4995306, 46326209.17770693, 1, 5, 138345722.761883, 46326316.90137038, 42 },
-  { 138345680.85474735, 46326211.19526816, 138345674.7084777, 46326171.67029669, 138345687.001017, 46326250.72023963, 138345680.54743388, 46326209.21901959, 138345681.16206083, 46326213.17151673, 0, 0, 0, 0, 0 },
-  { 138345661.31131533, 46326214.23433937, 138345657.21207222, 46326174.444941215, 138345665.41055843, 46326254.02373753, 138345661.10635316, 46326212.24486946, 138345661.5162775, 46326216.22380928, 1, 4, 138345695.6424764, 46326547.47054896, 39 },
-  { 138345641.5709428, 46326216.26806167, 138345639.63684836, 46326176.31484804, 138345643.50503722, 46326256.22127529, 138345641.47423807, 46326214.270400986, 138345641.6676475, 46326218.26572235, 0, 0, 0, 0, 0 },
-  { 138345621.74105647, 46326217.228006296, 138345622.10897976, 46326177.22969843, 138345621.37313318, 46326257.226314165, 138345621.75945264, 46326215.228090905, 138345621.7226603, 46326219.22792169, 0, 0, 0, 0, 0 },
-  { 138345601.9290697, 46326217.0457663, 138345604.67230275, 46326177.13994376, 138345599.18583664, 46326256.95158884, 138345602.06623134, 46326215.05047517, 138345601.79190806, 46326219.04105743, 1, 0, 138345625.72661638, 46325870.86275578, 35 },
-  { 138345582.21904165, 46326215.69084622, 138345587.16622573, 46326175.99795807, 138345577.27185756, 46326255.38373437, 138345582.46640086, 46326213.706201814, 138345581.97168243, 46326217.675490625, 0, 0, 0, 0, 0 },
-  { 138345562.62369764, 46326213.24855042, 138345569.54455718, 46326173.85182844, 138345555.7028381, 46326252.645272404, 138345562.96974063, 46326211.27871432, 138345562.27765465, 46326215.21838652, 0, 0, 0, 0, 0 },
-  { 138345543.14219046, 46326209.82621556, 138345551.8019665, 46326170.77486117, 138345534.48241442, 46326248.87756994, 138345543.57517925, 46326207.87364784, 138345542.70920166, 46326211.77878328, 0, 0, 0, 0, 0 },
-  { 138345523.7736731, 46326205.531178296, 138345533.94013178, 46326166.844706275, 138345513.6072144, 46326244.21765032, 138345524.281996, 46326203.596854694, 138345523.26535016, 46326207.4655019, 0, 0, 0, 0, 0 },
-  { 138345504.5172985, 46326200.47077534, 138345515.9651218, 46326162.14392651, 138345493.06947517, 46326238.79762418, 138345505.08968964, 46326198.5544329, 138345503.94490734, 46326202.38711779, 0, 0, 0, 0, 0 },
-  { 138345485.3722196, 46326194.752343304, 138345497.8851698, 46326156.759895675, 138345472.85926938, 46326232.744790934, 138345485.9978671, 46326192.85272092, 138345484.74657208, 46326196.651965685, 1, 0, 138345548.24979442, 46326003.840293966, 43 },
-  { 138345466.33758935, 46326188.4832189, 138345479.70893607, 46326150.78431856, 138345452.96624264, 46326226.18211924, 138345467.00615668, 46326186.59827388, 138345465.66902202, 46326190.36816392, 0, 0, 0, 0, 0 },
-  { 138345447.41256076, 46326181.77073879, 138345461.44422698, 46326144.31259757, 138345433.38089454, 46326219.22888, 138345448.11414406, 46326179.89783173, 138345446.71097746, 46326183.643645845, 1, 3, 138345538.96918282, 46325937.356367365, 30 },
-  { 138345428.59628665, 46326174.722239606, 138345443.09708935, 46326137.44320097, 138345414.09548396, 46326212.001278244, 138345429.3213268, 46326172.85828768, 138345427.87124652, 46326176.586191535, 0, 0, 0, 0, 0 },
-  { 138345409.88792008, 46326167.445058055, 138345424.671181, 46326130.27712568, 138345395.10465917, 46326204.61299043, 138345410.62708312, 46326165.586661436, 138345409.14875704, 46326169.303454675, 0, 0, 0, 0, 0 },
-  { 138345391.28661397, 46326160.04653078, 138345406.1673301, 46326122.91750861, 138345376.40589786, 46326197.17555296, 138345392.03064978, 46326158.190079674, 138345390.54257816, 46326161.90298189, 0, 0, 0, 0, 0 },
-  { 138345372.79152116, 46326152.63399445, 138345387.58321935, 46326115.469419055, 138345357.99982297, 46326189.79856985, 138345373.53110608, 46326150.77576568, 138345372.05193624, 46326154.492223226, 0, 0, 0, 0, 0 },
-  { 138345354.40179473, 46326145.31478576, 138345368.91315582, 46326108.03985586, 138345339.89043364, 46326182.58971567, 138345355.1273628, 46326143.45103927, 138345353.67622668, 46326147.17853226, 1, 2, 138345260.4407317, 46326386.6699569, 47 },
-  { 138345336.11658752, 46326138.19624134, 138345350.1479194, 46326100.73797488, 138345322.08525565, 46326175.6545078, 138345336.81815413, 46326136.32332802, 138345335.4150209, 46326140.069154665, 1, 0, 138345409.07951325, 46325943.413255766, 42 },
-  { 138345317.93505254, 46326131.385697894, 138345331.27472067, 46326093.675576515, 138345304.59538442, 46326169.09581927, 138345318.60203594, 46326129.50019182, 138345317.26806915, 46326133.271203965, 0, 0, 0, 0, 0 },
-  { 138345299.85634273, 46326124.990492046, 138345312.27734187, 46326086.967883244, 138345287.4353436, 46326163.01310085, 138345300.4773927, 46326123.08936161, 138345299.23529276, 46326126.891622484, 0, 0, 0, 0, 0 },
-  { 138345281.87961102, 46326119.117960505, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 0.0 },
+// control points of course (x, y)
+static const double yasyajintouge_ctrl[347][2] = {
+  { 138358464.642819, 46322042.67960672 },
+  { 138358484.46412998, 46322242.05934611 },
+  { 138358509.835409, 46322360.17909539 },
+  { 138358561.370817, 46322496.7287091 },
+  { 138358638.27750403, 46322569.61094478 },
+  { 138358711.198299, 46322685.53076554 },
+  { 138358766.7196, 46322799.14776683 },
+  { 138358844.518661, 46322885.0618967 },
+  { 138359327.316284, 46323338.50233324 },
+  { 138360051.512718, 46324007.323365465 },
+  { 138360314.369202, 46324211.369603045 },
+  { 138360510.652488, 46324295.75867132 },
+  { 138360636.234283, 46324330.39638989 },
+  { 138360777.00341702, 46324342.662205 },
+  { 138361086.845398, 46324324.72845072 },
+  { 138361349.70188102, 46324324.72845072 },
+  { 138361816.40625, 46324409.747505374 },
+  { 138361998.796463, 46324523.10613674 },
+  { 138362058.02454898, 46324578.854678415 },
+  { 138362079.262733, 46324647.80048833 },
+  { 138362057.805061, 46324795.166347235 },
+  { 138361971.974373, 46325072.89374407 },
+  { 138361816.40625, 46325407.2992165 },
+  { 138361778.855324, 46325463.97800347 },
+  { 138361724.29317698, 46325528.64452331 },
+  { 138361655.32731202, 46325552.9335677 },
+  { 138361587.946868, 46325549.58335512 },
+  { 138361537.456512, 46325537.66038029 },
+  { 138361081.48098, 46325129.57271355 },
+  { 138361033.049101, 46325113.21722909 },
+  { 138360980.73016798, 46325101.49143448 },
+  { 138360899.090767, 46325055.89004722 },
+  { 138360834.871327, 46324983.395858966 },
+  { 138360786.43798798, 46324868.84919842 },
+  { 138360749.258528, 46324806.67102353 },
+  { 138360652.32753798, 46324710.147607975 },
+  { 138360593.318939, 46324670.47217256 },
+  { 138360030.055046, 46324540.10992067 },
+  { 138359935.936943, 46324490.91073518 },
+  { 138359826.207161, 46324387.07576433 },
+  { 138359772.56298098, 46324341.7322673 },
+  { 138359531.164169, 46324222.70549333 },
+  { 138358978.62911198, 46323910.96805849 },
+  { 138358624.57752198, 46323610.5656454 },
+  { 138358485.10265398, 46323525.54593686 },
+  { 138358329.534531, 46323463.19810638 },
+  { 138357996.940613, 46323338.50233324 },
+  { 138357433.67672, 46322885.0618967 },
+  { 138357326.388359, 46322834.04972379 },
+  { 138357111.811638, 46322777.36950227 },
+  { 138357004.52327698, 46322715.0212229 },
+  { 138356848.955154, 46322567.65241378 },
+  { 138356688.022614, 46322448.62360778 },
+  { 138356516.361237, 46322250.24196133 },
+  { 138356178.402901, 46321785.46062107 },
+  { 138356110.313191, 46321738.64647641 },
+  { 138355999.333637, 46321702.63036225 },
+  { 138355920.910835, 46321660.76283459 },
+  { 138355625.867844, 46321298.00478674 },
+  { 138355384.469032, 46321054.2760121 },
+  { 138355315.223961, 46320983.1430489 },
+  { 138355223.536491, 46320929.57734828 },
+  { 138354971.408844, 46320872.89608792 },
+  { 138354520.79772902, 46320697.18398447 },
+  { 138354359.865189, 46320617.83003395 },
+  { 138354302.93189, 46320583.61185411 },
+  { 138354220.39032, 46320561.14860356 },
+  { 138354050.849762, 46320579.42388799 },
+  { 138353903.889656, 46320606.4937503 },
+  { 138353812.69454998, 46320623.49817526 },
+  { 138353705.406189, 46320634.83445697 },
+  { 138353528.380394, 46320612.16189226 },
+  { 138353372.812271, 46320555.48045887 },
+  { 138353099.226952, 46320504.467142366 },
+  { 138353024.125099, 46320504.467142366 },
+  { 138352755.904198, 46320504.467142366 },
+  { 138352670.07350898, 46320487.46269789 },
+  { 138352613.66454297, 46320471.37430284 },
+  { 138352558.17476702, 46320437.03293838 },
+  { 138352510.61210102, 46320370.02536515 },
+  { 138352482.318878, 46320294.74546683 },
+  { 138352460.861206, 46319988.664424025 },
+  { 138352498.412132, 46319897.97357156 },
+  { 138352632.522583, 46319750.600767404 },
+  { 138352820.277214, 46319552.21397036 },
+  { 138353013.396263, 46319280.1400329 },
+  { 138353254.79507402, 46318838.01836512 },
+  { 138353372.812271, 46318554.606050484 },
+  { 138353399.634361, 46318452.57742794 },
+  { 138353412.717329, 46318386.58163145 },
+  { 138353414.302751, 46318348.8891331 },
+  { 138353399.24124, 46318317.897513226 },
+  { 138353372.812271, 46318293.86603822 },
+  { 138353325.519108, 46318291.93155424 },
+  { 138353270.888329, 46318316.53910877 },
+  { 138352954.387665, 46318718.98528706 },
+  { 138352886.357161, 46318780.25801871 },
+  { 138352793.455124, 46318809.67716847 },
+  { 138352605.700493, 46318860.691316985 },
+  { 138352396.48819, 46318968.3877704 },
+  { 138352171.182632, 46319172.44390241 },
+  { 138351849.317551, 46319659.90970721 },
+  { 138351811.766624, 46319705.25524719 },
+  { 138351780.525181, 46319727.58806433 },
+  { 138351736.664772, 46319727.92800978 },
+  { 138351702.83949298, 46319718.37446265 },
+  { 138351677.656174, 46319693.91886408 },
+  { 138351666.92733797, 46319637.23692981 },
+  { 138351665.582072, 46319574.30713054 },
+  { 138351683.020592, 46319495.531958744 },
+  { 138351833.224297, 46318991.060693786 },
+  { 138351845.13113502, 46318937.30935289 },
+  { 138351843.953133, 46318877.69602756 },
+  { 138351827.859879, 46318838.01836512 },
+  { 138351811.044558, 46318815.43753828 },
+  { 138351779.58011597, 46318798.3406876 },
+  { 138351746.438604, 46318799.104191385 },
+  { 138351720.571518, 46318809.67716847 },
+  { 138351602.554321, 46318906.03720562 },
+  { 138351414.79968998, 46319212.1214372 },
+  { 138351318.240166, 46319308.48110124 },
+  { 138351210.951805, 46319370.83142448 },
+  { 138351066.112518, 46319370.83142448 },
+  { 138350964.188576, 46319325.48573849 },
+  { 138350915.908813, 46319274.471818276 },
+  { 138350889.086723, 46319189.448562026 },
+  { 138350926.63764998, 46319064.74766052 },
+  { 138351076.841354, 46318787.00420556 },
+  { 138351178.765297, 46318667.971069 },
+  { 138351216.511236, 46318591.79610455 },
+  { 138351228.40190202, 46318535.676268436 },
+  { 138351226.81647998, 46318503.0094843 },
+  { 138351210.169547, 46318471.18030002 },
+  { 138351180.046525, 46318453.590483494 },
+  { 138351141.21437103, 46318458.24568729 },
+  { 138351007.10392, 46318486.58697988 },
+  { 138350840.806961, 46318554.606050484 },
+  { 138350604.77256802, 46318667.971069 },
+  { 138350492.119789, 46318764.33123771 },
+  { 138350105.881691, 46318883.364263766 },
+  { 138349998.59333003, 46318991.060693786 },
+  { 138349848.389626, 46319280.1400329 },
+  { 138349698.185921, 46319682.58247967 },
+  { 138349644.54174, 46319824.28719555 },
+  { 138349537.25338, 46320147.37322544 },
+  { 138349517.731355, 46320226.79653266 },
+  { 138349515.795708, 46320289.077307574 },
+  { 138349547.982216, 46320357.095198296 },
+  { 138349602.551443, 46320411.90510358 },
+  { 138349665.99941298, 46320447.78565009 },
+  { 138349844.328327, 46320509.06603146 },
+  { 138349998.59333003, 46320549.812313795 },
+  { 138350363.37375602, 46320668.84329482 },
+  { 138350712.06092802, 46320748.19720647 },
+  { 138350894.451141, 46320872.89608792 },
+  { 138351012.468338, 46320997.59481987 },
+  { 138351747.393608, 46321400.03061571 },
+  { 138351811.766624, 46321456.7115885 },
+  { 138351856.625446, 46321520.874433346 },
+  { 138351865.41080502, 46321581.409619756 },
+  { 138351811.766624, 46322017.851551004 },
+  { 138351822.495461, 46322119.87667329 },
+  { 138351940.512657, 46322454.29164925 },
+  { 138351983.42800102, 46322783.0375258 },
+  { 138352008.033266, 46322874.40404312 },
+  { 138352063.894272, 46322924.73801395 },
+  { 138352133.631706, 46322947.410074145 },
+  { 138352195.905795, 46322941.410001494 },
+  { 138352530.59864, 46322839.7177442 },
+  { 138352564.516455, 46322817.448944524 },
+  { 138352650.12925398, 46322693.487739764 },
+  { 138352680.80234498, 46322664.00896654 },
+  { 138352782.72628802, 46322612.99668496 },
+  { 138352895.37906602, 46322601.66061905 },
+  { 138352977.518937, 46322608.892508395 },
+  { 138353056.311607, 46322635.66881314 },
+  { 138353404.998779, 46322851.053784244 },
+  { 138353614.211082, 46323066.43830879 },
+  { 138353665.592169, 46323094.68596862 },
+  { 138353726.863861, 46323100.44635078 },
+  { 138354091.644287, 46322919.069998085 },
+  { 138354247.21241, 46322896.39793179 },
+  { 138354359.865189, 46322913.40198197 },
+  { 138354467.02308702, 46322964.02450263 },
+  { 138354558.348656, 46323049.43428358 },
+  { 138354708.55236098, 46323338.50233324 },
+  { 138354767.560959, 46323457.53012003 },
+  { 138354987.502098, 46323922.303981535 },
+  { 138355084.06162298, 46324064.002916045 },
+  { 138355625.867844, 46324630.79672194 },
+  { 138355888.724327, 46324885.85292581 },
+  { 138355922.440661, 46324939.84284686 },
+  { 138355923.233372, 46325023.59862325 },
+  { 138355883.359909, 46325089.897438176 },
+  { 138355835.080147, 46325146.576398306 },
+  { 138355384.469032, 46325412.96709664 },
+  { 138354912.400246, 46325764.37505822 },
+  { 138354687.094688, 46325849.392934926 },
+  { 138354359.865189, 46325917.40718617 },
+  { 138354225.754738, 46325962.74999563 },
+  { 138354021.90685302, 46326064.771244444 },
+  { 138353877.067566, 46326195.131583385 },
+  { 138353791.236877, 46326342.495247886 },
+  { 138353737.592697, 46326591.87943462 },
+  { 138353780.50804102, 46327198.33393652 },
+  { 138353844.881058, 46327374.03504678 },
+  { 138354172.110558, 46327986.152722955 },
+  { 138354429.602623, 46328507.58345459 },
+  { 138354461.789131, 46328671.94694699 },
+  { 138354472.517967, 46328966.667041115 },
+  { 138354451.060295, 46329029.0115692 },
+  { 138354408.14495102, 46329091.35605998 },
+  { 138354306.221008, 46329142.36516085 },
+  { 138354232.38060302, 46329141.78687041 },
+  { 138354153.10949302, 46329093.21045369 },
+  { 138354102.373123, 46329017.67620321 },
+  { 138354091.644287, 46328926.99323097 },
+  { 138354101.583272, 46328867.07856017 },
+  { 138354122.986471, 46328818.502015136 },
+  { 138354227.624336, 46328670.25965958 },
+  { 138354241.847992, 46328615.26991009 },
+  { 138354225.754738, 46328479.24489512 },
+  { 138354166.74614, 46328354.55514162 },
+  { 138354118.466377, 46328292.21020871 },
+  { 138353914.618492, 46328008.823678784 },
+  { 138353803.523899, 46327795.03918202 },
+  { 138353453.27854198, 46327391.038364284 },
+  { 138353313.803673, 46327096.31380065 },
+  { 138353270.888329, 46326931.94781548 },
+  { 138353227.97298402, 46326597.547250025 },
+  { 138353210.575999, 46326454.97440403 },
+  { 138353208.990577, 46326309.24131743 },
+  { 138353245.455287, 46326163.50802648 },
+  { 138353437.185287, 46325696.360706754 },
+  { 138353544.47364798, 46325531.99250704 },
+  { 138353667.85526302, 46325418.63497639 },
+  { 138353850.245476, 46325327.94886282 },
+  { 138353941.44058198, 46325248.59844856 },
+  { 138354011.178017, 46325112.56902594 },
+  { 138354005.813599, 46325010.546842046 },
+  { 138353930.71174598, 46324891.52083428 },
+  { 138353742.957115, 46324772.4946903 },
+  { 138353061.676025, 46324392.74369998 },
+  { 138352857.82814, 46324296.38875038 },
+  { 138352761.901518, 46324279.007404186 },
+  { 138352670.07350898, 46324307.72463143 },
+  { 138351731.300354, 46324806.502173945 },
+  { 138351430.892944, 46324919.860372394 },
+  { 138351291.41807598, 46324925.528279066 },
+  { 138351219.285724, 46324913.04098424 },
+  { 138351034.584039, 46324854.41188553 },
+  { 138350964.188576, 46324817.83799935 },
+  { 138350915.908813, 46324755.49094419 },
+  { 138350856.900215, 46324545.77784814 },
+  { 138350787.162781, 46324177.361924544 },
+  { 138350708.779778, 46324060.40311959 },
+  { 138350600.17835802, 46323973.296303436 },
+  { 138350567.221642, 46323927.971942656 },
+  { 138350293.636322, 46323338.50233324 },
+  { 138350218.53447, 46323185.466407195 },
+  { 138350196.68840998, 46323126.5137368 },
+  { 138350143.43261698, 46323094.77834454 },
+  { 138350074.610901, 46323072.071495965 },
+  { 138349956.496947, 46323056.15760472 },
+  { 138349832.296371, 46323015.42622494 },
+  { 138349710.75650698, 46322921.30821849 },
+  { 138349589.47171, 46322856.81497189 },
+  { 138349499.702454, 46322834.04972379 },
+  { 138349231.481552, 46322834.04972379 },
+  { 138348947.167397, 46322885.0618967 },
+  { 138348764.77718398, 46322964.414116 },
+  { 138348528.74278998, 46323179.79840551 },
+  { 138348303.437233, 46323338.50233324 },
+  { 138347611.42730698, 46323752.26500503 },
+  { 138347423.672676, 46323808.94469484 },
+  { 138347316.384315, 46323820.28062905 },
+  { 138347139.35852098, 46323786.27282264 },
+  { 138347058.345178, 46323717.83839254 },
+  { 138347015.976906, 46323616.233623564 },
+  { 138346983.790398, 46323412.18621728 },
+  { 138346932.304114, 46323294.86571657 },
+  { 138346857.78927103, 46323190.16924379 },
+  { 138346758.48484, 46323117.45036768 },
+  { 138346634.24474102, 46323050.29459159 },
+  { 138346479.535103, 46322998.4221914 },
+  { 138346356.15348798, 46322975.750142395 },
+  { 138346259.59396398, 46322975.750142395 },
+  { 138346130.080484, 46323017.62922652 },
+  { 138346039.652824, 46323072.10631659 },
+  { 138345978.672664, 46323137.40218151 },
+  { 138345932.364464, 46323219.47441019 },
+  { 138345931.109999, 46323314.129856005 },
+  { 138345959.186554, 46323389.51425861 },
+  { 138346479.535103, 46323757.93297551 },
+  { 138346537.533988, 46323823.37190075 },
+  { 138346565.36579102, 46323899.632134154 },
+  { 138346651.19648, 46324262.38109982 },
+  { 138346694.111824, 46324347.40020542 },
+  { 138346822.85785702, 46324506.10234994 },
+  { 138347080.349922, 46324727.15136136 },
+  { 138347187.638283, 46324789.49843342 },
+  { 138347375.392914, 46324846.17755748 },
+  { 138347557.783127, 46324846.17755748 },
+  { 138347624.34090102, 46324831.797795855 },
+  { 138347675.800323, 46324800.834260784 },
+  { 138347831.36844602, 46324608.12502901 },
+  { 138347922.563553, 46324494.76649046 },
+  { 138348137.140274, 46324279.38492653 },
+  { 138348383.903503, 46324126.35038604 },
+  { 138348791.59927398, 46323956.3117435 },
+  { 138348930.728788, 46323936.44339773 },
+  { 138349086.64226502, 46323944.9758241 },
+  { 138349370.95642102, 46324024.3272339 },
+  { 138349484.833845, 46324083.85494227 },
+  { 138349564.07547, 46324154.690132804 },
+  { 138349633.812904, 46324245.37727038 },
+  { 138349700.451263, 46324315.02262526 },
+  { 138349715.512774, 46324364.43883859 },
+  { 138349713.927352, 46324444.8448305 },
+  { 138349682.09266698, 46324511.77027908 },
+  { 138349633.812904, 46324545.77784814 },
+  { 138349592.64255401, 46324554.56540639 },
+  { 138349512.578733, 46324522.738075666 },
+  { 138349469.772334, 46324485.88536484 },
+  { 138349440.693855, 46324432.4192416 },
+  { 138349425.38051298, 46324356.06321094 },
+  { 138349392.414093, 46324296.38875038 },
+  { 138349290.49015, 46324222.70549333 },
+  { 138349233.544427, 46324190.22564294 },
+  { 138349177.837372, 46324183.02987176 },
+  { 138349049.091339, 46324188.69781859 },
+  { 138348807.692528, 46324256.71315702 },
+  { 138348555.56488, 46324421.08337407 },
+  { 138348373.174667, 46324608.12502901 },
+  { 138348142.504692, 46325078.5616424 },
+  { 138348008.394241, 46325310.94520771 },
+  { 138347911.834717, 46325435.63861382 },
+  { 138347777.724266, 46325520.6567595 },
+  { 138347573.876381, 46325571.66761355 },
+  { 138347246.64688098, 46325560.33187044 },
+  { 138346940.87505302, 46325611.342704855 },
+  { 138346500.992775, 46325747.371474616 },
+  { 138346222.043037, 46325860.72864659 },
+  { 138345693.29667, 46326208.73562149 },
+  { 138345603.720316, 46326217.11109977 },
+  { 138345510.180406, 46326202.0352382 },
+  { 138345281.87961102, 46326119.117960505 },
 };
 
 #endif